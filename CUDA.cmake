@@ -204,6 +204,53 @@ else()
 
 endif()
 
+find_library(
+  NVML_LIBRARY nvidia-ml
+  PATHS
+  ${CUDA_TOOLKIT_ROOT_DIR}
+  PATH_SUFFIXES
+  lib/x86_64-linux-gnu
+  lib/x64
+  lib64
+  lib
+  lib64/stubs
+  lib/stubs
+  NO_DEFAULT_PATH
+  # We aren't going to search any system paths. We want to find the runtime 
+  # in the CUDA toolkit we're building against.
+  )
+
+if(NOT TARGET nvml AND NVML_LIBRARY)
+
+  message(STATUS "NVML: ${NVML_LIBRARY}")
+
+  if(WIN32)
+    add_library(nvml STATIC IMPORTED GLOBAL)
+    # Even though we're linking against a .dll, in Windows you statically link against
+    # the .lib file found under lib/x64. The .dll will be loaded at runtime automatically
+    # from the PATH search.
+  else()
+    add_library(nvml SHARED IMPORTED GLOBAL)
+  endif()  
+  
+  add_library(nvidia::nvml ALIAS nvml)
+  
+  set_property(
+    TARGET nvml
+    PROPERTY IMPORTED_LOCATION
+    ${NVML_LIBRARY}
+    )
+
+elseif(TARGET nvml)
+
+  message(STATUS "NVML: Already Found")
+
+else()
+
+  message(STATUS "NVML: Not Found")
+
+endif()
+
 include_directories(SYSTEM ${CUDA_INCLUDE_DIRS})
 # Some platforms (e.g. Visual Studio) don't add the CUDA include directories to the system include
 # paths by default, so we add it explicitly here.
@@ -263,11 +310,13 @@ function(cutlass_unify_source_files TARGET_ARGS_VAR)
       string(SUBSTRING ${CUDA_FILE_BATCH_HASH} 0 12 CUDA_FILE_BATCH_HASH)
       set(BATCH_FILE ${CMAKE_CURRENT_BINARY_DIR}/${NAME}.unity.${CUDA_FILE_BATCH_HASH}.cu)
       message(STATUS "Generating ${BATCH_FILE}")
-      file(WRITE ${BATCH_FILE} "// Unity File - Auto Generated!\n")
+      set(BATCH_FILE_CONTENT "// Unity File - Auto Generated!\n")
       foreach(CUDA_FILE ${CUDA_FILE_BATCH})
         get_filename_component(CUDA_FILE_ABS_PATH ${CUDA_FILE} ABSOLUTE)
-        file(APPEND ${BATCH_FILE} "#include \"${CUDA_FILE_ABS_PATH}\"\n")
+        string(APPEND BATCH_FILE_CONTENT "#include \"${CUDA_FILE_ABS_PATH}\"\n")
       endforeach()
+      # Only rewrite the batch file if its content changed, so reconfiguring does not recompile it
+      file(CONFIGURE OUTPUT ${BATCH_FILE} CONTENT "${BATCH_FILE_CONTENT}" @ONLY)
       list(APPEND TARGET_SOURCE_ARGS ${BATCH_FILE})
       if (NUM_CUDA_FILE_ARGS LESS_EQUAL __BATCH_SIZE)
         break()
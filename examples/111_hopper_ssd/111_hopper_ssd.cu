@@ -89,6 +89,7 @@ struct Options {
   int iterations;
   bool verify;
   bool verbose;
+  bool init_state;
 
   int warmups;
   bool measure;
@@ -117,6 +118,7 @@ struct Options {
     cmd.get_cmd_line_argument("E", E, defaults.E);
     cmd.get_cmd_line_argument("H", H, defaults.H);
     verbose = cmd.check_cmd_line_flag("verbose");
+    init_state = cmd.check_cmd_line_flag("init_state");
     verify = !(cmd.check_cmd_line_flag("without_verify"));
 
     EH = E*H;
@@ -139,6 +141,7 @@ struct Options {
       << "  --iterations=<int>          Benchmarking iterations.\n"
       << "  --without_verify            Don't verify the results.\n"
       << "  --verbose                   Print execution time per kernel\n"
+      << "  --init_state                Resume from a random initial state instead of zero\n"
       << "  --G=<int>                   Group\n"
       << "  --B=<int>                   Batch\n"
       << "  --E=<int>                   Expanded factor\n"
@@ -361,6 +364,7 @@ struct TestBed {
   thrust::universal_vector<Element> tensor_Y_ref_0;
   thrust::universal_vector<Element> tensor_Y_ref_1;
   thrust::universal_vector<Element> tensor_F;
+  thrust::universal_vector<Element> tensor_F_init;
   thrust::universal_vector<Element> tensor_F_ref_0;
   thrust::universal_vector<Element> tensor_F_ref_1;
 
@@ -403,6 +407,9 @@ struct TestBed {
     tensor_Y_ref_0.resize(sizeof(Element) * size(options.layoutY()));
     tensor_Y_ref_1.resize(sizeof(Element) * size(options.layoutY()));
     tensor_F      .resize(sizeof(Element) * size(options.layoutF()));
+    if (options.init_state) {
+      tensor_F_init.resize(sizeof(Element) * size(options.layoutF()));
+    }
     tensor_F_ref_0.resize(sizeof(Element) * size(options.layoutF()));
     tensor_F_ref_1.resize(sizeof(Element) * size(options.layoutF()));
 
@@ -416,6 +423,9 @@ struct TestBed {
     initialize_values(tensor_C, init_C, seed + 7);
     initialize_values(tensor_D, init_C, seed + 9);
     initialize_values(tensor_Z, init_X, seed);
+    if (options.init_state) {
+      initialize_values(tensor_F_init, init_X, seed + 11);
+    }
 
     cudaError_t result;
     result = cudaDeviceSynchronize();
@@ -551,7 +561,8 @@ struct TestBed {
         options.layoutX_transformed(),
         options.layoutB_transformed(),
         options.layoutC_transformed(),
-        options.layoutDelta_transformed()
+        options.layoutDelta_transformed(),
+        options.init_state ? tensor_F_init.data().get() : nullptr
       },
       { 
         tensor_Y.data().get(),
@@ -676,7 +687,8 @@ struct TestBed {
         mC,
         mD,
         mZ,
-        options
+        options,
+        options.init_state ? tensor_F_init.data().get() : nullptr
       );
     }
 
@@ -135,8 +135,15 @@ struct SsdMainloopTmaWarpSpecialized {
     cute::array_aligned<Element, get<0>(TileShape{}) * Stages::value> smem_delta;
     cute::array_aligned<ElementDA, get<0>(TileShape{}) * Stages::value> smem_delta_a;
     cute::array_aligned<Element, get<1>(TileShape{}) * Stages::value> smem_d;
+    // Per-chunk segsum factors exp(a_m - a_ref) and exp(a_ref - a_n) * delta_n
+    cute::array_aligned<ElementAcc, get<0>(TileShape{})> smem_segsum_m;
+    cute::array_aligned<ElementAcc, get<0>(TileShape{})> smem_segsum_n;
   };
 
+  // Largest |a_i - a_ref| for which the factorized segsum stays well inside the fp32 range.
+  // Chunks with a larger cumulative decay fall back to evaluating exp(a_m - a_n) per element.
+  static constexpr float kSegsumMaxExponent = 60.f;
+
   using LayoutX     = decltype(make_layout(make_shape(D, L, int32_t(0), int32_t(0)), make_stride(int32_t(0), _1{}, L, int32_t(0))));  // (D,L,C,B)
   using LayoutB     = decltype(make_layout(make_shape(L, N, int32_t(0), int32_t(0)), make_stride(_1{}, int32_t(0), L, int32_t(0))));  // (L,N,C,B)
   using LayoutC     = decltype(make_layout(make_shape(L, N, int32_t(0), int32_t(0)), make_stride(_1{}, int32_t(0), L, int32_t(0))));  // (L,N,C,B)
@@ -157,6 +164,8 @@ struct SsdMainloopTmaWarpSpecialized {
     LayoutB        layout_B{};
     LayoutC        layout_C{};
     LayoutDelta    layout_Delta{};
+    // Optional state [b, eh, d, n] to resume from, laid out like the final state (e.g. a cached decode state)
+    const Element* ptr_InitState{nullptr};
   };
 
   struct Params {
@@ -190,6 +199,7 @@ struct SsdMainloopTmaWarpSpecialized {
     TMA_C         tma_load_c;
     TensorDelta   tensor_delta;
     TensorDeltaA  tensor_delta_a;
+    Element const* ptr_init_state;
   };
 
   template<class ProblemShape>
@@ -249,7 +259,8 @@ struct SsdMainloopTmaWarpSpecialized {
       tma_load_b,
       tma_load_c,
       tensor_delta,
-      tensor_delta_a
+      tensor_delta_a,
+      args.ptr_InitState
     };
   }
 
@@ -701,31 +712,67 @@ struct SsdMainloopTmaWarpSpecialized {
     auto tSR_DeltaA_row = make_tensor<ElementAcc>(shape(tDeltaA_row));
     auto tSR_DeltaA_col = make_tensor<ElementAcc>(shape(tDeltaA_col));
 
+    Layout factor_row_layout = make_layout(make_shape(ts0, ts0), make_stride(_0{}, _1{}));
+    Layout factor_col_layout = make_layout(make_shape(ts0, ts0), make_stride(_1{}, _0{}));
+    Tensor sSegsumM = make_tensor(make_smem_ptr(shared_tensors.smem_segsum_m.data()), factor_col_layout);
+    Tensor sSegsumN = make_tensor(make_smem_ptr(shared_tensors.smem_segsum_n.data()), factor_row_layout);
+
     auto barrier_token = pipeline_delta.consumer_try_wait(pipeline_state_delta);
     pipeline_delta.consumer_wait(pipeline_state_delta, barrier_token);
 
-    // Load delta/delta_a
-    copy(tDelta_row, tSR_Delta_bf16);
-    copy(tDeltaA_row, tSR_DeltaA_row_bf16);
-    copy(tDeltaA_col, tSR_DeltaA_col_bf16);
+    // exp(a_m - a_n) = exp(a_m - a_ref) * exp(a_ref - a_n), so the chunk needs 2L exponentials instead of L*L.
+    // a_ref is the chunk midpoint; the cumsum is monotone, so the endpoints bound every exponent.
+    ElementDA const* ptr_delta_a = shared_tensors.smem_delta_a.data() + read_delta_stage * int(ts0);
+    Element const* ptr_delta = shared_tensors.smem_delta.data() + read_delta_stage * int(ts0);
+    ElementAcc a_ref = static_cast<ElementAcc>(ptr_delta_a[int(ts0) / 2]);
+    bool is_segsum_factorized = fabsf(static_cast<ElementAcc>(ptr_delta_a[0]) - a_ref) <= kSegsumMaxExponent &&
+                                fabsf(static_cast<ElementAcc>(ptr_delta_a[int(ts0) - 1]) - a_ref) <= kSegsumMaxExponent;
+
+    if (is_segsum_factorized) {
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int i = thread_idx; i < int(ts0); i += cutlass::NumThreadsPerWarpGroup) {
+        ElementAcc a_i = static_cast<ElementAcc>(ptr_delta_a[i]);
+        sSegsumM(i,0) = expf(a_i - a_ref);
+        sSegsumN(0,i) = expf(a_ref - a_i) * static_cast<ElementAcc>(ptr_delta[i]);
+      }
+    }
+    else {
+      // Load delta/delta_a
+      copy(tDelta_row, tSR_Delta_bf16);
+      copy(tDeltaA_row, tSR_DeltaA_row_bf16);
+      copy(tDeltaA_col, tSR_DeltaA_col_bf16);
+    }
 
     pipeline_delta.consumer_release(pipeline_state_delta);
     ++pipeline_state_delta;
 
-    // Data convert
-    type_convert<Element, ElementAcc>(tSR_Delta_bf16, tSR_Delta);
-    type_convert<ElementDA, ElementAcc>(tSR_DeltaA_row_bf16, tSR_DeltaA_row);
-    type_convert<ElementDA, ElementAcc>(tSR_DeltaA_col_bf16, tSR_DeltaA_col);
-
     // SegSum
-    #pragma unroll
-    for (int ii = 0; ii < size(tIntra1); ++ii) {
-      ElementAcc tmp(0.f);
-      auto [m,n] = tC(ii);
-      if (m >= n) {
-        tmp = expf(tSR_DeltaA_col(ii) - tSR_DeltaA_row(ii));
+    if (is_segsum_factorized) {
+      synchronize();
+      Tensor tSegsumM = thr_mma.partition_C(sSegsumM);
+      Tensor tSegsumN = thr_mma.partition_C(sSegsumN);
+      #pragma unroll
+      for (int ii = 0; ii < size(tIntra1); ++ii) {
+        auto [m,n] = tC(ii);
+        ElementAcc tmp = (m >= n) ? tSegsumM(ii) * tSegsumN(ii) : ElementAcc(0.f);
+        tIntra1(ii) = tmp * tIntra1(ii);
+      }
+    }
+    else {
+      // Data convert
+      type_convert<Element, ElementAcc>(tSR_Delta_bf16, tSR_Delta);
+      type_convert<ElementDA, ElementAcc>(tSR_DeltaA_row_bf16, tSR_DeltaA_row);
+      type_convert<ElementDA, ElementAcc>(tSR_DeltaA_col_bf16, tSR_DeltaA_col);
+
+      #pragma unroll
+      for (int ii = 0; ii < size(tIntra1); ++ii) {
+        ElementAcc tmp(0.f);
+        auto [m,n] = tC(ii);
+        if (m >= n) {
+          tmp = expf(tSR_DeltaA_col(ii) - tSR_DeltaA_row(ii));
+        }
+        tIntra1(ii) = tmp * tSR_Delta(ii) * tIntra1(ii);
       }
-      tIntra1(ii) = tmp * tSR_Delta(ii) * tIntra1(ii);
     }
 
     synchronize();
@@ -948,10 +995,11 @@ struct SsdMainloopTmaWarpSpecialized {
   }
 
   template<
+    class Params,
     class TensorStorage
   >
   CUTLASS_DEVICE
-  auto state_init(TensorStorage& shared_tensors) {
+  auto state_init(Params const& params, int const& blk_coord, TensorStorage& shared_tensors) {
     TiledMmaInter1 tiled_mma;
     Tensor tensor_state = partition_fragment_C(tiled_mma, take<0, 2>(TileShapeInterBMM1{}));
 
@@ -969,11 +1017,22 @@ struct SsdMainloopTmaWarpSpecialized {
     using CopyOpR2S = SM90_U16x8_STSM_T;
     TiledCopy tiled_r2s = make_tiled_copy_S(Copy_Atom<CopyOpR2S, Element>{}, tiled_r2s_atom);
     ThrCopy thread_r2s = tiled_r2s.get_slice(thread_idx);
-    Tensor tRS_rP = make_tensor<Element>(shape(thread_r2s.partition_S(sP)));
     Tensor tRS_sP = thread_r2s.partition_D(sP);
 
-    clear(tRS_rP);
     clear(tensor_state);
+    if (params.ptr_init_state != nullptr) {
+      // Resume the recurrence from the given state instead of zero
+      Tensor mInit = make_tensor(make_gmem_ptr(params.ptr_init_state + int64_t(blk_coord) * int64_t(N * D)),
+                                 make_layout(make_shape(N, D), make_stride(_1{}, N)));                  // (N, D)
+      Tensor tCcInit = tiled_mma.get_thread_slice(thread_idx).partition_C(make_identity_tensor(shape(mInit)));
+      CUTLASS_PRAGMA_UNROLL
+      for (int ii = 0; ii < size(tensor_state); ++ii) {
+        tensor_state(ii) = static_cast<ElementAcc>(mInit(tCcInit(ii)));
+      }
+    }
+    auto tP = make_tensor<Element>(shape(tensor_state));
+    type_convert<ElementAcc, Element>(tensor_state, tP);
+    Tensor tRS_rP = thread_r2s.retile_S(tP);
     // Store P
     copy(tiled_r2s, tRS_rP, tRS_sP);
 
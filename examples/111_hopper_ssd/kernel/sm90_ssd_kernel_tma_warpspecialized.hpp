@@ -471,7 +471,7 @@ struct SsdKernelTmaWarpSpecialized {
       TileScheduler tile_scheduler{params.tile_scheduler};
       cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto [tState] = collective_mainloop.state_init(storage.tensors.mainloop);
+        auto [tState] = collective_mainloop.state_init(params.mainloop, tile_scheduler.get_block_coord(), storage.tensors.mainloop);
         auto blk_coord_eh = tile_scheduler.get_block_coord_eh();
         bool is_first_iteration = true;
         for (int chunk = 0; chunk < C; ++chunk) {
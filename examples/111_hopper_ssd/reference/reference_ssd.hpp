@@ -174,7 +174,7 @@ void ssd_reference_impl(
     TensorY mY, TensorF mF,
     TensorX mX, TensorDelta mDelta, TensorDeltaA mDeltaA,
     TensorB mB, TensorC mC, TensorD mD, TensorZ mZ,
-    Params params) {
+    Params params, typename Params::Element const* ptr_init_state = nullptr) {
 
   using namespace cute;
   using Element = typename Params::Element;
@@ -187,8 +187,10 @@ void ssd_reference_impl(
   // C       [b,  g, n, c, l]
   // y       [b, eh, d, c, l]
   // fstate  [b, eh, d, n]
+  // istate  [b, eh, d, n] (optional)
   // d       [   eh, d]
   auto [G, B, EH, C, L, D, N] = params.get_problem_shape();
+  auto mInit = make_tensor(ptr_init_state, mF.layout());
   int group_ratio = EH / G;
   for (int b = 0; b < B; ++b) {
     for (int eh = 0; eh < EH; ++eh) {
@@ -261,7 +263,7 @@ void ssd_reference_impl(
         for (int ni = 0; ni < N; ++ ni){
           for (int di = 0; di < D; ++di) {
             if (ci == 0) {
-              tInterBMM2_inp(ci, ni, di) = 0;
+              tInterBMM2_inp(ci, ni, di) = ptr_init_state != nullptr ? static_cast<float>(mInit(b, eh, di, ni)) : 0.f;
             }
             else {
               tInterBMM2_inp(ci, ni, di) = tInterBMM1_out(ci - 1, ni, di) + expf(tLast(ci - 1)) * tInterBMM2_inp(ci - 1, ni, di);
@@ -338,8 +340,8 @@ void ssd_reference(
     TensorY mY, TensorF mF,
     TensorX mX, TensorDelta mDelta, TensorDeltaA mDeltaA,
     TensorB mB, TensorC mC, TensorD mD, TensorZ mZ,
-    Params params) {
-  ssd_reference_impl<HAS_D, D_HAS_HDIM, HAS_Z>(mY, mF, mX, mDelta, mDeltaA, mB, mC, mD, mZ, params);
+    Params params, typename Params::Element const* ptr_init_state = nullptr) {
+  ssd_reference_impl<HAS_D, D_HAS_HDIM, HAS_Z>(mY, mF, mX, mDelta, mDeltaA, mB, mC, mD, mZ, params, ptr_init_state);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,15 +147,28 @@ struct SsdMainloopTmaWarpSpecialized {
     cute::array_aligned<Element, get<0>(TileShape{}) * StagesInput> smem_delta;
     cute::array_aligned<ElementDA, get<0>(TileShape{}) * StagesInput> smem_delta_a;
     cute::array_aligned<Element, get<1>(TileShape{}) * StagesInput> smem_d;
+    // Per-chunk segsum factors exp(a_m - a_ref) and exp(a_ref - a_n) * delta_n, one buffer per delta stage
+    cute::array_aligned<ElementAcc, get<0>(TileShape{}) * StagesInput> smem_segsum_m;
+    cute::array_aligned<ElementAcc, get<0>(TileShape{}) * StagesInput> smem_segsum_n;
   };
 
-  // TMEM management (for LDN = 128x64x128)
-  static constexpr uint32_t tmem_intra_1_Acc = 0;
-  static constexpr uint32_t tmem_intra_2_A   = tmem_intra_1_Acc + 128;
-  static constexpr uint32_t tmem_intra_2_Acc = tmem_intra_2_A   +  64;
-  static constexpr uint32_t tmem_inter_1_A   = tmem_intra_2_Acc +  64;
-  static constexpr uint32_t tmem_inter_1_Acc = tmem_inter_1_A   +  64;
-  static constexpr uint32_t tmem_inter_2_Acc = tmem_inter_1_Acc +  64;
+  // TMEM management. All operands live in TMEM at once, so the column offsets follow from the tile shape:
+  // fp32 accumulators take one column per output column and 16b A operands take one column per two K elements.
+  static constexpr uint32_t kTmemColsPerPackedK = 32 / sizeof_bits_v<Element>;
+  static constexpr uint32_t tmem_intra_1_Acc = 0;                                                    // (L,L) fp32
+  static constexpr uint32_t tmem_intra_2_A   = tmem_intra_1_Acc + uint32_t(L);                        // (L,L) Q
+  static constexpr uint32_t tmem_intra_2_Acc = tmem_intra_2_A   + uint32_t(L) / kTmemColsPerPackedK;  // (L,D) fp32
+  static constexpr uint32_t tmem_inter_1_A   = tmem_intra_2_Acc + uint32_t(D);                        // (N,L) B^T
+  static constexpr uint32_t tmem_inter_1_Acc = tmem_inter_1_A   + uint32_t(L) / kTmemColsPerPackedK;  // (N,D) fp32
+  static constexpr uint32_t tmem_inter_2_Acc = tmem_inter_1_Acc + uint32_t(D);                        // (L,D) fp32
+  static constexpr uint32_t tmem_end         = tmem_inter_2_Acc + uint32_t(D);
+
+  static_assert(int(L) == 128 && int(N) == 128, "The 1SM UMMA tiles map L and N onto all 128 TMEM lanes");
+  static_assert(tmem_end <= 512, "Chunk size and head dim exceed the TMEM capacity (2L + 3D <= 512 columns)");
+
+  // Largest |a_i - a_ref| for which the factorized segsum stays well inside the fp32 range.
+  // Chunks with a larger cumulative decay fall back to evaluating exp(a_m - a_n) per element.
+  static constexpr float kSegsumMaxExponent = 60.f;
 
   using StrideX     = cute::tuple<int, _1, int, int>;     // (D,L,C,B)
   using StrideB     = cute::tuple<_1, int, int, int>;     // (L,N,C,B)
@@ -182,6 +195,8 @@ struct SsdMainloopTmaWarpSpecialized {
     LayoutB        layout_B{};
     LayoutC        layout_C{};
     LayoutDelta    layout_Delta{};
+    // Optional state [b, eh, d, n] to resume from, laid out like the final state (e.g. a cached decode state)
+    const Element* ptr_InitState{nullptr};
   };
 
   template <class TensorX, class ClusterShapeVMNK>
@@ -248,6 +263,7 @@ struct SsdMainloopTmaWarpSpecialized {
     TMA_C         tma_load_c;
     TensorDelta   tensor_delta;
     TensorDeltaA  tensor_delta_a;
+    Element const* ptr_init_state;
   };
 
   template<class ProblemShape>
@@ -298,7 +314,8 @@ struct SsdMainloopTmaWarpSpecialized {
       tma_load_b,
       tma_load_c,
       tensor_delta,
-      tensor_delta_a
+      tensor_delta_a,
+      args.ptr_InitState
     };
   }
 
@@ -783,11 +800,13 @@ struct SsdMainloopTmaWarpSpecialized {
   }
 
   template<
+    class Params,
     class FragmentC_1, class FragmentC_2,
     class TensorStorage
   >
   CUTLASS_DEVICE
   auto state_init(
+    Params const& params, int const& blk_coord,
     cute::tuple<FragmentC_1, FragmentC_2>& acc_inter,
     TensorStorage& shared_tensors) {
 
@@ -809,6 +828,17 @@ struct SsdMainloopTmaWarpSpecialized {
 
     clear(tTR_rP);
     clear(tTR_rP_compute);
+    if (params.ptr_init_state != nullptr) {
+      // Resume the recurrence from the given state instead of zero
+      Tensor mInit = make_tensor(make_gmem_ptr(params.ptr_init_state + int64_t(blk_coord) * int64_t(N * D)),
+                                 make_layout(make_shape(N, D), make_stride(_1{}, N)));                  // (N, D)
+      auto tTR_cInit = thr_t2r.partition_D(make_identity_tensor(shape(mInit)));
+      CUTLASS_PRAGMA_UNROLL
+      for (int ii = 0; ii < size(tTR_rP); ++ii) {
+        tTR_rP(ii) = mInit(tTR_cInit(ii));
+      }
+      type_convert<Element, ElementAcc>(tTR_rP, tTR_rP_compute);
+    }
 
     auto tiled_r2s = make_tiled_copy_D(Copy_Atom<CopyOpR2S, Element>{}, tiled_t2r);
     auto thr_r2s = tiled_r2s.get_slice(thread_idx);
@@ -1094,11 +1124,43 @@ struct SsdMainloopTmaWarpSpecialized {
     type_convert<ElementDA, ElementAcc>(tQrDeltaA_Col, tCrDeltaA_Col);
 
     // SegSum
-    #pragma unroll
-    for (int ii = 0; ii < size(tTR_rQ); ++ii) {
-      ElementAcc tmp(0);
-      tmp = tQrDeltaA_Col(ii) - tCrDeltaA_Row(ii);
-      tCompute(ii) = expf(tmp) * tCrDelta(ii) * tTR_rQ(ii);
+    // exp(a_m - a_n) = exp(a_m - a_ref) * exp(a_ref - a_n), so the chunk needs 2L exponentials instead of L*L.
+    // a_ref is the chunk midpoint; the cumsum is monotone, so the endpoints bound every exponent.
+    int read_delta_stage = pipeline_delta_consumer_state.index();
+    ElementDA const* ptr_delta_a = shared_tensors.smem_delta_a.data() + read_delta_stage * int(ts0);
+    Element const* ptr_delta = shared_tensors.smem_delta.data() + read_delta_stage * int(ts0);
+    ElementAcc a_ref = static_cast<ElementAcc>(ptr_delta_a[int(ts0) / 2]);
+    bool is_segsum_factorized = fabsf(static_cast<ElementAcc>(ptr_delta_a[0]) - a_ref) <= kSegsumMaxExponent &&
+                                fabsf(static_cast<ElementAcc>(ptr_delta_a[int(ts0) - 1]) - a_ref) <= kSegsumMaxExponent;
+
+    Tensor sSegsumM = make_tensor(make_smem_ptr(shared_tensors.smem_segsum_m.data()), col_layout);
+    Tensor sSegsumN = make_tensor(make_smem_ptr(shared_tensors.smem_segsum_n.data()), row_layout);
+    if (is_segsum_factorized) {
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int i = thread_idx; i < int(ts0); i += cutlass::NumThreadsPerWarpGroup) {
+        ElementAcc a_i = static_cast<ElementAcc>(ptr_delta_a[i]);
+        sSegsumM(i,0,read_delta_stage) = expf(a_i - a_ref);
+        sSegsumN(0,i,read_delta_stage) = expf(a_ref - a_i) * static_cast<ElementAcc>(ptr_delta[i]);
+      }
+    }
+    // Unconditional so that the factors of stage s are not overwritten while the chunk two steps back still reads them
+    cutlass::arch::NamedBarrier::sync(cutlass::NumThreadsPerWarpGroup, cutlass::arch::ReservedNamedBarriers::TransformBarrier);
+
+    if (is_segsum_factorized) {
+      auto tQsSegsumM = thr_t2r.partition_D(sSegsumM)(_,_,_,read_delta_stage);
+      auto tQsSegsumN = thr_t2r.partition_D(sSegsumN)(_,_,_,read_delta_stage);
+      #pragma unroll
+      for (int ii = 0; ii < size(tTR_rQ); ++ii) {
+        tCompute(ii) = tQsSegsumM(ii) * tQsSegsumN(ii) * tTR_rQ(ii);
+      }
+    }
+    else {
+      #pragma unroll
+      for (int ii = 0; ii < size(tTR_rQ); ++ii) {
+        ElementAcc tmp(0);
+        tmp = tQrDeltaA_Col(ii) - tCrDeltaA_Row(ii);
+        tCompute(ii) = expf(tmp) * tCrDelta(ii) * tTR_rQ(ii);
+      }
     }
     #pragma unroll
     for (int ii = 0; ii < size(tTR_rQ); ++ii) {
@@ -493,7 +493,7 @@ struct SsdKernelTmaWarpSpecialized {
     }
     else if (warp_category == WarpCategory::PreInter) {
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
-        auto [tState] = collective_mainloop.state_init(mma_output_inter, storage.tensors.mainloop);
+        auto [tState] = collective_mainloop.state_init(params.mainloop, tile_scheduler.get_block_coord(), mma_output_inter, storage.tensors.mainloop);
         for (int chunk = 0; chunk < C; ++chunk) {
           collective_mainloop.pre_inter(
             pipeline_b, mainloop_pipe_b_consumer,
@@ -42,10 +42,12 @@
 
 #include "cute/tensor.hpp"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/sm90_gated_collective_builder.hpp"
 #include "cutlass/epilogue/fusion/operations.hpp"
 #include "cutlass/epilogue/thread/activation.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/sm90_gated_collective_builder.hpp"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 #include "cutlass/gemm/kernel/gemm_universal.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler_params.h"
@@ -60,8 +62,6 @@
 #include "helper.h"
 #include "options.hpp"
 #include "utils.hpp"
-#include "gated_stride.hpp"
-#include "gated_builder.hpp"
 #include "activation_kernel.cuh"
 
 using namespace cute;
@@ -78,6 +78,12 @@ using ActivationFn = cutlass::epilogue::thread::ReLu<T>;
 #elif 1
 template<class T>
 using ActivationFn = cutlass::epilogue::thread::SiLu<T>;
+#elif 0
+template<class T>
+using ActivationFn = cutlass::epilogue::thread::GELU<T>;
+#elif 0
+template<class T>
+using ActivationFn = cutlass::epilogue::thread::SquaredReLu<T>;
 #else
 template<class T>
 using ActivationFn = cutlass::epilogue::thread::Identity<T>;
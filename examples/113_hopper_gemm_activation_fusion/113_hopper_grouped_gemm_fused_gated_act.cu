@@ -43,11 +43,13 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/sm90_gated_collective_builder.hpp"
 #include "cutlass/epilogue/fusion/operations.hpp"
 #include "cutlass/epilogue/thread/activation.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
 #include "cutlass/gemm/group_array_problem_shape.hpp"
 #include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/sm90_gated_collective_builder.hpp"
 #include "cutlass/gemm/kernel/gemm_universal.hpp"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 
@@ -62,8 +64,6 @@
 #include "options.hpp"
 #include "utils.hpp"
 #include "tile_scheduler_group.hpp"
-#include "gated_stride.hpp"
-#include "gated_builder.hpp"
 #include "activation_kernel.cuh"
 
 using namespace cute;
@@ -80,6 +80,12 @@ using ActivationFn = cutlass::epilogue::thread::ReLu<T>;
 #elif 1
 template<class T>
 using ActivationFn = cutlass::epilogue::thread::SiLu<T>;
+#elif 0
+template<class T>
+using ActivationFn = cutlass::epilogue::thread::GELU<T>;
+#elif 0
+template<class T>
+using ActivationFn = cutlass::epilogue::thread::SquaredReLu<T>;
 #else
 template<class T>
 using ActivationFn = cutlass::epilogue::thread::Identity<T>;
@@ -62,6 +62,12 @@ std::string activation_func_string() {
   else if constexpr (cute::is_same_v<cutlass::epilogue::thread::SiLu<float>, ActFn<float>>) {
     return "SiLU";
   }
+  else if constexpr (cute::is_same_v<cutlass::epilogue::thread::GELU<float>, ActFn<float>>) {
+    return "GELU";
+  }
+  else if constexpr (cute::is_same_v<cutlass::epilogue::thread::SquaredReLu<float>, ActFn<float>>) {
+    return "ReLU^2";
+  }
   else if constexpr (cute::is_same_v<cutlass::epilogue::thread::Identity<float>, ActFn<float>>) {
     return "None";
   }
@@ -0,0 +1,399 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Hopper GEMM whose device code is compiled at runtime with NVRTC
+
+    This example shows how to ship only the host side of a CUTLASS 3.x kernel and compile its device
+    code at runtime for the configuration it is launched with.
+
+    1. The library emits the source of a GemmUniversal for a cutlass::library::GemmDescription
+       (cutlass/library/runtime_gemm_source.h). Tile shape, cluster shape and alignments become
+       compile-time constants of the emitted kernel.
+
+    2. cutlass::nvrtc::CompiledModule (cutlass/util/nvrtc_runtime.hpp) compiles it with NVRTC and
+       keeps the cubin in an on-disk cache keyed by the source, the options and the NVRTC version.
+       A second run with the same --cache_dir loads the cubin without invoking NVRTC.
+
+    3. This file is compiled with CUTLASS_ENABLE_CUDA_HOST_ADAPTER=1, so GemmUniversalAdapter builds
+       Params on the host and launches through cutlass::nvrtc::HostAdapter instead of a <<<>>> launch
+       of device code compiled ahead of time. The host declaration of the kernel has to match the
+       emitted one; the sizes of Params and SharedStorage exported by the compiled module are checked
+       before launching.
+
+    Examples:
+
+      $ ./examples/114_hopper_runtime_compiled_gemm/114_hopper_runtime_compiled_gemm --m=2048 --n=2048 --k=2048 --cache_dir=/tmp
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/runtime_gemm_source.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/nvrtc_runtime.hpp"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// These must agree with the GemmDescription built in make_description()
+using         ElementA    = cutlass::half_t;
+using         LayoutA     = cutlass::layout::RowMajor;
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;
+
+using         ElementB    = cutlass::half_t;
+using         LayoutB     = cutlass::layout::ColumnMajor;
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;
+
+using         ElementC    = cutlass::half_t;
+using         LayoutC     = cutlass::layout::ColumnMajor;
+constexpr int AlignmentC  = 128 / cutlass::sizeof_bits<ElementC>::value;
+
+using ElementAccumulator  = float;
+using ArchTag             = cutlass::arch::Sm90;
+using OperatorClass       = cutlass::arch::OpClassTensorOp;
+using TileShape           = Shape<_128,_128,_64>;
+using ClusterShape        = Shape<_2,_1,_1>;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    TileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC, AlignmentC,
+    ElementC, LayoutC, AlignmentC,
+    cutlass::epilogue::collective::EpilogueScheduleAuto
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    cutlass::gemm::collective::KernelScheduleAuto
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>,
+    CollectiveMainloop,
+    CollectiveEpilogue,
+    void>;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+static_assert(Gemm::kEnableCudaHostAdapter, "This example must be compiled with CUTLASS_ENABLE_CUDA_HOST_ADAPTER=1");
+
+using StrideA = typename Gemm::GemmKernel::StrideA;
+using StrideB = typename Gemm::GemmKernel::StrideB;
+using StrideC = typename Gemm::GemmKernel::StrideC;
+using StrideD = typename Gemm::GemmKernel::StrideD;
+
+/// Description of the kernel above, as the library would record it
+cutlass::library::GemmDescription make_description() {
+  using namespace cutlass::library;
+
+  GemmDescription desc(
+    GemmKind::kUniversal,
+    TensorDescription(NumericTypeID::kF16, LayoutTypeID::kRowMajor, AlignmentA),
+    TensorDescription(NumericTypeID::kF16, LayoutTypeID::kColumnMajor, AlignmentB),
+    TensorDescription(NumericTypeID::kF16, LayoutTypeID::kColumnMajor, AlignmentC),
+    TensorDescription(NumericTypeID::kF16, LayoutTypeID::kColumnMajor, AlignmentC),
+    NumericTypeID::kF32);
+
+  desc.name = "114_hopper_runtime_compiled_gemm";
+  desc.provider = Provider::kCUTLASS;
+  desc.kind = OperationKind::kGemm;
+  desc.tile_description.threadblock_shape = cutlass::gemm::GemmCoord(128, 128, 64);
+  desc.tile_description.cluster_shape = cutlass::gemm::GemmCoord(2, 1, 1);
+  desc.tile_description.minimum_compute_capability = 90;
+  desc.tile_description.maximum_compute_capability = 90;
+  desc.tile_description.math_instruction.element_accumulator = NumericTypeID::kF32;
+  desc.tile_description.math_instruction.opcode_class = OpcodeClassID::kTensorOp;
+  return desc;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  float alpha = 1.f, beta = 0.f;
+  int iterations = 10;
+  int m = 4096, n = 4096, k = 4096;
+  std::string cache_dir;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.f);
+    cmd.get_cmd_line_argument("beta", beta, 0.f);
+    cmd.get_cmd_line_argument("iterations", iterations);
+    cmd.get_cmd_line_argument("cache_dir", cache_dir);
+  }
+
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "114_hopper_runtime_compiled_gemm\n\n"
+      << "  Hopper FP16 GEMM whose device code is compiled at runtime with NVRTC.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM\n"
+      << "  --alpha=<f32>               Epilogue scalar alpha\n"
+      << "  --beta=<f32>                Epilogue scalar beta\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform\n"
+      << "  --cache_dir=<path>          Directory of the cubin cache (defaults to $CUTLASS_NVRTC_CACHE_DIR)\n\n";
+
+    return out;
+  }
+
+  double gflops(double runtime_s) const {
+    return 2.0 * double(m) * double(n) * double(k) / double(1.0e9) / runtime_s;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Compiles the kernel of make_description() and checks it against the host declaration
+bool compile_kernel(Options const &options, cutlass::nvrtc::CompiledModule &module) {
+
+  std::string source;
+  cutlass::Status status = cutlass::library::emit_gemm_universal_3x_source(make_description(), source);
+  if (status != cutlass::Status::kSuccess) {
+    std::cerr << "Failed to emit the kernel source: " << cutlassGetStatusString(status) << std::endl;
+    return false;
+  }
+
+  cutlass::nvrtc::CompileOptions compile_options;
+  compile_options.include_paths = {CUTLASS_EXAMPLE_114_CUTLASS_INCLUDE_DIR, CUTLASS_EXAMPLE_114_CUDA_INCLUDE_DIR};
+  compile_options.defines = {"NDEBUG"};
+  compile_options.cache_dir = options.cache_dir;
+
+  status = module.compile(source, {cutlass::library::kRuntimeGemmEntryPoint}, compile_options);
+  if (status != cutlass::Status::kSuccess) {
+    std::cerr << "NVRTC compilation failed:\n" << module.log() << std::endl;
+    return false;
+  }
+  std::cout << "  Kernel " << (module.loaded_from_cache() ? "loaded from the cache" : "compiled with NVRTC") << std::endl;
+
+  uint64_t params_size = 0;
+  uint32_t shared_storage_size = 0;
+  uint32_t max_threads = 0;
+  if (module.get_global(cutlass::library::kRuntimeGemmParamsSizeSymbol, &params_size, sizeof(params_size)) != cutlass::Status::kSuccess ||
+      module.get_global(cutlass::library::kRuntimeGemmSharedStorageSizeSymbol, &shared_storage_size, sizeof(shared_storage_size)) != cutlass::Status::kSuccess ||
+      module.get_global(cutlass::library::kRuntimeGemmMaxThreadsSymbol, &max_threads, sizeof(max_threads)) != cutlass::Status::kSuccess) {
+    std::cerr << "The compiled module does not export the kernel sizes" << std::endl;
+    return false;
+  }
+
+  if (params_size != sizeof(typename GemmKernel::Params) ||
+      shared_storage_size != uint32_t(GemmKernel::SharedStorageSize) ||
+      max_threads != uint32_t(GemmKernel::MaxThreadsPerBlock)) {
+    std::cerr << "The compiled kernel does not match its host declaration" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+/// Execute the runtime compiled GEMM and verify it against a reference
+int run(Options &options) {
+
+  cutlass::nvrtc::CompiledModule module;
+  if (!compile_kernel(options, module)) {
+    return -1;
+  }
+  cutlass::nvrtc::HostAdapter adapter(module.function(cutlass::library::kRuntimeGemmEntryPoint));
+
+  int64_t size_A = int64_t(options.m) * options.k;
+  int64_t size_B = int64_t(options.k) * options.n;
+  int64_t size_C = int64_t(options.m) * options.n;
+
+  cutlass::DeviceAllocation<ElementA> block_A(size_A);
+  cutlass::DeviceAllocation<ElementB> block_B(size_B);
+  cutlass::DeviceAllocation<ElementC> block_C(size_C);
+  cutlass::DeviceAllocation<ElementC> block_D(size_C);
+  cutlass::DeviceAllocation<ElementC> block_ref_D(size_C);
+
+  cutlass::reference::device::BlockFillRandomUniform(block_A.get(), size_A, 2023, ElementA(2), ElementA(-2), 0);
+  cutlass::reference::device::BlockFillRandomUniform(block_B.get(), size_B, 2024, ElementB(2), ElementB(-2), 0);
+  cutlass::reference::device::BlockFillRandomUniform(block_C.get(), size_C, 2025, ElementC(2), ElementC(-2), 0);
+
+  StrideA stride_A = cutlass::make_cute_packed_stride(StrideA{}, {options.m, options.k, 1});
+  StrideB stride_B = cutlass::make_cute_packed_stride(StrideB{}, {options.n, options.k, 1});
+  StrideC stride_C = cutlass::make_cute_packed_stride(StrideC{}, {options.m, options.n, 1});
+  StrideD stride_D = cutlass::make_cute_packed_stride(StrideD{}, {options.m, options.n, 1});
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.m, options.n, options.k, 1},
+    {block_A.get(), stride_A, block_B.get(), stride_B},
+    {{options.alpha, options.beta}, block_C.get(), stride_C, block_D.get(), stride_D}
+  };
+
+  Gemm gemm;
+
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get(), nullptr, &adapter));
+  CUTLASS_CHECK(gemm.run(nullptr, &adapter));
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Reference computed with a device GEMM
+  cutlass::TensorRef ref_A(block_A.get(), cutlass::layout::RowMajor::packed({options.m, options.k}));
+  cutlass::TensorRef ref_B(block_B.get(), cutlass::layout::ColumnMajor::packed({options.k, options.n}));
+  cutlass::TensorRef ref_C(block_C.get(), cutlass::layout::ColumnMajor::packed({options.m, options.n}));
+  cutlass::TensorRef ref_D(block_ref_D.get(), cutlass::layout::ColumnMajor::packed({options.m, options.n}));
+
+  cutlass::reference::device::Gemm<
+    ElementA, LayoutA,
+    ElementB, LayoutB,
+    ElementC, LayoutC,
+    ElementAccumulator, ElementAccumulator> gemm_reference;
+
+  gemm_reference(
+    {options.m, options.n, options.k},
+    ElementAccumulator(options.alpha),
+    ref_A,
+    ref_B,
+    ElementAccumulator(options.beta),
+    ref_C,
+    ref_D);
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  bool passed = cutlass::reference::device::BlockCompareEqual(block_ref_D.get(), block_D.get(), size_C);
+
+  std::cout << "  Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << std::endl;
+  std::cout << "  Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+  if (!passed) {
+    return -1;
+  }
+
+  if (options.iterations > 0) {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(gemm.run(nullptr, &adapter));
+    }
+    timer.stop();
+
+    float elapsed_ms = timer.elapsed_millis();
+    double avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    std::cout << "  Avg runtime: " << avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS: " << options.gflops(avg_runtime_ms / 1000.0) << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture (compute capability 90).\n";
+    return 0;
+  }
+
+  // The driver API used by the module and the adapter needs a current context
+  CUDA_CHECK(cudaFree(nullptr));
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  return run(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,449 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Hopper persistent kernel executing a chain of dependent GEMMs as one grouped GEMM
+
+    At small batch, each GEMM of a transformer layer runs for a few microseconds, and launch
+    latency and the tail of each kernel dominate. This example runs a chain of GEMMs
+
+      X_1 = X_0 * W_0^T,  X_2 = X_1 * W_1^T,  ...
+
+    as the groups of one ptr-array grouped GEMM whose collectives are wrapped by
+    cutlass::gemm_dag::kernel::GemmDagKernel. The epilogue counts the tiles stored in each row of
+    tiles of X_i, and the tiles of group i+1 start as soon as the row of X_i they read is complete,
+    while other CTAs are still computing the rest of X_i.
+
+    The chain is compared against one launch per GEMM of the same kernel.
+
+    Examples:
+
+      $ ./examples/115_hopper_gemm_dag_megakernel/115_hopper_gemm_dag_megakernel --m=128 --dims=4096,11008,4096
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/experimental/gemm_dag/kernel/dag_collectives.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ProblemShape = cutlass::gemm::GroupProblemShape<Shape<int,int,int>>; // <M,N,K> per group
+
+// The output of a GEMM is the A operand of the next one: both are row-major and of the same type
+using         ElementA    = cutlass::half_t;
+using         LayoutA     = cutlass::layout::RowMajor;
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;
+
+// Weights are N x K, K-major
+using         ElementB    = cutlass::half_t;
+using         LayoutB     = cutlass::layout::ColumnMajor;
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;
+
+using         ElementD    = ElementA;
+using         LayoutD     = LayoutA;
+constexpr int AlignmentD  = AlignmentA;
+
+using ElementAccumulator  = float;
+using TileShape           = Shape<_128,_128,_64>;
+using ClusterShape        = Shape<_1,_1,_1>;
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    TileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    void, LayoutD *, AlignmentD,
+    ElementD, LayoutD *, AlignmentD,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative,
+    cutlass::epilogue::fusion::LinearCombination<ElementD, ElementAccumulator>
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+    ElementA, LayoutA *, AlignmentA,
+    ElementB, LayoutB *, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative
+  >::CollectiveOp;
+
+using GroupedGemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    ProblemShape,
+    CollectiveMainloop,
+    CollectiveEpilogue
+  >;
+
+using GemmKernel = typename cutlass::gemm_dag::kernel::GemmDagKernel<GroupedGemmKernel>::type;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+using StrideA = typename Gemm::GemmKernel::InternalStrideA;
+using StrideB = typename Gemm::GemmKernel::InternalStrideB;
+using StrideD = typename Gemm::GemmKernel::InternalStrideD;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  int m = 128;
+  std::vector<int> dims{4096, 11008, 4096, 4096};
+  int iterations = 100;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("iterations", iterations);
+    cmd.get_cmd_line_arguments("dims", dims);
+  }
+
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "115_hopper_gemm_dag_megakernel\n\n"
+      << "  Hopper chain of dependent GEMMs executed by one persistent kernel.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Rows of the activations (tokens)\n"
+      << "  --dims=<int,int,...>        Feature dimensions of the chain: GEMM i is m x dims[i+1] x dims[i]\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform\n\n";
+
+    return out;
+  }
+
+  int groups() const { return static_cast<int>(dims.size()) - 1; }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Chain {
+  std::vector<ProblemShape::UnderlyingProblemShape> problem_sizes_host;
+  cutlass::DeviceAllocation<ProblemShape::UnderlyingProblemShape> problem_sizes;
+
+  // Activations X_0 ... X_groups, and weights W_0 ... W_groups-1
+  std::vector<cutlass::DeviceAllocation<ElementA>> activations;
+  std::vector<cutlass::DeviceAllocation<ElementB>> weights;
+  std::vector<cutlass::DeviceAllocation<ElementD>> reference;
+
+  cutlass::DeviceAllocation<ElementA const*> ptr_A;
+  cutlass::DeviceAllocation<ElementB const*> ptr_B;
+  cutlass::DeviceAllocation<ElementD*> ptr_D;
+  cutlass::DeviceAllocation<StrideA> stride_A;
+  cutlass::DeviceAllocation<StrideB> stride_B;
+  cutlass::DeviceAllocation<StrideD> stride_D;
+
+  cutlass::DeviceAllocation<cutlass::gemm_dag::GemmDagNode> dag_nodes;
+  cutlass::DeviceAllocation<uint32_t> counters;
+  uint32_t epoch = 0;
+
+  void initialize(Options const& options) {
+    int groups = options.groups();
+    int m = options.m;
+
+    std::vector<ElementA const*> ptr_A_host(groups);
+    std::vector<ElementB const*> ptr_B_host(groups);
+    std::vector<ElementD*> ptr_D_host(groups);
+    std::vector<StrideA> stride_A_host(groups);
+    std::vector<StrideB> stride_B_host(groups);
+    std::vector<StrideD> stride_D_host(groups);
+    std::vector<int> producers(groups);
+
+    activations.resize(groups + 1);
+    weights.resize(groups);
+    reference.resize(groups + 1);
+
+    activations[0].reset(size_t(m) * options.dims[0]);
+    cutlass::reference::device::BlockFillRandomUniform(
+      activations[0].get(), activations[0].size(), 2023, ElementA(1), ElementA(-1), 0);
+
+    for (int i = 0; i < groups; ++i) {
+      int n = options.dims[i + 1];
+      int k = options.dims[i];
+      problem_sizes_host.push_back({m, n, k});
+
+      weights[i].reset(size_t(n) * k);
+      // Scaled so the activations stay in range along the chain
+      cutlass::reference::device::BlockFillRandomUniform(
+        weights[i].get(), weights[i].size(), 2024 + i, ElementB(2.f / k), ElementB(-2.f / k), -1);
+      activations[i + 1].reset(size_t(m) * n);
+      reference[i + 1].reset(size_t(m) * n);
+
+      ptr_A_host[i] = activations[i].get();
+      ptr_B_host[i] = weights[i].get();
+      ptr_D_host[i] = activations[i + 1].get();
+      stride_A_host[i] = cutlass::make_cute_packed_stride(StrideA{}, {m, k, 1});
+      stride_B_host[i] = cutlass::make_cute_packed_stride(StrideB{}, {n, k, 1});
+      stride_D_host[i] = cutlass::make_cute_packed_stride(StrideD{}, {m, n, 1});
+      producers[i] = i - 1;
+    }
+
+    problem_sizes.reset(groups);
+    problem_sizes.copy_from_host(problem_sizes_host.data());
+    ptr_A.reset(groups);
+    ptr_A.copy_from_host(ptr_A_host.data());
+    ptr_B.reset(groups);
+    ptr_B.copy_from_host(ptr_B_host.data());
+    ptr_D.reset(groups);
+    ptr_D.copy_from_host(ptr_D_host.data());
+    stride_A.reset(groups);
+    stride_A.copy_from_host(stride_A_host.data());
+    stride_B.reset(groups);
+    stride_B.copy_from_host(stride_B_host.data());
+    stride_D.reset(groups);
+    stride_D.copy_from_host(stride_D_host.data());
+
+    std::vector<cutlass::gemm_dag::GemmDagNode> dag_nodes_host;
+    int counter_count = cutlass::gemm_dag::make_gemm_dag<TileShape>(problem_sizes_host, producers, dag_nodes_host);
+    if (counter_count < 0) {
+      std::cerr << "Invalid GEMM chain" << std::endl;
+      exit(-1);
+    }
+    dag_nodes.reset(groups);
+    dag_nodes.copy_from_host(dag_nodes_host.data());
+    // Zeroed once; every launch then advances the epoch
+    counters.reset(std::max(counter_count, 1));
+    CUDA_CHECK(cudaMemset(counters.get(), 0, counters.bytes()));
+  }
+
+  /// Arguments of groups [first, first + count); the DAG is only used over the whole chain
+  typename Gemm::Arguments arguments(int first, int count, bool use_dag, cutlass::KernelHardwareInfo const& hw_info) {
+    typename GemmKernel::CollectiveMainloop::Arguments mainloop{
+      {ptr_A.get() + first, stride_A.get() + first, ptr_B.get() + first, stride_B.get() + first}};
+    typename GemmKernel::CollectiveEpilogue::Arguments epilogue{
+      {{}, nullptr, nullptr, ptr_D.get() + first, stride_D.get() + first}};
+    epilogue.thread.alpha = 1.f;
+    epilogue.thread.beta = 0.f;
+
+    if (use_dag) {
+      mainloop.ptr_dag_nodes = dag_nodes.get();
+      mainloop.ptr_counters = counters.get();
+      mainloop.epoch = ++epoch;
+      epilogue.ptr_dag_nodes = dag_nodes.get();
+      epilogue.ptr_counters = counters.get();
+    }
+
+    return typename Gemm::Arguments{
+      cutlass::gemm::GemmUniversalMode::kGrouped,
+      {count, problem_sizes.get() + first, problem_sizes_host.data() + first},
+      mainloop,
+      epilogue,
+      hw_info
+    };
+  }
+};
+
+/// Runs the whole chain in one launch
+void run_chain(Chain& chain, Options const& options, cutlass::KernelHardwareInfo const& hw_info,
+               cutlass::device_memory::allocation<uint8_t>& workspace) {
+  Gemm gemm;
+  auto arguments = chain.arguments(0, options.groups(), true, hw_info);
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+  if (workspace.size() < workspace_size) {
+    workspace.reset(workspace_size);
+  }
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+  CUTLASS_CHECK(gemm.run());
+}
+
+/// Runs the chain with one launch per GEMM
+void run_separately(Chain& chain, Options const& options, cutlass::KernelHardwareInfo const& hw_info,
+                    cutlass::device_memory::allocation<uint8_t>& workspace) {
+  for (int i = 0; i < options.groups(); ++i) {
+    Gemm gemm;
+    auto arguments = chain.arguments(i, 1, false, hw_info);
+    size_t workspace_size = Gemm::get_workspace_size(arguments);
+    if (workspace.size() < workspace_size) {
+      workspace.reset(workspace_size);
+    }
+    CUTLASS_CHECK(gemm.can_implement(arguments));
+    CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+    CUTLASS_CHECK(gemm.run());
+  }
+}
+
+/// Computes the chain with the reference GEMM, from the same X_0
+void run_reference(Chain& chain, Options const& options) {
+  cutlass::reference::device::Gemm<
+    ElementA, LayoutA,
+    ElementB, LayoutB,
+    ElementD, LayoutD,
+    ElementAccumulator, ElementAccumulator> gemm_reference;
+
+  for (int i = 0; i < options.groups(); ++i) {
+    auto [m, n, k] = chain.problem_sizes_host[i];
+    ElementA const* input = i == 0 ? chain.activations[0].get() : chain.reference[i].get();
+    cutlass::TensorRef ref_A(const_cast<ElementA*>(input), LayoutA::packed({m, k}));
+    cutlass::TensorRef ref_B(chain.weights[i].get(), LayoutB::packed({k, n}));
+    cutlass::TensorRef ref_D(chain.reference[i + 1].get(), LayoutD::packed({m, n}));
+    gemm_reference({m, n, k}, ElementAccumulator(1), ref_A, ref_B, ElementAccumulator(0), ref_D, ref_D);
+  }
+  CUDA_CHECK(cudaDeviceSynchronize());
+}
+
+/// Execute the chain and verify it against the reference
+int run(Options &options) {
+
+  if (options.groups() < 1) {
+    std::cerr << "--dims needs at least two dimensions" << std::endl;
+    return -1;
+  }
+
+  int device_id = 0;
+  CUDA_CHECK(cudaGetDevice(&device_id));
+  cutlass::KernelHardwareInfo hw_info = cutlass::KernelHardwareInfo::make_kernel_hardware_info<GemmKernel>(device_id);
+
+  Chain chain;
+  chain.initialize(options);
+  cutlass::device_memory::allocation<uint8_t> workspace;
+
+  run_reference(chain, options);
+  run_chain(chain, options, hw_info, workspace);
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Outputs are compared with a tolerance, since the rounding of intermediates to FP16 propagates
+  int last = options.groups();
+  bool passed = cutlass::reference::device::BlockCompareRelativelyEqual(
+    chain.reference[last].get(), chain.activations[last].get(), chain.activations[last].size(),
+    ElementD(0.05f), ElementD(0.05f));
+
+  std::cout << "  Chain: " << options.m << " rows, dims";
+  for (int dim : options.dims) {
+    std::cout << ' ' << dim;
+  }
+  std::cout << std::endl;
+  std::cout << "  Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+  if (!passed) {
+    return -1;
+  }
+
+  if (options.iterations > 0) {
+    GpuTimer timer;
+
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      run_chain(chain, options, hw_info, workspace);
+    }
+    timer.stop();
+    float chain_ms = timer.elapsed_millis() / options.iterations;
+
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      run_separately(chain, options, hw_info, workspace);
+    }
+    timer.stop();
+    float separate_ms = timer.elapsed_millis() / options.iterations;
+
+    std::cout << "  One launch per GEMM: " << separate_ms * 1000.f << " us" << std::endl;
+    std::cout << "  Single DAG launch:   " << chain_ms * 1000.f << " us" << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.3 Toolkit to run this example
+  if (__CUDACC_VER_MAJOR__ < 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ < 3)) {
+    std::cerr << "This example requires CUDA 12.3 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture (compute capability 90).\n";
+    return 0;
+  }
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  return run(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,837 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Transformer layer benchmark composed of CUTLASS library GEMM, grouped GEMM and FMHA kernels
+
+    This example times the GEMM and attention stages of one transformer layer of common model
+    shapes, so that their latency can be tracked from one CUTLASS release to the next. Every stage is
+    launched through cutlass::library::Handle, which selects a kernel from those the library was
+    built with, and is replayed from a CUDA graph so that the timings exclude host dispatch.
+
+    A layer consists of the stages
+
+      qkv_proj   Q, K and V projections (the low-rank projections of MLA for DeepSeek)
+      attention  Fused multi-head attention: causal over the prompt for prefill, one query over the
+                 KV cache for decode
+      o_proj     Output projection
+      mlp        Gate/up and down projections of the feed-forward network. Mixture-of-experts models
+                 run their experts as grouped GEMMs over tokens routed uniformly to the experts, and
+                 shared experts as dense GEMMs.
+
+    Elementwise kernels (normalization, rotary embedding, activation, routing and quantization) are
+    not part of the library and are left out. Each stage is timed on its own, and the layer is timed
+    as a single graph of all stages. Stages the library has no kernel for on the current device are
+    reported as unsupported and excluded from the layer.
+
+    The GEMM precision is selected with --precision:
+
+      bf16   BF16 operands
+      fp8    E4M3 operands with 1x128 and 128x128 blockwise scale factors; experts use per-tensor
+             scaled E4M3 grouped GEMMs
+      nvfp4  E2M1 operands with UE4M3 scale factors per 16 elements (SM100); experts run as one
+             block-scaled GEMM each
+
+    GEMMs write BF16, and attention is BF16 in all cases. Weights are stored N x K (column-major B).
+
+    Workloads sweep --batch over either the prompt length (prefill, batch x seqlen tokens) or the
+    KV cache length (decode, batch tokens) given by --seqlen. Workloads which don't fit in device
+    memory are skipped.
+
+    Examples:
+
+      $ ./examples/117_llm_layer_benchmark/117_llm_layer_benchmark --model=llama3-8b
+
+      $ ./examples/117_llm_layer_benchmark/117_llm_layer_benchmark --model=mixtral-8x7b,deepseek-v3 \
+          --mode=decode --batch=1,16,64 --seqlen=8192 --precision=fp8 --output=layers.csv
+*/
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/library/handle.h"
+#include "cutlass/library/library.h"
+#include "cutlass/library/util.h"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+using cutlass::library::NumericTypeID;
+using cutlass::library::LayoutTypeID;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Model presets
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ModelConfig {
+  char const *name;
+  int hidden;
+  int heads_q;
+  int heads_kv;
+  int head_dim;
+  int q_lora_rank;          ///< Nonzero for the low-rank Q projection of MLA
+  int kv_lora_rank;         ///< Nonzero for the low-rank KV projection of MLA
+  int ffn;                  ///< Intermediate size of the dense MLP or of each expert
+  int experts;              ///< Routed experts, or zero for a dense MLP
+  int top_k;                ///< Experts each token is routed to
+  int shared_experts;       ///< Experts every token passes through
+};
+
+// DeepSeek-V3 attention is modelled with the 128-wide heads the library's FMHA kernels support
+// rather than its 192-wide query/key heads.
+static ModelConfig const kModels[] = {
+  {"llama3-8b",     4096,  32,   8, 128,    0,   0, 14336,   0, 0, 0},
+  {"llama3-70b",    8192,  64,   8, 128,    0,   0, 28672,   0, 0, 0},
+  {"mixtral-8x7b",  4096,  32,   8, 128,    0,   0, 14336,   8, 2, 0},
+  {"deepseek-v3",   7168, 128, 128, 128, 1536, 512,  2048, 256, 8, 1},
+};
+
+/// Width of the rotary part of the MLA KV down-projection
+static int const kMlaRopeDim = 64;
+
+enum class Precision { kBF16, kFP8, kNVFP4 };
+
+static char const *to_string(Precision precision) {
+  switch (precision) {
+    case Precision::kBF16: return "bf16";
+    case Precision::kFP8: return "fp8";
+    case Precision::kNVFP4: return "nvfp4";
+  }
+  return "invalid";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Command line options
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Options {
+
+  bool help = false;
+  bool error = false;
+
+  std::vector<ModelConfig> models;
+  std::vector<std::string> modes;
+  std::vector<int> batch;
+  std::vector<int> seqlen;
+  Precision precision = Precision::kBF16;
+  int iterations = 20;
+  int warmup = 5;
+  std::string output;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    std::vector<std::string> model_names;
+    cmd.get_cmd_line_arguments("model", model_names);
+    if (model_names.empty()) {
+      model_names = {"llama3-8b"};
+    }
+    for (auto const &name : model_names) {
+      auto it = std::find_if(std::begin(kModels), std::end(kModels),
+        [&](ModelConfig const &model) { return name == model.name; });
+      if (it == std::end(kModels)) {
+        std::cerr << "Unknown model: " << name << std::endl;
+        error = true;
+        return;
+      }
+      models.push_back(*it);
+    }
+
+    cmd.get_cmd_line_arguments("mode", modes);
+    if (modes.empty()) {
+      modes = {"prefill", "decode"};
+    }
+    for (auto const &mode : modes) {
+      if (mode != "prefill" && mode != "decode") {
+        std::cerr << "Unknown mode: " << mode << std::endl;
+        error = true;
+        return;
+      }
+    }
+
+    cmd.get_cmd_line_arguments("batch", batch);
+    cmd.get_cmd_line_arguments("seqlen", seqlen);
+
+    std::string precision_name = "bf16";
+    cmd.get_cmd_line_argument("precision", precision_name);
+    if (precision_name == "bf16") {
+      precision = Precision::kBF16;
+    }
+    else if (precision_name == "fp8") {
+      precision = Precision::kFP8;
+    }
+    else if (precision_name == "nvfp4") {
+      precision = Precision::kNVFP4;
+    }
+    else {
+      std::cerr << "Unknown precision: " << precision_name << std::endl;
+      error = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("iterations", iterations);
+    cmd.get_cmd_line_argument("warmup", warmup);
+    cmd.get_cmd_line_argument("output", output);
+  }
+
+  /// Batch sizes swept in a mode
+  std::vector<int> batch_sweep(std::string const &mode) const {
+    if (!batch.empty()) {
+      return batch;
+    }
+    return mode == "prefill" ? std::vector<int>{1, 4} : std::vector<int>{1, 16, 64, 256};
+  }
+
+  /// Prompt lengths (prefill) or KV cache lengths (decode) swept in a mode
+  std::vector<int> seqlen_sweep(std::string const &mode) const {
+    if (!seqlen.empty()) {
+      return seqlen;
+    }
+    return mode == "prefill" ? std::vector<int>{2048} : std::vector<int>{4096};
+  }
+
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "117_llm_layer_benchmark\n\n"
+      << "  Times the GEMM and attention stages of one transformer layer using CUTLASS library kernels.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --model=<name,...>          Models among llama3-8b, llama3-70b, mixtral-8x7b and deepseek-v3\n"
+      << "                              (default: llama3-8b)\n"
+      << "  --mode=<mode,...>           Workloads among prefill and decode (default: both)\n"
+      << "  --batch=<int,...>           Batch sizes (default: 1,4 for prefill and 1,16,64,256 for decode)\n"
+      << "  --seqlen=<int,...>          Prompt lengths for prefill or KV cache lengths for decode\n"
+      << "                              (default: 2048 for prefill and 4096 for decode)\n"
+      << "  --precision=<str>           GEMM precision among bf16, fp8 and nvfp4 (default: bf16)\n"
+      << "  --iterations=<int>          Number of timed graph replays (default: 20)\n"
+      << "  --warmup=<int>              Number of graph replays before timing (default: 5)\n"
+      << "  --output=<path>             Appends the results as CSV to a file\n\n";
+
+    return out;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Device memory
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Owns the device allocations of one workload
+struct DeviceArena {
+
+  std::vector<cutlass::DeviceAllocation<uint8_t>> blocks;
+  uint32_t seed = 2026;
+
+  /// Allocates bytes of uninitialized device memory, throwing cutlass::cuda_exception on failure
+  void *allocate(size_t bytes) {
+    blocks.emplace_back(std::max<size_t>(bytes, 1));
+    return blocks.back().get();
+  }
+
+  /// Allocates elements of a type and fills them with values which are finite in that type
+  void *allocate(NumericTypeID element, size_t count) {
+    size_t bytes = (count * cutlass::library::sizeof_bits(element) + 7) / 8;
+    void *ptr = allocate(bytes);
+
+    switch (element) {
+      case NumericTypeID::kBF16:
+        cutlass::reference::device::BlockFillRandomUniform(
+          static_cast<cutlass::bfloat16_t *>(ptr), count, seed++,
+          cutlass::bfloat16_t(1), cutlass::bfloat16_t(-1), 0);
+        break;
+      case NumericTypeID::kFE4M3:
+        cutlass::reference::device::BlockFillRandomUniform(
+          static_cast<cutlass::float_e4m3_t *>(ptr), count, seed++,
+          cutlass::float_e4m3_t(2), cutlass::float_e4m3_t(-2), 0);
+        break;
+      case NumericTypeID::kF32:
+        cutlass::reference::device::BlockFillRandomUniform(
+          static_cast<float *>(ptr), count, seed++, 1.f, 0.5f, 0);
+        break;
+      case NumericTypeID::kFUE4M3:
+        // Scale factors of one
+        CUDA_CHECK(cudaMemset(ptr, 0x38, bytes));
+        break;
+      default:
+        // Every E2M1 encoding is finite
+        cutlass::reference::device::BlockFillRandomUniform(
+          static_cast<uint8_t *>(ptr), bytes, seed++, uint8_t(255), uint8_t(0), 0);
+        break;
+    }
+    return ptr;
+  }
+
+  /// Copies a host vector to the device
+  template <typename T>
+  T *upload(std::vector<T> const &host) {
+    void *ptr = allocate(host.size() * sizeof(T));
+    CUDA_CHECK(cudaMemcpy(ptr, host.data(), host.size() * sizeof(T), cudaMemcpyHostToDevice));
+    return static_cast<T *>(ptr);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Layer stages
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// A stage of the layer: a named sequence of library calls
+struct Stage {
+  std::string name;
+  double flops = 0;
+  std::vector<std::function<cutlass::Status()>> launches;
+
+  cutlass::Status run() const {
+    for (auto const &launch : launches) {
+      cutlass::Status status = launch();
+      if (status != cutlass::Status::kSuccess) {
+        return status;
+      }
+    }
+    return cutlass::Status::kSuccess;
+  }
+};
+
+/// Builds the stages of one layer for a workload
+class LayerBuilder {
+public:
+
+  LayerBuilder(cutlass::library::Handle &handle, DeviceArena &arena, Precision precision):
+    handle_(handle), arena_(arena), precision_(precision) { }
+
+  /// Appends D (M x N) = A (M x K) * B (K x N) to a stage
+  void add_gemm(Stage &stage, int m, int n, int k) {
+    stage.flops += 2.0 * m * n * k;
+
+    switch (precision_) {
+      case Precision::kBF16: {
+        void *A = arena_.allocate(NumericTypeID::kBF16, size_t(m) * k);
+        void *B = arena_.allocate(NumericTypeID::kBF16, size_t(n) * k);
+        void *D = arena_.allocate(size_t(m) * n * 2);
+        stage.launches.push_back([=]() {
+          return handle_.gemm_universal(
+            cutlass::library::GemmUniversalMode::kGemm, m, n, k,
+            0, 0, 0, 0, 0, 0,
+            NumericTypeID::kF32, NumericTypeID::kF32, &kAlpha,
+            NumericTypeID::kBF16, LayoutTypeID::kRowMajor, cutlass::library::ComplexTransform::kNone, A, k,
+            NumericTypeID::kBF16, LayoutTypeID::kColumnMajor, cutlass::library::ComplexTransform::kNone, B, k,
+            &kBeta,
+            NumericTypeID::kBF16, LayoutTypeID::kRowMajor, D, n,
+            NumericTypeID::kBF16, LayoutTypeID::kRowMajor, D, n);
+        });
+        break;
+      }
+      case Precision::kFP8: {
+        int const kBlock = 128;
+        void *A = arena_.allocate(NumericTypeID::kFE4M3, size_t(m) * k);
+        void *B = arena_.allocate(NumericTypeID::kFE4M3, size_t(n) * k);
+        void *SFA = arena_.allocate(NumericTypeID::kF32, size_t(m) * ceil_div(k, kBlock));
+        void *SFB = arena_.allocate(NumericTypeID::kF32, size_t(ceil_div(n, kBlock)) * ceil_div(k, kBlock));
+        void *D = arena_.allocate(size_t(m) * n * 2);
+        stage.launches.push_back([=]() {
+          return handle_.gemm_blockwise(
+            m, n, k,
+            0, 0, 0, 0, 0, 0,
+            NumericTypeID::kF32, NumericTypeID::kF32, &kAlpha,
+            NumericTypeID::kFE4M3, LayoutTypeID::kRowMajor, A, k,
+            NumericTypeID::kF32, SFA,
+            NumericTypeID::kFE4M3, LayoutTypeID::kColumnMajor, B, k,
+            NumericTypeID::kF32, SFB,
+            1, kBlock, kBlock,
+            &kBeta,
+            NumericTypeID::kBF16, LayoutTypeID::kRowMajor, D, n,
+            NumericTypeID::kBF16, LayoutTypeID::kRowMajor, D, n);
+        });
+        break;
+      }
+      case Precision::kNVFP4: {
+        add_block_scaled_gemm(stage, m, n, k);
+        break;
+      }
+    }
+  }
+
+  /// Appends a grouped GEMM of one problem per active expert to a stage
+  void add_grouped_gemm(Stage &stage, int experts, int m, int n, int k) {
+    stage.flops += 2.0 * experts * m * n * k;
+
+    // Grouped GEMMs with block scale factors are not exposed by the handle
+    if (precision_ == Precision::kNVFP4) {
+      for (int expert = 0; expert < experts; ++expert) {
+        add_block_scaled_gemm(stage, m, n, k);
+      }
+      return;
+    }
+
+    NumericTypeID element = (precision_ == Precision::kFP8) ? NumericTypeID::kFE4M3 : NumericTypeID::kBF16;
+
+    char *A = static_cast<char *>(arena_.allocate(element, size_t(experts) * m * k));
+    char *B = static_cast<char *>(arena_.allocate(element, size_t(experts) * n * k));
+    char *D = static_cast<char *>(arena_.allocate(size_t(experts) * m * n * 2));
+
+    int element_bytes = cutlass::library::sizeof_bits(element) / 8;
+
+    std::vector<void const *> ptr_A, ptr_B;
+    std::vector<void *> ptr_D;
+    for (int expert = 0; expert < experts; ++expert) {
+      ptr_A.push_back(A + size_t(expert) * m * k * element_bytes);
+      ptr_B.push_back(B + size_t(expert) * n * k * element_bytes);
+      ptr_D.push_back(D + size_t(expert) * m * n * 2);
+    }
+
+    auto problem_sizes_host = std::make_shared<std::vector<cute::Shape<int, int, int>>>(
+      experts, cute::make_shape(m, n, k));
+    auto lda = std::make_shared<std::vector<int64_t>>(experts, k);
+    auto ldb = std::make_shared<std::vector<int64_t>>(experts, k);
+    auto ldc = std::make_shared<std::vector<int64_t>>(experts, n);
+
+    cute::Shape<int, int, int> const *problem_sizes = arena_.upload(*problem_sizes_host);
+    void const * const *device_ptr_A = arena_.upload(ptr_A);
+    void const * const *device_ptr_B = arena_.upload(ptr_B);
+    void * const *device_ptr_D = arena_.upload(ptr_D);
+
+    stage.launches.push_back([=]() {
+      return handle_.gemm_grouped(
+        experts, problem_sizes, problem_sizes_host->data(),
+        NumericTypeID::kF32, NumericTypeID::kF32, &kAlpha,
+        element, LayoutTypeID::kRowMajor, cutlass::library::ComplexTransform::kNone, device_ptr_A, lda->data(),
+        element, LayoutTypeID::kColumnMajor, cutlass::library::ComplexTransform::kNone, device_ptr_B, ldb->data(),
+        &kBeta,
+        NumericTypeID::kBF16, LayoutTypeID::kRowMajor, reinterpret_cast<void const * const *>(device_ptr_D), ldc->data(),
+        NumericTypeID::kBF16, LayoutTypeID::kRowMajor, device_ptr_D);
+    });
+  }
+
+  /// Appends attention over packed [batch, seqlen, heads, head_dim] tensors to a stage
+  void add_attention(Stage &stage, ModelConfig const &model, int batch, int seqlen_q, int seqlen_kv, bool causal) {
+    double scores = double(batch) * model.heads_q * seqlen_q * seqlen_kv;
+    stage.flops += 4.0 * scores * model.head_dim * (causal ? 0.5 : 1.0);
+
+    void *Q = arena_.allocate(NumericTypeID::kBF16, size_t(batch) * seqlen_q * model.heads_q * model.head_dim);
+    void *K = arena_.allocate(NumericTypeID::kBF16, size_t(batch) * seqlen_kv * model.heads_kv * model.head_dim);
+    void *V = arena_.allocate(NumericTypeID::kBF16, size_t(batch) * seqlen_kv * model.heads_kv * model.head_dim);
+    void *O = arena_.allocate(size_t(batch) * seqlen_q * model.heads_q * model.head_dim * 2);
+
+    cutlass::library::AttentionMask mask = causal ?
+      cutlass::library::AttentionMask::kCausal : cutlass::library::AttentionMask::kNone;
+
+    stage.launches.push_back([=]() {
+      return handle_.attention(
+        batch, model.heads_q, model.heads_kv, seqlen_q, seqlen_kv, model.head_dim,
+        mask,
+        NumericTypeID::kF32,
+        NumericTypeID::kBF16, Q,
+        NumericTypeID::kBF16, K, V,
+        NumericTypeID::kBF16, O);
+    });
+  }
+
+private:
+
+  static int ceil_div(int a, int b) {
+    return (a + b - 1) / b;
+  }
+
+  /// Appends an NVFP4 GEMM to a stage
+  void add_block_scaled_gemm(Stage &stage, int m, int n, int k) {
+    int const kVecSize = 16;
+
+    // Scale factors are stored in 128 x 4 blocks
+    size_t sf_k = size_t(ceil_div(ceil_div(k, kVecSize), 4)) * 4;
+    size_t sf_m = size_t(ceil_div(m, 128)) * 128;
+    size_t sf_n = size_t(ceil_div(n, 128)) * 128;
+
+    void *A = arena_.allocate(NumericTypeID::kFE2M1, size_t(m) * k);
+    void *B = arena_.allocate(NumericTypeID::kFE2M1, size_t(n) * k);
+    void *SFA = arena_.allocate(NumericTypeID::kFUE4M3, sf_m * sf_k);
+    void *SFB = arena_.allocate(NumericTypeID::kFUE4M3, sf_n * sf_k);
+    void *D = arena_.allocate(size_t(m) * n * 2);
+
+    stage.launches.push_back([=]() {
+      return handle_.gemm_block_scaled(
+        m, n, k,
+        0, 0, 0, 0, 0, 0,
+        NumericTypeID::kF32, NumericTypeID::kF32, &kAlpha,
+        NumericTypeID::kFE2M1, LayoutTypeID::kRowMajor, A, k,
+        NumericTypeID::kFUE4M3, SFA,
+        NumericTypeID::kFE2M1, LayoutTypeID::kColumnMajor, B, k,
+        NumericTypeID::kFUE4M3, SFB,
+        kVecSize,
+        &kBeta,
+        NumericTypeID::kBF16, LayoutTypeID::kRowMajor, D, n,
+        NumericTypeID::kBF16, LayoutTypeID::kRowMajor, D, n,
+        NumericTypeID::kVoid, LayoutTypeID::kRowMajor, nullptr, kVecSize, nullptr);
+    });
+  }
+
+  static float const kAlpha;
+  static float const kBeta;
+
+  cutlass::library::Handle &handle_;
+  DeviceArena &arena_;
+  Precision precision_;
+};
+
+float const LayerBuilder::kAlpha = 1.f;
+float const LayerBuilder::kBeta = 0.f;
+
+/// Builds the stages of one layer of a model for batch prompts of seqlen tokens (prefill) or for
+/// batch tokens attending to seqlen cached tokens (decode)
+std::vector<Stage> build_layer(
+  LayerBuilder &builder, ModelConfig const &model, bool prefill, int batch, int seqlen) {
+
+  int tokens = prefill ? batch * seqlen : batch;
+  int hd = model.head_dim;
+
+  std::vector<Stage> stages;
+
+  Stage qkv_proj{"qkv_proj"};
+  if (model.q_lora_rank) {
+    builder.add_gemm(qkv_proj, tokens, model.q_lora_rank, model.hidden);
+    builder.add_gemm(qkv_proj, tokens, model.heads_q * hd, model.q_lora_rank);
+    builder.add_gemm(qkv_proj, tokens, model.kv_lora_rank + kMlaRopeDim, model.hidden);
+    builder.add_gemm(qkv_proj, tokens, model.heads_kv * 2 * hd, model.kv_lora_rank);
+  }
+  else {
+    builder.add_gemm(qkv_proj, tokens, (model.heads_q + 2 * model.heads_kv) * hd, model.hidden);
+  }
+  stages.push_back(std::move(qkv_proj));
+
+  Stage attention{"attention"};
+  if (prefill) {
+    builder.add_attention(attention, model, batch, seqlen, seqlen, true);
+  }
+  else {
+    builder.add_attention(attention, model, batch, 1, seqlen, false);
+  }
+  stages.push_back(std::move(attention));
+
+  Stage o_proj{"o_proj"};
+  builder.add_gemm(o_proj, tokens, model.hidden, model.heads_q * hd);
+  stages.push_back(std::move(o_proj));
+
+  if (!model.experts) {
+    Stage mlp{"mlp"};
+    builder.add_gemm(mlp, tokens, 2 * model.ffn, model.hidden);
+    builder.add_gemm(mlp, tokens, model.hidden, model.ffn);
+    stages.push_back(std::move(mlp));
+  }
+  else {
+    // Tokens are spread evenly over as many experts as they are routed to
+    int64_t routed = int64_t(tokens) * model.top_k;
+    int active = int(std::min<int64_t>(model.experts, routed));
+    int tokens_per_expert = int((routed + active - 1) / active);
+
+    Stage experts{"moe_experts"};
+    builder.add_grouped_gemm(experts, active, tokens_per_expert, 2 * model.ffn, model.hidden);
+    builder.add_grouped_gemm(experts, active, tokens_per_expert, model.hidden, model.ffn);
+    stages.push_back(std::move(experts));
+
+    if (model.shared_experts) {
+      Stage shared{"shared_experts"};
+      builder.add_gemm(shared, tokens, 2 * model.ffn * model.shared_experts, model.hidden);
+      builder.add_gemm(shared, tokens, model.hidden, model.ffn * model.shared_experts);
+      stages.push_back(std::move(shared));
+    }
+  }
+
+  return stages;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Timing
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Timing {
+  cutlass::Status status = cutlass::Status::kSuccess;
+  bool graph = false;             ///< Timed by replaying a CUDA graph rather than by launching
+  double runtime_ms = 0;
+  std::string kernels;            ///< Kernels selected by the handle
+};
+
+/// Times a sequence of stages, replayed from a CUDA graph when the launches can be captured
+Timing time_stages(
+  cutlass::library::Handle &handle, std::vector<Stage const *> const &stages, cudaStream_t stream,
+  Options const &options) {
+
+  Timing timing;
+
+  // Launching once outside of capture selects the kernels, initializes them and allocates the
+  // handle's workspace
+  for (Stage const *stage : stages) {
+    for (auto const &launch : stage->launches) {
+      timing.status = launch();
+      if (timing.status != cutlass::Status::kSuccess) {
+        return timing;
+      }
+      cutlass::library::Operation const *operation = handle.get_last_operation();
+      if (operation) {
+        timing.kernels += (timing.kernels.empty() ? "" : " ") + std::string(operation->description().name);
+      }
+    }
+  }
+  CUDA_CHECK(cudaStreamSynchronize(stream));
+
+  cudaGraph_t graph = nullptr;
+  cudaGraphExec_t graph_exec = nullptr;
+
+  if (cudaStreamBeginCapture(stream, cudaStreamCaptureModeThreadLocal) == cudaSuccess) {
+    bool launched = true;
+    for (Stage const *stage : stages) {
+      launched = launched && stage->run() == cutlass::Status::kSuccess;
+    }
+    if (cudaStreamEndCapture(stream, &graph) == cudaSuccess && launched &&
+        cudaGraphInstantiate(&graph_exec, graph, 0) == cudaSuccess) {
+      timing.graph = true;
+    }
+  }
+
+  if (!timing.graph) {
+    // Launches which can't be captured are timed as launched
+    (void)cudaGetLastError();
+    std::cerr << "  Warning: stages not captured by a CUDA graph, timing launches" << std::endl;
+  }
+
+  auto replay = [&]() {
+    if (timing.graph) {
+      CUDA_CHECK(cudaGraphLaunch(graph_exec, stream));
+    }
+    else {
+      for (Stage const *stage : stages) {
+        CUTLASS_CHECK(stage->run());
+      }
+    }
+  };
+
+  for (int iter = 0; iter < options.warmup; ++iter) {
+    replay();
+  }
+
+  GpuTimer timer;
+  timer.start(stream);
+  for (int iter = 0; iter < options.iterations; ++iter) {
+    replay();
+  }
+  timer.stop();
+
+  timing.runtime_ms = double(timer.elapsed_millis()) / double(std::max(options.iterations, 1));
+
+  if (graph_exec) {
+    CUDA_CHECK(cudaGraphExecDestroy(graph_exec));
+  }
+  if (graph) {
+    CUDA_CHECK(cudaGraphDestroy(graph));
+  }
+
+  return timing;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Reporting
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Workload {
+  ModelConfig model;
+  std::string mode;
+  int batch;
+  int seqlen;
+};
+
+/// Prints a row of the results table and appends it to the CSV output
+void report(
+  Workload const &workload, Options const &options, std::string const &stage, double flops,
+  Timing const &timing, std::ostream *csv) {
+
+  bool supported = timing.status == cutlass::Status::kSuccess;
+  double tflops = supported && timing.runtime_ms > 0 ? flops / (timing.runtime_ms * 1.0e9) : 0;
+
+  std::cout << "  " << std::left << std::setw(16) << stage << std::right;
+  if (supported) {
+    std::cout << std::fixed << std::setprecision(1)
+      << std::setw(12) << timing.runtime_ms * 1000.0 << " us"
+      << std::setw(10) << std::setprecision(1) << tflops << " TFLOP/s"
+      << (timing.graph ? "" : "  (not graph captured)");
+  }
+  else {
+    std::cout << "  unsupported: " << cutlassGetStatusString(timing.status);
+  }
+  std::cout << std::endl;
+
+  if (csv) {
+    *csv << workload.model.name << ',' << to_string(options.precision) << ',' << workload.mode << ','
+      << workload.batch << ',' << workload.seqlen << ',' << stage << ','
+      << (supported ? "success" : cutlassGetStatusString(timing.status)) << ','
+      << (timing.graph ? "true" : "false") << ','
+      << timing.runtime_ms * 1000.0 << ',' << tflops << ',' << timing.kernels << '\n';
+  }
+}
+
+/// Benchmarks one workload
+void run_workload(
+  cutlass::library::Handle &handle, Workload const &workload, Options const &options,
+  cudaStream_t stream, std::ostream *csv) {
+
+  bool prefill = workload.mode == "prefill";
+
+  std::cout << workload.model.name << ' ' << to_string(options.precision) << ' ' << workload.mode
+    << ": batch " << workload.batch << ", " << (prefill ? "prompt length " : "KV cache length ")
+    << workload.seqlen << std::endl;
+
+  DeviceArena arena;
+  LayerBuilder builder(handle, arena, options.precision);
+  std::vector<Stage> stages;
+
+  try {
+    stages = build_layer(builder, workload.model, prefill, workload.batch, workload.seqlen);
+  }
+  catch (cutlass::cuda_exception const &) {
+    (void)cudaGetLastError();
+    std::cout << "  skipped: out of device memory" << std::endl << std::endl;
+    return;
+  }
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Each stage on its own
+  std::vector<Stage const *> supported;
+  double layer_flops = 0;
+  double stage_sum_ms = 0;
+
+  for (Stage const &stage : stages) {
+    Timing timing = time_stages(handle, {&stage}, stream, options);
+    report(workload, options, stage.name, stage.flops, timing, csv);
+
+    if (timing.status == cutlass::Status::kSuccess) {
+      supported.push_back(&stage);
+      layer_flops += stage.flops;
+      stage_sum_ms += timing.runtime_ms;
+    }
+  }
+
+  // The supported stages back to back
+  if (!supported.empty()) {
+    Timing timing = time_stages(handle, supported, stream, options);
+    report(workload, options, supported.size() == stages.size() ? "layer" : "layer (partial)",
+      layer_flops, timing, csv);
+    std::cout << "  " << std::left << std::setw(16) << "sum of stages" << std::right
+      << std::fixed << std::setprecision(1) << std::setw(12) << stage_sum_ms * 1000.0 << " us" << std::endl;
+  }
+
+  std::cout << std::endl;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.error) {
+    return -1;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major < 9) {
+    std::cerr << "This example requires a GPU of NVIDIA's Hopper Architecture or newer.\n";
+    return 0;
+  }
+
+  std::cout << "Device: " << props.name << " (SM" << props.major << props.minor << ")" << std::endl << std::endl;
+
+  std::ofstream csv_file;
+  std::ostream *csv = nullptr;
+  if (!options.output.empty()) {
+    bool exists = std::ifstream(options.output).good();
+    csv_file.open(options.output, std::ios::app);
+    if (!csv_file) {
+      std::cerr << "Failed to open " << options.output << std::endl;
+      return -1;
+    }
+    if (!exists) {
+      csv_file << "Model,Precision,Mode,Batch,SeqLen,Stage,Status,Graph,Runtime_us,TFLOPs,Kernels\n";
+    }
+    csv = &csv_file;
+  }
+
+  // Launches captured by a graph must be issued to a stream other than the legacy default stream
+  cudaStream_t stream;
+  CUDA_CHECK(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+  {
+    size_t const kWorkspaceSize = size_t(128) << 20;
+    cutlass::library::Handle handle(stream, kWorkspaceSize);
+
+    for (ModelConfig const &model : options.models) {
+      for (std::string const &mode : options.modes) {
+        for (int batch : options.batch_sweep(mode)) {
+          for (int seqlen : options.seqlen_sweep(mode)) {
+            run_workload(handle, {model, mode, batch, seqlen}, options, stream, csv);
+          }
+        }
+      }
+    }
+  }
+
+  CUDA_CHECK(cudaStreamDestroy(stream));
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
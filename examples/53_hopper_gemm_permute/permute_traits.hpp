@@ -34,6 +34,7 @@
 */
 
 #include "cutlass/layout/permute.h"
+#include "cutlass/layout/permute_layout.hpp"
 #include "cutlass/gemm/gemm.h"
 
 namespace example
@@ -47,30 +48,7 @@ template<class Permute>
 struct PermuteTraits {};
 
 // Use X as a placeholder for shape division result
-using X = Underscore;
-
-// Reshape a rank-2 shape into a multidimensional shape.
-// Input:
-//   shape = (A, B, ...)
-//   target_shape = ((A1, ..., X, ..., Am), (B1, ..., X, ..., Bn), ...)
-// Output:
-//   ((A1, ..., A/prod(A1..Am), ..., Am), (B1, ..., B/prod(B1..Bn), ..., Bn), ...)
-template<class Shape, class TargetShape>
-constexpr auto
-reshape(Shape const& shape, TargetShape const& target_shape)
-{
-  if constexpr (is_tuple<Shape>::value) {
-    return cute::transform(shape, target_shape, [](auto && s, auto && t){ return reshape(s, t); });
-  }
-  else {
-    auto idx = find_if(target_shape, [](auto x){ return is_underscore<decltype(x)>{}; });
-    constexpr int I = decltype(idx)::value;
-    static_assert(I < tuple_size_v<TargetShape>, "Each mode of TargetShape must contain a placeholder X");
-    auto divisors = remove<I>(target_shape);
-    assert(shape % product(divisors) == 0);
-    return replace<I>(target_shape, shape / product(divisors));
-  }
-}
+using X = cutlass::layout::X;
 
 // Given a tensor layout, compute a permutation layout consisting of:
 // - sub-modes corresponding to the implied multidimensional shape of the source tensor
@@ -94,7 +72,7 @@ make_permute_layout(Layout<Shape,Stride> const& layout) {
       // Here's where the permutation layout is actually built
       using ShapeProfile = typename PermuteTraits<Permute>::ShapeProfile;
       using StrideOrder  = typename PermuteTraits<Permute>::StrideOrder;
-      return make_ordered_layout(reshape(layout.shape(), ShapeProfile{}), StrideOrder{});
+      return cutlass::layout::make_permuted_layout(layout, ShapeProfile{}, StrideOrder{});
     }
   }
 }
@@ -143,11 +121,11 @@ make_original_layout(Layout<Shape,Stride> const& layout) {
   }
   else {
     using ShapeProfile = typename PermuteTraits<Permute>::ShapeProfile;
-    auto re_shape   = flatten(reshape(layout.shape(), ShapeProfile{}));
+    auto re_shape   = flatten(cutlass::layout::reshape_modes(layout.shape(), ShapeProfile{}));
     using IndexOrder   = typename PermuteTraits<Permute>::IndexOrder;
     auto orig_shape = transform_leaf(IndexOrder{}, [&](auto i){ return get<i>(re_shape); });
     using OrigOrder    = conditional_t<cutlass::gemm::detail::is_major<0,Stride>(), seq<0,1,2>, seq<1,0,2>>;
-    // print("Permuted shape: "); print(reshape(layout.shape(), ShapeProfile{})); print("\n");
+    // print("Permuted shape: "); print(cutlass::layout::reshape_modes(layout.shape(), ShapeProfile{})); print("\n");
     // print("Original shape: "); print(orig_shape); print("\n");
     return make_ordered_layout(product_each(orig_shape), OrigOrder{});
   }
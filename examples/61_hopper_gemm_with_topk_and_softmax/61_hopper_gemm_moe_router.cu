@@ -0,0 +1,595 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief  Hopper MoE router GEMM with fused Top-K + Softmax routing
+
+    This example illustrates how to use the LinCombTopKSoftmaxRouterCol EVT node to compute
+    the MoE routing of every token in the epilogue of the router GEMM:
+
+      logits(m,e)  = alpha * sum_k(X(m,k) * W(e,k))
+      indices(m,j) = expert of the j-th largest logit of token m, j < TopK
+      weights(m,j) = softmax of the selected logits of token m
+      counts(e)    = number of tokens routed to expert e
+      slots(m,j)   = position of token m in the bucket of expert indices(m,j)
+      tokens(s,e)  = slot index m * TopK + j of the s-th token in the bucket of expert e
+
+    An exclusive prefix sum of the counts gives the first row of every expert in the permuted
+    input of the grouped expert GEMM, and offsets(e) + slots(m,j) the row of (m,j), so the router
+    feeds the expert GEMMs without an intermediate sort.
+
+    Assumptions:
+      1. All experts are in a single CTA and epilogue tile (N <= 256 with this tile shape).
+      2. TopK is static and at most 8.
+
+    Tokens are distributed to the buckets of an expert in no particular order, so the
+    verification checks the buckets as sets.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/distribution.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/host/tensor_fill.h"
+#include "cutlass/util/reference/host/gett.hpp"
+
+#include "helper.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+static constexpr int TopK = 8;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A matrix configuration (tokens)
+using         ElementA    = cutlass::bfloat16_t;                            // Element type for A matrix operand
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for A matrix operand
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A matrix in units of elements (up to 16 bytes)
+
+// B matrix configuration (router weights)
+using         ElementB    = cutlass::bfloat16_t;                            // Element type for B matrix operand
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of B matrix in units of elements (up to 16 bytes)
+
+// C matrix configuration
+using         ElementC    = void;
+using         LayoutC     = cutlass::layout::RowMajor;
+constexpr int AlignmentC  = 1;
+
+// D matrix configuration (logits, kept for the auxiliary load balancing loss)
+using         ElementD    = float;                                          // Element type for D matrix operand
+using         LayoutD     = cutlass::layout::RowMajor;                      // Layout type for output
+constexpr int AlignmentD  = 128 / cutlass::sizeof_bits<ElementD>::value;    // Memory access granularity/alignment of output in units of elements (up to 16 bytes)
+
+// Routing weights
+using ElementWeight       = float;
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ElementCompute      = float;                                          // Element type for epilogue computation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using TileShape           = Shape<_64,_256,_64>;                            // Threadblock-level tile size, N covers all experts
+using ClusterShape        = Shape<_1,_1,_1>;                                // Shape of the threadblocks in a cluster
+using KernelSchedule      = cutlass::gemm::KernelTmaWarpSpecialized;
+using EpilogueSchedule    = cutlass::epilogue::TmaWarpSpecialized;
+
+// Top-K + Softmax router fusion operation
+using FusionOperation     = cutlass::epilogue::fusion::LinCombTopKSoftmaxRouterCol<
+                              TopK, ElementD, ElementCompute, ElementWeight>;
+
+// The fusion op requires the epilogue tile to cover all experts.
+using EpilogueTileType    = decltype(cute::take<0,2>(TileShape{}));
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    TileShape, ClusterShape,
+    EpilogueTileType,
+    ElementAccumulator, ElementCompute,
+    ElementC, LayoutC, AlignmentC,
+    ElementD, LayoutD, AlignmentD,
+    EpilogueSchedule,
+    FusionOperation
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))
+    >,
+    KernelSchedule
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>, // Indicates ProblemShape
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+// Extract information from Gemm kernel.
+using EpilogueOutputOp  = typename Gemm::EpilogueOutputOp;
+using ElementScalar     = typename EpilogueOutputOp::ElementScalar;
+
+using StrideA = typename Gemm::GemmKernel::StrideA;
+using StrideB = typename Gemm::GemmKernel::StrideB;
+using StrideD = typename Gemm::GemmKernel::StrideD;
+
+/// Initialization
+StrideA stride_A;
+StrideB stride_B;
+StrideD stride_D;
+uint64_t seed;
+
+cutlass::HostTensor<ElementA  , LayoutA  > tensor_A;
+cutlass::HostTensor<ElementB  , LayoutB  > tensor_B;
+cutlass::HostTensor<ElementD  , LayoutD  > tensor_D;
+cutlass::HostTensor<ElementD  , LayoutD  > tensor_ref_D;
+
+cutlass::device_memory::allocation<int32_t> topk_indices;
+cutlass::device_memory::allocation<ElementWeight> topk_weights;
+cutlass::device_memory::allocation<int32_t> topk_slots;
+cutlass::device_memory::allocation<int32_t> expert_counts;
+cutlass::device_memory::allocation<int32_t> expert_tokens;
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  int iterations = 1000;
+  int m = 4096, n = 128, k = 2048, l = 1;
+  int capacity = 0;
+  bool renormalize = true;
+  double eps = 1e-4;
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("l", l);
+    cmd.get_cmd_line_argument("capacity", capacity);
+    cmd.get_cmd_line_argument("renormalize", renormalize, true);
+    cmd.get_cmd_line_argument("iterations", iterations);
+    cmd.get_cmd_line_argument("eps", eps);
+
+    // By default every bucket can hold all tokens
+    if (capacity <= 0) {
+      capacity = m;
+    }
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "61_hopper_gemm_moe_router\n\n"
+      << "  Hopper MoE router GEMM with fused Top-K + softmax routing.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the number of tokens\n"
+      << "  --n=<int>                   Sets the number of experts (at most 256)\n"
+      << "  --k=<int>                   Sets the hidden dimension\n"
+      << "  --l=<int>                   Sets the l extent (batch) of the GEMM\n"
+      << "  --capacity=<int>            Sets the capacity of the token list of every expert. Default: m.\n"
+      << "  --renormalize=<bool>        Softmax over the selected experts (true) or all experts (false).\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n"
+      << "  --eps=<float>               Threshold of numerical verification. Default: 1e-4.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "61_hopper_gemm_moe_router" << " --m=8192 --n=256 --k=7168 \n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GFLOP/s
+  double gflops(double runtime_s) const
+  {
+    // Two flops per multiply-add
+    uint64_t flop = uint64_t(2) * m * n * k * l;
+    double gflop = double(flop) / double(1.0e9);
+    return gflop / runtime_s;
+  }
+
+  float alpha() const {
+    return 1.f / static_cast<float>(k);
+  }
+};
+
+/// Result structure
+struct Result {
+  double avg_runtime_ms;
+  double gflops;
+  cutlass::Status status;
+  cudaError_t error;
+  bool passed;
+
+  Result(
+    double avg_runtime_ms = 0,
+    double gflops = 0,
+    cutlass::Status status = cutlass::Status::kSuccess,
+    cudaError_t error = cudaSuccess)
+  :
+    avg_runtime_ms(avg_runtime_ms), gflops(gflops), status(status), error(error), passed(false)
+  {}
+
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Helper to initialize a block of device data
+/// Values are multiples of 1/16, so the logits are exact in FP32 regardless of the order of accumulation
+template <typename Element, typename Layout>
+bool initialize_tensor(
+    cutlass::TensorView<Element, Layout> view,
+    uint64_t seed) {
+  cutlass::reference::host::TensorFillRandomUniform(
+    view, seed, /* max = */ 1, /* min = */ -1, /* bits = */ 4);
+  return true;
+}
+
+/// Initialize operands to be used in the GEMM and reference GEMM
+void initialize(const Options &options) {
+
+  stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(options.m, options.k, options.l));
+  stride_B = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(options.n, options.k, options.l));
+  stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(options.m, options.n, options.l));
+
+  auto a_coord = cutlass::make_Coord(options.m * options.l, options.k);
+  auto c_coord = cutlass::make_Coord(options.m * options.l, options.n);
+  auto b_coord = cutlass::make_Coord(options.k, options.n * options.l);
+
+  tensor_A.resize(a_coord);
+  tensor_B.resize(b_coord);
+  tensor_D.resize(c_coord);
+  tensor_ref_D.resize(c_coord);
+
+  initialize_tensor(tensor_A.host_view(), seed + 2022);
+  initialize_tensor(tensor_B.host_view(), seed + 2023);
+
+  tensor_A.sync_device();
+  tensor_B.sync_device();
+  tensor_D.sync_device();
+
+  size_t routes = size_t(options.m) * TopK * options.l;
+  topk_indices.reset(routes);
+  topk_weights.reset(routes);
+  topk_slots.reset(routes);
+  expert_counts.reset(size_t(options.n) * options.l);
+  expert_tokens.reset(size_t(options.capacity) * options.n * options.l);
+}
+
+/// Populates a Gemm::Arguments structure from the given commandline options
+typename Gemm::Arguments args_from_options(const Options &options) {
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.m, options.n, options.k, options.l},
+    {tensor_A.device_data(), stride_A, tensor_B.device_data(), stride_B},
+    {
+      {}, // epilogue.thread
+      nullptr, stride_D,
+      tensor_D.device_data(), stride_D
+    }
+  };
+
+  auto &fusion_args = arguments.epilogue.thread;
+  fusion_args.alpha = options.alpha();
+  fusion_args.beta = 0.f;
+  fusion_args.topk_indices_ptr = topk_indices.get();
+  fusion_args.topk_weights_ptr = topk_weights.get();
+  fusion_args.expert_counts_ptr = expert_counts.get();
+  fusion_args.topk_slots_ptr = topk_slots.get();
+  fusion_args.expert_tokens_ptr = expert_tokens.get();
+  fusion_args.expert_capacity = options.capacity;
+  fusion_args.renormalize = options.renormalize;
+
+  return arguments;
+}
+
+bool verify(const Options &options) {
+  //
+  // Compute reference logits
+  //
+
+  auto A = cute::make_tensor(tensor_A.host_data(),
+      cute::make_layout(cute::make_shape(options.m, options.k, options.l), stride_A));
+  auto B = cute::make_tensor(tensor_B.host_data(),
+      cute::make_layout(cute::make_shape(options.n, options.k, options.l), stride_B));
+  auto D = cute::make_tensor(tensor_ref_D.host_data(),
+      cute::make_layout(cute::make_shape(options.m, options.n, options.l), stride_D));
+  using unused_t = decltype(D);
+
+  cutlass::reference::host::GettMainloopParams<ElementAccumulator, decltype(A), decltype(B)> mainloop_params{A, B};
+
+  cutlass::reference::host::GettEpilogueParams<
+      ElementScalar,
+      ElementScalar,
+      ElementAccumulator,
+      ElementCompute,
+      unused_t,
+      decltype(D),
+      unused_t, // bias
+      unused_t, // aux
+      unused_t, // valpha
+      unused_t  // vbeta
+  > epilogue_params;
+
+  epilogue_params.D = D;
+  epilogue_params.alpha = options.alpha();
+  epilogue_params.beta = 0.f;
+
+  cutlass::reference::host::Gemm3x(mainloop_params, epilogue_params);
+
+  size_t routes = size_t(options.m) * TopK * options.l;
+  std::vector<int32_t> indices(routes), slots(routes);
+  std::vector<ElementWeight> weights(routes);
+  std::vector<int32_t> counts(size_t(options.n) * options.l);
+  std::vector<int32_t> tokens(size_t(options.capacity) * options.n * options.l);
+  topk_indices.copy_to_host(indices.data(), routes);
+  topk_weights.copy_to_host(weights.data(), routes);
+  topk_slots.copy_to_host(slots.data(), routes);
+  expert_counts.copy_to_host(counts.data(), counts.size());
+  expert_tokens.copy_to_host(tokens.data(), tokens.size());
+
+  bool passed = true;
+  std::vector<int32_t> ref_counts(size_t(options.n) * options.l, 0);
+  std::vector<int32_t> bucket_hits(tokens.size(), 0);
+
+  for (int l = 0; l < options.l && passed; ++l) {
+    for (int m = 0; m < options.m && passed; ++m) {
+      // Reference top-k values. Experts with equal logits may be selected in any order,
+      // so the selection is checked through the logits of the selected experts.
+      std::vector<float> row(options.n);
+      for (int e = 0; e < options.n; ++e) {
+        row[e] = D(m, e, l);
+      }
+      std::vector<float> sorted_row = row;
+      std::sort(sorted_row.begin(), sorted_row.end(), std::greater<float>());
+
+      float max = sorted_row[0];
+      float sum = 0.f;
+      for (int e = 0; e < (options.renormalize ? TopK : options.n); ++e) {
+        sum += std::exp(sorted_row[e] - max);
+      }
+
+      float weight_sum = 0.f;
+      for (int j = 0; j < TopK; ++j) {
+        size_t route = (size_t(l) * options.m + m) * TopK + j;
+        int32_t e = indices[route];
+        if (e < 0 || e >= options.n) {
+          std::cerr << "  Token " << m << " route " << j << ": invalid expert " << e << std::endl;
+          passed = false;
+          break;
+        }
+        for (int i = 0; i < j; ++i) {
+          passed &= indices[route - j + i] != e;
+        }
+        float ref_weight = std::exp(row[e] - max) / sum;
+        passed &= row[e] == sorted_row[j];
+        passed &= std::abs(weights[route] - ref_weight) <= options.eps;
+        weight_sum += weights[route];
+
+        size_t bucket = size_t(l) * options.n + e;
+        ++ref_counts[bucket];
+        int32_t slot = slots[route];
+        passed &= slot >= 0;
+        if (slot >= 0 && slot < options.capacity) {
+          passed &= tokens[bucket * options.capacity + slot] == m * TopK + j;
+          ++bucket_hits[bucket * options.capacity + slot];
+        }
+        if (!passed) {
+          std::cerr << "  Token " << m << " route " << j << ": expert " << e << " logit " << row[e]
+                    << " (expected " << sorted_row[j] << "), weight " << weights[route]
+                    << " (expected " << ref_weight << "), slot " << slot << std::endl;
+          break;
+        }
+      }
+      if (options.renormalize && std::abs(weight_sum - 1.f) > options.eps * TopK) {
+        std::cerr << "  Token " << m << ": weights sum to " << weight_sum << std::endl;
+        passed = false;
+      }
+    }
+  }
+
+  // Every slot of a bucket is taken exactly once
+  for (size_t bucket = 0; bucket < counts.size() && passed; ++bucket) {
+    passed &= counts[bucket] == ref_counts[bucket];
+    for (int slot = 0; slot < std::min(counts[bucket], options.capacity); ++slot) {
+      passed &= bucket_hits[bucket * options.capacity + slot] == 1;
+    }
+    if (!passed) {
+      std::cerr << "  Expert " << bucket << ": count " << counts[bucket]
+                << " (expected " << ref_counts[bucket] << ")" << std::endl;
+    }
+  }
+
+  std::cout << "  Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+  return passed;
+}
+
+/// Execute a given example GEMM computation
+template <typename Gemm>
+int run(Options &options) {
+  initialize(options);
+
+  // Instantiate CUTLASS kernel depending on templates
+  Gemm gemm;
+
+  // Create a structure of gemm kernel arguments suitable for invoking an instance of Gemm
+  auto arguments = args_from_options(options);
+
+  // Using the arguments, query for extra workspace required for matrix multiplication computation
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+
+  // Allocate workspace memory
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  // Check if the problem size is supported or not
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+
+  // Initialize CUTLASS kernel with arguments and workspace pointer, this zeroes the expert counts
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(gemm.run());
+
+  // Check if output from CUTLASS kernel and reference kernel are equal or not
+  Result result;
+  result.passed = verify(options);
+
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0) {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      // Expert counts have to be zeroed before every routing
+      CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+      CUTLASS_CHECK(gemm.run());
+    }
+    timer.stop();
+
+    // Compute average runtime and GFLOPs.
+    float elapsed_ms = timer.elapsed_millis();
+    result.avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    result.gflops = options.gflops(result.avg_runtime_ms / 1000.0);
+
+    std::cout << "  Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << 'x' << options.l << std::endl;
+    std::cout << "  Top-K: " << TopK << std::endl;
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS: " << result.gflops << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture (compute capability 90).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.n > 256) {
+    std::cerr << "This example routes over at most 256 experts.\n";
+    return 0;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  run<Gemm>(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
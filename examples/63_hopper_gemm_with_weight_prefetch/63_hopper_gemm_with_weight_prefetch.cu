@@ -117,11 +117,6 @@
 #include "cutlass/util/reference/host/tensor_norm.h"
 #include "cutlass/util/reference/host/gett.hpp"
 
-
-#include "collective/dispatch_policy_extra.hpp"
-#include "collective/builder.hpp"
-#include "kernel/sm90_gemm_tma_warpspecialized_with_prefetch.hpp"
-
 #include "helper.h"
 #include "gemm_with_weight_prefetch_commandline.hpp"
 
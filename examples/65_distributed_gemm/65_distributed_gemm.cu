@@ -116,6 +116,7 @@
 #include "cutlass/experimental/distributed/device/dist_gemm_universal_wrapper.hpp"
 #include "cutlass/experimental/distributed/kernel/dist_gemm_kernel_wrapper.hpp"
 #include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_2d_schedules.hpp"
 
 #include "helper.h"
 
@@ -145,6 +146,21 @@ static constexpr int TP_ = TP{};
 // * GEMM + Reduce Scatter:
 //   * ReduceScatter1D_TilingA_RotatingC
 //   * ReduceScatter1D_TilingB_RotatingC
+//
+// * GEMM + All Reduce, for row-parallel layers with small M (one-shot is the lowest latency):
+//   * AllReduce1D_TilingB_OneShot
+//   * AllReduce1D_TilingB_TwoShot
+//
+// * Hierarchical All Gather + GEMM, for TP spanning several NVLink domains
+//   (e.g. AllGather2D_TilingCD_RotatingA<_4, _2> for 2 nodes of 4 GPUs):
+//   * AllGather2D_TilingCD_RotatingA
+//   * AllGather2D_TilingCD_RotatingB
+//   This example runs all devices from one process, which requires them to be peer accessible;
+//   multi-node runs pass NvshmemTransport to DistributedGemmUniversalAdapter instead.
+//
+// All Gather schedules copy peer slices with copy engines by default. Wrapping them in
+// WithPeerCopyMode selects communication CTAs on an SM budget, or direct TMA loads from peers,
+// e.g. WithPeerCopyMode<AllGather1D_TilingCD_RotatingA<TP>, PeerCopyMode::kCommunicationCtas, 8>.
 
 using DistSchedule = cutlass::distributed::schedules::AllGather1D_TilingCD_RotatingA<TP>;
 
@@ -0,0 +1,413 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Distributed GEMM (DistGEMM) schedule autotuner for Hopper
+
+    This example measures the peer bandwidth and latency matrices of the available devices, then
+    sweeps Distributed GEMM schedules, tile configurations and TP degrees for a given problem
+    size, and reports the fastest configuration along with its overlap efficiency: the
+    compute-only runtime of its local GEMMs over its end-to-end runtime.
+
+    To add candidates, extend the Schedules, TileConfigs and TPs lists below. Since each candidate
+    is compiled in, long lists increase build time.
+
+    Please refer to 65_distributed_gemm.cu for topology requirements; any TP degree that is larger
+    than the number of peer-accessible devices is skipped.
+
+    Example:
+
+      $ ./65_distributed_gemm_autotune --m=16384 --n=106496 --k=16384
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/command_line.h"
+
+// Distributed GEMM headers
+#include "cutlass/experimental/distributed/device/dist_gemm_universal_wrapper.hpp"
+#include "cutlass/experimental/distributed/kernel/dist_gemm_kernel_wrapper.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_1d_schedules.hpp"
+
+#include "helper.h"
+
+// Distributed GEMM helpers
+#include "dist_gemm_helpers.h"
+#include "dist_gemm_autotune.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Autotuning candidates
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// TP degrees (= number of processors/GPUs)
+using TPs = cute::tuple<_2, _4, _8>;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) && \
+  (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
+
+// Distributed GEMM tiling/sharding schedules
+namespace candidates {
+
+struct AllGatherRotatingA {
+  static constexpr char const* name = "AllGather1D_TilingCD_RotatingA";
+  template <class TP> using Schedule = cutlass::distributed::schedules::AllGather1D_TilingCD_RotatingA<TP>;
+};
+
+struct AllGatherRotatingB {
+  static constexpr char const* name = "AllGather1D_TilingCD_RotatingB";
+  template <class TP> using Schedule = cutlass::distributed::schedules::AllGather1D_TilingCD_RotatingB<TP>;
+};
+
+struct ReduceScatterTilingA {
+  static constexpr char const* name = "ReduceScatter1D_TilingA_RotatingC";
+  template <class TP> using Schedule = cutlass::distributed::schedules::ReduceScatter1D_TilingA_RotatingC<TP>;
+};
+
+struct ReduceScatterTilingB {
+  static constexpr char const* name = "ReduceScatter1D_TilingB_RotatingC";
+  template <class TP> using Schedule = cutlass::distributed::schedules::ReduceScatter1D_TilingB_RotatingC<TP>;
+};
+
+// Tile configurations
+template <class TileShape_, class ClusterShape_, class KernelSchedule_, class EpilogueSchedule_>
+struct TileConfig {
+  using TileShape = TileShape_;
+  using ClusterShape = ClusterShape_;
+  using KernelSchedule = KernelSchedule_;
+  using EpilogueSchedule = EpilogueSchedule_;
+
+  static std::string name() {
+    return std::to_string(size<0>(TileShape{})) + "x" + std::to_string(size<1>(TileShape{})) + "x" +
+      std::to_string(size<2>(TileShape{})) + "_" + std::to_string(size<0>(ClusterShape{})) + "x" +
+      std::to_string(size<1>(ClusterShape{})) + "x" + std::to_string(size<2>(ClusterShape{})) +
+      (cute::is_same_v<KernelSchedule, cutlass::gemm::KernelTmaWarpSpecializedPingpong> ? "_pingpong" : "_cooperative");
+  }
+};
+
+} // namespace candidates
+
+using Schedules = cute::tuple<
+  candidates::AllGatherRotatingA,
+  candidates::AllGatherRotatingB,
+  candidates::ReduceScatterTilingA,
+  candidates::ReduceScatterTilingB
+>;
+
+using TileConfigs = cute::tuple<
+  candidates::TileConfig<Shape<_128,_256,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong, cutlass::epilogue::TmaWarpSpecialized>,
+  candidates::TileConfig<Shape<_256,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative, cutlass::epilogue::TmaWarpSpecializedCooperative>
+>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A matrix configuration
+using         ElementA    = cutlass::half_t;                                // Element type for A matrix operand
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for A matrix operand
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A matrix in units of elements (up to 16 bytes)
+
+// B matrix configuration
+using         ElementB    = cutlass::half_t;                                // Element type for B matrix operand
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of B matrix in units of elements (up to 16 bytes)
+
+// C matrix configuration
+using         ElementC    = cutlass::half_t;                                // Element type for C and D matrix operands
+using         LayoutC     = cutlass::layout::ColumnMajor;                   // Layout type for C and D matrix operands
+constexpr int AlignmentC  = 128 / cutlass::sizeof_bits<ElementC>::value;    // Memory access granularity/alignment of C matrix in units of elements (up to 16 bytes)
+
+// D matrix configuration
+using         ElementD    = ElementC;
+using         LayoutD     = LayoutC;
+constexpr int AlignmentD  = AlignmentC;
+
+// Core kernel configurations
+using ElementAccumulator  = cutlass::half_t;                                // Element type for internal accumulation
+using ElementCompute      = cutlass::half_t;                                // Element type for epilogue computation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using EpilogueTileType    = cutlass::epilogue::collective::EpilogueTileAuto;
+
+template <class TP, class ScheduleCandidate, class TileConfig>
+struct DistGemmConfig {
+  using DistSchedule = typename ScheduleCandidate::template Schedule<TP>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      ArchTag, OperatorClass,
+      typename TileConfig::TileShape, typename TileConfig::ClusterShape,
+      EpilogueTileType,
+      ElementAccumulator, ElementCompute,
+      ElementC, LayoutC, AlignmentC,
+      ElementD, LayoutD, AlignmentD,
+      typename TileConfig::EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      ArchTag, OperatorClass,
+      ElementA, LayoutA, AlignmentA,
+      ElementB, LayoutB, AlignmentB,
+      ElementAccumulator,
+      typename TileConfig::TileShape, typename TileConfig::ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<
+        static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))
+      >,
+      typename TileConfig::KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>, // Indicates ProblemShape
+      CollectiveMainloop,
+      CollectiveEpilogue
+  >;
+
+  // Single-device GEMM, used to measure compute-only runtime
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  using DistGemmKernel = cutlass::distributed::kernel::DistributedGemmKernelWrapper<
+    GemmKernel,
+    DistSchedule
+  >;
+  using DistGemm = cutlass::distributed::device::DistributedGemmUniversalAdapter<DistGemmKernel>;
+
+  static std::string name() {
+    return std::string(ScheduleCandidate::name) + " " + TileConfig::name();
+  }
+};
+
+#endif // (defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) &&
+       // (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  float alpha = 1.f, beta = 0.f;
+  int iterations = 20;
+  int warmup_iterations = 5;
+  int m = 16384, n = 106496, k = 16384, l = 1;
+  int max_tp = 8;
+  bool skip_topology = false;
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("l", l);
+    cmd.get_cmd_line_argument("alpha", alpha);
+    cmd.get_cmd_line_argument("beta", beta);
+    cmd.get_cmd_line_argument("iterations", iterations);
+    cmd.get_cmd_line_argument("warmup-iterations", warmup_iterations);
+    cmd.get_cmd_line_argument("max-tp", max_tp);
+    skip_topology = cmd.check_cmd_line_flag("skip-topology");
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "65_distributed_gemm_autotune\n\n"
+      << "  Hopper Distributed GEMM (DistGEMM) schedule autotuner. \n"
+      << "  For more details please refer to the source file.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM\n"
+      << "  --l=<int>                   Sets the L extent (batch) of the GEMM (default: 1)\n"
+      << "  --alpha=<f32>               Epilogue scalar alpha (default: 1.0)\n"
+      << "  --beta=<f32>                Epilogue scalar beta (default: 0.0)\n"
+      << "  --iterations=<int>          Number of profiling iterations per configuration (default: 20)\n"
+      << "  --warmup-iterations=<int>   Number of warmup iterations per configuration (default: 5)\n"
+      << "  --max-tp=<int>              Largest TP degree to sweep (default: 8)\n"
+      << "  --skip-topology             If specified, skips measuring peer bandwidth and latency\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "65_distributed_gemm_autotune" << " --m=16384 --n=106496 --k=16384 \n\n";
+
+    return out;
+  }
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) && \
+  (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Autotuning
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int run(Options &options, int num_devices) {
+
+  int max_tp = std::min(options.max_tp, num_devices);
+  if (not cutlass::enable_peer_access(max_tp)) {
+    return -1;
+  }
+
+  if (not options.skip_topology) {
+    cutlass::PeerTopology topology;
+    topology.measure(max_tp);
+    std::cout << std::endl;
+    topology.print(std::cout);
+  }
+
+#if defined(CUTLASS_ENABLE_GDC_FOR_SM90)
+  bool launch_with_pdl = true;
+#else
+  bool launch_with_pdl = false;
+#endif
+
+  auto problem_shape = cute::make_tuple(options.m, options.n, options.k, options.l);
+  std::vector<cutlass::DistGemmProfileResult> results;
+
+  std::cout << "  Problem Size: " <<
+    options.m << " x " <<
+    options.n << " x " <<
+    options.k << " x " <<
+    options.l << std::endl << std::endl;
+
+  cute::for_each(TPs{}, [&](auto tp) {
+    using TP = decltype(tp);
+    if (TP{} > max_tp) {
+      return;
+    }
+    cute::for_each(Schedules{}, [&](auto schedule) {
+      cute::for_each(TileConfigs{}, [&](auto tile_config) {
+        using Config = DistGemmConfig<TP, decltype(schedule), decltype(tile_config)>;
+
+        std::cout << "  profiling " << Config::name() << " (TP = " << TP{} << ")..." << std::endl;
+        results.push_back(cutlass::profile_dist_gemm<typename Config::DistGemm, typename Config::Gemm>(
+            Config::name(),
+            problem_shape,
+            options.alpha,
+            options.beta,
+            options.warmup_iterations,
+            options.iterations,
+            launch_with_pdl));
+      });
+    });
+  });
+
+  std::cout << std::endl;
+  cutlass::print_profile_results(results, std::cout);
+
+  return 0;
+}
+
+#endif // (defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) &&
+       // (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA Toolkit 12.6 or newer to run this example
+  // and must have compute capability at least 90.
+  // Some necessary cuda graph APIs were only introduced in CUDA 12.6.
+  if (__CUDACC_VER_MAJOR__ < 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ < 6)) {
+    std::cerr << "This example requires CUDA 12.6 or newer." << std::endl;
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  int num_devices;
+  CUDA_CHECK(cudaGetDeviceCount(&num_devices));
+  if (num_devices < 2) {
+    std::cerr << "Distributed GEMM requires at least 2 devices, but found only " << num_devices << "." <<
+      std::endl;
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  CUDA_CHECK(cudaGetDeviceProperties(&props, 0));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture "
+      << "(compute capability 90)." << std::endl;
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  //
+  // Autotune CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED) && \
+  (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
+  return run(options, num_devices);
+#else
+    std::cerr
+      << "This example must be compiled with `sm90a` and CUDA Toolkit 12.6 or later." << std::endl;
+    return 0;
+#endif
+}
@@ -48,12 +48,57 @@
     The output scale gets passed to the collective mainloop, and is applied
     using FP32 compute pre-quantization
 
+    KV Dequantization
+    -----------------
+
+    Besides the per tensor scale_k and scale_v, K and V can be dequantized with
+    per KV head scales (ptr_scale_k, ptr_scale_v). The K scale is folded into the
+    softmax scale and the V scale into the output scale of each tile, so an FP8
+    KV cache needs no extra pass over the data.
+
     Variable Sequence Length
     ------------------------
 
     For variable sequence length, pass in VariableLength objects
     (max_seqlen, cumulative_seqlen_ptr) in the problem shape for
-    seqlen Q and KV.
+    seqlen Q and KV. The persistent kernel then schedules the batches by
+    decreasing KV length, so a few long sequences packed with many short ones
+    start first instead of being the tail of the launch.
+
+    Paged KV Cache
+    --------------
+
+    K and V can be read from a paged cache by passing a page table and a page
+    size that is a multiple of the KV tile. The batch mode of K and V then indexes
+    pages, and each KV tile is loaded from the page the table maps it to. Paired
+    with a Q extent smaller than the K extent and the qend causal mask, this is
+    chunked prefill on top of a prefix held in the cache.
+
+    Rotary Position Embedding
+    -------------------------
+
+    --rope=<interleaved|half> rotates Q and K in the load warp on their way into
+    shared memory, from cos/sin tables with --rope-table or otherwise computed,
+    instead of running a separate rotary embedding pass over Q and K beforehand.
+    The rotated K can also be stored, e.g. into the cache the next step reads.
+
+    Local and Block Sparse Masks
+    ----------------------------
+
+    --mask=local restricts every query to a band of keys, a sliding window of
+    --window-left keys before and --window-right keys after it, optionally
+    confined to chunks of --chunk positions (chunked local attention when only
+    --chunk is given). --mask=block-sparse instead drops a random --sparsity
+    fraction of the 128x128 blocks of the attention matrix. In both cases KV
+    tiles that no query of a Q tile can see are skipped entirely rather than
+    computed and masked.
+
+    Soft-Capping and Attention Sinks
+    --------------------------------
+
+    --soft-cap=<float> passes the scaled scores through soft_cap * tanh(s / soft_cap)
+    before the softmax (Gemma 2), and --sinks adds a random sink logit per query head
+    to the softmax denominator. Both wrap whichever mask is selected.
 
     Support
     ---------
@@ -68,6 +113,7 @@
 */
 
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <regex>
 
@@ -80,6 +126,7 @@
 #include "cutlass/util/distribution.h"
 #include "cutlass/util/reference/device/tensor_fill.h"
 #include "reference/fmha_fwd_reference.hpp"
+#include "reference/fmha_rope_reference.hpp"
 #include "reference/reference_abs_error.hpp"
 
 #include "device/fmha.hpp"
@@ -128,8 +175,20 @@ struct Options {
   bool causal = false;
   bool causal_q_begin = true;
   bool residual = false;
+  bool local = false;
+  int window_left = -1;
+  int window_right = 0;
+  int chunk_size = 0;
+  bool block_sparse = false;
+  float sparsity = 0.5f;
+  float soft_cap = 0.0f;
+  bool sinks = false;
   bool varlen = false;
   bool persistent = false;
+  int page = 0;
+  bool kv_scale = false;
+  std::string rope;
+  bool rope_table = false;
   int sm_count = 0;
   std::string kernel_filter;
 
@@ -264,6 +323,31 @@ struct Options {
     verify = cmd.check_cmd_line_flag("verify");
     verbose = cmd.check_cmd_line_flag("verbose");
     persistent = cmd.check_cmd_line_flag("persistent");
+    cmd.get_cmd_line_argument("page", page, defaults.page);
+    kv_scale = cmd.check_cmd_line_flag("kv-scale");
+    if (page > 0 && varlen) {
+      std::cout << "Error: Can't combine --page and --varlen\n";
+      error = true;
+      return;
+    }
+    cmd.get_cmd_line_argument<std::string>("rope", rope, "");
+    rope_table = cmd.check_cmd_line_flag("rope-table");
+    if (! rope.empty() && rope != "interleaved" && rope != "half") {
+      std::cout << "Error: " << rope << " is not a valid rope variant.\n";
+      error = true;
+      return;
+    }
+    if (! rope.empty() && (varlen || kv_scale)) {
+      std::cout << "Error: Can't combine --rope with --varlen or --kv-scale\n";
+      error = true;
+      return;
+    }
+    if (! rope.empty() && rope_table && q > k) {
+      // the queries are the last positions of the table
+      std::cout << "Error: --rope-table needs a Q extent no larger than the K extent\n";
+      error = true;
+      return;
+    }
 
     std::string mask;
     cmd.get_cmd_line_argument<std::string>("mask", mask, "");
@@ -288,6 +372,19 @@ struct Options {
       residual = true;
       causal = false;
     }
+    else if (mask == "local") {
+      local = true;
+      causal_q_begin = causal_type != "qend";
+      cmd.get_cmd_line_argument("window-left", window_left, defaults.window_left);
+      cmd.get_cmd_line_argument("window-right", window_right, defaults.window_right);
+      cmd.get_cmd_line_argument("chunk", chunk_size, defaults.chunk_size);
+    }
+    else if (mask == "block-sparse") {
+      block_sparse = true;
+      cmd.get_cmd_line_argument("sparsity", sparsity, defaults.sparsity);
+    }
+    cmd.get_cmd_line_argument("soft-cap", soft_cap, defaults.soft_cap);
+    sinks = cmd.check_cmd_line_flag("sinks");
     cmd.get_cmd_line_argument("sm-count", sm_count, defaults.sm_count);
     get_init_style_argument(cmd, "init-style", init_style_q, defaults.init_style_q);
     get_init_style_argument(cmd, "init-style", init_style_k, defaults.init_style_q);
@@ -320,9 +417,20 @@ struct Options {
       << "  --iterations=<int>          Benchmarking iterations\n"
       << "  --verify                    Verify results\n"
       << "  --verbose                   Print smem and execution time per kernel\n"
-      << "  --mask=<no|residual|causal> Enables masking\n"
-      << "  --causal-type=<qbegin|qend> Causal mask type\n"
+      << "  --mask=<no|residual|causal|local|block-sparse>\n"
+      << "                              Enables masking\n"
+      << "  --causal-type=<qbegin|qend> Causal mask type, also aligns the local mask\n"
+      << "  --window-left=<int>         Keys before the query a local mask keeps, -1 for all\n"
+      << "  --window-right=<int>        Keys after the query a local mask keeps, -1 for all\n"
+      << "  --chunk=<int>               Confines a local mask to chunks of this size\n"
+      << "  --sparsity=<float>          Fraction of blocks a block sparse mask drops\n"
+      << "  --soft-cap=<float>          Soft-caps the scaled scores with this cap, 0 for none\n"
+      << "  --sinks                     Adds an attention sink per query head\n"
       << "  --persistent                Enables persistent scheduler\n"
+      << "  --page=<int>                Reads K and V from shuffled pages of this size\n"
+      << "  --kv-scale                  Dequantizes K and V with per KV head scales\n"
+      << "  --rope=<interleaved|half>   Applies rotary position embedding to Q and K while loading\n"
+      << "  --rope-table                Reads the rope angles from cos/sin tables instead of computing them\n"
       << "  --varlen                    Enables variable sequence length\n"
       << "                              B*Q and B*K become the total sequence length\n"
       << "                              and are split B-ways, alternatingly +10% and -10%\n"
@@ -431,7 +539,10 @@ struct FwdRunner {
   using StrideLSE = cute::tuple<_1, cute::tuple<cute::tuple<int, int>, int>>;     // Q ((H_R, H_K), B)
 
   static constexpr bool kIsPersistent = find_option_t<Tag::kIsPersistent, true_type, KernelOptions...>::value;
-  using TileScheduler = std::conditional_t<kIsPersistent, cutlass::fmha::kernel::PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>;
+  using PersistentTileScheduler = std::conditional_t<kIsVarlen,
+      cutlass::fmha::kernel::VarlenPersistentTileScheduler,
+      cutlass::fmha::kernel::PersistentTileScheduler>;
+  using TileScheduler = std::conditional_t<kIsPersistent, PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>;
 
   using Mainloop = 
     cutlass::fmha::collective::Sm100FmhaFwdMainloopTmaWarpspecialized<
@@ -473,6 +584,13 @@ struct FwdRunner {
     DeviceAllocation<ElementAccumulatorPV> block_ref_LSE;
     DeviceAllocation<int> device_cumulative_seqlen_q;
     DeviceAllocation<int> device_cumulative_seqlen_kv;
+    DeviceAllocation<Element> block_paged_K;
+    DeviceAllocation<Element> block_paged_V;
+    DeviceAllocation<Element> block_quant_K;
+    DeviceAllocation<Element> block_quant_V;
+    DeviceAllocation<Element> block_rope_Q;
+    DeviceAllocation<Element> block_rope_K;
+    DeviceAllocation<Element> block_K_rotated;
 
     DeviceBuffer() = default;
     DeviceBuffer(const DeviceBuffer&) = delete;
@@ -482,7 +600,11 @@ struct FwdRunner {
       return block_Q.get_storage_size() + block_K.get_storage_size() + block_V.get_storage_size()
           + block_O.get_storage_size() + block_LSE.get_storage_size() + block_ref_O.get_storage_size()
           + block_ref_LSE.get_storage_size() + device_cumulative_seqlen_q.get_storage_size()
-          + device_cumulative_seqlen_kv.get_storage_size();
+          + device_cumulative_seqlen_kv.get_storage_size()
+          + block_paged_K.get_storage_size() + block_paged_V.get_storage_size()
+          + block_quant_K.get_storage_size() + block_quant_V.get_storage_size()
+          + block_rope_Q.get_storage_size() + block_rope_K.get_storage_size()
+          + block_K_rotated.get_storage_size();
     }
   };
 
@@ -491,15 +613,62 @@ struct FwdRunner {
   std::vector<int> cumulative_seqlen_q;
   std::vector<int> cumulative_seqlen_kv;
 
+  // paged K/V, the reference still reads the contiguous K/V
+  int page_size = 0;
+  int pages_per_batch = 0;
+  std::vector<int> page_table;
+  DeviceAllocation<int> block_page_table;
+  StrideK stride_paged_K;
+  StrideV stride_paged_V;
+
+  // per KV head scales, the kernel reads K/V quantized by them while the reference
+  // reads the original K/V, powers of two keep the round trip exact
+  std::vector<float> kv_head_scale;
+  DeviceAllocation<float> block_kv_head_scale;
+
+  // rotary position embedding, the reference reads Q and K rotated up front with the
+  // same parameters, and compares the rotated K the kernel stores if not paged
+  Rope rope;
+  std::vector<float> rope_cos;
+  std::vector<float> rope_sin;
+  DeviceAllocation<float> block_rope_cos;
+  DeviceAllocation<float> block_rope_sin;
+
+  // runtime state of the mask, shared by the kernel and the reference
+  ActiveMask mask;
+  std::vector<uint32_t> block_sparse_mask;
+  DeviceAllocation<uint32_t> block_block_sparse_mask;
+  // fraction of the attention matrix the mask keeps, for the flop count
+  double mask_density = 1.0;
+  std::vector<float> sinks;
+  DeviceAllocation<float> block_sinks;
+
   //
   // Methods
   //
   bool verify(const ProblemShapeType& problem_shape, DeviceBuffer& buffer) {
-    Tensor mQ = make_tensor(make_gmem_ptr(buffer.block_Q.get()),
+    Element* ptr_Q = buffer.block_Q.get();
+    Element* ptr_K = buffer.block_K.get();
+    if constexpr (! kIsVarlen) {
+      if (rope.is_enabled()) {
+        fmha_rope_reference(rope,
+            make_tensor(make_gmem_ptr(ptr_Q), select<0,2,3>(problem_shape), stride_Q),
+            make_tensor(make_gmem_ptr(buffer.block_rope_Q.get()), select<0,2,3>(problem_shape), stride_Q),
+            get<1>(problem_shape) - get<0>(problem_shape));
+        fmha_rope_reference(rope,
+            make_tensor(make_gmem_ptr(ptr_K), select<1,2,3>(problem_shape), stride_K),
+            make_tensor(make_gmem_ptr(buffer.block_rope_K.get()), select<1,2,3>(problem_shape), stride_K),
+            0);
+        ptr_Q = buffer.block_rope_Q.get();
+        ptr_K = buffer.block_rope_K.get();
+      }
+    }
+
+    Tensor mQ = make_tensor(make_gmem_ptr(ptr_Q),
       select<0,2,3>(problem_shape),
       stride_Q);
 
-    Tensor mK = make_tensor(make_gmem_ptr(buffer.block_K.get()),
+    Tensor mK = make_tensor(make_gmem_ptr(ptr_K),
       select<1,2,3>(problem_shape),
       stride_K);
 
@@ -519,7 +688,7 @@ struct FwdRunner {
 
     auto problem_shape_ref = cute::make_tuple(Q, K, D, D, HB);
 
-    fmha_reference(problem_shape_ref, mQ, mK, mV, mO, mLSE, ActiveMask{});
+    fmha_reference(problem_shape_ref, mQ, mK, mV, mO, mLSE, mask);
 
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
@@ -550,7 +719,18 @@ struct FwdRunner {
                 << " mean " << mean_diff << std::endl;
     }
 
-    return passed_O && passed_LSE;
+    bool passed_K = true;
+    if (buffer.block_K_rotated.size() > 0) {
+      reference_abs_diff(buffer.block_K_rotated, buffer.block_rope_K, max_diff, mean_diff);
+
+      passed_K = (max_diff < kMaxDiffThresh) && (mean_diff < kMeanDiffThresh);
+      if ( ! passed_K) {
+        std::cerr << "failed rotated K: max diff " << max_diff 
+                  << " mean " << mean_diff << std::endl;
+      }
+    }
+
+    return passed_O && passed_LSE && passed_K;
   }
 
   template<class ProblemShape>
@@ -668,6 +848,126 @@ struct FwdRunner {
       get<1,1>(stride_LSE) = 0;
     }
 
+    if (options.page > 0) {
+      page_size = options.page;
+      pages_per_batch = cute::ceil_div(SK, page_size);
+
+      // scatter the pages of all batches across the paged K/V
+      page_table.resize(B * pages_per_batch);
+      std::iota(page_table.begin(), page_table.end(), 0);
+      std::mt19937 rng(0x202510141200ull);
+      std::shuffle(page_table.begin(), page_table.end(), rng);
+      block_page_table.reset(page_table.size());
+      block_page_table.copy_from_host(page_table.data(), page_table.size());
+
+      stride_paged_K = stride_K;
+      get<2,1>(stride_paged_K) = H_K*D*page_size;
+      stride_paged_V = stride_paged_K;
+    }
+
+    if (options.kv_scale) {
+      kv_head_scale.resize(H_K);
+      for (int h = 0; h < H_K; h++) {
+        kv_head_scale[h] = 1.0f / static_cast<float>(2 << (h % 2));
+      }
+      block_kv_head_scale.reset(H_K);
+      block_kv_head_scale.copy_from_host(kv_head_scale.data(), kv_head_scale.size());
+    }
+
+    if (! options.rope.empty()) {
+      rope.mode = options.rope == "half" ? RopeMode::kHalf : RopeMode::kInterleaved;
+      if (options.rope_table) {
+        rope_cos.resize(size_t(SK) * D / 2);
+        rope_sin.resize(size_t(SK) * D / 2);
+        for (int pos = 0; pos < SK; pos++) {
+          for (int i = 0; i < D / 2; i++) {
+            double angle = pos * std::pow(static_cast<double>(rope.theta), -2.0 * i / D);
+            rope_cos[size_t(pos) * D / 2 + i] = static_cast<float>(std::cos(angle));
+            rope_sin[size_t(pos) * D / 2 + i] = static_cast<float>(std::sin(angle));
+          }
+        }
+        block_rope_cos.reset(rope_cos.size());
+        block_rope_cos.copy_from_host(rope_cos.data(), rope_cos.size());
+        block_rope_sin.reset(rope_sin.size());
+        block_rope_sin.copy_from_host(rope_sin.data(), rope_sin.size());
+        rope.ptr_cos = block_rope_cos.get();
+        rope.ptr_sin = block_rope_sin.get();
+      }
+    }
+
+    int max_seqlen_q = get<0>(problem_shape);
+    int max_seqlen_kv = get<1>(problem_shape);
+    if constexpr (ActiveMask::kIsSoftCapping) {
+      mask.soft_cap = options.soft_cap;
+    }
+    if constexpr (ActiveMask::kHasSink) {
+      // around the size of the scaled scores, so that the sinks take a visible share
+      std::mt19937 rng(0x202610141200ull);
+      std::normal_distribution<float> dist(0.0f, 1.0f);
+      sinks.resize(options.h);
+      for (auto& sink : sinks) {
+        sink = dist(rng);
+      }
+      block_sinks.reset(sinks.size());
+      block_sinks.copy_from_host(sinks.data(), sinks.size());
+      mask.ptr_sink = block_sinks.get();
+    }
+    if constexpr (is_local_mask_v<ActiveMask>) {
+      mask.window_left = options.window_left;
+      mask.window_right = options.window_right;
+      mask.chunk_size = options.chunk_size;
+      int64_t visible = 0;
+      for (int q = 0; q < max_seqlen_q; q++) {
+        int q_offset = q + mask.get_offset_q(cute::make_tuple(max_seqlen_q, max_seqlen_kv));
+        visible += std::max(mask.get_last_key(q_offset, max_seqlen_kv) - mask.get_first_key(q_offset) + 1, 0);
+      }
+      mask_density = static_cast<double>(visible) / max_seqlen_q / max_seqlen_kv;
+    }
+    if constexpr (is_block_sparse_mask_v<ActiveMask>) {
+      // every q block keeps the kv block on its diagonal, so no row is fully masked
+      int blocks_q = cute::ceil_div(max_seqlen_q, mask.block_q);
+      int blocks_k = cute::ceil_div(max_seqlen_kv, mask.block_k);
+      mask.stride = cute::ceil_div(blocks_k, 32);
+      block_sparse_mask.assign(blocks_q * mask.stride, 0u);
+      std::mt19937 rng(0x202510141500ull);
+      std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+      int enabled = 0;
+      for (int r = 0; r < blocks_q; r++) {
+        for (int c = 0; c < blocks_k; c++) {
+          if (c == std::min(r * blocks_k / blocks_q, blocks_k - 1) || dist(rng) >= options.sparsity) {
+            block_sparse_mask[r * mask.stride + c / 32] |= 1u << (c % 32);
+            enabled += 1;
+          }
+        }
+      }
+      block_block_sparse_mask.reset(block_sparse_mask.size());
+      block_block_sparse_mask.copy_from_host(block_sparse_mask.data(), block_sparse_mask.size());
+      mask.ptr_block_mask = block_block_sparse_mask.get();
+      mask_density = static_cast<double>(enabled) / blocks_q / blocks_k;
+    }
+
+    auto quantize_block = [&](DeviceAllocation<Element>& dst, DeviceAllocation<Element> const& src) {
+      std::vector<Element> data(src.size());
+      cudaMemcpy(data.data(), src.get(), data.size() * sizeof(Element), cudaMemcpyDeviceToHost);
+      for (size_t i = 0; i < data.size(); i++) {
+        int h = static_cast<int>((i / D) % H_K);
+        data[i] = static_cast<Element>(static_cast<float>(data[i]) / kv_head_scale[h]);
+      }
+      dst.reset(src.size());
+      dst.copy_from_host(data.data(), data.size());
+    };
+
+    auto copy_to_pages = [&](Element* dst, Element const* src) {
+      for (int b = 0; b < B; b++) {
+        for (int i = 0; i < pages_per_batch; i++) {
+          int rows = std::min(page_size, SK - i * page_size);
+          size_t offset = (size_t(b) * SK + size_t(i) * page_size) * H_K * D;
+          size_t offset_paged = size_t(page_table[b * pages_per_batch + i]) * page_size * H_K * D;
+          cudaMemcpy(dst + offset_paged, src + offset, sizeof(Element) * rows * H_K * D, cudaMemcpyDeviceToDevice);
+        }
+      }
+    };
+
     auto buffer_init_fn = [&](auto& buffer) {
       buffer.block_Q.reset(size(shape_QO));
       buffer.block_K.reset(size(shape_KV));
@@ -681,6 +981,32 @@ struct FwdRunner {
       initialize_block(buffer.block_K, seed + 2022, options.init_style_k);
       initialize_block(buffer.block_V, seed + 2021, options.init_style_v);
 
+      if (rope.is_enabled()) {
+        buffer.block_rope_Q.reset(size(shape_QO));
+        buffer.block_rope_K.reset(size(shape_KV));
+        // every K tile is loaded, and so stored rotated, only if the mask skips none
+        if (options.page == 0 && ! options.causal && ! options.local && ! options.block_sparse) {
+          buffer.block_K_rotated.reset(size(shape_KV));
+        }
+      }
+
+      if (options.kv_scale) {
+        quantize_block(buffer.block_quant_K, buffer.block_K);
+        quantize_block(buffer.block_quant_V, buffer.block_V);
+      }
+      Element* ptr_K = options.kv_scale ? buffer.block_quant_K.get() : buffer.block_K.get();
+      Element* ptr_V = options.kv_scale ? buffer.block_quant_V.get() : buffer.block_V.get();
+
+      if (page_size > 0) {
+        buffer.block_paged_K.reset(page_table.size() * page_size * H_K * D);
+        buffer.block_paged_V.reset(page_table.size() * page_size * H_K * D);
+        // rows past the end of the last page are masked, but must not hold NaNs for P*V
+        cudaMemset(buffer.block_paged_K.get(), 0, buffer.block_paged_K.size() * sizeof(Element));
+        cudaMemset(buffer.block_paged_V.get(), 0, buffer.block_paged_V.size() * sizeof(Element));
+        copy_to_pages(buffer.block_paged_K.get(), ptr_K);
+        copy_to_pages(buffer.block_paged_V.get(), ptr_V);
+      }
+
       if ( ! cumulative_seqlen_q.empty()) {
         buffer.device_cumulative_seqlen_q.reset(cumulative_seqlen_q.size());
         buffer.device_cumulative_seqlen_q.copy_from_host(
@@ -725,6 +1051,28 @@ struct FwdRunner {
         buffers[buffer_index]->block_LSE.get(), stride_LSE },
       hw_info
     };
+    arguments.mainloop.mask = mask;
+    if ( ! kv_head_scale.empty()) {
+      arguments.mainloop.load.ptr_K = buffers[buffer_index]->block_quant_K.get();
+      arguments.mainloop.load.ptr_V = buffers[buffer_index]->block_quant_V.get();
+      arguments.mainloop.ptr_scale_k = block_kv_head_scale.get();
+      arguments.mainloop.ptr_scale_v = block_kv_head_scale.get();
+    }
+    if (rope.is_enabled()) {
+      arguments.mainloop.load.rope = rope;
+      arguments.mainloop.load.ptr_K_rotated = buffers[buffer_index]->block_K_rotated.get();
+    }
+    if (page_size > 0) {
+      auto& load = arguments.mainloop.load;
+      load.ptr_K = buffers[buffer_index]->block_paged_K.get();
+      load.dK = stride_paged_K;
+      load.ptr_V = buffers[buffer_index]->block_paged_V.get();
+      load.dV = stride_paged_V;
+      load.ptr_page_table = block_page_table.get();
+      load.stride_page_table = pages_per_batch;
+      load.page_count = static_cast<int>(page_table.size());
+      load.page_size = page_size;
+    }
     return arguments;
   }
 
@@ -866,7 +1214,8 @@ struct FwdRunner {
       flops *= static_cast<double>(size<1>(problem_shape));
       flops *= static_cast<double>(size<3,1>(problem_shape));
     }
-    flops *= 4.0 * (std::is_same_v<ActiveMask, CausalMask<true>> || std::is_same_v<ActiveMask, CausalMask<false>> ? 0.5 : 1.0);
+    flops *= 4.0 * (std::is_base_of_v<CausalMask<true>, ActiveMask> || std::is_base_of_v<CausalMask<false>, ActiveMask> ? 0.5 : 1.0);
+    flops *= mask_density;
     flops *= static_cast<double>(size<2>(problem_shape));
     flops *= static_cast<double>(size<3,0>(problem_shape));
     double tflops_s = flops * 1e-12 /*tera*/ / (runtime_ms * 1e-3 /*ms*/);
@@ -1087,9 +1436,46 @@ int main_single(int argc, char const **args) {
 
   std::cout << "###### B " << options.b << " H " << options.h << " H_K " << options.h_k << " Q " << options.q << " K " << options.k << " D " << options.d << " ";
   std::cout << "Forward" << " " << (options.causal ? "Causal" : (options.residual ? "Residual" : "None")) << " ";
+  if (options.local) {
+    std::cout << "Local " << options.window_left << ":" << options.window_right << " Chunk " << options.chunk_size << " ";
+  }
+  if (options.block_sparse) {
+    std::cout << "Block-Sparse " << options.sparsity << " ";
+  }
+  if (options.page > 0) {
+    std::cout << "Paged " << options.page << " ";
+  }
+  if (options.kv_scale) {
+    std::cout << "KV-Scale ";
+  }
+  if (options.soft_cap > 0) {
+    std::cout << "Soft-Cap " << options.soft_cap << " ";
+  }
+  if (options.sinks) {
+    std::cout << "Sinks ";
+  }
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
-  auto with_mask = [&](auto fn) {
+  auto with_score_mod = [&](auto fn) {
+    return [&, fn](auto mask) {
+      using Mask = decltype(mask);
+      if (options.soft_cap > 0 && options.sinks) {
+        fn(AttentionSink<SoftCapping<Mask>>{});
+      }
+      else if (options.soft_cap > 0) {
+        fn(SoftCapping<Mask>{});
+      }
+      else if (options.sinks) {
+        fn(AttentionSink<Mask>{});
+      }
+      else {
+        fn(mask);
+      }
+    };
+  };
+
+  auto with_mask = [&](auto fn_) {
+    auto fn = with_score_mod(fn_);
     if (options.causal) {
       if(options.causal_q_begin) {
         fn(CausalMask{});
@@ -1100,6 +1486,16 @@ int main_single(int argc, char const **args) {
     else if (options.residual) {
       fn(ResidualMask{});
     }
+    else if (options.local) {
+      if (options.causal_q_begin) {
+        fn(LocalMask<true>{});
+      } else {
+        fn(LocalMask<false>{});
+      }
+    }
+    else if (options.block_sparse) {
+      fn(BlockSparseMask{});
+    }
     else {
       fn(NoMask{});
     }
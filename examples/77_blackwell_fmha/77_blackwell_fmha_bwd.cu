@@ -47,6 +47,21 @@
     Implementing this kernel in CUTLASS enabled easy customization and high
     performance.
 
+    Deterministic dQ
+    ----------------
+    By default, dQ is accumulated with TMA reduce-adds from every KV block, so
+    the fp32 summation order depends on scheduling. With --deterministic, each
+    KV block writes its own zero-initialized fp32 partial and the convert kernel
+    sums the partials in a fixed order, at the cost of K/128 times the dQ
+    workspace. Both variants are timed so the overhead can be compared.
+
+    Soft-Capping and Attention Sinks
+    --------------------------------
+    --soft-cap=<float> and --sinks wrap the mask as in the forward example. The
+    capped scores are recomputed and dS is scaled by the slope of the cap, while
+    sinks only enter through the LSE of the forward pass. Their gradient, one
+    per query head, is accumulated by the sum(O*dO) preprocessing kernel.
+
     Introduction
     ------------
     The example targets the NVIDIA Blackwell architecture, and takes advantage of
@@ -68,6 +83,7 @@
             --b=2048 --h=2048 --d=2048 --q=2048 --k=2048
 */
 
+#include <cstring>
 #include <iostream>
 #include <random>
 #include <regex>
@@ -121,9 +137,18 @@ struct Options {
   int iterations = 3;
   bool verify = false;
   bool verbose = false;
+  bool deterministic = false;
 
   bool causal = false;
   bool residual = false;
+  bool local = false;
+  int window_left = -1;
+  int window_right = 0;
+  int chunk_size = 0;
+  bool block_sparse = false;
+  float sparsity = 0.5f;
+  float soft_cap = 0.0f;
+  bool sinks = false;
   bool varlen = false;
   int sm_count = 0;
 
@@ -261,6 +286,7 @@ struct Options {
     cmd.get_cmd_line_argument("iterations", iterations, defaults.iterations);
     verify = cmd.check_cmd_line_flag("verify");
     verbose = cmd.check_cmd_line_flag("verbose");
+    deterministic = cmd.check_cmd_line_flag("deterministic");
     std::string mask;
     cmd.get_cmd_line_argument<std::string>("mask", mask, "");
     if (mask == "causal") {
@@ -269,12 +295,24 @@ struct Options {
     else if (mask == "residual") {
       residual = true;
     }
+    else if (mask == "local") {
+      local = true;
+      cmd.get_cmd_line_argument("window-left", window_left, defaults.window_left);
+      cmd.get_cmd_line_argument("window-right", window_right, defaults.window_right);
+      cmd.get_cmd_line_argument("chunk", chunk_size, defaults.chunk_size);
+    }
+    else if (mask == "block-sparse") {
+      block_sparse = true;
+      cmd.get_cmd_line_argument("sparsity", sparsity, defaults.sparsity);
+    }
     else {
       causal = defaults.causal;
     }
     if (varlen) {
       residual = true;
     }
+    cmd.get_cmd_line_argument("soft-cap", soft_cap, defaults.soft_cap);
+    sinks = cmd.check_cmd_line_flag("sinks");
 
     skip_reference = cmd.check_cmd_line_flag("skip-reference");
     cmd.get_cmd_line_argument("sm-count", sm_count, defaults.sm_count);
@@ -311,7 +349,17 @@ struct Options {
       << "  --iterations=<int>          Benchmarking iterations\n"
       << "  --verify                    Verify results\n"
       << "  --verbose                   Print smem and execution time per kernel\n"
-      << "  --mask=<no|residual|causal> Enables masking\n"
+      << "  --deterministic             Also runs the bitwise reproducible dQ reduction\n"
+      << "                              with --verify, additionally checks that a rerun\n"
+      << "                              produces the exact same dQ bits\n"
+      << "  --mask=<no|residual|causal|local|block-sparse>\n"
+      << "                              Enables masking\n"
+      << "  --window-left=<int>         Keys before the query a local mask keeps, -1 for all\n"
+      << "  --window-right=<int>        Keys after the query a local mask keeps, -1 for all\n"
+      << "  --chunk=<int>               Confines a local mask to chunks of this size\n"
+      << "  --sparsity=<float>          Fraction of blocks a block sparse mask drops\n"
+      << "  --soft-cap=<float>          Soft-caps the scaled scores with this cap, 0 for none\n"
+      << "  --sinks                     Adds an attention sink per query head\n"
       << "  --varlen                    Enables variable sequence length\n"
       << "                              B*Q and B*K become the total sequence length\n"
       << "                              and are split B-ways, alternatingly +10% and -10%\n"
@@ -392,6 +440,11 @@ struct ExampleResult {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Reduces dQ into one fp32 partial per KV block, summed in a fixed order
+struct KernelDeterministic {};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<
   bool kIsVarlen,
   bool kIsMla,
@@ -402,6 +455,8 @@ template<
 >
 struct BwdRunner {
 
+  static constexpr bool kIsDeterministic = (std::is_same_v<KernelOptions, KernelDeterministic> || ...);
+
 #ifdef FP8
   using Element = cutlass::float_e4m3_t;
 #else
@@ -464,6 +519,16 @@ struct BwdRunner {
   DeviceAllocation<Element> block_ref_dK;
   DeviceAllocation<Element> block_ref_dV;
 
+  // runtime state of the mask, shared by the kernel and the reference
+  ActiveMask mask;
+  std::vector<uint32_t> block_sparse_mask;
+  DeviceAllocation<uint32_t> block_block_sparse_mask;
+  // fraction of the attention matrix the mask keeps, for the flop count
+  double mask_density = 1.0;
+  DeviceAllocation<ElementAccumulator> block_sinks;
+  DeviceAllocation<ElementAccumulator> block_dsinks;
+  DeviceAllocation<ElementAccumulator> block_ref_dsinks;
+
   //
   // Methods
   //
@@ -481,7 +546,7 @@ struct BwdRunner {
     Tensor mDV = make_tensor(make_gmem_ptr(block_ref_dV.get()), make_shape(K, D_VO, HB), stride_dV);
     Tensor mDO = make_tensor(make_gmem_ptr(block_dO.get()), make_shape(Q, D_VO, HB), stride_dO);
 
-    fmha_bwd_reference(problem_shape, mQ, mK, mV, mO, mLSE, mDO, mDQ, mDK, mDV, ActiveMask{});
+    fmha_bwd_reference(problem_shape, mQ, mK, mV, mO, mLSE, mDO, mDQ, mDK, mDV, mask);
 
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
@@ -520,7 +585,27 @@ struct BwdRunner {
                 << " mean " << mean_diff << std::endl;
     }
 
-    return passed_dQ && passed_dK && passed_dV;
+    bool passed_dsink = true;
+    if constexpr (ActiveMask::kHasSink) {
+      fmha_bwd_reference_dsink(problem_shape, mO, mLSE, mDO, block_ref_dsinks.get(), mask);
+      result = cudaDeviceSynchronize();
+      if (result != cudaSuccess) {
+        std::cerr << "Reference kernel failed. Last CUDA error: "
+                  << cudaGetErrorString(result) << std::endl;
+        return false;
+      }
+
+      // a sum over all rows of a head, so the tolerance grows with them
+      reference_abs_diff(block_dsinks, block_ref_dsinks, max_diff, mean_diff);
+      double rows = std::max(1.0, static_cast<double>(size<0>(problem_shape)) * size<1>(HB) / 1024);
+      passed_dsink = (max_diff < kMaxDiffThresh * rows) && (mean_diff < kMaxDiffThresh * rows);
+      if (! passed_dsink) {
+        std::cerr << "failed dsink: max diff " << max_diff
+                  << " mean " << mean_diff << std::endl;
+      }
+    }
+
+    return passed_dQ && passed_dK && passed_dV && passed_dsink;
   }
 
   auto initialize_problem_shape(Options const& options) {
@@ -651,6 +736,58 @@ struct BwdRunner {
     initialize_block(block_ref_dK, seed + 2034);
     initialize_block(block_ref_dV, seed + 2035);
 
+    int max_seqlen_q = get<0>(problem_shape);
+    int max_seqlen_kv = get<1>(problem_shape);
+    if constexpr (ActiveMask::kIsSoftCapping) {
+      mask.soft_cap = options.soft_cap;
+    }
+    if constexpr (ActiveMask::kHasSink) {
+      std::vector<ElementAccumulator> sinks(options.h);
+      std::mt19937 rng(0x202610141200ull);
+      std::normal_distribution<float> dist(0.0f, 1.0f);
+      for (auto& sink : sinks) {
+        sink = dist(rng);
+      }
+      block_sinks.reset(sinks.size());
+      block_sinks.copy_from_host(sinks.data(), sinks.size());
+      block_dsinks.reset(sinks.size());
+      block_ref_dsinks.reset(sinks.size());
+      mask.ptr_sink = block_sinks.get();
+    }
+    if constexpr (is_local_mask_v<ActiveMask>) {
+      mask.window_left = options.window_left;
+      mask.window_right = options.window_right;
+      mask.chunk_size = options.chunk_size;
+      int64_t visible = 0;
+      for (int q = 0; q < max_seqlen_q; q++) {
+        int q_offset = q + mask.get_offset_q(cute::make_tuple(max_seqlen_q, max_seqlen_kv));
+        visible += std::max(mask.get_last_key(q_offset, max_seqlen_kv) - mask.get_first_key(q_offset) + 1, 0);
+      }
+      mask_density = static_cast<double>(visible) / max_seqlen_q / max_seqlen_kv;
+    }
+    if constexpr (is_block_sparse_mask_v<ActiveMask>) {
+      // every q block keeps the kv block on its diagonal, so no row is fully masked
+      int blocks_q = cute::ceil_div(max_seqlen_q, mask.block_q);
+      int blocks_k = cute::ceil_div(max_seqlen_kv, mask.block_k);
+      mask.stride = cute::ceil_div(blocks_k, 32);
+      block_sparse_mask.assign(blocks_q * mask.stride, 0u);
+      std::mt19937 rng(0x202510141500ull);
+      std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+      int enabled = 0;
+      for (int r = 0; r < blocks_q; r++) {
+        for (int c = 0; c < blocks_k; c++) {
+          if (c == std::min(r * blocks_k / blocks_q, blocks_k - 1) || dist(rng) >= options.sparsity) {
+            block_sparse_mask[r * mask.stride + c / 32] |= 1u << (c % 32);
+            enabled += 1;
+          }
+        }
+      }
+      block_block_sparse_mask.reset(block_sparse_mask.size());
+      block_block_sparse_mask.copy_from_host(block_sparse_mask.data(), block_sparse_mask.size());
+      mask.ptr_block_mask = block_block_sparse_mask.get();
+      mask_density = static_cast<double>(enabled) / blocks_q / blocks_k;
+    }
+
     Tensor mQ = make_tensor(make_gmem_ptr(block_Q.get()),
       select<0,2,4>(problem_shape),
       stride_Q);
@@ -672,7 +809,7 @@ struct BwdRunner {
       stride_LSE);
 
     if (not options.skip_reference) {
-      fmha_reference(problem_shape, mQ, mK, mV, mO, mLSE, ActiveMask{});
+      fmha_reference(problem_shape, mQ, mK, mV, mO, mLSE, mask);
     }
 
     return problem_shape;
@@ -685,7 +822,7 @@ struct BwdRunner {
 
     ExampleResult example_result;
 
-    using Operation = cutlass::fmha::device::Sm100FmhaBwd<ProblemShape, Element, ElementAccumulator, TileShape, kIsMla, ActiveMask>;
+    using Operation = cutlass::fmha::device::Sm100FmhaBwd<ProblemShape, Element, ElementAccumulator, TileShape, kIsMla, ActiveMask, kIsDeterministic>;
 
     typename Operation::Arguments arguments{
       problem_shape,
@@ -699,7 +836,9 @@ struct BwdRunner {
       block_dK.get(), stride_dK,
       block_dV.get(), stride_dV,
       softmax_scale,
-      hw_info
+      hw_info,
+      mask,
+      block_dsinks.get()
     };
 
     Operation op;
@@ -798,7 +937,8 @@ struct BwdRunner {
 
     runtime_ms /= static_cast<float>(options.iterations);
 
-    double flops = 2.0 * (std::is_same_v<ActiveMask, CausalForBackwardMask<false>> || std::is_same_v<ActiveMask, CausalForBackwardMask<true>> ? 0.5 : 1.0);
+    double flops = 2.0 * (std::is_base_of_v<CausalForBackwardMask<false>, ActiveMask> || std::is_base_of_v<CausalForBackwardMask<true>, ActiveMask> ? 0.5 : 1.0);
+    flops *= mask_density;
     flops *= static_cast<double>(get<0>(problem_shape));
     flops *= static_cast<double>(get<1>(problem_shape));
     flops *= (3 * static_cast<double>(get<2>(problem_shape)) + 2 * static_cast<double>(get<3>(problem_shape)));
@@ -822,6 +962,24 @@ struct BwdRunner {
       passed = verify(problem_shape);
       if (passed) example_result.verified = true;
     }
+
+    // The deterministic reduction must reproduce dQ bit for bit across runs
+    if (kIsDeterministic && options.verify && passed) {
+      std::vector<Element> dQ_first(block_dQ.size());
+      std::vector<Element> dQ_second(block_dQ.size());
+      cudaMemcpy(dQ_first.data(), block_dQ.get(), block_dQ.size() * sizeof(Element), cudaMemcpyDeviceToHost);
+      status = op.run();
+      if (status != cutlass::Status::kSuccess) {
+        std::cerr << "Failed to launch the CUTLASS kernel. Last CUDA error is: "
+                  << cudaGetErrorString(cudaGetLastError()) << std::endl;
+        return example_result;
+      }
+      cudaMemcpy(dQ_second.data(), block_dQ.get(), block_dQ.size() * sizeof(Element), cudaMemcpyDeviceToHost);
+      passed = std::memcmp(dQ_first.data(), dQ_second.data(), dQ_first.size() * sizeof(Element)) == 0;
+      if (! passed) {
+        std::cerr << "Deterministic dQ differs between runs" << std::endl;
+      }
+    }
     
     if (!passed) {
       std::cerr << "Reference check failed" << std::endl;
@@ -889,6 +1047,9 @@ void run_bwd_64(Mask fusion, Options const & options, cutlass::KernelHardwareInf
   using HeadDim = _64;
 
   run(Shape<_128, _128, HeadDim, HeadDim>{}, KernelCoop{}, "tma");
+  if (options.deterministic) {
+    run(Shape<_128, _128, HeadDim, HeadDim>{}, KernelCoop{}, "tma deterministic", KernelDeterministic{});
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -906,6 +1067,9 @@ void run_bwd_128(Mask fusion, Options const & options, cutlass::KernelHardwareIn
   using HeadDim = _128;
 
   run(Shape<_128, _128, HeadDim, HeadDim>{}, KernelCoop{}, "tma");
+  if (options.deterministic) {
+    run(Shape<_128, _128, HeadDim, HeadDim>{}, KernelCoop{}, "tma deterministic", KernelDeterministic{});
+  }
 }
 
 template<class Mask>
@@ -921,6 +1085,9 @@ void run_bwd_mla_192(Mask fusion, Options const & options, cutlass::KernelHardwa
   using HeadDim = _192;
 
   run(Shape<_64, _128, HeadDim, _128>{}, KernelCoop{}, "tma");
+  if (options.deterministic) {
+    run(Shape<_64, _128, HeadDim, _128>{}, KernelCoop{}, "tma deterministic", KernelDeterministic{});
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -991,15 +1158,52 @@ int main_single(int argc, char const **args) {
 
   std::cout << "###### B " << options.b << " H " << options.h << " H_K " << options.h_k << " Q " << options.q << " K " << options.k << " D " << options.d << " D_VO " << options.d_vo << " ";
   std::cout << "Backward" << " " << (options.causal ? "Causal" : "Full") << " ";
+  if (options.local) {
+    std::cout << "Local " << options.window_left << ":" << options.window_right << " Chunk " << options.chunk_size << " ";
+  }
+  if (options.block_sparse) {
+    std::cout << "Block-Sparse " << options.sparsity << " ";
+  }
+  if (options.soft_cap > 0) {
+    std::cout << "Soft-Cap " << options.soft_cap << " ";
+  }
+  if (options.sinks) {
+    std::cout << "Sinks ";
+  }
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
-  auto with_causal = [&](auto fn) {
+  auto with_score_mod = [&](auto fn) {
+    return [&, fn](auto mask) {
+      using Mask = decltype(mask);
+      if (options.soft_cap > 0 && options.sinks) {
+        fn(AttentionSink<SoftCapping<Mask>>{});
+      }
+      else if (options.soft_cap > 0) {
+        fn(SoftCapping<Mask>{});
+      }
+      else if (options.sinks) {
+        fn(AttentionSink<Mask>{});
+      }
+      else {
+        fn(mask);
+      }
+    };
+  };
+
+  auto with_causal = [&](auto fn_) {
+    auto fn = with_score_mod(fn_);
     if (options.causal) {
       fn(CausalForBackwardMask{});
     }
     else if (options.residual) {
       fn(ResidualMaskForBackward{});
     }
+    else if (options.local) {
+      fn(LocalMaskForBackward{});
+    }
+    else if (options.block_sparse) {
+      fn(BlockSparseMaskForBackward{});
+    }
     else {
       fn(NoMask{});
     }
@@ -1013,7 +1217,12 @@ int main_single(int argc, char const **args) {
       run_bwd_128(fusion, options, hw_info);
     }
     else if (options.d == 192 && options.d_vo == 128) {
-      run_bwd_mla_192(fusion, options, hw_info);
+      if constexpr (! decltype(fusion)::kIsSoftCapping) {
+        run_bwd_mla_192(fusion, options, hw_info);
+      }
+      else {
+        std::cout << "Soft-capping is not supported for the MLA backward." << std::endl;
+      }
     }
     else {
       std::cout << "No kernel instantiated for d=" << options.d << std::endl;
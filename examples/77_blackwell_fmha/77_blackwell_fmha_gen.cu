@@ -42,6 +42,15 @@
     * GQA is (grouped_heads,heads_kv):(head_stride,grouped_heads*head_stride) in Q
       and (grouped_heads,heads_kv):(0,head_stride) in K and V
 
+    Multiple query tokens
+    ---------------------
+
+    For speculative decoding, the first mode of the problem shape is the number of query
+    tokens per sequence (--q), each with its own new K/V entry. The tokens of a kv head are
+    packed together with its grouped heads into the rows of a tile (heads fastest), so
+    h/h_k * q must not exceed 32. MultiTokenMask masks the tokens among each other, either
+    causally or through a draft tree shared by all batches (--tree).
+
     Example usage:
       $ ./examples/77_blackell_fmha/77_blackell_fmha_gen_fp8 \
             --b=2048 --h=2048 --d=2048 --k=2048
@@ -51,6 +60,7 @@
 #define DSHOWT(x) print(#x ": "); print_tensor(x); print("\n");
 
 #include <iostream>
+#include <numeric>
 #include <random>
 #include <regex>
 
@@ -101,6 +111,9 @@ struct Options {
   bool remap = false;
   bool varlen = false;
   bool cache_only = false;
+  int page = 0;
+  int q = 1;
+  bool tree = false;
 
   int sm_count = 0;
 
@@ -175,6 +188,13 @@ struct Options {
     varlen = cmd.check_cmd_line_flag("varlen");
     remap = cmd.check_cmd_line_flag("remap");
     cache_only = cmd.check_cmd_line_flag("cache-only");
+    cmd.get_cmd_line_argument("page", page, defaults.page);
+    cmd.get_cmd_line_argument("q", q, defaults.q);
+    tree = cmd.check_cmd_line_flag("tree");
+    if (q < 1 || q > 32) {
+      std::cout << "Error: --q must be between 1 and 32.\n";
+      error = true;
+    }
     cmd.get_cmd_line_argument("sm-count", sm_count, defaults.sm_count);
 
     get_init_style_argument(cmd, "init-style", init_style_q, defaults.init_style_q);
@@ -212,6 +232,9 @@ struct Options {
       << "  --remap                     Enables batch index remapping\n"
       << "  --cache-only                Only use data from KV cache, no reading or inserting new entry\n"
       << "  --varlen                    Varies sequence length between cache entries\n"
+      << "  --page=<int>                Stores the KV cache in shuffled pages of this size\n"
+      << "  --q=<int>                   Query tokens per sequence, e.g. speculative decoding drafts\n"
+      << "  --tree                      Masks the query tokens with a random draft tree instead of causally\n"
       << "  --sm-count                  Sets SM count rather than querying it\n"
       << "  --clear-cache               Clears the cache before benchmarking runs\n"
       << " --kernel-filter=<filter>     Sets regexp to match kernel against\n"
@@ -330,10 +353,10 @@ struct ExampleRunner {
   using ElementAcc = float;
   using ElementOut = cutlass::half_t;
 
-  using ProblemShape = Shape<_1, int, int, Shape<Shape<int, int>, int>>;
+  using ProblemShape = Shape<int, int, int, Shape<Shape<int, int>, int>>;
 
-  using StrideQ = Stride<_0, _1, Stride<Stride<int, int>, int>>;
-  using StrideNewK = Stride<_0, _1, Stride<Stride<_0, int>, int>>;
+  using StrideQ = Stride<int, _1, Stride<Stride<int, int>, int>>;
+  using StrideNewK = Stride<int, _1, Stride<Stride<_0, int>, int>>;
   using StrideCacheK = Stride<int, _1, Stride<Stride<_0, int>, int>>;
   using StrideNewV = StrideNewK;
   using StrideCacheV = StrideCacheK;
@@ -346,7 +369,8 @@ struct ExampleRunner {
         Element, ElementAcc, ElementAcc, ElementOut,
         TileShape,
         StrideQ, StrideNewK, StrideNewV,
-        StrideCacheK, StrideCacheV, StrideO
+        StrideCacheK, StrideCacheV, StrideO,
+        cutlass::fmha::collective::MultiTokenMask
       >,
       cutlass::fmha::collective::Sm100FmhaGenEpilogueWarpspecialized<ElementOut, StrideO>,
       std::conditional_t<kKernelType == KernelType::UMMA_P,
@@ -367,6 +391,10 @@ struct ExampleRunner {
 
   std::vector<int> seqlen_kv;
 
+  // draft tree among the query tokens, empty for causal
+  std::vector<uint32_t> tree_mask;
+  DeviceAllocation<uint32_t> block_tree_mask;
+
   DeviceAllocation<int> block_seqlen_kv;
   DeviceAllocation<int> block_cache_batch_idx;
   DeviceAllocation<Element> block_q;
@@ -380,10 +408,45 @@ struct ExampleRunner {
   DeviceAllocation<Element> block_ref_cache_v;
   DeviceAllocation<ElementOut> block_ref_o;
 
+  // paged kv cache, populated from block_cache_k/v if --page is given
+  int page_size = 0;
+  int pages_per_batch = 0;
+  std::vector<int> page_table;
+  DeviceAllocation<int> block_page_table;
+  DeviceAllocation<Element> block_paged_cache_k;
+  DeviceAllocation<Element> block_paged_cache_v;
+  StrideCacheK stride_paged_cache_k;
+  StrideCacheV stride_paged_cache_v;
+
   ClearCache clear_cache;
 
+  // moves the kv cache between the contiguous and the paged layout
+  void copy_pages(bool to_pages, int seqlen_alloc) {
+    int64_t row_size = get<0>(stride_cache_k);
+    for (int b = 0; b < static_cast<int>(page_table.size()) / pages_per_batch; b++) {
+      for (int i = 0; i < pages_per_batch; i++) {
+        int rows = std::min(page_size, seqlen_alloc - i * page_size);
+        int64_t offset = b * int64_t(get<2,1>(stride_cache_k)) + i * page_size * row_size;
+        int64_t offset_paged = page_table[b * pages_per_batch + i] * int64_t(get<2,1>(stride_paged_cache_k));
+        size_t bytes = rows * row_size * sizeof(Element);
+        if (to_pages) {
+          cudaMemcpy(block_paged_cache_k.get() + offset_paged, block_cache_k.get() + offset, bytes, cudaMemcpyDeviceToDevice);
+          cudaMemcpy(block_paged_cache_v.get() + offset_paged, block_cache_v.get() + offset, bytes, cudaMemcpyDeviceToDevice);
+        }
+        else {
+          cudaMemcpy(block_cache_k.get() + offset, block_paged_cache_k.get() + offset_paged, bytes, cudaMemcpyDeviceToDevice);
+          cudaMemcpy(block_cache_v.get() + offset, block_paged_cache_v.get() + offset_paged, bytes, cudaMemcpyDeviceToDevice);
+        }
+      }
+    }
+  }
+
   bool verify(const ProblemShape& problem_shape) {
 
+    if (page_size > 0) {
+      copy_pages(/* to_pages = */ false, get<1>(problem_shape));
+    }
+
     Tensor mQ = make_tensor(make_gmem_ptr(block_q.get()), select<0,2,3>(problem_shape), stride_q);
     Tensor mNewK = make_tensor(make_gmem_ptr(block_new_k.get()), select<0,2,3>(problem_shape), stride_new_k);
     Tensor mNewV = make_tensor(make_gmem_ptr(block_new_v.get()), select<0,2,3>(problem_shape), stride_new_v);
@@ -393,7 +456,8 @@ struct ExampleRunner {
 
     fmha_fwd_gen_reference<ElementAcc>(
         problem_shape, block_seqlen_kv.get(), block_cache_batch_idx.get(),
-        mQ, mNewK, mNewV, mCacheK, mCacheV, mO);
+        mQ, mNewK, mNewV, mCacheK, mCacheV, mO,
+        tree_mask.empty() ? nullptr : block_tree_mask.get());
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
       std::cerr << "Reference kernel failed. Last CUDA error: "
@@ -469,10 +533,11 @@ struct ExampleRunner {
       max_seqlen_kv = std::max(e, max_seqlen_kv);
     }
 
-    ProblemShape result = make_shape(_1{}, max_seqlen_kv + 1, options.d, make_shape(make_shape(options.h / options.h_k, options.h_k), options.b));
+    ProblemShape result = make_shape(options.q, max_seqlen_kv + options.q, options.d, make_shape(make_shape(options.h / options.h_k, options.h_k), options.b));
 
-    stride_q = make_stride(_0{}, _1{}, make_stride(make_stride(options.d, options.d * size<3,0,0>(result)), options.d * size<3,0>(result)));
-    stride_new_k = make_stride(_0{}, _1{}, make_stride(make_stride(_0{}, options.d), options.d * size<3,0,1>(result)));
+    // q, new k/v and o are [b, q, h, d]
+    stride_q = make_stride(options.d * size<3,0>(result), _1{}, make_stride(make_stride(options.d, options.d * size<3,0,0>(result)), options.d * size<3,0>(result) * options.q));
+    stride_new_k = make_stride(options.d * size<3,0,1>(result), _1{}, make_stride(make_stride(_0{}, options.d), options.d * size<3,0,1>(result) * options.q));
     stride_cache_k = make_stride(options.d * size<3,0,1>(result), _1{}, make_stride(make_stride(_0{}, options.d), options.d * size<3,0,1>(result) * get<1>(result)));
 
     stride_new_v = stride_new_k;
@@ -511,24 +576,72 @@ struct ExampleRunner {
       block_cache_batch_idx.copy_from_host(cache_batch_idx.data(), cache_batch_idx.size());
     }
 
+    if (options.tree) {
+      // every draft token extends a random earlier one, and sees its ancestors and itself
+      std::mt19937 rng(0x202610141500ull);
+      tree_mask.resize(options.q);
+      for (int i = 0; i < options.q; i++) {
+        int parent = i == 0 ? -1 : static_cast<int>(rng() % i);
+        tree_mask[i] = (parent < 0 ? 0u : tree_mask[parent]) | (1u << i);
+      }
+      block_tree_mask.reset(tree_mask.size());
+      block_tree_mask.copy_from_host(tree_mask.data(), tree_mask.size());
+    }
+
+    if (options.page > 0) {
+      page_size = options.page;
+      pages_per_batch = cute::ceil_div(get<1>(result), page_size);
+      int page_count = options.b * pages_per_batch;
+
+      // scatter the pages of all batches across the paged cache
+      page_table.resize(page_count);
+      std::iota(page_table.begin(), page_table.end(), 0);
+      std::mt19937 rng(0x202510141200ull);
+      std::shuffle(page_table.begin(), page_table.end(), rng);
+
+      stride_paged_cache_k = stride_cache_k;
+      get<2,1>(stride_paged_cache_k) = get<0>(stride_cache_k) * page_size;
+      stride_paged_cache_v = stride_paged_cache_k;
+
+      block_paged_cache_k.reset(page_count * get<2,1>(stride_paged_cache_k));
+      block_paged_cache_v.reset(page_count * get<2,1>(stride_paged_cache_v));
+      block_page_table.reset(page_table.size());
+      block_page_table.copy_from_host(page_table.data(), page_table.size());
+
+      copy_pages(/* to_pages = */ true, get<1>(result));
+    }
+
     return result;
   }
 
   ExampleResult run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
     auto problem_shape = initialize(options);
 
+    bool is_paged = page_size > 0;
+
     typename Operation::Arguments arguments{
       problem_shape,
       block_seqlen_kv.get(), block_cache_batch_idx.get(),
       block_q.get(), stride_q,
       block_new_k.get(), stride_new_k,
       block_new_v.get(), stride_new_v,
-      block_cache_k.get(), stride_cache_k,
-      block_cache_v.get(), stride_cache_v,
+      is_paged ? block_paged_cache_k.get() : block_cache_k.get(),
+      is_paged ? stride_paged_cache_k : stride_cache_k,
+      is_paged ? block_paged_cache_v.get() : block_cache_v.get(),
+      is_paged ? stride_paged_cache_v : stride_cache_v,
       block_o.get(), stride_o,
       hw_info
     };
 
+    arguments.mask = cutlass::fmha::collective::MultiTokenMask{
+        options.q, tree_mask.empty() ? nullptr : block_tree_mask.get()};
+
+    if (is_paged) {
+      arguments.ptr_page_table = block_page_table.get();
+      arguments.stride_page_table = pages_per_batch;
+      arguments.page_size = page_size;
+    }
+
     Operation op;
 
     ExampleResult example_result;
@@ -644,12 +757,12 @@ struct ExampleRunner {
 
     double bytes;
     bytes = 0.0;
-    bytes += double(sizeof(Element) * size<3>(problem_shape));  // Q
-    bytes += double(sizeof(ElementOut) * size<3>(problem_shape));  // O
-    bytes += 2.0 * double(sizeof(Element) * size<3>(problem_shape) / size<3,0,0>(problem_shape));  // NewK, NewV
+    bytes += double(sizeof(Element) * size<3>(problem_shape) * options.q);  // Q
+    bytes += double(sizeof(ElementOut) * size<3>(problem_shape) * options.q);  // O
+    bytes += 2.0 * double(sizeof(Element) * size<3>(problem_shape) / size<3,0,0>(problem_shape) * options.q);  // NewK, NewV
     double total_seqlen_kv = 0;
     for (auto e : seqlen_kv) {
-      total_seqlen_kv += double(e + 1);
+      total_seqlen_kv += double(e + options.q);
     }
     bytes += 2.0 * double(sizeof(Element) * size<3,0,1>(problem_shape) * total_seqlen_kv);  // CacheK, CacheV
     bytes *= static_cast<double>(size<2>(problem_shape));
@@ -776,6 +889,12 @@ int main_single(int argc, char const **args) {
 
   std::cout << "###### B " << options.b << " H " << options.h << " H_K " << options.h_k << " K " << options.k << " D " << options.d << " ";
   std::cout << "Gen" << " " << (options.varlen ? "Variable" : "Uniform") << " " << (options.remap ? "Remap" : "Linear") << " ";
+  if (options.page > 0) {
+    std::cout << "Paged " << options.page << " ";
+  }
+  if (options.q > 1) {
+    std::cout << "Q " << options.q << (options.tree ? " Tree" : " Causal") << " ";
+  }
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
   using UMMA = true_type;
@@ -72,6 +72,7 @@ struct Options {
 
   int b = 1;
   int k = 256;
+  int q = 1; // query tokens per sequence, > 1 runs a causal prefill chunk
   int split_kv = -1; // number of split along k dim.
   bool is_var_split_kv = false;
   int max_split_kv = 16;
@@ -143,6 +144,8 @@ struct Options {
     if (b == -1) b = 16384 / k;
     if (b == 0) b = 1;
 
+    cmd.get_cmd_line_argument("q", q, defaults.q);
+
     cmd.get_cmd_line_argument("split_kv", split_kv, defaults.split_kv);
     if (split_kv == 0) {
       split_kv = 1;
@@ -184,11 +187,12 @@ struct Options {
       << "  --help                      If specified, displays this usage statement\n\n"
       << "  --b=<int>                   Sets the B extent\n"
       << "  --k=<int>                   Sets the K extent\n"
+      << "  --q=<int>                   Sets the query tokens per sequence (causal prefill chunk)\n"
       << "  --page=<int>                Enables paging and sets the page size\n"
       << "  --iterations=<int>          Benchmarking iterations\n"
       << "  --spread=<float>            Relative spread away from K for paging\n"
-      << "  --split_kv=<int>            Split KV factor\n"
-      << "  --fused_reduction           Fuse the reduction operation\n"
+      << "  --split_kv=<int>            Split KV factor, picked automatically if not set\n"
+      << "  --fuse_reduction            Fuse the reduction operation\n"
       << "  --var_split_kv              Use varying split KV factor\n"
       << "  --verify                    Verify results\n"
       << "  --verbose                   Print smem and execution time per kernel\n"
@@ -260,6 +264,8 @@ struct ExampleResult {
   double tflops_tc_s = 0;
   double tbytes_s = 0;
   size_t smem_size = 0;
+  int split_kv = 0;
+  bool is_fused_reduction = false;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,6 +337,7 @@ struct Runner {
 
   int page_size = -1;
   int page_count = -1;
+  int q_tokens = 1;
 
   // We allocate Q and C as first latent, then rope
   // This means that we offset the pointer by HeadDim_latent to get the rope
@@ -357,7 +364,7 @@ struct Runner {
     auto [D_latent, D_rope] = D;
 
     int page_K = K;
-    int page_B = B;
+    int page_B = B / q_tokens;
     if (block_PT.get() != nullptr) {
       page_K = page_size;
       page_B = page_count;
@@ -387,10 +394,10 @@ struct Runner {
       cute::make_tuple(H, B),
       stride_LSE);
 
-    Tensor mSeq = make_tensor(make_gmem_ptr(static_cast<int*>(block_seq.get())), make_shape(B));
-    Tensor mPT = make_tensor(make_gmem_ptr(static_cast<int*>(block_PT.get())), make_shape(ceil_div(K, page_size), B), stride_PT);
+    Tensor mSeq = make_tensor(make_gmem_ptr(static_cast<int*>(block_seq.get())), make_shape(B / q_tokens));
+    Tensor mPT = make_tensor(make_gmem_ptr(static_cast<int*>(block_PT.get())), make_shape(ceil_div(K, page_size), B / q_tokens), stride_PT);
 
-    fmha_mla_reference(problem_shape, mSeq, mPT, mQ_latent, mQ_rope, mC_latent, mK_rope, mO, mLSE, scale);
+    fmha_mla_reference(problem_shape, mSeq, mPT, mQ_latent, mQ_rope, mC_latent, mK_rope, mO, mLSE, scale, q_tokens);
 
     cudaError_t result = cudaDeviceSynchronize();
     if (result != cudaSuccess) {
@@ -426,7 +433,9 @@ struct Runner {
   }
 
   ProblemShape initialize(const Options& options) {
-    auto problem_shape = cute::make_tuple(TileShapeH{}, options.k, TileShapeD{}, options.b);
+    // the batch mode holds options.q query rows per cached sequence
+    q_tokens = options.q;
+    auto problem_shape = cute::make_tuple(TileShapeH{}, options.k, TileShapeD{}, options.b * options.q);
 
     auto [H, K, D, B] = problem_shape;
     auto [D_latent, D_rope] = D;
@@ -441,11 +450,11 @@ struct Runner {
     stride_O = cute::make_tuple(static_cast<int64_t>(0 + D_latent), _1{}, static_cast<int64_t>(0 + H * D_latent));
     stride_LSE = cute::make_tuple(_1{}, 0 + H);
 
-    block_Q.reset(static_cast<size_t>(options.b) * H * (D_latent + D_rope));
-    block_O.reset(static_cast<size_t>(options.b) * H * D_latent);
-    block_LSE.reset(static_cast<size_t>(options.b) * H);
-    block_ref_O.reset(static_cast<size_t>(options.b) * H * D_latent);
-    block_ref_LSE.reset(static_cast<size_t>(options.b) * H);
+    block_Q.reset(static_cast<size_t>(B) * H * (D_latent + D_rope));
+    block_O.reset(static_cast<size_t>(B) * H * D_latent);
+    block_LSE.reset(static_cast<size_t>(B) * H);
+    block_ref_O.reset(static_cast<size_t>(B) * H * D_latent);
+    block_ref_LSE.reset(static_cast<size_t>(B) * H);
 
     if (options.page == -1) {
 
@@ -458,20 +467,21 @@ struct Runner {
     else {
       
       float spread = options.spread;
-      int max_K = static_cast<int>((1 + spread) * K);
+      int max_K = std::max(options.q, static_cast<int>((1 + spread) * K));
       int min_K = static_cast<int>((1 - spread) * K);
       page_size = options.page;
-      page_count = B * ceil_div(max_K, page_size);
+      int S = options.b;
+      page_count = S * ceil_div(max_K, page_size);
       stride_PT = cute::make_stride(_1{}, page_count);
 
-      std::vector<int> host_seq(B);
-      std::vector<int> host_PT(page_count * B);
+      std::vector<int> host_seq(S);
+      std::vector<int> host_PT(page_count * S);
 
-      for (int i = 0; i < B; i++) {
-        int seq = min_K + rand() % (max_K - min_K + 1);
+      for (int i = 0; i < S; i++) {
+        int seq = std::max(options.q, min_K + rand() % (max_K - min_K + 1));
         host_seq[i] = seq;
         for (int j = 0; j < ceil_div(seq, page_size); j++) {
-          host_PT[page_count * i + j] = i + j * B;
+          host_PT[page_count * i + j] = i + j * S;
         }
       }
 
@@ -490,7 +500,7 @@ struct Runner {
       if (options.is_var_split_kv == true) {
         std::vector<int> host_split_kv(B);
         for(int i = 0; i < B; ++i) {
-          auto len = host_seq[i];
+          auto len = host_seq[i / options.q] - (options.q - 1 - i % options.q);
 	  int split = ceil_div(options.max_split_kv, ceil_div(max_K, len));
 	  host_split_kv[i] = split;
         }
@@ -521,7 +531,7 @@ struct Runner {
         block_C.get() + D_latent, stride_K_rope,
         block_seq.get(),
         block_PT.get(), stride_PT,
-        page_count, page_size},
+        page_count, page_size, q_tokens},
       { block_O.get(), 
         stride_O,
         block_LSE.get(),
@@ -540,6 +550,8 @@ struct Runner {
     ExampleResult example_result;
 
     example_result.smem_size = Operation::Kernel::SharedStorageSize;
+    example_result.split_kv = arguments.split_kv;
+    example_result.is_fused_reduction = arguments.is_fused_reduction;
 
     size_t workspace_size = 0;
     workspace_size = Operation::get_workspace_size(arguments);
@@ -704,7 +716,8 @@ void print_result(const std::string& description, ExampleResult result, bool ver
   std::cout << " : " << result.tflops_tc_s << " TFLOPS/s " << result.tbytes_s << " TB/s" << std::endl;
   if (verbose) {
     std::cout << "       t=" << result.runtime_ms * 1e3 << " us, "
-        "smem=" << result.smem_size << "b" << std::endl;
+        "smem=" << result.smem_size << "b, "
+        "split_kv=" << result.split_kv << (result.is_fused_reduction ? " fused" : "") << std::endl;
   }
 }
 
@@ -726,7 +739,7 @@ void run_mla(Options const & options, cutlass::KernelHardwareInfo const& hw_info
 
   std::cout << "###### B " << options.b << " MLA H " << 0 + NumHeads{} << " ";
   std::cout << "D_rope " << 0 + get<1>(HeadDim{}) << " D_latent " << 0 + get<0>(HeadDim{}) << " ";
-  std::cout << "Q 1 K " << options.k << " Gen None ";
+  std::cout << "Q " << options.q << " K " << options.k << " Gen None ";
   std::cout << "Split " << options.split_kv << " Gen None ";
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
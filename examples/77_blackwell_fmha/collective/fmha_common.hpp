@@ -122,4 +122,20 @@ void warpgroup_reg_set() {
   }
 }
 
+// Per KV head dequantization scale of the tile at blk_coord, 1 if there is none.
+// The head mode of the problem shape is ((H_R, H_K), B), so the KV head is the
+// flat head coordinate divided by H_R.
+template<class BlkCoord, class ProblemShape>
+CUTLASS_DEVICE
+float kv_head_scale(float const* ptr_scale, BlkCoord const& blk_coord, ProblemShape const& problem_shape) {
+  if (ptr_scale == nullptr) {
+    return 1.0f;
+  }
+  int head_kv = get<2,0>(blk_coord);
+  if constexpr (is_tuple<tuple_element_t<0, tuple_element_t<3, ProblemShape>>>::value) {
+    head_kv /= int(get<3,0,0>(problem_shape));
+  }
+  return ptr_scale[head_kv];
+}
+
 }  // namespace cutlass::fmha::collective
@@ -32,6 +32,7 @@
 
 
 #include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
 #include "cute/tensor.hpp"
 
 namespace cutlass::fmha::collective {
@@ -39,12 +40,50 @@ namespace cutlass::fmha::collective {
 using namespace cute;
 
 struct NoMask {
+  // set by the SoftCapping and AttentionSink wrappers below
+  static constexpr bool kIsSoftCapping = false;
+  static constexpr bool kHasSink = false;
+
+  // first kv tile a q tile visits, tiles before it are skipped entirely
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_start(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return 0;
+  }
+
+  // kv tile visited after k_tile
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_next_trip(
+      BlkCoord const& blk_coord,
+      int k_tile,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return k_tile + 1;
+  }
+
+  // masked kv tiles visited before the unmasked ones
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_leading_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return 0;
+  }
+
   template<class BlkCoord, class TileShape, class ProblemSize>
   CUTLASS_DEVICE
   int get_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     return ceil_div(get<1>(problem_size), get<1>(tile_shape));
   }
@@ -54,7 +93,7 @@ struct NoMask {
   int get_masked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     return 0;
   }
@@ -64,7 +103,7 @@ struct NoMask {
   int get_unmasked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     return get_trip_count(blk_coord, tile_shape, problem_size);
   }
@@ -74,7 +113,7 @@ struct NoMask {
   void apply_mask(
       AccQK& acc_qk,
       IndexQK const& index_qk,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     return;
   }
@@ -88,7 +127,7 @@ struct ResidualMask : NoMask {
   CUTLASS_DEVICE int get_masked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     if (get<1>(problem_size) % get<1>(tile_shape) != 0) {
       return 1;
@@ -101,7 +140,7 @@ struct ResidualMask : NoMask {
   int get_unmasked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     // if the sequence length does not divide the tile size evenly
     if (get<1>(problem_size) % get<1>(tile_shape) != 0) {
@@ -115,7 +154,7 @@ struct ResidualMask : NoMask {
   void apply_mask(
       AccQK& acc_qk,
       IndexQK const& index_qk,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     // This is useful is seqlen_k % kBlockN != 0 since it masks
     // the remaining elements out from softmax.
@@ -140,7 +179,7 @@ struct ResidualMaskForBackward : NoMask {
   CUTLASS_DEVICE int get_masked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     if (get<1>(problem_size) % get<1>(tile_shape) != 0) {
       return 1;
@@ -153,7 +192,7 @@ struct ResidualMaskForBackward : NoMask {
   int get_unmasked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     // if the sequence length does not divide the tile size evenly
     if (get<1>(problem_size) % get<1>(tile_shape) != 0) {
@@ -167,7 +206,7 @@ struct ResidualMaskForBackward : NoMask {
   void apply_mask(
       AccQK& acc_qk,
       IndexQK const& index_qk,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     // This is useful is seqlen_k % kBlockN != 0 since it masks
     // the remaining elements out from softmax.
@@ -199,7 +238,7 @@ struct CausalMask : NoMask {
   int get_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     // See note below on different ways to think about causal attention
     // Again, we'd add the offset_q into the max_blocks_q calculation
@@ -219,7 +258,7 @@ struct CausalMask : NoMask {
   int get_masked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
         
     int trip_count = get_trip_count(blk_coord, tile_shape, problem_size);
     if constexpr (IsQBegin) {
@@ -235,7 +274,7 @@ struct CausalMask : NoMask {
   int get_unmasked_trip_count(
       BlkCoord const& blk_coord,
       TileShape const& tile_shape,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     return get_trip_count(blk_coord, tile_shape, problem_size) - get_masked_trip_count(blk_coord, tile_shape, problem_size);
   }
@@ -245,7 +284,7 @@ struct CausalMask : NoMask {
   void apply_mask(
       AccQK& acc_qk,
       IndexQK const& index_qk,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     // There are two ways to do causal if N_Q != N_K
     // (1) is to assume that the Q is at the beginning of the matrix
@@ -286,7 +325,7 @@ struct CausalForBackwardMask : CausalMask<kIsQBegin>, ResidualMaskForBackward {
   void apply_mask(
       AccQK& acc_qk,
       IndexQK const& index_qk,
-      ProblemSize const& problem_size) {
+      ProblemSize const& problem_size) const {
 
     // There are two ways to do causal if N_Q != N_K
     // (1) is to assume that the Q is at the beginning of the matrix
@@ -313,6 +352,563 @@ struct CausalForBackwardMask : CausalMask<kIsQBegin>, ResidualMaskForBackward {
 
 };
 
+// Local attention: query q attends to key k iff
+//   q - window_left <= k <= q + window_right
+// and, if chunk_size is non-zero, both fall into the same chunk of chunk_size positions.
+// A negative window size leaves that side unbounded. This covers
+//  - sliding window attention: LocalMask{window, 0}
+//  - chunked local attention:  LocalMask{-1, 0, chunk}
+// The usual causal alignment of Q against K applies, and kv tiles outside of the band
+// are never loaded or computed. Tiles on either edge of the band are masked.
+template<bool kIsQBegin = true>
+struct LocalMask : NoMask {
+
+  using Base = NoMask;
+
+  static constexpr bool IsQBegin = kIsQBegin;
+
+  int window_left = -1;
+  int window_right = 0;
+  int chunk_size = 0;
+
+  CUTE_HOST_DEVICE
+  LocalMask(int window_left_ = -1, int window_right_ = 0, int chunk_size_ = 0)
+      : window_left(window_left_), window_right(window_right_), chunk_size(chunk_size_) {}
+
+  template<class ProblemSize>
+  CUTE_HOST_DEVICE
+  int get_offset_q(ProblemSize const& problem_size) const {
+    if constexpr (IsQBegin) {
+      return 0;
+    }
+    else {
+      return get<1>(problem_size) - get<0>(problem_size);
+    }
+  }
+
+  // first and last key visible to query position q (already offset), both monotonic in q
+  CUTE_HOST_DEVICE
+  int get_first_key(int q) const {
+    int k = 0;
+    if (window_left >= 0) {
+      k = q - window_left;
+    }
+    if (chunk_size > 0) {
+      k = cute::max(k, q / chunk_size * chunk_size);
+    }
+    return cute::max(k, 0);
+  }
+
+  CUTE_HOST_DEVICE
+  int get_last_key(int q, int seqlen_k) const {
+    int k = seqlen_k - 1;
+    if (window_right >= 0) {
+      k = cute::min(k, q + window_right);
+    }
+    if (chunk_size > 0) {
+      k = cute::min(k, q / chunk_size * chunk_size + chunk_size - 1);
+    }
+    return k;
+  }
+
+  // query rows [q_first, q_last] of the q tile, offset into key positions
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTE_HOST_DEVICE
+  auto get_q_rows(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    int q_first = get<0>(blk_coord) * get<0>(tile_shape);
+    int q_last = cute::min(q_first + int(get<0>(tile_shape)), int(get<0>(problem_size))) - 1;
+    int offset_q = get_offset_q(problem_size);
+    return cute::make_tuple(q_first + offset_q, cute::max(q_first, q_last) + offset_q);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_start(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    auto [q_first, q_last] = get_q_rows(blk_coord, tile_shape, problem_size);
+    return get_first_key(q_first) / get<1>(tile_shape);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    auto [q_first, q_last] = get_q_rows(blk_coord, tile_shape, problem_size);
+    int trip_start = get_first_key(q_first) / get<1>(tile_shape);
+    int trip_end = ceil_div(get_last_key(q_last, get<1>(problem_size)) + 1, int(get<1>(tile_shape)));
+    return cute::max(trip_end - trip_start, 0);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_leading_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    // tiles starting before the first key of the last row miss keys for some rows
+    auto [q_first, q_last] = get_q_rows(blk_coord, tile_shape, problem_size);
+    int trip_start = get_first_key(q_first) / get<1>(tile_shape);
+    int full_start = ceil_div(get_first_key(q_last), int(get<1>(tile_shape)));
+    int trip_count = get_trip_count(blk_coord, tile_shape, problem_size);
+    return cute::min(cute::max(full_start - trip_start, 0), trip_count);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_unmasked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    // a tile is fully visible if it lies within the keys all rows of the q tile see
+    auto [q_first, q_last] = get_q_rows(blk_coord, tile_shape, problem_size);
+    int trip_start = get_first_key(q_first) / get<1>(tile_shape);
+    int trip_count = get_trip_count(blk_coord, tile_shape, problem_size);
+    int leading = get_leading_masked_trip_count(blk_coord, tile_shape, problem_size);
+    int full_end = (get_last_key(q_first, get<1>(problem_size)) + 1) / get<1>(tile_shape);
+    int unmasked = cute::min(full_end, trip_start + trip_count) - (trip_start + leading);
+    return cute::max(unmasked, 0);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return get_trip_count(blk_coord, tile_shape, problem_size)
+        - get_leading_masked_trip_count(blk_coord, tile_shape, problem_size)
+        - get_unmasked_trip_count(blk_coord, tile_shape, problem_size);
+  }
+
+  // range of q tiles that see the kv tile k_tile, used by the backward pass
+  template<class ProblemSize>
+  CUTLASS_DEVICE
+  auto get_q_trip_range(
+      int k_tile, int tile_q, int tile_k,
+      ProblemSize const& problem_size) const {
+
+    int k_first = k_tile * tile_k;
+    int k_last = cute::min(k_first + tile_k, int(get<1>(problem_size))) - 1;
+    // smallest q whose last key reaches k_first, largest q whose first key is before k_last
+    int q_first = window_right >= 0 ? k_first - window_right : 0;
+    int q_last = window_left >= 0 ? k_last + window_left : int(get<0>(problem_size) + get<1>(problem_size));
+    if (chunk_size > 0) {
+      q_first = cute::max(q_first, k_first / chunk_size * chunk_size);
+      q_last = cute::min(q_last, k_last / chunk_size * chunk_size + chunk_size - 1);
+    }
+    int offset_q = get_offset_q(problem_size);
+    q_first = cute::max(q_first - offset_q, 0);
+    q_last = cute::min(q_last - offset_q, int(get<0>(problem_size)) - 1);
+    if (q_last < q_first) {
+      return cute::make_tuple(0, 0);
+    }
+    return cute::make_tuple(q_first / tile_q, q_last / tile_q + 1);
+  }
+
+  // whether every element of the (q_tile, k_tile) tile is visible, used by the backward pass
+  template<class ProblemSize>
+  CUTLASS_DEVICE
+  bool is_unmasked_tile(
+      int q_tile, int k_tile, int tile_q, int tile_k,
+      ProblemSize const& problem_size) const {
+
+    int offset_q = get_offset_q(problem_size);
+    int q_first = q_tile * tile_q;
+    int q_last = q_first + tile_q - 1;
+    int k_first = k_tile * tile_k;
+    int k_last = k_first + tile_k - 1;
+    return q_last < get<0>(problem_size) &&
+        k_first >= get_first_key(q_last + offset_q) &&
+        k_last <= get_last_key(q_first + offset_q, get<1>(problem_size));
+  }
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_mask(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size) const {
+
+    int offset_q = get_offset_q(problem_size);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      int q = get<0>(pos) + offset_q;
+      int k = get<1>(pos);
+      if ((k < get_first_key(q)) || (k > get_last_key(q, get<1>(problem_size)))) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+template<bool kIsQBegin = true>
+struct LocalMaskForBackward : LocalMask<kIsQBegin> {
+
+  using Base = LocalMask<kIsQBegin>;
+  using Base::Base;
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_mask(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size) const {
+
+    // rows past the end of Q must not contribute to dK and dV
+    int offset_q = this->get_offset_q(problem_size);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      int q = get<0>(pos) + offset_q;
+      int k = get<1>(pos);
+      bool masked = (k < this->get_first_key(q)) || (k > this->get_last_key(q, get<1>(problem_size)));
+      if (masked || get<0>(pos) >= get<0>(problem_size)) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+// Block sparse attention: one bit per (block_q x block_k) block of the attention matrix,
+// shared by all batches and heads. Row r of the bitmap starts at ptr_block_mask + r * stride,
+// and bit (c % 32) of word c / 32 enables kv block c for q block r. kv tiles that do not
+// cover any enabled block are skipped, all others are masked elementwise. Every q block
+// needs at least one enabled kv block.
+struct BlockSparseMask : NoMask {
+
+  using Base = NoMask;
+
+  uint32_t const* ptr_block_mask = nullptr;
+  int stride = 0;
+  int block_q = 128;
+  int block_k = 128;
+
+  CUTE_HOST_DEVICE
+  bool is_block_enabled(int q_block, int k_block) const {
+    return (ptr_block_mask[q_block * stride + k_block / 32] >> (k_block % 32)) & 1u;
+  }
+
+  // whether the tile covering rows [q_first, q_last] and columns [k_first, k_last] is visible at all
+  CUTE_HOST_DEVICE
+  bool is_tile_enabled(int q_first, int q_last, int k_first, int k_last) const {
+    for (int q_block = q_first / block_q; q_block <= q_last / block_q; q_block++) {
+      for (int k_block = k_first / block_k; k_block <= k_last / block_k; k_block++) {
+        if (is_block_enabled(q_block, k_block)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  bool is_trip_enabled(
+      BlkCoord const& blk_coord,
+      int k_tile,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    int q_first = get<0>(blk_coord) * get<0>(tile_shape);
+    int q_last = cute::min(q_first + int(get<0>(tile_shape)), int(get<0>(problem_size))) - 1;
+    int k_first = k_tile * get<1>(tile_shape);
+    int k_last = cute::min(k_first + int(get<1>(tile_shape)), int(get<1>(problem_size))) - 1;
+    return is_tile_enabled(q_first, cute::max(q_first, q_last), k_first, k_last);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_next_trip(
+      BlkCoord const& blk_coord,
+      int k_tile,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    int max_trip = Base::get_trip_count(blk_coord, tile_shape, problem_size);
+    k_tile += 1;
+    while (k_tile < max_trip && ! is_trip_enabled(blk_coord, k_tile, tile_shape, problem_size)) {
+      k_tile += 1;
+    }
+    return k_tile;
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_start(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return get_next_trip(blk_coord, -1, tile_shape, problem_size);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    int max_trip = Base::get_trip_count(blk_coord, tile_shape, problem_size);
+    int trip_count = 0;
+    for (int k_tile = 0; k_tile < max_trip; k_tile++) {
+      if (is_trip_enabled(blk_coord, k_tile, tile_shape, problem_size)) {
+        trip_count += 1;
+      }
+    }
+    return trip_count;
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return get_trip_count(blk_coord, tile_shape, problem_size);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_unmasked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return 0;
+  }
+
+  // q tiles that see the kv tile k_tile, used by the backward pass
+  template<class ProblemSize>
+  CUTLASS_DEVICE
+  bool is_q_trip_enabled(
+      int q_tile, int k_tile, int tile_q, int tile_k,
+      ProblemSize const& problem_size) const {
+
+    int q_first = q_tile * tile_q;
+    int q_last = cute::min(q_first + tile_q, int(get<0>(problem_size))) - 1;
+    int k_first = k_tile * tile_k;
+    int k_last = cute::min(k_first + tile_k, int(get<1>(problem_size))) - 1;
+    return is_tile_enabled(q_first, q_last, k_first, k_last);
+  }
+
+  template<class ProblemSize>
+  CUTLASS_DEVICE
+  int get_next_q_trip(
+      int q_tile, int k_tile, int tile_q, int tile_k,
+      ProblemSize const& problem_size) const {
+
+    int max_trip = ceil_div(int(get<0>(problem_size)), tile_q);
+    q_tile += 1;
+    while (q_tile < max_trip && ! is_q_trip_enabled(q_tile, k_tile, tile_q, tile_k, problem_size)) {
+      q_tile += 1;
+    }
+    return q_tile;
+  }
+
+  template<class ProblemSize>
+  CUTLASS_DEVICE
+  int get_q_trip_count(
+      int k_tile, int tile_q, int tile_k,
+      ProblemSize const& problem_size) const {
+
+    int max_trip = ceil_div(int(get<0>(problem_size)), tile_q);
+    int trip_count = 0;
+    for (int q_tile = 0; q_tile < max_trip; q_tile++) {
+      if (is_q_trip_enabled(q_tile, k_tile, tile_q, tile_k, problem_size)) {
+        trip_count += 1;
+      }
+    }
+    return trip_count;
+  }
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_mask(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size) const {
+
+    // rows past the end of Q are clamped rather than masked, the epilogue drops them
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      int q = cute::min(int(get<0>(pos)), int(get<0>(problem_size)) - 1);
+      int k = get<1>(pos);
+      if ((k >= get<1>(problem_size)) || ! is_block_enabled(q / block_q, k / block_k)) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+struct BlockSparseMaskForBackward : BlockSparseMask {
+
+  using Base = BlockSparseMask;
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_mask(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size) const {
+
+    // rows past the end of Q must not contribute to dK and dV
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      bool masked = ! elem_less(pos, select<0,1>(problem_size));
+      if (masked || ! is_block_enabled(get<0>(pos) / block_q, get<1>(pos) / block_k)) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+// Generation with several query tokens per sequence (e.g. speculative decoding drafts).
+// The rows of the problem pack (head, token) with the head fastest, and the tokens are
+// the last num_tokens keys. Each token sees all earlier keys and, among the tokens,
+// either the causal prefix or the tokens set in its row of the (batch shared) tree mask,
+// where bit j of ptr_tree_mask[i] means that token i attends to token j.
+struct MultiTokenMask : ResidualMask {
+
+  using Base = ResidualMask;
+
+  int num_tokens = 1;
+  uint32_t const* ptr_tree_mask = nullptr;
+
+  CUTE_HOST_DEVICE
+  MultiTokenMask(int num_tokens = 1, uint32_t const* ptr_tree_mask = nullptr)
+    : num_tokens(num_tokens), ptr_tree_mask(ptr_tree_mask) {}
+
+  // keys below this are visible to every token
+  template<class ProblemSize>
+  CUTLASS_DEVICE
+  int get_shared_key_count(ProblemSize const& problem_size) const {
+    // a causal token always sees the first token
+    return get<1>(problem_size) - num_tokens + (ptr_tree_mask == nullptr ? 1 : 0);
+  }
+
+  template<class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE
+  int get_unmasked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return cute::min(
+        get_trip_count(blk_coord, tile_shape, problem_size),
+        cute::max(0, get_shared_key_count(problem_size)) / int(get<1>(tile_shape)));
+  }
+
+  template <class BlkCoord, class TileShape, class ProblemSize>
+  CUTLASS_DEVICE int get_masked_trip_count(
+      BlkCoord const& blk_coord,
+      TileShape const& tile_shape,
+      ProblemSize const& problem_size) const {
+
+    return get_trip_count(blk_coord, tile_shape, problem_size) -
+        get_unmasked_trip_count(blk_coord, tile_shape, problem_size);
+  }
+
+  template<class AccQK, class IndexQK, class ProblemSize>
+  CUTLASS_DEVICE
+  void apply_mask(
+      AccQK& acc_qk,
+      IndexQK const& index_qk,
+      ProblemSize const& problem_size) const {
+
+    int heads = cute::max(1, int(get<0>(problem_size)) / num_tokens);
+    int first_token_key = get<1>(problem_size) - num_tokens;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      auto pos = index_qk(i);
+      // padding rows past the last token behave like the last token
+      int token = cute::min(int(get<0>(pos)) / heads, num_tokens - 1);
+      int key_token = get<1>(pos) - first_token_key;
+      bool visible = get<1>(pos) < get<1>(problem_size);
+      if (key_token >= 0) {
+        visible = visible && (ptr_tree_mask != nullptr ?
+            ((ptr_tree_mask[token] >> key_token) & 1u) != 0 : key_token <= token);
+      }
+      if (! visible) {
+        acc_qk(i) = -INFINITY;
+      }
+    }
+  }
+};
+
+// Logit soft-capping (Gemma 2): the softmax sees soft_cap * tanh(s / soft_cap) instead of the
+// scaled score s = softmax_scale * q.k. Wraps any of the masks above, e.g.
+// SoftCapping<CausalMask<>>{{}, 50.0f}, and is applied to every kv tile before masking. The
+// kernels keep scores unscaled, so the capped score is mapped back by 1 / softmax_scale.
+template<class Mask>
+struct SoftCapping : Mask {
+
+  using Base = Mask;
+
+  static constexpr bool kIsSoftCapping = true;
+
+  float soft_cap = 0.0f;
+
+  CUTE_HOST_DEVICE
+  float soft_cap_score(float s, float softmax_scale) const {
+    return soft_cap / softmax_scale * cutlass::fast_tanh(s * softmax_scale / soft_cap);
+  }
+
+  // d(capped score) / d(score) = 1 - tanh^2, from the capped score
+  CUTE_HOST_DEVICE
+  float soft_cap_slope(float capped_s, float softmax_scale) const {
+    float t = capped_s * softmax_scale / soft_cap;
+    return 1.0f - t * t;
+  }
+
+  template<class AccQK>
+  CUTLASS_DEVICE
+  void apply_soft_cap(AccQK& acc_qk, float softmax_scale) const {
+    float scale_in = softmax_scale / soft_cap;
+    float scale_out = soft_cap / softmax_scale;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc_qk); i++) {
+      acc_qk(i) = scale_out * cutlass::fast_tanh(scale_in * acc_qk(i));
+    }
+  }
+};
+
+// Attention sinks: every query head has a learned logit ptr_sink[head] (in units of the scaled
+// score) that joins the softmax denominator but has no value row, so that a query can attend
+// to nothing. The head is the flat query head, and the LSE includes the sink. Wraps any of the
+// masks above, also on top of SoftCapping, which does not cap the sink.
+template<class Mask>
+struct AttentionSink : Mask {
+
+  using Base = Mask;
+
+  static constexpr bool kHasSink = true;
+
+  float const* ptr_sink = nullptr;
+};
+
+template<class T> constexpr bool is_local_mask_v =
+    std::is_base_of_v<LocalMask<true>, T> || std::is_base_of_v<LocalMask<false>, T>;
+template<class T> constexpr bool is_block_sparse_mask_v = std::is_base_of_v<BlockSparseMask, T>;
+
 struct VariableLength {
   int max_length;
   int* cumulative_length = nullptr;
@@ -197,6 +197,13 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
     // scaling factor to quantize O
     float inv_scale_o = 1.0f;
+
+    // optional per KV head scaling factors to dequantize KV, on top of scale_k and scale_v
+    float const* ptr_scale_k = nullptr;
+    float const* ptr_scale_v = nullptr;
+
+    // runtime state of the mask, e.g. the window of a LocalMask
+    Mask mask = {};
   };
 
   struct Params {
@@ -206,11 +213,31 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     float scale_softmax_log2;
 
     float scale_output;
+
+    float const* ptr_scale_k;
+    float const* ptr_scale_v;
+
+    Mask mask;
   };
 
   template<class ProblemShape>
   static bool can_implement(ProblemShape const& problem_shape, Arguments const& args) {
-    return true;
+    if constexpr (is_block_sparse_mask_v<Mask>) {
+      if (args.mask.ptr_block_mask == nullptr) {
+        return false;
+      }
+    }
+    if constexpr (Mask::kIsSoftCapping) {
+      if (args.mask.soft_cap <= 0.0f) {
+        return false;
+      }
+    }
+    if constexpr (Mask::kHasSink) {
+      if (args.mask.ptr_sink == nullptr) {
+        return false;
+      }
+    }
+    return Load::can_implement(problem_shape, args.load);
   }
 
   template<class ProblemShape>
@@ -229,7 +256,10 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
         Load::to_underlying_arguments(problem_shape, args.load, workspace),
         args.scale_q * args.scale_k * scale_softmax,
         args.scale_q * args.scale_k * log2_e * scale_softmax,
-        args.scale_v * args.inv_scale_o
+        args.scale_v * args.inv_scale_o,
+        args.ptr_scale_k,
+        args.ptr_scale_v,
+        args.mask
     };
   }
 
@@ -249,7 +279,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
     Load load;
     load.load(blk_coord, problem_shape, params.load, params_problem_shape,
-        storage,
+        params.mask, storage,
         pipeline_q, pipeline_q_producer_state,
         pipeline_kv, pipeline_kv_producer_state);
   }
@@ -269,7 +299,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     auto pipeline_q_release_state = pipeline_q_consumer_state;
     auto pipeline_kv_release_state = pipeline_kv_consumer_state;
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = params.mask.get_trip_count(blk_coord, TileShape{}, problem_shape);
 
     typename CollectiveMmaQK::TiledMma mma_qk;
     ThrMMA thr_mma_qk = mma_qk.get_slice(0);
@@ -572,15 +602,29 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     Tensor tTMEM_LOADrS = make_tensor<ElementQK>(shape(tTMEM_LOADcS));
     copy(tiled_tmem_load, tTMEM_LOADtS, tTMEM_LOADrS);
 
+    // every tile is capped, masked tiles before the mask sets -inf
+    [[maybe_unused]] float scale_softmax_head = 0.0f;
+    if constexpr (Mask::kIsSoftCapping) {
+      scale_softmax_head = params.scale_softmax * kv_head_scale(params.ptr_scale_k, blk_coord, problem_shape);
+      params.mask.apply_soft_cap(tTMEM_LOADrS, scale_softmax_head);
+    }
+
     if constexpr (need_apply_mask) {
-      Mask{}.apply_mask(tTMEM_LOADrS, tTMEM_LOADcS, problem_shape);
+      params.mask.apply_mask(tTMEM_LOADrS, tTMEM_LOADcS, problem_shape);
     }
 
+    // the hardware row max sees the unmasked S, which only the causal shape allows to shortcut
+    constexpr bool kIsBandedMask = is_local_mask_v<Mask> || is_block_sparse_mask_v<Mask>;
+
     ElementQK old_row_max = row_max;
     #if defined CUTE_ARCH_TCGEN05_TMEM_STAT_ENABLED
       auto pos = tTMEM_LOADcS(0);
-      if (!need_apply_mask || (need_apply_mask && (get<0>(pos) >= get<1>(pos) + 12) && (get<1>(pos) < get<1>(problem_shape)))) {
+      if (!need_apply_mask || (need_apply_mask && !kIsBandedMask && (get<0>(pos) >= get<1>(pos) + 12) && (get<1>(pos) < get<1>(problem_shape)))) {
         float curr_max = tiled_tmem_load.get_max();
+        if constexpr (Mask::kIsSoftCapping) {
+          // the hardware saw the uncapped S, but capping is monotonic
+          curr_max = params.mask.soft_cap_score(curr_max, scale_softmax_head);
+        }
         row_max = ::fmax(row_max, curr_max);
       }
       else
@@ -615,7 +659,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
     // notify correction wg that they are ready (might need addtl ordering between S0 and S1 WG's)
 
-    ElementQK scale = params.scale_softmax_log2;
+    ElementQK scale = params.scale_softmax_log2 * kv_head_scale(params.ptr_scale_k, blk_coord, problem_shape);
     ElementQK row_max_scale = row_max_safe * scale;
 
     float2 scale_fp32x2 = make_float2(scale, scale);
@@ -732,37 +776,68 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       PipelineC& pipeline_c, typename PipelineC::PipelineState& pipeline_c_producer_state,
       OrderBarrierSoftmax& order_s) {
 
-    int mask_tile_count = Mask{}.get_unmasked_trip_count(blk_coord, TileShape{}, problem_shape);
+    Mask const& mask = params.mask;
+
+    int leading_mask_tile_count = mask.get_leading_masked_trip_count(blk_coord, TileShape{}, problem_shape);
+    int unmasked_tile_count = mask.get_unmasked_trip_count(blk_coord, TileShape{}, problem_shape);
+    int trailing_mask_tile_count = mask.get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
 
     ElementQK row_max = -INFINITY;
     ElementQK row_sum = 0;
 
+    int k_tile = mask.get_trip_start(blk_coord, TileShape{}, problem_shape);
+
     Tensor cS_base = make_identity_tensor(select<0,1>(TileShapeQK{}));
     auto logical_offset = make_coord(
         get<0>(blk_coord) * get<0>(TileShape{}) + (stage % get<0>(ThreadShape{})) * get<0>(TileShapeQK{}),
-        0 + (stage % get<1>(ThreadShape{})) * get<1>(TileShapeQK{})
+        k_tile * get<1>(ThreadShape{}) * get<1>(TileShapeQK{}) + (stage % get<1>(ThreadShape{})) * get<1>(TileShapeQK{})
     );
     Tensor cS = domain_offset(logical_offset, cS_base);
 
+    // move cS along to the next kv tile the mask visits
+    auto advance_cS = [&]() {
+      int k_tile_next = mask.get_next_trip(blk_coord, k_tile, TileShape{}, problem_shape);
+      cS.data() = cS.data() + E<1>{} * (k_tile_next - k_tile) * get<1>(ThreadShape{}) * get<1>(TileShapeQK{});
+      k_tile = k_tile_next;
+    };
+
     pipeline_c.producer_acquire(pipeline_c_producer_state);
 
+    // Masked iterations on the leading edge of the mask
+    int mask_tile_count = leading_mask_tile_count;
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (; mask_tile_count > 0; mask_tile_count -= 1) {
+      softmax_step<true /* need_apply_mask */>(
+          row_max, row_sum, stage,
+          (mask_tile_count == 1) && (unmasked_tile_count == 0) && (trailing_mask_tile_count == 0),
+          blk_coord, cS, params, problem_shape,
+          pipeline_s, pipeline_s_consumer_state,
+          pipeline_c, pipeline_c_producer_state,
+          order_s
+      );
+
+      advance_cS();
+    }
+
+    mask_tile_count = unmasked_tile_count;
+
     CUTLASS_PRAGMA_NO_UNROLL
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
       softmax_step<false /* need_apply_mask */>(
           row_max, row_sum, stage,
-          (mask_tile_count == 1) &&
-              (Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape) == 0),
+          (mask_tile_count == 1) && (trailing_mask_tile_count == 0),
           blk_coord, cS, params, problem_shape,
           pipeline_s, pipeline_s_consumer_state,
           pipeline_c, pipeline_c_producer_state,
           order_s
       );
 
-      cS.data() = cS.data() + E<1>{} * get<1>(ThreadShape{}) * get<1>(TileShapeQK{});
+      advance_cS();
     }
 
     // Masked iterations
-    mask_tile_count = Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
+    mask_tile_count = trailing_mask_tile_count;
 
     CUTLASS_PRAGMA_NO_UNROLL
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
@@ -774,7 +849,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
           order_s
       );
 
-      cS.data() = cS.data() + E<1>{} * get<1>(ThreadShape{}) * get<1>(TileShapeQK{});
+      advance_cS();
     }
 
     pipeline_c.producer_commit(pipeline_c_producer_state);
@@ -877,6 +952,17 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     cutlass::arch::fence_view_async_shared();
   }
 
+  // the sink of an AttentionSink mask joins the final row sum, and so the LSE, but not O
+  template<class TensorV, class BlkCoord>
+  CUTLASS_DEVICE void
+  add_sink(TensorV& tTMEM_LOADVrS, BlkCoord const& blk_coord, Params const& params, float scale_softmax_log2) {
+    if constexpr (Mask::kHasSink) {
+      float log2_e = static_cast<float>(M_LOG2E);
+      float sink_log2 = params.mask.ptr_sink[get<2,0>(blk_coord)] * log2_e;
+      tTMEM_LOADVrS(kIdxFinalRowSum) += ::exp2f(sink_log2 - scale_softmax_log2 * tTMEM_LOADVrS(kIdxFinalRowMax));
+    }
+  }
+
   CUTLASS_DEVICE auto
   correction_rescale(
       float scale,
@@ -978,7 +1064,13 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       PipelineE& pipeline_epi, typename PipelineE::PipelineState& pipeline_epi_producer_state,
       CollectiveEpilogue& epilogue) {
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = params.mask.get_trip_count(blk_coord, TileShape{}, problem_shape);
+
+    // fold the per KV head dequantization into the softmax and output scales
+    float scale_k_head = kv_head_scale(params.ptr_scale_k, blk_coord, problem_shape);
+    float scale_softmax = params.scale_softmax * scale_k_head;
+    float scale_softmax_log2 = params.scale_softmax_log2 * scale_k_head;
+    float scale_output = params.scale_output * kv_head_scale(params.ptr_scale_v, blk_coord, problem_shape);
 
     int thread_idx = threadIdx.x % (4 * cutlass::NumThreadsPerWarp);
 
@@ -1024,7 +1116,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
       copy(tiled_tmem_loadv, tTMEM_LOADVtS0, tTMEM_LOADVrS);
 
       // e^(scale * (old_max - new_max)
-      float scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(params.scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
+      float scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
 
       pipeline_o.consumer_wait(pipeline_o_consumer_state);
 
@@ -1045,7 +1137,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
       copy(tiled_tmem_loadv, tTMEM_LOADVtS1, tTMEM_LOADVrS);
 
-      scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(params.scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
+      scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
 
       pipeline_o.consumer_wait(pipeline_o_consumer_state);
 
@@ -1077,6 +1169,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     // read row_sum and final row_max here
     Tensor tTMEM_LOADVrS = make_tensor<ElementQK>(shape(tTMEM_LOADVcS));
     copy(tiled_tmem_loadv, tTMEM_LOADVtS0, tTMEM_LOADVrS);
+    add_sink(tTMEM_LOADVrS, blk_coord, params, scale_softmax_log2);
 
     pipeline_s0_c.consumer_release(pipeline_s0_c_consumer_state);
     ++pipeline_s0_c_consumer_state;
@@ -1093,7 +1186,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     Tensor sO = make_tensor(make_smem_ptr(shared_storage_epi.smem_o.data()), typename TensorStorageEpi::SmemLayoutO{});
     Tensor gLSE = make_tensor(make_gmem_ptr(epilogue.params.ptr_LSE), select<0,3>(problem_shape), epilogue.params.dLSE);
 
-    correction_epilogue(params.scale_output / tTMEM_LOADVrS(kIdxFinalRowSum), _0{}, sO);
+    correction_epilogue(scale_output / tTMEM_LOADVrS(kIdxFinalRowSum), _0{}, sO);
 
     if (epilogue.params.ptr_LSE != nullptr) {
       int row_idx = get<0>(tTMEM_LOADVcS(_0{})) + get<0>(TileShape{}) * get<0>(blk_coord);
@@ -1103,7 +1196,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
         row_offset = get<0>(params_problem_shape).cumulative_length[get<2,1>(blk_coord)];
       }
 
-      ElementPV lse = cutlass::fast_log(tTMEM_LOADVrS(kIdxFinalRowSum)) + params.scale_softmax * tTMEM_LOADVrS(kIdxFinalRowMax);
+      ElementPV lse = cutlass::fast_log(tTMEM_LOADVrS(kIdxFinalRowSum)) + scale_softmax * tTMEM_LOADVrS(kIdxFinalRowMax);
 
       if (row_idx < get<0>(problem_shape)) {
         gLSE(row_idx + row_offset, get<2>(blk_coord)) = lse;
@@ -1122,6 +1215,7 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
 
     // load from V1
     copy(tiled_tmem_loadv, tTMEM_LOADVtS1, tTMEM_LOADVrS);
+    add_sink(tTMEM_LOADVrS, blk_coord, params, scale_softmax_log2);
 
     pipeline_s1_c.consumer_release(pipeline_s1_c_consumer_state);
     ++pipeline_s1_c_consumer_state;
@@ -1129,12 +1223,12 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     pipeline_o.consumer_wait(pipeline_o_consumer_state);
     pipeline_epi.producer_acquire(pipeline_epi_producer_state);
 
-    correction_epilogue(params.scale_output / tTMEM_LOADVrS(kIdxFinalRowSum), _1{}, sO);
+    correction_epilogue(scale_output / tTMEM_LOADVrS(kIdxFinalRowSum), _1{}, sO);
 
     if (epilogue.params.ptr_LSE != nullptr) {
       int row_idx = get<0>(tTMEM_LOADVcS(_0{})) + get<0>(TileShape{}) * get<0>(blk_coord) + get<0>(TileShapeQK{});
 
-      ElementPV lse = cutlass::fast_log(tTMEM_LOADVrS(kIdxFinalRowSum)) + params.scale_softmax * tTMEM_LOADVrS(kIdxFinalRowMax);
+      ElementPV lse = cutlass::fast_log(tTMEM_LOADVrS(kIdxFinalRowSum)) + scale_softmax * tTMEM_LOADVrS(kIdxFinalRowMax);
 
       int row_offset = 0;
       if constexpr (is_variable_length_v<tuple_element_t<0, ParamsProblemShape>>) {
@@ -1174,6 +1268,10 @@ struct Sm100FmhaFwdMainloopTmaWarpspecialized {
     Tensor sO = make_tensor(make_smem_ptr(shared_storage_epi.smem_o.data()), typename TensorStorageEpi::SmemLayoutO{});
     Tensor gLSE = make_tensor(make_gmem_ptr(epilogue.params.ptr_LSE), select<0,3>(problem_shape), epilogue.params.dLSE);
     float lse = -INFINITY;
+    if constexpr (Mask::kHasSink) {
+      // without keys the sink takes the whole softmax
+      lse = params.mask.ptr_sink[get<2,0>(blk_coord)];
+    }
     int thread_idx = threadIdx.x % (4 * NumThreadsPerWarp);
 
 #define DSHOW(x) print(#x ": "); print(x); print("\n")
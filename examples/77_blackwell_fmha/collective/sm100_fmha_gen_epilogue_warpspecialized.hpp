@@ -59,6 +59,10 @@ struct Sm100FmhaGenEpilogueWarpspecialized {
   struct Arguments {
     Element* ptr_o;
     StrideO dO;
+
+    // query tokens per sequence, the rows then pack (head, token) and dO is the head stride
+    int num_tokens = 1;
+    int64_t stride_o_token = 0;
   };
 
   using Params = Arguments;
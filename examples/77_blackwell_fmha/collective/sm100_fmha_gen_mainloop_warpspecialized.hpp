@@ -83,6 +83,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
   using StrideOOrig = StrideO_;
   using StrideO = decltype(replace<0>(StrideO_{}, 0));
   using Mask = Mask_;
+  static_assert(! Mask::kIsSoftCapping && ! Mask::kHasSink, "Soft-capping and sinks are only supported by the FMHA mainloop");
 
   static constexpr int StageCountQ = get<1>(TileShape{}) == 256 ? 1 : 2;
   static constexpr int StageCountKV = 256 * 11 / get<1>(TileShape{});
@@ -201,6 +202,12 @@ struct Sm100FmhaGenMainloopWarpspecialized {
 
     // scaling factor to quantize O
     float inv_scale_o = 1.0f;
+
+    // optional per KV head scaling factors to dequantize KV, on top of scale_k and scale_v
+    float const* ptr_scale_k = nullptr;
+    float const* ptr_scale_v = nullptr;
+
+    Mask mask = {};
   };
 
   struct Params {
@@ -210,11 +217,16 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     float scale_softmax_log2;
 
     float scale_output;
+
+    float const* ptr_scale_k;
+    float const* ptr_scale_v;
+
+    Mask mask;
   };
 
   template<class ProblemShape>
   static bool can_implement(ProblemShape const& problem_shape, Arguments const& args) {
-    return true;
+    return Load::can_implement(problem_shape, args.load);
   }
 
   template<class ProblemShape>
@@ -233,7 +245,10 @@ struct Sm100FmhaGenMainloopWarpspecialized {
         Load::to_underlying_arguments(problem_shape, args.load, workspace),
         args.scale_q * args.scale_k * scale_softmax,
         args.scale_q * args.scale_k * log2_e * scale_softmax,
-        args.scale_v * args.inv_scale_o
+        args.scale_v * args.inv_scale_o,
+        args.ptr_scale_k,
+        args.ptr_scale_v,
+        args.mask
     };
   }
 
@@ -253,7 +268,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
 
     Load load;
     load.load(blk_coord, problem_shape, params.load, params_problem_shape,
-        storage,
+        params.mask, storage,
         pipeline_q, pipeline_q_producer_state,
         pipeline_kv, pipeline_kv_producer_state);
   }
@@ -273,7 +288,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     auto pipeline_q_release_state = pipeline_q_consumer_state;
     auto pipeline_kv_release_state = pipeline_kv_consumer_state;
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = params.mask.get_trip_count(blk_coord, TileShape{}, problem_shape);
 
     typename CollectiveMmaQK::TiledMma mma_qk;
     ThrMMA thr_mma_qk = mma_qk.get_slice(0);
@@ -577,7 +592,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     copy(tiled_tmem_load, tTMEM_LOADtS, tTMEM_LOADrS);
 
     if constexpr (need_apply_mask) {
-      Mask{}.apply_mask(tTMEM_LOADrS, tTMEM_LOADcS, problem_shape);
+      params.mask.apply_mask(tTMEM_LOADrS, tTMEM_LOADcS, problem_shape);
     }
 
     ElementQK old_row_max = row_max;
@@ -619,7 +634,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
 
     // notify correction wg that they are ready (might need addtl ordering between S0 and S1 WG's)
 
-    ElementQK scale = params.scale_softmax_log2;
+    ElementQK scale = params.scale_softmax_log2 * kv_head_scale(params.ptr_scale_k, blk_coord, problem_shape);
     ElementQK row_max_scale = row_max_safe * scale;
 
     float2 scale_fp32x2 = make_float2(scale, scale);
@@ -736,7 +751,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       PipelineC& pipeline_c, typename PipelineC::PipelineState& pipeline_c_producer_state,
       OrderBarrierSoftmax& order_s) {
 
-    int mask_tile_count = Mask{}.get_unmasked_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = params.mask.get_unmasked_trip_count(blk_coord, TileShape{}, problem_shape);
 
     ElementQK row_max = -INFINITY;
     ElementQK row_sum = 0;
@@ -755,7 +770,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       softmax_step<false /* need_apply_mask */>(
           row_max, row_sum, stage,
           (mask_tile_count == 1) &&
-              (Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape) == 0),
+              (params.mask.get_masked_trip_count(blk_coord, TileShape{}, problem_shape) == 0),
           blk_coord, cS, params, problem_shape,
           pipeline_s, pipeline_s_consumer_state,
           pipeline_c, pipeline_c_producer_state,
@@ -766,7 +781,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     }
 
     // Masked iterations
-    mask_tile_count = Mask{}.get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
+    mask_tile_count = params.mask.get_masked_trip_count(blk_coord, TileShape{}, problem_shape);
 
     CUTLASS_PRAGMA_NO_UNROLL
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
@@ -830,6 +845,15 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     Tensor tTMEM_LOADcO = thr_tmem_load.partition_D(tOcO_i);
     Tensor tTMEM_LOADgO = thr_tmem_load.partition_D(tOgO_i);
 
+    // with several query tokens, the rows pack (head, token) and each token has its own stride
+    if (epilogue.params.num_tokens > 1) {
+      int row = get<0>(tTMEM_LOADcO(_0{}));
+      int heads = cute::max(1, int(get<0>(g_shape)) / epilogue.params.num_tokens);
+      int64_t offset = static_cast<int64_t>(row % heads - row) * stride<0>(gO) +
+          static_cast<int64_t>(row / heads) * epilogue.params.stride_o_token;
+      tTMEM_LOADgO.data() = tTMEM_LOADgO.data() + offset;
+    }
+
     float row_max = std::max(v0(kIdxFinalRowMax), v1(kIdxFinalRowMax));
     float adj0 = ::exp2f(scale_softmax_log2 * (v0(kIdxFinalRowMax) - row_max));
     float adj1 = ::exp2f(scale_softmax_log2 * (v1(kIdxFinalRowMax) - row_max));
@@ -988,7 +1012,11 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       PipelineE& pipeline_epi, typename PipelineE::PipelineState& pipeline_epi_producer_state,
       Epilogue const& epilogue) {
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = params.mask.get_trip_count(blk_coord, TileShape{}, problem_shape);
+
+    // fold the per KV head dequantization into the softmax and output scales
+    float scale_softmax_log2 = params.scale_softmax_log2 * kv_head_scale(params.ptr_scale_k, blk_coord, problem_shape);
+    float scale_output = params.scale_output * kv_head_scale(params.ptr_scale_v, blk_coord, problem_shape);
 
     int thread_idx = threadIdx.x % (4 * cutlass::NumThreadsPerWarp);
 
@@ -1034,7 +1062,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
       copy(tiled_tmem_loadv, tTMEM_LOADVtS0, tTMEM_LOADVrS);
 
       // e^(scale * (old_max - new_max)
-      float scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(params.scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
+      float scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
 
       pipeline_o.consumer_wait(pipeline_o_consumer_state);
 
@@ -1055,7 +1083,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
 
       copy(tiled_tmem_loadv, tTMEM_LOADVtS1, tTMEM_LOADVrS);
 
-      scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(params.scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
+      scale = (tTMEM_LOADVrS(kIdxOldRowMax) == tTMEM_LOADVrS(kIdxNewRowMax)) ? 1.0f : ::exp2f(scale_softmax_log2 * (tTMEM_LOADVrS(kIdxOldRowMax) - tTMEM_LOADVrS(kIdxNewRowMax)));
 
       pipeline_o.consumer_wait(pipeline_o_consumer_state);
 
@@ -1118,7 +1146,7 @@ struct Sm100FmhaGenMainloopWarpspecialized {
     auto mO = make_tensor(make_gmem_ptr(epilogue.params.ptr_o), append<3>(select<0,1>(TileShapePV{}), get<3>(problem_shape)), epilogue.params.dO);
     auto gO = mO(_, _, get<2>(blk_coord));
 
-    correction_epilogue(params.scale_softmax_log2, params.scale_output, tTMEM_LOADVrS0, tTMEM_LOADVrS1, gO, cO, g_shape, epilogue);
+    correction_epilogue(scale_softmax_log2, scale_output, tTMEM_LOADVrS0, tTMEM_LOADVrS1, gO, cO, g_shape, epilogue);
 
     cutlass::arch::fence_view_async_tmem_load();
 
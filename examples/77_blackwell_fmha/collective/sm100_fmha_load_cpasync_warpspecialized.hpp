@@ -82,10 +82,33 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     StrideCacheK dCacheK;
     Element* ptr_cache_v;
     StrideCacheV dCacheV;
+
+    // for paged attention, we interpret the batch mode of the cache as pages and the
+    // sequence mode as the offset within a page, and index pages through the page table
+    const int* ptr_page_table = nullptr;
+    // page table is [batch, pages per batch]
+    int stride_page_table = 0;
+    // must be a multiple of the kv tile size, such that no tile straddles pages
+    int page_size = 0;
+
+    // query tokens per sequence, the rows of q then pack (head, token) and dQ is the head
+    // stride, with new k/v there is one new entry per token (along the seqlen mode of dNewK)
+    int num_tokens = 1;
+    int64_t stride_q_token = 0;
   };
 
   using Params = Arguments;
 
+  template<class ProblemShape>
+  static bool can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if (args.ptr_page_table == nullptr) {
+      return true;
+    }
+    return args.page_size > 0 &&
+        args.page_size % get<1>(TileShapeQK{}) == 0 &&
+        args.page_size % get<2>(TileShapePV{}) == 0;
+  }
+
   template<class ProblemShape>
   static Params to_underlying_arguments(
       ProblemShape const& problem_shape,
@@ -140,11 +163,11 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
   load(
       BlkCoord const& blk_coord, ProblemShape const& problem_shape,
       Params const& params, ParamsProblemShape const& params_problem_shape,
-      TensorStorage& storage,
+      Mask const& mask, TensorStorage& storage,
       PipelineQ& pipeline_q, typename PipelineQ::PipelineState& pipeline_q_producer_state,
       PipelineKV& pipeline_kv, typename PipelineKV::PipelineState& pipeline_kv_producer_state) {
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord, TileShape{}, problem_shape);
+    int mask_tile_count = mask.get_trip_count(blk_coord, TileShape{}, problem_shape);
     mask_tile_count *= 2;
 
     int warp_idx = (threadIdx.x / 32) % 2;
@@ -158,6 +181,28 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
       get<2,1>(blk_coord_cache) = params.cache_batch_idx[get<2,1>(blk_coord_cache)];
     }
 
+    bool is_paged = params.ptr_page_table != nullptr;
+    const int* page_table = params.ptr_page_table;
+    int tiles_per_page = 1;
+    if (is_paged) {
+      page_table += get<2,1>(blk_coord_cache) * params.stride_page_table;
+      tiles_per_page = params.page_size / get<1>(TileShapeQK{});
+      // the page is applied per tile as an offset, so the cache tensors start at page 0
+      get<2,1>(blk_coord_cache) = 0;
+    }
+
+    // source of kv tile index in the cache, either contiguous or through the page table
+    auto cache_tile = [&](auto const& tXgX, int index, auto const& stride_page) {
+      int tile = index;
+      int64_t offset = 0;
+      if (is_paged) {
+        tile = index % tiles_per_page;
+        offset = static_cast<int64_t>(page_table[index / tiles_per_page]) * stride_page;
+      }
+      auto tXgX_tile = tXgX(_, _, _, _, tile);
+      return make_tensor(tXgX_tile.data() + offset, tXgX_tile.layout());
+    };
+
     // Q1, K1, K2, V1, K3, V2, ... Kn, Vn-1, Vn
     // two pipes: Q and KV
     auto cQ = make_identity_tensor(select<0,2>(TileShape{}));
@@ -185,6 +230,7 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     auto tQcQ = thr_copy_q.partition_S(tScQ);
 
     auto limitQ = append<2>(get<0>(problem_shape), _128{});
+    int heads_q = cute::max(1, int(get<0>(problem_shape)) / params.num_tokens);
 
     // Q1
     int q0_index = get<0>(blk_coord);
@@ -204,6 +250,11 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
         auto cc = c(vlen*i);
         Vec* dst_ptr = &dst(i);
         const Vec* src_ptr = &src(i);
+        if (params.num_tokens > 1) {
+          int row = get<0>(cc);
+          src_ptr = reinterpret_cast<const Vec*>(&gQ(row % heads_q, get<1>(cc)) +
+              static_cast<int64_t>(row / heads_q) * params.stride_q_token);
+        }
         bool guard = elem_less(cc, limitQ);
         cutlass::arch::cp_async_zfill<16, cutlass::arch::CacheOperation::Always>(
           dst_ptr, src_ptr, guard
@@ -237,7 +288,7 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     auto tKgK = thr_copy_k.partition_S(tSgK);
     auto tKcK = thr_copy_k.partition_S(tScK);
 
-    int seqlen_cache_kv = get<1>(problem_shape) - ((params.ptr_new_k != nullptr) ? 1 : 0);
+    int seqlen_cache_kv = get<1>(problem_shape) - ((params.ptr_new_k != nullptr) ? params.num_tokens : 0);
     auto limitK = append<2>(seqlen_cache_kv, _128{});
 
     auto cV_t = make_identity_tensor(select<1,2>(TileShapePV{}));
@@ -276,13 +327,15 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     auto load_k = [&](int k_index, auto& state) {
       pipeline_kv.producer_acquire(state);
 
+      auto tKgK_tile = cache_tile(tKgK, k_index, get<2,1>(params.dCacheK));
+
       if (k_index < full_tiles_cache) {
-        copy(tiled_copy_k, tKgK(_, _, _, _, k_index), tKsK(_, _, _, _, state.index()));
+        copy(tiled_copy_k, tKgK_tile, tKsK(_, _, _, _, state.index()));
         pipeline_kv.producer_commit(state, cutlass::arch::cpasync_barrier_arrive);
       } else {
         using Vec = uint128_t;
         Vec vzero = uint128_t(0, 0);
-        auto src = recast<Vec>(tKgK(_, _, _, _, k_index));
+        auto src = recast<Vec>(tKgK_tile);
         auto dst = recast<Vec>(tKsK(_, _, _, _, state.index()));
         auto src2 = recast<Vec>(gNewK);
         auto c = tKcK(_, _, _, _, k_index);
@@ -293,8 +346,9 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
           Vec* dst_ptr = &dst(i);
           const Vec* src_ptr = &src(i);
           bool guard = elem_less(cc, limitK);
-          if (get<0>(cc) == seqlen_cache_kv && has_new) {
-            src_ptr = &src2(_0{}, get<1>(cc) / vlen);
+          int new_idx = get<0>(cc) - seqlen_cache_kv;
+          if (has_new && new_idx >= 0 && new_idx < params.num_tokens) {
+            src_ptr = &src2(new_idx, get<1>(cc) / vlen);
             guard = true;
           }
           cutlass::arch::cp_async_zfill<16, cutlass::arch::CacheOperation::Global>(
@@ -309,13 +363,15 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     auto load_v = [&](int v_index, auto& state) {
       pipeline_kv.producer_acquire(state);
 
+      auto tVgV_tile = cache_tile(tVgV, v_index, get<2,1>(params.dCacheV));
+
       if (v_index < full_tiles_cache) {
-        copy(tiled_copy_v, tVgV(_, _, _, _, v_index), tVsV(_, _, _, _, state.index()));
+        copy(tiled_copy_v, tVgV_tile, tVsV(_, _, _, _, state.index()));
         pipeline_kv.producer_commit(state, cutlass::arch::cpasync_barrier_arrive);
       } else {
         using Vec = uint128_t;
         Vec vzero = uint128_t(0, 0);
-        auto src = recast<Vec>(tVgV(_, _, _, _, v_index));
+        auto src = recast<Vec>(tVgV_tile);
         auto dst = recast<Vec>(tVsV(_, _, _, _, state.index()));
         auto src2 = recast<Vec>(gNewV);
         int vlen = sizeof(Vec) / sizeof(Element);
@@ -327,8 +383,9 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
           Vec* dst_ptr = &dst(i);
           const Vec* src_ptr = &src(i);
           bool guard = elem_less(cc, limitV);
-          if (get<1>(cc) == seqlen_cache_kv && has_new) {
-            src_ptr = &src2(_0{}, get<0>(cc) / vlen);
+          int new_idx = get<1>(cc) - seqlen_cache_kv;
+          if (has_new && new_idx >= 0 && new_idx < params.num_tokens) {
+            src_ptr = &src2(new_idx, get<0>(cc) / vlen);
             guard = true;
           }
           cutlass::arch::cp_async_zfill<16, cutlass::arch::CacheOperation::Global>(
@@ -371,10 +428,21 @@ struct Sm100FmhaLoadCpAsyncWarpspecialized {
     ++pipeline_kv_producer_state;
     v_index += 1;
   
-    if (has_new) {
+    for (int token = 0; has_new && token < params.num_tokens; token++) {
+      int new_idx = seqlen_cache_kv + token;
+      int64_t offset_k = 0;
+      int64_t offset_v = 0;
+      if (is_paged) {
+        int page = page_table[new_idx / params.page_size];
+        offset_k = static_cast<int64_t>(page) * get<2,1>(params.dCacheK);
+        offset_v = static_cast<int64_t>(page) * get<2,1>(params.dCacheV);
+        new_idx = new_idx % params.page_size;
+      }
+      Tensor gK_new = make_tensor(gK.data() + offset_k, gK.layout());
+      Tensor gV_new = make_tensor(gV.data() + offset_v, gV.layout());
       for (int i = thread_idx; i < get<2>(TileShape{}); i += 64) {
-        gK(seqlen_cache_kv, i, 0) = gNewK(0, i);
-        gV(i, seqlen_cache_kv, 0) = gNewV(0, i);
+        gK_new(new_idx, i, 0) = gNewK(token, i);
+        gV_new(i, new_idx, 0) = gNewV(token, i);
       }
     }
   }
@@ -38,6 +38,7 @@
 
 #include "collective/fmha_common.hpp"
 #include "collective/fmha_fusion.hpp"
+#include "collective/fmha_rope.hpp"
 
 namespace cutlass::fmha::collective {
 
@@ -71,6 +72,21 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     StrideK dK;
     const Element* ptr_V;
     StrideV dV;
+
+    // for paged attention, we interpret what was previously [batch, seqlen_k]
+    // as [page_count, page_size] for K and V, and index according to page_table
+    const int* ptr_page_table = nullptr;
+    // page table is [batch, pages per batch]
+    int stride_page_table = 0;
+    int page_count = 0;
+    // must be a multiple of the kv tile size, such that every tile is a single TMA load
+    int page_size = 0;
+
+    // rotary position embedding of Q and K, the load warp then copies their tiles through
+    // registers instead of TMA. K row j sits at position j, Q row i at i + seqlen_k - seqlen_q
+    Rope rope{};
+    // optional destination of the rotated K, laid out (and paged) like K
+    Element* ptr_K_rotated = nullptr;
   };
 
   using TMA_Q = typename CollectiveMmaQK::Params::TMA_A;
@@ -81,8 +97,37 @@ struct Sm100FmhaLoadTmaWarpspecialized {
     TMA_Q tma_load_q;
     TMA_K tma_load_k;
     TMA_V tma_load_v;
+
+    const int* ptr_page_table;
+    int stride_page_table;
+    int page_size;
+
+    Rope rope{};
+    const Element* ptr_Q;
+    StrideQ dQ;
+    const Element* ptr_K;
+    StrideK dK;
+    Element* ptr_K_rotated;
   };
 
+  template<class ProblemShape>
+  static bool can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if (args.rope.is_enabled() && get<2>(problem_shape) % 2 != 0) {
+      return false;
+    }
+    if (args.ptr_page_table == nullptr) {
+      return true;
+    }
+    if constexpr (is_variable_length_v<tuple_element_t<1, ProblemShape>>) {
+      if (get<1>(problem_shape).cumulative_length != nullptr) {
+        return false;
+      }
+    }
+    return args.page_count > 0 && args.page_size > 0 &&
+        args.page_size % get<1>(TileShapeQK{}) == 0 &&
+        args.page_size % get<2>(TileShapePV{}) == 0;
+  }
+
   template<class ProblemShape>
   static Params to_underlying_arguments(
       ProblemShape const& problem_shape,
@@ -119,7 +164,21 @@ struct Sm100FmhaLoadTmaWarpspecialized {
             ptr_K, dK,
         }, /*workspace=*/ nullptr);
 
-    auto problem_shape_pv = select<0,2,1,3>(problem_shape_qk);
+    // the K/V descriptors address pages, the Q descriptor is unchanged
+    IntProblemShape problem_shape_kv = problem_shape_qk;
+    if (args.ptr_page_table != nullptr) {
+      get<1>(problem_shape_kv) = args.page_size;
+      get<3,1>(problem_shape_kv) = args.page_count;
+    }
+
+    auto params_qk_paged = CollectiveMmaQK::to_underlying_arguments(
+        problem_shape_kv,
+        typename CollectiveMmaQK::Arguments {
+            ptr_Q, dQ,
+            ptr_K, dK,
+        }, /*workspace=*/ nullptr);
+
+    auto problem_shape_pv = select<0,2,1,3>(problem_shape_kv);
     auto params_pv = CollectiveMmaPV::to_underlying_arguments(
         problem_shape_pv,
         typename CollectiveMmaPV::Arguments {
@@ -129,8 +188,15 @@ struct Sm100FmhaLoadTmaWarpspecialized {
 
     return Params{
         params_qk.tma_load_a,
-        params_qk.tma_load_b,
-        params_pv.tma_load_b
+        params_qk_paged.tma_load_b,
+        params_pv.tma_load_b,
+        args.ptr_page_table,
+        args.stride_page_table,
+        args.page_size,
+        args.rope,
+        ptr_Q, dQ,
+        ptr_K, dK,
+        args.ptr_K_rotated
     };
   }
 
@@ -147,14 +213,14 @@ struct Sm100FmhaLoadTmaWarpspecialized {
   load(
       BlkCoord const& blk_coord_in, ProblemShape const& problem_shape,
       Params const& params, ParamsProblemShape const& params_problem_shape,
-      TensorStorage& storage,
+      Mask const& mask, TensorStorage& storage,
       PipelineQ& pipeline_q, typename PipelineQ::PipelineState& pipeline_q_producer_state,
       PipelineKV& pipeline_kv, typename PipelineKV::PipelineState& pipeline_kv_producer_state) {
 
     BlkCoord blk_coord_q = blk_coord_in;
     BlkCoord blk_coord_kv = blk_coord_in;
 
-    int mask_tile_count = Mask{}.get_trip_count(blk_coord_in, TileShape{}, problem_shape);
+    int mask_tile_count = mask.get_trip_count(blk_coord_in, TileShape{}, problem_shape);
 
     using X = Underscore;
 
@@ -212,7 +278,6 @@ struct Sm100FmhaLoadTmaWarpspecialized {
       params.tma_load_k, _0{}, make_layout(_1{}),
       group_modes<0,3>(sK), group_modes<0,3>(tSgK_kdl)
     );
-    Tensor tKgK = tKgK_kdl(_, _, _0{}, get<2>(blk_coord_kv));
 
     // compute gV, sV
     ThrMMA mma_pv = typename CollectiveMmaPV::TiledMma{}.get_slice(0);
@@ -227,7 +292,49 @@ struct Sm100FmhaLoadTmaWarpspecialized {
       params.tma_load_v, _0{}, make_layout(_1{}),
       group_modes<0,3>(sV), group_modes<0,3>(tOgV_dkl)
     );
-    auto tVgV = tVgV_dkl(_, _0{}, _, get<2>(blk_coord_kv));
+
+    // a kv tile is addressed by its index within the batch, or for paged attention,
+    // by its index within the page that the page table maps it to
+    bool is_paged = params.ptr_page_table != nullptr;
+    const int* page_table = params.ptr_page_table;
+    int tiles_per_page = 1;
+    if (is_paged) {
+      page_table += get<2,1>(blk_coord_kv) * params.stride_page_table;
+      tiles_per_page = params.page_size / get<1>(TileShapeQK{});
+    }
+
+    auto kv_coord = [&](int k_index) {
+      auto coord = get<2>(blk_coord_kv);
+      int tile = k_index;
+      if (is_paged) {
+        get<1>(coord) = page_table[k_index / tiles_per_page];
+        tile = k_index % tiles_per_page;
+      }
+      return cute::make_tuple(tile, coord);
+    };
+
+    // with rope, Q and K tiles are read through pointer views tiled like the TMA tensors
+    bool is_rope = params.rope.is_enabled();
+    int head_dim = get<2>(problem_shape);
+    Tensor gQ_ptr = local_tile(
+        domain_offset(make_coord(q_offs_0, _0{}, make_coord(_0{}, _0{})),
+            make_tensor(make_gmem_ptr(params.ptr_Q), make_layout(select<0,2,3>(problem_shape), params.dQ))),
+        TileShapeQK{}, make_coord(_, _, _), Step<_1, X, _1>{});
+    Tensor gK_ptr = local_tile(
+        domain_offset(make_coord(kv_offs_0, _0{}, make_coord(_0{}, _0{})),
+            make_tensor(make_gmem_ptr(params.ptr_K), make_layout(select<1,2,3>(problem_shape), params.dK))),
+        TileShapeQK{}, make_coord(_, _, _), Step<X, _1, _1>{});
+    Tensor gK_rotated = local_tile(
+        domain_offset(make_coord(kv_offs_0, _0{}, make_coord(_0{}, _0{})),
+            make_tensor(make_gmem_ptr(params.ptr_K_rotated), make_layout(select<1,2,3>(problem_shape), params.dK))),
+        TileShapeQK{}, make_coord(_, _, _), Step<X, _1, _1>{});
+    Tensor tScQ = mma_qk.partition_A(make_identity_tensor(select<0,2>(TileShapeQK{})));
+    Tensor tScK = mma_qk.partition_B(make_identity_tensor(select<1,2>(TileShapeQK{})));
+    // the query heads of a kv head load the same K, the first one stores it rotated
+    bool is_k_rotated_writer = params.ptr_K_rotated != nullptr &&
+        get<0>(idx2crd(get<2,0>(blk_coord_in), shape<3,0>(problem_shape))) == 0;
+    constexpr uint32_t kTransactionBytesQ = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutQ{})) * sizeof_bits_v<Element>);
+    constexpr uint32_t kTransactionBytesK = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutK{})) * sizeof_bits_v<Element>);
 
     // blk_coord in decomposed in terms of TileShape, not TileShapeQK
     // As such, it needs to be transformed as
@@ -236,62 +343,84 @@ struct Sm100FmhaLoadTmaWarpspecialized {
 
     uint32_t lane_predicate = cute::elect_one_sync();
 
+    auto load_q = [&](int q_index) {
+      pipeline_q.producer_acquire(pipeline_q_producer_state);
+      auto tma_barrier = pipeline_q.producer_get_barrier(pipeline_q_producer_state);
+      if (is_rope) {
+        int q_begin = q_index * get<0>(TileShapeQK{});
+        copy_rope(params.rope, gQ_ptr(_, _, q_index, _0{}, get<2>(blk_coord_q)),
+            sQ(_, _, _, pipeline_q_producer_state.index()), tScQ,
+            get<0>(problem_shape) - q_begin, head_dim,
+            q_begin + get<1>(problem_shape) - get<0>(problem_shape));
+        commit_rope(tma_barrier, kTransactionBytesQ, lane_predicate);
+      }
+      else if (lane_predicate) {
+        copy(params.tma_load_q.with(*tma_barrier, 0), tQgQ(_, q_index), tQsQ(_, pipeline_q_producer_state.index()));
+      }
+      ++pipeline_q_producer_state;
+    };
+
+    // k_index is the logical tile, k_tile and k_coord address it in the (paged) K
+    auto load_k = [&](int k_index, int k_tile, auto const& k_coord) {
+      pipeline_kv.producer_acquire(pipeline_kv_producer_state);
+      auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
+      if (is_rope) {
+        int k_begin = k_index * get<1>(TileShapeQK{});
+        Tensor gK_rotated_tile = gK_rotated(_, _, k_tile, _0{}, k_coord);
+        copy_rope(params.rope, gK_ptr(_, _, k_tile, _0{}, k_coord),
+            sK(_, _, _, pipeline_kv_producer_state.index()), tScK,
+            get<1>(problem_shape) - k_begin, head_dim, k_begin,
+            [&](int row, int col, auto value) {
+              if (is_k_rotated_writer) {
+                gK_rotated_tile(row, col) = value;
+              }
+            });
+        commit_rope(tma_barrier, kTransactionBytesK, lane_predicate);
+      }
+      else if (lane_predicate) {
+        copy(params.tma_load_k.with(*tma_barrier, 0), tKgK_kdl(_, k_tile, _0{}, k_coord), tKsK(_, pipeline_kv_producer_state.index()));
+      }
+      ++pipeline_kv_producer_state;
+    };
+
     // Q1
     int q0_index = 2 * get<0>(blk_coord_q);
     int q1_index = 2 * get<0>(blk_coord_q) + 1;
-    pipeline_q.producer_acquire(pipeline_q_producer_state);
-    if (lane_predicate) {
-      auto tma_barrier = pipeline_q.producer_get_barrier(pipeline_q_producer_state);
-      copy(params.tma_load_q.with(*tma_barrier, 0), tQgQ(_, q0_index), tQsQ(_, pipeline_q_producer_state.index()));
-    }
-    ++pipeline_q_producer_state;
+    load_q(q0_index);
 
-    // K1
-    int k_index = 0;
-    pipeline_kv.producer_acquire(pipeline_kv_producer_state);
-    if (lane_predicate) {
-      auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-      copy(params.tma_load_k.with(*tma_barrier, 0), tKgK(_, k_index), tKsK(_, pipeline_kv_producer_state.index()));
-    }
-    ++pipeline_kv_producer_state;
+    // K1, kv tiles the mask rules out are never loaded
+    int k_index = mask.get_trip_start(blk_coord_in, TileShape{}, problem_shape);
+    auto [k_tile, k_coord] = kv_coord(k_index);
+    load_k(k_index, k_tile, k_coord);
 
     // Q2
-    pipeline_q.producer_acquire(pipeline_q_producer_state);
-    if (lane_predicate) {
-      auto tma_barrier = pipeline_q.producer_get_barrier(pipeline_q_producer_state);
-      copy(params.tma_load_q.with(*tma_barrier, 0), tQgQ(_, q1_index), tQsQ(_, pipeline_q_producer_state.index()));
-    }
-    ++pipeline_q_producer_state;
+    load_q(q1_index);
 
     // V1
     pipeline_kv.producer_acquire(pipeline_kv_producer_state);
     if (lane_predicate) {
       auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-      copy(params.tma_load_v.with(*tma_barrier, 0), tVgV(_, k_index), tVsV(_, pipeline_kv_producer_state.index()));
+      copy(params.tma_load_v.with(*tma_barrier, 0), tVgV_dkl(_, _0{}, k_tile, k_coord), tVsV(_, pipeline_kv_producer_state.index()));
     }
     ++pipeline_kv_producer_state;
-    k_index += 1;
+    k_index = mask.get_next_trip(blk_coord_in, k_index, TileShape{}, problem_shape);
 
     // loop:
     mask_tile_count -= 1;
     for (; mask_tile_count > 0; mask_tile_count -= 1) {
 
       // Ki
-      pipeline_kv.producer_acquire(pipeline_kv_producer_state);
-      if (lane_predicate) {
-        auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-        copy(params.tma_load_k.with(*tma_barrier, 0), tKgK(_, k_index), tKsK(_, pipeline_kv_producer_state.index()));
-      }
-      ++pipeline_kv_producer_state;
+      auto [ki_tile, ki_coord] = kv_coord(k_index);
+      load_k(k_index, ki_tile, ki_coord);
 
       // Vi
       pipeline_kv.producer_acquire(pipeline_kv_producer_state);
       if (lane_predicate) {
         auto tma_barrier = pipeline_kv.producer_get_barrier(pipeline_kv_producer_state);
-        copy(params.tma_load_v.with(*tma_barrier, 0), tVgV(_, k_index), tVsV(_, pipeline_kv_producer_state.index()));
+        copy(params.tma_load_v.with(*tma_barrier, 0), tVgV_dkl(_, _0{}, ki_tile, ki_coord), tVsV(_, pipeline_kv_producer_state.index()));
       }
       ++pipeline_kv_producer_state;
-      k_index += 1;
+      k_index = mask.get_next_trip(blk_coord_in, k_index, TileShape{}, problem_shape);
     }
   }
 };
@@ -72,6 +72,7 @@ struct Sm100MlaFwdMainloopTmaWarpspecialized {
   using StrideK = StrideK_;
   using StrideV = StrideV_;
   using Mask = Mask_;
+  static_assert(! Mask::kIsSoftCapping && ! Mask::kHasSink, "Soft-capping and sinks are only supported by the FMHA mainloop");
 
   static constexpr int StageCountQ = 2;
   static constexpr int StageCountK = 1;
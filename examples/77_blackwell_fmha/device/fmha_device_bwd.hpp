@@ -57,7 +57,8 @@ template<
     class ElementAccumulator,
     class TileShape,
     bool IsMla,
-    class Mask
+    class Mask,
+    bool IsDeterministic = false
 >
 class Sm100FmhaBwd {
 private:
@@ -123,6 +124,12 @@ public:
     ElementAccumulator softmax_scale;
 
     cutlass::KernelHardwareInfo hw_info;
+
+    // runtime state of the mask, e.g. the window of a LocalMaskForBackward
+    Mask mask = {};
+
+    // gradient of the sinks of an AttentionSink mask, one per query head, or nullptr to skip it
+    ElementAccumulator* ptr_dsink = nullptr;
   };
 
   using OperationSumOdO = cutlass::fmha::device::FMHA<
@@ -134,14 +141,14 @@ public:
 
   using OperationNormal= cutlass::fmha::device::FMHA<
       cutlass::fmha::kernel::Sm100FmhaBwdKernelTmaWarpSpecialized<
-          ProblemShape, Element, ElementAccumulator, TileShape, Mask
+          ProblemShape, Element, ElementAccumulator, TileShape, Mask, IsDeterministic
       >
   >;
 
   using ProblemShapeMLA = decltype(to_bwd_shape(ProblemShape{}));
   using OperationMla = cutlass::fmha::device::FMHA<
       cutlass::fmha::kernel::Sm100FmhaBwdMlaKernelTmaWarpSpecialized<
-          ProblemShapeMLA, Element, ElementAccumulator, TileShape, Mask
+          ProblemShapeMLA, Element, ElementAccumulator, TileShape, Mask, IsDeterministic
       >
   >;
 
@@ -155,11 +162,23 @@ public:
     OperationConvert op_convert;
     ElementAccumulator* dQ_acc;
     size_t dQ_acc_size;
+    ElementAccumulator* dsink;
+    size_t dsink_size;
   };
 
 private:
   Params params_;
 
+  // deterministic mode keeps one fp32 dQ partial per KV block instead of reducing into one
+  static int get_num_dQ_splits(Arguments const& args) {
+    if constexpr (IsDeterministic) {
+      return cute::ceil_div(static_cast<int>(get<1>(args.problem_shape)), int(get<1>(TileShape{})));
+    }
+    else {
+      return 1;
+    }
+  }
+
   static typename OperationSumOdO::Arguments to_sum_OdO_arguments(
         Arguments const& args,
         ElementAccumulator* sum_odo = nullptr,
@@ -173,6 +192,10 @@ private:
     auto stride_sum_OdO = make_stride(_1{}, make_stride(make_stride(Q, Q*H_R), B == 1 ? 0 : Q*H_R*H_K));
     auto stride_scaled_lse = make_stride(_1{}, make_stride(make_stride(Q, Q*H_R), B == 1 ? 0 : Q*H_R*H_K));
     auto log2_e = log2f(expf(1.0f));
+    const ElementAccumulator* ptr_sink = nullptr;
+    if constexpr (Mask::kHasSink) {
+      ptr_sink = args.mask.ptr_sink;
+    }
     return typename OperationSumOdO::Arguments {
       args.problem_shape,
       args.ptr_O, args.stride_O,
@@ -180,7 +203,8 @@ private:
       sum_odo, stride_sum_OdO,
       args.ptr_LSE, args.stride_LSE,
       scaled_lse, stride_scaled_lse,
-      -1.0f, -log2_e
+      -1.0f, -log2_e,
+      ptr_sink, ptr_sink != nullptr ? args.ptr_dsink : nullptr
     };
   }
 
@@ -191,7 +215,8 @@ private:
     auto [H_R, H_K] = H;
     D = cutlass::round_up(D, 8);  // Alignment
     int Q = cutlass::round_up(static_cast<int>(Q_), 8);  // Alignment
-    auto stride_src_dQ = make_stride(D, _1{}, make_stride(make_stride(D*Q, D*Q*H_R), B == 1 ? 0 : D*Q*H_R*H_K));
+    // the partials extend the batch mode, so it needs a real stride in deterministic mode
+    auto stride_src_dQ = make_stride(D, _1{}, make_stride(make_stride(D*Q, D*Q*H_R), (B == 1 && ! IsDeterministic) ? 0 : D*Q*H_R*H_K));
     return typename OperationConvert::Arguments {
       args.problem_shape,
       src, stride_src_dQ,
@@ -200,7 +225,9 @@ private:
       args.ptr_dQ, args.stride_dQ,
       nullptr, args.stride_dK,
       nullptr, args.stride_dV,
-      args.softmax_scale
+      args.softmax_scale,
+      get_num_dQ_splits(args),
+      static_cast<int64_t>(D) * Q * H_R * H_K * B
     };
   }
 
@@ -219,7 +246,8 @@ private:
         scaled_lse, to_bwd_stride(stride_scaled_lse),
         sum_OdO, to_bwd_stride(stride_sum_OdO),
         dQ_acc, to_bwd_stride(stride_dQ),
-        args.softmax_scale },
+        args.softmax_scale,
+        args.mask },
       { args.ptr_dK, to_bwd_stride(args.stride_dK),
         args.ptr_dV, to_bwd_stride(args.stride_dV) },
       args.hw_info
@@ -264,7 +292,7 @@ public:
     // scaled LSE vector
     workspace_bytes += B*H*Q * sizeof(ElementAccumulator);
     // FP32 versions of outputs that are churned (start off with Q only)
-    workspace_bytes += B*H*Q*D * sizeof(ElementAccumulator);
+    workspace_bytes += B*H*Q*D * get_num_dQ_splits(args) * sizeof(ElementAccumulator);
     return workspace_bytes;
   }
 
@@ -282,7 +310,9 @@ public:
     ElementAccumulator* scaled_lse = reinterpret_cast<ElementAccumulator*>(workspace_scaled_lse);
     ElementAccumulator* dQ_acc = reinterpret_cast<ElementAccumulator*>(workspace_dQ);
     params_.dQ_acc = dQ_acc;
-    params_.dQ_acc_size = B*H*Q*D * sizeof(ElementAccumulator);
+    params_.dQ_acc_size = B*H*Q*D * get_num_dQ_splits(args) * sizeof(ElementAccumulator);
+    params_.dsink = Mask::kHasSink ? args.ptr_dsink : nullptr;
+    params_.dsink_size = H * sizeof(ElementAccumulator);
     auto args_sum_OdO = to_sum_OdO_arguments(args, sum_OdO, scaled_lse);
     auto args_convert = to_convert_arguments(args, dQ_acc);
     params_.op_sum_OdO.initialize(args_sum_OdO, nullptr, stream);
@@ -323,6 +353,14 @@ public:
     CUTLASS_TRACE_HOST("FmhaDeviceBwd::run()");
 
     Status result = Status::kSuccess;
+    if (params.dsink != nullptr) {
+      // the sum_OdO kernel accumulates the sink gradient
+      auto cuda_result = cudaMemsetAsync(params.dsink, 0, params.dsink_size, stream);
+      if (cuda_result != cudaSuccess) {
+        return Status::kErrorInternal;
+      }
+    }
+
     result = params.op_sum_OdO.run(stream);
     if (result != Status::kSuccess) {
       return result;
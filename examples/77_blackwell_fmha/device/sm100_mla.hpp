@@ -106,7 +106,7 @@ private:
     return ReductionArguments{
       nullptr, args.epilogue.ptr_o, nullptr, args.epilogue.ptr_lse,
       args.mainloop.softmax_scale, B, args.split_kv, K, args.mainloop.ptr_seq, 
-      args.ptr_split_kv, Kernel::TileShapeS::value
+      args.ptr_split_kv, Kernel::TileShapeS::value, args.mainloop.q_tokens
     };
   }
 
@@ -117,14 +117,21 @@ public:
     return params_;
   }
 
+  // Picks the split count from batch, heads, kv length and sm count. The caller's
+  // is_fused_reduction is kept, and caps the split at half the sm count when set.
   static void set_split_kv (KernelArguments& args) {
     if (args.split_kv >= 1) return;
     auto [H, K, D, B] = args.problem_shape; 
     int sm_count = args.hw_info.sm_count;
-    int max_splits = ceil_div(K, 128);
-    int sms_per_batch = max(1, sm_count / B);
-    int split_heur = min(max_splits, sms_per_batch);
-    int waves = ceil_div(B * split_heur, sm_count);
+    // every (head tile, batch, split) work tile runs on one cluster
+    int cluster_count = max(1, sm_count / int(size(typename Kernel::ClusterShape{})));
+    int work_tiles = max(1, B * int(H / Kernel::TileShapeH::value));
+    int max_splits = ceil_div(K, Kernel::TileShapeS::value);
+    int split_heur = max(1, min(max_splits, cluster_count / work_tiles));
+    // grow the split until the last wave of clusters is full
+    int waves = ceil_div(work_tiles * split_heur, cluster_count);
+    split_heur = max(1, min(max_splits, waves * cluster_count / work_tiles));
+    // drop splits that would end up without k tiles
     int k_waves = ceil_div(max_splits, split_heur);
     int split_wave_aware = ceil_div(max_splits, k_waves);
     if (args.is_fused_reduction && split_wave_aware > 1) {
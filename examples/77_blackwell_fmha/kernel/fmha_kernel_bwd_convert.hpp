@@ -60,6 +60,10 @@ struct FmhaKernelBwdConvert {
     tuple<int, _1, tuple<tuple<_0, int>, int>> stride_dest_dV;
 
     ElementAcc scale = 1.0;
+
+    // number of dQ partials to sum in order (deterministic backward), and their stride
+    int num_splits_dQ = 1;
+    int64_t stride_split_dQ = 0;
   };
 
   using Params = Arguments;
@@ -103,7 +107,8 @@ struct FmhaKernelBwdConvert {
   }
 
   template<class StrideSrc, class StrideDest, class Count>
-  CUTLASS_DEVICE void copy(Params const& params, const ElementAcc* ptr_src, StrideSrc const& stride_src, Element* ptr_dest, StrideDest const& stride_dest, Count const& count, int d_dim) {
+  CUTLASS_DEVICE void copy(Params const& params, const ElementAcc* ptr_src, StrideSrc const& stride_src, Element* ptr_dest, StrideDest const& stride_dest, Count const& count, int d_dim,
+                           int num_splits = 1, int64_t stride_split = 0) {
     auto ptr_src_bh = ptr_src + get<2,0,0>(stride_src) * blockIdx.x + get<2,1>(stride_src) * blockIdx.y;
     auto ptr_dest_bh = ptr_dest + get<2,0,0>(stride_dest) * blockIdx.x + get<2,1>(stride_dest) * blockIdx.y;
 
@@ -128,6 +133,15 @@ struct FmhaKernelBwdConvert {
         using VecDest = uint_bit_t<sizeof_bits_v<Element> * kElementsPerLoad>;
         *reinterpret_cast<VecSrc*>(value_src) = *reinterpret_cast<const VecSrc*>(&ptr_src_bhs[idx_d]);
 
+        // fixed summation order over the partials keeps the result bitwise reproducible
+        for (int split = 1; split < num_splits; split++) {
+          ElementAcc value_split[kElementsPerLoad];
+          *reinterpret_cast<VecSrc*>(value_split) = *reinterpret_cast<const VecSrc*>(&ptr_src_bhs[idx_d + split * stride_split]);
+          for (int v = 0; v < kElementsPerLoad; v++) {
+            value_src[v] += value_split[v];
+          }
+        }
+
         for (int v = 0; v < kElementsPerLoad; v++) {
           value_dest[v] = static_cast<Element>(params.scale * value_src[v]);
         }
@@ -139,7 +153,8 @@ struct FmhaKernelBwdConvert {
 
   CUTLASS_DEVICE void operator()(const Params &params, char* smem) {
     if (params.ptr_src_dQ != nullptr) {
-      copy(params, params.ptr_src_dQ, params.stride_src_dQ, params.ptr_dest_dQ, params.stride_dest_dQ, get<0>(params.problem_shape), get<2>(params.problem_shape));
+      copy(params, params.ptr_src_dQ, params.stride_src_dQ, params.ptr_dest_dQ, params.stride_dest_dQ, get<0>(params.problem_shape), get<2>(params.problem_shape),
+           params.num_splits_dQ, params.stride_split_dQ);
     }
     if (params.ptr_src_dK != nullptr) {
       copy(params, params.ptr_src_dK, params.stride_src_dK, params.ptr_dest_dK, params.stride_dest_dK, get<1>(params.problem_shape), get<2>(params.problem_shape));
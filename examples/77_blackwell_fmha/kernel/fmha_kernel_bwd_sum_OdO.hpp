@@ -61,6 +61,11 @@ struct FmhaKernelBwdSumOdO {
 
     ElementAcc sum_odo_scale = 1.0;
     ElementAcc lse_scale = 1.0;
+
+    // attention sinks, one per query head, and their gradient -sum(exp(sink - lse) * sum(O*dO))
+    // over batch and rows, which is accumulated into
+    const ElementAcc* ptr_sink = nullptr;
+    ElementAcc* ptr_dsink = nullptr;
   };
 
   using Params = Arguments;
@@ -153,6 +158,10 @@ struct FmhaKernelBwdSumOdO {
         if (params.ptr_scaled_lse) {
           *ptr_scaled_lse_bhq = params.lse_scale * *ptr_lse_bhq;
         }
+        if (params.ptr_dsink) {
+          ElementAcc p_sink = expf(params.ptr_sink[blockIdx.y] - *ptr_lse_bhq);
+          atomicAdd(&params.ptr_dsink[blockIdx.y], -p_sink * acc);
+        }
       }
     }
   }
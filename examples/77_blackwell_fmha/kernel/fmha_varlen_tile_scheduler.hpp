@@ -0,0 +1,221 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/kernel_hardware_info.h"
+
+#include "collective/fmha_fusion.hpp"
+
+namespace cutlass::fmha::kernel {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Orders the batches of a variable length problem by decreasing K length and
+// writes the first work unit of each batch into `block_offset`.
+// `batch_order[r]` is the batch of rank r, `block_offset[r]` is the first
+// work unit of that batch, and `block_offset[num_batches]` the total work.
+template<class ProblemShape>
+__global__ void
+varlen_tile_scheduler_init_kernel(
+    ProblemShape problem_shape, int tile_m, int cluster_m,
+    int* batch_order, int* block_offset) {
+#if defined(__CUDA_ARCH__)
+  using namespace cute;
+  using cutlass::fmha::collective::apply_variable_length;
+
+  int num_heads = size<3,0>(problem_shape);
+  int num_batches = size<3,1>(problem_shape);
+
+  // Rank each batch by (K length, Q length) descending, ties keep batch order.
+  for (int i = threadIdx.x; i < num_batches; i += blockDim.x) {
+    auto shape_i = apply_variable_length(problem_shape, i);
+    int len_q_i = get<0>(shape_i);
+    int len_k_i = get<1>(shape_i);
+    int rank = 0;
+    for (int j = 0; j < num_batches; j++) {
+      auto shape_j = apply_variable_length(problem_shape, j);
+      int len_q_j = get<0>(shape_j);
+      int len_k_j = get<1>(shape_j);
+      bool before = len_k_j > len_k_i ||
+          (len_k_j == len_k_i && (len_q_j > len_q_i || (len_q_j == len_q_i && j < i)));
+      rank += before ? 1 : 0;
+    }
+    batch_order[rank] = i;
+  }
+  __syncthreads();
+
+  if (threadIdx.x == 0) {
+    int offset = 0;
+    for (int r = 0; r < num_batches; r++) {
+      block_offset[r] = offset;
+      int len_q = get<0>(apply_variable_length(problem_shape, batch_order[r]));
+      offset += cutlass::round_up(cutlass::ceil_div(len_q, tile_m), cluster_m) * num_heads;
+    }
+    block_offset[num_batches] = offset;
+  }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Persistent scheduler for variable length batches: the (head, q block) work
+// units of the batch with the longest K extent are handed out first, so that a
+// single long sequence starts early and the short ones fill in the remaining SMs.
+// Launch order: H Q B, with B sorted by decreasing K length and Q descending.
+struct VarlenPersistentTileScheduler {
+
+  struct Params {
+    int num_blocks;
+    int num_batches;
+    FastDivmod divmod_h;
+    int const* batch_order;
+    int const* block_offset;
+
+    KernelHardwareInfo hw_info;
+  };
+
+  int block_idx = 0;
+  int num_blocks = 0;
+  Params params;
+
+  CUTLASS_DEVICE
+  VarlenPersistentTileScheduler(Params const& params) : block_idx(blockIdx.x), params(params) {
+    num_blocks = params.block_offset[params.num_batches];
+  }
+
+  template<class ProblemSize>
+  static size_t get_workspace_size(ProblemSize const& problem_size) {
+    using namespace cute;
+    return sizeof(int) * (2 * size<3,1>(problem_size) + 1);
+  }
+
+  template<class ProblemSize, class ClusterShape, class TileShape>
+  static cutlass::Status initialize_workspace(
+      ProblemSize const& problem_size, ClusterShape const& cluster_shape,
+      TileShape const& tile_shape, void* workspace, cudaStream_t stream) {
+    using namespace cute;
+    if (workspace == nullptr) {
+      return cutlass::Status::kErrorWorkspaceNull;
+    }
+    int num_batches = size<3,1>(problem_size);
+    int* batch_order = reinterpret_cast<int*>(workspace);
+    int* block_offset = batch_order + num_batches;
+    varlen_tile_scheduler_init_kernel<<<1, 1024, 0, stream>>>(
+        problem_size, int(size<0>(tile_shape)), int(size<0>(cluster_shape)), batch_order, block_offset);
+    cudaError_t result = cudaGetLastError();
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  initialize_workspace(): kernel launch failed with error: " << cudaGetErrorString(result));
+      return cutlass::Status::kErrorInternal;
+    }
+    return cutlass::Status::kSuccess;
+  }
+
+  template<class ProblemSize, class ClusterShape, class TileShape>
+  static Params to_underlying_arguments(
+      ProblemSize const& problem_size, KernelHardwareInfo hw_info,
+      ClusterShape const& cluster_shape, TileShape const& tile_shape,
+      void* workspace) {
+    using namespace cute;
+    // Get SM count if needed, otherwise use user supplied SM count
+    int sm_count = hw_info.sm_count;
+    if (sm_count <= 0) {
+      CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
+          "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+
+    CUTLASS_TRACE_HOST("to_underlying_arguments(): Setting persistent grid SM count to " << sm_count);
+    hw_info.sm_count = sm_count;
+
+    // The exact number of work units is only known on the device, size the grid
+    // by the max Q extent and let the surplus CTAs exit immediately.
+    int num_batches = size<3,1>(problem_size);
+    int num_m_blocks = cutlass::round_up(ceil_div(size<0>(problem_size), size<0>(tile_shape)), size<0>(cluster_shape));
+    int num_blocks = num_m_blocks * size<3,0>(problem_size) * num_batches;
+
+    int const* batch_order = reinterpret_cast<int const*>(workspace);
+    return Params {
+      num_blocks, num_batches,
+      { size<3,0>(problem_size) },
+      batch_order, batch_order + num_batches,
+      hw_info
+    };
+  }
+
+  static dim3 get_grid_shape(Params const& params) {
+    dim3 grid(std::min(params.num_blocks, params.hw_info.sm_count), 1, 1);
+    return grid;
+  }
+
+  CUTLASS_DEVICE
+  bool is_valid() {
+    return block_idx < num_blocks;
+  }
+
+  CUTLASS_DEVICE
+  auto get_block_coord() {
+    using namespace cute;
+    // Find the batch rank r with block_offset[r] <= block_idx < block_offset[r+1]
+    int lo = 0;
+    int hi = params.num_batches - 1;
+    while (lo < hi) {
+      int mid = (lo + hi + 1) / 2;
+      if (params.block_offset[mid] <= block_idx) {
+        lo = mid;
+      }
+      else {
+        hi = mid - 1;
+      }
+    }
+    int block_begin = params.block_offset[lo];
+    int block_end = params.block_offset[lo + 1];
+    int bidb = params.batch_order[lo];
+
+    int m_block, bidh;
+    params.divmod_h(m_block, bidh, block_idx - block_begin);
+    int num_m_blocks = (block_end - block_begin) / params.divmod_h.divisor;
+    return make_coord(num_m_blocks - 1 - m_block, _0{}, make_coord(bidh, bidb));
+  }
+
+  CUTLASS_DEVICE
+  VarlenPersistentTileScheduler& operator++() {
+    block_idx += gridDim.x;
+    return *this;
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace cutlass::fmha::kernel
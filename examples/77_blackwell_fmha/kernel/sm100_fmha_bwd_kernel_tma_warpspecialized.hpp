@@ -56,7 +56,8 @@ template<
     class Element,
     class ElementAcc,
     class TileShape,
-    class Mask
+    class Mask,
+    bool IsDeterministic = false
 >
 struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
@@ -303,6 +304,9 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     TensorStride stride_dq_acc;
 
     ElementAcc softmax_scale = 1.0f / sqrtf(TileShapeDQK{});
+
+    // runtime state of the mask, e.g. the window of a LocalMaskForBackward
+    Mask mask = {};
   };
 
   using TMA_K = typename CollectiveMmaKQ::Params::TMA_A;
@@ -356,6 +360,16 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     if (D % Alignment != 0 || D_VO % Alignment != 0) {
       return false;
     }
+    if constexpr (Mask::kIsSoftCapping) {
+      if (args.mainloop.mask.soft_cap <= 0.0f) {
+        return false;
+      }
+    }
+    if constexpr (Mask::kHasSink) {
+      if (args.mainloop.mask.ptr_sink == nullptr) {
+        return false;
+      }
+    }
     return true;
   }
 
@@ -365,6 +379,36 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
   }
 
 
+  // In deterministic mode, each KV block reduces its dQ contribution into a zero-filled
+  // partial of its own, folded into the batch mode as (b + B * blk_k). Every element then
+  // sees a single add, and the convert kernel sums the partials in a fixed order.
+  // q tile visited after iter_index by the kv tile k_tile, only block sparse masks skip any
+  template<class ProblemShape_>
+  CUTLASS_DEVICE static int get_next_iter_index(
+      int iter_index, int k_tile,
+      MainloopArguments const& mainloop_args,
+      ProblemShape_ const& problem_shape) {
+
+    if constexpr (cutlass::fmha::collective::is_block_sparse_mask_v<Mask>) {
+      return mainloop_args.mask.get_next_q_trip(iter_index, k_tile, TileShapeQ{}, TileShapeK{}, problem_shape);
+    }
+    else {
+      return iter_index + 1;
+    }
+  }
+
+
+  template<class HBShape>
+  static auto dq_batch_shape(HBShape const& HB, int num_k_blocks) {
+    if constexpr (IsDeterministic) {
+      return replace<1>(HB, get<1>(HB) * num_k_blocks);
+    }
+    else {
+      return HB;
+    }
+  }
+
+
   static Params to_underlying_arguments(Arguments const& args, void*) {
     auto [Q_, K_, D, D_VO, HB] = args.problem_shape;
     int Q = Q_;
@@ -393,7 +437,9 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
     TMA_DQ tma_red_dq = make_tma_copy(
         SM90_TMA_REDUCE_ADD{},
-        make_tensor(args.mainloop.ptr_dq_acc, make_shape(Q_, D, HB), args.mainloop.stride_dq_acc),
+        make_tensor(args.mainloop.ptr_dq_acc,
+            make_shape(Q_, D, dq_batch_shape(HB, ceil_div(static_cast<int>(K_), int(TileShapeK{})))),
+            args.mainloop.stride_dq_acc),
         SmemLayoutDQ{}(_, _, _0{})
     );
 
@@ -593,7 +639,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     ++pipeline_load_compute_sum_odo_producer_state;
 
     iter_count -= 1;
-    iter_index += 1;
+    iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
 
     while (iter_count > 0) {
       if (iter_index == iter_end) {
@@ -662,7 +708,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
       ++pipeline_load_compute_sum_odo_producer_state;
 
       iter_count -= 1;
-      iter_index += 1;
+      iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
     }
   }
 
@@ -1215,6 +1261,8 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     Tensor tTR_cST_p = thread_t2r.partition_D(cST);
     Tensor tTR_cST   = split_wg(tTR_cST_p);
     Tensor tTR_rST = make_tensor<ElementAcc>(shape(tTR_cST));
+    // slope of the soft-capping of S, which dS is scaled by
+    Tensor tTR_rSlopeST = make_tensor<ElementAcc>(shape(tTR_cST));
     // Tensor tTR_tST_p = thread_t2r.partition_S(tSTtST);
     Tensor tTR_tST = split_wg(thread_t2r.partition_S(tSTtST));
 
@@ -1270,6 +1318,13 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
 
         leading_causal_masking = warp_uniform(!((q_left > kv_right) || (q_right < kv_left)));
       }
+      // banded and block sparse masks decide per tile, and cover the residual rows and columns
+      if constexpr (cutlass::fmha::collective::is_local_mask_v<Mask>) {
+        leading_causal_masking = warp_uniform(! mainloop_args.mask.is_unmasked_tile(
+            iter_index, get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape));
+      } else if constexpr (cutlass::fmha::collective::is_block_sparse_mask_v<Mask>) {
+        leading_causal_masking = true;
+      }
       bool trailing_residual_masking = false;
       if constexpr (std::is_base_of_v<cutlass::fmha::collective::ResidualMaskForBackward, Mask>) {
         trailing_residual_masking = warp_uniform((iter_index == iter_end - 1) || is_residual_k);
@@ -1280,8 +1335,16 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
         // compute P = softmax(S, LSE)
         cute::copy(tiled_t2r, tTR_tST, tTR_rST);
 
+        if constexpr (Mask::kIsSoftCapping) {
+          mainloop_args.mask.apply_soft_cap(tTR_rST, mainloop_args.softmax_scale);
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(tTR_rST); i++) {
+            tTR_rSlopeST(i) = mainloop_args.mask.soft_cap_slope(tTR_rST(i), mainloop_args.softmax_scale);
+          }
+        }
+
         if constexpr (decltype(is_masked_tile)::value) {
-          Mask{}.apply_mask(tTR_rST, [&](int i) {
+          mainloop_args.mask.apply_mask(tTR_rST, [&](int i) {
             auto c_transpose = tTR_cST(i);
             return make_coord(get<1>(c_transpose) + iter_index * TileShapeQ{}, get<0>(c_transpose) + get<1>(blk_coord) * TileShapeK{});
           }, problem_shape);
@@ -1358,6 +1421,12 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
         cute::add(dif, dpt, odo);
         float2 out;
         cute::mul(out, dif, st);
+        if constexpr (Mask::kIsSoftCapping) {
+          float2 slope;
+          slope.x = tTR_rSlopeST(i);
+          slope.y = tTR_rSlopeST(i+1);
+          cute::mul(out, out, slope);
+        }
         tTR_rDPT(i) = out.x;
         tTR_rDPT(i+1) = out.y;
       }
@@ -1392,7 +1461,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
       ++pipeline_load_compute_sum_odo_consumer_state;
 
       iter_count -= 1;
-      iter_index += 1;
+      iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
       if (iter_index == iter_end) {
         iter_index = iter_start;
       }
@@ -1432,7 +1501,14 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     auto tDQtDQ = partition_fragment_C(TiledMmaDSK{}, select<0,1>(TileShapeDSK{}))(make_coord(_,_),_0{},_0{});
     tDQtDQ.data() = TmemAllocation::kDQ;
 
-    Tensor mDQ = mainloop_params.tma_red_dq.get_tma_tensor(make_shape(Q, D, HB));
+    auto HB_dq = HB;
+    if constexpr (IsDeterministic) {
+      // one dQ partial per KV block, see dq_batch_shape
+      get<1>(HB_dq) = get<1>(HB) * int(gridDim.x);
+      get<1>(blk_coord_batch) += get<1>(HB) * get<1>(blk_coord);
+    }
+
+    Tensor mDQ = mainloop_params.tma_red_dq.get_tma_tensor(make_shape(Q, D, HB_dq));
     auto gDQ = local_tile(mDQ, TileShapeKQ{}, make_coord(_,_,_), Step<X, _1, _1>{})
         (_, _, _, _0{}, _);
 
@@ -1498,7 +1574,7 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
       }
 
       iter_count -= 1;
-      iter_index += 1;
+      iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
       if (iter_index == iter_end) {
         iter_index = iter_start;
         get<0,0>(blk_coord_batch) += 1;
@@ -1721,11 +1797,22 @@ struct Sm100FmhaBwdKernelTmaWarpSpecialized {
     } else if constexpr (std::is_base_of_v<cutlass::fmha::collective::CausalMask<false>, Mask>) {
       int offset = get<1>(problem_shape) - get<0>(problem_shape);
       iter_start = max(0, (int(get<1>(blk_coord) * TileShapeK{}) - offset) / (int)TileShapeQ{});
+    } else if constexpr (cutlass::fmha::collective::is_local_mask_v<Mask>) {
+      // q tiles outside of the band never see this kv tile
+      auto [q_trip_start, q_trip_end] = params.mainloop.mask.get_q_trip_range(
+          get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape);
+      iter_start = q_trip_start;
+      iter_end = q_trip_end;
     }
     if (get<1>(blk_coord) * TileShapeK{} >= get<1>(problem_shape)) {
       return;
     }
     int iter_count = (iter_end - iter_start) * get<4,0,0>(problem_shape);
+    if constexpr (cutlass::fmha::collective::is_block_sparse_mask_v<Mask>) {
+      // the q tiles are walked by get_next_iter_index, which returns iter_end past the last one
+      iter_start = params.mainloop.mask.get_next_q_trip(-1, get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape);
+      iter_count = params.mainloop.mask.get_q_trip_count(get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape) * get<4,0,0>(problem_shape);
+    }
 
     if (iter_count <= 0) {
       epilogue_clear(
@@ -56,7 +56,8 @@ template<
     class Element,
     class ElementAcc,
     class TileShape,
-    class Mask
+    class Mask,
+    bool IsDeterministic = false
 >
 struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
 
@@ -91,6 +92,8 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
 
   static constexpr int kLoadPerThread = TileShapeQ{} / NumThreadsPerWarp;
   static_assert(TileShapeQ{} % NumThreadsPerWarp == 0, "TileShapeQ must be divisible by NumThreadsPerWarp");
+  // sinks only enter through the LSE, soft-capping would change dS
+  static_assert(! Mask::kIsSoftCapping, "Soft-capping is only supported by the FMHA backward kernel");
   CUTLASS_DEVICE WarpRole warp_idx_to_role(int warp_idx) {
     return static_cast<WarpRole>((kWarpAssignment >> (4 * warp_idx)) & 0xF);
   }
@@ -307,6 +310,9 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
     TensorStride stride_dq_acc;
 
     ElementAcc softmax_scale = 1.0f / sqrtf(TileShapeDQK{});
+
+    // runtime state of the mask, e.g. the window of a LocalMaskForBackward
+    Mask mask = {};
   };
 
   using TMA_K = typename CollectiveMmaQK::Params::TMA_B;
@@ -368,6 +374,36 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
   }
 
 
+  // In deterministic mode, each KV block reduces its dQ contribution into a zero-filled
+  // partial of its own, folded into the batch mode as (b + B * blk_k). Every element then
+  // sees a single add, and the convert kernel sums the partials in a fixed order.
+  // q tile visited after iter_index by the kv tile k_tile, only block sparse masks skip any
+  template<class ProblemShape_>
+  CUTLASS_DEVICE static int get_next_iter_index(
+      int iter_index, int k_tile,
+      MainloopArguments const& mainloop_args,
+      ProblemShape_ const& problem_shape) {
+
+    if constexpr (cutlass::fmha::collective::is_block_sparse_mask_v<Mask>) {
+      return mainloop_args.mask.get_next_q_trip(iter_index, k_tile, TileShapeQ{}, TileShapeK{}, problem_shape);
+    }
+    else {
+      return iter_index + 1;
+    }
+  }
+
+
+  template<class HBShape>
+  static auto dq_batch_shape(HBShape const& HB, int num_k_blocks) {
+    if constexpr (IsDeterministic) {
+      return replace<1>(HB, get<1>(HB) * num_k_blocks);
+    }
+    else {
+      return HB;
+    }
+  }
+
+
   static Params to_underlying_arguments(Arguments const& args, void*) {
     auto [Q_, K_, D, D_VO, HB] = args.problem_shape;
     int Q = Q_;
@@ -396,7 +432,9 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
 
     TMA_DQ tma_red_dq = make_tma_copy(
         SM90_TMA_REDUCE_ADD{},
-        make_tensor(args.mainloop.ptr_dq_acc, make_shape(Q_, D, HB), args.mainloop.stride_dq_acc),
+        make_tensor(args.mainloop.ptr_dq_acc,
+            make_shape(Q_, D, dq_batch_shape(HB, ceil_div(static_cast<int>(K_), int(TileShapeK{})))),
+            args.mainloop.stride_dq_acc),
         SmemLayoutDQ{}(_, _, _0{})
     );
 
@@ -593,7 +631,7 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
     ++pipeline_load_compute_sum_odo_producer_state;
 
     iter_count -= 1;
-    iter_index += 1;
+    iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
 
     while (iter_count > 0) {
       pipeline_load_mma_q.producer_acquire(pipeline_load_mma_q_producer_state);
@@ -657,7 +695,7 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
       ++pipeline_load_compute_sum_odo_producer_state;
 
       iter_count -= 1;
-      iter_index += 1;
+      iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
     }
   }
 
@@ -1241,6 +1279,13 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
 
         leading_causal_masking = warp_uniform(!((q_left > kv_right) || (q_right < kv_left)));
       }
+      // banded and block sparse masks decide per tile, and cover the residual rows and columns
+      if constexpr (cutlass::fmha::collective::is_local_mask_v<Mask>) {
+        leading_causal_masking = warp_uniform(! mainloop_args.mask.is_unmasked_tile(
+            iter_index, get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape));
+      } else if constexpr (cutlass::fmha::collective::is_block_sparse_mask_v<Mask>) {
+        leading_causal_masking = true;
+      }
       bool trailing_residual_masking = false;
       if constexpr (std::is_base_of_v<cutlass::fmha::collective::ResidualMaskForBackward, Mask>) {
         trailing_residual_masking = warp_uniform((iter_index == last_iter) || is_residual_k);
@@ -1252,7 +1297,7 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
         cute::copy(tiled_t2r, tTR_tST, tTR_rST);
 
         if constexpr (decltype(is_masked_tile)::value) {
-          Mask{}.apply_mask(tTR_rST, [&](int i) {
+          mainloop_args.mask.apply_mask(tTR_rST, [&](int i) {
             auto c_transpose = tTR_cST(i);
             return make_coord(get<0>(c_transpose) + iter_index * TileShapeQ{}, get<1>(c_transpose) + get<1>(blk_coord) * TileShapeK{});
           }, problem_shape);
@@ -1372,7 +1417,7 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
       ++pipeline_load_compute_sum_odo_consumer_state;
 
       iter_count -= 1;
-      iter_index += 1;
+      iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
     }
 
     epilogue(
@@ -1407,7 +1452,14 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
     auto tDQtDQ = partition_fragment_C(TiledMmaDSK{}, select<0,1>(TileShapeDSK{}))(make_coord(_,_),_0{},_0{});
     tDQtDQ.data() = TmemAllocation::kDQ;
 
-    Tensor mDQ = mainloop_params.tma_red_dq.get_tma_tensor(make_shape(Q, D, HB));
+    auto HB_dq = HB;
+    if constexpr (IsDeterministic) {
+      // one dQ partial per KV block, see dq_batch_shape
+      get<1>(HB_dq) = get<1>(HB) * int(gridDim.x);
+      get<1>(blk_coord_batch) += get<1>(HB) * get<1>(blk_coord);
+    }
+
+    Tensor mDQ = mainloop_params.tma_red_dq.get_tma_tensor(make_shape(Q, D, HB_dq));
     auto gDQ = local_tile(mDQ, TileShapeQK{}, make_coord(_,_,_), Step<_1, X, _1>{})
         (_, _, _, _0{}, blk_coord_batch);
 
@@ -1474,7 +1526,7 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
       }
 
       iter_count -= 1;
-      iter_index += 1;
+      iter_index = get_next_iter_index(iter_index, get<1>(blk_coord), mainloop_args, problem_shape);
     }
   }
 
@@ -1693,11 +1745,22 @@ struct Sm100FmhaBwdMlaKernelTmaWarpSpecialized {
     } else if constexpr (std::is_base_of_v<cutlass::fmha::collective::CausalMask<false>, Mask>) {
       int offset = get<1>(problem_shape) - get<0>(problem_shape);
       iter_start = max(0, (int(get<1>(blk_coord) * TileShapeK{}) - offset) / (int)TileShapeQ{});
+    } else if constexpr (cutlass::fmha::collective::is_local_mask_v<Mask>) {
+      // q tiles outside of the band never see this kv tile
+      auto [q_trip_start, q_trip_end] = params.mainloop.mask.get_q_trip_range(
+          get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape);
+      iter_start = q_trip_start;
+      iter_count = q_trip_end;
     }
     if (get<1>(blk_coord) * TileShapeK{} >= get<1>(problem_shape)) {
       return;
     }
     iter_count -= iter_start;
+    if constexpr (cutlass::fmha::collective::is_block_sparse_mask_v<Mask>) {
+      // the q tiles are walked by get_next_iter_index
+      iter_start = params.mainloop.mask.get_next_q_trip(-1, get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape);
+      iter_count = params.mainloop.mask.get_q_trip_count(get<1>(blk_coord), TileShapeQ{}, TileShapeK{}, problem_shape);
+    }
 
     if (iter_count <= 0) {
       epilogue_clear(
@@ -40,6 +40,7 @@
 #include "kernel/fmha_options.hpp"
 #include "kernel/fmha_tile_scheduler.hpp"
 #include "kernel/fmha_causal_tile_scheduler.hpp"
+#include "kernel/fmha_varlen_tile_scheduler.hpp"
 #include "collective/fmha_fusion.hpp"
 #include "collective/fmha_common.hpp"
 
@@ -175,7 +176,8 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
       typename CollectiveEpilogue::TensorStorage epilogue;
     };
 
-    static constexpr bool IsPersistent = std::is_same_v<TileScheduler, PersistentTileScheduler> || std::is_same_v<TileScheduler, CausalPersistentTileScheduler>;
+    static constexpr bool IsPersistent = std::is_same_v<TileScheduler, PersistentTileScheduler> || std::is_same_v<TileScheduler, CausalPersistentTileScheduler> ||
+                                         std::is_same_v<TileScheduler, VarlenPersistentTileScheduler>;
     using MainloopEpilogueStorage = std::conditional_t<IsPersistent, 
                                                        std::conditional_t<IsMla, 
                                                                           std::conditional_t<CollectiveMainloop::IsOrderLoadEpilogue, UnionType, StructType>,
@@ -219,9 +221,25 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
   static const int MaxThreadsPerBlock = NumWarps * cutlass::NumThreadsPerWarp;
   using ArchTag = cutlass::arch::Sm100;
 
-  static size_t get_workspace_size(Arguments const& args) { return 0; }
-  static cutlass::Status initialize_workspace(Arguments const&, void*, cudaStream_t) {
-    return cutlass::Status::kSuccess;
+  // The varlen scheduler keeps its batch order in the workspace
+  static constexpr bool IsVarlenScheduler = std::is_same_v<TileScheduler, VarlenPersistentTileScheduler>;
+
+  static size_t get_workspace_size(Arguments const& args) {
+    if constexpr (IsVarlenScheduler) {
+      return TileScheduler::get_workspace_size(args.problem_shape);
+    }
+    else {
+      return 0;
+    }
+  }
+
+  static cutlass::Status initialize_workspace(Arguments const& args, void* workspace, cudaStream_t stream) {
+    if constexpr (IsVarlenScheduler) {
+      return TileScheduler::initialize_workspace(args.problem_shape, ClusterShape{}, TileShape{}, workspace, stream);
+    }
+    else {
+      return cutlass::Status::kSuccess;
+    }
   }
 
   static bool can_implement(Arguments const& args) {
@@ -237,12 +255,21 @@ struct Sm100FmhaFwdKernelTmaWarpspecialized {
     return block;
   }
 
+  static auto to_underlying_scheduler_arguments(Arguments const& args, void* workspace) {
+    if constexpr (IsVarlenScheduler) {
+      return TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, ClusterShape{}, TileShape{}, workspace);
+    }
+    else {
+      return TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, ClusterShape{}, TileShape{});
+    }
+  }
+
   static Params to_underlying_arguments(Arguments const& args, void* workspace) {
     return Params{
         args.problem_shape,
         CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
         CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, workspace),
-        TileScheduler::to_underlying_arguments(args.problem_shape, args.hw_info, ClusterShape{}, TileShape{})
+        to_underlying_scheduler_arguments(args, workspace)
     };
   }
 
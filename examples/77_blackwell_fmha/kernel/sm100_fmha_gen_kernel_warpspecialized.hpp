@@ -148,28 +148,43 @@ struct Sm100FmhaGenKernelWarpspecialized {
   using ElementOut = typename CollectiveMainloop::ElementOut;
 
   struct Arguments {
-    // _1, max_seqlen_k, head_dim, ((h_g, h_kv), b)
+    // q_tokens, max_seqlen_k, head_dim, ((h_g, h_kv), b)
+    // q_tokens is _1 for plain generation, or the number of query tokens per sequence
+    // (e.g. speculative decoding drafts), which are packed with h_g into the rows of a tile
     ProblemShapeIn problem_shape;
     const int* seqlen_kv;
     const int* cache_batch_idx;
 
-    const Element* ptr_q;  // 1 x D x (H x B)
+    const Element* ptr_q;  // Q_T x D x (H x B)
     StrideQOrig dQ;
-    const Element* ptr_new_k; // 1 x D x (H x B)
+    const Element* ptr_new_k; // Q_T x D x (H x B)
     StrideNewK dNewK;
-    const Element* ptr_new_v; // 1 x D x (H x B)
+    const Element* ptr_new_v; // Q_T x D x (H x B)
     StrideNewV dNewV;
     
     Element* ptr_cache_k;  // seqlen_max x D x (H x B)
     StrideCacheK dCacheK;
     Element* ptr_cache_v;  // seqlen_max x D x (H x B)
     StrideCacheV dCacheV;
-    ElementOut* ptr_o;     // 1 x D x (H x B)
+    ElementOut* ptr_o;     // Q_T x D x (H x B)
     StrideOOrig dO;
 
     cutlass::KernelHardwareInfo hw_info;
 
     ElementAcc scale_softmax = 0.0f;
+
+    // optional paged kv cache, the cache is then page_count x page_size x D x H
+    // and page i of cache batch b is ptr_page_table[b * stride_page_table + i]
+    const int* ptr_page_table = nullptr;
+    int stride_page_table = 0;
+    int page_size = 0;
+
+    // optional per KV head scales to dequantize the (new and cached) K and V
+    const float* ptr_scale_k = nullptr;
+    const float* ptr_scale_v = nullptr;
+
+    // e.g. MultiTokenMask to mask the query tokens among each other
+    typename CollectiveMainloop::Mask mask = {};
   };
 
   struct Params {
@@ -190,6 +205,15 @@ struct Sm100FmhaGenKernelWarpspecialized {
   }
 
   static bool can_implement(Arguments const& args) {
+    // each softmax warp owns 32 rows of the tile, which hold all query tokens of a kv head
+    if (get<0>(args.problem_shape) * get<3,0,0>(args.problem_shape) > NumWarpsSoftmax * cutlass::NumThreadsPerWarp) {
+      return false;
+    }
+    if (args.ptr_page_table != nullptr) {
+      return args.page_size > 0 &&
+          args.page_size % get<1>(typename CollectiveMainloop::TileShapeQK{}) == 0 &&
+          args.page_size % get<2>(typename CollectiveMainloop::TileShapePV{}) == 0;
+    }
     return true;
   }
 
@@ -204,10 +228,10 @@ struct Sm100FmhaGenKernelWarpspecialized {
 
   static Params to_underlying_arguments(Arguments const& args, void* workspace) {
     ProblemShape problem_shape = replace<0>(args.problem_shape, static_cast<int>(get<0>(args.problem_shape)));
-    CUTE_STATIC_ASSERT_V(get<0>(args.problem_shape) == _1{});
+    int num_tokens = get<0>(args.problem_shape);
     StrideQ dQ = replace<0>(args.dQ, 0);
     StrideO dO = replace<0>(args.dO, 0);
-    get<0>(problem_shape) = get<3,0,0>(args.problem_shape);
+    get<0>(problem_shape) = get<3,0,0>(args.problem_shape) * num_tokens;
     get<3,0,0>(problem_shape) = 1;
     get<0>(dQ) = get<2,0,0>(dQ);
     get<0>(dO) = get<2,0,0>(dO);
@@ -220,12 +244,18 @@ struct Sm100FmhaGenKernelWarpspecialized {
         args.ptr_new_v, args.dNewV,
         args.ptr_cache_k, args.dCacheK,
         args.ptr_cache_v, args.dCacheV,
+        args.ptr_page_table, args.stride_page_table, args.page_size
       },
       args.scale_softmax
     };
+    mainloop_args.load.num_tokens = num_tokens;
+    mainloop_args.load.stride_q_token = get<0>(args.dQ);
+    mainloop_args.ptr_scale_k = args.ptr_scale_k;
+    mainloop_args.ptr_scale_v = args.ptr_scale_v;
+    mainloop_args.mask = args.mask;
 
     typename CollectiveEpilogue::Arguments epilogue_args {
-      args.ptr_o, dO,
+      args.ptr_o, dO, num_tokens, get<0>(args.dO)
     };
 
     return Params{
@@ -241,7 +271,7 @@ struct Sm100FmhaGenKernelWarpspecialized {
     ProblemShape result = problem_shape;
     get<1>(result) = params.seqlen_kv[batch_idx];
     if (params.mainloop.load.ptr_new_k != nullptr) {
-      get<1>(result) += 1;
+      get<1>(result) += params.mainloop.load.num_tokens;
     }
     return result;
   }
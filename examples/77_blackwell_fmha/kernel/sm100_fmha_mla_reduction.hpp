@@ -67,13 +67,14 @@ struct Sm100FmhaMlaReductionKernel {
     int* ptr_seq = nullptr;
     int* ptr_split_kv = nullptr;
     int tile_shape_s = 128;
+    int q_tokens = 1;
   };
   using Params = Arguments;
 
   static Params to_underlying_arguments(Arguments const& args, void* workspace) {
     return {args.ptr_oaccum, args.ptr_o, args.ptr_lseaccum, args.ptr_lse, 
 	    args.scale, args.num_batches, args.split_kv, args.dim_k, args.ptr_seq, 
-	    args.ptr_split_kv, args.tile_shape_s};    
+	    args.ptr_split_kv, args.tile_shape_s, args.q_tokens};    
   }
 
   static size_t get_workspace_size(Arguments const& /*args*/) {
@@ -104,9 +105,15 @@ struct Sm100FmhaMlaReductionKernel {
 
     auto blk_coord = make_coord(blockIdx.x, _0{}, blockIdx.z);
 
-    auto dim_k = params.ptr_seq == nullptr ?  params.dim_k : params.ptr_seq[get<2>(blk_coord)];
+    auto dim_k = params.ptr_seq == nullptr ?  params.dim_k : params.ptr_seq[get<2>(blk_coord) / params.q_tokens];
+    dim_k -= params.q_tokens - 1 - get<2>(blk_coord) % params.q_tokens;
     auto local_split_kv = params.ptr_split_kv == nullptr ? params.split_kv : params.ptr_split_kv[get<2>(blk_coord)];
     auto k_tile_total = ceil_div(dim_k, params.tile_shape_s);
+    if (params.ptr_seq != nullptr && params.ptr_split_kv == nullptr) {
+      // matches the per row split of the mla kernel for variable sequence length
+      auto k_tile_per_split = ceil_div(ceil_div(params.dim_k, params.tile_shape_s), params.split_kv);
+      local_split_kv = max(1, min(params.split_kv, ceil_div(k_tile_total, k_tile_per_split)));
+    }
     auto k_tile_per_cta = ceil_div(k_tile_total, local_split_kv);
     local_split_kv = ceil_div(k_tile_total, k_tile_per_cta);
 
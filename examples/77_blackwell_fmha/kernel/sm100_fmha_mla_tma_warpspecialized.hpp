@@ -77,6 +77,8 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
   static const int MinBlocksPerMultiprocessor = 1;
   static const int TotalSNum = 2;
   static const int TotalPNum = 2;
+  // the fused split-kv reduction needs all splits of a batch resident at once
+  static const bool kIsPersistent = ! std::is_same_v<TileScheduler, Sm100MlaIndividualTileScheduler>;
   using ArchTag = cutlass::arch::Sm100;
 
   using ClusterShape = cute::conditional_t<kIs2Sm, Shape<_2, _1, _1>, Shape<_1, _1, _1>>;
@@ -269,6 +271,12 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     Stride<_1, int> stride_page_table = {};
     int page_count = 0;
     int page_size = TileShapeS{};  // powers of two if kIsCpAsync, otherwise TileShapeS
+
+    // prefill with absorbed weights straight from the latent cache: q_tokens query rows share
+    // each cached sequence, the batch mode of q, o and lse is (token, sequence) with the token
+    // fastest, while ptr_seq, the page table and the non-paged cache are indexed by sequence.
+    // The tokens are the last q_tokens keys of their sequence and attend causally.
+    int q_tokens = 1;
   };
   
   struct EpilogueArguments {
@@ -338,13 +346,38 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     bool is_fused_reduction = false;
   };
 
+  // number of keys visible to the query row batch_coord
+  CUTLASS_DEVICE static int get_seqlen(Params const& params, int batch_coord) {
+    int q_tokens = params.mainloop.q_tokens;
+    int seqlen = get<1>(params.problem_shape);
+    if (params.mainloop.ptr_seq != nullptr) {
+      seqlen = params.mainloop.ptr_seq[batch_coord / q_tokens];
+    }
+    return seqlen - (q_tokens - 1 - batch_coord % q_tokens);
+  }
+
+  // number of splits of the query row batch_coord; with variable sequence length and no
+  // explicit ptr_split_kv, shorter rows use fewer splits of the same k tile count as the
+  // longest one, so the splits of all rows finish at about the same time
+  CUTLASS_DEVICE static int get_split_kv(Params const& params, int batch_coord) {
+    if (params.mainloop.ptr_seq == nullptr) {
+      return params.split_kv;
+    }
+    if (params.ptr_split_kv != nullptr) {
+      return params.ptr_split_kv[batch_coord];
+    }
+    int k_tile_per_split = ceil_div(ceil_div(get<1>(params.problem_shape), TileShapeS{}), params.split_kv);
+    int k_tile_total = ceil_div(get_seqlen(params, batch_coord), TileShapeS{});
+    return max(1, min(params.split_kv, ceil_div(k_tile_total, k_tile_per_split)));
+  }
+
   static Params to_underlying_arguments(Arguments const& args, void* workspace) {
     //workspace = nullptr;  // let's get an error if one of these needs workspace
 
     auto [H, K, D, B] = args.problem_shape;
     auto [L, R] = D;
 
-    int paged_B = B;
+    int paged_B = B / args.mainloop.q_tokens;
     int paged_K = K;
     if (args.mainloop.ptr_page_table != nullptr) {
       paged_B = args.mainloop.page_count;
@@ -496,6 +529,14 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
       std::cerr << __FILE__ << "(" << __LINE__ << "): split-k off\n";
       return false;
     }
+    if (args.mainloop.q_tokens <= 0 || get<3>(args.problem_shape) % args.mainloop.q_tokens != 0) {
+      std::cerr << __FILE__ << "(" << __LINE__ << "): q tokens off\n";
+      return false;
+    }
+    if (args.mainloop.ptr_seq == nullptr && get<1>(args.problem_shape) < args.mainloop.q_tokens) {
+      std::cerr << __FILE__ << "(" << __LINE__ << "): q tokens exceed seqlen\n";
+      return false;
+    }
     if (args.is_fused_reduction && args.split_kv > 1) {
       if (2 * args.split_kv > args.hw_info.sm_count || 
       std::is_same_v<TileScheduler, Sm100MlaIndividualTileScheduler>) {
@@ -639,13 +680,8 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
         auto blk_coord = tile_scheduler.get_block_coord();
         auto problem_shape = params.problem_shape;
-	auto local_split_kv = params.split_kv;
-        if (params.mainloop.ptr_seq != nullptr) {
-          get<1>(problem_shape) = params.mainloop.ptr_seq[get<2>(blk_coord)];
-	  if (params.ptr_split_kv != nullptr) {
-            local_split_kv = params.ptr_split_kv[get<2>(blk_coord)];
-          }
-        }
+	auto local_split_kv = get_split_kv(params, get<2>(blk_coord));
+        get<1>(problem_shape) = get_seqlen(params, get<2>(blk_coord));
 	if (local_split_kv <= get<3>(blk_coord))
 	  continue;
         load_page_table(
@@ -664,13 +700,8 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
 	  auto problem_shape = params.problem_shape;
-	  auto local_split_kv = params.split_kv;
-          if (params.mainloop.ptr_seq != nullptr) {
-            get<1>(problem_shape) = params.mainloop.ptr_seq[get<2>(blk_coord)];
-	    if (params.ptr_split_kv != nullptr) {
-              local_split_kv = params.ptr_split_kv[get<2>(blk_coord)];
-            }
-          }
+	  auto local_split_kv = get_split_kv(params, get<2>(blk_coord));
+          get<1>(problem_shape) = get_seqlen(params, get<2>(blk_coord));
 	  if (local_split_kv <= get<3>(blk_coord))
             continue;
           load_cpasync(
@@ -693,13 +724,8 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
           for (; tile_scheduler.is_valid(); ++tile_scheduler) {
             auto blk_coord = tile_scheduler.get_block_coord();
 	    auto problem_shape = params.problem_shape;
-	    auto local_split_kv = params.split_kv;
-            if (params.mainloop.ptr_seq != nullptr) {
-              get<1>(problem_shape) = params.mainloop.ptr_seq[get<2>(blk_coord)];
-	      if (params.ptr_split_kv != nullptr) {
-	        local_split_kv = params.ptr_split_kv[get<2>(blk_coord)];
-	      }
-            }
+	    auto local_split_kv = get_split_kv(params, get<2>(blk_coord));
+            get<1>(problem_shape) = get_seqlen(params, get<2>(blk_coord));
 	    if (local_split_kv <= get<3>(blk_coord))
               continue;
             load_tma</* paged= */ true>(
@@ -720,13 +746,8 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
           for (; tile_scheduler.is_valid(); ++tile_scheduler) {
             auto blk_coord = tile_scheduler.get_block_coord();
 	    auto problem_shape = params.problem_shape;
-	    auto local_split_kv = params.split_kv;
-            if (params.mainloop.ptr_seq != nullptr) {
-              get<1>(problem_shape) = params.mainloop.ptr_seq[get<2>(blk_coord)];
-	      if (params.ptr_split_kv != nullptr) {
-                local_split_kv = params.ptr_split_kv[get<2>(blk_coord)];
-	      }
-            }
+	    auto local_split_kv = get_split_kv(params, get<2>(blk_coord));
+            get<1>(problem_shape) = get_seqlen(params, get<2>(blk_coord));
 	    if (local_split_kv <= get<3>(blk_coord))
               continue;
             load_tma<false>(
@@ -753,13 +774,8 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
         for (; tile_scheduler.is_valid(); ++tile_scheduler) {
           auto blk_coord = tile_scheduler.get_block_coord();
           auto problem_shape = params.problem_shape;
-	  auto local_split_kv = params.split_kv;
-          if (params.mainloop.ptr_seq != nullptr) {
-            get<1>(problem_shape) = params.mainloop.ptr_seq[get<2>(blk_coord)];
-            if (params.ptr_split_kv != nullptr) {
-                local_split_kv = params.ptr_split_kv[get<2>(blk_coord)];
-            }
-          }
+	  auto local_split_kv = get_split_kv(params, get<2>(blk_coord));
+          get<1>(problem_shape) = get_seqlen(params, get<2>(blk_coord));
 	  if (local_split_kv <= get<3>(blk_coord))
             continue;
           mma(blk_coord,
@@ -785,14 +801,8 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
       for (; tile_scheduler.is_valid(); ++tile_scheduler) {
         auto blk_coord = tile_scheduler.get_block_coord();
         auto problem_shape = params.problem_shape;
-	auto split_kv = params.split_kv;
-	auto local_split_kv = split_kv;
-        if (params.mainloop.ptr_seq != nullptr) {
-          get<1>(problem_shape) = params.mainloop.ptr_seq[get<2>(blk_coord)];
-	  if (params.ptr_split_kv != nullptr) {
-            local_split_kv = params.ptr_split_kv[get<2>(blk_coord)];
-          }
-        }
+	auto local_split_kv = get_split_kv(params, get<2>(blk_coord));
+        get<1>(problem_shape) = get_seqlen(params, get<2>(blk_coord));
 	if (local_split_kv <= get<3>(blk_coord))
           continue;
         compute(
@@ -831,12 +841,12 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
       typename PipelinePT::PipelineState& pipeline_pt_producer_state, int const& split_kv) {
 
     auto [H, K, D, B] = problem_shape;
-    int batch_coord = get<2>(blk_coord);
+    int cache_batch_coord = get<2>(blk_coord) / mainloop_args.q_tokens;
 
     auto mPT_l = make_tensor(make_gmem_ptr(mainloop_args.ptr_page_table), 
                             make_shape(mainloop_args.page_count, B), 
                             mainloop_args.stride_page_table);
-    auto mPT = mPT_l(_, batch_coord);
+    auto mPT = mPT_l(_, cache_batch_coord);
     
     int k_tile_total = ceil_div(K, TileShapeS{});
     int k_tile_per_cta = ceil_div(k_tile_total, split_kv);
@@ -924,7 +934,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     auto mPT_l = make_tensor(make_gmem_ptr(mainloop_args.ptr_page_table), make_shape(paged_B, B), mainloop_args.stride_page_table);
 
     int batch_coord = get<2>(blk_coord);
-    auto mPT = mPT_l(_, batch_coord);
+    auto mPT = mPT_l(_, batch_coord / mainloop_args.q_tokens);
 
     auto gQL = local_tile(mQL, TileShapeQK{}, make_coord(_,_,_), Step<_1, X, _1>{});
     auto gQR = local_tile(mQR, TileShapeQK{}, make_coord(_,_,_), Step<_1, X, _1>{});
@@ -1180,7 +1190,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     auto mQL = mainloop_params.tma_load_q_latent.get_tma_tensor(make_shape(H, D_latent, B));
     auto mQR = mainloop_params.tma_load_q_rope.get_tma_tensor(make_shape(H, D_rope, B));
 
-    int paged_B = B;
+    int paged_B = B / mainloop_args.q_tokens;
     int paged_K = K;
     if constexpr (kIsPaged) {
       paged_B = mainloop_args.page_count;
@@ -1241,7 +1251,9 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
     Tensor tQLgQL = tQLgQL_mkl(_, _, _, batch_coord);
     Tensor tQRgQR = tQRgQR_mkl(_, _, _, batch_coord);
 
-    auto mPT = mPT_l(_, batch_coord);
+    // the latent cache is shared by the q_tokens query rows of a sequence
+    int cache_batch_coord = batch_coord / mainloop_args.q_tokens;
+    auto mPT = mPT_l(_, cache_batch_coord);
 
     Tensor tCLgCL = tCLgCL_nkl(_, _, _, _);
     Tensor tKRgKR = tKRgKR_nkl(_, _, _, _);
@@ -1273,7 +1285,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
         else {
           cute::copy(
               mainloop_params.tma_load_c_latent.with(*tma_barrier, mcast_mask),
-              tCLgCL(_, k_index, i, batch_coord),
+              tCLgCL(_, k_index, i, cache_batch_coord),
               tKCsKC(_, pipeline_load_qk_producer_state.index()));
         }
       }
@@ -1300,7 +1312,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
         else {
           cute::copy(
               mainloop_params.tma_load_k_rope.with(*tma_barrier, mcast_mask),
-              tKRgKR(_, k_index, i, batch_coord),
+              tKRgKR(_, k_index, i, cache_batch_coord),
               tKCsKC(_, pipeline_load_qk_producer_state.index()));
         }
       }
@@ -1332,7 +1344,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
           else {
             cute::copy(
                 mainloop_params.tma_load_c_latent.with(*tma_barrier, mcast_mask),
-                tCLgCL(_, k_index, i, batch_coord),
+                tCLgCL(_, k_index, i, cache_batch_coord),
                 tKCsKC(_, pipeline_load_qk_producer_state.index()));
           }
         }
@@ -1355,7 +1367,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
           else {
             cute::copy(
                 mainloop_params.tma_load_k_rope.with(*tma_barrier, mcast_mask),
-                tKRgKR(_, k_index, i, batch_coord),
+                tKRgKR(_, k_index, i, cache_batch_coord),
                 tKCsKC(_, pipeline_load_qk_producer_state.index()));
           }
         }
@@ -1377,7 +1389,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
           else {
             cute::prefetch(
                 mainloop_params.tma_load_c_latent,
-                tCLgCL(_, k_index + kPrefetchDistance, i, batch_coord)
+                tCLgCL(_, k_index + kPrefetchDistance, i, cache_batch_coord)
             );
           }
         }
@@ -1396,7 +1408,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
           else {
             cute::prefetch(
                 mainloop_params.tma_load_k_rope,
-                tKRgKR(_, k_index + kPrefetchDistance, i, batch_coord)
+                tKRgKR(_, k_index + kPrefetchDistance, i, cache_batch_coord)
             );
           }
         }
@@ -1423,7 +1435,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
             else {
               cute::copy(
                   mainloop_params.tma_load_c_latent_transpose.with(*tma_barrier, mcast_mask, cute::TMA::CacheHintSm100::EVICT_FIRST),
-                  tCLTgCLT(_, j, IterationsPV_K * (k_index - 1) + i, batch_coord),
+                  tCLTgCLT(_, j, IterationsPV_K * (k_index - 1) + i, cache_batch_coord),
                   tVCsVC(_, pipeline_load_pv_producer_state.index())
               );
             }
@@ -1456,7 +1468,7 @@ struct Sm100FmhaMlaKernelTmaWarpspecialized {
           else {
             cute::copy(
                 mainloop_params.tma_load_c_latent_transpose.with(*tma_barrier, mcast_mask, cute::TMA::CacheHintSm100::EVICT_FIRST),
-                tCLTgCLT(_, j, IterationsPV_K * (k_index - 1) + i, batch_coord),
+                tCLTgCLT(_, j, IterationsPV_K * (k_index - 1) + i, cache_batch_coord),
                 tVCsVC(_, pipeline_load_pv_producer_state.index())
             );
           }
@@ -93,13 +93,18 @@ void __global__ fmha_bwd_reference_dQ_kernel(
           acc_doo += mDO(idx_Q, idx_D1, idx_L) * mO(idx_Q, idx_D1, idx_L);
         }
 
+        ElementAcc slope = 1;
+        if constexpr (Fusion::kIsSoftCapping) {
+          acc_qk = fusion.soft_cap / softmax_scale * tanhf(acc_qk * softmax_scale / fusion.soft_cap);
+          slope = fusion.soft_cap_slope(acc_qk, softmax_scale);
+        }
         auto id = make_identity_tensor(make_shape(1, 1));
         auto frag = make_tensor<ElementAcc>(Shape<_1, _1>{});
         frag(0) = acc_qk;
         fusion.apply_mask(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
         acc_qk = frag(0);
 
-        mS[idx_K] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * (acc_dov - acc_doo));
+        mS[idx_K] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, idx_L)) * softmax_scale * slope * (acc_dov - acc_doo));
       }  // for idx_K
 
       __syncthreads();
@@ -185,13 +190,18 @@ void __global__ fmha_bwd_reference_dK_kernel(
             acc_dov += rDO * rV;
             acc_doo += rDO * rO ;
           }
+          ElementAcc slope = 1;
+          if constexpr (Fusion::kIsSoftCapping) {
+            acc_qk = fusion.soft_cap / softmax_scale * tanhf(acc_qk * softmax_scale / fusion.soft_cap);
+            slope = fusion.soft_cap_slope(acc_qk, softmax_scale);
+          }
           auto id = make_identity_tensor(make_shape(1, 1));
           auto frag = make_tensor<ElementAcc>(Shape<_1, _1>{});
           frag(0) = acc_qk;
           fusion.apply_mask(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
           acc_qk = frag(0);
 
-          mS[idx_Q] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, coord_HB)) * softmax_scale * (acc_dov - acc_doo));
+          mS[idx_Q] = static_cast<Element>(expf(softmax_scale * acc_qk - mLSE(idx_Q, coord_HB)) * softmax_scale * slope * (acc_dov - acc_doo));
         }  // for idx_Q
 
         __syncthreads();
@@ -276,6 +286,9 @@ void __global__ fmha_bwd_reference_dV_kernel(
             acc_qk += rQ * rK;
           }  // for idx_D0
 
+          if constexpr (Fusion::kIsSoftCapping) {
+            acc_qk = fusion.soft_cap / softmax_scale * tanhf(acc_qk * softmax_scale / fusion.soft_cap);
+          }
           auto id = make_identity_tensor(make_shape(1, 1));
           auto frag = make_tensor<ElementAcc>(Shape<_1, _1>{});
           frag(0) = acc_qk;
@@ -430,6 +443,80 @@ void fmha_bwd_reference_dV(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+template<
+    class ProblemShape,
+    class TensorO, class TensorLSE, class TensorDO,
+    class Fusion
+>
+void __global__ fmha_bwd_reference_dsink_kernel(
+    ProblemShape problem_shape_in,
+    TensorO mO_in, TensorLSE mLSE_in, TensorDO mDO_in,
+    typename TensorLSE::value_type* ptr_dsink,
+    Fusion fusion) {
+
+  using namespace cute;
+
+  using ElementAcc = typename TensorLSE::value_type;
+
+  __shared__ ElementAcc partial[256];
+
+  auto [H, B] = get<4>(problem_shape_in);
+
+  // one block per query head, dsink = -sum(exp(sink - LSE) * sum(dO * O)) over batch and rows
+  int idx_H = blockIdx.x;
+  ElementAcc sink = fusion.ptr_sink[idx_H];
+  ElementAcc acc = 0;
+  for (int idx_B = 0; idx_B < B; idx_B++) {
+    auto coord_HB = make_coord(idx2crd(idx_H, H), idx_B);
+    auto [problem_shape, offset] = apply_variable_length_offset(
+        problem_shape_in,
+        make_coord(_0{}, _0{}, _0{}, _0{}, coord_HB)
+    );
+    auto mO = domain_offset(select<0,3,4>(offset), mO_in);
+    auto mLSE = domain_offset(select<0,4>(offset), mLSE_in);
+    auto mDO = domain_offset(select<0,3,4>(offset), mDO_in);
+    for (int idx_Q = threadIdx.x; idx_Q < size<0>(problem_shape); idx_Q += blockDim.x) {
+      ElementAcc acc_doo = 0;
+      for (int idx_D1 = 0; idx_D1 < size<3>(problem_shape); idx_D1++) {
+        acc_doo += mDO(idx_Q, idx_D1, coord_HB) * mO(idx_Q, idx_D1, coord_HB);
+      }
+      acc -= expf(sink - mLSE(idx_Q, coord_HB)) * acc_doo;
+    }
+  }
+
+  partial[threadIdx.x] = acc;
+  __syncthreads();
+  if (threadIdx.x == 0) {
+    for (int i = 1; i < blockDim.x; i++) {
+      acc += partial[i];
+    }
+    ptr_dsink[idx_H] = acc;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// gradient of the sinks of an AttentionSink fusion, one per query head
+template<
+    class ProblemShape,
+    class TensorO, class TensorLSE, class TensorDO,
+    class Fusion
+>
+void fmha_bwd_reference_dsink(
+    ProblemShape problem_shape,
+    TensorO mO, TensorLSE mLSE, TensorDO mDO,
+    typename TensorLSE::value_type* ptr_dsink,
+    Fusion fusion) {
+
+  using namespace cute;
+
+  dim3 grid(size<4,0>(problem_shape), 1, 1);
+  dim3 block(256);
+  fmha_bwd_reference_dsink_kernel<<<grid, block>>>(problem_shape, mO, mLSE, mDO, ptr_dsink, fusion);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<
     class ProblemShape,
     class TensorQ, class TensorK, class TensorV,
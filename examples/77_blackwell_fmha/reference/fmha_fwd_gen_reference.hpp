@@ -49,24 +49,28 @@ void __global__ fmha_fwd_gen_reference_kernel(
     ProblemShape problem_shape,
     const int* seqlen_kv, const int* cache_batch_idx, 
     TensorQ mQ, TensorNewK mNewK, TensorNewV mNewV,
-    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO) {
+    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO,
+    const uint32_t* tree_mask) {
 
   using namespace cute;
   extern __shared__ char mS_mem[];
   ElementAcc* mS = reinterpret_cast<ElementAcc*>(mS_mem);
 
   float scale = 1.0f / std::sqrt(float(get<2>(problem_shape)));
+  int num_tokens = get<0>(problem_shape);
 
   if (mNewK.data() != nullptr) {
     // 1. copy in new_k to cache
     for (int idx_h = blockIdx.x; idx_h < size<3,0,1>(problem_shape); idx_h += gridDim.x) {
       for (int idx_b = blockIdx.z; idx_b < size<3,1>(problem_shape); idx_b += gridDim.z) {
         int idx_b_kv = cache_batch_idx != nullptr ? cache_batch_idx[idx_b] : idx_b;
-        for (int idx_d = threadIdx.x; idx_d < size<2>(problem_shape); idx_d += blockDim.x) {
-          mCacheK(seqlen_kv[idx_b], idx_d, make_coord(make_coord(_0{}, idx_h), idx_b_kv)) =
-              mNewK(_0{}, idx_d, make_coord(make_coord(_0{}, idx_h), idx_b));
-          mCacheV(seqlen_kv[idx_b], idx_d, make_coord(make_coord(_0{}, idx_h), idx_b_kv)) =
-              mNewV(_0{}, idx_d, make_coord(make_coord(_0{}, idx_h), idx_b));
+        for (int idx_t = 0; idx_t < num_tokens; idx_t++) {
+          for (int idx_d = threadIdx.x; idx_d < size<2>(problem_shape); idx_d += blockDim.x) {
+            mCacheK(seqlen_kv[idx_b] + idx_t, idx_d, make_coord(make_coord(_0{}, idx_h), idx_b_kv)) =
+                mNewK(idx_t, idx_d, make_coord(make_coord(_0{}, idx_h), idx_b));
+            mCacheV(seqlen_kv[idx_b] + idx_t, idx_d, make_coord(make_coord(_0{}, idx_h), idx_b_kv)) =
+                mNewV(idx_t, idx_d, make_coord(make_coord(_0{}, idx_h), idx_b));
+          }
         }
       }
     }
@@ -77,79 +81,98 @@ void __global__ fmha_fwd_gen_reference_kernel(
     for (int idx_h_qo = blockIdx.y; idx_h_qo < size<3,0,0>(problem_shape); idx_h_qo += gridDim.y) {
       int idx_h = idx_h_qo + size<3,0,0>(problem_shape) * idx_h_kv;
       for (int idx_b = blockIdx.z; idx_b < size<3,1>(problem_shape); idx_b += gridDim.z) {
-        int idx_b_kv = cache_batch_idx != nullptr ? cache_batch_idx[idx_b] : idx_b;
-        const int kDim = 128;
-        ElementAcc reg_o[kDim] = {0};
-        ElementAcc row_max = -INFINITY;
-        ElementAcc row_sum = 0;
-        auto iteration = [&](auto const& tK, auto const& tV) {
-          ElementAcc reg_s = 0;
-          for (int idx_d = 0; idx_d < kDim; idx_d++) {
-            ElementAcc eQ = mQ(_0{}, idx_d, make_coord(idx_h, idx_b));
-            ElementAcc eK = tK(idx_d);
-            reg_s += eQ * eK;
+        for (int idx_t = 0; idx_t < num_tokens; idx_t++) {
+          int idx_b_kv = cache_batch_idx != nullptr ? cache_batch_idx[idx_b] : idx_b;
+          const int kDim = 128;
+          ElementAcc reg_o[kDim] = {0};
+          ElementAcc row_max = -INFINITY;
+          ElementAcc row_sum = 0;
+          auto iteration = [&](auto const& tK, auto const& tV) {
+            ElementAcc reg_s = 0;
+            for (int idx_d = 0; idx_d < kDim; idx_d++) {
+              ElementAcc eQ = mQ(idx_t, idx_d, make_coord(idx_h, idx_b));
+              ElementAcc eK = tK(idx_d);
+              reg_s += eQ * eK;
+            }
+
+            ElementAcc old_row_max = row_max;
+            row_max = std::max(row_max, reg_s);
+
+            ElementAcc adjustment = std::exp(scale * (old_row_max - row_max));
+            row_sum *= adjustment;
+            for (int idx_d = 0; idx_d < kDim; idx_d++) {
+              reg_o[idx_d] *= adjustment;
+            }
+
+            ElementAcc reg_p = std::exp(scale * (reg_s - row_max));
+            row_sum += reg_p;
+
+            for (int idx_d = 0; idx_d < kDim; idx_d++) {
+              ElementAcc eV = tV(idx_d);
+              reg_o[idx_d] += reg_p * eV;
+            }
+          };
+
+          // the query tokens are the last num_tokens keys, and see each other causally or through the tree mask
+          int seqlen = seqlen_kv[idx_b] + (mNewK.data() != nullptr ? num_tokens : 0);
+          auto is_visible = [&](int idx_s) {
+            int key_token = idx_s - (seqlen - num_tokens);
+            if (key_token < 0) {
+              return true;
+            }
+            return tree_mask != nullptr ? ((tree_mask[idx_t] >> key_token) & 1u) != 0 : key_token <= idx_t;
+          };
+
+          for (int idx_s = threadIdx.x; idx_s < seqlen_kv[idx_b]; idx_s += blockDim.x) {
+            if (is_visible(idx_s)) {
+              iteration(mCacheK(idx_s, _, make_coord(idx_h, idx_b_kv)), mCacheV(idx_s, _, make_coord(idx_h, idx_b_kv)));
+            }
           }
 
-          ElementAcc old_row_max = row_max;
-          row_max = std::max(row_max, reg_s);
+          if (mNewK.data() != nullptr && threadIdx.x == 0) {
+            for (int idx_n = 0; idx_n < num_tokens; idx_n++) {
+              if (is_visible(seqlen_kv[idx_b] + idx_n)) {
+                iteration(mNewK(idx_n, _, make_coord(idx_h, idx_b)), mNewV(idx_n, _, make_coord(idx_h, idx_b)));
+              }
+            }
+          }
+
+          mS[threadIdx.x] = row_max;
+          __syncthreads();
+          float old_row_max = row_max;
+          for (int i = 0; i < blockDim.x; i++) {
+            row_max = std::max(row_max, mS[i]);
+          }
+          __syncthreads();
 
           ElementAcc adjustment = std::exp(scale * (old_row_max - row_max));
           row_sum *= adjustment;
           for (int idx_d = 0; idx_d < kDim; idx_d++) {
             reg_o[idx_d] *= adjustment;
           }
+          mS[threadIdx.x] = row_sum;
+          __syncthreads();
 
-          ElementAcc reg_p = std::exp(scale * (reg_s - row_max));
-          row_sum += reg_p;
-
+          row_sum = 0;
+          for (int i = 0; i < blockDim.x; i++) {
+            row_sum += mS[i];
+          }
+          __syncthreads();
           for (int idx_d = 0; idx_d < kDim; idx_d++) {
-            ElementAcc eV = tV(idx_d);
-            reg_o[idx_d] += reg_p * eV;
+            mS[idx_d] = 0;
           }
-        };
-
-        for (int idx_s = threadIdx.x; idx_s < seqlen_kv[idx_b]; idx_s += blockDim.x) {
-          iteration(mCacheK(idx_s, _, make_coord(idx_h, idx_b_kv)), mCacheV(idx_s, _, make_coord(idx_h, idx_b_kv)));
-        }
-
-        if (mNewK.data() != nullptr && threadIdx.x == 0) {
-          iteration(mNewK(_0{}, _, make_coord(idx_h, idx_b)), mNewV(_0{}, _, make_coord(idx_h, idx_b)));
-        }
+          __syncthreads();
 
-        mS[threadIdx.x] = row_max;
-        __syncthreads();
-        float old_row_max = row_max;
-        for (int i = 0; i < blockDim.x; i++) {
-          row_max = std::max(row_max, mS[i]);
-        }
-        __syncthreads();
-
-        ElementAcc adjustment = std::exp(scale * (old_row_max - row_max));
-        row_sum *= adjustment;
-        for (int idx_d = 0; idx_d < kDim; idx_d++) {
-          reg_o[idx_d] *= adjustment;
-        }
-        mS[threadIdx.x] = row_sum;
-        __syncthreads();
-
-        row_sum = 0;
-        for (int i = 0; i < blockDim.x; i++) {
-          row_sum += mS[i];
-        }
-        __syncthreads();
-        for (int idx_d = 0; idx_d < kDim; idx_d++) {
-          mS[idx_d] = 0;
-        }
-        __syncthreads();
-
-        for (int idx_d = 0; idx_d < kDim; idx_d++) {
-          reg_o[idx_d] /= row_sum;
-          atomicAdd(&mS[idx_d], reg_o[idx_d]);
-        }
+          for (int idx_d = 0; idx_d < kDim; idx_d++) {
+            reg_o[idx_d] /= row_sum;
+            atomicAdd(&mS[idx_d], reg_o[idx_d]);
+          }
 
-        __syncthreads();
-        for (int idx_d = threadIdx.x; idx_d < kDim; idx_d += blockDim.x) {
-          mO(_0{}, idx_d, make_coord(idx_h, idx_b)) = static_cast<typename TensorO::value_type>(mS[idx_d]);
+          __syncthreads();
+          for (int idx_d = threadIdx.x; idx_d < kDim; idx_d += blockDim.x) {
+            mO(idx_t, idx_d, make_coord(idx_h, idx_b)) = static_cast<typename TensorO::value_type>(mS[idx_d]);
+          }
+          __syncthreads();
         }
       }
     }
@@ -170,7 +193,8 @@ void fmha_fwd_gen_reference(
     ProblemShape problem_shape,
     const int* seqlen_kv, const int* cache_batch_idx, 
     TensorQ mQ, TensorNewK mNewK, TensorNewV mNewV,
-    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO) {
+    TensorCacheK mCacheK, TensorCacheV mCacheV, TensorO mO,
+    const uint32_t* tree_mask = nullptr) {
 
   using namespace cute;
 
@@ -180,6 +204,6 @@ void fmha_fwd_gen_reference(
   assert(get<2>(problem_shape) == 128);
   fmha_fwd_gen_reference_kernel<ElementAcc><<<grid, block, shared_mem>>>(
       problem_shape, seqlen_kv, cache_batch_idx,
-      mQ, mNewK, mNewV, mCacheK, mCacheV, mO
+      mQ, mNewK, mNewV, mCacheK, mCacheV, mO, tree_mask
   );
 }
@@ -106,7 +106,11 @@ void __global__ fmha_reference_kernel(
         }
 
         if (threadIdx.x == 0 && mLSE.data() != nullptr) {
-          mLSE(idx_Q + offset_Q, idx_L) = -INFINITY;
+          ElementAccumulator lse = -INFINITY;
+          if constexpr (Mask::kHasSink) {
+            lse = mask.ptr_sink[idx_L % size<4,0>(problem_shape_in)];
+          }
+          mLSE(idx_Q + offset_Q, idx_L) = lse;
         }
         continue;
       }
@@ -118,6 +122,9 @@ void __global__ fmha_reference_kernel(
           ElementAccumulator eK = mK(idx_K + offset_K, idx_D, idx_L);
           acc += eQ * eK;
         }
+        if constexpr (Mask::kIsSoftCapping) {
+          acc = mask.soft_cap / softmax_scale * tanhf(acc * softmax_scale / mask.soft_cap);
+        }
         auto frag = make_tensor<ElementAccumulator>(Shape<_1, _1>{});
         frag(0) = acc;
         mask.apply_mask(frag, make_tensor(id.data() + make_arithmetic_tuple(idx_Q, idx_K), id.layout()), problem_shape);
@@ -144,6 +151,9 @@ void __global__ fmha_reference_kernel(
       for (int idx_K = 0; idx_K < size<1>(problem_shape); idx_K++) {
         sum += mS[idx_K];
       }
+      if constexpr (Mask::kHasSink) {
+        sum += expf(mask.ptr_sink[idx_L % size<4,0>(problem_shape_in)] - softmax_scale * maxS);
+      }
 
       ElementAccumulator scale = 1.0f / sum;
 
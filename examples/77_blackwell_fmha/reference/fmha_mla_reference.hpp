@@ -52,7 +52,7 @@ void __global__ fmha_mla_reference_kernel(
     TensorQL mQL, TensorQR mQR,
     TensorCL mCL, TensorKR mKR,
     TensorO mO, TensorLSE mLSE,
-    Scale softmax_scale) {
+    Scale softmax_scale, int q_tokens) {
 
   using namespace cute;
 
@@ -65,10 +65,12 @@ void __global__ fmha_mla_reference_kernel(
   extern __shared__ ElementAcc mS[];
   // ElementAcc* mS = reinterpret_cast<ElementAcc*>(mS_mem);
 
+  // q_tokens query rows share each cached sequence idx_S and see its last keys causally
+  int seqlen = K;
   for (int idx_B = blockIdx.y; idx_B < B; idx_B += gridDim.y) {
-    if (mSeq.data() != nullptr) {
-      K = mSeq(idx_B);
-    }
+    int idx_S = idx_B / q_tokens;
+    K = mSeq.data() != nullptr ? mSeq(idx_S) : seqlen;
+    K -= q_tokens - 1 - idx_B % q_tokens;
 
     for (int idx_H = blockIdx.x; idx_H < H; idx_H += gridDim.x) {
 
@@ -77,9 +79,9 @@ void __global__ fmha_mla_reference_kernel(
 
         for (int idx_D = 0; idx_D < D_latent; idx_D++) {
           int page_idx_K = idx_K;
-          int page_idx_B = idx_B;
+          int page_idx_B = idx_S;
           if (mPT.data() != nullptr) {
-            page_idx_B = mPT(idx_K / size<0>(mCL), idx_B); 
+            page_idx_B = mPT(idx_K / size<0>(mCL), idx_S); 
             page_idx_K = idx_K % size<0>(mCL);
           }
           ElementAcc eQ = mQL(idx_H, idx_D, idx_B);
@@ -89,9 +91,9 @@ void __global__ fmha_mla_reference_kernel(
 
         for (int idx_D = 0; idx_D < D_rope; idx_D++) {
           int page_idx_K = idx_K;
-          int page_idx_B = idx_B;
+          int page_idx_B = idx_S;
           if (mPT.data() != nullptr) {
-            page_idx_B = mPT(idx_K / size<0>(mCL), idx_B); 
+            page_idx_B = mPT(idx_K / size<0>(mCL), idx_S); 
             page_idx_K = idx_K % size<0>(mCL);
           }
           ElementAcc eQ = mQR(idx_H, idx_D, idx_B);
@@ -128,9 +130,9 @@ void __global__ fmha_mla_reference_kernel(
         ElementAcc acc = 0;
         for (int idx_K = 0; idx_K < K; idx_K++) {
           int page_idx_K = idx_K;
-          int page_idx_B = idx_B;
+          int page_idx_B = idx_S;
           if (mPT.data() != nullptr) {
-            page_idx_B = mPT(idx_K / size<0>(mCL), idx_B); 
+            page_idx_B = mPT(idx_K / size<0>(mCL), idx_S); 
             page_idx_K = idx_K % size<0>(mCL);
           }
           ElementAcc eV = mCL(page_idx_K, idx_D, page_idx_B);
@@ -168,7 +170,7 @@ void fmha_mla_reference(
     TensorQL mQL, TensorQR mQR,
     TensorCL mCL, TensorKR mKR,
     TensorO mO, TensorLSE mLSE,
-    Scale scale) {
+    Scale scale, int q_tokens = 1) {
 
   using namespace cute;
 
@@ -192,7 +194,7 @@ void fmha_mla_reference(
     }    
   }
   fmha_mla_reference_kernel<<<grid, block, shared_mem>>>(
-      problem_shape, mSeq, mPT, mQL, mQR, mCL, mKR, mO, mLSE, scale);
+      problem_shape, mSeq, mPT, mQL, mQR, mCL, mKR, mO, mLSE, scale, q_tokens);
   cudaDeviceSynchronize();
   result = cudaGetLastError();
   if (cudaSuccess != result) {
@@ -0,0 +1,73 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cute/tensor.hpp"
+#include "collective/fmha_rope.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class TensorIn, class TensorOut>
+void __global__ fmha_rope_reference_kernel(
+    cutlass::fmha::collective::Rope rope,
+    TensorIn mIn, TensorOut mOut, int pos_offset) {
+
+  using namespace cute;
+
+  int head_dim = size<1>(mIn);
+  for (int idx_L = blockIdx.y; idx_L < size<2>(mIn); idx_L += gridDim.y) {
+    for (int idx_S = blockIdx.x; idx_S < size<0>(mIn); idx_S += gridDim.x) {
+      for (int idx_D = threadIdx.x; idx_D < head_dim; idx_D += blockDim.x) {
+        float x = static_cast<float>(mIn(idx_S, idx_D, idx_L));
+        float y = static_cast<float>(mIn(idx_S, rope.partner(idx_D, head_dim), idx_L));
+        mOut(idx_S, idx_D, idx_L) = static_cast<typename TensorOut::value_type>(
+            rope.rotate(x, y, idx_S + pos_offset, idx_D, head_dim));
+      }
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// rotates the (seqlen, head_dim, batch) tensor mIn into mOut, row s sits at s + pos_offset
+template<class TensorIn, class TensorOut>
+void fmha_rope_reference(
+    cutlass::fmha::collective::Rope const& rope,
+    TensorIn mIn, TensorOut mOut, int pos_offset) {
+
+  using namespace cute;
+
+  dim3 grid(size<0>(mIn), size<2>(mIn), 1);
+  dim3 block(128);
+  fmha_rope_reference_kernel<<<grid, block>>>(rope, mIn, mOut, pos_offset);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
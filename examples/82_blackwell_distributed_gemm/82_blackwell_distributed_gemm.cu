@@ -145,6 +145,11 @@ static constexpr int TP_ = TP{};
 // * GEMM + Reduce Scatter:
 //   * ReduceScatter1D_TilingA_RotatingC
 //   * ReduceScatter1D_TilingB_RotatingC
+//
+// All Gather schedules wait on each memcpied slice before starting a stage by default. Wrapping
+// them in WithTileArrival copies slices in chunks, and has each CTA tile of the local GEMM wait
+// only on the chunk it reads, so that communication and compute overlap within stages, e.g.
+// WithTileArrival<AllGather1D_TilingCD_RotatingA<TP>, 4>. This requires --l=1.
 
 using DistSchedule = cutlass::distributed::schedules::AllGather1D_TilingCD_RotatingA<TP>;
 
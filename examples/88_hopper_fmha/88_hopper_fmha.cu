@@ -105,7 +105,7 @@ struct Options {
   bool help;
   bool error;
 
-  int b, h, q, k, d;
+  int b, h, h_k, q, k, d;
   int iterations;
   bool verify;
   bool verbose;
@@ -116,7 +116,7 @@ struct Options {
   Options():
     help(false),
     error(false),
-    b(16), h(16), q(1024), k(1024), d(128),
+    b(16), h(16), h_k(16), q(1024), k(1024), d(128),
     iterations(3), verify(false),
     causal(false), residual(false), bwd(false), verbose(false)
   { }
@@ -136,6 +136,13 @@ struct Options {
     cmd.get_cmd_line_argument("h", h, -1);
     if (h == -1) h = 2048 / d;
 
+    cmd.get_cmd_line_argument("h_k", h_k, h);
+    if (h_k <= 0 || h % h_k != 0) {
+      std::cerr << "H must be a multiple of H_K.\n";
+      error = true;
+      return;
+    }
+
     cmd.get_cmd_line_argument("q", q, -1);
     cmd.get_cmd_line_argument("k", k, -1);
     if (q == -1) q = k;
@@ -177,6 +184,7 @@ struct Options {
       << "  --help                      If specified, displays this usage statement\n\n"
       << "  --b=<int>                   Sets the B extent\n"
       << "  --h=<int>                   Sets the H extent\n"
+      << "  --h_k=<int>                 Sets the number of K/V heads for GQA (default H, backward only)\n"
       << "  --q=<int>                   Sets the Q extent\n"
       << "  --k=<int>                   Sets the K extent\n"
       << "  --d=<int>                   Sets the D extent\n"
@@ -218,6 +226,8 @@ struct ExampleResult {
   float runtime_ms = 0;
   double tflops_s = 0;
   size_t smem_size = 0;
+  double max_diff_O = 0;
+  double mean_diff_O = 0;
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -237,13 +247,19 @@ struct FwdRunner {
 #ifdef FP8
   using Element = cutlass::float_e4m3_t;
   using ElementAccumulatorQK = find_option_t<Tag::kAccQK, float, KernelOptions...>;
+  using ElementOut = cutlass::bfloat16_t;
 #else
   using Element = cutlass::half_t;
   using ElementAccumulatorQK = float;
+  using ElementOut = Element;
 #endif
 
   using ElementAccumulatorPV = float;
 
+  static constexpr bool kIsFp8 = sizeof(Element) == 1;
+  // fp8 inputs are quantized from fp32 data, the reference runs on their dequantized values
+  using ElementRef = std::conditional_t<kIsFp8, float, Element>;
+
   // B H Q K D
   using ProblemShapeType = cute::tuple<int, int, int, int, int>;
 
@@ -256,12 +272,17 @@ struct FwdRunner {
   using StrideO = cute::tuple<int, _1, cute::tuple<int, int>>; // Q D (B H)
   using StrideLSE = cute::tuple<_1, cute::tuple<int, int>>; // Q (B H)
 
-  using Operation = cutlass::device::Universal<
-    typename cutlass::fmha::kernel::FmhaBuilder<
+  using Builder = cutlass::fmha::kernel::FmhaBuilder<
       Element, ElementAccumulatorQK, ElementAccumulatorPV,
       TileShape, StrideQ, StrideK, StrideV,
-      ActiveFusion, DispatchPolicy, KernelOptions...
-    >::Kernel>;
+      ActiveFusion, DispatchPolicy, KernelOptions...,
+      Option<Tag::kElementOut, ElementOut>
+    >;
+
+  using Operation = cutlass::device::Universal<typename Builder::Kernel>;
+
+  using CollectiveMainloop = typename Builder::CollectiveMainloop;
+  using StrideDescale = cute::tuple<int, cute::tuple<int, int>>;  // block (B H)
 
   //
   // Data members
@@ -273,31 +294,49 @@ struct FwdRunner {
   StrideV stride_V;
   StrideO stride_O;
   StrideLSE stride_LSE;
+  StrideDescale stride_descale_Q;
+  StrideDescale stride_descale_K;
+  StrideDescale stride_descale_V;
   uint64_t seed = 0;
 
   cutlass::DeviceAllocation<Element> block_Q;
   cutlass::DeviceAllocation<Element> block_K;
   cutlass::DeviceAllocation<Element> block_V;
-  cutlass::DeviceAllocation<Element> block_O;
+  cutlass::DeviceAllocation<ElementOut> block_O;
   cutlass::DeviceAllocation<ElementAccumulatorPV> block_LSE;
-  cutlass::DeviceAllocation<Element> block_ref_O;
+  cutlass::DeviceAllocation<ElementRef> block_ref_O;
   cutlass::DeviceAllocation<ElementAccumulatorPV> block_ref_LSE;
 
+  // fp8 only
+  cutlass::DeviceAllocation<float> block_descale_Q;
+  cutlass::DeviceAllocation<float> block_descale_K;
+  cutlass::DeviceAllocation<float> block_descale_V;
+  cutlass::DeviceAllocation<float> block_ref_Q;
+  cutlass::DeviceAllocation<float> block_ref_K;
+  cutlass::DeviceAllocation<float> block_ref_V;
+
+  double max_diff_O = 0;
+  double mean_diff_O = 0;
+
   //
   // Methods
   //
   bool verify(const ProblemShapeType& problem_size) {
     auto [B, H, Q, K, D] = problem_size;
 
-    Tensor mQ = make_tensor(make_gmem_ptr(block_Q.get()),
+    auto ptr_Q = [&]() { if constexpr (kIsFp8) return block_ref_Q.get(); else return block_Q.get(); }();
+    auto ptr_K = [&]() { if constexpr (kIsFp8) return block_ref_K.get(); else return block_K.get(); }();
+    auto ptr_V = [&]() { if constexpr (kIsFp8) return block_ref_V.get(); else return block_V.get(); }();
+
+    Tensor mQ = make_tensor(make_gmem_ptr(ptr_Q),
       make_shape(Q, D, make_shape(B, H)),
       stride_Q);
 
-    Tensor mK = make_tensor(make_gmem_ptr(block_K.get()),
+    Tensor mK = make_tensor(make_gmem_ptr(ptr_K),
       make_shape(K, D, make_shape(B, H)),
       stride_K);
 
-    Tensor mV = make_tensor(make_gmem_ptr(block_V.get()),
+    Tensor mV = make_tensor(make_gmem_ptr(ptr_V),
       make_shape(K, D, make_shape(B, H)),
       stride_V);
 
@@ -324,6 +363,8 @@ struct FwdRunner {
     double max_diff = 0;
     double mean_diff = 0;
     reference_abs_diff(block_O, block_ref_O, max_diff, mean_diff);
+    max_diff_O = max_diff;
+    mean_diff_O = mean_diff;
     bool passed_O = (max_diff < kMaxDiffThresh) && (mean_diff < kMeanDiffThresh);
     if (! passed_O) {
       std::cerr << "failed O: max diff " << max_diff 
@@ -355,6 +396,64 @@ struct FwdRunner {
     stride = make_stride(_1{}, Q, make_stride(H*Q*D, Q*D));
   }
 
+  /// Quantizes fp32 data of shape (S, D, (B, H)) into fp8 with one descale factor per block of rows of
+  /// each head, and keeps the dequantized values as reference input
+  template<class Stride>
+  void quantize_fp8(
+      int B, int H, int S, int D, Stride const& stride, int block_rows, float quant_max, uint64_t seed_data,
+      cutlass::DeviceAllocation<Element>& block, cutlass::DeviceAllocation<float>& block_ref,
+      cutlass::DeviceAllocation<float>& block_descale, StrideDescale& stride_descale) {
+
+    cutlass::DeviceAllocation<float> block_data(block.size());
+    initialize_block(block_data, seed_data, false);
+    std::vector<float> data(block.size());
+    block_data.copy_to_host(data.data());
+
+    int num_blocks = cutlass::ceil_div(S, block_rows);
+    stride_descale = make_stride(1, make_stride(H * num_blocks, num_blocks));
+    std::vector<float> descale(size_t(B) * H * num_blocks);
+    std::vector<Element> quantized(block.size());
+    std::vector<float> dequantized(block.size());
+
+    Tensor mData = make_tensor(data.data(), make_shape(S, D, make_shape(B, H)), stride);
+    Tensor mQuantized = make_tensor(quantized.data(), make_shape(S, D, make_shape(B, H)), stride);
+    Tensor mDequantized = make_tensor(dequantized.data(), make_shape(S, D, make_shape(B, H)), stride);
+    Tensor mDescale = make_tensor(descale.data(), make_shape(num_blocks, make_shape(B, H)), stride_descale);
+
+    for (int b = 0; b < B; b++) {
+      for (int h = 0; h < H; h++) {
+        // spread the magnitudes of the heads, so per-head factors matter
+        float head_scale = std::exp2(float(h % 4) - 1.5f);
+        for (int blk = 0; blk < num_blocks; blk++) {
+          int s_begin = blk * block_rows;
+          int s_end = std::min(S, s_begin + block_rows);
+          float amax = 0;
+          for (int s = s_begin; s < s_end; s++) {
+            for (int d = 0; d < D; d++) {
+              mData(s, d, make_coord(b, h)) *= head_scale;
+              amax = std::max(amax, std::abs(mData(s, d, make_coord(b, h))));
+            }
+          }
+          float scale = amax > 0 ? amax / quant_max : 1.0f;
+          mDescale(blk, make_coord(b, h)) = scale;
+          for (int s = s_begin; s < s_end; s++) {
+            for (int d = 0; d < D; d++) {
+              Element q = static_cast<Element>(mData(s, d, make_coord(b, h)) / scale);
+              mQuantized(s, d, make_coord(b, h)) = q;
+              mDequantized(s, d, make_coord(b, h)) = static_cast<float>(q) * scale;
+            }
+          }
+        }
+      }
+    }
+
+    block.copy_from_host(quantized.data());
+    block_ref.reset(block.size());
+    block_ref.copy_from_host(dequantized.data());
+    block_descale.reset(descale.size());
+    block_descale.copy_from_host(descale.data());
+  }
+
   /// Initialize operands to be used in the GEMM and reference GEMM
   void initialize(const ProblemShapeType& problem_size) {
     auto [B, H, Q, K, D] = problem_size;
@@ -378,9 +477,21 @@ struct FwdRunner {
     block_ref_O.reset(size(shape_QO));
     block_ref_LSE.reset(size(shape_LSE));
 
-    initialize_block(block_Q, seed + 2023, false);
-    initialize_block(block_K, seed + 2022, false);
-    initialize_block(block_V, seed + 2021, false);
+    if constexpr (kIsFp8) {
+      // S = Q*K^T of full-range fp8 inputs would overflow an fp16 accumulator
+      float quant_max_qk = std::is_same_v<ElementAccumulatorQK, cutlass::half_t> ? 16.f : 448.f;
+      quantize_fp8(B, H, Q, D, stride_Q, CollectiveMainloop::kDescaleBlockQ, quant_max_qk, seed + 2023,
+          block_Q, block_ref_Q, block_descale_Q, stride_descale_Q);
+      quantize_fp8(B, H, K, D, stride_K, CollectiveMainloop::kDescaleBlockKV, quant_max_qk, seed + 2022,
+          block_K, block_ref_K, block_descale_K, stride_descale_K);
+      quantize_fp8(B, H, K, D, stride_V, CollectiveMainloop::kDescaleBlockKV, 448.f, seed + 2021,
+          block_V, block_ref_V, block_descale_V, stride_descale_V);
+    }
+    else {
+      initialize_block(block_Q, seed + 2023, false);
+      initialize_block(block_K, seed + 2022, false);
+      initialize_block(block_V, seed + 2021, false);
+    }
   }
 
   ExampleResult run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
@@ -398,6 +509,15 @@ struct FwdRunner {
       hw_info
     };
 
+    if constexpr (kIsFp8) {
+      arguments.mainloop.ptr_descale_Q = block_descale_Q.get();
+      arguments.mainloop.dDescaleQ = stride_descale_Q;
+      arguments.mainloop.ptr_descale_K = block_descale_K.get();
+      arguments.mainloop.dDescaleK = stride_descale_K;
+      arguments.mainloop.ptr_descale_V = block_descale_V.get();
+      arguments.mainloop.dDescaleV = stride_descale_V;
+    }
+
     Operation op;
 
     ExampleResult example_result;
@@ -516,6 +636,8 @@ struct FwdRunner {
     if (options.verify) {
       passed = verify(problem_size);
       if (passed) example_result.verified = true;
+      example_result.max_diff_O = max_diff_O;
+      example_result.mean_diff_O = mean_diff_O;
     }
     
     if (!passed) {
@@ -550,15 +672,15 @@ struct BwdRunner {
   
   // Just like forward
   using StrideQ = cute::tuple<int, int, int, _1>; // B H Q D
-  using StrideK = cute::tuple<int, int, int, _1>; // B H K D
-  using StrideV = cute::tuple<int, int, int, _1>; // B H K D
+  using StrideK = cute::tuple<int, int, int, _1>; // B H_K K D
+  using StrideV = cute::tuple<int, int, int, _1>; // B H_K K D
   using StrideO = cute::tuple<int, int, int, _1>; // B H Q D
   using StrideLSE = cute::tuple<int, int, _1>; // B H Q
 
   // Backwards specific
   using StrideDQ = cute::tuple<int, int, int, _1>; // B H Q D
-  using StrideDK = cute::tuple<int, int, int, _1>; // B H K D
-  using StrideDV = cute::tuple<int, int, int, _1>; // B H K D
+  using StrideDK = cute::tuple<int, int, int, _1>; // B H_K K D
+  using StrideDV = cute::tuple<int, int, int, _1>; // B H_K K D
   using StrideDO = cute::tuple<int, int, int, _1>; // B H Q D
 
   //
@@ -579,6 +701,9 @@ struct BwdRunner {
 
   uint64_t seed = 0;
 
+  // Number of K/V heads, each shared by H / H_K query heads
+  int h_k = 0;
+
   cutlass::DeviceAllocation<Element> block_Q;
   cutlass::DeviceAllocation<Element> block_K;
   cutlass::DeviceAllocation<Element> block_V;
@@ -594,9 +719,41 @@ struct BwdRunner {
   cutlass::DeviceAllocation<Element> block_ref_dK;
   cutlass::DeviceAllocation<Element> block_ref_dV;
 
+  // Per query head dK and dV of the reference, summed over each group into block_ref_dK, _dV
+  cutlass::DeviceAllocation<Element> block_ref_dK_full;
+  cutlass::DeviceAllocation<Element> block_ref_dV_full;
+
   //
   // Methods
   //
+
+  // Views K or V of B H_K K D as K D ((B, (H / H_K, H_K))), repeating each K/V head for its group
+  template<class Stride>
+  auto make_kv_view(Element* ptr, Stride const& stride, int B, int H, int K, int D) {
+    return make_tensor(make_gmem_ptr(ptr),
+      make_shape(K, D, make_shape(B, make_shape(H / h_k, h_k))),
+      make_stride(get<2>(stride), get<3>(stride), make_stride(get<0>(stride), make_stride(_0{}, get<1>(stride)))));
+  }
+
+  // Sums the per query head gradient full of B H K D over the query heads of each K/V head
+  void reduce_group(cutlass::DeviceAllocation<Element> const& full, cutlass::DeviceAllocation<Element>& out,
+      int B, int H, int K, int D) {
+    std::vector<Element> host_full(full.size());
+    full.copy_to_host(host_full.data());
+    std::vector<ElementAccumulator> host_acc(out.size(), ElementAccumulator(0));
+    int H_R = H / h_k;
+    for (int b = 0; b < B; b++) {
+      for (int h = 0; h < H; h++) {
+        for (size_t i = 0; i < size_t(K) * D; i++) {
+          host_acc[(size_t(b) * h_k + h / H_R) * K * D + i] +=
+            ElementAccumulator(host_full[(size_t(b) * H + h) * K * D + i]);
+        }
+      }
+    }
+    std::vector<Element> host_out(host_acc.begin(), host_acc.end());
+    out.copy_from_host(host_out.data());
+  }
+
   bool verify(const ProblemShapeType& problem_size) {
     auto [B, H, Q, K, D] = problem_size;
 
@@ -604,13 +761,9 @@ struct BwdRunner {
       make_shape(Q, D, make_shape(B, H)),
       make_stride(get<2>(stride_Q), get<3>(stride_Q), make_stride(get<0>(stride_Q), get<1>(stride_Q))));
 
-    Tensor mK = make_tensor(make_gmem_ptr(block_K.get()),
-      make_shape(K, D, make_shape(B, H)),
-      make_stride(get<2>(stride_K), get<3>(stride_K), make_stride(get<0>(stride_K), get<1>(stride_K))));
+    Tensor mK = make_kv_view(block_K.get(), stride_K, B, H, K, D);
 
-    Tensor mV = make_tensor(make_gmem_ptr(block_V.get()),
-      make_shape(K, D, make_shape(B, H)),
-      make_stride(get<2>(stride_V), get<3>(stride_V), make_stride(get<0>(stride_V), get<1>(stride_V))));
+    Tensor mV = make_kv_view(block_V.get(), stride_V, B, H, K, D);
 
     Tensor mO = make_tensor(make_gmem_ptr(block_O.get()),
       make_shape(Q, D, make_shape(B, H)),
@@ -624,13 +777,16 @@ struct BwdRunner {
       make_shape(Q, D, make_shape(B, H)),
       make_stride(get<2>(stride_dQ), get<3>(stride_dQ), make_stride(get<0>(stride_dQ), get<1>(stride_dQ))));
 
-    Tensor mDK = make_tensor(make_gmem_ptr(block_ref_dK.get()),
+    // The reference produces dK and dV per query head
+    auto stride_dKV_full = cute::compact_row_major(cute::make_shape(B, H, K, D));
+
+    Tensor mDK = make_tensor(make_gmem_ptr(block_ref_dK_full.get()),
       make_shape(K, D, make_shape(B, H)),
-      make_stride(get<2>(stride_dK), get<3>(stride_dK), make_stride(get<0>(stride_dK), get<1>(stride_dK))));
+      make_stride(get<2>(stride_dKV_full), get<3>(stride_dKV_full), make_stride(get<0>(stride_dKV_full), get<1>(stride_dKV_full))));
 
-    Tensor mDV = make_tensor(make_gmem_ptr(block_ref_dV.get()),
+    Tensor mDV = make_tensor(make_gmem_ptr(block_ref_dV_full.get()),
       make_shape(K, D, make_shape(B, H)),
-      make_stride(get<2>(stride_dV), get<3>(stride_dV), make_stride(get<0>(stride_dV), get<1>(stride_dV))));
+      make_stride(get<2>(stride_dKV_full), get<3>(stride_dKV_full), make_stride(get<0>(stride_dKV_full), get<1>(stride_dKV_full))));
 
     Tensor mDO = make_tensor(make_gmem_ptr(block_dO.get()),
       make_shape(Q, D, make_shape(B, H)),
@@ -645,6 +801,9 @@ struct BwdRunner {
       return false;
     }
 
+    reduce_group(block_ref_dK_full, block_ref_dK, B, H, K, D);
+    reduce_group(block_ref_dV_full, block_ref_dV, B, H, K, D);
+
     // Check if output from CUTLASS kernel and reference kernel are equal or not
     double max_diff = 0;
     double mean_diff = 0;
@@ -679,7 +838,7 @@ struct BwdRunner {
     Q = cutlass::round_up(Q, 8);  // Alignment
 
     auto shape_QO = cute::make_shape(B, H, Q, D);
-    auto shape_KV = cute::make_shape(B, H, K, D);
+    auto shape_KV = cute::make_shape(B, h_k, K, D);
     auto shape_LSE = cute::make_shape(B, H, Q);
 
     stride_Q = cute::compact_row_major(shape_QO);
@@ -707,6 +866,8 @@ struct BwdRunner {
     block_ref_dQ.reset(size(shape_QO));
     block_ref_dK.reset(size(shape_KV));
     block_ref_dV.reset(size(shape_KV));
+    block_ref_dK_full.reset(size(shape_KV) * (H / h_k));
+    block_ref_dV_full.reset(size(shape_KV) * (H / h_k));
 
     initialize_block(block_Q, seed + 2023, false);
     initialize_block(block_K, seed + 2022, false);
@@ -716,13 +877,9 @@ struct BwdRunner {
       make_shape(Q, D, make_shape(B, H)),
       make_stride(get<2>(stride_Q), get<3>(stride_Q), make_stride(get<0>(stride_Q), get<1>(stride_Q))));
 
-    Tensor mK = make_tensor(make_gmem_ptr(block_K.get()),
-      make_shape(K, D, make_shape(B, H)),
-      make_stride(get<2>(stride_K), get<3>(stride_K), make_stride(get<0>(stride_K), get<1>(stride_K))));
+    Tensor mK = make_kv_view(block_K.get(), stride_K, B, H, K, D);
 
-    Tensor mV = make_tensor(make_gmem_ptr(block_V.get()),
-      make_shape(K, D, make_shape(B, H)),
-      make_stride(get<2>(stride_V), get<3>(stride_V), make_stride(get<0>(stride_V), get<1>(stride_V))));
+    Tensor mV = make_kv_view(block_V.get(), stride_V, B, H, K, D);
 
     Tensor mO = make_tensor(make_gmem_ptr(block_O.get()),
       make_shape(Q, D, make_shape(B, H)),
@@ -737,6 +894,7 @@ struct BwdRunner {
 
   ExampleResult run(const Options& options, const cutlass::KernelHardwareInfo& hw_info) {
     ProblemShapeType problem_size = ProblemShapeType{options.b, options.h, options.q, options.k, options.d};
+    h_k = options.h_k;
 
     initialize(problem_size);
 
@@ -751,7 +909,8 @@ struct BwdRunner {
       block_dQ.get(), stride_dQ,
       block_dK.get(), stride_dK,
       block_dV.get(), stride_dV,
-      hw_info
+      hw_info,
+      h_k
     };
 
     Operation op;
@@ -900,6 +1059,10 @@ void print_result(const std::string& description, ExampleResult result, bool ver
   std::cout << std::setw(32) << std::left << description;
   std::cout.copyfmt(fmt);
   std::cout << " : " << result.tflops_s << " TFLOPS/s" << std::endl;
+  if (result.verified) {
+    std::cout << "       O vs reference: max abs diff=" << result.max_diff_O
+        << ", mean abs diff=" << result.mean_diff_O << std::endl;
+  }
   if (verbose) {
     std::cout << "       t=" << result.runtime_ms << "ms, "
         "smem=" << result.smem_size << "b" << std::endl;
@@ -943,6 +1106,13 @@ void run_fwd_64(Fusion fusion, Options const & options, cutlass::KernelHardwareI
   run(Shape< _64, _128, HeadDim>{}, KernelTma{}, "tma 64x128x64");
   run(Shape< _128, _64, HeadDim>{}, KernelCooperative{}, "tma ws cooperative 128x64x64");
   run(Shape< _128, _64, HeadDim>{}, KernelPingpong{}, "tma ws ping-pong 128x64x64");
+  if (options.k <= 256) {
+    // short sequences: the whole KV row is one tile, softmax is exact in a single pass
+    run(Shape< _128, _256, HeadDim>{}, KernelCooperative{}, "tma ws cooperative 128x256x64 single pass",
+        Option<Tag::kIsSinglePass, true_type>{}, Option<Tag::kStagesKV, _2>{});
+    run(Shape< _128, _256, HeadDim>{}, KernelPingpong{}, "tma ws ping-pong 128x256x64 single pass",
+        Option<Tag::kIsSinglePass, true_type>{}, Option<Tag::kStagesKV, _2>{});
+  }
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -963,6 +1133,16 @@ void run_fwd_128(Fusion fusion, Options const & options, cutlass::KernelHardware
   run(Shape<_128, _256, HeadDim>{}, KernelCooperative{}, "tma ws cooperative 128x256x128 acc fp32");
 #endif
   run(Shape<_128, _128, HeadDim>{}, KernelPingpong{}, "tma ws ping-pong 128x128x128");
+  if (options.k <= 128) {
+    run(Shape<_128, _128, HeadDim>{}, KernelPingpong{}, "tma ws ping-pong 128x128x128 single pass",
+        Option<Tag::kIsSinglePass, true_type>{}, Option<Tag::kStagesKV, _2>{});
+  }
+#ifdef FP8
+  if (options.k <= 256) {
+    run(Shape<_128, _256, HeadDim>{}, KernelCooperative{}, "tma ws cooperative 128x256x128 single pass",
+        Option<Tag::kIsSinglePass, true_type>{}, Option<Tag::kStagesKV, _2>{});
+  }
+#endif
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1081,6 +1261,11 @@ int main_single(int argc, char const **args) {
     return -1;
   }
 
+  if (! options.bwd && options.h_k != options.h) {
+    std::cout << "Grouped K/V heads (--h_k) are only implemented for backward." << std::endl;
+    return 0;
+  }
+
 #if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
 
   //
@@ -1097,6 +1282,9 @@ int main_single(int argc, char const **args) {
   hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
 
   std::cout << "###### B " << options.b << " H " << options.h << " Q " << options.q << " K " << options.k << " D " << options.d << " ";
+  if (options.h_k != options.h) {
+    std::cout << "H_K " << options.h_k << " ";
+  }
   std::cout << (options.bwd ? "Backward" : "Forward") << " " << (options.causal ? "Causal" : "Full") << " ";
   std::cout << "#SM " << hw_info.sm_count << std::endl;
 
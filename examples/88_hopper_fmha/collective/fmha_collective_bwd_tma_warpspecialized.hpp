@@ -224,6 +224,10 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
 
     ElementAccumulator* ptr_dQ;
     cute::tuple<int, int, int, _1> dDQ;
+
+    // Query heads per K/V head. The problem size counts K/V heads, and the CTA of each
+    // K/V head walks the query heads of its group, so dK and dV are reduced in registers.
+    int h_r = 1;
   };
 
   using TMA_Q = typename CollectiveMmaNM::Params::TMA_B;
@@ -297,6 +301,8 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
 
     float scale_softmax;
     float scale_softmax_log2;
+
+    int h_r;
   };
 
   static_assert(size(TiledMmaNM{}) == size(TiledMmaND{}));
@@ -305,6 +311,7 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
   template<class ProblemShape>
   static bool can_implement(ProblemShape const& problem_size, Arguments const& args) {
     return true
+      && (args.h_r >= 1)
       && (get<4>(problem_size) <= get<2>(TileShape{}))
       && ((get<4>(problem_size) % Alignment) == 0)
       && ((get<2>(problem_size) % Alignment) == 0)
@@ -313,42 +320,64 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
 
   template<class ProblemShape>
   static Params to_underlying_arguments(ProblemShape const& problem_size, Arguments const& args, void* workspace) {
+    // K and V span the K/V heads of problem_size, the query side tensors all query heads
+    auto problem_size_q = get_problem_size_q(problem_size, args.h_r);
     auto problem_shape_nm = make_shape(get<3>(problem_size), get<2>(problem_size), get<4>(problem_size), make_shape(get<0>(problem_size), get<1>(problem_size)));
+    auto problem_shape_nm_q = make_shape(get<3>(problem_size), get<2>(problem_size), get<4>(problem_size), make_shape(get<0>(problem_size), get<1>(problem_size_q)));
 
     auto dK = make_stride(get<2>(args.dK), get<3>(args.dK), make_stride(get<0>(args.dK), get<1>(args.dK)));
     auto dQ = make_stride(get<2>(args.dQ), get<3>(args.dQ), make_stride(get<0>(args.dQ), get<1>(args.dQ)));
-    auto params_nm_kq = CollectiveMmaNM::to_underlying_arguments(problem_shape_nm,
-        typename CollectiveMmaNM::Arguments {
-            args.ptr_K, dK,
-            args.ptr_Q, dQ,
-        }, /*workspace=*/ nullptr);
+    typename CollectiveMmaNM::Arguments args_nm_kq{
+        args.ptr_K, dK,
+        args.ptr_Q, dQ,
+    };
+    auto params_nm_k = CollectiveMmaNM::to_underlying_arguments(problem_shape_nm, args_nm_kq, /*workspace=*/ nullptr);
+    auto params_nm_q = CollectiveMmaNM::to_underlying_arguments(problem_shape_nm_q, args_nm_kq, /*workspace=*/ nullptr);
 
     auto dV = make_stride(get<2>(args.dV), get<3>(args.dV), make_stride(get<0>(args.dV), get<1>(args.dV)));
     auto dDO = make_stride(get<2>(args.dDO), get<3>(args.dDO), make_stride(get<0>(args.dDO), get<1>(args.dDO)));
-    auto params_nm_vdo = CollectiveMmaNM::to_underlying_arguments(problem_shape_nm,
-        typename CollectiveMmaNM::Arguments {
-            args.ptr_V, dV,
-            args.ptr_dO, dDO,
-        }, /*workspace=*/ nullptr);
+    typename CollectiveMmaNM::Arguments args_nm_vdo{
+        args.ptr_V, dV,
+        args.ptr_dO, dDO,
+    };
+    auto params_nm_v = CollectiveMmaNM::to_underlying_arguments(problem_shape_nm, args_nm_vdo, /*workspace=*/ nullptr);
+    auto params_nm_do = CollectiveMmaNM::to_underlying_arguments(problem_shape_nm_q, args_nm_vdo, /*workspace=*/ nullptr);
 
 
-    TMA_LSE tma_load_lse = make_tma_copy(SM90_TMA_LOAD{}, make_tensor(args.ptr_LSE, select<2,0,1>(problem_size), select<2,0,1>(args.dLSE)), SmemLayoutLSE{}(_,_0{}));
-    TMA_ODO tma_load_odo = make_tma_copy(SM90_TMA_LOAD{}, make_tensor(args.ptr_sum_OdO, select<2,0,1>(problem_size), select<2,0,1>(args.dSumOdO)), SmemLayoutLSE{}(_,_0{}));
+    TMA_LSE tma_load_lse = make_tma_copy(SM90_TMA_LOAD{}, make_tensor(args.ptr_LSE, select<2,0,1>(problem_size_q), select<2,0,1>(args.dLSE)), SmemLayoutLSE{}(_,_0{}));
+    TMA_ODO tma_load_odo = make_tma_copy(SM90_TMA_LOAD{}, make_tensor(args.ptr_sum_OdO, select<2,0,1>(problem_size_q), select<2,0,1>(args.dSumOdO)), SmemLayoutLSE{}(_,_0{}));
 
-    TMA_DQ tma_red_dq = make_tma_copy(SM90_TMA_REDUCE_ADD{}, make_tensor(args.ptr_dQ, select<2,4,0,1>(problem_size), select<2,3,0,1>(args.dDQ)), SmemLayoutDQ{}(_,_,_0{}));
+    TMA_DQ tma_red_dq = make_tma_copy(SM90_TMA_REDUCE_ADD{}, make_tensor(args.ptr_dQ, select<2,4,0,1>(problem_size_q), select<2,3,0,1>(args.dDQ)), SmemLayoutDQ{}(_,_,_0{}));
 
     return Params{
-        params_nm_kq.tma_load_b,
-        params_nm_kq.tma_load_a,
-        params_nm_vdo.tma_load_a,
-        params_nm_vdo.tma_load_b,
+        params_nm_q.tma_load_b,
+        params_nm_k.tma_load_a,
+        params_nm_v.tma_load_a,
+        params_nm_do.tma_load_b,
         tma_load_lse, tma_load_odo,
         tma_red_dq,
         1.0f / (float) std::sqrt(get<4>(problem_size)),
-        (float) (std::log2(std::exp(1.0)) / std::sqrt(get<4>(problem_size)))
+        (float) (std::log2(std::exp(1.0)) / std::sqrt(get<4>(problem_size))),
+        args.h_r
     };
   }
 
+  // The problem size over query heads, given the one over K/V heads
+  template<class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static auto get_problem_size_q(ProblemShape const& problem_size, int h_r) {
+    return make_shape(get<0>(problem_size), get<1>(problem_size) * h_r,
+        get<2>(problem_size), get<3>(problem_size), get<4>(problem_size));
+  }
+
+  // The block coordinate of query head r of the group of the K/V head in blk_coord
+  template<class BlkCoord>
+  CUTLASS_DEVICE
+  static auto get_blk_coord_q(BlkCoord const& blk_coord, int h_r, int r) {
+    return make_coord(get<0>(blk_coord), get<1>(blk_coord),
+        make_coord(get<2,0>(blk_coord), get<2,1>(blk_coord) * h_r + r));
+  }
+
   template<class BlkCoord, class ProblemSize>
   CUTLASS_DEVICE
   auto
@@ -380,21 +409,26 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
     // K0    V0 K1     V1
     //    Q0       DO0    Q1 DO1 Q2 DO2 ...
     // K0 Q0 V0 K1 DO0 V1 ...
+    // and with GQA the Q, DO tiles of the query heads of the group follow one another.
     int lane_predicate = cute::elect_one_sync();
 
     int outer_tile_count = NumMmaWarpGroups;
-    int inner_tile_count = get_inner_tile_count(blk_coord, problem_size);
+    int inner_tile_count_per_head = get_inner_tile_count(blk_coord, problem_size);
+    int inner_tile_count = inner_tile_count_per_head;
 
     auto outer_tile_iter = cute::make_coord_iterator(outer_tile_count);
     auto inner_tile_iter = cute::make_coord_iterator(inner_tile_count);
 
     uint16_t mcast_mask_b = 0;
+
+    auto problem_size_q = get_problem_size_q(problem_size, params.h_r);
+    auto blk_coord_q = get_blk_coord_q(blk_coord, params.h_r, 0);
     
     LoadQ load_q{params.tma_load_q, pipeline_inner, storage.smem_q};
-    auto load_state_q = load_q.init_state(block_rank_in_cluster, problem_size, TileShapeNM{}, blk_coord, inner_tile_count);
+    auto load_state_q = load_q.init_state(block_rank_in_cluster, problem_size_q, TileShapeNM{}, blk_coord_q, inner_tile_count);
 
     LoadDO load_do{params.tma_load_do, pipeline_inner, storage.smem_do};
-    auto load_state_do = load_do.init_state(block_rank_in_cluster, problem_size, TileShapeNM{}, blk_coord, inner_tile_count);
+    auto load_state_do = load_do.init_state(block_rank_in_cluster, problem_size_q, TileShapeNM{}, blk_coord_q, inner_tile_count);
 
     LoadK load_k{params.tma_load_k, pipeline_outer, storage.smem_k};
     auto load_state_k = load_k.init_state(_0{}, problem_size, TileShapeNM{}, blk_coord, outer_tile_count);
@@ -403,10 +437,10 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
     auto load_state_v = load_v.init_state(_0{}, problem_size, TileShapeNM{}, blk_coord, outer_tile_count);
 
     LoadLSE load_lse{params.tma_load_lse, pipeline_inner, storage.smem_lse};
-    auto load_state_lse = load_lse.init_state(_0{}, problem_size, TileShapeNM{}, blk_coord, outer_tile_count);
+    auto load_state_lse = load_lse.init_state(_0{}, problem_size_q, TileShapeNM{}, blk_coord_q, outer_tile_count);
 
     LoadODO load_odo{params.tma_load_odo, pipeline_inner, storage.smem_sumOdO};
-    auto load_state_odo = load_odo.init_state(_0{}, problem_size, TileShapeNM{}, blk_coord, outer_tile_count);
+    auto load_state_odo = load_odo.init_state(_0{}, problem_size_q, TileShapeNM{}, blk_coord_q, outer_tile_count);
 
     outer_tile_count *= 2; // K & V
     inner_tile_count *= 4; // Q & dO & LSE & sumOdO
@@ -454,19 +488,32 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
     }
 
     CUTLASS_PRAGMA_NO_UNROLL
-    while (inner_tile_count > 0) {
-      while (inner_tile_count > 0) { 
-        if (Fusion{}.is_contributing(make_coord(*inner_tile_iter, get<1>(blk_coord)), TileShape{}, problem_size)) {
-          break;
-        }
-        inner_tile_count -= 4;
-        ++inner_tile_iter;
+    for (int r = 0; r < params.h_r; r++) {
+      if (r > 0) {
+        blk_coord_q = get_blk_coord_q(blk_coord, params.h_r, r);
+        load_state_q = load_q.init_state(block_rank_in_cluster, problem_size_q, TileShapeNM{}, blk_coord_q, inner_tile_count_per_head);
+        load_state_do = load_do.init_state(block_rank_in_cluster, problem_size_q, TileShapeNM{}, blk_coord_q, inner_tile_count_per_head);
+        load_state_lse = load_lse.init_state(_0{}, problem_size_q, TileShapeNM{}, blk_coord_q, NumMmaWarpGroups);
+        load_state_odo = load_odo.init_state(_0{}, problem_size_q, TileShapeNM{}, blk_coord_q, NumMmaWarpGroups);
+        inner_tile_count = inner_tile_count_per_head * 4;
+        inner_tile_iter.coord = 0;
       }
-      load_q.template step<false,false,true>(inner_tile_iter, load_state_q, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
-      load_lse.template step<false,true,false>(inner_tile_iter, load_state_lse, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
 
-      load_do.template step<false,false,true>(inner_tile_iter, load_state_do, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
-      load_odo.template step<true,true,false>(inner_tile_iter, load_state_odo, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
+      CUTLASS_PRAGMA_NO_UNROLL
+      while (inner_tile_count > 0) {
+        while (inner_tile_count > 0) { 
+          if (Fusion{}.is_contributing(make_coord(*inner_tile_iter, get<1>(blk_coord)), TileShape{}, problem_size)) {
+            break;
+          }
+          inner_tile_count -= 4;
+          ++inner_tile_iter;
+        }
+        load_q.template step<false,false,true>(inner_tile_iter, load_state_q, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
+        load_lse.template step<false,true,false>(inner_tile_iter, load_state_lse, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
+
+        load_do.template step<false,false,true>(inner_tile_iter, load_state_do, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
+        load_odo.template step<true,true,false>(inner_tile_iter, load_state_odo, smem_pipe_write_inner, lane_predicate, inner_tile_count, mcast_mask_b);
+      }
     }
   }
 
@@ -521,48 +568,55 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
   {
     int lane_predicate = cute::elect_one_sync();
 
-    Tensor mDQ_full = params.tma_red_dq.get_tma_tensor(select<2,4,0,1>(problem_size));
+    Tensor mDQ_full = params.tma_red_dq.get_tma_tensor(select<2,4,0,1>(get_problem_size_q(problem_size, params.h_r)));
     Tensor gDQ_full = local_tile(mDQ_full, TileShapeMD{}, make_coord(_, _, _), Step<_1, _1, Underscore>{});
-    Tensor gDQ = gDQ_full(_, _, _, _0{}, get<2,0>(blk_coord), get<2,1>(blk_coord));
     Tensor sDQ = make_tensor(make_smem_ptr(storage.smem_dq.data()), SmemLayoutDQ{});
 
     auto block_tma = params.tma_red_dq.get_slice(_0{});
 
     Tensor tDQsDQ = block_tma.partition_S(sDQ);
-    Tensor tDQgDQ = block_tma.partition_D(gDQ);
 
-    int inner_tile_count = get_inner_tile_count(blk_coord, problem_size);
-    int g_index = 0;
+    int inner_tile_count_per_head = get_inner_tile_count(blk_coord, problem_size);
 
     auto smem_pipe_release_reducer = smem_pipe_read_reducer;
     bool first = true;
-    while (inner_tile_count > 0) {
-      while (inner_tile_count > 0) { 
-        if (Fusion{}.is_contributing(make_coord(g_index, get<1>(blk_coord)), TileShape{}, problem_size)) {
-          break;
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int r = 0; r < params.h_r; r++) {
+      auto blk_coord_q = get_blk_coord_q(blk_coord, params.h_r, r);
+      Tensor gDQ = gDQ_full(_, _, _, _0{}, get<2,0>(blk_coord_q), get<2,1>(blk_coord_q));
+      Tensor tDQgDQ = block_tma.partition_D(gDQ);
+
+      int inner_tile_count = inner_tile_count_per_head;
+      int g_index = 0;
+
+      while (inner_tile_count > 0) {
+        while (inner_tile_count > 0) { 
+          if (Fusion{}.is_contributing(make_coord(g_index, get<1>(blk_coord)), TileShape{}, problem_size)) {
+            break;
+          }
+          inner_tile_count -= 1;
+          ++g_index;
         }
-        inner_tile_count -= 1;
-        ++g_index;
-      }
-      if (inner_tile_count == 0) break;
+        if (inner_tile_count == 0) break;
 
-      pipeline_reducer.consumer_wait(smem_pipe_read_reducer);
-      if (lane_predicate == 1) {
-        tma_store_wait<1>();
-      }
-      if (! first) {
-        pipeline_reducer.consumer_release(smem_pipe_release_reducer);
-        ++smem_pipe_release_reducer;
-      } else {
-        first = false;
-      }
-      if (lane_predicate == 1) {
-        copy(params.tma_red_dq, tDQsDQ(_,_,_,smem_pipe_read_reducer.index()), tDQgDQ(_,_,_,g_index));
-        tma_store_arrive();
+        pipeline_reducer.consumer_wait(smem_pipe_read_reducer);
+        if (lane_predicate == 1) {
+          tma_store_wait<1>();
+        }
+        if (! first) {
+          pipeline_reducer.consumer_release(smem_pipe_release_reducer);
+          ++smem_pipe_release_reducer;
+        } else {
+          first = false;
+        }
+        if (lane_predicate == 1) {
+          copy(params.tma_red_dq, tDQsDQ(_,_,_,smem_pipe_read_reducer.index()), tDQgDQ(_,_,_,g_index));
+          tma_store_arrive();
+        }
+        ++smem_pipe_read_reducer;
+        --inner_tile_count;
+        ++g_index;
       }
-      ++smem_pipe_read_reducer;
-      --inner_tile_count;
-      ++g_index;
     }
     if (lane_predicate) {
       tma_store_wait<0>();
@@ -600,7 +654,7 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
     pipeline_outer.consumer_wait(smem_pipe_read_outer);
     PipelineStateQ smem_pipe_read_v = smem_pipe_read_outer;
 
-    int inner_tile_count = get_inner_tile_count(wg_coord, problem_size);
+    int inner_tile_count_per_head = get_inner_tile_count(wg_coord, problem_size);
                                                                                 
     TiledMmaNM tiled_mma_nm;
     Tensor sK = make_tensor(make_smem_ptr(storage.smem_k.data()), SmemLayoutK{});
@@ -672,179 +726,186 @@ struct FmhaBwdMainloopTmaWarpSpecialized {
     auto smem_pipe_read_k_other = smem_pipe_read_k;
     smem_pipe_read_k_other.advance(2);
 
-    int k_index = 0;
+    auto tScS_head = tScS.data();
 
-    while (inner_tile_count > 0) {
-      while (inner_tile_count > 0) { 
-        if (Fusion{}.is_contributing(make_coord(k_index, get<1>(blk_coord)), TileShape{}, problem_size)) {
-          break;
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int r = 0; r < params.h_r; r++) {
+      int inner_tile_count = inner_tile_count_per_head;
+      int k_index = 0;
+      tScS.data() = tScS_head;
+
+      while (inner_tile_count > 0) {
+        while (inner_tile_count > 0) { 
+          if (Fusion{}.is_contributing(make_coord(k_index, get<1>(blk_coord)), TileShape{}, problem_size)) {
+            break;
+          }
+          inner_tile_count -= 1;
+          tScS.data() = tScS.data() + E<1>{} * get<1>(TileShapeNM{});
+          k_index += 1;
         }
-        inner_tile_count -= 1;
-        tScS.data() = tScS.data() + E<1>{} * get<1>(TileShapeNM{});
-        k_index += 1;
-      }
-      if (inner_tile_count == 0) break;
+        if (inner_tile_count == 0) break;
 
-      pipeline_inner.consumer_wait(smem_pipe_read_inner);
-      PipelineState smem_pipe_read_q = smem_pipe_read_inner;
-      ++smem_pipe_read_inner;
-      PipelineState smem_pipe_read_do = smem_pipe_read_inner;
-      ++smem_pipe_read_inner;
+        pipeline_inner.consumer_wait(smem_pipe_read_inner);
+        PipelineState smem_pipe_read_q = smem_pipe_read_inner;
+        ++smem_pipe_read_inner;
+        PipelineState smem_pipe_read_do = smem_pipe_read_inner;
+        ++smem_pipe_read_inner;
 
-      // GEMM KQ -> S
-      Tensor acc_S = partition_fragment_C(tiled_mma_nm, take<0,2>(TileShapeNM{}));
+        // GEMM KQ -> S
+        Tensor acc_S = partition_fragment_C(tiled_mma_nm, take<0,2>(TileShapeNM{}));
 
-      warpgroup_fence_operand(acc_S);
-      warpgroup_arrive();
-      gemm_zero_acc(tiled_mma_nm, tSrK(_,_,_,smem_pipe_read_k.index()), tSrQ(_,_,_,smem_pipe_read_q.index()), acc_S);
-      warpgroup_commit_batch();
+        warpgroup_fence_operand(acc_S);
+        warpgroup_arrive();
+        gemm_zero_acc(tiled_mma_nm, tSrK(_,_,_,smem_pipe_read_k.index()), tSrQ(_,_,_,smem_pipe_read_q.index()), acc_S);
+        warpgroup_commit_batch();
       
-      pipeline_inner.consumer_wait(smem_pipe_read_do);
+        pipeline_inner.consumer_wait(smem_pipe_read_do);
 
-      // GEMM VdO -> dP
-      Tensor acc_DP = partition_fragment_C(tiled_mma_nm, take<0,2>(TileShapeNM{}));
+        // GEMM VdO -> dP
+        Tensor acc_DP = partition_fragment_C(tiled_mma_nm, take<0,2>(TileShapeNM{}));
 
-      warpgroup_fence_operand(acc_DP);
-      warpgroup_arrive();
-      gemm_zero_acc(tiled_mma_nm, tDPrV(_,_,_,smem_pipe_read_v.index()), tDPrDO(_,_,_,smem_pipe_read_do.index()), acc_DP);
-      warpgroup_commit_batch();
+        warpgroup_fence_operand(acc_DP);
+        warpgroup_arrive();
+        gemm_zero_acc(tiled_mma_nm, tDPrV(_,_,_,smem_pipe_read_v.index()), tDPrDO(_,_,_,smem_pipe_read_do.index()), acc_DP);
+        warpgroup_commit_batch();
 
-      Tensor reg_LSE = make_fragment_like<ElementAccumulator>(acc_S);
-      for (int i = 0; i < size(reg_LSE); i++) {
-        reg_LSE(i) = ((ElementAccumulator)std::log2(std::exp(1.0))) * tSsLSE(_,_,_,smem_pipe_read_q.index())(i);
-      }
+        Tensor reg_LSE = make_fragment_like<ElementAccumulator>(acc_S);
+        for (int i = 0; i < size(reg_LSE); i++) {
+          reg_LSE(i) = ((ElementAccumulator)std::log2(std::exp(1.0))) * tSsLSE(_,_,_,smem_pipe_read_q.index())(i);
+        }
 
-      Tensor reg_ODO = make_fragment_like<ElementAccumulator>(acc_S);
-      if constexpr (decltype(get<0>(TileShape{}) != _128{})::value) {
-        for (int i = 0; i < size(reg_ODO); i++) {
-          reg_ODO(i) = tDPsODO(_,_,_,smem_pipe_read_do.index())(i);
+        Tensor reg_ODO = make_fragment_like<ElementAccumulator>(acc_S);
+        if constexpr (decltype(get<0>(TileShape{}) != _128{})::value) {
+          for (int i = 0; i < size(reg_ODO); i++) {
+            reg_ODO(i) = tDPsODO(_,_,_,smem_pipe_read_do.index())(i);
+          }
         }
-      }
 
-      warpgroup_wait<1>();
-      warpgroup_fence_operand(acc_S);
+        warpgroup_wait<1>();
+        warpgroup_fence_operand(acc_S);
 
-      math_wg_order_barrier.wait();
-      // Compute S -> P
-      Fusion{}.before_softmax(acc_S, tScS, problem_size);
-      auto acc_P = make_fragment_like<ElementAccumulator>(acc_S);
-      CUTLASS_PRAGMA_UNROLL
-      for (int i = 0; i < size(acc_P); i++) {
-        acc_P(i) = ::exp2f(params.scale_softmax_log2 * acc_S(i) - reg_LSE(i));
-      }
-      math_wg_order_barrier.arrive();
+        math_wg_order_barrier.wait();
+        // Compute S -> P
+        Fusion{}.before_softmax(acc_S, tScS, problem_size);
+        auto acc_P = make_fragment_like<ElementAccumulator>(acc_S);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(acc_P); i++) {
+          acc_P(i) = ::exp2f(params.scale_softmax_log2 * acc_S(i) - reg_LSE(i));
+        }
+        math_wg_order_barrier.arrive();
 
-      if constexpr (decltype(get<0>(TileShape{}) == _128{})::value) {
-        for (int i = 0; i < size(reg_ODO); i++) {
-          reg_ODO(i) = tDPsODO(_,_,_,smem_pipe_read_do.index())(i);
+        if constexpr (decltype(get<0>(TileShape{}) == _128{})::value) {
+          for (int i = 0; i < size(reg_ODO); i++) {
+            reg_ODO(i) = tDPsODO(_,_,_,smem_pipe_read_do.index())(i);
+          }
         }
-      }
 
-      warpgroup_wait<0>();
-      warpgroup_fence_operand(acc_DP);
+        warpgroup_wait<0>();
+        warpgroup_fence_operand(acc_DP);
       
-      // Compute dP P -> dS
-      auto acc_DS = make_fragment_like<Element>(acc_DP);
-      CUTLASS_PRAGMA_UNROLL
-      for (int i = 0; i < size(acc_DS); i++) {
-        // We could move the scale out and into the respective epilogues (or a final scaling step)
-        acc_DS(i) = acc_P(i) * params.scale_softmax * (acc_DP(i) - reg_ODO(i));
-      }
+        // Compute dP P -> dS
+        auto acc_DS = make_fragment_like<Element>(acc_DP);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(acc_DS); i++) {
+          // We could move the scale out and into the respective epilogues (or a final scaling step)
+          acc_DS(i) = acc_P(i) * params.scale_softmax * (acc_DP(i) - reg_ODO(i));
+        }
 
-      // GEMM PdO -> dV
-      auto op_P = make_acc_into_op<Element>(acc_P, typename TiledMmaND::LayoutA_TV{});
-      warpgroup_fence_operand(acc_DV);
-      warpgroup_fence_operand(op_P);
-      warpgroup_arrive();
-      cute::gemm(tiled_mma_nd, op_P, tDVrDO(_,_,_,smem_pipe_read_do.index()), acc_DV);
-      warpgroup_commit_batch();
-
-      // Store dS to smem dS'
-      if (wg_idx == 0) math_wg_order_barrier.wait();
-
-      auto recast_bits = [](auto sz, auto t) {
-        return recast<uint_bit_t<decltype(sz)::value>>(t);
-      };
-      auto tDPsDS_v = recast_bits(Int<sizeof_bits_v<Element> * 2>{}, tDPsDS);
-      auto acc_DS_v = recast_bits(Int<sizeof_bits_v<Element> * 2>{}, acc_DS);
-
-      CUTLASS_PRAGMA_UNROLL
-      for (int i = 0; i < size(acc_DS_v); i++) {
-        tDPsDS_v(_,_,_,wg_idx)(i) = acc_DS_v(i);
-      }
+        // GEMM PdO -> dV
+        auto op_P = make_acc_into_op<Element>(acc_P, typename TiledMmaND::LayoutA_TV{});
+        warpgroup_fence_operand(acc_DV);
+        warpgroup_fence_operand(op_P);
+        warpgroup_arrive();
+        cute::gemm(tiled_mma_nd, op_P, tDVrDO(_,_,_,smem_pipe_read_do.index()), acc_DV);
+        warpgroup_commit_batch();
 
-      cutlass::arch::fence_view_async_shared();
-      if (wg_idx == 0) math_wg_order_barrier.arrive();
+        // Store dS to smem dS'
+        if (wg_idx == 0) math_wg_order_barrier.wait();
 
-      // GEMM dS Q -> dK
-      if (wg_idx == 1) {
+        auto recast_bits = [](auto sz, auto t) {
+          return recast<uint_bit_t<decltype(sz)::value>>(t);
+        };
+        auto tDPsDS_v = recast_bits(Int<sizeof_bits_v<Element> * 2>{}, tDPsDS);
+        auto acc_DS_v = recast_bits(Int<sizeof_bits_v<Element> * 2>{}, acc_DS);
 
-        math_wg_order_barrier.wait();
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(acc_DS_v); i++) {
+          tDPsDS_v(_,_,_,wg_idx)(i) = acc_DS_v(i);
+        }
 
-        // GEMM dS' K -> dQ
-        Tensor acc_DQ = partition_fragment_C(tiled_mma_md, take<0,2>(TileShapeMD{}));
-  
-        warpgroup_fence_operand(acc_DQ);
-        warpgroup_arrive();
-        gemm_zero_acc(tiled_mma_md, tDQrDS(_,_,_,0), tDQrK(_,_,_,smem_pipe_read_k_other.index()), acc_DQ);
-        cute::gemm(tiled_mma_md, tDQrDS(_,_,_,1), tDQrK(_,_,_,smem_pipe_read_k.index()), acc_DQ);
-        warpgroup_commit_batch();
+        cutlass::arch::fence_view_async_shared();
+        if (wg_idx == 0) math_wg_order_barrier.arrive();
 
-        warpgroup_fence_operand(acc_DK);
-        warpgroup_arrive();
-        cute::gemm(TiledMmaND_SS{}, tDKrDSp(_,_,_,wg_idx), tDKrQ(_,_,_,smem_pipe_read_q.index()), acc_DK);
-        warpgroup_commit_batch();
+        // GEMM dS Q -> dK
+        if (wg_idx == 1) {
 
-        warpgroup_wait<1>();
-        warpgroup_fence_operand(acc_DK);
-  
-        warpgroup_wait<1>();
-        warpgroup_fence_operand(acc_DQ);
+          math_wg_order_barrier.wait();
 
-        math_wg_order_barrier.arrive();
+          // GEMM dS' K -> dQ
+          Tensor acc_DQ = partition_fragment_C(tiled_mma_md, take<0,2>(TileShapeMD{}));
   
-        pipeline_reducer.producer_acquire(smem_pipe_write_reducer);
-        auto tDQsDQ = tDQsDQ_full(_,_,_,smem_pipe_write_reducer.index());
+          warpgroup_fence_operand(acc_DQ);
+          warpgroup_arrive();
+          gemm_zero_acc(tiled_mma_md, tDQrDS(_,_,_,0), tDQrK(_,_,_,smem_pipe_read_k_other.index()), acc_DQ);
+          cute::gemm(tiled_mma_md, tDQrDS(_,_,_,1), tDQrK(_,_,_,smem_pipe_read_k.index()), acc_DQ);
+          warpgroup_commit_batch();
+
+          warpgroup_fence_operand(acc_DK);
+          warpgroup_arrive();
+          cute::gemm(TiledMmaND_SS{}, tDKrDSp(_,_,_,wg_idx), tDKrQ(_,_,_,smem_pipe_read_q.index()), acc_DK);
+          warpgroup_commit_batch();
+
+          warpgroup_wait<1>();
+          warpgroup_fence_operand(acc_DK);
   
-        // Store dQ to smem dQ'
-        // Invoke TMA reduce on dQ'
-        using Vec = uint_bit_t<sizeof_bits_v<ElementAccumulator> * 2>;
-        auto tDQsDQ_v = recast<Vec>(tDQsDQ);
-        auto acc_DQ_v = recast<Vec>(acc_DQ);
+          warpgroup_wait<1>();
+          warpgroup_fence_operand(acc_DQ);
 
-        CUTLASS_PRAGMA_UNROLL
-        for (int i = 0; i < size(acc_DQ_v); i++) {
-          tDQsDQ_v(i) = acc_DQ_v(i);
-        }
+          math_wg_order_barrier.arrive();
   
-        cutlass::arch::fence_view_async_shared();
+          pipeline_reducer.producer_acquire(smem_pipe_write_reducer);
+          auto tDQsDQ = tDQsDQ_full(_,_,_,smem_pipe_write_reducer.index());
+  
+          // Store dQ to smem dQ'
+          // Invoke TMA reduce on dQ'
+          using Vec = uint_bit_t<sizeof_bits_v<ElementAccumulator> * 2>;
+          auto tDQsDQ_v = recast<Vec>(tDQsDQ);
+          auto acc_DQ_v = recast<Vec>(acc_DQ);
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(acc_DQ_v); i++) {
+            tDQsDQ_v(i) = acc_DQ_v(i);
+          }
+  
+          cutlass::arch::fence_view_async_shared();
         
-        pipeline_reducer.producer_commit(smem_pipe_write_reducer);
-        ++smem_pipe_write_reducer;
-      } else {
+          pipeline_reducer.producer_commit(smem_pipe_write_reducer);
+          ++smem_pipe_write_reducer;
+        } else {
 
-        warpgroup_fence_operand(acc_DK);
-        warpgroup_arrive();
-        cute::gemm(TiledMmaND_SS{}, tDKrDSp(_,_,_,wg_idx), tDKrQ(_,_,_,smem_pipe_read_q.index()), acc_DK);
-        warpgroup_commit_batch();
+          warpgroup_fence_operand(acc_DK);
+          warpgroup_arrive();
+          cute::gemm(TiledMmaND_SS{}, tDKrDSp(_,_,_,wg_idx), tDKrQ(_,_,_,smem_pipe_read_q.index()), acc_DK);
+          warpgroup_commit_batch();
 
-        warpgroup_wait<1>();
-        warpgroup_fence_operand(acc_DK);
+          warpgroup_wait<1>();
+          warpgroup_fence_operand(acc_DK);
 
-        pipeline_reducer.producer_acquire(smem_pipe_write_reducer);
-        pipeline_reducer.producer_commit(smem_pipe_write_reducer);
-        ++smem_pipe_write_reducer;
-      }
+          pipeline_reducer.producer_acquire(smem_pipe_write_reducer);
+          pipeline_reducer.producer_commit(smem_pipe_write_reducer);
+          ++smem_pipe_write_reducer;
+        }
 
-      --inner_tile_count;
+        --inner_tile_count;
 
-      pipeline_inner.consumer_release(smem_pipe_release_inner);  
-      ++smem_pipe_release_inner;
-      pipeline_inner.consumer_release(smem_pipe_release_inner);  
-      ++smem_pipe_release_inner;
+        pipeline_inner.consumer_release(smem_pipe_release_inner);  
+        ++smem_pipe_release_inner;
+        pipeline_inner.consumer_release(smem_pipe_release_inner);  
+        ++smem_pipe_release_inner;
 
-      tScS.data() = tScS.data() + E<1>{} * get<1>(TileShapeNM{});
-      k_index += 1;
+        tScS.data() = tScS.data() + E<1>{} * get<1>(TileShapeNM{});
+        k_index += 1;
+      }
     }
 
     pipeline_outer.consumer_release(smem_pipe_read_k);           
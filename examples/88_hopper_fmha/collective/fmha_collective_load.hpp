@@ -34,6 +34,8 @@
 #include "cutlass/cutlass.h"
 #include "cute/tensor.hpp"
 
+#include "../collective/fmha_rope.hpp"
+
 namespace cutlass::fmha::collective {
 
 enum class LoadKind {
@@ -100,6 +102,27 @@ struct CollectiveLoadTma {
     }
   }
 
+  // The tiles of init_g over the tensor at ptr instead of the TMA tensor, used by step_rope
+  template<class Stride, class ProblemSize, class TileShape, class BlockCoord>
+  CUTLASS_DEVICE auto init_g_rope(Element const* ptr, Stride const& dX,
+      ProblemSize const& problem_size, TileShape const& tile_shape,
+      BlockCoord const& blk_coord, int loop_count
+  ) {
+    using X = Underscore;
+    static_assert(kKind == LoadKind::kQ || kKind == LoadKind::kK);
+    if constexpr (kKind == LoadKind::kK) {
+      Tensor mK_full = make_tensor(make_gmem_ptr(ptr), make_shape(get<3>(problem_size), get<4>(problem_size), select<0,1>(problem_size)), dX);
+      Tensor gK_full = local_tile(mK_full, tile_shape, make_coord(_, _, _), Step<X, _1, _1>{});
+      Tensor gK = gK_full(_, _, _, _0{}, get<2>(blk_coord));
+      return gK;
+    } else {
+      Tensor mQ_full = make_tensor(make_gmem_ptr(ptr), make_shape(get<2>(problem_size), get<4>(problem_size), select<0,1>(problem_size)), dX);
+      Tensor gQ_full = local_tile(mQ_full, tile_shape, make_coord(_, _, _), Step<_1, X, _1>{});
+      Tensor gQ = gQ_full(_, _, _, _0{}, get<2>(blk_coord));
+      return make_tensor(gQ.data() + loop_count * get<0>(blk_coord) * stride<2>(gQ), gQ.layout());
+    }
+  }
+
   template<class ClusterRank, class ProblemSize, class TileShape, class BlockCoord>
   CUTLASS_DEVICE auto init_state(ClusterRank const& block_rank_in_cluster,
       ProblemSize const& problem_size, TileShape const& tile_shape,
@@ -135,6 +158,32 @@ struct CollectiveLoadTma {
     }
     --tile_count;
   }
+
+  // Same as step, but all threads of the warp copy the tile from g of init_g_rope and
+  // rotate it on the way. Rows of tile 0 from row_bound on are out of bounds and row 0
+  // of tile 0 is at position pos_offset.
+  template<bool kAdvanceIterator=true, bool kAdvancePipe=true, bool kAcquireBarrier=true, class TileIterator, class TensorG>
+  CUTLASS_DEVICE void step_rope(TileIterator& tile_iter, TensorG const& g,
+      PipelineState& smem_pipe_write,
+      int lane_predicate, int& tile_count,
+      Rope const& rope, int row_bound, int head_dim, int pos_offset
+  ) {
+    if (tile_count > 0) {
+      if constexpr (kAcquireBarrier) pipeline.producer_acquire(smem_pipe_write);
+      using BarrierType = typename Pipeline::ProducerBarrierType;
+      BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
+
+      Tensor s = make_tensor(make_smem_ptr(storage.data()), SmemLayout{})(_,_,smem_pipe_write.index());
+      Tensor c = make_identity_tensor(make_shape(size<0>(s), size<1>(s)));
+      int row_offset = *tile_iter * size<0>(s);
+      copy_rope(rope, g(_,_,*tile_iter), s, c, row_bound - row_offset, head_dim, pos_offset + row_offset);
+      commit_rope(tma_barrier, size(s) * sizeof(Element), lane_predicate == 1);
+
+      if constexpr (kAdvancePipe) ++smem_pipe_write;
+      if constexpr (kAdvanceIterator) ++tile_iter;
+    }
+    --tile_count;
+  }
 };
 
 }  // namespace cutlass::fmha::collective
@@ -68,6 +68,8 @@ struct FmhaMainloopTmaWarpSpecialized {
   // Options
   static constexpr bool kIsPersistent = find_option_t<Tag::kIsPersistent, false_type, Options...>::value;
   static constexpr bool kIsMainloopLocked = find_option_t<Tag::kIsMainloopLocked, false_type, Options...>::value;
+  // the whole KV sequence fits into one tile, so the softmax of each row is computed exactly in one pass
+  static constexpr bool kIsSinglePass = find_option_t<Tag::kIsSinglePass, false_type, Options...>::value;
 
   static constexpr int NumLoadWarpGroups = 1;
   static constexpr int NumMmaWarpGroups = find_option_t<Tag::kNumMmaWarpGroups, Int<2>, Options...>::value;
@@ -84,6 +86,11 @@ struct FmhaMainloopTmaWarpSpecialized {
   // 16B alignment lets us use TMA
   static constexpr int Alignment = 16 / sizeof(Element);
 
+  static constexpr bool kIsFp8 = sizeof(Element) == 1;
+  // P is in [0, 1] and is multiplied by the largest finite fp8 value before it is quantized for P*V,
+  // which keeps its small entries out of the subnormal range; O is divided by it again at the end
+  static constexpr float kScaleP = cute::is_same_v<Element, cutlass::float_e5m2_t> ? 57344.f : 448.f;
+
   using TileShapeQK = Shape<
     decltype(tuple_element_t<0, TileShape>{} / Int<NumMmaWarpGroups>{}),
     tuple_element_t<1, TileShape>,
@@ -91,6 +98,11 @@ struct FmhaMainloopTmaWarpSpecialized {
 
   using TileShapePV = decltype(select<0,2,1>(TileShapeQK{}));
 
+  // fp8 descale factors cover blocks of this many rows of Q and of K/V respectively
+  static constexpr int kDescaleBlockQ = get<0>(TileShapeQK{});
+  static constexpr int kDescaleBlockKV = get<1>(TileShapeQK{});
+  using StrideDescale = cute::tuple<int, cute::tuple<int, int>>;  // block (B H)
+
   using CollectiveMmaQK = typename cutlass::gemm::collective::CollectiveBuilder<
       cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
       Element, LayoutQ, Alignment,
@@ -143,6 +155,17 @@ struct FmhaMainloopTmaWarpSpecialized {
     LayoutK dK;
     const Element* ptr_V;
     LayoutV dV;
+    // rotary position embedding of Q and K, query row i is at position i + seqlen_k - seqlen_q
+    Rope rope{};
+
+    // fp8 only: dequantization factors of Q, K and V per block of kDescaleBlockQ/kDescaleBlockKV rows
+    // and per head. A block stride of zero gives per-head factors, a null pointer a factor of one.
+    const float* ptr_descale_Q = nullptr;
+    StrideDescale dDescaleQ{};
+    const float* ptr_descale_K = nullptr;
+    StrideDescale dDescaleK{};
+    const float* ptr_descale_V = nullptr;
+    StrideDescale dDescaleV{};
   };
 
   using TMA_Q = typename CollectiveMmaQK::Params::TMA_A;
@@ -157,6 +180,20 @@ struct FmhaMainloopTmaWarpSpecialized {
     float scale_softmax;
     float scale_softmax_log2;
     float rp_dropout;
+
+    // rope tiles are read without TMA, see CollectiveLoadTma::step_rope
+    Rope rope;
+    const Element* ptr_Q;
+    LayoutQ dQ;
+    const Element* ptr_K;
+    LayoutK dK;
+
+    const float* ptr_descale_Q;
+    StrideDescale dDescaleQ;
+    const float* ptr_descale_K;
+    StrideDescale dDescaleK;
+    const float* ptr_descale_V;
+    StrideDescale dDescaleV;
   };
 
   using LoadQ = cutlass::fmha::collective::CollectiveLoadTma<
@@ -191,6 +228,8 @@ struct FmhaMainloopTmaWarpSpecialized {
       && (get<4>(problem_size) <= get<2>(TileShape{}))
       && ((get<4>(problem_size) % Alignment) == 0)
       && ((get<2>(problem_size) % Alignment) == 0)
+      && (! args.rope.is_enabled() || (get<4>(problem_size) % 2) == 0)
+      && (! kIsSinglePass || get<3>(problem_size) <= get<1>(TileShape{}))
     ;
   }
 
@@ -217,10 +256,64 @@ struct FmhaMainloopTmaWarpSpecialized {
         params_pv.tma_load_b,
         1.0f / (float) std::sqrt(get<4>(problem_size)),
         (float) (std::log2(std::exp(1.0)) / std::sqrt(get<4>(problem_size))),
-        1.0f
+        1.0f,
+        args.rope,
+        args.ptr_Q, args.dQ,
+        args.ptr_K, args.dK,
+        args.ptr_descale_Q, args.dDescaleQ,
+        args.ptr_descale_K, args.dDescaleK,
+        args.ptr_descale_V, args.dDescaleV
     };
   }
 
+  template<class BlkCoord>
+  CUTLASS_DEVICE static float
+  load_descale(const float* ptr, StrideDescale const& stride, int block, BlkCoord const& blk_coord) {
+    if (ptr == nullptr) {
+      return 1.0f;
+    }
+    return ptr[block * get<0>(stride)
+        + get<2,0>(blk_coord) * get<1,0>(stride)
+        + get<2,1>(blk_coord) * get<1,1>(stride)];
+  }
+
+  template<class Acc>
+  CUTLASS_DEVICE static void
+  scale_fragment(Acc& acc, float scale) {
+    using ElementAcc = typename Acc::value_type;
+    ElementAcc scale_ele = static_cast<ElementAcc>(scale);
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(acc); i++) {
+      acc(i) *= scale_ele;
+    }
+  }
+
+  // fp8: S = Q*K^T is dequantized by the Q and K block factors before the softmax, and the V block
+  // factor is carried by O. O is kept in units of the current V block; when the factor changes
+  // between blocks, the partial O is rescaled to the new one before the next P*V.
+  struct Descale {
+    float qk;
+    float v;
+  };
+
+  template<class BlkCoord>
+  CUTLASS_DEVICE static Descale
+  load_descale_tile(Params const& params, BlkCoord const& wg_coord, int k_tile) {
+    float descale_q = load_descale(params.ptr_descale_Q, params.dDescaleQ, get<0>(wg_coord), wg_coord);
+    float descale_k = load_descale(params.ptr_descale_K, params.dDescaleK, k_tile, wg_coord);
+    float descale_v = load_descale(params.ptr_descale_V, params.dDescaleV, k_tile, wg_coord);
+    return Descale{descale_q * descale_k, descale_v};
+  }
+
+  template<class AccPV>
+  CUTLASS_DEVICE static void
+  descale_pv_block(AccPV& acc_pv, float& descale_v, float descale_v_next) {
+    if (descale_v_next != descale_v) {
+      scale_fragment(acc_pv, descale_v / descale_v_next);
+      descale_v = descale_v_next;
+    }
+  }
+
   CUTLASS_DEVICE
   static void prefetch_tma_descriptors(Params const& params) {
     cute::prefetch_tma_descriptor(params.tma_load_q.get_tma_descriptor());
@@ -228,6 +321,25 @@ struct FmhaMainloopTmaWarpSpecialized {
     cute::prefetch_tma_descriptor(params.tma_load_v.get_tma_descriptor());
   }
 
+  template<class LoadState, class TileIterator, class BlkCoord, class ProblemShape>
+  CUTLASS_DEVICE void
+  load_q_maybe_rope(
+      LoadQ& load_q, LoadState const& load_state_q, TileIterator& q_tile_iter,
+      BlkCoord const& blk_coord, Params const& params, ProblemShape const& problem_size,
+      PipelineStateQ& smem_pipe_write_q, int lane_predicate, int& q_tile_count)
+  {
+    if (params.rope.is_enabled()) {
+      Tensor gQ_rope = load_q.init_g_rope(params.ptr_Q, params.dQ, problem_size, TileShapeQK{}, blk_coord, NumMmaWarpGroups);
+      int row_offset = NumMmaWarpGroups * get<0>(blk_coord) * get<0>(TileShapeQK{});
+      load_q.step_rope(q_tile_iter, gQ_rope, smem_pipe_write_q, lane_predicate, q_tile_count,
+          params.rope, get<2>(problem_size) - row_offset, get<4>(problem_size),
+          row_offset + get<3>(problem_size) - get<2>(problem_size));
+    }
+    else {
+      load_q.step(q_tile_iter, load_state_q, smem_pipe_write_q, lane_predicate, q_tile_count);
+    }
+  }
+
   template<bool kLoadQ, class BlkCoord, class ProblemShape, class LoadWarpBarrier>
   CUTLASS_DEVICE void
   load_kv_maybe_q(
@@ -268,14 +380,30 @@ struct FmhaMainloopTmaWarpSpecialized {
     LoadV load_v{params.tma_load_v, pipeline, storage.smem_v};
     auto load_state_v = load_v.init_state(block_rank_in_cluster, problem_size, TileShapePV{}, blk_coord, fusion_tile_count);
 
+    Tensor gK_rope = load_k.init_g_rope(params.ptr_K, params.dK, problem_size, TileShapeQK{}, blk_coord, fusion_tile_count);
+
+    auto step_q = [&](int& count) {
+      load_q_maybe_rope(load_q, load_state_q, q_tile_iter, blk_coord, params, problem_size, smem_pipe_write_q, lane_predicate, count);
+    };
+
+    auto step_k = [&]() {
+      if (params.rope.is_enabled()) {
+        load_k.template step_rope<false>(k_tile_iter, gK_rope, smem_pipe_write, lane_predicate, k_tile_count,
+            params.rope, get<3>(problem_size), get<4>(problem_size), 0);
+      }
+      else {
+        load_k.template step<false>(k_tile_iter, load_state_k, smem_pipe_write, lane_predicate, k_tile_count, mcast_mask_b);
+      }
+    };
+
     if constexpr (kLoadQ) {
-      load_q.step(q_tile_iter, load_state_q, smem_pipe_write_q, lane_predicate, q_tile_count);
+      step_q(q_tile_count);
     }
 
-    load_k.template step<false>(k_tile_iter, load_state_k, smem_pipe_write, lane_predicate, k_tile_count, mcast_mask_b);
+    step_k();
 
     if constexpr (kLoadQ) {
-      load_q.step(q_tile_iter, load_state_q, smem_pipe_write_q, lane_predicate, q_tile_count);
+      step_q(q_tile_count);
     }
 
     if constexpr (! kLoadQ) {
@@ -290,13 +418,13 @@ struct FmhaMainloopTmaWarpSpecialized {
 
     if constexpr (kLoadQ) {
       while (q_tile_count > 0) {
-        load_q.step(q_tile_iter, load_state_q, smem_pipe_write_q, lane_predicate, q_tile_count);
+        step_q(q_tile_count);
       }
     }
 
     CUTLASS_PRAGMA_NO_UNROLL
     while (k_tile_count > 0) {
-      load_k.template step<false>(k_tile_iter, load_state_k, smem_pipe_write, lane_predicate, k_tile_count, mcast_mask_b);
+      step_k();
       load_v.template step<true>(k_tile_iter, load_state_v, smem_pipe_write, lane_predicate, k_tile_count, mcast_mask_b);
     }
   }
@@ -319,7 +447,7 @@ struct FmhaMainloopTmaWarpSpecialized {
     CUTLASS_PRAGMA_UNROLL
     for (int q_tile_count = 0; q_tile_count < NumMmaWarpGroups; q_tile_count++) {
       int count = 1;
-      load_q.step(q_tile_iter, load_state_q, smem_pipe_write_q, lane_predicate, count);
+      load_q_maybe_rope(load_q, load_state_q, q_tile_iter, blk_coord, params, problem_size, smem_pipe_write_q, lane_predicate, count);
       if (q_tile_count == 0 && do_barrier) {
         load_warp_barrier.arrive();
         load_warp_barrier.wait(/*phase=*/ 0);
@@ -336,6 +464,118 @@ struct FmhaMainloopTmaWarpSpecialized {
       SharedStorage& storage)
   { /* no-op */ }
 
+  // S = Q * K^T covers the whole row, so its max and sum are final after one tile: no running max,
+  // no rescaling of O, and the K stage is released as soon as S is in registers.
+  template<class BlkCoord, class ProblemShape, class MathWgOrderBarrier>
+  CUTLASS_DEVICE auto
+  compute_single_pass(
+      BlkCoord const& blk_coord, BlkCoord const& wg_coord,
+      Params const& params, ProblemShape const& problem_size,
+      MainloopPipeline& pipeline, PipelineState& smem_pipe_read,
+      MainloopPipelineQ& pipeline_q, PipelineStateQ& smem_pipe_read_q,
+      SharedStorage& storage,
+      MathWgOrderBarrier& math_wg_order_barrier)
+  {
+    int thread_idx = int(threadIdx.x);
+
+    PipelineState smem_pipe_release = smem_pipe_read;
+    PipelineStateQ smem_pipe_release_q = smem_pipe_read_q;
+
+    TiledMmaQK tiled_mma_qk;
+    auto thr_mma_qk = tiled_mma_qk.get_thread_slice(thread_idx);
+
+    Tensor sQ = make_tensor(make_smem_ptr(storage.smem_q.data()), SmemLayoutQ{});
+    Tensor sK = make_tensor(make_smem_ptr(storage.smem_k.data()), SmemLayoutK{});
+
+    Tensor tSsQ = thr_mma_qk.partition_A(sQ);                                   // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tSsK = thr_mma_qk.partition_B(sK);                                   // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tSrQ = thr_mma_qk.make_fragment_A(tSsQ);                            // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tSrK = thr_mma_qk.make_fragment_B(tSsK);                            // (MMA,MMA_M,MMA_N,PIPE)
+
+    TiledMmaPV tiled_mma_pv;
+    auto thr_mma_pv = tiled_mma_pv.get_thread_slice(thread_idx);
+
+    Tensor sV = make_tensor(make_smem_ptr(storage.smem_v.data()), SmemLayoutV{});
+
+    Tensor tOsV = thr_mma_pv.partition_B(sV);                                   // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tOrV = thr_mma_pv.make_fragment_B(tOsV);                            // (MMA,MMA_M,MMA_N,PIPE)
+
+    pipeline_q.consumer_wait(smem_pipe_read_q);
+
+    // mapping into QK accumulator
+    Tensor cP = make_identity_tensor(take<0,2>(TileShapeQK{}));
+    Tensor tPcP = thr_mma_qk.partition_C(cP);
+    int m_block = get<0>(wg_coord);
+    tPcP.data() = tPcP.data() + E<0>{} * m_block * get<0>(TileShapeQK{});
+
+    Tensor acc_pv = partition_fragment_C(tiled_mma_pv, take<0, 2>(TileShapePV{}));
+    Tensor acc_qk = partition_fragment_C(tiled_mma_qk, take<0, 2>(TileShapeQK{}));
+
+    cutlass::fmha::collective::CollectiveSoftmax<ElementAccumulatorQK, Fusion, decltype(params)> softmax{params};
+    auto softmax_state = softmax.init(acc_pv, tiled_mma_pv);
+
+    [[maybe_unused]] Descale descale;
+    if constexpr (kIsFp8) {
+      descale = load_descale_tile(params, wg_coord, 0);
+    }
+
+    pipeline.consumer_wait(smem_pipe_read);
+    math_wg_order_barrier.wait();
+
+    // MMA QK
+    warpgroup_fence_operand(acc_qk);
+    warpgroup_arrive();
+
+    gemm_zero_acc(tiled_mma_qk, tSrQ(_,_,_,smem_pipe_read_q.index()), tSrK(_,_,_,smem_pipe_read.index()), acc_qk);
+    warpgroup_commit_batch();
+    math_wg_order_barrier.arrive();
+
+    ++smem_pipe_read;
+    auto tok = pipeline.consumer_try_wait(smem_pipe_read);
+
+    warpgroup_wait<0>();
+    warpgroup_fence_operand(acc_qk);
+
+    pipeline.consumer_release(smem_pipe_release);
+    ++smem_pipe_release;
+
+    if constexpr (kIsFp8) scale_fragment(acc_qk, descale.qk);
+
+    if constexpr (kIsMainloopLocked) math_wg_order_barrier.wait();
+    softmax.step(acc_qk, tiled_mma_qk, tPcP, softmax_state, problem_size);
+    if constexpr (kIsMainloopLocked) math_wg_order_barrier.arrive();
+
+    if constexpr (kIsFp8) scale_fragment(acc_qk, kScaleP);
+
+    Tensor acc_qk_fixed = make_acc_into_op<Element>(acc_qk, typename TiledMmaPV::LayoutA_TV{});
+
+    pipeline.consumer_wait(smem_pipe_read, tok);
+
+    // MMA PV
+    warpgroup_fence_operand(acc_pv);
+    warpgroup_fence_operand(acc_qk_fixed);
+    warpgroup_arrive();
+
+    gemm_zero_acc(tiled_mma_pv, acc_qk_fixed, tOrV(_,_,_,smem_pipe_read.index()), acc_pv);
+    warpgroup_commit_batch();
+
+    ++smem_pipe_read;
+
+    if (kIsPersistent) pipeline_q.consumer_release(smem_pipe_release_q);
+
+    warpgroup_wait<0>();
+    warpgroup_fence_operand(acc_pv);
+
+    if (kIsPersistent) pipeline.consumer_release(smem_pipe_release);
+    ++smem_pipe_release;
+
+    Tensor lse = softmax.tail(softmax_state, acc_pv, tiled_mma_pv);
+
+    if constexpr (kIsFp8) scale_fragment(acc_pv, descale.v / kScaleP);
+
+    return make_tuple(acc_pv, lse);
+  }
+
   template<class BlkCoord, class ProblemShape, class MainloopPipelineReducer, class PipelineStateReducer, class MathWgOrderBarrier>
   CUTLASS_DEVICE auto
   compute(
@@ -347,6 +587,11 @@ struct FmhaMainloopTmaWarpSpecialized {
       SharedStorage& storage,
       MathWgOrderBarrier& math_wg_order_barrier)
   {
+    if constexpr (kIsSinglePass) {
+      return compute_single_pass(blk_coord, wg_coord, params, problem_size,
+          pipeline, smem_pipe_read, pipeline_q, smem_pipe_read_q, storage, math_wg_order_barrier);
+    }
+
     int thread_idx = int(threadIdx.x);
 
     PipelineState smem_pipe_release = smem_pipe_read;
@@ -390,9 +635,18 @@ struct FmhaMainloopTmaWarpSpecialized {
     cutlass::fmha::collective::CollectiveSoftmax<ElementAccumulatorQK, Fusion, decltype(params)> softmax{params};
     auto softmax_state = softmax.init(acc_pv, tiled_mma_pv);
 
+    // index of the current KV tile and the V descale factor O is kept in (fp8 only)
+    int k_tile = 0;
+    [[maybe_unused]] float descale_v = 1.0f;
+
     if (true)
     {
         --k_tile_count;
+        [[maybe_unused]] Descale descale;
+        if constexpr (kIsFp8) {
+          descale = load_descale_tile(params, wg_coord, k_tile);
+          descale_v = descale.v;
+        }
         // Allocate QK acc
         Tensor acc_qk = partition_fragment_C(tiled_mma_qk, take<0, 2>(TileShapeQK{}));
   
@@ -413,7 +667,11 @@ struct FmhaMainloopTmaWarpSpecialized {
         warpgroup_wait<0>();
         warpgroup_fence_operand(acc_qk);
 
+        if constexpr (kIsFp8) scale_fragment(acc_qk, descale.qk);
+
         softmax.step(acc_qk, tiled_mma_qk, tPcP, softmax_state, problem_size);
+
+        if constexpr (kIsFp8) scale_fragment(acc_qk, kScaleP);
   
         Tensor acc_qk_fixed = make_acc_into_op<Element>(acc_qk, typename TiledMmaPV::LayoutA_TV{});
   
@@ -433,12 +691,15 @@ struct FmhaMainloopTmaWarpSpecialized {
         // Advance consumer pipeline
         ++smem_pipe_read;
         tPcP.data() = tPcP.data() + E<1>{} * get<1>(TileShapeQK{});
+        ++k_tile;
     }
   
     CUTLASS_PRAGMA_NO_UNROLL
     while (k_tile_count > 0)
     {
         --k_tile_count;
+        [[maybe_unused]] Descale descale;
+        if constexpr (kIsFp8) descale = load_descale_tile(params, wg_coord, k_tile);
 
         // Allocate QK acc
         Tensor acc_qk = partition_fragment_C(tiled_mma_qk, take<0, 2>(TileShapeQK{}));
@@ -460,10 +721,17 @@ struct FmhaMainloopTmaWarpSpecialized {
         warpgroup_fence_operand(acc_qk);
         warpgroup_fence_operand(acc_pv);
 
+        if constexpr (kIsFp8) scale_fragment(acc_qk, descale.qk);
+
         if constexpr (kIsMainloopLocked) math_wg_order_barrier.wait();
         softmax.template step<false>(acc_qk, tiled_mma_qk, tPcP, softmax_state, acc_pv, tiled_mma_pv, problem_size);
         if constexpr (kIsMainloopLocked) math_wg_order_barrier.arrive();
 
+        if constexpr (kIsFp8) {
+          scale_fragment(acc_qk, kScaleP);
+          descale_pv_block(acc_pv, descale_v, descale.v);
+        }
+
         Tensor acc_qk_fixed = make_acc_into_op<Element>(acc_qk, typename TiledMmaPV::LayoutA_TV{});
   
         pipeline.consumer_wait(smem_pipe_read, tok);
@@ -484,6 +752,7 @@ struct FmhaMainloopTmaWarpSpecialized {
 
         ++smem_pipe_read;
         tPcP.data() = tPcP.data() + E<1>{} * get<1>(TileShapeQK{});
+        ++k_tile;
     }
 
     k_tile_count += Fusion{}.get_masked_trip_count(blk_coord, TileShape{}, problem_size);
@@ -492,6 +761,8 @@ struct FmhaMainloopTmaWarpSpecialized {
     while (k_tile_count > 0)
     {
         --k_tile_count;
+        [[maybe_unused]] Descale descale;
+        if constexpr (kIsFp8) descale = load_descale_tile(params, wg_coord, k_tile);
 
         // Allocate QK acc
         Tensor acc_qk = partition_fragment_C(tiled_mma_qk, take<0, 2>(TileShapeQK{}));
@@ -513,6 +784,8 @@ struct FmhaMainloopTmaWarpSpecialized {
         warpgroup_fence_operand(acc_qk);
         warpgroup_fence_operand(acc_pv);
 
+        if constexpr (kIsFp8) scale_fragment(acc_qk, descale.qk);
+
         //if constexpr (kIsPersistent)
         //  if (k_tile_count == 0) pipeline_q.consumer_release(smem_pipe_release_q);
 
@@ -520,6 +793,11 @@ struct FmhaMainloopTmaWarpSpecialized {
         softmax.step(acc_qk, tiled_mma_qk, tPcP, softmax_state, acc_pv, tiled_mma_pv, problem_size);
         if constexpr (kIsMainloopLocked) math_wg_order_barrier.arrive();
 
+        if constexpr (kIsFp8) {
+          scale_fragment(acc_qk, kScaleP);
+          descale_pv_block(acc_pv, descale_v, descale.v);
+        }
+
         Tensor acc_qk_fixed = make_acc_into_op<Element>(acc_qk, typename TiledMmaPV::LayoutA_TV{});
   
         pipeline.consumer_wait(smem_pipe_read, tok);
@@ -540,6 +818,7 @@ struct FmhaMainloopTmaWarpSpecialized {
 
         ++smem_pipe_read;
         tPcP.data() = tPcP.data() + E<1>{} * get<1>(TileShapeQK{});
+        ++k_tile;
     }
 
     if (kIsPersistent) pipeline_q.consumer_release(smem_pipe_release_q);
@@ -553,6 +832,8 @@ struct FmhaMainloopTmaWarpSpecialized {
 
     Tensor lse = softmax.tail(softmax_state, acc_pv, tiled_mma_pv);
 
+    if constexpr (kIsFp8) scale_fragment(acc_pv, descale_v / kScaleP);
+
     return make_tuple(acc_pv, lse);
   }
 };
@@ -0,0 +1,132 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cute/tensor.hpp"
+
+namespace cutlass::fmha::collective {
+
+using namespace cute;
+
+enum class RopeMode {
+  kNone,
+  // rotates the column pairs (2i, 2i+1) of the head dim
+  kInterleaved,
+  // rotates the column pairs (i, i + head_dim/2) of the head dim
+  kHalf
+};
+
+// Rotary position embedding, applied to Q and K on their way into shared memory
+struct Rope {
+  RopeMode mode = RopeMode::kNone;
+  // [position, head_dim/2] tables, if null the angle of pair i is pos * theta^(-2i/head_dim)
+  const float* ptr_cos = nullptr;
+  const float* ptr_sin = nullptr;
+  float theta = 10000.0f;
+
+  CUTLASS_HOST_DEVICE bool is_enabled() const {
+    return mode != RopeMode::kNone;
+  }
+
+  // the column that is rotated together with column d
+  CUTLASS_HOST_DEVICE int partner(int d, int head_dim) const {
+    if (mode == RopeMode::kInterleaved) {
+      return d ^ 1;
+    }
+    return d < head_dim / 2 ? d + head_dim / 2 : d - head_dim / 2;
+  }
+
+  // value of column d after the rotation, where y is the value of its partner column
+  CUTLASS_HOST_DEVICE float rotate(float x, float y, int pos, int d, int head_dim) const {
+    bool is_first = mode == RopeMode::kInterleaved ? (d % 2 == 0) : (d < head_dim / 2);
+    int i = mode == RopeMode::kInterleaved ? d / 2 : d % (head_dim / 2);
+    float c, s;
+    if (ptr_cos != nullptr) {
+      c = ptr_cos[pos * (head_dim / 2) + i];
+      s = ptr_sin[pos * (head_dim / 2) + i];
+    }
+    else {
+      float angle = pos * powf(theta, -2.0f * i / head_dim);
+      c = cosf(angle);
+      s = sinf(angle);
+    }
+    return is_first ? x * c - y * s : x * c + y * s;
+  }
+};
+
+// Writes the tile gX rotated into sX with all threads of the calling warp, cX maps the
+// elements of sX to (row, column) of gX. Rows from row_bound on are zero, as TMA would
+// fill them, and pos_offset is the position of row 0. store(row, column, value) sees
+// every rotated element, e.g. to also write it back to a cache.
+template<class TensorG, class TensorS, class TensorC, class Store>
+CUTLASS_DEVICE void copy_rope(
+    Rope const& rope, TensorG const& gX, TensorS&& sX, TensorC const& cX,
+    int row_bound, int head_dim, int pos_offset, Store const& store) {
+
+  using Element = typename remove_cvref_t<TensorS>::value_type;
+
+  CUTLASS_PRAGMA_NO_UNROLL
+  for (int i = threadIdx.x % NumThreadsPerWarp; i < size(sX); i += NumThreadsPerWarp) {
+    int row = get<0>(cX(i));
+    int col = get<1>(cX(i));
+    Element value = Element(0);
+    if (row < row_bound && col < head_dim) {
+      float x = static_cast<float>(gX(row, col));
+      float y = static_cast<float>(gX(row, rope.partner(col, head_dim)));
+      value = static_cast<Element>(rope.rotate(x, y, pos_offset + row, col, head_dim));
+      store(row, col, value);
+    }
+    sX(i) = value;
+  }
+}
+
+template<class TensorG, class TensorS, class TensorC>
+CUTLASS_DEVICE void copy_rope(
+    Rope const& rope, TensorG const& gX, TensorS&& sX, TensorC const& cX,
+    int row_bound, int head_dim, int pos_offset) {
+  copy_rope(rope, gX, sX, cX, row_bound, head_dim, pos_offset, [](int, int, auto) {});
+}
+
+// Signals a tile written by copy_rope on the barrier its TMA load would have signaled,
+// once the generic proxy writes of the warp are visible to the tensor cores
+CUTLASS_DEVICE void commit_rope(uint64_t* barrier, uint32_t transaction_bytes, bool is_leader) {
+  cutlass::arch::fence_view_async_shared();
+  __syncwarp();
+  if (is_leader) {
+    __threadfence_block();
+    cutlass::arch::ClusterTransactionBarrier::complete_transaction(
+        barrier, cute::block_rank_in_cluster(), transaction_bytes);
+  }
+}
+
+}  // namespace cutlass::fmha::collective
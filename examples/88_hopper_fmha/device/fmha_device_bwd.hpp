@@ -86,6 +86,10 @@ public:
     cute::tuple<int, int, int, cute::_1> stride_dV;
 
     cutlass::KernelHardwareInfo hw_info;
+
+    // Number of K/V heads for grouped query attention, K, V, dK and dV hold this many heads.
+    // Zero selects H of the problem size.
+    int num_heads_kv = 0;
   };
 
   using OperationSumOdO = cutlass::device::Universal<cutlass::fmha::kernel::FmhaKernelBwdSumOdO<Element, ElementAccumulator>>;
@@ -143,20 +147,28 @@ private:
     };
   }
 
+  static int get_num_heads_kv(Arguments const& args) {
+    return args.num_heads_kv == 0 ? get<1>(args.problem_size) : args.num_heads_kv;
+  }
+
   static typename Operation::Arguments to_bwd_arguments(
       Arguments const& args,
       ElementAccumulator* sum_OdO = nullptr, cute::tuple<int, int, _1> const& stride_sum_OdO = {},
       ElementAccumulator* dQ_acc = nullptr, cute::tuple<int, int, int, _1> const& stride_dQ = {}
   ) {
+    // The kernel runs one CTA per K/V head and tile, which walks all query heads of the group
+    auto [B, H, Q, K, D] = args.problem_size;
+    int H_K = get_num_heads_kv(args);
     return typename Operation::Arguments{
-      args.problem_size,
+      cute::make_tuple(B, H_K, Q, K, D),
       { args.ptr_Q, args.stride_Q,
         args.ptr_K, args.stride_K,
         args.ptr_V, args.stride_V,
         args.ptr_dO, args.stride_dO,
         args.ptr_LSE, args.stride_LSE,
         sum_OdO, stride_sum_OdO,
-        dQ_acc, stride_dQ },
+        dQ_acc, stride_dQ,
+        H / H_K },
       { args.ptr_dK, args.stride_dK,
         args.ptr_dV, args.stride_dV },
       args.hw_info
@@ -170,6 +182,11 @@ public:
   can_implement(Arguments const& args) {
     Status status = Status::kSuccess;
 
+    int H_K = get_num_heads_kv(args);
+    if (H_K <= 0 || get<1>(args.problem_size) % H_K != 0) {
+      return Status::kErrorInvalidProblem;
+    }
+
     status = OperationSumOdO::can_implement(to_sum_OdO_arguments(args));
     if (status != Status::kSuccess) {
       return status;
@@ -37,6 +37,7 @@
 #include "../kernel/fmha_kernel_tma.hpp"
 #include "../kernel/fmha_kernel_tma_warpspecialized.hpp"
 #include "../kernel/fmha_options.hpp"
+#include "../kernel/fmha_causal_tile_scheduler.hpp"
 
 namespace cutlass::fmha::kernel {
 
@@ -111,11 +112,18 @@ struct FmhaBuilder<
       TileShape, LayoutQ, LayoutK, LayoutV,
       Fusion, Options...>;
 
+  // O defaults to the input type; fp8 kernels can write it in 16 bits instead
+  using ElementOut = find_option_t<Tag::kElementOut, Element, Options...>;
+
   using CollectiveEpilogue = cutlass::fmha::collective::FmhaFwdEpilogue<
-      Element, ElementAccumulatorPV, typename CollectiveMainloop::TileShapePV>;
+      ElementOut, ElementAccumulatorPV, typename CollectiveMainloop::TileShapePV>;
 
   static constexpr bool kIsPersistent = find_option_t<Tag::kIsPersistent, false_type, Options...>::value;
-  using TileScheduler = std::conditional_t<kIsPersistent, cutlass::fmha::kernel::PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>;
+  // causal q blocks get longer with their index, balance them across the persistent CTAs
+  using PersistentTileScheduler = std::conditional_t<std::is_base_of_v<cutlass::fmha::collective::CausalFusion, Fusion>,
+      cutlass::fmha::kernel::CausalPersistentTileScheduler,
+      cutlass::fmha::kernel::PersistentTileScheduler>;
+  using TileScheduler = std::conditional_t<kIsPersistent, PersistentTileScheduler, cutlass::fmha::kernel::IndividualTileScheduler>;
 
   using Kernel = cutlass::fmha::kernel::FmhaKernelTmaWarpSpecialized<CollectiveMainloop, CollectiveEpilogue, TileScheduler, Options...>;
 };
@@ -143,7 +151,7 @@ struct FmhaBuilder<
   cutlass::gemm::KernelTmaWarpSpecializedPingpong,
   Options...
 > {
-  using Kernel = typename FmhaBuilder<
+  using Cooperative = FmhaBuilder<
       Element, ElementAccumulatorQK, ElementAccumulatorPV,
       TileShape,
       LayoutQ, LayoutK, LayoutV,
@@ -152,7 +160,10 @@ struct FmhaBuilder<
       Options...,
       Option<Tag::kIsPersistent, true_type>,
       Option<Tag::kLoadsQSeparately, true_type>
-  >::Kernel;
+  >;
+
+  using CollectiveMainloop = typename Cooperative::CollectiveMainloop;
+  using Kernel = typename Cooperative::Kernel;
 };
 
 }  // namespace cutlass::fmha::kernel
@@ -71,7 +71,10 @@ enum class Tag {
   kBlocksPerSM,
   kClusterM,
 
-  kAccQK
+  kAccQK,
+  kElementOut,
+
+  kIsSinglePass
 };
 
 template<auto kTag, class Value>
@@ -36,9 +36,9 @@
 #include <cmath>
 #include "cutlass/util/device_memory.h"
 
-template<typename Element>
+template<typename Element, typename ElementRef>
 __global__ void reference_abs_diff_kernel(
-    Element* data, Element* data_ref, size_t count,
+    Element* data, ElementRef* data_ref, size_t count,
     double* max_diff, double* sum_diff,
     bool print_diff
 ) {
@@ -49,7 +49,7 @@ __global__ void reference_abs_diff_kernel(
     __shared__ double block_sum_diff;
 
     for (size_t i = threadIdx.x + blockIdx.x * blockDim.x; i < count; i += blockDim.x * gridDim.x) {
-      double diff = fabs(data[i] - data_ref[i]);
+      double diff = fabs(static_cast<double>(data[i]) - static_cast<double>(data_ref[i]));
       if (print_diff) if (diff != diff || diff > 0.01f) printf("difference at %lld: %f ... %f vs %f\n", static_cast<long long int>(i), diff, (double)data[i], (double)data_ref[i]);
       thread_max_diff = fmax(diff, thread_max_diff);
       thread_sum_diff += diff;
@@ -81,10 +81,10 @@ __global__ void reference_abs_diff_kernel(
    }
 }
 
-template<typename Element>
+template<typename Element, typename ElementRef>
 void reference_abs_diff(
     cutlass::DeviceAllocation<Element> const& data,
-    cutlass::DeviceAllocation<Element> const& data_ref,
+    cutlass::DeviceAllocation<ElementRef> const& data_ref,
     double& max_diff, double& mean_diff
 ) {
   static bool kPrintDiff = getenv("REF_PRINT_DIFF") && atoi(getenv("REF_PRINT_DIFF")) == 1;
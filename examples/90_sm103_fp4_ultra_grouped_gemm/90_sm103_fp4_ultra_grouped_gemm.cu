@@ -60,6 +60,10 @@
         3 256x256x128
         4 256x512x1024
         5 1024x512x128 and so on
+
+    Enabling SF Output (see the "Enable for SF Output" lines) keeps an MoE expert FFN in FP4 end-to-end.
+    The epilogue then scales each output row by the routing weight of its token and generates NVFP4 D
+    along with its scale factors, so D can feed the next expert GEMM directly.
 */
 
 #include <iostream>
@@ -128,14 +132,17 @@ using ElementAccumulator  = float;                                          // E
 // using ElementD = cutlass::float_e2m1_t; // Enable for SF Output          // Element type for D matrix operands
 
 using ElementSFD  = cutlass::float_ue4m3_t;                                 // Element type for SF Output operands
+using ElementRoutingWeight = float;                                         // Element type for the per-token routing weights
 constexpr int OutputSFVectorSize = 16;
-using FusionOperation = cutlass::epilogue::fusion::LinCombEltActBlockScaleFactor<
-    cutlass::epilogue::thread::SiLu,
+// D = routing_weight * (alpha * acc + beta * C), quantized to D with generated block scale factors
+using FusionOperation = cutlass::epilogue::fusion::LinCombEltActRowScaleBlockScaleFactor<
+    cutlass::epilogue::thread::Identity,
     OutputSFVectorSize,
     ElementD,
     ElementAccumulator,
     ElementSFD,
     LayoutC,
+    ElementRoutingWeight,
     ElementC>;
 
 // Core kernel configurations
@@ -246,6 +253,7 @@ using HostTensorB = cutlass::HostTensor<typename Gemm::ElementB, cutlass::layout
 using HostTensorSF = cutlass::HostTensor<typename Gemm::GemmKernel::ElementSF, cutlass::layout::PackedVectorLayout>;
 using HostTensorC = cutlass::HostTensor<typename Gemm::ElementC, cutlass::layout::PackedVectorLayout>;
 using HostTensorD = cutlass::HostTensor<typename Gemm::EpilogueOutputOp::ElementOutput, cutlass::layout::PackedVectorLayout>;
+using HostTensorRoutingWeight = cutlass::HostTensor<ElementRoutingWeight, cutlass::layout::PackedVectorLayout>;
 std::vector<HostTensorA> block_A;
 std::vector<HostTensorB> block_B;
 std::vector<HostTensorSF> block_SFA;
@@ -254,6 +262,7 @@ std::vector<HostTensorC> block_C;
 std::vector<HostTensorD> block_D;
 std::vector<HostTensorSF> block_SFD;
 std::vector<HostTensorD> block_ref_D;
+std::vector<HostTensorRoutingWeight> block_routing_weight;
 
 // Device-side allocations
 cutlass::DeviceAllocation<typename ProblemShape::UnderlyingProblemShape> problem_sizes;
@@ -266,6 +275,8 @@ cutlass::DeviceAllocation<const typename Gemm::ElementC *> ptr_C;
 cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput *> ptr_D;
 cutlass::DeviceAllocation<typename Gemm::GemmKernel::ElementSF *> ptr_SFD;
 cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput *> ptr_ref_D;
+// One routing weight per row (token) of each group
+cutlass::DeviceAllocation<const ElementRoutingWeight *> ptr_routing_weight;
 
 cutlass::DeviceAllocation<StrideA> stride_A;
 cutlass::DeviceAllocation<StrideB> stride_B;
@@ -577,6 +588,7 @@ void allocate(const Options &options) {
     block_D.push_back(HostTensorD(cutlass::make_Coord(size(layout_D))));
     block_SFD.push_back(HostTensorSF(cutlass::make_Coord(size(filter_zeros(layout_SFD)))));
     block_ref_D.push_back(HostTensorD(cutlass::make_Coord(size(layout_D))));
+    block_routing_weight.push_back(HostTensorRoutingWeight(cutlass::make_Coord(M)));
   }
   block_alpha.reset(options.groups);
   block_beta.reset(options.groups);
@@ -604,6 +616,7 @@ void initialize(const Options &options) {
   std::vector<typename Gemm::GemmKernel::ElementSF *> ptr_SFD_host(options.groups);
   std::vector<ElementAccumulator *> ptr_alpha_host(options.groups);
   std::vector<ElementAccumulator *> ptr_beta_host(options.groups);
+  std::vector<const ElementRoutingWeight *> ptr_routing_weight_host(options.groups);
 
   std::cout << "    Initializing tensor data for " << options.groups << " groups..." << std::endl;
   for (int32_t i = 0; i < options.groups; ++i) {
@@ -614,12 +627,15 @@ void initialize(const Options &options) {
     initialize_block(block_C.at(i).host_view(), seed + 2023);
     initialize_block(block_SFA.at(i).host_view(), seed + 2024);
     initialize_block(block_SFB.at(i).host_view(), seed + 2025);
+    // Top-k routing weights are softmax probabilities in (0, 1]
+    cutlass::reference::host::TensorFillRandomUniform(block_routing_weight.at(i).host_view(), seed + 2026, 1, 0, 4);
 
     block_A.at(i).sync_device();
     block_B.at(i).sync_device();
     block_C.at(i).sync_device();
     block_SFA.at(i).sync_device();
     block_SFB.at(i).sync_device();
+    block_routing_weight.at(i).sync_device();
 
     ptr_A_host.at(i) = block_A.at(i).device_data();
     ptr_B_host.at(i) = block_B.at(i).device_data();
@@ -628,6 +644,7 @@ void initialize(const Options &options) {
     ptr_C_host.at(i) = block_C.at(i).device_data();
     ptr_D_host.at(i) = block_D.at(i).device_data();
     ptr_SFD_host.at(i) = block_SFD.at(i).device_data();
+    ptr_routing_weight_host.at(i) = block_routing_weight.at(i).device_data();
 
     alpha_host.push_back((options.alpha == FLT_MAX) ? static_cast<ElementAccumulator>((rand() % 5) + 1) : options.alpha);
     beta_host.push_back((options.beta == FLT_MAX) ? static_cast<ElementAccumulator>(rand() % 5) : options.beta);
@@ -657,6 +674,9 @@ void initialize(const Options &options) {
   ptr_SFD.reset(options.groups);
   ptr_SFD.copy_from_host(ptr_SFD_host.data());
 
+  ptr_routing_weight.reset(options.groups);
+  ptr_routing_weight.copy_from_host(ptr_routing_weight_host.data());
+
   stride_A.reset(options.groups);
   stride_A.copy_from_host(stride_A_host.data());
 
@@ -738,6 +758,7 @@ typename Gemm::Arguments args_from_options(Options &options, bool host_problem_s
   // Output Block SF
   // fusion_args.block_scale_factor_ptr = ptr_SFD.get();          // Enable for SF Output
   // fusion_args.norm_constant_ptr = norm_constant_device.get();  // Enable for SF Output
+  // fusion_args.row_scale_ptr_array = ptr_routing_weight.get();  // Enable for SF Output
 
   typename Gemm::GemmKernel::TileSchedulerArguments scheduler;
   scheduler.raster_order = options.raster_order;
@@ -206,6 +206,8 @@ std::vector<ElementAccumulator> beta_host;
 
 // Device-side allocations
 cutlass::DeviceAllocation<int32_t> tokens_per_expert;
+// Exclusive prefix sum of tokens_per_expert, only used with --use_token_offsets
+cutlass::DeviceAllocation<int64_t> token_offsets;
 
 cutlass::DeviceAllocation<typename Gemm::ElementA> block_A;
 cutlass::DeviceAllocation<typename Gemm::ElementB> block_B;
@@ -243,6 +245,7 @@ struct Options {
   bool help = false;
   bool use_pdl = false;
   bool sparse_test = false;
+  bool use_token_offsets = false;
 
   float alpha = FLT_MAX;
   float beta  = FLT_MAX;
@@ -271,6 +274,9 @@ struct Options {
     if (cmd.check_cmd_line_flag("use_pdl")) {
       use_pdl = true;
     }
+    if (cmd.check_cmd_line_flag("use_token_offsets")) {
+      use_token_offsets = true;
+    }
     if (cmd.check_cmd_line_flag("sparse_test")) {
       sparse_test = true;
       cmd.get_cmd_line_argument("sparse_prob", sparse_prob);
@@ -452,7 +458,8 @@ struct Options {
       << "  --iterations=<int>                                           Number of profiling iterations to perform\n\n"
       << "  --benchmark=<str>                                            Executes a benchmark problem size\n"
       << "  --max_sm_count=<int>                                         Run kernels using only these number of SMs\n"
-      << "  --use_pdl                                                    Launch kernel with PDL (Programmatic Dependent Launch) enabled\n";
+      << "  --use_pdl                                                    Launch kernel with PDL (Programmatic Dependent Launch) enabled\n"
+      << "  --use_token_offsets                                          Address B/C/D through device token offsets instead of per-group pointer arrays\n";
                                                                                              
     out
       << "\n\nExamples:\n\n"
@@ -572,6 +579,17 @@ void initialize(const Options &options) {
   tokens_per_expert.reset(options.tokens_per_expert_host.size());
   tokens_per_expert.copy_from_host(options.tokens_per_expert_host.data());
 
+  // Token offsets locate each expert within the contiguous B/C/D allocations.
+  // In an MoE layer these come straight from the router's scan, so no pointer arrays are rebuilt per launch.
+  std::vector<int64_t> token_offsets_host(options.groups);
+  int64_t total_tokens = 0;
+  for (int32_t i = 0; i < options.groups; ++i) {
+    token_offsets_host.at(i) = total_tokens;
+    total_tokens += options.tokens_per_expert_host.at(i);
+  }
+  token_offsets.reset(options.groups);
+  token_offsets.copy_from_host(token_offsets_host.data());
+
   //
   // Assign pointers
   //
@@ -673,13 +691,24 @@ typename Gemm::Arguments args_from_options(Options &options)
   typename Gemm::GemmKernel::TileSchedulerArguments scheduler;
   scheduler.raster_order = options.raster_order;
 
-  arguments = typename Gemm::Arguments {
-    cutlass::gemm::GemmUniversalMode::kGrouped,
-    {options.m, options.n, options.k, options.groups, tokens_per_expert.get()},
-    {block_A.get(), ptr_B.get()},
-    {fusion_args, ptr_C.get(), nullptr, ptr_D.get(), nullptr},
-    hw_info, scheduler
-  };
+  if (options.use_token_offsets) {
+    arguments = typename Gemm::Arguments {
+      cutlass::gemm::GemmUniversalMode::kGrouped,
+      {options.m, options.n, options.k, options.groups, tokens_per_expert.get(), nullptr, token_offsets.get()},
+      {block_A.get(), nullptr, {}, {}, block_B.get()},
+      {fusion_args, nullptr, nullptr, nullptr, nullptr, block_C.get(), block_D.get()},
+      hw_info, scheduler
+    };
+  }
+  else {
+    arguments = typename Gemm::Arguments {
+      cutlass::gemm::GemmUniversalMode::kGrouped,
+      {options.m, options.n, options.k, options.groups, tokens_per_expert.get()},
+      {block_A.get(), ptr_B.get()},
+      {fusion_args, ptr_C.get(), nullptr, ptr_D.get(), nullptr},
+      hw_info, scheduler
+    };
+  }
 
   return arguments;
 }
@@ -40,6 +40,11 @@
     kvL is max_seq_len, seq_lens[BS] is the actual seq len for each batch
     sinks has shape (qHLocal * kvH), i.e. one sink per q head
 
+  --qL > 1 is MTP (speculative decoding): qL draft tokens per batch, whose K/V are the last qL entries of the KV cache.
+    A draft token sees the whole KV cache before the drafts, and among the drafts only itself and its ancestors,
+    i.e. causal by default or a random draft tree with --tree (tree_mask[q] has bit j set if draft q sees draft j).
+    The drafts of a GQA group are packed together into the BMM N dimension (CTA_qHLocal * CTA_qL).
+
   --mode 1 enables the paged variant:
     Combined KV cache shape (num_pages_total, 2, Page_Size, kvH, dH), with BS folded into num_pages_total
       and KV(_,0,_,_,_) = K, KV(_,1,_,_,_) = V.
@@ -48,6 +53,7 @@
   Example usage:
     $ ./examples/93_blackwell_low_latency_gqa --kvL 8192 --kvH 8 --qH 64 --BS 1
     $ ./examples/93_blackwell_low_latency_gqa --kvL 8192 --kvH 8 --qH 64 --BS 1 --mode 1
+    $ ./examples/93_blackwell_low_latency_gqa --kvL 8192 --kvH 8 --qH 64 --BS 1 --qL 4 --tree
 */
 
 // Standard library includes
@@ -88,6 +94,7 @@ using namespace cute;
 // O (dH, (qHLocal, qL), kvH, BS)
 // seq_lens (BS)
 // Sinks ((qHLocal, qL), kvH)
+// tree_mask (qL), nullptr for a causal mask among the qL draft tokens
 template <
   class TypeAcc,
   int CTA_kvL,
@@ -106,7 +113,8 @@ reference_gqa(
   int* seq_lens,
   TensorSinks const& tensor_Sinks,
   float softmax_scale,
-  int sliding_window_size) {
+  int sliding_window_size,
+  const uint32_t* tree_mask) {
 
   using TypeQKV = typename TensorQ::element_type;
   using TypeO = typename TensorO::element_type;
@@ -176,7 +184,10 @@ reference_gqa(
               for (int _dH = 0; _dH < dH; ++_dH) {
                 acc += tensor_K(_kvL, _dH, _kvH, _BS) * tensor_Q(make_coord(_qHLocal, _qL), _dH, _kvH, _BS);
               }
-              tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) =  (_kvL < kvL_start) ? -INFINITY : (acc * softmax_scale_log2);
+              // MTP draft mask, the last qL keys are the drafts, draft _qL only sees the drafts on its path
+              int draft_idx = _kvL - (seq_len - qL);
+              bool visible = (draft_idx < 0) || ((tree_mask != nullptr) ? ((tree_mask[_qL] >> draft_idx) & 1) : (draft_idx <= _qL));
+              tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) =  (_kvL < kvL_start || !visible) ? -INFINITY : (acc * softmax_scale_log2);
             }
           }
         }
@@ -209,8 +220,11 @@ reference_gqa(
             int start = _kvBlock * CTA_kvL;
             int end = std::min(start + CTA_kvL, seq_len);
             assert(start < end);
+            // a block can be fully masked by the draft mask, use 0 as its max so p is 0 instead of nan
+            TypeAcc fmax = tensor_Fmax(_kvBlock, make_coord(_qHLocal, _qL), _kvH, _BS);
+            fmax = (fmax == -INFINITY) ? TypeAcc(0.f) : fmax;
             for (int _kvL = start; _kvL < end; ++_kvL) {
-              tensor_P(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) = std::exp2f(tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) - tensor_Fmax(_kvBlock, make_coord(_qHLocal, _qL), _kvH, _BS));
+              tensor_P(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) = std::exp2f(tensor_Acc1(_kvL, make_coord(_qHLocal, _qL), _kvH, _BS) - fmax);
             }
           }
         }
@@ -495,6 +509,9 @@ public:
   using TypeAcc = float;
   static constexpr int CTA_qHLocal = 8;
   static constexpr int CTA_qL = 1;
+  // MTP packs CTA_qL_MTP draft tokens of the GQA group into one CTA, i.e. BMM N = CTA_qHLocal * CTA_qL_MTP,
+  // so the drafts share one pass over the KV cache instead of each reloading it in its own CTA
+  static constexpr int CTA_qL_MTP = 2;
   static constexpr int CTA_kvL = 128;
   static constexpr int CTA_dH = 64;
   // Page_Size only used by gqa_paged (mode 1). Page_Size must divide CTA_kvL; CTA_kvL/Page_Size = pages per CTA tile.
@@ -516,6 +533,7 @@ private:
   ProblemStride stride_;
   int sliding_window_size_;
   int mode_; // 0: gqa, 1: gqa_paged
+  bool tree_; // MTP draft tree mask instead of causal among the qL draft tokens
 
   // Host vectors
   thrust::host_vector<TypeQKV> host_Q_;
@@ -525,6 +543,7 @@ private:
   thrust::host_vector<TypeO> host_reference_O_;
   thrust::host_vector<int> host_seq_lens_;
   thrust::host_vector<TypeAcc> host_sinks_;
+  thrust::host_vector<uint32_t> host_tree_mask_;
 
   // Device vectors
   thrust::device_vector<TypeQKV> device_Q_;
@@ -543,6 +562,7 @@ private:
   thrust::device_vector<TypeO> device_O_;
   thrust::device_vector<int> device_seq_lens_;
   thrust::device_vector<TypeAcc> device_sinks_;
+  thrust::device_vector<uint32_t> device_tree_mask_;
 
   // Build the host-side page table: tail-padded buffer with shape (kvL/Page_Size, BS) and contents = a random
   // per-batch slice of a Fisher-Yates shuffle of [0, num_pages_total). Each batch's slice length is
@@ -600,9 +620,10 @@ private:
   }
 
 public:
-  GQATester(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, int mode = 0) :
-  kvH_(kvH), qHLocal_(qH / kvH), qL_(qL), kvL_(kvL), dH_(dH), BS_(BS), softmax_scale_(softmax_scale), sliding_window_size_(sliding_window_size), mode_(mode) {
+  GQATester(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, int mode = 0, bool tree = false) :
+  kvH_(kvH), qHLocal_(qH / kvH), qL_(qL), kvL_(kvL), dH_(dH), BS_(BS), softmax_scale_(softmax_scale), sliding_window_size_(sliding_window_size), mode_(mode), tree_(tree) {
     assert(sliding_window_size_ >= 0);
+    assert(qL_ >= 1 && qL_ <= 32 && qL_ <= kvL_);
     // Allocate host memory
     host_Q_.resize(kvH_ * qHLocal_ * qL_ * dH_ * BS_);
     host_K_.resize(kvH_ * kvL_ * dH_ * BS_);
@@ -635,6 +656,12 @@ public:
     for (int i = 0; i < qHLocal_ * kvH_; ++i) {
       host_sinks_[i] = rand() / (float)RAND_MAX;
     }
+    // random draft tree, draft 0 is the root and every later draft hangs off an earlier one
+    // each draft sees itself and the chain of its ancestors
+    host_tree_mask_.resize(qL_);
+    for (int i = 0; i < qL_; ++i) {
+      host_tree_mask_[i] = (i == 0 ? 0u : host_tree_mask_[rand() % i]) | (1u << i);
+    }
 
     // Allocate device memory and copy H2D
     device_Q_ = host_Q_;
@@ -643,6 +670,7 @@ public:
     device_O_.resize(kvH_ * qHLocal_ * qL_ * dH_ * BS_);
     device_seq_lens_ = host_seq_lens_;
     device_sinks_ = host_sinks_;
+    device_tree_mask_ = host_tree_mask_;
 
     // For paged mode, build the page_table and combined KV tensor on device. The harness owns the layouts:
     // stride_KV_* and stride_PT_* were computed in make_gqa_stride above and are used both here (host pack)
@@ -676,10 +704,21 @@ public:
   }
 
     void run_kernel(bool pdl, int pdl_count = -1, cudaStream_t stream = 0) {
+      if (qL_ > 1) {
+        run_kernel_impl<CTA_qL_MTP>(pdl, pdl_count, stream);
+      }
+      else {
+        run_kernel_impl<CTA_qL>(pdl, pdl_count, stream);
+      }
+    }
+
+    template <int CTA_qL_>
+    void run_kernel_impl(bool pdl, int pdl_count, cudaStream_t stream) {
+      uint32_t const* device_ptr_tree_mask = tree_ ? device_tree_mask_.data().get() : nullptr;
       if (mode_ == 0) {
         TGV::gqa::gqa_host<
           TypeQKV, TypeO, TypeAcc,
-          CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH,
+          CTA_qHLocal, CTA_qL_, CTA_kvL, CTA_dH,
           BMM1_DMA_Stage, BMM2_DMA_Stage,
           MaxSplits,
           NumReductionCTA>(
@@ -693,12 +732,13 @@ public:
           stride_.stride_O_kvH, stride_.stride_O_qHLocal, stride_.stride_O_qL, stride_.stride_O_dH, stride_.stride_O_BS,
           softmax_scale_,
           sliding_window_size_,
+          device_ptr_tree_mask,
           pdl, pdl_count, stream);
       }
       else {
         TGV::gqa_paged::gqa_paged_host<
           TypeQKV, TypeO, TypeAcc,
-          CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH,
+          CTA_qHLocal, CTA_qL_, CTA_kvL, CTA_dH,
           Page_Size,
           BMM1_DMA_Stage, BMM2_DMA_Stage,
           Page_Idx_Stage, Num_Page_Idx_Per_Stage,
@@ -717,6 +757,7 @@ public:
           stride_.stride_PT_p, stride_.stride_PT_BS,
           softmax_scale_,
           sliding_window_size_,
+          device_ptr_tree_mask,
           pdl, pdl_count, stream);
       }
     }
@@ -750,7 +791,8 @@ public:
 
       // Execute reference GQA kernel
       reference_gqa<TypeAcc, CTA_kvL, NoSink>(
-        host_tensor_K, host_tensor_Q, host_tensor_V, host_reference_tensor_O, host_seq_lens_.data(), host_tensor_sinks, softmax_scale_, sliding_window_size_);
+        host_tensor_K, host_tensor_Q, host_tensor_V, host_reference_tensor_O, host_seq_lens_.data(), host_tensor_sinks, softmax_scale_, sliding_window_size_,
+        tree_ ? host_tree_mask_.data() : nullptr);
 
       // Compare results using torch.allclose semantics
       // For bfloat16, use more relaxed tolerances due to reduced precision
@@ -767,9 +809,12 @@ public:
 
 };
 
-void benchmark_gqa(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, int mode, bool pdl, int pdl_count, int num_testers = 4, int bench_iters = 100) {
+void benchmark_gqa(int kvH, int qH, int qL, int kvL, int dH, int BS, float softmax_scale, int sliding_window_size, int mode, bool tree, bool pdl, int pdl_count, int num_testers = 4, int bench_iters = 100) {
   std::cout << "=== GQA Benchmark ===" << std::endl;
-  std::cout << "Problem size: kvH=" << kvH << ", qH=" << qH << ", qL=" << qL << ", kvL=" << kvL << ", dH=" << dH << ", BS=" << BS << ", sliding_window_size=" << sliding_window_size << std::endl;
+  std::cout << "Problem size: kvH=" << kvH << ", qH=" << qH << ", qL=" << qL << ", kvL=" << kvL << ", dH=" << dH << ", BS=" << BS << , sliding_window_size=" << sliding_window_size << std::endl;
+  if (qL > 1) {
+    std::cout << "MTP: " << qL << " draft tokens, " << (tree ? "tree" : "causal") << " draft mask" << std::endl;
+  }
   std::cout << "Mode: " << mode << " (" << (mode == 0 ? "gqa" : "gqa_paged") << ")" << std::endl;
   std::cout << "Number of testers (L2 thrashing): " << num_testers << std::endl;
   std::cout << "Benchmark iterations: " << bench_iters << std::endl;
@@ -777,7 +822,7 @@ void benchmark_gqa(int kvH, int qH, int qL, int kvL, int dH, int BS, float softm
   // Create multiple tester instances to thrash L2 cache
   std::vector<std::unique_ptr<GQATester>> testers;
   for (int i = 0; i < num_testers; ++i) {
-    testers.push_back(std::make_unique<GQATester>(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode));
+    testers.push_back(std::make_unique<GQATester>(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode, tree));
   }
   std::cout << "Created " << num_testers << " GQATester instances" << std::endl;
 
@@ -874,6 +919,8 @@ int main(int argc, char* argv[]) {
   int pdl_count = -1;
   // 0: gqa (contiguous KV cache), 1: gqa_paged (paged KV cache)
   int mode = 0;
+  // MTP with qL > 1: random draft tree mask instead of causal among the draft tokens
+  bool tree = false;
 
   // arg parsing
   while (1) {
@@ -885,6 +932,7 @@ int main(int argc, char* argv[]) {
     {"BS",          required_argument, 0, 0},
     {"sliding_window_size", required_argument, 0, 0},
     {"mode",        required_argument, 0, 0},
+    {"tree",        no_argument,       0, 0},
     {0, 0, 0, 0} // denote end of array
     };
 
@@ -905,16 +953,17 @@ int main(int argc, char* argv[]) {
         else if (option_index == 4) BS = atoi(optarg);
         else if (option_index == 5) sliding_window_size = atoi(optarg);
         else if (option_index == 6) mode = atoi(optarg);
+        else if (option_index == 7) tree = true;
         break;
       default: assert(false);
     }
   }
 
-  GQATester tester(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode);
+  GQATester tester(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode, tree);
   bool success = tester.verify();
   std::cout << "Correctness test"
             << " mode=" << mode
             << " " << (success ? "PASSED" : "FAILED") << std::endl;
 
-  benchmark_gqa(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode, pdl, pdl_count, 100, 1000);
+  benchmark_gqa(kvH, qH, qL, kvL, dH, BS, softmax_scale, sliding_window_size, mode, tree, pdl, pdl_count, 100, 1000);
 }
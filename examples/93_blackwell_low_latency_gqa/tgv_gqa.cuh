@@ -910,6 +910,7 @@ EPILOG_warp(
   TiledBMM2 tiled_bmm2,
   float softmax_scale_log2,
   int sliding_window_size,
+  uint32_t const* tree_mask,
   cutlass::arch::NamedBarrier& epilog_barrier,
   int NumSplits,
   int tid,      // tid local to epilog warp
@@ -964,6 +965,8 @@ EPILOG_warp(
   Tensor tDsS    = thr_t2r_copy_bmm1.partition_D(tCsS);     // (CpyD, NumCpy_M, NumCpy_N), per thread slice of the Acc1/S tensor in smem, i.e. a row of the Acc1 tensor
   // allocate per thread rmem space for the Acc1, the shape is the same as the post partition shape of the output tensor
   Tensor tDrS = make_tensor<TypeAcc>(shape(tDsS));          // (CpyD, NumCpy_M, NumCpy_N), per thread slice of the Acc1/S tensor in rmem, i.e. a row of the Acc1 tensor
+  // coordinate of each element of tDrS in the (CTA_kvL, (CTA_qHLocal, CTA_qL)) tile, used to find the q token of each column for the MTP draft mask
+  Tensor tDcS = thr_t2r_copy_bmm1.partition_D(cta_bmm1.partition_C(make_identity_tensor(shape(sS(_,_,0))))); // (CpyD, NumCpy_M, NumCpy_N)
 
   // restructure Acc1 in rmem for faster fsum reduction
   // because tcgen05.ld.32dp32bit put each row of the Acc1 tensor into 1 thread, for softmax we need cross thread reduction (reduce each column) for fsum/fmax, fmax is fine because we can use redux.sync
@@ -1337,6 +1340,22 @@ EPILOG_warp(
       if (!row_valid) {
         fill(tDrS, -cutlass::platform::numeric_limits<TypeAcc>::infinity());
       }
+      // MTP (speculative decoding): the last qL keys are the draft tokens of this step, their K/V were appended before the kernel
+      // a draft q token only sees the draft keys on its own path, i.e. its ancestors and itself
+      // the path is given by tree_mask[q] (bit j set if draft key j is visible to draft q), or causal (j <= q) when tree_mask is nullptr
+      int qL = size<1>(shape<1>(mO));
+      int draft_idx = kv_seq_len - (seq_len - qL);
+      if (row_valid && qL > 1 && draft_idx >= 0) {
+        CUTE_UNROLL
+        for (int i = 0; i < tDrS.size(); i++) {
+          int q_idx = work_tile_info.qL_idx * CTA_qL + get<1,1>(tDcS(i));
+          bool visible = (q_idx >= qL) ||
+                         ((tree_mask != nullptr) ? ((tree_mask[q_idx] >> draft_idx) & 1) : (draft_idx <= q_idx));
+          if (!visible) {
+            tDrS[i] = -cutlass::platform::numeric_limits<TypeAcc>::infinity();
+          }
+        }
+      }
       // scale it by softmax_scale_log2, s = s * softmax_scale_log2 = s * softmax_scale * log2(e)
       // here we leverage the fact that expf(s) = exp2f(s * log2(e)), and doing the exp2f path generates less instructions than expf (and presumably slightly less accurate)
       // so we fuse the log2(e) with the softmax scale, hence all later expf (e.g. alpha/beta) should be replaced by exp2f
@@ -1361,16 +1380,24 @@ EPILOG_warp(
         tDrFmax[i] = reduce_op<ReduceOp::Max>(tDrFmax(i), m_ij(i));
       }
 
+      // with the MTP draft mask a column can be fully masked so far in this split, i.e. m_i = -inf
+      // use 0 as the reference max for such columns, otherwise exp2f(-inf - (-inf)) is nan; p and alpha are then 0 as expected
+      Tensor m_i_safe = make_tensor<TypeAcc>(shape(tDrFmax));
+      CUTE_UNROLL
+      for (int i = 0; i < tDrFmax.size(); i++) {
+        m_i_safe[i] = (tDrFmax[i] == -cutlass::platform::numeric_limits<TypeAcc>::infinity()) ? TypeAcc(0) : tDrFmax[i];
+      }
+
       // alpha = exp2f(m_i_old - m_i)
       CUTE_UNROLL
       for (int i = 0; i < tDrFmax.size(); i++) {
-        rAlpha[i] = exp2f(m_i_old[i] - tDrFmax[i]);
+        rAlpha[i] = exp2f(m_i_old[i] - m_i_safe[i]);
       }
 
       // p = exp2f(s - m_i)
       CUTE_UNROLL
       for (int i = 0; i < tDrS.size(); i++) {
-        tDrS[i] = exp2f(tDrS[i] - tDrFmax[i]);
+        tDrS[i] = exp2f(tDrS[i] - m_i_safe[i]);
       }
 
       // l_i = alpha * l_i + p
@@ -1688,6 +1715,7 @@ gqa_device(
   TiledBMM2 tiled_bmm2,
   float softmax_scale_log2,
   int sliding_window_size,
+  uint32_t const* tree_mask,
   int pdl_count
 ) {
   //if (threadIdx.x == 0) {
@@ -1839,7 +1867,7 @@ gqa_device(
     // epilog tid is from 128 to 255, need to offset by -128 when getting the per thread slice
     int tid = threadIdx.x - 128;
     // warp_idx - 4 because epilog warp group starts from warp 4
-    EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
+    EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, tree_mask, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
   }
 
   __syncthreads();
@@ -1852,6 +1880,8 @@ gqa_device(
 // kvL is max_seq_len, seq_lens[BS] is the actual seq len for each batch
 // sinks has shape (qHLocal * kvH), i.e. one sink per q head, when device_ptr_sinks is nullptr, it's disabled
 // sliding_window_size is the size of the sliding window, when it's 0, it's disabled
+// qL > 1 is MTP (speculative decoding), the last qL keys of each batch are the draft tokens, and the draft q tokens see each other
+// through the tree mask device_ptr_tree_mask (qL uint32 bitmasks, bit j of entry q set if draft q sees draft key j), or causally when it's nullptr
 template<
   class TypeQKV, class TypeO, class TypeAcc,
   int CTA_qHLocal, int CTA_qL, int CTA_kvL, int CTA_dH,
@@ -1871,6 +1901,7 @@ void gqa_host(
   int stride_O_kvH, int stride_O_qHLocal, int stride_O_qL, int stride_O_dH, int stride_O_BS,
   float softmax_scale,
   int sliding_window_size,
+  uint32_t const* device_ptr_tree_mask,
   bool pdl, int pdl_count = -1,
   cudaStream_t stream = 0
 ) {
@@ -1886,6 +1917,7 @@ void gqa_host(
   // we partition kvL with tile size of CTA_kvL, and we evenly distribute the kvL blocks to MaxSplits number of cta in the cluster
   assert(NumReductionCTA <= MaxSplits);
   static_assert(((CTA_qHLocal * CTA_qL) % NumReductionCTA) == 0, "each reduction cta must have even number of q tokens");
+  assert(qL <= 32); // one uint32 bitmask per draft q token
 
   //printf("Running for problem shape (kvH x qHLocal x qL x kvL x dH x BS): %d x %d x %d x %d x %d x %d\n", kvH, qHLocal, qL, kvL, dH, BS);
   //printf("with tile size CTA_qHLocal: %d, CTA_qL: %d, CTA_kvL: %d, CTA_dH: %d\n", CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH);
@@ -2110,7 +2142,7 @@ void gqa_host(
                                 mSeqLens,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, device_ptr_tree_mask, pdl_count));
   }
   else {
     auto *kernel_instance =
@@ -2130,7 +2162,7 @@ void gqa_host(
                                 mSeqLens,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, device_ptr_tree_mask, pdl_count));
   }
 }
 
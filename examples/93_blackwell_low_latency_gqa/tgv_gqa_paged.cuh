@@ -429,6 +429,7 @@ gqa_paged_device(
   TiledBMM2 tiled_bmm2,
   float softmax_scale_log2,
   int sliding_window_size,
+  uint32_t const* tree_mask,
   int pdl_count
 ) {
   // Allocate SMEM
@@ -557,7 +558,7 @@ gqa_paged_device(
     int kvL = static_cast<int>(shape<0>(mPageTable)) * Page_Size;
     auto mK_coord = make_identity_tensor(make_shape(kvL, dH, kvH, BS));
     // warp_idx - 4 because epilog warp group starts from warp 4
-    gqa::EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK_coord), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK_coord, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
+    gqa::EPILOG_warp<SharedStorage, WorkTileInfo, decltype(mK_coord), decltype(mO), decltype(mSink), TiledBMM1, TiledBMM2, CTA_qHLocal, CTA_qL, CTA_kvL, CTA_dH, NumReductionCTA, NoSink>(shared_storage, work_tile_info, mK_coord, mO, mSink, seq_len, tiled_bmm1, tiled_bmm2, softmax_scale_log2, sliding_window_size, tree_mask, epilog_barrier, NumSplits, tid, warp_idx - 4, rank);
   }
 
   __syncthreads();
@@ -570,6 +571,7 @@ gqa_paged_device(
 // seq_lens has shape (BS); kvL is max_seq_len, seq_lens[bs] is the actual seq len for batch bs
 // page_table has shape (kvL/Page_Size, BS)
 // sliding_window_size is the size of the sliding window, when it's 0, it's disabled
+// tree_mask has shape (qL), the MTP draft mask, see gqa::gqa_host
 template<
   class TypeQKV, class TypeO, class TypeAcc,
   int CTA_qHLocal, int CTA_qL, int CTA_kvL, int CTA_dH,
@@ -591,6 +593,7 @@ void gqa_paged_host(
   int stride_PT_p, int stride_PT_BS,
   float softmax_scale,
   int sliding_window_size,
+  uint32_t const* device_ptr_tree_mask,
   bool pdl, int pdl_count = -1,
   cudaStream_t stream = 0
 ) {
@@ -632,6 +635,7 @@ void gqa_paged_host(
   // we partition kvL with tile size of CTA_kvL, and we evenly distribute the kvL blocks to MaxSplits number of cta in the cluster
   assert(NumReductionCTA <= MaxSplits);
   static_assert(((CTA_qHLocal * CTA_qL) % NumReductionCTA) == 0, "each reduction cta must have even number of q tokens");
+  assert(qL <= 32); // one uint32 bitmask per draft q token
 
   // mK and mV are constructed above by slicing+permuting the combined mKV tensor.
   Tensor mQ = make_tensor(make_gmem_ptr(device_ptr_Q), layout_Q); // ((qHLocal, qL), dH, kvH, BS)
@@ -836,7 +840,7 @@ void gqa_paged_host(
                                 mSeqLens, mPageTable,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, device_ptr_tree_mask, pdl_count));
   }
   else {
     auto *kernel_instance =
@@ -859,7 +863,7 @@ void gqa_paged_host(
                                 mSeqLens, mPageTable,
                                 tma_atom_K, tma_atom_Q, tma_atom_V,
                                 tiled_bmm1, tiled_bmm2,
-                                softmax_scale * Log2_E, sliding_window_size, pdl_count));
+                                softmax_scale * Log2_E, sliding_window_size, device_ptr_tree_mask, pdl_count));
   }
 }
 
@@ -40,9 +40,16 @@
  *        - StaticPersistentScheduler
  *
  * Use --scheduler=dynamic (default) or --scheduler=static to select the scheduler.
+ *
+ * With --partition_sms, the device is split into GEMM partitions of several sizes, the GEMM
+ * parameters are initialized once per partition size (cutlass::GemmPartitionParams), and the
+ * profiling loop reshapes the GEMM partition on every launch without calling initialize().
  */
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <vector>
 
 #include <cuda.h>
 
@@ -61,6 +68,7 @@
 
 #include "cutlass/util/command_line.h"
 #include "cutlass/util/distribution.h"
+#include "cutlass/util/green_context_gemm.hpp"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/util/packed_stride.hpp"
 #include "cutlass/util/tensor_view_io.h"
@@ -257,8 +265,10 @@ struct Options {
   int iterations;
   int swizzle;
   int max_num_sm;
+  int cta_budget;
   std::string raster_order;
   std::string scheduler;
+  std::vector<int> partition_sms;
 
   Options():
     help(false),
@@ -268,6 +278,7 @@ struct Options {
     iterations(30),
     swizzle(0),
     max_num_sm(0),
+    cta_budget(0),
     raster_order("heuristic"),
     scheduler("dynamic")
   { }
@@ -288,8 +299,10 @@ struct Options {
     cmd.get_cmd_line_argument("iterations", iterations);
     cmd.get_cmd_line_argument("swizzle", swizzle);
     cmd.get_cmd_line_argument("max_num_sm", max_num_sm);
+    cmd.get_cmd_line_argument("cta_budget", cta_budget);
     cmd.get_cmd_line_argument("raster_order", raster_order, std::string("heuristic"));
     cmd.get_cmd_line_argument("scheduler", scheduler, std::string("dynamic"));
+    cmd.get_cmd_line_arguments("partition_sms", partition_sms);
     use_cuda_graph = cmd.check_cmd_line_flag("use_cuda_graph");
   }
 
@@ -322,6 +335,8 @@ struct Options {
       << "  --swizzle=<int>             Cluster rasterization swizzle\n"
       << "  --raster_order=<string>     Raster order: 'heuristic' (default), 'along_m', or 'along_n'\n"
       << "  --max_num_sm=<int>          Max number of SMs for green context partition (0 = use all SMs, no green context)\n"
+      << "  --cta_budget=<int>          Max number of resident CTAs of the static persistent kernel, without a green context (0 = no limit)\n"
+      << "  --partition_sms=<int,...>   SM counts of GEMM partitions to cycle through, with parameters initialized once per partition\n"
       << "  --use_cuda_graph            If specified, use CUDA graph capture/replay for profiling iterations\n\n"
       << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
 
@@ -330,7 +345,11 @@ struct Options {
       << "  # Dynamic scheduler, all SMs (no green context)\n"
       << "  $ 95_blackwell_gemm_green_context --scheduler=dynamic --m=8192 --n=8192 --k=8192\n\n"
       << "  # Static scheduler, 120-SM green context partition\n"
-      << "  $ 95_blackwell_gemm_green_context --scheduler=static --m=8192 --n=8192 --k=8192 --max_num_sm=120\n\n";
+      << "  $ 95_blackwell_gemm_green_context --scheduler=static --m=8192 --n=8192 --k=8192 --max_num_sm=120\n\n"
+      << "  # Static scheduler, at most 120 resident CTAs on the full device\n"
+      << "  $ 95_blackwell_gemm_green_context --scheduler=static --m=8192 --n=8192 --k=8192 --cta_budget=120\n\n"
+      << "  # Static scheduler, GEMM partition reshaped between 128, 96 and 64 SMs on every launch\n"
+      << "  $ 95_blackwell_gemm_green_context --scheduler=static --m=8192 --n=8192 --k=8192 --partition_sms=128,96,64\n\n";
 
     return out;
   }
@@ -442,9 +461,13 @@ typename Gemm::Arguments args_from_options(const Options &options, cudaStream_t
   // If the stream is not passed, the query returns the full-device max active clusters,
   // which leads to an oversized persistent grid that exceeds the partition's capacity,
   // causing performance issues (because static scheduler stride to next work with launch grid size)
+  //
+  // Without a green context, a CTA budget bounds the persistent grid instead, rounded down to
+  // whole clusters. The SMs running the CTAs are then chosen by the hardware.
   // =====================================================================================
   arguments.hw_info = cutlass::KernelHardwareInfo::make_kernel_hardware_info<typename Gemm::GemmKernel>(
-      0 /* device_id */, 0 /* sm_count: auto-query */, 0 /* max_active_clusters: auto-query */, stream);
+      0 /* device_id */, 0 /* sm_count: auto-query */, 0 /* max_active_clusters: auto-query */, stream,
+      options.cta_budget);
 
   return arguments;
 }
@@ -488,7 +511,8 @@ int run(const Options &options, cudaStream_t stream)
 
   dim3 grid = Gemm::get_grid_shape(arguments);
   std::cout << "  hw_info: sm_count=" << arguments.hw_info.sm_count
-            << ", max_active_clusters=" << arguments.hw_info.max_active_clusters << std::endl;
+            << ", max_active_clusters=" << arguments.hw_info.max_active_clusters
+            << ", cta_budget=" << arguments.hw_info.cta_budget << std::endl;
   std::cout << "  Launch grid: (" << grid.x << ", " << grid.y << ", " << grid.z << ")" << std::endl;
 
   size_t workspace_size = Gemm::get_workspace_size(arguments);
@@ -561,11 +585,131 @@ int run(const Options &options, cudaStream_t stream)
   return 0;
 }
 
+/// Splits the device into one GEMM partition per size in --partition_sms, initializes the GEMM
+/// parameters of each partition once, and then launches the GEMM onto a different partition
+/// every iteration with the cached parameters only, as a server reshaping its partitions would.
+template <typename Gemm>
+int run_reshaped(const Options &options, int current_device_id)
+{
+  initialize(options);
+
+  CUDA_DRIVER_CHECK(cuInit(0));
+
+  CUdevice cu_device;
+  CUcontext primary_context;
+  CUDA_DRIVER_CHECK(cuDeviceGet(&cu_device, current_device_id));
+  CUDA_DRIVER_CHECK(cuDevicePrimaryCtxRetain(&primary_context, cu_device));
+  CUDA_DRIVER_CHECK(cuCtxSetCurrent(primary_context));
+
+  CUdevResource device_resource;
+  CUDA_DRIVER_CHECK(cuDeviceGetDevResource(cu_device, &device_resource, CU_DEV_RESOURCE_TYPE_SM));
+  std::cout << "  Device SM count: " << device_resource.sm.smCount << std::endl;
+
+  struct GemmPartition {
+    int sm_count;
+    CUgreenCtx green_ctx;
+    CUstream stream;
+  };
+  std::vector<GemmPartition> partitions;
+
+  // hw_info is replaced by that of each partition
+  auto arguments = args_from_options<Gemm>(options, cudaStreamDefault);
+  cutlass::GemmPartitionParams<Gemm> partition_params;
+
+  for (int max_num_sm : options.partition_sms) {
+    unsigned int min_count = static_cast<unsigned int>(max_num_sm);
+#if CUDA_VERSION >= 13000
+    unsigned int sm_alignment = device_resource.sm.smCoscheduledAlignment;
+    min_count = std::max(sm_alignment, (min_count / sm_alignment) * sm_alignment);
+#endif
+    CUdevResource partition_resource;
+    CUdevResource remaining_resource;
+    unsigned int num_groups = 1;
+    CUDA_DRIVER_CHECK(cuDevSmResourceSplitByCount(
+        &partition_resource, &num_groups, &device_resource, &remaining_resource, 0, min_count));
+
+    CUdevResourceDesc partition_desc;
+    CUDA_DRIVER_CHECK(cuDevResourceGenerateDesc(&partition_desc, &partition_resource, 1));
+
+    GemmPartition partition;
+    partition.sm_count = static_cast<int>(partition_resource.sm.smCount);
+    CUDA_DRIVER_CHECK(cuGreenCtxCreate(&partition.green_ctx, partition_desc, cu_device, CU_GREEN_CTX_DEFAULT_STREAM));
+    CUDA_DRIVER_CHECK(cuGreenCtxStreamCreate(&partition.stream, partition.green_ctx, CU_STREAM_NON_BLOCKING, 0));
+
+    // The only initialize() of this partition size: occupancy query, TMA descriptors, smem attributes
+    CUTLASS_CHECK(partition_params.add_partition(arguments, static_cast<cudaStream_t>(partition.stream)));
+
+    auto const& hw_info = partition_params.find(partition.sm_count)->hw_info;
+    std::cout << "  Partition (requested " << max_num_sm << " SMs): sm_count=" << hw_info.sm_count
+              << ", max_active_clusters=" << hw_info.max_active_clusters << std::endl;
+
+    partitions.push_back(partition);
+  }
+
+  for (auto const& partition : partitions) {
+    CUDA_RUNTIME_CHECK(cudaMemset(block_D.get(), 0, block_D.size() * sizeof(ElementC)));
+    CUTLASS_CHECK(partition_params.run(partition.sm_count, static_cast<cudaStream_t>(partition.stream)));
+    CUDA_RUNTIME_CHECK(cudaStreamSynchronize(static_cast<cudaStream_t>(partition.stream)));
+
+    bool passed = verify<Gemm>(options);
+    std::cout << "  Disposition (" << partition.sm_count << " SMs): " << (passed ? "Passed" : "Failed") << std::endl;
+    if (!passed) {
+      exit(-1);
+    }
+  }
+
+  if (options.iterations > 0) {
+    // Each launch goes to the next partition and waits for the previous one, which shares D
+    cudaEvent_t start, done;
+    CUDA_RUNTIME_CHECK(cudaEventCreate(&start));
+    CUDA_RUNTIME_CHECK(cudaEventCreate(&done));
+
+    cudaStream_t first_stream = static_cast<cudaStream_t>(partitions.front().stream);
+    CUDA_RUNTIME_CHECK(cudaEventRecord(start, first_stream));
+    CUDA_RUNTIME_CHECK(cudaEventRecord(done, first_stream));
+
+    auto host_start = std::chrono::steady_clock::now();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      auto const& partition = partitions[iter % partitions.size()];
+      cudaStream_t stream = static_cast<cudaStream_t>(partition.stream);
+      CUDA_RUNTIME_CHECK(cudaStreamWaitEvent(stream, done, 0));
+      CUTLASS_CHECK(partition_params.run(partition.sm_count, stream));
+      CUDA_RUNTIME_CHECK(cudaEventRecord(done, stream));
+    }
+    auto host_stop = std::chrono::steady_clock::now();
+
+    CUDA_RUNTIME_CHECK(cudaEventSynchronize(done));
+    float elapsed_ms = 0.f;
+    CUDA_RUNTIME_CHECK(cudaEventElapsedTime(&elapsed_ms, start, done));
+    CUDA_RUNTIME_CHECK(cudaEventDestroy(start));
+    CUDA_RUNTIME_CHECK(cudaEventDestroy(done));
+
+    double host_us = std::chrono::duration<double, std::micro>(host_stop - host_start).count() / options.iterations;
+    double avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+
+    std::cout << "  Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << std::endl;
+    std::cout << "  Avg runtime (partition reshaped every launch): " << avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  Avg host time per launch: " << host_us << " us" << std::endl;
+    std::cout << "  GFLOPS: " << options.gflops(avg_runtime_ms / 1000.0) << std::endl;
+  }
+
+  for (auto const& partition : partitions) {
+    CUDA_DRIVER_CHECK(cuStreamDestroy(partition.stream));
+    CUDA_DRIVER_CHECK(cuGreenCtxDestroy(partition.green_ctx));
+  }
+  CUDA_DRIVER_CHECK(cuDevicePrimaryCtxRelease(cu_device));
+
+  return 0;
+}
+
 /// Dispatches to the correct Gemm type and handles green context setup.
 template <typename Gemm>
 int dispatch(const Options &options, int current_device_id)
 {
-  if (options.max_num_sm > 0) {
+  if (!options.partition_sms.empty()) {
+    return run_reshaped<Gemm>(options, current_device_id);
+  }
+  else if (options.max_num_sm > 0) {
     //
     // Green Context path: partition SMs and launch kernel on primary partition
     //
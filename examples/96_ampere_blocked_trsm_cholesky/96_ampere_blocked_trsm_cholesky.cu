@@ -0,0 +1,317 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Blocked Cholesky factorization and triangular solve on NVIDIA Ampere using CUTLASS GEMM.
+
+    This example factors a double-precision symmetric positive definite matrix A = L * L^T
+    (POTRF) and solves A * X = B with two triangular solves L * Y = B and L^T * X = Y (POTRS).
+
+    Both are blocked so that almost all of the flops run in CUTLASS tensor core kernels:
+
+      - TRSM recurses on halves of L. Each off-diagonal block of L is applied to the right-hand
+        sides by a DGEMM; only the 32x32 diagonal blocks are solved by a small SIMT kernel.
+
+      - POTRF factors one 32-wide block column at a time: an unblocked Cholesky of the diagonal
+        block, a TRSM of the panel below it, and a SYRK (cutlass::gemm::device::RankK) update of the
+        trailing matrix. The update of the next block column is issued first on the main stream
+        (look-ahead), and the update of the rest of the trailing matrix is issued on a second
+        stream, so the small latency-bound panel kernels overlap the bulk SYRK.
+
+    See blocked_trsm_cholesky.h for the implementation.
+
+    Usage:
+
+      $ ./examples/96_ampere_blocked_trsm_cholesky/96_ampere_blocked_trsm_cholesky --n=2048 --nrhs=256
+*/
+
+#include <cmath>
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+#include "blocked_trsm_cholesky.h"
+#include "helper.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Element = double;
+using Layout = cutlass::layout::ColumnMajor;
+
+using Cholesky = example::BlockedCholesky<Element>;
+using TrsmLower = example::BlockedTrsm<Element, Layout, false>;
+using TrsmUpper = example::BlockedTrsm<Element, Layout, true>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+  int n = 1024;
+  int nrhs = 128;
+  int iterations = 10;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("nrhs", nrhs);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  std::ostream & print_usage(std::ostream &out) const {
+    out << "96_ampere_blocked_trsm_cholesky\n\n"
+      << "  Blocked Cholesky factorization and triangular solves of a double-precision SPD matrix.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --n=<int>                   Order of the matrix A\n"
+      << "  --nrhs=<int>                Number of right-hand sides\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform\n\n";
+    return out;
+  }
+
+  /// POTRF flop count
+  double potrf_gflops(double runtime_s) const {
+    return (double(n) * n * n / 3.0) / runtime_s / 1.0e9;
+  }
+
+  /// Flop count of the two triangular solves
+  double potrs_gflops(double runtime_s) const {
+    return (2.0 * double(n) * n * nrhs) / runtime_s / 1.0e9;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the largest relative residual max|A - L * L^T| / max|A| over the lower triangle
+double potrf_residual(
+  cutlass::HostTensor<Element, Layout> const &A,
+  cutlass::HostTensor<Element, Layout> const &L,
+  int n) {
+
+  double error = 0;
+  double norm = 0;
+  for (int j = 0; j < n; ++j) {
+    for (int i = j; i < n; ++i) {
+      double accum = 0;
+      for (int p = 0; p <= j; ++p) {
+        accum += L.at({i, p}) * L.at({j, p});
+      }
+      error = std::max(error, std::abs(accum - A.at({i, j})));
+      norm = std::max(norm, std::abs(A.at({i, j})));
+    }
+  }
+  return error / norm;
+}
+
+/// Returns the largest relative residual max|A * X - B| / max|B|, reading A from its lower triangle
+double potrs_residual(
+  cutlass::HostTensor<Element, Layout> const &A,
+  cutlass::HostTensor<Element, Layout> const &X,
+  cutlass::HostTensor<Element, Layout> const &B,
+  int n,
+  int nrhs) {
+
+  double error = 0;
+  double norm = 0;
+  for (int c = 0; c < nrhs; ++c) {
+    for (int i = 0; i < n; ++i) {
+      double accum = 0;
+      for (int p = 0; p < n; ++p) {
+        accum += (p <= i ? A.at({i, p}) : A.at({p, i})) * X.at({p, c});
+      }
+      error = std::max(error, std::abs(accum - B.at({i, c})));
+      norm = std::max(norm, std::abs(B.at({i, c})));
+    }
+  }
+  return error / norm;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int run(Options const &options) {
+
+  int n = options.n;
+  int nrhs = options.nrhs;
+
+  // A = R * R^T + n * I is symmetric positive definite
+  cutlass::HostTensor<Element, Layout> R({n, n});
+  cutlass::HostTensor<Element, Layout> A({n, n});
+  cutlass::HostTensor<Element, Layout> L({n, n});
+  cutlass::HostTensor<Element, Layout> B({n, nrhs});
+  cutlass::HostTensor<Element, Layout> X({n, nrhs});
+
+  cutlass::reference::host::TensorFillRandomUniform(R.host_view(), 2024, 1.0, -1.0, 0);
+  cutlass::reference::host::TensorFillRandomUniform(B.host_view(), 2025, 1.0, -1.0, 0);
+
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      double accum = (i == j) ? double(n) : 0.0;
+      for (int p = 0; p < n; ++p) {
+        accum += R.at({i, p}) * R.at({j, p});
+      }
+      A.at({i, j}) = accum;
+      A.at({j, i}) = accum;
+    }
+  }
+
+  A.sync_device();
+  B.sync_device();
+
+  cutlass::DeviceAllocation<int> info(1);
+
+  cudaStream_t stream;
+  cudaStream_t update_stream;
+  CUDA_CHECK(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  CUDA_CHECK(cudaStreamCreateWithFlags(&update_stream, cudaStreamNonBlocking));
+
+  Cholesky cholesky;
+  TrsmLower trsm_lower;
+  TrsmUpper trsm_upper;
+
+  auto factor = [&]() {
+    CUDA_CHECK(cudaMemcpyAsync(L.device_data(), A.device_data(), sizeof(Element) * A.capacity(),
+      cudaMemcpyDeviceToDevice, stream));
+    CUDA_CHECK(cudaMemsetAsync(info.get(), 0, sizeof(int), stream));
+    CUTLASS_CHECK(cholesky(n, L.device_ref(), info.get(), stream, update_stream));
+  };
+
+  auto solve = [&]() {
+    CUDA_CHECK(cudaMemcpyAsync(X.device_data(), B.device_data(), sizeof(Element) * B.capacity(),
+      cudaMemcpyDeviceToDevice, stream));
+    CUTLASS_CHECK(trsm_lower(n, nrhs, Element(1), L.device_ref(), X.device_ref(), stream));
+    CUTLASS_CHECK(trsm_upper(n, nrhs, Element(1), L.device_ref(), X.device_ref(), stream));
+  };
+
+  //
+  // Verify
+  //
+
+  factor();
+  solve();
+  CUDA_CHECK(cudaStreamSynchronize(stream));
+
+  int host_info = 0;
+  info.copy_to_host(&host_info);
+  L.sync_host();
+  X.sync_host();
+
+  double potrf_error = potrf_residual(A, L, n);
+  double potrs_error = potrs_residual(A, X, B, n, nrhs);
+  double tolerance = 1.0e-10;
+  bool passed = (host_info == 0) && (potrf_error < tolerance) && (potrs_error < tolerance);
+
+  std::cout << "  Problem: n = " << n << ", nrhs = " << nrhs << std::endl;
+  std::cout << "  POTRF residual: " << potrf_error << " (info = " << host_info << ")" << std::endl;
+  std::cout << "  POTRS residual: " << potrs_error << std::endl;
+  std::cout << "  Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+  //
+  // Profile
+  //
+
+  if (passed && options.iterations > 0) {
+    GpuTimer timer;
+
+    timer.start(stream);
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      factor();
+    }
+    timer.stop();
+    double potrf_runtime_ms = double(timer.elapsed_millis()) / double(options.iterations);
+
+    timer.start(stream);
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      solve();
+    }
+    timer.stop();
+    double potrs_runtime_ms = double(timer.elapsed_millis()) / double(options.iterations);
+
+    std::cout << "  POTRF: " << potrf_runtime_ms << " ms, "
+      << options.potrf_gflops(potrf_runtime_ms / 1000.0) << " GFLOP/s" << std::endl;
+    std::cout << "  POTRS: " << potrs_runtime_ms << " ms, "
+      << options.potrs_gflops(potrs_runtime_ms / 1000.0) << " GFLOP/s" << std::endl;
+  }
+
+  CUDA_CHECK(cudaStreamDestroy(stream));
+  CUDA_CHECK(cudaStreamDestroy(update_stream));
+
+  return passed ? 0 : -1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS double-precision tensor core kernels require CUDA 11.0 or higher and compute
+  // capability 8.0 or higher.
+  if (!(__CUDACC_VER_MAJOR__ >= 11)) {
+    std::cerr << "This example requires CUDA 11.0 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  CUDA_CHECK(cudaGetDeviceProperties(&props, 0));
+
+  if (!(props.major >= 8)) {
+    std::cerr << "This example requires a GPU of NVIDIA's Ampere Architecture or later (compute capability 80 or greater).\n";
+    // Returning zero so this test passes on older GPUs. Its actions are no-op.
+    return 0;
+  }
+
+  Options options;
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.n <= 0 || options.nrhs <= 0) {
+    std::cerr << "Invalid problem size.\n";
+    return -1;
+  }
+
+  return run(options);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,531 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Blocked triangular solve (TRSM) and Cholesky factorization (POTRF) built on CUTLASS GEMM.
+
+    BlockedTrsm solves op(L) * X = alpha * B for X in place of B, with L lower triangular and
+    op(L) = L or L^T. The solve recurses on halves of L: the diagonal blocks of at most kBlock rows
+    are solved by a SIMT kernel holding the block of L in shared memory, and the off-diagonal
+    blocks of L are applied to the right-hand sides by a CUTLASS GEMM. Right-side solves
+    X * op(L)^T = B are the left-side solves of X^T, i.e. B with a transposed layout.
+
+    BlockedCholesky factors a symmetric positive definite A = L * L^T in place of the lower
+    triangle of A, block column by block column: POTRF of the diagonal block, TRSM of the panel
+    below it, and a SYRK/GEMM update of the trailing matrix. With a look-ahead of one block column,
+    the update of the next block column runs on the critical path stream, and the update of the
+    rest of the trailing matrix runs on a second stream, overlapping the factorization of the next
+    panel.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/blas3.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/tensor_ref.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/gemm/device/gemm.h"
+#include "cutlass/gemm/device/rank_k.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace example {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Solves op(L) * X = alpha * B for a diagonal block L of at most kBlock rows. Each thread solves
+/// one column of B by forward (L) or backward (L^T) substitution in registers.
+template <typename Element, typename LayoutB, int kBlock, bool kTransposeL>
+__global__ void trsm_diagonal_block_kernel(
+  int rows,
+  int columns,
+  Element alpha,
+  cutlass::TensorRef<Element const, cutlass::layout::ColumnMajor> ref_L,
+  cutlass::TensorRef<Element, LayoutB> ref_B) {
+
+  __shared__ Element shared_L[kBlock][kBlock + 1];
+
+  // Rows beyond the block are padded with the identity so that the unrolled loops stay uniform
+  for (int idx = threadIdx.x; idx < kBlock * kBlock; idx += blockDim.x) {
+    int i = idx % kBlock;
+    int p = idx / kBlock;
+    Element value = Element(i == p ? 1 : 0);
+    if (i < rows && p <= i) {
+      value = ref_L.at({i, p});
+    }
+    shared_L[i][p] = value;
+  }
+  __syncthreads();
+
+  int column = blockIdx.x * blockDim.x + threadIdx.x;
+  if (column >= columns) {
+    return;
+  }
+
+  Element x[kBlock];
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < kBlock; ++i) {
+    x[i] = (i < rows) ? alpha * ref_B.at({i, column}) : Element(0);
+  }
+
+  if constexpr (kTransposeL) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = kBlock - 1; i >= 0; --i) {
+      Element accum = x[i];
+      CUTLASS_PRAGMA_UNROLL
+      for (int p = i + 1; p < kBlock; ++p) {
+        accum -= shared_L[p][i] * x[p];
+      }
+      x[i] = accum / shared_L[i][i];
+    }
+  }
+  else {
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kBlock; ++i) {
+      Element accum = x[i];
+      CUTLASS_PRAGMA_UNROLL
+      for (int p = 0; p < i; ++p) {
+        accum -= shared_L[i][p] * x[p];
+      }
+      x[i] = accum / shared_L[i][i];
+    }
+  }
+
+  CUTLASS_PRAGMA_UNROLL
+  for (int i = 0; i < kBlock; ++i) {
+    if (i < rows) {
+      ref_B.at({i, column}) = x[i];
+    }
+  }
+}
+
+/// Factors a diagonal block of at most kBlock rows as A = L * L^T in place of its lower triangle,
+/// by a right-looking unblocked Cholesky in shared memory. If the leading minor of order j of the
+/// block is not positive definite, `*info` is set to `offset + j` unless already set.
+template <typename Element, int kBlock>
+__global__ void potrf_diagonal_block_kernel(
+  int rows,
+  cutlass::TensorRef<Element, cutlass::layout::ColumnMajor> ref_A,
+  int *info,
+  int offset) {
+
+  __shared__ Element shared_A[kBlock][kBlock + 1];
+
+  for (int idx = threadIdx.x; idx < rows * rows; idx += blockDim.x) {
+    int i = idx % rows;
+    int p = idx / rows;
+    if (p <= i) {
+      shared_A[i][p] = ref_A.at({i, p});
+    }
+  }
+  __syncthreads();
+
+  for (int j = 0; j < rows; ++j) {
+    Element diagonal = shared_A[j][j];
+    if (!(diagonal > Element(0))) {
+      if (threadIdx.x == 0) {
+        atomicCAS(info, 0, offset + j + 1);
+      }
+      return;
+    }
+    Element root = cutlass::fast_sqrt(diagonal);
+    __syncthreads();
+
+    for (int i = j + threadIdx.x; i < rows; i += blockDim.x) {
+      shared_A[i][j] /= root;
+    }
+    __syncthreads();
+
+    // Rank-1 update of the lower triangle of the trailing block
+    int trailing = rows - j - 1;
+    for (int idx = threadIdx.x; idx < trailing * trailing; idx += blockDim.x) {
+      int i = j + 1 + idx % trailing;
+      int p = j + 1 + idx / trailing;
+      if (p <= i) {
+        shared_A[i][p] -= shared_A[i][j] * shared_A[p][j];
+      }
+    }
+    __syncthreads();
+  }
+
+  for (int idx = threadIdx.x; idx < rows * rows; idx += blockDim.x) {
+    int i = idx % rows;
+    int p = idx / rows;
+    if (p <= i) {
+      ref_A.at({i, p}) = shared_A[i][p];
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Solves op(L) * X = alpha * B in place of B (left side, lower triangular, non-unit diagonal)
+template <
+  typename Element_,
+  typename LayoutB_,
+  bool TransposeL = false,
+  int Block = 32,
+  typename ArchTag = cutlass::arch::Sm80
+>
+class BlockedTrsm {
+public:
+
+  using Element = Element_;
+  using LayoutL = cutlass::layout::ColumnMajor;
+  using LayoutB = LayoutB_;
+  using TensorRefL = cutlass::TensorRef<Element const, LayoutL>;
+  using TensorRefB = cutlass::TensorRef<Element, LayoutB>;
+
+  static bool const kTransposeL = TransposeL;
+  static int const kBlock = Block;
+  static int const kThreadsPerBlock = 128;
+
+  /// Applies the off-diagonal block of op(L), i.e. L21 or L21^T, to the right-hand sides
+  using LayoutOffDiagonal = typename cutlass::platform::conditional<
+    kTransposeL, cutlass::layout::RowMajor, cutlass::layout::ColumnMajor>::type;
+
+  using Gemm = cutlass::gemm::device::Gemm<
+    Element, LayoutOffDiagonal,
+    Element, LayoutB,
+    Element, LayoutB,
+    Element,
+    cutlass::arch::OpClassTensorOp,
+    ArchTag>;
+
+  /// Solves the M-by-N system on `stream`
+  cutlass::Status operator()(
+    int M,
+    int N,
+    Element alpha,
+    TensorRefL ref_L,
+    TensorRefB ref_B,
+    cudaStream_t stream = nullptr) const {
+
+    if (M <= 0 || N <= 0) {
+      return cutlass::Status::kSuccess;
+    }
+
+    if (M <= kBlock) {
+      dim3 grid((N + kThreadsPerBlock - 1) / kThreadsPerBlock);
+      trsm_diagonal_block_kernel<Element, LayoutB, kBlock, kTransposeL>
+        <<<grid, kThreadsPerBlock, 0, stream>>>(M, N, alpha, ref_L, ref_B);
+      return cudaGetLastError() == cudaSuccess ? cutlass::Status::kSuccess : cutlass::Status::kErrorInternal;
+    }
+
+    // Split at a multiple of the diagonal block so that all but the last leaf are full blocks
+    int M1 = ((M / 2 + kBlock - 1) / kBlock) * kBlock;
+    int M2 = M - M1;
+
+    TensorRefL ref_L22 = ref_L;
+    ref_L22.add_coord_offset({M1, M1});
+    TensorRefB ref_B1 = ref_B;
+    TensorRefB ref_B2 = ref_B;
+    ref_B2.add_coord_offset({M1, 0});
+
+    cutlass::Status status;
+    if constexpr (!kTransposeL) {
+      // X1 = L11^-1 * alpha * B1, B2 = alpha * B2 - L21 * X1, X2 = L22^-1 * B2
+      status = (*this)(M1, N, alpha, ref_L, ref_B1, stream);
+      if (status != cutlass::Status::kSuccess) {
+        return status;
+      }
+      cutlass::TensorRef<Element const, LayoutOffDiagonal> ref_L21(
+        ref_L.data() + ref_L.offset({M1, 0}), LayoutOffDiagonal(ref_L.stride(0)));
+      status = update({M2, N, M1}, ref_L21, ref_B1, ref_B2, alpha, stream);
+      if (status != cutlass::Status::kSuccess) {
+        return status;
+      }
+      return (*this)(M2, N, Element(1), ref_L22, ref_B2, stream);
+    }
+    else {
+      // X2 = L22^-T * alpha * B2, B1 = alpha * B1 - L21^T * X2, X1 = L11^-T * B1
+      status = (*this)(M2, N, alpha, ref_L22, ref_B2, stream);
+      if (status != cutlass::Status::kSuccess) {
+        return status;
+      }
+      // L21^T is the row-major view of the column-major L21
+      cutlass::TensorRef<Element const, LayoutOffDiagonal> ref_L21t(
+        ref_L.data() + ref_L.offset({M1, 0}), LayoutOffDiagonal(ref_L.stride(0)));
+      status = update({M1, N, M2}, ref_L21t, ref_B2, ref_B1, alpha, stream);
+      if (status != cutlass::Status::kSuccess) {
+        return status;
+      }
+      return (*this)(M1, N, Element(1), ref_L, ref_B1, stream);
+    }
+  }
+
+private:
+
+  /// C = beta * C - A * B
+  static cutlass::Status update(
+    cutlass::gemm::GemmCoord problem_size,
+    cutlass::TensorRef<Element const, LayoutOffDiagonal> ref_A,
+    TensorRefB ref_X,
+    TensorRefB ref_C,
+    Element beta,
+    cudaStream_t stream) {
+
+    typename Gemm::Arguments arguments{
+      problem_size,
+      ref_A,
+      {ref_X.data(), ref_X.layout()},
+      {ref_C.data(), ref_C.layout()},
+      ref_C,
+      {Element(-1), beta}
+    };
+
+    Gemm gemm_op;
+    cutlass::Status status = gemm_op.can_implement(arguments);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+    status = gemm_op.initialize(arguments, nullptr, stream);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+    return gemm_op(stream);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Factors the symmetric positive definite A as L * L^T in place of the lower triangle of A. The
+/// strictly upper triangle of A is not referenced.
+template <
+  typename Element_,
+  int Block = 32,
+  typename ArchTag = cutlass::arch::Sm80
+>
+class BlockedCholesky {
+public:
+
+  using Element = Element_;
+  using Layout = cutlass::layout::ColumnMajor;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+
+  static int const kBlock = Block;
+  static int const kThreadsPerBlock = 256;
+
+  /// Solves the panel below a diagonal block: X * L11^T = A21 is L11 * X^T = A21^T, with A21^T the
+  /// row-major view of A21
+  using PanelTrsm = BlockedTrsm<Element, cutlass::layout::RowMajor, false, kBlock, ArchTag>;
+
+  /// Lower triangle of C = C - A * A^T
+  using Syrk = cutlass::gemm::device::RankK<
+    Element, Layout,
+    Element, Layout,
+    cutlass::FillMode::kLower,
+    Element,
+    cutlass::arch::OpClassTensorOp,
+    ArchTag,
+    cutlass::gemm::GemmShape<64, 64, 16>,
+    cutlass::gemm::GemmShape<32, 32, 16>,
+    cutlass::gemm::GemmShape<8, 8, 4>,
+    cutlass::epilogue::thread::LinearCombination<Element, 1, Element, Element>,
+    cutlass::gemm::threadblock::GemmIdentityThreadblockSwizzle<>,
+    4>;
+
+  /// C = C - A * B^T below the diagonal block of the next block column, with B^T the row-major view
+  /// of the column-major panel
+  using Gemm = cutlass::gemm::device::Gemm<
+    Element, Layout,
+    Element, cutlass::layout::RowMajor,
+    Element, Layout,
+    Element,
+    cutlass::arch::OpClassTensorOp,
+    ArchTag>;
+
+  BlockedCholesky() {
+    (void)cudaEventCreateWithFlags(&panel_done_, cudaEventDisableTiming);
+    (void)cudaEventCreateWithFlags(&update_done_, cudaEventDisableTiming);
+  }
+
+  ~BlockedCholesky() {
+    (void)cudaEventDestroy(panel_done_);
+    (void)cudaEventDestroy(update_done_);
+  }
+
+  BlockedCholesky(BlockedCholesky const&) = delete;
+  BlockedCholesky& operator=(BlockedCholesky const&) = delete;
+
+  /// Factors the N-by-N matrix. The factorization is stream-ordered on `stream`, and the trailing
+  /// updates off the critical path run on `update_stream`, which may be the same stream to disable
+  /// the look-ahead. `info` is a device integer which must be zero on entry; it receives the order
+  /// of the first leading minor that is not positive definite, if any.
+  cutlass::Status operator()(
+    int N,
+    TensorRef ref_A,
+    int *info,
+    cudaStream_t stream,
+    cudaStream_t update_stream) {
+
+    PanelTrsm trsm;
+
+    for (int k = 0; k < N; k += kBlock) {
+      int kb = cutlass::const_min(kBlock, N - k);
+      int below = N - k - kb;
+
+      TensorRef ref_A11 = offset(ref_A, k, k);
+      potrf_diagonal_block_kernel<Element, kBlock><<<1, kThreadsPerBlock, 0, stream>>>(kb, ref_A11, info, k);
+      if (cudaGetLastError() != cudaSuccess) {
+        return cutlass::Status::kErrorInternal;
+      }
+
+      if (below == 0) {
+        break;
+      }
+
+      // L21 = A21 * L11^-T
+      TensorRef ref_A21 = offset(ref_A, k + kb, k);
+      cutlass::TensorRef<Element, cutlass::layout::RowMajor> ref_A21t(
+        ref_A21.data(), cutlass::layout::RowMajor(ref_A.stride(0)));
+      cutlass::Status status = trsm(kb, below, Element(1), {ref_A11.data(), ref_A11.layout()}, ref_A21t, stream);
+      if (status != cutlass::Status::kSuccess) {
+        return status;
+      }
+      cudaEventRecord(panel_done_, stream);
+
+      // Look-ahead: update the next block column once the updates of the previous panels
+      // have been applied to it
+      int next_kb = cutlass::const_min(kBlock, below);
+      int rest = below - next_kb;
+      cudaStreamWaitEvent(stream, update_done_, 0);
+
+      status = syrk(next_kb, kb, ref_A21, offset(ref_A, k + kb, k + kb), stream);
+      if (status != cutlass::Status::kSuccess) {
+        return status;
+      }
+      if (rest > 0) {
+        status = gemm(
+          {rest, next_kb, kb},
+          offset(ref_A, k + kb + next_kb, k),
+          ref_A21t,
+          offset(ref_A, k + kb + next_kb, k + kb),
+          stream);
+        if (status != cutlass::Status::kSuccess) {
+          return status;
+        }
+
+        // Update the rest of the trailing matrix off the critical path
+        cudaStreamWaitEvent(update_stream, panel_done_, 0);
+        status = syrk(
+          rest, kb,
+          offset(ref_A, k + kb + next_kb, k),
+          offset(ref_A, k + kb + next_kb, k + kb + next_kb),
+          update_stream);
+        if (status != cutlass::Status::kSuccess) {
+          return status;
+        }
+        cudaEventRecord(update_done_, update_stream);
+      }
+    }
+
+    // Join the update stream
+    cudaEventRecord(update_done_, update_stream);
+    cudaStreamWaitEvent(stream, update_done_, 0);
+    return cudaGetLastError() == cudaSuccess ? cutlass::Status::kSuccess : cutlass::Status::kErrorInternal;
+  }
+
+private:
+
+  static TensorRef offset(TensorRef ref, int row, int column) {
+    ref.add_coord_offset({row, column});
+    return ref;
+  }
+
+  /// Lower triangle of C = C - A * A^T with A of N-by-K
+  static cutlass::Status syrk(int N, int K, TensorRef ref_A, TensorRef ref_C, cudaStream_t stream) {
+    typename Syrk::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {N, N, K},
+      1,
+      {Element(-1), Element(1)},
+      ref_A.data(),
+      ref_C.data(),
+      ref_C.data(),
+      0, 0, 0,
+      ref_A.stride(0),
+      ref_C.stride(0),
+      ref_C.stride(0)
+    };
+
+    Syrk syrk_op;
+    cutlass::Status status = syrk_op.can_implement(arguments);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+    status = syrk_op.initialize(arguments, nullptr, stream);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+    return syrk_op.run(stream);
+  }
+
+  /// C = C - A * B with B the row-major view of a column-major panel
+  static cutlass::Status gemm(
+    cutlass::gemm::GemmCoord problem_size,
+    TensorRef ref_A,
+    cutlass::TensorRef<Element, cutlass::layout::RowMajor> ref_B,
+    TensorRef ref_C,
+    cudaStream_t stream) {
+
+    typename Gemm::Arguments arguments{
+      problem_size,
+      {ref_A.data(), ref_A.layout()},
+      {ref_B.data(), ref_B.layout()},
+      {ref_C.data(), ref_C.layout()},
+      ref_C,
+      {Element(-1), Element(1)}
+    };
+
+    Gemm gemm_op;
+    cutlass::Status status = gemm_op.can_implement(arguments);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+    status = gemm_op.initialize(arguments, nullptr, stream);
+    if (status != cutlass::Status::kSuccess) {
+      return status;
+    }
+    return gemm_op(stream);
+  }
+
+  cudaEvent_t panel_done_;
+  cudaEvent_t update_done_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace example
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,551 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Hopper block sparse (BSR) GEMM with persistent scheduling over the nonzero blocks
+
+    This example computes D = alpha * A * B + beta * C for a block sparse A in block sparse row
+    (BSR) format with 128x64 blocks and an irregular number of nonzero blocks per block row, as in
+    block sparse attention masks and pruned MLP weights. Example 43 covers the Blocked-ELL format,
+    which has the same number of blocks in every block row, on the 2.x API.
+
+    1. The MainloopSm90TmaGmmaWarpSpecializedBlockSparse mainloop loads the nonzero blocks of A with
+    TMA from their CSR-ordered storage, and the tiles of B at the block columns of those blocks.
+    The zero blocks of A are never read.
+
+    2. The BlockSparseScheduler hands out (work unit, N tile) pairs, where a work unit is a run of
+    nonzero blocks of one block row. Block rows with many more blocks than the average are split
+    into several units, stream-K style, whose partial accumulators are reduced in a workspace in
+    order, so that one dense block row does not set the runtime of the whole grid. The units are
+    built on the host from the block row pointers with cutlass::make_block_sparse_work_units().
+
+    Every block row of A has at least one nonzero block in this example; the rows of D of an
+    empty block row are not written by the kernel.
+
+    Examples:
+
+      $ ./examples/97_hopper_bsr_gemm/97_hopper_bsr_gemm --m=4096 --n=4096 --k=8192 --density=0.1
+
+      $ ./examples/97_hopper_bsr_gemm/97_hopper_bsr_gemm --max_blocks_per_unit=0  # no splitting
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/util/block_sparse_work_units.hpp"
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// A matrix configuration, each nonzero block is row-major
+using         ElementA    = cutlass::half_t;                                // Element type for A matrix operand
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for the blocks of A
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A matrix in units of elements (up to 16 bytes)
+
+// B matrix configuration
+using         ElementB    = cutlass::half_t;                                // Element type for B matrix operand
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of B matrix in units of elements (up to 16 bytes)
+
+// C/D matrix configuration
+using         ElementC    = cutlass::half_t;                                // Element type for C and D matrix operands
+using         LayoutC     = cutlass::layout::ColumnMajor;                   // Layout type for C and D matrix operands
+constexpr int AlignmentC  = 128 / cutlass::sizeof_bits<ElementC>::value;    // Memory access granularity/alignment of C matrix in units of elements (up to 16 bytes)
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using TileShape           = Shape<_128,_128,_64>;                           // Threadblock-level tile size, (BlockM, _, BlockK) is the block size of A
+using ClusterShape        = Shape<_1,_1,_1>;                                // The block sparse mainloop does not multicast
+using KernelSchedule      = cutlass::gemm::KernelTmaWarpSpecializedCooperative;
+using EpilogueSchedule    = cutlass::epilogue::TmaWarpSpecializedCooperative;
+
+constexpr int BlockM = size<0>(TileShape{});
+constexpr int BlockK = size<2>(TileShape{});
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    TileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC, AlignmentC,
+    ElementC, LayoutC, AlignmentC,
+    EpilogueSchedule
+  >::CollectiveOp;
+
+// The dense mainloop provides the MMA, the TMA copy atoms and the shared memory layouts of the
+// block sparse mainloop
+using DenseCollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA, AlignmentA,
+    ElementB, LayoutB, AlignmentB,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    KernelSchedule
+  >::CollectiveOp;
+
+using CollectiveMainloop = cutlass::gemm::collective::CollectiveMma<
+    cutlass::gemm::MainloopSm90TmaGmmaWarpSpecializedBlockSparse<
+      DenseCollectiveMainloop::DispatchPolicy::Stages, ClusterShape, KernelSchedule>,
+    TileShape,
+    ElementA,
+    typename DenseCollectiveMainloop::StrideA,
+    ElementB,
+    typename DenseCollectiveMainloop::StrideB,
+    typename DenseCollectiveMainloop::TiledMma,
+    typename DenseCollectiveMainloop::GmemTiledCopyA,
+    typename DenseCollectiveMainloop::SmemLayoutAtomA,
+    typename DenseCollectiveMainloop::SmemCopyAtomA,
+    typename DenseCollectiveMainloop::TransformA,
+    typename DenseCollectiveMainloop::GmemTiledCopyB,
+    typename DenseCollectiveMainloop::SmemLayoutAtomB,
+    typename DenseCollectiveMainloop::SmemCopyAtomB,
+    typename DenseCollectiveMainloop::TransformB>;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>, // Indicates ProblemShape
+    CollectiveMainloop,
+    CollectiveEpilogue,
+    cutlass::gemm::BlockSparseScheduler
+>;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+using WorkUnit = typename GemmKernel::TileScheduler::WorkUnit;
+
+// Reference device GEMM implementation type, on the decompressed A
+using DeviceGemmReference = cutlass::reference::device::Gemm<
+  ElementA,
+  cutlass::layout::RowMajor,
+  ElementB,
+  LayoutB,
+  ElementC,
+  LayoutC,
+  ElementAccumulator,
+  ElementAccumulator>;
+
+using StrideA = typename Gemm::GemmKernel::StrideA;
+using StrideB = typename Gemm::GemmKernel::StrideB;
+using StrideC = typename Gemm::GemmKernel::StrideC;
+using StrideD = typename Gemm::GemmKernel::StrideD;
+
+//
+// Data members
+//
+
+/// Initialization
+StrideA stride_A;
+StrideB stride_B;
+StrideC stride_C;
+StrideD stride_D;
+uint64_t seed = 2026;
+
+// BSR A: the nonzero blocks in CSR order and their block columns
+std::vector<int32_t> block_row_ptr;
+std::vector<int32_t> block_col_indices;
+cutlass::BlockSparseWorkUnits work_units;
+
+cutlass::DeviceAllocation<ElementA> block_A;
+cutlass::DeviceAllocation<ElementA> block_A_dense;
+cutlass::DeviceAllocation<int32_t> block_col_indices_device;
+cutlass::DeviceAllocation<WorkUnit> work_units_device;
+cutlass::DeviceAllocation<typename Gemm::ElementB> block_B;
+cutlass::DeviceAllocation<typename Gemm::ElementC> block_C;
+cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput> block_D;
+cutlass::DeviceAllocation<typename Gemm::EpilogueOutputOp::ElementOutput> block_ref_D;
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Testbed utility types
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  float alpha = 1.f, beta = 0.f;
+  int iterations = 100;
+  int m = 4096, n = 4096, k = 8192;
+  float density = 0.1f;
+  // Log-normal spread of the number of blocks per block row
+  float skew = 1.f;
+  // Negative selects twice the average number of nonzero blocks per block row
+  int max_blocks_per_unit = -1;
+
+  // Parses the command line
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.f);
+    cmd.get_cmd_line_argument("beta", beta, 0.f);
+    cmd.get_cmd_line_argument("density", density, 0.1f);
+    cmd.get_cmd_line_argument("skew", skew, 1.f);
+    cmd.get_cmd_line_argument("max_blocks_per_unit", max_blocks_per_unit, -1);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "97_hopper_bsr_gemm\n\n"
+      << "  Hopper FP16 GEMM with a block sparse (BSR) A of " << 128 << "x" << 64 << " blocks.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM, a multiple of 128\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM, a multiple of 64\n"
+      << "  --alpha=<f32>               Epilogue scalar alpha\n"
+      << "  --beta=<f32>                Epilogue scalar beta\n\n"
+      << "  --density=<f32>             Average fraction of nonzero blocks of A\n"
+      << "  --skew=<f32>                Spread of the number of nonzero blocks per block row (0 is uniform)\n"
+      << "  --max_blocks_per_unit=<int> Splits block rows with more nonzero blocks (0 never splits, negative is automatic)\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    out
+      << "\n\nExamples:\n\n"
+      << "$ " << "97_hopper_bsr_gemm" << " --m=4096 --n=4096 --k=8192 --density=0.1 --skew=1.5\n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GFLOP/s of the nonzero blocks of A
+  double gflops(double runtime_s, size_t nonzeros_A) const
+  {
+    // Two flops per multiply-add
+    double flop = 2.0 * double(nonzeros_A) * double(n);
+    return flop / double(1.0e9) / runtime_s;
+  }
+};
+
+/// Result structure
+struct Result
+{
+  double avg_runtime_ms = 0;
+  double gflops = 0;
+  bool passed = false;
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Builds a random sparsity pattern with a log-normal number of nonzero blocks per block row,
+/// and at least one block per block row
+void initialize_pattern(const Options &options) {
+  int block_rows = options.m / BlockM;
+  int block_cols = options.k / BlockK;
+
+  std::mt19937 generator(static_cast<uint32_t>(seed));
+  std::lognormal_distribution<float> spread(-0.5f * options.skew * options.skew, options.skew);
+  std::vector<int32_t> columns(block_cols);
+  std::iota(columns.begin(), columns.end(), 0);
+
+  block_row_ptr.assign(1, 0);
+  block_col_indices.clear();
+  for (int row = 0; row < block_rows; ++row) {
+    float weight = options.skew > 0.f ? spread(generator) : 1.f;
+    int count = static_cast<int>(options.density * block_cols * weight + 0.5f);
+    count = std::min(std::max(count, 1), block_cols);
+
+    std::shuffle(columns.begin(), columns.end(), generator);
+    std::sort(columns.begin(), columns.begin() + count);
+    block_col_indices.insert(block_col_indices.end(), columns.begin(), columns.begin() + count);
+    block_row_ptr.push_back(static_cast<int32_t>(block_col_indices.size()));
+  }
+}
+
+/// Expands the nonzero blocks of A into a dense row-major matrix for the reference
+void initialize_dense_A(const Options &options) {
+  size_t block_size = size_t(BlockM) * BlockK;
+  std::vector<ElementA> blocks(block_A.size());
+  std::vector<ElementA> dense(size_t(options.m) * options.k, ElementA(0));
+  block_A.copy_to_host(blocks.data());
+
+  int block_rows = options.m / BlockM;
+  for (int row = 0; row < block_rows; ++row) {
+    for (int b = block_row_ptr[row]; b < block_row_ptr[row + 1]; ++b) {
+      for (int i = 0; i < BlockM; ++i) {
+        for (int kk = 0; kk < BlockK; ++kk) {
+          dense[size_t(row * BlockM + i) * options.k + block_col_indices[b] * BlockK + kk] =
+            blocks[b * block_size + i * BlockK + kk];
+        }
+      }
+    }
+  }
+
+  block_A_dense.reset(dense.size());
+  block_A_dense.copy_from_host(dense.data());
+}
+
+/// Helper to initialize a block of device data
+template <class Element>
+bool initialize_block(
+  cutlass::DeviceAllocation<Element>& block,
+  uint64_t seed=2023) {
+
+  cutlass::reference::device::BlockFillRandomUniform(
+    block.get(), block.size(), seed, Element(2), Element(-2), 0);
+
+  return true;
+}
+
+/// Initialize operands to be used in the GEMM and reference GEMM
+void initialize(const Options &options) {
+
+  initialize_pattern(options);
+  size_t num_blocks = block_col_indices.size();
+
+  int max_blocks_per_unit = options.max_blocks_per_unit;
+  if (max_blocks_per_unit < 0) {
+    max_blocks_per_unit = std::max(2, static_cast<int>(2 * num_blocks / (options.m / BlockM)));
+  }
+  work_units = cutlass::make_block_sparse_work_units(block_row_ptr, max_blocks_per_unit);
+
+  // Row-major blocks stacked along L
+  stride_A = make_stride(int64_t(BlockK), _1{}, int64_t(BlockM * BlockK));
+  stride_B = cutlass::make_cute_packed_stride(StrideB{}, {options.n, options.k, 1});
+  stride_C = cutlass::make_cute_packed_stride(StrideC{}, {options.m, options.n, 1});
+  stride_D = cutlass::make_cute_packed_stride(StrideD{}, {options.m, options.n, 1});
+
+  block_A.reset(num_blocks * BlockM * BlockK);
+  block_col_indices_device.reset(num_blocks);
+  block_col_indices_device.copy_from_host(block_col_indices.data());
+  work_units_device.reset(work_units.units.size());
+  work_units_device.copy_from_host(work_units.units.data());
+  block_B.reset(size_t(options.k) * options.n);
+  block_C.reset(size_t(options.m) * options.n);
+  block_D.reset(size_t(options.m) * options.n);
+  block_ref_D.reset(size_t(options.m) * options.n);
+
+  initialize_block(block_A, seed + 2023);
+  initialize_block(block_B, seed + 2022);
+  initialize_block(block_C, seed + 2021);
+
+  initialize_dense_A(options);
+}
+
+/// Populates a Gemm::Arguments structure from the given commandline options
+typename Gemm::Arguments args_from_options(const Options &options, cutlass::KernelHardwareInfo const& hw_info)
+{
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {options.m, options.n, options.k, 1},
+    {
+      block_A.get(), stride_A,
+      static_cast<int32_t>(block_col_indices.size()), block_col_indices_device.get(),
+      block_B.get(), stride_B
+    },
+    {{options.alpha, options.beta}, block_C.get(), stride_C, block_D.get(), stride_D},
+    hw_info
+  };
+
+  arguments.scheduler.work_units = work_units_device.get();
+  arguments.scheduler.num_work_units = static_cast<int32_t>(work_units.units.size());
+  arguments.scheduler.num_split_rows = work_units.num_split_rows;
+
+  return arguments;
+}
+
+bool verify(const Options &options) {
+  cutlass::TensorRef ref_A(block_A_dense.get(), cutlass::layout::RowMajor::packed({options.m, options.k}));
+  cutlass::TensorRef ref_B(block_B.get(), Gemm::LayoutB::packed({options.k, options.n}));
+  cutlass::TensorRef ref_C(block_C.get(), Gemm::LayoutC::packed({options.m, options.n}));
+  cutlass::TensorRef ref_D(block_ref_D.get(), Gemm::LayoutD::packed({options.m, options.n}));
+
+  DeviceGemmReference gemm_reference;
+
+  gemm_reference(
+    {options.m, options.n, options.k},
+    ElementAccumulator(options.alpha),
+    ref_A,
+    ref_B,
+    ElementAccumulator(options.beta),
+    ref_C,
+    ref_D);
+
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // The splits of a block row sum their partials in a different order than the reference
+  return cutlass::reference::device::BlockCompareRelativelyEqual(
+    block_ref_D.get(), block_D.get(), block_D.size(), ElementC(1e-2f), ElementC(1e-1f));
+}
+
+/// Execute a given example GEMM computation
+template <typename Gemm>
+int run(Options &options)
+{
+  int device_id = 0;
+  cutlass::KernelHardwareInfo hw_info = cutlass::KernelHardwareInfo::make_kernel_hardware_info<Gemm::GemmKernel>(device_id);
+
+  initialize(options);
+
+  Gemm gemm;
+
+  auto arguments = args_from_options(options, hw_info);
+
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+
+  // Correctness / Warmup iteration
+  CUTLASS_CHECK(gemm.run());
+
+  Result result;
+  result.passed = verify(options);
+
+  int block_rows = options.m / BlockM;
+  std::cout << "  Problem Size: " << options.m << 'x' << options.n << 'x' << options.k << std::endl;
+  std::cout << "  Nonzero blocks: " << block_col_indices.size() << " of " << size_t(block_rows) * (options.k / BlockK)
+            << ", " << work_units.units.size() << " work units, " << work_units.num_split_rows << " split block rows" << std::endl;
+  std::cout << "  Disposition: " << (result.passed ? "Passed" : "Failed") << std::endl;
+
+  if (!result.passed) {
+    exit(-1);
+  }
+
+  // Run profiling loop
+  if (options.iterations > 0)
+  {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+      CUTLASS_CHECK(gemm.run());
+    }
+    timer.stop();
+
+    float elapsed_ms = timer.elapsed_millis();
+    result.avg_runtime_ms = double(elapsed_ms) / double(options.iterations);
+    result.gflops = options.gflops(result.avg_runtime_ms / 1000.0, block_A.size());
+
+    std::cout << "  Avg runtime: " << result.avg_runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS: " << result.gflops << std::endl;
+  }
+
+  return 0;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture (compute capability 90).\n";
+    return 0;
+  }
+
+  //
+  // Parse options
+  //
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+  if (options.m % 128 != 0 || options.k % 64 != 0) {
+    std::cerr << "M must be a multiple of 128 and K a multiple of 64.\n";
+    return -1;
+  }
+
+  //
+  // Evaluate CUTLASS kernels
+  //
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  run<Gemm>(options);
+#endif
+
+  return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
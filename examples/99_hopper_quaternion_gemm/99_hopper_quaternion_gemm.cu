@@ -0,0 +1,321 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Quaternion GEMM on Hopper tensor cores.
+
+    Examples 21_quaternion_gemm and 22_quaternion_conv compute quaternion products on SIMT cores.
+    This example instead maps a quaternion GEMM D = alpha * A * B + beta * C onto a real-valued
+    CUTLASS 3 tensor core GEMM:
+
+      - A (M x K) and C/D (M x N) are row-major quaternion matrices stored as (x, y, z, w) tuples.
+        Reinterpreted as real matrices they are simply row-major M x 4K and M x 4N.
+      - Every element b of B is replaced by its 4x4 right-product matrix R(b) (a * b == R(b) a),
+        producing the column-major real matrix B_real of extent 4K x 4N.
+
+    The real GEMM (M, 4N, 4K) performs exactly the 16 real products per quaternion product of the
+    SIMT kernel with shared loads of A and C, but on WGMMA (tf32 for float inputs). Expanding B costs
+    4x its storage and is typically done once per weight tensor with
+    cutlass::quaternion_right_product_expand(). The same expansion feeds any SM90/SM100 collective.
+
+    Usage:
+
+      $ ./examples/99_hopper_quaternion_gemm/99_hopper_quaternion_gemm --m=1024 --n=512 --k=1024
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/quaternion.h"
+
+#include "cute/tensor.hpp"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/util/command_line.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/device_quaternion_expand.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/gemm.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+#include "helper.h"
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Command line options parsing
+struct Options {
+
+  bool help = false;
+
+  int m = 1024, n = 512, k = 1024;
+  float alpha = 1.f, beta = 0.f;
+  int iterations = 20;
+
+  void parse(int argc, char const **args) {
+    cutlass::CommandLine cmd(argc, args);
+
+    if (cmd.check_cmd_line_flag("help")) {
+      help = true;
+      return;
+    }
+
+    cmd.get_cmd_line_argument("m", m);
+    cmd.get_cmd_line_argument("n", n);
+    cmd.get_cmd_line_argument("k", k);
+    cmd.get_cmd_line_argument("alpha", alpha, 1.f);
+    cmd.get_cmd_line_argument("beta", beta, 0.f);
+    cmd.get_cmd_line_argument("iterations", iterations);
+  }
+
+  /// Prints the usage statement.
+  std::ostream & print_usage(std::ostream &out) const {
+
+    out << "99_hopper_quaternion_gemm\n\n"
+      << "  Quaternion GEMM computed as a real Hopper tensor core GEMM.\n\n"
+      << "Options:\n\n"
+      << "  --help                      If specified, displays this usage statement\n\n"
+      << "  --m=<int>                   Sets the M extent of the GEMM (in quaternions)\n"
+      << "  --n=<int>                   Sets the N extent of the GEMM (in quaternions)\n"
+      << "  --k=<int>                   Sets the K extent of the GEMM (in quaternions)\n"
+      << "  --alpha=<f32>               Epilogue scalar alpha\n"
+      << "  --beta=<f32>                Epilogue scalar beta\n\n"
+      << "  --iterations=<int>          Number of profiling iterations to perform.\n\n";
+
+    return out;
+  }
+
+  /// Compute performance in GFLOP/s, counting 16 multiply-adds per quaternion product
+  double gflops(double runtime_s) const {
+    uint64_t flop = uint64_t(2) * 16 * m * n * k;
+    return double(flop) / double(1.0e9) / runtime_s;
+  }
+};
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM kernel configurations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Element             = float;                                          // Real type of the quaternion components
+using ElementQuaternion   = cutlass::Quaternion<Element>;
+
+// Real views of the quaternion operands
+using         LayoutA     = cutlass::layout::RowMajor;                      // A_real (M x 4K) aliases quaternion A
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // B_real (4K x 4N) is the expanded B
+using         LayoutC     = cutlass::layout::RowMajor;                      // C_real/D_real (M x 4N) alias quaternion C/D
+constexpr int Alignment   = 128 / cutlass::sizeof_bits<Element>::value;    // One quaternion per 16B vector
+
+// Core kernel configurations
+using ElementAccumulator  = float;                                          // Element type for internal accumulation
+using ArchTag             = cutlass::arch::Sm90;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                 // Operator class tag
+using TileShape           = Shape<_128,_128,_32>;                           // Threadblock-level tile size
+using ClusterShape        = Shape<_1,_2,_1>;                                // Shape of the threadblocks in a cluster
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    TileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    Element, LayoutC, Alignment,
+    Element, LayoutC, Alignment,
+    cutlass::epilogue::collective::EpilogueScheduleAuto
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    Element, LayoutA, Alignment,
+    Element, LayoutB, Alignment,
+    ElementAccumulator,
+    TileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    cutlass::gemm::collective::KernelScheduleAuto
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    Shape<int,int,int,int>, // Indicates ProblemShape
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+
+using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+using StrideA = typename Gemm::GemmKernel::StrideA;
+using StrideB = typename Gemm::GemmKernel::StrideB;
+using StrideC = typename Gemm::GemmKernel::StrideC;
+using StrideD = typename Gemm::GemmKernel::StrideD;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// GEMM setup and evaluation
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+int run(Options const& options) {
+
+  int M = options.m, N = options.n, K = options.k;
+
+  cutlass::HostTensor<ElementQuaternion, cutlass::layout::RowMajor> tensor_A({M, K});
+  cutlass::HostTensor<ElementQuaternion, cutlass::layout::RowMajor> tensor_B({K, N});
+  cutlass::HostTensor<ElementQuaternion, cutlass::layout::RowMajor> tensor_C({M, N});
+  cutlass::HostTensor<ElementQuaternion, cutlass::layout::RowMajor> tensor_D({M, N});
+  cutlass::HostTensor<ElementQuaternion, cutlass::layout::RowMajor> tensor_ref_D({M, N});
+
+  // Integer-valued data keeps the tf32 tensor core result exact so it can be compared bitwise
+  cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), 1, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), 2, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), 3, 4, -4, 0);
+  cutlass::reference::host::TensorFill(tensor_D.host_view());
+  cutlass::reference::host::TensorFill(tensor_ref_D.host_view());
+
+  tensor_A.sync_device();
+  tensor_B.sync_device();
+  tensor_C.sync_device();
+  tensor_D.sync_device();
+  tensor_ref_D.sync_device();
+
+  // Expand B into its real right-product form once
+  cutlass::DeviceAllocation<Element> block_B_real(size_t(4 * K) * (4 * N));
+  cutlass::TensorRef<Element, cutlass::layout::ColumnMajor> ref_B_real(block_B_real.get(), cutlass::layout::ColumnMajor(4 * K));
+  cutlass::quaternion_right_product_expand<Element, cutlass::layout::RowMajor>(
+    {K, N}, tensor_B.device_ref().const_ref(), ref_B_real, nullptr);
+
+  auto stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, 4 * K, 1));
+  auto stride_B = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(4 * N, 4 * K, 1));
+  auto stride_C = cutlass::make_cute_packed_stride(StrideC{}, cute::make_shape(M, 4 * N, 1));
+  auto stride_D = cutlass::make_cute_packed_stride(StrideD{}, cute::make_shape(M, 4 * N, 1));
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, 4 * N, 4 * K, 1},
+    {reinterpret_cast<Element const*>(tensor_A.device_data()), stride_A, block_B_real.get(), stride_B},
+    {{options.alpha, options.beta},
+     reinterpret_cast<Element const*>(tensor_C.device_data()), stride_C,
+     reinterpret_cast<Element*>(tensor_D.device_data()), stride_D}
+  };
+
+  Gemm gemm;
+  size_t workspace_size = Gemm::get_workspace_size(arguments);
+  cutlass::device_memory::allocation<uint8_t> workspace(workspace_size);
+
+  CUTLASS_CHECK(gemm.can_implement(arguments));
+  CUTLASS_CHECK(gemm.initialize(arguments, workspace.get()));
+  CUTLASS_CHECK(gemm.run());
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  // Reference quaternion GEMM
+  cutlass::reference::device::Gemm<ElementQuaternion, cutlass::layout::RowMajor,
+                                   ElementQuaternion, cutlass::layout::RowMajor,
+                                   ElementQuaternion, cutlass::layout::RowMajor,
+                                   ElementQuaternion, ElementQuaternion> gemm_reference;
+
+  gemm_reference({M, N, K},
+                 ElementQuaternion(options.alpha),
+                 tensor_A.device_ref(),
+                 tensor_B.device_ref(),
+                 ElementQuaternion(options.beta),
+                 tensor_C.device_ref(),
+                 tensor_ref_D.device_ref());
+  CUDA_CHECK(cudaDeviceSynchronize());
+
+  tensor_D.sync_host();
+  tensor_ref_D.sync_host();
+
+  bool passed = cutlass::reference::host::TensorEquals(tensor_D.host_view(), tensor_ref_D.host_view());
+  std::cout << "  Disposition: " << (passed ? "Passed" : "Failed") << std::endl;
+
+  if (passed && options.iterations > 0) {
+    GpuTimer timer;
+    timer.start();
+    for (int iter = 0; iter < options.iterations; ++iter) {
+      CUTLASS_CHECK(gemm.run());
+    }
+    timer.stop();
+
+    double runtime_ms = double(timer.elapsed_millis()) / double(options.iterations);
+    std::cout << "  Problem Size: " << M << 'x' << N << 'x' << K << " quaternions" << std::endl;
+    std::cout << "  Avg runtime: " << runtime_ms << " ms" << std::endl;
+    std::cout << "  GFLOPS: " << options.gflops(runtime_ms / 1000.0) << std::endl;
+  }
+
+  return passed ? 0 : -1;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char const **args) {
+
+  // CUTLASS must be compiled with CUDA 12.0 Toolkit to run this example
+  // and must have compute capability at least 90.
+  if (__CUDACC_VER_MAJOR__ < 12) {
+    std::cerr << "This example requires CUDA 12 or newer.\n";
+    // Returning zero so this test passes on older Toolkits. Its actions are no-op.
+    return 0;
+  }
+
+  cudaDeviceProp props;
+  int current_device_id;
+  CUDA_CHECK(cudaGetDevice(&current_device_id));
+  CUDA_CHECK(cudaGetDeviceProperties(&props, current_device_id));
+  if (props.major != 9 || props.minor != 0) {
+    std::cerr
+      << "This example requires a GPU of NVIDIA's Hopper Architecture "
+      << "(compute capability 90).\n";
+    return 0;
+  }
+
+  Options options;
+
+  options.parse(argc, args);
+
+  if (options.help) {
+    options.print_usage(std::cout) << std::endl;
+    return 0;
+  }
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  return run(options);
+#else
+  return 0;
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,389 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Autotuning helpers for Distributed GEMM
+
+    profile_dist_gemm runs one Distributed GEMM configuration across all of its devices, and
+    measures its runtime alongside the compute-only runtime of its local GEMMs on a single device.
+    The ratio of the two is the overlap efficiency of the schedule: 1.0 means that communication is
+    entirely hidden behind compute.
+
+    Operands are filled with random data, and results are not verified; the Distributed GEMM
+    examples verify each schedule against a single-device reference.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/device/tensor_fill.h"
+
+#include "helper.h"
+#include "dist_gemm_helpers.h"
+
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Profiling results
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct DistGemmProfileResult {
+  std::string name;
+  int tp = 0;
+  cutlass::Status status = cutlass::Status::kSuccess;
+  double avg_runtime_ms = 0.0;
+  double compute_only_ms = 0.0;
+  double tflops = 0.0;
+
+  bool valid() const {
+    return status == cutlass::Status::kSuccess && avg_runtime_ms > 0.0;
+  }
+
+  double overlap_efficiency() const {
+    return valid() ? compute_only_ms / avg_runtime_ms : 0.0;
+  }
+};
+
+/// Prints profiled configurations from fastest to slowest, followed by the best configuration.
+inline std::ostream &
+print_profile_results(std::vector<DistGemmProfileResult> results, std::ostream &out) {
+  std::stable_sort(results.begin(), results.end(),
+      [](DistGemmProfileResult const& lhs, DistGemmProfileResult const& rhs) {
+        if (lhs.valid() != rhs.valid()) {
+          return lhs.valid();
+        }
+        return lhs.avg_runtime_ms < rhs.avg_runtime_ms;
+      });
+
+  out << "  " << std::left << std::setw(72) << "Configuration" << std::right
+    << std::setw(4) << "TP"
+    << std::setw(14) << "Runtime (ms)"
+    << std::setw(14) << "Compute (ms)"
+    << std::setw(10) << "TFLOPS"
+    << std::setw(10) << "Overlap" << "\n";
+
+  for (auto const& result : results) {
+    out << "  " << std::left << std::setw(72) << result.name << std::right << std::setw(4) << result.tp;
+    if (result.valid()) {
+      out << std::fixed << std::setprecision(3)
+        << std::setw(14) << result.avg_runtime_ms
+        << std::setw(14) << result.compute_only_ms
+        << std::setprecision(1)
+        << std::setw(10) << result.tflops
+        << std::setw(9) << result.overlap_efficiency() * 100.0 << "%";
+    }
+    else {
+      out << "    " << cutlassGetStatusString(result.status);
+    }
+    out << "\n";
+  }
+
+  if (not results.empty() && results.front().valid()) {
+    auto const& best = results.front();
+    out << "\n  Best configuration: " << best.name << " (TP = " << best.tp << ")\n"
+      << "    Avg runtime: " << std::fixed << std::setprecision(3) << best.avg_runtime_ms << " ms\n"
+      << "    Compute-only runtime: " << best.compute_only_ms << " ms\n"
+      << "    Overlap efficiency: " << std::setprecision(1) << best.overlap_efficiency() * 100.0 << "%\n";
+  }
+  else {
+    out << "\n  No configuration could run this problem.\n";
+  }
+
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Distributed GEMM profiler
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template <typename Element>
+void fill_random_uniform(Element* ptr, size_t capacity, uint64_t seed) {
+  using Real = typename cutlass::RealType<Element>::Type;
+  cutlass::reference::device::BlockFillRandomUniform(
+    ptr, capacity, seed, static_cast<Real>(2), static_cast<Real>(-2), 0);
+}
+
+} // namespace detail
+
+/// Profiles DistGemm on devices [0, TP), and the compute-only runtime of its local GEMMs with Gemm,
+/// the single-device GEMM it wraps. Peer access must be enabled.
+template <class DistGemm, class Gemm, class ProblemShape>
+DistGemmProfileResult
+profile_dist_gemm(
+    std::string name,
+    ProblemShape problem_shape,
+    float alpha,
+    float beta,
+    int warmup_iterations,
+    int iterations,
+    bool launch_with_pdl,
+    uint64_t seed = 2024) {
+
+  using DistSchedule = typename DistGemm::DistSchedule;
+  static constexpr int TP_ = DistGemm::TP_;
+
+  using ElementA = typename DistGemm::ElementA;
+  using ElementB = typename DistGemm::ElementB;
+  using ElementC = typename DistGemm::ElementC;
+  using ElementD = typename DistGemm::ElementD;
+  using StrideA = typename DistGemm::StrideA;
+  using StrideB = typename DistGemm::StrideB;
+  using StrideC = typename DistGemm::StrideC;
+  using StrideD = typename DistGemm::StrideD;
+
+  DistGemmProfileResult result;
+  result.name = name;
+  result.tp = TP_;
+
+  if (not DistSchedule::can_implement_global(problem_shape)) {
+    result.status = cutlass::Status::kErrorInvalidProblem;
+    return result;
+  }
+
+  int primary_device_idx;
+  CUDA_CHECK(cudaGetDevice(&primary_device_idx));
+
+  //
+  // Distributed GEMM
+  //
+
+  auto local_shape_A = DistSchedule::get_local_a_shape(problem_shape);
+  auto local_shape_B = DistSchedule::get_local_b_shape(problem_shape);
+  auto local_shape_C = DistSchedule::get_local_c_shape(problem_shape);
+  auto local_shape_D = DistSchedule::get_local_d_shape(problem_shape);
+
+  auto local_stride_A = cutlass::make_cute_packed_stride(StrideA{}, local_shape_A);
+  auto local_stride_B = cutlass::make_cute_packed_stride(StrideB{}, local_shape_B);
+  auto local_stride_C = cutlass::make_cute_packed_stride(StrideC{}, local_shape_C);
+  auto local_stride_D = cutlass::make_cute_packed_stride(StrideD{}, local_shape_D);
+
+  cutlass::device_memory::allocation<ElementA> tensor_A_arr[TP_];
+  cutlass::device_memory::allocation<ElementB> tensor_B_arr[TP_];
+  cutlass::device_memory::allocation<ElementC> tensor_C_arr[TP_];
+  cutlass::device_memory::allocation<ElementD> tensor_D_arr[TP_];
+
+  typename DistGemm::Arguments arguments_[TP_];
+
+  for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+    CUDA_CHECK(cudaSetDevice(device_idx));
+
+    tensor_A_arr[device_idx].reset(cute::size(local_shape_A));
+    tensor_B_arr[device_idx].reset(cute::size(local_shape_B));
+    tensor_C_arr[device_idx].reset(cute::size(local_shape_C));
+    tensor_D_arr[device_idx].reset(cute::size(local_shape_D));
+
+    detail::fill_random_uniform(tensor_A_arr[device_idx].get(), tensor_A_arr[device_idx].size(), seed + 3 * device_idx);
+    detail::fill_random_uniform(tensor_B_arr[device_idx].get(), tensor_B_arr[device_idx].size(), seed + 3 * device_idx + 1);
+    detail::fill_random_uniform(tensor_C_arr[device_idx].get(), tensor_C_arr[device_idx].size(), seed + 3 * device_idx + 2);
+
+    arguments_[device_idx] = {
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      problem_shape,
+      {tensor_A_arr[device_idx].get(), local_stride_A, tensor_B_arr[device_idx].get(), local_stride_B},
+      {{}, tensor_C_arr[device_idx].get(), local_stride_C, tensor_D_arr[device_idx].get(), local_stride_D},
+      {},
+      {}
+    };
+    arguments_[device_idx].epilogue.thread.alpha = alpha;
+    arguments_[device_idx].epilogue.thread.beta = beta;
+
+    result.status = DistGemm::can_implement(arguments_[device_idx]);
+    if (result.status != cutlass::Status::kSuccess) {
+      CUDA_CHECK(cudaSetDevice(primary_device_idx));
+      return result;
+    }
+  }
+
+  cudaStream_t stream_arr[TP_];
+  DistGemm dist_gemm_arr[TP_];
+  cutlass::device_memory::allocation<uint8_t> workspace_arr[TP_];
+  cutlass::device_memory::allocation<uint8_t> exclusive_workspace_arr[TP_];
+  void * workspace_ptr_arr[TP_];
+  void * exclusive_workspace_ptr_arr[TP_];
+
+  for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+    CUDA_CHECK(cudaSetDevice(device_idx));
+    CUDA_CHECK(cudaStreamCreate(&stream_arr[device_idx]));
+
+    size_t workspace_size = DistGemm::get_workspace_size(arguments_, device_idx);
+    size_t exclusive_workspace_size = DistGemm::get_exclusive_workspace_size();
+
+    workspace_arr[device_idx] = cutlass::device_memory::allocation<uint8_t>(workspace_size);
+    exclusive_workspace_arr[device_idx] = cutlass::device_memory::allocation<uint8_t>(exclusive_workspace_size);
+
+    workspace_ptr_arr[device_idx] = workspace_arr[device_idx].get();
+    exclusive_workspace_ptr_arr[device_idx] = exclusive_workspace_arr[device_idx].get();
+
+    CUDA_CHECK(cudaMemsetAsync(exclusive_workspace_ptr_arr[device_idx], 0, exclusive_workspace_size, stream_arr[device_idx]));
+    CUDA_CHECK(cudaDeviceSynchronize());
+  }
+
+  for (int device_idx = 0; device_idx < TP_ && result.status == cutlass::Status::kSuccess; ++device_idx) {
+    CUDA_CHECK(cudaSetDevice(device_idx));
+    result.status = dist_gemm_arr[device_idx].initialize(
+        arguments_,
+        workspace_ptr_arr,
+        exclusive_workspace_ptr_arr,
+        device_idx,
+        stream_arr[device_idx],
+        launch_with_pdl);
+    CUDA_CHECK(cudaDeviceSynchronize());
+  }
+
+  if (result.status == cutlass::Status::kSuccess) {
+    auto run_all_devices = [&]() {
+      for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+        CUDA_CHECK(cudaSetDevice(device_idx));
+        CUTLASS_CHECK(dist_gemm_arr[device_idx].run(stream_arr[device_idx]));
+      }
+    };
+
+    // Warmup
+    for (int warmup_iter = 0; warmup_iter < warmup_iterations; ++warmup_iter) {
+      run_all_devices();
+    }
+    for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+      CUDA_CHECK(cudaSetDevice(device_idx));
+      CUDA_CHECK(cudaStreamSynchronize(stream_arr[device_idx]));
+    }
+
+    // Benchmark; the delay kernel releases all devices at once
+    cutlass::AtomicBoolean* atomic_flag_ptr;
+    CUDA_CHECK(cudaHostAlloc(&atomic_flag_ptr, sizeof(cutlass::AtomicBoolean), cudaHostAllocPortable));
+    atomic_flag_ptr->store(false);
+
+    {
+      cutlass::DistGpuTimer<TP_> timer;
+
+      for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+        CUDA_CHECK(cudaSetDevice(device_idx));
+        cutlass::delay_kernel<<<1, 1, 0, stream_arr[device_idx]>>>(atomic_flag_ptr);
+        CUDA_CHECK(cudaGetLastError());
+        timer.start(device_idx, stream_arr[device_idx]);
+      }
+
+      atomic_flag_ptr->store(true);
+
+      for (int profile_iter = 0; profile_iter < iterations; ++profile_iter) {
+        run_all_devices();
+      }
+
+      float elapsed_ms = 0.f;
+      for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+        CUDA_CHECK(cudaSetDevice(device_idx));
+        timer.stop(device_idx, stream_arr[device_idx]);
+      }
+      for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+        elapsed_ms = std::max(elapsed_ms, timer.elapsed_millis(device_idx));
+      }
+
+      result.avg_runtime_ms = double(elapsed_ms) / double(iterations);
+    }
+
+    CUDA_CHECK(cudaFreeHost(atomic_flag_ptr));
+  }
+
+  for (int device_idx = 0; device_idx < TP_; ++device_idx) {
+    CUDA_CHECK(cudaSetDevice(device_idx));
+    CUDA_CHECK(cudaStreamSynchronize(stream_arr[device_idx]));
+    CUDA_CHECK(cudaStreamDestroy(stream_arr[device_idx]));
+  }
+  CUDA_CHECK(cudaSetDevice(primary_device_idx));
+
+  if (result.status != cutlass::Status::kSuccess) {
+    return result;
+  }
+
+  auto [M, N, K, L] = cute::append<4>(problem_shape, 1);
+  double flop = 2.0 * double(M) * double(N) * double(K) * double(L) / double(TP_);
+  result.tflops = flop / (result.avg_runtime_ms * 1.0e9);
+
+  //
+  // Compute only: the local GEMM of every iteration, back to back on a single device
+  //
+
+  auto [local_M, local_N, local_K, local_L] = DistSchedule::get_local_gemm_shape(problem_shape);
+  int num_iterations = cute::size(typename DistSchedule::IterationTiler{});
+
+  auto gemm_shape_A = cute::make_shape(int(local_M), int(local_K), int(local_L));
+  auto gemm_shape_B = cute::make_shape(int(local_N), int(local_K), int(local_L));
+  auto gemm_shape_C = cute::make_shape(int(local_M), int(local_N), int(local_L));
+
+  cutlass::device_memory::allocation<ElementA> gemm_A(cute::size(gemm_shape_A));
+  cutlass::device_memory::allocation<ElementB> gemm_B(cute::size(gemm_shape_B));
+  cutlass::device_memory::allocation<ElementC> gemm_C(cute::size(gemm_shape_C));
+  cutlass::device_memory::allocation<ElementD> gemm_D(cute::size(gemm_shape_C));
+
+  detail::fill_random_uniform(gemm_A.get(), gemm_A.size(), seed);
+  detail::fill_random_uniform(gemm_B.get(), gemm_B.size(), seed + 1);
+  detail::fill_random_uniform(gemm_C.get(), gemm_C.size(), seed + 2);
+
+  typename Gemm::Arguments gemm_arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {int(local_M), int(local_N), int(local_K), int(local_L)},
+    {gemm_A.get(), cutlass::make_cute_packed_stride(StrideA{}, gemm_shape_A),
+     gemm_B.get(), cutlass::make_cute_packed_stride(StrideB{}, gemm_shape_B)},
+    {{}, gemm_C.get(), cutlass::make_cute_packed_stride(StrideC{}, gemm_shape_C),
+     gemm_D.get(), cutlass::make_cute_packed_stride(StrideD{}, gemm_shape_C)}
+  };
+  gemm_arguments.epilogue.thread.alpha = alpha;
+  gemm_arguments.epilogue.thread.beta = beta;
+
+  Gemm gemm;
+  cutlass::device_memory::allocation<uint8_t> gemm_workspace(Gemm::get_workspace_size(gemm_arguments));
+
+  result.status = gemm.can_implement(gemm_arguments);
+  if (result.status == cutlass::Status::kSuccess) {
+    result.status = gemm.initialize(gemm_arguments, gemm_workspace.get());
+  }
+  if (result.status != cutlass::Status::kSuccess) {
+    return result;
+  }
+
+  auto gemm_result = run_benchmark([&]() { CUTLASS_CHECK(gemm.run()); }, warmup_iterations, iterations);
+  result.compute_only_ms = gemm_result.avg_runtime_ms * double(num_iterations);
+
+  return result;
+}
+
+} //namespace cutlass
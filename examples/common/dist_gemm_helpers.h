@@ -36,11 +36,16 @@
     the host will set off once it launches DistGEMM across all devices.
 
     DistGpuTimer extends cutlass's existing cudaEvent-based timer to multiple devices.
+
+    PeerTopology measures the peer bandwidth and latency matrices between devices.
 */
 
 #pragma once
 #include "cutlass/cutlass.h"
 #include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
 #include <cuda/atomic>
 #include CUDA_STD_HEADER(atomic)
 
@@ -161,4 +166,174 @@ void device_copy(TensorSource      tensor_source,
   device_copy_kernel<<<grid, block, 0, stream>>>(tensor_source, tensor_destination);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Peer access
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Enables any-to-any peer access between the first num_devices devices.
+/// Returns false if any pair of devices can't access each other.
+bool enable_peer_access(int num_devices) {
+  int primary_device_idx;
+  CUDA_CHECK(cudaGetDevice(&primary_device_idx));
+
+  for (int device_idx = 0; device_idx < num_devices; ++device_idx) {
+    CUDA_CHECK(cudaSetDevice(device_idx));
+    for (int peer_idx = 0; peer_idx < num_devices; ++peer_idx) {
+      if (peer_idx == device_idx) {
+        continue;
+      }
+      int can_access;
+      CUDA_CHECK(cudaDeviceCanAccessPeer(&can_access, device_idx, peer_idx));
+      if (not can_access) {
+        std::cerr << "FAILURE: Device " << device_idx << " can't access device " << peer_idx << "." <<
+          std::endl;
+        CUDA_CHECK(cudaSetDevice(primary_device_idx));
+        return false;
+      }
+      cudaError_t result = cudaDeviceEnablePeerAccess(peer_idx, 0);
+      if (result == cudaErrorPeerAccessAlreadyEnabled) {
+        result = cudaGetLastError(); // to clear the error bit
+      }
+      else {
+        CUDA_CHECK(result);
+      }
+    }
+  }
+
+  CUDA_CHECK(cudaSetDevice(primary_device_idx));
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+/// Peer topology
+/// Bandwidth of copy engine peer copies, and latency of dependent loads from peer memory, for
+/// every pair of devices. Peer access must be enabled.
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+__global__ void peer_latency_kernel(uint32_t volatile const* peer_ptr, int iterations, uint32_t* result_ptr) {
+  // Peer memory is zeroed, so every load depends on the previous one
+  uint32_t offset = 0;
+  for (int i = 0; i < iterations; ++i) {
+    offset = peer_ptr[offset];
+  }
+  *result_ptr = offset;
+}
+
+struct PeerTopology {
+  int num_devices = 0;
+  std::vector<std::vector<double>> bandwidth_gbps;   // [src][dst], GB/s
+  std::vector<std::vector<double>> latency_us;       // [src][dst], microseconds
+
+  /// Measures bandwidth by pushing copy_bytes from every device to every peer, and latency
+  /// with a chain of dependent loads from every peer.
+  void measure(
+      int num_devices_,
+      size_t copy_bytes = size_t(256) << 20,
+      int copy_iterations = 20,
+      int latency_iterations = 10000) {
+
+    num_devices = num_devices_;
+    bandwidth_gbps.assign(num_devices, std::vector<double>(num_devices, 0.0));
+    latency_us.assign(num_devices, std::vector<double>(num_devices, 0.0));
+
+    int primary_device_idx;
+    CUDA_CHECK(cudaGetDevice(&primary_device_idx));
+
+    std::vector<void*> buffers(num_devices, nullptr);
+    for (int device_idx = 0; device_idx < num_devices; ++device_idx) {
+      CUDA_CHECK(cudaSetDevice(device_idx));
+      CUDA_CHECK(cudaMalloc(&buffers[device_idx], copy_bytes * 2));
+      CUDA_CHECK(cudaMemset(buffers[device_idx], 0, copy_bytes * 2));
+    }
+
+    for (int src = 0; src < num_devices; ++src) {
+      CUDA_CHECK(cudaSetDevice(src));
+
+      cudaStream_t stream;
+      CUDA_CHECK(cudaStreamCreate(&stream));
+      uint32_t* result_ptr;
+      CUDA_CHECK(cudaMalloc(&result_ptr, sizeof(uint32_t)));
+
+      for (int dst = 0; dst < num_devices; ++dst) {
+        if (dst == src) {
+          continue;
+        }
+        // Source slice is the first half of the buffer, destination slice the second half
+        void* dst_ptr = reinterpret_cast<uint8_t*>(buffers[dst]) + copy_bytes;
+
+        auto peer_ptr = reinterpret_cast<uint32_t const*>(buffers[dst]);
+
+        // Warmup
+        CUDA_CHECK(cudaMemcpyPeerAsync(dst_ptr, dst, buffers[src], src, copy_bytes, stream));
+        peer_latency_kernel<<<1, 1, 0, stream>>>(peer_ptr, 1, result_ptr);
+
+        GpuTimer timer;
+        timer.start(stream);
+        for (int iter = 0; iter < copy_iterations; ++iter) {
+          CUDA_CHECK(cudaMemcpyPeerAsync(dst_ptr, dst, buffers[src], src, copy_bytes, stream));
+        }
+        timer.stop();
+        double elapsed_ms = timer.elapsed_millis() / double(copy_iterations);
+        bandwidth_gbps[src][dst] = double(copy_bytes) / (elapsed_ms * 1.0e6);
+
+        timer.start(stream);
+        peer_latency_kernel<<<1, 1, 0, stream>>>(peer_ptr, latency_iterations, result_ptr);
+        timer.stop();
+        latency_us[src][dst] = double(timer.elapsed_millis()) * 1.0e3 / double(latency_iterations);
+      }
+
+      CUDA_CHECK(cudaStreamSynchronize(stream));
+      CUDA_CHECK(cudaGetLastError());
+      CUDA_CHECK(cudaFree(result_ptr));
+      CUDA_CHECK(cudaStreamDestroy(stream));
+    }
+
+    for (int device_idx = 0; device_idx < num_devices; ++device_idx) {
+      CUDA_CHECK(cudaSetDevice(device_idx));
+      CUDA_CHECK(cudaFree(buffers[device_idx]));
+    }
+    CUDA_CHECK(cudaSetDevice(primary_device_idx));
+  }
+
+  /// Slowest link between any two of the first num_devices_ devices, in GB/s
+  double min_bandwidth_gbps(int num_devices_) const {
+    double result = 0.0;
+    for (int src = 0; src < num_devices_; ++src) {
+      for (int dst = 0; dst < num_devices_; ++dst) {
+        if (src != dst && (result == 0.0 || bandwidth_gbps[src][dst] < result)) {
+          result = bandwidth_gbps[src][dst];
+        }
+      }
+    }
+    return result;
+  }
+
+  std::ostream & print(std::ostream &out) const {
+    auto print_matrix = [&](char const* title, std::vector<std::vector<double>> const& matrix) {
+      out << "  " << title << "\n        ";
+      for (int dst = 0; dst < num_devices; ++dst) {
+        out << std::setw(9) << ("GPU" + std::to_string(dst));
+      }
+      out << "\n";
+      for (int src = 0; src < num_devices; ++src) {
+        out << "    " << std::setw(4) << ("GPU" + std::to_string(src));
+        for (int dst = 0; dst < num_devices; ++dst) {
+          if (src == dst) {
+            out << std::setw(9) << "X";
+          }
+          else {
+            out << std::setw(9) << std::fixed << std::setprecision(2) << matrix[src][dst];
+          }
+        }
+        out << "\n";
+      }
+      out << "\n";
+    };
+
+    print_matrix("Peer bandwidth (GB/s), rows: source, columns: destination", bandwidth_gbps);
+    print_matrix("Peer latency (us), rows: source, columns: destination", latency_us);
+    return out;
+  }
+};
+
 } //namespace cutlass
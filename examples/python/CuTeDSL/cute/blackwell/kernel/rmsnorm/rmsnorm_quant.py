@@ -0,0 +1,780 @@
+# Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import argparse
+import os
+import sys
+from typing import Tuple, Type
+
+import cuda.bindings.driver as cuda
+import torch
+
+import cutlass
+import cutlass.cute as cute
+import cutlass.cute.testing as testing
+import cutlass.torch as cutlass_torch
+import cutlass.utils as utils
+import cutlass.utils.blockscaled_layout as blockscaled_utils
+from cutlass import Float32, Int32
+from cutlass.cute.runtime import make_ptr
+
+# Support both direct execution and module import
+if __name__ == "__main__":
+    current_dir = os.path.dirname(os.path.abspath(__file__))
+    sys.path.insert(0, os.path.join(current_dir, "../../.."))
+
+from blackwell.kernel.reduce.reduce import row_reduce
+from blackwell.kernel.rmsnorm.rmsnorm import (
+    RMSNormConfig,
+    get_sm_version,
+    predicate_k,
+)
+from blackwell.kernel.blockscaled_gemm.dense_blockscaled_gemm_persistent import (
+    to_blocked,
+)
+
+"""
+Fused RMSNorm + Block-Scaled Quantization for Blackwell (SM100)
+===============================================================
+
+RMSNorm followed by the block-scaled quantization of its output, in a single
+kernel. The normalized activation never goes back to global memory in high
+precision: each CTA normalizes its rows and directly writes
+
+- the quantized data ``q`` (NVFP4 / MXFP4 / MXFP8), row-major (M, N), and
+- one scale factor per ``sf_vec_size`` consecutive elements of a row, in the
+  swizzled ``(32, 4, restM, 4, restK)`` layout of ``blockscaled_layout.py``.
+
+Both can be passed as the A operand (K = N) of the block-scaled GEMM example
+``blockscaled_gemm/dense_blockscaled_gemm_persistent.py`` without any reordering.
+
+Quantization of a block of ``sf_vec_size`` elements ``y``:
+
+    scale = amax(|y|) / max(q_dtype)               (rounded up to a power of 2 for E8M0)
+    sf = scale.to(sf_dtype)
+    q = (y / float(sf)).to(q_dtype)
+
+Supported formats:
+
+- NVF4: q Float4E2M1FN, sf Float8E4M3FN,  sf_vec_size 16
+- MXF4: q Float4E2M1FN, sf Float8E8M0FNU, sf_vec_size 32
+- MXF8: q Float8E4M3FN,  sf Float8E8M0FNU, sf_vec_size 32
+
+The NVF4 per-tensor global scale is not applied here; fold it into the RMSNorm
+weight if required.
+
+The thread layout is the one of the RMSNorm example: each thread holds
+``vec_size`` contiguous elements per vector block, so a scale factor block
+spans ``sf_vec_size // vec_size`` adjacent lanes, whose amax is reduced with
+warp shuffles.
+
+To run this example:
+
+.. code-block:: bash
+
+    python examples/python/CuTeDSL/cute/blackwell/kernel/rmsnorm/rmsnorm_quant.py \
+      --M 2048 --N 4096 --dtype BFloat16                                           \
+      --q_dtype Float4E2M1FN --sf_dtype Float8E4M3FN --sf_vec_size 16
+
+Constraints:
+
+* N must be a multiple of sf_vec_size
+* sf_vec_size must be a multiple of the 128-bit vector size of the input dtype
+"""
+
+
+class RMSNormQuantKernel:
+    """
+    RMSNorm kernel that writes its output quantized with block scale factors.
+
+    Example:
+        >>> kernel = RMSNormQuantKernel(
+        ...     cutlass.BFloat16, 4096, cutlass.Float4E2M1FN, cutlass.Float8E4M3FN, 16
+        ... )
+        >>> kernel(x_ptr, w_ptr, q_ptr, sf_ptr, M, eps, stream)
+    """
+
+    def __init__(
+        self,
+        dtype: Type[cutlass.Numeric],
+        N: int,
+        q_dtype: Type[cutlass.Numeric],
+        sf_dtype: Type[cutlass.Numeric],
+        sf_vec_size: int,
+        has_weight: bool = True,
+    ):
+        self.cfg = RMSNormConfig(dtype, N, has_weight)
+        self.dtype = dtype
+        self.N = N
+        self.has_weight = has_weight
+        self.cluster_n = self.cfg.cluster_n
+        self.q_dtype = q_dtype
+        self.sf_dtype = sf_dtype
+        self.sf_vec_size = sf_vec_size
+        # Number of adjacent lanes sharing one scale factor
+        self.lanes_per_sf = sf_vec_size // self.cfg.vec_size
+        self.q_max = 6.0 if q_dtype == cutlass.Float4E2M1FN else 448.0
+
+    @staticmethod
+    def can_implement(
+        dtype: Type[cutlass.Numeric],
+        N: int,
+        q_dtype: Type[cutlass.Numeric],
+        sf_dtype: Type[cutlass.Numeric],
+        sf_vec_size: int,
+    ) -> bool:
+        """
+        Check if the fused kernel supports the given configuration.
+
+        :param dtype: Input data type (Float16, BFloat16, Float32)
+        :type dtype: Type[cutlass.Numeric]
+        :param N: Hidden dimension size
+        :type N: int
+        :param q_dtype: Quantized data type
+        :type q_dtype: Type[cutlass.Numeric]
+        :param sf_dtype: Scale factor data type
+        :type sf_dtype: Type[cutlass.Numeric]
+        :param sf_vec_size: Number of elements sharing one scale factor
+        :type sf_vec_size: int
+        :return: True if the configuration is supported, False otherwise
+        :rtype: bool
+        """
+        if (q_dtype, sf_dtype, sf_vec_size) not in [
+            (cutlass.Float4E2M1FN, cutlass.Float8E4M3FN, 16),
+            (cutlass.Float4E2M1FN, cutlass.Float8E8M0FNU, 32),
+            (cutlass.Float8E4M3FN, cutlass.Float8E8M0FNU, 32),
+        ]:
+            return False
+        if dtype not in [cutlass.Float16, cutlass.BFloat16, cutlass.Float32]:
+            return False
+        if N % sf_vec_size != 0:
+            return False
+        cfg = RMSNormConfig(dtype, N)
+        # A scale factor block must be made of whole vectors of adjacent lanes of a row
+        if sf_vec_size % cfg.vec_size != 0:
+            return False
+        if sf_vec_size // cfg.vec_size > cfg.threads_per_row:
+            return False
+        return True
+
+    @cute.jit
+    def __call__(
+        self,
+        x_ptr: cute.Pointer,
+        w_ptr: cute.Pointer | None,
+        q_ptr: cute.Pointer,
+        sf_ptr: cute.Pointer,
+        M: Int32,
+        eps: Float32,
+        stream: cuda.CUstream,
+    ):
+        """Host function to launch the fused RMSNorm + quantization kernel."""
+        cfg = self.cfg
+
+        mX = cute.make_tensor(
+            x_ptr,
+            cute.make_layout((M, cfg.N), stride=(cfg.N, 1)),
+        )
+        mQ = cute.make_tensor(
+            q_ptr,
+            cute.make_layout((M, cfg.N), stride=(cfg.N, 1)),
+        )
+        # ((Atom_M, Rest_M),(Atom_K, Rest_K),RestL), as the SFA operand of the GEMM
+        sf_layout = blockscaled_utils.tile_atom_to_shape_SF(
+            (M, cfg.N, 1), self.sf_vec_size
+        )
+        mSF = cute.make_tensor(sf_ptr, sf_layout)
+
+        if cutlass.const_expr(cfg.has_weight and w_ptr is not None):
+            mW = cute.make_tensor(
+                w_ptr,
+                cute.make_layout((cfg.N,), stride=(1,)),
+            )
+        else:
+            mW = None
+
+        tv_shape, tv_stride = RMSNormConfig._make_tv_layout(
+            cfg.threads_per_row,
+            cfg.rows_per_block,
+            cfg.vec_size,
+            cfg.num_vec_blocks,
+        )
+        tv_layout = cute.make_layout(tv_shape, stride=tv_stride)
+        tiler_mn = (cfg.rows_per_block, cfg.cols_per_tile)
+
+        self.kernel(mX, mW, mQ, mSF, eps, tv_layout, tiler_mn).launch(
+            grid=[cute.ceil_div(M, cfg.rows_per_block), cfg.cluster_n, 1],
+            block=[cfg.num_threads, 1, 1],
+            cluster=[1, cfg.cluster_n, 1] if cutlass.const_expr(cfg.cluster_n > 1) else None,
+            smem=cfg.smem_size_in_bytes(),
+            stream=stream,
+        )
+
+    @cute.kernel
+    def kernel(
+        self,
+        mX: cute.Tensor,
+        mW: cute.Tensor | None,
+        mQ: cute.Tensor,
+        mSF: cute.Tensor,
+        eps: Float32,
+        tv_layout: cute.Layout,
+        tiler_mn: cute.Shape,
+    ):
+        """Device kernel implementing RMSNorm followed by block-scaled quantization."""
+        cfg = self.cfg
+        tidx, _, _ = cute.arch.thread_idx()
+        bidx, _, _ = cute.arch.block_idx()
+
+        if cutlass.const_expr(cfg.cluster_n > 1):
+            cluster_y = cute.arch.block_idx()[1]
+        else:
+            cluster_y = cutlass.const_expr(0)
+
+        M = mX.shape[0]
+        threads_per_row = tv_layout.shape[0][0]
+        warps_per_row = max(threads_per_row // 32, 1)
+        rows_per_block = tiler_mn[0]
+
+        # =====================================================================
+        # Allocate shared memory
+        # =====================================================================
+        smem = utils.SmemAllocator()
+
+        sX = smem.allocate_tensor(
+            mX.element_type,
+            cute.make_ordered_layout(tiler_mn, order=(1, 0)),
+            byte_alignment=16,
+        )
+
+        if cutlass.const_expr(cfg.cluster_n == 1):
+            reduction_buffer = smem.allocate_tensor(
+                Float32,
+                cute.make_layout((rows_per_block, warps_per_row)),
+                byte_alignment=4,
+            )
+            mbar_ptr = None
+        else:
+            reduction_buffer = smem.allocate_tensor(
+                Float32,
+                cute.make_layout((rows_per_block, (warps_per_row, cfg.cluster_n))),
+                byte_alignment=4,
+            )
+            mbar_ptr = smem.allocate_array(cutlass.Int64, num_elems=1)
+
+        # =====================================================================
+        # Initialize cluster
+        # =====================================================================
+        if cutlass.const_expr(cfg.cluster_n > 1):
+            if tidx == 0:
+                cute.arch.mbarrier_init(mbar_ptr, 1)
+            cute.arch.mbarrier_init_fence()
+            cute.arch.cluster_arrive_relaxed()
+            cute.arch.cluster_wait()
+
+        # =====================================================================
+        # Create identity tensor and partition
+        # =====================================================================
+        idX = cute.make_identity_tensor(mX.shape)
+
+        gX = cute.local_tile(mX, tiler_mn, (bidx, cluster_y))
+        gQ = cute.local_tile(mQ, tiler_mn, (bidx, cluster_y))
+        cX = cute.local_tile(idX, tiler_mn, (bidx, cluster_y))
+
+        if cutlass.const_expr(cfg.has_weight and mW is not None):
+            mW_expanded_layout = cute.prepend(
+                mW.layout, cute.make_layout((tiler_mn[0],), stride=(0,))
+            )
+            mW_2d = cute.make_tensor(mW.iterator, mW_expanded_layout)
+            gW = cute.local_tile(mW_2d, tiler_mn, (0, cluster_y))
+
+        # =====================================================================
+        # Create TiledCopy operations
+        # =====================================================================
+        copy_atom_load_async = cute.make_copy_atom(
+            cute.nvgpu.cpasync.CopyG2SOp(),
+            mX.element_type,
+            num_bits_per_copy=RMSNormConfig.COPY_BITS,
+        )
+
+        copy_atom_load_W = cute.make_copy_atom(
+            cute.nvgpu.CopyUniversalOp(),
+            mX.element_type,
+            num_bits_per_copy=RMSNormConfig.COPY_BITS,
+        )
+
+        # Same vectors as the loads, but with the narrower quantized element
+        copy_atom_store_Q = cute.make_copy_atom(
+            cute.nvgpu.CopyUniversalOp(),
+            mQ.element_type,
+            num_bits_per_copy=cfg.vec_size * mQ.element_type.width,
+        )
+
+        tiled_copy_load = cute.make_tiled_copy(copy_atom_load_async, tv_layout, tiler_mn)
+        tiled_copy_W = cute.make_tiled_copy(copy_atom_load_W, tv_layout, tiler_mn)
+        tiled_copy_store_Q = cute.make_tiled_copy(copy_atom_store_Q, tv_layout, tiler_mn)
+
+        thr_copy_X = tiled_copy_load.get_slice(tidx)
+        thr_copy_W = tiled_copy_W.get_slice(tidx)
+        thr_copy_Q = tiled_copy_store_Q.get_slice(tidx)
+
+        # Partition tensors
+        tXgX = thr_copy_X.partition_S(gX)
+        tXsX = thr_copy_X.partition_D(sX)
+        tXgQ = thr_copy_Q.partition_D(gQ)
+        tXcX = thr_copy_X.partition_S(cX)
+
+        # Register fragments
+        tXrX = cute.make_fragment_like(tXgX)
+        tXrQ = cute.make_fragment_like(tXgQ)
+        tXrY = cute.make_fragment_like(tXgX, Float32)
+
+        if cutlass.const_expr(cfg.has_weight and mW is not None):
+            tWgW = thr_copy_W.partition_S(gW)
+            tWrW = cute.make_fragment_like(tWgW)
+            tXrW = thr_copy_X.retile(tWrW)
+
+        # =====================================================================
+        # Bounds checking
+        # =====================================================================
+        tXpX = predicate_k(tXcX, limit=cfg.N)
+
+        row_coord = tXcX[(0, 0), 0, 0]
+        row_in_bounds = row_coord[0] < M
+
+        # =====================================================================
+        # Async copy global → shared
+        # =====================================================================
+        if row_in_bounds:
+            cute.copy(copy_atom_load_async, tXgX, tXsX, pred=tXpX)
+
+        cute.arch.cp_async_commit_group()
+
+        # Load weight while waiting
+        if cutlass.const_expr(cfg.has_weight and mW is not None):
+            tWpW = predicate_k(thr_copy_W.partition_S(cX), limit=cfg.N)
+            cute.copy(copy_atom_load_W, tWgW, tWrW, pred=tWpW)
+
+        cute.arch.cp_async_wait_group(0)
+
+        # =====================================================================
+        # Pass 1: Compute sum of squares with cluster reduction
+        # =====================================================================
+        cute.autovec_copy(tXsX, tXrX)
+        x = tXrX.load().to(Float32)
+
+        x_sq = x * x
+        sum_sq = row_reduce(
+            x_sq,
+            cute.ReductionOp.ADD,
+            threads_per_row,
+            reduction_buffer,
+            mbar_ptr,
+            cfg.cluster_n,
+            Float32(0.0),
+        )
+
+        mean_sq = sum_sq / cfg.N
+        rstd = cute.math.rsqrt(mean_sq + eps, fastmath=True)
+
+        if cutlass.const_expr(cfg.cluster_n > 1):
+            cute.arch.cluster_arrive_relaxed()
+            cute.arch.cluster_wait()
+        else:
+            cute.arch.barrier()
+
+        # =====================================================================
+        # Pass 2: Normalize, kept in fp32 registers for the quantization
+        # =====================================================================
+        cute.autovec_copy(tXsX, tXrX)
+        x = tXrX.load().to(Float32)
+
+        y = x * rstd
+
+        if cutlass.const_expr(cfg.has_weight and mW is not None):
+            w = tXrW.load().to(Float32)
+            y = y * w
+
+        tXrY.store(y)
+
+        # =====================================================================
+        # Pass 3: Block scale factors
+        # =====================================================================
+        num_vec_blocks = cute.size(tXrY, mode=[0, 1])
+        tXrScale = cute.make_rmem_tensor(cute.make_layout(num_vec_blocks), Float32)
+        for vb in cutlass.range_constexpr(num_vec_blocks):
+            amax = Float32(0.0)
+            for v in cutlass.range_constexpr(cfg.vec_size):
+                amax = cute.arch.fmax(amax, cute.math.absf(tXrY[(v, vb), 0, 0]))
+            # Each lane holds vec_size elements of the block, reduce over its lanes
+            amax = cute.arch.warp_reduction_max(
+                amax, threads_in_group=self.lanes_per_sf
+            )
+            scale = amax * (1.0 / self.q_max)
+            if cutlass.const_expr(self.sf_dtype == cutlass.Float8E8M0FNU):
+                # Round up to a power of two so that the block never saturates
+                scale = cute.math.exp2(
+                    cute.math.ceil(cute.math.log2(cute.arch.fmax(scale, 2.0**-127)))
+                )
+            tXrScale[vb] = scale
+
+        tXrSF = cute.make_rmem_tensor(tXrScale.layout, self.sf_dtype)
+        tXrSF.store(tXrScale.load().to(self.sf_dtype))
+        # Quantize with the scale factor actually stored, not the exact one
+        tXrScale.store(tXrSF.load().to(Float32))
+
+        # =====================================================================
+        # Pass 4: Quantize and store data and scale factors
+        # =====================================================================
+        for vb in cutlass.range_constexpr(num_vec_blocks):
+            scale = tXrScale[vb]
+            inv_scale = Float32(0.0)
+            if scale > Float32(0.0):
+                inv_scale = cute.arch.rcp_approx(scale)
+            for v in cutlass.range_constexpr(cfg.vec_size):
+                tXrY[(v, vb), 0, 0] = tXrY[(v, vb), 0, 0] * inv_scale
+
+        tXrQ.store(tXrY.load().to(self.q_dtype))
+
+        if row_in_bounds:
+            cute.copy(copy_atom_store_Q, tXrQ, tXgQ, pred=tXpX)
+
+            # The first lane of each scale factor block writes its scale factor
+            if tidx % self.lanes_per_sf == 0:
+                for vb in cutlass.range_constexpr(num_vec_blocks):
+                    m, n = tXcX[(0, vb), 0, 0]
+                    if n < cfg.N:
+                        mSF[m, n, 0] = tXrSF[vb]
+
+
+# =============================================================================
+# Tensor Creation and Reference
+# =============================================================================
+
+
+def ceil_div(a: int, b: int) -> int:
+    return (a + b - 1) // b
+
+
+def create_tensors(
+    M: int,
+    N: int,
+    dtype: Type[cutlass.Numeric],
+    q_dtype: Type[cutlass.Numeric],
+    sf_vec_size: int,
+    has_weight: bool,
+) -> Tuple:
+    """Create input and weight tensors, and byte buffers for the quantized data and scale factors."""
+    torch.manual_seed(42)
+    torch_dtype = cutlass_torch.dtype(dtype)
+
+    x = torch.randn(M, N, device="cuda", dtype=torch_dtype)
+    weight = torch.randn(N, device="cuda", dtype=torch_dtype) if has_weight else None
+    q = torch.empty(M, N * q_dtype.width // 8, device="cuda", dtype=torch.uint8)
+    # Padded to whole (128, 4) scale factor atoms; the padding is left at zero
+    num_sf = ceil_div(M, 128) * 128 * ceil_div(N // sf_vec_size, 4) * 4
+    sf = torch.zeros(num_sf, device="cuda", dtype=torch.uint8)
+    return x, weight, q, sf
+
+
+_FP4_E2M1_VALUES = [0.0, 0.5, 1.0, 1.5, 2.0, 3.0, 4.0, 6.0]
+
+
+def dequantize(
+    q: torch.Tensor,
+    sf: torch.Tensor,
+    M: int,
+    N: int,
+    q_dtype: Type[cutlass.Numeric],
+    sf_dtype: Type[cutlass.Numeric],
+    sf_vec_size: int,
+) -> Tuple[torch.Tensor, torch.Tensor]:
+    """Decode the kernel outputs into fp32 values and the (M, N // sf_vec_size) scale factors."""
+    if q_dtype == cutlass.Float4E2M1FN:
+        table = torch.tensor(
+            _FP4_E2M1_VALUES + [-v for v in _FP4_E2M1_VALUES], device=q.device
+        )
+        # Two values per byte, the first one in the low nibble
+        codes = torch.stack([q & 0xF, q >> 4], dim=-1).reshape(M, N)
+        values = table[codes.long()]
+    else:
+        values = q.view(torch.float8_e4m3fn).float()
+
+    # Row-major index of the (m, k) block held by each entry of the swizzled layout,
+    # -1 for the padding of the (128, 4) atoms
+    sf_k = N // sf_vec_size
+    index = torch.full(
+        (ceil_div(M, 128) * 128, ceil_div(sf_k, 4) * 4),
+        -1,
+        dtype=torch.int32,
+        device=sf.device,
+    )
+    index[:M, :sf_k] = torch.arange(
+        M * sf_k, dtype=torch.int32, device=sf.device
+    ).reshape(M, sf_k)
+    index = to_blocked(index)
+    valid = index >= 0
+    sf_mk = torch.empty(M * sf_k, dtype=torch.uint8, device=sf.device)
+    sf_mk[index[valid].long()] = sf[valid]
+    sf_torch_dtype = cutlass_torch.dtype(sf_dtype)
+    scales = sf_mk.view(sf_torch_dtype).float().reshape(M, sf_k)
+
+    values = values.reshape(M, sf_k, sf_vec_size) * scales.unsqueeze(-1)
+    return values.reshape(M, N), scales
+
+
+def rmsnorm_fp32_ref(
+    x: torch.Tensor,
+    weight: torch.Tensor | None,
+    eps: float,
+) -> torch.Tensor:
+    """Reference RMSNorm kept in fp32, as quantized by the kernel."""
+    x_f32 = x.float()
+    rms = torch.sqrt(torch.mean(x_f32**2, dim=-1, keepdim=True) + eps)
+    y = x_f32 / rms
+    if weight is not None:
+        y = y * weight.float()
+    return y
+
+
+# =============================================================================
+# Run Function
+# =============================================================================
+
+
+def run(
+    M: int,
+    N: int,
+    dtype: Type[cutlass.Numeric],
+    q_dtype: Type[cutlass.Numeric],
+    sf_dtype: Type[cutlass.Numeric],
+    sf_vec_size: int,
+    has_weight: bool = True,
+    eps: float = 1e-6,
+    warmup_iterations: int = 2,
+    iterations: int = 100,
+    skip_ref_check: bool = False,
+    benchmark: bool = False,
+    **kwargs,
+) -> float:
+    """
+    Execute the fused RMSNorm + quantization and optionally benchmark performance.
+
+    :param M: Number of rows (batch size * sequence length)
+    :type M: int
+    :param N: Hidden dimension size
+    :type N: int
+    :param dtype: Input data type (Float16, BFloat16, Float32)
+    :type dtype: Type[cutlass.Numeric]
+    :param q_dtype: Quantized data type (Float4E2M1FN, Float8E4M3FN)
+    :type q_dtype: Type[cutlass.Numeric]
+    :param sf_dtype: Scale factor data type (Float8E4M3FN, Float8E8M0FNU)
+    :type sf_dtype: Type[cutlass.Numeric]
+    :param sf_vec_size: Number of elements sharing one scale factor
+    :type sf_vec_size: int
+    :param has_weight: Whether to apply learnable weight
+    :type has_weight: bool
+    :param eps: Epsilon for numerical stability
+    :type eps: float
+    :param warmup_iterations: Warmup iterations for benchmarking
+    :type warmup_iterations: int
+    :param iterations: Number of benchmark iterations
+    :type iterations: int
+    :param skip_ref_check: Skip reference correctness check
+    :type skip_ref_check: bool
+    :param benchmark: Enable benchmarking
+    :type benchmark: bool
+    :return: Execution time in microseconds (0.0 if not benchmarking)
+    :rtype: float
+    """
+    print("Running fused RMSNorm + quantization test with:")
+    print(f"  M: {M}, N: {N}")
+    print(f"  dtype: {dtype}, q_dtype: {q_dtype}, sf_dtype: {sf_dtype}")
+    print(f"  sf_vec_size: {sf_vec_size}, has_weight: {has_weight}, eps: {eps}")
+    print(f"  SM version: {get_sm_version()}")
+
+    if not torch.cuda.is_available():
+        raise RuntimeError("CUDA GPU is required to run this example!")
+    if not RMSNormQuantKernel.can_implement(dtype, N, q_dtype, sf_dtype, sf_vec_size):
+        raise TypeError(
+            f"Unsupported configuration: {dtype}, N={N}, {q_dtype}, {sf_dtype}, "
+            f"sf_vec_size={sf_vec_size}"
+        )
+
+    torch_stream = torch.cuda.current_stream()
+    stream = cuda.CUstream(torch_stream.cuda_stream)
+
+    x, weight, q, sf = create_tensors(M, N, dtype, q_dtype, sf_vec_size, has_weight)
+
+    kernel_obj = RMSNormQuantKernel(dtype, N, q_dtype, sf_dtype, sf_vec_size, has_weight)
+    print(f"  cluster_n: {kernel_obj.cluster_n}")
+
+    def make_ptrs(x, weight, q, sf):
+        return (
+            make_ptr(dtype, x.data_ptr(), cute.AddressSpace.gmem, assumed_align=16),
+            make_ptr(dtype, weight.data_ptr(), cute.AddressSpace.gmem, assumed_align=16)
+            if weight is not None
+            else None,
+            make_ptr(q_dtype, q.data_ptr(), cute.AddressSpace.gmem, assumed_align=16),
+            make_ptr(sf_dtype, sf.data_ptr(), cute.AddressSpace.gmem, assumed_align=16),
+        )
+
+    compiled_kernel = cute.compile(
+        kernel_obj, *make_ptrs(x, weight, q, sf), Int32(M), Float32(eps), stream
+    )
+
+    if not skip_ref_check:
+        compiled_kernel(*make_ptrs(x, weight, q, sf), Int32(M), Float32(eps), stream)
+        torch.cuda.synchronize()
+
+        y_ref = rmsnorm_fp32_ref(x, weight, eps)
+        y, scales = dequantize(q, sf, M, N, q_dtype, sf_dtype, sf_vec_size)
+        # Error of one block: half a quantization step at the top of the q_dtype range,
+        # plus the saturation when the E4M3 scale factor is rounded down
+        amax = y_ref.reshape(M, -1, sf_vec_size).abs().amax(dim=-1, keepdim=True)
+        half_step = 1.0 if q_dtype == cutlass.Float4E2M1FN else 16.0
+        bound = scales.unsqueeze(-1) * half_step + amax * 0.0625 + 1e-3
+        err = (y - y_ref).reshape(M, -1, sf_vec_size).abs()
+        assert torch.all(err <= bound), f"max error {torch.max(err - bound)} above bound"
+        print("Correctness check passed!")
+
+    if not benchmark:
+        return 0.0
+
+    print(f"\nBenchmarking with {warmup_iterations} warmup, {iterations} iterations...")
+
+    def generate_tensors():
+        x, weight, q, sf = create_tensors(M, N, dtype, q_dtype, sf_vec_size, has_weight)
+        return testing.JitArguments(
+            *make_ptrs(x, weight, q, sf), Int32(M), Float32(eps), stream
+        )
+
+    exec_time_us = testing.benchmark(
+        compiled_kernel,
+        workspace_generator=generate_tensors,
+        workspace_count=10,
+        warmup_iterations=warmup_iterations,
+        iterations=iterations,
+        stream=stream,
+    )
+
+    # Read x once, write the quantized data and the scale factors
+    bytes_per_elem = dtype.width // 8
+    total_bytes = M * N * bytes_per_elem + M * N * q_dtype.width // 8
+    total_bytes += M * (N // sf_vec_size)
+    if has_weight:
+        total_bytes += N * bytes_per_elem
+
+    throughput_gbps = (total_bytes / (exec_time_us / 1e6)) / 1e9
+
+    print(f"Kernel execution time: {exec_time_us:.2f} us")
+    print(f"Memory throughput: {throughput_gbps:.2f} GB/s")
+
+    return exec_time_us
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Fused RMSNorm + block-scaled quantization example for Blackwell (SM100)"
+    )
+
+    parser.add_argument("--M", type=int, default=2048, help="Number of rows")
+    parser.add_argument("--N", type=int, default=4096, help="Hidden dimension size")
+    parser.add_argument(
+        "--dtype",
+        type=cutlass.dtype,
+        default=cutlass.BFloat16,
+        help="Input data type (Float16, BFloat16, Float32)",
+    )
+    parser.add_argument(
+        "--q_dtype",
+        type=cutlass.dtype,
+        default=cutlass.Float4E2M1FN,
+        help="Quantized data type (Float4E2M1FN, Float8E4M3FN)",
+    )
+    parser.add_argument(
+        "--sf_dtype",
+        type=cutlass.dtype,
+        default=cutlass.Float8E4M3FN,
+        help="Scale factor data type (Float8E4M3FN, Float8E8M0FNU)",
+    )
+    parser.add_argument(
+        "--sf_vec_size", type=int, default=16, help="Elements per scale factor"
+    )
+    parser.add_argument(
+        "--no_weight",
+        action="store_true",
+        help="Disable learnable weight",
+    )
+    parser.add_argument(
+        "--eps",
+        type=float,
+        default=1e-6,
+        help="Epsilon for numerical stability",
+    )
+    parser.add_argument(
+        "--warmup_iterations",
+        type=int,
+        default=2,
+        help="Warmup iterations for benchmarking",
+    )
+    parser.add_argument(
+        "--iterations",
+        type=int,
+        default=100,
+        help="Number of benchmark iterations",
+    )
+    parser.add_argument(
+        "--skip_ref_check",
+        action="store_true",
+        help="Skip reference correctness check",
+    )
+    parser.add_argument(
+        "--benchmark",
+        action="store_true",
+        help="Enable benchmarking",
+    )
+
+    args = parser.parse_args()
+
+    run(
+        M=args.M,
+        N=args.N,
+        dtype=args.dtype,
+        q_dtype=args.q_dtype,
+        sf_dtype=args.sf_dtype,
+        sf_vec_size=args.sf_vec_size,
+        has_weight=not args.no_weight,
+        eps=args.eps,
+        warmup_iterations=args.warmup_iterations,
+        iterations=args.iterations,
+        skip_ref_check=args.skip_ref_check,
+        benchmark=args.benchmark,
+    )
+
+    print("PASS")
@@ -0,0 +1,316 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include <cute/config.hpp>
+#include <cute/tensor_impl.hpp>                  // cute::Tensor
+#include <cute/algorithm/copy.hpp>               // cute::copy, cute::AutoFilter
+#include <cute/algorithm/cooperative_copy.hpp>   // cute::cooperative_copy
+#include <cute/atom/copy_atom.hpp>               // cute::Copy_Atom, cute::make_tmem_copy
+#include <cute/arch/copy_sm100.hpp>              // cute::SM100::TMEM::LOAD::SM100_TMEM_LOAD_32dp32b1x
+
+/* copy_auto: Copy atom and vector width selection from the static properties of the tensors
+ *
+ * The widest vectorization is derived from the common contiguous vector of the two layouts and their
+ * static alignment, capped by MaxVecBits: the alignment that pointers and dynamic strides are assumed to have.
+ * The copy instruction is then derived from the memory spaces of the tensors:
+ *
+ *   gmem -> smem                      : SM80_CP_ASYNC_CACHEGLOBAL/CACHEALWAYS when the vector is 4B, 8B or 16B
+ *                                       (the caller must cp_async_fence()/cp_async_wait<>() before reading dst)
+ *   gmem -> smem with an mbarrier     : SM90_BULK_COPY_G2S issued by a single thread (see is_bulk_copyable)
+ *   tmem -> rmem, rmem -> tmem        : widest SM100_TMEM_LOAD/STORE_32dp32b that tiles the column mode
+ *   otherwise                         : UniversalCopy of the vector type
+ */
+
+namespace cute
+{
+
+// The widest vector, in bits, that can be used to copy src to dst:
+//   limited by the contiguous vector common to both layouts, their static alignments, and MaxVecBits.
+template <int MaxVecBits,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+copy_auto_vec_bits(Tensor<SrcEngine, SrcLayout> const& src,
+                   Tensor<DstEngine, DstLayout> const& dst)
+{
+  constexpr int elem_bits   = sizeof_bits_v<typename DstEngine::value_type>;
+  constexpr int common_elem = CUTE_STATIC_V(max_common_vector(src, dst));
+  constexpr int align_bits  = CUTE_STATIC_V(gcd(max_alignment(src), max_alignment(dst), Int<MaxVecBits>{}));
+  return Int<cute::max(elem_bits, cute::gcd(common_elem * elem_bits, align_bits))>{};
+}
+
+// True if src and dst can be moved with SM90_BULK_COPY_AUTO:
+//   gmem <-> smem of the same value_type, static shapes, and 16B contiguous and aligned vectors.
+template <int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+is_bulk_copyable(Tensor<SrcEngine, SrcLayout> const& src,
+                 Tensor<DstEngine, DstLayout> const& dst)
+{
+  using SrcType = typename SrcEngine::value_type;
+  using DstType = typename DstEngine::value_type;
+  if constexpr (not ((is_gmem<SrcEngine>::value && is_smem<DstEngine>::value) ||
+                     (is_smem<SrcEngine>::value && is_gmem<DstEngine>::value)) ||
+                not cute::is_same<SrcType, DstType>::value ||
+                not (is_static<decltype(shape(src))>::value && is_static<decltype(shape(dst))>::value)) {
+    return false_type{};
+  } else {
+    constexpr int common_bits = CUTE_STATIC_V(max_common_vector(src, dst)) * sizeof_bits_v<SrcType>;
+    constexpr int align_bits  = CUTE_STATIC_V(gcd(max_alignment(src), max_alignment(dst), Int<MaxVecBits>{}));
+    return bool_constant<(common_bits % 128 == 0) && (align_bits % 128 == 0)>{};
+  }
+}
+
+//
+// AutoCopyWithAssumedAlignment -- Vectorize up to MaxVecBits, then select the copy instruction per vector
+//
+
+template <int MaxVecBits>
+struct AutoCopyWithAssumedAlignment
+{
+  static_assert(MaxVecBits == 8 || MaxVecBits == 16 || MaxVecBits == 32 || MaxVecBits == 64 || MaxVecBits == 128,
+                "Expected MaxVecBits to be 8 or 16 or 32 or 64 or 128 for alignment and performance.");
+};
+
+template <int MaxVecBits,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+copy(AutoCopyWithAssumedAlignment<MaxVecBits> const&,
+     Tensor<SrcEngine, SrcLayout>             const& src,
+     Tensor<DstEngine, DstLayout>                  & dst)
+{
+  using DstType = typename DstEngine::value_type;
+  constexpr int vec_bits = decltype(copy_auto_vec_bits<MaxVecBits>(src, dst))::value;
+
+  if constexpr ((vec_bits % 8) == 0 && sizeof_bits_v<DstType> < vec_bits) {
+    // Recast to the vector type, preserving the constness of src for the cache policy of cp.async
+    using VecType    = uint_bit_t<vec_bits>;
+    using SrcVecType = conditional_t<is_const_v<remove_reference_t<typename SrcEngine::reference>>, VecType const, VecType>;
+
+    Tensor src_v = recast<SrcVecType>(src);
+    Tensor dst_v = recast<VecType>(dst);
+    return copy(AutoCopyAsync{}, src_v, dst_v);
+  } else {
+    return copy(AutoCopyAsync{}, src, dst);
+  }
+}
+
+// copy_auto(src, dst)
+// Copy Tensor src to Tensor dst in a single thread with the widest legal vector and copy instruction.
+// @pre Pointers and dynamic strides of @a src and @a dst are aligned up to MaxVecBits.
+// @post If src is gmem and dst is smem, the copy may be asynchronous: fence and wait with
+//       cp_async_fence() and cp_async_wait<0>() before consuming dst.
+template <int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+copy_auto(Tensor<SrcEngine, SrcLayout> const& src,
+          Tensor<DstEngine, DstLayout>      & dst)
+{
+  if constexpr (is_static<decltype(shape(src))>::value && is_static<decltype(shape(dst))>::value) {
+    return copy(AutoFilter(AutoCopyWithAssumedAlignment<MaxVecBits>{}), src, dst);
+  } else {
+    return copy(AutoCopyWithAssumedAlignment<MaxVecBits>{}, src, dst);
+  }
+}
+
+// copy_auto(mbar, src, dst)
+// Copy the gmem Tensor src to the smem Tensor dst with SM90 bulk copies that complete on the mbarrier.
+// The mbarrier must expect size(dst) * sizeof(value_type) transaction bytes.
+// @pre is_bulk_copyable<MaxVecBits>(src, dst)
+template <int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+copy_auto(uint64_t                          & mbar,
+          Tensor<SrcEngine, SrcLayout> const& src,
+          Tensor<DstEngine, DstLayout>      & dst)
+{
+  static_assert(is_gmem<SrcEngine>::value && is_smem<DstEngine>::value,
+                "copy_auto with an mbarrier expects a gmem source and an smem destination.");
+  static_assert(decltype(is_bulk_copyable<MaxVecBits>(src, dst))::value,
+                "Tensors are not bulk copyable, use copy_auto(src, dst) instead.");
+  return copy(Copy_Traits<SM90_BULK_COPY_AUTO>{}.with(mbar), src, dst);
+}
+
+// cooperative_copy_auto<NumThreads>(tid, src, dst)
+// Use NumThreads to copy Tensor src to Tensor dst with the widest legal vector and copy instruction.
+// MaxVecBits of cooperative_copy is derived from the static alignment of the layouts, and gmem -> smem
+// copies are issued as cp.async where available.
+// @pre 0 <= @a tid < NumThreads
+// @pre Pointers and dynamic strides of @a src and @a dst are aligned up to MaxVecBits.
+// @post If src is gmem and dst is smem, the copy may be asynchronous: fence and wait with
+//       cp_async_fence() and cp_async_wait<0>() before synchronizing the threads.
+template <uint32_t NumThreads, int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_copy_auto(uint32_t                     const& tid,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>      & dst)
+{
+  constexpr int elem_bits  = sizeof_bits_v<typename SrcEngine::value_type>;
+  constexpr int align_bits = CUTE_STATIC_V(gcd(max_alignment(src), max_alignment(dst), Int<MaxVecBits>{}));
+  constexpr int vec_bits   = cute::max(elem_bits, align_bits);
+
+  return cooperative_copy<NumThreads, uint32_t(vec_bits)>(tid, src, dst, AutoCopyAsync{});
+}
+
+// cooperative_copy_auto<NumThreads>(tid, mbar, src, dst)
+// Copy the gmem Tensor src to the smem Tensor dst with SM90 bulk copies issued by thread 0 of the group.
+// The mbarrier must expect size(dst) * sizeof(value_type) transaction bytes.
+// @pre is_bulk_copyable<MaxVecBits>(src, dst)
+template <uint32_t NumThreads, int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_copy_auto(uint32_t                     const& tid,
+                      uint64_t                          & mbar,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>      & dst)
+{
+  assert(tid < NumThreads);
+  if (tid == 0) {
+    copy_auto<MaxVecBits>(mbar, src, dst);
+  }
+}
+
+//
+// Accept mutable temporaries
+//
+
+template <int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+copy_auto(Tensor<SrcEngine, SrcLayout> const& src,
+          Tensor<DstEngine, DstLayout>     && dst)
+{
+  return copy_auto<MaxVecBits>(src, dst);
+}
+
+template <int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+copy_auto(uint64_t                          & mbar,
+          Tensor<SrcEngine, SrcLayout> const& src,
+          Tensor<DstEngine, DstLayout>     && dst)
+{
+  return copy_auto<MaxVecBits>(mbar, src, dst);
+}
+
+template <uint32_t NumThreads, int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_copy_auto(uint32_t                     const& tid,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>     && dst)
+{
+  return cooperative_copy_auto<NumThreads, MaxVecBits>(tid, src, dst);
+}
+
+template <uint32_t NumThreads, int MaxVecBits = 128,
+          class SrcEngine, class SrcLayout,
+          class DstEngine, class DstLayout>
+CUTE_HOST_DEVICE
+void
+cooperative_copy_auto(uint32_t                     const& tid,
+                      uint64_t                          & mbar,
+                      Tensor<SrcEngine, SrcLayout> const& src,
+                      Tensor<DstEngine, DstLayout>     && dst)
+{
+  return cooperative_copy_auto<NumThreads, MaxVecBits>(tid, mbar, src, dst);
+}
+
+//
+// TMEM -- Select the widest 32dp32b TMEM_LOAD/TMEM_STORE that tiles the column mode of the TMEM tensor
+//
+
+// Defined in cute/atom/copy_traits_sm100.hpp, which may be the header that is including this one
+namespace TMEM {
+
+template <class CopyOp, int bits_n>
+CUTE_HOST_DEVICE constexpr auto
+op_repeater();
+
+template <class CopyOp>
+CUTE_HOST_DEVICE constexpr auto
+tmem_load_to_store(CopyOp);
+
+} // end namespace TMEM
+
+// The 1x TMEM_LOAD op repeated to cover the columns of the TMEM tensor
+// @pre @a tmem is (M,N,...) with M the datapath mode and N the column mode
+template <class TEngine, class TLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+tmem_load_op_auto(Tensor<TEngine, TLayout> const& tmem)
+{
+  static_assert(is_tmem<TEngine>::value, "Expected TMEM tensor.");
+  constexpr int bits_n = size<1>(TLayout{}) * sizeof_bits_v<typename TEngine::value_type>;
+  static_assert(bits_n % 32 == 0, "Expected the TMEM column mode to cover a multiple of 32b.");
+  return TMEM::op_repeater<SM100::TMEM::LOAD::SM100_TMEM_LOAD_32dp32b1x, bits_n>();
+}
+
+// TiledCopy for tmem -> rmem with the widest TMEM_LOAD, see make_tmem_copy
+template <class TEngine, class TLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+make_tmem_load_auto(Tensor<TEngine, TLayout> const& tmem)
+{
+  return make_tmem_copy(tmem_load_op_auto(tmem), tmem);
+}
+
+// TiledCopy for rmem -> tmem with the widest TMEM_STORE, see make_tmem_copy
+template <class TEngine, class TLayout>
+CUTE_HOST_DEVICE constexpr
+auto
+make_tmem_store_auto(Tensor<TEngine, TLayout> const& tmem)
+{
+  return make_tmem_copy(TMEM::tmem_load_to_store(tmem_load_op_auto(tmem)), tmem);
+}
+
+} // end namespace cute
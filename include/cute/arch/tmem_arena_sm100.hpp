@@ -0,0 +1,202 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cute/config.hpp>
+#include <cute/numeric/integral_constant.hpp>
+#include <cute/util/type_traits.hpp>
+
+namespace cute::TMEM {
+
+//
+// TMEM Arena
+//
+// The allocators in tmem_allocator_sm100.hpp hand out a single power-of-two block of columns per CTA.
+// Kernels that fuse several MMAs (back-to-back GEMMs, attention, SSD) partition that block by hand.
+// ArenaPlan does the partitioning at compile time: each Region declares its width in columns and the
+// range of phases [FirstPhase, LastPhase] during which it is live. Regions with disjoint lifetimes
+// may be assigned overlapping columns, so e.g. the accumulator of GEMM1 can be reused by GEMM2 once
+// its contents have been consumed.
+//
+// Reuse across phases is only legal once every access of the earlier phase has completed; the kernel
+// is responsible for the ordering (tcgen05 fences and the usual pipeline barriers) between phases.
+//
+
+template <int Columns, int FirstPhase = 0, int LastPhase = FirstPhase>
+struct Region {
+  static_assert(Columns > 0, "TMEM region must occupy at least one column.");
+  static_assert(FirstPhase <= LastPhase, "TMEM region lifetime must be a non-empty phase range.");
+
+  static constexpr int columns = Columns;
+  static constexpr int first_phase = FirstPhase;
+  static constexpr int last_phase = LastPhase;
+};
+
+namespace detail {
+
+template <int N>
+struct ArenaLayout {
+  int offset[N];
+  int end;
+};
+
+// First-fit placement in declaration order: a region is placed at the lowest aligned column that
+// does not intersect any earlier region whose lifetime overlaps its own.
+template <int N>
+CUTE_HOST_DEVICE constexpr
+ArenaLayout<N>
+plan_arena(int const (&columns)[N], int const (&first)[N], int const (&last)[N], int alignment) {
+  ArenaLayout<N> layout{};
+  layout.end = 0;
+  for (int i = 0; i < N; ++i) {
+    int candidate = 0;
+    bool moved = true;
+    while (moved) {
+      moved = false;
+      for (int j = 0; j < i; ++j) {
+        bool live_together = first[i] <= last[j] && first[j] <= last[i];
+        bool intersects = candidate < layout.offset[j] + columns[j] &&
+                          layout.offset[j] < candidate + columns[i];
+        if (live_together && intersects) {
+          candidate = (layout.offset[j] + columns[j] + alignment - 1) / alignment * alignment;
+          moved = true;
+        }
+      }
+    }
+    layout.offset[i] = candidate;
+    layout.end = layout.end < candidate + columns[i] ? candidate + columns[i] : layout.end;
+  }
+  return layout;
+}
+
+CUTE_HOST_DEVICE constexpr
+int
+allocation_columns(int end, int min_columns) {
+  int columns = min_columns;
+  while (columns < end) {
+    columns *= 2;
+  }
+  return columns;
+}
+
+} // namespace detail
+
+template <int Alignment, class... Regions>
+struct ArenaPlanAligned {
+  static_assert(sizeof...(Regions) > 0, "TMEM arena requires at least one region.");
+  static_assert(Alignment > 0 && (Alignment & (Alignment - 1)) == 0, "Region alignment must be a power of 2.");
+
+  static constexpr int NumRegions = sizeof...(Regions);
+  static constexpr int ColumnsPerAllocationSlice = 32;
+  static constexpr int Sm100TmemCapacityColumns = 512;
+
+private:
+  static constexpr int columns_[NumRegions] = {Regions::columns...};
+  static constexpr int first_[NumRegions] = {Regions::first_phase...};
+  static constexpr int last_[NumRegions] = {Regions::last_phase...};
+  static constexpr detail::ArenaLayout<NumRegions> layout_ =
+      detail::plan_arena(columns_, first_, last_, Alignment);
+
+public:
+  // Highest column touched by any region
+  static constexpr int UsedColumns = layout_.end;
+  // Columns to request from the allocator: power of 2, at least one allocation slice
+  static constexpr int AllocationColumns = detail::allocation_columns(UsedColumns, ColumnsPerAllocationSlice);
+
+  static_assert(AllocationColumns <= Sm100TmemCapacityColumns,
+    "TMEM arena exceeds the 512 columns available per SM. Shorten region lifetimes or shrink regions.");
+
+  template <int I>
+  static constexpr uint32_t offset = uint32_t(layout_.offset[I]);
+
+  template <int I>
+  static constexpr int columns = columns_[I];
+
+  // True if regions I and J are assigned intersecting columns (only possible for disjoint lifetimes)
+  template <int I, int J>
+  static constexpr bool aliases =
+    I != J &&
+    layout_.offset[I] < layout_.offset[J] + columns_[J] &&
+    layout_.offset[J] < layout_.offset[I] + columns_[I];
+
+  // TMEM address of region I given the arena base address returned by the allocator
+  template <int I>
+  CUTE_HOST_DEVICE static constexpr
+  uint32_t
+  address(uint32_t tmem_base) {
+    return tmem_base + offset<I>;
+  }
+
+  // Rebase a TMEM tensor (e.g. an accumulator fragment from make_fragment_C) onto region I
+  template <int I, class TmemTensor>
+  CUTE_HOST_DEVICE static constexpr
+  TmemTensor
+  place(TmemTensor tensor, uint32_t tmem_base) {
+    tensor.data() = address<I>(tmem_base);
+    return tensor;
+  }
+};
+
+template <class... Regions>
+using ArenaPlan = ArenaPlanAligned<1, Regions...>;
+
+//
+// Runtime wrapper binding a plan to one of Allocator1Sm / Allocator2Sm. The same preconditions as
+// the underlying allocator apply: a single, fully active warp issues allocate/free/release.
+//
+
+template <class Plan, class Allocator>
+class Arena {
+public:
+  CUTE_DEVICE
+  Arena() { }
+
+  CUTE_DEVICE void
+  allocate(uint32_t* dst_ptr) {
+    allocator_.allocate(Plan::AllocationColumns, dst_ptr);
+  }
+
+  CUTE_DEVICE void
+  release_allocation_lock() {
+    allocator_.release_allocation_lock();
+  }
+
+  CUTE_DEVICE void
+  free(uint32_t tmem_base) {
+    allocator_.free(tmem_base, Plan::AllocationColumns);
+  }
+
+private:
+  Allocator allocator_{};
+};
+
+} // namespace cute::TMEM
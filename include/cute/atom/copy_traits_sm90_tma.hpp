@@ -35,6 +35,7 @@
 #endif
 
 #include <cute/atom/copy_traits_sm90_tma_swizzle.hpp>
+#include <cute/atom/copy_traits_sm90_tma_desc_cache.hpp>
 #include <cute/atom/copy_traits.hpp>
 #include <cute/atom/copy_atom.hpp>
 
@@ -1044,7 +1045,21 @@ make_tma_copy_desc(Tensor<GEngine,GLayout> const& gtensor,         // The origin
     TMA::SmemSwizzleBits swizzle_bits = get_tma_swizzle_bits(swizzle);
     TMA::SmemSwizzleBase swizzle_base = get_tma_swizzle_base(swizzle);
     CUtensorMapSwizzle smem_swizzle = TMA::to_CUtensorMapSwizzle(swizzle_bits, swizzle_base);
-    CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+
+    // The driver version is queried once per process
+    static int const driver_version = [] {
+      int version = 0;
+      [[maybe_unused]] cudaError_t driver_version_err = cudaDriverGetVersion(&version);
+      assert(driver_version_err == cudaSuccess);
+      return version;
+    }();
+    bool clear_bit21 = driver_version <= 13010 &&
+      cute::bits_to_bytes(
+        cute::cosize(gtensor.layout()) *
+        cute::sizeof_bits<typename GEngine::value_type>::value) < 131072;
+
+    // Reuses a previously encoded descriptor of the same problem, see TMA::DescriptorCache
+    CUresult result = TMA::DescriptorCache::get().encode_tiled(
         &tma_desc,
         tma_format,
         tma_dim,
@@ -1056,18 +1071,8 @@ make_tma_copy_desc(Tensor<GEngine,GLayout> const& gtensor,         // The origin
         tma_interleave,
         smem_swizzle,
         tma_l2Promotion,
-        tma_oobFill);
-   
-    int driver_version = 0;
-    cudaError_t driver_version_err = cudaDriverGetVersion(&driver_version);
-    assert(driver_version_err == cudaSuccess);
-    if (driver_version <= 13010) {      
-      if (cute::bits_to_bytes(
-            cute::cosize(gtensor.layout()) *
-            cute::sizeof_bits<typename GEngine::value_type>::value) < 131072) {
-        reinterpret_cast<uint64_t*>(&tma_desc)[1] &= ~(1llu << 21);
-      }
-    }
+        tma_oobFill,
+        clear_bit21);
 
     if (result != CUDA_SUCCESS) {
       std::cerr << "TMA Desc Addr:   " << &tma_desc
@@ -0,0 +1,232 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Host-side cache of encoded TMA descriptors.
+
+    Building the arguments of a TMA kernel encodes one CUtensorMap per operand with
+    cuTensorMapEncodeTiled, which is a measurable fraction of the host time of small, repeated GEMMs.
+    The descriptors only depend on the pointer through their base address, so the cache keys them by
+    the remaining encoding parameters (data type, global shape and strides, box, swizzle, ...) and
+    patches the base address of a cached descriptor with cuTensorMapReplaceAddress when the pointer
+    changes. Define CUTE_DISABLE_TMA_DESCRIPTOR_CACHE to always encode new descriptors.
+*/
+
+#if !defined(__CUDACC_RTC__)
+#include <cuda.h>
+
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#endif
+
+#include <cute/config.hpp>
+#include <cute/container/array.hpp>
+#include <cute/arch/copy_sm90_desc.hpp>
+#include <cutlass/cuda_host_adapter.hpp>
+
+namespace cute
+{
+
+#if (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
+
+namespace TMA {
+
+class DescriptorCache
+{
+public:
+  // The cache is cleared once it holds this many descriptors
+  static constexpr size_t Capacity = 1024;
+
+  struct Statistics {
+    uint64_t hits = 0;                  // Cached descriptors returned as is
+    uint64_t address_replacements = 0;  // Cached descriptors returned with a new base address
+    uint64_t misses = 0;                // Newly encoded descriptors
+  };
+
+  // Process-wide instance used by make_tma_copy
+  static DescriptorCache&
+  get()
+  {
+    static DescriptorCache cache;
+    return cache;
+  }
+
+  // Encodes a tiled descriptor with the arguments of cuTensorMapEncodeTiled. Clears bit 21 of the
+  // second word of newly encoded descriptors if clear_bit21 is set, see make_tma_copy_desc.
+  CUresult
+  encode_tiled(TmaDescriptor* desc,
+               CUtensorMapDataType format,
+               uint32_t rank,
+               void* address,
+               uint64_t const* shape,
+               uint64_t const* strides,       // rank - 1 byte strides, the stride of mode 0 is implicit
+               uint32_t const* box_shape,
+               uint32_t const* box_strides,
+               CUtensorMapInterleave interleave,
+               CUtensorMapSwizzle swizzle,
+               CUtensorMapL2promotion l2_promotion,
+               CUtensorMapFloatOOBfill oob_fill,
+               bool clear_bit21)
+  {
+    Key key{};
+    key[0] = uint64_t(format)      | (uint64_t(rank) << 8)          | (uint64_t(interleave) << 16) |
+             (uint64_t(swizzle) << 24) | (uint64_t(l2_promotion) << 32) | (uint64_t(oob_fill) << 40) |
+             (uint64_t(clear_bit21) << 48);
+    for (uint32_t i = 0; i < rank; ++i) {
+      key[1 + i] = shape[i];
+      key[6 + i] = i + 1 < rank ? strides[i] : 0;
+      key[11 + i] = uint64_t(box_shape[i]) | (uint64_t(box_strides[i]) << 32);
+    }
+
+#if !defined(CUTE_DISABLE_TMA_DESCRIPTOR_CACHE)
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (enabled_) {
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        Entry& entry = it->second;
+        if (entry.address == address) {
+          ++statistics_.hits;
+          *desc = entry.desc;
+          return CUDA_SUCCESS;
+        }
+        TmaDescriptor patched = entry.desc;
+        CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapReplaceAddress)(&patched, address);
+        if (result == CUDA_SUCCESS) {
+          ++statistics_.address_replacements;
+          entry.desc = patched;
+          entry.address = address;
+          *desc = patched;
+          return CUDA_SUCCESS;
+        }
+        // E.g. the new address does not meet the alignment of the descriptor, encode it from scratch
+      }
+    }
+#endif
+
+    CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+        desc, format, rank, address, shape, strides, box_shape, box_strides,
+        interleave, swizzle, l2_promotion, oob_fill);
+    if (result != CUDA_SUCCESS) {
+      return result;
+    }
+    if (clear_bit21) {
+      reinterpret_cast<uint64_t*>(desc)[1] &= ~(1llu << 21);
+    }
+
+#if !defined(CUTE_DISABLE_TMA_DESCRIPTOR_CACHE)
+    if (enabled_) {
+      ++statistics_.misses;
+      if (entries_.size() >= Capacity) {
+        entries_.clear();
+      }
+      entries_[key] = Entry{*desc, address};
+    }
+#endif
+    return CUDA_SUCCESS;
+  }
+
+  // Disabling the cache makes encode_tiled encode every descriptor
+  void
+  set_enabled(bool enabled)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+  }
+
+  bool
+  enabled() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return enabled_;
+  }
+
+  void
+  clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    statistics_ = Statistics{};
+  }
+
+  size_t
+  size() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+  Statistics
+  statistics() const
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return statistics_;
+  }
+
+private:
+  // Encoding parameters: packed enums and rank, then global shape, global strides and box
+  using Key = cute::array<uint64_t, 16>;
+
+  struct KeyHash {
+    size_t operator()(Key const& key) const {
+      // FNV-1a over the words of the key
+      uint64_t hash = 14695981039346656037ull;
+      for (uint64_t word : key) {
+        hash = (hash ^ word) * 1099511628211ull;
+      }
+      return size_t(hash);
+    }
+  };
+
+  struct KeyEqual {
+    bool operator()(Key const& lhs, Key const& rhs) const {
+      return std::memcmp(lhs.data(), rhs.data(), sizeof(Key)) == 0;
+    }
+  };
+
+  struct Entry {
+    TmaDescriptor desc;
+    void* address;
+  };
+
+  mutable std::mutex mutex_;
+  bool enabled_ = true;
+  std::unordered_map<Key, Entry, KeyHash, KeyEqual> entries_;
+  Statistics statistics_;
+};
+
+} // end namespace TMA
+
+#endif // (__CUDACC_VER_MAJOR__ >= 12) && !defined(__CUDACC_RTC__)
+
+} // end namespace cute
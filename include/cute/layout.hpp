@@ -764,6 +764,217 @@ transform_layout(Tuple0 const& t0, Tuple1 const& t1, F&& f)
   return detail::transform_layout(t0, t1, f, make_seq<R>{}, make_range<R,R0>{}, make_range<R,R1>{});
 }
 
+//
+// Static layout algebra
+//
+// Fully static layouts (every flattened shape and stride an Int<>) are the common case in
+// collective builders and atom construction. For those, coalesce, composition and right_inverse
+// are evaluated as constexpr loops over the modes instead of a chain of recursive instantiations,
+// and the result is materialized once per canonical (flattened) layout. The class templates below
+// are keyed on int sequences, so every spelling of the same flat layout shares one instantiation.
+// Define CUTE_DISABLE_STATIC_LAYOUT_ALGEBRA to always take the generic recursive path.
+//
+
+namespace detail {
+
+template <class T>
+struct is_static_int : false_type {};
+#if !defined(CUTE_DISABLE_STATIC_LAYOUT_ALGEBRA)
+template <int v>
+struct is_static_int<C<v>> : true_type {};
+#endif
+
+template <class T>
+struct is_static_int_tuple : is_static_int<T> {};
+template <class... Ts>
+struct is_static_int_tuple<tuple<Ts...>> : bool_constant<(sizeof...(Ts) > 0) && (is_static_int<Ts>::value && ...)> {};
+
+// The modes of a flat static layout: shape[i]:stride[i] for i < rank
+template <int N>
+struct StaticModes {
+  int rank = 0;
+  cute::array<int,N> shape  = {};
+  cute::array<int,N> stride = {};
+  bool shape_divisible  = true;
+  bool stride_divisible = true;
+};
+
+// Same rules as detail::bw_coalesce.
+// @a x selects the coalesce_x treatment of a trailing shape-1 mode.
+template <int N>
+CUTE_HOST_DEVICE constexpr
+StaticModes<N>
+static_coalesce(StaticModes<N> const& in, bool x)
+{
+  // Built back to front, out.shape[n-1] is the front mode
+  StaticModes<N> out{};
+  int n = 1;
+  out.shape[0]  = (x && in.shape[in.rank-1] == 1) ? 2 : in.shape[in.rank-1];
+  out.stride[0] = in.stride[in.rank-1];
+  for (int i = in.rank-2; i >= 0; --i) {
+    if (in.shape[i] == 1) {
+      continue;
+    } else if (n == 1 && out.shape[0] == 1) {
+      out.shape[0]  = in.shape[i];
+      out.stride[0] = in.stride[i];
+    } else if (in.shape[i] * in.stride[i] == out.stride[n-1]) {
+      out.shape[n-1]  = in.shape[i] * out.shape[n-1];
+      out.stride[n-1] = in.stride[i];
+    } else {
+      out.shape[n]  = in.shape[i];
+      out.stride[n] = in.stride[i];
+      ++n;
+    }
+  }
+  if (n == 1 && out.shape[0] == 1) {
+    out.stride[0] = 0;
+  }
+
+  StaticModes<N> result{};
+  result.rank = n;
+  for (int i = 0; i < n; ++i) {
+    result.shape[i]  = out.shape[n-1-i];
+    result.stride[i] = out.stride[n-1-i];
+  }
+  return result;
+}
+
+// Same rules as the general case of detail::composition_impl: flat static lhs, integral static rhs
+template <int N>
+CUTE_HOST_DEVICE constexpr
+StaticModes<N>
+static_composition(StaticModes<N> const& lhs, int rhs_shape, int rhs_stride)
+{
+  StaticModes<N> result{};
+  int rest_shape  = rhs_shape;
+  int rest_stride = rhs_stride;
+  for (int i = 0; i < lhs.rank-1; ++i) {
+    int curr_shape  = lhs.shape[i];
+    int curr_stride = lhs.stride[i];
+    int abs_stride  = rest_stride < 0 ? -rest_stride : rest_stride;
+
+    if (not ((rest_stride % curr_shape) == 0 or (rest_stride < curr_shape))) {
+      result.stride_divisible = false;
+    }
+
+    int next_shape  = (curr_shape + abs_stride - 1) / abs_stride;
+    int next_stride = ((abs_stride + curr_shape - 1) / curr_shape) * ((0 < rest_stride) - (rest_stride < 0));
+
+    if (next_shape == 1 or rest_shape == 1) {
+      rest_stride = next_stride;
+    } else {
+      int new_shape = next_shape < rest_shape ? next_shape : rest_shape;
+      if ((rest_shape % new_shape) != 0) {
+        result.shape_divisible = false;
+      }
+      result.shape[result.rank]  = new_shape;
+      result.stride[result.rank] = rest_stride * curr_stride;
+      ++result.rank;
+      rest_shape  = rest_shape / new_shape;
+      rest_stride = next_stride;
+    }
+  }
+
+  if (result.rank == 0 or rest_shape != 1) {
+    result.shape[result.rank]  = rest_shape;
+    result.stride[result.rank] = rest_stride * lhs.stride[lhs.rank-1];
+    ++result.rank;
+  }
+  return result;
+}
+
+// Same rules as right_inverse, applied to an already coalesced static layout
+template <int N>
+CUTE_HOST_DEVICE constexpr
+StaticModes<N+1>
+static_right_inverse(StaticModes<N> const& in)
+{
+  cute::array<int,N> preprod = {};
+  cute::array<kvpair,N> order = {};
+  int prod = 1;
+  for (int i = 0; i < in.rank; ++i) {
+    preprod[i] = prod;
+    prod *= in.shape[i];
+    order[i] = kvpair{in.stride[i], i};
+  }
+  // Sort the modes by stride
+  for (int i = 0; i < in.rank; ++i) {
+    for (int j = i+1; j < in.rank; ++j) {
+      if (order[j] < order[i]) {
+        kvpair tmp = order[j]; order[j] = order[i]; order[i] = tmp;
+      }
+    }
+  }
+
+  StaticModes<N+1> result{};
+  result.rank      = 1;
+  result.shape[0]  = 1;
+  result.stride[0] = 0;
+  int curr = 1;
+  for (int k = 0; k < in.rank; ++k) {
+    int i = order[k].val;
+    if (in.stride[i] == curr) {
+      result.shape[result.rank]  = in.shape[i];
+      result.stride[result.rank] = preprod[i];
+      ++result.rank;
+      curr = in.shape[i] * in.stride[i];
+    }
+  }
+  return static_coalesce(result, false);
+}
+
+// Materialize the first Modes::value.rank modes of Modes::value as a Layout
+template <class Modes, int... Is>
+CUTE_HOST_DEVICE constexpr
+auto
+make_static_layout(seq<Is...>)
+{
+  if constexpr (sizeof...(Is) == 1) {
+    return Layout<Int<Modes::value.shape[0]>, Int<Modes::value.stride[0]>>{};
+  } else {
+    return Layout<tuple<Int<Modes::value.shape[Is]>...>, tuple<Int<Modes::value.stride[Is]>...>>{};
+  }
+
+  CUTE_GCC_UNREACHABLE;
+}
+
+template <class Modes>
+using static_layout_t = decltype(make_static_layout<Modes>(make_seq<Modes::value.rank>{}));
+
+template <class Shape, class Stride, bool X>
+struct StaticCoalesce : StaticCoalesce<to_seq_t<Shape>, to_seq_t<Stride>, X> {};
+
+template <int... Ss, int... Ds, bool X>
+struct StaticCoalesce<seq<Ss...>, seq<Ds...>, X> {
+  static constexpr StaticModes<sizeof...(Ss)> value =
+    static_coalesce(StaticModes<sizeof...(Ss)>{int(sizeof...(Ss)), {Ss...}, {Ds...}}, X);
+  using type = static_layout_t<StaticCoalesce>;
+};
+
+template <class LShape, class LStride, int RShape, int RStride>
+struct StaticComposition : StaticComposition<to_seq_t<LShape>, to_seq_t<LStride>, RShape, RStride> {};
+
+template <int... Ss, int... Ds, int RShape, int RStride>
+struct StaticComposition<seq<Ss...>, seq<Ds...>, RShape, RStride> {
+  static constexpr StaticModes<sizeof...(Ss)> value =
+    static_composition(StaticModes<sizeof...(Ss)>{int(sizeof...(Ss)), {Ss...}, {Ds...}}, RShape, RStride);
+  static_assert(value.stride_divisible, "Stride Divisibility Condition");
+  static_assert(value.shape_divisible,  "Shape Divisibility Condition");
+  using type = static_layout_t<StaticComposition>;
+};
+
+template <class Shape, class Stride>
+struct StaticRightInverse : StaticRightInverse<to_seq_t<Shape>, to_seq_t<Stride>> {};
+
+template <int... Ss, int... Ds>
+struct StaticRightInverse<seq<Ss...>, seq<Ds...>> {
+  static constexpr StaticModes<sizeof...(Ss)+1> value =
+    static_right_inverse(StaticCoalesce<seq<Ss...>, seq<Ds...>, false>::value);
+  using type = static_layout_t<StaticRightInverse>;
+};
+
+} // end namespace detail
+
 //
 // Coalesce and Filter
 //
@@ -829,6 +1040,9 @@ coalesce_x(Layout<Shape,Stride> const& layout)
   auto flat_stride = flatten(layout.stride());
 
   constexpr int R = decltype(rank(flat_shape))::value;
+  if constexpr (is_static_int_tuple<decltype(flat_shape)>::value && is_static_int_tuple<decltype(flat_stride)>::value) {
+    return typename StaticCoalesce<decltype(wrap(flat_shape)), decltype(wrap(flat_stride)), true>::type{};
+  } else
   if constexpr (is_constant<1, decltype(get<R-1>(flat_shape))>::value) {
     return detail::bw_coalesce<R-2>(flat_shape, flat_stride,             Int<2>{}, get<R-1>(flat_stride));
   } else {
@@ -870,7 +1084,13 @@ coalesce(Layout<Shape,Stride> const& layout)
   auto flat_stride = flatten(layout.stride());
 
   constexpr int R = decltype(rank(flat_shape))::value;
-  return detail::bw_coalesce<R-2>(flat_shape, flat_stride, get<R-1>(flat_shape), get<R-1>(flat_stride));
+  if constexpr (detail::is_static_int_tuple<decltype(flat_shape)>::value && detail::is_static_int_tuple<decltype(flat_stride)>::value) {
+    return typename detail::StaticCoalesce<decltype(wrap(flat_shape)), decltype(wrap(flat_stride)), false>::type{};
+  } else {
+    return detail::bw_coalesce<R-2>(flat_shape, flat_stride, get<R-1>(flat_shape), get<R-1>(flat_stride));
+  }
+
+  CUTE_GCC_UNREACHABLE;
 }
 
 // Apply coalesce at the terminals of trg_profile
@@ -1047,6 +1267,11 @@ composition_impl(LShape const& lhs_shape, [[maybe_unused]] LStride const& lhs_st
   } else
   if constexpr (is_integral<LShape>::value) {              // Special case shortcut for any LHS integral shape
     return Layout{rhs_shape, rhs_stride * lhs_stride};
+  } else
+  if constexpr (is_static_int_tuple<LShape>::value && is_static_int_tuple<LStride>::value &&
+                is_static_int<RShape>::value && is_static_int<RStride>::value) {
+    // Static case: LHS static flat tuple, RHS static integral
+    return typename StaticComposition<LShape, LStride, RShape::value, RStride::value>::type{};
   } else {                                                 // General case: LHS tuple, RHS integral
     constexpr int R = tuple_size<LShape>::value;
 
@@ -1264,42 +1489,50 @@ CUTE_HOST_DEVICE constexpr
 auto
 right_inverse(Layout<Shape,Stride> const& layout)
 {
-  // Flatten and filter shape-1
-  auto clayout = coalesce(layout);
-  auto lstride = wrap(clayout.stride());
-  auto lshape  = wrap(clayout.shape());
-
-  // Prefix product of the shape
-  auto preprod_shape = cute::fold(lshape, cute::tuple<_1>{}, [](auto c, auto vi) { return append(c, vi*back(c)); });
-
-  // Filter out any dynamic strides
-  [[maybe_unused]] auto filtered_seq    = filter_tuple(make_seq<rank(lstride)>{}, lstride, [](auto i, auto d) {
-                                                         return conditional_return<is_static_v<decltype(d)>>(cute::tuple{i}, cute::tuple<>{}); });
-  [[maybe_unused]] auto filtered_stride = transform(filtered_seq, [&](auto i) { return get<i>(lstride); });
-
-  // Sort by strides
-  using Sorted = detail::SortByKey<decltype(filtered_stride), decltype(filtered_seq)>;
-  auto sorted_seq = typename Sorted::val_type{};
-  //auto sorted_stride = typename Sorted::key_type{};
-
-  auto [result_shape, result_stride, curr] = cute::fold(sorted_seq, tuple<tuple<_1>,tuple<_0>,_1>{},
-    [&](auto const& init, auto i) {
-      [[maybe_unused]] auto ishape  = get<i>(lshape);
-      [[maybe_unused]] auto istride = get<i>(lstride);
-      [[maybe_unused]] auto curr_stride = get<2>(init);
-
-      if constexpr (is_constant<decltype(istride)::value, decltype(curr_stride)>::value) {
-        return make_tuple(append(get<0>(init),  ishape),                // result_shape
-                          append(get<1>(init), get<i>(preprod_shape)),  // result_stride
-                          ishape * istride);
-      } else {
-        return init;
-      }
-
-      CUTE_GCC_UNREACHABLE;
-    });
+  using FlatShape  = decltype(wrap(flatten(layout.shape())));
+  using FlatStride = decltype(wrap(flatten(layout.stride())));
+  if constexpr (detail::is_static_int_tuple<FlatShape>::value && detail::is_static_int_tuple<FlatStride>::value) {
+    return typename detail::StaticRightInverse<FlatShape, FlatStride>::type{};
+  } else {
+    // Flatten and filter shape-1
+    auto clayout = coalesce(layout);
+    auto lstride = wrap(clayout.stride());
+    auto lshape  = wrap(clayout.shape());
+
+    // Prefix product of the shape
+    auto preprod_shape = cute::fold(lshape, cute::tuple<_1>{}, [](auto c, auto vi) { return append(c, vi*back(c)); });
+
+    // Filter out any dynamic strides
+    [[maybe_unused]] auto filtered_seq    = filter_tuple(make_seq<rank(lstride)>{}, lstride, [](auto i, auto d) {
+                                                           return conditional_return<is_static_v<decltype(d)>>(cute::tuple{i}, cute::tuple<>{}); });
+    [[maybe_unused]] auto filtered_stride = transform(filtered_seq, [&](auto i) { return get<i>(lstride); });
+
+    // Sort by strides
+    using Sorted = detail::SortByKey<decltype(filtered_stride), decltype(filtered_seq)>;
+    auto sorted_seq = typename Sorted::val_type{};
+    //auto sorted_stride = typename Sorted::key_type{};
+
+    auto [result_shape, result_stride, curr] = cute::fold(sorted_seq, tuple<tuple<_1>,tuple<_0>,_1>{},
+      [&](auto const& init, auto i) {
+        [[maybe_unused]] auto ishape  = get<i>(lshape);
+        [[maybe_unused]] auto istride = get<i>(lstride);
+        [[maybe_unused]] auto curr_stride = get<2>(init);
+
+        if constexpr (is_constant<decltype(istride)::value, decltype(curr_stride)>::value) {
+          return make_tuple(append(get<0>(init),  ishape),                // result_shape
+                            append(get<1>(init), get<i>(preprod_shape)),  // result_stride
+                            ishape * istride);
+        } else {
+          return init;
+        }
+
+        CUTE_GCC_UNREACHABLE;
+      });
+
+    return coalesce(make_layout(result_shape, result_stride));
+  }
 
-  return coalesce(make_layout(result_shape, result_stride));
+  CUTE_GCC_UNREACHABLE;
 }
 
 CUTE_HOST_DEVICE constexpr
@@ -55,6 +55,7 @@
 
 #include <cute/algorithm/cooperative_copy.hpp>
 #include <cute/algorithm/cooperative_gemm.hpp>
+#include <cute/algorithm/copy_auto.hpp>
 
 //
 // Utilities
@@ -175,6 +175,8 @@ enum class ReservedNamedBarriers {
   , TmemAllocBarrier = 6 
   , Sm120MainloopBarrier = 7
   , FirstUserBarrier = Sm120MainloopBarrier + 1
+  // SM100 ping-pong kernels never run the SM90 transpose, so the second epilogue warpgroup reuses its ID
+  , Sm100PingpongEpilogueBarrier = TransposeBarrier
 };
 
 
@@ -39,6 +39,7 @@
 #include "cutlass/arch/barrier.h"
 #include "cutlass/conv/dispatch_policy.hpp"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/kernel_hardware_info.h"
 
 #ifndef CUTLASS_GDC_ENABLED
   #if (CUDA_BARRIER_ENABLED && \
@@ -88,6 +89,15 @@ void launch_dependent_grids() {
 #endif
 }
 
+// Issues launch_dependents only if current_point is the release point selected for the launch,
+// so that a kernel signals its dependents exactly once.
+CUTLASS_DEVICE
+void launch_dependent_grids(PdlReleasePoint release_point, PdlReleasePoint current_point) {
+  if (release_point == current_point) {
+    launch_dependent_grids();
+  }
+}
+
 // Issuing the griddepcontrol.wait instruction enforces no global memory access
 // prior to this istruction. This ensures the correctness of global memory access
 // when launching a dependent kernel earlier.
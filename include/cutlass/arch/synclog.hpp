@@ -30,6 +30,15 @@
  **************************************************************************************************/
 /*! \file
     \brief Synchronization event logging for race condition debugging.
+
+    Defining CUTLASS_ENABLE_SYNCLOG logs every synchronization event of lane 0 of each warp of
+    CTA (0,0,0) into one global buffer, and prints it at the end of the kernel.
+
+    Defining CUTLASS_ENABLE_SYNCLOG_SAMPLED instead selects a low-overhead trace mode meant for
+    performance work: events are only recorded for the CTAs, warps and event types chosen by
+    synclog_set_sample_config(), each sampled CTA writes fixed-size records into its own ring
+    buffer (keeping the most recent events when it wraps), and nothing is printed by the kernel.
+    cutlass/util/synclog_timeline.hpp decodes the rings into per-CTA timelines on the host.
 */
 
 #pragma once
@@ -47,26 +56,86 @@
 #include <vector>
 #endif
 
+#if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED) && !defined(CUTLASS_ENABLE_SYNCLOG)
+#define CUTLASS_ENABLE_SYNCLOG 1
+#endif
+
 namespace cutlass {
 namespace arch {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Selection of the events recorded by the sampled synclog mode
+struct SynclogSampleConfig {
+  /// Every cta_stride-th CTA in linear launch order is sampled, starting with CTA 0
+  uint32_t cta_stride = 1;
+  /// Number of sampled CTAs; each owns one ring buffer
+  uint32_t max_ctas = 64;
+  /// Bit w selects warp w (linear thread index / 32) of a sampled CTA
+  uint32_t warp_mask = 0xFFFFFFFFu;
+  /// Number of records each ring holds before the oldest ones are overwritten
+  uint32_t ring_slots = 4096;
+  /// Bit h selects events with synclog_header_* value h
+  uint64_t event_mask = ~uint64_t(0);
+};
+
+// Sampled mode layout of the synclog buffer, in 32-bit words:
+//   [1, 7)                      : cta_stride, max_ctas, warp_mask, ring_slots, event_mask (lo, hi)
+//   [8, 8 + max_ctas)           : number of records written by each sampled CTA
+//   [ring_base, ...)            : max_ctas rings of ring_slots records each
+// Records use the layout of the regular mode, padded to synclog_sample_slot_words.
+constexpr uint32_t synclog_sample_config_cta_stride = 1;
+constexpr uint32_t synclog_sample_config_max_ctas = 2;
+constexpr uint32_t synclog_sample_config_warp_mask = 3;
+constexpr uint32_t synclog_sample_config_ring_slots = 4;
+constexpr uint32_t synclog_sample_config_event_mask = 5;
+constexpr uint32_t synclog_sample_counters = 8;
+constexpr uint32_t synclog_sample_slot_words = 16;
+
+CUTLASS_HOST_DEVICE constexpr
+uint32_t synclog_sample_ring_base(uint32_t max_ctas) {
+  return (synclog_sample_counters + max_ctas + synclog_sample_slot_words - 1) /
+    synclog_sample_slot_words * synclog_sample_slot_words;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 #if defined(CUTLASS_ENABLE_SYNCLOG)
 
 constexpr uint32_t synclog_cap = 1 << 26;
 
 inline std::mutex synclog_mutex;
 inline std::vector<uint32_t*> synclog_buf_list;
+inline SynclogSampleConfig synclog_sample_config;
 #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
 CUTLASS_DEVICE uint32_t* synclog_buf;
 #endif
 
+#if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+CUTLASS_DEVICE
+uint32_t synclog_sample_cta() {
+  #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  return blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z);
+  #else
+  return 0;
+  #endif
+}
+#endif // defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+
 CUTLASS_DEVICE
 uint32_t* synclog_alloc(uint32_t n) {
   #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
   uint32_t* buf = synclog_buf;
   if (buf == nullptr) return nullptr;
+  #if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+  // synclog_condition_emit() has already made sure this CTA is sampled
+  CUTLASS_UNUSED(n);
+  uint32_t ring = synclog_sample_cta() / buf[synclog_sample_config_cta_stride];
+  uint32_t ring_slots = buf[synclog_sample_config_ring_slots];
+  uint32_t slot = atomicAdd(&buf[synclog_sample_counters + ring], 1u) % ring_slots;
+  return buf + synclog_sample_ring_base(buf[synclog_sample_config_max_ctas]) +
+    (ring * ring_slots + slot) * synclog_sample_slot_words;
+  #endif
   uint32_t last = atomicAdd(&buf[0], n);
   if (last + n < synclog_cap) return buf + last + 1;
   if (last >= synclog_cap) atomicAdd(&buf[0], -n);
@@ -223,12 +292,34 @@ constexpr uint32_t synclog_length_wgmma_smem_smem = synclog_length_prefix + 4;
 constexpr bool     synclog_enable_cpasync_barrier_arrive = true;
 constexpr uint32_t synclog_header_cpasync_barrier_arrive = 33;
 constexpr uint32_t synclog_length_cpasync_barrier_arrive = synclog_length_prefix + 1;
+
+// Every record must fit into one slot of the sampled mode rings
+static_assert(synclog_length_prefix + 5 <= synclog_sample_slot_words);
+
 CUTLASS_DEVICE
-bool synclog_condition_emit() {
+bool synclog_condition_emit(uint32_t header) {
   #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
+  #if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+  uint32_t const* buf = synclog_buf;
+  if (buf == nullptr) return false;
+  uint32_t event_mask = buf[synclog_sample_config_event_mask + header / 32];
+  if (((event_mask >> (header % 32)) & 1) == 0) return false;
+  uint32_t thread = threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+  uint32_t warp = thread / NumThreadsPerWarp;
+  if (thread % NumThreadsPerWarp != 0 || warp >= 32 ||
+      ((buf[synclog_sample_config_warp_mask] >> warp) & 1) == 0) {
+    return false;
+  }
+  uint32_t cta = synclog_sample_cta();
+  uint32_t cta_stride = buf[synclog_sample_config_cta_stride];
+  return cta % cta_stride == 0 && cta / cta_stride < buf[synclog_sample_config_max_ctas];
+  #else
+  CUTLASS_UNUSED(header);
   return threadIdx.x % NumThreadsPerWarp == 0 && threadIdx.y == 0 && threadIdx.z == 0 &&
     blockIdx.x == 0 && blockIdx.y == 0 && blockIdx.z == 0;
+  #endif
   #else
+  CUTLASS_UNUSED(header);
   return 0;
   #endif
 }
@@ -276,6 +367,17 @@ void synclog_print_wgmma_desc(char const* str, uint32_t lo, uint32_t hi, char co
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Selects the CTAs, warps and events recorded by the kernels launched after the next
+/// synclog_setup(). Only has an effect with CUTLASS_ENABLE_SYNCLOG_SAMPLED.
+inline void synclog_set_sample_config(SynclogSampleConfig const& config) {
+  #if defined(CUTLASS_ENABLE_SYNCLOG)
+  std::scoped_lock lock(synclog_mutex);
+  synclog_sample_config = config;
+  #else
+  CUTLASS_UNUSED(config);
+  #endif // defined(CUTLASS_ENABLE_SYNCLOG)
+}
+
 inline void synclog_setup() {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
@@ -302,13 +404,41 @@ inline void synclog_setup() {
       synclog_buf_list.push_back(buf);
     }
   }
+  #if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+  SynclogSampleConfig const& config = synclog_sample_config;
+  if (config.cta_stride == 0 || config.ring_slots == 0 ||
+    synclog_sample_ring_base(config.max_ctas) +
+      uint64_t(config.max_ctas) * config.ring_slots * synclog_sample_slot_words > synclog_cap) {
+    fprintf(stderr, "synclog_setup(): sample config exceeds the synclog capacity\n");
+    fail();
+  }
+  uint32_t header[synclog_sample_counters] = {
+    0,
+    config.cta_stride,
+    config.max_ctas,
+    config.warp_mask,
+    config.ring_slots,
+    static_cast<uint32_t>(config.event_mask),
+    static_cast<uint32_t>(config.event_mask >> 32),
+    0
+  };
+  // Only the header and the ring counters need clearing, records are overwritten in place
+  size_t clear_words = synclog_sample_counters + config.max_ctas;
+  #else
+  size_t clear_words = synclog_cap;
+  #endif
   for (int device = 0; device < device_count; device++) {
     uint32_t* buf = synclog_buf_list.at(device);
     if (cudaSetDevice(device) != cudaSuccess ||
-      cudaMemset(buf, 0, synclog_cap * sizeof(uint32_t)) != cudaSuccess ||
+      cudaMemset(buf, 0, clear_words * sizeof(uint32_t)) != cudaSuccess ||
       cudaMemcpyToSymbol(synclog_buf, &buf, sizeof(buf)) != cudaSuccess) {
       fail();
     }
+    #if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+    if (cudaMemcpy(buf, header, sizeof(header), cudaMemcpyHostToDevice) != cudaSuccess) {
+      fail();
+    }
+    #endif
   }
   if (cudaSetDevice(orig_device) != cudaSuccess) {
     fail();
@@ -321,7 +451,7 @@ CUTLASS_DEVICE
 void synclog_emit_syncthreads(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_syncthreads) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_syncthreads)) return;
   uint32_t* to = synclog_alloc(synclog_length_syncthreads);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_syncthreads, line);
@@ -334,7 +464,7 @@ CUTLASS_DEVICE
 void synclog_emit_syncwarp(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_syncwarp) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_syncwarp)) return;
   uint32_t* to = synclog_alloc(synclog_length_syncwarp);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_syncwarp, line);
@@ -350,7 +480,7 @@ void synclog_emit_named_barrier_arrive_and_wait(
   uint32_t barrier_id) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_named_barrier_arrive_and_wait) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_named_barrier_arrive_and_wait)) return;
   uint32_t* to = synclog_alloc(synclog_length_named_barrier_arrive_and_wait);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_named_barrier_arrive_and_wait, line);
@@ -370,7 +500,7 @@ void synclog_emit_named_barrier_arrive(
   uint32_t barrier_id) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_named_barrier_arrive) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_named_barrier_arrive)) return;
   uint32_t* to = synclog_alloc(synclog_length_named_barrier_arrive);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_named_barrier_arrive, line);
@@ -390,7 +520,7 @@ void synclog_emit_cluster_barrier_init(
   uint32_t arrive_count) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_barrier_init) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_barrier_init)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_barrier_init);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_barrier_init, line);
@@ -410,7 +540,7 @@ void synclog_emit_cluster_barrier_wait(
   uint32_t phase) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_barrier_wait) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_barrier_wait)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_barrier_wait);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_barrier_wait, line);
@@ -431,7 +561,7 @@ void synclog_emit_cluster_barrier_test_wait(
   uint32_t pred) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_barrier_test_wait) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_barrier_test_wait)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_barrier_test_wait);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_barrier_test_wait, line);
@@ -453,7 +583,7 @@ void synclog_emit_cluster_barrier_try_wait(
   uint32_t phase) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_barrier_try_wait) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_barrier_try_wait)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_barrier_try_wait);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_barrier_try_wait, line);
@@ -474,7 +604,7 @@ void synclog_emit_cluster_barrier_arrive_cluster(
   uint32_t pred) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_barrier_arrive_cluster) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_barrier_arrive_cluster)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_barrier_arrive_cluster);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_barrier_arrive_cluster, line);
@@ -495,7 +625,7 @@ void synclog_emit_cluster_barrier_arrive(
   uint32_t smem_addr) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_barrier_arrive) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_barrier_arrive)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_barrier_arrive);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_barrier_arrive, line);
@@ -512,7 +642,7 @@ void synclog_emit_cluster_barrier_invalidate(
   uint32_t smem_addr) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_barrier_invalidate) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_barrier_invalidate)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_barrier_invalidate);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_barrier_invalidate, line);
@@ -530,7 +660,7 @@ void synclog_emit_cluster_transaction_barrier_arrive_and_expect_tx(
   uint32_t transaction_bytes) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_transaction_barrier_arrive_and_expect_tx) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_transaction_barrier_arrive_and_expect_tx)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_transaction_barrier_arrive_and_expect_tx);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_transaction_barrier_arrive_and_expect_tx, line);
@@ -552,7 +682,7 @@ void synclog_emit_cluster_transaction_barrier_arrive_and_expect_tx_cluster(
   uint32_t pred) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_transaction_barrier_arrive_and_expect_tx_cluster) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_transaction_barrier_arrive_and_expect_tx_cluster)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_transaction_barrier_arrive_and_expect_tx_cluster);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_transaction_barrier_arrive_and_expect_tx_cluster, line);
@@ -576,7 +706,7 @@ void synclog_emit_cluster_transaction_barrier_expect_transaction(
   uint32_t transaction_bytes) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_transaction_barrier_expect_transaction) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_transaction_barrier_expect_transaction)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_transaction_barrier_expect_transaction);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_transaction_barrier_expect_transaction, line);
@@ -598,7 +728,7 @@ void synclog_emit_cluster_transaction_barrier_complete_transaction(
   uint32_t pred) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cluster_transaction_barrier_complete_transaction) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cluster_transaction_barrier_complete_transaction)) return;
   uint32_t* to = synclog_alloc(synclog_length_cluster_transaction_barrier_complete_transaction);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cluster_transaction_barrier_complete_transaction, line);
@@ -619,7 +749,7 @@ CUTLASS_DEVICE
 void synclog_emit_fence_barrier_init(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_fence_barrier_init) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_fence_barrier_init)) return;
   uint32_t* to = synclog_alloc(synclog_length_fence_barrier_init);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_fence_barrier_init, line);
@@ -632,7 +762,7 @@ CUTLASS_DEVICE
 void synclog_emit_fence_view_async_shared(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_fence_view_async_shared) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_fence_view_async_shared)) return;
   uint32_t* to = synclog_alloc(synclog_length_fence_view_async_shared);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_fence_view_async_shared, line);
@@ -645,7 +775,7 @@ CUTLASS_DEVICE
 void synclog_emit_fence_view_shared(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_fence_view_shared) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_fence_view_shared)) return;
   uint32_t* to = synclog_alloc(synclog_length_fence_view_shared);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_fence_view_shared, line);
@@ -660,7 +790,7 @@ void synclog_emit_cp_async_wait(
   uint32_t n) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cp_async_wait) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cp_async_wait)) return;
   uint32_t* to = synclog_alloc(synclog_length_cp_async_wait);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cp_async_wait, line);
@@ -675,7 +805,7 @@ CUTLASS_DEVICE
 void synclog_emit_cp_async_wait_all(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cp_async_wait_all) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cp_async_wait_all)) return;
   uint32_t* to = synclog_alloc(synclog_length_cp_async_wait_all);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cp_async_wait_all, line);
@@ -688,7 +818,7 @@ CUTLASS_DEVICE
 void synclog_emit_cp_async_fence(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cp_async_fence) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cp_async_fence)) return;
   uint32_t* to = synclog_alloc(synclog_length_cp_async_fence);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cp_async_fence, line);
@@ -705,7 +835,7 @@ void synclog_emit_cp_async_nan(
   uint32_t pred) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cp_async_nan) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cp_async_nan)) return;
   uint32_t* to = synclog_alloc(synclog_length_cp_async_nan);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cp_async_nan, line);
@@ -730,7 +860,7 @@ void synclog_emit_cp_async_zfill(
   uint32_t size) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cp_async_zfill) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cp_async_zfill)) return;
   uint32_t* to = synclog_alloc(synclog_length_cp_async_zfill);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cp_async_zfill, line);
@@ -757,7 +887,7 @@ void synclog_emit_cp_async(
   uint32_t size) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cp_async) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cp_async)) return;
   uint32_t* to = synclog_alloc(synclog_length_cp_async);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cp_async, line);
@@ -783,7 +913,7 @@ void synclog_emit_tma_load(
   uint32_t smem_int_ptr) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_tma_load) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_tma_load)) return;
   uint32_t* to = synclog_alloc(synclog_length_tma_load);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_tma_load, line);
@@ -806,7 +936,7 @@ void synclog_emit_tma_store(
   uint32_t smem_int_ptr) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_tma_store) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_tma_store)) return;
   uint32_t* to = synclog_alloc(synclog_length_tma_store);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_tma_store, line);
@@ -824,7 +954,7 @@ CUTLASS_DEVICE
 void synclog_emit_tma_store_arrive(uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_tma_store_arrive) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_tma_store_arrive)) return;
   uint32_t* to = synclog_alloc(synclog_length_tma_store_arrive);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_tma_store_arrive, line);
@@ -839,7 +969,7 @@ void synclog_emit_tma_store_wait(
   uint32_t count) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_tma_store_wait) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_tma_store_wait)) return;
   uint32_t* to = synclog_alloc(synclog_length_tma_store_wait);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_tma_store_wait, line);
@@ -855,7 +985,7 @@ void synclog_emit_warpgroup_arrive(
   uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_warpgroup_arrive) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_warpgroup_arrive)) return;
   uint32_t* to = synclog_alloc(synclog_length_warpgroup_arrive);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_warpgroup_arrive, line);
@@ -870,7 +1000,7 @@ void synclog_emit_warpgroup_wait(
   uint32_t n) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_warpgroup_wait) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_warpgroup_wait)) return;
   uint32_t* to = synclog_alloc(synclog_length_warpgroup_wait);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_warpgroup_wait, line);
@@ -886,7 +1016,7 @@ void synclog_emit_warpgroup_commit_batch(
   uint32_t line) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_warpgroup_commit_batch) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_warpgroup_commit_batch)) return;
   uint32_t* to = synclog_alloc(synclog_length_warpgroup_commit_batch);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_warpgroup_commit_batch, line);
@@ -901,7 +1031,7 @@ void synclog_emit_wgmma_reg_smem(
   uint64_t desc_b) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_wgmma_reg_smem) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_wgmma_reg_smem)) return;
   uint32_t* to = synclog_alloc(synclog_length_wgmma_reg_smem);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_wgmma_reg_smem, line);
@@ -920,7 +1050,7 @@ void synclog_emit_wgmma_smem_smem(
   uint64_t desc_b) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_wgmma_smem_smem) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_wgmma_smem_smem)) return;
   uint32_t* to = synclog_alloc(synclog_length_wgmma_smem_smem);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_wgmma_smem_smem, line);
@@ -941,7 +1071,7 @@ void synclog_emit_cpasync_barrier_arrive(
   uint32_t smem_addr) {
   #if defined(CUTLASS_ENABLE_SYNCLOG)
   if constexpr (!synclog_enable_cpasync_barrier_arrive) return;
-  if (!synclog_condition_emit()) return;
+  if (!synclog_condition_emit(synclog_header_cpasync_barrier_arrive)) return;
   uint32_t* to = synclog_alloc(synclog_length_cpasync_barrier_arrive);
   if (to == nullptr) return;
   synclog_emit_prefix(to, synclog_header_cpasync_barrier_arrive, line);
@@ -960,7 +1090,8 @@ static __attribute__((__noinline__)) __device__
 static __attribute__((__noinline__))
 #endif
 void synclog_print() {
-  #if defined(CUTLASS_ENABLE_SYNCLOG)
+  // The sampled mode is decoded on the host, see cutlass/util/synclog_timeline.hpp
+  #if defined(CUTLASS_ENABLE_SYNCLOG) && !defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
   #if defined(__NVCC__) || (defined(__clang__) && defined(__CUDA__))
   if (synclog_buf == nullptr || !synclog_condition_print()) {
     return;
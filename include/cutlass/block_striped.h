@@ -263,5 +263,71 @@ struct BlockStripedReduce<BlockThreads, ArrayT, half_t> :
 };
 
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// BlockStripedVectorReduce
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Utility for performing block-striped access (load, store, reduce) of trivially-copyable,
+/// statically-sized array types to global memory, with reductions striped at the full access
+/// width of BlockStriped. Arrays of float are reduced with red.global.add.v4.f32 on SM90 and
+/// newer, other element types with one atomic_add per element.
+template <
+  int BlockThreads,
+  typename ArrayT,
+  typename AccessT = StripedAccessType<ArrayT> >
+struct BlockStripedVectorReduce :
+  BlockStriped<
+    BlockThreads,
+    ArrayT,
+    AccessT>
+{
+  using ElementT = typename ArrayT::Element;
+  static const int kElementsPerAccess = int(sizeof(AccessT) / sizeof(ElementT));
+
+  /// Whether an access is reduced with a single vectorized red.global.add
+  static constexpr bool kVectorized = platform::is_same<ElementT, float>::value && kElementsPerAccess == 4;
+
+  /// Reduce a single access element by element
+  CUTLASS_DEVICE
+  static void reduce_elements(AccessT *ptr, const AccessT &data)
+  {
+    cutlass::atomic_add<ElementT> reduce;
+    ElementT *access_output = reinterpret_cast<ElementT*>(ptr);
+    const ElementT *access_data = reinterpret_cast<const ElementT*>(&data);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < kElementsPerAccess; ++j) {
+      reduce(access_output + j, access_data[j]);
+    }
+  }
+
+  /// Reduce
+  CUTLASS_DEVICE
+  static void reduce(ArrayT *ptr, const ArrayT &data, int thread_idx)
+  {
+    AccessT *access_output = reinterpret_cast<AccessT*>(ptr);
+    const AccessT *access_data = reinterpret_cast<const AccessT*>(&data);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < BlockStripedVectorReduce::kStripes; ++i) {
+      AccessT *output = access_output + (BlockThreads * i) + thread_idx;
+      if constexpr (kVectorized) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+        // Vector-4 atomic reduction requires .target sm_90 or higher
+        const float *values = reinterpret_cast<const float*>(access_data + i);
+        asm volatile ("red.relaxed.gpu.global.add.v4.f32 [%0], {%1, %2, %3, %4};\n"
+          : : "l"(output), "f"(values[0]), "f"(values[1]), "f"(values[2]), "f"(values[3]) : "memory");
+#else
+        reduce_elements(output, access_data[i]);
+#endif
+      }
+      else {
+        reduce_elements(output, access_data[i]);
+      }
+    }
+  }
+};
+
+
 } // namespace cutlass
 
@@ -200,7 +200,7 @@ private:
   using SmemTileShape = cute::Shape<BlockTileA_M, BlockTileB_N, BlockTileA_K>;
 
   static constexpr int PipelineStages = detail::compute_stage_count_or_override<
-      ReducedSmemCapacityBytes, ElementAMma, ElementBMma, SmemTileShape>(StageCountType{});
+      ReducedSmemCapacityBytes, ElementAMma, ElementBMma, SmemTileShape, 0>(StageCountType{});
 
   constexpr static int NumSpatialDimensions = detail::gmem_layout_tags_to_spatial_dims<GmemLayoutA, GmemLayoutB>();
 
@@ -45,21 +45,22 @@ using namespace cute;
 namespace detail {
 
 // Returns the maximum number of smem tiles that can be used with a given smem capacity, or overrides with manual count. 
-template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, int stages>
+template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, int ExtraStageBytes, int stages>
 constexpr int
 compute_stage_count_or_override(StageCount<stages> stage_count) {
   return stages;
 }
 
 // Returns the maximum number of smem tiles that can be used with a given smem capacity, or overrides with manual count. 
-template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, int stages>
+template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, int ExtraStageBytes, int stages>
 constexpr int
 compute_stage_count_or_override(cute::Int<stages> stage_count) {
   return stages;
 }
 
 // Returns the maximum number of smem tiles that can be used with a given smem capacity, or overrides with manual count. 
-template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, int carveout_bytes>
+// ExtraStageBytes accounts for any per-stage smem the mainloop keeps besides the A and B tiles.
+template<int CapacityBytes, class ElementA, class ElementB, class TileShapeMNK, int ExtraStageBytes, int carveout_bytes>
 constexpr int
 compute_stage_count_or_override(StageCountAutoCarveout<carveout_bytes> stage_count) {
   constexpr auto mainloop_pipeline_bytes = sizeof(typename cutlass::PipelineTmaAsync<1>::SharedStorage);
@@ -68,6 +69,7 @@ compute_stage_count_or_override(StageCountAutoCarveout<carveout_bytes> stage_cou
   constexpr int stage_bytes =
     cutlass::bits_to_bytes(a_bits * size<0>(TileShapeMNK{}) * size<2>(TileShapeMNK{})) +
     cutlass::bits_to_bytes(b_bits * size<1>(TileShapeMNK{}) * size<2>(TileShapeMNK{})) +
+    ExtraStageBytes +
     static_cast<int>(mainloop_pipeline_bytes);
 
   return (CapacityBytes - carveout_bytes) / stage_bytes;
@@ -109,7 +111,9 @@ struct CollectiveBuilder<
     KernelScheduleType,
     cute::enable_if_t<cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90> ||
                       cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Cooperative> ||
-                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Pingpong>>
+                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Pingpong> ||
+                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90FpropScaleBiasRelu> ||
+                      cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90CooperativeFpropScaleBiasRelu>>
 > {
   static_assert(is_static<TileShape_MNK>::value);
   static_assert(is_static<ClusterShape_MNK>::value);
@@ -131,7 +135,7 @@ struct CollectiveBuilder<
   static constexpr cute::GMMA::Major GmmaMajorB =
     (ConvOp == conv::Operator::kFprop) ? cute::GMMA::Major::K : cute::GMMA::Major::MN;
 
-  using AtomLayoutMNK = cute::conditional_t<cute::is_same_v<KernelScheduleType, KernelImplicitTmaWarpSpecializedSm90Cooperative>,
+  using AtomLayoutMNK = cute::conditional_t<cute::is_base_of_v<KernelImplicitTmaWarpSpecializedSm90Cooperative, KernelScheduleType>,
       Layout<Shape<_2,_1,_1>>, Layout<Shape<_1,_1,_1>>>;
 
   using TiledMma = decltype(cute::make_tiled_mma(cute::GMMA::ss_op_selector<
@@ -150,8 +154,12 @@ struct CollectiveBuilder<
   using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::ss_smem_selector<
       GmmaMajorB, ElementBMma, decltype(cute::get<1>(TileShape_MNK{})), decltype(cute::get<2>(TileShape_MNK{}))>());
 
+  // The fused scale-bias-ReLU fprop keeps the scale and bias of the K tile's channels with every stage
+  static constexpr int ScaleBiasStageBytes = cute::is_base_of_v<KernelScheduleSm90FpropScaleBiasRelu, KernelScheduleType> ?
+      2 * static_cast<int>(cutlass::bits_to_bytes(cute::sizeof_bits_v<ElementA> * size<2>(TileShape_MNK{}))) : 0;
+
   static constexpr int PipelineStages = detail::compute_stage_count_or_override<cutlass::gemm::collective::detail::sm90_smem_capacity_bytes,
-      ElementAMma, ElementBMma, TileShape_MNK>(StageCountType{});
+      ElementAMma, ElementBMma, TileShape_MNK, ScaleBiasStageBytes>(StageCountType{});
 
   using SmemLayoutA = decltype(tile_to_shape(
       SmemLayoutAtomA{},
@@ -260,6 +260,62 @@ compute_lower_srt(ConvProblemShape<ConvOp, NumSpatialDimensions> const& problem_
   return lower;
 }
 
+// Grouped fprop is lowered onto the dense implicit GEMM by giving every N tile a single group:
+// the filter is already a dense (K,(c,s,r,t)) matrix with c = C/groups channels, so only the
+// activation needs its channel coordinate shifted to the tile's group. That holds when the
+// per-group filter count is a multiple of the N tile and the per-group channel count is a
+// multiple of the K tile, so no tile straddles two groups.
+template <conv::Operator ConvOp, int NumSpatialDimensions>
+CUTLASS_HOST_DEVICE
+constexpr bool
+is_grouped_fprop_implementable(
+    ConvProblemShape<ConvOp, NumSpatialDimensions> const& problem_shape,
+    int tile_n, int tile_k) {
+  constexpr int RankT = NumSpatialDimensions + 2;
+  int groups = problem_shape.groups;
+  if (groups == 1) {
+    return true;
+  }
+  if constexpr (ConvOp != conv::Operator::kFprop) {
+    return false;
+  }
+  else {
+    int filters = problem_shape.shape_B[0];
+    int channels_per_group = problem_shape.shape_B[RankT - 1];
+    return groups > 1 &&
+           problem_shape.shape_A[RankT - 1] == channels_per_group * groups &&
+           filters % groups == 0 &&
+           (filters / groups) % tile_n == 0 &&
+           channels_per_group % tile_k == 0;
+  }
+}
+
+// The im2col TMA tensor spans every channel of the activation in its gemm-k (c,s,r,t) mode.
+// Grouped fprop only reduces over the c = C/groups channels of one group, so this rebuilds the
+// tensor with the channel extent clamped to channels_per_group. The TMA descriptor still covers
+// the whole activation; each tile offsets its channel coordinate to the first channel of its group.
+template <class Engine, class Layout>
+CUTLASS_HOST_DEVICE
+constexpr auto
+make_grouped_fprop_im2col_tensor(cute::Tensor<Engine, Layout> const& tma_tensor, int channels_per_group) {
+  auto const& layout = tma_tensor.layout();
+  auto linear = layout.layout_b();                                                   // (m,(c,s,r,t))
+  auto shape_mk = cute::make_shape(
+      cute::get<0>(linear.shape()),
+      cute::replace<0>(cute::get<1>(linear.shape()), channels_per_group));
+  return cute::make_tensor(tma_tensor.data(),
+      cute::composition(layout.layout_a(), layout.offset(), cute::make_layout(shape_mk, linear.stride())));
+}
+
+// Shifts the channel coordinate, mode 0 of the im2col TMA codomain (c,w,h,d,n,s,r,t), of an im2col TMA tensor
+template <class Engine, class Layout>
+CUTLASS_HOST_DEVICE
+constexpr auto
+offset_im2col_channel(cute::Tensor<Engine, Layout> const& tma_tensor, int channel_offset) {
+  auto coord = cute::as_arithmetic_tuple(*tma_tensor.data());
+  return cute::make_tensor(cute::ArithmeticTupleIterator(coord + cute::E<0>{} * channel_offset), tma_tensor.layout());
+}
+
 template <class CopyOp> struct is_im2col_load { static constexpr bool value = false; };
 template <> struct is_im2col_load<cute::SM90_TMA_LOAD_IM2COL          > { static constexpr bool value = true; };
 template <> struct is_im2col_load<cute::SM90_TMA_LOAD_IM2COL_MULTICAST> { static constexpr bool value = true; };
@@ -354,6 +354,9 @@ public:
     TMA_A tma_load_a_fallback;
     TMA_B tma_load_b_fallback;
     dim3 cluster_shape_fallback;
+    // Grouped fprop: filters (K/groups) and activation channels (C/groups) per group
+    int32_t filters_per_group = 0;
+    int32_t channels_per_group = 0;
   };
 
   //
@@ -422,7 +425,9 @@ public:
       tma_load_b,
       tma_load_a_fallback,
       tma_load_b_fallback,
-      hw_info.cluster_shape_fallback
+      hw_info.cluster_shape_fallback,
+      problem_shape.shape_B[0] / problem_shape.groups,
+      problem_shape.shape_B[NumTensorDimensions-1]
     };
   }
 
@@ -586,7 +591,7 @@ public:
 
     // When groups > 1, it should be a Grouped Conv.
     if (problem_shape.groups > 1) {
-      implementable &= TileShapeMNKLRank > 3;
+      implementable &= TileShapeMNKLRank > 3 || ConvOp == conv::Operator::kFprop;
 
       if (!implementable) {
         CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Only Grouped Conv can support groups > 1.\n");
@@ -594,6 +599,16 @@ public:
       }
     }
 
+    // Grouped fprop reuses the dense tiling, so groups must align to the N and K tiles.
+    if constexpr (ConvOp == conv::Operator::kFprop) {
+      implementable &= detail::is_grouped_fprop_implementable(problem_shape, size<1>(TileShape{}), size<2>(TileShape{}));
+
+      if (!implementable) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped Fprop requires K/groups divisible by Tile_N and C/groups divisible by Tile_K.\n");
+        return false;
+      }
+    }
+
     // Only support Grouped Wgrad currently.
     if constexpr (TileShapeMNKLRank > 3) {
       implementable &= ConvOp == conv::Operator::kWgrad;
@@ -702,7 +717,18 @@ public:
           mcast_mask_a, mcast_mask_b] = load_inputs;
 
     // slice out the work coord from partitioned tensors
-    Tensor tAgA = tAgA_mk(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _);
+    Tensor tAgA = [&]() {
+      if constexpr (ConvOp == conv::Operator::kFprop) {
+        // Shift the im2col channel coordinate to the first channel of this N tile's group.
+        // Dense fprop has a single group, so the offset is always zero.
+        int group_idx = int(get<1>(cta_coord_mnkl)) * int(size<1>(TileShape{})) / params.filters_per_group;
+        return detail::offset_im2col_channel(
+            tAgA_mk(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _), group_idx * params.channels_per_group);
+      }
+      else {
+        return tAgA_mk(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _);
+      }
+    }();
     auto tensor_b_coord = get<1>(cta_coord_mnkl);
     if constexpr (is_grouped_wgrad) {
       // in grouped wgrad, tensor A = NZPQK, tensor B = NDHWC, tensor C = KTRSc, where C = G*c, c = channel_per_group = 8,16,32.
@@ -778,7 +804,16 @@ public:
 
     // Represent the full tensors -- get these from TMA
     auto K_A = conditional_return<is_strided_dgrad>(get<0>(K), K);
-    Tensor mA_mk = observed_tma_load_a_->get_tma_tensor(make_shape(M, K_A));
+    Tensor mA_mk = [&]() {
+      if constexpr (ConvOp == conv::Operator::kFprop) {
+        // Grouped fprop reduces over the channels of a single group only
+        return detail::make_grouped_fprop_im2col_tensor(
+            observed_tma_load_a_->get_tma_tensor(make_shape(M, K_A)), params.channels_per_group);
+      }
+      else {
+        return observed_tma_load_a_->get_tma_tensor(make_shape(M, K_A));
+      }
+    }();
     Tensor mB_nk = observed_tma_load_b_->get_tma_tensor(make_shape(N, K));
 
     // Tile the tensors and defer the slice
@@ -43,6 +43,7 @@
 #include "cutlass/conv/detail.hpp"
 #include "cutlass/conv/convolution.h"
 #include "cutlass/conv/dispatch_policy.hpp"
+#include "cutlass/arch/barrier.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/util/packed_stride.hpp"
 
@@ -103,6 +104,8 @@ struct CollectiveConv<
   using PipelineParams = typename MainloopPipeline::Params;
   using PipelineState  = typename cutlass::PipelineState<DispatchPolicy::Stages>;
 
+  static constexpr int NumProducerThreadEvents = 1;
+
   using ProblemShape = ConvProblemShape<ConvOp, NumSpatialDimensions>;
 
   static_assert(rank(SmemLayoutA{}) == 3, "SmemLayout must be rank 3 (M/N, K, PIPE)");
@@ -134,11 +137,20 @@ struct CollectiveConv<
   static constexpr bool is_im2col_A = detail::is_im2col_load<GmemTiledCopyA>::value;
   static constexpr bool is_im2col_B = detail::is_im2col_load<GmemTiledCopyB>::value;
 
+  // Fused fprop input transform: every activation element x of channel c is replaced by
+  // max(scale[c] * x + bias[c], 0) in smem before GMMA consumes the stage.
+  static constexpr bool IsFpropScaleBiasRelu = cute::is_base_of_v<KernelScheduleSm90FpropScaleBiasRelu, KernelSchedule>;
+  static_assert(!IsFpropScaleBiasRelu || cute::is_same_v<ElementA, cutlass::half_t> || cute::is_same_v<ElementA, cutlass::bfloat16_t>,
+      "The fused scale-bias-ReLU input transform requires a 16b floating point activation.");
+
   // TMA converts f32 input to tf32 when copying from GMEM to SMEM
   // For all other types, cast to size equivalent uint type to avoid any rounding by TMA.
+  // The fused input transform keeps the floating point type instead, since TMA only fills out of bounds (padding)
+  // elements with NaN for floating point tensors, and the transform relies on that NaN to keep padding at zero.
   static constexpr bool ConvertF32toTF32A = cute::is_same_v<float, ElementA>;
   static constexpr bool ConvertF32toTF32B = cute::is_same_v<float, ElementB>;
-  using InternalElementA = cute::conditional_t<ConvertF32toTF32A, tfloat32_t, uint_bit_t<sizeof_bits_v<ElementA>>>;
+  using InternalElementA = cute::conditional_t<ConvertF32toTF32A, tfloat32_t,
+                           cute::conditional_t<IsFpropScaleBiasRelu, ElementA, uint_bit_t<sizeof_bits_v<ElementA>>>>;
   using InternalElementB = cute::conditional_t<ConvertF32toTF32B, tfloat32_t, uint_bit_t<sizeof_bits_v<ElementB>>>;
 
   struct SharedStorage
@@ -146,6 +158,9 @@ struct CollectiveConv<
     struct TensorStorage : cute::aligned_struct<128, _0> {
       cute::array_aligned<typename TiledMma::ValTypeA, cute::cosize_v<SmemLayoutA>> smem_A;
       cute::array_aligned<typename TiledMma::ValTypeB, cute::cosize_v<SmemLayoutB>> smem_B;
+      // Per-stage scale and bias of the channels of the K tile, only allocated for the fused input transform
+      cute::array_aligned<ElementA, IsFpropScaleBiasRelu ? size<1>(SmemLayoutA{}) * DispatchPolicy::Stages : 0> smem_scale;
+      cute::array_aligned<ElementA, IsFpropScaleBiasRelu ? size<1>(SmemLayoutA{}) * DispatchPolicy::Stages : 0> smem_bias;
     } tensors;
 
     using PipelineStorage = typename MainloopPipeline::SharedStorage;
@@ -156,14 +171,22 @@ struct CollectiveConv<
 
   static constexpr int K_PIPE_MAX = DispatchPolicy::Stages;
   static constexpr int K_PIPE_MMAS = DispatchPolicy::PipelineAsyncMmaStages;
+  // Bulk copy bytes of the scale or the bias of one K tile
+  static constexpr uint32_t ScaleBiasTransactionBytes =
+      IsFpropScaleBiasRelu ? size<1>(SmemLayoutA{}) * static_cast<uint32_t>(sizeof(ElementA)) : 0;
+  static_assert(ScaleBiasTransactionBytes % 16 == 0, "Bulk copies of the scale and bias require 16B multiples.");
   static constexpr uint32_t TmaTransactionBytes =
       (size<0>(SmemLayoutA{}) * size<1>(SmemLayoutA{}) * static_cast<uint32_t>(sizeof(InternalElementA)))+
-      (size<0>(SmemLayoutB{}) * size<1>(SmemLayoutB{}) * static_cast<uint32_t>(sizeof(InternalElementB)));
+      (size<0>(SmemLayoutB{}) * size<1>(SmemLayoutB{}) * static_cast<uint32_t>(sizeof(InternalElementB)))+
+      (2 * ScaleBiasTransactionBytes);
 
   // Host side kernel arguments
   struct Arguments {
     ElementA const* ptr_A{nullptr};
     ElementB const* ptr_B{nullptr};
+    // Per-channel scale and bias of the activation, only read by the fused scale-bias-ReLU fprop schedules
+    ElementA const* ptr_scale{nullptr};
+    ElementA const* ptr_bias{nullptr};
   };
 
 private:
@@ -188,6 +211,12 @@ private:
             problem_shape.dilation[NumSpatialDimensions-1-i];
       }
 
+      // The fused input transform detects padding through the NaN out of bounds fill
+      TMA::DescriptorAuxParams aux_params{};
+      if constexpr (IsFpropScaleBiasRelu) {
+        aux_params.oobfill_ = TMA::OOBFill::CONSTANT;
+      }
+
       return make_im2col_tma_copy(
           GmemTiledCopyA{},
           tensor_a,
@@ -200,7 +229,8 @@ private:
           cute::reverse(shape(problem_shape.upper_padding)),
           cute::reverse(shape(problem_shape.traversal_stride)),
           shape(lower_srt),
-          shape(stride_srt));
+          shape(stride_srt),
+          aux_params);
     }
     // TMA tiled mode for tensor A in wgrad kernel.
     else {
@@ -294,6 +324,11 @@ public:
     TMA_A tma_load_a;
     TMA_B tma_load_b;
     uint32_t tma_transaction_bytes = TmaTransactionBytes;
+    // Grouped fprop: filters (K/groups) and activation channels (C/groups) per group
+    int32_t filters_per_group = 0;
+    int32_t channels_per_group = 0;
+    ElementA const* ptr_scale = nullptr;
+    ElementA const* ptr_bias = nullptr;
   };
 
   //
@@ -328,7 +363,11 @@ public:
     return {
       tma_load_a,
       tma_load_b,
-      TmaTransactionBytes
+      TmaTransactionBytes,
+      problem_shape.shape_B[0] / problem_shape.groups,
+      problem_shape.shape_B[NumTensorDimensions-1],
+      args.ptr_scale,
+      args.ptr_bias
     };
   }
 
@@ -343,6 +382,19 @@ public:
     implementable &= problem_shape.stride_A[NumTensorDimensions-1] == 1;
     implementable &= problem_shape.stride_B[NumTensorDimensions-1] == 1;
 
+    // The im2col mainloop implements unit-stride dgrad only; strided dgrad is decomposed into
+    // unit-stride sub-convolutions by device::ConvUniversalStridedDgradAdapter.
+    if constexpr (ConvOp == conv::Operator::kDgrad) {
+      bool unit_stride = true;
+      for (auto stride : problem_shape.traversal_stride) {
+        unit_stride &= (stride == 1);
+      }
+      if (!unit_stride) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Dgrad requires unit traversal strides.\n");
+        return false;
+      }
+    }
+
     constexpr int tma_alignment_bits = 128;
     // A extents.
     auto shape_A_orig = problem_shape.get_shape_A();
@@ -476,11 +528,27 @@ public:
       return false;
     }
 
-    if (problem_shape.groups > 1) {
-      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: This kernel does not support conv groups > 1.\n");
+    // Only grouped fprop whose groups align to the N and K tiles can support groups > 1.
+    implementable &= detail::is_grouped_fprop_implementable(problem_shape, size<1>(TileShape{}), size<2>(TileShape{}));
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped conv requires fprop with K/groups divisible by Tile_N and C/groups divisible by Tile_K.\n");
       return false;
     }
 
+    if constexpr (IsFpropScaleBiasRelu) {
+      // Every K tile reads the scale and bias of TileK whole channels with 16B aligned bulk copies
+      constexpr int tma_alignment_bytes = tma_alignment_bits / 8;
+      implementable &= problem_shape.shape_B[NumTensorDimensions-1] % size<2>(TileShape{}) == 0;
+      implementable &= args.ptr_scale != nullptr && reinterpret_cast<uintptr_t>(args.ptr_scale) % tma_alignment_bytes == 0;
+      implementable &= args.ptr_bias != nullptr && reinterpret_cast<uintptr_t>(args.ptr_bias) % tma_alignment_bytes == 0;
+
+      if (!implementable) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Fused scale-bias-ReLU requires C/groups divisible by Tile_K and 16B aligned scale and bias.\n");
+        return false;
+      }
+    }
+
     if constexpr (is_im2col_A || is_im2col_B) {
       auto [M, N, K, L] = cutlass::conv::detail::get_transformed_problem_shape_MNKL(problem_shape);
       auto to_64b = [](auto S) { return transform_leaf(S, [](auto s) { return static_cast<int64_t>(s); }); };
@@ -527,7 +595,16 @@ public:
 
     // TMA requires special handling of strides to deal with coord codomain mapping
     // Represent the full tensors -- get these from TMA
-    Tensor mA_mk = mainloop_params.tma_load_a.get_tma_tensor(make_shape(M,K));                            // (m,k)
+    Tensor mA_mk = [&]() {
+      if constexpr (ConvOp == conv::Operator::kFprop) {
+        // Grouped fprop reduces over the channels of a single group only
+        return detail::make_grouped_fprop_im2col_tensor(
+            mainloop_params.tma_load_a.get_tma_tensor(make_shape(M,K)), mainloop_params.channels_per_group);  // (m,k)
+      }
+      else {
+        return mainloop_params.tma_load_a.get_tma_tensor(make_shape(M,K));                                  // (m,k)
+      }
+    }();
     Tensor mB_nk = mainloop_params.tma_load_b.get_tma_tensor(make_shape(N,K));                            // (n,k)
 
     // Make tiled views, defer the slice
@@ -574,7 +651,17 @@ public:
       // Partition the inputs based on the current block coordinates.
       auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
 
-      Tensor gA = gA_mk(_,_,m_coord,_);                                                     // (BLK_M,BLK_K,k)
+      Tensor gA = [&]() {
+        if constexpr (ConvOp == conv::Operator::kFprop) {
+          // Shift the im2col channel coordinate to the first channel of this N tile's group.
+          // Dense fprop has a single group, so the offset is always zero.
+          int group_idx = int(n_coord) * int(size<1>(TileShape{})) / mainloop_params.filters_per_group;
+          return detail::offset_im2col_channel(gA_mk(_,_,m_coord,_), group_idx * mainloop_params.channels_per_group);
+        }
+        else {
+          return gA_mk(_,_,m_coord,_);
+        }
+      }();                                                                                  // (BLK_M,BLK_K,k)
       Tensor gB = gB_nk(_,_,n_coord,_);                                                     // (BLK_N,BLK_K,k)
 
       // Applies the mapping from block_tma_a
@@ -622,6 +709,16 @@ public:
 
         copy(mainloop_params.tma_load_a.with(*tma_barrier, mcast_mask_a), tAgA(_,_,_,*k_tile_iter), tAsA(_,_,_,write_stage));
         copy(mainloop_params.tma_load_b.with(*tma_barrier, mcast_mask_b), tBgB(_,_,_,*k_tile_iter), tBsB(_,_,_,write_stage));
+
+        if constexpr (IsFpropScaleBiasRelu) {
+          // Channel of the first element of this K tile, including the group offset
+          int channel = get<0>(gA(_0{},_0{},*k_tile_iter));
+          int smem_offset = write_stage * size<1>(SmemLayoutA{});
+          SM90_BULK_COPY_G2S::copy(mainloop_params.ptr_scale + channel, tma_barrier,
+                                   shared_tensors.smem_scale.data() + smem_offset, ScaleBiasTransactionBytes);
+          SM90_BULK_COPY_G2S::copy(mainloop_params.ptr_bias + channel, tma_barrier,
+                                   shared_tensors.smem_bias.data() + smem_offset, ScaleBiasTransactionBytes);
+        }
         ++k_tile_iter;
 
         // Advance smem_pipe_producer_state
@@ -684,6 +781,47 @@ public:
     CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<2>(sA));                                         // PIPE
     CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<2>(sB));                                         // PIPE
 
+    // Applies the fused scale-bias-ReLU to the A stage in place. All consumer threads transform the whole tile,
+    // so they synchronize before any of them issues GMMAs on it.
+    auto transform_A = [&](int read_stage) {
+      if constexpr (IsFpropScaleBiasRelu) {
+        constexpr int NumTransformThreads = size(TiledMma{});
+        constexpr int VectorElements = 128 / sizeof_bits_v<ElementA>;
+        constexpr int ThreadsK = size<1>(SmemLayoutA{}) / VectorElements;
+        static_assert(NumTransformThreads % ThreadsK == 0 && size<0>(SmemLayoutA{}) % (NumTransformThreads / ThreadsK) == 0,
+            "The activation tile must be evenly divisible among the consumer threads.");
+
+        auto transform_copy = make_tiled_copy(
+            Copy_Atom<UniversalCopy<uint128_t>, ElementA>{},
+            Layout<Shape<Int<NumTransformThreads / ThreadsK>, Int<ThreadsK>>, Stride<Int<ThreadsK>, _1>>{},
+            Layout<Shape<_1, Int<VectorElements>>>{});
+        auto thr_copy = transform_copy.get_thread_slice(thread_idx);
+
+        Tensor tXsA = thr_copy.partition_S(sA(_,_,read_stage));                                   // (CPY,CPY_M,CPY_K)
+        Tensor tXcA = thr_copy.partition_S(make_identity_tensor(make_shape(size<0>(sA), size<1>(sA)))); // (CPY,CPY_M,CPY_K)
+        Tensor tXrA = make_fragment_like(tXsA);                                                   // (CPY,CPY_M,CPY_K)
+
+        ElementA const* scale = shared_tensors.smem_scale.data() + read_stage * size<1>(SmemLayoutA{});
+        ElementA const* bias  = shared_tensors.smem_bias.data()  + read_stage * size<1>(SmemLayoutA{});
+
+        copy(transform_copy, tXsA, tXrA);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tXrA); ++i) {
+          int k = get<1>(tXcA(i));
+          float x = static_cast<float>(tXrA(i));
+          // Padding is filled with NaN by TMA and must stay zero, as in the zero padded conv of the transformed input
+          float y = CUTLASS_CMATH_NAMESPACE::isnan(x) ? 0.f :
+                    fmaxf(fmaf(x, static_cast<float>(scale[k]), static_cast<float>(bias[k])), 0.f);
+          tXrA(i) = static_cast<ElementA>(y);
+        }
+        copy(transform_copy, tXrA, tXsA);
+
+        // Make the generic proxy writes visible to the async proxy GMMA reads
+        cutlass::arch::fence_view_async_shared();
+        cutlass::arch::NamedBarrier::sync(NumTransformThreads, cutlass::arch::ReservedNamedBarriers::TransformBarrier);
+      }
+    };
+
     //
     // PIPELINED MAIN LOOP
     //
@@ -705,6 +843,7 @@ public:
       pipeline.consumer_wait(smem_pipe_consumer_state);
 
       int read_stage = smem_pipe_consumer_state.index();
+      transform_A(read_stage);
       warpgroup_arrive();
       // Unroll the K mode manually to set scale D to 1
       CUTLASS_PRAGMA_UNROLL
@@ -733,6 +872,7 @@ public:
       //
 
       int read_stage = smem_pipe_consumer_state.index();
+      transform_A(read_stage);
       warpgroup_fence_operand(accum);
       warpgroup_arrive();
       // Unroll the K mode manually to set scale D to 1
@@ -592,6 +592,7 @@ void print(ConvProblemShape<ConvOp, SpatialDim> const& problem) {
   printf("\tUpper padding:     "); print(problem.upper_padding);       printf("\n");
   printf("\tTraversal strides: "); print(problem.traversal_stride);    printf("\n");
   printf("\tDilation:          "); print(problem.dilation);            printf("\n");
+  printf("\tGroups:            %d\n", problem.groups);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
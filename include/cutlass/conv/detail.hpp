@@ -130,6 +130,32 @@ get_linearized_problem_shape_MNKL(ConvProblemShape<ConvOp, SpatialDim> const& pr
 
 }
 
+// Extent of the linearized M mode covered by one slice of the output along its outermost spatial mode,
+// i.e. P*Q for 3D and Q for 2D fprop. Zero if M is not the output pixel mode.
+template <class ProblemShape>
+CUTLASS_HOST_DEVICE
+constexpr int
+get_output_slice_extent_M(ProblemShape const&) {
+  return 0;
+}
+
+template <conv::Operator ConvOp, int SpatialDim>
+CUTLASS_HOST_DEVICE
+constexpr int
+get_output_slice_extent_M(ConvProblemShape<ConvOp, SpatialDim> const& problem_shape) {
+  if constexpr (ConvOp == conv::Operator::kFprop) {
+    constexpr int RankT = SpatialDim + 2;
+    int extent = 1;
+    for (int i = 2; i < RankT - 1; ++i) {
+      extent *= problem_shape.shape_C[i];
+    }
+    return extent;
+  }
+  else {
+    return 0;
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass::conv::detail
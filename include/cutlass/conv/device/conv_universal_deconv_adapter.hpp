@@ -0,0 +1,152 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Transposed convolution (deconvolution) on 3.x implicit GEMM dgrad kernels.
+
+    A transposed convolution with input x [n,(z),p,q,k], filter w [k,(t),r,s,c] and traversal
+    stride U is the dgrad of the forward convolution it transposes: y = dgrad(dy = x, w), with y
+    taking the role of dx [n,(d),h,w,c]. The filter is the channels-last form of a framework
+    ConvTranspose weight [k, c, (t), r, s], i.e. exactly the KTRSC filter the dgrad mainloop loads.
+
+    For U > 1 the equivalent direct convolution runs over x with U-1 zeros inserted between its
+    elements. Neither path supported here materializes or loads those zeros:
+      - SM100 mainloops built with KernelStridedDgradTmaWs* schedules handle the phases natively,
+        so the problem is launched once through ConvUniversalAdapter.
+      - All other dgrad mainloops (SM90 and SM100 im2col) run one unit-stride sub-convolution per
+        output phase through ConvUniversalStridedDgradAdapter.
+    In both cases the epilogue, including any fused bias and activation, is applied once per
+    output element of y.
+*/
+
+#pragma once
+
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/device/conv_universal_adapter.hpp"
+#include "cutlass/conv/device/conv_universal_strided_dgrad_adapter.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::conv::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// True when the collective mainloop implements strided dgrad without decomposition
+template <class CollectiveMainloop, class = void>
+struct has_native_strided_dgrad : cute::false_type {};
+
+template <class CollectiveMainloop>
+struct has_native_strided_dgrad<CollectiveMainloop, cute::void_t<decltype(CollectiveMainloop::is_strided_dgrad)>>
+  : cute::bool_constant<CollectiveMainloop::is_strided_dgrad> {};
+
+template <class ConvKernel>
+using DeconvUnderlyingAdapter = cute::conditional_t<
+    has_native_strided_dgrad<typename ConvKernel::CollectiveMainloop>::value,
+    ConvUniversalAdapter<ConvKernel>,
+    ConvUniversalStridedDgradAdapter<ConvKernel>>;
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  ConvUniversalDeconvAdapter is a stateful, reusable handle that runs a transposed convolution on a
+  cutlass::conv::kernel::ConvUniversal dgrad kernel. Problem shapes are built from deconvolution
+  parameters with make_problem_shape(); the A operand is the deconvolution input, B its filter and
+  C/D its output.
+
+  Auxiliary epilogue tensors are not offset per phase by the decomposed path, so epilogues that
+  store or load an aux tensor should only be used with natively strided mainloops.
+*/
+template <class ConvKernel_>
+class ConvUniversalDeconvAdapter : public detail::DeconvUnderlyingAdapter<ConvKernel_>
+{
+public:
+  using Base = detail::DeconvUnderlyingAdapter<ConvKernel_>;
+  using ConvKernel = typename Base::ConvKernel;
+  using ProblemShape = typename ConvKernel::ProblemShape;
+  using Arguments = typename Base::Arguments;
+  using Params = typename Base::Params;
+
+  static constexpr int NumSpatialDimensions = Base::NumSpatialDimensions;
+  static constexpr bool kNativeStridedDgrad =
+    detail::has_native_strided_dgrad<typename ConvKernel::CollectiveMainloop>::value;
+
+  static_assert(Base::kConvolutionalOperator == conv::Operator::kDgrad,
+    "ConvUniversalDeconvAdapter requires a dgrad kernel.");
+
+  using TensorExtent = typename ProblemShape::TensorExtent;
+  using SpatialExtent = typename ProblemShape::SpatialExtent;
+
+  /// Output extent of a transposed convolution along one spatial mode
+  static constexpr int
+  output_extent(int input, int filter, int lower_pad, int upper_pad, int stride, int dilation, int output_padding) {
+    return (input - 1) * stride - lower_pad - upper_pad + dilation * (filter - 1) + 1 + output_padding;
+  }
+
+  /// Builds the dgrad problem shape of a transposed convolution.
+  ///   shape_input  : [n,(z),p,q,k] deconvolution input
+  ///   shape_flt    : [k,(t),r,s,c] filter, c being the number of output channels
+  ///   output_padding extends the output at the upper end of each mode and must be less than the
+  ///   stride, so the dgrad problem recovers the input extent; it is not added to upper_padding.
+  static ProblemShape
+  make_problem_shape(
+      conv::Mode mode,
+      TensorExtent shape_input,
+      TensorExtent shape_flt,
+      SpatialExtent lower_padding,
+      SpatialExtent upper_padding,
+      SpatialExtent output_padding,
+      SpatialExtent tstride,
+      SpatialExtent dilation,
+      int groups = 1) {
+    constexpr int RankT = ProblemShape::RankT;
+    TensorExtent shape_output{};
+    shape_output[0] = shape_input[0];
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      CUTLASS_ASSERT(output_padding[i] >= 0 && output_padding[i] < tstride[i]);
+      shape_output[i + 1] = output_extent(shape_input[i + 1], shape_flt[i + 1],
+        lower_padding[i], upper_padding[i], tstride[i], dilation[i], output_padding[i]);
+    }
+    shape_output[RankT - 1] = shape_flt[RankT - 1] * groups;
+    return ProblemShape(mode, shape_output, shape_flt, lower_padding, upper_padding, tstride, dilation, groups);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::conv::device
+
+////////////////////////////////////////////////////////////////////////////////
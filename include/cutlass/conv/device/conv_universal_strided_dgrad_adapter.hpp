@@ -0,0 +1,371 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Strided dgrad for SM90 implicit GEMM convolution kernels.
+
+    The SM90 im2col TMA mainloop only implements unit-stride dgrad. A dgrad with traversal stride U
+    splits into prod(U) independent unit-stride sub-convolutions, one per output phase: the dx
+    elements whose coordinate is congruent to u modulo U are produced only by the filter taps r
+    with (u + pad - r * dilation) divisible by U. Each phase is a unit-stride dgrad over the full dy
+    tensor with a strided view of the filter and a strided view of dx, so it runs on the existing
+    im2col TMA kernel unchanged. Phases are launched back to back on the same stream.
+*/
+
+#pragma once
+
+#include <numeric>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/trace.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/device/conv_universal_adapter.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::conv::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  ConvUniversalStridedDgradAdapter is a stateful, reusable handle that runs a strided dgrad
+  problem on a unit-stride cutlass::conv::kernel::ConvUniversal dgrad kernel by decomposing it
+  into one sub-convolution per output phase.
+
+  A phase whose output extent is empty is skipped. Problems for which some non-empty phase has no
+  contributing filter taps (for example a filter smaller than the stride) or would require a
+  negative leading pad are rejected by can_implement().
+*/
+template <class ConvKernel_>
+class ConvUniversalStridedDgradAdapter
+{
+public:
+  using UnderlyingAdapter = ConvUniversalAdapter<ConvKernel_>;
+  using ConvKernel = typename UnderlyingAdapter::ConvKernel;
+  using TileShape = typename UnderlyingAdapter::TileShape;
+  using ElementA = typename UnderlyingAdapter::ElementA;
+  using ElementB = typename UnderlyingAdapter::ElementB;
+  using ElementC = typename UnderlyingAdapter::ElementC;
+  using ElementD = typename UnderlyingAdapter::ElementD;
+  using ElementAccumulator = typename UnderlyingAdapter::ElementAccumulator;
+  using DispatchPolicy = typename UnderlyingAdapter::DispatchPolicy;
+  using CollectiveMainloop = typename UnderlyingAdapter::CollectiveMainloop;
+  using CollectiveEpilogue = typename UnderlyingAdapter::CollectiveEpilogue;
+  using EpilogueOutputOp = typename UnderlyingAdapter::EpilogueOutputOp;
+  using ProblemShape = typename ConvKernel::ProblemShape;
+
+  static bool const kEnableCudaHostAdapter = UnderlyingAdapter::kEnableCudaHostAdapter;
+
+  static constexpr conv::Operator kConvolutionalOperator = UnderlyingAdapter::kConvolutionalOperator;
+  static constexpr int NumSpatialDimensions = UnderlyingAdapter::NumSpatialDimensions;
+
+  static_assert(kConvolutionalOperator == conv::Operator::kDgrad,
+    "ConvUniversalStridedDgradAdapter requires a dgrad kernel.");
+
+  /// Argument structure: User API
+  using Arguments = typename UnderlyingAdapter::Arguments;
+  /// Argument structure: Kernel API
+  using Params = typename UnderlyingAdapter::Params;
+
+private:
+
+  static constexpr size_t kWorkspaceAlignment = 256;
+
+  /// Kernel API parameters of each phase
+  std::vector<Params> phase_params_;
+
+  static size_t
+  aligned_workspace_size(Arguments const& args) {
+    size_t bytes = ConvKernel::get_workspace_size(args);
+    return (bytes + kWorkspaceAlignment - 1) / kWorkspaceAlignment * kWorkspaceAlignment;
+  }
+
+  /// Splits a strided dgrad into unit-stride sub-convolutions, one per non-empty output phase.
+  static Status
+  make_phase_arguments(Arguments const& args, std::vector<Arguments>& phase_args) {
+    ProblemShape const& problem_shape = args.problem_shape;
+    phase_args.clear();
+
+    if (problem_shape.mode != conv::Mode::kCrossCorrelation) {
+      CUTLASS_TRACE_HOST("  STRIDED DGRAD: only cross-correlation is supported.\n");
+      return Status::kInvalid;
+    }
+
+    int num_phases = 1;
+    for (int i = 0; i < NumSpatialDimensions; ++i) {
+      if (problem_shape.traversal_stride[i] < 1 || problem_shape.dilation[i] < 1) {
+        return Status::kInvalid;
+      }
+      num_phases *= problem_shape.traversal_stride[i];
+    }
+
+    for (int phase = 0; phase < num_phases; ++phase) {
+      // Phase coordinate u in [d,h,w] order, w fastest
+      cute::array<int, NumSpatialDimensions> phase_coord{};
+      for (int i = NumSpatialDimensions - 1, linear = phase; i >= 0; --i) {
+        phase_coord[i] = linear % problem_shape.traversal_stride[i];
+        linear /= problem_shape.traversal_stride[i];
+      }
+
+      Arguments sub_args = args;
+      ProblemShape& sub_shape = sub_args.problem_shape;
+      bool is_empty = false;
+      int64_t offset_B = 0;
+
+      for (int i = 0; i < NumSpatialDimensions; ++i) {
+        int const u = phase_coord[i];
+        int const stride = problem_shape.traversal_stride[i];
+        int const dilation = problem_shape.dilation[i];
+        int const pad = problem_shape.lower_padding[i];
+        int const filter_extent = problem_shape.shape_B[i+1];
+
+        int const output_extent = (problem_shape.shape_C[i+1] - u + stride - 1) / stride;
+        if (output_extent <= 0) {
+          is_empty = true;
+          break;
+        }
+
+        // Taps r = r0 + j * tap_stride reach this phase
+        int const tap_stride = stride / std::gcd(dilation, stride);
+        int r0 = 0;
+        while (r0 < tap_stride && (u + pad - r0 * dilation) % stride != 0) {
+          ++r0;
+        }
+        if (r0 >= tap_stride || r0 >= filter_extent) {
+          CUTLASS_TRACE_HOST("  STRIDED DGRAD: output phase " << phase << " has no contributing filter taps.\n");
+          return Status::kInvalid;
+        }
+        int const taps = (filter_extent - r0 + tap_stride - 1) / tap_stride;
+        int const sub_dilation = dilation * tap_stride / stride;
+        int const sub_pad = (u + pad - r0 * dilation) / stride;
+        if (sub_pad < 0) {
+          CUTLASS_TRACE_HOST("  STRIDED DGRAD: output phase " << phase << " requires a negative padding.\n");
+          return Status::kInvalid;
+        }
+
+        offset_B += int64_t(r0) * problem_shape.stride_B[i+1];
+        sub_shape.shape_B[i+1] = taps;
+        sub_shape.stride_B[i+1] = problem_shape.stride_B[i+1] * tap_stride;
+        sub_shape.shape_C[i+1] = output_extent;
+        sub_shape.stride_C[i+1] = problem_shape.stride_C[i+1] * stride;
+        sub_shape.lower_padding[i] = sub_pad;
+        sub_shape.upper_padding[i] = cute::max(0,
+          problem_shape.shape_A[i+1] - output_extent - sub_pad + (taps - 1) * sub_dilation);
+        sub_shape.traversal_stride[i] = 1;
+        sub_shape.dilation[i] = sub_dilation;
+      }
+
+      if (is_empty) {
+        continue;
+      }
+
+      // Epilogue stride modes are ((W,H,D,N), C, L); spatial dimension i maps to mode RankS-1-i
+      int64_t offset_C = 0;
+      int64_t offset_D = 0;
+      cute::for_each(cute::make_seq<NumSpatialDimensions>{}, [&](auto i) {
+        constexpr int mode = NumSpatialDimensions - 1 - decltype(i)::value;
+        int const stride = problem_shape.traversal_stride[i];
+        offset_C += int64_t(phase_coord[i]) * cute::get<0, mode>(args.epilogue.dC);
+        offset_D += int64_t(phase_coord[i]) * cute::get<0, mode>(args.epilogue.dD);
+        cute::get<0, mode>(sub_args.epilogue.dC) *= stride;
+        cute::get<0, mode>(sub_args.epilogue.dD) *= stride;
+      });
+
+      sub_args.mainloop.ptr_B = args.mainloop.ptr_B + offset_B;
+      if constexpr (not cute::is_void_v<ElementC>) {
+        if (args.epilogue.ptr_C != nullptr) {
+          sub_args.epilogue.ptr_C = args.epilogue.ptr_C + offset_C;
+        }
+      }
+      sub_args.epilogue.ptr_D = args.epilogue.ptr_D + offset_D;
+
+      phase_args.push_back(sub_args);
+    }
+
+    if (phase_args.empty()) {
+      return Status::kInvalid;
+    }
+    return Status::kSuccess;
+  }
+
+public:
+
+  /// Number of sub-convolutions launched by run()
+  int phase_count() const {
+    return static_cast<int>(phase_params_.size());
+  }
+
+  /// Determines whether the conv can execute the given problem.
+  static Status
+  can_implement(Arguments const& args) {
+    std::vector<Arguments> phase_args;
+    Status status = make_phase_arguments(args, phase_args);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    for (auto const& sub_args : phase_args) {
+      status = UnderlyingAdapter::can_implement(sub_args);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  /// Gets the workspace size: each phase owns an aligned slice.
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    std::vector<Arguments> phase_args;
+    if (make_phase_arguments(args, phase_args) != Status::kSuccess) {
+      return 0;
+    }
+    size_t workspace_bytes = 0;
+    for (auto const& sub_args : phase_args) {
+      workspace_bytes += aligned_workspace_size(sub_args);
+    }
+    CUTLASS_TRACE_HOST("  workspace_bytes: " << workspace_bytes);
+    return workspace_bytes;
+  }
+
+  /// Initializes the per-phase conv state from arguments.
+  Status
+  initialize(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+
+    CUTLASS_TRACE_HOST("ConvUniversalStridedDgrad::initialize() - workspace "
+      << workspace << ", stream: " << (stream ? "non-null" : "null"));
+
+    std::vector<Arguments> phase_args;
+    Status status = make_phase_arguments(args, phase_args);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    phase_params_.clear();
+    uint8_t* phase_workspace = static_cast<uint8_t*>(workspace);
+    for (auto const& sub_args : phase_args) {
+      size_t phase_workspace_bytes = aligned_workspace_size(sub_args);
+      void* sub_workspace = phase_workspace_bytes > 0 ? phase_workspace : nullptr;
+      if (phase_workspace_bytes > 0 && sub_workspace == nullptr) {
+        return Status::kErrorWorkspaceNull;
+      }
+      status = ConvKernel::initialize_workspace(sub_args, sub_workspace, stream, cuda_adapter);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+      phase_params_.push_back(ConvKernel::to_underlying_arguments(sub_args, sub_workspace));
+      if (phase_workspace != nullptr) {
+        phase_workspace += phase_workspace_bytes;
+      }
+    }
+
+    // Don't set the function attributes - require the CudaHostAdapter to set it.
+    if constexpr (kEnableCudaHostAdapter) {
+      CUTLASS_ASSERT(cuda_adapter);
+      return Status::kSuccess;
+    }
+    else {
+      // account for dynamic smem capacity if needed
+      int smem_size = ConvKernel::SharedStorageSize;
+      if (smem_size >= (48 << 10)) {
+        CUTLASS_TRACE_HOST("  Setting smem size to " << smem_size);
+        cudaError_t result = cudaFuncSetAttribute(
+            device_kernel<ConvKernel>,
+            cudaFuncAttributeMaxDynamicSharedMemorySize,
+            smem_size);
+        if (cudaSuccess != result) {
+          result = cudaGetLastError(); // to clear the error bit
+          CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error: " << cudaGetErrorString(result));
+          return Status::kErrorInternal;
+        }
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  /// Launches every phase of the previously initialized problem.
+  Status
+  run(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr, int32_t kernel_index = 0) {
+    CUTLASS_TRACE_HOST("ConvUniversalStridedDgrad::run() - " << phase_params_.size() << " phases");
+    if (phase_params_.empty()) {
+      return Status::kErrorNotSupported;
+    }
+    for (auto& params : phase_params_) {
+      Status status = UnderlyingAdapter::run(params, stream, cuda_adapter, kernel_index);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  /// Launches the phases after first constructing their Params from supplied arguments.
+  Status
+  run(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    int32_t kernel_index = 0
+  ) {
+    Status status = initialize(args, workspace, stream, cuda_adapter);
+    if (Status::kSuccess == status) {
+      status = run(stream, cuda_adapter, kernel_index);
+    }
+    return status;
+  }
+
+  /// Launches the phases after first constructing their Params from supplied arguments.
+  Status
+  operator()(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    return run(args, workspace, stream, cuda_adapter);
+  }
+
+  /// Overload that allows a user to re-launch the same phases without updating their params.
+  Status
+  operator()(cudaStream_t stream = nullptr) {
+    return run(stream);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::conv::device
+
+////////////////////////////////////////////////////////////////////////////////
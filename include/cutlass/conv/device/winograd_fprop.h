@@ -0,0 +1,313 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device-level Winograd F(m x m, 3 x 3) forward convolution.
+
+    WinogradFprop runs a 3x3, unit-stride NHWC forward convolution as a filter transform, an input
+    transform, alpha * alpha independent GEMMs, and an output transform (see
+    cutlass/conv/kernel/winograd_transform.h). The GEMMs are any CUTLASS 3.x GemmUniversalAdapter with
+    a rank-4 problem shape whose A operand is row-major (Tiles x C), whose B operand is column-major
+    (K x C), and whose D operand is row-major (Tiles x K); batch mode L indexes the transform point.
+    The transformed operands and the GEMM workspace live in the user-provided workspace.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/trace.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/kernel/winograd_transform.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace conv {
+namespace device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <
+  typename Gemm_,                     ///< 3.x GemmUniversalAdapter computing the batched GEMM
+  typename ElementOutput_,            ///< Element type of the NPQK source and output tensors
+  int OutputTile_ = 2,                ///< Output tile extent m of F(m x m, 3 x 3): 2 or 4
+  typename ElementCompute_ = float    ///< Element type of alpha and beta
+>
+class WinogradFprop {
+public:
+
+  using Gemm = Gemm_;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+
+  static int const kOutputTile = OutputTile_;
+  static_assert(kOutputTile == 2 || kOutputTile == 4, "Winograd fprop supports F(2x2, 3x3) and F(4x4, 3x3).");
+
+  /// Transformed activation V, filter U, and GEMM output M element types
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementTransformedOutput = typename Gemm::ElementD;
+
+  static_assert(cute::rank(typename GemmKernel::ProblemShape{}) == 4,
+    "Winograd fprop requires a batched (rank-4) GEMM problem shape.");
+  static_assert(cute::is_same_v<typename Gemm::LayoutA, cutlass::layout::RowMajor> &&
+                cute::is_same_v<typename Gemm::LayoutB, cutlass::layout::ColumnMajor> &&
+                cute::is_same_v<typename Gemm::LayoutD, cutlass::layout::RowMajor>,
+    "Winograd fprop requires a TN GEMM with a row-major D.");
+
+  using FilterTransform = kernel::WinogradFilterTransform<ElementB, ElementB, kOutputTile>;
+  using InputTransform = kernel::WinogradInputTransform<ElementA, ElementA, kOutputTile>;
+  using OutputTransform = kernel::WinogradOutputTransform<
+    ElementTransformedOutput, ElementOutput, ElementCompute, kOutputTile>;
+  using Tiling = kernel::WinogradTiling<kOutputTile>;
+
+  static int const kAlpha = kernel::WinogradMatrices<kOutputTile>::kAlpha;
+  static int const kTransformPoints = kAlpha * kAlpha;
+
+  static constexpr conv::Operator kConvolutionalOperator = conv::Operator::kFprop;
+
+  /// Argument structure
+  struct Arguments {
+    Conv2dProblemSize problem_size;
+    ElementA const *ptr_A = nullptr;      ///< NHWC activation
+    ElementB const *ptr_B = nullptr;      ///< KRSC filter
+    ElementOutput const *ptr_C = nullptr; ///< NPQK source, may be null when beta == 0
+    ElementOutput *ptr_D = nullptr;       ///< NPQK output
+    ElementCompute alpha = ElementCompute(1);
+    ElementCompute beta = ElementCompute(0);
+    KernelHardwareInfo hw_info{};
+  };
+
+private:
+
+  static constexpr size_t kWorkspaceAlignment = 256;
+
+  typename FilterTransform::Params filter_params_;
+  typename InputTransform::Params input_params_;
+  typename OutputTransform::Params output_params_;
+  typename Gemm::Arguments gemm_args_;
+  Gemm gemm_op_;
+  void *gemm_workspace_ = nullptr;
+
+  static size_t align_up(size_t bytes) {
+    return (bytes + kWorkspaceAlignment - 1) / kWorkspaceAlignment * kWorkspaceAlignment;
+  }
+
+  static size_t transformed_activation_bytes(Arguments const &args) {
+    return align_up(size_t(kTransformPoints) * size_t(Tiling::tile_count(args.problem_size)) *
+      size_t(args.problem_size.C) * sizeof(ElementA));
+  }
+
+  static size_t transformed_filter_bytes(Arguments const &args) {
+    return align_up(size_t(kTransformPoints) * size_t(args.problem_size.K) *
+      size_t(args.problem_size.C) * sizeof(ElementB));
+  }
+
+  static size_t transformed_output_bytes(Arguments const &args) {
+    return align_up(size_t(kTransformPoints) * size_t(Tiling::tile_count(args.problem_size)) *
+      size_t(args.problem_size.K) * sizeof(ElementTransformedOutput));
+  }
+
+  /// Batched GEMM: M[xi](Tiles, K) = V[xi](Tiles, C) * U[xi](K, C)^T for every transform point xi
+  static typename Gemm::Arguments make_gemm_arguments(
+      Arguments const &args,
+      ElementA const *ptr_V,
+      ElementB const *ptr_U,
+      ElementTransformedOutput *ptr_M) {
+
+    int tiles = Tiling::tile_count(args.problem_size);
+    int K = args.problem_size.K;
+    int C = args.problem_size.C;
+
+    typename Gemm::Arguments gemm_args{};
+    gemm_args.mode = cutlass::gemm::GemmUniversalMode::kGemm;
+    gemm_args.problem_shape = {tiles, K, C, kTransformPoints};
+    gemm_args.mainloop.ptr_A = ptr_V;
+    gemm_args.mainloop.dA = cutlass::make_cute_packed_stride(
+      typename GemmKernel::StrideA{}, cute::make_shape(tiles, C, kTransformPoints));
+    gemm_args.mainloop.ptr_B = ptr_U;
+    gemm_args.mainloop.dB = cutlass::make_cute_packed_stride(
+      typename GemmKernel::StrideB{}, cute::make_shape(K, C, kTransformPoints));
+    gemm_args.epilogue.thread.alpha = 1;
+    gemm_args.epilogue.thread.beta = 0;
+    gemm_args.epilogue.ptr_C = ptr_M;
+    gemm_args.epilogue.dC = cutlass::make_cute_packed_stride(
+      typename GemmKernel::StrideC{}, cute::make_shape(tiles, K, kTransformPoints));
+    gemm_args.epilogue.ptr_D = ptr_M;
+    gemm_args.epilogue.dD = cutlass::make_cute_packed_stride(
+      typename GemmKernel::StrideD{}, cute::make_shape(tiles, K, kTransformPoints));
+    gemm_args.hw_info = args.hw_info;
+    return gemm_args;
+  }
+
+  template <typename Operator>
+  static Status launch_transform(typename Operator::Params const &params, int64_t thread_count, cudaStream_t stream) {
+    dim3 block(Operator::kThreadCount, 1, 1);
+    dim3 grid(unsigned((thread_count + Operator::kThreadCount - 1) / Operator::kThreadCount), 1, 1);
+
+    cutlass::Kernel<Operator><<<grid, block, 0, stream>>>(params);
+
+    cudaError_t result = cudaGetLastError();
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  Winograd transform launch failed. Reason: " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+  }
+
+public:
+
+  /// Determines whether the Winograd pipeline can execute the given problem.
+  static Status can_implement(Arguments const &args) {
+
+    Conv2dProblemSize const &ps = args.problem_size;
+
+    if (ps.R != 3 || ps.S != 3) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (ps.stride_h != 1 || ps.stride_w != 1 || ps.dilation_h != 1 || ps.dilation_w != 1) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    if (ps.groups != 1 || ps.mode != Mode::kCrossCorrelation) {
+      return Status::kErrorNotSupported;
+    }
+
+    if (ps.P != ps.H + 2 * ps.pad_h - 2 || ps.Q != ps.W + 2 * ps.pad_w - 2) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    // Alignment and tile constraints of the batched GEMM itself
+    return Gemm::can_implement(make_gemm_arguments(args, nullptr, nullptr, nullptr));
+  }
+
+  /// Gets the workspace size: the transformed activation, filter, and output, plus the GEMM workspace
+  static size_t get_workspace_size(Arguments const &args) {
+    return transformed_activation_bytes(args) +
+           transformed_filter_bytes(args) +
+           transformed_output_bytes(args) +
+           Gemm::get_workspace_size(make_gemm_arguments(args, nullptr, nullptr, nullptr));
+  }
+
+  /// Initializes the transform and GEMM state from arguments.
+  Status initialize(Arguments const &args, void *workspace = nullptr, cudaStream_t stream = nullptr) {
+
+    CUTLASS_TRACE_HOST("WinogradFprop::initialize() - workspace " << workspace);
+
+    if (!workspace) {
+      return Status::kErrorWorkspaceNull;
+    }
+
+    uint8_t *workspace_ptr = static_cast<uint8_t *>(workspace);
+    ElementA *ptr_V = reinterpret_cast<ElementA *>(workspace_ptr);
+    workspace_ptr += transformed_activation_bytes(args);
+    ElementB *ptr_U = reinterpret_cast<ElementB *>(workspace_ptr);
+    workspace_ptr += transformed_filter_bytes(args);
+    ElementTransformedOutput *ptr_M = reinterpret_cast<ElementTransformedOutput *>(workspace_ptr);
+    workspace_ptr += transformed_output_bytes(args);
+    gemm_workspace_ = workspace_ptr;
+
+    filter_params_.ptr_filter = args.ptr_B;
+    filter_params_.ptr_U = ptr_U;
+    filter_params_.K = args.problem_size.K;
+    filter_params_.C = args.problem_size.C;
+
+    input_params_.problem_size = args.problem_size;
+    input_params_.ptr_activation = args.ptr_A;
+    input_params_.ptr_V = ptr_V;
+
+    output_params_.problem_size = args.problem_size;
+    output_params_.ptr_M = ptr_M;
+    output_params_.ptr_C = args.ptr_C;
+    output_params_.ptr_D = args.ptr_D;
+    output_params_.alpha = args.alpha;
+    output_params_.beta = args.beta;
+
+    gemm_args_ = make_gemm_arguments(args, ptr_V, ptr_U, ptr_M);
+    return gemm_op_.initialize(gemm_args_, gemm_workspace_, stream);
+  }
+
+  /// Runs the filter transform, input transform, batched GEMM, and output transform in stream order.
+  Status run(cudaStream_t stream = nullptr) {
+
+    Conv2dProblemSize const &ps = input_params_.problem_size;
+    int64_t tiles = Tiling::tile_count(ps);
+
+    Status status = launch_transform<FilterTransform>(filter_params_, int64_t(ps.K) * ps.C, stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    status = launch_transform<InputTransform>(input_params_, tiles * ps.C, stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    status = gemm_op_.run(stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    return launch_transform<OutputTransform>(output_params_, tiles * ps.K, stream);
+  }
+
+  /// Runs the kernels using initialized state.
+  Status operator()(cudaStream_t stream = nullptr) {
+    return run(stream);
+  }
+
+  /// Initializes and runs the kernels.
+  Status operator()(Arguments const &args, void *workspace = nullptr, cudaStream_t stream = nullptr) {
+
+    Status status = initialize(args, workspace, stream);
+
+    if (status == Status::kSuccess) {
+      status = run(stream);
+    }
+
+    return status;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace device
+} // namespace conv
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
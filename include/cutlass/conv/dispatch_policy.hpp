@@ -51,8 +51,17 @@ namespace cutlass::conv {
 // Policies for categorical dispatch of mainloop against kernel grid schedules
 //
 struct KernelImplicitTmaWarpSpecializedSm90 : cutlass::gemm::KernelTmaWarpSpecialized { };
-struct KernelImplicitTmaWarpSpecializedSm90Cooperative { };
-struct KernelImplicitTmaWarpSpecializedSm90Pingpong { };
+// Persistent schedules reuse the persistent GEMM kernels, so they support the persistent and stream-K tile schedulers
+struct KernelImplicitTmaWarpSpecializedSm90Cooperative : cutlass::gemm::KernelTmaWarpSpecializedCooperative { };
+struct KernelImplicitTmaWarpSpecializedSm90Pingpong : cutlass::gemm::KernelTmaWarpSpecializedPingpong { };
+
+// Fprop schedules that apply a per-channel scale, bias and ReLU to the activation tile in smem before it is
+// consumed by GMMA, mirroring the fused input transform of the 2.x ImplicitGemmFpropFusion kernels
+struct KernelScheduleSm90FpropScaleBiasRelu { };
+struct KernelImplicitTmaWarpSpecializedSm90FpropScaleBiasRelu :
+  KernelImplicitTmaWarpSpecializedSm90, KernelScheduleSm90FpropScaleBiasRelu { };
+struct KernelImplicitTmaWarpSpecializedSm90CooperativeFpropScaleBiasRelu :
+  KernelImplicitTmaWarpSpecializedSm90Cooperative, KernelScheduleSm90FpropScaleBiasRelu { };
 
 //
 // Collective Mainloop Policies
@@ -78,9 +87,8 @@ struct MainloopSm90TmaGmmaWarpSpecializedImplicitGemm {
   using Schedule = KernelSchedule;
 
   static_assert(NumSpatialDimensions >= 1);
-  static_assert(! (cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Cooperative> ||
-                   cute::is_same_v<KernelSchedule,KernelImplicitTmaWarpSpecializedSm90Pingpong>),
-    "Persistent schedules not support for conv yet.");
+  static_assert(!cute::is_base_of_v<KernelScheduleSm90FpropScaleBiasRelu, KernelSchedule> || ConvOp == Operator::kFprop,
+      "The fused scale-bias-ReLU input transform is only supported for fprop.");
 };
 
 
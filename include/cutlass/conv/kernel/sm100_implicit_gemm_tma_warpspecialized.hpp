@@ -620,6 +620,9 @@ public:
           ++clc_pipe_consumer_state;
         }
       } while (work_tile_info.is_valid());
+      // Release dependent grids here if requested, the last mainloop load has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
       collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
     }
@@ -713,7 +716,7 @@ public:
       // Hint on an early release of global memory resources.
       // The timing of calling this function only influences performance,
       // not functional correctness.
-      cutlass::arch::launch_dependent_grids();
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
       // Release the right to allocate before deallocations so that the next CTA can rasterize
       tmem_allocator.release_allocation_lock();
@@ -855,6 +858,9 @@ public:
         cta_coord_mnkl = scheduler.work_tile_to_cta_coord(work_tile_info);
       } while (work_tile_info.is_valid());
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       // Only perform a tail store if one of the work units processed performed
       // an epilogue. An example of a case in which a tail load should not be
       // performed is in split-K if a cluster is only assigned non-final splits (for which
@@ -0,0 +1,459 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Winograd F(m x m, 3 x 3) filter, input, and output transform kernels.
+
+    A Winograd forward convolution is computed as three element-wise transforms surrounding
+    alpha * alpha independent GEMMs, alpha = m + 2:
+
+      U[xi](K, C)     = G g G^T       (filter transform, KRSC filter)
+      V[xi](Tiles, C) = B^T d B       (input transform, NHWC activation)
+      M[xi](Tiles, K) = V[xi] U[xi]^T (batched GEMM, L = alpha * alpha)
+      Y               = A^T m A       (output transform, NPQK output)
+
+    Each output tile covers m x m output pixels and reads an overlapping alpha x alpha input patch.
+    The kernels here are launched through cutlass::Kernel<> by cutlass::conv::device::WinogradFprop.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace conv {
+namespace kernel {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Transform matrices of Winograd F(OutputTile x OutputTile, 3 x 3)
+template <int OutputTile>
+struct WinogradMatrices;
+
+/// F(2x2, 3x3): exact for integer-valued data
+template <>
+struct WinogradMatrices<2> {
+  static int const kOutputTile = 2;
+  static int const kAlpha = 4;
+
+  CUTLASS_HOST_DEVICE
+  static float BT(int i, int j) {
+    float const m[4][4] = {
+      {1.f,  0.f, -1.f,  0.f},
+      {0.f,  1.f,  1.f,  0.f},
+      {0.f, -1.f,  1.f,  0.f},
+      {0.f,  1.f,  0.f, -1.f}
+    };
+    return m[i][j];
+  }
+
+  CUTLASS_HOST_DEVICE
+  static float G(int i, int j) {
+    float const m[4][3] = {
+      {1.0f,  0.0f, 0.0f},
+      {0.5f,  0.5f, 0.5f},
+      {0.5f, -0.5f, 0.5f},
+      {0.0f,  0.0f, 1.0f}
+    };
+    return m[i][j];
+  }
+
+  CUTLASS_HOST_DEVICE
+  static float AT(int i, int j) {
+    float const m[2][4] = {
+      {1.f, 1.f,  1.f,  0.f},
+      {0.f, 1.f, -1.f, -1.f}
+    };
+    return m[i][j];
+  }
+};
+
+/// F(4x4, 3x3): fewer multiplies per output, but the filter transform is not exact in fp16/bf16
+template <>
+struct WinogradMatrices<4> {
+  static int const kOutputTile = 4;
+  static int const kAlpha = 6;
+
+  CUTLASS_HOST_DEVICE
+  static float BT(int i, int j) {
+    float const m[6][6] = {
+      {4.f,  0.f, -5.f,  0.f, 1.f, 0.f},
+      {0.f, -4.f, -4.f,  1.f, 1.f, 0.f},
+      {0.f,  4.f, -4.f, -1.f, 1.f, 0.f},
+      {0.f, -2.f, -1.f,  2.f, 1.f, 0.f},
+      {0.f,  2.f, -1.f, -2.f, 1.f, 0.f},
+      {0.f,  4.f,  0.f, -5.f, 0.f, 1.f}
+    };
+    return m[i][j];
+  }
+
+  CUTLASS_HOST_DEVICE
+  static float G(int i, int j) {
+    float const m[6][3] = {
+      { 1.f / 4.f,          0.f,        0.f},
+      {-1.f / 6.f,  -1.f /  6.f, -1.f / 6.f},
+      {-1.f / 6.f,   1.f /  6.f, -1.f / 6.f},
+      { 1.f / 24.f,  1.f / 12.f,  1.f / 6.f},
+      { 1.f / 24.f, -1.f / 12.f,  1.f / 6.f},
+      {        0.f,          0.f,        1.f}
+    };
+    return m[i][j];
+  }
+
+  CUTLASS_HOST_DEVICE
+  static float AT(int i, int j) {
+    float const m[4][6] = {
+      {1.f, 1.f,  1.f, 1.f,  1.f, 0.f},
+      {0.f, 1.f, -1.f, 2.f, -2.f, 0.f},
+      {0.f, 1.f,  1.f, 4.f,  4.f, 0.f},
+      {0.f, 1.f, -1.f, 8.f, -8.f, 1.f}
+    };
+    return m[i][j];
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Tiling of the output tensor into OutputTile x OutputTile Winograd tiles
+template <int OutputTile>
+struct WinogradTiling {
+
+  CUTLASS_HOST_DEVICE
+  static int tiles_h(Conv2dProblemSize const &problem_size) {
+    return (problem_size.P + OutputTile - 1) / OutputTile;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static int tiles_w(Conv2dProblemSize const &problem_size) {
+    return (problem_size.Q + OutputTile - 1) / OutputTile;
+  }
+
+  /// Number of tiles, i.e. the M extent of each of the alpha * alpha GEMMs
+  CUTLASS_HOST_DEVICE
+  static int tile_count(Conv2dProblemSize const &problem_size) {
+    return problem_size.N * tiles_h(problem_size) * tiles_w(problem_size);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Filter transform: U[xi](k, c) = (G g G^T)[xi], one thread per (k, c)
+template <
+  typename ElementFilter_,          ///< Element type of the KRSC filter
+  typename ElementTransformed_,     ///< Element type of U, the B operand of the batched GEMM
+  int OutputTile
+>
+struct WinogradFilterTransform {
+
+  using ElementFilter = ElementFilter_;
+  using ElementTransformed = ElementTransformed_;
+  using Matrices = WinogradMatrices<OutputTile>;
+
+  static int const kAlpha = Matrices::kAlpha;
+  static int const kThreadCount = 256;
+
+  struct Params {
+    ElementFilter const *ptr_filter = nullptr;
+    ElementTransformed *ptr_U = nullptr;
+    int K = 0;
+    int C = 0;
+  };
+
+  struct SharedStorage { };
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &) {
+
+    int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= int64_t(params.K) * params.C) {
+      return;
+    }
+
+    int k = int(idx / params.C);
+    int c = int(idx % params.C);
+
+    NumericConverter<float, ElementFilter> to_float;
+    NumericConverter<ElementTransformed, float> to_transformed;
+
+    float g[3][3];
+    CUTLASS_PRAGMA_UNROLL
+    for (int r = 0; r < 3; ++r) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int s = 0; s < 3; ++s) {
+        g[r][s] = to_float(params.ptr_filter[(int64_t(k) * 9 + r * 3 + s) * params.C + c]);
+      }
+    }
+
+    // Gg
+    float t[kAlpha][3];
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kAlpha; ++i) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int s = 0; s < 3; ++s) {
+        t[i][s] = 0.f;
+        CUTLASS_PRAGMA_UNROLL
+        for (int r = 0; r < 3; ++r) {
+          t[i][s] += Matrices::G(i, r) * g[r][s];
+        }
+      }
+    }
+
+    // (Gg)G^T
+    int64_t xi_stride = int64_t(params.K) * params.C;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kAlpha; ++i) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < kAlpha; ++j) {
+        float u = 0.f;
+        CUTLASS_PRAGMA_UNROLL
+        for (int s = 0; s < 3; ++s) {
+          u += t[i][s] * Matrices::G(j, s);
+        }
+        params.ptr_U[(i * kAlpha + j) * xi_stride + idx] = to_transformed(u);
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Input transform: V[xi](tile, c) = (B^T d B)[xi], one thread per (tile, c).
+/// Input pixels falling in the padding or beyond the activation extent are read as zero.
+template <
+  typename ElementActivation_,      ///< Element type of the NHWC activation
+  typename ElementTransformed_,     ///< Element type of V, the A operand of the batched GEMM
+  int OutputTile
+>
+struct WinogradInputTransform {
+
+  using ElementActivation = ElementActivation_;
+  using ElementTransformed = ElementTransformed_;
+  using Matrices = WinogradMatrices<OutputTile>;
+  using Tiling = WinogradTiling<OutputTile>;
+
+  static int const kAlpha = Matrices::kAlpha;
+  static int const kThreadCount = 256;
+
+  struct Params {
+    Conv2dProblemSize problem_size;
+    ElementActivation const *ptr_activation = nullptr;
+    ElementTransformed *ptr_V = nullptr;
+  };
+
+  struct SharedStorage { };
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &) {
+
+    Conv2dProblemSize const &ps = params.problem_size;
+
+    int tiles_h = Tiling::tiles_h(ps);
+    int tiles_w = Tiling::tiles_w(ps);
+    int64_t tile_count = int64_t(ps.N) * tiles_h * tiles_w;
+
+    int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= tile_count * ps.C) {
+      return;
+    }
+
+    int64_t tile = idx / ps.C;
+    int c = int(idx % ps.C);
+    int tw = int(tile % tiles_w);
+    int th = int((tile / tiles_w) % tiles_h);
+    int n = int(tile / (int64_t(tiles_w) * tiles_h));
+
+    int h0 = th * OutputTile - ps.pad_h;
+    int w0 = tw * OutputTile - ps.pad_w;
+
+    NumericConverter<float, ElementActivation> to_float;
+    NumericConverter<ElementTransformed, float> to_transformed;
+
+    float d[kAlpha][kAlpha];
+    CUTLASS_PRAGMA_UNROLL
+    for (int a = 0; a < kAlpha; ++a) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int b = 0; b < kAlpha; ++b) {
+        int h = h0 + a;
+        int w = w0 + b;
+        bool guard = h >= 0 && h < ps.H && w >= 0 && w < ps.W;
+        d[a][b] = guard ?
+          to_float(params.ptr_activation[((int64_t(n) * ps.H + h) * ps.W + w) * ps.C + c]) : 0.f;
+      }
+    }
+
+    // B^T d
+    float t[kAlpha][kAlpha];
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kAlpha; ++i) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int b = 0; b < kAlpha; ++b) {
+        t[i][b] = 0.f;
+        CUTLASS_PRAGMA_UNROLL
+        for (int a = 0; a < kAlpha; ++a) {
+          t[i][b] += Matrices::BT(i, a) * d[a][b];
+        }
+      }
+    }
+
+    // (B^T d)B
+    int64_t xi_stride = tile_count * ps.C;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < kAlpha; ++i) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < kAlpha; ++j) {
+        float v = 0.f;
+        CUTLASS_PRAGMA_UNROLL
+        for (int b = 0; b < kAlpha; ++b) {
+          v += t[i][b] * Matrices::BT(j, b);
+        }
+        params.ptr_V[(i * kAlpha + j) * xi_stride + idx] = to_transformed(v);
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Output transform: D = alpha * (A^T m A) + beta * C, one thread per (tile, k).
+/// Output pixels of partial tiles beyond the P x Q extent are not written.
+template <
+  typename ElementTransformed_,     ///< Element type of M, the D operand of the batched GEMM
+  typename ElementOutput_,          ///< Element type of the NPQK source and output
+  typename ElementCompute_,         ///< Element type of alpha and beta
+  int OutputTile
+>
+struct WinogradOutputTransform {
+
+  using ElementTransformed = ElementTransformed_;
+  using ElementOutput = ElementOutput_;
+  using ElementCompute = ElementCompute_;
+  using Matrices = WinogradMatrices<OutputTile>;
+  using Tiling = WinogradTiling<OutputTile>;
+
+  static int const kAlpha = Matrices::kAlpha;
+  static int const kThreadCount = 256;
+
+  struct Params {
+    Conv2dProblemSize problem_size;
+    ElementTransformed const *ptr_M = nullptr;
+    ElementOutput const *ptr_C = nullptr;
+    ElementOutput *ptr_D = nullptr;
+    ElementCompute alpha = ElementCompute(1);
+    ElementCompute beta = ElementCompute(0);
+  };
+
+  struct SharedStorage { };
+
+  CUTLASS_DEVICE
+  void operator()(Params const &params, SharedStorage &) {
+
+    Conv2dProblemSize const &ps = params.problem_size;
+
+    int tiles_h = Tiling::tiles_h(ps);
+    int tiles_w = Tiling::tiles_w(ps);
+    int64_t tile_count = int64_t(ps.N) * tiles_h * tiles_w;
+
+    int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+    if (idx >= tile_count * ps.K) {
+      return;
+    }
+
+    int64_t tile = idx / ps.K;
+    int k = int(idx % ps.K);
+    int tw = int(tile % tiles_w);
+    int th = int((tile / tiles_w) % tiles_h);
+    int n = int(tile / (int64_t(tiles_w) * tiles_h));
+
+    NumericConverter<float, ElementTransformed> to_float;
+    NumericConverter<ElementCompute, float> to_compute;
+    NumericConverter<ElementCompute, ElementOutput> source_to_compute;
+    NumericConverter<ElementOutput, ElementCompute> to_output;
+
+    float m[kAlpha][kAlpha];
+    int64_t xi_stride = tile_count * ps.K;
+    CUTLASS_PRAGMA_UNROLL
+    for (int a = 0; a < kAlpha; ++a) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int b = 0; b < kAlpha; ++b) {
+        m[a][b] = to_float(params.ptr_M[(a * kAlpha + b) * xi_stride + idx]);
+      }
+    }
+
+    // A^T m
+    float t[OutputTile][kAlpha];
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < OutputTile; ++i) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int b = 0; b < kAlpha; ++b) {
+        t[i][b] = 0.f;
+        CUTLASS_PRAGMA_UNROLL
+        for (int a = 0; a < kAlpha; ++a) {
+          t[i][b] += Matrices::AT(i, a) * m[a][b];
+        }
+      }
+    }
+
+    // (A^T m)A
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < OutputTile; ++i) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < OutputTile; ++j) {
+        int p = th * OutputTile + i;
+        int q = tw * OutputTile + j;
+        if (p < ps.P && q < ps.Q) {
+          float y = 0.f;
+          CUTLASS_PRAGMA_UNROLL
+          for (int b = 0; b < kAlpha; ++b) {
+            y += t[i][b] * Matrices::AT(j, b);
+          }
+
+          int64_t offset = ((int64_t(n) * ps.P + p) * ps.Q + q) * ps.K + k;
+          ElementCompute result = params.alpha * to_compute(y);
+          if (params.ptr_C != nullptr && params.beta != ElementCompute(0)) {
+            result += params.beta * source_to_compute(params.ptr_C[offset]);
+          }
+          params.ptr_D[offset] = to_output(result);
+        }
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace kernel
+} // namespace conv
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
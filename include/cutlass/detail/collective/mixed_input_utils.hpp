@@ -493,8 +493,21 @@ namespace cutlass {
     enum class ConversionMode {
       DirectConvert,              // A * B
       ConvertAndScale,            // (scale * A) * B
-      ConvertAndScaleWithZero     // (scale * A + zeros) * B
+      ConvertAndScaleWithZero,    // (scale * A + zeros) * B
+      ConvertWithLookupTable      // table[A] * B
     };
+
+    // A scale type of 16 16-bit values is a per-group lookup table indexed by 4-bit weights
+    // (e.g. NF4 or other non-uniform codebooks), selecting ConversionMode::ConvertWithLookupTable.
+    template <class T>
+    struct is_dequantization_lookup_table : cute::false_type {};
+
+    template <class T, bool RegisterSized>
+    struct is_dequantization_lookup_table<cutlass::Array<T, 16, RegisterSized>>
+      : cute::bool_constant<cute::sizeof_bits_v<T> == 16> {};
+
+    template <class T>
+    constexpr bool is_dequantization_lookup_table_v = is_dequantization_lookup_table<T>::value;
   } // namespace detail
 } //namespace cutlass
 
@@ -571,7 +584,8 @@ public:
   static constexpr auto
   elements_per_smem_zero() {
     if constexpr (KernelConversionMode == ConversionMode::DirectConvert ||
-                  KernelConversionMode == ConversionMode::ConvertAndScale ) {
+                  KernelConversionMode == ConversionMode::ConvertAndScale ||
+                  KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
       return 0;
     }
     else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -601,7 +615,8 @@ public:
     else if constexpr (ModeHasScales) {
       constexpr uint32_t scale_tx_bytes = cutlass::bits_to_bytes(size<0>(SmemLayoutScale{}) * size<1>(SmemLayoutScale{}) * static_cast<uint32_t>(cute::sizeof_bits_v<ElementScale>));
       static_assert(scale_tx_bytes % 128 == 0, "Each scale stage must be 128B aligned."); // required by TMA
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         return scale_tx_bytes;
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -627,7 +642,8 @@ public:
     else if constexpr (ModeHasScales) {
       constexpr uint32_t scale_tx_bytes = cutlass::bits_to_bytes(cosize(take<0,3>(SmemLayoutScale{})) * static_cast<uint32_t>(cute::sizeof_bits_v<ElementScale>));
       static_assert(scale_tx_bytes % 128 == 0, "Each scale stage must be 128B aligned."); // required by TMA
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         return scale_tx_bytes;
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -674,7 +690,8 @@ public:
         auto tCrS_copy_view    = cute::get<1>(tiled_copy_and_views);
         auto tCsS              = cute::get<0>(partitioned_mma_extra_info);
         copy(smem_tiled_copy_S, tCsS(_,_,k_block,read_stage), tCrS_copy_view(_,_,k_block));
-        if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+        if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                      KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
           // Nothing extra to do
         } else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
           auto tCsZ              = cute::get<2>(partitioned_mma_extra_info);
@@ -701,6 +718,20 @@ public:
     if constexpr (KernelConversionMode == ConversionMode::DirectConvert) {
       // nothing to do
     }
+    else if constexpr (KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
+      // Only load each distinct table once and keep it as byte planes for the lookups
+      auto&& tables          = cute::get<1>(partitioned_transform_extra_info);
+      auto tSrT              = filter_zeros(make_tensor(tables.data(), tables.layout()));
+      auto tSsT              = filter_zeros(cute::get<2>(partitioned_transform_extra_info)(_,_,_,_,load2transform_consumer_index));
+      copy(tSsT, tSrT);
+
+      Tensor tSrT_ = filter(tSrT);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tSrT_); ++i) {
+        auto&& table = reinterpret_cast<cutlass::Array<uint32_t, 8>&>(tSrT_(i));
+        table = lookup_table_to_planes(table);
+      }
+    }
     else if constexpr (ModeHasScales) {
       auto smem_tiled_copy_S = cute::get<0>(partitioned_transform_extra_info);
       auto&& scales          = cute::get<1>(partitioned_transform_extra_info);
@@ -811,6 +842,124 @@ public:
     }
   }
 
+  // Rearranges a lookup table of 16 16-bit entries, two per register, into byte planes: registers 0-3
+  // hold the low bytes and registers 4-7 the high bytes of entries 0-3, 4-7, 8-11 and 12-15.
+  CUTLASS_DEVICE
+  static cutlass::Array<uint32_t, 8>
+  lookup_table_to_planes(cutlass::Array<uint32_t, 8> const table) {
+    cutlass::Array<uint32_t, 8> planes;
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < 4; ++i) {
+      asm volatile(
+        "{\n"
+        "  prmt .b32 %0, %2, %3, 0x6420;\n" \
+        "  prmt .b32 %1, %2, %3, 0x7531;\n" \
+        "}\n"
+        : "=r"(planes[i]), "=r"(planes[i + 4])
+        : "r"(table[2 * i]), "r"(table[2 * i + 1])
+      );
+    }
+    return planes;
+  }
+
+  // Looks up the four 4-bit indices in the low 16 bits of idx in a table of byte planes. The 16-bit
+  // results are returned as pairs, values 0 and 1 in lo_pair and values 2 and 3 in hi_pair.
+  CUTLASS_DEVICE
+  static void
+  lookup_table_x4(
+    uint32_t const idx,
+    cutlass::Array<uint32_t, 8> const& planes,
+    uint32_t& lo_pair,
+    uint32_t& hi_pair) {
+
+    // The low 3 bits select a byte within entries 0-7 or 8-15, the 4th bit selects between them
+    uint32_t const sel = idx & 0x7777;
+    uint32_t const sel_half = ((idx & 0x8888) >> 1) | 0x3210;
+    asm volatile(
+      "{\n"
+      "  .reg .b32 lo0, lo1, hi0, hi1, lo, hi    ;\n" \
+      "  prmt .b32 lo0, %2, %3, %10              ;\n" \
+      "  prmt .b32 lo1, %4, %5, %10              ;\n" \
+      "  prmt .b32 hi0, %6, %7, %10              ;\n" \
+      "  prmt .b32 hi1, %8, %9, %10              ;\n" \
+      "  prmt .b32 lo, lo0, lo1, %11             ;\n" \
+      "  prmt .b32 hi, hi0, hi1, %11             ;\n" \
+      "  prmt .b32 %0, lo, hi, 0x5140            ;\n" \
+      "  prmt .b32 %1, lo, hi, 0x7362            ;\n" \
+      "}\n"
+      : "=r"(lo_pair), "=r"(hi_pair)
+      : "r"(planes[0]), "r"(planes[1]), "r"(planes[2]), "r"(planes[3]),
+        "r"(planes[4]), "r"(planes[5]), "r"(planes[6]), "r"(planes[7]),
+        "r"(sel), "r"(sel_half)
+    );
+  }
+
+  // Converts 8 4-bit weights to 16-bit values with the per-group lookup tables of the weights, given
+  // as byte planes. Either weights 0-3 and 4-7 must share a table, or weights 0, 1, 4, 5 and 2, 3,
+  // 6, 7 must share a table, as is the case for the GMMA register fragment of A.
+  template <class EngineIn,
+            class LayoutIn,
+            class EngineOut,
+            class LayoutOut,
+            class EngineTable,
+            class LayoutTable>
+  CUTLASS_DEVICE
+  static void lookup_table_dequantize( // Accept mutable temporaries
+    Tensor<EngineIn, LayoutIn>       const& src,
+    Tensor<EngineOut, LayoutOut>         && dst,
+    Tensor<EngineTable, LayoutTable> const& planes) {
+
+    lookup_table_dequantize(src, dst, planes);
+  }
+  template <class EngineIn,
+            class LayoutIn,
+            class EngineOut,
+            class LayoutOut,
+            class EngineTable,
+            class LayoutTable>
+  CUTLASS_DEVICE
+  static void lookup_table_dequantize(
+    Tensor<EngineIn, LayoutIn>       const& src,
+    Tensor<EngineOut, LayoutOut>          & dst,
+    Tensor<EngineTable, LayoutTable> const& planes) {
+
+    static_assert(cute::cosize_v<LayoutIn> == 8 && cute::size_v<LayoutOut> == 8,
+                  "Lookup table conversion requires 8 contiguous weights.");
+    static_assert(cute::is_static_v<LayoutTable>, "The table layout must be static.");
+    constexpr auto table = [](int i) { return LayoutTable{}(i); };
+    constexpr bool SharedQuads = table(0) == table(1) && table(0) == table(2) && table(0) == table(3) &&
+                                 table(4) == table(5) && table(4) == table(6) && table(4) == table(7);
+    constexpr bool SharedPairs = table(0) == table(1) && table(0) == table(4) && table(0) == table(5) &&
+                                 table(2) == table(3) && table(2) == table(6) && table(2) == table(7);
+    static_assert(SharedQuads || SharedPairs, "Adjacent weights in a thread must share the same lookup table.");
+
+    using RegArray = cutlass::AlignedArray<uint32_t, 4, 16>;
+    auto&& src_reg = cute::recast<uint32_t>(src)(0);
+    auto&& r       = cute::recast<RegArray>(dst)(0);
+    auto&& planes0 = reinterpret_cast<cutlass::Array<uint32_t, 8> const&>(planes(0));
+
+    if constexpr (SharedQuads) {
+      auto&& planes1 = reinterpret_cast<cutlass::Array<uint32_t, 8> const&>(planes(4));
+      lookup_table_x4(src_reg, planes0, r[0], r[1]);
+      lookup_table_x4(src_reg >> 16, planes1, r[2], r[3]);
+    }
+    else {
+      auto&& planes1 = reinterpret_cast<cutlass::Array<uint32_t, 8> const&>(planes(2));
+      // Gather the indices of weights 0, 1, 4, 5 and 2, 3, 6, 7
+      uint32_t idx0, idx1;
+      asm volatile(
+        "{\n"
+        "  prmt .b32 %0, %2, %2, 0x0020;\n" \
+        "  prmt .b32 %1, %2, %2, 0x0031;\n" \
+        "}\n"
+        : "=r"(idx0), "=r"(idx1)
+        : "r"(src_reg)
+      );
+      lookup_table_x4(idx0, planes0, r[0], r[2]);
+      lookup_table_x4(idx1, planes1, r[1], r[3]);
+    }
+  }
+
   /// Utilities to dequantize A.
   template <class Layout>
   CUTLASS_DEVICE
@@ -860,6 +1009,34 @@ public:
         LayoutAwareConvert(src_vm(_, i), dst_vm(_, i));
       }
     }
+    else if constexpr (KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
+      static_assert(sizeof_bits_v<SrcType> == 4 && sizeof_bits_v<DstType> == 16,
+                    "Lookup tables convert 4-bit weights to 16-bit values.");
+      static_assert(is_same_v<typename ElementScale::Element, DstType>,
+                    "The lookup table entries must be of the MMA type.");
+      static_assert(NumValPerSrcReg == 8, "Lookup table conversion requires 8 contiguous weights per thread.");
+
+      Tensor tables = cute::get<1>(partitioned_extra_info)(_, _, k_block);
+      auto&& tCrT_planes = cute::get<2>(partitioned_extra_info); // modification to its value is needed
+      Tensor planes = tCrT_planes(_, _, k_block);
+      CUTE_STATIC_ASSERT_V(size(src) == size(tables));
+
+      if (k_block == 0) {
+        // The tables are loaded at the first k_block of a k_tile
+        Tensor tables_ = filter(tables);
+        Tensor planes_ = filter(planes);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tables_); ++i) {
+          reinterpret_cast<cutlass::Array<uint32_t, 8>&>(planes_(i)) =
+            lookup_table_to_planes(reinterpret_cast<cutlass::Array<uint32_t, 8> const&>(tables_(i)));
+        }
+      }
+      Tensor planes_vm = cute::group_modes<1,-1>(cute::zipped_divide(planes, Int<NumValPerSrcReg>{}));
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size<1>(dst_vm); ++i) {
+        lookup_table_dequantize(src_vm(_, i), dst_vm(_, i), planes_vm(_, i));
+      }
+    }
     else if constexpr (UseScaleLookupTable) {
       constexpr int num_elements = decltype(size(src))::value;
       static_assert(is_same_v<RealSwappedElementA, cutlass::int4b_t> || is_same_v<RealSwappedElementA, cutlass::float_e2m1_t>, 
@@ -1007,88 +1184,109 @@ public:
 
     auto src = tArA(_, _, _, k_block);
     auto dst = tArACompute(_, _, _, k_block);
-    constexpr int num_elements = decltype(size(src))::value;
 
-    constexpr int pack = decltype(select_packing<SrcType, DstType, num_elements>::value())::value;
-    using Converter = cutlass::NumericArrayConverter<DstType, SrcType, pack, cutlass::FloatRoundStyle::round_to_nearest>;
-    using SrcArray = cutlass::Array<SrcType, pack>;
-    using DstArray = cutlass::Array<DstType, pack>;
-    constexpr int DstElementsPerReg = 32 / sizeof_bits_v<DstType>;
-    using RegArray = cutlass::AlignedArray<uint32_t, pack / DstElementsPerReg, sizeof(DstArray)>;
+    if constexpr (KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
+      static_assert(sizeof_bits_v<SrcType> == 4 && sizeof_bits_v<DstType> == 16,
+                    "Lookup tables convert 4-bit weights to 16-bit values.");
+      static_assert(is_same_v<typename ElementScale::Element, DstType>,
+                    "The lookup table entries must be of the MMA type.");
+
+      // The tables were converted to byte planes when copied to registers
+      auto const& planes = cute::get<1>(partitioned_extra_info)(_,_,_,k_block);
+      CUTE_STATIC_ASSERT_V(size(src) == size(planes));
+
+      Tensor src_vm = cute::group_modes<1,-1>(cute::zipped_divide(src, Int<8>{}));
+      Tensor dst_vm = cute::group_modes<1,-1>(cute::zipped_divide(dst, Int<8>{}));
+      Tensor planes_vm = cute::group_modes<1,-1>(cute::zipped_divide(planes, Int<8>{}));
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size<1>(dst_vm); ++i) {
+        lookup_table_dequantize(src_vm(_, i), dst_vm(_, i), planes_vm(_, i));
+      }
+    }
+    else {
+      constexpr int num_elements = decltype(size(src))::value;
+
+      constexpr int pack = decltype(select_packing<SrcType, DstType, num_elements>::value())::value;
+      using Converter = cutlass::NumericArrayConverter<DstType, SrcType, pack, cutlass::FloatRoundStyle::round_to_nearest>;
+      using SrcArray = cutlass::Array<SrcType, pack>;
+      using DstArray = cutlass::Array<DstType, pack>;
+      constexpr int DstElementsPerReg = 32 / sizeof_bits_v<DstType>;
+      using RegArray = cutlass::AlignedArray<uint32_t, pack / DstElementsPerReg, sizeof(DstArray)>;
 
-    auto src_arr = recast<SrcArray>(src);
-    auto dst_arr = recast<DstArray>(dst);
+      auto src_arr = recast<SrcArray>(src);
+      auto dst_arr = recast<DstArray>(dst);
 
-    Tensor dst_vm = cute::group_modes<1,-1>(cute::zipped_divide(dst, pack));
+      Tensor dst_vm = cute::group_modes<1,-1>(cute::zipped_divide(dst, pack));
 
-    cute::transform(src_arr, dst_arr, Converter::convert);
+      cute::transform(src_arr, dst_arr, Converter::convert);
     
-    if constexpr (ModeHasScales) {
+      if constexpr (ModeHasScales) {
 
-      auto const& scales = cute::get<1>(partitioned_extra_info)(_,_,_,k_block);
+        auto const& scales = cute::get<1>(partitioned_extra_info)(_,_,_,k_block);
 
-      CUTE_STATIC_ASSERT_V(size(src) == size(scales));
+        CUTE_STATIC_ASSERT_V(size(src) == size(scales));
 
-      if constexpr (is_same_v<DstType, ElementScale>) {
+        if constexpr (is_same_v<DstType, ElementScale>) {
 
-        using ScaleArray = cutlass::Array<ElementScale, pack>;
-        auto scale_arr = recast<ScaleArray>(filter_zeros(scales));
+          using ScaleArray = cutlass::Array<ElementScale, pack>;
+          auto scale_arr = recast<ScaleArray>(filter_zeros(scales));
 
-        if constexpr (is_same_v<DstType, cutlass::bfloat16_t>){
-          Tensor scales_vm = cute::group_modes<1,-1>(cute::zipped_divide(scales, pack));
+          if constexpr (is_same_v<DstType, cutlass::bfloat16_t>){
+            Tensor scales_vm = cute::group_modes<1,-1>(cute::zipped_divide(scales, pack));
 
-          for (int i = 0; i < size<1>(dst_vm); ++i){
-            auto&& r       = cute::recast<RegArray>(dst_vm(_,i))(0);
-            auto&& scale_reg = cute::recast<RegArray>(scales_vm(_,i))(0);
-            CUTLASS_PRAGMA_UNROLL
-            for (size_t ii = 0; ii < RegArray::kElements; ++ii) {
-              __nv_bfloat162& bf16x2_val = reinterpret_cast<__nv_bfloat162&>(r[ii]);
-              bf16x2_val = __hmul2(bf16x2_val,
-                                  reinterpret_cast<const __nv_bfloat162&>(scale_reg[ii]));
+            for (int i = 0; i < size<1>(dst_vm); ++i){
+              auto&& r       = cute::recast<RegArray>(dst_vm(_,i))(0);
+              auto&& scale_reg = cute::recast<RegArray>(scales_vm(_,i))(0);
+              CUTLASS_PRAGMA_UNROLL
+              for (size_t ii = 0; ii < RegArray::kElements; ++ii) {
+                __nv_bfloat162& bf16x2_val = reinterpret_cast<__nv_bfloat162&>(r[ii]);
+                bf16x2_val = __hmul2(bf16x2_val,
+                                    reinterpret_cast<const __nv_bfloat162&>(scale_reg[ii]));
+              }
             }
           }
+          else{
+            cute::transform(dst_arr, scale_arr, dst_arr, cute::multiplies{});
+          }
         }
-        else{
-          cute::transform(dst_arr, scale_arr, dst_arr, cute::multiplies{});
+        if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+           // Do Nothing
         }
-      }
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
-         // Do Nothing
-      }
-      else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
-        static_assert(is_same_v<ElementScale, ElementZero>, "ElementScale and ElementZero must be the same.");
-
-        auto const& zeros = cute::get<3>(partitioned_extra_info)(_,_,_,k_block);
-        CUTE_STATIC_ASSERT_V(size(src) == size(zeros));
-
-        if constexpr (is_same_v<DstType, ElementZero>) {
-          using ZeroArray = cutlass::Array<ElementZero, pack>;
-          auto zero_arr = recast<ZeroArray>(filter_zeros(zeros));
-
-        if constexpr (is_same_v<DstType, cutlass::bfloat16_t>) {
-          Tensor zeros_vm = cute::group_modes<1,-1>(cute::zipped_divide(zeros, pack));
-
-          for (int i = 0; i < size<1>(dst_vm); ++i){
-            auto&& r       = cute::recast<RegArray>(dst_vm(_,i))(0);
-            auto&& zero_reg = cute::recast<RegArray>(zeros_vm(_,i))(0);
-            CUTLASS_PRAGMA_UNROLL
-            for (size_t ii = 0; ii < RegArray::kElements; ++ii) {
-              __nv_bfloat162& bf16x2_val = reinterpret_cast<__nv_bfloat162&>(r[ii]);
-              bf16x2_val = __hadd2(bf16x2_val,
-                                  reinterpret_cast<const __nv_bfloat162&>(zero_reg[ii]));
+        else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
+          static_assert(is_same_v<ElementScale, ElementZero>, "ElementScale and ElementZero must be the same.");
+
+          auto const& zeros = cute::get<3>(partitioned_extra_info)(_,_,_,k_block);
+          CUTE_STATIC_ASSERT_V(size(src) == size(zeros));
+
+          if constexpr (is_same_v<DstType, ElementZero>) {
+            using ZeroArray = cutlass::Array<ElementZero, pack>;
+            auto zero_arr = recast<ZeroArray>(filter_zeros(zeros));
+
+          if constexpr (is_same_v<DstType, cutlass::bfloat16_t>) {
+            Tensor zeros_vm = cute::group_modes<1,-1>(cute::zipped_divide(zeros, pack));
+
+            for (int i = 0; i < size<1>(dst_vm); ++i){
+              auto&& r       = cute::recast<RegArray>(dst_vm(_,i))(0);
+              auto&& zero_reg = cute::recast<RegArray>(zeros_vm(_,i))(0);
+              CUTLASS_PRAGMA_UNROLL
+              for (size_t ii = 0; ii < RegArray::kElements; ++ii) {
+                __nv_bfloat162& bf16x2_val = reinterpret_cast<__nv_bfloat162&>(r[ii]);
+                bf16x2_val = __hadd2(bf16x2_val,
+                                    reinterpret_cast<const __nv_bfloat162&>(zero_reg[ii]));
+              }
             }
           }
-        }
-        else{
-          cute::transform(dst_arr, zero_arr, dst_arr, cute::plus{});
+          else{
+            cute::transform(dst_arr, zero_arr, dst_arr, cute::plus{});
+           }
          }
        }
-     }
-     else {
-        static_assert(cutlass::detail::dependent_false<KernelSchedule>, "Conversion mode not handled for input partitioning.");
-     }
+       else {
+          static_assert(cutlass::detail::dependent_false<KernelSchedule>, "Conversion mode not handled for input partitioning.");
+       }
+    }
+    }
   }
-}
 
 
   /// Utilities for any additional inputs inside of the TMA load
@@ -1117,7 +1315,8 @@ public:
 
       Tensor tSgS = block_tma_s.partition_S(gS);
       Tensor tSsS = block_tma_s.partition_D(sS);                                              // (TMA,TMA_M,TMA_K,PIPE)
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         return cute::make_tuple(tSgS, tSsS);
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -1163,6 +1362,14 @@ public:
         return cute::make_tuple(tCsS, tCrS_neg, tCrS_pos);
       }
     }
+    else if constexpr (KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
+      Tensor sS = make_tensor(make_smem_ptr(shared_tensors.smem_scale.begin()), SmemLayoutScale{});// (BLK_M,BLK_SCALE_K,PIPE)
+      Tensor tCsS = mma_thread_slice.partition_A(sS);
+      Tensor tCrS = make_tensor<ElementScale>(mma_thread_slice.partition_fragment_A(sS(_,_,Int<0>{})).layout());
+      // Byte planes of the tables in tCrS
+      Tensor tCrP = make_tensor<ElementScale>(mma_thread_slice.partition_fragment_A(sS(_,_,Int<0>{})).layout());
+      return cute::make_tuple(tCsS, tCrS, tCrP);
+    }
     else if constexpr (ModeHasScales) {
       Tensor sS = make_tensor(make_smem_ptr(shared_tensors.smem_scale.begin()), SmemLayoutScale{});// (BLK_M,BLK_SCALE_K,PIPE)
       Tensor tCsS = mma_thread_slice.partition_A(sS);
@@ -1201,6 +1408,15 @@ public:
       // nothing to do
       return cute::make_tuple();
     }
+    else if constexpr (KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
+      auto smem_thr_copy_S = smem_tiled_copy_S.get_slice(threadIdx.x % 128);
+
+      Tensor sS = make_tensor(make_smem_ptr(shared_storage.input.smem_scale.begin()), SmemLayoutScale{}); // (BLK_M,BLK_SCALE_K,PIPE)
+      Tensor tSsS = smem_thr_copy_S.partition_S(sS);
+      // Keep the broadcasts of the tables so that each distinct table occupies registers once
+      Tensor tSrS = make_tensor<ElementScale>(make_layout_like(tSsS(_,_,_,_,0).layout()));
+      return cute::make_tuple(smem_tiled_copy_S, tSrS, tSsS);
+    }
     else if constexpr (ModeHasScales) {
       ThrMMA cta_mma = TiledMma{}.get_slice(blockIdx.x % size(typename TiledMma::AtomThrID{}));
       auto smem_thr_copy_S = smem_tiled_copy_S.get_slice(threadIdx.x % 128);
@@ -1244,7 +1460,8 @@ public:
       auto smem_thr_copy_S   = smem_tiled_copy_S.get_thread_slice(warp_group_thread_idx);
       Tensor tCrS_copy_view  = smem_thr_copy_S.retile_D(cute::get<1>(partitioned_extra_info));        // (CPY,CPY_M,CPY_K)
 
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         return cute::make_tuple(smem_tiled_copy_S, tCrS_copy_view);
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
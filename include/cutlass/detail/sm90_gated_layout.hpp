@@ -35,9 +35,28 @@
 #include "cutlass/detail/layout.hpp"
 
 /**
- * Convenience functions for computing input/output strides for sm90 gated activation kernel
+ * Shapes and strides for sm90 gated activation kernels, whose M mode is factored as (8,2,M/16):
+ * each group of 16 rows holds 8 rows of the up projection followed by 8 rows of the gate.
  */
 
+namespace cutlass::detail {
+
+template <int ModeIndex, class InputStride>
+using GatedStride = cute::conditional_t<
+  cutlass::detail::is_major<ModeIndex, InputStride>(),
+  decltype(replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,int64_t,cute::_8>{})),
+  decltype(replace<ModeIndex>(InputStride{}, cute::Stride< int64_t,int64_t, int64_t>{}))
+>;
+
+template <int ModeIndex, class InputStride>
+using GatedOutputStride = cute::conditional_t<
+  cutlass::detail::is_major<ModeIndex, InputStride>(),
+  decltype(replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,cute::_8>{})),
+  decltype(replace<ModeIndex>(InputStride{}, cute::Stride< int64_t, int64_t>{}))
+>;
+
+} // namespace cutlass::detail
+
 namespace cutlass {
 
 template <int ModeIndex, class InputShape>
@@ -1096,6 +1096,21 @@ sm100_cta_tile_shape() {
   }
 }
 
+// Smem ring depths requested by the schedule (e.g. TmaWarpSpecialized1SmStreaming), 0 selects the default
+template <class EpilogueScheduleType, class = void>
+struct sm100_epilogue_ring_depth {
+  static constexpr int StagesD = 0;
+  static constexpr int StagesC = 0;
+};
+
+template <class EpilogueScheduleType>
+struct sm100_epilogue_ring_depth<EpilogueScheduleType,
+    cute::void_t<decltype(EpilogueScheduleType::StagesD), decltype(EpilogueScheduleType::StagesC)>> {
+  static constexpr int StagesD = EpilogueScheduleType::StagesD;
+  static constexpr int StagesC = EpilogueScheduleType::StagesC;
+  static_assert(StagesD >= 1 && StagesC >= 1, "Epilogue ring depths must be >= 1");
+};
+
 template<
   class EpilogueScheduleType,
   class ElementC_,
@@ -1110,9 +1125,14 @@ sm100_dense_dispatch_policy() {
   // TMA store delay performs worse with residual loads
   constexpr bool DelayTmaStore = is_void_v<ElementC_>;
 
-  constexpr int StagesD = cute::min(EpiTiles, 2);
-  constexpr int StagesC = ReuseSmem ? cute::max(cute::min(EpiTiles, 4), StagesD+1)
-                                    : cute::min(EpiTiles, 4);
+  using RingDepth = sm100_epilogue_ring_depth<EpilogueScheduleType>;
+  constexpr int MaxStagesD = RingDepth::StagesD > 0 ? RingDepth::StagesD : 2;
+  constexpr int MaxStagesC = RingDepth::StagesC > 0 ? RingDepth::StagesC : 4;
+
+  constexpr int StagesD = cute::min(EpiTiles, MaxStagesD);
+  // Smem reuse needs a C buffer beyond the in-flight D stores, so it may exceed the requested depth by one
+  constexpr int StagesC = ReuseSmem ? cute::max(cute::min(EpiTiles, MaxStagesC), StagesD+1)
+                                    : cute::min(EpiTiles, MaxStagesC);
 
   if constexpr (is_base_of_v<PtrArrayNoSmemWarpSpecialized1Sm, EpilogueScheduleType> ||
                 is_base_of_v<PtrArrayNoSmemWarpSpecialized2Sm, EpilogueScheduleType>) {
@@ -46,6 +46,7 @@
 #include "cutlass/epilogue/fusion/sm100_callbacks_tma_warpspecialized.hpp"
 #include "cutlass/detail/layout.hpp"
 #include "cutlass/detail/collective/moe_stride_utils.hpp"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
 #include "cutlass/trace.h"
 
 #include "cute/tensor.hpp"
@@ -248,6 +249,10 @@ public:
     StrideC dC{};
     ElementD** ptr_D = nullptr;
     StrideD dD{};
+    // Contiguous C/D for all groups of an MoE problem shape with token offsets. Used in place of
+    // ptr_C/ptr_D when those are null, with each group starting at token_offset * M.
+    ElementC const* ptr_C_base = nullptr;
+    ElementD* ptr_D_base = nullptr;
   };
 
   // Device side epilogue params
@@ -281,6 +286,8 @@ public:
     StrideC dC;
     ElementD** ptr_D;
     StrideD dD;
+    ElementC const* ptr_C_base;
+    ElementD* ptr_D_base;
   };
 
   //
@@ -345,7 +352,9 @@ public:
       args.ptr_C,
       args.dC,
       args.ptr_D,
-      args.dD
+      args.dD,
+      args.ptr_C_base,
+      args.ptr_D_base
     };
   }
 
@@ -408,7 +417,7 @@ public:
 
     bool beta_implementable = true;
 
-    if (cute::is_void_v<ElementC> || args.ptr_C == nullptr) {
+    if (cute::is_void_v<ElementC> || (args.ptr_C == nullptr && args.ptr_C_base == nullptr)) {
       if constexpr (detail::has_beta<Arguments>::value) {
         beta_implementable = args.thread.beta == 0.0;
       }
@@ -1435,13 +1444,22 @@ public:
   }
 
   // Replace address for the global tensor (to be done by single thread)
-  template <bool IsLoad>
+  template <bool IsLoad, class ProblemShape>
   CUTLASS_DEVICE
   void
   tensormaps_replace_global_address(
       TensorMapStorage& shared_tensormap,
       Params const& params,
+      ProblemShape const& problem_shape,
       int32_t next_batch) {
+    // Element offset of the next group within contiguous C/D, only used with MoE token offsets
+    [[maybe_unused]] int64_t offset_CD = 0;
+    if constexpr (cutlass::gemm::detail::is_moe_problem_shape<ProblemShape>::value) {
+      if (problem_shape.has_token_offsets()) {
+        int64_t const M = get<0>(problem_shape.get_problem_shape(next_batch));
+        offset_CD = problem_shape.get_token_offset(next_batch) * M;
+      }
+    }
     // Replacing global_address for the next batch
     if constexpr (IsLoad) {
       if constexpr (is_source_supported) {
@@ -1449,10 +1467,20 @@ public:
           cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormap.smem_tensormap_C,
                                                           params.ptr_C[next_batch]);
         }
+        else if (params.ptr_C_base != nullptr) {
+          auto ptr_C = reinterpret_cast<char const*>(params.ptr_C_base) + (offset_CD * sizeof_bits_v<GmemElementC>) / 8;
+          cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormap.smem_tensormap_C, ptr_C);
+        }
       }
     } else if constexpr (is_destination_supported) {
-      cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormap.smem_tensormap_D,
-                                                      params.ptr_D[next_batch]);
+      if (params.ptr_D != nullptr) {
+        cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormap.smem_tensormap_D,
+                                                        params.ptr_D[next_batch]);
+      }
+      else {
+        auto ptr_D = reinterpret_cast<char const*>(params.ptr_D_base) + (offset_CD * sizeof_bits_v<ElementD>) / 8;
+        cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormap.smem_tensormap_D, ptr_D);
+      }
     }
   }
 
@@ -1535,7 +1563,7 @@ public:
     __syncwarp();
     if (cute::elect_one_sync()) {
       // Replacing global_address for the next batch
-      tensormaps_replace_global_address<IsLoad>(shared_tensormap, params, next_batch);
+      tensormaps_replace_global_address<IsLoad>(shared_tensormap, params, problem_shape, next_batch);
 
       if constexpr (IsGroupedGemmKernel) {
         auto problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(next_batch), 1);
@@ -539,8 +539,11 @@ public:
     int warp_idx = thread_idx / NumThreadsPerWarp;
     [[maybe_unused]] int lane_idx = thread_idx % NumThreadsPerWarp;
 
+    // Gauss 3M mainloops hand over T1 = Ar*Br, T2 = Ai*Bi and T3 = (Ar+Ai)*(Br+Bi) in place of (real,imag)
+    constexpr bool IsGauss3M = decltype(size<3>(accumulators))::value == 3;
     auto accumulators_real = accumulators(_,_,_,0);
     auto accumulators_imag = accumulators(_,_,_,1);
+    auto accumulators_gauss = accumulators(_,_,_,Int<IsGauss3M ? 2 : 1>{});
 
     auto coord_shape = make_coord(m_coord, n_coord, l_coord);
 
@@ -556,10 +559,12 @@ public:
 
     Tensor tAcc_real = accumulators_real(make_coord(_,_),_0{},_0{});                                             // (CTA_M,CTA_N)
     Tensor tAcc_imag = accumulators_imag(make_coord(_,_),_0{},_0{});                                             // (CTA_M,CTA_N)
+    Tensor tAcc_gauss = accumulators_gauss(make_coord(_,_),_0{},_0{});                                           // (CTA_M,CTA_N)
 
     // Apply epilogue subtiling
     Tensor tAcc_real_epi = flat_divide(tAcc_real, EpilogueTile{});                         // (EPI_TILE_M,EPI_TILE_N,EPI_M,EPI_N)
     Tensor tAcc_imag_epi = flat_divide(tAcc_imag, EpilogueTile{});                         // (EPI_TILE_M,EPI_TILE_N,EPI_M,EPI_N)
+    Tensor tAcc_gauss_epi = flat_divide(tAcc_gauss, EpilogueTile{});                       // (EPI_TILE_M,EPI_TILE_N,EPI_M,EPI_N)
 
     Tensor gD_real_epi   = flat_divide(gD_real, EpilogueTile{});                           // (EPI_TILE_M,EPI_TILE_N,EPI_M,EPI_N)
     Tensor gD_imag_epi   = flat_divide(gD_imag, EpilogueTile{});                           // (EPI_TILE_M,EPI_TILE_N,EPI_M,EPI_N)
@@ -602,10 +607,12 @@ public:
     Tensor tTR_sD_real   = thread_t2r.partition_D(sD_real_epi(_,_,_0{}));                        // (T2R,T2R_M,T2R_N)
     Tensor tTR_tAcc_imag = thread_t2r.partition_S(tAcc_imag_epi);                                // (T2R,T2R_M,T2R_N,EPI_M,EPI_N)
     Tensor tTR_sD_imag   = thread_t2r.partition_D(sD_imag_epi(_,_,_0{}));                        // (T2R,T2R_M,T2R_N)
+    Tensor tTR_tAcc_gauss = thread_t2r.partition_S(tAcc_gauss_epi);                              // (T2R,T2R_M,T2R_N,EPI_M,EPI_N)
 
     // Allocate D and accumulator registers
     Tensor tTR_rAcc = make_tensor<ElementAccumulator>(append(shape(tTR_sD_real), Int<NumAccumulatorMtxs>{})); // (T2R,T2R_M,T2R_N,2)
     Tensor tTR_rD   = make_tensor<SmemElementD>(append(shape(tTR_sD_real), Int<NumAccumulatorMtxs>{}));       // (T2R,T2R_M,T2R_N,2)
+    Tensor tTR_rAcc_gauss = make_tensor<ElementAccumulator>(shape(tTR_sD_real));                               // (T2R,T2R_M,T2R_N)
 
     // Vectorized fragment view
     constexpr int FragmentSize = DispatchPolicy::FragmentSize;
@@ -790,6 +797,7 @@ public:
         // The current tile in tmem
         Tensor tTR_tAcc_real_mn = tTR_tAcc_real(_,_,_,epi_m,epi_n);
         Tensor tTR_tAcc_imag_mn = tTR_tAcc_imag(_,_,_,epi_m,epi_n);
+        Tensor tTR_tAcc_gauss_mn = tTR_tAcc_gauss(_,_,_,epi_m,epi_n);
 
         // Compute tmem load predication if necessary
         if constexpr (predicate_tmem_load) {
@@ -802,6 +810,9 @@ public:
         if (issue_tmem_load) { // acc tmem -> reg
           copy(tiled_t2r, tTR_tAcc_real_mn, tTR_rAcc(_,_,_,0));
           copy(tiled_t2r, tTR_tAcc_imag_mn, tTR_rAcc(_,_,_,1));
+          if constexpr (IsGauss3M) {
+            copy(tiled_t2r, tTR_tAcc_gauss_mn, tTR_rAcc_gauss);
+          }
         }
 
         // After the last tmem load, signal that tmem buffer is consumed and empty
@@ -811,6 +822,17 @@ public:
           ++acc_pipe_consumer_state;
         }
 
+        // Resolve the Gauss products: real = T1 - T2, imag = T3 - T1 - T2
+        if constexpr (IsGauss3M) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(tTR_rAcc_gauss); ++i) {
+            ElementAccumulator t1 = tTR_rAcc(_,_,_,0)(i);
+            ElementAccumulator t2 = tTR_rAcc(_,_,_,1)(i);
+            tTR_rAcc(_,_,_,0)(i) = t1 - t2;
+            tTR_rAcc(_,_,_,1)(i) = tTR_rAcc_gauss(i) - t1 - t2;
+          }
+        }
+
         // Vectorized fragment loop with visitor callback entry point
         if (epilogue_op.is_source_needed()) {
           CUTLASS_PRAGMA_UNROLL
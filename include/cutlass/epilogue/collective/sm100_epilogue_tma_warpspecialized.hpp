@@ -432,13 +432,16 @@ public:
   //
   // Constructor and Data Members
   //
+  // Kernels running several epilogue warpgroups concurrently give each of them its own named barrier
   CUTLASS_DEVICE
-  CollectiveEpilogue(Params const& params_, TensorStorage& shared_tensors)
-      : params(params_), fusion_callbacks(params_.thread, shared_tensors.thread) {}
+  CollectiveEpilogue(Params const& params_, TensorStorage& shared_tensors,
+                     cutlass::arch::ReservedNamedBarriers epilogue_barrier_ = cutlass::arch::ReservedNamedBarriers::EpilogueBarrier)
+      : params(params_), fusion_callbacks(params_.thread, shared_tensors.thread), epilogue_barrier(epilogue_barrier_) {}
 
 private:
   Params const& params;
   FusionCallbacks fusion_callbacks;
+  cutlass::arch::ReservedNamedBarriers epilogue_barrier;
 
   //
   // Non-static Device Functions
@@ -720,7 +723,7 @@ public:
 
     // Thread synchronizer for previously issued waits or fences
     // to ensure visibility of smem reads/writes to threads or TMA unit
-    auto synchronize = [] () { cutlass::arch::NamedBarrier::sync(ThreadCount, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier); };
+    auto synchronize = [&] () { cutlass::arch::NamedBarrier::sync(ThreadCount, epilogue_barrier); };
 
     // Predication for sub-128 thread T2R tiled copy
     Layout tmem_warp_layout = typename decltype(make_tmem_warp_partitioner(tAcc_epi(_,_,0,0)))::TiledLayout_TV{};
@@ -1094,7 +1097,7 @@ public:
 
     // Thread synchronizer for previously issued waits or fences
     // to ensure visibility of smem reads/writes to threads or TMA unit
-    auto synchronize = [] () { cutlass::arch::NamedBarrier::sync(ThreadCount, cutlass::arch::ReservedNamedBarriers::EpilogueBarrier); };
+    auto synchronize = [&] () { cutlass::arch::NamedBarrier::sync(ThreadCount, epilogue_barrier); };
 
     // Predication for TMA store (one warp issues TMA store)
     bool issue_tma_store = warp_idx == 0;
@@ -44,6 +44,7 @@
 #include "cutlass/epilogue/fusion/sm120_callbacks_tma_warpspecialized.hpp"
 #include "cutlass/detail/collective.hpp"
 #include "cutlass/detail/layout.hpp"
+#include "cutlass/gemm/indexed_ptr_array.hpp"
 #include "cutlass/trace.h"
 #include "cutlass/cuda_host_adapter.hpp"
 
@@ -261,6 +262,9 @@ public:
     StrideC dC;
     ElementD ** ptr_D = nullptr;
     StrideD dD;
+    // Used in place of ptr_C/ptr_D when those are null: batch addresses are generated on device
+    cutlass::gemm::IndexedPtrArray<NonVoidElementC const> indexed_C{};
+    cutlass::gemm::IndexedPtrArray<NonVoidElementD> indexed_D{};
   };
 
   // Device side epilogue params
@@ -290,6 +294,8 @@ public:
     ElementD** ptr_D;
     StrideD dD;
     uint32_t tma_transaction_bytes = TmaTransactionBytes;
+    cutlass::gemm::IndexedPtrArray<NonVoidElementC const> indexed_C{};
+    cutlass::gemm::IndexedPtrArray<NonVoidElementD> indexed_D{};
   };
 
   //
@@ -330,7 +336,8 @@ public:
     typename Params::TMA_C tma_load_c{};
     if constexpr (is_source_supported) {
     // NOTE: Since TMA desc creation with nullptr not possible until 12.6, we use an initial address even when tensor addresses are on device. This address is never used.
-      ElementC const* ptr_C_first_batch = reinterpret_cast<ElementC const*>(reinterpret_cast<uint64_t>(args.ptr_C) & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
+      auto init_ptr_C = args.ptr_C != nullptr ? reinterpret_cast<uint64_t>(args.ptr_C) : reinterpret_cast<uint64_t>(args.indexed_C.base);
+      ElementC const* ptr_C_first_batch = reinterpret_cast<ElementC const*>(init_ptr_C & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
       Tensor tensor_c = make_tensor(ptr_C_first_batch, make_layout(make_shape(init_M,init_N,init_L), append<3>(stride_c, _0{})));
       tma_load_c = make_tma_copy(
           CopyOpG2S{},
@@ -343,7 +350,8 @@ public:
     typename Params::TMA_D tma_store_d{};
     if constexpr (is_destination_supported) {
     // NOTE: Since TMA desc creation with nullptr not possible until 12.6, we use an initial address even when tensor addresses are on device. This address is never used.
-      ElementD const* ptr_D_first_batch = reinterpret_cast<ElementD const*>(reinterpret_cast<uint64_t>(args.ptr_D) & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
+      auto init_ptr_D = args.ptr_D != nullptr ? reinterpret_cast<uint64_t>(args.ptr_D) : reinterpret_cast<uint64_t>(args.indexed_D.base);
+      ElementD const* ptr_D_first_batch = reinterpret_cast<ElementD const*>(init_ptr_D & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
       Tensor tensor_d = make_tensor(ptr_D_first_batch, make_layout(make_shape(init_M,init_N,init_L), append<3>(stride_d, _0{})));
       tma_store_d = make_tma_copy(
           CopyOpS2G{},
@@ -367,6 +375,8 @@ public:
       args.ptr_D,
       args.dD,
       transaction_bytes,
+      args.indexed_C,
+      args.indexed_D
     };
   }
 
@@ -431,7 +441,7 @@ public:
 
     bool beta_implementable = true;
 
-    if (cute::is_void_v<ElementC> || args.ptr_C == nullptr) {
+    if (cute::is_void_v<ElementC> || (args.ptr_C == nullptr && not args.indexed_C.is_set())) {
       if constexpr (detail::has_beta<Arguments>::value) {
         beta_implementable = args.thread.beta == 0.0;
       }
@@ -1183,16 +1193,16 @@ public:
     // Replacing global_address for the next batch
     if constexpr (IsLoad) {
       if constexpr (is_source_supported) {
-        if (params.ptr_C != nullptr) {
+        if (params.ptr_C != nullptr || params.indexed_C.is_set()) {
           cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_C,
-                                                          params.ptr_C[next_batch]);
+                                                          cutlass::gemm::get_batch_ptr(params.ptr_C, params.indexed_C, next_batch));
         }
       }
     }
     else {
       if constexpr (is_destination_supported) {
         cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_D[warp_group_idx],
-                                                        params.ptr_D[next_batch]);
+                                                        cutlass::gemm::get_batch_ptr(params.ptr_D, params.indexed_D, next_batch));
       }
     }
   }
@@ -44,6 +44,7 @@
 #include "cutlass/epilogue/fusion/sm120_callbacks_tma_warpspecialized.hpp"
 #include "cutlass/detail/collective.hpp"
 #include "cutlass/detail/layout.hpp"
+#include "cutlass/layout/permute_layout.hpp"
 #include "cutlass/detail/helper_macros.hpp"
 #include "cutlass/trace.h"
 
@@ -355,6 +356,19 @@ public:
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
     }
 
+    // Hierarchical (permuted) strides must still map onto a single TMA descriptor
+    bool permute_implementable = true;
+    if constexpr (is_destination_supported && cute::depth(StrideD{}) > 1) {
+      permute_implementable = cutlass::layout::is_tma_expressible<ElementD>(cute::make_layout(shape, args.dD));
+    }
+    if constexpr (not cute::is_void_v<ElementC> && cute::depth(StrideC{}) > 1) {
+      permute_implementable = permute_implementable && cutlass::layout::is_tma_expressible<ElementC>(cute::make_layout(shape, args.dC));
+    }
+
+    if (!permute_implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Permuted C/D layout is not TMA expressible, use a non-TMA epilogue.\n");
+    }
+
     bool fusion_implementable = FusionCallbacks::can_implement(problem_shape, args.thread);
 
     if (!fusion_implementable) {
@@ -376,7 +390,7 @@ public:
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Beta/beta pointer was set, but epilogue is sourceless (void-C).\n");
     }
 
-    return implementable && fusion_implementable && beta_implementable;
+    return implementable && permute_implementable && fusion_implementable && beta_implementable;
   }
 
   template<class TileShapeMNK>
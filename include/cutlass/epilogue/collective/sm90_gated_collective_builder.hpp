@@ -28,72 +28,25 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  **************************************************************************************************/
+/*! \file
+  \brief Epilogue builder for sm90 gated activation GEMMs.
+
+  The GEMM computes a tile of height 2*I in which every 16 rows hold 8 rows of the up projection
+  followed by 8 rows of the gate (see cutlass/detail/sm90_gated_layout.hpp). The epilogue emits
+  up * ActivationFn(gate) of height I through the aux store, so the intermediate 2*I wide tensor
+  is never written to global memory.
+*/
+
 #pragma once
 
 // This is a temp fix for circular include issue in CuTe
 #include "cute/atom/copy_atom.hpp"
 
-#include "cutlass/gemm/collective/collective_builder.hpp"
 #include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_gated_act_tma_warpspecialized.hpp"
+#include "cutlass/detail/sm90_gated_layout.hpp"
 
-#include "gated_stride.hpp"
-#include "sm90_visitor_gated_act.hpp"
-
-namespace cutlass::detail {
-
-template <int ModeIndex, class InputStride>
-using GatedStride = cute::conditional_t<
-  cutlass::detail::is_major<ModeIndex, InputStride>(),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,int64_t,cute::_8>{})),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride< int64_t,int64_t, int64_t>{}))
->;
-
-template <int ModeIndex, class InputStride>
-using GatedOutputStride = cute::conditional_t<
-  cutlass::detail::is_major<ModeIndex, InputStride>(),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride<cute::_1,cute::_8>{})),
-  decltype(replace<ModeIndex>(InputStride{}, cute::Stride< int64_t, int64_t>{}))
->;
-
-}
-
-namespace cutlass::gemm::collective {
-
-template <
-  class OpClass,
-  class ElementA,
-  class GmemLayoutA,
-  int AlignmentA,
-  class ElementB,
-  class GmemLayoutB,
-  int AlignmentB,
-  class ElementAccumulator,
-  class TileShape_MNK_,
-  class ClusterShape_MNK,
-  class StageCountType,
-  class KernelScheduleType
->
-struct Sm90CollectiveBuilderGated {
-
-  using TileShape_MNK = decltype(cutlass::sm90_make_gated_shape<0>(TileShape_MNK_{}));
-
-  using InternalStrideA = cute::remove_pointer_t<cutlass::gemm::TagToStrideA_t<GmemLayoutA>>;
-  using GatedInternalStrideA = cutlass::detail::GatedStride<0, InternalStrideA>;
-  using StrideA = cute::conditional_t<platform::is_pointer<GmemLayoutA>::value, GatedInternalStrideA *, GatedInternalStrideA>;
-
-  using StrideB = cutlass::gemm::TagToStrideB_t<GmemLayoutB>;
-  
-  using CollectiveOp = typename CollectiveBuilder<
-    arch::Sm90, OpClass,
-    ElementA, StrideA, AlignmentA,
-    ElementB, StrideB, AlignmentB,
-    ElementAccumulator,
-    TileShape_MNK, ClusterShape_MNK,
-    StageCountType, KernelScheduleType
-  >::CollectiveOp;
-};
-
-} // namespace cutlass::gemm::collective
+/////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::epilogue::collective {
 
@@ -170,4 +123,6 @@ struct Sm90CollectiveBuilderGated {
   >::CollectiveOp;
 };
 
-} // namespace cutlass::epilogue::collective 
+} // namespace cutlass::epilogue::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,6 +76,19 @@ struct PtrArrayPlanarComplexNoSmemWarpSpecialized2Sm : PtrArrayNoSmemWarpSpecial
 // Blackwell TMA schedules 
 struct TmaWarpSpecialized1Sm {};
 struct TmaWarpSpecialized2Sm {};
+// Streams epilogue subtiles through smem rings of a fixed depth instead of the builder's heuristic depth.
+// Smem is StagesD (and StagesC for residuals) epilogue tiles regardless of the CTA tile, so a small
+// EpilogueTile with a shallow ring returns smem to the mainloop, e.g. for 256x256 tiles with fp32 output
+template <int StagesD_ = 1, int StagesC_ = 2>
+struct TmaWarpSpecialized1SmStreaming : TmaWarpSpecialized1Sm {
+  static constexpr int StagesD = StagesD_;
+  static constexpr int StagesC = StagesC_;
+};
+template <int StagesD_ = 1, int StagesC_ = 2>
+struct TmaWarpSpecialized2SmStreaming : TmaWarpSpecialized2Sm {
+  static constexpr int StagesD = StagesD_;
+  static constexpr int StagesC = StagesC_;
+};
 struct PtrArrayTmaWarpSpecialized1Sm : TmaWarpSpecialized1Sm {};
 struct PtrArrayTmaWarpSpecialized2Sm : TmaWarpSpecialized2Sm {};
 
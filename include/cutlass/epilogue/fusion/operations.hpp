@@ -134,6 +134,25 @@ struct LinCombEltAct
   static constexpr bool IsEltActSupported = true;
 };
 
+// D = activation(alpha * acc + beta * C)
+// amax_d = max(abs(elements in D))
+// First phase of just-in-time (current) scaling: D is written in high precision and is then
+// quantized with a scale derived from amax_d by cutlass::quantize_current_scaling
+template<
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementAmax_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombEltActAmax
+    : LinCombEltAct<ActivationFn_, ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementAmax = ElementAmax_;
+  static constexpr bool IsAbsMaxSupported = true;
+};
+
 // D = softmax(top_k(alpha * acc + beta * C))
 template<
   int TopK,
@@ -147,6 +166,68 @@ struct LinCombTopKSoftmaxCol
     : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
 };
 
+// D = alpha * acc + beta * C
+// with MoE routing of every row over the N experts: the indices and softmax weights of the
+// row's top-k experts, per-expert token counts, and the position of each token in its experts' buckets
+template<
+  int TopK,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementWeight_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombTopKSoftmaxRouterCol
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementWeight = ElementWeight_;
+};
+
+// D = alpha * acc + beta * C
+// with per-row online softmax partials (max, sum of exps) and optional top-k candidates per N tile
+template<
+  int TopK,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombOnlineSoftmaxCol
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+};
+
+// D = alpha * acc + beta * C
+// with the per-row cross entropy loss of the logits D against per-row target columns,
+// and optionally the per-row logsumexp that scales the logits gradient
+template<
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombCrossEntropyCol
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+};
+
+// D = gamma * norm(alpha * acc + beta * C) + shift
+// norm is a LayerNorm (or RMSNorm) over each row of N, gamma and shift are per-column vectors
+template<
+  bool IsRMSNorm_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementGamma_ = ElementOutput_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombRowNorm
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementGamma = ElementGamma_;
+  static constexpr bool IsRMSNorm = IsRMSNorm_;
+};
+
 
 // D = alpha * acc + beta * C + per-row bias
 template<
@@ -336,6 +417,27 @@ struct PerColResAddPerColBiasEltAct
   static constexpr bool IsResidualSupported = true;
 };
 
+// D = dropout(activation(per-col alpha * acc + per-column bias)) + per-col beta * C
+// the keep mask is generated statelessly from (seed, offset) and can be emitted as a bit tensor
+template<
+  class GmemLayoutTagMask_,
+  template <class> class ActivationFn_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementBias_ = ElementOutput_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_, // per-row alpha/beta
+  int AlignmentBias_ = 128 / cute::sizeof_bits_v<ElementBias_>,
+  int AlignmentScalar_ = 128 / cute::sizeof_bits_v<ElementScalar_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct PerColResAddPerColBiasEltActDropout
+    : PerColResAddPerColBiasEltAct<ActivationFn_, ElementOutput_, ElementCompute_,
+        ElementBias_, ElementSource_, ElementScalar_, AlignmentBias_, AlignmentScalar_, RoundStyle_> {
+  using GmemLayoutTagMask = GmemLayoutTagMask_;
+  static constexpr bool IsDropoutSupported = true;
+};
+
 // Z = scale_a * scale_b * alpha * acc + beta * scale_c * C + per-row bias
 // if D is fp8 
 //   D = scale_d * activation(Z)
@@ -541,6 +643,29 @@ struct LinCombEltActBlockScaleFactor
   using GmemLayoutTagScalefactor = GmemLayoutTagScalefactor_;
 };
 
+// D = per-row scale * activation(alpha * acc + beta * C)
+// With BlockScaleFactor generation. The per-row scale is applied ahead of quantization,
+// e.g. the top-k routing weight of each token in an MoE expert GEMM.
+template<
+  template <class> class ActivationFn_,
+  int SFVecSize_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementBlockScaleFactor_,
+  class GmemLayoutTagScalefactor_ = cutlass::layout::RowMajor,
+  class ElementRowScale_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  int AlignmentRowScale_ = 128 / cute::sizeof_bits_v<ElementRowScale_>,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombEltActRowScaleBlockScaleFactor
+    : LinCombEltActBlockScaleFactor<ActivationFn_, SFVecSize_, ElementOutput_, ElementCompute_,
+        ElementBlockScaleFactor_, GmemLayoutTagScalefactor_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementRowScale = ElementRowScale_;
+  static constexpr int AlignmentRowScale = AlignmentRowScale_;
+};
+
 // D = alpha * acc + beta * C + per-row bias
 // With BlockScaleFactor generation
 template<
@@ -634,6 +759,49 @@ struct LinCombPerColBiasEltActBlockScaleFactor
   using GmemLayoutTagScalefactor = GmemLayoutTagScalefactor_;
 };
 
+// D = alpha * acc + beta * C
+// With 1 x SFVecSize blockwise scale generation for 8-bit float D.
+// Scales are MN-major fp32 (by default), the layout the blockwise-scaled mainloops take as
+// the scales of their A operand, so D can feed the next GEMM's A directly.
+template<
+  int SFVecSize_,
+  class ElementOutput_,
+  class ElementCompute_,
+  class ElementBlockScale_ = ElementCompute_,
+  class ElementSource_ = ElementOutput_,
+  class ElementScalar_ = ElementCompute_,
+  FloatRoundStyle RoundStyle_ = FloatRoundStyle::round_to_nearest
+>
+struct LinCombBlockwiseScaleFactor
+    : LinearCombination<ElementOutput_, ElementCompute_, ElementSource_, ElementScalar_, RoundStyle_> {
+  using ElementBlockScale = ElementBlockScale_;
+  static constexpr int SFVecSize = SFVecSize_;
+};
+
+// Gated activation over M-interleaved gate/up row pairs from a single GEMM of height 2*I:
+// rows [16i, 16i+8) hold the up projection and rows [16i+8, 16i+16) the gate, and
+// Aux = (alpha * acc_up + beta * C_up) * activation(alpha * acc_gate + beta * C_gate) [* scale]
+// is written with height I. D is not written; the output is carried by the aux store.
+template<
+  bool Quantize, // whether to quantize output with a per-tensor scale factor
+  template <class> class ActivationFn,
+  class GmemLayoutTagOutput,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  class ElementIntermediate = ElementOutput,
+  int Alignment = 128 / cute::sizeof_bits_v<ElementOutput>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct LinCombGatedActFunc
+    : LinearCombination<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+  using ElementAux = ElementOutput;
+  using GmemLayoutTagAux = GmemLayoutTagOutput;
+  static constexpr int AlignmentAux = Alignment;
+  static constexpr bool IsAuxOutSupported = true;
+};
+
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -502,6 +502,122 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// For Ptr-Array and Grouped GEMM
+// D = per-row scale * activation(alpha * acc + beta * C), where alpha and beta can be vectors for each batch/group
+// and the per-row scale is a separate vector for each batch/group
+// With Row BlockScaleFactor Generation, separate tensors per batch/group.
+template<
+  class CtaTileShapeMNK,
+  int SFVecsize,
+  class EpilogueTile,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBlockScaleFactor,
+  class ElementRowScale = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  int AlignmentRowScale = 128 / cute::sizeof_bits_v<ElementRowScale>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm100LinCombEltActRowScaleRowBlockScaleFactorPtrArray =
+  Sm90EVT<Sm100BlockScaleFactorRowStore<SFVecsize, EpilogueTile, ElementOutput, ElementCompute, ElementBlockScaleFactor *, RoundStyle>, // gen scalefactor
+    Sm90EVT<Sm90Compute<multiplies, ElementCompute, ElementCompute, RoundStyle>, // row_scale * activation(beta * C + (alpha * acc))
+      Sm90ColBroadcast<0, CtaTileShapeMNK, ElementRowScale *, ElementCompute, Stride<_1,_0,_0>, AlignmentRowScale>, // row_scale
+      Sm90LinCombEltActPtrArray<ActivationFn, ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // activation(beta * C + (alpha * acc))
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBlockScaleFactor,
+  int SFVecSize,
+  class ElementRowScale,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentRowScale,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm100PtrArrayTmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombEltActRowScaleBlockScaleFactor<ActivationFn, SFVecSize, ElementOutput, ElementCompute, ElementBlockScaleFactor, cutlass::layout::RowMajor,
+      ElementRowScale, ElementSource, ElementScalar, AlignmentRowScale, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm100LinCombEltActRowScaleRowBlockScaleFactorPtrArray<CtaTileShapeMNK, SFVecSize, EpilogueTile, ActivationFn,
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementBlockScaleFactor,
+      ElementRowScale, ElementSource, ElementScalar, AlignmentRowScale, RoundStyle> {
+
+  using Impl = Sm100LinCombEltActRowScaleRowBlockScaleFactorPtrArray<CtaTileShapeMNK, SFVecSize, EpilogueTile, ActivationFn,
+      typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementBlockScaleFactor,
+      ElementRowScale, ElementSource, ElementScalar, AlignmentRowScale, RoundStyle>;
+  using Operation = fusion::LinCombEltActRowScaleBlockScaleFactor<ActivationFn, SFVecSize, ElementOutput, ElementCompute, ElementBlockScaleFactor, cutlass::layout::RowMajor,
+      ElementRowScale, ElementSource, ElementScalar, AlignmentRowScale, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+    ElementScalar const* const* alpha_ptr_array = nullptr;
+    ElementScalar const* const* beta_ptr_array = nullptr;
+    // One M-length vector per batch/group. Rows are not scaled when no vectors are provided.
+    ElementRowScale const* const* row_scale_ptr_array = nullptr;
+    ElementBlockScaleFactor ** block_scale_factor_ptr = nullptr;
+    // A matrix wide constant value to scale the output matrix
+    // Avoids generating small FP4 values.
+    using StrideNormConst = Stride<_0,_0,int64_t>;
+    ElementCompute const* norm_constant_ptr = nullptr;
+    StrideNormConst dNormConst = {_0{}, _0{}, 0};
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    operator typename Impl::Arguments() const {
+      return
+        {
+          {    // binary op : row_scale * activation(beta * C + (alpha * acc))
+            {row_scale_ptr_array, ElementRowScale(1), {}}, // leaf args : row_scale
+            {    // unary op: activation(beta * C + (alpha * acc))
+              {    // ternary op : beta * C + (alpha * acc)
+                {{beta}, {beta_ptr}, {beta_ptr_array}, {dBeta}}, // leaf args : beta
+                {},                   // leaf args : C
+                {                     // binary op : alpha * acc
+                  {{alpha}, {alpha_ptr}, {alpha_ptr_array}, {dAlpha}}, // leaf args : alpha
+                  {},                     // leaf args : acc
+                  {}                  // binary args : multiplies
+                },                    // end binary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              activation // unary args : activation
+            },   // end unary op
+            {} // binary args : multiplies
+          },   // end binary op
+          {block_scale_factor_ptr, norm_constant_ptr, dNormConst} // BlockScaleFactor args
+        };   // end ternary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 // D = alpha * acc + beta * C + per-row bias
 //   with row blockScaled generation
 template<
@@ -47,6 +47,13 @@
 #include "cutlass/epilogue/fusion/sm90_visitor_compute_tma_warpspecialized.hpp"
 
 #include "cutlass/epilogue/fusion/sm90_visitor_topk_softmax.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_row_norm.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_online_softmax.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_dropout.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_stochastic_round.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_gather_scatter.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_grouped_store.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_pooling.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1470,6 +1477,133 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// D = dropout(activation(per-col alpha * acc + per-column bias)) + per-col beta * C
+template<
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class StrideMask,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBias = ElementOutput,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  int AlignmentBias = 128 / sizeof_bits_v<ElementBias>,
+  int AlignmentScalar = 128 / sizeof_bits_v<ElementScalar>,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90PerColResAddPerColBiasEltActDropout =
+  Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementOutput, ElementCompute, RoundStyle>, // beta * C + dropout(activation(alpha * acc + bias))
+    Sm90RowBroadcast<0, CtaTileShapeMNK, ElementScalar, ElementCompute, Stride<_0,bool,int64_t>, AlignmentScalar>, // beta, dynamic scalar/vector broadcast
+    Sm90SrcFetch<ElementSource>, // C
+    Sm90EVT<Sm90Dropout<ElementCompute, ElementCompute, RoundStyle, StrideMask>, // dropout(activation(alpha * acc + bias))
+      Sm90EVT<Sm90Compute<ActivationFn, ElementCompute, ElementCompute, RoundStyle>, // activation(alpha * acc + bias)
+        Sm90EVT<Sm90Compute<homogeneous_multiply_add, ElementCompute, ElementCompute, RoundStyle>, // alpha * acc + bias
+          Sm90RowBroadcast<0, CtaTileShapeMNK, ElementScalar, ElementCompute, Stride<_0,bool,int64_t>, AlignmentScalar>, // alpha, dynamic scalar/vector broadcast
+          Sm90AccFetch, // acc
+          Sm90RowBroadcast<0, CtaTileShapeMNK, ElementBias, ElementCompute, Stride<_0,_1,int64_t>, AlignmentBias> // bias
+        >
+      >
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class GmemLayoutTagMask,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBias,
+  class ElementSource,
+  class ElementScalar,
+  int AlignmentBias,
+  int AlignmentScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::PerColResAddPerColBiasEltActDropout<
+      GmemLayoutTagMask, ActivationFn, ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    >,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90PerColResAddPerColBiasEltActDropout<
+      CtaTileShapeMNK, EpilogueTile, cutlass::gemm::TagToStrideC_t<GmemLayoutTagMask>, ActivationFn,
+      ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    > {
+
+  using Impl =
+    Sm90PerColResAddPerColBiasEltActDropout<
+      CtaTileShapeMNK, EpilogueTile, cutlass::gemm::TagToStrideC_t<GmemLayoutTagMask>, ActivationFn,
+      ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    >;
+  using Operation =
+    fusion::PerColResAddPerColBiasEltActDropout<
+      GmemLayoutTagMask, ActivationFn, ElementOutput, ElementCompute, ElementBias, ElementSource, ElementScalar, AlignmentBias, AlignmentScalar, RoundStyle
+    >;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,bool,int64_t>;
+    using StrideBeta  = Stride<_0,bool,int64_t>;
+    StrideAlpha dAlpha = {_0{}, bool(1), 0};
+    StrideBeta  dBeta  = {_0{}, bool(1), 0};
+
+    using StrideBias = Stride<_0,_1,int64_t>;
+    ElementBias const* bias_ptr = nullptr;
+    StrideBias dBias = {};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    float dropout_probability = 0.f;
+    uint64_t seed = 0;
+    uint64_t offset = 0;
+    uint64_t const* seed_ptr = nullptr;
+    uint64_t const* offset_ptr = nullptr;
+
+    using StrideMask = cutlass::gemm::TagToStrideC_t<GmemLayoutTagMask>;
+    cutlass::uint1b_t* mask_ptr = nullptr;
+    StrideMask dMask = {};
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // ternary op : beta * C + dropout(activation(alpha * acc + bias))
+          {beta_ptr, beta, dBeta}, // leaf args : beta
+          {},                      // leaf args : C
+          {                        // unary op : dropout(activation(alpha * acc + bias))
+            {                          // unary op : activation(alpha * acc + bias)
+              {                            // ternary op : alpha * acc + bias
+                {alpha_ptr, alpha, dAlpha},        // leaf args : alpha
+                {},                                // leaf args : acc
+                {bias_ptr, ElementBias(0), dBias}, // leaf args : bias
+                {}                         // ternary args : multiply_add
+              },                           // end ternary op
+              activation               // unary args : activation
+            },                         // end unary op
+            {dropout_probability, seed, offset, seed_ptr, offset_ptr, mask_ptr, dMask} // unary args : dropout
+          },                       // end unary op
+          {} // ternary args : multiply_add
+        };   // end ternary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace detail {
 
 template <typename T>
@@ -2424,6 +2558,97 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// D = activation(alpha * acc + beta * C), amax_d = max(abs(elements in D))
+// amax_d is reduced before D is rounded to ElementOutput, so a following current scaling
+// quantization pass sees the same range up to the rounding of D
+template<
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax = ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombEltActAmax =
+  Sm90EVT<Sm90Compute<epilogue::thread::Identity, ElementOutput, ElementCompute, RoundStyle>, // convert(activation(Z))
+    Sm90EVT<Sm90ScalarReduction<detail::amax, atomic_maximum, ElementAmax, ElementCompute, RoundStyle>, // amax_d
+      Sm90LinCombEltAct<ActivationFn, ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // activation(Z)
+    >
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  template <class> class ActivationFn,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementAmax,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombEltActAmax<ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombEltActAmax<ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombEltActAmax<ActivationFn, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombEltActAmax<ActivationFn, ElementOutput, ElementCompute, ElementAmax, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    using ActivationArguments = typename Sm90Compute<ActivationFn, ElementOutput, ElementCompute, RoundStyle>::Arguments;
+    ActivationArguments activation = ActivationArguments();
+
+    ElementAmax* amax_D_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op : convert(activation(Z))
+          {    // unary op : amax_d
+            {    // unary op : activation(beta * C + (alpha * acc))
+              {    // ternary op : beta * C + (alpha * acc)
+                {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+                {},                   // leaf args : C
+                {                     // binary op : alpha * acc
+                  {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+                  {},                     // leaf args : acc
+                  {}                  // binary args : multiplies
+                },                    // end binary op
+                {} // ternary args : multiply_add
+              },   // end ternary op
+              activation // unary args : activation
+            },   // end unary op
+            {amax_D_ptr} // unary args : reduce
+          },   // end unary op
+          {} // unary args : convert
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<
   class CtaTileShapeMNK,
   class EpilogueTile,
@@ -2735,6 +2960,392 @@ struct FusionCallbacks<
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// D = alpha * acc + beta * C, with the top-k experts, routing weights and expert counts of every row
+template<
+  int TopK,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombTopKSoftmaxRouterCol =
+  Sm90EVT<Sm90TopKSoftmaxRouterColReduction<TopK, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementWeight, RoundStyle>, // route(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int TopK,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombTopKSoftmaxRouterCol<TopK, ElementOutput, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombTopKSoftmaxRouterCol<TopK, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombTopKSoftmaxRouterCol<TopK, CtaTileShapeMNK, EpilogueTile, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombTopKSoftmaxRouterCol<TopK, ElementOutput, ElementCompute, ElementWeight, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    int32_t* topk_indices_ptr = nullptr;      // (M,TopK,L)
+    ElementWeight* topk_weights_ptr = nullptr; // (M,TopK,L)
+    int32_t* expert_counts_ptr = nullptr;     // (N,L)
+    int32_t* topk_slots_ptr = nullptr;        // (M,TopK,L)
+    int32_t* expert_tokens_ptr = nullptr;     // (capacity,N,L)
+    int32_t expert_capacity = 0;
+    bool renormalize = true;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: route(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {topk_indices_ptr, topk_weights_ptr, expert_counts_ptr, topk_slots_ptr,
+           expert_tokens_ptr, expert_capacity, renormalize} // unary args: top-k router
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C, with online softmax partials of every row and N tile
+template<
+  int TopK,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombOnlineSoftmaxCol =
+  Sm90EVT<Sm90OnlineSoftmaxColReduction<TopK, CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // partials(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int TopK,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombOnlineSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombOnlineSoftmaxCol<TopK, CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombOnlineSoftmaxCol<TopK, CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombOnlineSoftmaxCol<TopK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Reduction = Sm90OnlineSoftmaxColReduction<TopK, CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    typename Reduction::Partial* partials_ptr = nullptr;
+    typename Reduction::Candidates* topk_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: partials(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {partials_ptr, topk_ptr} // unary args: online softmax
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C, with the cross entropy loss of every row of D
+template<
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombCrossEntropyCol =
+  Sm90EVT<Sm90CrossEntropyColReduction<CtaTileShapeMNK, ElementOutput, ElementCompute, RoundStyle>, // loss(beta * C + (alpha * acc))
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombCrossEntropyCol<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombCrossEntropyCol<CtaTileShapeMNK, ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombCrossEntropyCol<CtaTileShapeMNK, typename cutlass::detail::get_unpacked_element_type<ElementOutput>::type, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombCrossEntropyCol<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    int32_t const* targets_ptr = nullptr;
+    ElementCompute* loss_ptr = nullptr;
+    ElementCompute* lse_ptr = nullptr;
+    int32_t ignore_index = -100;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: loss(beta * C + (alpha * acc))
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {targets_ptr, loss_ptr, lse_ptr, ignore_index} // unary args: cross entropy
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = gamma * norm(alpha * acc + beta * C) + shift
+template<
+  bool IsRMSNorm,
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementGamma = ElementOutput,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombRowNorm =
+  Sm90EVT<Sm90RowNormColReduction<IsRMSNorm, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementCompute, RoundStyle, ElementGamma>, // gamma * norm(beta * C + (alpha * acc)) + shift
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  bool IsRMSNorm,
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementGamma,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombRowNorm<IsRMSNorm, ElementOutput, ElementCompute, ElementGamma, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombRowNorm<IsRMSNorm, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementGamma, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombRowNorm<IsRMSNorm, FragmentSize, CtaTileShapeMNK, EpilogueTile, ElementOutput, ElementCompute, ElementGamma, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombRowNorm<IsRMSNorm, ElementOutput, ElementCompute, ElementGamma, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    ElementCompute epsilon = ElementCompute(1e-5f);
+    ElementGamma const* gamma_ptr = nullptr;
+    ElementGamma const* shift_ptr = nullptr;
+
+    operator typename Impl::Arguments() const {
+      return
+        {    // unary op: gamma * norm(beta * C + (alpha * acc)) + shift
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {} // ternary args : multiply_add
+          },   // end ternary op
+          {epsilon, gamma_ptr, shift_ptr} // unary args: row norm
+        };   // end unary op
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// D = alpha * acc + beta * C
+// With 1 x SFVecSize blockwise scale generation, D quantized by the generated scales.
+template<
+  int SFVecSize,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBlockScale,
+  class ElementSource = ElementOutput,
+  class ElementScalar = ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+using Sm90LinCombBlockwiseScaleFactor =
+  Sm90EVT<Sm90BlockwiseScaleFactorRowStore<SFVecSize, EpilogueTile, ElementOutput, ElementCompute, ElementBlockScale, RoundStyle>, // gen scales
+    Sm90LinearCombination<ElementCompute, ElementCompute, ElementSource, ElementScalar, RoundStyle> // beta * C + (alpha * acc)
+  >;
+
+template <
+  int StagesC,
+  int StagesD,
+  int FragmentSize,
+  bool ReuseSmemC,
+  bool DelayTmaStore,
+  int SFVecSize,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBlockScale,
+  class ElementSource,
+  class ElementScalar,
+  FloatRoundStyle RoundStyle,
+  class CtaTileShapeMNK,
+  class EpilogueTile
+>
+struct FusionCallbacks<
+    epilogue::Sm90TmaWarpSpecialized<StagesC, StagesD, FragmentSize, ReuseSmemC, DelayTmaStore>,
+    fusion::LinCombBlockwiseScaleFactor<SFVecSize, ElementOutput, ElementCompute, ElementBlockScale, ElementSource, ElementScalar, RoundStyle>,
+    CtaTileShapeMNK,
+    EpilogueTile
+> : Sm90LinCombBlockwiseScaleFactor<SFVecSize, EpilogueTile, ElementOutput, ElementCompute, ElementBlockScale, ElementSource, ElementScalar, RoundStyle> {
+
+  using Impl = Sm90LinCombBlockwiseScaleFactor<SFVecSize, EpilogueTile, ElementOutput, ElementCompute, ElementBlockScale, ElementSource, ElementScalar, RoundStyle>;
+  using Operation = fusion::LinCombBlockwiseScaleFactor<SFVecSize, ElementOutput, ElementCompute, ElementBlockScale, ElementSource, ElementScalar, RoundStyle>;
+
+  struct Arguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+    ElementBlockScale* block_scale_ptr = nullptr;
+
+    using StrideAlpha = Stride<_0,_0,int64_t>;
+    using StrideBeta  = Stride<_0,_0,int64_t>;
+    StrideAlpha dAlpha = {_0{}, _0{}, 0};
+    StrideBeta  dBeta  = {_0{}, _0{}, 0};
+
+    operator typename Impl::Arguments() const {
+      return
+        {
+          {    // ternary op : beta * C + (alpha * acc)
+            {{beta}, {beta_ptr}, {dBeta}}, // leaf args : beta
+            {},                   // leaf args : C
+            {                     // binary op : alpha * acc
+              {{alpha}, {alpha_ptr}, {dAlpha}}, // leaf args : alpha
+              {},                     // leaf args : acc
+              {}                  // binary args : multiplies
+            },                    // end binary op
+            {}                    // ternary args : multiply_add
+          },                      // end ternary op
+          {block_scale_ptr}       // blockwise scale args
+        };
+    }
+  };
+
+  // Ctor inheritance
+  using Impl::Impl;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 // Grouped Wgrad Conv
 template<
   class GroupsPerTile,
@@ -0,0 +1,333 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Visitor tree stateless Philox dropout for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Philox-4x32-10 counter based generator (Salmon et al., SC'11)
+// Stateless: the four 32b outputs are a pure function of the 128b counter and the 64b key
+struct Philox4x32 {
+  static constexpr uint32_t kMul0 = 0xD2511F53u;
+  static constexpr uint32_t kMul1 = 0xCD9E8D57u;
+  static constexpr uint32_t kWeyl0 = 0x9E3779B9u;
+  static constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+
+  CUTLASS_HOST_DEVICE static uint32_t
+  mulhilo(uint32_t a, uint32_t b, uint32_t& hi) {
+  #if defined(__CUDA_ARCH__)
+    hi = __umulhi(a, b);
+    return a * b;
+  #else
+    uint64_t product = uint64_t(a) * uint64_t(b);
+    hi = static_cast<uint32_t>(product >> 32);
+    return static_cast<uint32_t>(product);
+  #endif
+  }
+
+  CUTLASS_HOST_DEVICE static Array<uint32_t, 4>
+  generate(Array<uint32_t, 4> ctr, uint64_t key) {
+    uint32_t k0 = static_cast<uint32_t>(key);
+    uint32_t k1 = static_cast<uint32_t>(key >> 32);
+    CUTLASS_PRAGMA_UNROLL
+    for (int round = 0; round < 10; ++round) {
+      uint32_t hi0, hi1;
+      uint32_t lo0 = mulhilo(kMul0, ctr[0], hi0);
+      uint32_t lo1 = mulhilo(kMul1, ctr[2], hi1);
+      ctr = {hi1 ^ ctr[1] ^ k0, lo1, hi0 ^ ctr[3] ^ k1, lo0};
+      k0 += kWeyl0;
+      k1 += kWeyl1;
+    }
+    return ctr;
+  }
+};
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Inverted dropout with a stateless Philox mask
+//   D(m,n,l) = keep(m,n,l) ? Z(m,n,l) / (1 - p) : 0
+// keep(m,n,l) depends only on the seed, the offset and the linear index i = (l * M + m) * N + n:
+// element i uses word i % 4 of Philox4x32-10 with counter (i / 4, offset) and key seed, and is
+// kept when that word is not below p * 2^32. The mask can therefore be regenerated by any kernel
+// (e.g. the backward pass) from (seed, offset) alone, or be emitted here as a bit tensor.
+// seed_ptr/offset_ptr take precedence over seed/offset so the state can advance on device
+// across CUDA graph replays.
+template <
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<int64_t,_1,int64_t>, // of the optional keep bit mask
+  int AlignmentMask = 128,
+  bool EnableNullptr = true // Noop on nullptr mask
+>
+struct Sm90Dropout {
+  static_assert(AlignmentMask % 8 == 0, "Mask must be byte-aligned");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    float probability = 0.f; // of dropping an element, in [0, 1)
+    uint64_t seed = 0;
+    uint64_t offset = 0;
+    uint64_t const* seed_ptr = nullptr;
+    uint64_t const* offset_ptr = nullptr;
+    cutlass::uint1b_t* ptr_mask = nullptr; // 1 = kept
+    StrideMNL dMask = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    bool implementable = args.probability >= 0.f && args.probability < 1.f;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Dropout probability must be in [0, 1).\n");
+    }
+    return implementable;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90Dropout() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90Dropout(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class RTensor, class GTensor, class CTensor, class ThrResidue>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        RTensor&& tC_rMask,
+        GTensor&& tC_gMask,
+        CTensor tCcD,
+        ThrResidue residue_tCcD,
+        int64_t thread_row,
+        int thread_n,
+        int N,
+        uint64_t seed,
+        uint64_t offset,
+        Params const* params_ptr)
+      : tC_rMask(cute::forward<RTensor>(tC_rMask)),
+        tC_gMask(cute::forward<GTensor>(tC_gMask)),
+        tCcD(tCcD),
+        residue_tCcD(residue_tCcD),
+        thread_row(thread_row),
+        thread_n(thread_n),
+        N(N),
+        seed(seed),
+        offset(offset),
+        params_ptr(params_ptr) {
+      float probability = params_ptr->probability;
+      threshold = static_cast<uint32_t>(cutlass::platform::min(
+                    double(probability) * 4294967296.0, 4294967295.0));
+      scale = ElementCompute(1.f / (1.f - probability));
+    }
+
+    RTensor tC_rMask;                                                                  // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    GTensor tC_gMask;                                                                  // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    CTensor tCcD;                                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ThrResidue residue_tCcD;
+    int64_t thread_row; // l * M + first row of the thread
+    int thread_n;       // first column of the thread
+    int N;
+    uint64_t seed;
+    uint64_t offset;
+    uint32_t threshold;
+    ElementCompute scale;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementOutput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementCompute, FragmentSize, RoundStyle>;
+      using ConvertMask = PackPredicates<FragmentSize>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+      ConvertMask convert_mask{};
+
+      Array frg_compute = convert_input(frg_input);
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      // Fragments are usually contiguous along n, so consecutive elements mostly share a Philox call
+      uint64_t group = ~uint64_t(0);
+      Array<uint32_t, 4> random;
+      bool frg_keep[FragmentSize];
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto [m, n] = tCcD_mn(epi_v * FragmentSize + i);
+        uint64_t idx = uint64_t(thread_row + m) * uint64_t(N) + uint64_t(thread_n + n);
+        if ((idx >> 2) != group) {
+          group = idx >> 2;
+          random = detail::Philox4x32::generate(
+            {static_cast<uint32_t>(group), static_cast<uint32_t>(group >> 32),
+             static_cast<uint32_t>(offset), static_cast<uint32_t>(offset >> 32)}, seed);
+        }
+        uint32_t word = (idx & 2) ? ((idx & 1) ? random[3] : random[2])
+                                  : ((idx & 1) ? random[1] : random[0]);
+        frg_keep[i] = word >= threshold;
+        frg_compute[i] = frg_keep[i] ? frg_compute[i] * scale : ElementCompute(0);
+      }
+
+      static_assert(FragmentSize % 8 == 0, "Predicate vector must be byte-aligned");
+      Tensor tC_rMask_frg = recast<typename ConvertMask::result_type>(coalesce(tC_rMask(_,_,_,epi_m,epi_n))); // (EPI_V)
+      tC_rMask_frg(epi_v) = convert_mask(frg_keep);
+
+      return convert_output(frg_compute);
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      // Nullptr is no-op
+      if constexpr (EnableNullptr) {
+        if (params_ptr->ptr_mask == nullptr) {
+          return;
+        }
+      }
+
+      // Compute vectorization
+      constexpr auto MCL = decltype(max_common_layout(tC_rMask, tC_gMask)){};
+      constexpr int V = cute::min(AlignmentMask, size(MCL));
+      // Copy vectorizes into byte-aligned stores
+      if constexpr (V > 1 && V % 8 == 0) {
+        using VecType = uint_bit_t<V>;
+        Tensor tC_rMask_vec = recast<VecType>(tC_rMask);
+        Tensor tC_gMask_vec = recast<VecType>(tC_gMask);
+        Tensor tCcD_vec = tensor<1>(zipped_divide(tCcD, MCL.compose(Int<V>{})));
+        Tensor tC_pMask_vec = cute::lazy::transform(tCcD_vec, [&](auto const& c){ return elem_less(c, residue_tCcD); });
+        copy_if(tC_pMask_vec, tC_rMask_vec, tC_gMask_vec);
+      }
+      // sub-byte vectorization, must serialize threads
+      else {
+        // Assumes no inter-warp sharing of bytes (most copy layouts should satisfy this)
+        int lane_idx = canonical_lane_idx();
+        Tensor tC_pMask = cute::lazy::transform(tCcD, [&](auto const& c){ return elem_less(c, residue_tCcD); });
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int i = 0; i < NumThreadsPerWarp; ++i) {
+          if (lane_idx == i) {
+            copy_if(tC_pMask, tC_rMask, tC_gMask);
+          }
+          __syncwarp();
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    gmem_ptr ptr_mask = make_gmem_ptr<cutlass::uint1b_t>(params_ptr->ptr_mask);
+    Tensor mMask = make_tensor(ptr_mask, make_layout(make_shape(M,N,L), params_ptr->dMask));                 // (M,N,L)
+    Tensor gMask = local_tile(mMask, take<0,2>(args.tile_shape_mnk), make_coord(m,n,l));               // (CTA_M,CTA_N)
+
+    Tensor tC_gMask = sm90_partition_for_epilogue<ReferenceSrc>(                       // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                        gMask, args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tC_rMask = make_tensor<cutlass::uint1b_t>(shape(tC_gMask));                 // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    // tCcD is relative to the first element of the thread, residue_tCcD holds the distance to the problem edge
+    int64_t thread_row = int64_t(l) * int64_t(M) + (M - get<0>(args.residue_tCcD));
+    int thread_n = N - get<1>(args.residue_tCcD);
+
+    uint64_t seed = params_ptr->seed_ptr != nullptr ? *params_ptr->seed_ptr : params_ptr->seed;
+    uint64_t offset = params_ptr->offset_ptr != nullptr ? *params_ptr->offset_ptr : params_ptr->offset;
+
+    return ConsumerStoreCallbacks<decltype(tC_rMask), decltype(tC_gMask), decltype(args.tCcD), decltype(args.residue_tCcD)>(
+      cute::move(tC_rMask), cute::move(tC_gMask), args.tCcD, args.residue_tCcD,
+      thread_row, thread_n, N, seed, offset, params_ptr);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
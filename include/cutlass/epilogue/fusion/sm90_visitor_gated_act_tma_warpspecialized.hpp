@@ -40,6 +40,7 @@
 
 #include "cute/tensor.hpp"
 
+#include "cutlass/epilogue/fusion/operations.hpp"
 #include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"       // Sm90EVT
 #include "cutlass/epilogue/fusion/sm90_visitor_load_tma_warpspecialized.hpp"    // Sm90ScalarBroadcast(PtrArray)
 #include "cutlass/epilogue/fusion/sm90_visitor_store_tma_warpspecialized.hpp"   // Sm90Aux(Array)Store
@@ -321,26 +322,6 @@ struct Sm90GatedActivation
   }
 };
 
-template<
-  bool Quantize, // whether to quantize output with a per-tensor scale factor
-  template <class> class ActivationFn,
-  class GmemLayoutTagOutput,
-  class ElementOutput,
-  class ElementCompute,
-  class ElementSource = ElementOutput,
-  class ElementScalar = ElementCompute,
-  class ElementIntermediate = ElementOutput,
-  int Alignment = 128 / cute::sizeof_bits_v<ElementOutput>,
-  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
->
-struct LinCombGatedActFunc
-    : LinearCombination<ElementOutput, ElementCompute, ElementSource, ElementScalar, RoundStyle> {
-  using ElementAux = ElementOutput;
-  using GmemLayoutTagAux = GmemLayoutTagOutput;
-  static constexpr int AlignmentAux = Alignment;
-  static constexpr bool IsAuxOutSupported = true;
-};
-
 template<
   bool PtrArray,
   bool Quantize,
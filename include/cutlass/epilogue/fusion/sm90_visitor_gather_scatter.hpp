@@ -0,0 +1,402 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Visitor tree indexed broadcast and scatter store operations for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Indexed (permuted) row operations, e.g. for MoE expert GEMMs whose rows are tokens routed
+// through a permutation. Row m of the tile maps to row index(m) of the gathered vector or of the
+// scattered output; negative indices mark padding rows.
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Column vector broadcast gathered through an index vector
+//   C(m,n,l) = index(m,l) < 0 ? null_default : col(index(m,l),l)
+// A nullptr index vector is the identity permutation, a nullptr col vector broadcasts
+// null_default. Indices address the col vector directly so it is loaded element-wise.
+template<
+  class ElementInput,
+  class ElementCompute = ElementInput,
+  class ElementIndex = int32_t,
+  class StrideMNL_ = Stride<_1,_0,int64_t>,
+  bool EnableNullptr = true // Fallback scalar broadcast for nullptr params
+>
+struct Sm90ColBroadcastGather {
+  using StrideMNL = StrideMNL_;
+  using StrideIndex = Stride<_1,_0,int64_t>;
+  static_assert(take<0,2>(StrideMNL{}) == Stride<_1,_0>{});
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementInput const* ptr_col = nullptr;
+    ElementIndex const* ptr_index = nullptr;
+    ElementInput null_default = ElementInput(0);
+    StrideMNL dCol = {};
+    StrideIndex dIndex = {};
+  };
+
+  struct Params {
+    ElementInput const* ptr_col = nullptr;
+    ElementIndex const* ptr_index = nullptr;
+    ElementCompute null_default = ElementCompute(0);
+    StrideMNL dCol = {};
+    StrideIndex dIndex = {};
+  };
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return {args.ptr_col, args.ptr_index, ElementCompute(args.null_default), args.dCol, args.dIndex};
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_zero() const {
+    return EnableNullptr && params.ptr_col == nullptr && params.null_default == ElementCompute(0);
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ColBroadcastGather() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ColBroadcastGather(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class RTensor, class CTensor, class ThrResidue>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(RTensor tCrCol_, CTensor tCcCol_, ThrResidue residue_tCcCol_,
+                           int thread_m_, int l_, Params const& params_)
+      : tCrCol(tCrCol_),
+        tCcCol(tCcCol_),
+        residue_tCcCol(residue_tCcCol_),
+        thread_m(thread_m_),
+        l(l_),
+        params(params_) {
+      if (EnableNullptr && params.ptr_col == nullptr) {
+        fill(tCrCol, params.null_default);
+      }
+    }
+
+    RTensor tCrCol;                                                                    // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    CTensor tCcCol;                                                                    // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ThrResidue residue_tCcCol;
+    int thread_m; // first row of the thread
+    int l;
+    Params const& params;
+
+    CUTLASS_DEVICE void
+    begin() {
+      if (EnableNullptr && params.ptr_col == nullptr) {
+        return;
+      }
+
+      // Filter so we only gather once per row, the stride-0 modes of tCrCol are the N modes
+      Tensor tCrCol_flt = filter_zeros(tCrCol);
+      Tensor tCcCol_flt = filter_zeros(tCcCol, tCrCol.stride());
+
+      ElementInput const* ptr_col = params.ptr_col + int64_t(l) * int64_t(get<2>(params.dCol));
+      ElementIndex const* ptr_index = params.ptr_index + int64_t(l) * int64_t(get<2>(params.dIndex));
+      NumericConverter<ElementCompute, ElementInput> convert_input{};
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tCrCol_flt); ++i) {
+        ElementCompute value = params.null_default;
+        if (elem_less(tCcCol_flt(i), residue_tCcCol)) {
+          int row = thread_m + int(get<0>(tCcCol_flt(i)));
+          int64_t index = params.ptr_index != nullptr ? int64_t(ptr_index[row]) : int64_t(row);
+          if (index >= 0) {
+            value = convert_input(ptr_col[index]);
+          }
+        }
+        tCrCol_flt(i) = value;
+      }
+    }
+
+    template <typename ElementAccumulator, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementCompute, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n) {
+      Array<ElementCompute, FragmentSize> frg_col;
+      Tensor tCrCol_mn = tCrCol(_,_,_,epi_m,epi_n);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        frg_col[i] = tCrCol_mn(epi_v * FragmentSize + i);
+      }
+
+      return frg_col;
+    }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // Only used for its layout, so the register tensor has stride-0 N modes
+    Tensor mCol = make_tensor(make_gmem_ptr(params.ptr_col), make_layout(make_shape(M,N,L), params.dCol));
+    Tensor tCgCol = sm90_partition_for_epilogue<ReferenceSrc>(                         // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+      mCol, args.tile_shape_mnk, args.tile_coord_mnkl, args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCrCol = make_tensor_like<ElementCompute>(tCgCol);                          // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+
+    // tCcD is relative to the first element of the thread, residue_tCcD holds the distance to the problem edge
+    int thread_m = int(M) - int(get<0>(args.residue_tCcD));
+
+    return ConsumerStoreCallbacks<decltype(tCrCol), decltype(args.tCcD), decltype(args.residue_tCcD)>(
+      tCrCol, args.tCcD, args.residue_tCcD, thread_m, int(l), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Row scatter store through an index vector
+//   D(index(m,l),n,l) = Z(m,n,l)     or, with AtomicAdd,     D(index(m,l),n,l) += Z(m,n,l)
+// Rows with a negative index are dropped. With AtomicAdd the top-k expert outputs of a token
+// (already scaled by their routing weight, e.g. through Sm90ColBroadcastGather) accumulate into
+// the unpermuted output, which must be zero-initialized. Stores go straight from registers to
+// global memory and return the input so the node can be chained with other stores.
+template <
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class StrideMNL = Stride<int64_t,_1,int64_t>,
+  class ElementIndex = int32_t,
+  bool AtomicAdd = false,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct Sm90ScatterRowStore {
+  using StrideIndex = Stride<_1,_0,int64_t>;
+  static_assert(!AtomicAdd || is_same_v<ElementOutput, float> || is_same_v<ElementOutput, double>,
+    "Atomic scatter requires a float or double output");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_out = nullptr;
+    ElementIndex const* ptr_index = nullptr;
+    StrideMNL dOut = {};
+    StrideIndex dIndex = {};
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ScatterRowStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90ScatterRowStore(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class ThrResidue>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        CTensor tCcD,
+        ThrResidue residue_tCcD,
+        int thread_m,
+        int thread_n,
+        int l,
+        Params const* params_ptr)
+      : tCcD(tCcD),
+        residue_tCcD(residue_tCcD),
+        thread_m(thread_m),
+        thread_n(thread_n),
+        l(l),
+        params_ptr(params_ptr) { }
+
+    CTensor tCcD;                                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ThrResidue residue_tCcD;
+    int thread_m; // first row of the thread
+    int thread_n; // first column of the thread
+    int l;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementInput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if constexpr (EnableNullptr) {
+        if (params_ptr->ptr_out == nullptr) {
+          return frg_input;
+        }
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      Array frg_output = convert_input(frg_input);
+
+      auto [stride_m, stride_n, stride_l] = params_ptr->dOut;
+      ElementOutput* ptr_out = params_ptr->ptr_out + int64_t(l) * int64_t(stride_l);
+      ElementIndex const* ptr_index = params_ptr->ptr_index + int64_t(l) * int64_t(get<2>(params_ptr->dIndex));
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto coord = tCcD_mn(epi_v * FragmentSize + i);
+        if (elem_less(coord, residue_tCcD)) {
+          int row = thread_m + int(get<0>(coord));
+          int64_t index = params_ptr->ptr_index != nullptr ? int64_t(ptr_index[row]) : int64_t(row);
+          if (index >= 0) {
+            ElementOutput* ptr = ptr_out + index * int64_t(stride_m) + int64_t(thread_n + int(get<1>(coord))) * int64_t(stride_n);
+            if constexpr (AtomicAdd) {
+              atomic_add<ElementOutput>{}(ptr, frg_output[i]);
+            }
+            else {
+              *ptr = frg_output[i];
+            }
+          }
+        }
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // tCcD is relative to the first element of the thread, residue_tCcD holds the distance to the problem edge
+    int thread_m = int(M) - int(get<0>(args.residue_tCcD));
+    int thread_n = int(N) - int(get<1>(args.residue_tCcD));
+
+    return ConsumerStoreCallbacks<decltype(args.tCcD), decltype(args.residue_tCcD)>(
+      args.tCcD, args.residue_tCcD, thread_m, thread_n, int(l), params_ptr);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
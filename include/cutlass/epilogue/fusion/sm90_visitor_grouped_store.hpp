@@ -0,0 +1,233 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Visitor tree store with a runtime output type per group for sm90 ptr-array / grouped epilogues
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class GroupOutputType : uint8_t {
+  None,      // group output is not stored
+  F32,
+  F16,
+  BF16,
+  E4M3,
+  E5M2
+};
+
+// Per-group output descriptor, indexed by the group (L) coordinate of the tile
+struct GroupOutputDescriptor {
+  void* ptr = nullptr;
+  int64_t stride_m = 0;
+  int64_t stride_n = 1;
+  GroupOutputType type = GroupOutputType::None;
+  float const* scale_ptr = nullptr; // optional dequantized-to-quantized scale, D = convert(scale * Z)
+};
+
+// Output store whose element type is selected per group at runtime
+//   D_g(m,n) = convert<type_g>(scale_g * Z(m,n))
+// Lets one grouped launch write bf16 for some groups and fp8 (with a per-group scale) for others.
+// Stores go straight from registers to global memory, so the collective D should be void;
+// the input is returned so the node can sit at the root of the tree.
+template <
+  class ElementCompute,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90GroupedStore {
+  // Placeholder D element for collectives instantiated with a void D
+  using ElementAux = ElementCompute;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    GroupOutputDescriptor const* descriptors = nullptr; // device array, one per group
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    bool implementable = args.descriptors != nullptr;
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Grouped store requires an output descriptor array.\n");
+    }
+    return implementable;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90GroupedStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90GroupedStore(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class ThrResidue>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        CTensor tCcD,
+        ThrResidue residue_tCcD,
+        GroupOutputDescriptor desc,
+        int64_t thread_offset,
+        ElementCompute scale)
+      : tCcD(tCcD),
+        residue_tCcD(residue_tCcD),
+        desc(desc),
+        thread_offset(thread_offset),
+        scale(scale) { }
+
+    CTensor tCcD;                                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ThrResidue residue_tCcD;
+    GroupOutputDescriptor desc;
+    int64_t thread_offset; // element offset of the first element of the thread
+    ElementCompute scale;
+
+    template <class ElementOutput, int FragmentSize, class CoordTensor>
+    CUTLASS_DEVICE void
+    store(Array<ElementCompute, FragmentSize> const& frg_compute, CoordTensor const& tCcD_mn, int epi_v) {
+      NumericArrayConverter<ElementOutput, ElementCompute, FragmentSize, RoundStyle> convert_output{};
+      Array frg_output = convert_output(frg_compute);
+      ElementOutput* ptr = static_cast<ElementOutput*>(desc.ptr) + thread_offset;
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto coord = tCcD_mn(epi_v * FragmentSize + i);
+        if (elem_less(coord, residue_tCcD)) {
+          ptr[int64_t(get<0>(coord)) * desc.stride_m + int64_t(get<1>(coord)) * desc.stride_n] = frg_output[i];
+        }
+      }
+    }
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementInput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if (desc.type == GroupOutputType::None || desc.ptr == nullptr) {
+        return frg_input;
+      }
+
+      NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle> convert_input{};
+      multiplies<Array<ElementCompute, FragmentSize>> mul{};
+      Array frg_compute = mul(convert_input(frg_input), scale);
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      // Group-uniform branch, the conversion and store width are picked once per fragment
+      switch (desc.type) {
+        case GroupOutputType::F32:  store<float, FragmentSize>(frg_compute, tCcD_mn, epi_v); break;
+        case GroupOutputType::F16:  store<half_t, FragmentSize>(frg_compute, tCcD_mn, epi_v); break;
+        case GroupOutputType::BF16: store<bfloat16_t, FragmentSize>(frg_compute, tCcD_mn, epi_v); break;
+        case GroupOutputType::E4M3: store<float_e4m3_t, FragmentSize>(frg_compute, tCcD_mn, epi_v); break;
+        case GroupOutputType::E5M2: store<float_e5m2_t, FragmentSize>(frg_compute, tCcD_mn, epi_v); break;
+        default: break;
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    GroupOutputDescriptor desc = params_ptr->descriptors[l];
+    ElementCompute scale = desc.scale_ptr != nullptr ? ElementCompute(*desc.scale_ptr) : ElementCompute(1);
+
+    // tCcD is relative to the first element of the thread, residue_tCcD holds the distance to the problem edge
+    int64_t thread_m = int64_t(M) - int64_t(get<0>(args.residue_tCcD));
+    int64_t thread_n = int64_t(N) - int64_t(get<1>(args.residue_tCcD));
+    int64_t thread_offset = thread_m * desc.stride_m + thread_n * desc.stride_n;
+
+    return ConsumerStoreCallbacks<decltype(args.tCcD), decltype(args.residue_tCcD)>(
+      args.tCcD, args.residue_tCcD, desc, thread_offset, scale);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
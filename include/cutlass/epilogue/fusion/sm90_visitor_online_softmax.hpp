@@ -0,0 +1,756 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree online-softmax row statistics and cross entropy loss for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Running softmax statistics of one row over a range of columns
+template <class Element>
+struct OnlineSoftmaxPartial {
+  Element max_ = -cutlass::platform::numeric_limits<Element>::infinity();
+  Element sum_ = Element(0);     // sum of exp(x - max_)
+
+  CUTLASS_HOST_DEVICE
+  void add(Element x) {
+    Element new_max = cutlass::fast_max(max_, x);
+    sum_ = sum_ * cutlass::fast_exp(max_ - new_max) + cutlass::fast_exp(x - new_max);
+    max_ = new_max;
+  }
+
+  CUTLASS_HOST_DEVICE
+  void merge(OnlineSoftmaxPartial const& other) {
+    Element new_max = cutlass::fast_max(max_, other.max_);
+    if (new_max == -cutlass::platform::numeric_limits<Element>::infinity()) {
+      return;
+    }
+    sum_ = sum_ * cutlass::fast_exp(max_ - new_max) + other.sum_ * cutlass::fast_exp(other.max_ - new_max);
+    max_ = new_max;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Element logsumexp() const {
+    return max_ + cutlass::fast_log(sum_);
+  }
+};
+
+// Largest TopK values of one row over a range of columns, sorted in descending order
+template <class Element, int TopK>
+struct OnlineSoftmaxTopK {
+  Array<Element, TopK> value_;
+  Array<int32_t, TopK> index_;
+
+  CUTLASS_HOST_DEVICE
+  OnlineSoftmaxTopK() {
+    value_.fill(-cutlass::platform::numeric_limits<Element>::infinity());
+    index_.fill(-1);
+  }
+
+  CUTLASS_HOST_DEVICE
+  void add(Element x, int32_t idx) {
+    if (not (x > value_[TopK - 1])) {
+      return;
+    }
+    int k = TopK - 1;
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = TopK - 1; j > 0; --j) {
+      if (k == j && x > value_[j - 1]) {
+        value_[j] = value_[j - 1];
+        index_[j] = index_[j - 1];
+        k = j - 1;
+      }
+    }
+    value_[k] = x;
+    index_[k] = idx;
+  }
+
+  CUTLASS_HOST_DEVICE
+  void merge(OnlineSoftmaxTopK const& other) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int j = 0; j < TopK; ++j) {
+      add(other.value_[j], other.index_[j]);
+    }
+  }
+};
+
+// Online softmax reduction across columns
+// Accumulates, for every row of the CTA tile, the running max and sum of exponentials over the
+// tile's columns, and optionally the TopK largest values with their column indices. One partial
+// per (row, N tile) is written to compact m-major tensors of shape
+// (round_nearest(M,CTA_M), ceil_div(N,CTA_N), L), so that an LM-head GEMM over a wide vocabulary
+// never has to re-read its logits: the partials of a row are merged with
+// OnlineSoftmaxPartial::merge / OnlineSoftmaxTopK::merge to obtain its logsumexp and candidates.
+//
+// The visited values are passed through, converted to ElementOutput.
+//
+//   Assumptions:
+//     1. A row of the epilogue tile is held by a single warp (true for the SM90 and SM100
+//        TMA warp-specialized epilogues).
+//
+template <
+  int TopK,
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle
+>
+struct Sm90OnlineSoftmaxColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Online softmax reduction requires FP32 accumulation.");
+  static_assert(TopK >= 0 && TopK <= 8, "Online softmax reduction keeps at most 8 candidates per row and tile.");
+
+  static constexpr bool HasTopK = TopK > 0;
+
+public:
+  using Partial = OnlineSoftmaxPartial<ElementCompute>;
+  using Candidates = OnlineSoftmaxTopK<ElementCompute, cute::max(TopK, 1)>;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    Partial* ptr_partials = nullptr;      // (round_nearest(M,CTA_M), ceil_div(N,CTA_N), L), m-major
+    Candidates* ptr_topk = nullptr;       // same layout as ptr_partials, only used if TopK > 0
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90OnlineSoftmaxColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90OnlineSoftmaxColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertOutput convert_output{};
+
+      if (params.ptr_partials == nullptr) {
+        return convert_output(frg_input);
+      }
+
+      auto& [ref_src, tCrPartial, tCrTopK, tCcCol, cCol, gPartial_l, gTopK_l,
+              lane_layout_MN, lane_mn, tile_coord_mnkl, thread_n, residue_cCol, residue_tCcCol,
+              epi_tile, tiled_copy, thread_idx] = args_tuple;
+      Tensor tCrPartial_mn = tCrPartial(_,_,_,epi_m,epi_n);
+      Tensor tCrTopK_mn = tCrTopK(_,_,_,epi_m,epi_n);
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcCol_mn(epi_v * FragmentSize + i);
+        if (elem_less(thread_crd, residue_tCcCol)) {
+          tCrPartial_mn(epi_v * FragmentSize + i).add(frg_I[i]);
+          if constexpr (HasTopK) {
+            int32_t n = thread_n + get<1>(thread_crd);
+            tCrTopK_mn(epi_v * FragmentSize + i).add(frg_I[i], n);
+          }
+        }
+      }
+
+      return convert_output(frg_input);
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (not is_last_iteration || params.ptr_partials == nullptr) {
+        return;
+      }
+
+      auto& [ref_src, tCrPartial, tCrTopK, tCcCol, cCol, gPartial_l, gTopK_l,
+              lane_layout_MN, lane_mn, tile_coord_mnkl, thread_n, residue_cCol, residue_tCcCol,
+              epi_tile, tiled_copy, thread_idx] = args_tuple;
+      auto [m, n, k, l] = tile_coord_mnkl;
+      constexpr bool ReferenceSrc = decltype(ref_src)::value;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+
+      //
+      // 1. Warp shuffle reduction
+      //
+      // Filter so we don't shuffle or store redundant copies over stride-0 modes
+      Tensor tCrPartial_flt = filter_zeros(tCrPartial);
+      Tensor tCrTopK_flt = filter_zeros(tCrTopK);
+      CUTLASS_PRAGMA_UNROLL
+      for (int reduction_cols = size<1>(lane_layout_MN) / 2; reduction_cols > 0; reduction_cols /= 2) {
+        int delta = lane_layout_MN(_0{},reduction_cols);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrPartial_flt); ++i) {
+          Partial other;
+          other.max_ = __shfl_down_sync(0xFFFFFFFF, tCrPartial_flt(i).max_, delta);
+          other.sum_ = __shfl_down_sync(0xFFFFFFFF, tCrPartial_flt(i).sum_, delta);
+          tCrPartial_flt(i).merge(other);
+          if constexpr (HasTopK) {
+            Candidates other_topk;
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < TopK; ++j) {
+              other_topk.value_[j] = __shfl_down_sync(0xFFFFFFFF, tCrTopK_flt(i).value_[j], delta);
+              other_topk.index_[j] = __shfl_down_sync(0xFFFFFFFF, tCrTopK_flt(i).index_[j], delta);
+            }
+            tCrTopK_flt(i).merge(other_topk);
+          }
+        }
+      }
+
+      //
+      // 2. Reduced lanes write the row partials of this N tile
+      //
+      if (get<1>(lane_mn) == 0) {
+        Tensor tCcCol_flt = make_tensor(tCcCol.data(), make_layout(tCrPartial_flt.shape(), tCcCol.stride()));
+        Tensor tCgPartial = sm90_partition_for_epilogue<ReferenceSrc>(gPartial_l(_,_,n,l), epi_tile, tiled_copy, thread_idx);
+        Tensor tCgPartial_flt = filter_zeros(tCgPartial);
+        Tensor tCgTopK = sm90_partition_for_epilogue<ReferenceSrc>(gTopK_l(_,_,n,l), epi_tile, tiled_copy, thread_idx);
+        Tensor tCgTopK_flt = filter_zeros(tCgTopK);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrPartial_flt); ++i) {
+          // Only the row matters here, every column of the row has been reduced
+          if (get<0>(tCcCol_flt(i)) < get<0>(residue_tCcCol)) {
+            tCgPartial_flt(i) = tCrPartial_flt(i);
+            if constexpr (HasTopK) {
+              if (params.ptr_topk != nullptr) {
+                tCgTopK_flt(i) = tCrTopK_flt(i);
+              }
+            }
+          }
+        }
+      }
+      sync_fn();
+    }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      auto mn_shape = shape(typename decltype(args.tiled_copy)::Tiler_MN{});
+      if constexpr (ReferenceSrc) { return right_inverse(args.tiled_copy.get_layoutS_TV()).with_shape(mn_shape); }
+      else                        { return right_inverse(args.tiled_copy.get_layoutD_TV()).with_shape(mn_shape); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout + coord of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+    Layout inv_lane_layout_MN = right_inverse(lane_layout_MN);                                  // lane_idx -> lane_mn
+    int lane_idx = canonical_lane_idx();
+    auto lane_mn = idx2crd(inv_lane_layout_MN(lane_idx), shape(lane_layout_MN));
+
+    // Get the MN layout of warps to make sure a row never spans warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1,
+      "Online softmax reduction requires a single warp across N of the epilogue tile.");
+
+    auto [tile_M, tile_N, tile_K] = args.tile_shape_mnk;
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // Compact m-major partial tensors, broadcast along the columns of a tile
+    Layout gBuf_layout = make_layout(take<0,2>(args.tile_shape_mnk), make_stride(_1{}, _0{}));
+    Layout mBuf_layout = blocked_product(gBuf_layout, make_layout(ceil_div(make_shape(M,N,L), shape(gBuf_layout))));
+    Tensor mPartial = make_tensor(make_gmem_ptr(params.ptr_partials), mBuf_layout);                // (ceil_M,ceil_N,L)
+    Tensor gPartial_l = local_tile(mPartial, take<0,2>(args.tile_shape_mnk), make_coord(m,_,_));  // (CTA_M,CTA_N,REST_N,L)
+    Tensor mTopK = make_tensor(make_gmem_ptr(params.ptr_topk), mBuf_layout);                       // (ceil_M,ceil_N,L)
+    Tensor gTopK_l = local_tile(mTopK, take<0,2>(args.tile_shape_mnk), make_coord(m,_,_));        // (CTA_M,CTA_N,REST_N,L)
+
+    // Thread coordinates are relative to the thread's first element, this is its global column
+    int32_t thread_n = N - get<1>(args.residue_tCcD);
+
+    // Register state of the rows this thread visits, stride-0 along N
+    Tensor tCgPartial = sm90_partition_for_epilogue<ReferenceSrc>(                     // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                          gPartial_l(_,_,n,l), args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCrPartial = make_tensor_like<Partial>(tCgPartial);                         // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrTopK = make_tensor_like<Candidates>(tCgPartial);                         // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    fill(tCrPartial, Partial{});
+    if constexpr (HasTopK) {
+      fill(tCrTopK, Candidates{});
+    }
+
+    auto args_tuple = make_tuple(
+        bool_constant<ReferenceSrc>{}, cute::move(tCrPartial), cute::move(tCrTopK), args.tCcD, args.cD,
+        gPartial_l, gTopK_l, lane_layout_MN, lane_mn, args.tile_coord_mnkl, thread_n,
+        args.residue_cD, args.residue_tCcD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Softmax statistics of one row over a range of columns, with the logit of the row's target column
+template <class Element>
+struct CrossEntropyPartial : OnlineSoftmaxPartial<Element> {
+  Element target_ = -cutlass::platform::numeric_limits<Element>::infinity();
+
+  CUTLASS_HOST_DEVICE
+  void merge(CrossEntropyPartial const& other) {
+    OnlineSoftmaxPartial<Element>::merge(other);
+    target_ = cutlass::fast_max(target_, other.target_);
+  }
+};
+
+// Cross entropy loss reduction across columns
+// For every row m with target column t(m), computes
+//   loss(m) = logsumexp_n(x(m,n)) - x(m,t(m))
+// over the whole N extent without writing the logits. Each CTA reduces its N tile into a
+// (row, N tile) partial in the workspace; the last CTA of an M tile to finish merges the
+// partials and writes the loss. The row logsumexp is written as well if ptr_lse is set, it
+// is the scaling factor for the logits gradient:
+//   dlogits(m,n) = dloss(m) * (exp(x(m,n) - lse(m)) - (n == t(m)))
+// Rows whose target is ignore_index get a loss of 0.
+// The visited values are passed through, converted to ElementOutput.
+//
+//   Assumptions:
+//     1. A row of the epilogue tile is held by a single warp.
+//     2. Targets, loss and lse are (M,L) tensors with stride (1,M).
+//
+template <
+  class CtaTileShapeMNK,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle
+>
+struct Sm90CrossEntropyColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Cross entropy reduction requires FP32 accumulation.");
+
+public:
+  using Partial = CrossEntropyPartial<ElementCompute>;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    int32_t const* ptr_targets = nullptr;
+    ElementCompute* ptr_loss = nullptr;
+    ElementCompute* ptr_lse = nullptr;
+    int32_t ignore_index = -100;
+  };
+
+  struct Params {
+    int32_t const* ptr_targets = nullptr;
+    ElementCompute* ptr_loss = nullptr;
+    ElementCompute* ptr_lse = nullptr;
+    int32_t ignore_index = -100;
+    Partial* reduction_buffer = nullptr;
+    int* tile_counters = nullptr;
+  };
+
+  template <class ProblemShape>
+  static size_t
+  get_tile_counters_offset(ProblemShape const& problem_shape) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    size_t offset = product(ceil_div(make_shape(M,N,L), make_shape(tile_M, tile_N))) * tile_M * sizeof(Partial);
+    return round_nearest(offset, MinWorkspaceAlignment);
+  }
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return {
+      args.ptr_targets,
+      args.ptr_loss,
+      args.ptr_lse,
+      args.ignore_index,
+      reinterpret_cast<Partial*>(workspace),
+      reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + get_tile_counters_offset(problem_shape))
+    };
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return args.ptr_targets != nullptr && args.ptr_loss != nullptr;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    // Partials, then one tile counter per M tile and batch
+    return get_tile_counters_offset(problem_shape) + cute::ceil_div(M, tile_M) * L * sizeof(int);
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    auto problem_shape_mnkl = append<4>(problem_shape, 1);
+    auto [M, N, K, L] = problem_shape_mnkl;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    int* tile_counters = reinterpret_cast<int*>(reinterpret_cast<uint8_t*>(workspace) + get_tile_counters_offset(problem_shape));
+    size_t tile_counters_size = cute::ceil_div(M, tile_M) * L * sizeof(int);
+    return zero_workspace(tile_counters, tile_counters_size, stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90CrossEntropyColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90CrossEntropyColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+    bool do_final_reduction = false;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      auto& [ref_src, tCrPartial, tCrTarget, tCcCol, cCol, gBuf_nl, lane_layout_MN, lane_mn,
+              tile_coord_mnkl, problem_shape_mnkl, thread_n, residue_cCol, residue_tCcCol,
+              epi_tile, tiled_copy, thread_idx] = args_tuple;
+      Tensor tCrPartial_mn = tCrPartial(_,_,_,epi_m,epi_n);
+      Tensor tCrTarget_mn = tCrTarget(_,_,_,epi_m,epi_n);
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcCol_mn(epi_v * FragmentSize + i);
+        if (elem_less(thread_crd, residue_tCcCol)) {
+          Partial& partial = tCrPartial_mn(epi_v * FragmentSize + i);
+          partial.add(frg_I[i]);
+          if (tCrTarget_mn(epi_v * FragmentSize + i) == thread_n + get<1>(thread_crd)) {
+            partial.target_ = frg_I[i];
+          }
+        }
+      }
+
+      return convert_output(frg_input);
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (not is_last_iteration) {
+        return;
+      }
+
+      auto& [ref_src, tCrPartial, tCrTarget, tCcCol, cCol, gBuf_nl, lane_layout_MN, lane_mn,
+              tile_coord_mnkl, problem_shape_mnkl, thread_n, residue_cCol, residue_tCcCol,
+              epi_tile, tiled_copy, thread_idx] = args_tuple;
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [M, N, K, L] = problem_shape_mnkl;
+      constexpr bool ReferenceSrc = decltype(ref_src)::value;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+
+      //
+      // 1. Warp shuffle reduction
+      //
+      Tensor tCrPartial_flt = filter_zeros(tCrPartial);
+      CUTLASS_PRAGMA_UNROLL
+      for (int reduction_cols = size<1>(lane_layout_MN) / 2; reduction_cols > 0; reduction_cols /= 2) {
+        int delta = lane_layout_MN(_0{},reduction_cols);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrPartial_flt); ++i) {
+          Partial other;
+          other.max_ = __shfl_down_sync(0xFFFFFFFF, tCrPartial_flt(i).max_, delta);
+          other.sum_ = __shfl_down_sync(0xFFFFFFFF, tCrPartial_flt(i).sum_, delta);
+          other.target_ = __shfl_down_sync(0xFFFFFFFF, tCrPartial_flt(i).target_, delta);
+          tCrPartial_flt(i).merge(other);
+        }
+      }
+
+      //
+      // 2. Reduced lanes dump the row partials of this N tile to the gmem workspace
+      //
+      if (get<1>(lane_mn) == 0) {
+        Tensor tCcCol_flt = make_tensor(tCcCol.data(), make_layout(tCrPartial_flt.shape(), tCcCol.stride()));
+        Tensor tCgBuf = sm90_partition_for_epilogue<ReferenceSrc>(gBuf_nl(_,_,n,l), epi_tile, tiled_copy, thread_idx);
+        Tensor tCgBuf_flt = filter_zeros(tCgBuf);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrPartial_flt); ++i) {
+          if (get<0>(tCcCol_flt(i)) < get<0>(residue_tCcCol)) {
+            Partial volatile& dst = tCgBuf_flt(i);
+            dst.max_ = tCrPartial_flt(i).max_;
+            dst.sum_ = tCrPartial_flt(i).sum_;
+            dst.target_ = tCrPartial_flt(i).target_;
+          }
+        }
+      }
+
+      //
+      // 3. Increment atomic counters to signal final gmem reduction
+      //
+      // Ensure gmem writes are visible to other threads before incrementing counter
+      __threadfence();
+      sync_fn();
+      // Collective thread 0 increments atomic tile counter and copies value to smem
+      int* prev_tile_count = reinterpret_cast<int*>(raw_pointer_cast(smem_buffer.data()));
+      if (thread_idx == 0) {
+        int tiles_m = ceil_div(M, int(size<0>(CtaTileShapeMNK{})));
+        *prev_tile_count = atomicAdd(&params.tile_counters[m + l * tiles_m], 1);
+      }
+      sync_fn();
+      // Broadcast tile count to other threads in CTA and determine final reduction status
+      do_final_reduction = *prev_tile_count == size<2>(gBuf_nl) - 1;
+      sync_fn();
+    }
+
+    CUTLASS_DEVICE void
+    end() {
+      //
+      // 4. The last CTA of the M tile merges the partials of all N tiles
+      //
+      if (not do_final_reduction) {
+        return;
+      }
+
+      auto& [ref_src, tCrPartial, tCrTarget, tCcCol, cCol, gBuf_nl, lane_layout_MN, lane_mn,
+              tile_coord_mnkl, problem_shape_mnkl, thread_n, residue_cCol, residue_tCcCol,
+              epi_tile, tiled_copy, thread_idx] = args_tuple;
+      auto [m, n, k, l] = tile_coord_mnkl;
+      auto [M, N, K, L] = problem_shape_mnkl;
+      int tile_M = size<0>(CtaTileShapeMNK{});
+
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int row = thread_idx; row < size<0>(gBuf_nl); row += size(tiled_copy)) {
+        if (not elem_less(cCol(row,_0{}), residue_cCol)) {
+          continue;
+        }
+        Partial partial;
+        CUTLASS_PRAGMA_NO_UNROLL
+        for (int n_tile = 0; n_tile < size<2>(gBuf_nl); ++n_tile) {
+          Partial volatile const& src = gBuf_nl(row,_0{},n_tile,l);
+          Partial other;
+          other.max_ = src.max_;
+          other.sum_ = src.sum_;
+          other.target_ = src.target_;
+          partial.merge(other);
+        }
+        int64_t idx = int64_t(m * tile_M + row) + int64_t(l) * M;
+        ElementCompute lse = partial.logsumexp();
+        bool ignored = params.ptr_targets[idx] == params.ignore_index;
+        params.ptr_loss[idx] = ignored ? ElementCompute(0) : lse - partial.target_;
+        if (params.ptr_lse != nullptr) {
+          params.ptr_lse[idx] = lse;
+        }
+      }
+    }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      auto mn_shape = shape(typename decltype(args.tiled_copy)::Tiler_MN{});
+      if constexpr (ReferenceSrc) { return right_inverse(args.tiled_copy.get_layoutS_TV()).with_shape(mn_shape); }
+      else                        { return right_inverse(args.tiled_copy.get_layoutD_TV()).with_shape(mn_shape); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout + coord of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+    Layout inv_lane_layout_MN = right_inverse(lane_layout_MN);                                  // lane_idx -> lane_mn
+    int lane_idx = canonical_lane_idx();
+    auto lane_mn = idx2crd(inv_lane_layout_MN(lane_idx), shape(lane_layout_MN));
+
+    // Get the MN layout of warps to make sure a row never spans warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1,
+      "Cross entropy reduction requires a single warp across N of the epilogue tile.");
+
+    auto [tile_M, tile_N, tile_K] = args.tile_shape_mnk;
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // Partition gmem reduction buffer tensors
+    Layout gBuf_layout = make_layout(take<0,2>(args.tile_shape_mnk), make_stride(_1{}, _0{}));
+    Layout mBuf_layout = blocked_product(gBuf_layout, make_layout(ceil_div(make_shape(M,N,L), shape(gBuf_layout))));
+    Tensor mBuf = make_tensor(make_gmem_ptr(params.reduction_buffer), mBuf_layout);                // (ceil_M,ceil_N,L)
+    Tensor gBuf_nl = local_tile(mBuf, take<0,2>(args.tile_shape_mnk), make_coord(m,_,_));     // (CTA_M,CTA_N,REST_N,L)
+
+    // Register state of the rows this thread visits, stride-0 along N
+    Tensor tCgBuf = sm90_partition_for_epilogue<ReferenceSrc>(                         // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                      gBuf_nl(_,_,n,l), args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCrPartial = make_tensor_like<Partial>(tCgBuf);                             // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrTarget = make_tensor_like<int32_t>(tCgBuf);                              // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    fill(tCrPartial, Partial{});
+
+    // Thread coordinates are relative to the thread's first element, this is its global (m,n)
+    int32_t thread_m = M - get<0>(args.residue_tCcD);
+    int32_t thread_n = N - get<1>(args.residue_tCcD);
+
+    // Fetch the target column of every row once
+    Tensor tCrTarget_flt = filter_zeros(tCrTarget);
+    Tensor tCcCol_flt = make_tensor(args.tCcD.data(), make_layout(tCrTarget_flt.shape(), args.tCcD.stride()));
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < size(tCrTarget_flt); ++i) {
+      int row = get<0>(tCcCol_flt(i));
+      tCrTarget_flt(i) = row < get<0>(args.residue_tCcD)
+        ? params.ptr_targets[int64_t(thread_m + row) + int64_t(l) * M]
+        : params.ignore_index;
+    }
+
+    auto args_tuple = make_tuple(
+        bool_constant<ReferenceSrc>{}, cute::move(tCrPartial), cute::move(tCrTarget), args.tCcD, args.cD,
+        gBuf_nl, lane_layout_MN, lane_mn, args.tile_coord_mnkl, args.problem_shape_mnkl, thread_n,
+        args.residue_cD, args.residue_tCcD, args.epi_tile, args.tiled_copy, args.thread_idx);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,268 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Visitor tree store operations into peer device memory for sm90 TMA warp-specialized epilogue
+
+  Lets a row-parallel tensor-parallel GEMM push its output over NVLink while it runs, so the
+  all-reduce (or reduce-scatter) overlaps the GEMM instead of starting after it. Not included by
+  the default fusion callbacks since it depends on the experimental distributed helpers.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class PeerStoreMode {
+  Store,          // st.global into a peer-mapped buffer (P2P / IPC / symmetric memory)
+  AtomicAdd,      // atomic add into a peer-mapped buffer, reduces partials from several devices
+  MultimemReduce  // multimem.red into a multicast buffer, every bound device receives the sum
+};
+
+// Store into peer device memory with a completion flag per output tile
+//   Store / AtomicAdd:  P(m,n,l) = Z(m,n,l)  /  P(m,n,l) += Z(m,n,l), P peer-mapped
+//   MultimemReduce:     P_d(m,n,l) += Z(m,n,l) on every device d bound to the multicast P
+// Once all epilogue threads have issued the stores of a tile, one thread adds 1 to
+// ptr_tile_flags[tile] with system scope release semantics (a multimem reduction for
+// MultimemReduce, so the flag advances on every device). Tiles are linearized as
+// m + n * tiles_m + l * tiles_m * tiles_n over the CTA tile shape. Flags only increase:
+// a consumer waits with distributed::kernel::detail::wait_flag for epoch * (number of
+// producing devices). Stores are issued element-wise from registers in visit, the input is
+// returned so the local output is still written by the regular D store.
+template <
+  class ElementOutput,
+  FloatRoundStyle RoundStyle,
+  PeerStoreMode Mode = PeerStoreMode::Store,
+  class StrideMNL = Stride<int64_t,_1,int64_t>,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct Sm90PeerStore {
+  static_assert(Mode != PeerStoreMode::AtomicAdd ||
+                is_same_v<ElementOutput, float> || is_same_v<ElementOutput, double>,
+    "Peer atomic add requires a float or double output");
+  static_assert(Mode != PeerStoreMode::MultimemReduce ||
+                is_same_v<ElementOutput, float> || is_same_v<ElementOutput, cutlass::half_t> ||
+                is_same_v<ElementOutput, cutlass::bfloat16_t>,
+    "Multimem reduction requires a float, half_t or bfloat16_t output");
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_peer = nullptr;    // peer-mapped, or multicast for MultimemReduce
+    StrideMNL dPeer = {};
+    uint32_t* ptr_tile_flags = nullptr;   // optional, same address space as ptr_peer
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90PeerStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90PeerStore(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class ThrResidue>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        CTensor tCcD,
+        ThrResidue residue_tCcD,
+        ElementOutput* ptr_peer_thr,
+        uint32_t* ptr_flag,
+        int thread_idx,
+        Params const* params_ptr)
+      : tCcD(tCcD),
+        residue_tCcD(residue_tCcD),
+        ptr_peer_thr(ptr_peer_thr),
+        ptr_flag(ptr_flag),
+        thread_idx(thread_idx),
+        params_ptr(params_ptr) { }
+
+    CTensor tCcD;                                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ThrResidue residue_tCcD;
+    ElementOutput* ptr_peer_thr; // first element of the thread
+    uint32_t* ptr_flag;          // flag of the current tile
+    int thread_idx;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementInput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if constexpr (EnableNullptr) {
+        if (params_ptr->ptr_peer == nullptr) {
+          return frg_input;
+        }
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+      Array frg_output = convert_input(frg_input);
+
+      auto [stride_m, stride_n, stride_l] = params_ptr->dPeer;
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto coord = tCcD_mn(epi_v * FragmentSize + i);
+        if (elem_less(coord, residue_tCcD)) {
+          ElementOutput* ptr = ptr_peer_thr + int64_t(get<0>(coord)) * int64_t(stride_m)
+                                            + int64_t(get<1>(coord)) * int64_t(stride_n);
+          if constexpr (Mode == PeerStoreMode::MultimemReduce) {
+            distributed::kernel::detail::multimem_red_add(ptr, frg_output[i]);
+          }
+          else if constexpr (Mode == PeerStoreMode::AtomicAdd) {
+            atomic_add<ElementOutput>{}(ptr, frg_output[i]);
+          }
+          else {
+            *ptr = frg_output[i];
+          }
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      if (not is_last_iteration || ptr_flag == nullptr) {
+        return;
+      }
+      if constexpr (EnableNullptr) {
+        if (params_ptr->ptr_peer == nullptr) {
+          return;
+        }
+      }
+
+      // The last subtile was visited before this reduction, so every epilogue thread has issued
+      // its stores of the tile once past the barrier. The system scope release of the flag is
+      // cumulative over them.
+      sync_fn();
+      if (thread_idx == 0) {
+        if constexpr (Mode == PeerStoreMode::MultimemReduce) {
+          distributed::kernel::detail::multimem_red_release_sys_add(ptr_flag, 1u);
+        }
+        else {
+          distributed::kernel::detail::red_release_sys_add(ptr_flag, 1u);
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+    auto [stride_m, stride_n, stride_l] = params_ptr->dPeer;
+
+    // tCcD is relative to the first element of the thread, residue_tCcD holds the distance to the problem edge
+    int thread_m = int(M) - int(get<0>(args.residue_tCcD));
+    int thread_n = int(N) - int(get<1>(args.residue_tCcD));
+    ElementOutput* ptr_peer_thr = params_ptr->ptr_peer + int64_t(l) * int64_t(stride_l)
+                                + int64_t(thread_m) * int64_t(stride_m) + int64_t(thread_n) * int64_t(stride_n);
+
+    uint32_t* ptr_flag = nullptr;
+    if (params_ptr->ptr_tile_flags != nullptr) {
+      int tiles_m = ceil_div(int(M), int(size<0>(args.tile_shape_mnk)));
+      int tiles_n = ceil_div(int(N), int(size<1>(args.tile_shape_mnk)));
+      ptr_flag = params_ptr->ptr_tile_flags + (int64_t(l) * tiles_n + int(n)) * tiles_m + int(m);
+    }
+
+    return ConsumerStoreCallbacks<decltype(args.tCcD), decltype(args.residue_tCcD)>(
+      args.tCcD, args.residue_tCcD, ptr_peer_thr, ptr_flag, args.thread_idx, params_ptr);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
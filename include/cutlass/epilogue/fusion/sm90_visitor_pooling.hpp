@@ -0,0 +1,354 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Visitor tree pooling store operation for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/workspace.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Spatial pooling of an implicit GEMM conv fprop output inside the epilogue. GEMM row m is the
+// NHWC output pixel (img, p, q) of a P x Q output image with q fastest, GEMM column n is the
+// output channel. Instead of storing the conv output and re-reading it in a separate pooling
+// pass, each element is reduced straight into every pooling window that covers it, so window
+// halos crossing CTA tiles combine through global atomics.
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class PoolingMode {
+  Max,     // max pooling
+  Average  // average pooling, padding counts towards the window area
+};
+
+namespace detail {
+
+struct PoolingWindow {
+  int P = 1;        // conv output rows per image
+  int Q = 1;        // conv output columns per image
+  int PH = 0;       // pooled rows per image
+  int PW = 0;       // pooled columns per image
+  int window_h = 2;
+  int window_w = 2;
+  int stride_h = 2;
+  int stride_w = 2;
+  int pad_h = 0;
+  int pad_w = 0;
+};
+
+CUTLASS_HOST_DEVICE int
+pooled_extent(int extent, int window, int stride, int pad) {
+  return (extent + 2 * pad - window) / stride + 1;
+}
+
+CUTLASS_HOST_DEVICE bool
+is_valid_pooling_window(PoolingWindow const& window) {
+  return window.P > 0 && window.Q > 0 &&
+         window.window_h > 0 && window.window_w > 0 &&
+         window.stride_h > 0 && window.stride_w > 0 &&
+         window.pad_h >= 0 && window.pad_h < window.window_h &&
+         window.pad_w >= 0 && window.pad_w < window.window_w &&
+         window.PH > 0 && window.PW > 0;
+}
+
+// Reduces the conv output element (m,n) of an N-channel output into the packed (img,PH,PW,N)
+// pooled tensor. An element is covered by the windows [lo,hi] along each spatial mode.
+template <PoolingMode Mode, class Element>
+CUTLASS_DEVICE void
+pooling_scatter(Element* ptr_pool, PoolingWindow const& window, int m, int n, int N, Element value) {
+  int pixels = window.P * window.Q;
+  int img = m / pixels;
+  int p = (m % pixels) / window.Q;
+  int q = m % window.Q;
+
+  int h = p + window.pad_h;
+  int w = q + window.pad_w;
+  int ph_lo = h - window.window_h < 0 ? 0 : (h - window.window_h) / window.stride_h + 1;
+  int pw_lo = w - window.window_w < 0 ? 0 : (w - window.window_w) / window.stride_w + 1;
+  int ph_hi = cute::min(h / window.stride_h, window.PH - 1);
+  int pw_hi = cute::min(w / window.stride_w, window.PW - 1);
+
+  if constexpr (Mode == PoolingMode::Average) {
+    value = value / Element(window.window_h * window.window_w);
+  }
+
+  for (int ph = ph_lo; ph <= ph_hi; ++ph) {
+    for (int pw = pw_lo; pw <= pw_hi; ++pw) {
+      Element* ptr = ptr_pool + ((int64_t(img) * window.PH + ph) * window.PW + pw) * int64_t(N) + n;
+      if constexpr (Mode == PoolingMode::Max) {
+        atomic_maximum<Element>{}(ptr, value);
+      }
+      else {
+        atomic_add<Element>{}(ptr, value);
+      }
+    }
+  }
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Pooled store of the conv output
+//   pool(img,ph,pw,n) = reduce over (p,q) in window(ph,pw) of D(img,p,q,n)
+// The pooled tensor is packed NHWC. P and Q default to the output extents of the conv problem
+// shape (Z folds into the image index for 3D conv); GEMM problem shapes must set them explicitly.
+// initialize_workspace fills the pooled tensor with the reduction identity. The conv output
+// itself is not written unless another node stores it (e.g. a void ElementD skips it entirely).
+template <
+  PoolingMode Mode,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  bool EnableNullptr = true // Noop on nullptr params
+>
+struct Sm90PoolingStore {
+  static_assert(is_same_v<ElementOutput, float>, "Pooling store reduces with float atomics");
+
+  // Lets the builders size the epilogue tile when the pooled tensor replaces a void D
+  using ElementAux = ElementOutput;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementOutput* ptr_pool = nullptr;
+    int P = 0; // conv output height, 0 derives it from a conv problem shape
+    int Q = 0; // conv output width, 0 derives it from a conv problem shape
+    int window_h = 2;
+    int window_w = 2;
+    int stride_h = 2;
+    int stride_w = 2;
+    int pad_h = 0;
+    int pad_w = 0;
+  };
+
+  struct Params {
+    ElementOutput* ptr_pool = nullptr;
+    detail::PoolingWindow window = {};
+  };
+
+  template <class ProblemShape>
+  static detail::PoolingWindow
+  make_pooling_window(ProblemShape const& problem_shape, Arguments const& args) {
+    detail::PoolingWindow window;
+    window.P = args.P;
+    window.Q = args.Q;
+    // Conv problem shapes linearize the output pixels into a hierarchical M mode (q,p,...,n)
+    if constexpr (is_tuple<remove_cvref_t<decltype(get<0>(problem_shape))>>::value) {
+      auto shape_m = get<0>(problem_shape);
+      if (window.Q == 0) {
+        window.Q = int(get<0>(shape_m));
+      }
+      if (window.P == 0) {
+        if constexpr (rank_v<decltype(shape_m)> >= 3) {
+          window.P = int(get<1>(shape_m));
+        }
+        else {
+          window.P = 1;
+        }
+      }
+    }
+    window.window_h = args.window_h;
+    window.window_w = args.window_w;
+    window.stride_h = args.stride_h;
+    window.stride_w = args.stride_w;
+    window.pad_h = args.pad_h;
+    window.pad_w = args.pad_w;
+    if (window.window_h > 0 && window.stride_h > 0) {
+      window.PH = detail::pooled_extent(window.P, window.window_h, window.stride_h, window.pad_h);
+    }
+    if (window.window_w > 0 && window.stride_w > 0) {
+      window.PW = detail::pooled_extent(window.Q, window.window_w, window.stride_w, window.pad_w);
+    }
+    return window;
+  }
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return {args.ptr_pool, make_pooling_window(problem_shape, args)};
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    if constexpr (EnableNullptr) {
+      if (args.ptr_pool == nullptr) {
+        return true;
+      }
+    }
+
+    detail::PoolingWindow window = make_pooling_window(problem_shape, args);
+    if (!detail::is_valid_pooling_window(window)) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: invalid pooling window or unknown conv output extent.\n");
+      return false;
+    }
+    if (int64_t(size(get<0>(problem_shape))) % (int64_t(window.P) * window.Q) != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: GEMM M is not a multiple of the conv output image size.\n");
+      return false;
+    }
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+  #if !defined(CUTLASS_SKIP_REDUCTION_INIT)
+    if (args.ptr_pool != nullptr) {
+      detail::PoolingWindow window = make_pooling_window(problem_shape, args);
+      int64_t images = int64_t(size(get<0>(problem_shape))) / (int64_t(window.P) * window.Q);
+      size_t fill_count = size_t(images * window.PH * window.PW * int64_t(size(get<1>(problem_shape))));
+      ElementOutput identity = Mode == PoolingMode::Max ?
+        platform::identity_for_maximum<ElementOutput>() : ElementOutput(0);
+      return fill_workspace(args.ptr_pool, identity, fill_count, stream, cuda_adapter);
+    }
+  #endif
+
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90PoolingStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90PoolingStore(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor, class ThrResidue>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        CTensor tCcD,
+        ThrResidue residue_tCcD,
+        int thread_m,
+        int thread_n,
+        int N,
+        Params const* params_ptr)
+      : tCcD(tCcD),
+        residue_tCcD(residue_tCcD),
+        thread_m(thread_m),
+        thread_n(thread_n),
+        N(N),
+        params_ptr(params_ptr) { }
+
+    CTensor tCcD;                                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ThrResidue residue_tCcD;
+    int thread_m; // first row of the thread
+    int thread_n; // first column of the thread
+    int N;
+    Params const* params_ptr;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementInput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if constexpr (EnableNullptr) {
+        if (params_ptr->ptr_pool == nullptr) {
+          return frg_input;
+        }
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+      Array frg_compute = convert_input(frg_input);
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto coord = tCcD_mn(epi_v * FragmentSize + i);
+        if (elem_less(coord, residue_tCcD)) {
+          detail::pooling_scatter<Mode>(params_ptr->ptr_pool, params_ptr->window,
+            thread_m + int(get<0>(coord)), thread_n + int(get<1>(coord)), N, convert_output(frg_compute[i]));
+        }
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+
+    // tCcD is relative to the first element of the thread, residue_tCcD holds the distance to the problem edge
+    int thread_m = int(M) - int(get<0>(args.residue_tCcD));
+    int thread_n = int(N) - int(get<1>(args.residue_tCcD));
+
+    return ConsumerStoreCallbacks<decltype(args.tCcD), decltype(args.residue_tCcD)>(
+      args.tCcD, args.residue_tCcD, thread_m, thread_n, int(N), params_ptr);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
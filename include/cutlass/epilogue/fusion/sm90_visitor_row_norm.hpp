@@ -0,0 +1,342 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+  \brief Visitor tree row normalization (LayerNorm / RMSNorm) fusion operation for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Row normalization across columns
+// Reduces each row of the visited tile over N and normalizes it in place:
+//   LayerNorm: y = (x - mean(x)) * rsqrt(var(x) + epsilon) * gamma + shift
+//   RMSNorm:   y = x * rsqrt(mean(x^2) + epsilon) * gamma + shift
+// gamma and shift are optional per-column vectors, treated as 1 and 0 when null.
+// The variance is computed from the centered values in a second pass over the registers.
+//
+//   Assumptions:
+//     1. CTA_N >= N (single tile across N, the mode which is reduced)
+//     2. EPI_N >= N (single epilogue tile across N, because we can reduce and revisit one
+//        epilogue tile at a time.)
+//     3. This node is the root of the visitor tree, since it rewrites the visited results.
+//
+template <
+  bool IsRMSNorm,
+  int FragmentSize,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle,
+  class ElementGamma = ElementCompute
+>
+struct Sm90RowNormColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused row normalization requires FP32 accumulation.");
+
+public:
+  struct SharedStorage { };
+
+  struct Arguments {
+    ElementCompute epsilon = ElementCompute(1e-5f);
+    ElementGamma const* gamma_ptr = nullptr;
+    ElementGamma const* shift_ptr = nullptr;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto [M, N, K, L] = problem_shape;
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    // Cross CTA reduction is not possible because there is no guarantee that all CTAs run
+    // concurrently.
+    // Cross epilogue tile reduction is possible, but re-visiting and applying reduction
+    // to accumulators is only possible for the current epilogue tile.
+    auto [epi_M, epi_N] = EpilogueTile{};
+    return N <= tile_N && N <= epi_N && N > 0;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RowNormColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90RowNormColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    // Sum each row across the lanes that share it
+    template <class RowTensor, class LaneLayout>
+    CUTLASS_DEVICE static void
+    butterfly_reduce(RowTensor&& tCrRow_f, LaneLayout lane_layout_MN) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 1; j < size<1>(lane_layout_MN); j *= 2) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrRow_f); ++i) {
+          tCrRow_f(i) += __shfl_xor_sync(0xFFFFFFFF, tCrRow_f(i), lane_layout_MN(_0{},j));
+        }
+      }
+    }
+
+    template <typename ElementAccumulator, typename ElementInput>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+
+      if constexpr (not IsRMSNorm) {
+        auto& [tCrSum, tCrMean, tCcCol, cCol, lane_layout_MN,
+                residue_cCol, residue_tCcCol, N] = args_tuple;
+        Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+
+        using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+        ConvertInput convert_input{};
+
+        Array frg_I = convert_input(frg_input);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          if (elem_less(tCcCol_mn(epi_v * FragmentSize + i), residue_tCcCol)) {
+            tCrSum(epi_v * FragmentSize + i) += frg_I[i];
+          }
+        }
+      }
+
+      return frg_input;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+
+      auto& [tCrSum, tCrMean, tCcCol, cCol, lane_layout_MN,
+              residue_cCol, residue_tCcCol, N] = args_tuple;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+
+      // `tCrSum` and `tCrMean` have 0-strides along modes that correspond to N, so they are
+      // reduced and written through their filtered (one element per row) views.
+      auto tCrSum_f = filter(tCrSum);
+      auto tCrMean_f = filter(tCrMean);
+      ElementCompute inv_N = ElementCompute(1) / ElementCompute(N);
+
+      //
+      // 1. Row mean
+      //
+      if constexpr (not IsRMSNorm) {
+        butterfly_reduce(tCrSum_f, lane_layout_MN);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrMean_f); ++i) {
+          tCrMean_f(i) = tCrSum_f(i) * inv_N;
+          tCrSum_f(i) = ElementCompute(0);
+        }
+      }
+
+      //
+      // 2. Second moment about the mean, from the visited results
+      //
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+        auto const& visit_frag = visit_results(epi_v);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          int idx = epi_v * FragmentSize + i;
+          if (elem_less(tCcCol_mn(idx), residue_tCcCol)) {
+            ElementCompute centered = ElementCompute(visit_frag[i]) - tCrMean(idx);
+            tCrSum(idx) += centered * centered;
+          }
+        }
+      }
+      butterfly_reduce(tCrSum_f, lane_layout_MN);
+
+      // Reuse the reduction tensor to hold the reciprocal standard deviation
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < size(tCrSum_f); ++i) {
+        tCrSum_f(i) = rsqrtf(tCrSum_f(i) * inv_N + params.epsilon);
+      }
+
+      //
+      // 3. Re-visit and normalize
+      //
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+        auto& visit_frag = visit_results(epi_v);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          int idx = epi_v * FragmentSize + i;
+          ElementCompute y = (ElementCompute(visit_frag[i]) - tCrMean(idx)) * tCrSum(idx);
+          // Thread coordinates are relative to the thread's first element, whose global column
+          // is N - residue. Single tile across N, so no tile offset applies.
+          int n = N - get<1>(residue_tCcCol) + get<1>(tCcCol_mn(idx));
+          bool in_bounds = elem_less(tCcCol_mn(idx), residue_tCcCol);
+          if (params.gamma_ptr != nullptr && in_bounds) {
+            y *= ElementCompute(params.gamma_ptr[n]);
+          }
+          if (params.shift_ptr != nullptr && in_bounds) {
+            y += ElementCompute(params.shift_ptr[n]);
+          }
+          visit_frag[i] = y;
+        }
+      }
+    }
+
+    CUTLASS_DEVICE void
+    end_loop(int epi_m, int epi_n) {
+      auto& [tCrSum, tCrMean, tCcCol, cCol, lane_layout_MN,
+              residue_cCol, residue_tCcCol, N] = args_tuple;
+
+      // Reset row statistics for the next epilogue tile along M
+      fill(tCrSum, ElementCompute(0));
+      fill(tCrMean, ElementCompute(0));
+    }
+
+    CUTLASS_DEVICE void
+    end() { }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      auto mn_shape = shape(typename decltype(args.tiled_copy)::Tiler_MN{});
+      if constexpr (ReferenceSrc) { return right_inverse(args.tiled_copy.get_layoutS_TV()).with_shape(mn_shape); }
+      else                        { return right_inverse(args.tiled_copy.get_layoutD_TV()).with_shape(mn_shape); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+
+    // Get the MN layout of warps to make sure a row never spans warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+
+    // Make sure there's only one warp across N so we can use warp shuffle intrinsics for reduction.
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1);
+
+    // Reduction layout, built as in Sm90TopKSoftmaxColReduction: the accumulator layout with
+    // N modes broadcast, retiled to R2S and composed with the tCrC layout, so that every
+    // fragment index of a row maps to the same element.
+    auto [M, N, K] = args.tile_shape_mnk;
+    auto thr_mma = args.tiled_mma.get_thread_slice(args.thread_idx);
+    auto gColReduce = make_tensor<ElementCompute>(
+        make_layout(make_shape(M, N), make_stride(_1{}, 0_c)));                                                // (M,N)
+    auto tCrColReduce = make_tensor_like<ElementCompute>(                                       // (FrgV, MMA_M, MMA_N)
+        thr_mma.partition_C(gColReduce).layout());
+
+    ThrCopy thread_r2s = args.tiled_copy.get_slice(args.thread_idx);
+    Tensor tRS_rRow = thread_r2s.retile_S(tCrColReduce);                                   // ((R2S,R2S_V),MMA_M,MMA_N)
+    auto tCrC_layout = args.tCrC.layout();                                                         // (R2S,R2S_M,R2S_N)
+    auto tCrRow_layout = take<0, 3>(tRS_rRow.layout()).compose(tCrC_layout); // (R2S,R2S_V) o (R2S,R2S_M,R2S_N)
+
+    Tensor tCrSum = make_tensor<ElementCompute>(tCrRow_layout);                                    // (R2S,R2S_M,R2S_N)
+    Tensor tCrMean = make_tensor<ElementCompute>(tCrRow_layout);                                   // (R2S,R2S_M,R2S_N)
+    fill(tCrSum, ElementCompute(0));
+    fill(tCrMean, ElementCompute(0));
+
+    auto args_tuple = make_tuple(
+        cute::move(tCrSum), cute::move(tCrMean), args.tCcD, args.cD, lane_layout_MN,
+        args.residue_cD, args.residue_tCcD, int(get<1>(args.problem_shape_mnkl)));
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,202 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Visitor tree stochastic rounding of the output for sm90 TMA warp-specialized epilogue
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cute/tensor.hpp"
+#include "sm90_visitor_tma_warpspecialized.hpp"
+#include "sm90_visitor_dropout.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::epilogue::fusion {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Converts its child's output to ElementOutput with FloatRoundStyle::round_stochastic
+// (bf16, e4m3, e5m2 and e2m1 outputs; cvt.rs on SM100a/SM103a).
+// The random word consumed by the pack of elements starting at linear index
+// i = (l * M + m) * N + n is word i % 4 of Philox4x32-10 with counter (i / 4, offset) and key
+// seed ^ kKeySalt, so results are reproducible from (seed, offset) and uncorrelated with a
+// Sm90Dropout mask drawn from the same state.
+template <
+  class ElementOutput,
+  class ElementCompute = float,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest // of the input conversion
+>
+struct Sm90StochasticRound {
+  static_assert(cute::is_same_v<ElementCompute, float>, "Stochastic rounding converts from float");
+
+  static constexpr uint64_t kKeySalt = 0x5352'5352'5352'5352ull;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    uint64_t seed = 0;
+    uint64_t offset = 0;
+    uint64_t const* seed_ptr = nullptr;
+    uint64_t const* offset_ptr = nullptr;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90StochasticRound() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90StochasticRound(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class CTensor>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CTensor tCcD, int64_t thread_row, int thread_n, int N, uint64_t seed, uint64_t offset)
+      : tCcD(tCcD),
+        thread_row(thread_row),
+        thread_n(thread_n),
+        N(N),
+        seed(seed),
+        offset(offset) { }
+
+    CTensor tCcD;                                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    int64_t thread_row; // l * M + first row of the thread
+    int thread_n;       // first column of the thread
+    int N;
+    uint64_t seed;
+    uint64_t offset;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE Array<ElementOutput, FragmentSize>
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementCompute, FragmentSize, FloatRoundStyle::round_stochastic>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+
+      Array frg_compute = convert_input(frg_input);
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+
+      uint64_t group = ~uint64_t(0);
+      Array<uint32_t, 4> random;
+      typename ConvertOutput::random_type frg_rbits;
+      CUTLASS_PRAGMA_UNROLL
+      for (int w = 0; w < int(frg_rbits.size()); ++w) {
+        auto [m, n] = tCcD_mn(epi_v * FragmentSize + w * ConvertOutput::kElementsPerRandomWord);
+        uint64_t idx = uint64_t(thread_row + m) * uint64_t(N) + uint64_t(thread_n + n);
+        if ((idx >> 2) != group) {
+          group = idx >> 2;
+          random = detail::Philox4x32::generate(
+            {static_cast<uint32_t>(group), static_cast<uint32_t>(group >> 32),
+             static_cast<uint32_t>(offset), static_cast<uint32_t>(offset >> 32)}, seed ^ kKeySalt);
+        }
+        frg_rbits[w] = (idx & 2) ? ((idx & 1) ? random[3] : random[2])
+                                 : ((idx & 1) ? random[1] : random[0]);
+      }
+
+      return convert_output(frg_compute, frg_rbits);
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // tCcD is relative to the first element of the thread, residue_tCcD holds the distance to the problem edge
+    int64_t thread_row = int64_t(l) * int64_t(M) + (M - get<0>(args.residue_tCcD));
+    int thread_n = N - get<1>(args.residue_tCcD);
+
+    uint64_t seed = params_ptr->seed_ptr != nullptr ? *params_ptr->seed_ptr : params_ptr->seed;
+    uint64_t offset = params_ptr->offset_ptr != nullptr ? *params_ptr->offset_ptr : params_ptr->offset;
+
+    return ConsumerStoreCallbacks<decltype(args.tCcD)>(args.tCcD, thread_row, thread_n, N, seed, offset);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::epilogue::fusion
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
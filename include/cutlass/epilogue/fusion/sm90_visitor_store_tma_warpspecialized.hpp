@@ -874,6 +874,64 @@ struct Sm90AuxArrayStore {
   }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Multi-output aux store
+// Writes one auxiliary tensor per input of the node, aux I receiving the I-th input, e.g.
+//   Sm90EVT<Sm90AuxStoreMulti<Sm90AuxStore<..Z..>, Sm90AuxStore<..act(Z)..>, Sm90AuxStore<..fp8(act(Z))..>>,
+//     ZTree, ActTree, QuantTree>
+// Every output keeps the element type, stride, smem layout and copy atom of its Sm90AuxStore.
+// The inputs are independent subtrees rather than one value threaded through a chain of
+// stores, and the outputs are driven as a unit by the epilogue store pipeline: the R2S copies
+// of all outputs are issued together after each subtile reduction, and the thread that issues
+// the D store issues the TMA stores of all outputs back to back into the same bulk async group.
+// The first input is returned so the node can feed the D store
+template <class... AuxStores>
+struct Sm90AuxStoreMulti : Sm90VisitorImpl<AuxStores...> {
+  static_assert(sizeof...(AuxStores) > 1, "Use Sm90AuxStore for a single aux output");
+
+  // The first output picks the epilogue tile when D is void, like the D it can feed
+  using ElementAux = typename cute::tuple_element_t<0, cute::tuple<AuxStores...>>::ElementAux;
+
+  using Sm90VisitorImpl<AuxStores...>::Sm90VisitorImpl;
+
+  template<class CallbacksImpl>
+  struct ConsumerStoreCallbacks : CallbacksImpl {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(CallbacksImpl&& impl)
+      : CallbacksImpl(cute::forward<CallbacksImpl>(impl)) {}
+
+    using CallbacksImpl::callbacks_tuple;
+
+    template <typename ElementAccumulator, int FragmentSize, typename... ElementInputs>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInputs, FragmentSize> const&... frg_inputs) {
+      static_assert(sizeof...(ElementInputs) == sizeof...(AuxStores), "One input per aux output is required");
+      auto frg_input_ptrs = cute::make_tuple(&frg_inputs...);
+
+      cute::for_each(make_seq<sizeof...(AuxStores)>{},
+        [&] (auto I) CUTLASS_LAMBDA_FUNC_INLINE {
+          get<I>(callbacks_tuple).visit(frg_acc, epi_v, epi_m, epi_n, *get<I>(frg_input_ptrs));
+        }
+      );
+
+      return *get<0>(frg_input_ptrs);
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto callbacks_impl = Sm90VisitorImpl<AuxStores...>::
+      template get_consumer_store_callbacks<ReferenceSrc>(args);
+    return ConsumerStoreCallbacks<decltype(callbacks_impl)>(cute::move(callbacks_impl));
+  }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Reduction Store Operations
@@ -2128,6 +2186,252 @@ template <
 >
 struct Sm90MatrixReduction;
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Blockwise Scale Factor Generation Operations
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Quantizes the output to 8-bit floats with one scale per 1 x SFVecSize block of each row.
+// Scales are written MN-major, as the A operand scales of the blockwise-scaled mainloops
+// (Sm90BlockwiseScaleConfig / Sm100BlockwiseScaleConfig<1, SFVecSizeN, SFVecSize>) of a GEMM
+// that consumes D as its K-major A. The block amax is reduced in smem from reduce(), so
+// every block must lie within one epilogue subtile.
+template <
+  int SFVecSize,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementBlockScale,
+  FloatRoundStyle RoundStyle = FloatRoundStyle::round_to_nearest
+>
+struct Sm90BlockwiseScaleFactorRowStore {
+  static_assert(sizeof_bits_v<ElementOutput> == 8, "Blockwise scale generation expects an 8-bit output type");
+  static_assert(size<1>(EpilogueTile{}) % SFVecSize == 0,
+    "EpilogueTileN must be a multiple of SFVecSize; set the epilogue tile explicitly");
+
+  static constexpr int EpiM = size<0>(EpilogueTile{});
+  static constexpr int BlocksPerEpiN = size<1>(EpilogueTile{}) / SFVecSize;
+
+  struct SharedStorage {
+    array_aligned<ElementCompute, EpiM * BlocksPerEpiN> smem_amax;
+  };
+
+  struct Arguments {
+    ElementBlockScale* ptr_scale_factor = nullptr;
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    return true;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90BlockwiseScaleFactorRowStore() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90BlockwiseScaleFactorRowStore(Params const& params, SharedStorage const& shared_storage)
+      : params_ptr(&params)
+      , smem_amax(const_cast<ElementCompute*>(shared_storage.smem_amax.data())) { }
+
+  Params const* params_ptr = nullptr;
+  ElementCompute* smem_amax = nullptr;
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template <class GTensor, class CTensor, class ThrOffset, class ThrResidue>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(
+        GTensor mSF,
+        CTensor tCcD,
+        ThrOffset thr_offset_mn,
+        ThrResidue residue_tCcD,
+        int tile_m_base,
+        int tile_n_base,
+        int thread_idx,
+        int num_threads,
+        ElementCompute* smem_amax)
+      : mSF(mSF),
+        tCcD(tCcD),
+        thr_offset_mn(thr_offset_mn),
+        residue_tCcD(residue_tCcD),
+        tile_m_base(tile_m_base),
+        tile_n_base(tile_n_base),
+        thread_idx(thread_idx),
+        num_threads(num_threads),
+        smem_amax(smem_amax) {}
+
+    GTensor mSF;                                                                       // (M,N) in units of elements of D
+    CTensor tCcD;                                                                      // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    ThrOffset thr_offset_mn;                                                           // (m,n) of this thread within the CTA tile
+    ThrResidue residue_tCcD;
+    int tile_m_base;
+    int tile_n_base;
+    int thread_idx;
+    int num_threads;
+    ElementCompute* smem_amax;
+
+    template <class ElementAccumulator, class ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      return NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>{}(frg_input);
+    }
+
+    // Index of an element's (row, block) amax within the epilogue subtile, -1 if out of bounds
+    template <class Coord>
+    CUTLASS_DEVICE int
+    amax_index(Coord const& coord, int epi_m, int epi_n) const {
+      if (not elem_less(coord, residue_tCcD)) {
+        return -1;
+      }
+      int m = get<0>(thr_offset_mn) + get<0>(coord) - epi_m * EpiM;
+      int n = get<1>(thr_offset_mn) + get<1>(coord) - epi_n * size<1>(EpilogueTile{});
+      return m * BlocksPerEpiN + n / SFVecSize;
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+      using FragmentVisit = cute::remove_cvref_t<decltype(visit_results(0))>;
+      static_assert(cute::is_same_v<typename FragmentVisit::Element, ElementCompute>,
+        "Blockwise scale generation must run on unconverted compute values");
+      constexpr int FragmentSize = FragmentVisit::kElements;
+      constexpr int NumBlocks = EpiM * BlocksPerEpiN;
+
+      Tensor tCcD_mn = tCcD(_,_,_,epi_m,epi_n);
+      cutlass::maximum_absolute_value_reduction<ElementCompute, true> amax_op;
+      cutlass::atomic_maximum<ElementCompute> atomic_max;
+
+      // Previous subtile is done reading the block amaxes
+      sync_fn();
+      for (int i = thread_idx; i < NumBlocks; i += num_threads) {
+        smem_amax[i] = ElementCompute(0);
+      }
+      sync_fn();
+
+      // Thread-local amax over runs of values in the same block, then combine in smem
+      int run_idx = -1;
+      ElementCompute run_amax = ElementCompute(0);
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          int idx = amax_index(tCcD_mn(epi_v * FragmentSize + i), epi_m, epi_n);
+          if (idx != run_idx) {
+            if (run_idx >= 0) {
+              atomic_max(&smem_amax[run_idx], run_amax);
+            }
+            run_idx = idx;
+            run_amax = ElementCompute(0);
+          }
+          if (idx >= 0) {
+            run_amax = amax_op(run_amax, visit_results(epi_v)[i]);
+          }
+        }
+      }
+      if (run_idx >= 0) {
+        atomic_max(&smem_amax[run_idx], run_amax);
+      }
+      sync_fn();
+
+      ElementCompute fp_max = ElementCompute(cutlass::platform::numeric_limits<ElementOutput>::max());
+      ElementCompute fp_max_rcp = cutlass::reciprocal_approximate_ftz<ElementCompute>{}(fp_max);
+
+      // Scale = amax / fp_max, so that the consumer mainloop recovers D ~= D_fp8 * scale
+      NumericConverter<ElementBlockScale, ElementCompute, RoundStyle> convert_scale{};
+      for (int i = thread_idx; i < NumBlocks; i += num_threads) {
+        int m = tile_m_base + epi_m * EpiM + i / BlocksPerEpiN;
+        int n = tile_n_base + (epi_n * BlocksPerEpiN + i % BlocksPerEpiN) * SFVecSize;
+        if (m < size<0>(mSF) && n < size<1>(mSF)) {
+          mSF(m,n) = convert_scale(smem_amax[i] * fp_max_rcp);
+        }
+      }
+
+      cutlass::multiplies<ElementCompute> mul;
+      cutlass::minimum_with_nan_propagation<ElementCompute> min_op;
+      cutlass::maximum_with_nan_propagation<ElementCompute> max_op;
+      CUTLASS_PRAGMA_UNROLL
+      for (int epi_v = 0; epi_v < size(visit_results); ++epi_v) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          int idx = amax_index(tCcD_mn(epi_v * FragmentSize + i), epi_m, epi_n);
+          if (idx >= 0) {
+            ElementCompute amax = smem_amax[idx];
+            // All-zero blocks keep their zeros
+            ElementCompute qscale = amax > ElementCompute(0)
+              ? mul(fp_max, cutlass::reciprocal_approximate_ftz<ElementCompute>{}(amax))
+              : ElementCompute(0);
+            // Approximate reciprocal may overshoot the largest finite value
+            visit_results(epi_v)[i] = max_op(min_op(mul(visit_results(epi_v)[i], qscale), fp_max), -fp_max);
+          }
+        }
+      }
+    }
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // MN-major 1 x SFVecSize scales of a (M,N,L) tensor, batch stride M * ceil(N / SFVecSize)
+    Tensor mSF_mnl = make_tensor(make_gmem_ptr(params_ptr->ptr_scale_factor),
+      make_layout(make_shape(M, make_shape(Int<SFVecSize>{}, ceil_div(N, SFVecSize)), L),
+                  make_stride(_1{}, make_stride(_0{}, M), M * ceil_div(N, SFVecSize))));
+    Tensor mSF = mSF_mnl(_,_,l);                                                       // (M,N)
+
+    // Offset of this thread's first coordinate from the CTA tile origin
+    auto thr_offset_mn = args.residue_cD - args.residue_tCcD;
+
+    return ConsumerStoreCallbacks<decltype(mSF), decltype(args.tCcD), decltype(thr_offset_mn), decltype(args.residue_tCcD)>(
+      mSF, args.tCcD, thr_offset_mn, args.residue_tCcD,
+      int(m) * size<0>(args.tile_shape_mnk), int(n) * size<1>(args.tile_shape_mnk),
+      args.thread_idx, size(args.tiled_copy), smem_amax);
+  }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass::epilogue::fusion
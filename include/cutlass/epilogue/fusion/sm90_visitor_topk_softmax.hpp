@@ -36,10 +36,12 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
 #include "cutlass/workspace.h"
 
 #include "cute/tensor.hpp"
 #include "sm90_visitor_tma_warpspecialized.hpp"
+#include "sm90_visitor_online_softmax.hpp" // OnlineSoftmaxPartial, OnlineSoftmaxTopK
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -758,6 +760,311 @@ public:
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Top-K + Softmax MoE router reduction across columns
+// Every row (token) of the tile holds the logits of the N experts. The TopK largest logits of
+// each row are reduced with their expert indices, and for every selected (row m, slot j):
+//   indices(m,j) = expert e of the j-th largest logit
+//   weights(m,j) = softmax of that logit over the TopK selected logits (renormalize == true,
+//                  the weights of a row sum to 1) or over all N logits (renormalize == false)
+//   counts(e)   += 1, through a global atomic
+// The value returned by the atomic is the position of the token in the bucket of expert e. It is
+// written to slots(m,j), and the token slot index m * TopK + j is written to
+// expert_tokens(slot,e) when slot < expert_capacity. A prefix sum over the N counts then gives the
+// row of every (m,j) in the permuted input of the grouped expert GEMM, with no sort kernel.
+// The order of tokens within a bucket is not deterministic.
+//
+// The counts are zeroed by initialize_workspace(). The visited values are passed through,
+// converted to ElementOutput, so the logits are only written if ElementD is not void.
+//
+//   Assumptions:
+//     1. CTA_N >= N and EPI_N >= N (all experts are in a single epilogue tile)
+//     2. A row of the epilogue tile is held by a single warp
+//     3. indices, weights and slots are (M,TopK,L) with stride (TopK,1,M*TopK),
+//        counts is (N,L) with stride (1,N), expert_tokens is (capacity,N,L) with stride
+//        (1,capacity,N*capacity)
+//
+template <
+  int TopK,
+  class CtaTileShapeMNK,
+  class EpilogueTile,
+  class ElementOutput,
+  class ElementCompute,
+  class ElementWeight,
+  FloatRoundStyle RoundStyle
+>
+struct Sm90TopKSoftmaxRouterColReduction {
+private:
+  static_assert(is_same_v<ElementCompute, float>, "Fused Top-K + Softmax router requires FP32 accumulation.");
+  static_assert(TopK >= 1 && TopK <= 8, "Fused Top-K + Softmax router selects at most 8 experts per token.");
+
+public:
+  using Partial = OnlineSoftmaxPartial<ElementCompute>;
+  using Candidates = OnlineSoftmaxTopK<ElementCompute, TopK>;
+
+  struct SharedStorage { };
+
+  struct Arguments {
+    int32_t* ptr_topk_indices = nullptr;     // (M,TopK,L)
+    ElementWeight* ptr_topk_weights = nullptr; // (M,TopK,L)
+    int32_t* ptr_expert_counts = nullptr;    // (N,L), zeroed by initialize_workspace()
+    int32_t* ptr_topk_slots = nullptr;       // (M,TopK,L), optional
+    int32_t* ptr_expert_tokens = nullptr;    // (capacity,N,L), optional
+    int32_t expert_capacity = 0;
+    bool renormalize = true;                 // softmax over the TopK selected logits only
+  };
+
+  using Params = Arguments;
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    return args;
+  }
+
+  template <class ProblemShape>
+  static bool
+  can_implement(ProblemShape const& problem_shape, Arguments const& args) {
+    auto [M, N, K, L] = append<4>(problem_shape, 1);
+    auto [tile_M, tile_N, tile_K] = CtaTileShapeMNK{};
+    auto [epi_M, epi_N] = EpilogueTile{};
+    bool implementable = N <= tile_N && N <= epi_N && N >= TopK;
+    if (args.ptr_expert_tokens != nullptr) {
+      implementable &= args.expert_capacity > 0 && args.ptr_expert_counts != nullptr;
+    }
+    if (args.ptr_topk_slots != nullptr) {
+      implementable &= args.ptr_expert_counts != nullptr;
+    }
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Top-K router requires all experts in one epilogue tile,"
+                         " N >= TopK, and expert counts for slots and expert token lists.\n");
+    }
+    return implementable;
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    if (args.ptr_expert_counts == nullptr) {
+      return Status::kSuccess;
+    }
+    auto [M, N, K, L] = append<4>(problem_shape, 1);
+    return zero_workspace(args.ptr_expert_counts, size_t(N) * size_t(L) * sizeof(int32_t), stream, cuda_adapter);
+  }
+
+  CUTLASS_DEVICE bool
+  is_producer_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_DEVICE bool
+  is_C_load_needed() const {
+    return false;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Sm90TopKSoftmaxRouterColReduction() { }
+
+  CUTLASS_HOST_DEVICE
+  Sm90TopKSoftmaxRouterColReduction(Params const& params, SharedStorage const& shared_storage)
+      : params(params) { }
+
+  Params params;
+
+  template <class... Args>
+  CUTLASS_DEVICE auto
+  get_producer_load_callbacks(ProducerLoadArgs<Args...> const& args) {
+    return EmptyProducerLoadCallbacks{};
+  }
+
+  template<class ArgsTuple>
+  struct ConsumerStoreCallbacks : EmptyConsumerStoreCallbacks {
+    CUTLASS_DEVICE
+    ConsumerStoreCallbacks(ArgsTuple&& args_tuple, Params const& params)
+      : args_tuple(cute::forward<ArgsTuple>(args_tuple)),
+        params(params) {}
+
+    ArgsTuple args_tuple;
+    Params const& params;
+
+    template <typename ElementAccumulator, typename ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto
+    visit(Array<ElementAccumulator, FragmentSize> const& frg_acc, int epi_v, int epi_m, int epi_n,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      using ConvertOutput = NumericArrayConverter<ElementOutput, ElementInput, FragmentSize, RoundStyle>;
+      ConvertOutput convert_output{};
+
+      auto& [tCrTopK, tCrPartial, tCcCol, cCol, lane_layout_MN, lane_mn,
+              problem_shape_mnkl, tile_coord_mnkl, thread_mn, residue_cCol, residue_tCcCol] = args_tuple;
+      Tensor tCrTopK_mn = tCrTopK(_,_,_,epi_m,epi_n);
+      Tensor tCrPartial_mn = tCrPartial(_,_,_,epi_m,epi_n);
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      ConvertInput convert_input{};
+
+      Array frg_I = convert_input(frg_input);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < FragmentSize; ++i) {
+        auto thread_crd = tCcCol_mn(epi_v * FragmentSize + i);
+        if (elem_less(thread_crd, residue_tCcCol)) {
+          int32_t expert = get<1>(thread_mn) + get<1>(thread_crd);
+          tCrTopK_mn(epi_v * FragmentSize + i).add(frg_I[i], expert);
+          if (not params.renormalize) {
+            tCrPartial_mn(epi_v * FragmentSize + i).add(frg_I[i]);
+          }
+        }
+      }
+
+      return convert_output(frg_input);
+    }
+
+    template <class STensor, class SyncFn, class VTensor>
+    CUTLASS_DEVICE void
+    reduce(STensor&& smem_buffer, SyncFn const& sync_fn, int epi_m, int epi_n, bool is_last_iteration, VTensor visit_results) {
+
+      auto& [tCrTopK, tCrPartial, tCcCol, cCol, lane_layout_MN, lane_mn,
+              problem_shape_mnkl, tile_coord_mnkl, thread_mn, residue_cCol, residue_tCcCol] = args_tuple;
+      auto [M, N, K, L] = problem_shape_mnkl;
+      auto [m, n, k, l] = tile_coord_mnkl;
+
+      // fully OOB CTA in partially OOB cluster
+      if (not elem_less(cCol(_0{},_0{}), residue_cCol)) {
+        return;
+      }
+
+      // Every row of this epilogue tile has been visited in full, since EPI_N >= N.
+      // Filter so we don't shuffle or store redundant copies over stride-0 modes.
+      Tensor tCrTopK_flt = filter_zeros(tCrTopK(_,_,_,epi_m,epi_n));
+      Tensor tCrPartial_flt = filter_zeros(tCrPartial(_,_,_,epi_m,epi_n));
+      Tensor tCcCol_mn = tCcCol(_,_,_,epi_m,epi_n);
+      Tensor tCcCol_flt = make_tensor(tCcCol_mn.data(), make_layout(tCrTopK_flt.shape(), tCcCol_mn.stride()));
+
+      //
+      // 1. Warp shuffle reduction
+      //
+      CUTLASS_PRAGMA_UNROLL
+      for (int reduction_cols = size<1>(lane_layout_MN) / 2; reduction_cols > 0; reduction_cols /= 2) {
+        int delta = lane_layout_MN(_0{},reduction_cols);
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrTopK_flt); ++i) {
+          Candidates other;
+          CUTLASS_PRAGMA_UNROLL
+          for (int j = 0; j < TopK; ++j) {
+            other.value_[j] = __shfl_down_sync(0xFFFFFFFF, tCrTopK_flt(i).value_[j], delta);
+            other.index_[j] = __shfl_down_sync(0xFFFFFFFF, tCrTopK_flt(i).index_[j], delta);
+          }
+          tCrTopK_flt(i).merge(other);
+          if (not params.renormalize) {
+            Partial other_partial;
+            other_partial.max_ = __shfl_down_sync(0xFFFFFFFF, tCrPartial_flt(i).max_, delta);
+            other_partial.sum_ = __shfl_down_sync(0xFFFFFFFF, tCrPartial_flt(i).sum_, delta);
+            tCrPartial_flt(i).merge(other_partial);
+          }
+        }
+      }
+
+      //
+      // 2. Reduced lanes compute the routing weights and write the routing of their rows
+      //
+      if (get<1>(lane_mn) == 0) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < size(tCrTopK_flt); ++i) {
+          // Only the row matters here, every column of the row has been reduced
+          if (get<0>(tCcCol_flt(i)) < get<0>(residue_tCcCol)) {
+            Candidates const& topk = tCrTopK_flt(i);
+            ElementCompute logsumexp = params.renormalize ? detail::topk_logsumexp(topk.value_)
+                                                          : tCrPartial_flt(i).logsumexp();
+            int64_t token = get<0>(thread_mn) + get<0>(tCcCol_flt(i));
+            int64_t row_offset = (int64_t(l) * M + token) * TopK;
+
+            CUTLASS_PRAGMA_UNROLL
+            for (int j = 0; j < TopK; ++j) {
+              int32_t expert = topk.index_[j];
+              if (params.ptr_topk_indices != nullptr) {
+                params.ptr_topk_indices[row_offset + j] = expert;
+              }
+              if (params.ptr_topk_weights != nullptr) {
+                params.ptr_topk_weights[row_offset + j] =
+                  static_cast<ElementWeight>(fast_exp(topk.value_[j] - logsumexp));
+              }
+              if (params.ptr_expert_counts != nullptr) {
+                int64_t expert_offset = int64_t(l) * N + expert;
+                int32_t slot = atomicAdd(params.ptr_expert_counts + expert_offset, 1);
+                if (params.ptr_topk_slots != nullptr) {
+                  params.ptr_topk_slots[row_offset + j] = slot;
+                }
+                if (params.ptr_expert_tokens != nullptr && slot < params.expert_capacity) {
+                  params.ptr_expert_tokens[expert_offset * params.expert_capacity + slot] =
+                    static_cast<int32_t>(token * TopK + j);
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+
+  };
+
+  template <
+    bool ReferenceSrc, // do register tensors reference the src or dst layout of the tiled copy
+    class... Args
+  >
+  CUTLASS_DEVICE auto
+  get_consumer_store_callbacks(ConsumerStoreArgs<Args...> const& args) {
+    Layout ref_layout_MN = [&] () {
+      auto mn_shape = shape(typename decltype(args.tiled_copy)::Tiler_MN{});
+      if constexpr (ReferenceSrc) { return right_inverse(args.tiled_copy.get_layoutS_TV()).with_shape(mn_shape); }
+      else                        { return right_inverse(args.tiled_copy.get_layoutD_TV()).with_shape(mn_shape); }
+    }();                                                                                         // tile_mn -> tv_idx
+
+    // Get the MN layout + coord of lanes to determine shuffle reduction iterations
+    using _W = Int<decltype(args.tiled_copy)::TiledNumThr::value / NumThreadsPerWarp>;
+    Layout tv2lane = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_1,_0,_0>>{};            //   tv_idx -> lane_idx
+    Layout ref2lane = composition(tv2lane, ref_layout_MN);                                      //  tile_mn -> lane_idx
+    Layout lane_layout_MN = make_layout(filter(get<0>(ref2lane)), filter(get<1>(ref2lane)));    //  lane_mn -> lane_idx
+    Layout inv_lane_layout_MN = right_inverse(lane_layout_MN);                                  // lane_idx -> lane_mn
+    int lane_idx = canonical_lane_idx();
+    auto lane_mn = idx2crd(inv_lane_layout_MN(lane_idx), shape(lane_layout_MN));
+
+    // Get the MN layout of warps to make sure a row never spans warps
+    Layout tv2warp = Layout<Shape<Int<NumThreadsPerWarp>,_W,_1>,Stride<_0,_1,_0>>{};            //   tv_idx -> warp_idx
+    Layout ref2warp = composition(tv2warp, ref_layout_MN);                                      //  tile_mn -> warp_idx
+    Layout warp_layout_MN = make_layout(filter(get<0>(ref2warp)), filter(get<1>(ref2warp)));    //  warp_mn -> warp_idx
+    static_assert(decltype(size<1>(warp_layout_MN))::value <= 1,
+      "Top-K router requires a single warp across N of the epilogue tile.");
+
+    auto [M, N, K, L] = args.problem_shape_mnkl;
+    auto [m, n, k, l] = args.tile_coord_mnkl;
+
+    // Thread coordinates are relative to the thread's first element, this is its global (row, column)
+    auto thread_mn = make_coord(int32_t(M - get<0>(args.residue_tCcD)), int32_t(N - get<1>(args.residue_tCcD)));
+
+    // Register state of the rows this thread visits, stride-0 along N
+    Layout gRow_layout = make_layout(take<0,2>(args.tile_shape_mnk), make_stride(_1{}, _0{}));
+    Tensor tCgRow = sm90_partition_for_epilogue<ReferenceSrc>(                         // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+                      make_tensor(make_gmem_ptr(static_cast<int32_t*>(nullptr)), gRow_layout), args.epi_tile, args.tiled_copy, args.thread_idx);
+    Tensor tCrTopK = make_tensor_like<Candidates>(tCgRow);                             // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    Tensor tCrPartial = make_tensor_like<Partial>(tCgRow);                             // (CPY,CPY_M,CPY_N,EPI_M,EPI_N)
+    fill(tCrTopK, Candidates{});
+    fill(tCrPartial, Partial{});
+
+    auto args_tuple = make_tuple(
+        cute::move(tCrTopK), cute::move(tCrPartial), args.tCcD, args.cD, lane_layout_MN, lane_mn,
+        args.problem_shape_mnkl, args.tile_coord_mnkl, thread_mn, args.residue_cD, args.residue_tCcD);
+    return ConsumerStoreCallbacks<decltype(args_tuple)>(std::move(args_tuple), params);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace cutlass::epilogue::fusion
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,9 @@
 #include "cutlass/array.h"
 #include "cutlass/half.h"
 #include "cutlass/functional.h"
+#include "cutlass/fast_math.h"
+
+#include "cute/arch/simd_sm100.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -62,6 +65,88 @@ struct kIsHeavy_member_or_false<Op, typename cutlass::platform::enable_if<Op::kI
   static constexpr bool value = Op::kIsHeavy;
 };
 
+namespace detail {
+
+// fp32 array arithmetic for the activation polynomials, issued as packed f32x2 FMUL/FFMA/FADD
+// on SM100 (see cute/arch/simd_sm100.hpp). Rounding is identical to the scalar instructions.
+template <int N>
+struct Float2Math {
+  using Frag = Array<float, N>;
+
+  template <class Fn2, class Fn>
+  CUTLASS_HOST_DEVICE static Frag
+  apply(Frag const& a, Frag const& b, Frag const& c, Fn2 fn2, Fn fn) {
+    Frag d;
+#if defined(CUTE_ARCH_FLOAT2_MATH_ENABLED)
+    if constexpr (N % 2 == 0) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < N; i += 2) {
+        float2 d2;
+        fn2(d2, float2{a[i], a[i+1]}, float2{b[i], b[i+1]}, float2{c[i], c[i+1]});
+        d[i] = d2.x;
+        d[i+1] = d2.y;
+      }
+      return d;
+    }
+#endif
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      d[i] = fn(a[i], b[i], c[i]);
+    }
+    return d;
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  broadcast(float s) {
+    Frag f;
+    f.fill(s);
+    return f;
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  mul(Frag const& a, Frag const& b) {
+    return apply(a, b, b,
+      [] (float2& d, float2 const& x, float2 const& y, float2 const&) { cute::mul(d, x, y); },
+      [] (float x, float y, float) { return multiplies<float>{}(x, y); });
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  mul(float a, Frag const& b) {
+    return mul(broadcast(a), b);
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  add(Frag const& a, Frag const& b) {
+    return apply(a, b, b,
+      [] (float2& d, float2 const& x, float2 const& y, float2 const&) { cute::add(d, x, y); },
+      [] (float x, float y, float) { return plus<float>{}(x, y); });
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  add(float a, Frag const& b) {
+    return add(broadcast(a), b);
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  fma(Frag const& a, Frag const& b, Frag const& c) {
+    return apply(a, b, c,
+      [] (float2& d, float2 const& x, float2 const& y, float2 const& z) { cute::fma(d, x, y, z); },
+      [] (float x, float y, float z) { return multiply_add<float>{}(x, y, z); });
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  fma(Frag const& a, Frag const& b, float c) {
+    return fma(a, b, broadcast(c));
+  }
+
+  CUTLASS_HOST_DEVICE static Frag
+  fma(Frag const& a, float b, float c) {
+    return fma(a, broadcast(b), broadcast(c));
+  }
+};
+
+} // namespace detail
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 // Identity operator
@@ -185,6 +270,38 @@ struct ReLu<Array<T, N>> {
   }
 };
 
+/// Squared ReLu operator: relu(x)^2 - propagates NaNs
+template <typename T>
+struct SquaredReLu {
+  static const bool kIsHeavy = false;
+
+  CUTLASS_HOST_DEVICE
+  T operator()(T value) const {
+    ReLu<T> relu;
+    multiplies<T> mul;
+
+    T y = relu(value);
+    return mul(y, y);
+  }
+};
+
+template <typename T>
+using SquaredReLU = SquaredReLu<T>;
+
+template <typename T, int N>
+struct SquaredReLu<Array<T, N>> {
+  static const bool kIsHeavy = false;
+
+  CUTLASS_HOST_DEVICE
+  Array<T, N> operator()(Array<T, N> const &frag) const {
+    ReLu<Array<T, N>> relu;
+    multiplies<Array<T, N>> mul;
+
+    Array<T, N> y = relu(frag);
+    return mul(y, y);
+  }
+};
+
 // Generic clamp
 template <typename T>
 struct Clamp {
@@ -363,6 +480,18 @@ struct ThresholdReLU<Array<T,N>> {
 };
 
 // Tanh operator
+//
+// Packed paths exist only for Tanh on half_t and bfloat16_t arrays and for the fp32 arrays of
+// Sigmoid, SiLu and GELU_taylor. Other activations evaluate their arrays element by element.
+//   float      tanh.approx.f32, max 2^-11 relative error
+//   half_t     tanh.approx.f16x2
+//   bfloat16_t tanh.approx.bf16x2 on SM90+. This rounds to bf16 directly instead of rounding the
+//              result of tanh.approx.f32, so results differ from Tanh<bfloat16_t> by up to 2 ulp
+//              of bf16.
+// The fp32 Sigmoid, SiLu and GELU_taylor arrays issue their FMUL/FFMA/FADD as f32x2 on SM100, which
+// rounds as the scalar instructions do. They match the scalar functors to 1 ulp, the difference
+// being FMA contraction of the scalar expressions. test/unit/epilogue/thread/activation.cu checks
+// these bounds against the scalar functors.
 template <typename T>
 struct Tanh {
   static const bool kIsHeavy = true;
@@ -403,6 +532,18 @@ struct Tanh<Array<half_t, N>> {
   }
 };
 
+template <int N>
+struct Tanh<Array<bfloat16_t, N>> {
+  using T = bfloat16_t;
+  static const bool kIsHeavy = true;
+
+  CUTLASS_HOST_DEVICE
+  Array<T, N> operator()(Array<T, N> const& z) const {
+    fast_tanh_op<Array<T, N>> tanh;
+    return tanh(z);
+  }
+};
+
 // Sigmoid operator
 template <typename T>
 struct Sigmoid {
@@ -443,6 +584,29 @@ struct Sigmoid<Array<T, N>> {
   }
 };
 
+template <int N>
+struct Sigmoid<Array<float, N>> {
+  static const bool kIsHeavy = true;
+
+  CUTLASS_HOST_DEVICE
+  Array<float, N> operator()(Array<float, N> const& z) const {
+    using Math = detail::Float2Math<N>;
+#if defined(CUTLASS_USE_TANH_FOR_SIGMOID)
+    fast_tanh_op<Array<float, N>> tanh;
+    return Math::fma(tanh(Math::mul(cutlass::constants::half<float>(), z)),
+                     cutlass::constants::half<float>(),
+                     cutlass::constants::half<float>());
+#else
+    divides<Array<float, N>> div;
+    negate<Array<float, N>> neg;
+    fast_exp_op<Array<float, N>> fast_exp;
+    return div(cutlass::constants::one<float>(),
+               Math::add(cutlass::constants::one<float>(),
+                         fast_exp(neg(z))));
+#endif
+  }
+};
+
 // SiLu (swish) operator introduced by Elfwing et al. in the following paper
 // "Sigmoid-Weighted Linear Units for Neural Network Function Approximation in Reinforcement Learning" (2017)
 // https://arxiv.org/pdf/1702.03118.pdf
@@ -471,6 +635,17 @@ struct SiLu<Array<T, N>> {
   }
 };
 
+template <int N>
+struct SiLu<Array<float, N>> {
+  static const bool kIsHeavy = true;
+
+  CUTLASS_HOST_DEVICE
+  Array<float, N> operator()(Array<float, N> const &value) const {
+    Sigmoid<Array<float, N>> sigmoid_op;
+    return detail::Float2Math<N>::mul(value, sigmoid_op(value));
+  }
+};
+
 template <typename T>
 using ScaledSiLu = Scale<SiLu<T>>;
 
@@ -695,20 +870,19 @@ struct GELU_taylor<Array<float, N> > {
 
   CUTLASS_HOST_DEVICE
   Array<float, N> operator()(Array<float, N> const &value) const {
-    multiply_add<Array<float, N>> fma;
-    multiplies<Array<float, N>> mul;
+    using Math = detail::Float2Math<N>;
     fast_tanh_op<Array<float, N>> tanh;
     // 0.5f * (x + x * tanh(x * (0.797885f + 0.0356774f * x * x)));
     float k0 = float(0.7978845608028654);
     float tmp = float(0.044715);
     float k1 = float(k0*tmp);
 
-    Array<float, N> v0 = mul(k1, value);
-    Array<float, N> v1 = fma(v0, value, k0);
-    Array<float, N> v2 = mul(value, v1);
+    Array<float, N> v0 = Math::mul(k1, value);
+    Array<float, N> v1 = Math::fma(v0, value, k0);
+    Array<float, N> v2 = Math::mul(value, v1);
     Array<float, N> v3 = tanh(v2);
-    Array<float, N> v4 = fma(value, v3, value);
-    Array<float, N> v5 = mul(cutlass::constants::half<float>(), v4);
+    Array<float, N> v4 = Math::fma(value, v3, value);
+    Array<float, N> v5 = Math::mul(cutlass::constants::half<float>(), v4);
     return v5;
   }
 };
@@ -36,6 +36,7 @@
 #pragma once
 
 #include "cutlass/epilogue/threadblock/fusion/visitor_2x.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_pooling.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -185,6 +186,142 @@ struct VisitorAuxStore{
   }
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Pooled store of an implicit GEMM conv fprop output (see fusion::Sm90PoolingStore). Rows are
+// the NHWC output pixels of P x Q images, the 2x problem shape is flat so P and Q must be set.
+// The pooled tensor must be pre-filled with the reduction identity (-inf for max, 0 for average).
+template<
+  fusion::PoolingMode Mode,
+  class ThreadMap,
+  class ElementOutput,
+  class ElementCompute,
+  FloatRoundStyle RoundStyle
+>
+struct VisitorPoolingStore {
+  static_assert(is_same_v<ElementOutput, float>, "Pooling store reduces with float atomics");
+
+  struct Arguments {
+    ElementOutput* ptr_pool = nullptr;
+    int P = 1;
+    int Q = 1;
+    int window_h = 2;
+    int window_w = 2;
+    int stride_h = 2;
+    int stride_w = 2;
+    int pad_h = 0;
+    int pad_w = 0;
+  };
+
+  struct Params {
+    ElementOutput* ptr_pool = nullptr;
+    fusion::detail::PoolingWindow window = {};
+  };
+
+  template <class ProblemShape>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    fusion::detail::PoolingWindow window;
+    window.P = args.P;
+    window.Q = args.Q;
+    window.window_h = args.window_h;
+    window.window_w = args.window_w;
+    window.stride_h = args.stride_h;
+    window.stride_w = args.stride_w;
+    window.pad_h = args.pad_h;
+    window.pad_w = args.pad_w;
+    window.PH = fusion::detail::pooled_extent(args.P, args.window_h, args.stride_h, args.pad_h);
+    window.PW = fusion::detail::pooled_extent(args.Q, args.window_w, args.stride_w, args.pad_w);
+    return {args.ptr_pool, window};
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args) {
+    return 0;
+  }
+
+  struct SharedStorage {};
+
+  CUTLASS_HOST_DEVICE
+  VisitorPoolingStore() { }
+
+  CUTLASS_HOST_DEVICE
+  VisitorPoolingStore(Params const& params, SharedStorage const& shared_storage)
+    : params_ptr(&params) { }
+
+  Params const* params_ptr;
+
+  template <class CTensor, class ProblemShape>
+  struct Callbacks : EmptyCallbacks {
+    CUTLASS_DEVICE
+    Callbacks(
+      CTensor&& tC_cPool,
+      ProblemShape problem_shape,
+      Params const* params_ptr
+    ):
+      tC_cPool(cute::forward<CTensor>(tC_cPool)),
+      m(get<0>(problem_shape)),
+      n(get<1>(problem_shape)),
+      params_ptr(params_ptr) { }
+
+    CTensor tC_cPool;
+    Params const* params_ptr;
+    int m;
+    int n;
+
+    template <class ElementAccumulator, class ElementInput, int FragmentSize>
+    CUTLASS_DEVICE auto // returns an Array
+    visit(int iter_idx, int row_idx, int column_idx, int frg_idx,
+          Array<ElementAccumulator, FragmentSize> const& frg_acc,
+          Array<ElementInput, FragmentSize> const& frg_input) {
+      if (params_ptr->ptr_pool == nullptr) {
+        return frg_input;
+      }
+
+      using ConvertInput = NumericArrayConverter<ElementCompute, ElementInput, FragmentSize, RoundStyle>;
+      using ConvertOutput = NumericConverter<ElementOutput, ElementCompute, RoundStyle>;
+      ConvertInput convert_input{};
+      ConvertOutput convert_output{};
+      Array frg_compute = convert_input(frg_input);
+
+      auto coord = tC_cPool(column_idx, row_idx, iter_idx);
+      int coord_m = get<0>(coord);
+      int coord_n = get<1>(coord);
+      if (coord_m < m) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < FragmentSize; ++i) {
+          if (coord_n + i < n) {
+            fusion::detail::pooling_scatter<Mode>(params_ptr->ptr_pool, params_ptr->window,
+              coord_m, coord_n + i, n, convert_output(frg_compute[i]));
+          }
+        }
+      }
+
+      return frg_input;
+    }
+  };
+
+  template <class ProblemShape>
+  CUTLASS_DEVICE auto
+  get_callbacks(
+    gemm::GemmCoord threadblock_tile_offset,
+    int thread_idx,
+    ProblemShape problem_shape
+  ) {
+    // FRAGMENT_COL, FRAGMENT_ROW, (ITERATION_ROW, ITERATION_GROUP, ITERATION_CLUSTER)
+    Tensor cPool = make_identity_tensor(problem_shape);
+    Tensor tC_cPool = group_modes<2,5>(
+      ThreadMap::partition(cPool, thread_idx, threadblock_tile_offset)(_0{},_,_,_,_,_));
+
+    return Callbacks<decltype(tC_cPool), ProblemShape>(
+      cute::move(tC_cPool),
+      problem_shape,
+      params_ptr
+    );
+  }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Reduction Store Operations
@@ -1,5 +1,5 @@
 /***************************************************************************************************
- * Copyright (c) 2024 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
  * SPDX-License-Identifier: BSD-3-Clause
  *
  * Redistribution and use in source and binary forms, with or without
@@ -28,34 +28,28 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *
  **************************************************************************************************/
+/*! \file
+    \brief Device layer interface for Distributed GEMM all-reduce kernel.
+*/
 
 #pragma once
 
-namespace cutlass::gemm {
+#include "cutlass/cutlass.h"
+#include "cutlass/experimental/distributed/kernel/all_reduce.hpp"
 
-// Standard non-persistent kernel with a single producer warp, and one prefetch warp.
-// `A` is assumed to be static, and therefore the producer warp for `A` attempts to load `A` 
-// while the producer warp is waiting on griddepcontrol.
-// GDC `launch_dependent_grids` is issued from the producer warp instead of math warps, and 
-// according to prefetch ratio.
-struct KernelTmaWarpSpecializedFP8FastAccumWithPrefetch { };
+namespace cutlass::distributed::device {
 
-// Non-persistent kernel with two producer warps (one for each of A and B), and one prefetch warp.
-// `A` is assumed to be static, and therefore the producer warp for `A` attempts to load `A` 
-// while the producer warp for `B` is waiting on griddepcontrol. Producer warp for `A` does not 
-// wait on griddepcontrol and loads immediately.
-struct KernelTmaWarpSpecializedFP8FastAccumWithPrefetchAndSplitDMA { };
+// Launches one CTA per chunk, up to max_ctas. All devices must launch the same grid, since a CTA
+// waits on the chunks the same CTA on peers pushes.
+template <int NP, bool TwoShot, typename Element>
+void launch_all_reduce(
+    cutlass::distributed::kernel::AllReduceParams<NP, Element> const& params,
+    int max_ctas,
+    cudaStream_t stream) {
 
-template<
-  int Stages_,
-  class ClusterShape_ = Shape<_1,_1,_1>,
-  class KernelSchedule = KernelTmaWarpSpecializedFP8FastAccumWithPrefetch
->
-struct MainloopSm90TmaGmmaWarpSpecializedWithPrefetch {
-  constexpr static int Stages = Stages_;
-  using ClusterShape = ClusterShape_;
-  using ArchTag = arch::Sm90;
-  using Schedule = KernelSchedule;
-};
+  int num_ctas = params.num_chunks < max_ctas ? params.num_chunks : max_ctas;
+  cutlass::distributed::kernel::all_reduce_kernel<NP, TwoShot, Element>
+    <<<num_ctas, cutlass::distributed::kernel::AllReduceThreadCount, 0, stream>>>(params);
+}
 
-} // namespace cutlass::gemm
+} // namespace cutlass::distributed::device
@@ -38,6 +38,9 @@
 #include "cute/tensor.hpp"
 #include "cutlass/cutlass.h"
 
+#include "cutlass/experimental/distributed/kernel/all_reduce.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_base_schedule.hpp"
+
 ///////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::distributed::device::detail {
@@ -68,10 +71,13 @@ struct DistGemmBufferHelper {
   using ElementC = ElementC_;
   using ElementD = ElementD_;
 
-  static constexpr int NumBuffersA = Tiler::NumBuffersA;
-  static constexpr int NumBuffersB = Tiler::NumBuffersB;
+  // Slices accessed directly from peers aren't buffered
+  static constexpr bool IsDirectAccess = Tiler::CopyMode == schedules::PeerCopyMode::kDirectAccess;
+  static constexpr int NumBuffersA = IsDirectAccess ? 0 : Tiler::NumBuffersA;
+  static constexpr int NumBuffersB = IsDirectAccess ? 0 : Tiler::NumBuffersB;
   static constexpr int NumBuffersC = Tiler::NumBuffersC;
   static constexpr int NumBuffersD = Tiler::NumBuffersD;
+  static constexpr int NumReduceSlots = Tiler::NumReduceSlots;
 
   template <typename ProblemShape>
   static auto
@@ -109,6 +115,25 @@ struct DistGemmBufferHelper {
     return size(d_buffer_layout);
   }
 
+  // Number of chunks the all-reduce kernel splits the local D into, each with its own flags
+  template <typename ProblemShape>
+  static int
+  get_num_reduce_chunks(ProblemShape problem_shape) {
+    int64_t num_elements = size(Tiler::get_local_d_shape(problem_shape));
+    return static_cast<int>(cute::ceil_div(num_elements, kernel::AllReduceChunkElements));
+  }
+
+  template <typename ProblemShape>
+  static size_t
+  get_buffer_size_reduce(ProblemShape problem_shape) {
+    if constexpr (NumReduceSlots > 0) {
+      size_t slots_size = NumReduceSlots * size(Tiler::get_local_d_shape(problem_shape)) * sizeof(ElementD);
+      size_t flags_size = 2 * get_num_reduce_chunks(problem_shape) * sizeof(uint32_t);
+      return cute::round_up(slots_size, size_t(16)) + flags_size;
+    }
+    return 0;
+  }
+
   template <typename ProblemShape>
   static auto
   get_buffer_size(ProblemShape problem_shape) {
@@ -126,11 +151,14 @@ struct DistGemmBufferHelper {
     if constexpr (NumBuffersD > 0) {
       buffer_size += get_buffer_size_d(problem_shape);
     }
+    if constexpr (NumReduceSlots > 0) {
+      buffer_size += get_buffer_size_reduce(problem_shape);
+    }
 
     return buffer_size;
   }
 
-  // Buffer space: |  buffer_A  |  buffer_B  |  buffer_C  |  buffer_D  |
+  // Buffer space: |  buffer_A  |  buffer_B  |  buffer_C  |  buffer_D  |  reduce slots  |  reduce flags  |
   // And buffer_{A,B,C,D}: |  iter 1  |  iter 2  | ... |  iter TP - 1 |
   template <typename ProblemShape>
   static size_t
@@ -155,6 +183,21 @@ struct DistGemmBufferHelper {
   get_buffer_offset_D(ProblemShape problem_shape) {
     return get_buffer_size_a(problem_shape) + get_buffer_size_b(problem_shape) + get_buffer_size_c(problem_shape);
   }
+
+  // Receive slots are ordered by distance from the receiver: slot s holds the partial of device
+  // (device_idx + s + 1) % TP.
+  template <typename ProblemShape>
+  static size_t
+  get_buffer_offset_reduce_slots(ProblemShape problem_shape) {
+    return get_buffer_offset_D(problem_shape) + get_buffer_size_d(problem_shape);
+  }
+
+  template <typename ProblemShape>
+  static size_t
+  get_buffer_offset_reduce_flags(ProblemShape problem_shape) {
+    size_t slots_size = NumReduceSlots * size(Tiler::get_local_d_shape(problem_shape)) * sizeof(ElementD);
+    return get_buffer_offset_reduce_slots(problem_shape) + cute::round_up(slots_size, size_t(16));
+  }
 };
 
 } // namespace cutlass::distributed::device::detail
@@ -0,0 +1,104 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Transports for Distributed GEMM operand slices between NVLink domains.
+
+    The Distributed GEMM adapter copies slices between devices of the same NVLink domain with
+    peer-to-peer cudaMemcpyAsync. Slices owned by devices in another domain (another node or rack,
+    as told by the schedule's NodeSize) are pulled through a transport instead.
+
+    A transport provides:
+      * `AnyToAny`: whether every device can address every other device's memory directly. The
+        adapter then synchronizes all TP devices with its own full barrier kernel, and only the
+        devices of a node otherwise.
+      * `barrier(stream)`: synchronizes all TP devices before slices are pulled across nodes.
+        Only used when `AnyToAny` is false.
+      * `get(dst, src, bytes, peer_idx, stream)`: stream-ordered pull of `bytes` from `src` on
+        device `peer_idx` into local `dst`.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/device/detail.hpp"
+
+#if defined(CUTLASS_ENABLE_NVSHMEM)
+#include <nvshmem.h>
+#include <nvshmemx.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::device {
+
+// All TP devices share one NVLink domain (default.)
+struct CudaPeerTransport {
+  static constexpr bool AnyToAny = true;
+
+  static Status
+  barrier(cudaStream_t stream) {
+    return Status::kSuccess;
+  }
+
+  static Status
+  get(void* dst, void const* src, size_t bytes, int peer_idx, cudaStream_t stream) {
+    return detail::check_cuda_status(cudaMemcpyAsync(dst, src, bytes, cudaMemcpyDeviceToDevice, stream));
+  }
+};
+
+#if defined(CUTLASS_ENABLE_NVSHMEM)
+
+// NVSHMEM over InfiniBand / RDMA between nodes.
+// Requires device index == PE, and operands and workspaces of all devices to be allocated on the
+// symmetric heap (nvshmem_malloc), so that the pointers handed to the adapter for devices on other
+// nodes are the symmetric addresses of their buffers.
+struct NvshmemTransport {
+  static constexpr bool AnyToAny = false;
+
+  static Status
+  barrier(cudaStream_t stream) {
+    nvshmemx_barrier_all_on_stream(stream);
+    return detail::check_cuda_status(cudaGetLastError());
+  }
+
+  static Status
+  get(void* dst, void const* src, size_t bytes, int peer_idx, cudaStream_t stream) {
+    nvshmemx_getmem_on_stream(dst, src, bytes, peer_idx, stream);
+    return detail::check_cuda_status(cudaGetLastError());
+  }
+};
+
+#endif // CUTLASS_ENABLE_NVSHMEM
+
+} // namespace cutlass::distributed::device
+
+////////////////////////////////////////////////////////////////////////////////
@@ -33,6 +33,9 @@
 
   Sets up local GEMM stages, the cuda graph, manages buffer and barrier spaces,
   and maps arguments to per-stage arguments.
+
+  Slices memcpied from devices on other nodes (see the schedule's NodeSize) go through the
+  Transport, see dist_gemm_transport.hpp.
 */
 
 #pragma once
@@ -42,14 +45,17 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/device/gemm_universal_adapter.h"
 
+#include "cutlass/experimental/distributed/device/all_reduce.hpp"
 #include "cutlass/experimental/distributed/device/full_barrier.hpp"
+#include "cutlass/experimental/distributed/device/peer_copy.hpp"
 #include "cutlass/experimental/distributed/device/detail.hpp"
+#include "cutlass/experimental/distributed/device/dist_gemm_transport.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::distributed::device {
 
-template <class GemmKernel_>
+template <class GemmKernel_, class Transport_ = CudaPeerTransport>
 class DistributedGemmUniversalAdapter {
 public:
   using DeviceGemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel_>;
@@ -110,12 +116,24 @@ public:
 
   // Distributed GEMM types and defs
   using DistSchedule = typename GemmKernel::DistSchedule;
-  static constexpr bool HasMemcpy = DistSchedule::HasMemcpy;
+  static constexpr bool IsDirectAccess = DistSchedule::CopyMode == schedules::PeerCopyMode::kDirectAccess;
+  static constexpr bool HasMemcpy = DistSchedule::HasMemcpy && not IsDirectAccess;
   using TP = typename DistSchedule::TP;
   static constexpr int TP_ = TP{};
   using ElementFlag = typename GemmKernel::ElementFlag;
   using ElementBarrier = uint32_t;
 
+  using Transport = Transport_;
+  static constexpr int NodeSize = DistSchedule::NodeSize;
+  // Devices that take part in the full barrier kernel; with a transport that isn't any-to-any,
+  // nodes are synchronized with each other by the transport itself.
+  static constexpr int BarrierSize = Transport::AnyToAny ? TP_ : NodeSize;
+
+  // Memcpied slices arrive in chunks with their own flags, after the per-stage flags
+  static constexpr int NumArrivalChunks = DistSchedule::NumArrivalChunks;
+  static constexpr bool TileGranularArrival = NumArrivalChunks > 1;
+  static constexpr int NumFlags = TileGranularArrival ? TP_ * (1 + NumArrivalChunks) : TP_;
+
   using BufferHelper = detail::DistGemmBufferHelper<
     DistSchedule,
     ElementA,
@@ -145,9 +163,20 @@ public:
     void * memcpy_source_ptr_array[TP_];
     void const * memcpy_remote_ptr_array[TP_];
     size_t memcpy_bytes[TP_];
+    int memcpy_peer_idx[TP_];
+    bool memcpy_from_remote_node[TP_];
+    // Arrival flag of the local peer forwarding the slice, or null when copying a peer's own operand
+    ElementFlag const * memcpy_peer_flag_ptr_array[TP_];
+    // Bytes of each chunk of the slice, and their arrival flags, with tile-granular arrival
+    size_t memcpy_chunk_bytes[TP_];
+    void * memcpy_chunk_flag_ptr_array[TP_];
 
     cutlass::Array<ElementBarrier*, TP_> device_barrier_ptrs;
 
+    // All-reduce of the local output after the last stage, for all-reduce schedules
+    kernel::AllReduceParams<TP_, ElementD> all_reduce_params;
+    int all_reduce_max_ctas = 0;
+
     bool is_initialized = false;
   };
 
@@ -171,6 +200,32 @@ public:
       return Status::kInvalid;
     }
 
+    if constexpr (DistSchedule::HasAllReduce) {
+      if (args.epilogue.thread.beta != 0.0) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Selected TP all-reduces partial results, which " <<
+            "would add the epilogue source once per device (epilogue must be sourceless.)\n");
+        return Status::kInvalid;
+      }
+
+      // The all-reduce kernel treats D as a flat array
+      auto layout_D = make_layout(DistSchedule::get_local_d_shape(args.problem_shape), args.epilogue.dD);
+      if (cute::cosize(layout_D) != cute::size(layout_D)) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Selected TP all-reduces partial results, which " <<
+            "requires a packed D tensor.\n");
+        return Status::kInvalid;
+      }
+    }
+
+    if constexpr (TileGranularArrival) {
+      auto [M, N, K, L] = append<4>(DistSchedule::get_local_gemm_shape(args.problem_shape), 1);
+      int rotated_extent = DistSchedule::MemcpyA ? M : N;
+      if (L != 1 || rotated_extent % NumArrivalChunks != 0) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Tile-granular arrival requires L == 1 and the " <<
+            "local M (rotating A) or N (rotating B) to be divisible by the number of chunks.\n");
+        return Status::kInvalid;
+      }
+    }
+
     if (not DistSchedule::can_implement_global(args.problem_shape)) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem shape not divisible by TP.\n");
       return Status::kInvalid;
@@ -223,6 +278,41 @@ public:
     return DistSchedule::get_tensor_B(tensor_B, tensor_buffer, device_idx, iteration);
   }
 
+  // Operands read by the local GEMM of an iteration. With direct access, slices are read from
+  // the peer that would otherwise have been copied from.
+  static auto
+  get_gemm_tensor_A_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
+    if constexpr (IsDirectAccess && DistSchedule::MemcpyA) {
+      if (iteration > 0) {
+        auto [peer_idx, peer_iteration] = DistSchedule::get_copy_source(device_idx, iteration);
+        return get_tensor_A_for_iter(args_array, buffer_space, peer_idx, peer_iteration);
+      }
+    }
+    return get_tensor_A_for_iter(args_array, buffer_space, device_idx, iteration);
+  }
+
+  static auto
+  get_gemm_tensor_B_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
+    if constexpr (IsDirectAccess && DistSchedule::MemcpyB) {
+      if (iteration > 0) {
+        auto [peer_idx, peer_iteration] = DistSchedule::get_copy_source(device_idx, iteration);
+        return get_tensor_B_for_iter(args_array, buffer_space, peer_idx, peer_iteration);
+      }
+    }
+    return get_tensor_B_for_iter(args_array, buffer_space, device_idx, iteration);
+  }
+
+  // Communication CTAs run next to the local GEMMs, which are launched on the remaining SMs
+  static void
+  reserve_copy_sms(Arguments& args) {
+    if constexpr (DistSchedule::CopyMode == schedules::PeerCopyMode::kCommunicationCtas) {
+      if (args.hw_info.sm_count <= 0) {
+        args.hw_info.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+      }
+      args.hw_info.sm_count -= DistSchedule::CopySmCount;
+    }
+  }
+
   static auto
   get_tensor_C_for_iter(Arguments const* args_array, void** buffer_space, int device_idx, int iteration) {
     auto args = args_array[device_idx];
@@ -257,13 +347,14 @@ public:
   auto make_dummy_base_args(Arguments const* args, int device_idx, int iteration, void ** buffer_space) {
 
     // Set up GEMM arguments for the current stage/iteration
-    auto tensor_a_iter = get_tensor_A_for_iter(args, buffer_space, device_idx, iteration);
-    auto tensor_b_iter = get_tensor_B_for_iter(args, buffer_space, device_idx, iteration);
+    auto tensor_a_iter = get_gemm_tensor_A_for_iter(args, buffer_space, device_idx, iteration);
+    auto tensor_b_iter = get_gemm_tensor_B_for_iter(args, buffer_space, device_idx, iteration);
     auto tensor_c_iter = get_tensor_C_for_iter(args, buffer_space, device_idx, iteration);
     auto tensor_d_iter = get_tensor_D_for_iter(args, buffer_space, device_idx, iteration);
 
     Arguments base_args = args[device_idx];
     base_args.problem_shape = DistSchedule::get_local_gemm_shape(args[device_idx].problem_shape);
+    reserve_copy_sms(base_args);
     base_args.mainloop = {
       reinterpret_cast<const ElementA*>(tensor_a_iter.data()),
       tensor_a_iter.stride(),
@@ -318,7 +409,7 @@ public:
 
   static size_t
   get_flag_bytes() {
-    return round_nearest(sizeof(ElementFlag) * TP_, 32);
+    return round_nearest(sizeof(ElementFlag) * NumFlags, 32);
   }
 
   static void *
@@ -329,6 +420,12 @@ public:
         (sizeof(ElementFlag) * iteration));
   }
 
+  // Flag of the first chunk of an iteration
+  static void *
+  exclusive_workspace_ptr_to_chunk_flag_ptr(void * exclusive_workspace_ptr, int iteration) {
+    return exclusive_workspace_ptr_to_flag_ptr(exclusive_workspace_ptr, TP_ + iteration * NumArrivalChunks);
+  }
+
   static size_t
   get_exclusive_workspace_size() {
     return get_barrier_bytes() + get_flag_bytes();
@@ -366,13 +463,14 @@ public:
       void** buffer_space = workspace_ptrs;
 
       // Set up GEMM arguments for the current stage/iteration
-      auto tensor_a_iter = get_tensor_A_for_iter(args, buffer_space, device_idx, iteration);
-      auto tensor_b_iter = get_tensor_B_for_iter(args, buffer_space, device_idx, iteration);
+      auto tensor_a_iter = get_gemm_tensor_A_for_iter(args, buffer_space, device_idx, iteration);
+      auto tensor_b_iter = get_gemm_tensor_B_for_iter(args, buffer_space, device_idx, iteration);
       auto tensor_c_iter = get_tensor_C_for_iter(args, buffer_space, device_idx, iteration);
       auto tensor_d_iter = get_tensor_D_for_iter(args, buffer_space, device_idx, iteration);
 
       Arguments base_args = args[device_idx];
       base_args.problem_shape = DistSchedule::get_local_gemm_shape(args[device_idx].problem_shape);
+      reserve_copy_sms(base_args);
       base_args.mainloop = {
         reinterpret_cast<const ElementA*>(tensor_a_iter.data()),
         tensor_a_iter.stride(),
@@ -401,12 +499,15 @@ public:
 
       void * self_flag_ptr = exclusive_workspace_ptr_to_flag_ptr(exclusive_workspace_ptrs[device_idx], iteration);
       void * peer_flag_ptr = exclusive_workspace_ptr_to_flag_ptr(exclusive_workspace_ptrs[flag_peer_idx], iteration);
+      void * chunk_flag_ptr = TileGranularArrival && iteration > 0 ?
+        exclusive_workspace_ptr_to_chunk_flag_ptr(exclusive_workspace_ptrs[device_idx], iteration) : nullptr;
 
       DistributedArguments distributed_args = {
         device_idx,
         iteration,
         self_flag_ptr,
-        peer_flag_ptr
+        peer_flag_ptr,
+        chunk_flag_ptr
       };
       PackedArguments args_iter = {base_args, distributed_args};
 
@@ -421,7 +522,7 @@ public:
 
       // Set up peer buffer ptrs
       if (iteration > 0 && HasMemcpy) {
-        auto peer_idx_iter = DistSchedule::get_remote_peer_id(device_idx, iteration);
+        auto [peer_idx_iter, peer_iteration] = DistSchedule::get_copy_source(device_idx, iteration);
 
         void * local_ptr_itr = nullptr;
         void const * remote_ptr_itr = nullptr;
@@ -435,8 +536,9 @@ public:
           local_size = cute::cosize(tensor_a_iter.layout()) * sizeof(ElementA);
           local_ptr_itr = reinterpret_cast<void*>(tensor_a_iter.data());
 
-          // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring)
-          auto remote_tensor_iter = get_tensor_A_for_iter(args, buffer_space, peer_idx_iter, 0);
+          // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring),
+          // or the buffer it was forwarded into for hierarchical schedules
+          auto remote_tensor_iter = get_tensor_A_for_iter(args, buffer_space, peer_idx_iter, peer_iteration);
           remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
           remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementA);
         }
@@ -444,8 +546,9 @@ public:
           local_size = cute::cosize(tensor_b_iter.layout()) * sizeof(ElementB);
           local_ptr_itr = reinterpret_cast<void*>(tensor_b_iter.data());
 
-          // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring)
-          auto remote_tensor_iter = get_tensor_B_for_iter(args, buffer_space, peer_idx_iter, 0);
+          // Copy peer's slice in the first iteration (direct access memcpy instead of logical ring),
+          // or the buffer it was forwarded into for hierarchical schedules
+          auto remote_tensor_iter = get_tensor_B_for_iter(args, buffer_space, peer_idx_iter, peer_iteration);
           remote_ptr_itr = reinterpret_cast<void const*>(remote_tensor_iter.data());
           remote_size = cute::cosize(remote_tensor_iter.layout()) * sizeof(ElementB);
         }
@@ -455,6 +558,21 @@ public:
         state_.memcpy_source_ptr_array[iteration] = local_ptr_itr;
         state_.memcpy_remote_ptr_array[iteration] = remote_ptr_itr;
         state_.memcpy_bytes[iteration] = local_size;
+        state_.memcpy_peer_idx[iteration] = peer_idx_iter;
+        state_.memcpy_from_remote_node[iteration] = peer_idx_iter / NodeSize != device_idx / NodeSize;
+        state_.memcpy_peer_flag_ptr_array[iteration] = peer_iteration == 0 ? nullptr :
+          reinterpret_cast<ElementFlag const*>(
+              exclusive_workspace_ptr_to_flag_ptr(exclusive_workspace_ptrs[peer_idx_iter], peer_iteration));
+
+        // Chunks are whole rows of the rotated (K-major) operand; the last one takes the remainder
+        if constexpr (TileGranularArrival) {
+          size_t row_pitch_bytes = DistSchedule::MemcpyA ?
+            cute::stride<0>(tensor_a_iter) * sizeof(ElementA) :
+            cute::stride<0>(tensor_b_iter) * sizeof(ElementB);
+          int rotated_extent = DistSchedule::MemcpyA ? cute::size<0>(tensor_a_iter) : cute::size<0>(tensor_b_iter);
+          state_.memcpy_chunk_bytes[iteration] = (rotated_extent / NumArrivalChunks) * row_pitch_bytes;
+          state_.memcpy_chunk_flag_ptr_array[iteration] = chunk_flag_ptr;
+        }
       }
     }
 
@@ -476,6 +594,13 @@ public:
       }
     }
 
+    if constexpr (DistSchedule::HasAllReduce) {
+      Status status = initialize_all_reduce(args, workspace_ptrs, device_idx, stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
     state_.is_initialized = true;
 
     // Instantiate graph
@@ -487,6 +612,47 @@ public:
     return Status::kSuccess;
   }
 
+  // Receive slots and flags live in every device's buffer space. The partial of device d is
+  // pushed into slot (d - p - 1 + TP) % TP of device p.
+  Status
+  initialize_all_reduce(
+    Arguments const* args,
+    void** workspace_ptrs,
+    int device_idx,
+    cudaStream_t stream) {
+
+    auto problem_shape = args[device_idx].problem_shape;
+    int64_t num_elements = size(DistSchedule::get_local_d_shape(problem_shape));
+    size_t slots_offset = BufferHelper::get_buffer_offset_reduce_slots(problem_shape);
+    size_t flags_offset = BufferHelper::get_buffer_offset_reduce_flags(problem_shape);
+
+    auto& params = state_.all_reduce_params;
+    params.ptr_D = args[device_idx].epilogue.ptr_D;
+    params.ptr_slots = reinterpret_cast<ElementD const*>(
+        reinterpret_cast<uint8_t*>(workspace_ptrs[device_idx]) + slots_offset);
+    params.ptr_flags = reinterpret_cast<uint32_t*>(
+        reinterpret_cast<uint8_t*>(workspace_ptrs[device_idx]) + flags_offset);
+    params.num_elements = num_elements;
+    params.num_chunks = BufferHelper::get_num_reduce_chunks(problem_shape);
+    params.device_idx = device_idx;
+
+    for (int device = 0; device < TP_; ++device) {
+      int slot = (device_idx - device - 1 + TP_) % TP_;
+      params.peer_D_ptrs[device] = args[device].epilogue.ptr_D;
+      params.peer_slot_ptrs[device] = reinterpret_cast<ElementD*>(
+          reinterpret_cast<uint8_t*>(workspace_ptrs[device]) + slots_offset) + slot * num_elements;
+      params.peer_flag_ptrs[device] = reinterpret_cast<uint32_t*>(
+          reinterpret_cast<uint8_t*>(workspace_ptrs[device]) + flags_offset);
+    }
+
+    state_.all_reduce_max_ctas = KernelHardwareInfo::query_device_multiprocessor_count(
+        args[device_idx].hw_info.device_id);
+
+    // Flags are reset by the all-reduce kernel itself after each run
+    return detail::check_cuda_status(cudaMemsetAsync(
+          params.ptr_flags, 0, 2 * params.num_chunks * sizeof(uint32_t), stream));
+  }
+
   Status
   construct_graph(bool launch_with_pdl) {
 #if (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
@@ -527,13 +693,22 @@ public:
       return status;
     }
 
-    cutlass::Array<ElementFlag*, TP_> self_flag_ptrs;
+    cutlass::Array<ElementFlag*, NumFlags> self_flag_ptrs;
     for (int iteration = 0; iteration < TP_; ++iteration) {
       self_flag_ptrs[iteration] = state_.params_array[iteration].distributed.self_flag_ptr_;
     }
+    for (int flag = TP_; flag < NumFlags; ++flag) {
+      self_flag_ptrs[flag] = self_flag_ptrs[0] + flag;
+    }
 
-    launch_full_barrier<TP_, ElementBarrier, TP_, ElementFlag>(
-        state_.device_barrier_ptrs, self_flag_ptrs, state_.device_idx, stream, launch_with_pdl);
+    cutlass::Array<ElementBarrier*, BarrierSize> barrier_ptrs;
+    int barrier_offset = (state_.device_idx / BarrierSize) * BarrierSize;
+    for (int device = 0; device < BarrierSize; ++device) {
+      barrier_ptrs[device] = state_.device_barrier_ptrs[barrier_offset + device];
+    }
+
+    launch_full_barrier<BarrierSize, ElementBarrier, NumFlags, ElementFlag>(
+        barrier_ptrs, self_flag_ptrs, state_.device_idx % BarrierSize, stream, launch_with_pdl);
 
     status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
     if (status != Status::kSuccess) {
@@ -557,50 +732,21 @@ public:
       return status;
     }
 
-    // 2. Optional mem copy branch
+    // 2. Optional mem copy branches
+    //    Copies within the NVLink domain and pulls from other nodes are separate branches,
+    //    so that the inter-node pipeline overlaps the intra-node rotation.
     if constexpr (HasMemcpy) {
-
-      status = detail::check_cuda_status(cudaStreamBeginCaptureToGraph(
-            stream,
-            state_.graph,
-            &full_barrier_node,
-            /* dependencyData = */ nullptr,
-            1,
-            cudaStreamCaptureModeRelaxed));
-
+      status = capture_memcpy_branch(stream, full_barrier_node, /* remote_node = */ false);
       if (status != Status::kSuccess) {
         return status;
       }
 
-      // No copies for first iter; we assume the data is already there.
-      for (int iteration = 1; iteration < TP_; ++iteration) {
-
-        status = detail::check_cuda_status(cudaMemcpyAsync(
-              state_.memcpy_source_ptr_array[iteration],
-              state_.memcpy_remote_ptr_array[iteration],
-              state_.memcpy_bytes[iteration],
-              cudaMemcpyDeviceToDevice, stream));
-
-        if (status != Status::kSuccess) {
-          return status;
-        }
-
-        // Set flag to non zero
-        status = detail::check_cuda_status(cudaMemsetAsync(
-              reinterpret_cast<void *>(state_.params_array[iteration].distributed.peer_flag_ptr_),
-              0b11111111,
-              sizeof(ElementFlag),
-              stream));
-
+      if constexpr (DistSchedule::NumNodes > 1) {
+        status = capture_memcpy_branch(stream, full_barrier_node, /* remote_node = */ true);
         if (status != Status::kSuccess) {
           return status;
         }
       }
-
-      status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
-      if (status != Status::kSuccess) {
-        return status;
-      }
     }
 
     // 3. Run local GEMMs
@@ -632,6 +778,16 @@ public:
       }
     }
 
+    // 3.2. All-reduce the local output once the last stage is done
+    if constexpr (DistSchedule::HasAllReduce) {
+      launch_all_reduce<TP_, DistSchedule::AllReduce == schedules::AllReduceAlgorithm::kTwoShot>(
+          state_.all_reduce_params, state_.all_reduce_max_ctas, stream);
+      status = detail::check_cuda_status(cudaGetLastError());
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
     status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
     if (status != Status::kSuccess) {
       return status;
@@ -662,6 +818,108 @@ public:
 #endif
   }
 
+#if (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
+  Status
+  capture_memcpy_branch(cudaStream_t stream, cudaGraphNode_t dependency, bool remote_node) {
+    Status status = detail::check_cuda_status(cudaStreamBeginCaptureToGraph(
+          stream,
+          state_.graph,
+          &dependency,
+          /* dependencyData = */ nullptr,
+          1,
+          cudaStreamCaptureModeRelaxed));
+
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    if constexpr (not Transport::AnyToAny) {
+      if (remote_node) {
+        status = Transport::barrier(stream);
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+    }
+
+    // No copies for first iter; we assume the data is already there.
+    for (int iteration = 1; iteration < TP_; ++iteration) {
+      if (state_.memcpy_from_remote_node[iteration] != remote_node) {
+        continue;
+      }
+
+      // Forwarded slices must have arrived in the local peer's buffer first
+      if (state_.memcpy_peer_flag_ptr_array[iteration] != nullptr) {
+        launch_wait_flag(state_.memcpy_peer_flag_ptr_array[iteration], stream);
+        status = detail::check_cuda_status(cudaGetLastError());
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+
+      if constexpr (TileGranularArrival) {
+        // Flag each chunk as soon as it lands, so that the GEMM can start on its tiles
+        for (int chunk = 0; chunk < NumArrivalChunks; ++chunk) {
+          size_t chunk_offset = chunk * state_.memcpy_chunk_bytes[iteration];
+          size_t chunk_bytes = chunk < NumArrivalChunks - 1 ?
+            state_.memcpy_chunk_bytes[iteration] : state_.memcpy_bytes[iteration] - chunk_offset;
+
+          status = copy_slice(iteration, chunk_offset, chunk_bytes, remote_node, stream);
+          if (status != Status::kSuccess) {
+            return status;
+          }
+
+          status = detail::check_cuda_status(cudaMemsetAsync(
+                reinterpret_cast<ElementFlag *>(state_.memcpy_chunk_flag_ptr_array[iteration]) + chunk,
+                0b11111111,
+                sizeof(ElementFlag),
+                stream));
+          if (status != Status::kSuccess) {
+            return status;
+          }
+        }
+      }
+      else {
+        status = copy_slice(iteration, 0, state_.memcpy_bytes[iteration], remote_node, stream);
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+
+      // Set flag to non zero
+      status = detail::check_cuda_status(cudaMemsetAsync(
+            reinterpret_cast<void *>(state_.params_array[iteration].distributed.peer_flag_ptr_),
+            0b11111111,
+            sizeof(ElementFlag),
+            stream));
+
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    return detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
+  }
+#endif
+
+  // Copies bytes [offset, offset + bytes) of the slice memcpied in an iteration
+  Status
+  copy_slice(int iteration, size_t offset, size_t bytes, bool remote_node, cudaStream_t stream) {
+    void * dst = reinterpret_cast<uint8_t *>(state_.memcpy_source_ptr_array[iteration]) + offset;
+    void const * src = reinterpret_cast<uint8_t const *>(state_.memcpy_remote_ptr_array[iteration]) + offset;
+
+    if (remote_node) {
+      return Transport::get(dst, src, bytes, state_.memcpy_peer_idx[iteration], stream);
+    }
+    else if constexpr (DistSchedule::CopyMode == schedules::PeerCopyMode::kCommunicationCtas) {
+      launch_peer_copy(dst, src, bytes, DistSchedule::CopySmCount, stream);
+      return detail::check_cuda_status(cudaGetLastError());
+    }
+    else {
+      return detail::check_cuda_status(cudaMemcpyAsync(dst, src, bytes, cudaMemcpyDeviceToDevice, stream));
+    }
+  }
+
   Status
   update(Arguments const& args, void* workspace = nullptr) {
     CUTLASS_TRACE_HOST("  DistributedGemm does not support updating arguments yet.");
@@ -0,0 +1,634 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file Distributed Grouped GEMM Device Adapter
+
+  Expert-parallel grouped GEMM for Mixture-of-Experts layers. Every device owns num_local_experts
+  experts, and holds tokens sorted by the (global) expert they are routed to. A single cuda graph
+  fuses the all-to-all dispatch, the grouped expert GEMM, and the all-to-all combine:
+
+    1. Dispatch: every device pushes the tokens of each expert into its owner's receive buffer, and
+       raises the owner's arrival flag for the (expert, source) group.
+    2. Grouped GEMM: each owner runs one group per (local expert, source rank) with tokens. The
+       mainloop waits on a group's flag before loading its tiles (see GroupArrivalMainloop), so
+       tiles start as soon as their tokens arrive, and local tokens are processed first.
+    3. Combine: the epilogue writes each group's output directly into the source rank's output,
+       in the order of its tokens. A trailing barrier makes sure all outputs have landed.
+
+  Applying router weights and reducing over the top-k experts of each token is left to the caller.
+
+  Token counts for all devices and experts must be known on the host, and all devices must be
+  peer accessible.
+
+  NOTE: This API is __experimental__ and will change heavily over time.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+
+#include "cutlass/experimental/distributed/device/full_barrier.hpp"
+#include "cutlass/experimental/distributed/device/detail.hpp"
+#include "cutlass/experimental/distributed/kernel/group_arrival_mainloop.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::device {
+
+template <class GemmKernel_, class TP>
+class DistributedGroupedGemmUniversalAdapter {
+public:
+  using GemmKernel = typename kernel::detail::GroupArrivalKernel<GemmKernel_>::type;
+  using DeviceGemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using UnderlyingProblemShape = typename ProblemShape::UnderlyingProblemShape;
+
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using ElementC = typename GemmKernel::ElementC;
+  using ElementD = typename GemmKernel::ElementD;
+
+  using InternalStrideA = typename GemmKernel::InternalStrideA;
+  using InternalStrideB = typename GemmKernel::InternalStrideB;
+  using InternalStrideC = typename GemmKernel::InternalStrideC;
+  using InternalStrideD = typename GemmKernel::InternalStrideD;
+
+  using MainloopArguments = typename GemmKernel::MainloopArguments;
+  using EpilogueArguments = typename GemmKernel::EpilogueArguments;
+  using ThreadEpilogueArguments = decltype(EpilogueArguments{}.thread);
+
+  static constexpr int TP_ = TP{};
+  using ElementFlag = uint32_t;
+  using ElementBarrier = uint32_t;
+
+  static_assert(cutlass::gemm::detail::is_k_major<InternalStrideA>(),
+      "Tokens (A) must be K-major, so that the tokens of a group are contiguous.");
+  static_assert(cutlass::gemm::detail::is_major<1, InternalStrideD>(),
+      "Expert outputs (D) must be N-major, so that they can be written in place of source tokens.");
+
+  /// Argument structure, one per device
+  struct Arguments {
+    int num_local_experts = 0;
+    // Host tensor [TP, TP * num_local_experts] (row-major): tokens routed by each device to each expert.
+    // Must be the same for all devices.
+    int const* token_counts = nullptr;
+    int N = 0;
+    int K = 0;
+    // This device's tokens, [num_tokens, K] and sorted by expert
+    ElementA const* ptr_tokens = nullptr;
+    // Host array of the weights of this device's experts, each [N, K] with StrideB
+    ElementB const* const* ptr_weights = nullptr;
+    // Expert outputs of this device's tokens, [num_tokens, N] in the order of ptr_tokens
+    ElementD* ptr_output = nullptr;
+    ThreadEpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // One group per (local expert, source device) with tokens. Sources are ordered so that local
+  // tokens come first, followed by devices in the order they push to this device.
+  struct GroupInfo {
+    int expert = 0;
+    int source = 0;
+    int num_tokens = 0;
+    // Offset in the receive buffer, for tokens of other devices
+    int64_t recv_token_offset = 0;
+  };
+
+  // Tokens pushed by this device to an expert's owner
+  struct DispatchCopy {
+    void* dst = nullptr;
+    void const* src = nullptr;
+    size_t bytes = 0;
+    ElementFlag* flag_ptr = nullptr;
+  };
+
+  struct DistributedGroupedGemmState {
+    int device_idx = 0;
+
+    DeviceGemm gemm;
+    int num_groups = 0;
+    int num_local_groups = 0;
+    std::vector<UnderlyingProblemShape> problem_sizes_host;
+    std::vector<DispatchCopy> dispatch_copies;
+
+    ElementFlag* group_flag_ptr = nullptr;
+    cutlass::Array<ElementBarrier*, TP_> device_barrier_ptrs;
+
+    cudaGraph_t graph;
+    cudaGraphExec_t graph_executable;
+    bool graph_created = false;
+    bool graph_instantiated = false;
+    bool is_initialized = false;
+  };
+
+private:
+
+  DistributedGroupedGemmState state_;
+
+public:
+
+  bool is_initialized() {
+    return state_.is_initialized && state_.graph_created && state_.graph_instantiated;
+  }
+
+  static int
+  get_max_groups(Arguments const& args) {
+    return TP_ * args.num_local_experts;
+  }
+
+  static int
+  get_num_tokens(Arguments const& args, int device_idx, int expert) {
+    return args.token_counts[device_idx * get_max_groups(args) + expert];
+  }
+
+  // First token of an expert in a device's (sorted) tokens
+  static int64_t
+  get_token_offset(Arguments const& args, int device_idx, int expert) {
+    int64_t offset = 0;
+    for (int e = 0; e < expert; ++e) {
+      offset += get_num_tokens(args, device_idx, e);
+    }
+    return offset;
+  }
+
+  static std::vector<GroupInfo>
+  get_groups(Arguments const& args, int device_idx) {
+    std::vector<GroupInfo> groups;
+    int64_t recv_token_offset = 0;
+
+    for (int i = 0; i < TP_; ++i) {
+      int source = (device_idx - i + TP_) % TP_;
+      for (int e = 0; e < args.num_local_experts; ++e) {
+        int num_tokens = get_num_tokens(args, source, device_idx * args.num_local_experts + e);
+        if (num_tokens == 0) {
+          continue;
+        }
+        groups.push_back({e, source, num_tokens, recv_token_offset});
+        if (source != device_idx) {
+          recv_token_offset += num_tokens;
+        }
+      }
+    }
+    return groups;
+  }
+
+  //
+  // Buffer space: |  receive buffer  |  group flags  |  problem sizes  |  ptr_{A,B,C,D}  |  stride_{A,B,C,D}  |  GEMM workspace  |
+  //
+  static size_t
+  get_recv_buffer_size(Arguments const& args, int device_idx) {
+    size_t num_tokens = 0;
+    for (auto const& group : get_groups(args, device_idx)) {
+      if (group.source != device_idx) {
+        num_tokens += group.num_tokens;
+      }
+    }
+    return round_nearest(num_tokens * args.K * sizeof(ElementA), MinWorkspaceAlignment);
+  }
+
+  static size_t
+  get_group_array_size(Arguments const& args, size_t element_bytes) {
+    return round_nearest(get_max_groups(args) * element_bytes, MinWorkspaceAlignment);
+  }
+
+  static size_t
+  get_buffer_space_size(Arguments const& args, int device_idx) {
+    return get_recv_buffer_size(args, device_idx) +
+      get_group_array_size(args, sizeof(ElementFlag)) +
+      get_group_array_size(args, sizeof(UnderlyingProblemShape)) +
+      get_group_array_size(args, sizeof(void*)) * 4 +
+      get_group_array_size(args, sizeof(InternalStrideA)) +
+      get_group_array_size(args, sizeof(InternalStrideB)) +
+      get_group_array_size(args, sizeof(InternalStrideC)) +
+      get_group_array_size(args, sizeof(InternalStrideD));
+  }
+
+  static ElementFlag*
+  workspace_ptr_to_group_flag_ptr(void* workspace_ptr, Arguments const& args, int device_idx) {
+    return reinterpret_cast<ElementFlag*>(
+        reinterpret_cast<uint8_t*>(workspace_ptr) + get_recv_buffer_size(args, device_idx));
+  }
+
+  static InternalStrideA
+  make_stride_A(Arguments const& args) {
+    InternalStrideA stride{};
+    cute::get<0>(stride) = args.K;
+    return stride;
+  }
+
+  static InternalStrideB
+  make_stride_B(Arguments const& args) {
+    InternalStrideB stride{};
+    if constexpr (cutlass::gemm::detail::is_k_major<InternalStrideB>()) {
+      cute::get<0>(stride) = args.K;
+    }
+    else {
+      cute::get<1>(stride) = args.N;
+    }
+    return stride;
+  }
+
+  template <class InternalStrideC_>
+  static InternalStrideC_
+  make_stride_CD(Arguments const& args) {
+    InternalStrideC_ stride{};
+    cute::get<0>(stride) = args.N;
+    return stride;
+  }
+
+  /// Determines whether the grouped GEMM can execute the given problem.
+  static Status
+  can_implement(Arguments const& args) {
+    if (args.num_local_experts <= 0 || args.token_counts == nullptr || args.ptr_weights == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Expert-parallel grouped GEMM requires experts, host token counts, and weights.\n");
+      return Status::kInvalid;
+    }
+    return Status::kSuccess;
+  }
+
+  /// Gets the workspace size of a device, including the buffer space and the grouped GEMM's workspace.
+  static size_t
+  get_workspace_size(Arguments const* args, int device_idx) {
+    auto groups = get_groups(args[device_idx], device_idx);
+    std::vector<UnderlyingProblemShape> problem_sizes_host;
+    for (auto const& group : groups) {
+      problem_sizes_host.push_back({group.num_tokens, args[device_idx].N, args[device_idx].K});
+    }
+
+    typename GemmKernel::Arguments gemm_args{};
+    gemm_args.mode = cutlass::gemm::GemmUniversalMode::kGrouped;
+    gemm_args.problem_shape = {static_cast<int>(groups.size()), nullptr, problem_sizes_host.data()};
+    gemm_args.hw_info = args[device_idx].hw_info;
+
+    return get_buffer_space_size(args[device_idx], device_idx) + DeviceGemm::get_workspace_size(gemm_args);
+  }
+
+  static size_t
+  get_exclusive_workspace_size() {
+    return round_nearest(sizeof(ElementBarrier), 32);
+  }
+
+  /// Initializes grouped GEMM state from the arguments of all devices.
+  Status
+  initialize(
+    Arguments const* args,
+    void** workspace_ptrs,
+    void** exclusive_workspace_ptrs,
+    int device_idx,
+    cudaStream_t stream = nullptr) {
+
+    CUTLASS_TRACE_HOST("DistributedGroupedGemm::initialize() - stream: " << (stream ? "non-null" : "null"));
+
+    Arguments const& local_args = args[device_idx];
+    state_.device_idx = device_idx;
+
+    for (int device = 0; device < TP_; ++device) {
+      state_.device_barrier_ptrs[device] = reinterpret_cast<ElementBarrier*>(exclusive_workspace_ptrs[device]);
+    }
+    zero_workspace(exclusive_workspace_ptrs[device_idx], get_exclusive_workspace_size(), stream, nullptr);
+
+    // 1. Groups of this device, and their operands
+    auto groups = get_groups(local_args, device_idx);
+    state_.num_groups = static_cast<int>(groups.size());
+    state_.num_local_groups = 0;
+    state_.problem_sizes_host.clear();
+
+    auto recv_ptr = reinterpret_cast<ElementA*>(workspace_ptrs[device_idx]);
+    std::vector<ElementA const*> ptr_A_host;
+    std::vector<ElementB const*> ptr_B_host;
+    std::vector<ElementC const*> ptr_C_host;
+    std::vector<ElementD*> ptr_D_host;
+
+    for (auto const& group : groups) {
+      int expert = device_idx * local_args.num_local_experts + group.expert;
+      state_.problem_sizes_host.push_back({group.num_tokens, local_args.N, local_args.K});
+
+      if (group.source == device_idx) {
+        ++state_.num_local_groups;
+        ptr_A_host.push_back(local_args.ptr_tokens + get_token_offset(local_args, device_idx, expert) * local_args.K);
+      }
+      else {
+        ptr_A_host.push_back(recv_ptr + group.recv_token_offset * local_args.K);
+      }
+      ptr_B_host.push_back(local_args.ptr_weights[group.expert]);
+
+      // Outputs are written straight into the source device's output
+      ElementD* ptr_output = args[group.source].ptr_output +
+        get_token_offset(local_args, group.source, expert) * local_args.N;
+      ptr_C_host.push_back(ptr_output);
+      ptr_D_host.push_back(ptr_output);
+    }
+
+    std::vector<InternalStrideA> stride_A_host(groups.size(), make_stride_A(local_args));
+    std::vector<InternalStrideB> stride_B_host(groups.size(), make_stride_B(local_args));
+    std::vector<InternalStrideC> stride_C_host(groups.size(), make_stride_CD<InternalStrideC>(local_args));
+    std::vector<InternalStrideD> stride_D_host(groups.size(), make_stride_CD<InternalStrideD>(local_args));
+
+    // 2. Copy group arrays into the buffer space
+    uint8_t* buffer_ptr = reinterpret_cast<uint8_t*>(workspace_ptrs[device_idx]) + get_recv_buffer_size(local_args, device_idx);
+    state_.group_flag_ptr = reinterpret_cast<ElementFlag*>(buffer_ptr);
+    buffer_ptr += get_group_array_size(local_args, sizeof(ElementFlag));
+
+    Status status = detail::check_cuda_status(cudaMemsetAsync(
+          state_.group_flag_ptr, 0, get_max_groups(local_args) * sizeof(ElementFlag), stream));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    auto copy_group_array = [&](auto const& host_array, auto*& device_array) -> Status {
+      using T = typename std::decay_t<decltype(host_array)>::value_type;
+      device_array = reinterpret_cast<T*>(buffer_ptr);
+      buffer_ptr += get_group_array_size(local_args, sizeof(T));
+      if (host_array.empty()) {
+        return Status::kSuccess;
+      }
+      return detail::check_cuda_status(cudaMemcpyAsync(
+            device_array, host_array.data(), host_array.size() * sizeof(T), cudaMemcpyHostToDevice, stream));
+    };
+
+    UnderlyingProblemShape* problem_sizes = nullptr;
+    ElementA const** ptr_A = nullptr;
+    ElementB const** ptr_B = nullptr;
+    ElementC const** ptr_C = nullptr;
+    ElementD** ptr_D = nullptr;
+    InternalStrideA* stride_A = nullptr;
+    InternalStrideB* stride_B = nullptr;
+    InternalStrideC* stride_C = nullptr;
+    InternalStrideD* stride_D = nullptr;
+
+    for (Status array_status : {
+          copy_group_array(state_.problem_sizes_host, problem_sizes),
+          copy_group_array(ptr_A_host, ptr_A),
+          copy_group_array(ptr_B_host, ptr_B),
+          copy_group_array(ptr_C_host, ptr_C),
+          copy_group_array(ptr_D_host, ptr_D),
+          copy_group_array(stride_A_host, stride_A),
+          copy_group_array(stride_B_host, stride_B),
+          copy_group_array(stride_C_host, stride_C),
+          copy_group_array(stride_D_host, stride_D)}) {
+      if (array_status != Status::kSuccess) {
+        return array_status;
+      }
+    }
+
+    // Host arrays go out of scope
+    status = detail::check_cuda_status(cudaStreamSynchronize(stream));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    // 3. Tokens this device pushes to each expert's owner, ordered by distance to the owner
+    state_.dispatch_copies.clear();
+    for (int i = 1; i < TP_; ++i) {
+      int owner = (device_idx + i) % TP_;
+      auto owner_groups = get_groups(args[owner], owner);
+      auto owner_recv_ptr = reinterpret_cast<ElementA*>(workspace_ptrs[owner]);
+      auto owner_flag_ptr = workspace_ptr_to_group_flag_ptr(workspace_ptrs[owner], args[owner], owner);
+
+      for (int group_idx = 0; group_idx < static_cast<int>(owner_groups.size()); ++group_idx) {
+        auto const& group = owner_groups[group_idx];
+        if (group.source != device_idx) {
+          continue;
+        }
+        int expert = owner * local_args.num_local_experts + group.expert;
+        state_.dispatch_copies.push_back({
+          owner_recv_ptr + group.recv_token_offset * local_args.K,
+          local_args.ptr_tokens + get_token_offset(local_args, device_idx, expert) * local_args.K,
+          static_cast<size_t>(group.num_tokens) * local_args.K * sizeof(ElementA),
+          owner_flag_ptr + group_idx
+        });
+      }
+    }
+
+    // 4. Grouped GEMM over all groups of this device
+    if (state_.num_groups > 0) {
+      MainloopArguments mainloop_args{};
+      mainloop_args.ptr_A = ptr_A;
+      mainloop_args.dA = stride_A;
+      mainloop_args.ptr_B = ptr_B;
+      mainloop_args.dB = stride_B;
+      mainloop_args.ptr_group_flags = state_.group_flag_ptr;
+
+      typename GemmKernel::Arguments gemm_args{};
+      gemm_args.mode = cutlass::gemm::GemmUniversalMode::kGrouped;
+      gemm_args.problem_shape = {state_.num_groups, problem_sizes, state_.problem_sizes_host.data()};
+      gemm_args.mainloop = mainloop_args;
+      gemm_args.epilogue = {local_args.epilogue, ptr_C, stride_C, ptr_D, stride_D};
+      gemm_args.hw_info = local_args.hw_info;
+
+      status = state_.gemm.can_implement(gemm_args);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      void* gemm_workspace = reinterpret_cast<uint8_t*>(workspace_ptrs[device_idx]) +
+        get_buffer_space_size(local_args, device_idx);
+      status = state_.gemm.initialize(gemm_args, gemm_workspace, stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    state_.is_initialized = true;
+
+    return construct_graph();
+  }
+
+  Status
+  construct_graph() {
+#if (__CUDACC_VER_MAJOR__ > 12 || (__CUDACC_VER_MAJOR__ == 12 && __CUDACC_VER_MINOR__ >= 6))
+    Status status = Status::kSuccess;
+
+    if (state_.graph_created) {
+      status = detail::check_cuda_status(cudaGraphDestroy(state_.graph));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    // Dispatch runs on a side stream, forked from and joined into the GEMM's stream
+    cudaStream_t stream;
+    cudaStream_t dispatch_stream;
+    cudaEvent_t fork_event;
+    cudaEvent_t join_event;
+    for (cudaError_t result : {
+          cudaStreamCreate(&stream),
+          cudaStreamCreate(&dispatch_stream),
+          cudaEventCreateWithFlags(&fork_event, cudaEventDisableTiming),
+          cudaEventCreateWithFlags(&join_event, cudaEventDisableTiming)}) {
+      status = detail::check_cuda_status(result);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    status = detail::check_cuda_status(cudaStreamBeginCapture(stream, cudaStreamCaptureModeRelaxed));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    state_.graph_created = true;
+
+    // 1. Full barrier: receive buffers and flags of all devices are free
+    cutlass::Array<ElementFlag*, 1> flag_ptrs;
+    flag_ptrs[0] = state_.group_flag_ptr;
+    launch_full_barrier<TP_, ElementBarrier, 1, ElementFlag>(
+        state_.device_barrier_ptrs, flag_ptrs, state_.device_idx, stream, /* launch_with_pdl = */ false);
+
+    status = detail::check_cuda_status(cudaEventRecord(fork_event, stream));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    status = detail::check_cuda_status(cudaStreamWaitEvent(dispatch_stream, fork_event));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    // 2. Dispatch: local groups are resident, push tokens to owners and flag their arrival
+    if (state_.num_local_groups > 0) {
+      status = detail::check_cuda_status(cudaMemsetAsync(
+            state_.group_flag_ptr, 0b11111111, state_.num_local_groups * sizeof(ElementFlag), dispatch_stream));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    for (auto const& copy : state_.dispatch_copies) {
+      status = detail::check_cuda_status(cudaMemcpyAsync(
+            copy.dst, copy.src, copy.bytes, cudaMemcpyDeviceToDevice, dispatch_stream));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+      status = detail::check_cuda_status(cudaMemsetAsync(
+            copy.flag_ptr, 0b11111111, sizeof(ElementFlag), dispatch_stream));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    status = detail::check_cuda_status(cudaEventRecord(join_event, dispatch_stream));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    // 3. Grouped GEMM, concurrent with the dispatch; groups wait on their own flags
+    if (state_.num_groups > 0) {
+      status = state_.gemm.run(stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    status = detail::check_cuda_status(cudaStreamWaitEvent(stream, join_event));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    // 4. Full barrier: outputs of all devices have been combined into this device's output
+    launch_full_barrier<TP_, ElementBarrier, 1, ElementFlag>(
+        state_.device_barrier_ptrs, flag_ptrs, state_.device_idx, stream, /* launch_with_pdl = */ false);
+
+    // Peers only push again after the next run's first barrier
+    if (state_.num_groups > 0) {
+      status = detail::check_cuda_status(cudaMemsetAsync(
+            state_.group_flag_ptr, 0, state_.num_groups * sizeof(ElementFlag), stream));
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    status = detail::check_cuda_status(cudaStreamEndCapture(stream, &state_.graph));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    for (cudaError_t result : {
+          cudaEventDestroy(fork_event),
+          cudaEventDestroy(join_event),
+          cudaStreamDestroy(dispatch_stream),
+          cudaStreamDestroy(stream)}) {
+      status = detail::check_cuda_status(result);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    status = detail::check_cuda_status(cudaGraphInstantiate(
+          &state_.graph_executable,
+          state_.graph,
+          /* flags = */ 0));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    state_.graph_instantiated = true;
+
+    return Status::kSuccess;
+#else
+      CUTLASS_TRACE_HOST("  construct_graph() failure: target was compiled with an incompatible " <<
+          "version of the CUDA toolkit. Please compile Distributed GEMM with CUDA toolkit 12.4 or later.");
+      return Status::kErrorInternal;
+#endif
+  }
+
+  Status
+  run(cudaStream_t stream = nullptr) {
+    CUTLASS_TRACE_HOST("DistributedGroupedGemm::run()");
+
+    if (not is_initialized()) {
+      CUTLASS_TRACE_HOST("  Distributed grouped gemm was not initialized. Did you forget to call initialize()?");
+      return Status::kErrorInternal;
+    }
+
+    cudaError_t result = cudaGraphLaunch(state_.graph_executable, stream);
+    if (cudaSuccess != result) {
+      result = cudaGetLastError(); // to clear the error bit
+      CUTLASS_TRACE_HOST("  cudaGraphLaunch() returned error: " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+
+    return Status::kSuccess;
+  }
+
+  Status
+  operator()(cudaStream_t stream = nullptr) {
+    return run(stream);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::distributed::device
+
+////////////////////////////////////////////////////////////////////////////////
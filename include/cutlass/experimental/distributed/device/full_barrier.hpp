@@ -29,7 +29,7 @@
  *
  **************************************************************************************************/
 /*! \file
-    \brief Device layer interface for Distributed GEMM barrier kernel.
+    \brief Device layer interface for Distributed GEMM barrier and flag wait kernels.
 */
 
 #pragma once
@@ -70,5 +70,13 @@ void launch_full_barrier(
 #endif
 }
 
+template <typename FlagType>
+void launch_wait_flag(
+    FlagType const* flag_ptr,
+    cudaStream_t stream) {
+
+  cutlass::distributed::kernel::wait_flag_kernel<FlagType><<<1, 1, 0, stream>>>(flag_ptr);
+}
+
 } // namespace cutlass::distributed::device
 
@@ -0,0 +1,64 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device layer interface for Distributed GEMM peer copy kernel.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/experimental/distributed/kernel/peer_copy.hpp"
+
+namespace cutlass::distributed::device {
+
+template <int ThreadCount = 512>
+void launch_peer_copy(
+    void* dst,
+    void const* src,
+    size_t bytes,
+    int num_ctas,
+    cudaStream_t stream) {
+
+  // 16B accesses unless the slice isn't aligned to them
+  bool is_vectorized = (reinterpret_cast<uintptr_t>(dst) % 16 == 0) &&
+                       (reinterpret_cast<uintptr_t>(src) % 16 == 0) &&
+                       (bytes % 16 == 0);
+  if (is_vectorized) {
+    cutlass::distributed::kernel::peer_copy_kernel<uint4><<<num_ctas, ThreadCount, 0, stream>>>(
+        reinterpret_cast<uint4*>(dst), reinterpret_cast<uint4 const*>(src), bytes / 16);
+  }
+  else {
+    cutlass::distributed::kernel::peer_copy_kernel<uint8_t><<<num_ctas, ThreadCount, 0, stream>>>(
+        reinterpret_cast<uint8_t*>(dst), reinterpret_cast<uint8_t const*>(src), bytes);
+  }
+}
+
+} // namespace cutlass::distributed::device
@@ -0,0 +1,166 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM all-reduce kernel.
+
+    Reduces the partial outputs of row-parallel (K-sharded) GEMMs across devices after the local
+    GEMM stages, by pushing partials into peers' receive slots. The output is split into chunks,
+    each with their own arrival flags, so a chunk is reduced as soon as all of its partials have
+    arrived instead of after a barrier on the whole output:
+
+      * One-shot: every device pushes each chunk of its partial to all peers, and reduces all
+        chunks locally. A single communication step, best for small messages.
+      * Two-shot: chunk c is owned by device c % TP. Devices push each chunk to its owner only, the
+        owner reduces it and pushes the result back to all peers. Moves about 2 / TP of the data of
+        one-shot per device, at the cost of a second step.
+
+    Flags are reset by their consumer once a chunk is done. Peers can only signal again after the
+    next full barrier, which all devices reach after this kernel.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+namespace cutlass::distributed::kernel {
+
+// Output elements per chunk (and per CTA iteration)
+static constexpr int AllReduceChunkElements = 2048;
+static constexpr int AllReduceThreadCount = 256;
+
+template <int NP, typename Element>
+struct AllReduceParams {
+  Element* ptr_D = nullptr;                       // local partial, reduced in place
+  cutlass::Array<Element*, NP> peer_D_ptrs;       // D of every device, written by the chunk owner (two-shot)
+  cutlass::Array<Element*, NP> peer_slot_ptrs;    // slot receiving this device's partial on every device
+  Element const* ptr_slots = nullptr;             // local receive slots, (NP - 1) x num_elements
+  cutlass::Array<uint32_t*, NP> peer_flag_ptrs;   // flags of every device, 2 x num_chunks
+  uint32_t* ptr_flags = nullptr;                  // local flags: [0, num_chunks) partials, [num_chunks, 2 x num_chunks) results
+  int64_t num_elements = 0;
+  int num_chunks = 0;
+  int device_idx = 0;
+};
+
+template <int NP, bool TwoShot, typename Element>
+__global__ void all_reduce_kernel(AllReduceParams<NP, Element> params) {
+
+  using ElementCompute = float;
+  NumericConverter<ElementCompute, Element> to_compute;
+  NumericConverter<Element, ElementCompute> to_output;
+
+  int device_idx = params.device_idx;
+
+  for (int chunk = blockIdx.x; chunk < params.num_chunks; chunk += gridDim.x) {
+    int64_t chunk_begin = static_cast<int64_t>(chunk) * AllReduceChunkElements;
+    int64_t chunk_end = chunk_begin + AllReduceChunkElements < params.num_elements ?
+      chunk_begin + AllReduceChunkElements : params.num_elements;
+
+    int owner = TwoShot ? chunk % NP : device_idx;
+    bool is_owner = owner == device_idx;
+
+    // 1. Push this device's partial to the devices reducing the chunk
+    CUTLASS_PRAGMA_UNROLL
+    for (int peer = 0; peer < NP; ++peer) {
+      if (peer != device_idx && (not TwoShot || peer == owner)) {
+        for (int64_t i = chunk_begin + threadIdx.x; i < chunk_end; i += blockDim.x) {
+          params.peer_slot_ptrs[peer][i] = params.ptr_D[i];
+        }
+      }
+    }
+    __syncthreads();
+
+    if (threadIdx.x == 0) {
+      __threadfence_system();
+      CUTLASS_PRAGMA_UNROLL
+      for (int peer = 0; peer < NP; ++peer) {
+        if (peer != device_idx && (not TwoShot || peer == owner)) {
+          detail::red_release_sys_add(params.peer_flag_ptrs[peer] + chunk, 1);
+        }
+      }
+    }
+
+    // 2. Reduce the chunk once all partials have arrived
+    if (is_owner) {
+      if (threadIdx.x == 0) {
+        detail::wait_flag(params.ptr_flags + chunk, NP - 1);
+        params.ptr_flags[chunk] = 0;
+      }
+      __syncthreads();
+
+      for (int64_t i = chunk_begin + threadIdx.x; i < chunk_end; i += blockDim.x) {
+        ElementCompute acc = to_compute(params.ptr_D[i]);
+        CUTLASS_PRAGMA_UNROLL
+        for (int slot = 0; slot < NP - 1; ++slot) {
+          acc += to_compute(params.ptr_slots[slot * params.num_elements + i]);
+        }
+        Element result = to_output(acc);
+        params.ptr_D[i] = result;
+
+        // 3. Two-shot: push the result back to all peers
+        if constexpr (TwoShot) {
+          CUTLASS_PRAGMA_UNROLL
+          for (int peer = 0; peer < NP; ++peer) {
+            if (peer != device_idx) {
+              params.peer_D_ptrs[peer][i] = result;
+            }
+          }
+        }
+      }
+
+      if constexpr (TwoShot) {
+        __syncthreads();
+        if (threadIdx.x == 0) {
+          __threadfence_system();
+          CUTLASS_PRAGMA_UNROLL
+          for (int peer = 0; peer < NP; ++peer) {
+            if (peer != device_idx) {
+              detail::red_release_sys_add(params.peer_flag_ptrs[peer] + params.num_chunks + chunk, 1);
+            }
+          }
+        }
+      }
+    }
+    else {
+      // Two-shot: the output is complete once the owner's result has arrived
+      if (threadIdx.x == 0) {
+        detail::wait_flag(params.ptr_flags + params.num_chunks + chunk, 1);
+        params.ptr_flags[params.num_chunks + chunk] = 0;
+      }
+    }
+    __syncthreads();
+  }
+}
+
+} // namespace cutlass::distributed::kernel
@@ -35,6 +35,7 @@
 #pragma once
 
 #include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -65,6 +66,116 @@ void ld_without_cache(uint32_t& val, void const * ptr) {
       : "l"(ptr));
 }
 
+// Acquire load at system scope, pairs with the release reductions below
+CUTLASS_DEVICE
+void ld_acquire_sys(uint32_t& val, void const * ptr) {
+  asm volatile(
+      "{\n"
+      "  ld.acquire.sys.global.u32 %0, [%1];\n"
+      "}\n"
+      : "=r"(val)
+      : "l"(ptr)
+      : "memory");
+}
+
+// Release reduction at system scope
+// Used for per-tile completion flags that live in a peer device's memory
+CUTLASS_DEVICE
+void red_release_sys_add(uint32_t* ptr, uint32_t val) {
+  asm volatile(
+      "{\n"
+      "  red.release.sys.global.add.u32 [%0], %1;\n"
+      "}\n"
+      :
+      : "l"(ptr), "r"(val)
+      : "memory");
+}
+
+// Multimem (NVLink SHARP) reductions into a multicast address, applied on every device bound
+// to the multicast object. Require SM90 and CUDA 12.1.
+// Reference:
+// https://docs.nvidia.com/cuda/parallel-thread-execution/#data-movement-and-conversion-instructions-multimem-ld-reduce-multimem-st-multimem-red
+
+CUTLASS_DEVICE
+void multimem_red_release_sys_add(uint32_t* mc_ptr, uint32_t val) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+  asm volatile(
+      "{\n"
+      "  multimem.red.release.sys.global.add.u32 [%0], %1;\n"
+      "}\n"
+      :
+      : "l"(mc_ptr), "r"(val)
+      : "memory");
+#else
+  CUTLASS_UNUSED(mc_ptr);
+  CUTLASS_UNUSED(val);
+  CUTLASS_NOT_IMPLEMENTED();
+#endif
+}
+
+CUTLASS_DEVICE
+void multimem_red_add(float* mc_ptr, float val) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+  asm volatile(
+      "{\n"
+      "  multimem.red.relaxed.sys.global.add.f32 [%0], %1;\n"
+      "}\n"
+      :
+      : "l"(mc_ptr), "f"(val)
+      : "memory");
+#else
+  CUTLASS_UNUSED(mc_ptr);
+  CUTLASS_UNUSED(val);
+  CUTLASS_NOT_IMPLEMENTED();
+#endif
+}
+
+CUTLASS_DEVICE
+void multimem_red_add(cutlass::half_t* mc_ptr, cutlass::half_t val) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+  asm volatile(
+      "{\n"
+      "  multimem.red.relaxed.sys.global.add.noftz.f16 [%0], %1;\n"
+      "}\n"
+      :
+      : "l"(mc_ptr), "h"(val.raw())
+      : "memory");
+#else
+  CUTLASS_UNUSED(mc_ptr);
+  CUTLASS_UNUSED(val);
+  CUTLASS_NOT_IMPLEMENTED();
+#endif
+}
+
+CUTLASS_DEVICE
+void multimem_red_add(cutlass::bfloat16_t* mc_ptr, cutlass::bfloat16_t val) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+  asm volatile(
+      "{\n"
+      "  multimem.red.relaxed.sys.global.add.noftz.bf16 [%0], %1;\n"
+      "}\n"
+      :
+      : "l"(mc_ptr), "h"(val.raw())
+      : "memory");
+#else
+  CUTLASS_UNUSED(mc_ptr);
+  CUTLASS_UNUSED(val);
+  CUTLASS_NOT_IMPLEMENTED();
+#endif
+}
+
+// Spins until a completion flag reaches the expected count
+// Flags only ever increase, so a consumer passes epoch * (number of producers) and no reset is needed
+CUTLASS_DEVICE
+void wait_flag(uint32_t const* ptr, uint32_t expected) {
+  uint32_t curr_val = 0;
+  ld_acquire_sys(curr_val, ptr);
+  while (curr_val < expected) {
+    __nanosleep(40);
+    ld_acquire_sys(curr_val, ptr);
+  }
+}
+
 } // namespace cutlass::distributed::kernel::detail
 
 ///////////////////////////////////////////////////////////////////////////////
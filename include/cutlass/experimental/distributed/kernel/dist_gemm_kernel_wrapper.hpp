@@ -40,8 +40,11 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/arch/grid_dependency_control.h"
 #include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
 
 #include "cutlass/experimental/distributed/kernel/detail.hpp"
+#include "cutlass/experimental/distributed/kernel/tile_arrival_mainloop.hpp"
+#include "cutlass/experimental/distributed/schedules/dist_gemm_base_schedule.hpp"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -53,6 +56,30 @@ namespace detail {
 template <typename GemmKernel_>
 struct SupportsDistributedGemm: cutlass::gemm::detail::IsCutlass3GemmKernel<GemmKernel_> {};
 
+// Local GEMM kernel of a stage: schedules with tile-granular arrival wrap the mainloop so that its
+// loads wait on the chunks they read.
+template <typename GemmKernel_, typename DistSchedule_, typename Enable = void>
+struct DistributedBaseKernel {
+  using type = GemmKernel_;
+};
+
+template <
+  class ProblemShape_,
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  class TileSchedulerTag_,
+  class DistSchedule_>
+struct DistributedBaseKernel<
+    cutlass::gemm::kernel::GemmUniversal<ProblemShape_, CollectiveMainloop_, CollectiveEpilogue_, TileSchedulerTag_>,
+    DistSchedule_,
+    cute::enable_if_t<(DistSchedule_::NumArrivalChunks > 1)>> {
+  using type = cutlass::gemm::kernel::GemmUniversal<
+    ProblemShape_,
+    TileArrivalMainloop<CollectiveMainloop_, DistSchedule_::MemcpyA ? 0 : 1>,
+    CollectiveEpilogue_,
+    TileSchedulerTag_>;
+};
+
 } // namespace detail
 
 /*!
@@ -71,14 +98,26 @@ struct DistributedGemmKernelWrapper<
   GemmKernel_,
   DistSchedule_,
   cute::enable_if_t<detail::SupportsDistributedGemm<GemmKernel_>::value>
-  >: GemmKernel_
+  >: detail::DistributedBaseKernel<GemmKernel_, DistSchedule_>::type
 {
   using DistSchedule = DistSchedule_;
   using TP = typename DistSchedule::TP;
 
   static constexpr bool KernelWritesArrivalFlag = DistSchedule::KernelWritesArrivalFlag;
-
-  using BaseKernel = GemmKernel_;
+  // Peer slices read directly are ready as soon as the full barrier completes
+  static constexpr bool IsDirectAccess = DistSchedule::CopyMode == schedules::PeerCopyMode::kDirectAccess;
+  // Memcpied slices can be waited on per tile instead of per stage, see WithTileArrival
+  static constexpr int NumArrivalChunks = DistSchedule::NumArrivalChunks;
+  static constexpr bool TileGranularArrival = NumArrivalChunks > 1;
+  // All-reduce schedules exchange nothing between stages
+  static constexpr bool WaitsOnBuffers = not IsDirectAccess && not DistSchedule::HasAllReduce && not TileGranularArrival;
+
+  using BaseKernel = typename detail::DistributedBaseKernel<GemmKernel_, DistSchedule_>::type;
+
+  static_assert(not TileGranularArrival || (DistSchedule::MemcpyA ?
+        cutlass::gemm::detail::is_k_major<typename BaseKernel::StrideA>() :
+        cutlass::gemm::detail::is_k_major<typename BaseKernel::StrideB>()),
+      "Tile-granular arrival requires the rotated operand to be K-major, so that chunks are contiguous.");
   using BaseArguments = typename BaseKernel::Arguments;
   using BaseParams = typename BaseKernel::Params;
 
@@ -94,6 +133,8 @@ struct DistributedGemmKernelWrapper<
 
     void* self_flag_ptr{nullptr};
     void* peer_flag_ptr{nullptr};
+    // Chunk arrival flags of the stage, with tile-granular arrival
+    void* chunk_flag_ptr{nullptr};
   };
 
   struct PackedArguments {
@@ -125,6 +166,13 @@ struct DistributedGemmKernelWrapper<
 
     auto kernel_params = BaseKernel::to_underlying_arguments(args.base, workspace);
 
+    if constexpr (TileGranularArrival) {
+      auto problem_shape_MNKL = append<4>(args.base.problem_shape, 1);
+      kernel_params.mainloop.ptr_chunk_flags = reinterpret_cast<ElementFlag const*>(args.distributed.chunk_flag_ptr);
+      kernel_params.mainloop.chunk_extent = get<DistSchedule::MemcpyA ? 0 : 1>(problem_shape_MNKL) / NumArrivalChunks;
+      kernel_params.mainloop.num_chunks = NumArrivalChunks;
+    }
+
     DistributedParams dist_params = {
         args.distributed.device_idx,
         args.distributed.iteration,
@@ -181,7 +229,7 @@ struct DistributedGemmKernelWrapper<
   CUTLASS_DEVICE
   void
   barrier_buffer(PackedParams const& params) {
-    if (params.distributed.iteration > 0) {
+    if (WaitsOnBuffers && params.distributed.iteration > 0) {
 
       ElementFlag comm_iter = 0;
       detail::ld_without_cache(comm_iter, params.distributed.self_flag_ptr_);
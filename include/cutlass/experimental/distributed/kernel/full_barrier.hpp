@@ -33,6 +33,9 @@
 
     The kernel resets the per-stage arrival flags, performs a full barrier (any-to-any),
     and also atomically resets the local barrier arrival count.
+
+    The flag wait kernel is used by hierarchical schedules, which copy slices out of a local
+    peer's buffer once the peer has received them.
 */
 
 #pragma once
@@ -58,6 +61,9 @@ __global__ void full_barrier_kernel(
     iteration_flag_ptrs[i][0] = static_cast<FlagType>(0);
   }
 
+  // Peers may wait on these flags as soon as they leave the barrier
+  __threadfence_system();
+
   IntType val = 1;
   IntType max_val = static_cast<IntType>(NP - 1);
 
@@ -78,5 +84,15 @@ __global__ void full_barrier_kernel(
   atomicSub(device_arrival_ptrs[device_idx], max_val);
 }
 
+template <typename FlagType>
+__global__ void wait_flag_kernel(FlagType const* flag_ptr) {
+  FlagType curr_val = 0;
+  detail::ld_without_cache(curr_val, flag_ptr);
+  while (curr_val == 0) {
+    __nanosleep(40);
+    detail::ld_without_cache(curr_val, flag_ptr);
+  }
+}
+
 } // namespace cutlass::distributed::kernel
 
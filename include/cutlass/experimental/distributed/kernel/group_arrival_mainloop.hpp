@@ -0,0 +1,115 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed grouped GEMM mainloop adaptor for flag-gated groups.
+
+    Wraps an SM90 ptr-array (grouped) TMA mainloop so that the load warp waits on a group's arrival
+    flag whenever it moves on to the group's tiles. With expert-parallel grouped GEMMs, groups
+    are (expert, source rank) pairs whose tokens are pushed by their source rank, so each CTA starts
+    on a group's tiles as soon as the group's tokens have arrived, instead of waiting on the full
+    all-to-all dispatch.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::kernel {
+
+template <class CollectiveMainloop_>
+struct GroupArrivalMainloop: CollectiveMainloop_ {
+
+  using Base = CollectiveMainloop_;
+
+  static_assert(Base::ArchTag::kMinComputeCapability == 90,
+      "Flag-gated groups are only supported with SM90 ptr-array mainloops.");
+
+  struct Arguments: Base::Arguments {
+    // Per-group arrival flags, or null if all groups are resident
+    uint32_t const* ptr_group_flags = nullptr;
+  };
+
+  struct Params: Base::Params {
+    uint32_t const* ptr_group_flags = nullptr;
+  };
+
+  template <class ProblemShape, class... Args>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, Args const&... other_args) {
+    return {Base::to_underlying_arguments(problem_shape, args, other_args...), args.ptr_group_flags};
+  }
+
+  // Called by the load warp before the first tile of every group it processes
+  template <class InputTensors, class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  tensors_perform_update(
+      InputTensors const& input_tensors,
+      Params const& mainloop_params,
+      ProblemShape_MNKL problem_shape_mnkl,
+      int32_t next_batch) {
+
+    if (mainloop_params.ptr_group_flags != nullptr) {
+      detail::wait_flag(mainloop_params.ptr_group_flags + next_batch, 1);
+    }
+    return Base::tensors_perform_update(input_tensors, mainloop_params, problem_shape_mnkl, next_batch);
+  }
+};
+
+namespace detail {
+
+// Grouped GEMM kernel whose mainloop is gated on group arrival flags
+template <typename GemmKernel_>
+struct GroupArrivalKernel;
+
+template <
+  class ProblemShape_,
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  class TileSchedulerTag_>
+struct GroupArrivalKernel<
+    cutlass::gemm::kernel::GemmUniversal<ProblemShape_, CollectiveMainloop_, CollectiveEpilogue_, TileSchedulerTag_>> {
+  using type = cutlass::gemm::kernel::GemmUniversal<
+    ProblemShape_,
+    GroupArrivalMainloop<CollectiveMainloop_>,
+    CollectiveEpilogue_,
+    TileSchedulerTag_>;
+};
+
+} // namespace detail
+
+} // namespace cutlass::distributed::kernel
+
+///////////////////////////////////////////////////////////////////////////////
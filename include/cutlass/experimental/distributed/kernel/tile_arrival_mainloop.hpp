@@ -0,0 +1,126 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Distributed GEMM mainloop adaptor for tile-granular arrival of memcpied slices.
+
+    Wraps an SM100 TMA mainloop so that its load warp waits on the arrival flag of the chunk of
+    the rotated operand covering each CTA tile, before issuing the tile's loads. Chunks are copied
+    in order along the rotated mode, so the flag of the last chunk a tile covers is sufficient.
+
+    CTA tiles are expressed in CtaShape_MNK, so that with 2-SM MMAs each CTA of a pair waits on
+    the rows of A it loads itself, and B's wait covers the MMA tile's full N extent.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/kernel/detail.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::kernel {
+
+template <
+  class CollectiveMainloop_,
+  int RotatedMode_>               // 0 if A is rotated (M tiles), 1 if B is rotated (N tiles)
+struct TileArrivalMainloop: CollectiveMainloop_ {
+
+  using Base = CollectiveMainloop_;
+  using ClusterShape = typename Base::DispatchPolicy::ClusterShape;
+  using CtaShape_MNK = typename Base::CtaShape_MNK;
+  using MainloopPipeline = typename Base::MainloopPipeline;
+  using MainloopPipelineState = typename Base::MainloopPipelineState;
+
+  static constexpr int RotatedMode = RotatedMode_;
+  static_assert(RotatedMode == 0 || RotatedMode == 1, "Only A or B can be rotated.");
+  static_assert(Base::ArchTag::kMinComputeCapability >= 100,
+      "Tile-granular arrival is only supported with SM100 mainloops.");
+
+  struct Params: Base::Params {
+    // Arrival flags of the current stage's chunks, or null when the stage's operands are local
+    uint32_t const* ptr_chunk_flags = nullptr;
+    // Extent of the rotated mode covered by each chunk
+    int chunk_extent = 0;
+    int num_chunks = 0;
+  };
+
+  template <class... Args>
+  static Params
+  to_underlying_arguments(Args const&... args) {
+    return {Base::to_underlying_arguments(args...)};
+  }
+
+  CUTLASS_DEVICE
+  TileArrivalMainloop(Params const& params, ClusterShape cluster_shape, uint32_t block_rank_in_cluster)
+    : Base(params, cluster_shape, block_rank_in_cluster)
+    , ptr_chunk_flags_(params.ptr_chunk_flags)
+    , chunk_extent_(params.chunk_extent)
+    , num_chunks_(params.num_chunks) { }
+
+  template <
+    class LoadParams,
+    class TileCoordMNKL,
+    class KTileIterator
+  >
+  CUTLASS_DEVICE auto
+  load(
+    MainloopPipeline mainloop_pipeline,
+    MainloopPipelineState mainloop_pipe_producer_state,
+    LoadParams const& load_inputs,
+    TileCoordMNKL const& cta_coord_mnkl,
+    KTileIterator k_tile_iter, int k_tile_count) {
+
+    if (ptr_chunk_flags_ != nullptr && k_tile_count > 0) {
+      int tile_extent = cute::size<RotatedMode>(CtaShape_MNK{});
+      int last_row = (static_cast<int>(get<RotatedMode>(cta_coord_mnkl)) + 1) * tile_extent - 1;
+      // Residue tiles extend past the last chunk
+      int chunk = cute::min(last_row / chunk_extent_, num_chunks_ - 1);
+      detail::wait_flag(ptr_chunk_flags_ + chunk, 1);
+    }
+
+    return Base::load(
+      mainloop_pipeline,
+      mainloop_pipe_producer_state,
+      load_inputs,
+      cta_coord_mnkl,
+      k_tile_iter, k_tile_count);
+  }
+
+private:
+  uint32_t const* ptr_chunk_flags_ = nullptr;
+  int chunk_extent_ = 0;
+  int num_chunks_ = 0;
+};
+
+} // namespace cutlass::distributed::kernel
+
+///////////////////////////////////////////////////////////////////////////////
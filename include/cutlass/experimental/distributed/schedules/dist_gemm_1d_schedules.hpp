@@ -318,6 +318,86 @@ struct AllGather1D_TilingCD_RotatingB: BaseSchedule<
     /* NumBuffersD_ = */ 0>{};
 
 
+// GEMM + AllReduce
+// Row-parallel layers (e.g. the second GEMM of an MLP) shard A and B along the K mode like the
+// ReduceScatter schedules, but need the reduced output replicated on all GPUs. For the small M of
+// decode, a reduce-scatter followed by an all-gather pays for two latency-bound collectives, so
+// these schedules compute the full partial [M, N] output locally and all-reduce it afterwards with
+// a push-based kernel (see kernel/all_reduce.hpp) that flags arrivals per output chunk.
+//
+// Each GPU gets an [M, K / TP] slice of A and an [N, K / TP] slice of B, and every stage computes
+// a GEMM of shape [M, N / TP, K / TP] into its own N tile of the local partial D:
+//
+//              Tensor C/D
+//          (partial, then reduced)
+//
+//      |-----|-----|-----|-----|
+//      |     |     |     |     |
+// GPU0 |  0  |  1  |  2  |  3  |
+//      |_____|_____|_____|_____|
+//      |     |     |     |     |
+// GPU1 |  3  |  0  |  1  |  2  |
+//      |_____|_____|_____|_____|
+//      |     |     |     |     |
+// GPU2 |  2  |  3  |  0  |  1  |
+//      |_____|_____|_____|_____|
+//      |     |     |     |     |
+// GPU3 |  1  |  2  |  3  |  0  |
+//      |_____|_____|_____|_____|
+//
+//                               M x N
+//
+//  Tensor C/D's access pattern is the same as in AllGather1D_TilingCD_RotatingB:
+//    tile_idx = (device_idx + iter) % TP
+//  which can be expressed with the following CuTe layout:
+//    (TP, TP) : (1, 1)
+//
+//  Nothing is exchanged between stages, so no buffers are memcpied and kernels don't wait on
+//  arrival flags. Instead, every device owns TP - 1 receive slots the size of its D in the
+//  adapter's buffer space, and the all-reduce kernel runs after the last stage:
+//    * One-shot moves (TP - 1) x |D| per device in a single step, and should be preferred for
+//      small messages.
+//    * Two-shot moves 2 x (TP - 1) / TP x |D| per device in two steps, and wins once the
+//      all-reduce is bandwidth-bound.
+//
+//  C is added by every partial, so these schedules can't have an epilogue source (beta == 0),
+//  and D must be packed.
+//
+template <class TP_, AllReduceAlgorithm AllReduce_>
+struct AllReduce1D_TilingB: BaseSchedule<
+    TP_,
+    /* ProcessorTiler_ = */ cute::Shape<_1, _1, TP_, _1>,
+    /* IterationTiler_ = */ cute::Shape<_1, TP_, _1, _1>,
+    /* PeerDeviceMapping_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _1>>,                             // (unused) = device_idx + iter
+    /* IterationMappingM_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::M == 1) = 0
+    /* IterationMappingN_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_1, _1>>,                             // = device_idx + iter
+    /* IterationMappingK_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::K == 1) = 0
+    /* IterationMappingL_ = */ cute::Layout<cute::Shape<TP_, TP_>, cute::Stride<_0, _0>>,                             // (IterationTiler::L == 1) = 0
+    /* ProcessorOffset_ = */ _0,
+    /* MemcpyA_ = */ false,
+    /* MemcpyB_ = */ false,
+    /* KernelWritesArrivalFlag_ = */ false,
+    /* NumBuffersA_ = */ 0,
+    /* NumBuffersB_ = */ 0,
+    /* NumBuffersC_ = */ 0,
+    /* NumBuffersD_ = */ 0> {
+
+  static_assert(AllReduce_ != AllReduceAlgorithm::kNone, "AllReduce schedules need an all-reduce algorithm.");
+
+  static constexpr AllReduceAlgorithm AllReduce = AllReduce_;
+  static constexpr bool HasAllReduce = true;
+
+  // Receive slots for peers' partials, each the size of the local D
+  static constexpr int NumReduceSlots = TP_{} - 1;
+};
+
+template <class TP_>
+struct AllReduce1D_TilingB_OneShot: AllReduce1D_TilingB<TP_, AllReduceAlgorithm::kOneShot> {};
+
+template <class TP_>
+struct AllReduce1D_TilingB_TwoShot: AllReduce1D_TilingB<TP_, AllReduceAlgorithm::kTwoShot> {};
+
+
 } // namespace cutlass::distributed::schedules
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,183 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file 2-D (Hierarchical) Distributed GEMM Schedules
+
+  NOTE: This API is __experimental__ and will change heavily over time.
+  Please proceed with caution when modifying these schedules or defining new ones.
+
+  The 1-D schedules assume all TP devices can access each other's memory directly (one NVLink
+  domain.) When TP spans several such domains (nodes or racks), the schedules below split the
+  device index into (local_idx, node_idx), with
+    device_idx = local_idx + node_idx * NodeSize,
+  and the iteration into (local_iter, node_iter), with
+    iteration = local_iter + node_iter * NodeSize.
+
+  The intra-node rotation is nested inside the inter-node pipeline: for every node step, devices
+  rotate through the slices of one remote node over NVLink, before moving on to the next node.
+  In iteration (local_iter, node_iter) a device consumes the slice owned by device
+    ((local_idx + local_iter) % NodeSize, (node_idx + node_iter) % NumNodes).
+
+  Only one slice per device and remote node crosses the inter-node network: in iterations
+  (0, node_iter > 0) each device pulls the slice from its counterpart on the remote node through
+  the adapter's transport, and in iterations (local_iter > 0, node_iter > 0) it copies the same
+  slice over NVLink from the buffer of the local peer that already pulled it.
+  The remote pulls run concurrently with the NVLink rotation, so they have NodeSize - 1 stages of
+  local GEMMs to hide behind.
+
+  Only the AllGather schedules are provided: ReduceScatter schedules read the peer's D directly
+  from the epilogue, which is not possible across nodes.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+#include "cutlass/cutlass.h"
+
+#include "cutlass/experimental/distributed/schedules/dist_gemm_base_schedule.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::distributed::schedules {
+
+// Maps (device_idx, iter) to
+//   (local_idx + local_iter) % NodeSize + ((node_idx + node_iter) % NumNodes) * NodeSize
+// The wrap-around at each level makes this piecewise linear, so it can't be expressed as a
+// CuTe layout, but it can stand in for one in BaseSchedule.
+template <int NodeSize, int NumNodes>
+struct HierarchicalRotation {
+  static constexpr int rank = 2;
+
+  CUTLASS_HOST_DEVICE
+  int operator()(int device_idx, int iteration) const {
+    int local_idx = device_idx % NodeSize;
+    int node_idx = device_idx / NodeSize;
+    int local_iter = iteration % NodeSize;
+    int node_iter = iteration / NodeSize;
+    return (local_idx + local_iter) % NodeSize + ((node_idx + node_iter) % NumNodes) * NodeSize;
+  }
+};
+
+template <class NodeSize_, class NumNodes_>
+using HierarchicalTP = cute::C<NodeSize_::value * NumNodes_::value>;
+
+// Mapping for modes that are not tiled across iterations (= 0)
+template <class NodeSize_, class NumNodes_>
+using ConstantMapping = cute::Layout<
+    cute::Shape<HierarchicalTP<NodeSize_, NumNodes_>, HierarchicalTP<NodeSize_, NumNodes_>>,
+    cute::Stride<_0, _0>>;
+
+template <class NodeSize_, class NumNodes_, class ProcessorTiler_, class IterationTiler_,
+          class IterationMappingM_, class IterationMappingN_, bool MemcpyA_, bool MemcpyB_>
+struct HierarchicalAllGatherSchedule: BaseSchedule<
+    HierarchicalTP<NodeSize_, NumNodes_>,
+    ProcessorTiler_,
+    IterationTiler_,
+    /* PeerDeviceMapping_ = */ HierarchicalRotation<NodeSize_::value, NumNodes_::value>,
+    IterationMappingM_,
+    IterationMappingN_,
+    /* IterationMappingK_ = */ ConstantMapping<NodeSize_, NumNodes_>,
+    /* IterationMappingL_ = */ ConstantMapping<NodeSize_, NumNodes_>,
+    /* ProcessorOffset_ = */ _0,
+    MemcpyA_,
+    MemcpyB_,
+    /* KernelWritesArrivalFlag_ = */ false,
+    /* NumBuffersA_ = */ MemcpyA_ ? NodeSize_::value * NumNodes_::value - 1 : 0,
+    /* NumBuffersB_ = */ MemcpyB_ ? NodeSize_::value * NumNodes_::value - 1 : 0,
+    /* NumBuffersC_ = */ 0,
+    /* NumBuffersD_ = */ 0> {
+
+  static_assert(NodeSize_{} > 1 && NumNodes_{} > 1,
+      "Hierarchical schedules need more than one device per node and more than one node; "
+      "use the 1-D schedules otherwise.");
+
+  static constexpr int NodeSize = NodeSize_{};
+  static constexpr int NumNodes = NumNodes_{};
+
+  // Slices of remote nodes are pulled over the network only by the device with the same local
+  // index, every other device of the node copies them from that device's buffer.
+  static auto
+  get_copy_source(int device_idx, int iteration) {
+    int local_iter = iteration % NodeSize;
+    int node_iter = iteration / NodeSize;
+
+    if (local_iter == 0 || node_iter == 0) {
+      return cute::make_tuple(HierarchicalAllGatherSchedule::get_remote_peer_id(device_idx, iteration), 0);
+    }
+
+    // The local peer for local_iter pulled the slice in iteration (0, node_iter)
+    int forwarding_peer_idx = HierarchicalAllGatherSchedule::get_remote_peer_id(device_idx, local_iter);
+    return cute::make_tuple(forwarding_peer_idx, node_iter * NodeSize);
+  }
+};
+
+// AllGather + GEMM, hierarchical version of AllGather1D_TilingCD_RotatingA.
+// A and B are tiled along the N mode, A is all-gathered and rotated along M, nesting the
+// intra-node rotation inside the inter-node one.
+//
+// Below are the slices of A accessed by node 0 in the TP = 2 x 2 case
+// (devices 0, 1 on node 0, devices 2, 3 on node 1); R marks inter-node pulls and
+// F marks NVLink copies forwarded from the local peer's buffer:
+//
+//             iter 0    iter 1    iter 2    iter 3
+//   GPU0        0         1        2 (R)     3 (F, from GPU1)
+//   GPU1        1         0        3 (R)     2 (F, from GPU0)
+//
+//  Tensor C/D's M tile index follows the same mapping as the peer device.
+//
+template <class NodeSize_, class NumNodes_>
+struct AllGather2D_TilingCD_RotatingA: HierarchicalAllGatherSchedule<
+    NodeSize_,
+    NumNodes_,
+    /* ProcessorTiler_ = */ cute::Shape<_1, HierarchicalTP<NodeSize_, NumNodes_>, _1, _1>,
+    /* IterationTiler_ = */ cute::Shape<HierarchicalTP<NodeSize_, NumNodes_>, _1, _1, _1>,
+    /* IterationMappingM_ = */ HierarchicalRotation<NodeSize_::value, NumNodes_::value>,
+    /* IterationMappingN_ = */ ConstantMapping<NodeSize_, NumNodes_>,
+    /* MemcpyA_ = */ true,
+    /* MemcpyB_ = */ false> {};
+
+// This schedule is similar to AllGather2D_TilingCD_RotatingA, but rotates slices of B instead
+// of slices of A, like AllGather1D_TilingCD_RotatingB.
+template <class NodeSize_, class NumNodes_>
+struct AllGather2D_TilingCD_RotatingB: HierarchicalAllGatherSchedule<
+    NodeSize_,
+    NumNodes_,
+    /* ProcessorTiler_ = */ cute::Shape<HierarchicalTP<NodeSize_, NumNodes_>, _1, _1, _1>,
+    /* IterationTiler_ = */ cute::Shape<_1, HierarchicalTP<NodeSize_, NumNodes_>, _1, _1>,
+    /* IterationMappingM_ = */ ConstantMapping<NodeSize_, NumNodes_>,
+    /* IterationMappingN_ = */ HierarchicalRotation<NodeSize_::value, NumNodes_::value>,
+    /* MemcpyA_ = */ false,
+    /* MemcpyB_ = */ true> {};
+
+} // namespace cutlass::distributed::schedules
+
+///////////////////////////////////////////////////////////////////////////////
@@ -51,6 +51,36 @@
 
 namespace cutlass::distributed::schedules {
 
+// How slices of memcpied operands are moved between devices of the same NVLink domain
+enum class PeerCopyMode {
+  kCopyEngine,         // cudaMemcpyAsync on copy engines, no SMs are used
+  kCommunicationCtas,  // copy kernel on a fixed budget of SMs, taken away from the local GEMMs
+  kDirectAccess        // no copies, the local GEMMs TMA-load slices straight from peer memory
+};
+
+// How partial outputs of K-sharded GEMMs are all-reduced after the local GEMM stages
+enum class AllReduceAlgorithm {
+  kNone,     // schedule does not all-reduce its output
+  kOneShot,  // push partials to all peers and reduce everywhere, a single communication step
+  kTwoShot   // push partials to chunk owners, who reduce and push the results back to all peers
+};
+
+namespace detail {
+
+// Device/iteration mappings are either rank-2 CuTe layouts, or functors that expose a static rank
+// because they cannot be written as a single linear function (see HierarchicalRotation.)
+template <class Mapping>
+constexpr bool is_rank2_mapping() {
+  if constexpr (cute::is_layout<Mapping>::value) {
+    return decltype(cute::rank(Mapping{}))::value == 2;
+  }
+  else {
+    return Mapping::rank == 2;
+  }
+}
+
+} // namespace detail
+
 /*
  * Distributed GEMM schedules define exactly how operand tensors are tiled and sliced across 
  * processors (GPUs) and stages/iterations.
@@ -88,16 +118,16 @@ struct BaseSchedule {
   static_assert(cute::rank(ProcessorTiler_{}) == 4, "Expected rank-4 processor tiler.");
   static_assert(cute::rank(IterationTiler_{}) == 4, "Expected rank-4 iteration tiler.");
 
-  static_assert(cute::rank(PeerDeviceMapping_{}) == 2, 
+  static_assert(detail::is_rank2_mapping<PeerDeviceMapping_>(), 
       "PeerDeviceMapping must be rank-2 (device_idx, iter)");
 
-  static_assert(cute::rank(IterationMappingM_{}) == 2, 
+  static_assert(detail::is_rank2_mapping<IterationMappingM_>(), 
       "IterationMappingM must be rank-2 (device_idx, iter).");
-  static_assert(cute::rank(IterationMappingN_{}) == 2, 
+  static_assert(detail::is_rank2_mapping<IterationMappingN_>(), 
       "IterationMappingN must be rank-2 (device_idx, iter).");
-  static_assert(cute::rank(IterationMappingK_{}) == 2, 
+  static_assert(detail::is_rank2_mapping<IterationMappingK_>(), 
       "IterationMappingK must be rank-2 (device_idx, iter).");
-  static_assert(cute::rank(IterationMappingL_{}) == 2, 
+  static_assert(detail::is_rank2_mapping<IterationMappingL_>(), 
       "IterationMappingL must be rank-2 (device_idx, iter).");
 
   using ProcessorTiler = ProcessorTiler_;
@@ -122,10 +152,10 @@ struct BaseSchedule {
   static constexpr int NumBuffersD = NumBuffersD_;
 
   static_assert(
-      NumBuffersA > 0 ^ 
-      NumBuffersB > 0 ^ 
-      NumBuffersC > 0 ^ 
-      NumBuffersD > 0,
+      int(NumBuffersA > 0) +
+      int(NumBuffersB > 0) +
+      int(NumBuffersC > 0) +
+      int(NumBuffersD > 0) <= 1,
       "Only one of the ABCD tensors can be buffered!");
 
   static constexpr bool BufferedOutput = NumBuffersC > 0 || NumBuffersD > 0;
@@ -134,6 +164,23 @@ struct BaseSchedule {
 
   static_assert(not RemoteD, "Remote D is not supported yet.");
 
+  // Number of consecutive devices that share an NVLink domain. 1-D schedules assume all TP
+  // devices do; hierarchical schedules override this.
+  static constexpr int NodeSize = TP{};
+  static constexpr int NumNodes = TP{} / NodeSize;
+
+  // Peer copy mode and SM budget for memcpied operands, see WithPeerCopyMode
+  static constexpr PeerCopyMode CopyMode = PeerCopyMode::kCopyEngine;
+  static constexpr int CopySmCount = 0;
+
+  // All-reduce of the local output after the last stage, see AllReduce1D_TilingB_OneShot
+  static constexpr AllReduceAlgorithm AllReduce = AllReduceAlgorithm::kNone;
+  static constexpr bool HasAllReduce = false;
+  static constexpr int NumReduceSlots = 0;
+
+  // Number of chunks memcpied slices arrive in, each with its own flag, see WithTileArrival
+  static constexpr int NumArrivalChunks = 1;
+
   // Host-side API: can_implement based on the GLOBAL problem shape
   template <typename ProblemShape>
   static bool
@@ -183,6 +230,14 @@ struct BaseSchedule {
     return peer_idx;
   }
 
+  // Determines which device and iteration hold the slice memcpied in a given iteration.
+  // Iteration 0 refers to the source device's own operand, later iterations to its buffers.
+  // 1-D schedules always copy from the peer's own operand.
+  static auto
+  get_copy_source(int device_idx, int iteration) {
+    return cute::make_tuple(get_remote_peer_id(device_idx, iteration), 0);
+  }
+
   // Construct tilers and index mappers for sharding across processors
   template <typename Tensor>
   CUTLASS_HOST_DEVICE
@@ -532,6 +587,49 @@ struct BaseSchedule {
 
 
 
+/*
+ * WithPeerCopyMode selects how a schedule moves memcpied operand slices between peers, so that
+ * the cheapest option for a given topology can be picked:
+ *   * kCopyEngine leaves all SMs to the GEMMs, but copy engines may not saturate NVLink,
+ *   * kCommunicationCtas copies with CopySmCount_ CTAs, and launches the GEMMs on that many
+ *     fewer SMs,
+ *   * kDirectAccess skips the copies and the buffers altogether, and the GEMMs read peer slices
+ *     over NVLink, which works best when the GEMMs are not bandwidth-bound.
+ * Slices pulled from other nodes always go through the adapter's transport.
+ */
+template <class Schedule_, PeerCopyMode CopyMode_, int CopySmCount_ = 0>
+struct WithPeerCopyMode: Schedule_ {
+
+  static_assert(Schedule_::HasMemcpy, "Only schedules that memcpy operands have a peer copy mode.");
+  static_assert((CopyMode_ == PeerCopyMode::kCommunicationCtas) == (CopySmCount_ > 0),
+      "Communication CTAs need an SM budget, and other modes don't use one.");
+  static_assert(CopyMode_ != PeerCopyMode::kDirectAccess || Schedule_::NumNodes == 1,
+      "Direct access requires all devices to be in the same NVLink domain.");
+
+  static constexpr PeerCopyMode CopyMode = CopyMode_;
+  static constexpr int CopySmCount = CopySmCount_;
+};
+
+/*
+ * WithTileArrival splits every memcpied slice into NumArrivalChunks_ chunks along its rotated mode
+ * (M for A, N for B), and flags the arrival of each chunk. Instead of waiting on the whole slice
+ * before starting a stage, the local GEMM's load warp waits on the chunk covering each of its CTA
+ * tiles, so tiles of a stage start as soon as their rows arrive and communication is interleaved
+ * with compute within stages.
+ * Requires an SM100 GEMM, a K-major rotated operand, and a rotated mode divisible by the number
+ * of chunks.
+ */
+template <class Schedule_, int NumArrivalChunks_>
+struct WithTileArrival: Schedule_ {
+
+  static_assert(Schedule_::HasMemcpy, "Only schedules that memcpy operands have arrivals to flag.");
+  static_assert(NumArrivalChunks_ > 1, "Tile arrival requires more than one chunk per slice.");
+  static_assert(Schedule_::CopyMode != PeerCopyMode::kDirectAccess,
+      "Slices accessed directly from peers don't arrive.");
+
+  static constexpr int NumArrivalChunks = NumArrivalChunks_;
+};
+
 } // namespace cutlass::gemm::distributed
 
 ///////////////////////////////////////////////////////////////////////////////
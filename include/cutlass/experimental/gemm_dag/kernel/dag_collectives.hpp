@@ -0,0 +1,248 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Collective adaptors executing the groups of an SM90 grouped GEMM as a dependency DAG.
+
+    DagMainloop wraps an SM90 ptr-array TMA mainloop: before the loads of each tile, the load warp
+    waits on the counter of the producer's row of tiles its A operand covers. DagEpilogue wraps an
+    SM90 ptr-array TMA epilogue: after the stores of each tile of a consumed group, the storing warp
+    waits for its TMA stores and increments the counter of the tile's row. Waiting on the stores of
+    every tile gives up the overlap of a tile's stores with the next tile's epilogue in consumed
+    groups; groups nobody consumes are stored as usual.
+
+    See gemm_dag.hpp for the DAG and its requirements.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cute/arch/copy_sm90_tma.hpp"
+
+#include "cutlass/experimental/gemm_dag/kernel/gemm_dag.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm_dag::kernel {
+
+template <class CollectiveMainloop_>
+struct DagMainloop: CollectiveMainloop_ {
+
+  using Base = CollectiveMainloop_;
+
+  static_assert(Base::ArchTag::kMinComputeCapability == 90,
+      "GEMM DAGs are only supported with SM90 ptr-array mainloops.");
+
+  struct Arguments: Base::Arguments {
+    // Per-group dependencies, or null if the groups are independent
+    GemmDagNode const* ptr_dag_nodes = nullptr;
+    uint32_t const* ptr_counters = nullptr;
+    // Launch number, counted from 1, since the counters were zeroed
+    uint32_t epoch = 1;
+  };
+
+  struct Params: Base::Params {
+    GemmDagNode const* ptr_dag_nodes = nullptr;
+    uint32_t const* ptr_counters = nullptr;
+    uint32_t epoch = 1;
+  };
+
+  template <class ProblemShape, class... Args>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, Args const&... other_args) {
+    return {Base::to_underlying_arguments(problem_shape, args, other_args...),
+            args.ptr_dag_nodes, args.ptr_counters, args.epoch};
+  }
+
+  // Called by the load warp before the first tile of every group it processes
+  template <class InputTensors, class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  tensors_perform_update(
+      InputTensors const& input_tensors,
+      Params const& mainloop_params,
+      ProblemShape_MNKL problem_shape_mnkl,
+      int32_t next_batch) {
+    if (mainloop_params.ptr_dag_nodes != nullptr) {
+      node_ = mainloop_params.ptr_dag_nodes[next_batch];
+    }
+    return Base::tensors_perform_update(input_tensors, mainloop_params, problem_shape_mnkl, next_batch);
+  }
+
+  template <
+    class TensorA, class TensorB,
+    class TensorMapA, class TensorMapB,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      typename Base::MainloopPipeline pipeline,
+      typename Base::PipelineState smem_pipe_write,
+      cute::tuple<TensorA, TensorB> const& load_inputs,
+      cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
+      BlockCoord const& blk_coord,
+      KTileIterator k_tile_iter, int k_tile_count,
+      int thread_idx,
+      uint32_t block_rank_in_cluster,
+      typename Base::TensorStorage& shared_tensors) {
+
+    if (node_.producer_counters >= 0 && k_tile_count > 0) {
+      int m_coord = static_cast<int>(get<0>(blk_coord));
+      detail::wait_counter(mainloop_params.ptr_counters + node_.producer_counters + m_coord,
+                           mainloop_params.epoch * static_cast<uint32_t>(node_.producer_tiles_n));
+    }
+
+    Base::load(
+      mainloop_params,
+      pipeline,
+      smem_pipe_write,
+      load_inputs,
+      input_tensormaps,
+      blk_coord,
+      k_tile_iter, k_tile_count,
+      thread_idx,
+      block_rank_in_cluster,
+      shared_tensors);
+  }
+
+private:
+  GemmDagNode node_{};
+};
+
+template <class CollectiveEpilogue_>
+struct DagEpilogue: CollectiveEpilogue_ {
+
+  using Base = CollectiveEpilogue_;
+
+  struct Arguments: Base::Arguments {
+    // Must match the mainloop's
+    GemmDagNode const* ptr_dag_nodes = nullptr;
+    uint32_t* ptr_counters = nullptr;
+  };
+
+  struct Params: Base::Params {
+    GemmDagNode const* ptr_dag_nodes = nullptr;
+    uint32_t* ptr_counters = nullptr;
+  };
+
+  template <class ProblemShape, class... Args>
+  static Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, Args const&... other_args) {
+    return {Base::to_underlying_arguments(problem_shape, args, other_args...),
+            args.ptr_dag_nodes, args.ptr_counters};
+  }
+
+  CUTLASS_DEVICE
+  DagEpilogue(Params const& params_, typename Base::TensorStorage& shared_tensors)
+    : Base(params_, shared_tensors)
+    , ptr_dag_nodes_(params_.ptr_dag_nodes)
+    , ptr_counters_(params_.ptr_counters) { }
+
+  template<
+    class ProblemShapeMNKL,
+    class TileShapeMNK,
+    class TileCoordMNKL,
+    class AccEngine, class AccLayout,
+    class TiledMma,
+    class StoreTensorMaps
+  >
+  CUTLASS_DEVICE auto
+  store(
+      typename Base::LoadPipeline load_pipeline,
+      typename Base::LoadPipelineState load_pipe_consumer_state,
+      typename Base::StorePipeline store_pipeline,
+      typename Base::StorePipelineState store_pipe_producer_state,
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShapeMNK tile_shape_MNK,
+      TileCoordMNKL tile_coord_mnkl,
+      cute::Tensor<AccEngine,AccLayout> accumulators,
+      TiledMma tiled_mma,
+      int thread_idx,
+      typename Base::TensorStorage& shared_tensors,
+      StoreTensorMaps const& store_tensormaps,
+      int subtile_idx=-1) {
+
+    auto result = Base::store(
+      load_pipeline,
+      load_pipe_consumer_state,
+      store_pipeline,
+      store_pipe_producer_state,
+      problem_shape_mnkl,
+      tile_shape_MNK,
+      tile_coord_mnkl,
+      accumulators,
+      tiled_mma,
+      thread_idx,
+      shared_tensors,
+      store_tensormaps,
+      subtile_idx);
+
+    // The tile's stores are issued by one elected thread of the first warp
+    if (ptr_dag_nodes_ != nullptr && thread_idx / NumThreadsPerWarp == 0) {
+      int32_t counters = ptr_dag_nodes_[static_cast<int>(get<3>(tile_coord_mnkl))].counters;
+      if (counters >= 0) {
+        cute::tma_store_wait<0>();
+        __syncwarp();
+        if (thread_idx == 0) {
+          detail::arrive_counter(ptr_counters_ + counters + static_cast<int>(get<0>(tile_coord_mnkl)));
+        }
+      }
+    }
+
+    return result;
+  }
+
+private:
+  GemmDagNode const* ptr_dag_nodes_ = nullptr;
+  uint32_t* ptr_counters_ = nullptr;
+};
+
+/// Grouped GEMM kernel executing its groups as a DAG
+template <typename GemmKernel_>
+struct GemmDagKernel;
+
+template <
+  class ProblemShape_,
+  class CollectiveMainloop_,
+  class CollectiveEpilogue_,
+  class TileSchedulerTag_>
+struct GemmDagKernel<
+    cutlass::gemm::kernel::GemmUniversal<ProblemShape_, CollectiveMainloop_, CollectiveEpilogue_, TileSchedulerTag_>> {
+  using type = cutlass::gemm::kernel::GemmUniversal<
+    ProblemShape_,
+    DagMainloop<CollectiveMainloop_>,
+    DagEpilogue<CollectiveEpilogue_>,
+    TileSchedulerTag_>;
+};
+
+} // namespace cutlass::gemm_dag::kernel
+
+///////////////////////////////////////////////////////////////////////////////
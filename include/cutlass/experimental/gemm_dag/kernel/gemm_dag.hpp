@@ -0,0 +1,164 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Dependency DAG of the groups of a grouped GEMM, executed by a single persistent kernel.
+
+    A chain of dependent GEMMs (e.g. the projections and MLP of a transformer layer at small batch)
+    runs as the groups of one SM90 ptr-array grouped GEMM. A group may consume the output D of an
+    earlier group as its A operand. Each CTA row of tiles of a group's output has a counter that
+    the epilogue increments once per tile after the tile's TMA stores are complete; the load warp
+    of a consumer tile waits until its row of tiles of the producer is complete before loading A.
+    Consumer tiles thus start as soon as the rows they read are written, instead of after the whole
+    producer GEMM, and the chain costs a single launch.
+
+    The persistent group tile scheduler hands out tiles in increasing group order and every CTA
+    processes its tiles in order, so a tile only ever waits on tiles that are already assigned to
+    running CTAs: producers must precede their consumers in group order.
+
+    Counters are never reset. They accumulate across launches, and launch e (counted from 1)
+    waits for e * (tiles per row of the producer) arrivals, so the counters need to be zeroed once
+    after allocation and the epoch incremented by every launch.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/trace.h"
+#include "cute/layout.hpp"
+
+#if !defined(__CUDACC_RTC__)
+#include <vector>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm_dag {
+
+/// Dependencies of one group, resident in device memory
+struct GemmDagNode {
+  // First counter of the producer of this group's A operand, or -1 if A is an input
+  int32_t producer_counters = -1;
+  // Tiles per row of the producer's output, i.e. arrivals that complete one of its rows
+  int32_t producer_tiles_n = 0;
+  // First counter of this group's output, one per row of tiles, or -1 if no group consumes it
+  int32_t counters = -1;
+};
+
+#if !defined(__CUDACC_RTC__)
+
+/// Builds the nodes of a DAG of GEMMs for a CTA tile shape.
+///
+/// `problems` are the (M,N,K) extents of the groups and `producers[i]` the group whose D is the A
+/// operand of group i, or -1. A producer must precede its consumer, have the same M and have the
+/// consumer's K as its N; both matrices must be row-major (K-major A). Returns the number of
+/// counters to allocate, or -1 if the DAG is malformed.
+template <class TileShape, class ProblemShapeMNK>
+int
+make_gemm_dag(
+    std::vector<ProblemShapeMNK> const& problems,
+    std::vector<int> const& producers,
+    std::vector<GemmDagNode>& nodes) {
+
+  int const groups = static_cast<int>(problems.size());
+  int const tile_m = cute::size<0>(TileShape{});
+  int const tile_n = cute::size<1>(TileShape{});
+
+  if (static_cast<int>(producers.size()) != groups) {
+    return -1;
+  }
+
+  nodes.assign(groups, GemmDagNode{});
+  int counter_count = 0;
+
+  for (int i = 0; i < groups; ++i) {
+    int p = producers[i];
+    if (p < 0) {
+      continue;
+    }
+    if (p >= i) {
+      CUTLASS_TRACE_HOST("make_gemm_dag(): group " << i << " precedes its producer " << p);
+      return -1;
+    }
+    auto [M, N, K] = problems[i];
+    auto [M_p, N_p, K_p] = problems[p];
+    if (M != M_p || K != N_p) {
+      CUTLASS_TRACE_HOST("make_gemm_dag(): group " << i << " does not consume the output of group " << p);
+      return -1;
+    }
+    // Producers get counters on their first consumer
+    if (nodes[p].counters < 0) {
+      nodes[p].counters = counter_count;
+      counter_count += (int(M_p) + tile_m - 1) / tile_m;
+    }
+    nodes[i].producer_counters = nodes[p].counters;
+    nodes[i].producer_tiles_n = (int(N_p) + tile_n - 1) / tile_n;
+  }
+
+  return counter_count;
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+namespace kernel::detail {
+
+// Waits for a counter written by TMA stores of other CTAs, and orders the TMA loads that follow
+CUTLASS_DEVICE
+void wait_counter(uint32_t const* ptr, uint32_t expected) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+  uint32_t curr_val = 0;
+  asm volatile ("ld.acquire.gpu.global.u32 %0, [%1];\n" : "=r"(curr_val) : "l"(ptr) : "memory");
+  while (curr_val < expected) {
+    __nanosleep(40);
+    asm volatile ("ld.acquire.gpu.global.u32 %0, [%1];\n" : "=r"(curr_val) : "l"(ptr) : "memory");
+  }
+  asm volatile ("fence.proxy.async.global;\n" : : : "memory");
+#else
+  CUTLASS_UNUSED(ptr);
+  CUTLASS_UNUSED(expected);
+#endif
+}
+
+// Publishes the TMA stores this thread waited on, and those its warp synchronized with
+CUTLASS_DEVICE
+void arrive_counter(uint32_t* ptr) {
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 900)
+  asm volatile ("fence.proxy.async.global;\n" : : : "memory");
+  asm volatile ("red.release.gpu.global.add.u32 [%0], %1;\n" : : "l"(ptr), "r"(1u) : "memory");
+#else
+  CUTLASS_UNUSED(ptr);
+#endif
+}
+
+} // namespace kernel::detail
+
+} // namespace cutlass::gemm_dag
+
+///////////////////////////////////////////////////////////////////////////////
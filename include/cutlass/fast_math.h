@@ -45,6 +45,7 @@
 #include "cutlass/uint128.h"
 #include "cutlass/coord.h"
 #include "cutlass/half.h"
+#include "cutlass/bfloat16.h"
 
 /**
  * \file
@@ -900,6 +901,11 @@ half_t fast_exp(half_t x) {
   #endif
 }
 
+CUTLASS_HOST_DEVICE
+bfloat16_t fast_exp(bfloat16_t x) {
+  return bfloat16_t(fast_exp(float(x)));
+}
+
 CUTLASS_HOST_DEVICE
 float fast_log(float x) {
   #if defined(__CUDA_ARCH__)
@@ -954,6 +960,11 @@ half_t fast_tanh(half_t x) {
   #endif
 }
 
+CUTLASS_HOST_DEVICE
+bfloat16_t fast_tanh(bfloat16_t x) {
+  return bfloat16_t(fast_tanh(float(x)));
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <typename T>
@@ -992,6 +1003,34 @@ struct fast_exp_op<Array<half_t, N>> {
 };
 #endif // #if defined(__CUDA_ARCH__)
 
+#if defined(__CUDA_ARCH__) && (__CUDACC_VER_MAJOR__ >= 11) && (__CUDA_ARCH__ >= 800)
+template <int N>
+struct fast_exp_op<Array<bfloat16_t, N>> {
+  CUTLASS_DEVICE
+  Array<bfloat16_t, N> operator()(Array<bfloat16_t, N> const &rhs) const {
+
+    Array<bfloat16_t, N> result;
+
+    // use x2 specialization
+    __nv_bfloat162 const *in  = reinterpret_cast<__nv_bfloat162 const *>(&rhs);
+    __nv_bfloat162 *out = reinterpret_cast<__nv_bfloat162 *>(&result);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N / 2; ++i) {
+      out[i] = ::h2exp(in[i]);
+    }
+
+    // residual
+    if (N % 2) {
+      bfloat16_t last = rhs[N - 1];
+      result[N - 1] = bfloat16_t(::hexp(last.to_nv_bfloat16()));
+    }
+
+    return result;
+  }
+};
+#endif // #if defined(__CUDA_ARCH__)
+
 template <typename T, int N>
 struct fast_exp_op<Array<T, N>> {
   CUTLASS_HOST_DEVICE
@@ -1048,6 +1087,37 @@ struct fast_tanh_op<Array<half_t, N>> {
 };
 #endif // #if defined(__CUDA_ARCH__)
 
+// tanh.approx.bf16x2 rounds directly to bf16, its error is on the order of the bf16 ulp (2^-8
+// relative) instead of the 2^-11 max relative error of tanh.approx.f32
+#if defined(__CUDA_ARCH__) && (__CUDACC_VER_MAJOR__ >= 12) && (__CUDA_ARCH__ >= 900)
+template <int N>
+struct fast_tanh_op<Array<bfloat16_t, N>> {
+  CUTLASS_DEVICE
+  Array<bfloat16_t, N> operator()(Array<bfloat16_t, N> const &rhs) const {
+
+    Array<bfloat16_t, N> result;
+
+    // use x2 specialization
+    uint32_t const *in  = reinterpret_cast<uint32_t const *>(&rhs);
+    uint32_t *out = reinterpret_cast<uint32_t *>(&result);
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N / 2; ++i) {
+      asm volatile ("tanh.approx.bf16x2 %0, %1;" : "=r"(out[i]) : "r"(in[i]));
+    }
+
+    // residual
+    if (N % 2) {
+      uint16_t const *in = reinterpret_cast<uint16_t const *>(&rhs);
+      uint16_t *out = reinterpret_cast<uint16_t *>(&result);
+      asm volatile ("tanh.approx.bf16 %0, %1;" : "=h"(out[N - 1]) : "h"(in[N - 1]));
+    }
+
+    return result;
+  }
+};
+#endif // #if defined(__CUDA_ARCH__)
+
 template <typename T, int N>
 struct fast_tanh_op<Array<T, N>> {
   CUTLASS_HOST_DEVICE
@@ -0,0 +1,267 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/gemm/collective/builders/sm100_common.inl"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Returns the number of smem stages of the activation quantization mainloop, or overrides with manual count.
+template<
+  int CapacityBytes,
+  class ElementA,
+  class ElementAMma,
+  class ElementB,
+  class CtaTileShape_MNK,
+  class SmemLayoutAtomSFA,
+  class SmemLayoutAtomSFB,
+  int stages
+>
+constexpr cute::tuple<int, int>
+sm100_compute_stage_count_or_override_blockscaled_input_quant(StageCount<stages> stage_count) {
+  return cute::make_tuple(stages, stages);
+}
+
+template<
+  int CapacityBytes,
+  class ElementA,
+  class ElementAMma,
+  class ElementB,
+  class CtaTileShape_MNK,
+  class SmemLayoutAtomSFA,
+  class SmemLayoutAtomSFB,
+  int carveout_bytes
+>
+constexpr cute::tuple<int, int>
+sm100_compute_stage_count_or_override_blockscaled_input_quant(StageCountAutoCarveout<carveout_bytes> stage_count) {
+  constexpr int CtaM = get<0>(CtaTileShape_MNK{});
+  constexpr int CtaN = get<1>(CtaTileShape_MNK{});
+  constexpr int CtaK = get<2>(CtaTileShape_MNK{});
+
+  // Load2Transform and Load2Mma stages: A, B and SFB loaded by TMA
+  constexpr auto load2transform_pipeline_bytes = sizeof(typename cutlass::PipelineTmaTransformAsync<1>::SharedStorage);
+  constexpr auto load2mma_pipeline_bytes = sizeof(typename cutlass::PipelineTmaUmmaAsync<1>::SharedStorage);
+  constexpr int load_stage_bytes =
+    cutlass::bits_to_bytes(cute::sizeof_bits_v<ElementA> * CtaM * CtaK) +
+    cutlass::bits_to_bytes(cute::sizeof_bits_v<ElementB> * CtaN * CtaK) +
+    static_cast<int>(size(filter_zeros(SmemLayoutAtomSFB{}))) +
+    static_cast<int>(load2transform_pipeline_bytes + load2mma_pipeline_bytes);
+
+  // Transform2Mma stages: quantized A and SFA written by the transform warps
+  constexpr auto transform2mma_pipeline_bytes = sizeof(typename cutlass::PipelineUmmaConsumerAsync<1>::SharedStorage);
+  constexpr int transform_stage_bytes =
+    cutlass::bits_to_bytes(cute::sizeof_bits_v<ElementAMma> * CtaM * CtaK) +
+    static_cast<int>(size(filter_zeros(SmemLayoutAtomSFA{}))) +
+    static_cast<int>(transform2mma_pipeline_bytes);
+
+  // Two quantized stages suffice to hide the transformation latency, the rest is spent on loads
+  constexpr int Transform2MmaStageCount = 2;
+  constexpr int Load2TransformStageCount =
+    (CapacityBytes - carveout_bytes - Transform2MmaStageCount * transform_stage_bytes) / load_stage_bytes;
+
+  static_assert(Load2TransformStageCount >= 2, "Not enough SMEM capacity for selected tile size");
+  return cute::make_tuple(Load2TransformStageCount, Transform2MmaStageCount);
+}
+
+} // namespace detail
+
+// Block scaled MMA kernels builder quantizing a 16b A operand to the block scaled format of B
+template <
+  class ArchTag,
+  class ElementA,
+  class GmemLayoutATag,
+  int AlignmentA,
+  class ElementPairB,
+  class GmemLayoutBTag,
+  int AlignmentB,
+  class ElementAccumulator,
+  class TileShape_MNK,  // (MmaAtomShapeM, MmaAtomShapeN, TileK)
+  class ClusterShape_MNK,
+  class StageCountType,
+  class BuilderScheduleTag
+>
+struct CollectiveBuilder<
+    ArchTag,
+    arch::OpClassBlockScaledTensorOp,
+    ElementA,
+    GmemLayoutATag,
+    AlignmentA,
+    ElementPairB,
+    GmemLayoutBTag,
+    AlignmentB,
+    ElementAccumulator,
+    TileShape_MNK,
+    ClusterShape_MNK,
+    StageCountType,
+    BuilderScheduleTag,
+    cute::enable_if_t<
+      (cute::is_same_v<ArchTag, arch::Sm100>) &&
+      (cute::is_base_of_v<KernelScheduleBlockScaledInputQuantGemmSm100, BuilderScheduleTag>) &&
+      ((cute::sizeof_bits_v<ElementA> * AlignmentA) % (detail::tma_alignment_bytes * 8) == 0)>>
+{
+  using ElementSF = typename detail::blockscaled::blockscaled_type<BuilderScheduleTag, ElementPairB>::sf_type;
+  using ElementB = typename detail::blockscaled::blockscaled_type<BuilderScheduleTag, ElementPairB>::data_type;
+  static constexpr int SFVectorSize = detail::blockscaled::blockscaled_type<BuilderScheduleTag, ElementPairB>::SfVectorSize;
+
+  static constexpr cute::UMMA::Major UmmaMajorA = cutlass::gemm::collective::detail::tag_to_umma_major_A<GmemLayoutATag>();
+  static constexpr cute::UMMA::Major UmmaMajorB = cutlass::gemm::collective::detail::tag_to_umma_major_B<GmemLayoutBTag>();
+
+  static_assert(cute::is_static_v<TileShape_MNK> && cute::is_static_v<ClusterShape_MNK>,
+      "TileShape and ClusterShape have to be static");
+  static_assert(cute::sizeof_bits_v<ElementA> == 16, "ElementA must be a 16b type.");
+  static_assert(cute::is_same_v<ElementB, cutlass::float_e2m1_t>, "ElementB must be nv_float4_t or mx_float4_t.");
+  static_assert(UmmaMajorA == cute::UMMA::Major::K && UmmaMajorB == cute::UMMA::Major::K, "Only K-major inputs are supported.");
+  static_assert(cute::size<2>(ClusterShape_MNK{}) == 1, "Cluster K mode must be 1.");
+
+  static constexpr int M = cute::size<0>(TileShape_MNK{});
+  static constexpr int N = cute::size<1>(TileShape_MNK{});
+  static_assert(M == 128, "Invalid TileShape_M.");
+  static_assert(N == 128 || N == 256, "Invalid TileShape_N.");
+
+  // A is quantized to the data type of B
+  using ElementAMma = ElementB;
+  using ElementBMma = ElementB;
+
+  using TiledMma = decltype(make_tiled_mma(
+      cute::SM100_MMA_MXF4_SS<ElementAMma, ElementBMma, ElementAccumulator, ElementSF,
+                              M, N, SFVectorSize, UmmaMajorA, UmmaMajorB>{}));
+  using AtomThrID = typename TiledMma::AtomThrID;
+  using AtomThrShapeMNK = Shape<decltype(shape<0>(typename TiledMma::ThrLayoutVMNK{})), _1, _1>;
+  using CtaTileShape_MNK = decltype(shape_div(TileShape_MNK{}, AtomThrShapeMNK{}));
+  using Sm1xxBlkScaledConfig = cutlass::detail::Sm1xxBlockScaledConfig<SFVectorSize>;
+
+  // ((MMA_TILE_M,MMA_TILE_K), MMA_M, MMA_K)
+  using MmaShapeA_MK = decltype(partition_shape_A(TiledMma{}, make_shape(cute::size<0>(TileShape_MNK{}),
+                                                                         cute::size<2>(TileShape_MNK{}))));
+  // ((MMA_TILE_N,MMA_TILE_K), MMA_N, MMA_K)
+  using MmaShapeB_NK = decltype(partition_shape_B(TiledMma{}, make_shape(cute::size<1>(TileShape_MNK{}),
+                                                                         cute::size<2>(TileShape_MNK{}))));
+
+  using BlockTileA_M = decltype(cute::size<0,0>(MmaShapeA_MK{}) * cute::size<1>(MmaShapeA_MK{}));
+  using BlockTileA_K = decltype(cute::size<0,1>(MmaShapeA_MK{}) * cute::size<2>(MmaShapeA_MK{}));
+  using BlockTileB_N = decltype(cute::size<0,0>(MmaShapeB_NK{}) * cute::size<1>(MmaShapeB_NK{}));
+  using BlockTileB_K = decltype(cute::size<0,1>(MmaShapeB_NK{}) * cute::size<2>(MmaShapeB_NK{}));
+
+  using GmemTiledCopyA = decltype(detail::sm90_cluster_shape_to_tma_atom(cute::size<1>(ClusterShape_MNK{})));
+  using GmemTiledCopyB = decltype(detail::sm100_cluster_shape_to_tma_atom_B(ClusterShape_MNK{}, AtomThrID{}));
+  using GmemTiledCopySFB = decltype(detail::sm100_cluster_shape_to_tma_atom_SFB(ClusterShape_MNK{}, AtomThrID{}));
+  using GmemTiledCopyPairB = decltype(cute::make_tuple(GmemTiledCopyB{}, GmemTiledCopySFB{}));
+
+  using SmemLayoutAtomA = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<UmmaMajorA, ElementA,
+    BlockTileA_M, BlockTileA_K>());
+  using SmemLayoutAtomACompute = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<UmmaMajorA, ElementAMma,
+    BlockTileA_M, BlockTileA_K>());
+  using SmemLayoutAtomPairA = cutlass::gemm::collective::detail::CollectiveMmaEmulatedLayoutAtomType<
+    SmemLayoutAtomA, SmemLayoutAtomACompute>;
+  using SmemLayoutAtomSFA = decltype(Sm1xxBlkScaledConfig::deduce_smem_layoutSFA(TiledMma{}, TileShape_MNK{}));
+
+  using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<UmmaMajorB, ElementBMma,
+    BlockTileB_N, BlockTileB_K>());
+  using SmemLayoutAtomSFB = decltype(Sm1xxBlkScaledConfig::deduce_smem_layoutSFB(TiledMma{}, TileShape_MNK{}));
+  using SmemLayoutAtomPairB = decltype(cute::make_tuple(SmemLayoutAtomB{}, SmemLayoutAtomSFB{}));
+
+  using StrideA = cutlass::gemm::TagToStrideA_t<GmemLayoutATag>;
+  using StrideB = cutlass::gemm::TagToStrideB_t<GmemLayoutBTag>;
+  using LayoutSFB = decltype(Sm1xxBlkScaledConfig::deduce_layoutSFB());
+  using StridePairB = decltype(cute::make_tuple(StrideB{}, LayoutSFB{}));
+
+  // SmemCarveout, see sm100_mixed_input_umma_builder.inl
+  static constexpr int SchedulerPipelineStageCount = 3;
+  static constexpr int AccumulatorPipelineStageCount = (N == 256) ? 1 : 2;
+
+  // CLCPipeline = PipelineCLCFetchAsync
+  static constexpr auto CLCPipelineStorage = sizeof(typename cutlass::PipelineCLCFetchAsync<SchedulerPipelineStageCount, ClusterShape_MNK>::SharedStorage);
+  // CLC (scheduler) response
+  static constexpr auto CLCResponseStorage = SchedulerPipelineStageCount * detail::CLCResponseSize;
+  // CLC Throttle pipeline storage
+  static constexpr auto CLCThrottlePipelineStorage = sizeof(typename cutlass::PipelineAsync<SchedulerPipelineStageCount>::SharedStorage);
+  // Accumulator pipeline storage
+  static constexpr auto Mma2AccumPipelineStorage = sizeof(typename cutlass::PipelineUmmaAsync<AccumulatorPipelineStageCount>::SharedStorage);
+  // Tmem dealloc
+  static constexpr auto TmemDeallocStorage = sizeof(cutlass::arch::ClusterBarrier);
+  // Tmem ptr storage
+  static constexpr auto TmemBasePtrsStorage = sizeof(uint32_t);
+
+  // Smem usage that's not part of CollectiveEpilogue::SharedStorage & CollectiveMainloop::SharedStorage
+  static constexpr auto KernelSmemCarveout = static_cast<int>( CLCPipelineStorage +
+                                                               CLCResponseStorage +
+                                                               CLCThrottlePipelineStorage +
+                                                               Mma2AccumPipelineStorage +
+                                                               TmemDeallocStorage +
+                                                               TmemBasePtrsStorage);
+
+  static constexpr int ReducedSmemCapacityBytes = detail::sm100_reduced_smem_capacity_bytes<ArchTag, KernelSmemCarveout>();
+
+  static constexpr auto stage_info = cutlass::gemm::collective::detail::sm100_compute_stage_count_or_override_blockscaled_input_quant<
+    ReducedSmemCapacityBytes, ElementA, ElementAMma, ElementB, CtaTileShape_MNK, SmemLayoutAtomSFA, SmemLayoutAtomSFB>(StageCountType{});
+
+  static constexpr int Load2TransformPipelineStageCount = get<0>(stage_info);
+  static constexpr int Transform2MmaPipelineStageCount = get<1>(stage_info);
+
+  using DispatchPolicy = cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedBlockScaledInputQuant<
+    Load2TransformPipelineStageCount,
+    Transform2MmaPipelineStageCount,
+    SchedulerPipelineStageCount,
+    AccumulatorPipelineStageCount,
+    ClusterShape_MNK,
+    ArchTag
+  >;
+
+  using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
+    DispatchPolicy,
+    TileShape_MNK,
+    ElementA,
+    StrideA,
+    cute::tuple<ElementB, ElementSF>,
+    StridePairB,
+    TiledMma,
+    GmemTiledCopyA,
+    SmemLayoutAtomPairA,
+    void,
+    cute::identity,
+    GmemTiledCopyPairB,
+    SmemLayoutAtomPairB,
+    void,
+    cute::identity
+  >;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +70,7 @@ struct CollectiveBuilder<
       (cute::is_same_v<ArchTag, arch::Sm100> 
       ) &&
       (cute::is_same_v<KernelWarpSpecialized1SmSm100, BuilderScheduleTag> ||
+       cute::is_same_v<KernelWarpSpecialized1SmGatherASm100, BuilderScheduleTag> ||
                         (cute::is_same_v<KernelScheduleAuto, BuilderScheduleTag> &&
                         (((sizeof(ElementA) * AlignmentA) % cutlass::gemm::collective::detail::tma_alignment_bytes != 0) ||
                          ((sizeof(ElementB) * AlignmentB) % cutlass::gemm::collective::detail::tma_alignment_bytes != 0))))>
@@ -150,13 +151,24 @@ struct CollectiveBuilder<
   static constexpr int PipelineStages = cutlass::gemm::collective::detail::sm100_compute_stage_count_or_override<
       ReducedSmemCapacityBytes, ElementAMma_SmemAllocType, ElementBMma_SmemAllocType, SmemTileShape, MainloopPipelineStorage>(StageCountType{});
 
-  using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
-      cutlass::gemm::MainloopSm100UmmaCpAsyncWarpSpecialized<
+  static constexpr bool IsGatherA = cute::is_same_v<KernelWarpSpecialized1SmGatherASm100, BuilderScheduleTag>;
+
+  using DispatchPolicy = cute::conditional_t<IsGatherA,
+      cutlass::gemm::MainloopSm100UmmaCpAsyncWarpSpecializedGatherA<
         PipelineStages,
         SchedulerPipelineStageCount,
         AccumulatorPipelineStageCount,
         ClusterShape_MNK,
         ArchTag>,
+      cutlass::gemm::MainloopSm100UmmaCpAsyncWarpSpecialized<
+        PipelineStages,
+        SchedulerPipelineStageCount,
+        AccumulatorPipelineStageCount,
+        ClusterShape_MNK,
+        ArchTag>>;
+
+  using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
+      DispatchPolicy,
       TileShape_MNK,
       ElementA,
       cutlass::gemm::TagToStrideA_t<GmemLayoutATag>,
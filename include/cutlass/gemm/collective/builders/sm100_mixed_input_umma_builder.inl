@@ -276,14 +276,17 @@ struct CollectiveBuilder<
   using VoidStrideScale = Stride<Stride<_0,_1>,Stride<_0, _1>, _1>;
   using VoidLayoutScale = Layout<VoidShapeScale, VoidStrideScale>;
  
+  // Grouped GEMM carries one scale layout per group, matching the pointer-to-stride convention of A
   using NonVoidLayoutScale = cute::conditional_t<
-    cute::is_void_v<LayoutScale>, VoidLayoutScale, LayoutScale>;
+    cute::is_void_v<LayoutScale>,
+    cute::conditional_t<cute::is_pointer_v<StrideA>, VoidLayoutScale*, VoidLayoutScale>,
+    LayoutScale>;
   
   using StridePairA = decltype(cute::make_tuple(StrideA{}, NonVoidLayoutScale{}));
 
   // SmemCarveout
   static constexpr int SchedulerPipelineStageCount = 3;
-  static constexpr bool IsArrayOfPointersGemm = (cute::is_base_of_v<KernelScheduleSm100PtrArrayFastFP32Gemm, KernelScheduleType>);
+  static constexpr bool IsArrayOfPointersGemm = (cute::is_base_of_v<KernelScheduleSm100PtrArrayMixedInputGemm, KernelScheduleType>);
 
   // CLCPipeline = PipelineCLCFetchAsync
   static constexpr auto CLCPipelineStorage = sizeof(typename cutlass::PipelineCLCFetchAsync<SchedulerPipelineStageCount, ClusterShape_MNK>::SharedStorage);
@@ -296,7 +299,7 @@ struct CollectiveBuilder<
   // Tmem ptr storage
   static constexpr auto TmemBasePtrsStorage = sizeof(uint32_t);
   // Tensormap Storage
-  static constexpr size_t TensorMapStorage = IsArrayOfPointersGemm ? sizeof(cute::TmaDescriptor) * 2 /* for A and B */ : 0;
+  static constexpr size_t TensorMapStorage = IsArrayOfPointersGemm ? sizeof(cute::TmaDescriptor) * 4 /* for A, B, scale and zero */ : 0;
 
   // Smem usage that's not part of CollectiveEpilogue::SharedStorage & CollectiveMainloop::SharedStorage
   static constexpr auto KernelSmemCarveout = static_cast<int>( CLCPipelineStorage +
@@ -309,7 +312,7 @@ struct CollectiveBuilder<
   // Reduce SMEM capacity available for buffers considering extra B smem and barrier smem allocations
   static constexpr int ReducedSmemCapacityBytes = detail::sm100_reduced_smem_capacity_bytes<ArchTag, KernelSmemCarveout>();
 
-  static constexpr int ScaleGranularityK = get_ScaleGranularityK<LayoutScale>();
+  static constexpr int ScaleGranularityK = get_ScaleGranularityK<cute::remove_pointer_t<LayoutScale>>();
   static constexpr auto stage_info = cutlass::gemm::collective::detail::sm100_compute_stage_count_or_override_mixed_input<
   ReducedSmemCapacityBytes, TmaElementA, ElementAMma, ElementScale, ElementZero, ElementB, CtaTileShape_MNK, TiledMma, KernelScheduleType, UmmaMajorA, ScaleGranularityK>(StageCountType{});
   
@@ -317,15 +320,23 @@ struct CollectiveBuilder<
   static constexpr int Transform2MmaPipelineStageCount = get<1>(stage_info);
   static constexpr int AccumulatorPipelineStageCount = get<2>(stage_info);
 
-  static_assert(!IsArrayOfPointersGemm, "mixed input does not support grouped gemm on Blackwell");
-
-  using DispatchPolicy = cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedMixedInput<
-    Load2TransformPipelineStageCount,
-    Transform2MmaPipelineStageCount,
-    SchedulerPipelineStageCount,
-    AccumulatorPipelineStageCount,
-    ClusterShape_MNK,
-    ArchTag
+  using DispatchPolicy = cute::conditional_t<IsArrayOfPointersGemm,
+    cutlass::gemm::MainloopSm100ArrayTmaUmmaWarpSpecializedMixedInput<
+      Load2TransformPipelineStageCount,
+      Transform2MmaPipelineStageCount,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape_MNK,
+      ArchTag
+    >,
+    cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedMixedInput<
+      Load2TransformPipelineStageCount,
+      Transform2MmaPipelineStageCount,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape_MNK,
+      ArchTag
+    >
   >;
   using CollectiveOp = cutlass::gemm::collective::CollectiveMma<
     DispatchPolicy,
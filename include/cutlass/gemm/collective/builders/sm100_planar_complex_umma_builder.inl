@@ -114,8 +114,14 @@ struct CollectiveBuilder<
   using SmemLayoutAtomB = decltype(cutlass::gemm::collective::detail::sm100_smem_selector<
       UmmaMajorB, ElementB, BlockTileB_N, BlockTileB_K>());
 
+  // Gauss 3M keeps a third accumulator for (Ar+Ai)*(Br+Bi) and a third smem operand buffer for the sums
+  static constexpr bool IsGauss3M = cute::is_base_of_v<KernelScheduleSm100PlanarComplexGauss3MGemm, BuilderScheduleTag>;
+  static constexpr int Gauss3MAccumulatorColumns = 3 * cute::size<1>(TileShape_MNK{});
+  static_assert(not IsGauss3M || Gauss3MAccumulatorColumns <= 512, "Gauss 3M accumulators exceed TMEM capacity.");
+
   // Calculate SMEM matrix A and B buffers' pipeline stages
-  static constexpr uint32_t AccumulatorPipelineStageCount = 2;
+  // Gauss 3M falls back to a single accumulator stage when its three accumulators cannot be double buffered
+  static constexpr uint32_t AccumulatorPipelineStageCount = (IsGauss3M && 2 * Gauss3MAccumulatorColumns > 512) ? 1 : 2;
   // Ptr-arry gemm requires extra TensorMap storage
   static constexpr bool IsArrayOfPointersGemm = (cute::is_base_of_v<KernelScheduleSm100PtrArrayPlanarComplexGemm, BuilderScheduleTag>);
   // Calculate scheduler pipeline stages. Having one more stage than the accumulator allows more latency hiding.
@@ -135,14 +141,16 @@ struct CollectiveBuilder<
   static constexpr int ReducedSmemCapacityBytes = detail::sm100_reduced_smem_capacity_bytes<ArchTag, KernelSmemCarveout>();
   using SmemTileShape = cute::Shape<BlockTileA_M, BlockTileB_N, BlockTileA_K>;
 
-  // Use complex type to calculate SMEM stage count
-  using ComplexElementA = cutlass::complex<ElementA>;
-  using ComplexElementB = cutlass::complex<ElementB>;
+  // Use complex type to calculate SMEM stage count, Gauss 3M stores the operand sums as a third plane
+  using ComplexElementA = cute::conditional_t<IsGauss3M, cutlass::Array<ElementA, 3>, cutlass::complex<ElementA>>;
+  using ComplexElementB = cute::conditional_t<IsGauss3M, cutlass::Array<ElementB, 3>, cutlass::complex<ElementB>>;
 
   using MainloopPipelineStorage = typename cutlass::PipelineTmaUmmaAsync<1>::SharedStorage;
   static constexpr int PipelineStages = detail::sm100_compute_stage_count_or_override<
       ReducedSmemCapacityBytes, ComplexElementA, ComplexElementB, SmemTileShape, MainloopPipelineStorage>(StageCountType{});
 
+  static_assert(not (IsGauss3M && IsArrayOfPointersGemm), "Gauss 3M planar complex does not support ptr-array GEMM.");
+
   using DispatchPolicy = cute::conditional_t<IsArrayOfPointersGemm,
       cutlass::gemm::MainloopSm100ArrayTmaUmmaWarpSpecializedPlanarComplex<
           PipelineStages,
@@ -151,12 +159,21 @@ struct CollectiveBuilder<
           ClusterShape_MNK,
           ArchTag
       >,
-      cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedPlanarComplex<
-          PipelineStages,
-          SchedulerPipelineStageCount,
-          AccumulatorPipelineStageCount,
-          ClusterShape_MNK,
-          ArchTag
+      cute::conditional_t<IsGauss3M,
+        cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedPlanarComplexGauss3M<
+            PipelineStages,
+            SchedulerPipelineStageCount,
+            AccumulatorPipelineStageCount,
+            ClusterShape_MNK,
+            ArchTag
+        >,
+        cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedPlanarComplex<
+            PipelineStages,
+            SchedulerPipelineStageCount,
+            AccumulatorPipelineStageCount,
+            ClusterShape_MNK,
+            ArchTag
+        >
       >
     >;
 
@@ -190,6 +190,7 @@ struct CollectiveBuilder<
        (not cute::is_same_v<KernelMixedTmaCpAsyncWarpSpecialized1SmSm100, BuilderScheduleTag>) && 
        (not cute::is_same_v<KernelMixedTmaCpAsyncWarpSpecialized2SmSm100, BuilderScheduleTag>) && 
        (not cute::is_same_v<KernelWarpSpecialized1SmSm100, BuilderScheduleTag>) && 
+       (not cute::is_same_v<KernelWarpSpecialized1SmGatherASm100, BuilderScheduleTag>) && 
        (cute::is_base_of_v<KernelScheduleSm100DenseGemm, BuilderScheduleTag> ||
         cute::is_same_v<KernelScheduleAuto, BuilderScheduleTag>)) &&
       // Alignment check
@@ -264,7 +265,12 @@ struct CollectiveBuilder<
                                                               TotalTmem / (cute::size<0>(CtaTileShape_MNK{}) * cute::size<1>(CtaTileShape_MNK{}))
                                                             : (Sm100TmemCapacityColumns / cute::size<1>(CtaTileShape_MNK{})) * 2;                       // 1SM MMA_M = 64 case
   // 4 accumulator stages works well to buffer the accumulators, while also preventing overhead in the epilogue tail on small tile sizes.
-  static constexpr uint32_t AccumulatorPipelineStageCount = cute::min(4u, AccumulatorPipelineStageCount_);                                              // Cap at 4 accumulator stages
+  // The ping-pong schedule hands alternate accumulator stages to its two epilogue warpgroups,
+  // so it needs an even number of stages.
+  static constexpr bool IsPingpong = cute::is_base_of_v<KernelScheduleSm100PingpongGemm, BuilderScheduleTag>;
+  static constexpr uint32_t AccumulatorPipelineStageCount = IsPingpong ? cute::min(4u, AccumulatorPipelineStageCount_) & ~1u
+                                                                       : cute::min(4u, AccumulatorPipelineStageCount_);                   // Cap at 4 accumulator stages
+  static_assert(!IsPingpong || AccumulatorPipelineStageCount >= 2, "Ping-pong schedule requires at least two accumulator stages in TMEM.");
   static_assert(AccumulatorPipelineStageCount > 0, "Accumulator pipeline stage count must be positive.  This error probably means that TileShape_MNK and/or TiledMma::ThrLayoutVMNK are wrong.");
 
   // Calculate scheduler pipeline stages. Having one more stage than the accumulator allows more latency hiding.
@@ -289,6 +295,7 @@ struct CollectiveBuilder<
       IsArrayOfPointersGemm
     >::KernelSmemCarveout;
   // Reduce SMEM capacity available for buffers considering barrier allocations.
+  // For the ping-pong schedule, StageCountAutoCarveout must cover the TensorStorage of both epilogue warpgroups.
   static constexpr int ReducedSmemCapacityBytes = detail::sm100_reduced_smem_capacity_bytes<ArchTag, KernelSmemCarveout>();
   
 
@@ -317,12 +324,21 @@ struct CollectiveBuilder<
             ArchTag
           >
         >,
-      cutlass::gemm::MainloopSm100TmaUmmaWarpSpecialized<
-          PipelineStages,
-          SchedulerPipelineStageCount,
-          AccumulatorPipelineStageCount,
-          ClusterShape_MNK,
-          ArchTag
+      cute::conditional_t<IsPingpong,
+        cutlass::gemm::MainloopSm100TmaUmmaWarpSpecializedPingpong<
+            PipelineStages,
+            SchedulerPipelineStageCount,
+            AccumulatorPipelineStageCount,
+            ClusterShape_MNK,
+            ArchTag
+        >,
+        cutlass::gemm::MainloopSm100TmaUmmaWarpSpecialized<
+            PipelineStages,
+            SchedulerPipelineStageCount,
+            AccumulatorPipelineStageCount,
+            ClusterShape_MNK,
+            ArchTag
+        >
       >
     >;
 
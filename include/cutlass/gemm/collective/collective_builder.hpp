@@ -51,6 +51,7 @@
 #include "cutlass/gemm/collective/builders/sm100_cpasync_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_mixed_tma_cpasync_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm100_blockscaled_mixed_tma_cpasync_umma_builder.inl"
+#include "cutlass/gemm/collective/builders/sm100_blockscaled_input_quant_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm103_blockscaled_umma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm120_mma_builder.inl"
 #include "cutlass/gemm/collective/builders/sm120_blockscaled_mma_builder.inl"
@@ -68,6 +68,31 @@ struct StageCountAutoCarveoutEpi : StageCountAutoCarveout<detail::compute_carveo
 
 using StageCountAuto = StageCountAutoCarveout<0>;
 
+// Sizes the pipeline like StageCountAutoCarveout, but lets the mainloop arguments select how many of
+// the stages are active at runtime (only supported by the SM90 TMA warp-specialized SS mainloop)
+template<int carveout_bytes>
+struct StageCountAutoCarveoutDynamic : StageCountAutoCarveout<carveout_bytes> {
+  StageCountAutoCarveoutDynamic() = default;
+  explicit StageCountAutoCarveoutDynamic(cute::Int<carveout_bytes>) {}
+};
+
+template<class CollectiveEpilogue>
+struct StageCountAutoCarveoutEpiDynamic
+  : StageCountAutoCarveoutDynamic<detail::compute_carveout_from_epi<CollectiveEpilogue>()> {};
+
+namespace detail {
+
+template<class StageCountType>
+constexpr bool is_stage_count_dynamic_v = false;
+
+template<int carveout_bytes>
+constexpr bool is_stage_count_dynamic_v<StageCountAutoCarveoutDynamic<carveout_bytes>> = true;
+
+template<class CollectiveEpilogue>
+constexpr bool is_stage_count_dynamic_v<StageCountAutoCarveoutEpiDynamic<CollectiveEpilogue>> = true;
+
+} // namespace detail
+
 // Used to automatically let the builder pick the kernel schedule.
 // Can be overridden with kernel schedule tags in cutlass/gemm/dispatch_policy.hpp
 struct KernelScheduleAuto final {};
@@ -39,6 +39,7 @@
 #include "cutlass/numeric_types.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
 #include "cutlass/trace.h"
 #include "cutlass/kernel_hardware_info.hpp"
 #include "cutlass/cuda_host_adapter.hpp"
@@ -265,6 +266,9 @@ struct CollectiveMma<
     ArrayElementB const** ptr_B{nullptr};
     RuntimeDataTypeA runtime_data_type_a{};
     RuntimeDataTypeB runtime_data_type_b{};
+    // Contiguous B for all experts. Used instead of ptr_B when ptr_B is null, with each expert's
+    // B located through the token offsets of the MoE problem shape.
+    ArrayElementB const* ptr_B_base{nullptr};
   };
 
   // Device side kernel params
@@ -300,6 +304,7 @@ struct CollectiveMma<
     cute::TmaDescriptor* tensormaps;
     ArrayElementA const* ptr_A;
     ArrayElementB const** ptr_B;
+    ArrayElementB const* ptr_B_base;
   };
 
   CUTLASS_DEVICE
@@ -400,7 +405,8 @@ struct CollectiveMma<
       args.runtime_data_type_b,
       reinterpret_cast<cute::TmaDescriptor*>(workspace),
       args.ptr_A,
-      reinterpret_cast<ArrayElementB const**>(args.ptr_B)
+      reinterpret_cast<ArrayElementB const**>(args.ptr_B),
+      args.ptr_B_base
     };
   }
 
@@ -444,7 +450,24 @@ struct CollectiveMma<
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
     }
-    return implementable;
+
+    bool offsets_implementable = true;
+    if (args.ptr_B == nullptr) {
+      if constexpr (cutlass::gemm::detail::is_moe_problem_shape<ProblemShape>::value) {
+        offsets_implementable = args.ptr_B_base != nullptr && problem_shapes.has_token_offsets();
+      }
+      else {
+        offsets_implementable = false;
+      }
+      // Each expert's B starts at token_offset * K, so K must keep every group start TMA aligned
+      auto K = get<2>(problem_shapes.get_host_problem_shape(0));
+      offsets_implementable = offsets_implementable && (K % min_tma_aligned_elements_B == 0);
+    }
+
+    if (!offsets_implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: ptr_B is null but contiguous B with MoE token offsets was not provided.\n");
+    }
+    return implementable && offsets_implementable;
   }
 
   /// Construct A Single Stage's Accumulator Shape
@@ -785,15 +808,27 @@ struct CollectiveMma<
   }
 
   // Replace address for the global tensor (to be done by single thread)
+  template <class ProblemShape>
   CUTLASS_DEVICE
   void
   tensormaps_replace_global_address(
       TensorMapStorage& shared_tensormaps,
       Params const& mainloop_params,
+      ProblemShape const& problem_shape,
       int32_t next_batch) {
     // Replacing global_address for the next batch
-    cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_B,
-                                                    mainloop_params.ptr_B[next_batch]);
+    if (mainloop_params.ptr_B != nullptr) {
+      cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_B,
+                                                      mainloop_params.ptr_B[next_batch]);
+    }
+    else if constexpr (cutlass::gemm::detail::is_moe_problem_shape<ProblemShape>::value) {
+      // Experts are packed back to back along the token (N) mode of a contiguous B
+      int64_t const K = get<2>(problem_shape.get_problem_shape(next_batch));
+      int64_t const offset_B = problem_shape.get_token_offset(next_batch) * K;
+      auto ptr_B = reinterpret_cast<char const*>(mainloop_params.ptr_B_base) +
+                   (offset_B * sizeof_bits_v<TmaInternalElementB>) / 8;
+      cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_B, ptr_B);
+    }
   }
 
   // Replace dim and strides for the global tensor - used only for Grouped GEMM (to be done by single thread)
@@ -844,7 +879,7 @@ struct CollectiveMma<
   ) {
     if (cute::elect_one_sync()) {
       // Replacing global_address for the next batch
-      tensormaps_replace_global_address(shared_tensormaps, mainloop_params, next_batch);
+      tensormaps_replace_global_address(shared_tensormaps, mainloop_params, problem_shape, next_batch);
 
       auto problem_shape_MNKL = append<4>(problem_shape.get_problem_shape(next_batch), 1);
       // Replacing global dims and strides for the next batch
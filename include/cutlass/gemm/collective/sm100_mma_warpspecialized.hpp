@@ -298,6 +298,10 @@ struct CollectiveMma<
     StrideB dB{};
     RuntimeDataTypeA runtime_data_type_a{};
     RuntimeDataTypeB runtime_data_type_b{};
+    // Fraction of the K tiles of A of the first work tile that is prefetched into L2 before waiting on
+    // the preceding grid. Requires A not to be written by the preceding grid (e.g. weights).
+    // Non-positive values disable the prefetch.
+    float prefetch_ratio = -1.0f;
   };
 
   // Device side kernel params
@@ -330,6 +334,7 @@ struct CollectiveMma<
     dim3 cluster_shape_fallback;
     RuntimeDataTypeA runtime_data_type_a;
     RuntimeDataTypeB runtime_data_type_b;
+    float prefetch_ratio;
   };
 
   CUTLASS_DEVICE
@@ -337,7 +342,8 @@ struct CollectiveMma<
     : cluster_shape_(cluster_shape)
     , block_rank_in_cluster_(block_rank_in_cluster)
     , runtime_data_type_a_(params.runtime_data_type_a)
-    , runtime_data_type_b_(params.runtime_data_type_b) {
+    , runtime_data_type_b_(params.runtime_data_type_b)
+    , prefetch_ratio_(params.prefetch_ratio) {
     if constexpr (IsDynamicCluster) {
       const bool is_fallback_cluster = (cute::size<0>(cluster_shape_) == params.cluster_shape_fallback.x &&
                                         cute::size<1>(cluster_shape_) == params.cluster_shape_fallback.y);
@@ -413,7 +419,8 @@ struct CollectiveMma<
       tma_load_b_fallback,
       hw_info.cluster_shape_fallback,
       args.runtime_data_type_a,
-      args.runtime_data_type_b
+      args.runtime_data_type_b,
+      args.prefetch_ratio
     };
   }
 
@@ -438,6 +445,12 @@ struct CollectiveMma<
 
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+      return false;
+    }
+
+    if (args.prefetch_ratio > 1.0f) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: `prefetch_ratio` must be either non-positive (disabled) or in (0, 1].\n");
+      return false;
     }
     return implementable;
   }
@@ -578,6 +591,37 @@ struct CollectiveMma<
       tCrA, tCrB};
   }
 
+  /// Issue L2 prefetches of the first prefetch_ratio fraction of the K tiles of A of a work tile.
+  /// Meant to be called before griddepcontrol.wait, so it must not be used if A is written by the preceding grid.
+  template <
+    class LoadParams,
+    class TileCoordMNKL,
+    class KTileIterator
+  >
+  CUTLASS_DEVICE void
+  prefetch_A(
+    LoadParams const& load_inputs,
+    TileCoordMNKL const& cta_coord_mnkl,
+    KTileIterator k_tile_iter, int k_tile_count) const {
+
+    int prefetch_k_tile_count = static_cast<int>(static_cast<float>(k_tile_count) * prefetch_ratio_);
+    if (prefetch_k_tile_count <= 0) {
+      return;
+    }
+
+    // slice out the work coord from partitioned tensors
+    Tensor tAgA = load_inputs.tAgA_mkl(_, get<0>(cta_coord_mnkl) / size(typename TiledMma::AtomThrID{}), _, get<3>(cta_coord_mnkl));
+
+    if (cute::elect_one_sync()) {
+      CUTLASS_PRAGMA_NO_UNROLL
+      while (prefetch_k_tile_count > 0) {
+        prefetch(*observed_tma_load_a_, tAgA(_,*k_tile_iter));
+        --prefetch_k_tile_count;
+        ++k_tile_iter;
+      }
+    }
+  }
+
   /// Perform a collective-scoped matrix multiply-accumulate
   /// Producer Perspective
   template <
@@ -717,6 +761,7 @@ protected:
   typename Params::TMA_B const* observed_tma_load_b_{nullptr};
   RuntimeDataTypeA runtime_data_type_a_{};
   RuntimeDataTypeB runtime_data_type_b_{};
+  float prefetch_ratio_{-1.0f};
 
   ClusterShape cluster_shape_;
   uint32_t block_rank_in_cluster_;
@@ -724,6 +769,105 @@ protected:
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// The ping-pong schedule only changes how the kernel drains the accumulator stages,
+// the mainloop itself is the regular warp-specialized one.
+template <
+  int Stages,
+  int SchedulerPipelineStageCount,
+  int AccumulatorPipelineStageCount,
+  class ArchTag_,
+  class ClusterShape,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm100TmaUmmaWarpSpecializedPingpong<
+      Stages,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape,
+      ArchTag_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopSm100TmaUmmaWarpSpecialized<
+      Stages,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape,
+      ArchTag_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  using Base = CollectiveMma<
+    MainloopSm100TmaUmmaWarpSpecialized<
+      Stages,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape,
+      ArchTag_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+
+  using DispatchPolicy = MainloopSm100TmaUmmaWarpSpecializedPingpong<
+                          Stages,
+                          SchedulerPipelineStageCount,
+                          AccumulatorPipelineStageCount,
+                          ClusterShape,
+                          ArchTag_>;
+
+  using Base::Base;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace cutlass::gemm::collective
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
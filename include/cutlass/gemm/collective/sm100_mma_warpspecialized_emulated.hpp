@@ -316,6 +316,9 @@ struct CollectiveMma<
     StrideA dA{};
     ElementB const* ptr_B{nullptr};
     StrideB dB{};
+    // Number of bands computed at runtime, in [3, NumBandsToCompute].
+    // 3/4/5 bands issue 6/8/9 BF16 products per MMA K-block.
+    int num_bands{NumBandsToCompute};
   };
 
   // Device side kernel params
@@ -344,12 +347,14 @@ struct CollectiveMma<
     TMA_A tma_load_a_fallback;
     TMA_B tma_load_b_fallback;
     dim3 cluster_shape_fallback;
+    int num_bands;
   };
 
   CUTLASS_DEVICE
   CollectiveMma(Params const& params, ClusterShape cluster_shape, uint32_t block_rank_in_cluster)
     : cluster_shape_(cluster_shape)
-    , block_rank_in_cluster_(block_rank_in_cluster) {
+    , block_rank_in_cluster_(block_rank_in_cluster)
+    , num_bands_(params.num_bands) {
     if constexpr (IsDynamicCluster) {
       const bool is_fallback_cluster = (cute::size<0>(cluster_shape_) == params.cluster_shape_fallback.x &&
                                         cute::size<1>(cluster_shape_) == params.cluster_shape_fallback.y);
@@ -419,7 +424,8 @@ struct CollectiveMma<
       tma_load_b,
       tma_load_a_fallback,
       tma_load_b_fallback,
-      hw_info.cluster_shape_fallback
+      hw_info.cluster_shape_fallback,
+      args.num_bands
     };
   }
 
@@ -440,8 +446,14 @@ struct CollectiveMma<
 
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+      return false;
     }
-    return implementable;
+
+    if (args.num_bands < 3 || args.num_bands > NumBandsToCompute) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: `num_bands` must be in [3, NumBandsToCompute].\n");
+      return false;
+    }
+    return true;
   }
 
   /// Issue Tma Descriptor Prefetch -- ideally from a single thread for best performance
@@ -837,9 +849,10 @@ struct CollectiveMma<
         auto accumulate = UMMA::ScaleOut::Zero;
         // First set of GEMMs that we need to perform for each band are unrolled to set compile-time constant
         // scaling parameter. Scaled GEMM operations are only needed for the first MMA operation of each band.
+        // The least significant bands 5 and 4 are dropped when fewer bands are requested at runtime.
 
         // Band 5
-        if constexpr (NumBandsToCompute == 5) {
+        if (NumBandsToCompute == 5 && num_bands_ == 5) {
           cute::gemm(tiled_mma.with(accumulate, ZeroScaler{}), tCrA2(_,_,k_block), tCrB2(_,_,k_block), tCtC);         // A[2]*B[2]
           accumulate = UMMA::ScaleOut::One;
           CUTLASS_PRAGMA_UNROLL
@@ -848,7 +861,7 @@ struct CollectiveMma<
           }
         }
         // Band 4
-        if constexpr (NumBandsToCompute >= 4) {
+        if (NumBandsToCompute >= 4 && num_bands_ >= 4) {
           cute::gemm(tiled_mma.with(accumulate, Scaler{}), tCrA1(_,_,k_block), tCrB2(_,_,k_block), tCtC);             // A[1]*B[2]
           accumulate = UMMA::ScaleOut::One;
           cute::gemm(tiled_mma.with(accumulate, ZeroScaler{}), tCrA2(_,_,k_block), tCrB1(_,_,k_block), tCtC);         // A[2]*B[1]
@@ -1017,6 +1030,7 @@ protected:
 
   ClusterShape cluster_shape_;
   uint32_t block_rank_in_cluster_;
+  int num_bands_{NumBandsToCompute};
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
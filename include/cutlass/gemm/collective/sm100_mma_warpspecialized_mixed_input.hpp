@@ -238,7 +238,8 @@ public:
 
   static constexpr int IsSubbyteA = cute::sizeof_bits_v<SwappedElementA> < 8;
   using TmaElementA = cute::conditional_t<IsSubbyteA, uint8_t, SwappedElementA>;
-  using TmaElementScale = uint_bit_t<sizeof_bits_v<NonVoidElementScale> >; // in case we have array. translating to uint to satisfy tma descriptor's specialization
+  // in case we have array. translating to uint to satisfy tma descriptor's specialization. Lookup tables are 256b and are copied as uint64_t.
+  using TmaElementScale = uint_bit_t<cute::min(64, sizeof_bits_v<NonVoidElementScale>)>;
 
   using ArchTag = typename DispatchPolicy::ArchTag;
   static_assert(cute::is_same_v<ElementAMma, cutlass::bfloat16_t> || cute::is_same_v<ElementAMma, cutlass::half_t> || cute::is_same_v<ElementAMma, cutlass::float_e4m3_t>, 
@@ -345,6 +346,9 @@ private:
     if constexpr (cute::is_void_v<ElementScale>) {
       return ConversionMode::DirectConvert;
     } 
+    else if constexpr (cutlass::detail::is_dequantization_lookup_table_v<ElementScale> && cute::is_void_v<ElementZero>) {
+      return ConversionMode::ConvertWithLookupTable;
+    }
     else if constexpr (cute::is_void_v<ElementZero>) {
       return ConversionMode::ConvertAndScale;
     }
@@ -355,10 +359,14 @@ private:
 
 public:
   static constexpr ConversionMode KernelConversionMode = get_conversion_mode();
+  // The lookup tables are loaded like scales
   static constexpr bool ModeHasScales = KernelConversionMode == ConversionMode::ConvertAndScale ||
-                                        KernelConversionMode == ConversionMode::ConvertAndScaleWithZero;
+                                        KernelConversionMode == ConversionMode::ConvertAndScaleWithZero ||
+                                        KernelConversionMode == ConversionMode::ConvertWithLookupTable;
   static constexpr bool UseScaleLookupTable = KernelConversionMode == ConversionMode::ConvertAndScale &&
                                               cutlass::detail::is_Array_v<ElementScale>;
+  using TmaInternalElementScale = cute::conditional_t<KernelConversionMode == ConversionMode::ConvertWithLookupTable,
+                                                      TmaElementScale, NonVoidElementScale>;
   static constexpr size_t SmemAlignmentA = cutlass::detail::alignment_for_swizzle(SmemLayoutA{}); 
 
   static constexpr size_t SmemAlignmentB = cutlass::detail::alignment_for_swizzle(SmemLayoutB{});
@@ -429,6 +437,7 @@ public:
     StrideA dA{};
     ElementB const* ptr_B{nullptr};
     StrideB dB{};
+    // Scales, or the lookup tables of A if ElementScale is cutlass::Array<T, 16> with 16-bit T
     ElementScale const* ptr_S{nullptr};
     LayoutScale layout_S{};
     ElementZero const* ptr_Z{nullptr};
@@ -438,7 +447,7 @@ public:
     using ClusterLayout_VMNK = decltype(tiled_divide(make_layout(conditional_return<IsDynamicCluster>(make_shape(uint32_t(0), uint32_t(0), Int<1>{}), ClusterShape{})),
                               make_tile(typename TiledMma::AtomThrID{})));
 
-    using TMA_Scale = decltype(make_tma_atom_A_sm100(
+    using TMA_Scale = decltype(make_tma_atom_A_sm100<TmaInternalElementScale>(
         GmemTiledCopyScale{},
         make_tensor(static_cast<NonVoidElementScale const*>(nullptr), LayoutScale{}),
         SmemLayoutScale{}(_,_,_,cute::Int<0>{}),
@@ -578,7 +587,7 @@ public:
       ElementScale const* ptr_S = args.ptr_S;
     
       Tensor tensor_scale = make_tensor(detail::get_logical_ptr(ptr_S), args.layout_S);
-      typename Params::TMA_Scale tma_load_scale = make_tma_atom_A_sm100<ElementScale>(
+      typename Params::TMA_Scale tma_load_scale = make_tma_atom_A_sm100<TmaInternalElementScale>(
         GmemTiledCopyScale{},
         tensor_scale,
         SmemLayoutScale{}(_,_,_,cute::Int<0>{}),
@@ -586,7 +595,8 @@ public:
         TiledMma{},
         cluster_layout_vmnk);
 
-      if constexpr(KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr(KernelConversionMode == ConversionMode::ConvertAndScale ||
+                   KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         typename Params::TMAScaleParams scale_params{tma_load_scale, {}};
         return { 
           scale_params,
@@ -655,11 +665,12 @@ public:
       check_mode_args = check_mode_args && (args.ptr_Z == nullptr);
     } 
     else if constexpr (ModeHasScales) {
-      constexpr int min_tma_aligned_elements_scale = tma_alignment_bits_S / cutlass::sizeof_bits<ElementScale>::value;
+      constexpr int min_tma_aligned_elements_scale = cute::max(1, tma_alignment_bits_S / cutlass::sizeof_bits<ElementScale>::value);
       check_aligned_S = cutlass::detail::check_alignment<min_tma_aligned_elements_scale>(args.layout_S);
       check_mode_args = check_mode_args && (args.ptr_S != nullptr);
 
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         check_mode_args = check_mode_args && (args.ptr_Z == nullptr);
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -715,7 +726,8 @@ public:
     }
 
     if constexpr (KernelConversionMode == ConversionMode::DirectConvert);
-    else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+    else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                       KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
       cute::prefetch_tma_descriptor(params.tma_load_scale.get_tma_descriptor());
     }
     else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -941,7 +953,8 @@ public:
                                       get<2>(cta_coord_vmnk), make_layout(size<2>(cta_layout_vmnk)),
                                       group_modes<0,3>(sS), group_modes<0,3>(tCgS_mkl));
 
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         return cute::make_tuple(
           gA_mkl, gB_nkl,                        // for scheduler
           tAgA_mkl, tBgB_nkl, tAsA, tBsB,        // for input tensor values
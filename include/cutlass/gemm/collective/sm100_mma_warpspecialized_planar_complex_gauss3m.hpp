@@ -0,0 +1,425 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/sm100_mma_warpspecialized_planar_complex.hpp"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/functional.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Planar complex mainloop using the Gauss 3M algorithm. Each k-block issues three real MMAs
+//   T1 += Ar * Br,  T2 += Ai * Bi,  T3 += (Ar + Ai) * (Br + Bi)
+// into three TMEM accumulators, which the planar complex epilogue resolves to
+//   real = T1 - T2,  imag = T3 - T1 - T2.
+// The operand sums are formed by the MMA warp in dedicated smem buffers while the tensor core
+// runs the previous k-tile. Conjugated operands flip the sign of their imaginary part in the sums
+// and in T2. The sums are rounded to the input type, which costs up to one ulp of the operand
+// magnitude compared to the 4M mainloop.
+template <
+  int Stages,
+  int SchedulerPipelineStageCount,
+  int AccumulatorPipelineStageCount,
+  class ArchTag_,
+  class ClusterShape,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMmaPair_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm100TmaUmmaWarpSpecializedPlanarComplexGauss3M<
+      Stages,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape,
+      ArchTag_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMmaPair_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopSm100TmaUmmaWarpSpecializedPlanarComplex<
+      Stages,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape,
+      ArchTag_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMmaPair_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  using Base = CollectiveMma<
+    MainloopSm100TmaUmmaWarpSpecializedPlanarComplex<
+      Stages,
+      SchedulerPipelineStageCount,
+      AccumulatorPipelineStageCount,
+      ClusterShape,
+      ArchTag_>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMmaPair_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+
+  using DispatchPolicy = MainloopSm100TmaUmmaWarpSpecializedPlanarComplexGauss3M<
+                          Stages,
+                          SchedulerPipelineStageCount,
+                          AccumulatorPipelineStageCount,
+                          ClusterShape,
+                          ArchTag_>;
+
+  using typename Base::TiledMma;
+  using typename Base::TiledMmaANeg;
+  using typename Base::AtomThrShapeMNK;
+  using typename Base::TileShape;
+  using typename Base::ElementAMma;
+  using typename Base::ElementBMma;
+  using typename Base::TransformA;
+  using typename Base::TransformB;
+  using typename Base::SmemLayoutA;
+  using typename Base::SmemLayoutB;
+  using typename Base::MainloopPipeline;
+  using typename Base::MainloopPipelineState;
+  using typename Base::Arguments;
+  using typename Base::Params;
+
+  static_assert(size(AtomThrShapeMNK{}) == 1,
+      "Gauss 3M planar complex mainloop forms the operand sums in the MMA warp and supports 1SM MMAs only.");
+  // M=64 UMMAs pack accumulator pairs into the two TMEM lane halves, which an odd accumulator count cannot fill
+  static_assert(size<0>(TileShape{}) == 128,
+      "Gauss 3M planar complex mainloop requires a 128-row MMA tile.");
+  static_assert(cute::is_same_v<typename Base::ElementA, ElementAMma> && cute::is_same_v<typename Base::ElementB, ElementBMma>,
+      "Gauss 3M planar complex mainloop requires the MMA to consume the input types directly.");
+
+  // Planar operands share one smem layout, so the operand sums are formed elementwise over the
+  // raw stage buffers independent of the swizzle.
+  static constexpr int StageElementsA = size(take<0,3>(SmemLayoutA{}));
+  static constexpr int StageElementsB = size(take<0,3>(SmemLayoutB{}));
+  static constexpr int SumVectorElementsA = 128 / cute::sizeof_bits_v<ElementAMma>;
+  static constexpr int SumVectorElementsB = 128 / cute::sizeof_bits_v<ElementBMma>;
+  static_assert(cute::cosize_v<SmemLayoutA> == StageElementsA * DispatchPolicy::Stages &&
+                cute::cosize_v<SmemLayoutB> == StageElementsB * DispatchPolicy::Stages,
+      "Gauss 3M operand sums require densely packed smem stages.");
+  static_assert(StageElementsA % SumVectorElementsA == 0 && StageElementsB % SumVectorElementsB == 0,
+      "Smem stage must be a multiple of 128 bits.");
+
+  struct SharedStorage {
+    struct TensorStorage : Base::TensorStorage {
+      cute::ArrayEngine<ElementAMma, cute::cosize_v<SmemLayoutA>> smem_A_sum;
+      cute::ArrayEngine<ElementBMma, cute::cosize_v<SmemLayoutB>> smem_B_sum;
+    } tensors;
+
+    using PipelineStorage = typename MainloopPipeline::SharedStorage;
+    PipelineStorage pipeline;
+  };
+
+  // Expose shared storage for tensors/pipelines separately to allow kernel layer to reorder them.
+  using TensorStorage = typename SharedStorage::TensorStorage;
+  using PipelineStorage = typename SharedStorage::PipelineStorage;
+
+  template<class AccTensor>
+  using TmemStorage = typename Base::template TmemStorage<AccTensor>;
+
+  template<class FragmentA, class FragmentB>
+  struct MmaParams {
+    TiledMma tiled_mma_a_pos;
+    TiledMmaANeg tiled_mma_a_neg;
+    FragmentA tCrA_real;
+    FragmentA tCrA_imag;
+    FragmentA tCrA_sum;
+    FragmentB tCrB_real;
+    FragmentB tCrB_imag;
+    FragmentB tCrB_sum;
+    TensorStorage* shared_tensors;
+
+    CUTLASS_DEVICE
+    MmaParams (
+        TiledMma tiled_mma_a_pos_, TiledMmaANeg tiled_mma_a_neg_,
+        FragmentA tCrA_real_, FragmentA tCrA_imag_, FragmentA tCrA_sum_,
+        FragmentB tCrB_real_, FragmentB tCrB_imag_, FragmentB tCrB_sum_,
+        TensorStorage* shared_tensors_)
+    : tiled_mma_a_pos(tiled_mma_a_pos_), tiled_mma_a_neg(tiled_mma_a_neg_)
+    , tCrA_real(tCrA_real_), tCrA_imag(tCrA_imag_), tCrA_sum(tCrA_sum_)
+    , tCrB_real(tCrB_real_), tCrB_imag(tCrB_imag_), tCrB_sum(tCrB_sum_)
+    , shared_tensors(shared_tensors_) {}
+  };
+
+  using Base::Base;
+
+  /// Construct A Single Stage's Accumulator Shape
+  CUTLASS_DEVICE static
+  auto
+  partition_accumulator_shape() {
+    auto acc_shape = append(
+                      partition_shape_C(TiledMma{}, take<0,2>(TileShape{})),
+                      Int<3>{});  // ((MMA_TILE_M,MMA_TILE_N),MMA_M,MMA_N,3)
+
+    return acc_shape;
+  }
+
+  template<class EpilogueTile, bool IsOverlappingAccum = false>
+  CUTLASS_DEVICE static
+  auto
+  init_tmem_tensors(EpilogueTile epi_tile) {
+    TiledMma tiled_mma;
+    auto acc_shape = partition_accumulator_shape();
+    // ((MMA_TILE_M,MMA_TILE_N),MMA_M,MMA_N,3,ACC_PIPE)
+    Tensor accumulators = cutlass::detail::make_sm100_accumulator<AccumulatorPipelineStageCount, IsOverlappingAccum>(
+        tiled_mma, acc_shape, EpilogueTile{});
+
+    TmemStorage<decltype(accumulators)> tmem_storage;
+    tmem_storage.accumulators = accumulators;
+
+    return tmem_storage;
+  }
+
+  /// Set up the data needed by this collective for mma compute.
+  template <class TmemStorage>
+  CUTLASS_DEVICE auto
+  mma_init(
+      [[maybe_unused]] TmemStorage tmem_storage,
+      TensorStorage& shared_tensors) const {
+    Tensor sA_real = make_tensor(make_smem_ptr(shared_tensors.smem_A_real.begin()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
+    Tensor sA_imag = make_tensor(make_smem_ptr(shared_tensors.smem_A_imag.begin()), SmemLayoutA{});          // (BLK_M,BLK_K,PIPE)
+    Tensor sA_sum  = make_tensor(make_smem_ptr(shared_tensors.smem_A_sum.begin()), SmemLayoutA{});           // (BLK_M,BLK_K,PIPE)
+
+    Tensor sB_real = make_tensor(make_smem_ptr(shared_tensors.smem_B_real.begin()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+    Tensor sB_imag = make_tensor(make_smem_ptr(shared_tensors.smem_B_imag.begin()), SmemLayoutB{});          // (BLK_N,BLK_K,PIPE)
+    Tensor sB_sum  = make_tensor(make_smem_ptr(shared_tensors.smem_B_sum.begin()), SmemLayoutB{});           // (BLK_N,BLK_K,PIPE)
+
+    // Allocate "fragments/descriptors" for A and B matrices
+    Tensor tCrA_real = TiledMma::make_fragment_A(sA_real);                                           // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tCrA_imag = TiledMma::make_fragment_A(sA_imag);                                           // (MMA,MMA_M,MMA_K,PIPE)
+    Tensor tCrA_sum  = TiledMma::make_fragment_A(sA_sum);                                            // (MMA,MMA_M,MMA_K,PIPE)
+
+    Tensor tCrB_real = TiledMma::make_fragment_B(sB_real);                                           // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tCrB_imag = TiledMma::make_fragment_B(sB_imag);                                           // (MMA,MMA_N,MMA_K,PIPE)
+    Tensor tCrB_sum  = TiledMma::make_fragment_B(sB_sum);                                            // (MMA,MMA_N,MMA_K,PIPE)
+
+    CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<3>(sA_real));                                     // PIPE
+    CUTE_STATIC_ASSERT_V(Int<DispatchPolicy::Stages>{} == size<3>(sB_real));                                     // PIPE
+
+    TiledMma tiled_mma_a_pos;
+    TiledMmaANeg tiled_mma_a_neg;
+    MmaParams<decltype(tCrA_real), decltype(tCrB_real)> mma_params {
+      tiled_mma_a_pos, tiled_mma_a_neg,
+      tCrA_real, tCrA_imag, tCrA_sum,
+      tCrB_real, tCrB_imag, tCrB_sum,
+      &shared_tensors
+    };
+
+    return mma_params;
+  }
+
+  /// Writes real + imag (or real - imag for a conjugated operand) of one smem stage to sum.
+  /// Executed by all threads of the MMA warp.
+  template <bool NegateImag, int VectorElements, int StageElements, class Element>
+  CUTLASS_DEVICE static void
+  gauss_operand_sum(Element* sum, Element const* real, Element const* imag) {
+    using SmemVector = cutlass::Array<Element, VectorElements>;
+    using ComputeVector = cutlass::Array<float, VectorElements>;
+    cutlass::NumericArrayConverter<float, Element, VectorElements> convert_to_compute;
+    cutlass::NumericArrayConverter<Element, float, VectorElements> convert_to_smem;
+    using SumOp = cute::conditional_t<NegateImag, cutlass::minus<ComputeVector>, cutlass::plus<ComputeVector>>;
+
+    int lane_idx = threadIdx.x % NumThreadsPerWarp;
+    CUTLASS_PRAGMA_NO_UNROLL
+    for (int i = lane_idx; i < StageElements / VectorElements; i += NumThreadsPerWarp) {
+      ComputeVector r = convert_to_compute(reinterpret_cast<SmemVector const*>(real)[i]);
+      ComputeVector m = convert_to_compute(reinterpret_cast<SmemVector const*>(imag)[i]);
+      reinterpret_cast<SmemVector*>(sum)[i] = convert_to_smem(SumOp{}(r, m));
+    }
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Consumer Perspective
+  template <
+    class AccumulatorPipeline,
+    class FrgEngine, class FrgLayout,
+    class MmaParams,
+    class CtaTileCoord
+  >
+  CUTLASS_DEVICE auto
+  mma(cute::tuple<MainloopPipeline,
+                  AccumulatorPipeline> pipelines,
+      cute::tuple<MainloopPipelineState,
+                  typename AccumulatorPipeline::PipelineState> pipeline_states,
+      cute::tuple<cute::Tensor<FrgEngine, FrgLayout>> const& accumulators_tuple,
+      MmaParams const& mma_inputs,
+      CtaTileCoord cta_tile_coord,
+      int k_tile_count
+    ) {
+    static_assert(is_tmem<FrgEngine>::value, "Accumulator must be tmem resident.");
+    static_assert(rank(FrgLayout{}) == 4 && size<3>(FrgLayout{}) == _3{}, "Accumulator must be MMA-partitioned: (MMA, MMA_M, MMA_N, _3)");
+
+    auto [tiled_mma_a_pos, tiled_mma_a_neg,
+          tCrA_real, tCrA_imag, tCrA_sum,
+          tCrB_real, tCrB_imag, tCrB_sum,
+          shared_tensors] = mma_inputs;
+
+    auto [mainloop_pipeline, accumulator_pipeline] = pipelines;
+    auto [mainloop_pipe_consumer_state, accumulator_pipe_producer_state] = pipeline_states;
+
+    constexpr bool IsConjugateA = cute::is_same_v<TransformA, cute::conjugate>;
+    constexpr bool IsConjugateB = cute::is_same_v<TransformB, cute::conjugate>;
+
+    uint32_t skip_wait = k_tile_count <= 0;
+    auto barrier_token = mainloop_pipeline.consumer_try_wait(mainloop_pipe_consumer_state, skip_wait);
+
+    //
+    // PIPELINED MAIN LOOP
+    //
+    tiled_mma_a_pos.accumulate_ = UMMA::ScaleOut::Zero;
+    tiled_mma_a_neg.accumulate_ = UMMA::ScaleOut::Zero;
+
+    auto accumulators = get<0>(accumulators_tuple);
+    auto accumulators_t1 = accumulators(_,_,_,0);
+    auto accumulators_t2 = accumulators(_,_,_,1);
+    auto accumulators_t3 = accumulators(_,_,_,2);
+
+    // Wait for tmem accumulator buffer to become empty with a flipped phase
+    accumulator_pipeline.producer_acquire(accumulator_pipe_producer_state);
+
+    CUTLASS_PRAGMA_NO_UNROLL
+    while (k_tile_count > 0) {
+      // WAIT on mainloop_pipe_consumer_state until its data are available
+      // (phase bit flips from mainloop_pipe_consumer_state.phase() value)
+      mainloop_pipeline.consumer_wait(mainloop_pipe_consumer_state, barrier_token);
+
+      // Compute on k_tile
+      int read_stage = mainloop_pipe_consumer_state.index();
+      // Save current mainlop pipeline read state
+      auto curr_mainloop_pipe_consumer_state = mainloop_pipe_consumer_state;
+
+      // Advance mainloop_pipe
+      ++mainloop_pipe_consumer_state;
+      --k_tile_count;
+      skip_wait = k_tile_count <= 0;
+      // Peek at next iteration
+      barrier_token = mainloop_pipeline.consumer_try_wait(mainloop_pipe_consumer_state, skip_wait);
+
+      // Form the operand sums of this stage. The sum buffers of a stage are free again once its
+      // previous MMAs completed, which the TMA load of the current k-tile already waited for.
+      gauss_operand_sum<IsConjugateA, SumVectorElementsA, StageElementsA>(
+          shared_tensors->smem_A_sum.begin()  + read_stage * StageElementsA,
+          shared_tensors->smem_A_real.begin() + read_stage * StageElementsA,
+          shared_tensors->smem_A_imag.begin() + read_stage * StageElementsA);
+      gauss_operand_sum<IsConjugateB, SumVectorElementsB, StageElementsB>(
+          shared_tensors->smem_B_sum.begin()  + read_stage * StageElementsB,
+          shared_tensors->smem_B_real.begin() + read_stage * StageElementsB,
+          shared_tensors->smem_B_imag.begin() + read_stage * StageElementsB);
+      // Make the generic proxy writes visible to UMMA before any lane issues
+      cutlass::arch::fence_view_async_shared();
+      __syncwarp();
+
+      // Unroll the K mode manually so we can set scale C to 1
+      CUTLASS_PRAGMA_UNROLL
+      for (int k_block = 0; k_block < size<2>(tCrA_real); ++k_block) {
+        // (V,M) x (V,N) => (V,M,N)
+
+        // T1 += realA * realB
+        cute::gemm(tiled_mma_a_pos, tCrA_real(_,_,k_block,read_stage), tCrB_real(_,_,k_block,read_stage), accumulators_t1);
+
+        // T2 += imagA * imagB, negated when exactly one operand is conjugated
+        if constexpr (IsConjugateA != IsConjugateB) {
+          cute::gemm(tiled_mma_a_neg, tCrA_imag(_,_,k_block,read_stage), tCrB_imag(_,_,k_block,read_stage), accumulators_t2);
+        } else {
+          cute::gemm(tiled_mma_a_pos, tCrA_imag(_,_,k_block,read_stage), tCrB_imag(_,_,k_block,read_stage), accumulators_t2);
+        }
+
+        // T3 += sumA * sumB
+        cute::gemm(tiled_mma_a_pos, tCrA_sum(_,_,k_block,read_stage), tCrB_sum(_,_,k_block,read_stage), accumulators_t3);
+
+        tiled_mma_a_pos.accumulate_ = UMMA::ScaleOut::One;
+        tiled_mma_a_neg.accumulate_ = UMMA::ScaleOut::One;
+      }
+      mainloop_pipeline.consumer_release(curr_mainloop_pipe_consumer_state);
+    }
+
+    return mainloop_pipe_consumer_state;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,86 @@
+/***************************************************************************************************
+ * Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Mainloop builder for sm90 gated activation GEMMs.
+
+  Wraps the sm90 CollectiveBuilder with the (8,2,M/16) tile shape and A stride used by
+  cutlass::epilogue::collective::Sm90CollectiveBuilderGated.
+*/
+
+#pragma once
+
+// This is a temp fix for circular include issue in CuTe
+#include "cute/atom/copy_atom.hpp"
+
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/detail/sm90_gated_layout.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+
+template <
+  class OpClass,
+  class ElementA,
+  class GmemLayoutA,
+  int AlignmentA,
+  class ElementB,
+  class GmemLayoutB,
+  int AlignmentB,
+  class ElementAccumulator,
+  class TileShape_MNK_,
+  class ClusterShape_MNK,
+  class StageCountType,
+  class KernelScheduleType
+>
+struct Sm90CollectiveBuilderGated {
+
+  using TileShape_MNK = decltype(cutlass::sm90_make_gated_shape<0>(TileShape_MNK_{}));
+
+  using InternalStrideA = cute::remove_pointer_t<cutlass::gemm::TagToStrideA_t<GmemLayoutA>>;
+  using GatedInternalStrideA = cutlass::detail::GatedStride<0, InternalStrideA>;
+  using StrideA = cute::conditional_t<platform::is_pointer<GmemLayoutA>::value, GatedInternalStrideA *, GatedInternalStrideA>;
+
+  using StrideB = cutlass::gemm::TagToStrideB_t<GmemLayoutB>;
+  
+  using CollectiveOp = typename CollectiveBuilder<
+    arch::Sm90, OpClass,
+    ElementA, StrideA, AlignmentA,
+    ElementB, StrideB, AlignmentB,
+    ElementAccumulator,
+    TileShape_MNK, ClusterShape_MNK,
+    StageCountType, KernelScheduleType
+  >::CollectiveOp;
+};
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@
 
 #include "cutlass/cutlass.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/indexed_ptr_array.hpp"
 #include "cutlass/numeric_types.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/trace.h"
@@ -193,6 +194,9 @@ struct CollectiveMma<
     StrideA dA;
     ElementB const** ptr_B;
     StrideB dB;
+    // Used in place of ptr_A/ptr_B when those are null: batch addresses are generated on device
+    IndexedPtrArray<ElementA const> indexed_A{};
+    IndexedPtrArray<ElementB const> indexed_B{};
   };
 
   // Device side kernel params
@@ -205,6 +209,8 @@ struct CollectiveMma<
     StrideA dA;
     InternalElementB const** ptr_B;
     StrideB dB;
+    IndexedPtrArray<ElementA const> indexed_A;
+    IndexedPtrArray<ElementB const> indexed_B;
   };
 
   //
@@ -226,8 +232,10 @@ struct CollectiveMma<
     // Batches/Groups are managed by using appropriate pointers to input matrices
     const uint32_t init_L = 1;
     // NOTE: Since TMA desc creation with nullptr not possible until 12.6, we use an initial address even when tensor addresses are on device. This address is never used.
-    InternalElementA const* ptr_A_first_batch = reinterpret_cast<InternalElementA const*>(reinterpret_cast<uint64_t>(args.ptr_A) & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
-    InternalElementB const* ptr_B_first_batch = reinterpret_cast<InternalElementB const*>(reinterpret_cast<uint64_t>(args.ptr_B) & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
+    auto init_ptr_A = args.ptr_A != nullptr ? reinterpret_cast<uint64_t>(args.ptr_A) : reinterpret_cast<uint64_t>(args.indexed_A.base);
+    auto init_ptr_B = args.ptr_B != nullptr ? reinterpret_cast<uint64_t>(args.ptr_B) : reinterpret_cast<uint64_t>(args.indexed_B.base);
+    InternalElementA const* ptr_A_first_batch = reinterpret_cast<InternalElementA const*>(init_ptr_A & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
+    InternalElementB const* ptr_B_first_batch = reinterpret_cast<InternalElementB const*>(init_ptr_B & 0xFFFFFFFFFFFFFFF0);  // Address must be 16B-aligned
 
     InternalStrideA stride_a;
     InternalStrideB stride_b;
@@ -271,7 +279,9 @@ struct CollectiveMma<
       reinterpret_cast<InternalElementA const**>(args.ptr_A),
       args.dA,
       reinterpret_cast<InternalElementB const**>(args.ptr_B),
-      args.dB
+      args.dB,
+      args.indexed_A,
+      args.indexed_B
     };
   }
 
@@ -549,6 +559,10 @@ struct CollectiveMma<
 
       ++smem_pipe_read;
     }
+    else {
+      // Groups with K == 0 accumulate nothing, their epilogue computes D = beta * C
+      clear(accum);
+    }
 
     warpgroup_fence_operand(accum);
     CUTLASS_PRAGMA_UNROLL
@@ -659,9 +673,9 @@ struct CollectiveMma<
       int32_t next_batch) {
     // Replacing global_address for the next batch
     cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_A,
-                                                    mainloop_params.ptr_A[next_batch]);
+                                                    get_batch_ptr(mainloop_params.ptr_A, mainloop_params.indexed_A, next_batch));
     cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_B,
-                                                    mainloop_params.ptr_B[next_batch]);
+                                                    get_batch_ptr(mainloop_params.ptr_B, mainloop_params.indexed_B, next_batch));
   }
 
   // Replace dim and strides for the global tensor - used only for Grouped GEMM (to be done by single thread)
@@ -0,0 +1,322 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/indexed_ptr_array.hpp"
+#include "cutlass/gemm/collective/sm90_mma_array_tma_gmma_ss_warpspecialized.hpp"
+#include "cutlass/trace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Grouped Gemm mainloop whose groups are consecutive row segments of one A matrix, as in
+// multi-LoRA where tokens of every adapter share one activation buffer. Group g multiplies
+// rows [segment_offsets[g], segment_offsets[g] + M_g) of A with its own B.
+// A is described by a single TMA descriptor over the whole (M_total, K) matrix and each group
+// addresses its segment through a row offset on the TMA coordinates, so only B's tensormap is
+// rewritten when the group changes. The last M tile of a segment may read rows of the next
+// segment; those rows are never stored as the epilogue predicates D by the group's M.
+template <
+  int Stages,
+  class ClusterShape,
+  class KernelSchedule,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm90ArrayTmaGmmaWarpSpecializedSegmentedA<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  using Base = CollectiveMma<
+    MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopSm90ArrayTmaGmmaWarpSpecializedSegmentedA<Stages, ClusterShape, KernelSchedule>;
+  using typename Base::TileShape;
+  using typename Base::ElementA;
+  using typename Base::StrideA;
+  using typename Base::InternalStrideA;
+  using typename Base::ElementB;
+  using typename Base::StrideB;
+  using typename Base::InternalStrideB;
+  using typename Base::InternalElementA;
+  using typename Base::InternalElementB;
+  using typename Base::GmemTiledCopyA;
+  using typename Base::SmemLayoutA;
+  using typename Base::TMA_A;
+  using typename Base::TensorMapStorage;
+  using Base::IsGroupedGemmKernel;
+
+  // Host side kernel arguments
+  struct Arguments {
+    // All segments, stacked along M
+    ElementA const* ptr_A;
+    int32_t M_total;
+    int32_t K;
+    InternalStrideA dA;
+    // Device array holding the first row of every group's segment in A
+    int32_t const* segment_offsets;
+    ElementB const** ptr_B;
+    StrideB dB;
+    IndexedPtrArray<ElementB const> indexed_B{};
+  };
+
+  // Device side kernel params
+  struct Params : Base::Params {
+    int32_t const* segment_offsets;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(
+      ProblemShape problem_shapes,
+      Arguments const& args,
+      void* workspace) {
+    typename Base::Arguments base_args{
+      // Never dereferenced: A's tensormap is not updated per group
+      reinterpret_cast<ElementA const**>(const_cast<ElementA*>(args.ptr_A)),
+      StrideA{},
+      args.ptr_B,
+      args.dB,
+      {},
+      args.indexed_B
+    };
+    if constexpr (not IsGroupedGemmKernel) {
+      base_args.dA = args.dA;
+    }
+
+    typename Base::Params base_params = Base::to_underlying_arguments(problem_shapes, base_args, workspace);
+
+    // Describe the whole A matrix once; groups select their rows with a coordinate offset
+    auto ptr_A = reinterpret_cast<InternalElementA const*>(args.ptr_A);
+    Tensor tensor_a = make_tensor(ptr_A, make_layout(make_shape(args.M_total, args.K, int32_t(1)), args.dA));
+    base_params.tma_load_a = make_tma_copy(
+        GmemTiledCopyA{},
+        tensor_a,
+        SmemLayoutA{}(_,_,Int<0>{}),
+        make_shape(shape<0>(TileShape{}), shape<2>(TileShape{})),
+        size<1>(ClusterShape{})); // mcast along N mode for this M load, if any
+
+    return {base_params, args.segment_offsets};
+  }
+
+  template <class ProblemShape>
+  static size_t
+  get_workspace_size(ProblemShape const& problem_shape, Arguments const& args, int sm_count) {
+    constexpr uint32_t NumInputTensors = 2;
+    constexpr size_t SizeOfCuTensorMap = sizeof(cute::TmaDescriptor);
+    // The shared A tensormap keeps its per-SM slot so that load() can remain unchanged
+    return (NumInputTensors * SizeOfCuTensorMap * sm_count);
+  }
+
+  template <class ProblemShape>
+  static cutlass::Status
+  initialize_workspace(ProblemShape const& problem_shape, Arguments const& args, void* workspace, cudaStream_t stream, CudaHostAdapter* cuda_adapter = nullptr) {
+    return cutlass::Status::kSuccess;
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape problem_shapes,
+      Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements_A = tma_alignment_bits / cutlass::sizeof_bits<ElementA>::value;
+    constexpr int min_tma_aligned_elements_B = tma_alignment_bits / cutlass::sizeof_bits<ElementB>::value;
+
+    bool implementable = args.ptr_A != nullptr && args.segment_offsets != nullptr;
+    implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_A>(
+        cute::make_shape(args.M_total, args.K, 1), args.dA);
+    if (problem_shapes.is_host_problem_shape_available()) {
+      for (int i = 0; i < problem_shapes.groups(); i++) {
+        auto problem_shape_MNKL = append<4>(problem_shapes.get_host_problem_shape(i), 1);
+        auto [M,N,K,L] = problem_shape_MNKL;
+        // Every group reduces over the full K extent of the shared A
+        implementable = implementable && K == args.K && M <= args.M_total;
+        implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_B>(cute::make_shape(N,K,L), InternalStrideB{});
+      }
+    }
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Segmented A or problem sizes don't meet the requirements for TMA.\n");
+    }
+    return implementable;
+  }
+
+  // Same contract as the base load_init; A is offset to the first group's segment by
+  // tensors_perform_update before the first load.
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  load_init(ProblemShape_MNKL const& problem_shape_MNKL, Params const& mainloop_params) const {
+    return make_segment_tensors(problem_shape_MNKL, mainloop_params, int32_t(0));
+  }
+
+  template <class TensorMapA, class TensorMapB, class ProblemShape_MNKL>
+  CUTLASS_DEVICE
+  void
+  tensormaps_perform_update(
+      TensorMapStorage& shared_tensormaps,
+      Params const& mainloop_params,
+      cute::tuple<TensorMapA, TensorMapB> const& input_tensormaps,
+      ProblemShape_MNKL problem_shape_mnkl,
+      int32_t next_batch) {
+    if (cute::elect_one_sync()) {
+      // Only B changes between groups
+      cute::tma_descriptor_replace_addr_in_shared_mem(shared_tensormaps.smem_tensormap_B,
+                                                      get_batch_ptr(mainloop_params.ptr_B, mainloop_params.indexed_B, next_batch));
+
+      if constexpr (IsGroupedGemmKernel) {
+        const auto N = get<1>(problem_shape_mnkl);
+        const auto K = get<2>(problem_shape_mnkl);
+        constexpr int MaxTensorRank = 5;
+        cute::array<uint32_t, MaxTensorRank> prob_shape_B  = {1,1,1,1,1};
+        cute::array<uint64_t, MaxTensorRank> prob_stride_B = {0,0,0,0,0};
+
+        InternalElementB const* ptr_B = nullptr;
+        Tensor tensor_b = make_tensor(ptr_B, make_shape(N,K,Int<1>{}), mainloop_params.dB[next_batch]);
+        cute::detail::fill_tma_gmem_shape_stride(mainloop_params.tma_load_b, tensor_b,
+                                                 prob_shape_B, prob_stride_B);
+        // Convert strides to byte strides
+        for (uint64_t& stride : prob_stride_B) {
+          stride = (stride * sizeof_bits_v<InternalElementB>) / 8;
+        }
+        cute::tma_descriptor_replace_dims_strides_in_shared_mem(shared_tensormaps.smem_tensormap_B,
+                                                                prob_shape_B,
+                                                                prob_stride_B);
+      }
+    }
+  }
+
+  template <class InputTensors, class ProblemShape_MNKL>
+  CUTLASS_DEVICE
+  InputTensors
+  tensors_perform_update(
+      [[maybe_unused]] InputTensors const& input_tensors,
+      Params const& mainloop_params,
+      ProblemShape_MNKL problem_shape_mnkl,
+      int32_t next_batch) {
+    return make_segment_tensors(problem_shape_mnkl, mainloop_params, mainloop_params.segment_offsets[next_batch]);
+  }
+
+private:
+
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  make_segment_tensors(ProblemShape_MNKL const& problem_shape_MNKL, Params const& mainloop_params, int32_t row_offset) const {
+    using X = Underscore;
+    // Separate out problem shape for convenience
+    auto [M,N,K,L] = problem_shape_MNKL;
+    const int32_t init_L = 1;
+
+    // The group's rows start at row_offset of the shared A tensor
+    Tensor mA_mkl = domain_offset(make_coord(row_offset, _0{}, _0{}),
+                                  mainloop_params.tma_load_a.get_tma_tensor(make_shape(M,K,init_L)));     // (m,k,l)
+    Tensor mB_nkl = mainloop_params.tma_load_b.get_tma_tensor(make_shape(N,K,init_L));                    // (n,k,l)
+
+    // Make tiled views, defer the slice
+    Tensor gA_mkl = local_tile(mA_mkl, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{});  // (BLK_M,BLK_K,m,k,l)
+    Tensor gB_nkl = local_tile(mB_nkl, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});  // (BLK_N,BLK_K,n,k,l)
+
+    return cute::make_tuple(gA_mkl, gB_nkl);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -201,7 +201,8 @@ public:
 
   static constexpr int IsSubbyteA = cute::sizeof_bits_v<SwappedElementA> < 8;
   using TmaElementA = cute::conditional_t<IsSubbyteA, uint8_t, SwappedElementA>;
-  using TmaElementScale = uint_bit_t<sizeof_bits_v<NonVoidElementScale> >; // in case we have array. translating to uint to satisfy tma descriptor's specialization
+  // in case we have array. translating to uint to satisfy tma descriptor's specialization. Lookup tables are 256b and are copied as uint64_t.
+  using TmaElementScale = uint_bit_t<cute::min(64, sizeof_bits_v<NonVoidElementScale>)>;
 
   using ArchTag = typename DispatchPolicy::ArchTag;
 
@@ -260,6 +261,9 @@ private:
     if constexpr (cute::is_void_v<ElementScale>) {
       return ConversionMode::DirectConvert;
     }
+    else if constexpr (cutlass::detail::is_dequantization_lookup_table_v<ElementScale> && cute::is_void_v<ElementZero>) {
+      return ConversionMode::ConvertWithLookupTable;
+    }
     else if constexpr (cute::is_void_v<ElementZero>) {
       return ConversionMode::ConvertAndScale;
     }
@@ -270,8 +274,10 @@ private:
 
 public:
   static constexpr ConversionMode KernelConversionMode = get_conversion_mode();
+  // The lookup tables are loaded like scales
   static constexpr bool ModeHasScales = KernelConversionMode == ConversionMode::ConvertAndScale ||
-                                        KernelConversionMode == ConversionMode::ConvertAndScaleWithZero;
+                                        KernelConversionMode == ConversionMode::ConvertAndScaleWithZero ||
+                                        KernelConversionMode == ConversionMode::ConvertWithLookupTable;
   static constexpr bool UseScaleLookupTable = KernelConversionMode == ConversionMode::ConvertAndScale &&
                                               cutlass::detail::is_Array_v<ElementScale>;
   static constexpr size_t SmemAlignmentA = cutlass::detail::alignment_for_swizzle(SmemLayoutA{});
@@ -306,6 +312,7 @@ public:
     StrideA dA{};
     ElementB const* ptr_B = nullptr;
     StrideB dB{};
+    // Scales, or the lookup tables of A if ElementScale is cutlass::Array<T, 16> with 16-bit T
     ElementScale const* ptr_S = nullptr;
     NonVoidStrideScale dS{};
     int group_size = 0;
@@ -432,7 +439,8 @@ public:
           ScaleTileShape{},
           _1{}); // mcast along N mode for this M load, if any
 
-      if constexpr(KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr(KernelConversionMode == ConversionMode::ConvertAndScale ||
+                   KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         return { tma_load_a, tma_load_b, tma_load_scale, tma_load_zero, scale_k, args.group_size, tma_transaction_bytes + TmaTransactionBytesExtra, (args.group_size + size<2>(TileShape{}) - 1) / size<2>(TileShape{}), dA, dB };
       }
       else if constexpr(KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -479,13 +487,14 @@ public:
     else if constexpr (ModeHasScales) {
       const int scale_mn = SwapAB ? N : M;
       const int scale_k = ceil_div(K, args.group_size);
-      constexpr int min_tma_aligned_elements_scale = tma_alignment_bits / cutlass::sizeof_bits<ElementScale>::value;
+      constexpr int min_tma_aligned_elements_scale = cute::max(1, tma_alignment_bits / cutlass::sizeof_bits<ElementScale>::value);
       check_aligned_S = cutlass::detail::check_alignment<min_tma_aligned_elements_scale>(cute::make_shape(scale_mn,scale_k,L), args.dS);
       check_mode_args = check_mode_args && (args.group_size == K || ((args.group_size % size<2>(TileShape{})) == 0));
       check_mode_args = check_mode_args && args.group_size != 0;
       check_mode_args = check_mode_args && (args.ptr_S != nullptr);
 
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         check_mode_args = check_mode_args && (args.ptr_Z == nullptr);
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -535,7 +544,8 @@ public:
     if constexpr (KernelConversionMode == ConversionMode::DirectConvert) {
       // Nothing extra to do
     }
-    else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+    else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                       KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
       cute::prefetch_tma_descriptor(mainloop_params.tma_load_scale.get_tma_descriptor());
     }
     else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -577,7 +587,8 @@ public:
       auto scale_k = mainloop_params.scale_k;
       Tensor mS_mkl = mainloop_params.tma_load_scale.get_tma_tensor(make_shape(M,scale_k,L));          // (m,scale_k,l)
       Tensor gS_mkl = local_tile(mS_mkl, ScaleTileShape{}, make_coord(_,_));         // (BLK_M,BLK_Scale_K,m,scale_k,l)
-      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+      if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                    KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
         return cute::make_tuple(gA_mkl, gB_nkl, gS_mkl);
       }
       else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -615,7 +626,8 @@ public:
     if constexpr (KernelConversionMode == ConversionMode::DirectConvert) {
       static_assert(sizeof... (Ts) == 2, "Direct convert needs two inputs");
     }
-    else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+    else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                       KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
       static_assert(sizeof... (Ts) == 3, "Scaled convert needs three inputs");
     }
     else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
@@ -710,7 +722,8 @@ public:
         int const scale_load_k = *k_tile_iter / mainloop_params.reload_factor; // This will always be 0 when group_size == K.
         if (cute::elect_one_sync()) copy(mainloop_params.tma_load_scale.with(*tma_barrier, mcast_mask_s), tSgS(_,_,_,scale_load_k), tSsS(_,_,_,write_stage));
 
-        if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale) {
+        if constexpr (KernelConversionMode == ConversionMode::ConvertAndScale ||
+                      KernelConversionMode == ConversionMode::ConvertWithLookupTable) {
           // Nothing extra to do
         }
         else if constexpr (KernelConversionMode == ConversionMode::ConvertAndScaleWithZero) {
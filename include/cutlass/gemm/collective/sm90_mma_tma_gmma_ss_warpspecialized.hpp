@@ -35,6 +35,7 @@
 #include "cutlass/numeric_types.h"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/trace.h"
+#include "cutlass/layout/permute_layout.hpp"
 
 #include "cute/arch/cluster_sm90.hpp"
 #include "cute/arch/copy_sm90.hpp"
@@ -55,6 +56,7 @@ template <
   int Stages,
   class ClusterShape,
   class KernelSchedule,
+  bool DynamicStages,
   class TileShape_,
   class ElementA_,
   class StrideA_,
@@ -70,7 +72,7 @@ template <
   class SmemCopyAtomB_,
   class TransformB_>
 struct CollectiveMma<
-    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule, DynamicStages>,
     TileShape_,
     ElementA_,
     StrideA_,
@@ -89,7 +91,7 @@ struct CollectiveMma<
   //
   // Type Aliases
   //
-  using DispatchPolicy = MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>;
+  using DispatchPolicy = MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule, DynamicStages>;
   using TileShape = TileShape_;
   using ElementA = ElementA_;
   using StrideA = StrideA_;
@@ -109,7 +111,7 @@ struct CollectiveMma<
 
   using CtaShape_MNK = decltype(shape_div(TileShape{}, ClusterShape{}));
   using MainloopPipeline = cutlass::PipelineTmaAsync<DispatchPolicy::Stages>;
-  using PipelineState = cutlass::PipelineState<DispatchPolicy::Stages>;
+  using PipelineState = cutlass::PipelineState<DispatchPolicy::Stages, DispatchPolicy::DynamicStages>;
 
   using PipelineParams = typename MainloopPipeline::Params;
 
@@ -170,6 +172,9 @@ struct CollectiveMma<
     ElementB const* ptr_B;
     StrideB dB;
     uint32_t mma_promotion_interval = 4;
+    // Number of pipeline stages cycled through, in [2, Stages]. 0 selects all Stages.
+    // Only DispatchPolicy::DynamicStages mainloops accept a value other than 0 or Stages.
+    uint32_t active_stages = 0;
   };
 
   // Device side kernel params
@@ -193,6 +198,7 @@ struct CollectiveMma<
     uint32_t tma_transaction_bytes = TmaTransactionBytes;
     uint32_t tma_transaction_bytes_mk = TmaTransactionBytesMK;
     uint32_t tma_transaction_bytes_nk = TmaTransactionBytesNK;
+    uint32_t active_stages = DispatchPolicy::Stages;
   };
 
   //
@@ -235,7 +241,8 @@ struct CollectiveMma<
       tma_load_b,
       transaction_bytes,
       transaction_bytes_mk,
-      transaction_bytes_nk
+      transaction_bytes_nk,
+      args.active_stages == 0 ? uint32_t(DispatchPolicy::Stages) : args.active_stages
     };
   }
 
@@ -243,7 +250,7 @@ struct CollectiveMma<
   static bool
   can_implement(
       ProblemShape const& problem_shape,
-      [[maybe_unused]] Arguments const& args) {
+      Arguments const& args) {
     constexpr int tma_alignment_bits = 128;
     auto problem_shape_MNKL = append<4>(problem_shape, 1);
     auto [M,N,K,L] = problem_shape_MNKL;
@@ -256,6 +263,30 @@ struct CollectiveMma<
 
     if (!implementable) {
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+      return implementable;
+    }
+
+    // Hierarchical (permuted) strides must still map onto a single TMA descriptor
+    if constexpr (cute::depth(StrideA{}) > 1) {
+      implementable = implementable && cutlass::layout::is_tma_expressible<ElementA>(cute::make_layout(cute::make_shape(M,K,L), args.dA));
+    }
+    if constexpr (cute::depth(StrideB{}) > 1) {
+      implementable = implementable && cutlass::layout::is_tma_expressible<ElementB>(cute::make_layout(cute::make_shape(N,K,L), args.dB));
+    }
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Permuted A/B layout is not TMA expressible, use a cp.async mainloop.\n");
+      return implementable;
+    }
+
+    if (args.active_stages != 0 && args.active_stages != uint32_t(DispatchPolicy::Stages)) {
+      if constexpr (!DispatchPolicy::DynamicStages) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: active_stages requires a mainloop with DynamicStages.\n");
+        return false;
+      }
+      else if (args.active_stages <= uint32_t(K_PIPE_MMAS) || args.active_stages > uint32_t(DispatchPolicy::Stages)) {
+        CUTLASS_TRACE_HOST("  CAN IMPLEMENT: active_stages must be in [" << K_PIPE_MMAS + 1 << ", " << DispatchPolicy::Stages << "].\n");
+        return false;
+      }
     }
     return implementable;
   }
@@ -328,7 +359,8 @@ struct CollectiveMma<
       //
 
       constexpr uint32_t cluster_shape_x = get<0>(typename DispatchPolicy::ClusterShape());
-      uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape_x, block_rank_in_cluster / cluster_shape_x};
+      constexpr uint32_t cluster_shape_y = get<1>(typename DispatchPolicy::ClusterShape());
+      uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape_x, (block_rank_in_cluster / cluster_shape_x) % cluster_shape_y};
 
       Tensor gA_mkl = get<0>(load_inputs);
       Tensor gB_nkl = get<1>(load_inputs);
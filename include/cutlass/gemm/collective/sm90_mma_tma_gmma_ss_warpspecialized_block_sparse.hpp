@@ -0,0 +1,308 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/collective/sm90_mma_tma_gmma_ss_warpspecialized.hpp"
+#include "cutlass/trace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::collective {
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// WarpSpecialized Mainloop for a block sparse row (BSR) A with TileM x TileK nonzero blocks.
+// The nonzero blocks are stored contiguously in CSR order, block b holding the element (i,k) of
+// its block at ptr_A + i * get<0>(dA) + k * get<1>(dA) + b * get<2>(dA), with the block column of
+// block b at block_col_indices[b]. The K tiles handed to load() by the kernel are indices of
+// nonzero blocks, so TMA only loads the nonzero blocks of A, and the B tile of a nonzero block is
+// loaded at its block column. The problem shape is that of the dense GEMM, with M and K multiples
+// of the block size and L == 1. The mma is the one of the dense mainloop.
+template <
+  int Stages,
+  class ClusterShape,
+  class KernelSchedule,
+  class TileShape_,
+  class ElementA_,
+  class StrideA_,
+  class ElementB_,
+  class StrideB_,
+  class TiledMma_,
+  class GmemTiledCopyA_,
+  class SmemLayoutAtomA_,
+  class SmemCopyAtomA_,
+  class TransformA_,
+  class GmemTiledCopyB_,
+  class SmemLayoutAtomB_,
+  class SmemCopyAtomB_,
+  class TransformB_>
+struct CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecializedBlockSparse<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+  : CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>
+{
+  using Base = CollectiveMma<
+    MainloopSm90TmaGmmaWarpSpecialized<Stages, ClusterShape, KernelSchedule>,
+    TileShape_,
+    ElementA_,
+    StrideA_,
+    ElementB_,
+    StrideB_,
+    TiledMma_,
+    GmemTiledCopyA_,
+    SmemLayoutAtomA_,
+    SmemCopyAtomA_,
+    TransformA_,
+    GmemTiledCopyB_,
+    SmemLayoutAtomB_,
+    SmemCopyAtomB_,
+    TransformB_>;
+
+  //
+  // Type Aliases
+  //
+  using DispatchPolicy = MainloopSm90TmaGmmaWarpSpecializedBlockSparse<Stages, ClusterShape, KernelSchedule>;
+  using typename Base::TileShape;
+  using typename Base::ElementA;
+  using typename Base::StrideA;
+  using typename Base::ElementB;
+  using typename Base::StrideB;
+  using typename Base::InternalElementA;
+  using typename Base::InternalElementB;
+  using typename Base::GmemTiledCopyA;
+  using typename Base::GmemTiledCopyB;
+  using typename Base::SmemLayoutA;
+  using typename Base::SmemLayoutB;
+  using typename Base::MainloopPipeline;
+  using typename Base::PipelineState;
+  using typename Base::TensorStorage;
+
+  // The nonzero blocks of different M tiles differ, so A cannot be multicast, and neither can B
+  // since the block columns of the M tiles of a cluster differ
+  static_assert(size(ClusterShape{}) == 1, "The block sparse mainloop requires a cluster shape of (1, 1, 1).");
+
+  static constexpr int BlockM = size<0>(TileShape{});
+  static constexpr int BlockK = size<2>(TileShape{});
+
+  // Host side kernel arguments
+  struct Arguments {
+    // Nonzero blocks of A, (BlockM, BlockK) each, in CSR order
+    ElementA const* ptr_A;
+    StrideA dA;
+    int32_t num_blocks;
+    // Device array holding the block column of every nonzero block
+    int32_t const* block_col_indices;
+    ElementB const* ptr_B;
+    StrideB dB;
+    uint32_t mma_promotion_interval = 4;
+  };
+
+  // Device side kernel params
+  struct Params : Base::Params {
+    int32_t num_blocks;
+    int32_t const* block_col_indices;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShape>
+  static constexpr Params
+  to_underlying_arguments(ProblemShape const& problem_shape, Arguments const& args, void* workspace) {
+    typename Base::Arguments base_args{
+      args.ptr_A,
+      args.dA,
+      args.ptr_B,
+      args.dB,
+      args.mma_promotion_interval
+    };
+    typename Base::Params base_params = Base::to_underlying_arguments(problem_shape, base_args, workspace);
+
+    // Describe the nonzero blocks as a (BlockM, BlockK, num_blocks) tensor; a K tile is a block
+    auto ptr_A = reinterpret_cast<InternalElementA const*>(args.ptr_A);
+    Tensor tensor_a = make_tensor(ptr_A, make_layout(make_shape(int32_t(BlockM), int32_t(BlockK), args.num_blocks), args.dA));
+    base_params.tma_load_a = make_tma_copy_A_sm90(
+        GmemTiledCopyA{},
+        tensor_a,
+        SmemLayoutA{}(_,_,cute::Int<0>{}),
+        TileShape{},
+        ClusterShape{});
+
+    return {base_params, args.num_blocks, args.block_col_indices};
+  }
+
+  template<class ProblemShape>
+  static bool
+  can_implement(
+      ProblemShape const& problem_shape,
+      Arguments const& args) {
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements_A = tma_alignment_bits / cutlass::sizeof_bits<ElementA>::value;
+    auto problem_shape_MNKL = append<4>(problem_shape, 1);
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    typename Base::Arguments base_args{args.ptr_A, args.dA, args.ptr_B, args.dB, args.mma_promotion_interval};
+    bool implementable = Base::can_implement(problem_shape, base_args);
+    implementable = implementable && args.num_blocks > 0 && args.block_col_indices != nullptr;
+    implementable = implementable && M % BlockM == 0 && K % BlockK == 0 && L == 1;
+    implementable = implementable && cutlass::detail::check_alignment<min_tma_aligned_elements_A>(
+        cute::make_shape(int32_t(BlockM), int32_t(BlockK), args.num_blocks), args.dA);
+
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Block sparse A requires M and K multiples of the tile, L == 1 and TMA aligned blocks.\n");
+    }
+    return implementable;
+  }
+
+  /// Set up the data needed by this collective for load and mma.
+  /// Same contract as the base load_init, with gA_mkl of shape (BLK_M,BLK_K,m,b,1) over the
+  /// nonzero blocks b of A, where every M tile m addresses the same blocks.
+  template <class ProblemShape_MNKL>
+  CUTLASS_DEVICE auto
+  load_init(ProblemShape_MNKL const& problem_shape_MNKL, Params const& mainloop_params) const {
+    using X = Underscore;
+    auto [M,N,K,L] = problem_shape_MNKL;
+
+    Tensor mA_blk = mainloop_params.tma_load_a.get_tma_tensor(
+        make_shape(Int<BlockM>{}, Int<BlockK>{}, mainloop_params.num_blocks));                 // (BLK_M,BLK_K,b)
+    Tensor mB_nkl = mainloop_params.tma_load_b.get_tma_tensor(make_shape(N,K,L));                 // (n,k,l)
+
+    Tensor gA_mkl = make_tensor(mA_blk.data(),
+        make_layout(
+          make_shape(Int<BlockM>{}, Int<BlockK>{}, M / BlockM, mainloop_params.num_blocks, _1{}),
+          make_stride(stride<0>(mA_blk), stride<1>(mA_blk), _0{}, stride<2>(mA_blk), _0{})));    // (BLK_M,BLK_K,m,b,1)
+    Tensor gB_nkl = local_tile(mB_nkl, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{});        // (BLK_N,BLK_K,n,k,l)
+
+    return cute::make_tuple(gA_mkl, gB_nkl);
+  }
+
+  /// Perform a collective-scoped matrix multiply-accumulate
+  /// Producer Perspective
+  /// k_tile_iter iterates over the indices of the nonzero blocks of the work tile
+  template <
+    class TensorA, class TensorB,
+    class KTileIterator, class BlockCoord
+  >
+  CUTLASS_DEVICE void
+  load(
+      Params const& mainloop_params,
+      MainloopPipeline pipeline,
+      PipelineState smem_pipe_write,
+      cute::tuple<TensorA, TensorB> const& load_inputs,
+      BlockCoord const& blk_coord,
+      KTileIterator k_tile_iter, int k_tile_count,
+      int thread_idx,
+      uint32_t block_rank_in_cluster,
+      TensorStorage& shared_tensors) {
+    int lane_predicate = cute::elect_one_sync();
+
+    if (lane_predicate) {
+      Tensor sA = make_tensor(make_smem_ptr(shared_tensors.smem_A.data()), SmemLayoutA{});        // (BLK_M,BLK_K,PIPE)
+      Tensor sB = make_tensor(make_smem_ptr(shared_tensors.smem_B.data()), SmemLayoutB{});        // (BLK_N,BLK_K,PIPE)
+
+      Tensor gA_mkl = get<0>(load_inputs);
+      Tensor gB_nkl = get<1>(load_inputs);
+
+      auto block_tma_a = mainloop_params.tma_load_a.get_slice(0);
+      auto block_tma_b = mainloop_params.tma_load_b.get_slice(0);
+
+      auto [m_coord, n_coord, k_coord, l_coord] = blk_coord;
+      Tensor gA = gA_mkl(_,_,m_coord,_,Int<0>{});                                                 // (BLK_M,BLK_K,b)
+      Tensor gB = gB_nkl(_,_,n_coord,_,l_coord);                                                 // (BLK_N,BLK_K,k)
+
+      Tensor tAgA = block_tma_a.partition_S(gA);                                                 // (TMA,TMA_M,TMA_K,b)
+      Tensor tAsA = block_tma_a.partition_D(sA);                                              // (TMA,TMA_M,TMA_K,PIPE)
+
+      Tensor tBgB = block_tma_b.partition_S(gB);                                                 // (TMA,TMA_N,TMA_K,k)
+      Tensor tBsB = block_tma_b.partition_D(sB);                                              // (TMA,TMA_N,TMA_K,PIPE)
+
+      // Mainloop
+      CUTLASS_PRAGMA_NO_UNROLL
+      for ( ; k_tile_count > 0; --k_tile_count) {
+        int32_t block_idx = *k_tile_iter;
+        // Issued ahead of the acquire so that the index load overlaps the wait on the stage
+        int32_t block_col = __ldg(mainloop_params.block_col_indices + block_idx);
+
+        // LOCK smem_pipe_write for _writing_
+        pipeline.producer_acquire(smem_pipe_write);
+
+        using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+        BarrierType* tma_barrier = pipeline.producer_get_barrier(smem_pipe_write);
+
+        int write_stage = smem_pipe_write.index();
+        copy(mainloop_params.tma_load_a.with(*tma_barrier, uint16_t(0)), tAgA(_,_,_,block_idx), tAsA(_,_,_,write_stage));
+        copy(mainloop_params.tma_load_b.with(*tma_barrier, uint16_t(0)), tBgB(_,_,_,block_col), tBsB(_,_,_,write_stage));
+        ++k_tile_iter;
+
+        // Advance smem_pipe_write
+        ++smem_pipe_write;
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::collective
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -326,7 +326,8 @@ struct CollectiveMma<
       //
 
       constexpr uint32_t cluster_shape_x = get<0>(ClusterShape());
-      uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape_x, block_rank_in_cluster / cluster_shape_x};
+      constexpr uint32_t cluster_shape_y = get<1>(ClusterShape());
+      uint2 cluster_local_block_id = {block_rank_in_cluster % cluster_shape_x, (block_rank_in_cluster / cluster_shape_x) % cluster_shape_y};
 
       Tensor gA_mkl = get<0>(load_inputs);
       Tensor gB_nkl = get<1>(load_inputs);
@@ -44,10 +44,7 @@
 #include "cute/algorithm/gemm.hpp"
 #include "cute/numeric/arithmetic_tuple.hpp"
 #include "cutlass/arch/grid_dependency_control.h"
-
-#include "dispatch_policy_extra.hpp"
-
-#include "../pipeline/prefetch_pipeline_sm90.hpp"
+#include "cutlass/pipeline/sm90_prefetch_pipeline.hpp"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,333 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*!
+  \file
+  \brief Stateful handle of the TMA GEMV kernel with cluster split-K, see
+    cutlass/gemm/kernel/sm90_gemv_tma_split_k.hpp.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/arch/mma.h"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/detail/layout.hpp"
+
+#include "cutlass/kernel_launch.h"
+#if !defined(__CUDACC_RTC__)
+#include "cutlass/cluster_launch.hpp"
+#include "cutlass/trace.h"
+#endif // !defined(__CUDACC_RTC__)
+
+#include "cutlass/gemm/kernel/sm90_gemv_tma_split_k.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::device {
+
+////////////////////////////////////////////////////////////////////////////////
+
+/*!
+  GemvUniversalAdapter manages the lifetime of the Params of a GEMV kernel such as
+  cutlass::gemm::kernel::Sm90GemvTmaSplitK, and exposes the same host API as
+  GemmUniversalAdapter, including the 2.x type aliases used by the CUTLASS library.
+*/
+template <class GemvKernel_>
+class GemvUniversalAdapter {
+public:
+  using GemvKernel = GemvKernel_;
+  // Alias consumed by the code shared with the GEMM adapters
+  using GemmKernel = GemvKernel;
+  using TileShape = typename GemvKernel::TileShape;
+  using ElementA = typename GemvKernel::ElementA;
+  using ElementB = typename GemvKernel::ElementB;
+  using ElementC = typename GemvKernel::ElementC;
+  using ElementD = typename GemvKernel::ElementD;
+  using ElementAccumulator = typename GemvKernel::ElementAccumulator;
+  using ArchTag = typename GemvKernel::ArchTag;
+
+  // Map back to 2.x type as best as possible
+  using LayoutA = gemm::detail::StrideToLayoutTagA_t<typename GemvKernel::StrideA>;
+  using LayoutB = gemm::detail::StrideToLayoutTagB_t<typename GemvKernel::StrideB>;
+  using LayoutC = gemm::detail::StrideToLayoutTagC_t<typename GemvKernel::StrideC>;
+  using LayoutD = gemm::detail::StrideToLayoutTagC_t<typename GemvKernel::StrideD>;
+
+  static bool const kEnableCudaHostAdapter = CUTLASS_ENABLE_CUDA_HOST_ADAPTER;
+
+  static ComplexTransform const kTransformA = ComplexTransform::kNone;
+  static ComplexTransform const kTransformB = ComplexTransform::kNone;
+
+  using MathOperator = cutlass::arch::OpMultiplyAdd;
+  // The dot products run on the CUDA cores
+  using OperatorClass = cutlass::arch::OpClassSimt;
+
+  using ThreadblockShape = cutlass::gemm::GemmShape<
+      cute::size<0>(TileShape{}),
+      cute::size<1>(TileShape{}),
+      cute::size<2>(TileShape{})>;
+
+  using ClusterShape = cutlass::gemm::GemmShape<
+      cute::size<0>(typename GemvKernel::ClusterShape{}),
+      cute::size<1>(typename GemvKernel::ClusterShape{}),
+      cute::size<2>(typename GemvKernel::ClusterShape{})>;
+
+  using InstructionShape = cutlass::gemm::GemmShape<1, 1, 1>;
+
+  static int const kThreadCount = GemvKernel::MaxThreadsPerBlock;
+
+  // The math warps are stacked along M
+  using WarpCount = cutlass::gemm::GemmShape<GemvKernel::NumMathWarps, 1, 1>;
+
+  static int constexpr kStages = GemvKernel::Stages;
+
+  // TMA requires 16B aligned rows of A and B, the epilogue accesses C and D element-wise
+  static int constexpr kAlignmentA = 128 / sizeof_bits<ElementA>::value;
+  static int constexpr kAlignmentB = 128 / sizeof_bits<ElementB>::value;
+  static int constexpr kAlignmentC = 1;
+  static int constexpr kAlignmentD = 1;
+
+  using EpilogueOutputOp = typename GemvKernel::ThreadEpilogueOp;
+
+  /// Argument structure: User API
+  using Arguments = typename GemvKernel::Arguments;
+  /// Argument structure: Kernel API
+  using Params = typename GemvKernel::Params;
+
+private:
+
+  /// Kernel API parameters object
+  Params params_;
+
+public:
+
+  /// Access the Params structure
+  Params const& params() const {
+    return params_;
+  }
+
+  /// Determines whether the GEMV can execute the given problem.
+  static Status
+  can_implement(Arguments const& args) {
+    if (GemvKernel::can_implement(args)) {
+      return Status::kSuccess;
+    }
+    else {
+      return Status::kInvalid;
+    }
+  }
+
+  /// Gets the workspace size
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return GemvKernel::get_workspace_size(args);
+  }
+
+  /// Computes the grid shape
+  static dim3
+  get_grid_shape(Arguments const& args, void* workspace = nullptr) {
+    auto tmp_params = GemvKernel::to_underlying_arguments(args, workspace);
+    return GemvKernel::get_grid_shape(tmp_params);
+  }
+
+  /// Computes the grid shape
+  static dim3
+  get_grid_shape(Params const& params) {
+    return GemvKernel::get_grid_shape(params);
+  }
+
+  /// Initializes GEMV state from arguments.
+  Status
+  initialize(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    CUTLASS_TRACE_HOST("GemvUniversal::initialize() - workspace "
+      << workspace << ", stream: " << (stream ? "non-null" : "null"));
+
+    Status status = GemvKernel::initialize_workspace(args, workspace, stream, cuda_adapter);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    params_ = GemvKernel::to_underlying_arguments(args, workspace);
+
+    // Don't set the function attributes - require the CudaHostAdapter to set it.
+    if constexpr (kEnableCudaHostAdapter) {
+      CUTLASS_ASSERT(cuda_adapter);
+      return Status::kSuccess;
+    }
+    else {
+      int smem_size = GemvKernel::SharedStorageSize;
+
+      if (smem_size >= (48 << 10)) {
+        CUTLASS_TRACE_HOST("  Setting smem size to " << smem_size);
+        cudaError_t result = cudaFuncSetAttribute(
+            device_kernel<GemvKernel>,
+            cudaFuncAttributeMaxDynamicSharedMemorySize,
+            smem_size);
+        if (cudaSuccess != result) {
+          result = cudaGetLastError(); // to clear the error bit
+          CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error: " << cudaGetErrorString(result));
+          return Status::kErrorInternal;
+        }
+      }
+    }
+    return Status::kSuccess;
+  }
+
+  /// Update API does not guarantee a lightweight update of params.
+  Status
+  update(Arguments const& args, void* workspace = nullptr) {
+    params_ = GemvKernel::to_underlying_arguments(args, workspace);
+    return Status::kSuccess;
+  }
+
+  /// Primary run() entry point API that is static allowing users to create and manage their own params.
+  /// Supplied params struct must be construct by calling GemvKernel::to_underlying_arguments()
+  static Status
+  run(Params& params,
+      cudaStream_t stream = nullptr,
+      CudaHostAdapter *cuda_adapter = nullptr,
+      bool launch_with_pdl = false) {
+    CUTLASS_TRACE_HOST("GemvUniversal::run()");
+    dim3 const block = GemvKernel::get_block_shape();
+    dim3 const grid = get_grid_shape(params);
+    int smem_size = GemvKernel::SharedStorageSize;
+
+    [[maybe_unused]] constexpr bool is_static_1x1x1 = cute::size(typename GemvKernel::ClusterShape{}) == 1;
+    [[maybe_unused]] dim3 cluster(cute::size<0>(typename GemvKernel::ClusterShape{}),
+      cute::size<1>(typename GemvKernel::ClusterShape{}),
+      cute::size<2>(typename GemvKernel::ClusterShape{}));
+    [[maybe_unused]] void* kernel_params[] = {&params};
+
+    Status launch_result{ Status::kSuccess };
+    if constexpr (kEnableCudaHostAdapter) {
+      CUTLASS_ASSERT(cuda_adapter);
+      if (cuda_adapter) {
+        if (launch_with_pdl) {
+          CUTLASS_TRACE_HOST(
+            "GemvUniversal::run() does not support launching with PDL and a custom cuda adapter.");
+          return Status::kErrorInternal;
+        }
+        if constexpr (is_static_1x1x1) {
+          launch_result = cuda_adapter->launch(grid, block, smem_size, stream, kernel_params, 0);
+        }
+        else {
+          launch_result = cuda_adapter->launch(grid, cluster, block, smem_size, stream, kernel_params, 0);
+        }
+      }
+      else {
+        CUTLASS_TRACE_HOST("GemvUniversal::run: kEnableCudaHostAdapter is true, but CUDA host adapter is null");
+        return Status::kErrorInternal;
+      }
+    }
+    else {
+      CUTLASS_ASSERT(cuda_adapter == nullptr);
+      if constexpr (is_static_1x1x1) {
+        launch_result = cutlass::kernel_launch<GemvKernel>(
+          grid, block, smem_size, stream, params, launch_with_pdl);
+      }
+      else {
+        void const* kernel = (void const*) device_kernel<GemvKernel>;
+        launch_result = ClusterLauncher::launch(
+          grid, cluster, block, smem_size, stream, kernel, kernel_params, launch_with_pdl);
+      }
+      if (launch_result != Status::kSuccess) {
+        CUTLASS_TRACE_HOST("GemvUniversal::run: kernel launch reports failure");
+      }
+    }
+
+    cudaError_t result = cudaGetLastError();
+    if (cudaSuccess == result && Status::kSuccess == launch_result) {
+      return Status::kSuccess;
+    }
+    else {
+      CUTLASS_TRACE_HOST("  Kernel launch failed. Reason: " << result);
+      return Status::kErrorInternal;
+    }
+  }
+
+  //
+  // Non-static launch overloads that first create and set the internal params struct of this kernel handle.
+  //
+
+  /// Launches the kernel after first constructing Params internal state from supplied arguments.
+  Status
+  run(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    bool launch_with_pdl = false
+  ) {
+    Status status = initialize(args, workspace, stream, cuda_adapter);
+
+    if (Status::kSuccess == status) {
+      status = run(params_, stream, cuda_adapter, launch_with_pdl);
+    }
+    return status;
+  }
+
+  /// Launches the kernel after first constructing Params internal state from supplied arguments.
+  Status
+  operator()(
+    Arguments const& args,
+    void* workspace = nullptr,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    return run(args, workspace, stream, cuda_adapter, launch_with_pdl);
+  }
+
+  /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
+  Status
+  run(
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    bool launch_with_pdl = false) {
+    return run(params_, stream, cuda_adapter, launch_with_pdl);
+  }
+
+  /// Overload that allows a user to re-launch the same kernel without updating internal params struct.
+  Status
+  operator()(cudaStream_t stream = nullptr, CudaHostAdapter *cuda_adapter = nullptr, bool launch_with_pdl = false) {
+    return run(params_, stream, cuda_adapter, launch_with_pdl);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::device
+
+////////////////////////////////////////////////////////////////////////////////
@@ -74,7 +74,8 @@ namespace detail {
 enum class KernelInputTransformType {
     FastF32,
     InterleavedComplexTF32,
-    MixedInput
+    MixedInput,
+    BlockScaledInputQuant
 };
 
 } // namespace detail
@@ -102,6 +103,18 @@ struct HasAuxiliaryLoad : cute::false_type{};
 template <typename T>
 static constexpr bool HasAuxiliaryLoad_v = HasAuxiliaryLoad<T>::value;
 
+// Number of math warp groups of a pingpong kernel schedule:
+//   T::NumMmaWarpGroups if class T has that member, 2 otherwise
+template <typename T, typename = void>
+struct PingpongNumMmaWarpGroups { static constexpr uint32_t value = 2; };
+
+template <typename T>
+struct PingpongNumMmaWarpGroups <T, CUTE_STL_NAMESPACE::void_t<decltype(T::NumMmaWarpGroups)>>
+{ static constexpr uint32_t value = T::NumMmaWarpGroups; };
+
+template <typename T>
+static constexpr uint32_t PingpongNumMmaWarpGroups_v = PingpongNumMmaWarpGroups<T>::value;
+
 } // namespace kernel::detail
 
 //////////////////////////////////////////////////////////////////////////////
@@ -122,6 +135,13 @@ struct KernelTmaWarpSpecializedPingpong {
 struct KernelTmaWarpSpecializedCooperative { 
   static constexpr int SchedulerPipelineStageCount = 0;
 };
+// Pingpong with NumMmaWarpGroups_ math warp groups taking turns on mainloop and epilogue.
+// More than two groups help hide the epilogue of small tiles (e.g. 64x128), at the cost of registers.
+template <int NumMmaWarpGroups_>
+struct KernelTmaWarpSpecializedPingpongWarpGroups : KernelTmaWarpSpecializedPingpong {
+  static constexpr int NumMmaWarpGroups = NumMmaWarpGroups_;
+};
+using KernelTmaWarpSpecializedPingpong3WG = KernelTmaWarpSpecializedPingpongWarpGroups<3>;
 
 struct KernelPtrArrayTmaWarpSpecializedCooperative { };
 struct KernelPtrArrayTmaWarpSpecializedPingpong { };
@@ -156,6 +176,32 @@ struct KernelTmaWarpSpecializedCooperativeFP8FastAccum: KernelTmaWarpSpecialized
 struct KernelPtrArrayTmaWarpSpecializedCooperativeFP8FastAccum : KernelPtrArrayTmaWarpSpecializedCooperative { };
 struct KernelPtrArrayTmaWarpSpecializedPingpongFP8FastAccum : KernelPtrArrayTmaWarpSpecializedPingpong { };
 
+// Segmented Grouped GEMM: every group multiplies a row segment of one shared A matrix (e.g. multi-LoRA)
+struct KernelPtrArrayTmaWarpSpecializedCooperativeSegmentedA : KernelPtrArrayTmaWarpSpecializedCooperative { };
+struct KernelPtrArrayTmaWarpSpecializedPingpongSegmentedA : KernelPtrArrayTmaWarpSpecializedPingpong { };
+
+// FP8 Fast Accumulation policies with L2 prefetch of weights (operand A) while the kernel waits on
+// the preceding grid through griddepcontrol, directed at low latency inference.
+// Standard non-persistent kernel with a single producer warp, and one prefetch warp.
+// GDC `launch_dependent_grids` is issued from the producer warp according to the overlap ratio.
+struct KernelTmaWarpSpecializedFP8FastAccumWithPrefetch { };
+// Non-persistent kernel with two producer warps (one for each of A and B), and one prefetch warp.
+// The producer warp for A does not wait on griddepcontrol and loads immediately.
+struct KernelTmaWarpSpecializedFP8FastAccumWithPrefetchAndSplitDMA { };
+
+// Dual-B (gated) GEMM policies: one A tile is multiplied against two B operands sharing the same
+// layout, and the accumulators are combined in registers as ActivationFn(A*B) * (A*B1) before the
+// epilogue, e.g. ActivationFn = SiLu for the SwiGLU gate/up projection of an MLP.
+struct KernelScheduleSm90DualB { };
+template <template <class> class ActivationFn_>
+struct KernelTmaWarpSpecializedCooperativeDualB : KernelTmaWarpSpecializedCooperative, KernelScheduleSm90DualB {
+  template <class T> using ActivationFn = ActivationFn_<T>;
+};
+template <template <class> class ActivationFn_>
+struct KernelTmaWarpSpecializedPingpongDualB : KernelTmaWarpSpecializedPingpong, KernelScheduleSm90DualB {
+  template <class T> using ActivationFn = ActivationFn_<T>;
+};
+
 //////////////////////////////////////////////////////////////////////////////
 
 // Policies for dispatch of epilogue
@@ -257,16 +303,52 @@ struct MainloopSm90TmaGmma {
 };
 
 // n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// With DynamicStages_, Stages_ is the maximum pipeline depth and the active depth is a mainloop argument
 template<
   int Stages_,
   class ClusterShape_ = Shape<_1,_1,_1>,
-  class KernelSchedule = KernelTmaWarpSpecializedCooperative
+  class KernelSchedule = KernelTmaWarpSpecializedCooperative,
+  bool DynamicStages_ = false
 >
 struct MainloopSm90TmaGmmaWarpSpecialized {
+  constexpr static int Stages = Stages_;
+  constexpr static bool DynamicStages = DynamicStages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// Loads one A tile and two B tiles per stage and combines the two accumulators with the activation of KernelSchedule
+template<
+  int Stages_,
+  class ClusterShape_,
+  class KernelSchedule
+>
+struct MainloopSm90TmaGmmaWarpSpecializedDualB {
   constexpr static int Stages = Stages_;
   using ClusterShape = ClusterShape_;
   using ArchTag = arch::Sm90;
   using Schedule = KernelSchedule;
+  static_assert(cute::is_base_of_v<KernelScheduleSm90DualB, KernelSchedule>,
+    "KernelSchedule must be one of the dual-B policies");
+};
+
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For a block sparse (BSR) A whose nonzero blocks are TileM x TileK, with the nonzero blocks of each
+// output tile selected by the BlockSparseScheduler
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedCooperative
+>
+struct MainloopSm90TmaGmmaWarpSpecializedBlockSparse {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+  static_assert(cute::is_same_v<KernelSchedule, KernelTmaWarpSpecializedCooperative>,
+    "KernelSchedule must be KernelTmaWarpSpecializedCooperative");
 };
 
 // n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
@@ -322,6 +404,23 @@ struct MainloopSm90TmaGmmaWarpSpecializedFP8
     "KernelSchedule must be one of the warp specialized policies");
 };
 
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
+// For FP8 kernels that prefetch a runtime fraction of A into L2 ahead of griddepcontrol.wait
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelTmaWarpSpecializedFP8FastAccumWithPrefetch
+>
+struct MainloopSm90TmaGmmaWarpSpecializedWithPrefetch {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+  using Schedule = KernelSchedule;
+  static_assert(
+    cute::is_same_v<KernelSchedule, KernelTmaWarpSpecializedFP8FastAccumWithPrefetch> ||
+    cute::is_same_v<KernelSchedule, KernelTmaWarpSpecializedFP8FastAccumWithPrefetchAndSplitDMA>,
+    "KernelSchedule must be one of the prefetch policies");
+};
 
 // n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule
 // For FP8 kernels with Blockwise (Software) Scaling
@@ -371,6 +470,17 @@ struct MainloopSm90ArrayTmaGmmaWarpSpecializedFP8
     "KernelSchedule must be one of the Ptr-Array or Grouped Gemm TMA Warp Specialized Cooperative or Pingpong policies");
 };
 
+// n-buffer in smem (Hopper TMA), pipelined with Hopper GMMA and TMA, Warp specialized dynamic schedule for Grouped Gemm
+// whose groups are row segments of a single A matrix. A is loaded through one TMA descriptor with per-group row offsets.
+template<
+  int Stages_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class KernelSchedule = KernelPtrArrayTmaWarpSpecializedCooperativeSegmentedA
+>
+struct MainloopSm90ArrayTmaGmmaWarpSpecializedSegmentedA
+  : MainloopSm90ArrayTmaGmmaWarpSpecialized<Stages_, ClusterShape_, KernelSchedule> {
+};
+
 // n-buffer in smem (Hopper TMA), pipelined with Hopper sparse GMMA and TMA, Warp specialized dynamic schedule
 template<
   int Stages_,
@@ -463,6 +573,17 @@ struct KernelTmaWarpSpecializedSm100 final {
   static constexpr int AccumulatorPipelineStageCount = AccumulatorPipelineStageCount_;
 };
 
+// Dense gemm with two epilogue warpgroups that alternate over output tiles,
+// so the epilogue of one tile overlaps the mainloop of the next
+template<
+  int SchedulerPipelineStageCount_,
+  int AccumulatorPipelineStageCount_
+>
+struct KernelTmaWarpSpecializedPingpongSm100 final {
+  static constexpr int SchedulerPipelineStageCount = SchedulerPipelineStageCount_;
+  static constexpr int AccumulatorPipelineStageCount = AccumulatorPipelineStageCount_;
+};
+
 // Gemm with block scaling factors
 template<
   int SchedulerPipelineStageCount_,
@@ -579,6 +700,16 @@ struct KernelPtrArrayTmaWarpSpecializedInputTransformSm100 final {
   static constexpr int AccumulatorPipelineStageCount = AccumulatorPipelineStageCount_;
 };
 
+// Ptr-Array Mixed Input Transform GEMM
+template<
+  int SchedulerPipelineStageCount_,
+  int AccumulatorPipelineStageCount_
+>
+struct KernelPtrArrayTmaWarpSpecializedMixedInputTransformSm100 final {
+  static constexpr int SchedulerPipelineStageCount = SchedulerPipelineStageCount_;
+  static constexpr int AccumulatorPipelineStageCount = AccumulatorPipelineStageCount_;
+};
+
 
 // SM120 kernel schedules
 template<int SchedulerPipelineStageCount_>
@@ -714,8 +845,13 @@ struct KernelScheduleSm100DenseGemm : KernelScheduleSm100 {};   // Base policy
 struct KernelTmaWarpSpecialized1SmSm100 final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};  // Use for 1SM Dense GEMM Kernels for Collective Mainloop Builder
 struct KernelTmaWarpSpecialized2SmSm100 final : KernelSchedule2Sm, KernelScheduleSm100DenseGemm {};  // Use for 2SM Dense GEMM Kernels for Collective Mainloop Builder
 struct KernelWarpSpecialized1SmSm100    final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};  // Use for 1SM Dense GEMM Kernels for Collective Mainloop Builder Without TMA
+struct KernelWarpSpecialized1SmGatherASm100 final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};  // As above, with rows of A gathered through an index buffer
 struct KernelMixedTmaCpAsyncWarpSpecialized1SmSm100 final : KernelSchedule1Sm, KernelScheduleSm100DenseGemm {};
 struct KernelMixedTmaCpAsyncWarpSpecialized2SmSm100 final : KernelSchedule2Sm, KernelScheduleSm100DenseGemm {};
+// Dense GEMM with ping-pong epilogue warpgroups
+struct KernelScheduleSm100PingpongGemm : KernelScheduleSm100DenseGemm {};
+struct KernelTmaWarpSpecialized1SmPingpongSm100 final : KernelSchedule1Sm, KernelScheduleSm100PingpongGemm {};
+struct KernelTmaWarpSpecialized2SmPingpongSm100 final : KernelSchedule2Sm, KernelScheduleSm100PingpongGemm {};
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // SM100 Ptr-Array Dense GEMM Dispatch Policies
@@ -744,6 +880,10 @@ struct KernelScheduleSm100PlanarComplexGemm : KernelScheduleSm100{};
 // Planar Complex GEMM: Specialize for 1SM vs 2SM
 struct KernelTmaWarpSpecialized1SmPlanarComplexSm100 final : KernelSchedule1Sm, KernelScheduleSm100PlanarComplexGemm { };
 struct KernelTmaWarpSpecialized2SmPlanarComplexSm100 final : KernelSchedule2Sm, KernelScheduleSm100PlanarComplexGemm { };
+// Planar Complex GEMM with the Gauss 3M algorithm: 3 real MMAs per complex multiply-accumulate
+// instead of 4, at the cost of rounding the operand sums (Ar+Ai) and (Br+Bi) to the input type
+struct KernelScheduleSm100PlanarComplexGauss3MGemm : KernelScheduleSm100PlanarComplexGemm {};
+struct KernelTmaWarpSpecialized1SmPlanarComplexGauss3MSm100 final : KernelSchedule1Sm, KernelScheduleSm100PlanarComplexGauss3MGemm { };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // SM100 Ptr-Array Planar Complex GEMM Dispatch Policies
@@ -776,6 +916,14 @@ struct KernelTmaWarpSpecialized1SmMixedInputSmemSm100 final : KernelSchedule1Sm,
 struct KernelTmaWarpSpecialized2SmMixedInputSm100 final : KernelSchedule2Sm, KernelScheduleSm100MixedInputGemm { };
 struct KernelTmaWarpSpecialized2SmMixedInputSmemSm100 final : KernelSchedule2Sm, KernelTmaWarpSpecializedMixedInputSmemSm100 { };
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// SM100 Ptr-Array Mixed Precision Input GEMM Dispatch Policies
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// Ptr-Array and grouped mixed input GEMM. Only the variants that keep the converted operand in tmem are provided.
+struct KernelScheduleSm100PtrArrayMixedInputGemm : KernelScheduleSm100MixedInputGemm {};
+struct KernelPtrArrayTmaWarpSpecialized1SmMixedInputSm100 final : KernelSchedule1Sm, KernelScheduleSm100PtrArrayMixedInputGemm { };
+struct KernelPtrArrayTmaWarpSpecialized2SmMixedInputSm100 final : KernelSchedule2Sm, KernelScheduleSm100PtrArrayMixedInputGemm { };
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // SM100 Ptr-Array FastF32 (9xBF16) GEMM Dispatch Policies
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -831,6 +979,9 @@ struct KernelTmaWarpSpecialized1SmMxf8f6f4Sm100          final : KernelSchedule1
 struct KernelTmaWarpSpecialized2SmMxf8f6f4Sm100          final : KernelSchedule2Sm, KernelScheduleMxf8f6f4Sm100 { };
 struct KernelMixedTmaCpAsyncWarpSpecialized1SmBlockScaledSm100 final : KernelSchedule1Sm, KernelScheduleBlockScaledGemmSm100 {};
 struct KernelMixedTmaCpAsyncWarpSpecialized2SmBlockScaledSm100 final : KernelSchedule2Sm, KernelScheduleBlockScaledGemmSm100 {};
+// Block Scaled Dense GEMM with 16b A operand quantized to the block scaled B format in the mainloop
+struct KernelScheduleBlockScaledInputQuantGemmSm100 : KernelScheduleSm100 {};
+struct KernelTmaWarpSpecialized1SmBlockScaledInputQuantSm100 final : KernelSchedule1Sm, KernelScheduleBlockScaledInputQuantGemmSm100 { };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // SM100 BlockScaled Ptr Array Dense GEMM Dispatch Policies
@@ -988,6 +1139,22 @@ struct MainloopSm100UmmaCpAsyncWarpSpecialized {
   using Schedule = KernelWarpSpecializedSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
 };
 
+// n-buffer in smem, pipelined with Blackwell UMMA and CPASYNC, Warp specialized dynamic schedule.
+// Row m of A is read from row gather_A[m] of the source matrix (e.g. MoE token permutation).
+template<
+  int Stages_,
+  int SchedulerPipelineStageCount_,
+  int AccumulatorPipelineStageCount_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100UmmaCpAsyncWarpSpecializedGatherA {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelWarpSpecializedSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+};
+
 template<
   int Stages_,
   int SchedulerPipelineStageCount_,
@@ -1034,6 +1201,23 @@ struct MainloopSm100TmaUmmaWarpSpecialized {
   constexpr static bool IsOverlappingAccum = false;
 };
 
+// n-buffer in smem, pipelined with Blackwell UMMA and TMA, Warp specialized dynamic schedule
+// with two epilogue warpgroups consuming alternate accumulator stages
+template<
+  int Stages_,
+  int SchedulerPipelineStageCount_,
+  int AccumulatorPipelineStageCount_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100TmaUmmaWarpSpecializedPingpong {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelTmaWarpSpecializedPingpongSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+  constexpr static bool IsOverlappingAccum = false;
+};
+
 // n-buffer in smem, pipelined with Blackwell UMMA and TMA, Warp specialized dynamic schedule
 template<
   int Stages_,
@@ -1220,6 +1404,66 @@ struct MainloopSm100TmaUmmaWarpSpecializedMixedInput {
   constexpr static int Stages = Load2TransformPipelineStageCount;
 };
 
+// Ptr-Array and grouped variant of the mixed input mainloop. A, B, scales and zeros are loaded
+// through per-SM TMA descriptors that are rewritten whenever the CTA moves to a new group.
+template<
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Conversion <-> MainLoad
+  int Load2TransformPipelineStageCount_,
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Conversion <-> MainLoad
+  int Transform2MmaPipelineStageCount_,
+  // TileScheduler pipeline depth
+  int SchedulerPipelineStageCount_,
+  // Accmulator pipeline depth
+  int AccumulatorPipelineStageCount_,
+  // ClusterShape for the kernel
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100ArrayTmaUmmaWarpSpecializedMixedInput {
+  constexpr static int Load2TransformPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Load2MmaPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Transform2MmaPipelineStageCount = Transform2MmaPipelineStageCount_;
+  constexpr static detail::KernelInputTransformType InputTransformType = detail::KernelInputTransformType::MixedInput;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelPtrArrayTmaWarpSpecializedMixedInputTransformSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+
+  // For backwards compatibility with GemmUniversalAdapter.
+  constexpr static int Stages = Load2TransformPipelineStageCount;
+};
+
+// n-buffer in smem, pipelined with Blackwell block scaled UMMA and TMA. The 16b A operand is loaded by
+// TMA and quantized to the block scaled MMA format, including its scale factors, by the transform warps.
+template<
+  // Number of Pipeline stages for
+  // MainloopLoad <-> Quantization and MainloopLoad <-> MMA
+  int Load2TransformPipelineStageCount_,
+  // Number of Pipeline stages for
+  // Quantization <-> MMA
+  int Transform2MmaPipelineStageCount_,
+  // TileScheduler pipeline depth
+  int SchedulerPipelineStageCount_,
+  // Accmulator pipeline depth
+  int AccumulatorPipelineStageCount_,
+  // ClusterShape for the kernel
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100TmaUmmaWarpSpecializedBlockScaledInputQuant {
+  constexpr static int Load2TransformPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Load2MmaPipelineStageCount = Load2TransformPipelineStageCount_;
+  constexpr static int Transform2MmaPipelineStageCount = Transform2MmaPipelineStageCount_;
+  constexpr static detail::KernelInputTransformType InputTransformType = detail::KernelInputTransformType::BlockScaledInputQuant;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelTmaWarpSpecializedMixedInputTransformSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+
+  // For backwards compatibility with GemmUniversalAdapter.
+  constexpr static int Stages = Load2TransformPipelineStageCount;
+};
+
 
 // n-buffer in smem, pipelined with Blackwell UMMA and TMA, Warp specialized dynamic schedule
 template<
@@ -1239,6 +1483,24 @@ struct MainloopSm100TmaUmmaWarpSpecializedPlanarComplex {
   constexpr static bool IsOverlappingAccum = false;
 };
 
+// Planar complex mainloop computing each complex product with 3 real MMAs (Gauss 3M).
+// The MMA warp forms the operand sums (Ar+Ai) and (Br+Bi) in smem, and three accumulators
+// T1 = Ar*Br, T2 = Ai*Bi, T3 = (Ar+Ai)*(Br+Bi) are resolved by the epilogue.
+template<
+  int Stages_,
+  int SchedulerPipelineStageCount_,
+  int AccumulatorPipelineStageCount_,
+  class ClusterShape_ = Shape<_1,_1,_1>,
+  class ArchTag_ = arch::Sm100
+>
+struct MainloopSm100TmaUmmaWarpSpecializedPlanarComplexGauss3M {
+  constexpr static int Stages = Stages_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = ArchTag_;
+  using Schedule = KernelTmaWarpSpecializedSm100<SchedulerPipelineStageCount_, AccumulatorPipelineStageCount_>;
+  constexpr static bool IsOverlappingAccum = false;
+};
+
 // n-buffer in smem, pipelined with Blackwell UMMA and TMA, Warp specialized dynamic schedule
 template<
   int Stages_,
@@ -93,10 +93,28 @@ struct MoEProblemShape {
   int32_t num_groups = 0;
   int32_t* tokens_per_expert = nullptr; 
   int32_t* tokens_per_expert_host = nullptr; 
+  // Optional device array of exclusive prefix sums of tokens_per_expert (length num_groups).
+  // When set, ragged-contiguous (RC) grouped kernels address operand B and the C/D tensors of
+  // each expert as offsets into a single contiguous allocation instead of per-group pointer arrays.
+  int64_t const* token_offsets = nullptr;
   
   CUTLASS_HOST_DEVICE
   int32_t groups() const { return num_groups; }
 
+  CUTLASS_HOST_DEVICE
+  bool
+  has_token_offsets() const {
+    return token_offsets != nullptr;
+  }
+
+  // Returns the index of the first token of the given expert within the contiguous token dimension
+  CUTLASS_HOST_DEVICE
+  int64_t
+  get_token_offset(int32_t group_idx) const {
+    assert(token_offsets != nullptr);
+    return token_offsets[group_idx];
+  }
+
   CUTLASS_HOST_DEVICE
   UnderlyingProblemShape const
   get_problem_shape(int32_t group_idx=0) const {
@@ -0,0 +1,88 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device-side operand addressing for 3.x Ptr-Array GEMMs: batch i of an operand lives at
+           base + index[i] * batch_stride instead of an entry of a materialized pointer array.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_size.h"
+
+#include "cute/util/type_traits.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Operand addresses of a Ptr-Array GEMM generated on device from a base pointer, an optional index
+/// vector and a batch stride in elements. Suited to paged KV caches and per-head adapter weights, where
+/// every batch points into one allocation and only the index vector changes between steps.
+/// Without an index vector, batch i maps to base + i * batch_stride.
+template <class Element>
+struct IndexedPtrArray {
+  Element* base = nullptr;
+  int32_t const* index = nullptr;
+  int64_t batch_stride = 0;
+
+  CUTLASS_HOST_DEVICE
+  bool
+  is_set() const {
+    return base != nullptr;
+  }
+
+  CUTLASS_HOST_DEVICE
+  Element*
+  operator[](int32_t batch) const {
+    int64_t offset = (index != nullptr ? static_cast<int64_t>(index[batch]) : static_cast<int64_t>(batch)) * batch_stride;
+    // Byte arithmetic keeps sub-byte element types addressable
+    using Byte = cute::conditional_t<cute::is_const_v<Element>, char const, char>;
+    return reinterpret_cast<Element*>(reinterpret_cast<Byte*>(base) + offset * sizeof_bits<Element>::value / 8);
+  }
+};
+
+/// Address of batch in a Ptr-Array operand given either as a materialized pointer array or as an IndexedPtrArray.
+/// The materialized array takes precedence when both are provided.
+template <class Element, class IndexedElement>
+CUTLASS_HOST_DEVICE
+Element*
+get_batch_ptr(Element* const* ptr_array, IndexedPtrArray<IndexedElement> const& indexed, int32_t batch) {
+  return ptr_array != nullptr ? ptr_array[batch] : reinterpret_cast<Element*>(indexed[batch]);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
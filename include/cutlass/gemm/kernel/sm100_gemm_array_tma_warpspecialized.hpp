@@ -1023,6 +1023,9 @@ public:
         is_first_iteration = false;
         did_batch_change = curr_batch != idx2crd(work_tile_info.L_idx, shape<4>(gA_mkl));
       } while (work_tile_info.is_valid());
+      // Release dependent grids here if requested, the last mainloop load has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
       collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
     }
@@ -1270,7 +1273,7 @@ public:
       // Hint on an early release of global memory resources.
       // The timing of calling this function only influences performance,
       // not functional correctness.
-      cutlass::arch::launch_dependent_grids();
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
       // Release the right to allocate before deallocations so that the next CTA can rasterize
       tmem_allocator.release_allocation_lock();
@@ -1535,6 +1538,9 @@ public:
         tmem_deallocation_result_barrier.arrive();
       }
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       // Only perform a tail store if one of the work units processed performed
       // an epilogue. An example of a case in which a tail load should not be
       // performed is in split-K if a cluster is only assigned non-final splits (for which
@@ -800,6 +800,10 @@ public:
         // For subsequent tiles, check if batch changes and therefore, we need tensormap updates
         did_batch_change = curr_batch != idx2crd(work_tile_info.L_idx, shape<4>(gA_mkl));
       } while (work_tile_info.is_valid());
+
+      // Release dependent grids here if requested, the last mainloop load has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
       if (lane_predicate) {
         load2transform_pipeline.producer_tail(load2transform_pipeline_producer_state);
       }
@@ -967,7 +971,7 @@ public:
       // Hint on an early release of global memory resources.
       // The timing of calling this function only influences performance,
       // not functional correctness.
-      cutlass::arch::launch_dependent_grids();
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
       // Signal to peer MMA that stage can be deallocated
       if constexpr (has_mma_peer_cta) {
@@ -1185,6 +1189,9 @@ public:
         did_batch_change = curr_batch != work_tile_info.L_idx;
       } while (work_tile_info.is_valid());
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       // Only perform a tail load if one of the work units processed performed
       // an epilogue load. An example of a case in which a tail load should not be
       // performed is in split-K if a cluster is only assigned non-final splits (for which
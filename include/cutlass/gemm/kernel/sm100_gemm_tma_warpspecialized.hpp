@@ -58,6 +58,20 @@ namespace cutlass::gemm::kernel {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+// Whether the mainloop can prefetch A into L2 ahead of griddepcontrol.wait
+template <class CollectiveMainloop, class = void>
+struct has_mainloop_prefetch_A : cute::false_type { };
+
+template <class CollectiveMainloop>
+struct has_mainloop_prefetch_A<CollectiveMainloop,
+    cute::void_t<decltype(CollectiveMainloop::Arguments::prefetch_ratio)>> : cute::true_type { };
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+
 template <
   class ProblemShape_,
   class CollectiveMainloop_,
@@ -614,6 +628,15 @@ public:
     pipeline_init_wait(cluster_size);
 
     if (is_participant.main_load) {
+      if constexpr (detail::has_mainloop_prefetch_A<CollectiveMainloop>::value) {
+        // Bring part of A of the first work tile into L2 while the preceding grid is still running
+        if (work_tile_info.is_valid()) {
+          auto k_tile_iter = scheduler.get_k_tile_iterator(work_tile_info, problem_shape_MNKL, CtaShape_MNK{}, load_inputs.k_tiles);
+          auto k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, CtaShape_MNK{});
+          collective_mainloop.prefetch_A(load_inputs, cta_coord_mnkl, k_tile_iter, k_tile_count);
+        }
+      }
+
       // Ensure that the prefetched kernel does not touch
       // unflushed global memory prior to this instruction
       cutlass::arch::wait_on_dependent_grids();
@@ -673,6 +696,9 @@ public:
           ++clc_pipe_consumer_state;
         }
       } while (work_tile_info.is_valid());
+      // Release dependent grids here if requested, the last mainloop load has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
       collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
     }
@@ -777,7 +803,7 @@ public:
       // Hint on an early release of global memory resources.
       // The timing of calling this function only influences performance,
       // not functional correctness.
-      cutlass::arch::launch_dependent_grids();
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
       // Release the right to allocate before deallocations so that the next CTA can rasterize
       tmem_allocator.release_allocation_lock();
@@ -941,6 +967,9 @@ public:
         tmem_deallocation_result_barrier.arrive();
       }
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       // Only perform a tail store if one of the work units processed performed
       // an epilogue. An example of a case in which a tail load should not be
       // performed is in split-K if a cluster is only assigned non-final splits (for which
@@ -724,6 +724,10 @@ public:
         }
         work_tile_info = next_work_tile_info;
       } while (work_tile_info.is_valid());
+
+      // Release dependent grids here if requested, the last mainloop load has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
       if (lane_predicate) {
         load2transform_pipeline.producer_tail(load2transform_pipeline_producer_state);
       }
@@ -880,7 +884,7 @@ public:
       // Hint on an early release of global memory resources.
       // The timing of calling this function only influences performance,
       // not functional correctness.
-      cutlass::arch::launch_dependent_grids();
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
       // Signal to peer MMA that entire tmem allocation can be deallocated
       if constexpr (has_mma_peer_cta) {
@@ -1069,6 +1073,9 @@ public:
         cta_coord_mnkl = scheduler.work_tile_to_cta_coord(work_tile_info);
       } while (work_tile_info.is_valid());
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       // Only perform a tail load if one of the work units processed performed
       // an epilogue load. An example of a case in which a tail load should not be
       // performed is in split-K if a cluster is only assigned non-final splits (for which
@@ -705,6 +705,9 @@ public:
         }
       } while (work_tile_info.is_valid());
 
+      // Release dependent grids here if requested, the last mainloop load has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
       collective_mainloop.load_ab_tail(
         mainloop_ab_pipeline, 
         mainloop_ab_pipe_producer_state
@@ -870,7 +873,7 @@ public:
       // Hint on an early release of global memory resources.
       // The timing of calling this function only influences performance,
       // not functional correctness.
-      cutlass::arch::launch_dependent_grids();
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
       // Release the right to allocate before deallocations so that the next CTA can rasterize
       tmem_allocator.release_allocation_lock();
@@ -1046,6 +1049,9 @@ public:
 
       } while (work_tile_info.is_valid());
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       // Only perform a tail store if one of the work units processed performed
       // an epilogue. An example of a case in which a tail load should not be
       // performed is in split-K if a cluster is only assigned non-final splits (for which
@@ -161,6 +161,17 @@ public:
       arguments.max_swizzle_size,
       arguments.raster_order
     );
+    BaseScheduler::initialize_tile_order(
+      params,
+      problem_blocks,
+      problem_shape_mnkl,
+      cute::size<0>(tile_shape_mnk) / cute::size<0>(atom_thr_shape_mnk),
+      cute::size<1>(tile_shape_mnk) / cute::size<1>(atom_thr_shape_mnk),
+      to_gemm_coord(cluster_shape_mnk),
+      hw_info,
+      arguments
+    );
+    BaseScheduler::initialize_telemetry(params, problem_shape_mnkl, cute::size<2>(tile_shape_mnk), arguments);
 
     return params;
   }
@@ -191,6 +202,17 @@ public:
       arguments.max_swizzle_size,
       arguments.raster_order
     );
+    BaseScheduler::initialize_tile_order(
+      params,
+      problem_blocks,
+      problem_shape_mnkl,
+      cute::size<0>(tile_shape),
+      cute::size<1>(tile_shape),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      arguments
+    );
+    BaseScheduler::initialize_telemetry(params, problem_shape_mnkl, cute::size<2>(tile_shape), arguments);
 
     return params;
   }
@@ -98,6 +98,9 @@ public:
   struct Arguments {
     int max_swizzle_size = 0;
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+    // If set, points to one entry per CTA of the grid receiving the work processed by the CTA. Only
+    // recorded if CUTLASS_ENABLE_TILE_SCHEDULER_TELEMETRY is defined.
+    TileSchedulerTelemetry* telemetry = nullptr;
   };
 
   //
@@ -129,6 +132,7 @@ public:
       args.max_swizzle_size,
       args.raster_order
     );
+    initialize_telemetry(params, problem_shape_mnkl, cute::size<2>(tile_shape), args);
     return params;
   }
 
@@ -157,9 +161,23 @@ public:
       args.max_swizzle_size,
       args.raster_order
     );
+    initialize_telemetry(params, problem_shape_mnkl, cute::size<2>(tile_shape_mnk), args);
     return params;
   }
 
+  // Sets up the per-CTA work accounting of Arguments::telemetry for output tiles of cta_tile_k along K
+  template <class ProblemShapeMNKL>
+  static void
+  initialize_telemetry(
+      Params& params,
+      ProblemShapeMNKL problem_shape_mnkl,
+      int cta_tile_k,
+      Arguments const& args) {
+    params.telemetry_ = args.telemetry;
+    params.telemetry_k_tiles_ = static_cast<uint32_t>(
+      (cute::size(cute::get<2>(problem_shape_mnkl)) + cta_tile_k - 1) / cta_tile_k);
+  }
+
   // Conv Specialization
   template <conv::Operator ConvOp, int NumSpatialDims, class TileShape, class AtomThrShape, class ClusterShape>
   static Params
@@ -339,6 +357,12 @@ public:
 
   static bool
   can_implement(Arguments const& args, KernelHardwareInfo const&) {
+    // Work is handed out by cluster launch control in hardware order, which the super-tile orders can't remap
+    if (args.raster_order == RasterOrderOptions::L2Aware ||
+        args.raster_order == RasterOrderOptions::Morton) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: CLC scheduler does not support the L2Aware and Morton raster orders.\n");
+      return false;
+    }
     return true;
   }
 
@@ -347,11 +371,15 @@ public:
   //
   CUTLASS_DEVICE
   PersistentTileSchedulerSm100(Params const& params)
-    : params_(params) {}
+    : params_(params) {
+    telemetry_.begin(params_.telemetry_);
+  }
 
   CUTLASS_DEVICE
   PersistentTileSchedulerSm100(CLCResponse* clc_response_ptr, Params const& params, dim3 block_id_in_cluster)
-    : clc_response_ptr_(clc_response_ptr), params_(params), block_id_in_cluster_(block_id_in_cluster) {}
+    : clc_response_ptr_(clc_response_ptr), params_(params), block_id_in_cluster_(block_id_in_cluster) {
+    telemetry_.begin(params_.telemetry_);
+  }
 
   template <class ProblemShapeMNKL, class TileShape>
   CUTLASS_DEVICE
@@ -468,6 +496,13 @@ public:
       work_tile.M_idx, work_tile.N_idx, work_tile.L_idx, work_tile.is_valid(),
       block_id_in_cluster_.x, block_id_in_cluster_.y);
 
+    if (work_tile_info.is_valid()) {
+      telemetry_.record(params_.telemetry_k_tiles_);
+    }
+    if (!work_tile.is_valid()) {
+      telemetry_.end();
+    }
+
     // Return true to indicate that the tile scheduler pipeline state should be advanced
     return cute::make_tuple(work_tile, true);
   }
@@ -819,6 +854,7 @@ public:
   CLCResponse *clc_response_ptr_ = nullptr;
   Params const& params_;
   dim3 block_id_in_cluster_ = {0, 0, 0};
+  TileSchedulerTelemetryRecorder telemetry_;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
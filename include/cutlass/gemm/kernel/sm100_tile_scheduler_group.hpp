@@ -104,7 +104,8 @@ public:
       to_gemm_coord(selected_cluster_shape),
       hw_info,
       args.max_swizzle_size,
-      args.raster_order
+      args.raster_order,
+      args.group_order
     );
 
     return params;
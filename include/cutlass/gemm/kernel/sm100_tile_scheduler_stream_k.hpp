@@ -90,6 +90,7 @@ public:
       params.sm100_params_.divmod_cluster_shape_m_.divisor,
       params.sm100_params_.divmod_cluster_shape_n_.divisor,
       Int<1>{});
+    telemetry_.begin(params_.sk_params_.telemetry_);
   }
 
   CUTLASS_DEVICE
@@ -102,6 +103,7 @@ public:
       params.sm100_params_.divmod_cluster_shape_m_.divisor,
       params.sm100_params_.divmod_cluster_shape_n_.divisor,
       Int<1>{});
+    telemetry_.begin(params_.sk_params_.telemetry_);
   }
 
   template <class ProblemShape, class TileShapeMNK>
@@ -139,8 +141,10 @@ public:
       args.reduction_mode,
       ForceDataParallel ? Params::DecompositionMode::DataParallel : args.decomposition_mode,
       workspace,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      args.heuristic
     );
+    params.sk_params_.telemetry_ = args.telemetry;
     return params;
   }
 
@@ -173,8 +177,10 @@ public:
       args.reduction_mode,
       ForceDataParallel ? Params::DecompositionMode::DataParallel : args.decomposition_mode,
       workspace,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      args.heuristic
     );
+    params.sk_params_.telemetry_ = args.telemetry;
 
     return params;
   }
@@ -338,12 +344,16 @@ public:
     // the work unit will have been updated in continue_current_work to reflect the new
     // tile to be computed. Return `false` to indicate that the CLC pipeline state
     // need not be advanced.
+    if (work_tile_info.is_valid()) {
+      telemetry_.record(work_tile_info.k_tile_count);
+    }
     if (continue_current_work(work_tile_info)) {
       return cute::make_tuple(work_tile_info, false);
     }
 
     auto [work_tile, _] = sm100_scheduler_.fetch_next_work(InternalWorkTileInfo{}, clc_pipeline, clc_pipe_consumer_state);
     if (!work_tile.is_valid()) {
+      telemetry_.end();
       return cute::make_tuple(invalid_work_tile(), true);
     }
 
@@ -429,7 +439,8 @@ public:
       sizeof_bits<ElementAccumulator>::value,
       EpilogueSubtiles,
       num_accumulator_mtxs,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      args.heuristic
     );
   }
 
@@ -471,7 +482,8 @@ public:
       sizeof_bits<ElementAccumulator>::value,
       EpilogueSubtiles,
       num_accumulator_mtxs,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      args.heuristic
     );
   }
 
@@ -516,7 +528,9 @@ public:
       EpilogueSubtiles,
       num_accumulator_mtxs,
       cuda_adapter,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      args.heuristic,
+      args.barrier_workspace_initialized
     );
   }
 
@@ -564,7 +578,9 @@ public:
       EpilogueSubtiles,
       num_accumulator_mtxs,
       cuda_adapter,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      args.heuristic,
+      args.barrier_workspace_initialized
     );
   }
 
@@ -1002,6 +1018,7 @@ private:
   dim3 block_id_in_cluster_;
   uint64_t current_work_linear_idx_ = 0;
   uint32_t unit_iter_start_ = 0;
+  TileSchedulerTelemetryRecorder telemetry_;
 
   // This might not be needed
   bool is_fallback_cluster_ = false;
@@ -0,0 +1,792 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#pragma once
+
+#include "cute/int_tuple.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/blas3_types.h"
+#include "cutlass/arch/config.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/detail/cluster.hpp"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/gemm_coord.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel::detail {
+
+//////////////////// Blackwell Work-Queue Scheduler /////////////////////////
+
+// Dynamic persistent scheduler that hands out cluster tiles from a work queue in global memory.
+//
+// A persistent grid of clusters is launched. Each cluster starts with the queue entry of its own
+// index, and further entries are claimed by incrementing an atomic counter in the scheduler
+// workspace. Clusters that finish early thus take over the remaining work, as with CLC, while the
+// order of the tiles is chosen by the queue. Sorting the queue by decreasing cost, e.g. with
+// populate_work_queue() below, schedules the expensive tiles first and avoids a long tail when
+// the cost of the tiles is uneven, e.g. for causal masks or block-sparse operands.
+//
+// Without a queue, cluster tiles are handed out in M-major order.
+//
+// The claimed entry is forwarded to the CTAs of the cluster through the CLC pipeline, replacing
+// the CLC query by a remote store of the 16B entry to the response buffer of each CTA.
+template<
+  class ClusterShape_,
+  uint32_t Stages_
+>
+class PersistentTileSchedulerSm100WorkQueue {
+
+private:
+
+  using UnderlyingTileScheduler = PersistentTileSchedulerSm90;
+
+public:
+  using ClusterShape = ClusterShape_;
+  using RasterOrder = UnderlyingTileScheduler::RasterOrder;
+  using RasterOrderOptions = UnderlyingTileScheduler::RasterOrderOptions;
+  static constexpr bool IsDynamicPersistent = true;
+
+  static constexpr uint32_t Stages = Stages_;
+
+  // Response holds the cluster tile coordinates (M, N, L) and a valid flag
+  struct CLCResponse { uint32_t data[4] = {0}; };
+  static_assert(sizeof(CLCResponse) == sizeof(WorkQueueEntry), "Queue entries must have the size of a CLC response.");
+
+  using WorkTileInfo = typename UnderlyingTileScheduler::WorkTileInfo;
+
+  using Params = PersistentTileSchedulerSm100WorkQueueParams;
+  using Pipeline = PipelineCLCFetchAsync<Stages, ClusterShape>;
+  using PipelineStorage = typename Pipeline::SharedStorage;
+
+  using ThrottlePipeline = PipelineAsync<Stages>;
+  using ThrottlePipelineStorage = typename ThrottlePipeline::SharedStorage;
+
+  class SharedStorage {
+  public:
+
+    CUTLASS_DEVICE PipelineStorage& pipeline() { return pipeline_; }
+    CUTLASS_DEVICE ThrottlePipelineStorage& throttle_pipeline() { return throttle_pipeline_; }
+    CUTLASS_DEVICE CLCResponse* data() { return data_; }
+
+  private:
+    alignas(16) PipelineStorage pipeline_;
+    alignas(16) ThrottlePipelineStorage throttle_pipeline_;
+    alignas(16) CLCResponse data_[Stages];
+  };
+
+  struct Arguments {
+    // Unused, the order of the tiles is given by the work queue. Kept for compatibility with
+    // the arguments of the other SM100 schedulers.
+    int max_swizzle_size = 0;
+    RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+    // Cluster tiles in the order they are handed out, with one entry per cluster tile of the
+    // problem, see get_work_queue_shape(). If null, tiles are handed out in M-major order.
+    WorkQueueEntry const* work_queue = nullptr;
+    // Number of entries of the work queue if it only holds a subset of the cluster tiles, e.g. the
+    // triangle of a rank-k update, see populate_triangular_work_queue(). Zero if the queue holds
+    // one entry per cluster tile. The tiles without an entry are not computed.
+    uint32_t num_work_queue_entries = 0;
+  };
+
+  //
+  // Static Host Methods
+  //
+
+  template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    ProblemShapeMNKL problem_shape_mnkl,
+    TileShape tile_shape,
+    [[maybe_unused]] ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& args,
+    void* workspace = nullptr,
+    [[maybe_unused]] uint32_t NumEpilogueSubTiles = 1,
+    [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u
+    ) {
+
+    auto cs = cutlass::detail::select_cluster_shape(ClusterShape_{}, hw_info.cluster_shape);
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape, cs);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      to_gemm_coord(cs),
+      hw_info,
+      args.work_queue,
+      args.num_work_queue_entries,
+      workspace
+    );
+    return params;
+  }
+
+  template <class ProblemShapeMNKL, class TileShape, class AtomThrShape, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape_mnk,
+      AtomThrShape atom_thr_shape_mnk,
+      ClusterShape cluster_shape_mnk,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& args,
+      void* workspace = nullptr
+    ) {
+
+    auto selected_cluster_shape = cutlass::detail::select_cluster_shape(cluster_shape_mnk, hw_info.cluster_shape);
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape_mnk,
+                                                  atom_thr_shape_mnk, selected_cluster_shape);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      to_gemm_coord(selected_cluster_shape),
+      hw_info,
+      args.work_queue,
+      args.num_work_queue_entries,
+      workspace
+    );
+    return params;
+  }
+
+  // Given the inputs, computes the physical grid we should launch: one cluster per
+  // persistent worker, laid out along the x dimension of the grid.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_grid_shape(
+      Params const& params,
+      ProblemShapeMNKL,
+      BlockShape,
+      ClusterShape,
+      KernelHardwareInfo,
+      [[maybe_unused]] Arguments arguments) {
+    return get_grid_shape(params);
+  }
+
+  template<class ProblemShapeMNKL, class TileShape, class AtomThrShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_grid_shape(
+      Params const& params,
+      ProblemShapeMNKL,
+      TileShape,
+      AtomThrShape,
+      ClusterShape,
+      KernelHardwareInfo) {
+    return get_grid_shape(params);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_grid_shape(Params const& params) {
+    return dim3(params.num_clusters_ * params.divmod_cluster_shape_m_.divisor,
+                params.divmod_cluster_shape_n_.divisor,
+                1);
+  }
+
+  // Shape (M, N, L) of the work queue in cluster tiles. The queue must hold one entry per cluster tile.
+  template<class ProblemShapeMNKL, class TileShape, class AtomThrShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_work_queue_shape(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape_mnk,
+      AtomThrShape atom_thr_shape_mnk,
+      ClusterShape cluster_shape_mnk) {
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape_mnk, atom_thr_shape_mnk, cluster_shape_mnk);
+    return dim3(problem_blocks.x / size<0>(cluster_shape_mnk),
+                problem_blocks.y / size<1>(cluster_shape_mnk),
+                problem_blocks.z);
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(
+      Arguments const&,
+      ProblemShape,
+      KernelHardwareInfo const&,
+      [[maybe_unused]] uint32_t reduction_warp_groups,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t num_accumulator_mtxs = 1) {
+    return Params::get_workspace_size();
+  }
+
+  template <class ElementAccumulator, class ProblemShape, class TileShapeMNK, class AtomThrShape, class ClusterShape>
+  static size_t
+  get_workspace_size(Arguments const& args, ProblemShape problem_shape, TileShapeMNK, AtomThrShape, ClusterShape, KernelHardwareInfo const& hw_info,
+      uint32_t reduction_warp_groups, uint32_t num_accumulator_mtxs = 1) {
+    return get_workspace_size<ProblemShape, ElementAccumulator>(args, problem_shape, hw_info, reduction_warp_groups, num_accumulator_mtxs);
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(
+    Arguments const&,
+    void* workspace,
+    cudaStream_t stream,
+    ProblemShape const&,
+    KernelHardwareInfo const&,
+    uint32_t,     // reduction_warp_groups
+    uint32_t = 1, // epilogue_subtile
+    uint32_t = 1, // num_accumulator_mtxs
+    CudaHostAdapter *cuda_adapter = nullptr) {
+    return Params::initialize_workspace(workspace, stream, cuda_adapter);
+  }
+
+  template <class ElementAccumulator, class ProblemShape, class TileShapeMNK, class AtomThrShape>
+  static cutlass::Status
+  initialize_workspace(
+      Arguments const& args,
+      void* workspace,
+      cudaStream_t stream,
+      ProblemShape const& problem_shape,
+      TileShapeMNK,
+      AtomThrShape,
+      ClusterShape,
+      KernelHardwareInfo const& hw_info,
+      uint32_t reduction_warp_groups,
+      uint32_t num_accumulator_mtxs = 1,
+      CudaHostAdapter *cuda_adapter = nullptr) {
+
+    return initialize_workspace<ProblemShape, ElementAccumulator>(
+      args,
+      workspace,
+      stream,
+      problem_shape,
+      hw_info,
+      reduction_warp_groups,
+      1,  // epilogue_subtile
+      num_accumulator_mtxs,
+      cuda_adapter
+    );
+  }
+
+  static bool
+  can_implement(Arguments const&, KernelHardwareInfo const& hw_info) {
+    // Queue entries are cluster tiles, so all clusters of the grid must have the same shape.
+    // A fallback cluster shape that differs from the preferred one is not supported.
+    dim3 const& preferred = hw_info.cluster_shape;
+    dim3 const& fallback = hw_info.cluster_shape_fallback;
+    bool const has_fallback = fallback.x > 0 && (fallback.x != preferred.x || fallback.y != preferred.y);
+    if (has_fallback) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Work-queue scheduler does not support a fallback cluster shape.\n");
+      return false;
+    }
+    return true;
+  }
+
+  //
+  // Constructors
+  //
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm100WorkQueue(Params const& params)
+    : params_(params) {}
+
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm100WorkQueue(CLCResponse* clc_response_ptr, Params const& params, dim3 block_id_in_cluster)
+    : clc_response_ptr_(clc_response_ptr), params_(params), block_id_in_cluster_(block_id_in_cluster) {}
+
+  template <class ProblemShapeMNKL, class TileShape>
+  CUTLASS_DEVICE
+  PersistentTileSchedulerSm100WorkQueue(CLCResponse* clc_response_ptr, Params const& params, ProblemShapeMNKL problem_shape_mnkl, TileShape tile_shape, dim3 block_id_in_cluster)
+    : PersistentTileSchedulerSm100WorkQueue(clc_response_ptr, params, block_id_in_cluster) {}
+
+  //
+  // Work Tile API
+  //
+
+  // Returns the initial work tile info that will be computed over. Cluster c starts with queue entry c.
+  template <class ClusterShape>
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    uint32_t cluster_idx = params_.divmod_cluster_shape_m_.divide(blockIdx.x);
+    CLCResponse response = make_response(cluster_idx);
+    return to_cta_work_tile(response);
+  }
+
+  CUTLASS_DEVICE
+  auto
+  work_tile_to_cta_coord(WorkTileInfo work_tile_info) {
+    return make_coord(work_tile_info.M_idx, work_tile_info.N_idx, _, work_tile_info.L_idx);
+  }
+
+  // Convert CTA-level work tile info to cluster-level tile coord
+  CUTLASS_DEVICE
+  auto
+  work_tile_to_cluster_coord_mnkl(WorkTileInfo work_tile_info) const {
+    int m_coord = params_.divmod_cluster_shape_m_.divide(work_tile_info.M_idx);
+    int n_coord = params_.divmod_cluster_shape_n_.divide(work_tile_info.N_idx);
+    return make_coord(m_coord, n_coord, _, work_tile_info.L_idx);
+  }
+
+  // Claims the next queue entry and forwards it to the response buffers of all CTAs of the cluster.
+  // Must be called by a full warp.
+  CUTLASS_DEVICE
+  PipelineState<Stages>
+  advance_to_next_work(Pipeline& clc_pipeline, PipelineState<Stages> clc_pipe_producer_state) const {
+    uint32_t mbarrier_addr = clc_pipeline.producer_get_barrier(clc_pipe_producer_state);
+    // Wait for the response buffer to become empty with a flipped phase
+    clc_pipeline.producer_acquire(clc_pipe_producer_state);
+
+    #if defined(__CUDA_ARCH__)
+    uint32_t queue_idx = 0;
+    if (cute::elect_one_sync()) {
+      queue_idx = params_.num_clusters_ + atomicAdd(params_.tile_counter_, 1u);
+    }
+    queue_idx = __shfl_sync(0xffffffff, queue_idx, 0);
+    // Read by every lane, the entry is shared by all lanes of the warp in L1
+    CLCResponse response = make_response(queue_idx);
+
+    // Lane i stores the response to CTA i of the cluster, completing the transaction
+    // expected by producer_acquire on the barrier of that CTA
+    uint32_t const cluster_size = params_.divmod_cluster_shape_m_.divisor * params_.divmod_cluster_shape_n_.divisor;
+    uint32_t const lane_idx = cutlass::canonical_lane_idx();
+    if (lane_idx < cluster_size) {
+      uint32_t smem_addr = cute::cast_smem_ptr_to_uint(&clc_response_ptr_[clc_pipe_producer_state.index()]);
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < 4; ++i) {
+        cute::store_shared_remote(response.data[i], smem_addr + i * sizeof(uint32_t), mbarrier_addr, lane_idx);
+      }
+    }
+    #endif
+
+    ++clc_pipe_producer_state;
+    return clc_pipe_producer_state;
+  }
+
+  // Kernel helper function to get next work tile
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+    WorkTileInfo,
+    TileSchedulerPipeline& scheduler_pipeline,
+    TileSchedulerPipelineState scheduler_pipe_consumer_state) {
+
+    scheduler_pipeline.consumer_wait(scheduler_pipe_consumer_state);
+    CLCResponse response = clc_response_ptr_[scheduler_pipe_consumer_state.index()];
+    cutlass::arch::fence_view_async_shared();
+    scheduler_pipeline.consumer_release(scheduler_pipe_consumer_state);
+
+    // Return true to indicate that the tile scheduler pipeline state should be advanced
+    return cute::make_tuple(to_cta_work_tile(response), true);
+  }
+
+  //
+  // K Tile API
+  //
+  // Permute K iteration loading order from [C, S, R, T] to [S, R, T, C] for better L2 locality
+  template <class ProblemShapeMNKL, class TileShape, class Shape>
+  CUTLASS_DEVICE
+  auto
+  get_k_tile_iterator(WorkTileInfo const& work_tile_info, ProblemShapeMNKL problem_shape_MNKL, TileShape tile_shape, Shape) {
+    constexpr int32_t rank_t = cute::rank<2>(ProblemShapeMNKL{});
+    auto k_tiles = cute::ceil_div(cute::get<2>(problem_shape_MNKL), cute::get<2>(tile_shape));
+    if constexpr (rank_t == 4) {
+      return cute::make_coord_iterator<cute::Step<_3, _0, _1, _2>>(k_tiles);
+    }
+    else if constexpr (rank_t == 3) {
+      return cute::make_coord_iterator<cute::Step<_2, _0, _1>>(k_tiles);
+    }
+    else if constexpr (rank_t == 2) {
+      return cute::make_coord_iterator<cute::Step<_1, _0>>(k_tiles);
+    }
+    else {
+      return cute::make_coord_iterator(k_tiles);
+    }
+  }
+
+  template <class ProblemShape, class TileShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape problem_shape, TileShape tile_shape) {
+    // All work units returned by this scheduler cover the entire K iteration
+    // space of the output tile assigned to the work unit.
+    return cute::size(cute::ceil_div(cute::get<2>(problem_shape), cute::get<2>(tile_shape)));
+  }
+
+  // Compatible with sm90 kernel layers
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const&) {
+    // All work units returned by this scheduler start from K tile 0
+    return 0u;
+  }
+
+  // Returns whether the block assigned this work should compute the epilogue for the corresponding
+  // output tile. For this scheduler, this is always true.
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&, Params const&) {
+    return true;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&) {
+    return true;
+  }
+
+  // Returns whether fixup is needed for `work_tile_info`. None of the work units returned by
+  // this scheduler require fixup, since none of the work units partition the reduction extent.
+  CUTLASS_HOST_DEVICE
+  static bool
+  requires_fixup(Params const& params, WorkTileInfo const work_tile_info) {
+    return false;
+  }
+
+  // Performs the reduction across splits for a given output tile. No fixup is required for
+  // work units returned by this scheduler.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  void
+  fixup(WorkTileInfo const&, FrgTensorC&, uint32_t, uint32_t, uint32_t = 1) const { }
+
+  template <
+    bool IsComplex,
+    class TiledMma,
+    class AccEngine,
+    class AccLayout,
+    class AccumulatorPipeline,
+    class AccumulatorPipelineState,
+    class CopyOpT2R
+  >
+  CUTLASS_DEVICE
+  AccumulatorPipelineState
+  fixup(
+      TiledMma const& ,
+      WorkTileInfo const&,
+      cute::Tensor<AccEngine, AccLayout>&,
+      AccumulatorPipeline,
+      AccumulatorPipelineState acc_pipe_consumer_state,
+      CopyOpT2R) const {
+    return acc_pipe_consumer_state;
+  }
+
+  // Returns whether the current WorkTileInfo passed in should continue to be used. Since
+  // this scheduler only schedules work in units of single, full output tiles, the WorkTileInfo
+  // passed in should not be used after having been processed.
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const& work_tile_info) {
+    return true;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const& params) {
+    return false;
+  }
+
+  //
+  // Implementation Helpers
+  //
+  // Given the inputs, computes the total number of output blocks this problem will compute over
+  // Note that this is only the logical size of our grid, not the physical grid we will actually launch.
+  template<class ProblemShapeMNKL, class BlockShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static dim3
+  get_tiled_cta_shape_mnl(ProblemShapeMNKL problem_shape_mnkl, BlockShape blk_shape, ClusterShape cluster_shape) {
+    return PersistentTileSchedulerSm100<ClusterShape_, Stages_>::get_tiled_cta_shape_mnl(
+      problem_shape_mnkl, blk_shape, cluster_shape);
+  }
+
+  template<class ProblemShapeMNKL, class TileShape, class AtomThrShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE
+  static dim3
+  get_tiled_cta_shape_mnl(ProblemShapeMNKL problem_shape_mnkl,
+                          TileShape tile_shape_mnk,
+                          AtomThrShape atom_thr_shape_mnk,
+                          ClusterShape cluster_shape_mnk) {
+    return PersistentTileSchedulerSm100<ClusterShape_, Stages_>::get_tiled_cta_shape_mnl(
+      problem_shape_mnkl, tile_shape_mnk, atom_thr_shape_mnk, cluster_shape_mnk);
+  }
+
+  // Returns the response for queue entry `queue_idx`, which is invalid past the end of the queue
+  CUTLASS_DEVICE
+  CLCResponse
+  make_response(uint32_t queue_idx) const {
+    CLCResponse response;
+    if (queue_idx < params_.num_tiles_) {
+      if (params_.work_queue_ != nullptr) {
+        WorkQueueEntry entry = params_.work_queue_[queue_idx];
+        response.data[0] = static_cast<uint32_t>(entry.M_idx);
+        response.data[1] = static_cast<uint32_t>(entry.N_idx);
+        response.data[2] = static_cast<uint32_t>(entry.L_idx);
+      }
+      else {
+        int tile_mn, tile_m, tile_n, tile_l;
+        params_.divmod_tiles_m_(tile_mn, tile_m, static_cast<int>(queue_idx));
+        params_.divmod_tiles_n_(tile_l, tile_n, tile_mn);
+        response.data[0] = static_cast<uint32_t>(tile_m);
+        response.data[1] = static_cast<uint32_t>(tile_n);
+        response.data[2] = static_cast<uint32_t>(tile_l);
+      }
+      response.data[3] = 1;
+    }
+    return response;
+  }
+
+  // Converts a response holding cluster tile coordinates to the work tile of this CTA
+  CUTLASS_DEVICE
+  WorkTileInfo
+  to_cta_work_tile(CLCResponse const& response) const {
+    WorkTileInfo work_tile_info;
+    work_tile_info.M_idx = static_cast<int32_t>(response.data[0] * params_.divmod_cluster_shape_m_.divisor + block_id_in_cluster_.x);
+    work_tile_info.N_idx = static_cast<int32_t>(response.data[1] * params_.divmod_cluster_shape_n_.divisor + block_id_in_cluster_.y);
+    work_tile_info.L_idx = static_cast<int32_t>(response.data[2]);
+    work_tile_info.is_valid_tile = (response.data[3] == 1);
+    return work_tile_info;
+  }
+
+  // Set data SMEM ptr
+  CUTLASS_DEVICE
+  void
+  set_data_ptr(CLCResponse* clc_response_ptr) {
+    clc_response_ptr_ = clc_response_ptr;
+  }
+
+  //
+  // Data Members
+  //
+  CLCResponse *clc_response_ptr_ = nullptr;
+  Params const& params_;
+  dim3 block_id_in_cluster_ = {0, 0, 0};
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+
+// Sorts the cluster tiles of a problem into a work queue by decreasing cost.
+//
+// `cost_fn(m, n, l)` returns the cost of cluster tile (m, n, l), e.g. its number of unmasked K tiles.
+// The tiles are ordered by floor(log2(cost)) buckets with a single CTA: a histogram of the buckets, a
+// descending prefix sum, and a scatter of the tiles to their bucket. This approximates a priority
+// queue with one pass over the tiles, tiles within a bucket are in no particular order.
+template <class CostFn>
+__global__ void
+populate_work_queue_kernel(WorkQueueEntry* work_queue, dim3 queue_shape, CostFn cost_fn) {
+  #if defined(__CUDA_ARCH__)
+  constexpr int NumBuckets = 33;
+  __shared__ uint32_t bucket_offset[NumBuckets];
+
+  auto bucket = [](uint32_t cost) { return 32 - __clz(cost); };
+  uint32_t const num_tiles = queue_shape.x * queue_shape.y * queue_shape.z;
+
+  for (int b = threadIdx.x; b < NumBuckets; b += blockDim.x) {
+    bucket_offset[b] = 0;
+  }
+  __syncthreads();
+
+  for (uint32_t i = threadIdx.x; i < num_tiles; i += blockDim.x) {
+    int m = i % queue_shape.x;
+    int n = (i / queue_shape.x) % queue_shape.y;
+    int l = i / (queue_shape.x * queue_shape.y);
+    atomicAdd(&bucket_offset[bucket(cost_fn(m, n, l))], 1u);
+  }
+  __syncthreads();
+
+  // The most expensive bucket comes first
+  if (threadIdx.x == 0) {
+    uint32_t offset = 0;
+    for (int b = NumBuckets - 1; b >= 0; --b) {
+      uint32_t count = bucket_offset[b];
+      bucket_offset[b] = offset;
+      offset += count;
+    }
+  }
+  __syncthreads();
+
+  for (uint32_t i = threadIdx.x; i < num_tiles; i += blockDim.x) {
+    int m = i % queue_shape.x;
+    int n = (i / queue_shape.x) % queue_shape.y;
+    int l = i / (queue_shape.x * queue_shape.y);
+    uint32_t cost = cost_fn(m, n, l);
+    uint32_t idx = atomicAdd(&bucket_offset[bucket(cost)], 1u);
+    work_queue[idx] = WorkQueueEntry{m, n, l, cost};
+  }
+  #endif
+}
+
+// Launches populate_work_queue_kernel on `stream`. `work_queue` must hold one entry per cluster tile of
+// `queue_shape`, as returned by PersistentTileSchedulerSm100WorkQueue::get_work_queue_shape().
+template <class CostFn>
+cutlass::Status
+populate_work_queue(
+    WorkQueueEntry* work_queue,
+    dim3 queue_shape,
+    CostFn cost_fn,
+    cudaStream_t stream = nullptr) {
+  populate_work_queue_kernel<<<1, 1024, 0, stream>>>(work_queue, queue_shape, cost_fn);
+  cudaError_t result = cudaGetLastError();
+  if (result != cudaSuccess) {
+    CUTLASS_TRACE_HOST("  populate_work_queue(): kernel launch failed with error: " << cudaGetErrorString(result));
+    return cutlass::Status::kErrorInternal;
+  }
+  return cutlass::Status::kSuccess;
+}
+
+// Returns whether cluster tile (m, n) of cluster_tile_m x cluster_tile_n elements holds an element of
+// the Fill triangle of the output, including the diagonal
+template <FillMode Fill>
+CUTLASS_HOST_DEVICE
+bool
+intersects_triangle(int m, int n, int cluster_tile_m, int cluster_tile_n) {
+  int64_t const last_row = int64_t(m + 1) * cluster_tile_m - 1;
+  int64_t const last_col = int64_t(n + 1) * cluster_tile_n - 1;
+  if constexpr (Fill == FillMode::kLower) {
+    return last_row >= int64_t(n) * cluster_tile_n;
+  }
+  else {
+    return last_col >= int64_t(m) * cluster_tile_m;
+  }
+}
+
+// Number of cluster tiles of `queue_shape` that intersect the Fill triangle of the output, i.e. the
+// number of work queue entries written by populate_triangular_work_queue()
+inline uint32_t
+get_triangular_work_queue_size(dim3 queue_shape, int cluster_tile_m, int cluster_tile_n, FillMode fill) {
+  uint32_t count = 0;
+  for (uint32_t n = 0; n < queue_shape.y; ++n) {
+    for (uint32_t m = 0; m < queue_shape.x; ++m) {
+      bool take = fill == FillMode::kLower ?
+        intersects_triangle<FillMode::kLower>(m, n, cluster_tile_m, cluster_tile_n) :
+        intersects_triangle<FillMode::kUpper>(m, n, cluster_tile_m, cluster_tile_n);
+      count += take ? 1 : 0;
+    }
+  }
+  return count * queue_shape.z;
+}
+
+// Writes the cluster tiles that intersect the Fill triangle of the output, batch by batch with the
+// tiles of a batch in M-major order. Used for the rank-k updates (SYRK) of C = A * A^T, whose
+// output tiles on the other side of the diagonal are never computed. A single CTA compacts the tiles
+// of one batch at a time with a block-wide prefix sum.
+template <FillMode Fill>
+__global__ void
+populate_triangular_work_queue_kernel(
+    WorkQueueEntry* work_queue, dim3 queue_shape, int cluster_tile_m, int cluster_tile_n) {
+  #if defined(__CUDA_ARCH__)
+  __shared__ uint32_t warp_count[32];
+  __shared__ uint32_t batch_offset;
+
+  uint32_t const tiles_per_batch = queue_shape.x * queue_shape.y;
+  uint32_t const warp_idx = threadIdx.x / 32;
+  uint32_t const lane_idx = threadIdx.x % 32;
+  if (threadIdx.x == 0) {
+    batch_offset = 0;
+  }
+  __syncthreads();
+
+  for (uint32_t l = 0; l < queue_shape.z; ++l) {
+    for (uint32_t base = 0; base < tiles_per_batch; base += blockDim.x) {
+      uint32_t i = base + threadIdx.x;
+      int m = static_cast<int>(i % queue_shape.x);
+      int n = static_cast<int>(i / queue_shape.x);
+      bool take = i < tiles_per_batch && intersects_triangle<Fill>(m, n, cluster_tile_m, cluster_tile_n);
+
+      uint32_t ballot = __ballot_sync(0xffffffff, take);
+      if (lane_idx == 0) {
+        warp_count[warp_idx] = __popc(ballot);
+      }
+      __syncthreads();
+
+      uint32_t offset = batch_offset;
+      uint32_t total = 0;
+      for (uint32_t w = 0; w < blockDim.x / 32; ++w) {
+        offset += (w < warp_idx) ? warp_count[w] : 0;
+        total += warp_count[w];
+      }
+      offset += __popc(ballot & ((1u << lane_idx) - 1));
+      if (take) {
+        work_queue[offset] = WorkQueueEntry{m, n, static_cast<int32_t>(l), 1};
+      }
+      __syncthreads();
+      if (threadIdx.x == 0) {
+        batch_offset += total;
+      }
+      __syncthreads();
+    }
+  }
+  #endif
+}
+
+// Launches populate_triangular_work_queue_kernel on `stream`. `work_queue` must hold
+// get_triangular_work_queue_size() entries, which is also the Arguments::num_work_queue_entries of
+// the scheduler. The cluster tile extents are those of the output tile of a cluster, e.g.
+// size<0>(TileShape) * size<0>(ClusterShape) for 1SM MMAs.
+inline cutlass::Status
+populate_triangular_work_queue(
+    WorkQueueEntry* work_queue,
+    dim3 queue_shape,
+    int cluster_tile_m,
+    int cluster_tile_n,
+    FillMode fill,
+    cudaStream_t stream = nullptr) {
+  if (fill == FillMode::kLower) {
+    populate_triangular_work_queue_kernel<FillMode::kLower><<<1, 1024, 0, stream>>>(
+      work_queue, queue_shape, cluster_tile_m, cluster_tile_n);
+  }
+  else if (fill == FillMode::kUpper) {
+    populate_triangular_work_queue_kernel<FillMode::kUpper><<<1, 1024, 0, stream>>>(
+      work_queue, queue_shape, cluster_tile_m, cluster_tile_n);
+  }
+  else {
+    CUTLASS_TRACE_HOST("  populate_triangular_work_queue(): fill mode must be kLower or kUpper");
+    return cutlass::Status::kErrorInvalidProblem;
+  }
+  cudaError_t result = cudaGetLastError();
+  if (result != cudaSuccess) {
+    CUTLASS_TRACE_HOST("  populate_triangular_work_queue(): kernel launch failed with error: " << cudaGetErrorString(result));
+    return cutlass::Status::kErrorInternal;
+  }
+  return cutlass::Status::kSuccess;
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // end namespace cutlass::gemm::kernel::detail
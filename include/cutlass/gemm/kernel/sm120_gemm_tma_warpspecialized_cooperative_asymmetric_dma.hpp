@@ -650,6 +650,9 @@ public:
           }
         } // Scheduler work fetch loop
 
+        // Release dependent grids here if requested, the last mainloop load has been issued
+        cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline_mk, mainloop_pipe_producer_state_mk);
 
@@ -840,7 +843,7 @@ public:
           // Hint on an early release of global memory resources.
           // The timing of calling this function only influences performance,
           // not functional correctness.
-          cutlass::arch::launch_dependent_grids();
+          cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
         }
         #endif
@@ -887,6 +890,9 @@ public:
         }
       } // Scheduler work fetch loop
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       if (do_store_tail) {
         collective_epilogue.store_tail(
           epi_load_pipeline,
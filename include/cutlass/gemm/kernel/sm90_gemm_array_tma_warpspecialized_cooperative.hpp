@@ -744,6 +744,9 @@ public:
           }
         } while (work_tile_info.is_valid()); // Scheduler work fetch loop
 
+        // Release dependent grids here if requested, the last mainloop load has been issued
+        cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
       } // Mainloop Producer Warp End
@@ -1044,7 +1047,7 @@ public:
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info, tile_scheduler_pipeline, tile_scheduler_pipe_consumer_state);
 
         if (!next_work_tile_info.is_valid()) {
-          cutlass::arch::launch_dependent_grids();
+          cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
         }
 
         work_tile_info = next_work_tile_info;
@@ -1080,6 +1083,9 @@ public:
 
       } while (work_tile_info.is_valid()); // Scheduler work fetch loop
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       // Cooperative only needs TMA to complete at the very end of the kernel
       if (do_store_tail) {
         collective_epilogue.store_tail(
@@ -134,6 +134,7 @@ public:
       and cute::is_base_of_v<GroupScheduler, TileScheduler_>
     ),
     "Ptr-Array Pingpong and Grouped Gemm Pingpong kernel only supports group-compatible schedulers (TileScheduler_ must derive from GroupScheduler).");
+  static_assert(!cute::is_same_v<TileScheduler_, GroupStreamKScheduler>, "Ptr-Array Pingpong kernel does not currently support stream-K scheduler.");
 
   using SchedulerTag = cute::conditional_t<
     cute::is_void_v<TileScheduler_>,
@@ -782,6 +783,9 @@ public:
           }
         } while (work_tile_info.is_valid()); // Scheduler work fetch loop
 
+        // Release dependent grids here if requested, the last mainloop load has been issued
+        cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
       } // Mainloop Producer Warp End
@@ -1088,7 +1092,7 @@ public:
         auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info, tile_scheduler_pipeline, tile_scheduler_pipe_consumer_state);
 
         if (!next_work_tile_info.is_valid()) {
-          cutlass::arch::launch_dependent_grids();
+          cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
         }
 
         work_tile_info = next_work_tile_info;
@@ -1164,6 +1168,9 @@ public:
         math_wg_order_barrier.arrive();
 
       } while (work_tile_info.is_valid()); // Scheduler work fetch loop
+
+      // Release dependent grids here if requested, the last output store of this warp group has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
     } // Consumer Warp Groups End
 #endif
   }
@@ -194,6 +194,7 @@ public:
     ProblemShapeMNKL problem_shape{};
     MainloopParams mainloop{};
     EpilogueParams epilogue{};
+    KernelHardwareInfo hw_info{};
   };
 
   //
@@ -217,7 +218,8 @@ public:
     return {
       swapped_problem_shape,
       CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, workspace),
-      CollectiveEpilogue::to_underlying_arguments(transformed_problem_shape, args.epilogue, workspace)
+      CollectiveEpilogue::to_underlying_arguments(transformed_problem_shape, args.epilogue, workspace),
+      args.hw_info
     };
   }
 
@@ -445,6 +447,10 @@ public:
         );
         // Update starting mainloop pipeline state for the pipeline drain
         mainloop_pipe_producer_state.advance(k_tile_count);
+
+        // Release dependent grids here if requested, the last mainloop load has been issued
+        cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
         // Make sure mainloop consumer has been waited upon before issuing epilogue load
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
@@ -488,7 +494,7 @@ public:
       // Hint on an early release of global memory resources.
       // The timing of calling this function only influences performance,
       // not functional correctness.
-      cutlass::arch::launch_dependent_grids();
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
       // Epilogue and write to gD
       auto [epi_load_pipe_consumer_state_next, epi_store_pipe_producer_state_next] =
@@ -506,6 +512,9 @@ public:
         shared_storage.tensors.epilogue
       );
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       collective_epilogue.store_tail(
         epi_load_pipeline,
         epi_load_pipe_consumer_state_next,
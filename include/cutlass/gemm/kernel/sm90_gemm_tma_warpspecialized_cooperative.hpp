@@ -45,6 +45,7 @@
 #include "cute/tensor.hpp"
 #include "cutlass/trace.h"
 #include "cutlass/gemm/kernel/gemm_universal_decl.h"
+#include "cutlass/conv/detail.hpp"
 #include "cutlass/arch/grid_dependency_control.h"
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -69,7 +70,8 @@ public:
   // Type Aliases
   //
   using ProblemShape = ProblemShape_;
-  static_assert(cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
+  static constexpr bool IsConvProblemShape = not (cute::is_tuple_v<ProblemShape> || IsCutlass3ArrayKernel<ProblemShape>::value);
+  static_assert(IsConvProblemShape || cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
     "ProblemShape{} should be <M,N,K> or <M,N,K,L>");
 
   // Mainloop derived types
@@ -118,6 +120,10 @@ public:
   static constexpr uint32_t NumEpilogueLoadThreads = NumThreadsPerWarp;      // 1 warp for C
 
   static constexpr bool IsSchedDynamicPersistent = TileScheduler::IsDynamicPersistent;
+  // Split-K across the CTAs of a cluster, reduced in distributed shared memory
+  static constexpr bool IsSchedClusterSplitK = cute::is_same_v<TileSchedulerTag, ClusterSplitKScheduler>;
+  // Walks the output slices of a convolution inside every CTA
+  static constexpr bool IsSchedTemporalStreaming = cute::is_same_v<TileSchedulerTag, TemporalStreamingScheduler>;
   static constexpr bool IsGdcEnabled = cutlass::arch::IsGdcGloballyEnabled;
 
   static constexpr uint32_t NumLoadWarpGroups = 1;
@@ -191,12 +197,48 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+
+    // Default constructor
+    Arguments() = default;
+
+    // Constructor with specified mode
+    // It is used for Gemm
+    Arguments(
+        GemmUniversalMode mode_,
+        ProblemShape problem_shape_,
+        MainloopArguments mainloop_,
+        EpilogueArguments epilogue_,
+        KernelHardwareInfo hw_info_ = KernelHardwareInfo(),
+        TileSchedulerArguments scheduler_ = TileSchedulerArguments())
+    : mode(mode_)
+      , problem_shape(problem_shape_)
+      , mainloop(mainloop_)
+      , epilogue(epilogue_)
+      , hw_info(hw_info_)
+      , scheduler(scheduler_) {}
+
+    // Constructor with default value for 'mode'
+    // This allows us to set GemmUniversal mode as kGemm for Conv right away
+    // while keeping the testbeds unchanged
+    Arguments(
+        ProblemShape problem_shape_,
+        MainloopArguments mainloop_,
+        EpilogueArguments epilogue_,
+        KernelHardwareInfo hw_info_ = KernelHardwareInfo(),
+        TileSchedulerArguments scheduler_ = TileSchedulerArguments())
+    : mode(GemmUniversalMode::kGemm) // Default mode
+      , problem_shape(problem_shape_)
+      , mainloop(mainloop_)
+      , epilogue(epilogue_)
+      , hw_info(hw_info_)
+      , scheduler(scheduler_) {}
   };
 
   // Kernel entry point API
   struct Params {
+    using ProblemShapeMNKL = decltype(cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(ProblemShape{}, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{}));
     GemmUniversalMode mode{};
-    ProblemShape problem_shape{};
+    ProblemShapeMNKL problem_shape{};
     MainloopParams mainloop{};
     EpilogueParams epilogue{};
     KernelHardwareInfo hw_info{};
@@ -214,11 +256,15 @@ public:
   to_underlying_arguments(Arguments const& args, void* workspace) {
     CUTLASS_TRACE_HOST("to_underlying_arguments():");
 
-    auto problem_shape = args.problem_shape;
+    // Convolutions are scheduled over their linearized (M,N,K,L) GEMM view
+    auto problem_shape_mnkl = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{});
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
+
+    auto problem_shape = problem_shape_mnkl;
     if constexpr (detail::Has_SwapAB_v<CollectiveMainloop>) {
       // swap M/N
-      get<0>(problem_shape) = get<1>(args.problem_shape);
-      get<1>(problem_shape) = get<0>(args.problem_shape);
+      get<0>(problem_shape) = get<1>(problem_shape_mnkl);
+      get<1>(problem_shape) = get<0>(problem_shape_mnkl);
     }
     auto problem_shape_MNKL = append<4>(problem_shape, 1);
 
@@ -251,12 +297,12 @@ public:
     size_t workspace_offset = 0;
 
     void* epilogue_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(transformed_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* scheduler_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+    workspace_offset += TileScheduler::template get_workspace_size<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* mainloop_workspace = nullptr;
@@ -264,15 +310,22 @@ public:
     // in separate reduction scheme for streamk case, NumEpilogueSubTiles default value is 1, which means
     // subtile will not be used, therefore separate reduction will not be enabled.
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
+    // Convolutions tell the temporal streaming scheduler the extent of an output slice in M
+    TileSchedulerArguments scheduler_args = args.scheduler;
+    if constexpr (IsSchedTemporalStreaming) {
+      if (scheduler_args.slice_extent_m == 0) {
+        scheduler_args.slice_extent_m = cutlass::conv::detail::get_output_slice_extent_M(args.problem_shape);
+      }
+    }
     TileSchedulerParams scheduler = TileScheduler::to_underlying_arguments(
-      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, scheduler_workspace, NumEpilogueSubTiles
+      problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, scheduler_args, scheduler_workspace, NumEpilogueSubTiles
       );
 
     return {
       args.mode,
       problem_shape,
       CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, mainloop_workspace),
-      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, epilogue_workspace),
+      CollectiveEpilogue::to_underlying_arguments(transformed_problem_shape, args.epilogue, epilogue_workspace),
       hw_info,
       scheduler,
       workspace
@@ -287,8 +340,9 @@ public:
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
       return implementable;
     }
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
-    implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
+    implementable &= CollectiveEpilogue::can_implement(transformed_problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler, args.hw_info);
     return implementable;
   }
@@ -297,12 +351,14 @@ public:
   get_workspace_size(Arguments const& args) {
     size_t workspace_size = 0;
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
+    auto problem_shape_mnkl = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{});
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
 
-    workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_size += CollectiveEpilogue::get_workspace_size(transformed_problem_shape, args.epilogue);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
-    workspace_size += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    workspace_size += TileScheduler::template get_workspace_size<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
     return workspace_size;
   }
@@ -315,18 +371,20 @@ public:
     size_t workspace_offset = 0;
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
     static constexpr uint32_t NumAccumulatorMtxs = 1;
+    auto problem_shape_mnkl = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{});
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
 
-    status = CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    status = CollectiveEpilogue::initialize_workspace(transformed_problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(transformed_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
     }
 
-    status = TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
+    status = TileScheduler::template initialize_workspace<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, workspace_ptr + workspace_offset, stream, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+    workspace_offset += TileScheduler::template get_workspace_size<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
@@ -373,10 +431,10 @@ public:
     static_assert(size<0>(TileShape{}) >= 128,
         "Cooperative kernel requires Tile Size to be greater than or equal to 128 along the M-dimension.");
 
-    static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
 
     /* In the Cooperative kernel, Consumer0 and Consumer1 collaborate on the same tile */
     enum class WarpGroupRole {
@@ -413,6 +471,14 @@ public:
       CollectiveEpilogue::prefetch_tma_descriptors(params.epilogue);
     }
 
+    // The split-K reduction barriers are signaled by the peer CTAs, so they are initialized
+    // ahead of the cluster-wide synchronization below
+    if constexpr (IsSchedClusterSplitK) {
+      if ((warp_idx == 0) && lane_predicate) {
+        TileScheduler::init_barriers(shared_storage.scheduler);
+      }
+    }
+
     CollectiveEpilogue collective_epilogue(params.epilogue, shared_storage.tensors.epilogue);
     bool is_epi_load_needed = collective_epilogue.is_producer_load_needed();
     // TileScheduler pipeline
@@ -503,12 +569,21 @@ public:
 
     // Initialize starting pipeline states for the collectives
     // Epilogue store pipe is producer-only (consumer is TMA unit, waits via scoreboarding)
-    typename CollectiveMainloop::PipelineState mainloop_pipe_consumer_state;
+    using MainloopPipelineState = typename CollectiveMainloop::PipelineState;
+    MainloopPipelineState mainloop_pipe_consumer_state;
     typename CollectiveEpilogue::LoadPipelineState epi_load_pipe_consumer_state;
 
     // For the DMA Load (producer) we start with an opposite phase
     // i.e., we skip all waits since we know that the buffer is indeed empty
-    PipelineState mainloop_pipe_producer_state = cutlass::make_producer_start_state<MainloopPipeline>();
+    MainloopPipelineState mainloop_pipe_producer_state;
+    if constexpr (MainloopPipelineState::DynamicStages) {
+      // Only cycle through the mainloop stages selected at launch
+      mainloop_pipe_consumer_state = cutlass::make_consumer_start_state<MainloopPipeline>(params.mainloop.active_stages);
+      mainloop_pipe_producer_state = cutlass::make_producer_start_state<MainloopPipeline>(params.mainloop.active_stages);
+    }
+    else {
+      mainloop_pipe_producer_state = cutlass::make_producer_start_state<MainloopPipeline>();
+    }
     PipelineState epi_load_pipe_producer_state = cutlass::make_producer_start_state<EpiLoadPipeline>();
     PipelineState epi_store_pipe_producer_state = cutlass::make_producer_start_state<EpiStorePipeline>();
 
@@ -534,7 +609,7 @@ public:
     auto blk_shape = TileShape{};                                                                // (BLK_M,BLK_N,BLK_K)
 
     TileScheduler scheduler{params.scheduler};
-    if constexpr (IsSchedDynamicPersistent) {
+    if constexpr (IsSchedDynamicPersistent || IsSchedClusterSplitK) {
       scheduler.set_data_ptr(shared_storage.scheduler.data());
     }
     // Declare work_tile_info, then define it in each of warps that use it.
@@ -553,6 +628,18 @@ public:
     Tensor gA_mkl = get<0>(load_inputs);
     Tensor gB_nkl = get<1>(load_inputs);
 
+    // Handles the difference between the rank of Tensor returned by load_input in case they do not have a batch mode
+    auto get_l_coord = [&] (auto const& gB_nkl_, int32_t L_idx) {
+      if constexpr (not IsConvProblemShape) {
+        // This needs to be inside an `if constexpr`,
+        // because shape<4>(gB_nkl) is not well-formed otherwise.
+        return idx2crd(L_idx, shape<4>(gB_nkl_));
+      }
+      else {
+        return Int<0>{};
+      }
+    };
+
     // Wait for all thread blocks in the Cluster
     cluster_wait_fn();
 
@@ -606,15 +693,21 @@ public:
         bool requires_clc_query = true;
         while (work_tile_info.is_valid()) {
           if (!TileScheduler::valid_warpgroup_in_work_tile(work_tile_info)) {
+            // The epilogue load warp waits for the first mainloop load, which a work tile without
+            // mainloop loads (e.g. an empty cluster split-K split) would otherwise never signal
+            if (do_load_order_arrive) {
+              load_order_barrier.arrive();
+              do_load_order_arrive = false;
+            }
             auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
-            work_tile_info = next_work_tile_info;   
+            work_tile_info = next_work_tile_info;
             continue;
           }
 
           // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
           auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
           auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-          auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+          auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
           auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
           // Get the number of K tiles to compute for this work as well as the starting K tile offset of the work.
@@ -662,6 +755,9 @@ public:
           }
         } // Scheduler work fetch loop
 
+        // Release dependent grids here if requested, the last mainloop load has been issued
+        cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
@@ -678,7 +774,7 @@ public:
             // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
             auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
             auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-            auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+            auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
             auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
             // Get the number of K tiles to compute for this work as well as the starting K tile offset of the work.
@@ -731,7 +827,7 @@ public:
             // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
             auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
             auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-            auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+            auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
             auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
             
             epi_load_pipe_producer_state =
@@ -778,7 +874,7 @@ public:
         // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
         auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
         auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-        auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+        auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
         auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
         auto work_k_tile_count = TileScheduler::get_work_k_tile_count(work_tile_info, problem_shape_MNKL, blk_shape);
         // Allocate the accumulators for the (M,N) blk_shape
@@ -826,7 +922,7 @@ public:
             // Hint on an early release of global memory resources.
             // The timing of calling this function only influences performance,
             // not functional correctness.
-            cutlass::arch::launch_dependent_grids();
+            cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
           }
         }
@@ -835,8 +931,13 @@ public:
         int consumer_warp_group_idx = canonical_warp_group_idx() - NumLoadWarpGroups;
 
         // Perform reduction across splits, if needed
-        TileScheduler::fixup(
-          params.scheduler, work_tile_info, accumulators, NumMmaWarpGroups, consumer_warp_group_idx);
+        if constexpr (IsSchedClusterSplitK) {
+          scheduler.template fixup<NumMMAThreads>(work_tile_info, accumulators, mma_thread_idx);
+        }
+        else {
+          TileScheduler::fixup(
+            params.scheduler, work_tile_info, accumulators, NumMmaWarpGroups, consumer_warp_group_idx);
+        }
 
         if (TileScheduler::compute_epilogue(work_tile_info, params.scheduler)) {
           // Epilogue and write to gD
@@ -873,6 +974,9 @@ public:
         }
       } // Scheduler work fetch loop
 
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+
       if (do_store_tail) {
         collective_epilogue.store_tail(
           epi_load_pipeline,
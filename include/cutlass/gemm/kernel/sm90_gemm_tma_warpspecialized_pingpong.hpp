@@ -43,6 +43,7 @@
 #include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
 #include "cutlass/gemm/kernel/tile_scheduler.hpp"
 #include "cutlass/gemm/kernel/gemm_universal_decl.h"
+#include "cutlass/conv/detail.hpp"
 #include "cutlass/pipeline/pipeline.hpp"
 #include "cutlass/trace.h"
 
@@ -73,7 +74,8 @@ public:
   // Type Aliases
   //
   using ProblemShape = ProblemShape_;
-  static_assert(cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
+  static constexpr bool IsConvProblemShape = not (cute::is_tuple_v<ProblemShape> || IsCutlass3ArrayKernel<ProblemShape>::value);
+  static_assert(IsConvProblemShape || cute::rank(ProblemShape{}) == 3 or cute::rank(ProblemShape{}) == 4,
     "ProblemShape{} should be <M,N,K> or <M,N,K,L>");
   static constexpr bool IsGdcEnabled = cutlass::arch::IsGdcGloballyEnabled;
 
@@ -123,13 +125,18 @@ public:
   using TileSchedulerThrottlePipelineState = typename TileSchedulerThrottlePipeline::PipelineState;
 
   static constexpr bool IsSchedDynamicPersistent = TileScheduler::IsDynamicPersistent;
+  // Walks the output slices of a convolution inside every CTA
+  static constexpr bool IsSchedTemporalStreaming = cute::is_same_v<TileSchedulerTag, TemporalStreamingScheduler>;
+  // The consumers skip the K tiles of the other warp group's tile, so all tiles must cover the same K tiles
+  static_assert(not detail::is_k_range_restricted_scheduler_v<TileSchedulerTag>,
+    "The ping-pong kernel does not support schedulers that restrict the K range of a tile.");
 
   // Warp specialization thread count per threadblock
   static constexpr uint32_t NumSchedThreads        = NumThreadsPerWarp;      // 1 warp
   static constexpr uint32_t NumMainloopLoadThreads = NumThreadsPerWarp;      // 1 warp
   static constexpr uint32_t NumEpilogueLoadThreads = NumThreadsPerWarp;      // 1 warp for C
   static constexpr uint32_t NumLoadWarpGroups = 1;
-  static constexpr uint32_t NumMmaWarpGroups = 2;
+  static constexpr uint32_t NumMmaWarpGroups = detail::PingpongNumMmaWarpGroups_v<typename DispatchPolicy::Schedule>;
   static constexpr uint32_t NumProducerThreads = CollectiveMainloop::NumProducerThreadEvents;
   static constexpr uint32_t NumMMAThreads = size(TiledMma{});                 // 4 warp 
   static constexpr uint32_t MaxThreadsPerBlock = NumMMAThreads * NumMmaWarpGroups + (NumLoadWarpGroups * NumThreadsPerWarpGroup);
@@ -137,7 +144,11 @@ public:
   static constexpr bool     IsMainloopAuxiliaryLoadNeeded = detail::HasAuxiliaryLoad_v<typename CollectiveMainloop::DispatchPolicy>;
   
   static_assert(NumMMAThreads == 128, "Pingpong kernel must have TiledMMA operating using 128 threads.");
-  static_assert(MaxThreadsPerBlock == 384, "Pingpong kernel must have 384 threads in total.");
+  static_assert(NumMmaWarpGroups == 2 || NumMmaWarpGroups == 3, "Pingpong kernel supports two or three math warp groups.");
+  static_assert(MaxThreadsPerBlock == NumThreadsPerWarpGroup * (NumMmaWarpGroups + 1),
+    "Pingpong kernel must have one producer and NumMmaWarpGroups math warp groups.");
+  static_assert(!IsSchedDynamicPersistent || NumMmaWarpGroups == 2,
+    "Dynamic persistent schedulers only support two math warp groups in the ping-pong kernel.");
 
   /// Register requirement for Load and Math WGs
   static constexpr int RegsPerThread =
@@ -145,7 +156,12 @@ public:
     / (NumMMAThreads * sizeof(uint32_t));
   static constexpr bool HeavyRegisterPressure = RegsPerThread >= 208;
   static constexpr uint32_t LoadRegisterRequirement = !HeavyRegisterPressure ? 40 : 24;
-  static constexpr uint32_t MmaRegisterRequirement = !HeavyRegisterPressure ? 232 : 240;
+  // Split what the producer leaves of the 64K register file between the math warp groups,
+  // in multiples of 8 and at most 240 (232 / 240 for two groups, 152 / 160 for three)
+  static constexpr uint32_t MmaRegisterRequirement = cute::min(240u,
+    (65536u - LoadRegisterRequirement * NumThreadsPerWarpGroup) / (NumMmaWarpGroups * NumThreadsPerWarpGroup) / 8u * 8u);
+  static_assert(NumMmaWarpGroups == 2 || RegsPerThread <= 96,
+    "Accumulators of the tile do not fit the registers of three math warp groups, use a smaller tile.");
 
   static constexpr bool IsSm120Family = cute::is_same_v<typename DispatchPolicy::ArchTag, arch::Sm120>;
 
@@ -195,12 +211,48 @@ public:
     EpilogueArguments epilogue{};
     KernelHardwareInfo hw_info{};
     TileSchedulerArguments scheduler{};
+
+    // Default constructor
+    Arguments() = default;
+
+    // Constructor with specified mode
+    // It is used for Gemm
+    Arguments(
+        GemmUniversalMode mode_,
+        ProblemShape problem_shape_,
+        MainloopArguments mainloop_,
+        EpilogueArguments epilogue_,
+        KernelHardwareInfo hw_info_ = KernelHardwareInfo(),
+        TileSchedulerArguments scheduler_ = TileSchedulerArguments())
+    : mode(mode_)
+      , problem_shape(problem_shape_)
+      , mainloop(mainloop_)
+      , epilogue(epilogue_)
+      , hw_info(hw_info_)
+      , scheduler(scheduler_) {}
+
+    // Constructor with default value for 'mode'
+    // This allows us to set GemmUniversal mode as kGemm for Conv right away
+    // while keeping the testbeds unchanged
+    Arguments(
+        ProblemShape problem_shape_,
+        MainloopArguments mainloop_,
+        EpilogueArguments epilogue_,
+        KernelHardwareInfo hw_info_ = KernelHardwareInfo(),
+        TileSchedulerArguments scheduler_ = TileSchedulerArguments())
+    : mode(GemmUniversalMode::kGemm) // Default mode
+      , problem_shape(problem_shape_)
+      , mainloop(mainloop_)
+      , epilogue(epilogue_)
+      , hw_info(hw_info_)
+      , scheduler(scheduler_) {}
   };
 
   // Kernel entry point API
   struct Params {
+    using ProblemShapeMNKL = decltype(cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(ProblemShape{}, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{}));
     GemmUniversalMode mode{};
-    ProblemShape problem_shape{};
+    ProblemShapeMNKL problem_shape{};
     MainloopParams mainloop{};
     EpilogueParams epilogue{};
     KernelHardwareInfo hw_info{};
@@ -217,11 +269,15 @@ public:
   to_underlying_arguments(Arguments const& args, void* workspace) {
     CUTLASS_TRACE_HOST("to_underlying_arguments():");
 
-    auto problem_shape = args.problem_shape;
+    // Convolutions are scheduled over their linearized (M,N,K,L) GEMM view
+    auto problem_shape_mnkl = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{});
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
+
+    auto problem_shape = problem_shape_mnkl;
     if constexpr (detail::Has_SwapAB_v<CollectiveMainloop>) {
       // swap M/N
-      get<0>(problem_shape) = get<1>(args.problem_shape);
-      get<1>(problem_shape) = get<0>(args.problem_shape);
+      get<0>(problem_shape) = get<1>(problem_shape_mnkl);
+      get<1>(problem_shape) = get<0>(problem_shape_mnkl);
     }
     auto problem_shape_MNKL = append<4>(problem_shape, 1);
 
@@ -254,25 +310,32 @@ public:
     size_t workspace_offset = 0;
 
     void* epilogue_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(transformed_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* scheduler_workspace = workspace_ptr + workspace_offset;
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+    workspace_offset += TileScheduler::template get_workspace_size<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
 
     void* mainloop_workspace = nullptr;
     constexpr uint32_t NumEpilogueSubTiles = CollectiveEpilogue::get_store_pipe_increment(TileShape{});
+    // Convolutions tell the temporal streaming scheduler the extent of an output slice in M
+    TileSchedulerArguments scheduler_args = args.scheduler;
+    if constexpr (IsSchedTemporalStreaming) {
+      if (scheduler_args.slice_extent_m == 0) {
+        scheduler_args.slice_extent_m = cutlass::conv::detail::get_output_slice_extent_M(args.problem_shape);
+      }
+    }
 
     return {
       args.mode,
       problem_shape,
       CollectiveMainloop::to_underlying_arguments(args.problem_shape, args.mainloop, mainloop_workspace),
-      CollectiveEpilogue::to_underlying_arguments(args.problem_shape, args.epilogue, epilogue_workspace),
+      CollectiveEpilogue::to_underlying_arguments(transformed_problem_shape, args.epilogue, epilogue_workspace),
       hw_info,
       TileScheduler::to_underlying_arguments(
-        problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, args.scheduler, scheduler_workspace, NumEpilogueSubTiles
+        problem_shape_MNKL, TileShape{}, ClusterShape{}, hw_info, scheduler_args, scheduler_workspace, NumEpilogueSubTiles
       )
     };
   }
@@ -285,8 +348,9 @@ public:
       CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Arguments or Problem Shape don't meet the requirements.\n");
       return implementable;
     }
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
     implementable &= CollectiveMainloop::can_implement(args.problem_shape, args.mainloop);
-    implementable &= CollectiveEpilogue::can_implement(args.problem_shape, args.epilogue);
+    implementable &= CollectiveEpilogue::can_implement(transformed_problem_shape, args.epilogue);
     implementable &= TileScheduler::can_implement(args.scheduler, args.hw_info);
 
     return implementable;
@@ -295,12 +359,14 @@ public:
   static size_t
   get_workspace_size(Arguments const& args) {
     size_t workspace_size = 0;
+    auto problem_shape_mnkl = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{});
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
 
-    workspace_size += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    workspace_size += CollectiveEpilogue::get_workspace_size(transformed_problem_shape, args.epilogue);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
-    workspace_size += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+    workspace_size += TileScheduler::template get_workspace_size<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups);
     workspace_size = round_nearest(workspace_size,  MinWorkspaceAlignment);
 
     return workspace_size;
@@ -314,18 +380,20 @@ public:
     size_t workspace_offset = 0;
     static constexpr uint32_t NumEpilogueSubTiles = 1;
     static constexpr uint32_t NumAccumulatorMtxs = 1;
+    auto problem_shape_mnkl = cutlass::conv::detail::get_problem_shape_MNKL_helper<CollectiveMainloop>(args.problem_shape, cute::conditional_t<IsConvProblemShape, cute::true_type, cute::false_type>{});
+    auto transformed_problem_shape = cutlass::conv::detail::get_transformed_problem_shape_MNKL(args.problem_shape);
 
-    status = CollectiveEpilogue::initialize_workspace(args.problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
-    workspace_offset += CollectiveEpilogue::get_workspace_size(args.problem_shape, args.epilogue);
+    status = CollectiveEpilogue::initialize_workspace(transformed_problem_shape, args.epilogue, workspace_ptr + workspace_offset, stream, cuda_adapter);
+    workspace_offset += CollectiveEpilogue::get_workspace_size(transformed_problem_shape, args.epilogue);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
     }
 
-    status = TileScheduler::template initialize_workspace<ProblemShape, ElementAccumulator>(
-      args.scheduler, workspace_ptr + workspace_offset, stream, args.problem_shape, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
-    workspace_offset += TileScheduler::template get_workspace_size<ProblemShape, ElementAccumulator>(
-      args.scheduler, args.problem_shape, args.hw_info, NumMmaWarpGroups);
+    status = TileScheduler::template initialize_workspace<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, workspace_ptr + workspace_offset, stream, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups, NumEpilogueSubTiles, NumAccumulatorMtxs, cuda_adapter);
+    workspace_offset += TileScheduler::template get_workspace_size<decltype(problem_shape_mnkl), ElementAccumulator>(
+      args.scheduler, problem_shape_mnkl, args.hw_info, NumMmaWarpGroups);
     workspace_offset = round_nearest(workspace_offset,  MinWorkspaceAlignment);
     if (status != Status::kSuccess) {
       return status;
@@ -368,10 +436,10 @@ public:
 #else
 
     // Preconditions
-    static_assert(cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
-    static_assert(cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideA{}) == 3, "StrideA must be rank-3: [M, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideB{}) == 3, "StrideB must be rank-3: [N, K, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideC{}) == 3, "StrideC must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
+    static_assert(IsConvProblemShape || cute::rank(StrideD{}) == 3, "StrideD must be rank-3: [M, N, L]. If batch mode is not needed, set L stride to Int<0>.");
 
     enum class WarpGroupRole {
       Producer = 0,
@@ -395,6 +463,9 @@ public:
     int warp_group_thread_idx = thread_idx % NumThreadsPerWarpGroup;
     auto warp_group_role = WarpGroupRole(canonical_warp_group_idx());
     auto producer_warp_role = ProducerWarpRole(warp_idx_in_warp_group);
+    // Position of a math warp group in the ping-pong order, negative for the producer warp group
+    int mma_warp_group_idx = canonical_warp_group_idx() - static_cast<int>(WarpGroupRole::Consumer0);
+    bool is_mma_warp_group = mma_warp_group_idx >= 0;
     int lane_predicate = cute::elect_one_sync();
     uint32_t block_rank_in_cluster = cute::block_rank_in_cluster();
 
@@ -456,7 +527,7 @@ public:
         || producer_warp_role == ProducerWarpRole::MainloopAux)) {
       mainloop_pipeline_params.role = MainloopPipeline::ThreadCategory::Producer;
     }
-    if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+    if (is_mma_warp_group) {
       mainloop_pipeline_params.role = MainloopPipeline::ThreadCategory::Consumer;
     }
     mainloop_pipeline_params.is_leader = warp_group_thread_idx == 0;
@@ -471,7 +542,7 @@ public:
     if (warp_group_role == WarpGroupRole::Producer && producer_warp_role == ProducerWarpRole::Epilogue) {
       epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Producer;
     }
-    if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+    if (is_mma_warp_group) {
       epi_load_pipeline_params.role = EpiLoadPipeline::ThreadCategory::Consumer;
     }
     epi_load_pipeline_params.dst_blockid = cute::block_rank_in_cluster();
@@ -495,18 +566,27 @@ public:
 
     typename MathWarpGroupOrderBarrier::Params params_math_wg_order_barrier;
     // DMA Load WG will not participate in these Ordered Barrier syncs
-    params_math_wg_order_barrier.group_id = canonical_warp_group_idx() - static_cast<int>(WarpGroupRole::Consumer0);
+    params_math_wg_order_barrier.group_id = mma_warp_group_idx;
     params_math_wg_order_barrier.group_size = NumThreadsPerWarpGroup; // Number of threads / participants in a group
     MathWarpGroupOrderBarrier math_wg_order_barrier(shared_storage.pipelines.math_wg_order, params_math_wg_order_barrier);
 
     // Initialize starting pipeline states for the collectives
     // Epilogue store pipe is producer-only (consumer is TMA unit, waits via scoreboarding)
-    typename CollectiveMainloop::PipelineState mainloop_pipe_consumer_state;
+    using MainloopPipelineState = typename CollectiveMainloop::PipelineState;
+    MainloopPipelineState mainloop_pipe_consumer_state;
     typename CollectiveEpilogue::LoadPipelineState epi_load_pipe_consumer_state;
 
     // For the DMA Load (producer) we start with an opposite phase
     // i.e., we skip all waits since we know that the buffer is indeed empty
-    PipelineState mainloop_pipe_producer_state = cutlass::make_producer_start_state<MainloopPipeline>();
+    MainloopPipelineState mainloop_pipe_producer_state;
+    if constexpr (MainloopPipelineState::DynamicStages) {
+      // Only cycle through the mainloop stages selected at launch
+      mainloop_pipe_consumer_state = cutlass::make_consumer_start_state<MainloopPipeline>(params.mainloop.active_stages);
+      mainloop_pipe_producer_state = cutlass::make_producer_start_state<MainloopPipeline>(params.mainloop.active_stages);
+    }
+    else {
+      mainloop_pipe_producer_state = cutlass::make_producer_start_state<MainloopPipeline>();
+    }
     PipelineState epi_load_pipe_producer_state = cutlass::make_producer_start_state<EpiLoadPipeline>();
     PipelineState epi_store_pipe_producer_state = cutlass::make_producer_start_state<EpiStorePipeline>();
 
@@ -545,6 +625,18 @@ public:
     Tensor gA_mkl = get<0>(load_inputs);
     Tensor gB_nkl = get<1>(load_inputs);
 
+    // Handles the difference between the rank of Tensor returned by load_input in case they do not have a batch mode
+    auto get_l_coord = [&] (auto const& gB_nkl_, int32_t L_idx) {
+      if constexpr (not IsConvProblemShape) {
+        // This needs to be inside an `if constexpr`,
+        // because shape<4>(gB_nkl) is not well-formed otherwise.
+        return idx2crd(L_idx, shape<4>(gB_nkl_));
+      }
+      else {
+        return Int<0>{};
+      }
+    };
+
     // Get pipeline stage increments from tensor shapes
     auto k_tile_count = size<3>(gA_mkl);
     auto c_tile_count = CollectiveEpilogue::get_load_pipe_increment(blk_shape);
@@ -555,17 +647,17 @@ public:
       scheduler.set_data_ptr(shared_storage.scheduler.data());
     }
 
-    if (warp_group_role == WarpGroupRole::Consumer1) {
+    if (mma_warp_group_idx > 0) {
 
       if constexpr (not IsSchedDynamicPersistent) {
-        // Advance 2nd Math WG to the next work tile for the startup
-        scheduler.advance_to_next_work();
+        // Advance the i-th Math WG to the i-th next work tile for the startup
+        scheduler.advance_to_next_work(mma_warp_group_idx);
       }
 
-      // Advance 2nd Math WG pipeline states to the end of 1st Math WG
-      mainloop_pipe_consumer_state.advance(k_tile_count);
-      epi_load_pipe_consumer_state.advance(c_tile_count);
-      epi_store_pipe_producer_state.advance(d_tile_count);
+      // Advance the i-th Math WG pipeline states past the tiles of the Math WGs before it
+      mainloop_pipe_consumer_state.advance(k_tile_count * mma_warp_group_idx);
+      epi_load_pipe_consumer_state.advance(c_tile_count * mma_warp_group_idx);
+      epi_store_pipe_producer_state.advance(d_tile_count * mma_warp_group_idx);
     }
     auto work_tile_info = scheduler.initial_work_tile_info(ClusterShape{});
 
@@ -632,7 +724,7 @@ public:
           // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
           auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
           auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-          auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+          auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
           auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
           auto k_tile_iter  = cute::make_coord_iterator(shape<3>(gA_mkl));
@@ -682,6 +774,9 @@ public:
           }
         } // Scheduler work fetch loop
 
+        // Release dependent grids here if requested, the last mainloop load has been issued
+        cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
         // Make sure all Consumer Warp Groups have been waited upon
         collective_mainloop.load_tail(mainloop_pipeline, mainloop_pipe_producer_state);
 
@@ -702,7 +797,7 @@ public:
             // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
             auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
             auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-            auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+            auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
             auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
             auto k_tile_iter = cute::make_coord_iterator(shape<3>(gA_mkl));
@@ -756,7 +851,7 @@ public:
           // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
           auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
           auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-          auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+          auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
           auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
           epi_load_pipe_producer_state =
@@ -800,7 +895,7 @@ public:
       } // Epilogue Producer Warp End
     } // Producer Warp Group End
 
-    else if (warp_group_role == WarpGroupRole::Consumer0 || warp_group_role == WarpGroupRole::Consumer1) {
+    else if (is_mma_warp_group) {
       cutlass::arch::warpgroup_reg_alloc<MmaRegisterRequirement>();
 
       if constexpr (!IsSm120Family) {
@@ -840,13 +935,13 @@ public:
         // Compute m_coord, n_coord, l_coord with the post-tiled m-shape and n-shape
         auto m_coord = idx2crd(work_tile_info.M_idx, shape<2>(gA_mkl));
         auto n_coord = idx2crd(work_tile_info.N_idx, shape<2>(gB_nkl));
-        auto l_coord = idx2crd(work_tile_info.L_idx, shape<4>(gB_nkl));
+        auto l_coord = get_l_coord(gB_nkl, work_tile_info.L_idx);
         auto blk_coord = make_coord(m_coord, n_coord, _, l_coord);
 
         // Allocate the accumulators for the (M,N) blk_shape
         Tensor accumulators = partition_fragment_C(tiled_mma, take<0,2>(blk_shape));               // (MMA,MMA_M,MMA_N)
 
-        // Order two Math WG's MMA one after the other, helps hide Epilogue
+        // Order the Math WGs' MMAs one after the other, helps hide Epilogue
         math_wg_order_barrier.wait();
 
         if constexpr (IsSm120Family) {
@@ -890,12 +985,12 @@ public:
             // Hint on an early release of global memory resources.
             // The timing of calling this function only influences performance,
             // not functional correctness.
-            cutlass::arch::launch_dependent_grids();
+            cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
 
           }
         }
 
-        // Order two Math WG's Epilogue one after the other
+        // Order the Math WGs' Epilogues one after the other
         math_wg_order_barrier.wait();
 
         // Epilogue and write to gD
@@ -926,11 +1021,11 @@ public:
         );
 
         // Update starting load/store pipeline states for the next tile
-        // state has already been incremented by 1 tile in collective calls, advance once again for ping pong
+        // state has already been incremented by 1 tile in collective calls, advance past the tiles of the other Math WGs
         epi_load_pipe_consumer_state = epi_load_pipe_consumer_state_next_;
         epi_store_pipe_producer_state = epi_store_pipe_producer_state_next_;
-        epi_load_pipe_consumer_state.advance(c_tile_count);
-        epi_store_pipe_producer_state.advance(d_tile_count);
+        epi_load_pipe_consumer_state.advance(c_tile_count * (NumMmaWarpGroups - 1));
+        epi_store_pipe_producer_state.advance(d_tile_count * (NumMmaWarpGroups - 1));
 
         // Cue for next Math WG's Epilogue to start
         math_wg_order_barrier.arrive();
@@ -953,6 +1048,9 @@ public:
         work_tile_info = scheduler.get_current_work();
         }
       } // Scheduler work fetch loop
+
+      // Release dependent grids here if requested, the last output store of this warp group has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
     } // Consumer Warp Groups End
 #endif
   }
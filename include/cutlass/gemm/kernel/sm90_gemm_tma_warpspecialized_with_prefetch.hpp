@@ -46,8 +46,6 @@
 
 #include "cute/tensor.hpp"
 
-#include "../collective/dispatch_policy_extra.hpp"
-
 ///////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::gemm::kernel {
@@ -292,7 +290,7 @@ public:
     }
     mainloop_pipeline_params.num_consumers = NumThreadsPerWarpGroup;
     MainloopPipeline mainloop_pipeline(shared_storage.pipelines.mainloop, mainloop_pipeline_params, ClusterShape{});
-    bool should_prefetch = params.mainloop.prefetch_ratio > 0;
+    bool should_prefetch = params.mainloop.prefetch_ratio != 0;
     using PrefetcherPipeline = typename CollectiveMainloop::PrefetcherPipeline;
     typename PrefetcherPipeline::Params prefetcher_pipeline_params;
     prefetcher_pipeline_params.num_prefetchers = 1;
@@ -0,0 +1,626 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief GEMV kernel for skinny GEMMs (N <= 16) that streams the weights with TMA and splits K
+    across the CTAs of a cluster.
+
+    D (M x N) = alpha * A (M x K) * B (N x K)^T + beta * C, where A holds the weights (row-major,
+    optionally quantized with one scale per ScaleGranularityK consecutive K elements of a row) and
+    B holds the N activation vectors (K-major). The Splits CTAs of a (1, 1, Splits) cluster compute
+    the partial products of disjoint K ranges of the same M tile, and the first CTA of the cluster
+    reduces the partial sums of its peers through distributed shared memory before the epilogue,
+    so no global workspace or second kernel is involved.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/arch/arch.h"
+#include "cutlass/arch/grid_dependency_control.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/detail/layout.hpp"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+#include "cute/atom/copy_traits_sm90_tma.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ElementA_,                     // Weights
+  class ElementB_,                     // Activations
+  class ElementC_,
+  class ElementD_,
+  class TileShape_,                    // (TileM, TileN, TileK)
+  class ClusterShape_,                 // (1, 1, Splits)
+  int Stages_ = 4,
+  class ElementScale_ = void,          // Scales of the weights, void if A is not scaled
+  int ScaleGranularityK_ = 0,          // Number of consecutive K elements of a row of A sharing a scale
+  class ElementAccumulator_ = float,
+  class ElementCompute_ = float
+>
+class Sm90GemvTmaSplitK {
+public:
+  //
+  // Type Aliases
+  //
+  using ElementA = ElementA_;
+  using ElementB = ElementB_;
+  using ElementC = ElementC_;
+  using ElementD = ElementD_;
+  using ElementScale = ElementScale_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = ElementCompute_;
+  using TileShape = TileShape_;
+  using ClusterShape = ClusterShape_;
+  using ArchTag = arch::Sm90;
+
+  using ProblemShape = cute::Shape<int,int,int,int>;
+  // A is row-major (M,K,L), B is K-major (N,K,L), C and D are column-major (M,N,L)
+  using StrideA = cute::Stride<int64_t, cute::Int<1>, int64_t>;
+  using StrideB = cute::Stride<int64_t, cute::Int<1>, int64_t>;
+  using StrideC = cute::Stride<cute::Int<1>, int64_t, int64_t>;
+  using StrideD = cute::Stride<cute::Int<1>, int64_t, int64_t>;
+  // Scales are M-major (M,ceil(K/ScaleGranularityK),L)
+  using StrideScale = cute::Stride<cute::Int<1>, int64_t, int64_t>;
+
+  static constexpr bool IsScaled = not cute::is_void_v<ElementScale>;
+  using NonVoidElementScale = cute::conditional_t<IsScaled, ElementScale, ElementAccumulator>;
+
+  static constexpr int TileM = cute::size<0>(TileShape{});
+  static constexpr int TileN = cute::size<1>(TileShape{});
+  static constexpr int TileK = cute::size<2>(TileShape{});
+  static constexpr int Splits = cute::size<2>(ClusterShape{});
+  static constexpr int Stages = Stages_;
+
+  static constexpr int NumMathWarps = 4;
+  static constexpr int NumMathThreads = NumMathWarps * NumThreadsPerWarp;
+  static constexpr uint32_t MaxThreadsPerBlock = NumMathThreads + NumThreadsPerWarp;
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  // Each lane of a math warp multiplies ElementsPerLane consecutive K elements of a K tile
+  static constexpr int ElementsPerLane = 8;
+  static constexpr int RowsPerWarp = TileM / NumMathWarps;
+
+  static constexpr int ScaleGranularityK = IsScaled ? ScaleGranularityK_ : TileK;
+  static constexpr int ScaleTileK = cute::max(1, TileK / ScaleGranularityK);
+
+  static_assert(cute::size<0>(ClusterShape{}) == 1 && cute::size<1>(ClusterShape{}) == 1,
+    "The cluster of the GEMV kernel only splits K.");
+  static_assert(Splits <= 8, "Cluster size must not exceed the portable maximum of 8 CTAs.");
+  static_assert(TileK == NumThreadsPerWarp * ElementsPerLane, "TileK must be 256.");
+  static_assert(TileM % NumMathWarps == 0 && TileM % 4 == 0, "TileM must be a multiple of the math warp count.");
+  static_assert(TileN <= 16, "The GEMV kernel supports at most 16 columns.");
+  static_assert(RowsPerWarp * TileN <= 64, "Accumulators of a math warp exceed the register budget.");
+  static_assert(not IsScaled || (ScaleGranularityK % ElementsPerLane == 0 &&
+                                 (TileK % ScaleGranularityK == 0 || ScaleGranularityK % TileK == 0)),
+    "ScaleGranularityK must be a multiple of 8 that divides or is divisible by TileK.");
+  static_assert(not IsScaled || (TileM * sizeof_bits<NonVoidElementScale>::value) % 128 == 0,
+    "A TMA box of scales must span a multiple of 16B along M.");
+
+  // Sub-byte operands are moved by TMA as bytes
+  using TmaElementA = cute::conditional_t<(sizeof_bits<ElementA>::value < 8), uint8_t, ElementA>;
+  using TmaElementB = cute::conditional_t<(sizeof_bits<ElementB>::value < 8), uint8_t, ElementB>;
+
+  // One stage holds a K-major (TileM,TileK) tile of A, a K-major (TileN,TileK) tile of B and the
+  // M-major (TileM,ScaleTileK) scales of the A tile. The rows are read with consecutive lanes
+  // touching consecutive 16B or smaller chunks, which is conflict free without a swizzle.
+  using SmemLayoutA = decltype(cute::make_layout(
+      cute::make_shape(cute::Int<TileM>{}, cute::Int<TileK>{}, cute::Int<Stages>{}),
+      cute::make_stride(cute::Int<TileK>{}, cute::Int<1>{}, cute::Int<TileM * TileK>{})));
+  using SmemLayoutB = decltype(cute::make_layout(
+      cute::make_shape(cute::Int<TileN>{}, cute::Int<TileK>{}, cute::Int<Stages>{}),
+      cute::make_stride(cute::Int<TileK>{}, cute::Int<1>{}, cute::Int<TileN * TileK>{})));
+  using SmemLayoutScale = decltype(cute::make_layout(
+      cute::make_shape(cute::Int<TileM>{}, cute::Int<ScaleTileK>{}, cute::Int<Stages>{}),
+      cute::make_stride(cute::Int<1>{}, cute::Int<TileM>{}, cute::Int<TileM * ScaleTileK>{})));
+
+  static constexpr uint32_t TmaTransactionBytes =
+    cutlass::bits_to_bytes(TileM * TileK * static_cast<uint32_t>(sizeof_bits<ElementA>::value)) +
+    cutlass::bits_to_bytes(TileN * TileK * static_cast<uint32_t>(sizeof_bits<ElementB>::value)) +
+    (IsScaled ? cutlass::bits_to_bytes(TileM * ScaleTileK * static_cast<uint32_t>(sizeof_bits<NonVoidElementScale>::value)) : 0);
+
+  using MainloopPipeline = cutlass::PipelineTmaAsync<Stages>;
+  using PipelineState = cutlass::PipelineState<Stages>;
+
+  using ThreadEpilogueOp = cutlass::epilogue::thread::LinearCombination<
+    ElementD, 4, ElementAccumulator, ElementCompute,
+    cutlass::epilogue::thread::ScaleType::Default, FloatRoundStyle::round_to_nearest, ElementC>;
+
+  struct SharedStorage {
+    struct TensorStorage : cute::aligned_struct<128, cute::_0> {
+      alignas(128) cute::ArrayEngine<ElementA, cute::cosize_v<SmemLayoutA>> smem_A;
+      alignas(128) cute::ArrayEngine<ElementB, cute::cosize_v<SmemLayoutB>> smem_B;
+      alignas(128) cute::ArrayEngine<NonVoidElementScale, IsScaled ? cute::cosize_v<SmemLayoutScale> : 1> smem_scale;
+      // (TileM,TileN) M-major partial sums of this CTA, reduced by the first CTA of the cluster
+      alignas(16) cute::array_aligned<ElementAccumulator, TileM * TileN> partials;
+    } tensors;
+
+    alignas(16) typename MainloopPipeline::SharedStorage pipeline;
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  struct MainloopArguments {
+    ElementA const* ptr_A = nullptr;
+    StrideA dA{};
+    ElementB const* ptr_B = nullptr;
+    StrideB dB{};
+    NonVoidElementScale const* ptr_S = nullptr;
+    StrideScale dS{};
+  };
+
+  struct EpilogueArguments {
+    typename ThreadEpilogueOp::Params thread{};
+    ElementC const* ptr_C = nullptr;
+    StrideC dC{};
+    ElementD* ptr_D = nullptr;
+    StrideD dD{};
+  };
+
+  // Device side arguments
+  struct Arguments {
+    GemmUniversalMode mode{};
+    ProblemShape problem_shape{};
+    MainloopArguments mainloop{};
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    using TMA_A = decltype(cute::make_tma_copy<TmaElementA>(
+        cute::SM90_TMA_LOAD{},
+        cute::make_tensor(cute::recast_ptr<ElementA const>(static_cast<ElementA const*>(nullptr)),
+          cute::repeat_like(StrideA{}, int32_t(0)), StrideA{}),
+        SmemLayoutA{}(cute::_,cute::_,cute::Int<0>{}),
+        cute::make_shape(cute::Int<TileM>{}, cute::Int<TileK>{}),
+        cute::_1{}));
+    using TMA_B = decltype(cute::make_tma_copy<TmaElementB>(
+        cute::SM90_TMA_LOAD{},
+        cute::make_tensor(cute::recast_ptr<ElementB const>(static_cast<ElementB const*>(nullptr)),
+          cute::repeat_like(StrideB{}, int32_t(0)), StrideB{}),
+        SmemLayoutB{}(cute::_,cute::_,cute::Int<0>{}),
+        cute::make_shape(cute::Int<TileN>{}, cute::Int<TileK>{}),
+        cute::_1{}));
+    using TMA_Scale = decltype(cute::make_tma_copy<NonVoidElementScale>(
+        cute::SM90_TMA_LOAD{},
+        cute::make_tensor(cute::recast_ptr<NonVoidElementScale const>(static_cast<NonVoidElementScale const*>(nullptr)),
+          cute::repeat_like(StrideScale{}, int32_t(0)), StrideScale{}),
+        SmemLayoutScale{}(cute::_,cute::_,cute::Int<0>{}),
+        cute::make_shape(cute::Int<TileM>{}, cute::Int<ScaleTileK>{}),
+        cute::_1{}));
+
+    ProblemShape problem_shape{};
+    TMA_A tma_load_a;
+    TMA_B tma_load_b;
+    TMA_Scale tma_load_scale;
+    EpilogueArguments epilogue{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  //
+  // Methods
+  //
+
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    using namespace cute;
+    (void) workspace;
+
+    auto [M, N, K, L] = args.problem_shape;
+
+    Tensor tensor_a = make_tensor(cute::recast_ptr<ElementA const>(args.mainloop.ptr_A),
+                                  make_layout(make_shape(M,K,L), args.mainloop.dA));
+    Tensor tensor_b = make_tensor(cute::recast_ptr<ElementB const>(args.mainloop.ptr_B),
+                                  make_layout(make_shape(N,K,L), args.mainloop.dB));
+    typename Params::TMA_A tma_load_a = cute::make_tma_copy<TmaElementA>(
+        SM90_TMA_LOAD{}, tensor_a, SmemLayoutA{}(_,_,Int<0>{}), make_shape(Int<TileM>{}, Int<TileK>{}), _1{});
+    typename Params::TMA_B tma_load_b = cute::make_tma_copy<TmaElementB>(
+        SM90_TMA_LOAD{}, tensor_b, SmemLayoutB{}(_,_,Int<0>{}), make_shape(Int<TileN>{}, Int<TileK>{}), _1{});
+
+    typename Params::TMA_Scale tma_load_scale{};
+    if constexpr (IsScaled) {
+      int scale_k = cute::ceil_div(K, ScaleGranularityK);
+      Tensor tensor_scale = make_tensor(cute::recast_ptr<NonVoidElementScale const>(args.mainloop.ptr_S),
+                                        make_layout(make_shape(M,scale_k,L), args.mainloop.dS));
+      tma_load_scale = cute::make_tma_copy<NonVoidElementScale>(
+          SM90_TMA_LOAD{}, tensor_scale, SmemLayoutScale{}(_,_,Int<0>{}), make_shape(Int<TileM>{}, Int<ScaleTileK>{}), _1{});
+    }
+
+    return {
+      args.problem_shape,
+      tma_load_a,
+      tma_load_b,
+      tma_load_scale,
+      args.epilogue,
+      args.hw_info
+    };
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    auto [M, N, K, L] = args.problem_shape;
+
+    bool implementable = M > 0 && N > 0 && K > 0 && L > 0;
+    if (N > TileN) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: N exceeds the tile N of the GEMV kernel.\n");
+      return false;
+    }
+
+    constexpr int tma_alignment_bits = 128;
+    constexpr int min_tma_aligned_elements_A = tma_alignment_bits / cutlass::sizeof_bits<ElementA>::value;
+    constexpr int min_tma_aligned_elements_B = tma_alignment_bits / cutlass::sizeof_bits<ElementB>::value;
+    implementable &= cutlass::detail::check_alignment<min_tma_aligned_elements_A>(cute::make_shape(M,K,L), StrideA{});
+    implementable &= cutlass::detail::check_alignment<min_tma_aligned_elements_B>(cute::make_shape(N,K,L), StrideB{});
+    if constexpr (IsScaled) {
+      constexpr int min_tma_aligned_elements_S = tma_alignment_bits / cutlass::sizeof_bits<NonVoidElementScale>::value;
+      int scale_k = cute::ceil_div(K, ScaleGranularityK);
+      implementable &= cutlass::detail::check_alignment<min_tma_aligned_elements_S>(cute::make_shape(M,scale_k,L), StrideScale{});
+      implementable &= args.mainloop.ptr_S != nullptr;
+    }
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Problem Size doesn't meet the minimum alignment requirements for TMA.\n");
+    }
+
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  // One cluster of Splits CTAs along z per M tile and batch
+  static dim3
+  get_grid_shape(Params const& params) {
+    auto [M, N, K, L] = params.problem_shape;
+    return dim3(cute::ceil_div(M, TileM), 1, Splits * L);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+    using X = Underscore;
+
+#if ! defined(CUTE_ARCH_TMA_SM90_ENABLED)
+    CUTE_INVALID_CONTROL_PATH("ERROR : The TMA GEMV kernel requires sm90 or newer. Aborting.\n");
+#else
+
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int thread_idx = int(threadIdx.x);
+    int lane_idx = canonical_lane_idx();
+    int warp_idx = canonical_warp_idx_sync();
+    int lane_predicate = cute::elect_one_sync();
+    // The math warps come first so that they form the first warp group of the CTA
+    bool is_producer_warp = warp_idx == NumMathWarps;
+
+    auto [M, N, K, L] = params.problem_shape;
+    int split_idx = int(cute::block_rank_in_cluster());
+    int m_coord = int(blockIdx.x);
+    int l_coord = int(blockIdx.z) / Splits;
+
+    int k_tile_count = cute::ceil_div(K, TileK);
+    int k_tile_begin = split_idx * k_tile_count / Splits;
+    int k_tile_end = (split_idx + 1) * k_tile_count / Splits;
+
+    // Issue Tma Descriptor Prefetch from a single thread
+    if (is_producer_warp && lane_predicate) {
+      cute::prefetch_tma_descriptor(params.tma_load_a.get_tma_descriptor());
+      cute::prefetch_tma_descriptor(params.tma_load_b.get_tma_descriptor());
+      if constexpr (IsScaled) {
+        cute::prefetch_tma_descriptor(params.tma_load_scale.get_tma_descriptor());
+      }
+    }
+
+    typename MainloopPipeline::Params pipeline_params;
+    pipeline_params.role = is_producer_warp ? MainloopPipeline::ThreadCategory::Producer
+                                            : MainloopPipeline::ThreadCategory::Consumer;
+    pipeline_params.is_leader = thread_idx == NumMathThreads;
+    pipeline_params.num_consumers = NumMathThreads;
+    pipeline_params.transaction_bytes = TmaTransactionBytes;
+    MainloopPipeline pipeline(shared_storage.pipeline, pipeline_params, ClusterShape{});
+
+    // We need this to guarantee that the Pipeline init is visible
+    // To all producers and consumer thread blocks in the Cluster
+    if constexpr (Splits > 1) {
+      cute::cluster_arrive_relaxed();
+      cute::cluster_wait();
+    }
+    else {
+      __syncthreads();
+    }
+
+    // Ensure that the prefetched kernel does not touch
+    // unflushed global memory prior to this instruction
+    cutlass::arch::wait_on_dependent_grids();
+
+    if (is_producer_warp) {
+      if (lane_predicate) {
+        Tensor mA_mkl = params.tma_load_a.get_tma_tensor(make_shape(M,K,L));          // (m,k,l)
+        Tensor mB_nkl = params.tma_load_b.get_tma_tensor(make_shape(N,K,L));          // (n,k,l)
+        Tensor gA_mkl = local_tile(mA_mkl, TileShape{}, make_coord(_,_,_), Step<_1, X,_1>{}); // (BLK_M,BLK_K,m,k,l)
+        Tensor gB_nkl = local_tile(mB_nkl, TileShape{}, make_coord(_,_,_), Step< X,_1,_1>{}); // (BLK_N,BLK_K,n,k,l)
+
+        Tensor sA = make_tensor(make_smem_ptr(shared_storage.tensors.smem_A.begin()), SmemLayoutA{}); // (BLK_M,BLK_K,PIPE)
+        Tensor sB = make_tensor(make_smem_ptr(shared_storage.tensors.smem_B.begin()), SmemLayoutB{}); // (BLK_N,BLK_K,PIPE)
+
+        auto [tAgA, tAsA] = tma_partition(params.tma_load_a, Int<0>{}, Layout<_1>{},
+                                          group_modes<0,2>(sA), group_modes<0,2>(gA_mkl));
+        auto [tBgB, tBsB] = tma_partition(params.tma_load_b, Int<0>{}, Layout<_1>{},
+                                          group_modes<0,2>(sB), group_modes<0,2>(gB_nkl));
+
+        Tensor mS_mkl = params.tma_load_scale.get_tma_tensor(make_shape(M,cute::ceil_div(K, ScaleGranularityK),L)); // (m,k,l)
+        Tensor gS_mkl = local_tile(mS_mkl, make_shape(Int<TileM>{}, Int<ScaleTileK>{}), make_coord(_,_)); // (BLK_M,BLK_K,m,k,l)
+        Tensor sS = make_tensor(make_smem_ptr(shared_storage.tensors.smem_scale.begin()), SmemLayoutScale{}); // (BLK_M,BLK_K,PIPE)
+        auto [tSgS, tSsS] = tma_partition(params.tma_load_scale, Int<0>{}, Layout<_1>{},
+                                          group_modes<0,2>(sS), group_modes<0,2>(gS_mkl));
+
+        PipelineState write_state = cutlass::make_producer_start_state<MainloopPipeline>();
+        for (int k_tile = k_tile_begin; k_tile < k_tile_end; ++k_tile) {
+          pipeline.producer_acquire(write_state);
+          using BarrierType = typename MainloopPipeline::ProducerBarrierType;
+          BarrierType* tma_barrier = pipeline.producer_get_barrier(write_state);
+          int write_stage = write_state.index();
+
+          // The weights are read exactly once, the activations are shared by all CTAs
+          copy(params.tma_load_a.with(*tma_barrier, 0, TMA::CacheHintSm90::EVICT_FIRST),
+               tAgA(_,m_coord,k_tile,l_coord), tAsA(_,write_stage));
+          copy(params.tma_load_b.with(*tma_barrier), tBgB(_,0,k_tile,l_coord), tBsB(_,write_stage));
+          if constexpr (IsScaled) {
+            int scale_k_tile = k_tile * TileK / (ScaleGranularityK * ScaleTileK);
+            copy(params.tma_load_scale.with(*tma_barrier, 0, TMA::CacheHintSm90::EVICT_FIRST),
+                 tSgS(_,m_coord,scale_k_tile,l_coord), tSsS(_,write_stage));
+          }
+          ++write_state;
+        }
+
+        // Release dependent grids here if requested, the last mainloop load has been issued
+        cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopLoadDone);
+
+        // Make sure all consumers have released the buffers before the producer exits
+        pipeline.producer_tail(write_state);
+      }
+    }
+    else {
+      using FragmentA = Array<ElementA, ElementsPerLane>;
+      using FragmentB = Array<ElementB, ElementsPerLane>;
+      using FragmentCompute = Array<ElementAccumulator, ElementsPerLane>;
+
+      NumericArrayConverter<ElementAccumulator, ElementA, ElementsPerLane> convert_A;
+      NumericArrayConverter<ElementAccumulator, ElementB, ElementsPerLane> convert_B;
+      [[maybe_unused]] NumericConverter<ElementAccumulator, NonVoidElementScale> convert_scale;
+
+      auto smem_A = reinterpret_cast<uint8_t const*>(raw_pointer_cast(shared_storage.tensors.smem_A.begin()));
+      auto smem_B = reinterpret_cast<uint8_t const*>(raw_pointer_cast(shared_storage.tensors.smem_B.begin()));
+      auto smem_scale = raw_pointer_cast(shared_storage.tensors.smem_scale.begin());
+
+      int first_row = warp_idx * RowsPerWarp;
+      int lane_k = lane_idx * ElementsPerLane;
+      // Index of the scale of this lane's K elements within the scales of a K tile
+      int lane_scale_k = ScaleTileK > 1 ? lane_k / ScaleGranularityK : 0;
+
+      ElementAccumulator accum[RowsPerWarp][TileN];
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < RowsPerWarp; ++r) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < TileN; ++n) {
+          accum[r][n] = ElementAccumulator(0);
+        }
+      }
+
+      PipelineState read_state;
+      for (int k_tile = k_tile_begin; k_tile < k_tile_end; ++k_tile) {
+        pipeline.consumer_wait(read_state);
+        int read_stage = read_state.index();
+
+        // The activations are kept in their storage type and converted for every row
+        FragmentB frag_B[TileN];
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < TileN; ++n) {
+          int offset = (read_stage * TileN + n) * TileK + lane_k;
+          frag_B[n] = *reinterpret_cast<FragmentB const*>(
+            smem_B + cutlass::bits_to_bytes(offset * sizeof_bits<ElementB>::value));
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int r = 0; r < RowsPerWarp; ++r) {
+          int row = first_row + r;
+          int offset = (read_stage * TileM + row) * TileK + lane_k;
+          FragmentCompute a = convert_A(*reinterpret_cast<FragmentA const*>(
+            smem_A + cutlass::bits_to_bytes(offset * sizeof_bits<ElementA>::value)));
+
+          ElementAccumulator scale = ElementAccumulator(1);
+          if constexpr (IsScaled) {
+            scale = convert_scale(smem_scale[(read_stage * ScaleTileK + lane_scale_k) * TileM + row]);
+          }
+
+          CUTLASS_PRAGMA_UNROLL
+          for (int n = 0; n < TileN; ++n) {
+            FragmentCompute b = convert_B(frag_B[n]);
+            ElementAccumulator dot = ElementAccumulator(0);
+            CUTLASS_PRAGMA_UNROLL
+            for (int i = 0; i < ElementsPerLane; ++i) {
+              dot += a[i] * b[i];
+            }
+            accum[r][n] += scale * dot;
+          }
+        }
+
+        pipeline.consumer_release(read_state);
+        ++read_state;
+      }
+
+      // Release dependent grids here if requested, the last FMA of the mainloop has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::MainloopDone);
+
+      // Reduce across the lanes of the warp, which all end up with the sums of the warp's rows
+      CUTLASS_PRAGMA_UNROLL
+      for (int r = 0; r < RowsPerWarp; ++r) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int n = 0; n < TileN; ++n) {
+          ElementAccumulator sum = accum[r][n];
+          CUTLASS_PRAGMA_UNROLL
+          for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+            sum += __shfl_xor_sync(0xffffffff, sum, offset);
+          }
+          // Spread the stores of the warp's partial sums across its lanes
+          if ((r * TileN + n) % NumThreadsPerWarp == lane_idx) {
+            shared_storage.tensors.partials[n * TileM + first_row + r] = sum;
+          }
+        }
+      }
+    }
+
+    // Make the partial sums of all CTAs of the cluster visible to the first CTA
+    if constexpr (Splits > 1) {
+      cute::cluster_sync();
+    }
+    else {
+      __syncthreads();
+    }
+
+    if (split_idx == 0 && not is_producer_warp) {
+      using FragmentAccumulator = typename ThreadEpilogueOp::FragmentAccumulator;
+      using FragmentSource = typename ThreadEpilogueOp::FragmentSource;
+      using FragmentOutput = typename ThreadEpilogueOp::FragmentOutput;
+      constexpr int VectorSize = ThreadEpilogueOp::kCount;
+
+      ThreadEpilogueOp epilogue_op(params.epilogue.thread);
+      bool is_source_needed = epilogue_op.is_source_needed() && params.epilogue.ptr_C != nullptr;
+
+      auto [stride_m_C, stride_n_C, stride_l_C] = params.epilogue.dC;
+      auto [stride_m_D, stride_n_D, stride_l_D] = params.epilogue.dD;
+
+      ElementAccumulator const* partials = shared_storage.tensors.partials.data();
+      uint32_t partials_addr = cute::cast_smem_ptr_to_uint(partials);
+
+      // Consecutive threads handle consecutive M elements of the column-major output
+      for (int v = thread_idx; v < TileM * TileN / VectorSize; v += NumMathThreads) {
+        int idx = v * VectorSize;
+        FragmentAccumulator accum = *reinterpret_cast<FragmentAccumulator const*>(partials + idx);
+        CUTLASS_PRAGMA_UNROLL
+        for (int split = 1; split < Splits; ++split) {
+          FragmentAccumulator peer = load_remote<FragmentAccumulator>(
+            partials_addr + uint32_t(idx * sizeof(ElementAccumulator)), split);
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < VectorSize; ++i) {
+            accum[i] += peer[i];
+          }
+        }
+
+        int m = m_coord * TileM + idx % TileM;
+        int n = idx / TileM;
+        if (n >= N) {
+          continue;
+        }
+
+        FragmentOutput output;
+        if (is_source_needed) {
+          FragmentSource source;
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < VectorSize; ++i) {
+            source[i] = m + i < M
+              ? params.epilogue.ptr_C[(m + i) * stride_m_C + n * stride_n_C + l_coord * stride_l_C]
+              : ElementC(0);
+          }
+          output = epilogue_op(accum, source);
+        }
+        else {
+          output = epilogue_op(accum);
+        }
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < VectorSize; ++i) {
+          if (m + i < M) {
+            params.epilogue.ptr_D[(m + i) * stride_m_D + n * stride_n_D + l_coord * stride_l_D] = output[i];
+          }
+        }
+      }
+
+      // Release dependent grids here if requested, the last output store has been issued
+      cutlass::arch::launch_dependent_grids(params.hw_info.pdl_release_point, PdlReleasePoint::EpilogueStoreIssued);
+    }
+
+    // The peers must not exit before the first CTA has read their partial sums
+    if constexpr (Splits > 1) {
+      cute::cluster_sync();
+    }
+#endif
+  }
+
+private:
+
+  // Loads 16B of the shared memory of the CTA with rank cta_id in the cluster
+  template <class Vector>
+  CUTLASS_DEVICE
+  static Vector
+  load_remote(uint32_t smem_addr, uint32_t cta_id) {
+    static_assert(sizeof(Vector) == sizeof(uint128_t));
+    Vector frag;
+    uint32_t* data = reinterpret_cast<uint32_t*>(&frag);
+    uint32_t remote_addr = cute::set_block_rank(smem_addr, cta_id);
+    asm volatile(
+        "ld.shared::cluster.v4.b32 {%0, %1, %2, %3}, [%4];\n"
+        : "=r"(data[0]), "=r"(data[1]), "=r"(data[2]), "=r"(data[3])
+        : "r"(remote_addr)
+        : "memory");
+    return frag;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
@@ -0,0 +1,474 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/barrier.h"
+#include "cutlass/block_striped.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/workspace.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// A unit of work of a block sparse (BSR) GEMM: a run of consecutive nonzero blocks of one block
+// row of A, which covers all N tiles of that block row. Block rows with more nonzero blocks than
+// fit a unit are split into several units whose partial accumulators are reduced in order.
+struct BlockSparseWorkUnit {
+  // Block row of A, i.e. the M tile of the output
+  int32_t block_row = 0;
+  // Index of the first nonzero block of the unit in the CSR order of the blocks
+  int32_t block_start = 0;
+  int32_t block_count = 0;
+  // Index of the unit among the splits of its block row
+  int32_t split_idx = 0;
+  int32_t split_count = 1;
+  // Index of the block row among the block rows with more than one split, which selects its
+  // partials in the reduction workspace. Unused if split_count == 1.
+  int32_t partial_idx = 0;
+};
+
+// Persistent Thread Block (TB) scheduler for block sparse GEMMs with a BSR A, on the cooperative
+// kernel with the MainloopSm90TmaGmmaWarpSpecializedBlockSparse mainloop.
+//
+// The scheduler hands out (work unit, N tile) pairs from a device array of BlockSparseWorkUnit
+// built on the host from the block row pointers of A (see cutlass/util/block_sparse_work_units.hpp),
+// so only the nonzero blocks are enumerated and block rows without nonzero blocks are never
+// scheduled: their rows of D are left untouched. The N tiles of a unit are adjacent so that its
+// blocks of A are reused from L2. The K tiles of a work tile are the nonzero blocks of its unit,
+// which the mainloop maps to their block columns of B.
+//
+// Splitting long block rows into several units bounds the work of a unit, as stream-K does for
+// dense GEMMs, and ordering the units by decreasing length has the short units fill the tail of
+// the last wave. The splits of an output tile are reduced in a workspace in order of their
+// split_idx, with the last split computing the epilogue, so the result is deterministic. As for
+// stream-K, all CTAs of the grid must be co-resident.
+template <
+  class TileShape,
+  class ClusterShape
+>
+class PersistentTileSchedulerSm90BlockSparse {
+private:
+  using UnderlyingScheduler = PersistentTileSchedulerSm90;
+  using UnderlyingParams = typename UnderlyingScheduler::Params;
+
+public:
+  static_assert(cute::size(ClusterShape{}) == 1,
+    "The block sparse scheduler requires a cluster shape of (1, 1, 1).");
+
+  using WorkUnit = BlockSparseWorkUnit;
+  using RasterOrder = UnderlyingScheduler::RasterOrder;
+  using RasterOrderOptions = UnderlyingScheduler::RasterOrderOptions;
+  static constexpr bool IsDynamicPersistent = false;
+
+  using Pipeline = PipelineEmpty;
+  using PipelineStorage = typename Pipeline::SharedStorage;
+  using ThrottlePipeline = PipelineEmpty;
+  using ThrottlePipelineStorage = typename ThrottlePipeline::SharedStorage;
+  struct CLCResponse {};
+
+  class SharedStorage {
+  public:
+    CUTLASS_DEVICE PipelineStorage pipeline() { return PipelineStorage{}; }
+    CUTLASS_DEVICE ThrottlePipelineStorage throttle_pipeline() { return ThrottlePipelineStorage{}; }
+    CUTLASS_DEVICE CLCResponse* data() { return nullptr; }
+  };
+
+  using BarrierType = typename NamedBarrierManager<1>::T;
+
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t L_idx = 0;
+    // First nonzero block and number of nonzero blocks of the work tile
+    int32_t K_idx = 0;
+    uint32_t k_tile_count = 0;
+    int32_t split_idx = 0;
+    int32_t split_count = 1;
+    int32_t partial_idx = 0;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return k_tile_count > 0;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, 0, 0u, 0, 1, 0};
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_final_split(uint32_t) const {
+      return split_idx == split_count - 1;
+    }
+
+    CUTLASS_HOST_DEVICE
+    int32_t
+    reduction_subtile_idx() const {
+      return -1;
+    }
+  };
+
+  struct Arguments {
+    // Device array of the work units
+    WorkUnit const* work_units = nullptr;
+    int32_t num_work_units = 0;
+    // Number of block rows with more than one split, i.e. max(partial_idx) + 1
+    int32_t num_split_rows = 0;
+    // Unused, kept for the launch grid computation of the persistent kernels
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongN;
+  };
+
+  struct Params : UnderlyingParams {
+    WorkUnit const* work_units_ = nullptr;
+    int32_t tiles_n_ = 0;
+    int32_t num_split_rows_ = 0;
+    void* reduction_workspace_ = nullptr;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShapeMNKL>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape,
+      [[maybe_unused]] KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      void* workspace = nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    Params params;
+    params.work_units_ = arguments.work_units;
+    params.tiles_n_ = static_cast<int32_t>(cute::size(cute::ceil_div(cute::get<1>(problem_shape_mnkl), cute::get<1>(tile_shape))));
+    params.num_split_rows_ = arguments.num_split_rows;
+    params.blocks_per_problem_ = uint64_t(arguments.num_work_units) * uint64_t(params.tiles_n_);
+    params.raster_order_ = RasterOrder::AlongN;
+    params.reduction_workspace_ = workspace;
+    return params;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const&) {
+    return args.work_units != nullptr && args.num_work_units > 0 && args.num_split_rows >= 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90BlockSparse() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90BlockSparse(Params const& params_) : scheduler_params(params_) {
+    // MSVC requires protecting use of CUDA-specific nonstandard syntax,
+    // like blockIdx and gridDim, with __CUDA_ARCH__.
+#if defined(__CUDA_ARCH__)
+    current_work_linear_idx_ = uint64_t(blockIdx.x);
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  // Returns the initial work tile info that will be computed over
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(current_work_linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    if (linear_idx >= scheduler_params.blocks_per_problem_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    uint64_t unit_idx = linear_idx / uint64_t(scheduler_params.tiles_n_);
+    int32_t n = static_cast<int32_t>(linear_idx % uint64_t(scheduler_params.tiles_n_));
+    WorkUnit unit = scheduler_params.work_units_[unit_idx];
+    return {
+      unit.block_row,
+      n,
+      0,
+      unit.block_start,
+      static_cast<uint32_t>(unit.block_count),
+      unit.split_idx,
+      unit.split_count,
+      unit.partial_idx
+    };
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo const&, uint32_t advance_count = 1) const {
+    return current_work_linear_idx_ + total_grid_size_ * uint64_t(advance_count) >= scheduler_params.blocks_per_problem_;
+  }
+
+  // Kernel helper function to get next work tile
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+  // Given the inputs, computes the physical grid we should launch: one CTA per work tile,
+  // at most one per SM so that the splits of a block row, which wait on each other, are co-resident
+  template <class ProblemShapeMNKL, class BlockShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+      Params const& params,
+      ProblemShapeMNKL,
+      BlockShape,
+      ClusterShape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size = true) {
+
+    uint64_t ctas = params.blocks_per_problem_;
+    if (hw_info.sm_count > 0) {
+      ctas = cute::min(ctas, uint64_t(hw_info.sm_count));
+    }
+    return dim3(static_cast<uint32_t>(cute::max(ctas, uint64_t(1))), 1, 1);
+  }
+
+  // Only the last split of an output tile computes the epilogue
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info, Params const&) {
+    return work_tile_info.split_idx == work_tile_info.split_count - 1;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info) {
+    return work_tile_info.split_idx == work_tile_info.split_count - 1;
+  }
+
+  // Reduces the accumulators of the splits of an output tile in order of their split_idx: the
+  // first split stores its accumulators to the workspace, the middle splits add theirs to it once
+  // the preceding split has arrived, and the last split adds the reduced partials to its
+  // accumulators.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(
+      Params const& params,
+      WorkTileInfo const& work_tile_info,
+      FrgTensorC& accumulators,
+      uint32_t num_barriers,
+      uint32_t barrier_idx) {
+    static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+    static constexpr uint32_t MaxNumNamedBarriers = 2;
+    using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, MaxNumNamedBarriers>;
+
+    if (work_tile_info.split_count <= 1) {
+      return;
+    }
+
+    using ElementAccumulator = typename FrgTensorC::value_type;
+    using AccumulatorArrayT = Array<ElementAccumulator, size(FrgTensorC{})>;
+    using BlockStripedReduceT = BlockStripedReduce<BarrierManager::ThreadCount, AccumulatorArrayT>;
+
+    uint64_t tile_idx = uint64_t(work_tile_info.partial_idx) * uint64_t(params.tiles_n_) + uint64_t(work_tile_info.N_idx);
+    uint64_t lock_idx = (tile_idx * num_barriers) + barrier_idx;
+
+    // Each warp group reduces its own slice of the tile
+    uint64_t reduction_offset =
+      static_cast<uint64_t>(cute::size<0>(TileShape{})) * static_cast<uint64_t>(cute::size<1>(TileShape{})) * tile_idx +
+      static_cast<uint64_t>(size(accumulators)) * barrier_idx * BarrierManager::ThreadCount;
+
+    AccumulatorArrayT* reduction_workspace_array = reinterpret_cast<AccumulatorArrayT*>(
+      reinterpret_cast<ElementAccumulator*>(params.reduction_workspace_) + reduction_offset);
+    AccumulatorArrayT* accumulator_array = reinterpret_cast<AccumulatorArrayT*>(accumulators.data());
+    size_t reduction_workspace_size = get_reduction_workspace_size<ElementAccumulator>(
+      uint64_t(params.num_split_rows_) * uint64_t(params.tiles_n_));
+    BarrierType* lock_workspace = reinterpret_cast<BarrierType*>(
+      reinterpret_cast<uint8_t*>(params.reduction_workspace_) + reduction_workspace_size);
+
+    uint32_t barrier_group_thread_idx = threadIdx.x % BarrierManager::ThreadCount;
+
+    if (work_tile_info.split_idx == 0) {
+      BlockStripedReduceT::store(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, 1);
+    }
+    else if (!compute_epilogue(work_tile_info, params)) {
+      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.split_idx);
+      BlockStripedReduceT::reduce(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, 1);
+    }
+    else {
+      // Leaves the lock cleared, as initialize_workspace found it
+      BarrierManager::wait_eq_reset(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.split_idx);
+      BlockStripedReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+    }
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  // The K tiles of a work tile are the nonzero blocks of its unit
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape, TileShape) {
+    return static_cast<int>(work_tile_info.k_tile_count);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return static_cast<uint32_t>(work_tile_info.K_idx);
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const&) {
+    return true;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const&) {
+    return false;
+  }
+
+  // Partials of one output tile per split block row and N tile, followed by one lock per tile
+  // and MMA warp group
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(
+      Arguments const& args,
+      ProblemShape problem_shape,
+      KernelHardwareInfo const&,
+      uint32_t mma_warp_groups,
+      const uint32_t = 1,
+      uint32_t = 1) {
+    auto problem_shape_mnkl = cute::append<4>(problem_shape, 1);
+    uint64_t tiles_n = uint64_t(cute::size(cute::ceil_div(cute::get<1>(problem_shape_mnkl), cute::get<1>(TileShape{}))));
+    uint64_t reduction_tiles = uint64_t(args.num_split_rows) * tiles_n;
+    if (reduction_tiles == 0) {
+      return 0;
+    }
+    return get_reduction_workspace_size<ElementAccumulator>(reduction_tiles) +
+      round_up_to_l2_alignment(reduction_tiles * mma_warp_groups * sizeof(BarrierType));
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(
+      Arguments const& args,
+      void* workspace,
+      cudaStream_t stream,
+      ProblemShape problem_shape,
+      KernelHardwareInfo const& hw_info,
+      uint32_t mma_warp_groups,
+      const uint32_t = 1,
+      uint32_t = 1,
+      CudaHostAdapter* cuda_adapter = nullptr) {
+    size_t workspace_size = get_workspace_size<ProblemShape, ElementAccumulator>(args, problem_shape, hw_info, mma_warp_groups);
+    if (workspace_size == 0) {
+      return Status::kSuccess;
+    }
+    // Only the locks need clearing, the first split of a tile overwrites its partials
+    auto problem_shape_mnkl = cute::append<4>(problem_shape, 1);
+    uint64_t tiles_n = uint64_t(cute::size(cute::ceil_div(cute::get<1>(problem_shape_mnkl), cute::get<1>(TileShape{}))));
+    size_t reduction_size = get_reduction_workspace_size<ElementAccumulator>(uint64_t(args.num_split_rows) * tiles_n);
+    return zero_workspace(static_cast<uint8_t*>(workspace) + reduction_size, workspace_size - reduction_size, stream, cuda_adapter);
+  }
+
+private:
+  template <class ElementAccumulator>
+  CUTLASS_HOST_DEVICE
+  static size_t
+  get_reduction_workspace_size(uint64_t reduction_tiles) {
+    return round_up_to_l2_alignment(
+      reduction_tiles * cute::size<0>(TileShape{}) * cute::size<1>(TileShape{}) * sizeof(ElementAccumulator));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static size_t
+  round_up_to_l2_alignment(size_t size) {
+    constexpr size_t L2Alignment = 128;
+    return (size + L2Alignment - 1) / L2Alignment * L2Alignment;
+  }
+
+public:
+  // Sink scheduler params as a member
+  Params scheduler_params;
+
+private:
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
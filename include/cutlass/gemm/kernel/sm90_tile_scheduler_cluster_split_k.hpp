@@ -0,0 +1,596 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#pragma once
+
+#include "cutlass/arch/barrier.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler splitting the K mode of every output tile across the CTAs
+// of a cluster of shape (1, 1, Splits). All CTAs of a cluster compute the same output tile, each over
+// its own contiguous range of K tiles, and the partial accumulators are reduced into the CTA of
+// split 0 through distributed shared memory, which then runs the epilogue. In contrast to
+// DecompositionMode::SplitK of the stream-K scheduler, no global workspace and no separate
+// reduction are needed.
+//
+// The partials are exchanged in chunks of ReductionBufferBytes through the shared storage of the
+// scheduler, which kernels using this scheduler must account for in their shared memory carveout.
+template <
+  class TileShape,
+  class ClusterShape
+>
+class PersistentTileSchedulerSm90ClusterSplitK {
+private:
+  using UnderlyingScheduler = PersistentTileSchedulerSm90;
+  using UnderlyingParams = typename UnderlyingScheduler::Params;
+
+public:
+  static constexpr int Splits = cute::size<2>(ClusterShape{});
+  static_assert(cute::size<0>(ClusterShape{}) == 1 && cute::size<1>(ClusterShape{}) == 1,
+    "The cluster split-K scheduler requires a cluster shape of (1, 1, Splits).");
+  static_assert(Splits >= 2 && Splits <= 8,
+    "The cluster split-K scheduler supports between 2 and 8 splits.");
+
+  // Size of the buffer through which a CTA shares its partial accumulators
+  static constexpr int ReductionBufferBytes = 16 * 1024;
+
+  using RasterOrder = UnderlyingScheduler::RasterOrder;
+  using RasterOrderOptions = UnderlyingScheduler::RasterOrderOptions;
+  static constexpr bool IsDynamicPersistent = false;
+
+  using Pipeline = PipelineEmpty;
+  using PipelineStorage = typename Pipeline::SharedStorage;
+  using ThrottlePipeline = PipelineEmpty;
+  using ThrottlePipelineStorage = typename ThrottlePipeline::SharedStorage;
+  struct CLCResponse {};
+
+  class SharedStorage {
+  public:
+    CUTLASS_DEVICE PipelineStorage pipeline() { return PipelineStorage{}; }
+    CUTLASS_DEVICE ThrottlePipelineStorage throttle_pipeline() { return ThrottlePipelineStorage{}; }
+    CUTLASS_DEVICE SharedStorage* data() { return this; }
+
+    alignas(16) uint128_t reduction_buffer[ReductionBufferBytes / sizeof(uint128_t)];
+    // Signaled by split s once its chunk is in its reduction buffer, only used in split 0
+    arch::ClusterBarrier full_barrier[Splits];
+    // Signaled by split 0 once it has read the chunk of this split
+    arch::ClusterBarrier empty_barrier;
+  };
+
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t L_idx = 0;
+    // Starting K tile and number of K tiles of the split of this CTA
+    uint32_t K_idx = 0;
+    uint32_t k_tile_count = 0;
+    int32_t split_idx = 0;
+    bool is_valid_tile = false;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, 0, 0, 0, false};
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_final_split(uint32_t) const {
+      return split_idx == 0;
+    }
+
+    CUTLASS_HOST_DEVICE
+    int32_t
+    reduction_subtile_idx() const {
+      return -1;
+    }
+  };
+
+  struct Arguments {
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+  };
+
+  struct Params : UnderlyingParams {
+    uint32_t k_tiles_per_output_tile_ = 0;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShapeMNKL>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      [[maybe_unused]] void* workspace = nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      GemmCoord(1, 1, 1),
+      get_hw_info_per_split(hw_info),
+      arguments.max_swizzle_size,
+      arguments.raster_order
+    );
+    params.k_tiles_per_output_tile_ = static_cast<uint32_t>(
+      cute::size(cute::ceil_div(cute::shape<2>(problem_shape_mnkl), cute::shape<2>(tile_shape))));
+    return params;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const&) {
+    return args.max_swizzle_size >= 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90ClusterSplitK() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90ClusterSplitK(Params const& params_) : scheduler_params(params_) {
+    // MSVC requires protecting use of CUDA-specific nonstandard syntax,
+    // like blockIdx and gridDim, with __CUDA_ARCH__.
+#if defined(__CUDA_ARCH__)
+    // All CTAs of a cluster share the linear index of the cluster, gridDim.z are the splits
+    if (params_.raster_order_ == RasterOrder::AlongN) {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    }
+    else {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+    }
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y);
+    split_idx_ = static_cast<int32_t>(cute::block_id_in_cluster().z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  // Sets the shared storage holding the reduction buffer and barriers of this CTA
+  CUTLASS_DEVICE
+  void
+  set_data_ptr(SharedStorage* shared_storage) {
+    shared_storage_ = shared_storage;
+  }
+
+  // Initializes the reduction barriers. Must be called by a single thread of every CTA before the
+  // cluster-wide synchronization that makes the barrier initialization visible to the peer CTAs.
+  CUTLASS_DEVICE
+  static void
+  init_barriers(SharedStorage& shared_storage) {
+    CUTLASS_PRAGMA_UNROLL
+    for (int split = 0; split < Splits; ++split) {
+      shared_storage.full_barrier[split].init(1);
+    }
+    shared_storage.empty_barrier.init(1);
+    cutlass::arch::fence_barrier_init();
+  }
+
+  // Returns the initial work tile info that will be computed over
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(current_work_linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    if (linear_idx >= scheduler_params.blocks_per_problem_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    uint64_t work_idx_l, remainder;
+    scheduler_params.divmod_batch_(work_idx_l, remainder, linear_idx);
+    uint64_t blk_per_grid_dim = scheduler_params.divmod_cluster_shape_minor_.divide(remainder);
+
+    // The tile space is that of a 1x1 cluster, all splits of a cluster compute the same output tile
+    auto [work_idx_m, work_idx_n] = UnderlyingScheduler::get_work_idx_m_and_n(
+      blk_per_grid_dim,
+      scheduler_params.divmod_cluster_shape_major_,
+      scheduler_params.divmod_cluster_shape_minor_,
+      scheduler_params.divmod_cluster_blk_major_,
+      scheduler_params.log_swizzle_size_,
+      scheduler_params.raster_order_,
+      /* cta_m_in_cluster = */ 0,
+      /* cta_n_in_cluster = */ 0
+    );
+
+    // Spread the K tiles evenly across the splits, the first splits get one extra K tile if needed
+    uint32_t k_tiles = scheduler_params.k_tiles_per_output_tile_;
+    uint32_t k_tiles_per_split = k_tiles / Splits;
+    uint32_t k_tiles_remainder = k_tiles % Splits;
+    uint32_t split = static_cast<uint32_t>(split_idx_);
+
+    WorkTileInfo work_tile_info;
+    work_tile_info.M_idx = work_idx_m;
+    work_tile_info.N_idx = work_idx_n;
+    work_tile_info.L_idx = static_cast<int32_t>(work_idx_l);
+    work_tile_info.K_idx = split * k_tiles_per_split + platform::min(split, k_tiles_remainder);
+    work_tile_info.k_tile_count = k_tiles_per_split + (split < k_tiles_remainder ? 1 : 0);
+    work_tile_info.split_idx = split_idx_;
+    work_tile_info.is_valid_tile = true;
+    return work_tile_info;
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo const&, uint32_t advance_count = 1) const {
+    return not get_current_work_for_linear_idx(
+        current_work_linear_idx_ + (total_grid_size_ * uint64_t(advance_count))
+    ).is_valid();
+  }
+
+  // Kernel helper function to get next work tile
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+  // Given the inputs, computes the number of output tiles over which this problem will compute.
+  template <class ProblemShapeMNKL>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_tiled_cta_shape_mnl(ProblemShapeMNKL problem_shape_mnkl, TileShape cta_shape) {
+    auto cta_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape_mnkl), cute::shape<0>(cta_shape)));
+    auto cta_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape_mnkl), cute::shape<1>(cta_shape)));
+
+    return UnderlyingParams::get_tiled_cta_shape_mnl(
+      to_gemm_coord(problem_shape_mnkl),
+      GemmCoord(1, 1, 1),
+      cta_m, cta_n
+    );
+  }
+
+  // Given the inputs, computes the physical grid we should launch. The tiles are distributed over
+  // gridDim.x * gridDim.y clusters, and gridDim.z is the number of splits.
+  template <class ProblemShapeMNKL, class BlockShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+      [[maybe_unused]] Params const& params,
+      ProblemShapeMNKL problem_shape_mnk,
+      BlockShape cta_shape,
+      ClusterShape,
+      KernelHardwareInfo hw_info,
+      Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size = true) {
+
+    auto problem_shape_mnkl = cute::append<4>(problem_shape_mnk, cute::Int<1>{});
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape_mnkl, TileShape{});
+
+    dim3 grid = UnderlyingParams::get_grid_shape(
+      problem_blocks,
+      GemmCoord(1, 1, 1),
+      get_hw_info_per_split(hw_info),
+      arguments.max_swizzle_size,
+      arguments.raster_order,
+      /* truncate_by_problem_size = */true
+    );
+    grid.z = Splits;
+    return grid;
+  }
+
+  // Returns whether the block assigned this work should compute the epilogue for the corresponding
+  // output tile. Only split 0, which holds the reduced accumulators, computes the epilogue.
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info, Params const&) {
+    return work_tile_info.split_idx == 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info) {
+    return work_tile_info.split_idx == 0;
+  }
+
+  // Reduces the partial accumulators of all splits of the output tile into those of split 0.
+  // Must be called by the NumThreads threads owning the accumulators in every CTA of the cluster,
+  // for every work tile. The peer splits return once split 0 has read their partials, which
+  // keeps them resident for as long as split 0 accesses their shared memory.
+  template <int NumThreads, class FrgTensorC>
+  CUTLASS_DEVICE
+  void
+  fixup(WorkTileInfo const& work_tile_info, FrgTensorC& accumulators, uint32_t thread_idx) {
+    using ElementAccumulator = typename FrgTensorC::value_type;
+    static_assert(sizeof(ElementAccumulator) == sizeof(uint32_t),
+      "The cluster split-K scheduler requires 32-bit accumulators.");
+
+    constexpr int NumElements = decltype(cute::size(accumulators))::value;
+    static_assert(NumElements % 4 == 0, "Accumulators must be reducible in vectors of four elements.");
+    constexpr int VectorsPerThread = NumElements / 4;
+    constexpr int VectorsPerChunkMax = ReductionBufferBytes / int(sizeof(uint128_t) * NumThreads);
+    static_assert(VectorsPerChunkMax >= 1, "The reduction buffer is too small for the number of threads.");
+    constexpr int VectorsPerChunk = cute::min(VectorsPerChunkMax, VectorsPerThread);
+    constexpr int NumChunks = (VectorsPerThread + VectorsPerChunk - 1) / VectorsPerChunk;
+
+    using Vector = cutlass::Array<ElementAccumulator, 4>;
+    SharedStorage& storage = *shared_storage_;
+
+    // Splits without K tiles did not run the mainloop and contribute zeros
+    if (work_tile_info.k_tile_count == 0) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < NumElements; ++i) {
+        accumulators(i) = ElementAccumulator(0);
+      }
+    }
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int chunk = 0; chunk < NumChunks; ++chunk) {
+      uint32_t phase = reduction_phase_;
+      reduction_phase_ ^= 1;
+
+      if (work_tile_info.split_idx != 0) {
+        // Publish this chunk of the partials, then wait until split 0 has consumed it
+        Vector* buffer = reinterpret_cast<Vector*>(storage.reduction_buffer);
+        CUTLASS_PRAGMA_UNROLL
+        for (int v = 0; v < VectorsPerChunk; ++v) {
+          int vector_idx = chunk * VectorsPerChunk + v;
+          if (vector_idx < VectorsPerThread) {
+            Vector frag;
+            CUTLASS_PRAGMA_UNROLL
+            for (int i = 0; i < 4; ++i) {
+              frag[i] = accumulators(vector_idx * 4 + i);
+            }
+            buffer[v * NumThreads + thread_idx] = frag;
+          }
+        }
+        arch::NamedBarrier::sync(NumThreads, arch::ReservedNamedBarriers::StreamkBarrier0);
+        if (thread_idx == 0) {
+          arrive_remote_release(&storage.full_barrier[work_tile_info.split_idx], 0);
+        }
+        wait_acquire(&storage.empty_barrier, phase);
+      }
+      else {
+        // Accumulate the chunks of the peer splits straight from their shared memory
+        uint32_t buffer_addr = cute::cast_smem_ptr_to_uint(storage.reduction_buffer);
+        CUTLASS_PRAGMA_UNROLL
+        for (int split = 1; split < Splits; ++split) {
+          wait_acquire(&storage.full_barrier[split], phase);
+          CUTLASS_PRAGMA_UNROLL
+          for (int v = 0; v < VectorsPerChunk; ++v) {
+            int vector_idx = chunk * VectorsPerChunk + v;
+            if (vector_idx < VectorsPerThread) {
+              Vector frag = load_remote<Vector>(
+                buffer_addr + uint32_t((v * NumThreads + thread_idx) * sizeof(Vector)), split);
+              CUTLASS_PRAGMA_UNROLL
+              for (int i = 0; i < 4; ++i) {
+                accumulators(vector_idx * 4 + i) += frag[i];
+              }
+            }
+          }
+        }
+        // Release the buffers of the peers once all threads have read their part of the chunk
+        arch::NamedBarrier::sync(NumThreads, arch::ReservedNamedBarriers::StreamkBarrier0);
+        if (thread_idx < Splits - 1) {
+          arrive_remote_release(&storage.empty_barrier, thread_idx + 1);
+        }
+      }
+    }
+  }
+
+  // Returns whether the current WorkTileInfo passed in should continue to be used. Every work tile
+  // covers the full K range of its split.
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape, TileShape) {
+    return static_cast<int>(work_tile_info.k_tile_count);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return work_tile_info.K_idx;
+  }
+
+  // Splits without K tiles skip the mainloop
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const& work_tile_info) {
+    return work_tile_info.k_tile_count > 0;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const&) {
+    return false;
+  }
+
+  // The partials are reduced in shared memory, no additional workspace is required
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
+    return 0;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void*, cudaStream_t, ProblemShape, KernelHardwareInfo const&,
+    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* = nullptr) {
+    return Status::kSuccess;
+  }
+
+private:
+  // Every cluster of Splits CTAs computes one output tile at a time, so the tile space is
+  // distributed over the device as if it had sm_count / Splits SMs
+  CUTLASS_HOST_DEVICE
+  static KernelHardwareInfo
+  get_hw_info_per_split(KernelHardwareInfo hw_info) {
+    hw_info = get_partitioned_hw_info(hw_info, Splits);
+    if (hw_info.max_active_clusters > 0) {
+      hw_info.sm_count = platform::min(hw_info.max_active_clusters, hw_info.sm_count / Splits);
+    }
+    else {
+      hw_info.sm_count = hw_info.sm_count / Splits;
+    }
+    hw_info.sm_count = platform::max(hw_info.sm_count, 1);
+    hw_info.max_active_clusters = 0;
+    return hw_info;
+  }
+
+  // Arrives on the barrier at the same shared memory offset in the CTA of rank cta_id, releasing the
+  // shared memory writes of this CTA ordered before the arrive to the cluster
+  CUTLASS_DEVICE
+  static void
+  arrive_remote_release(arch::ClusterBarrier const* barrier, uint32_t cta_id) {
+#if CUDA_BARRIER_ENABLED
+    uint32_t smem_addr = cute::cast_smem_ptr_to_uint(barrier);
+    asm volatile(
+        "{\n\t"
+        ".reg .b32 remAddr32;\n\t"
+        "mapa.shared::cluster.u32  remAddr32, %0, %1;\n\t"
+        "mbarrier.arrive.release.cluster.shared::cluster.b64  _, [remAddr32];\n\t"
+        "}"
+        :
+        : "r"(smem_addr), "r"(cta_id)
+        : "memory");
+#else
+    CUTLASS_NOT_IMPLEMENTED();
+#endif
+  }
+
+  // Waits for the given phase of a local barrier, acquiring the writes released to it by the cluster
+  CUTLASS_DEVICE
+  static void
+  wait_acquire(arch::ClusterBarrier const* barrier, uint32_t phase) {
+#if CUDA_BARRIER_ENABLED
+    uint32_t smem_addr = cute::cast_smem_ptr_to_uint(barrier);
+    asm volatile(
+        "{\n\t"
+        ".reg .pred       P1; \n\t"
+        "LAB_WAIT: \n\t"
+        "mbarrier.try_wait.parity.acquire.cluster.shared::cta.b64 P1, [%0], %1; \n\t"
+        "@P1 bra DONE; \n\t"
+        "bra     LAB_WAIT; \n\t"
+        "DONE: \n\t"
+        "}"
+        :
+        : "r"(smem_addr), "r"(phase)
+        : "memory");
+#else
+    CUTLASS_NOT_IMPLEMENTED();
+#endif
+  }
+
+  // Loads 16 bytes at the given shared memory address of the CTA of rank cta_id
+  template <class Vector>
+  CUTLASS_DEVICE
+  static Vector
+  load_remote(uint32_t smem_addr, uint32_t cta_id) {
+    static_assert(sizeof(Vector) == sizeof(uint128_t));
+    Vector frag;
+#if CUDA_BARRIER_ENABLED
+    uint32_t* data = reinterpret_cast<uint32_t*>(&frag);
+    uint32_t remote_addr = cute::set_block_rank(smem_addr, cta_id);
+    asm volatile(
+        "ld.shared::cluster.v4.b32 {%0, %1, %2, %3}, [%4];\n"
+        : "=r"(data[0]), "=r"(data[1]), "=r"(data[2]), "=r"(data[3])
+        : "r"(remote_addr)
+        : "memory");
+#else
+    CUTLASS_NOT_IMPLEMENTED();
+#endif
+    return frag;
+  }
+
+public:
+  // Sink scheduler params as a member
+  Params scheduler_params;
+
+private:
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+  int32_t split_idx_ = 0;
+  // Parity of the reduction barriers for the next chunk
+  uint32_t reduction_phase_ = 0;
+  SharedStorage* shared_storage_ = nullptr;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
@@ -60,6 +60,10 @@ protected:
     uint64_t total_tiles = 0;
     uint64_t problem_blocks_along_raster_order = 0;
     int32_t log_swizzle_size = 0;
+    // K cost bucket currently handed out with GroupOrder::LongestKFirst, -1 for GroupOrder::InOrder
+    int32_t k_bucket = -1;
+    // Set of the K cost buckets holding at least one group
+    uint32_t k_bucket_mask = 0;
   } current_group_info_;
 
 public:
@@ -98,6 +102,7 @@ public:
   using Params = PersistentTileSchedulerSm90GroupParams<GroupProblemShape>;
   using RasterOrder = typename Params::RasterOrder;
   using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using GroupOrder = typename Params::GroupOrder;
   static constexpr bool IsDynamicPersistent = false;
 
   // We need to hard code the number of stages here since the scheduling is static
@@ -132,6 +137,7 @@ public:
     int max_swizzle_size = 1;
     // Not applying Heuristics for Grouped problems, since largest dimension can change per group
     RasterOrderOptions raster_order = RasterOrderOptions::AlongM;
+    GroupOrder group_order = GroupOrder::InOrder;
   };
 
   // Sink scheduler params as a member
@@ -173,7 +179,8 @@ public:
       to_gemm_coord(cluster_shape),
       hw_info,
       arguments.max_swizzle_size, 
-      arguments.raster_order
+      arguments.raster_order,
+      arguments.group_order
     );
 
     return params;
@@ -264,6 +271,16 @@ public:
     }
   }
 
+  // Returns the K cost bucket of a group for GroupOrder::LongestKFirst, i.e. floor(log2) of its
+  // number of K tiles. All tiles of a group run the same number of mainloop iterations.
+  template <class ProblemShape>
+  CUTLASS_DEVICE
+  static int32_t
+  get_k_bucket(ProblemShape const& problem_shape, int32_t cta_shape_k) {
+    auto k_tiles = static_cast<uint32_t>((cute::size(cute::shape<2>(problem_shape)) + cta_shape_k - 1) / cta_shape_k);
+    return k_tiles == 0 ? 0 : 31 - __clz(k_tiles);
+  }
+
   PersistentTileSchedulerSm90Group() = default;
 
   // Note: constructing this tile scheduler can touch global memory that was
@@ -302,6 +319,19 @@ public:
     current_group_info_.total_tiles = problem_blocks_m * problem_blocks_n;
     current_group_info_.problem_blocks_along_raster_order = params_.raster_order_ == RasterOrder::AlongN ? problem_blocks_n : problem_blocks_m;
 
+    if (params_.group_order_ == GroupOrder::LongestKFirst) {
+      // Collect the non-empty buckets with one pass of the warp over all groups
+      uint32_t k_bucket_mask = 0;
+      for (int group = lane_idx; group < params_.problem_shapes_.groups(); group += NumThreadsPerWarp) {
+        k_bucket_mask |= 1u << get_k_bucket(params_.problem_shapes_.get_problem_shape(group), params_.cta_shape_.k());
+      }
+      k_bucket_mask = __reduce_or_sync(0xffffffff, k_bucket_mask);
+      current_group_info_.k_bucket_mask = k_bucket_mask;
+      current_group_info_.k_bucket = k_bucket_mask == 0 ? 0 : 31 - __clz(k_bucket_mask);
+      // Group 0 might not belong to the first bucket, let the first query search from it
+      current_group_info_.total_tiles = 0;
+    }
+
 #else
     CUTLASS_ASSERT(false && "This line should never be reached");
 #endif
@@ -324,7 +354,8 @@ public:
       FastDivmodU64 const& divmod_cta_shape_m,
       FastDivmodU64 const& divmod_cta_shape_n,
       int32_t max_swizzle_size, 
-      RasterOrder raster_order) {
+      RasterOrder raster_order,
+      int32_t cta_shape_k = 1) {
 
     uint8_t valid_tile = 1;
 
@@ -332,6 +363,10 @@ public:
     int lane_idx = canonical_lane_idx();
     int total_problem_groups = problem_shapes.groups();
     if (linear_idx >= group_info.total_tiles + group_info.start_linear_idx) {
+      // With GroupOrder::LongestKFirst, the groups are scanned once per bucket and only the groups
+      // of the current bucket contribute tiles. The search terminates past the last group of the last bucket.
+      bool is_last_bucket = group_info.k_bucket < 0 ||
+                            (group_info.k_bucket_mask & ((1u << group_info.k_bucket) - 1)) == 0;
       group_info.group_idx += lane_idx;
       for ( ; ; group_info.group_idx += NumThreadsPerWarp) {
         cached_problem_shapes[0] = cached_problem_shapes[1];
@@ -354,9 +389,13 @@ public:
           auto problem_blocks_n = round_up(ctas_along_n, (1 << group_info.log_swizzle_size) * cluster_shape.n());
           group_info.problem_blocks_along_raster_order = raster_order == RasterOrder::AlongN ? problem_blocks_n : problem_blocks_m;
           group_info.total_tiles = problem_blocks_m * problem_blocks_n;
+          if (group_info.k_bucket >= 0 && get_k_bucket(cached_problem_shapes[0], cta_shape_k) != group_info.k_bucket) {
+            // The tiles of this group are handed out with another bucket
+            group_info.total_tiles = 0;
+          }
         }
         else {
-          group_info.total_tiles = INT_MAX;
+          group_info.total_tiles = is_last_bucket ? INT_MAX : 0;
         }
 
         auto curr_total_tiles = group_info.total_tiles;
@@ -385,6 +424,17 @@ public:
         }
         // Update the start_linear_idx for all threads so that they're ready for the next iteration.
         group_info.start_linear_idx = __shfl_sync(0xffffffff, group_info.start_linear_idx + group_info.total_tiles, NumThreadsPerWarp - 1);
+
+        if (!is_last_bucket &&
+            __shfl_sync(0xffffffff, group_info.group_idx, NumThreadsPerWarp - 1) + 1 >= total_problem_groups) {
+          // All groups have been scanned for the current bucket. Restart from group 0 with the next non-empty bucket.
+          group_info.k_bucket = 31 - __clz(group_info.k_bucket_mask & ((1u << group_info.k_bucket) - 1));
+          group_info.group_idx = lane_idx - NumThreadsPerWarp;
+          if (lane_idx < total_problem_groups) {
+            cached_problem_shapes[1] = problem_shapes.get_problem_shape(lane_idx);
+          }
+          is_last_bucket = (group_info.k_bucket_mask & ((1u << group_info.k_bucket) - 1)) == 0;
+        }
       }
     }
 
@@ -453,7 +503,8 @@ public:
               scheduler_params.divmod_cta_shape_m_,
               scheduler_params.divmod_cta_shape_n_,
               scheduler_params.max_swizzle_size_, 
-              scheduler_params.raster_order_);
+              scheduler_params.raster_order_,
+              scheduler_params.cta_shape_.k());
   }
 
   template <typename TileSchedulerPipeline, typename TileSchedulerPipelineState, typename CallbackBeforeCommit = WorkTileInfo(*)(WorkTileInfo)>
@@ -0,0 +1,754 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/barrier.h"
+#include "cutlass/block_striped.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm_coord.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for Grouped GEMMs that splits the K mode of the output
+// tiles which do not fill a wave.
+//
+// Groups are scheduled in order as with PersistentTileSchedulerSm90Group. The output tiles of the
+// full waves are computed data-parallel. The groups starting in the last, partial wave have their
+// output tiles split into up to max_splits units along K, so that the CTAs that would otherwise
+// idle share the work. This matters for problems with fewer output tiles than SMs, e.g. the
+// experts of a MoE layer with a small batch. Partial accumulators are reduced in the global
+// workspace with the fixup used by the stream-K scheduler.
+template <class GroupProblemShape, class TileShape, int SchedulerPipelineStageCount>
+class PersistentTileSchedulerSm90GroupStreamK {
+  //
+  // Data members
+  //
+
+private:
+  using UnderlyingScheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount>;
+
+protected:
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+  // First output tile of the last, partial wave. Groups starting from it split their output tiles.
+  uint64_t split_tile_start_ = ~uint64_t(0);
+  // Number of splits of the output tiles of the last, partial wave
+  int32_t splits_ = 1;
+
+  // Tracking current group, its starting linear idx and total work units
+  struct GroupInfo {
+    int group_idx = 0;
+    uint64_t start_linear_idx = 0;
+    // Number of work units of the group, i.e. its output tiles times its splits
+    uint64_t total_tiles = 0;
+    uint64_t start_tile_idx = 0;
+    uint64_t output_tiles = 0;
+    uint64_t problem_blocks_along_raster_order = 0;
+    int32_t log_swizzle_size = 0;
+    int32_t splits = 1;
+    int32_t k_tiles = 0;
+  } current_group_info_;
+
+public:
+  struct WorkTileInfo {
+    int32_t M_idx = 0;
+    int32_t N_idx = 0;
+    int32_t L_idx = 0;
+    int32_t is_valid_tile = 0;
+
+    // Range of K tiles computed for the output tile by this unit of work
+    int32_t K_idx = 0;
+    int32_t k_tile_count = 0;
+
+    // Index of the output tile in the reduction workspace, -1 if the output tile is not split
+    int32_t reduction_tile_idx = -1;
+
+    // Whether this unit of work computes the final split of the output tile
+    bool final_split = true;
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_valid() const {
+      return is_valid_tile != 0;
+    }
+
+    CUTLASS_HOST_DEVICE
+    static WorkTileInfo
+    invalid_work_tile() {
+      return {-1, -1, -1, 0};
+    }
+
+    CUTLASS_HOST_DEVICE
+    bool
+    is_final_split(uint32_t) const {
+      return final_split;
+    }
+
+    CUTLASS_HOST_DEVICE
+    int32_t
+    reduction_subtile_idx() const {
+      return -1;
+    }
+  };
+
+  using ProblemShape = typename GroupProblemShape::UnderlyingProblemShape;
+  using Params = PersistentTileSchedulerSm90GroupStreamKParams<GroupProblemShape>;
+  using RasterOrder = typename Params::RasterOrder;
+  using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using ReductionMode = typename Params::ReductionMode;
+  static constexpr bool IsDynamicPersistent = false;
+
+  using Pipeline = PipelineAsync<SchedulerPipelineStageCount>;
+
+  // Call out the types here to work around a bug in MSVC.
+  using PipelineStorage = cutlass::PipelineDetail::PipelineAsyncSharedStorage<SchedulerPipelineStageCount>;
+  using PipelineState = cutlass::PipelineDetail::PipelineAsyncPipelineState<SchedulerPipelineStageCount>;
+
+  using ThrottlePipeline = PipelineEmpty;
+  using ThrottlePipelineStorage = typename PipelineEmpty::SharedStorage;
+  using SchedulerResponse = WorkTileInfo;
+
+  // Use a dummy barrier manager to simply get the type used to store the barrier
+  using BarrierType = typename NamedBarrierManager<1>::T;
+
+  class SharedStorage {
+  public:
+    CUTLASS_DEVICE PipelineStorage pipeline() { return pipeline_; }
+    // Pipeline throttle is not needed here as the scheduling is not dynamic.
+    CUTLASS_DEVICE ThrottlePipelineStorage throttle_pipeline() { return ThrottlePipelineStorage{}; }
+    CUTLASS_DEVICE SchedulerResponse* data() { return data_; }
+
+  private:
+    alignas(16) PipelineStorage pipeline_;
+    alignas(16) SchedulerResponse data_[SchedulerPipelineStageCount];
+  };
+
+  struct Arguments {
+    int max_swizzle_size = 1;
+    // Not applying Heuristics for Grouped problems, since largest dimension can change per group
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongM;
+    // Maximum number of splits of the K mode of an output tile. 1 schedules all tiles data-parallel.
+    int max_splits = 4;
+    ReductionMode reduction_mode = ReductionMode::Deterministic;
+    // The final split of each tile resets its barrier flags, so a workspace that was cleared once and
+    // whose last launch ran to completion need not be cleared again. Setting this skips the memset
+    // issued by initialize_workspace(). Atomic reductions still clear their partials.
+    bool barrier_workspace_initialized = false;
+  };
+
+  // Sink scheduler params as a member
+  Params scheduler_params;
+  void *response_ptr_ = nullptr;
+  ProblemShape cached_problem_shapes_[2];
+
+  //
+  // Methods
+  //
+
+  template <class TileShape_, class ClusterShape>
+  static Params
+  to_underlying_arguments(
+    GroupProblemShape problem_shapes,
+    TileShape_ tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    Arguments const& arguments,
+    void* workspace=nullptr,
+    [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+    [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u
+    ) {
+
+    static_assert(cute::is_static<TileShape_>::value);
+    static_assert(cute::is_static<ClusterShape>::value);
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(
+      problem_shapes,
+      hw_info,
+      tile_shape, cluster_shape);
+
+    Params params;
+    params.initialize(
+      problem_blocks,
+      problem_shapes,
+      to_gemm_coord(tile_shape),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      arguments.max_swizzle_size,
+      arguments.raster_order,
+      arguments.max_splits,
+      arguments.reduction_mode,
+      workspace
+    );
+
+    return params;
+  }
+
+  // Given the inputs, computes the physical grid we should launch.
+  template<class TileShape_, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+    [[maybe_unused]] Params const& params,
+    GroupProblemShape const& problem_shapes,
+    TileShape_ tile_shape,
+    ClusterShape cluster_shape,
+    KernelHardwareInfo hw_info,
+    Arguments arguments,
+    bool truncate_by_problem_size=true) {
+
+    dim3 problem_blocks = get_tiled_cta_shape_mnl(
+      problem_shapes,
+      hw_info,
+      tile_shape, cluster_shape);
+
+    // Splitting output tiles needs the CTAs beyond the number of output tiles
+    return Params::get_grid_shape(
+      problem_blocks,
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      arguments.max_swizzle_size,
+      arguments.raster_order,
+      /* truncate_by_problem_size = */arguments.max_splits <= 1
+    );
+  }
+
+  // Given the inputs, computes the total number of output blocks this problem will compute over
+  // Note that this is only the logical size of our grid, not the physical grid we will actually launch.
+  template<class BlockShape, class ClusterShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_tiled_cta_shape_mnl(GroupProblemShape const& problem_shapes, KernelHardwareInfo hw_info, BlockShape cta_shape, ClusterShape cluster_shape) {
+    return UnderlyingScheduler::get_tiled_cta_shape_mnl(problem_shapes, hw_info, cta_shape, cluster_shape);
+  }
+
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const&) {
+    return args.max_splits >= 1;
+  }
+
+  // Computes the number of output tiles of a group, along with its swizzle size and its blocks along the raster order
+  CUTLASS_DEVICE
+  static uint64_t
+  get_group_tiles(GroupInfo& group_info, ProblemShape const& problem_shape, Params const& params) {
+    uint64_t ctas_along_m, ctas_along_n;
+    if constexpr (is_tuple<decltype(cute::shape<0>(problem_shape))>::value ||
+                  is_tuple<decltype(cute::shape<1>(problem_shape))>::value) {
+      ctas_along_m = cute::size(cute::ceil_div(cute::shape<0>(problem_shape), params.cta_shape_.m()));
+      ctas_along_n = cute::size(cute::ceil_div(cute::shape<1>(problem_shape), params.cta_shape_.n()));
+    }
+    else {
+      ctas_along_m = params.divmod_cta_shape_m_.divide(cute::shape<0>(problem_shape) +  params.divmod_cta_shape_m_.divisor - 1);
+      ctas_along_n = params.divmod_cta_shape_n_.divide(cute::shape<1>(problem_shape) +  params.divmod_cta_shape_n_.divisor - 1);
+    }
+    group_info.log_swizzle_size = UnderlyingScheduler::get_log_swizzle_size(ctas_along_m, ctas_along_n, params.max_swizzle_size_);
+    auto problem_blocks_m = round_up(ctas_along_m, (1 << group_info.log_swizzle_size) * params.cluster_shape_.m());
+    auto problem_blocks_n = round_up(ctas_along_n, (1 << group_info.log_swizzle_size) * params.cluster_shape_.n());
+    group_info.problem_blocks_along_raster_order = params.raster_order_ == RasterOrder::AlongN ? problem_blocks_n : problem_blocks_m;
+    return problem_blocks_m * problem_blocks_n;
+  }
+
+  PersistentTileSchedulerSm90GroupStreamK() = default;
+
+  // Note: constructing this tile scheduler can touch global memory that was
+  // written to by the prior kernel.
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90GroupStreamK(Params const& params_, SchedulerResponse* response_ptr) : scheduler_params(params_), response_ptr_(response_ptr) {
+    // MSVC requires protecting use of CUDA-specific nonstandard syntax,
+    // like blockIdx and gridDim, with __CUDA_ARCH__.
+#if defined(__CUDA_ARCH__)
+    if (scheduler_params.raster_order_ == RasterOrder::AlongN) {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) + uint64_t(blockIdx.y) * uint64_t(gridDim.x);
+    }
+    else {
+      current_work_linear_idx_ = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
+    }
+
+    int lane_idx = canonical_lane_idx();
+    int groups = params_.problem_shapes_.groups();
+    if (lane_idx < groups) {
+      cached_problem_shapes_[1] = params_.problem_shapes_.get_problem_shape(lane_idx);
+    }
+
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+
+    if (params_.max_splits_ > 1) {
+      // Count the output tiles of all groups with one pass of the warp over the groups
+      uint64_t total_output_tiles = 0;
+      for (int group = lane_idx; group < groups; group += NumThreadsPerWarp) {
+        GroupInfo group_info;
+        total_output_tiles += get_group_tiles(group_info, params_.problem_shapes_.get_problem_shape(group), params_);
+      }
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = NumThreadsPerWarp / 2; i > 0; i /= 2) {
+        total_output_tiles += __shfl_xor_sync(0xffffffff, total_output_tiles, i);
+      }
+
+      // The output tiles of the last, partial wave are split over the CTAs of a wave. Their splits
+      // never exceed the reduction workspace, which holds partials for one output tile per CTA.
+      uint64_t tail_tiles = total_output_tiles % total_grid_size_;
+      if (tail_tiles > 0) {
+        uint64_t split_ctas = platform::min(total_grid_size_, static_cast<uint64_t>(params_.reduction_tiles_));
+        splits_ = static_cast<int32_t>(platform::min(static_cast<uint64_t>(params_.max_splits_), split_ctas / tail_tiles));
+        if (splits_ > 1) {
+          split_tile_start_ = total_output_tiles - tail_tiles;
+        }
+        else {
+          splits_ = 1;
+        }
+      }
+    }
+
+    // Let the first query search from group 0
+    current_group_info_.total_tiles = 0;
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  // get work_idx_m, work_idx_n from the index of the output tile in its group while applying swizzle
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_work_idx_m_and_n(uint64_t tile_idx_in_group, GroupInfo const& group_info) const {
+    auto const& divmod_cluster_shape_major = scheduler_params.divmod_cluster_shape_major_;
+    auto const& divmod_cluster_shape_minor = scheduler_params.divmod_cluster_shape_minor_;
+
+    uint64_t cluster_id, cluster_major_offset = 0, cluster_minor_offset = 0;
+    uint64_t blk_per_grid_dim = divmod_cluster_shape_minor.divide(tile_idx_in_group);
+    divmod_cluster_shape_major(cluster_id, cluster_major_offset, blk_per_grid_dim);
+
+    // The grid is launched such that all clusters are in linear (1-D) order, with the CTA offset
+    // inside a cluster along the minor dimension given by the blockIdx along it.
+    if (scheduler_params.raster_order_ == RasterOrder::AlongN) {
+      cluster_minor_offset = blockIdx.x;
+    }
+    else {
+      cluster_minor_offset = blockIdx.y;
+    }
+
+    uint64_t cluster_idx_minor, cluster_idx_major;
+    uint64_t cluster_idx_minor_div_swizzle, extra, offset;
+
+    offset = cluster_id & ((1 << group_info.log_swizzle_size) - 1);
+    extra = cluster_id >> group_info.log_swizzle_size;
+
+    uint64_t curr_group_cluster_blk_major = divmod_cluster_shape_major.divide(group_info.problem_blocks_along_raster_order);
+
+    cluster_idx_minor_div_swizzle = extra / curr_group_cluster_blk_major;
+    cluster_idx_major = extra % curr_group_cluster_blk_major;
+
+    cluster_idx_minor = cluster_idx_minor_div_swizzle * (1 << group_info.log_swizzle_size) + offset;
+
+    auto minor_work_idx = static_cast<int32_t>(cluster_idx_minor * divmod_cluster_shape_minor.divisor +
+                                               cluster_minor_offset);
+    auto major_work_idx = static_cast<int32_t>(cluster_idx_major * divmod_cluster_shape_major.divisor +
+                                               cluster_major_offset);
+
+    WorkTileInfo work_tile_info;
+    if (scheduler_params.raster_order_ == RasterOrder::AlongN) {
+      work_tile_info.M_idx = minor_work_idx;
+      work_tile_info.N_idx = major_work_idx;
+    }
+    else {
+      work_tile_info.M_idx = major_work_idx;
+      work_tile_info.N_idx = minor_work_idx;
+    }
+    work_tile_info.L_idx = group_info.group_idx;
+    work_tile_info.is_valid_tile = 1;
+    return work_tile_info;
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) {
+    GroupInfo& group_info = current_group_info_;
+    GroupProblemShape& problem_shapes = scheduler_params.problem_shapes_;
+
+    // Use a warp to "speculatively" check if the work unit maps to the next 32 groups
+    int lane_idx = canonical_lane_idx();
+    int total_problem_groups = problem_shapes.groups();
+    if (linear_idx >= group_info.total_tiles + group_info.start_linear_idx) {
+      group_info.group_idx += lane_idx;
+      for ( ; ; group_info.group_idx += NumThreadsPerWarp) {
+        cached_problem_shapes_[0] = cached_problem_shapes_[1];
+        if (group_info.group_idx + NumThreadsPerWarp < total_problem_groups) {
+          cached_problem_shapes_[1] = problem_shapes.get_problem_shape(group_info.group_idx + NumThreadsPerWarp);
+        }
+        if (group_info.group_idx < total_problem_groups) {
+          group_info.output_tiles = get_group_tiles(group_info, cached_problem_shapes_[0], scheduler_params);
+          group_info.k_tiles = static_cast<int32_t>(cute::size(cute::ceil_div(cute::shape<2>(cached_problem_shapes_[0]), scheduler_params.cta_shape_.k())));
+        }
+        else {
+          group_info.output_tiles = INT_MAX;
+          group_info.k_tiles = 0;
+        }
+
+        // Calculate prefix sum for start_tile_idx.
+        auto curr_output_tiles = group_info.output_tiles;
+        #pragma unroll
+        for (int i = 1; i < NumThreadsPerWarp; i *= 2) {
+          auto n = __shfl_up_sync(0xffffffff, curr_output_tiles, i);
+          curr_output_tiles = lane_idx >= i ? curr_output_tiles + n : curr_output_tiles;
+        }
+        group_info.start_tile_idx += curr_output_tiles - group_info.output_tiles;
+
+        // Groups starting in the last, partial wave split their output tiles, at most into one K tile each
+        group_info.splits = 1;
+        if (group_info.group_idx < total_problem_groups && group_info.start_tile_idx >= split_tile_start_) {
+          group_info.splits = platform::max(1, platform::min(splits_, group_info.k_tiles));
+        }
+        group_info.total_tiles = group_info.output_tiles * static_cast<uint64_t>(group_info.splits);
+
+        // Calculate prefix sum for start_linear_idx.
+        auto curr_total_tiles = group_info.total_tiles;
+        #pragma unroll
+        for (int i = 1; i < NumThreadsPerWarp; i *= 2) {
+          auto n = __shfl_up_sync(0xffffffff, curr_total_tiles, i);
+          curr_total_tiles = lane_idx >= i ? curr_total_tiles + n : curr_total_tiles;
+        }
+        group_info.start_linear_idx += curr_total_tiles - group_info.total_tiles;
+
+        uint32_t thread_succeed = __ballot_sync(0xffffffff, linear_idx < group_info.start_linear_idx + group_info.total_tiles);
+        if (thread_succeed) {
+          // Use the first succeeding thread.
+          int first_succeeding_thread = __ffs(thread_succeed) - 1;
+          group_info.group_idx = __shfl_sync(0xffffffff, group_info.group_idx, first_succeeding_thread);
+          group_info.start_linear_idx = __shfl_sync(0xffffffff, group_info.start_linear_idx, first_succeeding_thread);
+          group_info.total_tiles = __shfl_sync(0xffffffff, group_info.total_tiles, first_succeeding_thread);
+          group_info.start_tile_idx = __shfl_sync(0xffffffff, group_info.start_tile_idx, first_succeeding_thread);
+          group_info.output_tiles = __shfl_sync(0xffffffff, group_info.output_tiles, first_succeeding_thread);
+          group_info.problem_blocks_along_raster_order = __shfl_sync(0xffffffff, group_info.problem_blocks_along_raster_order, first_succeeding_thread);
+          group_info.log_swizzle_size = __shfl_sync(0xffffffff, group_info.log_swizzle_size, first_succeeding_thread);
+          group_info.splits = __shfl_sync(0xffffffff, group_info.splits, first_succeeding_thread);
+          group_info.k_tiles = __shfl_sync(0xffffffff, group_info.k_tiles, first_succeeding_thread);
+          if (group_info.group_idx + lane_idx < total_problem_groups) {
+            cached_problem_shapes_[1] = problem_shapes.get_problem_shape(group_info.group_idx + lane_idx);
+          }
+          break;
+        }
+        // Update the start indices for all threads so that they're ready for the next iteration.
+        group_info.start_linear_idx = __shfl_sync(0xffffffff, group_info.start_linear_idx + group_info.total_tiles, NumThreadsPerWarp - 1);
+        group_info.start_tile_idx = __shfl_sync(0xffffffff, group_info.start_tile_idx + group_info.output_tiles, NumThreadsPerWarp - 1);
+      }
+    }
+
+    if (group_info.group_idx >= total_problem_groups) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    // The work units of a group are ordered by split, so that the final split of an output tile
+    // has the highest linear index. Units only ever wait for units with lower linear indices.
+    uint64_t tile_idx_in_group = linear_idx - group_info.start_linear_idx;
+    int32_t split_idx = 0;
+    if (group_info.splits > 1) {
+      split_idx = static_cast<int32_t>(tile_idx_in_group / group_info.output_tiles);
+      tile_idx_in_group -= static_cast<uint64_t>(split_idx) * group_info.output_tiles;
+    }
+
+    WorkTileInfo work_tile_info = get_work_idx_m_and_n(tile_idx_in_group, group_info);
+    work_tile_info.K_idx = (split_idx * group_info.k_tiles) / group_info.splits;
+    work_tile_info.k_tile_count = ((split_idx + 1) * group_info.k_tiles) / group_info.splits - work_tile_info.K_idx;
+    if (group_info.splits > 1) {
+      // The first split of the output tiles of the split groups has linear indices in
+      // [split_tile_start_, split_tile_start_ + reduction_tiles_)
+      work_tile_info.reduction_tile_idx = static_cast<int32_t>(group_info.start_linear_idx + tile_idx_in_group - split_tile_start_);
+      work_tile_info.final_split = split_idx == group_info.splits - 1;
+    }
+    return work_tile_info;
+  }
+
+  template <typename TileSchedulerPipeline, typename TileSchedulerPipelineState, typename CallbackBeforeCommit = WorkTileInfo(*)(WorkTileInfo)>
+  CUTLASS_DEVICE
+  auto
+  advance_to_next_work(
+    TileSchedulerPipeline& scheduler_pipeline,
+    TileSchedulerPipelineState scheduler_pipe_producer_state,
+    uint32_t advance_count = 1,
+    CallbackBeforeCommit callback_before_commit = [] (WorkTileInfo info) { return info;}) {
+
+    current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+    auto work_tile = get_current_work_for_linear_idx(current_work_linear_idx_);
+    using WorkTileWithCallbackInfo = decltype(callback_before_commit(work_tile));
+    WorkTileWithCallbackInfo work_tile_with_callback_info = work_tile;
+    scheduler_pipeline.producer_acquire(scheduler_pipe_producer_state);
+    if (work_tile_with_callback_info.is_valid()) {
+      work_tile_with_callback_info = callback_before_commit(work_tile);
+    }
+
+    if (cute::elect_one_sync()) {
+      reinterpret_cast<WorkTileWithCallbackInfo *>(response_ptr_)[scheduler_pipe_producer_state.index()] = work_tile_with_callback_info;
+      cutlass::arch::fence_view_async_shared();
+      scheduler_pipeline.producer_commit(scheduler_pipe_producer_state);
+    }
+    return cute::make_tuple(work_tile_with_callback_info, true);
+  }
+
+  // Returns whether the block assigned this work should compute the epilogue for the corresponding
+  // output tile. Only the final split of a split output tile computes the epilogue.
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const& work_tile_info, Params const&) {
+    return work_tile_info.is_valid() && work_tile_info.final_split;
+  }
+
+  // Returns whether fixup is needed for `work_tile_info`.
+  CUTLASS_HOST_DEVICE
+  static bool
+  requires_fixup(Params const&, WorkTileInfo const& work_tile_info) {
+    // Fixup is not needed for invalid or data-parallel tiles
+    return work_tile_info.is_valid() && work_tile_info.reduction_tile_idx >= 0;
+  }
+
+  // Performs the reduction across splits for a given output tile. The splits of an output tile
+  // accumulate into its slot of the reduction workspace in order of their K tiles, and the final
+  // split adds the reduced partials to its accumulators.
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(
+    Params const& params,
+    WorkTileInfo const& work_tile_info,
+    FrgTensorC& accumulators,
+    uint32_t num_barriers,
+    uint32_t barrier_idx) {
+
+    static constexpr uint32_t Offset = static_cast<int>(cutlass::arch::ReservedNamedBarriers::StreamkBarrier0);
+    static constexpr uint32_t MaxNumNamedBarriers = 2;
+    using BarrierManager = NamedBarrierManager<NumThreadsPerWarpGroup, Offset, MaxNumNamedBarriers>;
+    using ElementAccumulator = typename FrgTensorC::value_type;
+
+    if (!requires_fixup(params, work_tile_info)) {
+      return;
+    }
+    uint64_t tile_idx = static_cast<uint64_t>(work_tile_info.reduction_tile_idx);
+
+    // Index of the lock on which to wait
+    uint64_t lock_idx = (tile_idx * num_barriers) + barrier_idx;
+
+    // Reductions use BlockStripedReduce with a width of BarrierManager::ThreadCount under the hood.
+    // Thus, the start of the reduction space is the same across all threads in a warp group.
+    uint64_t reduction_offset =
+      (static_cast<uint64_t>(cute::size<0>(TileShape{})) * static_cast<uint64_t>(cute::size<1>(TileShape{})) * tile_idx) +
+      (static_cast<uint64_t>(size(accumulators)) * barrier_idx * BarrierManager::ThreadCount);
+
+    ElementAccumulator* group_reduction_workspace = reinterpret_cast<ElementAccumulator*>(params.reduction_workspace_) + reduction_offset;
+
+    using AccumulatorArrayT = Array<typename FrgTensorC::value_type, size(FrgTensorC{})>;
+    using BlockStripedReduceT = BlockStripedReduce<BarrierManager::ThreadCount, AccumulatorArrayT>;
+    using BlockStripedVectorReduceT = BlockStripedVectorReduce<BarrierManager::ThreadCount, AccumulatorArrayT>;
+
+    AccumulatorArrayT* reduction_workspace_array = reinterpret_cast<AccumulatorArrayT*>(group_reduction_workspace);
+    AccumulatorArrayT* accumulator_array = reinterpret_cast<AccumulatorArrayT*>(accumulators.data());
+
+    uint32_t barrier_group_thread_idx = threadIdx.x % BarrierManager::ThreadCount;
+
+    // Barrier workspace follows reduction workspace.
+    uint64_t reduction_workspace_size = PersistentTileSchedulerSm90StreamKParams::get_reduction_workspace_size(
+      params.reduction_tiles_, to_gemm_coord(TileShape{}), sizeof_bits<ElementAccumulator>::value);
+    BarrierType* lock_workspace = reinterpret_cast<BarrierType*>(
+      reinterpret_cast<uint8_t*>(params.reduction_workspace_) + reduction_workspace_size);
+
+    if (!work_tile_info.final_split) {
+      if (params.reduction_mode_ == ReductionMode::Atomic) {
+        // Add the partials to the zero-initialized workspace without waiting for the other splits
+        BlockStripedVectorReduceT::reduce(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      }
+      else if (work_tile_info.K_idx == 0) {
+        // The first split initializes the workspace partials
+        BlockStripedReduceT::store(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      }
+      else {
+        if (params.reduction_mode_ == ReductionMode::Deterministic) {
+          // Wait until the preceding split added its accumulators
+          BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+        }
+        else {
+          // Wait until the first split has stored its accumulators
+          BarrierManager::wait_lt(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, 1);
+        }
+
+        // Perform reduction in workspace
+        BlockStripedReduceT::reduce(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      }
+
+      // Signal our arrival by incrementing the lock by the number of K tiles computed
+      BarrierManager::arrive_inc(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.k_tile_count);
+    }
+    else {
+      // Wait until all preceding splits added their accumulators, resetting the lock for the next launch
+      BarrierManager::wait_eq_reset(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+
+      // The block computing the final split for the tile adds previously-reduced partials
+      // to its accumulators and computes the epilogue.
+      if (params.reduction_mode_ == ReductionMode::Atomic) {
+        BlockStripedVectorReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+      }
+      else {
+        BlockStripedReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+      }
+    }
+  }
+
+  // Returns whether the current WorkTileInfo passed in should continue to be used. Each unit of
+  // work covers a single split of a single output tile, so it is not used after having been processed.
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  template <class ProblemShape_, class ElementAccumulator>
+  static size_t
+  get_workspace_size(
+    Arguments const& args,
+    ProblemShape_,
+    KernelHardwareInfo const& hw_info,
+    uint32_t mma_warp_groups,
+    [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+    [[maybe_unused]] uint32_t num_accumulator_mtxs = 1) {
+
+    return Params::get_workspace_size(
+      hw_info,
+      to_gemm_coord(TileShape{}),
+      args.max_splits,
+      mma_warp_groups,
+      sizeof_bits<BarrierType>::value,
+      sizeof_bits<ElementAccumulator>::value
+    );
+  }
+
+  template <class ProblemShape_, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(
+    Arguments const& args,
+    void* workspace,
+    cudaStream_t stream,
+    ProblemShape_,
+    KernelHardwareInfo const& hw_info,
+    uint32_t mma_warp_groups,
+    [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+    [[maybe_unused]] uint32_t num_accumulator_mtxs = 1,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+
+    return Params::initialize_workspace(
+      workspace,
+      stream,
+      hw_info,
+      to_gemm_coord(TileShape{}),
+      args.max_splits,
+      mma_warp_groups,
+      sizeof_bits<BarrierType>::value,
+      sizeof_bits<ElementAccumulator>::value,
+      args.reduction_mode,
+      cuda_adapter,
+      args.barrier_workspace_initialized
+    );
+  }
+
+  template <class ProblemShape_MNKL, class TileShape_>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape_MNKL, TileShape_) {
+    return work_tile_info.k_tile_count;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    return static_cast<uint32_t>(work_tile_info.K_idx);
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  need_separate_reduction(Params const& params) {
+    return false;
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_work_tile_for_reduction(WorkTileInfo const& work_tile_info, Params const& params) {
+    return false;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const& work_tile_info) {
+    return true;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const& params) {
+    return false;
+  }
+
+  // Kernel helper function to get next work tile
+  template <typename WorkTileWithCallbackInfo, typename TileSchedulerPipeline, typename TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+    WorkTileWithCallbackInfo work_tile_with_callback_info,
+    TileSchedulerPipeline& scheduler_pipeline,
+    TileSchedulerPipelineState scheduler_pipe_consumer_state) {
+
+    if (continue_current_work(work_tile_with_callback_info)) {
+      return cute::make_tuple(work_tile_with_callback_info, true);
+    }
+    scheduler_pipeline.consumer_wait(scheduler_pipe_consumer_state);
+    work_tile_with_callback_info = reinterpret_cast<WorkTileWithCallbackInfo *>(response_ptr_)[scheduler_pipe_consumer_state.index()];
+    cutlass::arch::fence_view_async_shared();
+    scheduler_pipeline.consumer_release(scheduler_pipe_consumer_state);
+
+    return cute::make_tuple(work_tile_with_callback_info, true);
+  }
+
+  // Returns the initial work tile info that will be computed over
+  template <class ClusterShape, typename CallbackBeforeCommit = WorkTileInfo(*)(WorkTileInfo)>
+  CUTLASS_DEVICE
+  auto
+  initial_work_tile_info(ClusterShape, CallbackBeforeCommit callback_before_commit = [] (WorkTileInfo response) { return response;}) {
+    auto work_tile = get_current_work_for_linear_idx(current_work_linear_idx_);
+    using WorkTileWithCallbackInfo = decltype(callback_before_commit(work_tile));
+    WorkTileWithCallbackInfo work_tile_with_callback_info = work_tile;
+    if (work_tile_with_callback_info.is_valid()) {
+      work_tile_with_callback_info = callback_before_commit(work_tile);
+    }
+    return work_tile_with_callback_info;
+  }
+};
+
+} // namespace cutlass::gemm::kernel::detail
@@ -61,6 +61,7 @@ private:
   dim3 block_id_in_cluster_;
   uint64_t current_work_linear_idx_ = 0;
   uint32_t unit_iter_start_ = 0;
+  TileSchedulerTelemetryRecorder telemetry_;
 
 public:
 
@@ -167,6 +168,9 @@ public:
       raster_order = args.raster_order;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
+      heuristic = args.heuristic;
+      telemetry = args.telemetry;
+      barrier_workspace_initialized = args.barrier_workspace_initialized;
       return *this;
     }
 
@@ -178,6 +182,9 @@ public:
       raster_order = args.raster_order;
       reduction_mode = args.reduction_mode;
       decomposition_mode = args.decomposition_mode;
+      heuristic = args.heuristic;
+      telemetry = args.telemetry;
+      barrier_workspace_initialized = args.barrier_workspace_initialized;
       return *this;
     }
 
@@ -199,6 +206,18 @@ public:
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
     ReductionMode reduction_mode = ReductionMode::Deterministic;
     DecompositionMode decomposition_mode = DecompositionMode::Heuristic;
+    // Constants of the cost model used with DecompositionMode::Heuristic. Fields left
+    // at zero take the values of StreamKHeuristicConfig::calibrated().
+    StreamKHeuristicConfig heuristic{};
+    // If set, points to one entry per CTA of the grid receiving the work processed by the CTA. Only
+    // recorded if CUTLASS_ENABLE_TILE_SCHEDULER_TELEMETRY is defined.
+    TileSchedulerTelemetry* telemetry = nullptr;
+    // Stream-K and split-K barrier flags are returned to zero by the final split consuming them, so a
+    // workspace that was cleared once and whose last launch ran to completion need not be cleared again.
+    // Setting this skips the memset issued by initialize_workspace(), keeping each GEMM to a single launch.
+    // Atomic reductions still clear their partials, and separate reduction, whose reduction units share
+    // a flag per tile, still clears the barrier workspace.
+    bool barrier_workspace_initialized = false;
   };
 
   // Sink scheduler params as a member
@@ -239,8 +258,12 @@ public:
       args.reduction_mode,
       args.decomposition_mode,
       workspace,
-      epilogue_subtile
+      epilogue_subtile,
+      /*ktile_start_alignment_count=*/1u,
+      /*bypass_sm90_occupancy_calculation=*/false,
+      args.heuristic
     );
+    params.telemetry_ = args.telemetry;
     return params;
   }
 
@@ -264,7 +287,7 @@ public:
     else {
       current_work_linear_idx_ = uint64_t(blockIdx.x) * uint64_t(gridDim.y) + uint64_t(blockIdx.y);
     }
-
+    telemetry_.begin(params_.telemetry_);
   }
 
   CUTLASS_DEVICE
@@ -468,6 +491,10 @@ public:
 
     using AccumulatorArrayT = Array<typename FrgTensorC::value_type, size(FrgTensorC{})>;
     using BlockStripedReduceT = BlockStripedReduce<BarrierManager::ThreadCount, AccumulatorArrayT>;
+    using BlockStripedVectorReduceT = BlockStripedVectorReduce<BarrierManager::ThreadCount, AccumulatorArrayT>;
+
+    // Atomic reductions add to a zero-initialized workspace, which is striped at the full access width
+    bool const atomic_reduction = params.reduction_mode_ == ReductionMode::Atomic && !params.requires_separate_reduction();
 
     AccumulatorArrayT* reduction_workspace_array = reinterpret_cast<AccumulatorArrayT*>(group_reduction_workspace);
     AccumulatorArrayT* accumulator_array = reinterpret_cast<AccumulatorArrayT*>(accumulators.data());
@@ -500,13 +527,19 @@ public:
 
     if (work_tile_info.is_reduction_unit()) {
       // Wait until the peers collaborating on this output tile have all written
-      // their accumulators to workspace.
+      // their accumulators to workspace. There is one reduction unit per epilogue subtile, all
+      // waiting on this lock, so it is not reset here. initialize_workspace() instead clears the
+      // barrier workspace on every launch that performs separate reduction.
       BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, num_peers);
 
       separate_reduction<FrgTensorC, BarrierManager>(accumulators, num_barriers, group_reduction_workspace, barrier_group_thread_idx, num_peers, num_accumulator_mtxs);
     }
     else if (!compute_epilogue(work_tile_info, params)) {
-      if (
+      if (atomic_reduction) {
+        // Add the partials to the workspace without waiting for the other splits
+        BlockStripedVectorReduceT::reduce(reduction_workspace_array, *accumulator_array, barrier_group_thread_idx);
+      }
+      else if (
         params.requires_separate_reduction()
         || work_tile_info.K_idx == 0
         ) {
@@ -542,12 +575,23 @@ public:
       }
     }
     else {
-      // Wait until the preceding split added its accumulators
-      BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      // Wait until the preceding split added its accumulators. No other unit accesses the lock
+      // afterwards, so the last wait on it resets it for the next launch.
+      if (idx_accumulator_mtxs == (num_accumulator_mtxs - 1)) {
+        BarrierManager::wait_eq_reset(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      }
+      else {
+        BarrierManager::wait_eq(barrier_idx, lock_workspace, barrier_group_thread_idx, lock_idx, work_tile_info.K_idx);
+      }
 
       // The block computing the final split for the tile adds previously-reduced partials
       // to its accumulators and computes the epilogue.
-      BlockStripedReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+      if (atomic_reduction) {
+        BlockStripedVectorReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+      }
+      else {
+        BlockStripedReduceT::load_add(*accumulator_array, reduction_workspace_array, barrier_group_thread_idx);
+      }
     }
   }
 
@@ -641,7 +685,11 @@ public:
       mma_warp_groups,
       sizeof_bits<BarrierType>::value,
       sizeof_bits<ElementAccumulator>::value,
-      epilogue_subtile
+      epilogue_subtile,
+      /*num_accumulator_mtxs=*/1,
+      /*ktile_start_alignment_count=*/1,
+      /*bypass_sm90_occupancy_calculation=*/false,
+      args.heuristic
     );
   }
 
@@ -684,7 +732,11 @@ public:
       sizeof_bits<ElementAccumulator>::value,
       epilogue_subtile,
       1,
-      cuda_adapter
+      cuda_adapter,
+      /*ktile_start_alignment_count=*/1,
+      /*bypass_sm90_occupancy_calculation=*/false,
+      args.heuristic,
+      args.barrier_workspace_initialized
     );
   }
 
@@ -705,12 +757,19 @@ public:
   CUTLASS_DEVICE
   auto
   fetch_next_work(WorkTileInfo work_tile_info) {
+    if (work_tile_info.is_valid()) {
+      telemetry_.record(work_tile_info.k_tile_count);
+    }
     if (continue_current_work(work_tile_info)) {
       return cute::make_tuple(work_tile_info, true);
     }
 
     advance_to_next_work();
-    return cute::make_tuple(get_current_work(), true);
+    auto next_work_tile_info = get_current_work();
+    if (!next_work_tile_info.is_valid()) {
+      telemetry_.end();
+    }
+    return cute::make_tuple(next_work_tile_info, true);
   }
 
   // Kernel helper function to get next work tile
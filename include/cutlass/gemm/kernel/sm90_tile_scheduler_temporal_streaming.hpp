@@ -0,0 +1,389 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler that walks the output of an implicit GEMM convolution
+// slice by slice along its outermost spatial mode (T for 3D, H for 2D) inside every CTA.
+//
+// The linearized M mode of fprop is (Q,P,Z,N), so for an output slice of SliceTiles M tiles the
+// tile m and the tile m + SliceTiles cover the same spatial block of two consecutive slices. Their
+// input footprints overlap in all but one of the T filter taps. The tile space is divided into
+// work units of a spatial block (M tile within a slice) and a run of consecutive slices; each CTA
+// processes its units one at a time, visiting every N tile of a slice before moving on to the next
+// slice. The input slices shared by consecutive output slices are hence re-read by the same CTA
+// right after it first loaded them and are served from L2, which reduces the DRAM traffic for the
+// activation by up to the filter depth.
+//
+// The slice extent is taken from Arguments::slice_extent_m, which the SM90 persistent kernels set
+// from the ConvProblemShape of convolutions. Without it, every work unit is a run of consecutive
+// M tiles.
+template <
+  class TileShape,
+  class ClusterShape
+>
+class PersistentTileSchedulerSm90TemporalStreaming {
+private:
+  using UnderlyingScheduler = PersistentTileSchedulerSm90;
+  using UnderlyingParams = typename UnderlyingScheduler::Params;
+
+public:
+  static_assert(cute::size(ClusterShape{}) == 1,
+    "The temporal streaming scheduler requires a cluster shape of (1, 1, 1).");
+
+  using RasterOrder = UnderlyingScheduler::RasterOrder;
+  using RasterOrderOptions = UnderlyingScheduler::RasterOrderOptions;
+  static constexpr bool IsDynamicPersistent = false;
+
+  using Pipeline = PipelineEmpty;
+  using PipelineStorage = typename Pipeline::SharedStorage;
+  using ThrottlePipeline = PipelineEmpty;
+  using ThrottlePipelineStorage = typename ThrottlePipeline::SharedStorage;
+  struct CLCResponse {};
+
+  class SharedStorage {
+  public:
+    CUTLASS_DEVICE PipelineStorage pipeline() { return PipelineStorage{}; }
+    CUTLASS_DEVICE ThrottlePipelineStorage throttle_pipeline() { return ThrottlePipelineStorage{}; }
+    CUTLASS_DEVICE CLCResponse* data() { return nullptr; }
+  };
+
+  using WorkTileInfo = typename UnderlyingScheduler::WorkTileInfo;
+
+  struct Arguments {
+    // Unused, kept for the launch grid computation of the persistent kernels
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongM;
+    // Extent of the M mode covered by one output slice, e.g. P * Q for 3D fprop. Zero if unknown.
+    int slice_extent_m = 0;
+    // Number of consecutive slices per work unit. If zero, the runs are chosen such that there are
+    // at least as many work units as SMs.
+    int slices_per_unit = 0;
+  };
+
+  struct Params : UnderlyingParams {
+    int32_t tiles_m_ = 0;
+    int32_t tiles_n_ = 0;
+    int32_t tiles_l_ = 0;
+    // M tiles per output slice, and number of slices of the deepest spatial block
+    int32_t slice_tiles_ = 1;
+    int32_t slices_ = 0;
+    // Consecutive slices per work unit, and number of such runs per spatial block
+    int32_t slices_per_unit_ = 1;
+    int32_t runs_ = 0;
+    uint64_t units_ = 0;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShapeMNKL>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments,
+      [[maybe_unused]] void* workspace = nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    auto [tiles_m, tiles_n, tiles_l] = cute::product_each(
+      cute::ceil_div(cute::select<0,1,3>(problem_shape_mnkl), cute::take<0,2>(tile_shape)));
+
+    Params params;
+    params.tiles_m_ = static_cast<int32_t>(tiles_m);
+    params.tiles_n_ = static_cast<int32_t>(tiles_n);
+    params.tiles_l_ = static_cast<int32_t>(tiles_l);
+
+    // Output slices that are not a multiple of the M tile are rounded down, the tiles of a spatial
+    // block then drift across slices but still cover neighboring slices
+    int32_t slice_tiles = arguments.slice_extent_m / static_cast<int32_t>(cute::size<0>(tile_shape));
+    params.slice_tiles_ = cute::max(1, cute::min(slice_tiles, params.tiles_m_));
+    params.slices_ = (params.tiles_m_ + params.slice_tiles_ - 1) / params.slice_tiles_;
+
+    int32_t strips = params.slice_tiles_ * params.tiles_l_;
+    int32_t slices_per_unit = arguments.slices_per_unit;
+    if (slices_per_unit <= 0) {
+      // Split the slices of every spatial block into runs until the units fill the device
+      slices_per_unit = params.slices_;
+      if (hw_info.sm_count > 0 && strips < hw_info.sm_count) {
+        slices_per_unit = cute::max(1, static_cast<int32_t>(
+          (int64_t(params.slices_) * strips) / hw_info.sm_count));
+      }
+    }
+    params.slices_per_unit_ = cute::min(slices_per_unit, cute::max(params.slices_, 1));
+    params.runs_ = (params.slices_ + params.slices_per_unit_ - 1) / params.slices_per_unit_;
+    params.units_ = uint64_t(strips) * uint64_t(params.runs_);
+    params.blocks_per_problem_ = uint64_t(tiles_m) * uint64_t(tiles_n) * uint64_t(tiles_l);
+    params.raster_order_ = RasterOrder::AlongM;
+    return params;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const&) {
+    return args.slice_extent_m >= 0 && args.slices_per_unit >= 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90TemporalStreaming() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90TemporalStreaming(Params const& params_) : scheduler_params(params_) {
+    // MSVC requires protecting use of CUDA-specific nonstandard syntax,
+    // like blockIdx and gridDim, with __CUDA_ARCH__.
+#if defined(__CUDA_ARCH__)
+    current_unit_ = uint64_t(blockIdx.x);
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+    current_step_ = 0;
+    skip_empty_units(current_unit_);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  // Returns the initial work tile info that will be computed over
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_work_for_unit_and_step(current_unit_, current_step_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_work_for_unit_and_step(uint64_t unit, uint32_t step) const {
+    if (unit >= scheduler_params.units_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    auto [l, run, strip, first_slice, slice_count] = decompose_unit(unit);
+    int32_t slice = first_slice + static_cast<int32_t>(step) / scheduler_params.tiles_n_;
+    int32_t n = static_cast<int32_t>(step) % scheduler_params.tiles_n_;
+    int32_t m = slice * scheduler_params.slice_tiles_ + strip;
+    return {m, n, l, true};
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    advance(current_unit_, current_step_, advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo const&, uint32_t advance_count = 1) const {
+    uint64_t unit = current_unit_;
+    uint32_t step = current_step_;
+    advance(unit, step, advance_count);
+    return not get_work_for_unit_and_step(unit, step).is_valid();
+  }
+
+  // Kernel helper function to get next work tile
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+  // Given the inputs, computes the physical grid we should launch: one CTA per work unit, at most
+  // one per SM
+  template <class ProblemShapeMNKL, class BlockShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+      Params const& params,
+      ProblemShapeMNKL,
+      BlockShape,
+      ClusterShape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size = true) {
+
+    uint64_t ctas = params.units_;
+    if (hw_info.sm_count > 0) {
+      ctas = cute::min(ctas, uint64_t(hw_info.sm_count));
+    }
+    return dim3(static_cast<uint32_t>(cute::max(ctas, uint64_t(1))), 1, 1);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&, Params const&) {
+    return true;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&) {
+    return true;
+  }
+
+  // Output tiles are not split, no reduction is needed
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(Params const&, WorkTileInfo const&, FrgTensorC&, uint32_t, uint32_t) {}
+
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const&, ProblemShape problem_shape, TileShape tile_shape) {
+    // All work units of this scheduler compute the entire K iteration space
+    return cute::size(cute::ceil_div(cute::get<2>(problem_shape), cute::get<2>(tile_shape)));
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const&) {
+    return 0;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const&) {
+    return true;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const&) {
+    return false;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
+    return 0;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void*, cudaStream_t, ProblemShape, KernelHardwareInfo const&,
+    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* = nullptr) {
+    return Status::kSuccess;
+  }
+
+private:
+  // Maps a work unit to its batch, run of slices, and M tile within a slice (strip), as well as the
+  // first slice and the number of slices of the unit. The spatial blocks of the last slice
+  // columns may have one slice less than the others when the M tiles do not fill the last slice.
+  CUTLASS_DEVICE
+  cute::tuple<int32_t, int32_t, int32_t, int32_t, int32_t>
+  decompose_unit(uint64_t unit) const {
+    uint64_t units_per_batch = uint64_t(scheduler_params.slice_tiles_) * uint64_t(scheduler_params.runs_);
+    int32_t l = static_cast<int32_t>(unit / units_per_batch);
+    int32_t unit_in_batch = static_cast<int32_t>(unit % units_per_batch);
+    int32_t run = unit_in_batch / scheduler_params.slice_tiles_;
+    int32_t strip = unit_in_batch % scheduler_params.slice_tiles_;
+
+    int32_t strip_slices = (scheduler_params.tiles_m_ - strip + scheduler_params.slice_tiles_ - 1) /
+                           scheduler_params.slice_tiles_;
+    int32_t first_slice = run * scheduler_params.slices_per_unit_;
+    int32_t last_slice = cute::min(first_slice + scheduler_params.slices_per_unit_, strip_slices);
+    return {l, run, strip, first_slice, cute::max(last_slice - first_slice, 0)};
+  }
+
+  CUTLASS_DEVICE
+  uint32_t
+  unit_tile_count(uint64_t unit) const {
+    return static_cast<uint32_t>(cute::get<4>(decompose_unit(unit)) * scheduler_params.tiles_n_);
+  }
+
+  // Moves past the units without tiles, which only occur in the last run of a spatial block
+  CUTLASS_DEVICE
+  void
+  skip_empty_units(uint64_t& unit) const {
+    while (unit < scheduler_params.units_ && unit_tile_count(unit) == 0) {
+      unit += total_grid_size_;
+    }
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance(uint64_t& unit, uint32_t& step, uint32_t advance_count) const {
+    for (uint32_t i = 0; i < advance_count && unit < scheduler_params.units_; ++i) {
+      if (++step >= unit_tile_count(unit)) {
+        step = 0;
+        unit += total_grid_size_;
+        skip_empty_units(unit);
+      }
+    }
+  }
+
+public:
+  // Sink scheduler params as a member
+  Params scheduler_params;
+
+private:
+  uint64_t current_unit_ = 0;
+  uint32_t current_step_ = 0;
+  uint64_t total_grid_size_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
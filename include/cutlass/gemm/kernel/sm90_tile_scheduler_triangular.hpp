@@ -0,0 +1,387 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cute/layout.hpp"
+#include "cute/tensor.hpp"
+
+namespace cutlass::gemm::kernel::detail {
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Persistent Thread Block (TB) scheduler for the BLAS3 operations whose output or operand A is
+// triangular, on top of the GEMM kernels.
+//
+// BlasMode::kSymmetric (SYRK, C = A * A^T with B = A): only the output tiles of a square (M, N)
+// tile grid that intersect the Fill triangle of C are scheduled, i.e. 1/2 + 1/(2 * tiles_m) of the
+// GEMM tiles. The tiles are handed out row by row of the
+// triangle. Diagonal tiles are computed and stored in full, so the elements of the opposite
+// triangle inside the diagonal tiles are overwritten with the symmetric result. HERK (C = A * A^H)
+// is not supported: it needs B = conj(A) from the mainloop and a real diagonal, which the GEMM
+// kernels do not provide.
+//
+// BlasMode::kTriangular (TRMM with a triangular A on the left, C = A * B with M == K): all output
+// tiles are scheduled, and each one only visits the K tiles that intersect the Fill triangle of its
+// rows of A. Since the cost of a tile grows with its number of K tiles, the M tiles with the
+// longest K range are handed out first, across all batches, so that the short tiles fill the tail
+// of the last wave. The K tiles that straddle the diagonal are read as stored, so the elements of
+// A in the opposite triangle within TileM of the diagonal must be zero. A with a triangle on the
+// right is a TRMM of the transposed problem, and is expressed by swapping the operands and strides.
+template <
+  class TileShape,
+  class ClusterShape,
+  BlasMode Mode,
+  FillMode Fill
+>
+class PersistentTileSchedulerSm90Triangular {
+private:
+  using UnderlyingScheduler = PersistentTileSchedulerSm90;
+  using UnderlyingParams = typename UnderlyingScheduler::Params;
+
+public:
+  static constexpr bool IsRankK = Mode == BlasMode::kSymmetric;
+  static constexpr bool IsTriangularA = Mode == BlasMode::kTriangular;
+
+  static_assert(IsRankK || IsTriangularA,
+    "The triangular scheduler supports BlasMode::kSymmetric and kTriangular.");
+  static_assert(Fill == FillMode::kLower || Fill == FillMode::kUpper,
+    "The triangular scheduler supports FillMode::kLower and kUpper.");
+  static_assert(cute::size(ClusterShape{}) == 1,
+    "The triangular scheduler requires a cluster shape of (1, 1, 1).");
+  static_assert(!IsRankK || cute::size<0>(TileShape{}) == cute::size<1>(TileShape{}),
+    "Rank-k updates require square output tiles.");
+
+  using RasterOrder = UnderlyingScheduler::RasterOrder;
+  using RasterOrderOptions = UnderlyingScheduler::RasterOrderOptions;
+  static constexpr bool IsDynamicPersistent = false;
+
+  using Pipeline = PipelineEmpty;
+  using PipelineStorage = typename Pipeline::SharedStorage;
+  using ThrottlePipeline = PipelineEmpty;
+  using ThrottlePipelineStorage = typename ThrottlePipeline::SharedStorage;
+  struct CLCResponse {};
+
+  class SharedStorage {
+  public:
+    CUTLASS_DEVICE PipelineStorage pipeline() { return PipelineStorage{}; }
+    CUTLASS_DEVICE ThrottlePipelineStorage throttle_pipeline() { return ThrottlePipelineStorage{}; }
+    CUTLASS_DEVICE CLCResponse* data() { return nullptr; }
+  };
+
+  using WorkTileInfo = typename UnderlyingScheduler::WorkTileInfo;
+
+  struct Arguments {
+    // Unused, kept for the launch grid computation of the persistent kernels
+    int max_swizzle_size = 1;
+    RasterOrderOptions raster_order = RasterOrderOptions::AlongM;
+  };
+
+  struct Params : UnderlyingParams {
+    int32_t tiles_m_ = 0;
+    int32_t tiles_n_ = 0;
+    int32_t tiles_l_ = 0;
+    // Scheduled tiles per batch
+    uint64_t tiles_per_batch_ = 0;
+  };
+
+  //
+  // Methods
+  //
+
+  template <class ProblemShapeMNKL>
+  static Params
+  to_underlying_arguments(
+      ProblemShapeMNKL problem_shape_mnkl,
+      TileShape tile_shape,
+      ClusterShape,
+      [[maybe_unused]] KernelHardwareInfo const& hw_info,
+      [[maybe_unused]] Arguments const& arguments,
+      [[maybe_unused]] void* workspace = nullptr,
+      [[maybe_unused]] const uint32_t epilogue_subtile = 1,
+      [[maybe_unused]] uint32_t ktile_start_alignment_count = 1u) {
+
+    static_assert(cute::is_static<TileShape>::value);
+
+    auto [tiles_m, tiles_n, tiles_l] = cute::product_each(
+      cute::ceil_div(cute::select<0,1,3>(problem_shape_mnkl), cute::take<0,2>(tile_shape)));
+
+    Params params;
+    params.tiles_m_ = static_cast<int32_t>(tiles_m);
+    params.tiles_n_ = static_cast<int32_t>(tiles_n);
+    params.tiles_l_ = static_cast<int32_t>(tiles_l);
+    if constexpr (IsRankK) {
+      // The output of a rank-k update is square, a non-square grid is clamped to its square part
+      uint64_t tiles = uint64_t(cute::min(params.tiles_m_, params.tiles_n_));
+      params.tiles_per_batch_ = tiles * (tiles + 1) / 2;
+    }
+    else {
+      params.tiles_per_batch_ = uint64_t(params.tiles_m_) * uint64_t(params.tiles_n_);
+    }
+    params.blocks_per_problem_ = params.tiles_per_batch_ * uint64_t(params.tiles_l_);
+    params.raster_order_ = RasterOrder::AlongM;
+    return params;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  can_implement(Arguments const& args, KernelHardwareInfo const&) {
+    return args.max_swizzle_size >= 0;
+  }
+
+  CUTLASS_HOST_DEVICE
+  PersistentTileSchedulerSm90Triangular() { }
+
+  CUTLASS_DEVICE explicit PersistentTileSchedulerSm90Triangular(Params const& params_) : scheduler_params(params_) {
+    // MSVC requires protecting use of CUDA-specific nonstandard syntax,
+    // like blockIdx and gridDim, with __CUDA_ARCH__.
+#if defined(__CUDA_ARCH__)
+    current_work_linear_idx_ = uint64_t(blockIdx.x);
+    total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+#else
+    CUTLASS_ASSERT(false && "This line should never be reached");
+#endif
+  }
+
+  // Returns the initial work tile info that will be computed over
+  CUTLASS_DEVICE
+  WorkTileInfo
+  initial_work_tile_info(ClusterShape) {
+    return get_current_work();
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work() const {
+    return get_current_work_for_linear_idx(current_work_linear_idx_);
+  }
+
+  CUTLASS_DEVICE
+  WorkTileInfo
+  get_current_work_for_linear_idx(uint64_t linear_idx) const {
+    if (linear_idx >= scheduler_params.blocks_per_problem_) {
+      return WorkTileInfo::invalid_work_tile();
+    }
+
+    if constexpr (IsRankK) {
+      int32_t l = static_cast<int32_t>(linear_idx / scheduler_params.tiles_per_batch_);
+      uint64_t idx = linear_idx % scheduler_params.tiles_per_batch_;
+      auto [row, col] = triangle_row_and_col(idx);
+      // Row `row` of the lower triangle holds the tiles (row, 0 ... row), the upper triangle is its transpose
+      if constexpr (Fill == FillMode::kLower) {
+        return {row, col, l, true};
+      }
+      else {
+        return {col, row, l, true};
+      }
+    }
+    else {
+      // M tiles ordered by decreasing K range, the batches and N tiles of an M tile are adjacent
+      uint64_t tiles_nl = uint64_t(scheduler_params.tiles_n_) * uint64_t(scheduler_params.tiles_l_);
+      int32_t rank_m = static_cast<int32_t>(linear_idx / tiles_nl);
+      uint64_t idx_nl = linear_idx % tiles_nl;
+      int32_t n = static_cast<int32_t>(idx_nl % uint64_t(scheduler_params.tiles_n_));
+      int32_t l = static_cast<int32_t>(idx_nl / uint64_t(scheduler_params.tiles_n_));
+      int32_t m = (Fill == FillMode::kLower) ? scheduler_params.tiles_m_ - 1 - rank_m : rank_m;
+      return {m, n, l, true};
+    }
+  }
+
+  CUTLASS_DEVICE
+  void
+  advance_to_next_work(uint32_t advance_count = 1) {
+    current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+  }
+
+  CUTLASS_DEVICE
+  bool
+  is_last_tile(WorkTileInfo const&, uint32_t advance_count = 1) const {
+    return not get_current_work_for_linear_idx(
+      current_work_linear_idx_ + total_grid_size_ * uint64_t(advance_count)
+    ).is_valid();
+  }
+
+  // Kernel helper function to get next work tile
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(WorkTileInfo) {
+    advance_to_next_work();
+    return cute::make_tuple(get_current_work(), true);
+  }
+
+  template <class TileSchedulerPipeline, class TileSchedulerPipelineState>
+  CUTLASS_DEVICE
+  auto
+  fetch_next_work(
+      WorkTileInfo work_tile_info,
+      TileSchedulerPipeline&,
+      TileSchedulerPipelineState) {
+    return fetch_next_work(work_tile_info);
+  }
+
+  // Given the inputs, computes the physical grid we should launch: one CTA per scheduled tile,
+  // at most one per SM
+  template <class ProblemShapeMNKL, class BlockShape>
+  CUTLASS_HOST_DEVICE static
+  dim3
+  get_grid_shape(
+      Params const& params,
+      ProblemShapeMNKL,
+      BlockShape,
+      ClusterShape,
+      KernelHardwareInfo hw_info,
+      [[maybe_unused]] Arguments arguments = Arguments{},
+      [[maybe_unused]] bool truncate_by_problem_size = true) {
+
+    uint64_t ctas = params.blocks_per_problem_;
+    if (hw_info.sm_count > 0) {
+      ctas = cute::min(ctas, uint64_t(hw_info.sm_count));
+    }
+    return dim3(static_cast<uint32_t>(cute::max(ctas, uint64_t(1))), 1, 1);
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&, Params const&) {
+    return true;
+  }
+
+  CUTLASS_HOST_DEVICE
+  static bool
+  compute_epilogue(WorkTileInfo const&) {
+    return true;
+  }
+
+  // Output tiles are not split, no reduction is needed
+  template <class FrgTensorC>
+  CUTLASS_DEVICE
+  static void
+  fixup(Params const&, WorkTileInfo const&, FrgTensorC&, uint32_t, uint32_t) {}
+
+  CUTLASS_DEVICE
+  static bool
+  continue_current_work(WorkTileInfo&) {
+    return false;
+  }
+
+  // Number of K tiles of the work tile, which for a triangular A ends (kLower) or starts (kUpper)
+  // at the K tile holding the last (first) diagonal element of the rows of the tile
+  template <class ProblemShape>
+  CUTLASS_HOST_DEVICE
+  static int
+  get_work_k_tile_count(WorkTileInfo const& work_tile_info, ProblemShape problem_shape, TileShape tile_shape) {
+    int k_tiles = cute::size(cute::ceil_div(cute::get<2>(problem_shape), cute::get<2>(tile_shape)));
+    if constexpr (IsTriangularA) {
+      constexpr int TileM = cute::size<0>(TileShape{});
+      constexpr int TileK = cute::size<2>(TileShape{});
+      if constexpr (Fill == FillMode::kLower) {
+        return cute::min(k_tiles, ((work_tile_info.M_idx + 1) * TileM + TileK - 1) / TileK);
+      }
+      else {
+        return cute::max(k_tiles - static_cast<int>(get_work_k_tile_start(work_tile_info)), 0);
+      }
+    }
+    else {
+      return k_tiles;
+    }
+  }
+
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_work_k_tile_start(WorkTileInfo const& work_tile_info) {
+    if constexpr (IsTriangularA && Fill == FillMode::kUpper) {
+      constexpr int TileM = cute::size<0>(TileShape{});
+      constexpr int TileK = cute::size<2>(TileShape{});
+      return static_cast<uint32_t>((work_tile_info.M_idx * TileM) / TileK);
+    }
+    else {
+      return 0;
+    }
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  valid_warpgroup_in_work_tile(WorkTileInfo const&) {
+    return true;
+  }
+
+  CUTLASS_DEVICE
+  static bool
+  requires_separate_reduction(Params const&) {
+    return false;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static size_t
+  get_workspace_size(Arguments const&, ProblemShape, KernelHardwareInfo const&, uint32_t, const uint32_t = 1, uint32_t = 1) {
+    return 0;
+  }
+
+  template <class ProblemShape, class ElementAccumulator>
+  static cutlass::Status
+  initialize_workspace(Arguments const&, void*, cudaStream_t, ProblemShape, KernelHardwareInfo const&,
+    uint32_t, const uint32_t = 1, uint32_t = 1, CudaHostAdapter* = nullptr) {
+    return Status::kSuccess;
+  }
+
+private:
+  // Maps the index of a tile in the row-major order of a lower triangle to its row and column,
+  // i.e. the row r with r * (r + 1) / 2 <= idx < (r + 1) * (r + 2) / 2
+  CUTLASS_DEVICE
+  static cute::tuple<int32_t, int32_t>
+  triangle_row_and_col(uint64_t idx) {
+    // The floating-point estimate is off by at most one for large indices
+    int64_t row = static_cast<int64_t>((fast_sqrt(8.0 * static_cast<double>(idx) + 1.0) - 1.0) * 0.5);
+    if (uint64_t(row) * uint64_t(row + 1) / 2 > idx) {
+      --row;
+    }
+    else if (uint64_t(row + 1) * uint64_t(row + 2) / 2 <= idx) {
+      ++row;
+    }
+    int64_t col = static_cast<int64_t>(idx - uint64_t(row) * uint64_t(row + 1) / 2);
+    return {static_cast<int32_t>(row), static_cast<int32_t>(col)};
+  }
+
+public:
+  // Sink scheduler params as a member
+  Params scheduler_params;
+
+private:
+  uint64_t current_work_linear_idx_ = 0;
+  uint64_t total_grid_size_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel::detail
@@ -50,6 +50,7 @@ class StaticPersistentTileScheduler {
 private:
   uint64_t current_work_linear_idx_;
   uint64_t total_grid_size_;
+  TileSchedulerTelemetryRecorder telemetry_;
 
 public:
   struct WorkTileInfo {
@@ -86,12 +87,28 @@ public:
   using Params = PersistentTileSchedulerSm90Params;
   using RasterOrder = typename Params::RasterOrder;
   using RasterOrderOptions = typename Params::RasterOrderOptions;
+  using TileOrder = typename Params::TileOrder;
   static constexpr bool IsDynamicPersistent = false;
 
 public:
   struct Arguments {
     int max_swizzle_size = 1;
     RasterOrderOptions raster_order = RasterOrderOptions::Heuristic;
+    // Width in bits of the elements of A and B, used by RasterOrderOptions::L2Aware to estimate
+    // the operand footprint of a tile
+    int operand_element_bits = 16;
+    // If set, points to the (M, N) extents of the problem in device memory, e.g. a token count produced
+    // by a preceding kernel. They are read at kernel start, and the problem shape passed on the host is
+    // the maximum problem shape: the grid is sized for it, TMA descriptors and buffers must cover it, and
+    // the tiles beyond (M, N) up to the next whole swizzle of clusters, or whole super-tile of the L2-aware
+    // and Morton orders, may be computed and stored within the maximum problem shape. K, L, and all
+    // strides are taken from the host problem shape. The extents must be written before the kernel starts,
+    // i.e. before the launch when using programmatic dependent launch. Super-tile orders are sized for
+    // the maximum problem shape.
+    int const* device_problem_shape_mn = nullptr;
+    // If set, points to one entry per CTA of the grid receiving the work processed by the CTA. Only
+    // recorded if CUTLASS_ENABLE_TILE_SCHEDULER_TELEMETRY is defined.
+    TileSchedulerTelemetry* telemetry = nullptr;
   };
 
   template <class ProblemShapeMNKL, class TileShape, class ClusterShape>
@@ -120,14 +137,68 @@ public:
       arguments.max_swizzle_size,
       arguments.raster_order
     );
+    initialize_tile_order(
+      params,
+      problem_blocks,
+      problem_shape_mnkl,
+      cute::size<0>(tile_shape),
+      cute::size<1>(tile_shape),
+      to_gemm_coord(cluster_shape),
+      hw_info,
+      arguments
+    );
+    initialize_telemetry(params, problem_shape_mnkl, cute::size<2>(tile_shape), arguments);
 
     return params;
   }
 
+  // Sets up the per-CTA work accounting of Arguments::telemetry for output tiles of cta_tile_k along K
+  template <class ProblemShapeMNKL>
+  static void
+  initialize_telemetry(
+      Params& params,
+      ProblemShapeMNKL problem_shape_mnkl,
+      int cta_tile_k,
+      Arguments const& arguments) {
+    params.telemetry_ = arguments.telemetry;
+    params.telemetry_k_tiles_ = static_cast<uint32_t>(
+      (cute::size(cute::get<2>(problem_shape_mnkl)) + cta_tile_k - 1) / cta_tile_k);
+  }
+
+  // Sets up the super-tile orders of RasterOrderOptions::L2Aware and RasterOrderOptions::Morton
+  // from the operand footprint of a CTA tile of cta_tile_m x cta_tile_n, or the tile space restriction
+  // of Arguments::device_problem_shape_mn
+  template <class ProblemShapeMNKL>
+  static void
+  initialize_tile_order(
+      Params& params,
+      dim3 problem_blocks,
+      ProblemShapeMNKL problem_shape_mnkl,
+      int cta_tile_m,
+      int cta_tile_n,
+      GemmCoord cluster_shape,
+      KernelHardwareInfo const& hw_info,
+      Arguments const& arguments) {
+    if (arguments.device_problem_shape_mn != nullptr) {
+      // The super-tiles are sized for the maximum problem, restrict_problem_shape() keeps their size
+      params.initialize_device_problem_shape(arguments.device_problem_shape_mn, cta_tile_m, cta_tile_n);
+    }
+    uint64_t bytes_per_k = (static_cast<uint64_t>(cute::size(cute::get<2>(problem_shape_mnkl))) *
+                            static_cast<uint64_t>(arguments.operand_element_bits) + 7) / 8;
+    params.initialize_tile_order(
+      problem_blocks,
+      cluster_shape,
+      hw_info,
+      arguments.raster_order,
+      bytes_per_k * cta_tile_m,
+      bytes_per_k * cta_tile_n
+    );
+  }
+
   CUTLASS_HOST_DEVICE
   static bool
   can_implement(Arguments const& args, KernelHardwareInfo const&) {
-    return args.max_swizzle_size >= 0;
+    return args.max_swizzle_size >= 0 && args.operand_element_bits > 0;
   }
 
   CUTLASS_HOST_DEVICE
@@ -145,6 +216,12 @@ public:
     }
 
     total_grid_size_ = uint64_t(gridDim.x) * uint64_t(gridDim.y) * uint64_t(gridDim.z);
+
+    if (scheduler_params.device_problem_shape_mn_ != nullptr) {
+      scheduler_params.restrict_problem_shape(
+        scheduler_params.device_problem_shape_mn_[0], scheduler_params.device_problem_shape_mn_[1]);
+    }
+    telemetry_.begin(scheduler_params.telemetry_);
 #else
     CUTLASS_ASSERT(false && "This line should never be reached");
 #endif
@@ -176,6 +253,9 @@ public:
     scheduler_params.divmod_batch_(work_idx_l, remainder, linear_idx);
 
     uint64_t blk_per_grid_dim = scheduler_params.divmod_cluster_shape_minor_.divide(remainder);
+    if (scheduler_params.tile_order_ != TileOrder::Swizzle) {
+      blk_per_grid_dim = get_super_tile_blk_per_grid_dim(blk_per_grid_dim);
+    }
 
     auto [work_idx_m, work_idx_n] = Subclass::get_work_idx_m_and_n(blk_per_grid_dim,
                                                          scheduler_params.divmod_cluster_shape_major_,
@@ -187,10 +267,52 @@ public:
     return {work_idx_m, work_idx_n, static_cast<int32_t>(work_idx_l), true};
   }
 
+  // Maps blk_per_grid_dim of the super-tile orders to that of the unswizzled raster order, which
+  // get_work_idx_m_and_n() turns into tile coordinates since log_swizzle_size_ is 0 for these orders
+  CUTLASS_DEVICE
+  uint64_t
+  get_super_tile_blk_per_grid_dim(uint64_t blk_per_grid_dim) const {
+    uint64_t cluster_id, cluster_major_offset;
+    scheduler_params.divmod_cluster_shape_major_(cluster_id, cluster_major_offset, blk_per_grid_dim);
+
+    uint64_t cluster_idx_minor, cluster_idx_major, stripe;
+    if (scheduler_params.tile_order_ == TileOrder::Morton) {
+      int32_t log_size = scheduler_params.log_super_tile_size_;
+      uint64_t code = cluster_id & ((uint64_t(1) << (2 * log_size)) - 1);
+      uint64_t super_tile_major;
+      scheduler_params.divmod_super_tile_(stripe, super_tile_major, cluster_id >> (2 * log_size));
+
+      // Even bits of the Morton code index the minor mode, odd bits the major mode
+      uint64_t minor_in_super_tile = 0, major_in_super_tile = 0;
+      for (int32_t i = 0; i < log_size; ++i) {
+        minor_in_super_tile |= ((code >> (2 * i)) & 1) << i;
+        major_in_super_tile |= ((code >> (2 * i + 1)) & 1) << i;
+      }
+      cluster_idx_minor = (stripe << log_size) + minor_in_super_tile;
+      cluster_idx_major = (super_tile_major << log_size) + major_in_super_tile;
+    }
+    else {
+      uint64_t extra, offset;
+      scheduler_params.divmod_super_tile_(extra, offset, cluster_id);
+      scheduler_params.divmod_cluster_blk_major_(stripe, cluster_idx_major, extra);
+      cluster_idx_minor = stripe * scheduler_params.divmod_super_tile_.divisor + offset;
+    }
+
+    uint64_t raster_cluster_id = cluster_idx_minor * scheduler_params.divmod_cluster_blk_major_.divisor + cluster_idx_major;
+    return raster_cluster_id * scheduler_params.divmod_cluster_shape_major_.divisor + cluster_major_offset;
+  }
+
   CUTLASS_DEVICE
   void
   advance_to_next_work(uint32_t advance_count = 1) {
+    // Kernels advance past every tile they processed, either directly or through fetch_next_work()
+    if (current_work_linear_idx_ < scheduler_params.blocks_per_problem_) {
+      telemetry_.record(scheduler_params.telemetry_k_tiles_);
+    }
     current_work_linear_idx_ += total_grid_size_ * uint64_t(advance_count);
+    if (current_work_linear_idx_ >= scheduler_params.blocks_per_problem_) {
+      telemetry_.end();
+    }
   }
 
   CUTLASS_DEVICE
@@ -36,6 +36,7 @@
 */
 
 #include "cutlass/arch/arch.h"
+#include "cutlass/blas3_types.h"
 #include "cutlass/detail/dependent_false.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -52,10 +53,37 @@ struct StreamKScheduler { };
 
 struct GroupScheduler { }; // Only used for Grouped GEMMs
 
+// Only used for Grouped GEMMs, splits the K mode of the output tiles that do not fill a wave
+struct GroupStreamKScheduler : GroupScheduler { };
+
 struct DynamicPersistentScheduler { };
 
 struct StaticPersistentScheduler { };
 
+// Dynamic persistent scheduler handing out tiles from a cost-ordered work queue, SM100 only
+struct WorkQueueScheduler { };
+
+// Splits the K mode of every output tile across the CTAs of a (1, 1, Splits) cluster and reduces
+// the partials through distributed shared memory, SM90 only
+struct ClusterSplitKScheduler { };
+
+// Walks the output of an implicit GEMM convolution slice by slice along its outermost spatial mode
+// inside every CTA, so that the input slices shared by consecutive output slices are reused from L2,
+// SM90 only
+struct TemporalStreamingScheduler { };
+
+// Schedules the output tiles of the BLAS3 operations with a triangular output or operand A:
+// the tiles of the Fill triangle of C for kSymmetric (SYRK), and all tiles with
+// the K range restricted to the Fill triangle of A for kTriangular (TRMM, cooperative kernel only),
+// SM90 only. On SM100, rank-k updates use the WorkQueueScheduler with populate_triangular_work_queue().
+template <BlasMode Mode, FillMode Fill>
+struct TriangularScheduler { };
+
+// Schedules the nonzero blocks of a block sparse (BSR) A from a device array of work units, with
+// long block rows split into several units reduced in order (cooperative kernel with the
+// MainloopSm90TmaGmmaWarpSpecializedBlockSparse mainloop only), SM90 only
+struct BlockSparseScheduler { };
+
 } // namespace cutlass::gemm
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -63,10 +91,16 @@ struct StaticPersistentScheduler { };
 #include "cutlass/gemm/kernel/sm100_static_tile_scheduler.hpp" 
 
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_stream_k.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_cluster_split_k.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_temporal_streaming.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_triangular.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_block_sparse.hpp"
 #include "cutlass/gemm/kernel/sm90_tile_scheduler_group.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_group_stream_k.hpp"
 #include "cutlass/gemm/kernel/sm100_tile_scheduler.hpp"            
 #include "cutlass/gemm/kernel/sm100_tile_scheduler_stream_k.hpp"   
 #include "cutlass/gemm/kernel/sm100_tile_scheduler_group.hpp"      
+#include "cutlass/gemm/kernel/sm100_tile_scheduler_work_queue.hpp"
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::gemm::kernel::detail {
@@ -142,6 +176,68 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90StreamK<TileShape, ClusterShape>;
 };
 
+template <
+  class TileShape,
+  class ClusterShape
+  , uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    ClusterSplitKScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90ClusterSplitK<TileShape, ClusterShape>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+  , uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    TemporalStreamingScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90TemporalStreaming<TileShape, ClusterShape>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape,
+  BlasMode Mode,
+  FillMode Fill
+  , uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    TriangularScheduler<Mode, Fill>,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90Triangular<TileShape, ClusterShape, Mode, Fill>;
+};
+
+template <
+  class TileShape,
+  class ClusterShape
+  , uint32_t SchedulerPipelineStageCount
+>
+struct TileSchedulerSelector<
+    BlockSparseScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+  > {
+  using Scheduler = PersistentTileSchedulerSm90BlockSparse<TileShape, ClusterShape>;
+};
+
 template <
   class ArchTag,
   class TileShape,
@@ -175,6 +271,23 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount>;
 };
 
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    GroupStreamKScheduler,
+    arch::Sm90,
+    TileShape,
+    ClusterShape
+    , SchedulerPipelineStageCount
+    , GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupStreamK<GroupProblemShape, TileShape, SchedulerPipelineStageCount>;
+};
+
 template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
 struct TileSchedulerSelector<
     PersistentScheduler,
@@ -284,6 +397,31 @@ struct TileSchedulerSelector<
                         SchedulerPipelineStageCount>;
 };
 
+// SM100 work-queue tile scheduler
+template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
+struct TileSchedulerSelector<
+    WorkQueueScheduler,
+    arch::Sm100,
+    TileShape,
+    ClusterShape,
+    SchedulerPipelineStageCount> {
+  using Scheduler = PersistentTileSchedulerSm100WorkQueue<
+                        ClusterShape,
+                        SchedulerPipelineStageCount>;
+};
+
+template <class TileShape, class ClusterShape, uint32_t SchedulerPipelineStageCount>
+struct TileSchedulerSelector<
+    WorkQueueScheduler,
+    arch::Sm103,
+    TileShape,
+    ClusterShape,
+    SchedulerPipelineStageCount> {
+  using Scheduler = PersistentTileSchedulerSm100WorkQueue<
+                        ClusterShape,
+                        SchedulerPipelineStageCount>;
+};
+
 template <
   class TileShape,
   class ClusterShape,
@@ -416,6 +554,39 @@ struct TileSchedulerSelector<
   using Scheduler = PersistentTileSchedulerSm90Group<GroupProblemShape, SchedulerPipelineStageCount>;
 };
 
+// GroupStreamKScheduler for Sm120 maps to PersistentTileSchedulerSm90GroupStreamK, since the
+// Sm120 ptr-array kernels reuse the Sm90 ptr-array kernels and their register accumulator fixup
+template <
+  class TileShape,
+  class ClusterShape,
+  uint32_t SchedulerPipelineStageCount,
+  class GroupProblemShape
+>
+struct TileSchedulerSelector<
+    GroupStreamKScheduler,
+    arch::Sm120,
+    TileShape,
+    ClusterShape,
+    SchedulerPipelineStageCount,
+    GroupProblemShape
+  > {
+  using Scheduler = PersistentTileSchedulerSm90GroupStreamK<GroupProblemShape, TileShape, SchedulerPipelineStageCount>;
+};
+
+// Whether a scheduler tag restricts the K range of its tiles, which kernels that advance their
+// mainloop pipeline by a fixed number of K tiles per tile do not support
+template <class TileSchedulerTag>
+struct is_k_range_restricted_scheduler : cute::false_type {};
+
+template <FillMode Fill>
+struct is_k_range_restricted_scheduler<TriangularScheduler<BlasMode::kTriangular, Fill>> : cute::true_type {};
+
+template <>
+struct is_k_range_restricted_scheduler<BlockSparseScheduler> : cute::true_type {};
+
+template <class TileSchedulerTag>
+constexpr bool is_k_range_restricted_scheduler_v = is_k_range_restricted_scheduler<TileSchedulerTag>::value;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 } // namespace cutlass::gemm::kernel::detail
@@ -43,7 +43,34 @@ enum class RasterOrder {
 enum class RasterOrderOptions {
   Heuristic,
   AlongM,
-  AlongN
+  AlongN,
+
+  // Clusters are visited in stripes along the heuristic raster order, as with the power-of-two
+  // swizzle, but the height of the stripes is chosen from the L2 capacity and the operand footprint
+  // of a tile: the minor-mode operands of a stripe and the major-mode operands of a wave are kept
+  // resident in L2 while the wave moves along the stripe. max_swizzle_size is ignored.
+  L2Aware,
+
+  // Clusters are visited along a Morton (Z-order) curve within square super-tiles of about one
+  // wave, and the super-tiles are visited in stripes along the heuristic raster order.
+  // max_swizzle_size is ignored.
+  //
+  // L2Aware and Morton are implemented by the data-parallel static persistent schedulers of SM90 and
+  // SM100. The SM100 CLC scheduler rejects them in can_implement(), and the stream-K and grouped
+  // schedulers treat them as Heuristic.
+  Morton
+};
+
+// Order of the clusters within the raster order of a problem, set up from RasterOrderOptions
+enum class TileOrder {
+  // Stripes of power-of-two height, see max_swizzle_size
+  Swizzle,
+
+  // Stripes of arbitrary height sized from the L2 capacity, see RasterOrderOptions::L2Aware
+  SuperTile,
+
+  // Morton order within square super-tiles, see RasterOrderOptions::Morton
+  Morton
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -66,7 +93,33 @@ enum class ReductionMode {
   // Due to the nondeterminsitic ordering of accumulation, deterministic numeric behavior cannot
   // be guaranteed with this mode (e.g., floating-point rounding error will depend on the order
   // of accumulation)
-  Nondeterministic
+  Nondeterministic,
+
+  // All participating CTAs but the final one add their partial values to a zero-initialized
+  // workspace with vectorized atomic reductions (red.global.add.v4.f32 on SM90 and newer),
+  // without waiting for each other. The only lock wait is that of the final CTA for all others
+  // to have accumulated.
+  //
+  // As with Nondeterministic, deterministic numeric behavior cannot be guaranteed with this mode.
+  // The reduction workspace is cleared along with the barrier workspace when initializing it.
+  Atomic
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Orders in which the grouped GEMM schedulers hand out the tiles of the groups
+enum class GroupOrder {
+  // Tiles are handed out group by group, in the order of the problem shapes
+  InOrder,
+
+  // Groups are visited in decreasing order of the K depth of their tiles, each CTA computing
+  // this order on device from the problem shapes. Groups whose number of K tiles has the same
+  // floor(log2) are visited together in the order of the problem shapes.
+  //
+  // The most expensive tiles are handed out first and the last wave only holds the cheapest ones,
+  // which balances the tail of problem sets with widely varying K (e.g., MoE layers) without
+  // sorting the problems on the host.
+  LongestKFirst
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@
 #include "cutlass/fast_math.h"
 #include "cutlass/gemm_coord.h"
 #include "cutlass/gemm/kernel/tile_scheduler_detail.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_telemetry.hpp"
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass {
@@ -77,6 +78,25 @@ get_max_cta_occupancy(int max_sm_per_gpc, GemmCoord cluster_shape, int sm_count)
   return cta_per_device;
 }
 
+// Restricts the hardware info used for sizing a persistent grid to the CTA budget of the kernel.
+// The budget is rounded down to whole clusters (but is at least one cluster) and bounds both the
+// SM count and the number of active clusters, so that persistent kernels co-located on the device
+// never keep more than their budget of CTAs resident. The placement of the CTAs is left to the
+// hardware; use a green context to pin a kernel to a fixed set of SMs.
+CUTLASS_HOST_DEVICE
+static KernelHardwareInfo
+get_partitioned_hw_info(KernelHardwareInfo hw_info, int cluster_size) {
+  if (hw_info.cta_budget <= 0) {
+    return hw_info;
+  }
+  int const cta_budget = platform::max(cluster_size, hw_info.cta_budget - (hw_info.cta_budget % cluster_size));
+  hw_info.sm_count = hw_info.sm_count > 0 ? platform::min(hw_info.sm_count, cta_budget) : cta_budget;
+  if (hw_info.max_active_clusters > 0) {
+    hw_info.max_active_clusters = platform::min(hw_info.max_active_clusters, cta_budget / cluster_size);
+  }
+  return hw_info;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 //
@@ -87,6 +107,7 @@ get_max_cta_occupancy(int max_sm_per_gpc, GemmCoord cluster_shape, int sm_count)
 struct PersistentTileSchedulerSm90Params {
   using RasterOrder = cutlass::gemm::kernel::detail::RasterOrder;
   using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+  using TileOrder = cutlass::gemm::kernel::detail::TileOrder;
 
   FastDivmodU64Pow2 divmod_cluster_shape_major_{};
   FastDivmodU64Pow2 divmod_cluster_shape_minor_{};
@@ -97,12 +118,29 @@ struct PersistentTileSchedulerSm90Params {
   int32_t log_swizzle_size_ = 0;
   RasterOrder raster_order_ = RasterOrder::AlongN;
 
+  // Super-tile orders, set up by initialize_tile_order(). For TileOrder::SuperTile, divmod_super_tile_
+  // holds the height of the stripes in clusters. For TileOrder::Morton, it holds the number of super-tiles
+  // along the major mode, whose side is (1 << log_super_tile_size_) clusters.
+  TileOrder tile_order_ = TileOrder::Swizzle;
+  FastDivmodU64 divmod_super_tile_{};
+  int32_t log_super_tile_size_ = 0;
+
   uint32_t problem_tiles_m_ = 0;
   uint32_t problem_tiles_n_ = 0;
   uint32_t problem_tiles_l_ = 0;
   uint32_t cluster_shape_m_ = 0;
   uint32_t cluster_shape_n_ = 0;
 
+  // (M, N) extents of the problem in device memory, set up by initialize_device_problem_shape().
+  // When set, the scheduler restricts the tile space to these extents at kernel start.
+  int const* device_problem_shape_mn_ = nullptr;
+  uint32_t cta_tile_m_ = 0;
+  uint32_t cta_tile_n_ = 0;
+
+  // Per-CTA work accounting, and the number of K tiles of an output tile accounted for every tile
+  TileSchedulerTelemetry* telemetry_ = nullptr;
+  uint32_t telemetry_k_tiles_ = 0;
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -124,6 +162,70 @@ struct PersistentTileSchedulerSm90Params {
     );
   }
 
+  // Reads the (M, N) extents of the problem from device_problem_shape_mn at kernel start. The problem
+  // shape passed to initialize() is then the maximum problem shape, for which the grid is launched.
+  // Must be called after initialize(). cta_tile_m and cta_tile_n are the extents of a CTA tile.
+  void
+  initialize_device_problem_shape(
+    int const* device_problem_shape_mn,
+    uint32_t cta_tile_m,
+    uint32_t cta_tile_n
+  ) {
+    device_problem_shape_mn_ = device_problem_shape_mn;
+    cta_tile_m_ = cta_tile_m;
+    cta_tile_n_ = cta_tile_n;
+  }
+
+  // Restricts the tile space to a problem of m x n, which must not exceed the maximum problem shape
+  // passed to initialize(). The raster order, swizzle and super-tile size of the maximum problem are
+  // kept, since the launched grid depends on them; the tile counts are rounded up to whole swizzles and
+  // super-tiles as initialize() and initialize_tile_order() do. Tiles outside of the restricted space
+  // are never scheduled, so the CTAs without work exit right away.
+  CUTLASS_HOST_DEVICE
+  void
+  restrict_problem_shape(int m, int n) {
+    int const swizzle = 1 << log_swizzle_size_;
+    uint32_t problem_blocks_m = static_cast<uint32_t>(round_up(
+      ceil_div(platform::max(m, 0), static_cast<int>(cta_tile_m_)), swizzle * static_cast<int>(cluster_shape_m_)));
+    uint32_t problem_blocks_n = static_cast<uint32_t>(round_up(
+      ceil_div(platform::max(n, 0), static_cast<int>(cta_tile_n_)), swizzle * static_cast<int>(cluster_shape_n_)));
+    uint32_t tiles_m = platform::min(problem_blocks_m / cluster_shape_m_, problem_tiles_m_);
+    uint32_t tiles_n = platform::min(problem_blocks_n / cluster_shape_n_, problem_tiles_n_);
+
+    // The tile counts of the maximum problem are whole super-tiles, so rounding up stays within them
+    bool const along_n = raster_order_ == RasterOrder::AlongN;
+    if (tile_order_ == TileOrder::SuperTile) {
+      uint32_t const height = static_cast<uint32_t>(divmod_super_tile_.divisor);
+      if (along_n) {
+        tiles_m = round_up(tiles_m, height);
+      }
+      else {
+        tiles_n = round_up(tiles_n, height);
+      }
+    }
+    else if (tile_order_ == TileOrder::Morton) {
+      uint32_t const size = 1u << log_super_tile_size_;
+      tiles_m = round_up(tiles_m, size);
+      tiles_n = round_up(tiles_n, size);
+    }
+
+    problem_tiles_m_ = tiles_m;
+    problem_tiles_n_ = tiles_n;
+    problem_blocks_m = tiles_m * cluster_shape_m_;
+    problem_blocks_n = tiles_n * cluster_shape_n_;
+    blocks_per_problem_ = uint64_t(problem_blocks_m) * problem_blocks_n * problem_tiles_l_;
+    if (blocks_per_problem_ == 0) {
+      // No tile is valid, keep the divisors of the maximum problem
+      return;
+    }
+    uint32_t const clusters_major = along_n ? problem_tiles_n_ : problem_tiles_m_;
+    divmod_batch_ = FastDivmodU64(uint64_t(problem_blocks_m) * problem_blocks_n);
+    divmod_cluster_blk_major_ = FastDivmodU64(clusters_major);
+    if (tile_order_ == TileOrder::Morton) {
+      divmod_super_tile_ = FastDivmodU64(clusters_major >> log_super_tile_size_);
+    }
+  }
+
   // Version of initialize that takes in as input the number of CTAs in the M and N and L dimensions.
   // This is useful for calculating the tiled shape when a mode of problem and/or CTA shape has rank > 1,
   // for which using CuTe algebra for calculating tile shapes is easiest.
@@ -176,6 +278,127 @@ struct PersistentTileSchedulerSm90Params {
     }
   }
 
+  // Replaces the power-of-two swizzle set up by initialize() with the super-tile order of
+  // RasterOrderOptions::L2Aware or RasterOrderOptions::Morton. Other options leave the params unchanged.
+  // Must be called after initialize() with the same problem_blocks. bytes_per_tile_m and bytes_per_tile_n
+  // are the bytes of A and B read by a CTA tile over the whole K mode.
+  void
+  initialize_tile_order(
+    dim3 problem_blocks,
+    GemmCoord cluster_shape,
+    KernelHardwareInfo hw_info,
+    RasterOrderOptions raster_order_option,
+    uint64_t bytes_per_tile_m,
+    uint64_t bytes_per_tile_n
+  ) {
+    if (raster_order_option != RasterOrderOptions::L2Aware &&
+        raster_order_option != RasterOrderOptions::Morton) {
+      return;
+    }
+
+    #if !defined(__CUDACC_RTC__)
+    if (hw_info.sm_count <= 0) {
+      hw_info.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+    if (raster_order_option == RasterOrderOptions::L2Aware && hw_info.l2_cache_size <= 0) {
+      hw_info.l2_cache_size = KernelHardwareInfo::query_device_l2_cache_size(hw_info.device_id);
+    }
+    #endif // !defined(__CUDACC_RTC__)
+
+    uint32_t clusters_m = problem_blocks.x / cluster_shape.m();
+    uint32_t clusters_n = problem_blocks.y / cluster_shape.n();
+    uint64_t bytes_per_cluster_m = bytes_per_tile_m * cluster_shape.m();
+    uint64_t bytes_per_cluster_n = bytes_per_tile_n * cluster_shape.n();
+
+    bool const along_n = raster_order_ == RasterOrder::AlongN;
+    uint32_t clusters_minor = along_n ? clusters_m : clusters_n;
+    uint32_t clusters_major = along_n ? clusters_n : clusters_m;
+
+    int const cluster_size = cluster_shape.m() * cluster_shape.n();
+    hw_info = get_partitioned_hw_info(hw_info, cluster_size);
+    uint32_t clusters_per_wave = static_cast<uint32_t>(hw_info.max_active_clusters > 0 ?
+      hw_info.max_active_clusters : platform::max(1, hw_info.sm_count / cluster_size));
+
+    if (raster_order_option == RasterOrderOptions::L2Aware) {
+      uint32_t height = get_l2_super_tile_size(
+        clusters_minor,
+        along_n ? bytes_per_cluster_m : bytes_per_cluster_n,
+        along_n ? bytes_per_cluster_n : bytes_per_cluster_m,
+        clusters_per_wave,
+        hw_info.l2_cache_size
+      );
+      clusters_minor = round_up(clusters_minor, height);
+      tile_order_ = TileOrder::SuperTile;
+      divmod_super_tile_ = FastDivmodU64(height);
+    }
+    else {
+      // Square super-tiles of at most one wave, no larger than the problem along either mode
+      int32_t log_size = 0;
+      uint32_t max_size = platform::min(clusters_minor, clusters_major);
+      while ((2u << log_size) <= max_size && (2u << log_size) * (2u << log_size) <= clusters_per_wave) {
+        ++log_size;
+      }
+      clusters_minor = round_up(clusters_minor, 1u << log_size);
+      clusters_major = round_up(clusters_major, 1u << log_size);
+      tile_order_ = TileOrder::Morton;
+      log_super_tile_size_ = log_size;
+      divmod_super_tile_ = FastDivmodU64(clusters_major >> log_size);
+    }
+
+    problem_tiles_m_ = along_n ? clusters_minor : clusters_major;
+    problem_tiles_n_ = along_n ? clusters_major : clusters_minor;
+    uint64_t problem_blocks_m = uint64_t(problem_tiles_m_) * cluster_shape.m();
+    uint64_t problem_blocks_n = uint64_t(problem_tiles_n_) * cluster_shape.n();
+
+    blocks_per_problem_ = problem_blocks_m * problem_blocks_n * problem_blocks.z;
+    log_swizzle_size_ = 0;
+    divmod_batch_ = FastDivmodU64(problem_blocks_m * problem_blocks_n);
+    divmod_cluster_blk_major_ = FastDivmodU64(clusters_major);
+  }
+
+  // Chooses the height in clusters of the stripes of RasterOrderOptions::L2Aware. The tallest stripe is
+  // chosen for which the minor-mode operands of the stripe and the major-mode operands of a wave fit in
+  // half of the L2, so that the former are read from DRAM once while the wave moves along the stripe.
+  // If no stripe fits, the height minimizing the operand footprint of a wave is chosen instead.
+  // The height is then lowered as far as possible without adding stripes, to limit the padding.
+  static uint32_t
+  get_l2_super_tile_size(
+    uint32_t clusters_minor,
+    uint64_t bytes_per_cluster_minor,
+    uint64_t bytes_per_cluster_major,
+    uint32_t clusters_per_wave,
+    int l2_cache_size
+  ) {
+    if (clusters_minor == 0) {
+      return 1;
+    }
+    uint64_t const budget = static_cast<uint64_t>(platform::max(l2_cache_size, 0)) / 2;
+    auto wave_footprint = [&](uint32_t height) {
+      uint64_t wave_width = (clusters_per_wave + height - 1) / height;
+      return height * bytes_per_cluster_minor + wave_width * bytes_per_cluster_major;
+    };
+
+    uint32_t height = 0;
+    for (uint32_t h = clusters_minor; h > 0; --h) {
+      if (wave_footprint(h) <= budget) {
+        height = h;
+        break;
+      }
+    }
+    if (height == 0) {
+      height = 1;
+      uint32_t max_height = platform::min(clusters_minor, platform::max(clusters_per_wave, 1u));
+      for (uint32_t h = 2; h <= max_height; ++h) {
+        if (wave_footprint(h) < wave_footprint(height)) {
+          height = h;
+        }
+      }
+    }
+
+    uint32_t stripes = (clusters_minor + height - 1) / height;
+    return (clusters_minor + stripes - 1) / stripes;
+  }
+
   // Given the inputs, computes the physical grid we should launch.
   // This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
@@ -219,6 +442,7 @@ struct PersistentTileSchedulerSm90Params {
     bool bypass_sm90_occupancy_calculation=false 
     ) {
 
+    hw_info = get_partitioned_hw_info(hw_info, cluster_shape.m() * cluster_shape.n());
     int const sm_count = hw_info.sm_count;
     int const max_active_clusters = hw_info.max_active_clusters;
 
@@ -334,7 +558,9 @@ struct PersistentTileSchedulerSm90Params {
     RasterOrderOptions raster_order_option
   ) {
 
-    if (raster_order_option == RasterOrderOptions::Heuristic) {
+    if (raster_order_option == RasterOrderOptions::Heuristic ||
+        raster_order_option == RasterOrderOptions::L2Aware ||
+        raster_order_option == RasterOrderOptions::Morton) {
       if (tiles_n > tiles_m) {
         return RasterOrder::AlongM;
       }
@@ -385,6 +611,47 @@ struct PersistentTileSchedulerSm90Params {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Tunable constants of the cost model used by the stream-K schedulers to select a decomposition
+// when DecompositionMode::Heuristic is requested. Fields left at zero take the values of calibrated().
+struct StreamKHeuristicConfig {
+  // Minimum number of K tiles assigned to a stream-K unit. Values below the minimum the kernels
+  // rely on when splitting output tiles (PersistentTileSchedulerSm90StreamKParams::min_iters_per_sk_unit_)
+  // are raised to it.
+  uint32_t min_k_tiles_per_sk_unit = 0;
+
+  // Number of waves of output tiles covered by stream-K work when the last wave is partial:
+  // the partial wave and the sk_waves - 1 full waves preceding it.
+  uint32_t sk_waves = 0;
+
+  // A partial last wave that is at least this full, in percent of a wave, is computed data-parallel
+  uint32_t dp_tail_wave_percent = 0;
+
+  // Maximum number of groups of stream-K units
+  uint32_t max_sk_groups = 0;
+
+  // Returns the constants for SM `sm_arch`. A single table, calibrated on SM90, is shared by all
+  // architectures: SM100 has not been calibrated separately and uses the SM90 constants.
+  CUTLASS_HOST_DEVICE
+  static constexpr StreamKHeuristicConfig
+  calibrated([[maybe_unused]] int sm_arch) {
+    return {8u, 2u, 50u, 8u};
+  }
+
+  // Returns a copy in which the fields left at zero are replaced by the constants of SM `sm_arch`
+  CUTLASS_HOST_DEVICE
+  constexpr StreamKHeuristicConfig
+  resolve(int sm_arch, uint32_t min_k_tiles_floor) const {
+    StreamKHeuristicConfig const defaults = calibrated(sm_arch);
+    StreamKHeuristicConfig config = *this;
+    config.min_k_tiles_per_sk_unit = platform::max(min_k_tiles_floor,
+      min_k_tiles_per_sk_unit != 0 ? min_k_tiles_per_sk_unit : defaults.min_k_tiles_per_sk_unit);
+    config.sk_waves = sk_waves != 0 ? sk_waves : defaults.sk_waves;
+    config.dp_tail_wave_percent = dp_tail_wave_percent != 0 ? dp_tail_wave_percent : defaults.dp_tail_wave_percent;
+    config.max_sk_groups = max_sk_groups != 0 ? max_sk_groups : defaults.max_sk_groups;
+    return config;
+  }
+};
+
 // Parameters for SM90 persistent stream-K scheduler
 struct PersistentTileSchedulerSm90StreamKParams {
   using ReductionMode = cutlass::gemm::kernel::detail::ReductionMode;
@@ -463,12 +730,23 @@ struct PersistentTileSchedulerSm90StreamKParams {
   // The number of blocks that launched for doing separate reduction
   uint32_t separate_reduction_units_ = 0;
 
-  // Minimum number of k tiles that can be assigned to a stream-K unit
+  // Per-CTA work accounting
+  TileSchedulerTelemetry* telemetry_ = nullptr;
+
+  // Minimum number of k tiles that can be assigned to a stream-K unit. The heuristic
+  // may use a larger minimum, see StreamKHeuristicConfig.
   static constexpr uint32_t min_iters_per_sk_unit_ = 8u;
 
-  // Maximum number of groups of stream-K units
+  // Default maximum number of groups of stream-K units
   static constexpr uint32_t max_sk_groups_ = 8u;
 
+  // Returns the heuristic constants for SM90 with the fields left at zero filled in
+  CUTLASS_HOST_DEVICE
+  static StreamKHeuristicConfig
+  resolve_heuristic(StreamKHeuristicConfig const& heuristic, int sm_arch = 90) {
+    return heuristic.resolve(sm_arch, min_iters_per_sk_unit_);
+  }
+
   // ktile start from even for each cta
   uint32_t ktile_start_alignment_count_ { 1u };
 
@@ -550,7 +828,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     void* workspace,
     const uint32_t epilogue_subtile = 1u,
     uint32_t ktile_start_alignment_count = 1u,
-    bool bypass_sm90_occupancy_calculation=false
+    bool bypass_sm90_occupancy_calculation=false,
+    StreamKHeuristicConfig const& heuristic = {}
   ) {
     dim3 problem_blocks = UnderlyingParams::get_tiled_cta_shape_mnl(
       problem_shape, tile_shape, cluster_shape);
@@ -571,7 +850,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
       workspace,
       epilogue_subtile,
       ktile_start_alignment_count,
-      bypass_sm90_occupancy_calculation
+      bypass_sm90_occupancy_calculation,
+      heuristic
     );
   }
 
@@ -592,7 +872,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     void* workspace,
     const uint32_t epilogue_subtile = 1,
     uint32_t ktile_start_alignment_count = 1u,
-    bool bypass_sm90_occupancy_calculation=false
+    bool bypass_sm90_occupancy_calculation=false,
+    StreamKHeuristicConfig const& heuristic = {}
   ) {
 
     #if !defined(__CUDACC_RTC__)
@@ -630,11 +911,12 @@ struct PersistentTileSchedulerSm90StreamKParams {
       reduction_mode,
       epilogue_subtile,
       ktile_start_alignment_count,
-      bypass_sm90_occupancy_calculation
+      bypass_sm90_occupancy_calculation,
+      resolve_heuristic(heuristic)
     ); 
   }
   
-  // max_sk_groups_ unless this extends beyond the extent of the dimension over
+  // heuristic.max_sk_groups unless this extends beyond the extent of the dimension over
   // which the problem is rasterized. For example, if the tiled problem shape
   // (in CTA_M x CTA_N representation) when using 1x1 clusters is 4x16,
   // and we rasterize along the M dimension, we choose 4 groups, rather than 8.
@@ -650,7 +932,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint64_t sk_cluster_tiles,
     uint64_t sk_units,
     uint32_t k_tiles_per_output_tile,
-    bool do_separate_reduction) {
+    bool do_separate_reduction,
+    StreamKHeuristicConfig const& heuristic = StreamKHeuristicConfig::calibrated(90)) {
 
     uint32_t max_groups_problem;
     if (underlying_params.raster_order_ == RasterOrder::AlongM) {
@@ -663,9 +946,9 @@ struct PersistentTileSchedulerSm90StreamKParams {
     // Select the number of groups that will be use. We start with the maximum
     // number of potential groups, and iterate down looking for a group size that
     // evenly divides the stream-K units and tiles, and for which the resulting
-    // number of K tiles per stream-K unit remains above min_iters_per_sk_unit_
+    // number of K tiles per stream-K unit remains above heuristic.min_k_tiles_per_sk_unit
 
-    uint32_t groups = platform::min(max_groups_problem, uint32_t(max_sk_groups_));
+    uint32_t groups = platform::min(max_groups_problem, heuristic.max_sk_groups);
     // Grouping is disabled when separate reduction is used because grouping is primarily an attempt
     // to improve L2 locality, and L2-locality optimizations are unnecessary when the the kernel
     // is a single wave (which is the case for separate reduction).
@@ -680,11 +963,11 @@ struct PersistentTileSchedulerSm90StreamKParams {
 
     auto sk_splits_too_small = [&](uint32_t g) {
       // Check whether the number of K tiles computed per stream-K unit is less
-      // than min_iters_per_sk_unit_
+      // than heuristic.min_k_tiles_per_sk_unit
       auto total_sk_cluster_tiles = (sk_cluster_tiles / g) * cluster_size;
       auto total_sk_k_tiles = total_sk_cluster_tiles * k_tiles_per_output_tile;
       auto k_tiles_per_sk_unit = total_sk_k_tiles / (sk_units / g);
-      return k_tiles_per_sk_unit < min_iters_per_sk_unit_;
+      return k_tiles_per_sk_unit < heuristic.min_k_tiles_per_sk_unit;
     };
 
     auto is_ideal_grouping = [&](uint32_t g) {
@@ -732,7 +1015,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
       ReductionMode reduction_mode,
       const uint32_t epilogue_subtile = 1,
       uint32_t ktile_start_alignment_count = 1u,
-      bool bypass_sm90_occupancy_calculation=false) {
+      bool bypass_sm90_occupancy_calculation=false,
+      StreamKHeuristicConfig const& heuristic = StreamKHeuristicConfig::calibrated(90)) {
     uint32_t groups = 0;
     uint32_t sk_tiles = 0;
     uint64_t sk_units = 0;
@@ -766,7 +1050,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         reduction_mode,
         epilogue_subtile,
         ktile_start_alignment_count,
-        bypass_sm90_occupancy_calculation
+        bypass_sm90_occupancy_calculation,
+        heuristic
       );
 
     // Given heuristic_mode returned from the heuristic() method, set params fields.
@@ -817,7 +1102,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     ReductionMode reduction_mode,
     uint32_t epilogue_subtile,
     uint32_t ktile_start_alignment_count,
-    bool bypass_sm90_occupancy_calculation=false
+    bool bypass_sm90_occupancy_calculation=false,
+    StreamKHeuristicConfig const& heuristic = StreamKHeuristicConfig::calibrated(90)
   ) {
 
     // Get block numbers in m, n and l dimensions
@@ -858,7 +1144,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         cluster_size,
         k_tiles_per_output_tile,
         decomposition_mode,
-        ctas_per_wave_in_full_clusters 
+        ctas_per_wave_in_full_clusters,
+        heuristic
       );
       uint64_t dp_tiles = output_tiles - sk_tiles;
       // Calculate the number of work units covering the data-parallel and stream-K tiles.
@@ -873,7 +1160,7 @@ struct PersistentTileSchedulerSm90StreamKParams {
 
       uint64_t ctas_per_sk_wave = ctas_per_wave;
       ctas_per_sk_wave = ctas_per_wave_in_full_clusters; 
-      sk_units = get_num_sk_units(cluster_shape, ctas_per_sk_wave, sk_tiles, k_tiles_per_output_tile);
+      sk_units = get_num_sk_units(cluster_shape, ctas_per_sk_wave, sk_tiles, k_tiles_per_output_tile, heuristic);
 
       if (decomposition_mode == DecompositionMode::DataParallel ||
           (decomposition_mode == DecompositionMode::Heuristic && sk_tiles == 0) ||
@@ -888,7 +1175,7 @@ struct PersistentTileSchedulerSm90StreamKParams {
         uint64_t sk_cluster_tiles = sk_tiles / cluster_size;
 
         groups = calculate_groups(underlying_params, reduction_mode, problem_blocks_m, problem_blocks_n, cluster_shape,
-          cluster_size, sk_tiles, sk_cluster_tiles, sk_units, k_tiles_per_output_tile, do_separate_reduction);
+          cluster_size, sk_tiles, sk_cluster_tiles, sk_units, k_tiles_per_output_tile, do_separate_reduction, heuristic);
 
         auto sk_units_per_group = sk_units / groups;
 
@@ -1069,7 +1356,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint64_t cluster_size,
     uint32_t k_tiles_per_output_tile,
     DecompositionMode decomposition_mode
-    , uint64_t ctas_per_wave_in_full_clusters 
+    , uint64_t ctas_per_wave_in_full_clusters,
+    StreamKHeuristicConfig const& heuristic = StreamKHeuristicConfig::calibrated(90)
   ) {
     uint32_t full_waves = static_cast<uint32_t>(output_tiles / ctas_per_wave);
     uint32_t total_waves = static_cast<uint32_t>((output_tiles + ctas_per_wave - 1) / ctas_per_wave);
@@ -1079,15 +1367,16 @@ struct PersistentTileSchedulerSm90StreamKParams {
       return 0;
     }
 
-    // If there is wave quantization, assign the first two waves worth of tiles to be
-    // covered by stream-K work and the remainder to be data-parallel. Since we know
-    // that full_waves == total_waves - 1 in this case, the number of data-parallel
-    // waves is simply full_waves-1 (unless full_waves == 0).
-    uint32_t dp_waves = full_waves > 1 ? full_waves - 1 : 0;
+    // If there is wave quantization, assign the last heuristic.sk_waves waves worth of tiles
+    // (two by default) to be covered by stream-K work and the remainder to be data-parallel.
+    // Since we know that full_waves == total_waves - 1 in this case, the number of data-parallel
+    // waves is simply full_waves - (sk_waves - 1) (unless there are fewer full waves).
+    uint32_t const sk_full_waves = heuristic.sk_waves - 1;
+    uint32_t dp_waves = full_waves > sk_full_waves ? full_waves - sk_full_waves : 0;
     uint64_t dp_tiles = dp_waves * ctas_per_wave;
     uint64_t sk_tiles = output_tiles - dp_tiles;
 
-    if (full_waves == total_waves || k_tiles_per_output_tile <= min_iters_per_sk_unit_) {
+    if (full_waves == total_waves || k_tiles_per_output_tile <= heuristic.min_k_tiles_per_sk_unit) {
       // All tiles will be data-parallel tiles if there is either no quantization
       // or if there is no work to be split.
       return 0;
@@ -1098,9 +1387,10 @@ struct PersistentTileSchedulerSm90StreamKParams {
     //
     if (decomposition_mode == DecompositionMode::Heuristic) {
       // Rudimentary heuristic: prefer data-parallel decomposition if we have more than
-      // one wave and the tail wave is more than half full. This is subject to change.
+      // one wave and the tail wave is at least heuristic.dp_tail_wave_percent full
+      // (half full by default).
       uint64_t tail_tiles = output_tiles - (full_waves * ctas_per_wave);
-      if (2 * tail_tiles >= ctas_per_wave) {
+      if (100 * tail_tiles >= heuristic.dp_tail_wave_percent * ctas_per_wave) {
         return 0;
       }
     }
@@ -1113,7 +1403,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
 
   CUTLASS_HOST_DEVICE
   static uint64_t
-  get_num_sk_units(GemmCoord cluster_shape, uint64_t ctas_per_sk_wave, uint32_t sk_tiles, uint32_t k_tiles_per_output_tile) {
+  get_num_sk_units(GemmCoord cluster_shape, uint64_t ctas_per_sk_wave, uint32_t sk_tiles, uint32_t k_tiles_per_output_tile,
+      StreamKHeuristicConfig const& heuristic = StreamKHeuristicConfig::calibrated(90)) {
     // If there are stream-K tiles to compute and a sufficiently large number of k iterations
     // across them, they will be covered by a single wave of persistent threadblocks. Thus, there
     // will be as many work units as there are threadblocks in a single wave.
@@ -1131,7 +1422,7 @@ struct PersistentTileSchedulerSm90StreamKParams {
     // Calculate the number of stream-K units that would be needed if each stream-K unit
     // computed the minimum allowable k iterations. Truncate this to be in units of clusters.
     auto cluster_size = cluster_shape.m() * cluster_shape.n();
-    uint64_t min_sized_sk_units = (k_tiles_sk_total / min_iters_per_sk_unit_);
+    uint64_t min_sized_sk_units = (k_tiles_sk_total / heuristic.min_k_tiles_per_sk_unit);
     min_sized_sk_units = (min_sized_sk_units / cluster_size) * cluster_size;
 
     uint64_t sk_units = platform::min(ctas_per_sk_wave, min_sized_sk_units);
@@ -1176,7 +1467,13 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
     uint32_t ktile_start_alignment_count = 1,
-    bool bypass_sm90_occupancy_calculation=false) {
+    bool bypass_sm90_occupancy_calculation=false,
+    StreamKHeuristicConfig const& heuristic = StreamKHeuristicConfig::calibrated(90),
+    bool* separate_reduction = nullptr) {
+
+    if (separate_reduction != nullptr) {
+      *separate_reduction = false;
+    }
 
     auto log_swizzle_size = UnderlyingParams::get_log_swizzle_size(problem_blocks.x, problem_blocks.y, max_swizzle);
     problem_blocks.x = round_up(problem_blocks.x, (1 << log_swizzle_size) * cluster_shape.m());
@@ -1195,6 +1492,7 @@ struct PersistentTileSchedulerSm90StreamKParams {
       new_hw_info.device_id = hw_info.device_id;
       new_hw_info.sm_count = hw_info.sm_count;
       new_hw_info.max_active_clusters = hw_info.max_active_clusters;
+      new_hw_info.cta_budget = hw_info.cta_budget;
       if (new_hw_info.sm_count <= 0) {
         CUTLASS_TRACE_HOST("  WARNING: Arguments do not include a valid SM count.\n"
             "  For optimal performance, populate the arguments KernelHardwareInfo struct with the SM count.");
@@ -1218,11 +1516,12 @@ struct PersistentTileSchedulerSm90StreamKParams {
         cluster_size,
         static_cast<uint32_t>(k_tiles_per_output_tile),
         decomposition_mode
-        , ctas_per_wave_in_full_clusters 
+        , ctas_per_wave_in_full_clusters,
+        heuristic
       );
       uint64_t ctas_per_sk_wave = ctas_per_wave;
       ctas_per_sk_wave = ctas_per_wave_in_full_clusters; 
-      uint64_t sk_units = get_num_sk_units(cluster_shape, ctas_per_sk_wave, sk_tiles, k_tiles_per_output_tile);
+      uint64_t sk_units = get_num_sk_units(cluster_shape, ctas_per_sk_wave, sk_tiles, k_tiles_per_output_tile, heuristic);
       uint64_t dp_tiles = output_tiles - sk_tiles;
 
       if (decomposition_mode == DecompositionMode::SplitK ||
@@ -1254,6 +1553,9 @@ struct PersistentTileSchedulerSm90StreamKParams {
           // Thus, for separate reduction, we need as many reduction tiles per output tile
           // as there are the maximum number of peers that can collaborate on an output tile.
           reduction_tiles *= max_peers_per_tile(sk_units, sk_tiles);
+          if (separate_reduction != nullptr) {
+            *separate_reduction = true;
+          }
         }
 
         // Though separate reduction requires a larger reduction workspace, only one barrier
@@ -1293,7 +1595,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t element_accumulator_bits,
     uint32_t epilogue_subtile,
     uint32_t num_accumulator_mtxs,
-    uint32_t ktile_start_alignment_count = 1) {
+    uint32_t ktile_start_alignment_count = 1,
+    StreamKHeuristicConfig const& heuristic = {}) {
 
     dim3 problem_blocks = UnderlyingParams::get_tiled_cta_shape_mnl(problem_shape, tile_shape, cluster_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -1314,7 +1617,9 @@ struct PersistentTileSchedulerSm90StreamKParams {
       element_accumulator_bits,
       epilogue_subtile,
       num_accumulator_mtxs,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      /*bypass_sm90_occupancy_calculation=*/false,
+      heuristic
     );
   }
 
@@ -1339,7 +1644,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
     uint32_t ktile_start_alignment_count = 1,
-    bool bypass_sm90_occupancy_calculation=false) {
+    bool bypass_sm90_occupancy_calculation=false,
+    StreamKHeuristicConfig const& heuristic = {}) {
 
     size_t barrier_workspace_size = 0;
     size_t reduction_workspace_size = 0;
@@ -1364,7 +1670,8 @@ struct PersistentTileSchedulerSm90StreamKParams {
         epilogue_subtile,
         num_accumulator_mtxs,
         ktile_start_alignment_count,
-        bypass_sm90_occupancy_calculation
+        bypass_sm90_occupancy_calculation,
+        resolve_heuristic(heuristic)
       );
     #endif
 
@@ -1391,7 +1698,9 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t element_accumulator_bits,
     uint32_t epilogue_subtile,
     CudaHostAdapter* cuda_adapter = nullptr,
-    uint32_t ktile_start_alignment_count = 1) {
+    uint32_t ktile_start_alignment_count = 1,
+    StreamKHeuristicConfig const& heuristic = {},
+    bool barrier_workspace_initialized = false) {
 
     dim3 problem_blocks = UnderlyingParams::get_tiled_cta_shape_mnl(problem_shape, tile_shape, cluster_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -1415,7 +1724,10 @@ struct PersistentTileSchedulerSm90StreamKParams {
       epilogue_subtile,
       1,
       cuda_adapter,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      /*bypass_sm90_occupancy_calculation=*/false,
+      heuristic,
+      barrier_workspace_initialized
     );
   }
 
@@ -1443,11 +1755,14 @@ struct PersistentTileSchedulerSm90StreamKParams {
     uint32_t num_accumulator_mtxs = 1,
     CudaHostAdapter* cuda_adapter = nullptr,
     uint32_t ktile_start_alignment_count = 1,
-    bool bypass_sm90_occupancy_calculation=false) {
+    bool bypass_sm90_occupancy_calculation=false,
+    StreamKHeuristicConfig const& heuristic = {},
+    bool barrier_workspace_initialized = false) {
 
     #if !defined(__CUDACC_RTC__)
       uint64_t barrier_workspace_size = 0;
       uint64_t reduction_workspace_size = 0;
+      bool separate_reduction = false;
 
       get_workspace_component_sizes(
         problem_blocks,
@@ -1468,7 +1783,9 @@ struct PersistentTileSchedulerSm90StreamKParams {
         epilogue_subtile,
         num_accumulator_mtxs,
         ktile_start_alignment_count,
-        bypass_sm90_occupancy_calculation
+        bypass_sm90_occupancy_calculation,
+        resolve_heuristic(heuristic),
+        &separate_reduction
       );
 
       if (barrier_workspace_size > 0) {
@@ -1476,7 +1793,19 @@ struct PersistentTileSchedulerSm90StreamKParams {
           return Status::kErrorWorkspaceNull;
         }
 
-        // Only the barrier workspace needs to be cleared for stream-K.
+        if (reduction_mode == ReductionMode::Atomic) {
+          // Atomic reductions add all partials to the reduction workspace, which therefore needs to
+          // be cleared along with the barrier workspace that follows it.
+          return zero_workspace(workspace, reduction_workspace_size + barrier_workspace_size, stream, cuda_adapter);
+        }
+
+        // Only the barrier workspace needs to be cleared for stream-K. Its flags are reset by the final
+        // splits consuming them, so it stays cleared across launches once initialized. The reduction
+        // units of separate reduction share a flag per tile and leave it set, so it is cleared again.
+        if (barrier_workspace_initialized && !separate_reduction) {
+          return Status::kSuccess;
+        }
+
         // Barrier workspace follows reduction workspace.
         uint8_t* barrier_workspace = reinterpret_cast<uint8_t*>(workspace) + reduction_workspace_size;
         return zero_workspace(static_cast<void*>(barrier_workspace), barrier_workspace_size, stream, cuda_adapter);
@@ -1627,6 +1956,7 @@ template<class GroupProblemShape>
 struct PersistentTileSchedulerSm90GroupParams {
   using RasterOrder = cutlass::gemm::kernel::detail::RasterOrder;
   using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+  using GroupOrder = cutlass::gemm::kernel::detail::GroupOrder;
 
   FastDivmodU64Pow2 divmod_cluster_shape_major_{};
   FastDivmodU64Pow2 divmod_cluster_shape_minor_{};
@@ -1637,6 +1967,7 @@ struct PersistentTileSchedulerSm90GroupParams {
   bool pre_processed_problem_shapes = true;
   int32_t max_swizzle_size_ = 0;
   RasterOrder raster_order_ = RasterOrder::AlongN;
+  GroupOrder group_order_ = GroupOrder::InOrder;
 
   GroupProblemShape problem_shapes_;
   GemmCoord cta_shape_;
@@ -1653,7 +1984,8 @@ struct PersistentTileSchedulerSm90GroupParams {
     GemmCoord cluster_shape,
     KernelHardwareInfo const& hw_info,
     int max_swizzle_size,
-    RasterOrderOptions raster_order_option
+    RasterOrderOptions raster_order_option,
+    GroupOrder group_order = GroupOrder::InOrder
   ) {
 
     CUTLASS_UNUSED(hw_info);
@@ -1678,6 +2010,7 @@ struct PersistentTileSchedulerSm90GroupParams {
     pre_processed_problem_shapes = problem_shapes.is_host_problem_shape_available();
     max_swizzle_size_ = max_swizzle_size;
     raster_order_ = raster_order;
+    group_order_ = group_order;
 
     if (raster_order == RasterOrder::AlongN) {
       divmod_cluster_shape_major_ = FastDivmodU64Pow2(cluster_shape.n());
@@ -1722,6 +2055,7 @@ struct PersistentTileSchedulerSm90GroupParams {
     RasterOrderOptions raster_order_option,
     bool truncate_by_problem_size=true) {
 
+    hw_info = get_partitioned_hw_info(hw_info, cluster_shape.m() * cluster_shape.n());
     int const sm_count = hw_info.sm_count;
     int const max_active_clusters = hw_info.max_active_clusters;
 
@@ -1807,7 +2141,9 @@ struct PersistentTileSchedulerSm90GroupParams {
     RasterOrderOptions raster_order_option
   ) {
 
-    if (raster_order_option == RasterOrderOptions::Heuristic) {
+    if (raster_order_option == RasterOrderOptions::Heuristic ||
+        raster_order_option == RasterOrderOptions::L2Aware ||
+        raster_order_option == RasterOrderOptions::Morton) {
       if (tiles_n > tiles_m) {
         return RasterOrder::AlongM;
       }
@@ -1829,6 +2165,151 @@ struct PersistentTileSchedulerSm90GroupParams {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Parameters for SM90 persistent group scheduler splitting the K mode of the output tiles
+// that do not fill a wave (only used for Grouped Gemms)
+template<class GroupProblemShape>
+struct PersistentTileSchedulerSm90GroupStreamKParams : PersistentTileSchedulerSm90GroupParams<GroupProblemShape> {
+  using ReductionMode = cutlass::gemm::kernel::detail::ReductionMode;
+  using RasterOrderOptions = typename PersistentTileSchedulerSm90GroupParams<GroupProblemShape>::RasterOrderOptions;
+
+  // Maximum number of splits of the K mode of an output tile
+  int32_t max_splits_ = 1;
+  // Number of output tiles the reduction workspace can hold
+  uint32_t reduction_tiles_ = 0;
+  ReductionMode reduction_mode_ = ReductionMode::Deterministic;
+  void* reduction_workspace_ = nullptr;
+
+  void
+  initialize(
+    dim3 problem_blocks,
+    GroupProblemShape problem_shapes,
+    GemmCoord cta_shape,
+    GemmCoord cluster_shape,
+    KernelHardwareInfo const& hw_info,
+    int max_swizzle_size,
+    RasterOrderOptions raster_order_option,
+    int max_splits,
+    ReductionMode reduction_mode,
+    void* reduction_workspace
+  ) {
+    PersistentTileSchedulerSm90GroupParams<GroupProblemShape>::initialize(
+      problem_blocks,
+      problem_shapes,
+      cta_shape,
+      cluster_shape,
+      hw_info,
+      max_swizzle_size,
+      raster_order_option
+    );
+
+    // Without a workspace, no output tile can be split
+    reduction_tiles_ = reduction_workspace == nullptr ? 0 : get_reduction_tiles(hw_info, max_splits);
+    max_splits_ = reduction_tiles_ == 0 ? 1 : max_splits;
+    reduction_mode_ = reduction_mode;
+    reduction_workspace_ = reduction_workspace;
+  }
+
+  // Returns the number of output tiles for which partials are kept in the reduction workspace.
+  // Only the output tiles of the last, partial wave are split, so their number is bounded by
+  // the number of CTAs that are launched.
+  CUTLASS_HOST_DEVICE
+  static uint32_t
+  get_reduction_tiles(KernelHardwareInfo const& hw_info, int max_splits) {
+    return max_splits > 1 && hw_info.sm_count > 0 ? static_cast<uint32_t>(hw_info.sm_count) : 0;
+  }
+
+  #if !defined(__CUDACC_RTC__)
+  static void
+  get_workspace_component_sizes(
+    KernelHardwareInfo const& hw_info,
+    GemmCoord tile_shape,
+    int max_splits,
+    uint32_t mma_warp_groups,
+    uint32_t barrier_bits,
+    uint32_t accumulator_bits,
+    size_t& barrier_workspace_size,
+    size_t& reduction_workspace_size) {
+
+    // The kernel resolves a missing SM count before setting up the scheduler, so do the same here
+    KernelHardwareInfo hw_info_resolved = hw_info;
+    if (hw_info_resolved.sm_count <= 0 && max_splits > 1) {
+      hw_info_resolved.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+
+    uint32_t reduction_tiles = get_reduction_tiles(hw_info_resolved, max_splits);
+    if (reduction_tiles == 0) {
+      barrier_workspace_size = 0;
+      reduction_workspace_size = 0;
+      return;
+    }
+    barrier_workspace_size = PersistentTileSchedulerSm90StreamKParams::get_barrier_workspace_size(
+      reduction_tiles, mma_warp_groups, barrier_bits);
+    reduction_workspace_size = PersistentTileSchedulerSm90StreamKParams::get_reduction_workspace_size(
+      reduction_tiles, tile_shape, accumulator_bits);
+  }
+
+  static size_t
+  get_workspace_size(
+    KernelHardwareInfo const& hw_info,
+    GemmCoord tile_shape,
+    int max_splits,
+    uint32_t mma_warp_groups,
+    uint32_t barrier_bits,
+    uint32_t accumulator_bits) {
+
+    size_t barrier_workspace_size = 0;
+    size_t reduction_workspace_size = 0;
+    get_workspace_component_sizes(
+      hw_info, tile_shape, max_splits, mma_warp_groups, barrier_bits, accumulator_bits,
+      barrier_workspace_size, reduction_workspace_size);
+    return barrier_workspace_size + reduction_workspace_size;
+  }
+
+  static cutlass::Status
+  initialize_workspace(
+    void* workspace,
+    cudaStream_t stream,
+    KernelHardwareInfo const& hw_info,
+    GemmCoord tile_shape,
+    int max_splits,
+    uint32_t mma_warp_groups,
+    uint32_t barrier_bits,
+    uint32_t accumulator_bits,
+    ReductionMode reduction_mode,
+    CudaHostAdapter* cuda_adapter = nullptr,
+    bool barrier_workspace_initialized = false) {
+
+    size_t barrier_workspace_size = 0;
+    size_t reduction_workspace_size = 0;
+    get_workspace_component_sizes(
+      hw_info, tile_shape, max_splits, mma_warp_groups, barrier_bits, accumulator_bits,
+      barrier_workspace_size, reduction_workspace_size);
+
+    if (barrier_workspace_size > 0) {
+      if (workspace == nullptr) {
+        return Status::kErrorWorkspaceNull;
+      }
+
+      if (reduction_mode == ReductionMode::Atomic) {
+        // Atomic reductions add all partials to the reduction workspace
+        return zero_workspace(workspace, reduction_workspace_size + barrier_workspace_size, stream, cuda_adapter);
+      }
+
+      // Only the barrier workspace, which follows the reduction workspace, needs to be cleared. The final
+      // split of each tile resets its flags, so it stays cleared across launches once initialized.
+      if (barrier_workspace_initialized) {
+        return Status::kSuccess;
+      }
+      uint8_t* barrier_workspace = reinterpret_cast<uint8_t*>(workspace) + reduction_workspace_size;
+      return zero_workspace(static_cast<void*>(barrier_workspace), barrier_workspace_size, stream, cuda_adapter);
+    }
+    return Status::kSuccess;
+  }
+  #endif // !defined(__CUDACC_RTC__)
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 
 //
 // Parameters for SM100 tile schedulers
@@ -1850,6 +2331,11 @@ struct PersistentTileSchedulerSm100Params {
   FastDivmod divmod_swizzle_size_{};
   RasterOrder raster_order_ = RasterOrder::AlongM;
   int32_t log_swizzle_size_ = 0;
+
+  // Per-CTA work accounting, and the number of K tiles of an output tile accounted for every tile
+  TileSchedulerTelemetry* telemetry_ = nullptr;
+  uint32_t telemetry_k_tiles_ = 0;
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -1879,7 +2365,7 @@ struct PersistentTileSchedulerSm100Params {
       RasterOrderOptions raster_order_option) {
 
     raster_order_ = UnderlyingParams::get_rasterization_order(problem_tiles_m_, problem_tiles_n_, raster_order_option);
-    if (raster_order_option == RasterOrderOptions::Heuristic && raster_order_ == RasterOrder::AlongN) {
+    if (raster_order_option != RasterOrderOptions::AlongN && raster_order_ == RasterOrder::AlongN) {
       // The current implementation of AlongN rasterization for B100 requires swapping the number of clusters along the
       // X and Y dimensions of the grid. However, since the grid Y dimension has a smaller range of allowed values
       // than the grid X dimension, we must check whether the swapped grid would exceed the grid Y limit. If the
@@ -2073,6 +2559,13 @@ struct PersistentTileSchedulerSm100StreamKParams {
   UnderlyingStreamKParams sk_params_{};
   UnderlyingParams sm100_params_{};
 
+  // Returns the heuristic constants for SM100 with the fields left at zero filled in
+  CUTLASS_HOST_DEVICE
+  static StreamKHeuristicConfig
+  resolve_heuristic(StreamKHeuristicConfig const& heuristic) {
+    return UnderlyingStreamKParams::resolve_heuristic(heuristic, 100);
+  }
+
   // Initializes members. This variant of the method should only be used when
   // problem_shape and tile_shape contain modes of only rank 1.
   void
@@ -2087,7 +2580,8 @@ struct PersistentTileSchedulerSm100StreamKParams {
     ReductionMode reduction_mode,
     DecompositionMode decomposition_mode,
     void* workspace,
-    uint32_t ktile_start_alignment_count = 1u
+    uint32_t ktile_start_alignment_count = 1u,
+    StreamKHeuristicConfig const& heuristic = {}
   ) {
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape, tile_shape, cluster_shape);
 
@@ -2105,7 +2599,8 @@ struct PersistentTileSchedulerSm100StreamKParams {
       reduction_mode,
       decomposition_mode,
       workspace,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      heuristic
     );
   }
 
@@ -2124,7 +2619,8 @@ struct PersistentTileSchedulerSm100StreamKParams {
     ReductionMode reduction_mode,
     DecompositionMode decomposition_mode,
     void* workspace,
-    uint32_t ktile_start_alignment_count = 1u
+    uint32_t ktile_start_alignment_count = 1u,
+    StreamKHeuristicConfig const& heuristic = {}
   ) {
     sk_params_.initialize(
       problem_blocks,
@@ -2139,7 +2635,8 @@ struct PersistentTileSchedulerSm100StreamKParams {
       workspace,
       /*epilogue_subtile=*/1,
       ktile_start_alignment_count,
-      /*bypass_sm90_occupancy_calculation=*/true
+      /*bypass_sm90_occupancy_calculation=*/true,
+      resolve_heuristic(heuristic)
     );
 
     log_swizzle_size_ = sk_params_.log_swizzle_size_;
@@ -2247,7 +2744,8 @@ struct PersistentTileSchedulerSm100StreamKParams {
     uint32_t reduction_warp_groups,
     uint32_t barrier_bits,
     uint32_t element_accumulator_bits,
-    uint32_t ktile_start_alignment_count = 1
+    uint32_t ktile_start_alignment_count = 1,
+    StreamKHeuristicConfig const& heuristic = {}
   ) {
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape, tile_shape, cluster_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -2266,7 +2764,10 @@ struct PersistentTileSchedulerSm100StreamKParams {
       reduction_warp_groups,
       barrier_bits,
       element_accumulator_bits,
-      ktile_start_alignment_count
+      /*epilogue_subtile=*/1,
+      /*num_accumulator_mtxs=*/1,
+      ktile_start_alignment_count,
+      heuristic
     );
   }
 
@@ -2290,7 +2791,8 @@ struct PersistentTileSchedulerSm100StreamKParams {
     uint32_t element_accumulator_bits,
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
-    uint32_t ktile_start_alignment_count = 1
+    uint32_t ktile_start_alignment_count = 1,
+    StreamKHeuristicConfig const& heuristic = {}
   ) {
     return UnderlyingStreamKParams::get_workspace_size(
       problem_blocks,
@@ -2309,7 +2811,8 @@ struct PersistentTileSchedulerSm100StreamKParams {
       epilogue_subtile,
       num_accumulator_mtxs,
       ktile_start_alignment_count,
-      /*bypass_sm90_occupancy_calculation=*/true
+      /*bypass_sm90_occupancy_calculation=*/true,
+      resolve_heuristic(heuristic)
     );
   }
 
@@ -2334,7 +2837,9 @@ struct PersistentTileSchedulerSm100StreamKParams {
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
     CudaHostAdapter *cuda_adapter = nullptr,
-    uint32_t ktile_start_alignment_count = 1
+    uint32_t ktile_start_alignment_count = 1,
+    StreamKHeuristicConfig const& heuristic = {},
+    bool barrier_workspace_initialized = false
   ) {
     dim3 problem_blocks = get_tiled_cta_shape_mnl(problem_shape, tile_shape, cluster_shape);
     uint32_t k_tiles_per_output_tile = (problem_shape.k() + tile_shape.k() - 1) / tile_shape.k();
@@ -2358,7 +2863,9 @@ struct PersistentTileSchedulerSm100StreamKParams {
       epilogue_subtile,
       num_accumulator_mtxs,
       cuda_adapter,
-      ktile_start_alignment_count
+      ktile_start_alignment_count,
+      heuristic,
+      barrier_workspace_initialized
     );
   }
 
@@ -2385,7 +2892,9 @@ struct PersistentTileSchedulerSm100StreamKParams {
     uint32_t epilogue_subtile = 1,
     uint32_t num_accumulator_mtxs = 1,
     CudaHostAdapter *cuda_adapter = nullptr,
-    uint32_t ktile_start_alignment_count = 1
+    uint32_t ktile_start_alignment_count = 1,
+    StreamKHeuristicConfig const& heuristic = {},
+    bool barrier_workspace_initialized = false
   ) {
     return UnderlyingStreamKParams::initialize_workspace(
       workspace,
@@ -2407,7 +2916,9 @@ struct PersistentTileSchedulerSm100StreamKParams {
       num_accumulator_mtxs,
       cuda_adapter,
       ktile_start_alignment_count,
-      /*bypass_sm90_occupancy_calculation=*/true
+      /*bypass_sm90_occupancy_calculation=*/true,
+      resolve_heuristic(heuristic),
+      barrier_workspace_initialized
     );
   }
 };
@@ -2420,6 +2931,7 @@ struct PersistentTileSchedulerSm100GroupParams {
   using UnderlyingSm90Params = PersistentTileSchedulerSm90GroupParams<GroupProblemShape>;
   using RasterOrder = cutlass::gemm::kernel::detail::RasterOrder;
   using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+  using GroupOrder = cutlass::gemm::kernel::detail::GroupOrder;
 
   UnderlyingSm90Params params_sm90_{};
 
@@ -2434,7 +2946,8 @@ struct PersistentTileSchedulerSm100GroupParams {
     GemmCoord cluster_shape,
     KernelHardwareInfo const& hw_info,
     int max_swizzle_size,
-    RasterOrderOptions raster_order_option
+    RasterOrderOptions raster_order_option,
+    GroupOrder group_order = GroupOrder::InOrder
   ) {
 
     params_sm90_.initialize(
@@ -2444,7 +2957,8 @@ struct PersistentTileSchedulerSm100GroupParams {
       cluster_shape,
       hw_info,
       max_swizzle_size,
-      raster_order_option
+      raster_order_option,
+      group_order
     );
   }
 
@@ -2471,6 +2985,7 @@ struct PersistentTileSchedulerSm100GroupParams {
     bool truncate_by_problem_size = true,
     bool is_static_cluster_shape = false) {
 
+    hw_info = get_partitioned_hw_info(hw_info, cluster_shape.m() * cluster_shape.n());
     int const sm_count = hw_info.sm_count;
     int const max_active_clusters = hw_info.max_active_clusters;
 
@@ -2570,6 +3085,87 @@ struct PersistentTileSchedulerSm100GroupParams {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Entry of the work queue of the SM100 work-queue scheduler. The coordinates are those of a cluster tile,
+// i.e. of the CTA at the origin of the cluster divided by the cluster shape. The entry has the size of a
+// CLC response, so that it can be forwarded to the CTAs of a cluster like one.
+struct alignas(16) WorkQueueEntry {
+  int32_t M_idx = 0;
+  int32_t N_idx = 0;
+  int32_t L_idx = 0;
+  uint32_t cost = 0;
+};
+
+// Parameters for SM100 persistent work-queue scheduler
+struct PersistentTileSchedulerSm100WorkQueueParams {
+
+  FastDivmod divmod_cluster_shape_m_{};
+  FastDivmod divmod_cluster_shape_n_{};
+  FastDivmod divmod_tiles_m_{};
+  FastDivmod divmod_tiles_n_{};
+
+  // Number of cluster tiles handed out, and of clusters of the persistent grid
+  uint32_t num_tiles_ = 0;
+  uint32_t num_clusters_ = 0;
+
+  // Cluster tiles in the order they are handed out, or nullptr to hand them out in M-major order
+  WorkQueueEntry const* work_queue_ = nullptr;
+  // Number of tiles fetched after the initial tile of each cluster, in the scheduler workspace
+  uint32_t* tile_counter_ = nullptr;
+
+  // Version of initialize that takes in as input the number of CTAs in the M and N and L dimensions.
+  void
+  initialize(
+    dim3 problem_blocks,
+    GemmCoord cluster_shape,
+    KernelHardwareInfo hw_info,
+    WorkQueueEntry const* work_queue,
+    uint32_t num_work_queue_entries,
+    void* workspace
+  ) {
+    #if !defined(__CUDACC_RTC__)
+    if (hw_info.sm_count <= 0) {
+      hw_info.sm_count = KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    }
+    #endif // !defined(__CUDACC_RTC__)
+
+    uint32_t tiles_m = problem_blocks.x / cluster_shape.m();
+    uint32_t tiles_n = problem_blocks.y / cluster_shape.n();
+
+    divmod_cluster_shape_m_ = FastDivmod(cluster_shape.m());
+    divmod_cluster_shape_n_ = FastDivmod(cluster_shape.n());
+    divmod_tiles_m_ = FastDivmod(tiles_m);
+    divmod_tiles_n_ = FastDivmod(tiles_n);
+    num_tiles_ = tiles_m * tiles_n * problem_blocks.z;
+    if (work_queue != nullptr && num_work_queue_entries > 0) {
+      num_tiles_ = platform::min(num_tiles_, num_work_queue_entries);
+    }
+
+    int const cluster_size = cluster_shape.m() * cluster_shape.n();
+    hw_info = get_partitioned_hw_info(hw_info, cluster_size);
+    uint32_t clusters_per_device = static_cast<uint32_t>(hw_info.max_active_clusters > 0 ?
+      hw_info.max_active_clusters : platform::max(1, hw_info.sm_count / cluster_size));
+    num_clusters_ = platform::max(1u, platform::min(clusters_per_device, num_tiles_));
+
+    work_queue_ = work_queue;
+    tile_counter_ = reinterpret_cast<uint32_t*>(workspace);
+  }
+
+  static size_t
+  get_workspace_size() {
+    return sizeof(uint32_t);
+  }
+
+  static Status
+  initialize_workspace(
+    void* workspace,
+    cudaStream_t stream,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return zero_workspace(workspace, get_workspace_size(), stream, cuda_adapter);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 
 } // namespace detail
 } // namespace kernel
@@ -0,0 +1,141 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Per-CTA work accounting of persistent tile schedulers for diagnosing load imbalance.
+
+    Recording is compiled in only if CUTLASS_ENABLE_TILE_SCHEDULER_TELEMETRY is defined, and is
+    enabled per launch by pointing the telemetry member of the scheduler arguments to a buffer with
+    one TileSchedulerTelemetry entry per CTA of the grid. The buffer must be initialized with
+    default-constructed entries before every launch, see cutlass/util/tile_scheduler_telemetry.hpp.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+namespace cutlass::gemm::kernel {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Work processed by a CTA of a persistent kernel. Every warp of the CTA running the scheduler
+// contributes to the entry, which therefore spans the first to the last warp of the CTA.
+struct TileSchedulerTelemetry {
+  // Global timer (ns) when the first warp of the CTA started fetching work
+  uint64_t start_time = ~uint64_t(0);
+  // Global timer (ns) when the last warp of the CTA ran out of work
+  uint64_t end_time = 0;
+  // Number of work units (output tiles or stream-K units) processed by the CTA
+  uint32_t tiles = 0;
+  // Number of K tiles (mainloop iterations) processed by the CTA
+  uint32_t k_tiles = 0;
+  // SM on which the CTA ran
+  uint32_t sm_id = 0;
+  uint32_t reserved = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Accumulates the work of the warp running a scheduler and merges it into the telemetry entry
+// of its CTA once the scheduler runs out of work
+class TileSchedulerTelemetryRecorder {
+public:
+#if defined(CUTLASS_ENABLE_TILE_SCHEDULER_TELEMETRY)
+  CUTLASS_DEVICE
+  void
+  begin(TileSchedulerTelemetry* telemetry) {
+    telemetry_ = telemetry;
+    if (telemetry_ != nullptr) {
+      start_time_ = globaltimer();
+    }
+  }
+
+  // Records a work unit of k_tiles K tiles
+  CUTLASS_DEVICE
+  void
+  record(uint32_t k_tiles) {
+    if (telemetry_ != nullptr) {
+      ++tiles_;
+      k_tiles_ += k_tiles;
+    }
+  }
+
+  // Merges the work of this warp into the entry of the CTA. Subsequent calls have no effect.
+  CUTLASS_DEVICE
+  void
+  end() {
+#if defined(__CUDA_ARCH__)
+    if (telemetry_ != nullptr) {
+      if (threadIdx.x % NumThreadsPerWarp == 0) {
+        uint64_t cta_idx = uint64_t(blockIdx.x) + uint64_t(gridDim.x) *
+                           (uint64_t(blockIdx.y) + uint64_t(gridDim.y) * uint64_t(blockIdx.z));
+        TileSchedulerTelemetry* entry = telemetry_ + cta_idx;
+        uint32_t sm_id;
+        asm volatile ("mov.u32 %0, %%smid;\n" : "=r"(sm_id));
+        atomicMin(reinterpret_cast<unsigned long long*>(&entry->start_time), static_cast<unsigned long long>(start_time_));
+        atomicMax(reinterpret_cast<unsigned long long*>(&entry->end_time), static_cast<unsigned long long>(globaltimer()));
+        atomicMax(&entry->tiles, tiles_);
+        atomicMax(&entry->k_tiles, k_tiles_);
+        entry->sm_id = sm_id;
+      }
+      telemetry_ = nullptr;
+    }
+#endif
+  }
+
+private:
+  CUTLASS_DEVICE
+  static uint64_t
+  globaltimer() {
+    uint64_t time = 0;
+#if defined(__CUDA_ARCH__)
+    asm volatile ("mov.u64 %0, %%globaltimer;\n" : "=l"(time));
+#endif
+    return time;
+  }
+
+  TileSchedulerTelemetry* telemetry_ = nullptr;
+  uint64_t start_time_ = 0;
+  uint32_t tiles_ = 0;
+  uint32_t k_tiles_ = 0;
+#else
+  CUTLASS_DEVICE void begin(TileSchedulerTelemetry*) { }
+  CUTLASS_DEVICE void record(uint32_t) { }
+  CUTLASS_DEVICE void end() { }
+#endif
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
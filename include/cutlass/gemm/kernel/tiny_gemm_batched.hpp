@@ -0,0 +1,569 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Batched GEMM for large batches of tiny problems (at most 64 x 64 x 64), packing several
+    problems into every CTA.
+
+    D_l (M x N) = alpha * A_l (M x K) * B_l (K x N) + beta * C_l for l in [0, batch_count), where
+    the extents are compile-time constants and every matrix of the batch is densely packed with the
+    given layout. Batches of matrices are separated by a runtime batch stride.
+
+    One warp computes a whole problem with a single warp-level MMA atom (e.g.
+    SM80_16x8x16_F32F16F16F32_TN, or SM90_16x8x8_F64F64F64F64_TN on SM90), so no CTA tile is wasted
+    on a problem smaller than the tile. A CTA of Warps warps processes Warps * ProblemsPerWarp
+    consecutive problems per stage and walks the batch persistently, with Stages stages in flight.
+    The operands of a stage are selected at runtime:
+
+    - On SM90, the A and B matrices of a stage are loaded with bulk copies (TMA). A densely packed
+      batch is contiguous, so each operand of a stage is a single copy; otherwise each problem is a
+      separate copy. Every problem must start at a 16B aligned address.
+    - On SM80, the same 16B aligned operands are loaded with cp.async.
+    - Otherwise, the CTA loads the operands element by element.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/arch/arch.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+#include "cute/arch/copy_sm80.hpp"
+#include "cute/arch/copy_sm90_tma.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::gemm::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Default warp-level MMA of the tiny GEMM for the given operand and accumulator types
+template <class ElementA, class ElementB, class ElementAccumulator>
+struct TinyGemmDefaultMmaOp {
+  using type = void;
+};
+
+template <>
+struct TinyGemmDefaultMmaOp<half_t, half_t, float> {
+  using type = cute::SM80_16x8x16_F32F16F16F32_TN;
+};
+
+template <>
+struct TinyGemmDefaultMmaOp<half_t, half_t, half_t> {
+  using type = cute::SM80_16x8x16_F16F16F16F16_TN;
+};
+
+template <>
+struct TinyGemmDefaultMmaOp<bfloat16_t, bfloat16_t, float> {
+  using type = cute::SM80_16x8x16_F32BF16BF16F32_TN;
+};
+
+template <>
+struct TinyGemmDefaultMmaOp<tfloat32_t, tfloat32_t, float> {
+  using type = cute::SM80_16x8x8_F32TF32TF32F32_TN;
+};
+
+template <>
+struct TinyGemmDefaultMmaOp<double, double, double> {
+  using type = cute::SM80_8x8x4_F64F64F64F64_TN;
+};
+
+template <>
+struct TinyGemmDefaultMmaOp<int8_t, int8_t, int32_t> {
+  using type = cute::SM80_16x8x32_S32S8S8S32_TN;
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ElementA_,
+  class LayoutA_,                      // layout::RowMajor or layout::ColumnMajor
+  class ElementB_,
+  class LayoutB_,                      // layout::RowMajor or layout::ColumnMajor
+  class ElementC_,
+  class LayoutC_,                      // Layout of C and D, layout::RowMajor or layout::ColumnMajor
+  class ProblemShape_,                 // Static (M, N, K), e.g. cute::Shape<_32,_32,_16>
+  class ElementAccumulator_ = float,
+  class MmaOp_ = typename detail::TinyGemmDefaultMmaOp<ElementA_, ElementB_, ElementAccumulator_>::type,
+  int Warps_ = 4,
+  int ProblemsPerWarp_ = 0,            // Problems of a warp per stage, 0 selects stages of about 8KB
+  int Stages_ = 2,
+  class ElementCompute_ = ElementAccumulator_
+>
+class TinyGemmBatched {
+public:
+  //
+  // Type Aliases
+  //
+  using ElementA = ElementA_;
+  using LayoutA = LayoutA_;
+  using ElementB = ElementB_;
+  using LayoutB = LayoutB_;
+  using ElementC = ElementC_;
+  using LayoutC = LayoutC_;
+  using ElementD = ElementC_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = ElementCompute_;
+  using ProblemShape = ProblemShape_;
+  using MmaOp = MmaOp_;
+  // cp.async and the MMA atoms require SM80, bulk copies are used on SM90 and newer
+  using ArchTag = arch::Sm80;
+
+  static_assert(not cute::is_void_v<MmaOp>,
+    "There is no default MMA atom for these element types, specify MmaOp.");
+
+  using TiledMma = decltype(cute::make_tiled_mma(MmaOp{}));
+
+  static constexpr int M = cute::size<0>(ProblemShape{});
+  static constexpr int N = cute::size<1>(ProblemShape{});
+  static constexpr int K = cute::size<2>(ProblemShape{});
+
+  static constexpr int Warps = Warps_;
+  static constexpr int Stages = Stages_;
+  static constexpr int Threads = Warps * NumThreadsPerWarp;
+
+  static constexpr uint32_t MaxThreadsPerBlock = Threads;
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  static constexpr int ElementsA = M * K;
+  static constexpr int ElementsB = N * K;
+  static constexpr int ElementsC = M * N;
+  static constexpr int BytesA = ElementsA * int(sizeof(ElementA));
+  static constexpr int BytesB = ElementsB * int(sizeof(ElementB));
+
+  static constexpr int ProblemsPerWarp = ProblemsPerWarp_ > 0
+    ? ProblemsPerWarp_ : cute::max(1, 8192 / (Warps * (BytesA + BytesB)));
+  static constexpr int ProblemsPerStage = Warps * ProblemsPerWarp;
+
+  static_assert(cute::is_static_v<ProblemShape> && cute::rank_v<ProblemShape> == 3,
+    "The problem shape must be a static (M, N, K) shape.");
+  static_assert(M <= 64 && N <= 64 && K <= 64,
+    "Tiny GEMM problems are at most 64 x 64 x 64, larger problems should use a tiled GEMM.");
+  static_assert(cute::size(TiledMma{}) == NumThreadsPerWarp, "The MMA atom must be warp-wide.");
+  static_assert(M % cute::tile_size<0>(TiledMma{}) == 0 &&
+                N % cute::tile_size<1>(TiledMma{}) == 0 &&
+                K % cute::tile_size<2>(TiledMma{}) == 0,
+    "The problem shape must be a multiple of the shape of the MMA atom.");
+  static_assert(sizeof_bits<ElementA>::value >= 8 && sizeof_bits<ElementB>::value >= 8,
+    "Sub-byte operands are not supported.");
+  static_assert(BytesA % 16 == 0 && BytesB % 16 == 0,
+    "The operands of a problem must be a multiple of 16B.");
+  static_assert(Warps >= 1 && Stages >= 2, "At least one warp and two stages are required.");
+
+  template <class Layout, class Shape>
+  using MatrixLayout = decltype(cute::make_layout(Shape{},
+    cute::conditional_t<cute::is_same_v<Layout, layout::RowMajor>, cute::LayoutRight, cute::LayoutLeft>{}));
+
+  static_assert(cute::is_same_v<LayoutA, layout::RowMajor> || cute::is_same_v<LayoutA, layout::ColumnMajor>);
+  static_assert(cute::is_same_v<LayoutB, layout::RowMajor> || cute::is_same_v<LayoutB, layout::ColumnMajor>);
+  static_assert(cute::is_same_v<LayoutC, layout::RowMajor> || cute::is_same_v<LayoutC, layout::ColumnMajor>);
+
+  // A problem in the (M,K), (N,K) and (M,N) coordinates of the MMA. A column-major K x N matrix is
+  // a row-major (N,K) matrix.
+  using ProblemLayoutA = MatrixLayout<LayoutA, cute::Shape<cute::Int<M>, cute::Int<K>>>;
+  using ProblemLayoutB = MatrixLayout<
+    cute::conditional_t<cute::is_same_v<LayoutB, layout::RowMajor>, layout::ColumnMajor, layout::RowMajor>,
+    cute::Shape<cute::Int<N>, cute::Int<K>>>;
+  using ProblemLayoutC = MatrixLayout<LayoutC, cute::Shape<cute::Int<M>, cute::Int<N>>>;
+
+  using ThreadEpilogueOp = cutlass::epilogue::thread::LinearCombination<
+    ElementD, 1, ElementAccumulator, ElementCompute>;
+
+  // A stage holds the operands of consecutive problems exactly as they are laid out in a densely
+  // packed batch, so a packed batch is a single bulk copy per operand
+  struct SharedStorage {
+    alignas(128) ElementA smem_A[Stages][ProblemsPerStage * ElementsA];
+    alignas(128) ElementB smem_B[Stages][ProblemsPerStage * ElementsB];
+    alignas(8) uint64_t barriers[Stages];
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  // Device side arguments
+  struct Arguments {
+    int batch_count = 0;
+    ElementA const* ptr_A = nullptr;
+    int64_t batch_stride_A = ElementsA;
+    ElementB const* ptr_B = nullptr;
+    int64_t batch_stride_B = ElementsB;
+    ElementC const* ptr_C = nullptr;
+    int64_t batch_stride_C = ElementsC;
+    ElementD* ptr_D = nullptr;
+    int64_t batch_stride_D = ElementsC;
+    typename ThreadEpilogueOp::Params epilogue{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    int batch_count = 0;
+    ElementA const* ptr_A = nullptr;
+    int64_t batch_stride_A = 0;
+    ElementB const* ptr_B = nullptr;
+    int64_t batch_stride_B = 0;
+    ElementC const* ptr_C = nullptr;
+    int64_t batch_stride_C = 0;
+    ElementD* ptr_D = nullptr;
+    int64_t batch_stride_D = 0;
+    typename ThreadEpilogueOp::Params epilogue{};
+
+    // Every problem starts at a 16B aligned address
+    bool aligned = false;
+    // Operands are loaded with bulk copies
+    bool bulk_copy = false;
+    // The operands of consecutive problems are contiguous
+    bool packed_A = false;
+    bool packed_B = false;
+    int tile_count = 0;
+    int cta_count = 0;
+  };
+
+  //
+  // Methods
+  //
+
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    Params params;
+    params.batch_count = args.batch_count;
+    params.ptr_A = args.ptr_A;
+    params.batch_stride_A = args.batch_stride_A;
+    params.ptr_B = args.ptr_B;
+    params.batch_stride_B = args.batch_stride_B;
+    params.ptr_C = args.ptr_C;
+    params.batch_stride_C = args.batch_stride_C;
+    params.ptr_D = args.ptr_D;
+    params.batch_stride_D = args.batch_stride_D;
+    params.epilogue = args.epilogue;
+
+    params.aligned = is_aligned(args.ptr_A, args.batch_stride_A) && is_aligned(args.ptr_B, args.batch_stride_B);
+    params.packed_A = args.batch_stride_A == ElementsA;
+    params.packed_B = args.batch_stride_B == ElementsB;
+
+    int sm_count = args.hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+    }
+    int major = query_device_attribute(cudaDevAttrComputeCapabilityMajor, args.hw_info.device_id);
+    int smem_per_sm = query_device_attribute(cudaDevAttrMaxSharedMemoryPerMultiprocessor, args.hw_info.device_id);
+    params.bulk_copy = params.aligned && major >= 9;
+
+    // Persistent CTAs, as many as are resident at once
+    int ctas_per_sm = cute::max(1, cute::min(2048 / Threads, smem_per_sm / SharedStorageSize));
+    params.tile_count = cute::ceil_div(args.batch_count, ProblemsPerStage);
+    params.cta_count = cute::max(1, cute::min(params.tile_count, sm_count * ctas_per_sm));
+
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.batch_count < 0 || args.ptr_A == nullptr || args.ptr_B == nullptr || args.ptr_D == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: A, B and D must not be null.\n");
+      return false;
+    }
+    if (args.batch_stride_A < 0 || args.batch_stride_B < 0 || args.batch_stride_C < 0 || args.batch_stride_D < 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Batch strides must not be negative.\n");
+      return false;
+    }
+    if (args.ptr_C == nullptr && ThreadEpilogueOp(args.epilogue).is_source_needed()) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: C must not be null if beta is not zero.\n");
+      return false;
+    }
+    return true;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return dim3(params.cta_count, 1, 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    using namespace cute;
+
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int thread_idx = int(threadIdx.x);
+    int warp_idx = canonical_warp_idx_sync();
+    int lane_idx = thread_idx % NumThreadsPerWarp;
+
+    // Tiles blockIdx.x, blockIdx.x + gridDim.x, ... of ProblemsPerStage problems belong to this CTA
+    int local_tiles = params.tile_count > int(blockIdx.x)
+      ? (params.tile_count - int(blockIdx.x) + int(gridDim.x) - 1) / int(gridDim.x) : 0;
+    auto first_problem = [&](int iter) {
+      return (int(blockIdx.x) + iter * int(gridDim.x)) * ProblemsPerStage;
+    };
+
+    bool bulk_copy = false;
+#if defined(CUTE_ARCH_TMA_SM90_ENABLED)
+    bulk_copy = params.bulk_copy;
+    if (bulk_copy && thread_idx == 0) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int stage = 0; stage < Stages; ++stage) {
+        cutlass::arch::ClusterTransactionBarrier::init(&shared_storage.barriers[stage], 1);
+      }
+      cutlass::arch::fence_barrier_init();
+    }
+    __syncthreads();
+#endif
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int iter = 0; iter < Stages; ++iter) {
+      load_stage(params, shared_storage, iter, first_problem(iter), iter < local_tiles, bulk_copy);
+    }
+
+    TiledMma tiled_mma;
+    auto thr_mma = tiled_mma.get_slice(lane_idx);
+    ThreadEpilogueOp output_op(params.epilogue);
+    bool source_needed = output_op.is_source_needed();
+
+    for (int iter = 0; iter < local_tiles; ++iter) {
+      int stage = iter % Stages;
+      wait_stage(shared_storage, iter, bulk_copy);
+
+      // Interleaving the problems of the warps keeps every warp busy on the last partial tile
+      CUTLASS_PRAGMA_NO_UNROLL
+      for (int p = warp_idx; p < ProblemsPerStage; p += Warps) {
+        int problem = first_problem(iter) + p;
+        if (problem >= params.batch_count) {
+          break;
+        }
+
+        Tensor sA = make_tensor(make_smem_ptr(shared_storage.smem_A[stage] + p * ElementsA), ProblemLayoutA{});
+        Tensor sB = make_tensor(make_smem_ptr(shared_storage.smem_B[stage] + p * ElementsB), ProblemLayoutB{});
+
+        Tensor tCsA = thr_mma.partition_A(sA);                                    // (MMA,MMA_M,MMA_K)
+        Tensor tCsB = thr_mma.partition_B(sB);                                    // (MMA,MMA_N,MMA_K)
+        Tensor tCrA = thr_mma.partition_fragment_A(sA);                           // (MMA,MMA_M,MMA_K)
+        Tensor tCrB = thr_mma.partition_fragment_B(sB);                           // (MMA,MMA_N,MMA_K)
+        Tensor accum = partition_fragment_C(tiled_mma, Shape<Int<M>, Int<N>>{});  // (MMA,MMA_M,MMA_N)
+        clear(accum);
+
+        CUTLASS_PRAGMA_UNROLL
+        for (int k_block = 0; k_block < size<2>(tCrA); ++k_block) {
+          copy(tCsA(_,_,k_block), tCrA(_,_,k_block));
+          copy(tCsB(_,_,k_block), tCrB(_,_,k_block));
+          gemm(tiled_mma, accum, tCrA(_,_,k_block), tCrB(_,_,k_block), accum);
+        }
+
+        Tensor gD = make_tensor(make_gmem_ptr(params.ptr_D + problem * params.batch_stride_D), ProblemLayoutC{});
+        Tensor tCgD = thr_mma.partition_C(gD);
+        typename ThreadEpilogueOp::FragmentAccumulator frag_accum;
+        if (source_needed) {
+          Tensor gC = make_tensor(make_gmem_ptr(params.ptr_C + problem * params.batch_stride_C), ProblemLayoutC{});
+          Tensor tCgC = thr_mma.partition_C(gC);
+          typename ThreadEpilogueOp::FragmentSource frag_source;
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(accum); ++i) {
+            frag_accum[0] = accum(i);
+            frag_source[0] = tCgC(i);
+            tCgD(i) = output_op(frag_accum, frag_source)[0];
+          }
+        }
+        else {
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < size(accum); ++i) {
+            frag_accum[0] = accum(i);
+            tCgD(i) = output_op(frag_accum)[0];
+          }
+        }
+      }
+
+      // Every warp is done with the stage before it is refilled
+      __syncthreads();
+      int next = iter + Stages;
+      load_stage(params, shared_storage, next, first_problem(next), next < local_tiles, bulk_copy);
+    }
+  }
+
+private:
+
+  template <class Element>
+  static bool
+  is_aligned(Element const* ptr, int64_t batch_stride) {
+    constexpr int64_t Alignment = 16;
+    return reinterpret_cast<uintptr_t>(ptr) % Alignment == 0 &&
+           (batch_stride * int64_t(sizeof(Element))) % Alignment == 0;
+  }
+
+  static int
+  query_device_attribute(cudaDeviceAttr attribute, int device_id) {
+    int value = 0;
+    if (cudaDeviceGetAttribute(&value, attribute, device_id) != cudaSuccess) {
+      cudaGetLastError(); // to clear the error bit
+      return 0;
+    }
+    return value;
+  }
+
+  // Loads the operands of the problems [first, first + ProblemsPerStage) into the stage of
+  // iteration iter. Every thread calls this once per iteration, even without work, so that the
+  // cp.async groups of the iterations stay in step.
+  CUTLASS_DEVICE
+  static void
+  load_stage(Params const& params, SharedStorage& shared_storage, int iter, int first, bool valid, bool bulk_copy) {
+    int thread_idx = int(threadIdx.x);
+    int stage = iter % Stages;
+    int count = valid ? cute::min(ProblemsPerStage, params.batch_count - first) : 0;
+    ElementA* smem_A = shared_storage.smem_A[stage];
+    ElementB* smem_B = shared_storage.smem_B[stage];
+
+#if defined(CUTE_ARCH_TMA_SM90_ENABLED)
+    if (bulk_copy) {
+      using Barrier = cutlass::arch::ClusterTransactionBarrier;
+      if (count == 0 || thread_idx >= NumThreadsPerWarp) {
+        return;
+      }
+      uint64_t* barrier = &shared_storage.barriers[stage];
+      if (thread_idx == 0) {
+        Barrier::arrive_and_expect_tx(barrier, uint32_t(count) * uint32_t(BytesA + BytesB));
+      }
+      __syncwarp();
+      if (params.packed_A) {
+        if (thread_idx == 0) {
+          cute::SM90_BULK_COPY_G2S::copy(params.ptr_A + int64_t(first) * ElementsA, barrier,
+                                         smem_A, count * BytesA);
+        }
+      }
+      else {
+        for (int p = thread_idx; p < count; p += NumThreadsPerWarp) {
+          cute::SM90_BULK_COPY_G2S::copy(params.ptr_A + int64_t(first + p) * params.batch_stride_A, barrier,
+                                         smem_A + p * ElementsA, BytesA);
+        }
+      }
+      if (params.packed_B) {
+        if (thread_idx == 0) {
+          cute::SM90_BULK_COPY_G2S::copy(params.ptr_B + int64_t(first) * ElementsB, barrier,
+                                         smem_B, count * BytesB);
+        }
+      }
+      else {
+        for (int p = thread_idx; p < count; p += NumThreadsPerWarp) {
+          cute::SM90_BULK_COPY_G2S::copy(params.ptr_B + int64_t(first + p) * params.batch_stride_B, barrier,
+                                         smem_B + p * ElementsB, BytesB);
+        }
+      }
+      return;
+    }
+#endif
+
+#if defined(CUTE_ARCH_CP_ASYNC_SM80_ENABLED)
+    if (params.aligned) {
+      load_operand_async<ElementsA>(params.ptr_A, params.batch_stride_A, smem_A, first, count);
+      load_operand_async<ElementsB>(params.ptr_B, params.batch_stride_B, smem_B, first, count);
+      cute::cp_async_fence();
+      return;
+    }
+#endif
+
+    load_operand<ElementsA>(params.ptr_A, params.batch_stride_A, smem_A, first, count);
+    load_operand<ElementsB>(params.ptr_B, params.batch_stride_B, smem_B, first, count);
+  }
+
+  // Waits until the operands of iteration iter are visible to every thread
+  CUTLASS_DEVICE
+  static void
+  wait_stage(SharedStorage& shared_storage, int iter, bool bulk_copy) {
+#if defined(CUTE_ARCH_TMA_SM90_ENABLED)
+    if (bulk_copy) {
+      cutlass::arch::ClusterTransactionBarrier::wait(&shared_storage.barriers[iter % Stages],
+                                                     uint32_t((iter / Stages) & 1));
+      return;
+    }
+#endif
+#if defined(CUTE_ARCH_CP_ASYNC_SM80_ENABLED)
+    // One group is committed per iteration, the groups of the following iterations may be in flight
+    cute::cp_async_wait<Stages - 1>();
+#endif
+    __syncthreads();
+  }
+
+  template <int ElementsPerProblem, class Element>
+  CUTLASS_DEVICE
+  static void
+  load_operand_async(Element const* ptr, int64_t batch_stride, Element* smem, int first, int count) {
+    constexpr int Chunks = ElementsPerProblem * int(sizeof(Element)) / 16;
+    for (int c = int(threadIdx.x); c < count * Chunks; c += Threads) {
+      int p = c / Chunks;
+      int q = c % Chunks;
+      auto const* src = reinterpret_cast<cute::uint128_t const*>(ptr + int64_t(first + p) * batch_stride) + q;
+      auto* dst = reinterpret_cast<cute::uint128_t*>(smem + p * ElementsPerProblem) + q;
+      cute::SM80_CP_ASYNC_CACHEGLOBAL<cute::uint128_t>::copy(*src, *dst);
+    }
+  }
+
+  template <int ElementsPerProblem, class Element>
+  CUTLASS_DEVICE
+  static void
+  load_operand(Element const* ptr, int64_t batch_stride, Element* smem, int first, int count) {
+    for (int e = int(threadIdx.x); e < count * ElementsPerProblem; e += Threads) {
+      int p = e / ElementsPerProblem;
+      smem[e] = ptr[int64_t(first + p) * batch_stride + (e % ElementsPerProblem)];
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::gemm::kernel
+
+///////////////////////////////////////////////////////////////////////////////
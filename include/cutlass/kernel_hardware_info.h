@@ -35,11 +35,116 @@
 #include "cuda_runtime.h"
 #include "cutlass/cluster_launch.hpp"
 #include "cutlass/trace.h"
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
 #endif
 #include <cute/int_tuple.hpp>
 
 namespace cutlass {
 
+// Point at which a GEMM or conv kernel issues griddepcontrol.launch_dependents, i.e. how early the
+// prologue of a kernel launched after it with programmatic dependent launch may start. Only affects
+// performance: dependents still wait for this grid to complete before touching its outputs.
+enum class PdlReleasePoint {
+  MainloopDone,        // After the MMA of the CTA's last tile has been issued
+  MainloopLoadDone,    // After the producer has issued the CTA's last mainloop load
+  EpilogueStoreIssued  // After the epilogue has issued the CTA's last output store
+};
+
+#if !defined(__CUDACC_RTC__)
+namespace detail {
+
+// Process-wide memo of the device and occupancy queries issued by KernelHardwareInfo. Building the
+// arguments of every 3.x kernel resolves the SM count and, for persistent kernels, the number of
+// co-resident clusters; both are invariant for a given device partition, so only the first query
+// reaches the runtime. Failed queries are not memoized. Define CUTLASS_DISABLE_KERNEL_HARDWARE_INFO_CACHE
+// to always query the runtime.
+class KernelHardwareInfoCache {
+public:
+  struct ClusterOccupancyKey {
+    int device_id;
+    void const* kernel_ptr;
+    uint32_t cluster_x, cluster_y, cluster_z;
+    uint32_t threads_per_block;
+    int smem_size;
+    cudaStream_t stream;   // Green context streams see their own SM partition
+
+    bool operator<(ClusterOccupancyKey const& rhs) const {
+      return std::tie(device_id, kernel_ptr, cluster_x, cluster_y, cluster_z, threads_per_block, smem_size, stream) <
+             std::tie(rhs.device_id, rhs.kernel_ptr, rhs.cluster_x, rhs.cluster_y, rhs.cluster_z,
+                      rhs.threads_per_block, rhs.smem_size, rhs.stream);
+    }
+  };
+
+  static KernelHardwareInfoCache& get() {
+    static KernelHardwareInfoCache cache;
+    return cache;
+  }
+
+  bool find_sm_count(int device_id, int& sm_count) const { return find(sm_counts_, device_id, sm_count); }
+  void insert_sm_count(int device_id, int sm_count) { insert(sm_counts_, device_id, sm_count); }
+
+  bool find_l2_cache_size(int device_id, int& size) const { return find(l2_cache_sizes_, device_id, size); }
+  void insert_l2_cache_size(int device_id, int size) { insert(l2_cache_sizes_, device_id, size); }
+
+  bool find_max_active_clusters(ClusterOccupancyKey const& key, int& count) const {
+    return find(max_active_clusters_, key, count);
+  }
+  void insert_max_active_clusters(ClusterOccupancyKey const& key, int count) {
+    insert(max_active_clusters_, key, count);
+  }
+
+  // Drops the memoized results of one device, or of all devices when device_id is negative.
+  void invalidate(int device_id = -1) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (device_id < 0) {
+      sm_counts_.clear();
+      l2_cache_sizes_.clear();
+      max_active_clusters_.clear();
+      return;
+    }
+    sm_counts_.erase(device_id);
+    l2_cache_sizes_.erase(device_id);
+    for (auto it = max_active_clusters_.begin(); it != max_active_clusters_.end(); ) {
+      it = (it->first.device_id == device_id) ? max_active_clusters_.erase(it) : std::next(it);
+    }
+  }
+
+private:
+  template <class Map, class Key>
+  bool find(Map const& map, Key const& key, int& value) const {
+#if defined(CUTLASS_DISABLE_KERNEL_HARDWARE_INFO_CACHE)
+    return false;
+#else
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = map.find(key);
+    if (it == map.end()) {
+      return false;
+    }
+    value = it->second;
+    return true;
+#endif
+  }
+
+  template <class Map, class Key>
+  void insert(Map& map, Key const& key, int value) {
+#if !defined(CUTLASS_DISABLE_KERNEL_HARDWARE_INFO_CACHE)
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map[key] = value;
+#endif
+  }
+
+  mutable std::shared_mutex mutex_;
+  std::map<int, int> sm_counts_;
+  std::map<int, int> l2_cache_sizes_;
+  std::map<ClusterOccupancyKey, int> max_active_clusters_;
+};
+
+} // namespace detail
+#endif
+
 struct KernelHardwareInfo {
   //
   // Data members
@@ -54,6 +159,17 @@ struct KernelHardwareInfo {
   dim3 cluster_shape = {0,0,0};             
   dim3 cluster_shape_fallback = {0,0,0};    
 
+  // L2 cache size in bytes, used by the L2-aware tile orders. Queried when left at 0.
+  int l2_cache_size = 0;
+
+  // Maximum number of CTAs a persistent kernel may keep resident, for sharing the device with
+  // co-located kernels. Rounded down to whole clusters by the persistent tile schedulers. 0 means
+  // the kernel may occupy the whole device (or the green context partition it is launched into).
+  int cta_budget = 0;
+
+  // Where kernels supporting programmatic dependent launch release their dependents.
+  PdlReleasePoint pdl_release_point = PdlReleasePoint::MainloopDone;
+
   //
   // Methods
   //
@@ -69,6 +185,10 @@ struct KernelHardwareInfo {
       return 0;
     }
     int multiprocessor_count;
+    auto& cache = detail::KernelHardwareInfoCache::get();
+    if (cache.find_sm_count(device_id, multiprocessor_count)) {
+      return multiprocessor_count;
+    }
     result = cudaDeviceGetAttribute(&multiprocessor_count,
       cudaDevAttrMultiProcessorCount, device_id);
     if (result != cudaSuccess) {
@@ -77,24 +197,56 @@ struct KernelHardwareInfo {
         << cudaGetErrorString(result));
       return 0;
     }
+    cache.insert_sm_count(device_id, multiprocessor_count);
     return multiprocessor_count;
   }
 
+  static inline int
+  query_device_l2_cache_size(int device_id = 0) {
+    int l2_cache_size = 0;
+    auto& cache = detail::KernelHardwareInfoCache::get();
+    if (cache.find_l2_cache_size(device_id, l2_cache_size)) {
+      return l2_cache_size;
+    }
+    cudaError_t result = cudaDeviceGetAttribute(&l2_cache_size,
+      cudaDevAttrL2CacheSize, device_id);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST(
+        "  cudaDeviceGetAttribute() returned error "
+        << cudaGetErrorString(result));
+      return 0;
+    }
+    cache.insert_l2_cache_size(device_id, l2_cache_size);
+    return l2_cache_size;
+  }
+
   // Query maximum number of active clusters that could co-exist on the target device
   // based on kernel properties such as cluster dims and threadblock dims.
   // When a green context stream is provided, the occupancy query is scoped to the
   // green context's SM partition, returning the max active clusters for that partition.
+  // Results are memoized per (device, kernel, cluster shape, block size, smem size, stream).
   static inline int
   query_device_max_active_clusters(
       dim3 cluster_dims,
       uint32_t threads_per_block,
       void const* kernel_ptr,
-      cudaStream_t stream = nullptr) {
+      cudaStream_t stream = nullptr,
+      int smem_size = 0) {
     int max_active_clusters = 0;
 #if defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
+    int device_id = 0;
+    if (cudaGetDevice(&device_id) != cudaSuccess) {
+      device_id = -1;
+    }
+    detail::KernelHardwareInfoCache::ClusterOccupancyKey key{
+      device_id, kernel_ptr, cluster_dims.x, cluster_dims.y, cluster_dims.z, threads_per_block, smem_size, stream};
+    auto& cache = detail::KernelHardwareInfoCache::get();
+    if (device_id >= 0 && cache.find_max_active_clusters(key, max_active_clusters)) {
+      return max_active_clusters;
+    }
     ClusterLauncher::LaunchConfig cluster_launch_config = ClusterLauncher::make_cluster_launch_config(
                                                             cluster_dims /* minimum grid dim */, cluster_dims, {threads_per_block, 1, 1},
-                                                            0 /* smem_size */, stream /* green ctx stream or nullptr */);
+                                                            smem_size, stream /* green ctx stream or nullptr */);
     // Given the kernel function and launch configuration, return the maximum number of clusters that could co-exist on the target device.
     // When stream is a green context stream, this returns the max active clusters for that partition.
     cudaError_t result = cudaOccupancyMaxActiveClusters(&max_active_clusters, kernel_ptr, &cluster_launch_config.launch_config);
@@ -106,6 +258,9 @@ struct KernelHardwareInfo {
     }
     CUTLASS_TRACE_HOST("cudaOccupancyMaxActiveClusters: maximum number of clusters that could co-exist on the target device = "
         << max_active_clusters << "\n");
+    if (device_id >= 0 && max_active_clusters > 0) {
+      cache.insert_max_active_clusters(key, max_active_clusters);
+    }
     return max_active_clusters;
 #else
     CUTLASS_TRACE_HOST("ClusterLauncher: CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED not defined! Aborting cluster occupancy query.");
@@ -132,14 +287,24 @@ struct KernelHardwareInfo {
   template <typename Kernel>
   static inline KernelHardwareInfo
   make_kernel_hardware_info(int const device_id = 0, int sm_count = 0, int max_active_clusters = 0,
-                            cudaStream_t stream = nullptr) {
+                            cudaStream_t stream = nullptr, int cta_budget = 0) {
     if (sm_count == 0) {
       sm_count = query_device_multiprocessor_count(device_id);
     }
     if (max_active_clusters == 0) {
       max_active_clusters = query_device_max_active_clusters<Kernel>(stream);
     }
-    return {device_id, sm_count, max_active_clusters};
+    KernelHardwareInfo hw_info{device_id, sm_count, max_active_clusters};
+    hw_info.cta_budget = cta_budget;
+    return hw_info;
+  }
+
+  // Drops the memoized query results of one device (all devices when device_id is negative). Call
+  // after the SM partition visible to the process changes, e.g. when green contexts are recreated or
+  // the MPS active thread percentage is updated, or before reusing a destroyed stream's handle.
+  static inline void
+  invalidate_cached_queries(int device_id = -1) {
+    detail::KernelHardwareInfoCache::get().invalidate(device_id);
   }
 #endif
 };
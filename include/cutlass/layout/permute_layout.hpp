@@ -0,0 +1,174 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief CuTe layouts describing permuted (reshaped + transposed) views of GEMM operands.
+
+    CUTLASS 3.x kernels accept hierarchical strides for A, B, C and D, so a permutation such as the
+    attention head split [B,S,H,D] -> [B,H,S,D] can be fused into the mainloop loads or epilogue stores
+    by describing the permuted tensor as a rank-3 (M,N,L) / (M,K,L) / (N,K,L) layout whose modes are
+    themselves multi-dimensional. The problem shape passed to the kernel must use the same hierarchical
+    mode structure (see examples/53_hopper_gemm_permute).
+
+    TMA based collectives can only consume such layouts when the tensor is TMA expressible;
+    is_tma_expressible() lets the caller select a non-TMA (NoSmem / CpAsync) collective otherwise.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cute/algorithm/tuple_algorithms.hpp"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::layout {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Placeholder for the shape division result in a reshape profile
+using X = cute::Underscore;
+
+// Reshape a shape into a multidimensional shape.
+// Input:
+//   shape = (A, B, ...)
+//   target_shape = ((A1, ..., X, ..., Am), (B1, ..., X, ..., Bn), ...)
+// Output:
+//   ((A1, ..., A/prod(A1..Am), ..., Am), (B1, ..., B/prod(B1..Bn), ..., Bn), ...)
+template <class Shape, class TargetShape>
+CUTLASS_HOST_DEVICE constexpr
+auto
+reshape_modes(Shape const& shape, TargetShape const& target_shape) {
+  if constexpr (cute::is_tuple<Shape>::value) {
+    return cute::transform(shape, target_shape, [](auto const& s, auto const& t) { return reshape_modes(s, t); });
+  }
+  else {
+    auto idx = cute::find_if(target_shape, [](auto x) { return cute::is_underscore<decltype(x)>{}; });
+    constexpr int I = decltype(idx)::value;
+    static_assert(I < cute::tuple_size_v<TargetShape>, "Each mode of TargetShape must contain a placeholder X");
+    auto divisors = cute::remove<I>(target_shape);
+    assert(shape % cute::product(divisors) == 0);
+    return cute::replace<I>(target_shape, shape / cute::product(divisors));
+  }
+}
+
+// Given the rank-3 [row,col,batch] layout of a packed matrix, compute the layout of its permuted view:
+// - ShapeProfile splits each mode into the sub-modes of the implied multidimensional tensor
+// - StrideOrder gives the memory order of those sub-modes in the permuted tensor (0 = fastest)
+// For operand B, whose CuTe-canonical mode order is [N,K,L], pass Transpose = true.
+template <bool Transpose = false, class Shape, class Stride, class ShapeProfile, class StrideOrder>
+CUTLASS_HOST_DEVICE constexpr
+auto
+make_permuted_layout(cute::Layout<Shape,Stride> const& layout, ShapeProfile const& profile, StrideOrder const& order) {
+  static_assert(cute::rank(Shape{}) == 3, "Only rank-3 layouts are supported");
+  if constexpr (Transpose) {
+    return cute::select<1,0,2>(make_permuted_layout<false>(cute::select<1,0,2>(layout), profile, order));
+  }
+  else {
+    return cute::make_ordered_layout(reshape_modes(layout.shape(), profile), order);
+  }
+}
+
+// View a packed [B,H,S,D] tensor (e.g. attention Q/K/V after the head split) as a
+// (B*S) x (H*D) row-major matrix with batch count l, i.e. the shape ((S,B),(D,H),L).
+// Storing D through this layout fuses the head split [B,S,H,D] -> [B,H,S,D] into the epilogue;
+// loading A through it fuses the head merge [B,H,S,D] -> [B,S,H,D] into the mainloop.
+template <class IntT>
+CUTLASS_HOST_DEVICE constexpr
+auto
+make_bhsd_matrix_layout(IntT batch, IntT seq_len, IntT heads, IntT head_dim, IntT l = 1) {
+  int64_t s_stride = head_dim;
+  int64_t h_stride = s_stride * seq_len;
+  int64_t b_stride = h_stride * heads;
+  int64_t l_stride = b_stride * batch;
+  return cute::make_layout(
+    cute::make_shape(cute::make_shape(seq_len, batch), cute::make_shape(head_dim, heads), l),
+    cute::make_stride(cute::make_stride(s_stride, b_stride), cute::make_stride(cute::Int<1>{}, h_stride), l_stride));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Returns true if a (possibly hierarchical) tensor layout can be described by a single TMA descriptor:
+// after dropping unit modes and merging modes that are contiguous in memory, at most 5 modes remain,
+// one of them has unit stride, and every other stride is a multiple of 16B below 2^40B.
+// This is a necessary condition checked on the host before the TMA descriptor is encoded; callers
+// should fall back to a non-TMA collective with per-thread vectorized accesses when it fails.
+template <class Element, class Shape, class Stride>
+CUTLASS_HOST_DEVICE constexpr
+bool
+is_tma_expressible(cute::Layout<Shape,Stride> const& layout) {
+  constexpr int MaxTmaRank = 5;
+  constexpr int MaxModes = cute::rank(cute::flatten(Shape{}));
+  int64_t shapes[MaxModes]  = {};
+  int64_t strides[MaxModes] = {};
+  int num_modes = 0;
+
+  auto flat = cute::flatten(layout);
+  cute::for_each(cute::make_seq<MaxModes>{}, [&](auto i) {
+    int64_t extent = cute::shape<i>(flat);
+    int64_t stride = cute::stride<i>(flat);
+    if (extent == 1) {
+      return;
+    }
+    // Merge with the previous mode if the two are contiguous in memory
+    if (num_modes > 0 && strides[num_modes - 1] * shapes[num_modes - 1] == stride) {
+      shapes[num_modes - 1] *= extent;
+      return;
+    }
+    shapes[num_modes] = extent;
+    strides[num_modes] = stride;
+    ++num_modes;
+  });
+
+  if (num_modes > MaxTmaRank) {
+    return false;
+  }
+
+  bool has_unit_stride = num_modes == 0;
+  for (int i = 0; i < num_modes; ++i) {
+    if (strides[i] == 1) {
+      has_unit_stride = true;
+      continue;
+    }
+    int64_t stride_bits = strides[i] * cutlass::sizeof_bits<Element>::value;
+    if (strides[i] < 0 || stride_bits % 128 != 0 || (stride_bits / 8) >= (int64_t(1) << 40)) {
+      return false;
+    }
+  }
+  return has_unit_stride;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::layout
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -61,7 +61,8 @@ enum class FloatRoundStyle {
   round_toward_infinity,        ///< round toward infinity
   round_toward_neg_infinity,    ///< round toward negative infinity
   round_half_ulp_truncate,      ///< add 0.5ulp to integer representation then round toward zero
-  round_half_ulp_trunc_dntz     ///< like round_half_ulp_truncate, except denorms are rounded *toward* zero
+  round_half_ulp_trunc_dntz,    ///< like round_half_ulp_truncate, except denorms are rounded *toward* zero
+  round_stochastic              ///< round up or down with probability given by caller-supplied random bits
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -7888,6 +7889,176 @@ public:
 
 #endif // defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 800)
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Stochastic rounding
+//
+// NumericArrayConverter<T, float, N, FloatRoundStyle::round_stochastic> rounds each element up or
+// down with probability proportional to its distance from the two neighboring representable values
+// of T, saturating to the largest finite value. The random bits are supplied by the caller as one
+// 32b word per kElementsPerRandomWord elements, so the result is a pure function of the source and
+// the random bits (e.g. Philox output keyed on the element coordinate).
+//
+// SM100a/SM103a use cvt.rs. Elsewhere a portable implementation consumes the same number of
+// random bits per element; it is unbiased as well but not bit-identical to cvt.rs.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if (defined(CUTLASS_ARCH_MMA_SM100A_ENABLED) || defined(CUTLASS_ARCH_MMA_SM103A_ENABLED))
+#  define CUDA_PTX_CVT_RS_ENABLED 1
+#endif
+
+namespace detail {
+
+/// Rounds |source| to one of its two neighbors in T, selected by the low RandomBits bits of rbits
+template <typename T, int RandomBits>
+CUTLASS_HOST_DEVICE
+T stochastic_round(float source, uint32_t rbits) {
+  using Storage = typename cutlass::platform::remove_reference<decltype(T{}.raw())>::type;
+  constexpr Storage kSignMask = Storage(1u << (cutlass::sizeof_bits<T>::value - 1));
+  constexpr float kMaxFloat = 3.40282347e+38f;
+
+  if (!(source == source)) {
+    return T(source);
+  }
+
+  bool negative = source < 0.f;
+  float magnitude = negative ? -source : source;
+
+  // Round to nearest, then step toward zero until finite (covers saturation of out-of-range inputs)
+  Storage nearest = T(magnitude).raw();
+  while (!(float(T::bitcast(nearest)) <= kMaxFloat)) {
+    --nearest;
+  }
+
+  float nearest_value = float(T::bitcast(nearest));
+  Storage result = nearest;
+  if (nearest_value != magnitude) {
+    Storage lo = nearest_value < magnitude ? nearest : Storage(nearest - 1);
+    Storage hi = Storage(lo + 1);
+    float lo_value = float(T::bitcast(lo));
+    float hi_value = float(T::bitcast(hi));
+    if (!(hi_value <= kMaxFloat)) {
+      result = lo;                       // satfinite
+    }
+    else {
+      float probability = (magnitude - lo_value) / (hi_value - lo_value);
+      uint32_t mask = RandomBits >= 32 ? ~0u : ((1u << (RandomBits % 32)) - 1u);
+      float random = float(rbits & mask) * (1.f / float(uint64_t(1) << RandomBits));
+      result = random < probability ? hi : lo;
+    }
+  }
+  return T::bitcast(Storage(negative ? (result | kSignMask) : result));
+}
+
+/// Shared implementation of the stochastic rounding array converters
+template <typename T, int N, int ElementsPerRandomWord>
+struct NumericArrayConverterStochastic {
+  static constexpr int kElementsPerRandomWord = ElementsPerRandomWord;
+  static constexpr int kRandomBits = 32 / ElementsPerRandomWord;
+  static constexpr int kRandomWords = (N + ElementsPerRandomWord - 1) / ElementsPerRandomWord;
+
+  using result_type = Array<T, N>;
+  using source_type = Array<float, N>;
+  using random_type = Array<uint32_t, kRandomWords>;
+  static FloatRoundStyle const round_style = FloatRoundStyle::round_stochastic;
+
+  CUTLASS_HOST_DEVICE
+  static result_type convert(source_type const & source, random_type const & rbits) {
+    result_type result;
+
+  #if defined(__CUDA_ARCH__) && defined(CUDA_PTX_CVT_RS_ENABLED)
+    if constexpr (N % ElementsPerRandomWord == 0) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kRandomWords; ++i) {
+        float const* src = &source[i * ElementsPerRandomWord];
+        if constexpr (cutlass::platform::is_same<T, cutlass::bfloat16_t>::value) {
+          asm volatile("cvt.rs.satfinite.bf16x2.f32 %0, %1, %2, %3;\n"
+            : "=r"(reinterpret_cast<uint32_t*>(&result)[i])
+            : "f"(src[1]), "f"(src[0]), "r"(rbits[i]));
+        }
+        else if constexpr (cutlass::platform::is_same<T, cutlass::float_e4m3_t>::value) {
+          asm volatile("cvt.rs.satfinite.e4m3x4.f32 %0, {%1, %2, %3, %4}, %5;\n"
+            : "=r"(reinterpret_cast<uint32_t*>(&result)[i])
+            : "f"(src[3]), "f"(src[2]), "f"(src[1]), "f"(src[0]), "r"(rbits[i]));
+        }
+        else if constexpr (cutlass::platform::is_same<T, cutlass::float_e5m2_t>::value) {
+          asm volatile("cvt.rs.satfinite.e5m2x4.f32 %0, {%1, %2, %3, %4}, %5;\n"
+            : "=r"(reinterpret_cast<uint32_t*>(&result)[i])
+            : "f"(src[3]), "f"(src[2]), "f"(src[1]), "f"(src[0]), "r"(rbits[i]));
+        }
+        else {
+          static_assert(cutlass::platform::is_same<T, cutlass::float_e2m1_t>::value, "Unsupported stochastic rounding type");
+          asm volatile("cvt.rs.satfinite.e2m1x4.f32 %0, {%1, %2, %3, %4}, %5;\n"
+            : "=h"(reinterpret_cast<uint16_t*>(&result)[i])
+            : "f"(src[3]), "f"(src[2]), "f"(src[1]), "f"(src[0]), "r"(rbits[i]));
+        }
+      }
+      return result;
+    }
+  #endif
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int i = 0; i < N; ++i) {
+      uint32_t word = rbits[i / ElementsPerRandomWord] >> ((i % ElementsPerRandomWord) * kRandomBits);
+      result[i] = stochastic_round<T, kRandomBits>(source[i], word);
+    }
+    return result;
+  }
+
+  CUTLASS_HOST_DEVICE
+  result_type operator()(source_type const &s, random_type const &rbits) const {
+    return convert(s, rbits);
+  }
+};
+
+} // namespace detail
+
+/// Partial specialization for Array<cutlass::bfloat16_t, N> <= Array<float, N> with stochastic rounding
+/// (one random word per 2 elements)
+template <int N>
+struct NumericArrayConverter<cutlass::bfloat16_t, float, N, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::bfloat16_t, N, 2> { };
+
+/// Partial specialization for Array<cutlass::float_e4m3_t, N> <= Array<float, N> with stochastic rounding
+/// (one random word per 4 elements)
+template <int N>
+struct NumericArrayConverter<cutlass::float_e4m3_t, float, N, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e4m3_t, N, 4> { };
+
+/// Partial specialization for Array<cutlass::float_e5m2_t, N> <= Array<float, N> with stochastic rounding
+/// (one random word per 4 elements)
+template <int N>
+struct NumericArrayConverter<cutlass::float_e5m2_t, float, N, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e5m2_t, N, 4> { };
+
+/// Partial specialization for Array<cutlass::float_e2m1_t, N> <= Array<float, N> with stochastic rounding
+/// (one random word per 4 elements)
+template <int N>
+struct NumericArrayConverter<cutlass::float_e2m1_t, float, N, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e2m1_t, N, 4> { };
+
+// Disambiguate from the fixed-width specializations above that are generic in the rounding style
+template <>
+struct NumericArrayConverter<cutlass::float_e4m3_t, float, 2, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e4m3_t, 2, 4> { };
+
+template <>
+struct NumericArrayConverter<cutlass::float_e5m2_t, float, 2, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e5m2_t, 2, 4> { };
+
+template <>
+struct NumericArrayConverter<cutlass::float_e2m1_t, float, 2, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e2m1_t, 2, 4> { };
+
+template <>
+struct NumericArrayConverter<cutlass::float_e2m1_t, float, 4, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e2m1_t, 4, 4> { };
+
+template <>
+struct NumericArrayConverter<cutlass::float_e2m1_t, float, 8, FloatRoundStyle::round_stochastic>
+  : detail::NumericArrayConverterStochastic<cutlass::float_e2m1_t, 8, 4> { };
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// FastNumericArrayConverter only works when the source is within center range.
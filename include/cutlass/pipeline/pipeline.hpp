@@ -33,6 +33,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "cutlass/pipeline/sm90_pipeline.hpp"
+#include "cutlass/pipeline/sm90_prefetch_pipeline.hpp"
 #include "cutlass/pipeline/sm100_pipeline.hpp" 
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
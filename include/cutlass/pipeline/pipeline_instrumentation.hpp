@@ -0,0 +1,220 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Optional instrumentation of pipeline waits.
+
+    When CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION is defined, the SM90 pipelines (and the SM100
+    pipelines built on them) accumulate, per warp index within the CTA, the cycles spent blocked in
+    producer_acquire and consumer_wait, and how often producer_try_acquire and consumer_try_wait
+    find their barrier not yet flipped. Counters are summed over all CTAs of a kernel into a device
+    buffer registered with pipeline_instrumentation_begin(), see also
+    cutlass/util/pipeline_instrumentation.hpp.
+
+    Long producer waits mean that stages are released late, i.e. the kernel is bound by its
+    consumers (MMA); long consumer waits mean that data arrives late, i.e. it is bound by loads.
+
+    The device buffer pointer has internal linkage: kernels are recorded only when launched from
+    the translation unit that registered the buffer. Without the macro, all hooks compile to nothing.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Counters of a warp index, summed over all CTAs of a kernel
+struct PipelineWaitCounters {
+  // Cycles spent blocked in producer_acquire, and the number of blocking waits
+  uint64_t producer_wait_cycles = 0;
+  uint64_t producer_waits = 0;
+  // producer_try_acquire calls that returned before the stage was released
+  uint64_t producer_try_acquire_failures = 0;
+  // Cycles spent blocked in consumer_wait, and the number of blocking waits
+  uint64_t consumer_wait_cycles = 0;
+  uint64_t consumer_waits = 0;
+  // consumer_try_wait calls that returned before the stage was filled
+  uint64_t consumer_try_wait_failures = 0;
+};
+
+// One set of counters per warp of a 1024-thread CTA
+static constexpr int PipelineInstrumentationMaxWarps = 32;
+
+namespace detail {
+
+#if defined(CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION)
+static __device__ PipelineWaitCounters* pipeline_wait_counters_ptr = nullptr;
+#endif
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct PipelineInstrumentationDisabled {
+  static constexpr bool Enabled = false;
+
+  CUTLASS_DEVICE static uint64_t begin_wait() { return 0; }
+  CUTLASS_DEVICE static void end_producer_wait(uint64_t) { }
+  CUTLASS_DEVICE static void end_consumer_wait(uint64_t) { }
+  CUTLASS_DEVICE static void producer_try_acquire(bool) { }
+  CUTLASS_DEVICE static void consumer_try_wait(bool) { }
+};
+
+#if defined(CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION)
+
+struct PipelineInstrumentationEnabled {
+  static constexpr bool Enabled = true;
+
+  // Only the first lane of each warp records, since all lanes of a warp wait together
+  CUTLASS_DEVICE static PipelineWaitCounters* warp_counters() {
+#if defined(__CUDA_ARCH__)
+    PipelineWaitCounters* counters = detail::pipeline_wait_counters_ptr;
+    int warp_idx = threadIdx.x / NumThreadsPerWarp;
+    if (counters == nullptr || threadIdx.x % NumThreadsPerWarp != 0 || warp_idx >= PipelineInstrumentationMaxWarps) {
+      return nullptr;
+    }
+    return counters + warp_idx;
+#else
+    return nullptr;
+#endif
+  }
+
+  CUTLASS_DEVICE static void add(uint64_t* counter, uint64_t value) {
+#if defined(__CUDA_ARCH__)
+    atomicAdd(reinterpret_cast<unsigned long long*>(counter), static_cast<unsigned long long>(value));
+#endif
+  }
+
+  CUTLASS_DEVICE static uint64_t begin_wait() {
+#if defined(__CUDA_ARCH__)
+    return static_cast<uint64_t>(clock64());
+#else
+    return 0;
+#endif
+  }
+
+  CUTLASS_DEVICE static void end_producer_wait(uint64_t start) {
+    if (auto counters = warp_counters()) {
+      add(&counters->producer_wait_cycles, begin_wait() - start);
+      add(&counters->producer_waits, 1);
+    }
+  }
+
+  CUTLASS_DEVICE static void end_consumer_wait(uint64_t start) {
+    if (auto counters = warp_counters()) {
+      add(&counters->consumer_wait_cycles, begin_wait() - start);
+      add(&counters->consumer_waits, 1);
+    }
+  }
+
+  CUTLASS_DEVICE static void producer_try_acquire(bool barrier_status) {
+    if (auto counters = warp_counters(); counters != nullptr && not barrier_status) {
+      add(&counters->producer_try_acquire_failures, 1);
+    }
+  }
+
+  CUTLASS_DEVICE static void consumer_try_wait(bool barrier_status) {
+    if (auto counters = warp_counters(); counters != nullptr && not barrier_status) {
+      add(&counters->consumer_try_wait_failures, 1);
+    }
+  }
+};
+
+using PipelineInstrumentation = PipelineInstrumentationEnabled;
+
+#else
+
+using PipelineInstrumentation = PipelineInstrumentationDisabled;
+
+#endif // defined(CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Host APIs
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if !defined(__CUDACC_RTC__)
+
+/// Zeroes counters (PipelineInstrumentationMaxWarps entries in device memory) and records
+/// subsequent kernels launched from this translation unit into them.
+static inline cudaError_t
+pipeline_instrumentation_begin(PipelineWaitCounters* counters, cudaStream_t stream = nullptr) {
+#if defined(CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION)
+  cudaError_t result = cudaMemsetAsync(
+      counters, 0, sizeof(PipelineWaitCounters) * PipelineInstrumentationMaxWarps, stream);
+  if (result != cudaSuccess) {
+    return result;
+  }
+  return cudaMemcpyToSymbolAsync(
+      detail::pipeline_wait_counters_ptr, &counters, sizeof(counters), 0, cudaMemcpyHostToDevice, stream);
+#else
+  return cudaSuccess;
+#endif
+}
+
+/// Stops recording, and copies the counters of kernels launched since pipeline_instrumentation_begin()
+/// to host_counters (PipelineInstrumentationMaxWarps entries). Synchronizes the stream.
+static inline cudaError_t
+pipeline_instrumentation_end(
+    PipelineWaitCounters* host_counters,
+    PipelineWaitCounters const* counters,
+    cudaStream_t stream = nullptr) {
+#if defined(CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION)
+  PipelineWaitCounters* null_counters = nullptr;
+  cudaError_t result = cudaMemcpyToSymbolAsync(
+      detail::pipeline_wait_counters_ptr, &null_counters, sizeof(null_counters), 0, cudaMemcpyHostToDevice, stream);
+  if (result != cudaSuccess) {
+    return result;
+  }
+  result = cudaMemcpyAsync(host_counters, counters,
+      sizeof(PipelineWaitCounters) * PipelineInstrumentationMaxWarps, cudaMemcpyDeviceToHost, stream);
+  if (result != cudaSuccess) {
+    return result;
+  }
+  return cudaStreamSynchronize(stream);
+#else
+  for (int i = 0; i < PipelineInstrumentationMaxWarps; ++i) {
+    host_counters[i] = {};
+  }
+  return cudaSuccess;
+#endif
+}
+
+#endif // !defined(__CUDACC_RTC__)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -42,6 +42,7 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/arch/barrier.h"
 #include "cutlass/detail/dependent_false.hpp"
+#include "cutlass/pipeline/pipeline_instrumentation.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -53,6 +54,23 @@ using namespace cute;
 
 namespace detail {
 
+// Blocking barrier waits, timed when CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION is defined
+template <class Barrier>
+CUTLASS_DEVICE
+void pipeline_producer_wait(Barrier& barrier, uint32_t phase) {
+  uint64_t wait_start = PipelineInstrumentation::begin_wait();
+  barrier.wait(phase);
+  PipelineInstrumentation::end_producer_wait(wait_start);
+}
+
+template <class Barrier>
+CUTLASS_DEVICE
+void pipeline_consumer_wait(Barrier& barrier, uint32_t phase) {
+  uint64_t wait_start = PipelineInstrumentation::begin_wait();
+  barrier.wait(phase);
+  PipelineInstrumentation::end_consumer_wait(wait_start);
+}
+
 // Helper function for DEBUG checks
 template<class ThreadCategory>
 CUTLASS_DEVICE
@@ -167,10 +185,12 @@ class ConsumerToken : public ArrivalToken {
 
 // Circular Buffer Index + Associated Phase
 // Assumes only one operation possible - i.e., ++
-template<uint32_t Stages_>
+// With DynamicStages_, the buffer wraps after a runtime number of active stages, see below.
+template<uint32_t Stages_, bool DynamicStages_ = false>
 struct PipelineState {
 
   static constexpr uint32_t Stages = Stages_;
+  static constexpr bool DynamicStages = false;
 
   int index_ = 0;
   uint32_t phase_ = 0;
@@ -249,6 +269,86 @@ struct PipelineState {
   }
 };
 
+// Circular Buffer Index + Associated Phase over the first stages() of Stages_ buffers.
+// Pipelines and shared memory are sized for Stages_, but only the active stages are cycled through,
+// so one kernel instantiation can run with the pipeline depth selected at launch.
+// Converts to the static PipelineState taken by the pipeline classes, which only use index and phase.
+template<uint32_t Stages_>
+struct PipelineState<Stages_, true> {
+
+  static constexpr uint32_t Stages = Stages_;
+  static constexpr bool DynamicStages = true;
+
+  int index_ = 0;
+  uint32_t phase_ = 0;
+  uint32_t count_ = 0;
+  uint32_t stages_ = Stages;
+
+  CUTLASS_DEVICE
+  PipelineState(): index_{}, phase_{}, count_{}, stages_{Stages} {}
+
+  CUTLASS_DEVICE
+  PipelineState(int index, uint32_t phase, uint32_t count, uint32_t stages)
+    : index_(index)
+    , phase_(phase)
+    , count_(count)
+    , stages_(stages) {}
+
+  CUTLASS_DEVICE
+  int index() const {
+    return index_;
+  }
+
+  CUTLASS_DEVICE
+  uint32_t phase() const {
+    return phase_;
+  }
+
+  CUTLASS_DEVICE
+  uint32_t count() const {
+    return count_;
+  }
+
+  CUTLASS_DEVICE
+  uint32_t stages() const {
+    return stages_;
+  }
+
+  CUTLASS_DEVICE
+  operator PipelineState<Stages>() const {
+    return {index_, phase_, count_};
+  }
+
+  CUTLASS_DEVICE
+  void operator++() {
+    ++index_;
+    ++count_;
+    if (index_ == static_cast<int>(stages_)) {
+      index_ = 0;
+      phase_ ^= 1;
+    }
+  }
+
+  CUTLASS_DEVICE
+  PipelineState& operator+=(uint32_t num_iterations) {
+    return advance(num_iterations);
+  }
+
+  CUTLASS_DEVICE
+  PipelineState& advance(uint32_t num_iterations) {
+    // Odd number of crossings of the stage boundary => flipped phase
+    phase_ ^= ((index_ + num_iterations) / stages_) & 1;
+    index_ = (index_ + num_iterations) % stages_;
+    count_ += num_iterations;
+    return *this;
+  }
+
+  CUTLASS_DEVICE
+  static PipelineState make_pipeline_state(PipelineState start_state, uint32_t num_iterations) {
+    return start_state.advance(num_iterations);
+  }
+};
+
 template<class Pipeline>
 CUTLASS_DEVICE
 PipelineState<Pipeline::Stages> make_producer_start_state() {
@@ -259,6 +359,22 @@ PipelineState<Pipeline::Stages> make_producer_start_state() {
   return {InitialProducerStage, InitialProducerPhase, InitialProducerCount};
 }
 
+// Start states of pipelines cycling through active_stages of their Pipeline::Stages buffers
+template<class Pipeline>
+CUTLASS_DEVICE
+PipelineState<Pipeline::Stages, true> make_producer_start_state(uint32_t active_stages) {
+  constexpr int InitialProducerStage = 0;
+  constexpr uint32_t InitialProducerPhase = 1;
+  constexpr uint32_t InitialProducerCount = 0;
+  return {InitialProducerStage, InitialProducerPhase, InitialProducerCount, active_stages};
+}
+
+template<class Pipeline>
+CUTLASS_DEVICE
+PipelineState<Pipeline::Stages, true> make_consumer_start_state(uint32_t active_stages) {
+  return {0, 0, 0, active_stages};
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // TMA load (producer) Async Pipeline class
@@ -390,9 +506,12 @@ public:
   template <class ClusterShape>
   CUTLASS_DEVICE
   bool is_same_row_or_col(int dst_block_id, dim3 block_id, ClusterShape cluster_shape) {
-    return (((dst_block_id % cute::size<0>(cluster_shape)) == block_id.x) ||
+    // Blocks along the third cluster mode load independent data, so they never share a stage
+    int cluster_size_mn = cute::size<0>(cluster_shape) * cute::size<1>(cluster_shape);
+    return ((dst_block_id / cluster_size_mn) == block_id.z) &&
+           (((dst_block_id % cute::size<0>(cluster_shape)) == block_id.x) ||
             (
-              ((dst_block_id / cute::size<0>(cluster_shape)) == block_id.y)
+              (((dst_block_id / cute::size<0>(cluster_shape)) % cute::size<1>(cluster_shape)) == block_id.y)
             ));
   }
 
@@ -453,6 +572,16 @@ public:
     }
   }
 
+  // Only the active stages were ever filled, the remaining buffers need no drain
+  CUTLASS_DEVICE
+  void producer_tail(cutlass::PipelineState<Stages, true> state) {
+    detail::pipeline_check_is_producer(params_.role);
+    for (uint32_t count = 0; count < state.stages(); ++count) {
+      empty_barrier_ptr_[state.index()].wait(state.phase());
+      ++state;
+    }
+  }
+
   CUTLASS_DEVICE
   ProducerBarrierType* producer_get_barrier(PipelineState state) {
     return producer_get_barrier(state.index());
@@ -505,12 +634,13 @@ private:
       return {BarrierStatus::WaitDone};
     }
     bool barrier_status = empty_barrier_ptr_[stage].try_wait(phase);
+    PipelineInstrumentation::producer_try_acquire(barrier_status);
     return {static_cast<BarrierStatus>(barrier_status)};
   }
 
   CUTLASS_DEVICE
   void producer_acquire(uint32_t stage, uint32_t phase) {
-    empty_barrier_ptr_[stage].wait(phase);
+    detail::pipeline_producer_wait(empty_barrier_ptr_[stage], phase);
 
     if (params_.is_leader) {
       full_barrier_ptr_[stage].arrive_and_expect_tx(params_.transaction_bytes);
@@ -531,7 +661,7 @@ private:
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
     if (barrier_token != BarrierStatus::WaitDone) {
-      empty_barrier_ptr_[stage].wait(phase);
+      detail::pipeline_producer_wait(empty_barrier_ptr_[stage], phase);
     }
 
     if (params_.is_leader) {
@@ -573,13 +703,13 @@ private:
 
         CUTLASS_PRAGMA_UNROLL
         for(int n = 0; n < size<1>(block_layout_in_cluster); ++n) {
-          uint32_t dst_block_id = block_layout_in_cluster(local_block_id.x,n,Int<0>{});
+          uint32_t dst_block_id = block_layout_in_cluster(local_block_id.x,n,local_block_id.z);
           full_barrier_ptr_[stage].complete_transaction(dst_block_id, bytes, n!=local_block_id.y);
         }
 
         CUTLASS_PRAGMA_UNROLL
         for(int m = 0; m < size<0>(block_layout_in_cluster); ++m) {
-          uint32_t dst_block_id = block_layout_in_cluster(m,local_block_id.y,Int<0>{});
+          uint32_t dst_block_id = block_layout_in_cluster(m,local_block_id.y,local_block_id.z);
           full_barrier_ptr_[stage].complete_transaction(dst_block_id, bytes, m!=local_block_id.x);
         }
       }
@@ -593,6 +723,7 @@ private:
       return {BarrierStatus::WaitDone};
     }
     bool barrier_status = full_barrier_ptr_[stage].try_wait(phase);
+    PipelineInstrumentation::consumer_try_wait(barrier_status);
     return {static_cast<BarrierStatus>(barrier_status)};
   }
 
@@ -610,7 +741,7 @@ private:
   CUTLASS_DEVICE
   void consumer_wait(uint32_t stage, uint32_t phase) {
     detail::pipeline_check_is_consumer(params_.role);
-    full_barrier_ptr_[stage].wait(phase);
+    detail::pipeline_consumer_wait(full_barrier_ptr_[stage], phase);
   }
 
   // Wait for producer to commit transactions (done by TMA)
@@ -618,7 +749,7 @@ private:
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
-      full_barrier_ptr_[stage].wait(phase);
+      detail::pipeline_consumer_wait(full_barrier_ptr_[stage], phase);
     }
   }
 
@@ -927,6 +1058,7 @@ private:
       return {BarrierStatus::WaitDone};
     }
     bool barrier_status = empty_barrier_ptr_[stage].try_wait(phase);
+    PipelineInstrumentation::producer_try_acquire(barrier_status);
     return {static_cast<BarrierStatus>(barrier_status)};
   }
 
@@ -934,7 +1066,7 @@ private:
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
-      empty_barrier_ptr_[stage].wait(phase);
+      detail::pipeline_producer_wait(empty_barrier_ptr_[stage], phase);
     }
   }
 
@@ -963,6 +1095,7 @@ private:
       return {BarrierStatus::WaitDone};
     }
     bool barrier_status = full_barrier_ptr_[stage].try_wait(phase);
+    PipelineInstrumentation::consumer_try_wait(barrier_status);
     return {static_cast<BarrierStatus>(barrier_status)};
   }
 
@@ -980,7 +1113,7 @@ private:
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
-      full_barrier_ptr_[stage].wait(phase);
+      detail::pipeline_consumer_wait(full_barrier_ptr_[stage], phase);
     }
   }
 
@@ -1178,6 +1311,7 @@ private:
       return {BarrierStatus::WaitDone};
     }
     bool barrier_status = empty_barrier_ptr_[stage].try_wait(phase);
+    PipelineInstrumentation::producer_try_acquire(barrier_status);
     return {static_cast<BarrierStatus>(barrier_status)};
   }
 
@@ -1185,7 +1319,7 @@ private:
   void producer_acquire(uint32_t stage, uint32_t phase, ProducerToken barrier_token) {
     detail::pipeline_check_is_producer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
-      empty_barrier_ptr_[stage].wait(phase);
+      detail::pipeline_producer_wait(empty_barrier_ptr_[stage], phase);
     }
   }
 
@@ -1202,6 +1336,7 @@ private:
       return {BarrierStatus::WaitDone};
     }
     bool barrier_status = full_barrier_ptr_[stage].try_wait(phase);
+    PipelineInstrumentation::consumer_try_wait(barrier_status);
     return {static_cast<BarrierStatus>(barrier_status)};
   }
 
@@ -1220,7 +1355,7 @@ private:
     detail::pipeline_check_is_consumer(params_.role);
     bool done = full_barrier_ptr_[stage].test_wait(phase);
     if (!done) {
-      full_barrier_ptr_[stage].wait(phase);
+      detail::pipeline_consumer_wait(full_barrier_ptr_[stage], phase);
     }
   }
 
@@ -1228,7 +1363,7 @@ private:
   void consumer_wait(uint32_t stage, uint32_t phase, ConsumerToken barrier_token) {
     detail::pipeline_check_is_consumer(params_.role);
     if (barrier_token == BarrierStatus::WaitAgain) {
-      full_barrier_ptr_[stage].wait(phase);
+      detail::pipeline_consumer_wait(full_barrier_ptr_[stage], phase);
     }
   }
 
@@ -1268,10 +1403,16 @@ public:
     PipelineDetail::OrderedSequenceBarrierSharedStorage<SequenceDepth, SequenceLength>;
   using Barrier = typename SharedStorage::Barrier;
 
+  // Groups take turns starting with first_group_id, each handing the turn to its next_group_id.
+  // By default groups take turns in the order of their ids, 0, 1, ..., SequenceLength - 1.
   struct Params {
     uint32_t group_id;
     uint32_t group_size;
     int initializing_warp = 0; 
+    // Group taking the first turn
+    uint32_t first_group_id = 0;
+    // Group taking the turn after this one; negative selects (group_id + 1) % SequenceLength
+    int next_group_id = -1;
   };
 
 private:
@@ -1295,8 +1436,11 @@ public:
   OrderedSequenceBarrier(SharedStorage& storage, Params const& params) :
       params_(params),
       barrier_ptr_(&storage.barrier_[0][0]),
-      // Group 0 - starts with an opposite phase
-      stage_({0, params.group_id == 0, 0}) {
+      // First group - starts with an opposite phase
+      stage_({0, params.group_id == params.first_group_id, 0}) {
+    if (params_.next_group_id < 0) {
+      params_.next_group_id = (params_.group_id + 1) % Length;
+    }
 
 #if (__CUDA_ARCH__ >= 1000)
     int warp_idx = canonical_warp_idx_sync();
@@ -1335,10 +1479,10 @@ public:
   }
 
   // Signal completion of Stage and move to the next stage
-  // (group_id) signals to (group_id+1)
+  // (group_id) signals to (next_group_id)
   CUTLASS_DEVICE
   void arrive() {
-    int signalling_id = (params_.group_id + 1) % Length;
+    int signalling_id = params_.next_group_id;
     get_barrier_for_current_stage(signalling_id).arrive();
     ++stage_;
   }
@@ -35,6 +35,7 @@
 #include "cute/arch/cluster_sm90.hpp"
 #include "cutlass/arch/barrier.h"
 #include "cute/container/array.hpp"
+#include "cutlass/pipeline/sm90_pipeline.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -54,8 +55,6 @@ struct PrefetcherPipelineSharedStorage {
 
 } // end namespace detail
 
-using namespace cute;
-
 // Prefetcher pipeline is modeled after PipelineTmaAsync, with a cluster transaction
 // barrier providing control over the number of concurrent outstanding TMA loads.
 // There is also an additional cluster barrier which is only used when `prefetch_ratio` is unset.
@@ -329,6 +329,30 @@ public:
     m.set_slice_3x3(as_rotation_matrix_3x3());
     return m;
   }
+
+  /// Computes the real 4x4 matrix L such that (*this) * p == L * p for any quaternion p,
+  /// with quaternions treated as column vectors in storage order (x, y, z, w)
+  CUTLASS_HOST_DEVICE
+  Matrix4x4<Element> as_left_product_matrix_4x4() const {
+    return Matrix4x4<Element>(
+       w(), -z(),  y(),  x(),
+       z(),  w(), -x(),  y(),
+      -y(),  x(),  w(),  z(),
+      -x(), -y(), -z(),  w()
+    );
+  }
+
+  /// Computes the real 4x4 matrix R such that p * (*this) == R * p for any quaternion p,
+  /// with quaternions treated as column vectors in storage order (x, y, z, w)
+  CUTLASS_HOST_DEVICE
+  Matrix4x4<Element> as_right_product_matrix_4x4() const {
+    return Matrix4x4<Element>(
+       w(),  z(), -y(),  x(),
+      -z(),  w(),  x(),  y(),
+       y(), -x(),  w(),  z(),
+      -x(), -y(), -z(),  w()
+    );
+  }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
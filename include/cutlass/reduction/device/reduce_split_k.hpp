@@ -0,0 +1,144 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device-wide parallel split-K reduction fused with an epilogue fusion operation, see
+    cutlass/reduction/kernel/reduce_split_k.hpp.
+
+    Typical use, with the partial GEMM running the K splits as its batch mode:
+
+      partial_gemm.run(stream, nullptr, launch_with_pdl);
+      reduction.run(stream, true);   // with PDL, overlaps its launch with the partial GEMM
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/kernel_launch.h"
+#include "cutlass/trace.h"
+
+#include "cutlass/reduction/kernel/reduce_split_k.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::reduction::device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <class ReductionKernel_>
+class ReduceSplitKFusion {
+public:
+
+  using ReductionKernel = ReductionKernel_;
+  using Arguments = typename ReductionKernel::Arguments;
+  using Params = typename ReductionKernel::Params;
+
+private:
+
+  Params params_;
+
+public:
+
+  /// Determines whether the reduction can execute the given problem
+  static Status
+  can_implement(Arguments const& args) {
+    return ReductionKernel::can_implement(args) ? Status::kSuccess : Status::kInvalid;
+  }
+
+  /// Gets the workspace size
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return ReductionKernel::get_workspace_size(args);
+  }
+
+  /// Initializes the reduction state from arguments
+  Status
+  initialize(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr) {
+    CUTLASS_TRACE_HOST("ReduceSplitKFusion::initialize()");
+
+    if (!ReductionKernel::can_implement(args)) {
+      return Status::kInvalid;
+    }
+    Status status = ReductionKernel::initialize_workspace(args, workspace, stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    params_ = ReductionKernel::to_underlying_arguments(args, workspace);
+    return Status::kSuccess;
+  }
+
+  /// Returns the parameters of the kernel
+  Params const&
+  params() const {
+    return params_;
+  }
+
+  /// Primary run() entry point API that is static allowing users to create and manage their own params.
+  /// With launch_with_pdl, the kernel may start while the preceding kernel of the stream is running.
+  static Status
+  run(Params const& params, cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    CUTLASS_TRACE_HOST("ReduceSplitKFusion::run()");
+
+    dim3 const grid = ReductionKernel::get_grid_shape(params);
+    dim3 const block = ReductionKernel::get_block_shape();
+    int smem_size = ReductionKernel::SharedStorageSize;
+
+    return cutlass::kernel_launch<ReductionKernel>(grid, block, smem_size, stream, params, launch_with_pdl);
+  }
+
+  /// Launches the kernel with the parameters of the last initialize() call
+  Status
+  run(cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(params_, stream, launch_with_pdl);
+  }
+
+  /// Overload that allows a user to re-use the same reduction with different arguments
+  Status
+  operator()(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+             bool launch_with_pdl = false) {
+    Status status = initialize(args, workspace, stream);
+    if (status == Status::kSuccess) {
+      status = run(params_, stream, launch_with_pdl);
+    }
+    return status;
+  }
+
+  Status
+  operator()(cudaStream_t stream = nullptr, bool launch_with_pdl = false) {
+    return run(params_, stream, launch_with_pdl);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::reduction::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
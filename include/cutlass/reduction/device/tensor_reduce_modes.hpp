@@ -0,0 +1,255 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device-wide reduction of an arbitrary subset of the modes of a cute::Tensor, see
+    cutlass/reduction/kernel/tensor_reduce_modes.hpp.
+
+    The element-wise pre-map and post-map fuse, e.g., amax (MapAbsolute + maximum), L2 norms
+    (MapSquare + plus + MapSqrt) and RMS norms (MapSquare + plus + MapCompose<MapScale, MapSqrt>)
+    into a single launch.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <utility>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/device_kernel.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/kernel_launch.h"
+#include "cutlass/cluster_launch.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+
+#include "cutlass/reduction/thread/reduction_operators.h"
+#include "cutlass/reduction/kernel/tensor_reduce_modes.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::reduction::device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Number of modes of a mode of a layout once flattened
+template <class Shape>
+constexpr int FlatRank = cute::rank_v<decltype(cute::flatten_to_tuple(std::declval<Shape>()))>;
+
+/// Stable sort of the modes by ascending stride magnitude, moving modes of extent 1 last. The
+/// strides of 'other' are permuted alongside.
+inline void sort_modes(int* extents, int64_t* strides, int64_t* other, int count) {
+  auto key = [](int extent, int64_t stride) {
+    return extent == 1 ? INT64_MAX : (stride < 0 ? -stride : stride);
+  };
+  for (int i = 1; i < count; ++i) {
+    for (int j = i; j > 0 && key(extents[j], strides[j]) < key(extents[j - 1], strides[j - 1]); --j) {
+      std::swap(extents[j], extents[j - 1]);
+      std::swap(strides[j], strides[j - 1]);
+      if (other) {
+        std::swap(other[j], other[j - 1]);
+      }
+    }
+  }
+}
+
+template <class Layout, size_t... I>
+Layout make_mode_layout(int const* extents, int64_t const* strides, std::index_sequence<I...>) {
+  return Layout(cute::make_tuple(extents[I]...), cute::make_tuple(strides[I]...));
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reduces an arbitrary subset of the modes of a rank-N source tensor in one launch
+template <
+  typename ElementOutput_,
+  typename ElementSource_,
+  typename ElementCompute_,
+  typename ReductionOp_,                                      ///< Associative and commutative
+  typename PreMap_ = thread::MapIdentity<ElementCompute_>,    ///< Applied to every source element
+  typename PostMap_ = thread::MapIdentity<ElementCompute_>,   ///< Applied to every reduced value
+  int ClusterSize = 1,                                        ///< CTAs splitting each reduction (SM90)
+  int Threads = 256
+>
+struct TensorReduceModes {
+
+  using ElementOutput = ElementOutput_;
+  using ElementSource = ElementSource_;
+  using ElementCompute = ElementCompute_;
+  using ReductionOp = ReductionOp_;
+  using PreMap = PreMap_;
+  using PostMap = PostMap_;
+
+  /// Kernel reducing ReducedRank flattened modes into KeptRank flattened modes
+  template <int KeptRank, int ReducedRank>
+  using ReductionKernel = kernel::TensorReduceModes<
+    ElementOutput, ElementSource, ElementCompute, ReductionOp, PreMap, PostMap,
+    cute::max(KeptRank, 1), cute::max(ReducedRank, 1), ClusterSize, Threads>;
+
+  /// Reduces the modes ReducedModes... of src. The kept modes of src, in order, form the shape of
+  /// dst, e.g. reducing modes 1 and 3 of an (N,H,W,C) tensor yields an (N,W) tensor. The modes
+  /// may be hierarchical; dst must match the flattened kept modes. If every mode is reduced, dst
+  /// holds a single element.
+  template <class DstEngine, class DstLayout, class SrcEngine, class SrcLayout, int... ReducedModes>
+  static Status reduce(
+    cute::Tensor<DstEngine, DstLayout> const& dst,              ///< Destination tensor in device memory
+    cute::Tensor<SrcEngine, SrcLayout> const& src,              ///< Source tensor in device memory
+    cute::seq<ReducedModes...> reduced_modes,                   ///< Modes of src to reduce
+    ElementCompute reduction_identity = ElementCompute(),      ///< Reduction identity element
+    ReductionOp reduction_op = ReductionOp(),                   ///< Reduction operator
+    PreMap pre_map = PreMap(),                                  ///< Map applied before the reduction
+    PostMap post_map = PostMap(),                               ///< Map applied after the reduction
+    cudaStream_t stream = nullptr,                              ///< CUDA stream for the launch
+    KernelHardwareInfo const& hw_info = KernelHardwareInfo{}) {
+
+    using SrcShape = cute::remove_cvref_t<decltype(std::declval<SrcLayout>().shape())>;
+    constexpr int Rank = cute::rank_v<SrcLayout>;
+    static_assert(((ReducedModes >= 0 && ReducedModes < Rank) && ...), "Reduced modes must be modes of the source.");
+
+    constexpr int SrcFlatRank = detail::FlatRank<SrcShape>;
+    constexpr int ReducedFlatRank = (0 + ... +
+      detail::FlatRank<cute::remove_cvref_t<decltype(cute::get<ReducedModes>(cute::wrap(std::declval<SrcShape>())))>>);
+    constexpr int KeptFlatRank = SrcFlatRank - ReducedFlatRank;
+    constexpr int DstFlatRank = detail::FlatRank<cute::remove_cvref_t<decltype(std::declval<DstLayout>().shape())>>;
+    static_assert(DstFlatRank == KeptFlatRank || KeptFlatRank == 0,
+      "The destination must have the flattened shape of the kept modes of the source.");
+
+    using Kernel = ReductionKernel<KeptFlatRank, ReducedFlatRank>;
+    constexpr int KeptCapacity = Kernel::KeptRank;
+    constexpr int ReducedCapacity = Kernel::ReducedRank;
+
+    // Partition the flattened modes of the source, empty sets are padded with a mode of extent 1
+    int kept_extents[KeptCapacity] = {1};
+    int64_t kept_strides[KeptCapacity] = {0};
+    int64_t dst_strides[KeptCapacity] = {0};
+    int reduced_extents[ReducedCapacity] = {1};
+    int64_t reduced_strides[ReducedCapacity] = {0};
+
+    int kept_count = 0;
+    int reduced_count = 0;
+    cute::for_each(cute::make_seq<Rank>{}, [&](auto m) {
+      constexpr bool IsReduced = ((decltype(m)::value == ReducedModes) || ...);
+      auto mode_shape = cute::flatten_to_tuple(cute::get<m>(cute::wrap(src.layout().shape())));
+      auto mode_stride = cute::flatten_to_tuple(cute::get<m>(cute::wrap(src.layout().stride())));
+      cute::for_each(cute::make_seq<cute::rank_v<decltype(mode_shape)>>{}, [&](auto i) {
+        if constexpr (IsReduced) {
+          reduced_extents[reduced_count] = int(cute::get<i>(mode_shape));
+          reduced_strides[reduced_count] = int64_t(cute::get<i>(mode_stride));
+          ++reduced_count;
+        }
+        else {
+          kept_extents[kept_count] = int(cute::get<i>(mode_shape));
+          kept_strides[kept_count] = int64_t(cute::get<i>(mode_stride));
+          ++kept_count;
+        }
+      });
+    });
+
+    if constexpr (KeptFlatRank > 0) {
+      auto flat_dst_shape = cute::flatten_to_tuple(dst.layout().shape());
+      auto flat_dst_stride = cute::flatten_to_tuple(dst.layout().stride());
+      bool matches = true;
+      cute::for_each(cute::make_seq<KeptFlatRank>{}, [&](auto i) {
+        matches &= int(cute::get<i>(flat_dst_shape)) == kept_extents[i];
+        dst_strides[i] = int64_t(cute::get<i>(flat_dst_stride));
+      });
+      if (!matches) {
+        CUTLASS_TRACE_HOST("TensorReduceModes::reduce(): destination shape does not match the kept modes");
+        return Status::kErrorInvalidProblem;
+      }
+    }
+    else if (cute::size(dst) != 1) {
+      CUTLASS_TRACE_HOST("TensorReduceModes::reduce(): a full reduction requires a destination of size 1");
+      return Status::kErrorInvalidProblem;
+    }
+
+    // Walking the kept and reduced modes in order of increasing stride coalesces the accesses, and
+    // a unit stride reduced mode selects the contiguous strategy of the kernel
+    detail::sort_modes(kept_extents, kept_strides, dst_strides, KeptCapacity);
+    detail::sort_modes(reduced_extents, reduced_strides, nullptr, ReducedCapacity);
+
+    typename Kernel::Arguments args;
+    args.ptr_dst = cute::raw_pointer_cast(dst.data());
+    args.layout_dst = detail::make_mode_layout<typename Kernel::LayoutKept>(
+      kept_extents, dst_strides, std::make_index_sequence<KeptCapacity>{});
+    args.ptr_src = cute::raw_pointer_cast(src.data());
+    args.layout_kept = detail::make_mode_layout<typename Kernel::LayoutKept>(
+      kept_extents, kept_strides, std::make_index_sequence<KeptCapacity>{});
+    args.layout_reduced = detail::make_mode_layout<typename Kernel::LayoutReduced>(
+      reduced_extents, reduced_strides, std::make_index_sequence<ReducedCapacity>{});
+    args.reduction_identity = reduction_identity;
+    args.reduction_op = reduction_op;
+    args.pre_map = pre_map;
+    args.post_map = post_map;
+    args.hw_info = hw_info;
+
+    if (!Kernel::can_implement(args)) {
+      return Status::kInvalid;
+    }
+
+    typename Kernel::Params params = Kernel::to_underlying_arguments(args, nullptr);
+
+    dim3 const grid = Kernel::get_grid_shape(params);
+    dim3 const block = Kernel::get_block_shape();
+    int smem_size = Kernel::SharedStorageSize;
+
+    Status launch_result;
+    cutlass::arch::synclog_setup();
+    if constexpr (ClusterSize == 1) {
+      launch_result = cutlass::kernel_launch<Kernel>(grid, block, smem_size, stream, params, false);
+    }
+    else {
+      dim3 const cluster(ClusterSize, 1, 1);
+      void* kernel_params[] = {&params};
+      void const* kernel = (void const*) device_kernel<Kernel>;
+      launch_result = ClusterLauncher::launch(grid, cluster, block, smem_size, stream, kernel, kernel_params);
+    }
+
+    cudaError_t result = cudaGetLastError();
+    if (cudaSuccess == result && Status::kSuccess == launch_result) {
+      return Status::kSuccess;
+    }
+    else {
+      CUTLASS_TRACE_HOST("  Kernel launch failed. Reason: " << result);
+      return Status::kErrorInternal;
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::reduction::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
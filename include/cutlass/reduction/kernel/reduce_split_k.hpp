@@ -0,0 +1,546 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Parallel split-K reduction of the partial slices of a 3.x GEMM, fused with the epilogue
+    operations of cutlass/epilogue/fusion/operations.hpp.
+
+    The partial GEMM runs the K splits as the batch mode L of a GEMM with ElementD =
+    ElementAccumulator and the identity epilogue, so slice s of the workspace holds
+    A(:, K_s) * B(K_s, :). This kernel sums the slices in ElementCompute and applies the fusion
+    operation to the result, with the semantics of the corresponding sm90 fusion callbacks:
+
+      Z = alpha * acc + beta * C + bias       (alpha and beta scaled by scale_a * scale_b and scale_c)
+      D = activation(Z)                       (scale_d applied and amax_D computed if D is fp8)
+      Aux = Z                                 (scale_aux applied and amax_aux computed if Aux is fp8)
+
+    Every thread owns 128b of contiguous outputs and issues SlicesInFlight 128b loads of the
+    partial slices before accumulating them. The kernel waits on the partial GEMM with
+    griddepcontrol.wait before touching global memory, so it may be launched with programmatic
+    dependent launch (PDL) right behind it and overlap its launch and prologue with that GEMM.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/arch/arch.h"
+#include "cutlass/arch/grid_dependency_control.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::reduction::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+struct EmptyActivationArguments { };
+
+template <class Fn, class = void>
+struct FusionActivationArguments {
+  using type = EmptyActivationArguments;
+};
+
+// Activations with hyperparameters, e.g. Clamp or LeakyReLU
+template <class Fn>
+struct FusionActivationArguments<Fn, platform::void_t<typename Fn::Arguments>> {
+  using type = typename Fn::Arguments;
+};
+
+template <class T, class Default>
+using non_void_t = cute::conditional_t<cute::is_void_v<T>, Default, T>;
+
+template <class T>
+constexpr bool is_fp8_v = cute::is_same_v<T, float_e4m3_t> || cute::is_same_v<T, float_e5m2_t>;
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <
+  class FusionOp_,                     // cutlass::epilogue::fusion operation
+  class ElementAccumulator_,           // Element of the partial slices
+  class GmemLayoutTag_,                // Layout of the partial slices, C and D
+  int Threads_ = 256,
+  int SlicesInFlight_ = 4,             // Partial slices loaded before the first one is accumulated
+  class ArchTag_ = arch::Sm90          // The kernel runs on any architecture, PDL launches need SM90
+>
+class ReduceSplitKFusion {
+public:
+  //
+  // Type Aliases
+  //
+  using FusionOp = FusionOp_;
+  using ElementAccumulator = ElementAccumulator_;
+  using GmemLayoutTag = GmemLayoutTag_;
+  using ArchTag = ArchTag_;
+
+  using ElementD = typename FusionOp::ElementOutput;
+  using ElementCompute = typename FusionOp::ElementCompute;
+  using ElementC = cute::conditional_t<FusionOp::IsSourceSupported, typename FusionOp::ElementSource, ElementD>;
+  using ElementScalar = detail::non_void_t<typename FusionOp::ElementScalar, ElementCompute>;
+  using ElementBias = detail::non_void_t<typename FusionOp::ElementBias, ElementCompute>;
+  using ElementAux = detail::non_void_t<typename FusionOp::ElementAux, ElementD>;
+  using ElementAmax = detail::non_void_t<typename FusionOp::ElementAmax, ElementCompute>;
+  using GmemLayoutTagAux = detail::non_void_t<typename FusionOp::GmemLayoutTagAux, GmemLayoutTag>;
+  using ActivationFn = cute::conditional_t<FusionOp::IsEltActSupported,
+    typename FusionOp::ActivationFn, epilogue::thread::Identity<ElementCompute>>;
+  using ActivationArguments = typename detail::FusionActivationArguments<ActivationFn>::type;
+  static constexpr FloatRoundStyle RoundStyle = FusionOp::RoundStyle;
+
+  // Strides of the (M,N,L) modes, the partial slices are the L mode of the workspace
+  using StrideAccumulator = cutlass::gemm::TagToStrideC_t<GmemLayoutTag>;
+  using StrideC = cutlass::gemm::TagToStrideC_t<GmemLayoutTag>;
+  using StrideD = cutlass::gemm::TagToStrideC_t<GmemLayoutTag>;
+  using StrideAux = cutlass::gemm::TagToStrideC_t<GmemLayoutTagAux>;
+  using ProblemShape = cute::Shape<int, int, int>;   // (M, N, splits)
+
+  static constexpr int Threads = Threads_;
+  static constexpr int SlicesInFlight = SlicesInFlight_;
+  static constexpr bool IsRowMajor = cute::is_same_v<GmemLayoutTag, layout::RowMajor>;
+  // Contiguous outputs per thread, one 128b load of every partial slice
+  static constexpr int VectorLength = 128 / sizeof_bits<ElementAccumulator>::value;
+
+  static constexpr bool IsPerRowScale = FusionOp::IsPerRowScaleSupported;
+  static constexpr bool IsPerColScale = FusionOp::IsPerColScaleSupported;
+  static constexpr bool IsScaleFactor = FusionOp::IsScaleFactorSupported;
+  static constexpr bool IsAux = FusionOp::IsAuxOutSupported;
+  // Scaled operations only quantize fp8 outputs; otherwise amax_D is the high precision amax of D
+  static constexpr bool IsScaleD = IsScaleFactor && detail::is_fp8_v<ElementD>;
+  static constexpr bool IsAmaxD = FusionOp::IsAbsMaxSupported && (!IsScaleFactor || detail::is_fp8_v<ElementD>);
+  static constexpr bool IsScaleAux = IsAux && IsScaleFactor && detail::is_fp8_v<ElementAux>;
+  static constexpr bool IsAmaxAux = IsAux && FusionOp::IsAbsMaxSupported && detail::is_fp8_v<ElementAux>;
+
+  static constexpr uint32_t MaxThreadsPerBlock = Threads;
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  static_assert(cute::is_same_v<GmemLayoutTag, layout::RowMajor> || cute::is_same_v<GmemLayoutTag, layout::ColumnMajor>,
+    "Partial slices, C and D must be row or column major.");
+  static_assert(Threads % NumThreadsPerWarp == 0 && Threads <= 1024,
+    "The thread count must be a multiple of the warp size and at most 1024.");
+  static_assert(SlicesInFlight >= 1, "At least one partial slice must be in flight.");
+  static_assert(sizeof_bits<ElementAccumulator>::value >= 8, "Sub-byte partial slices are not supported.");
+  static_assert(!FusionOp::IsBlockScaleSupported && !FusionOp::IsDeEltActSupported &&
+                !FusionOp::IsDePerRowBiasSupported && !FusionOp::IsAuxInSupported,
+    "Block scaling and backward fusions are not supported by the split-K reduction.");
+
+  struct SharedStorage { };
+
+  static constexpr int SharedStorageSize = 0;
+
+  // Fusion arguments, named after the arguments of the sm90 fusion callbacks. Fields the fusion
+  // operation does not support are ignored.
+  struct FusionArguments {
+    ElementScalar alpha = ElementScalar(1);
+    ElementScalar beta = ElementScalar(0);
+    // Scalars, or for per-row (per-column) scaling operations vectors of M (N) elements
+    ElementScalar const* alpha_ptr = nullptr;
+    ElementScalar const* beta_ptr = nullptr;
+
+    ElementScalar scale_a = ElementScalar(1);
+    ElementScalar scale_b = ElementScalar(1);
+    ElementScalar scale_c = ElementScalar(1);
+    ElementScalar scale_d = ElementScalar(1);
+    ElementScalar const* scale_a_ptr = nullptr;
+    ElementScalar const* scale_b_ptr = nullptr;
+    ElementScalar const* scale_c_ptr = nullptr;
+    ElementScalar const* scale_d_ptr = nullptr;
+
+    ElementScalar scale_aux = ElementScalar(1);
+    ElementScalar const* scale_aux_ptr = nullptr;
+
+    // M elements for per-row bias operations, N elements for per-column bias operations
+    ElementBias const* bias_ptr = nullptr;
+
+    ActivationArguments activation = ActivationArguments();
+
+    // Maxima are combined atomically with the values already in memory
+    ElementAmax* amax_D_ptr = nullptr;
+    ElementAmax* amax_aux_ptr = nullptr;
+
+    ElementAux* aux_ptr = nullptr;
+    StrideAux dAux = {};
+  };
+
+  // Device side arguments
+  struct Arguments {
+    ProblemShape problem_shape{};
+    ElementAccumulator const* ptr_partials = nullptr;
+    StrideAccumulator dPartials{};
+    ElementC const* ptr_C = nullptr;
+    StrideC dC{};
+    ElementD* ptr_D = nullptr;
+    StrideD dD{};
+    FusionArguments fusion{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ProblemShape problem_shape{};
+    ElementAccumulator const* ptr_partials = nullptr;
+    StrideAccumulator dPartials{};
+    ElementC const* ptr_C = nullptr;
+    StrideC dC{};
+    ElementD* ptr_D = nullptr;
+    StrideD dD{};
+    FusionArguments fusion{};
+
+    // C contributes to the output, i.e. beta may be nonzero
+    bool is_source_needed = false;
+    // Extent of the contiguous mode in vectors
+    int vectors_per_line = 0;
+    int64_t vector_count = 0;
+    int block_count = 0;
+  };
+
+  //
+  // Methods
+  //
+
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    Params params;
+    params.problem_shape = args.problem_shape;
+    params.ptr_partials = args.ptr_partials;
+    params.dPartials = args.dPartials;
+    params.ptr_C = args.ptr_C;
+    params.dC = args.dC;
+    params.ptr_D = args.ptr_D;
+    params.dD = args.dD;
+    params.fusion = args.fusion;
+
+    params.is_source_needed = FusionOp::IsSourceSupported && args.ptr_C != nullptr &&
+      (args.fusion.beta_ptr != nullptr || args.fusion.beta != ElementScalar(0));
+
+    auto [M, N, splits] = args.problem_shape;
+    int lines = IsRowMajor ? M : N;
+    params.vectors_per_line = (IsRowMajor ? N : M) / VectorLength;
+    params.vector_count = int64_t(lines) * params.vectors_per_line;
+
+    int sm_count = args.hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+    }
+    int64_t max_blocks = cute::max(1, sm_count * (2048 / Threads));
+    params.block_count = int(cute::max(int64_t(1),
+      cute::min(cute::ceil_div(params.vector_count, int64_t(Threads)), max_blocks)));
+
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    auto [M, N, splits] = args.problem_shape;
+    if (M <= 0 || N <= 0 || splits <= 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Extents and split count must be positive.\n");
+      return false;
+    }
+    if (args.ptr_partials == nullptr || args.ptr_D == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Partial slices and D must not be null.\n");
+      return false;
+    }
+    if ((IsRowMajor ? N : M) % VectorLength != 0) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: The contiguous extent must be a multiple of " << VectorLength << ".\n");
+      return false;
+    }
+
+    // Every vector of the partial slices, C, D and Aux starts on a 128b (partials) or
+    // VectorLength element boundary
+    auto is_aligned = [&](auto const* ptr, auto const& stride) {
+      using Element = cute::remove_cv_t<cute::remove_pointer_t<decltype(ptr)>>;
+      int64_t alignment = int64_t(sizeof(Element)) * VectorLength;
+      int64_t ld = IsRowMajor ? int64_t(cute::get<0>(stride)) : int64_t(cute::get<1>(stride));
+      int64_t batch = int64_t(cute::get<2>(stride));
+      return reinterpret_cast<uintptr_t>(ptr) % alignment == 0 &&
+             (ld * int64_t(sizeof(Element))) % alignment == 0 &&
+             (splits == 1 || (batch * int64_t(sizeof(Element))) % alignment == 0);
+    };
+    bool aligned = is_aligned(args.ptr_partials, args.dPartials) && is_aligned(args.ptr_D, args.dD);
+    if (FusionOp::IsSourceSupported && args.ptr_C != nullptr) {
+      aligned &= is_aligned(args.ptr_C, args.dC);
+    }
+    if (IsAux && args.fusion.aux_ptr != nullptr && cute::is_same_v<GmemLayoutTagAux, GmemLayoutTag>) {
+      aligned &= is_aligned(args.fusion.aux_ptr, args.fusion.dAux);
+    }
+    if (!aligned) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Tensors and their leading dimensions must be aligned to "
+        << VectorLength << " elements, partial slices to 128b.\n");
+      return false;
+    }
+    if (IsAux && args.fusion.aux_ptr == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: The fusion operation requires an aux tensor.\n");
+      return false;
+    }
+    return true;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return dim3(params.block_count, 1, 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+    (void) smem_buf;
+
+    using VectorAccumulator = AlignedArray<ElementAccumulator, VectorLength>;
+    using VectorC = AlignedArray<ElementC, VectorLength>;
+    using VectorD = AlignedArray<ElementD, VectorLength>;
+    using VectorAux = AlignedArray<ElementAux, VectorLength>;
+    using FragmentCompute = Array<ElementCompute, VectorLength>;
+
+    NumericArrayConverter<ElementCompute, ElementAccumulator, VectorLength, RoundStyle> convert_accumulator;
+    NumericArrayConverter<ElementCompute, ElementC, VectorLength, RoundStyle> convert_source;
+    NumericArrayConverter<ElementD, ElementCompute, VectorLength, RoundStyle> convert_output;
+    NumericArrayConverter<ElementAux, ElementCompute, VectorLength, RoundStyle> convert_aux;
+    NumericConverter<ElementCompute, ElementScalar, RoundStyle> convert_scalar;
+    NumericConverter<ElementCompute, ElementBias, RoundStyle> convert_bias;
+    plus<FragmentCompute> add;
+
+    FusionArguments const& fusion = params.fusion;
+    auto [M, N, splits] = params.problem_shape;
+    int64_t split_stride = int64_t(cute::get<2>(params.dPartials));
+
+    // Everything below may have been written by the partial GEMM
+    arch::wait_on_dependent_grids();
+
+    auto load_scalar = [&](ElementScalar const* ptr, ElementScalar value) {
+      return convert_scalar(ptr != nullptr ? *ptr : value);
+    };
+    ElementCompute scale_ab = ElementCompute(1);
+    ElementCompute scale_c = ElementCompute(1);
+    ElementCompute scale_d = ElementCompute(1);
+    ElementCompute scale_aux = ElementCompute(1);
+    if constexpr (IsScaleFactor) {
+      scale_ab = load_scalar(fusion.scale_a_ptr, fusion.scale_a) * load_scalar(fusion.scale_b_ptr, fusion.scale_b);
+      scale_c = load_scalar(fusion.scale_c_ptr, fusion.scale_c);
+    }
+    if constexpr (IsScaleD) {
+      scale_d = load_scalar(fusion.scale_d_ptr, fusion.scale_d);
+    }
+    if constexpr (IsScaleAux) {
+      scale_aux = load_scalar(fusion.scale_aux_ptr, fusion.scale_aux);
+    }
+    // Vectors of alpha and beta are loaded per output
+    ElementCompute alpha = fusion.alpha_ptr != nullptr && !(IsPerRowScale || IsPerColScale)
+      ? convert_scalar(*fusion.alpha_ptr) : convert_scalar(fusion.alpha);
+    ElementCompute beta = fusion.beta_ptr != nullptr && !(IsPerRowScale || IsPerColScale)
+      ? convert_scalar(*fusion.beta_ptr) : convert_scalar(fusion.beta);
+
+    ActivationFn activation;
+    ElementCompute amax_D = ElementCompute(0);
+    ElementCompute amax_aux = ElementCompute(0);
+    maximum_absolute_value_reduction<ElementCompute, true> amax_op;
+
+    for (int64_t v = int64_t(blockIdx.x) * Threads + threadIdx.x; v < params.vector_count;
+         v += int64_t(gridDim.x) * Threads) {
+      int line = int(v / params.vectors_per_line);
+      int offset = int(v % params.vectors_per_line) * VectorLength;
+      int m = IsRowMajor ? line : offset;
+      int n = IsRowMajor ? offset : line;
+
+      //
+      // Sum of the partial slices
+      //
+      ElementAccumulator const* ptr_partial = params.ptr_partials +
+        (int64_t(m) * cute::get<0>(params.dPartials) + int64_t(n) * cute::get<1>(params.dPartials));
+      FragmentCompute acc;
+      acc.fill(ElementCompute(0));
+      int split = 0;
+      for (; split + SlicesInFlight <= splits; split += SlicesInFlight) {
+        VectorAccumulator partials[SlicesInFlight];
+        CUTLASS_PRAGMA_UNROLL
+        for (int s = 0; s < SlicesInFlight; ++s) {
+          partials[s] = *reinterpret_cast<VectorAccumulator const*>(ptr_partial + (split + s) * split_stride);
+        }
+        CUTLASS_PRAGMA_UNROLL
+        for (int s = 0; s < SlicesInFlight; ++s) {
+          acc = add(acc, convert_accumulator(partials[s]));
+        }
+      }
+      for (; split < splits; ++split) {
+        acc = add(acc, convert_accumulator(
+          *reinterpret_cast<VectorAccumulator const*>(ptr_partial + split * split_stride)));
+      }
+
+      FragmentCompute source;
+      if (params.is_source_needed) {
+        source = convert_source(*reinterpret_cast<VectorC const*>(params.ptr_C +
+          (int64_t(m) * cute::get<0>(params.dC) + int64_t(n) * cute::get<1>(params.dC))));
+      }
+      else {
+        source.fill(ElementCompute(0));
+      }
+
+      //
+      // Fusion
+      //
+      FragmentCompute output;
+      FragmentCompute aux;
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < VectorLength; ++i) {
+        int row = IsRowMajor ? m : m + i;
+        int col = IsRowMajor ? n + i : n;
+
+        ElementCompute alpha_i = alpha;
+        ElementCompute beta_i = beta;
+        if constexpr (IsPerRowScale || IsPerColScale) {
+          int idx = IsPerRowScale ? row : col;
+          if (fusion.alpha_ptr != nullptr) {
+            alpha_i = convert_scalar(fusion.alpha_ptr[idx]);
+          }
+          if (fusion.beta_ptr != nullptr) {
+            beta_i = convert_scalar(fusion.beta_ptr[idx]);
+          }
+        }
+
+        ElementCompute z = scale_ab * alpha_i * acc[i];
+        if constexpr (!FusionOp::IsResidualSupported) {
+          z += scale_c * beta_i * source[i];
+        }
+        if constexpr (FusionOp::IsPerRowBiasSupported || FusionOp::IsPerColBiasSupported) {
+          if (fusion.bias_ptr != nullptr) {
+            z += convert_bias(fusion.bias_ptr[FusionOp::IsPerRowBiasSupported ? row : col]);
+          }
+        }
+
+        if constexpr (IsAmaxAux) {
+          amax_aux = amax_op(amax_aux, z);
+        }
+        aux[i] = IsScaleAux ? z * scale_aux : z;
+
+        ElementCompute d;
+        if constexpr (cute::is_same_v<ActivationArguments, detail::EmptyActivationArguments>) {
+          d = activation(z);
+        }
+        else {
+          d = activation(z, fusion.activation);
+        }
+        if constexpr (FusionOp::IsResidualSupported) {
+          d += scale_c * beta_i * source[i];
+        }
+
+        if constexpr (IsAmaxD) {
+          amax_D = amax_op(amax_D, d);
+        }
+        output[i] = IsScaleD ? d * scale_d : d;
+      }
+
+      Array<ElementD, VectorLength> output_frag = convert_output(output);
+      *reinterpret_cast<VectorD*>(params.ptr_D +
+        (int64_t(m) * cute::get<0>(params.dD) + int64_t(n) * cute::get<1>(params.dD))) =
+        reinterpret_cast<VectorD const&>(output_frag);
+
+      if constexpr (IsAux) {
+        auto aux_offset = [&](int row, int col) {
+          return int64_t(row) * cute::get<0>(fusion.dAux) + int64_t(col) * cute::get<1>(fusion.dAux);
+        };
+        Array<ElementAux, VectorLength> aux_frag = convert_aux(aux);
+        if constexpr (cute::is_same_v<GmemLayoutTagAux, GmemLayoutTag>) {
+          *reinterpret_cast<VectorAux*>(fusion.aux_ptr + aux_offset(m, n)) =
+            reinterpret_cast<VectorAux const&>(aux_frag);
+        }
+        else {
+          CUTLASS_PRAGMA_UNROLL
+          for (int i = 0; i < VectorLength; ++i) {
+            fusion.aux_ptr[IsRowMajor ? aux_offset(m, n + i) : aux_offset(m + i, n)] = aux_frag[i];
+          }
+        }
+      }
+    }
+
+    // The partial slices have been consumed
+    arch::launch_dependent_grids();
+
+    if constexpr (IsAmaxD) {
+      if (fusion.amax_D_ptr != nullptr) {
+        store_amax(fusion.amax_D_ptr, amax_D);
+      }
+    }
+    if constexpr (IsAmaxAux) {
+      if (fusion.amax_aux_ptr != nullptr) {
+        store_amax(fusion.amax_aux_ptr, amax_aux);
+      }
+    }
+  }
+
+private:
+
+  // Combines the maxima of a warp and merges them atomically into *ptr
+  CUTLASS_DEVICE
+  static void
+  store_amax(ElementAmax* ptr, ElementCompute amax) {
+    maximum<ElementCompute, true> max_op;
+    CUTLASS_PRAGMA_UNROLL
+    for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+      amax = max_op(amax, __shfl_xor_sync(0xffffffff, amax, offset));
+    }
+    if (threadIdx.x % NumThreadsPerWarp == 0) {
+      atomic_maximum<ElementAmax>{}(ptr, NumericConverter<ElementAmax, ElementCompute>{}(amax));
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::reduction::kernel
+
+///////////////////////////////////////////////////////////////////////////////
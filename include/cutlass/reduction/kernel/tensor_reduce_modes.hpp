@@ -0,0 +1,579 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Reduction of an arbitrary subset of the modes of an affine tensor, with element-wise maps
+    fused before and after the reduction.
+
+    The source offset of element (o, r) is layout_kept(o) + layout_reduced(r), where o enumerates
+    the coordinates of the output and r the coordinates of the reduced modes. Two strategies are
+    selected at runtime:
+
+    - Contiguous: mode 0 of the reduced layout has unit stride. Each cluster reduces one output at a
+      time; the reduced range is cut into chunks of at most StageBytes of contiguous elements. On
+      SM90, chunks are streamed into a multistage shared memory buffer with bulk copies (TMA),
+      provided every chunk is 16B aligned; otherwise the CTA reads them from global memory.
+    - Strided: every thread reduces one output, so consecutive threads read consecutive kept
+      coordinates.
+
+    With ClusterSize > 1, the CTAs of a (ClusterSize, 1, 1) cluster split the reduced range of the
+    same outputs, and the first CTA of the cluster combines their partial results through
+    distributed shared memory, so no workspace or second kernel is needed.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/arch/arch.h"
+#include "cutlass/arch/barrier.h"
+#include "cutlass/trace.h"
+
+#include "cute/tensor.hpp"
+#include "cute/arch/cluster_sm90.hpp"
+#include "cute/arch/copy_sm90_tma.hpp"
+
+///////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::reduction::kernel {
+
+///////////////////////////////////////////////////////////////////////////////
+
+template <
+  class ElementOutput_,
+  class ElementSource_,
+  class ElementCompute_,
+  class ReductionOp_,                  // Associative and commutative binary op on ElementCompute
+  class PreMap_,                       // Unary op on ElementCompute applied to every source element
+  class PostMap_,                      // Unary op on ElementCompute applied to every reduced value
+  int KeptRank_,                       // Number of modes of the output
+  int ReducedRank_,                    // Number of reduced modes
+  int ClusterSize_ = 1,                // Number of CTAs splitting the reduced range of an output
+  int Threads_ = 256,
+  int Stages_ = 4,
+  int StageBytes_ = 4096
+>
+class TensorReduceModes {
+public:
+  //
+  // Type Aliases
+  //
+  using ElementOutput = ElementOutput_;
+  using ElementSource = ElementSource_;
+  using ElementCompute = ElementCompute_;
+  using ReductionOp = ReductionOp_;
+  using PreMap = PreMap_;
+  using PostMap = PostMap_;
+  // Clusters require SM90, the single CTA variant runs on any architecture
+  using ArchTag = cute::conditional_t<(ClusterSize_ > 1), arch::Sm90, arch::Sm80>;
+
+  static constexpr int KeptRank = KeptRank_;
+  static constexpr int ReducedRank = ReducedRank_;
+  static constexpr int ClusterSize = ClusterSize_;
+  static constexpr int Threads = Threads_;
+  static constexpr int Stages = Stages_;
+  static constexpr int StageBytes = StageBytes_;
+  static constexpr int StageElements = StageBytes / int(sizeof(ElementSource));
+  static constexpr int NumWarps = Threads / NumThreadsPerWarp;
+
+  static constexpr uint32_t MaxThreadsPerBlock = Threads;
+  static constexpr uint32_t MinBlocksPerMultiprocessor = 1;
+
+  static_assert(KeptRank > 0 && ReducedRank > 0, "Pad empty mode sets with a mode of extent 1.");
+  static_assert(ClusterSize >= 1 && ClusterSize <= 8, "Cluster size must not exceed the portable maximum of 8 CTAs.");
+  static_assert(Threads % NumThreadsPerWarp == 0 && NumWarps <= NumThreadsPerWarp,
+    "The thread count must be a multiple of the warp size and at most 1024.");
+  static_assert(sizeof_bits<ElementSource>::value >= 8, "Sub-byte source elements are not supported.");
+  static_assert(StageBytes % 16 == 0 && StageElements > 0, "Stages must hold a multiple of 16B.");
+
+  // Offsets of the output coordinates in the source (or destination) and of the reduced coordinates
+  // in the source, all coordinates enumerated in colexicographical order
+  using LayoutKept = cute::Layout<decltype(cute::wrap(cute::repeat<KeptRank>(int{}))),
+                                  decltype(cute::wrap(cute::repeat<KeptRank>(int64_t{})))>;
+  using LayoutReduced = cute::Layout<decltype(cute::wrap(cute::repeat<ReducedRank>(int{}))),
+                                     decltype(cute::wrap(cute::repeat<ReducedRank>(int64_t{})))>;
+
+  // Partial result of a CTA read by the first CTA of the cluster, padded to whole 32b words
+  struct alignas(sizeof(ElementCompute) < 4 ? 4 : alignof(ElementCompute)) ClusterPartial {
+    ElementCompute value;
+  };
+
+  struct SharedStorage {
+    alignas(128) ElementSource stages[Stages][StageElements];
+    alignas(8) uint64_t barriers[Stages];
+    ElementCompute warp_partials[NumWarps];
+    // Double buffered so that a CTA may run ahead by one output of the first CTA of the cluster
+    ClusterPartial cluster_partials[2][ClusterSize > 1 ? Threads : 1];
+  };
+
+  static constexpr int SharedStorageSize = sizeof(SharedStorage);
+
+  // Device side arguments
+  struct Arguments {
+    ElementOutput* ptr_dst = nullptr;
+    LayoutKept layout_dst{};
+    ElementSource const* ptr_src = nullptr;
+    LayoutKept layout_kept{};
+    LayoutReduced layout_reduced{};
+    ElementCompute reduction_identity{};
+    ReductionOp reduction_op{};
+    PreMap pre_map{};
+    PostMap post_map{};
+    KernelHardwareInfo hw_info{};
+  };
+
+  // Kernel entry point API
+  struct Params {
+    ElementOutput* ptr_dst = nullptr;
+    LayoutKept layout_dst{};
+    ElementSource const* ptr_src = nullptr;
+    LayoutKept layout_kept{};
+    LayoutReduced layout_reduced{};
+    ElementCompute reduction_identity{};
+    ReductionOp reduction_op{};
+    PreMap pre_map{};
+    PostMap post_map{};
+
+    int64_t output_count = 0;
+    int64_t reduced_count = 0;
+    // Extent of mode 0 of the reduced layout
+    int row_length = 0;
+    // Mode 0 of the reduced layout is contiguous
+    bool contiguous = false;
+    // Chunks are loaded with bulk copies
+    bool bulk_copy = false;
+    int chunks_per_row = 0;
+    int64_t chunk_count = 0;
+    int cluster_count = 0;
+  };
+
+  //
+  // Methods
+  //
+
+  static Params
+  to_underlying_arguments(Arguments const& args, void* workspace) {
+    (void) workspace;
+
+    Params params;
+    params.ptr_dst = args.ptr_dst;
+    params.layout_dst = args.layout_dst;
+    params.ptr_src = args.ptr_src;
+    params.layout_kept = args.layout_kept;
+    params.layout_reduced = args.layout_reduced;
+    params.reduction_identity = args.reduction_identity;
+    params.reduction_op = args.reduction_op;
+    params.pre_map = args.pre_map;
+    params.post_map = args.post_map;
+
+    params.output_count = int64_t(cute::size(args.layout_kept));
+    params.reduced_count = int64_t(cute::size(args.layout_reduced));
+    params.row_length = int(cute::size<0>(args.layout_reduced));
+    params.contiguous = params.row_length > 1 && cute::stride<0>(args.layout_reduced) == 1;
+    params.chunks_per_row = cute::ceil_div(params.row_length, StageElements);
+    params.chunk_count = (params.reduced_count / params.row_length) * params.chunks_per_row;
+
+    if (params.contiguous) {
+      params.bulk_copy = is_bulk_copy_aligned(args) && device_supports_bulk_copy(args.hw_info.device_id);
+    }
+
+    // One output per cluster for the contiguous strategy, one output per thread otherwise
+    int64_t work_count = params.contiguous ? params.output_count
+                                           : cute::ceil_div(params.output_count, int64_t(Threads));
+    int sm_count = args.hw_info.sm_count;
+    if (sm_count <= 0) {
+      sm_count = KernelHardwareInfo::query_device_multiprocessor_count(args.hw_info.device_id);
+    }
+    int64_t max_clusters = cute::max(1, sm_count * (2048 / Threads) / ClusterSize);
+    params.cluster_count = int(cute::min(work_count, max_clusters));
+
+    return params;
+  }
+
+  static bool
+  can_implement(Arguments const& args) {
+    if (args.ptr_dst == nullptr || args.ptr_src == nullptr) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Source and destination must not be null.\n");
+      return false;
+    }
+    bool implementable = true;
+    cute::for_each(cute::make_seq<KeptRank>{}, [&](auto i) {
+      implementable &= cute::size<i>(args.layout_kept) > 0 &&
+                       cute::size<i>(args.layout_kept) == cute::size<i>(args.layout_dst);
+    });
+    cute::for_each(cute::make_seq<ReducedRank>{}, [&](auto i) {
+      implementable &= cute::size<i>(args.layout_reduced) > 0;
+    });
+    if (!implementable) {
+      CUTLASS_TRACE_HOST("  CAN IMPLEMENT: Extents must be positive and match between source and destination.\n");
+    }
+    return implementable;
+  }
+
+  static size_t
+  get_workspace_size(Arguments const& args) {
+    return 0;
+  }
+
+  static cutlass::Status
+  initialize_workspace(Arguments const& args, void* workspace = nullptr, cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr) {
+    return Status::kSuccess;
+  }
+
+  static dim3
+  get_grid_shape(Params const& params) {
+    return dim3(params.cluster_count * ClusterSize, 1, 1);
+  }
+
+  static dim3
+  get_block_shape() {
+    return dim3(MaxThreadsPerBlock, 1, 1);
+  }
+
+  CUTLASS_DEVICE
+  void
+  operator()(Params const& params, char* smem_buf) {
+
+#if ! defined(CUTE_ARCH_CLUSTER_SM90_ENABLED)
+    if constexpr (ClusterSize > 1) {
+      CUTE_INVALID_CONTROL_PATH("ERROR : Cluster reductions require sm90 or newer. Aborting.\n");
+      return;
+    }
+#endif
+
+    SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
+
+    int cluster_idx = int(blockIdx.x) / ClusterSize;
+    int rank = ClusterSize > 1 ? int(cute::block_rank_in_cluster()) : 0;
+
+    if (params.contiguous) {
+      reduce_contiguous(params, shared_storage, cluster_idx, rank);
+    }
+    else {
+      reduce_strided(params, shared_storage, cluster_idx, rank);
+    }
+
+    // Keep the shared memory of every CTA alive until the first CTA has read its partial results
+    if constexpr (ClusterSize > 1) {
+      cute::cluster_sync();
+    }
+  }
+
+private:
+
+  static bool
+  is_bulk_copy_aligned(Arguments const& args) {
+    constexpr int64_t Alignment = 16;
+    bool aligned = reinterpret_cast<uintptr_t>(args.ptr_src) % Alignment == 0 &&
+                   (int64_t(cute::size<0>(args.layout_reduced)) * int64_t(sizeof(ElementSource))) % Alignment == 0;
+    cute::for_each(cute::make_seq<KeptRank>{}, [&](auto i) {
+      aligned &= cute::size<i>(args.layout_kept) == 1 ||
+                 (cute::stride<i>(args.layout_kept) * int64_t(sizeof(ElementSource))) % Alignment == 0;
+    });
+    cute::for_each(cute::make_seq<ReducedRank - 1>{}, [&](auto i) {
+      constexpr int Mode = decltype(i)::value + 1;
+      aligned &= cute::size<Mode>(args.layout_reduced) == 1 ||
+                 (cute::stride<Mode>(args.layout_reduced) * int64_t(sizeof(ElementSource))) % Alignment == 0;
+    });
+    return aligned;
+  }
+
+  static bool
+  device_supports_bulk_copy(int device_id) {
+    int major = 0;
+    if (cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device_id) != cudaSuccess) {
+      cudaGetLastError(); // to clear the error bit
+      return false;
+    }
+    return major >= 9;
+  }
+
+  CUTLASS_DEVICE
+  static ElementCompute
+  load(Params const& params, int64_t offset) {
+    NumericConverter<ElementCompute, ElementSource> convert;
+    return params.pre_map(convert(params.ptr_src[offset]));
+  }
+
+  CUTLASS_DEVICE
+  static void
+  store(Params const& params, int64_t output, ElementCompute value) {
+    NumericConverter<ElementOutput, ElementCompute> convert;
+    params.ptr_dst[params.layout_dst(output)] = convert(params.post_map(value));
+  }
+
+  // Shuffles an arbitrary trivially copyable value as 32b words
+  template <class T>
+  CUTLASS_DEVICE
+  static T
+  shfl_xor(T const& value, int lane_mask) {
+    constexpr int Words = (int(sizeof(T)) + 3) / 4;
+    uint32_t words[Words] = {};
+    memcpy(words, &value, sizeof(T));
+    CUTLASS_PRAGMA_UNROLL
+    for (int w = 0; w < Words; ++w) {
+      words[w] = __shfl_xor_sync(0xffffffff, words[w], lane_mask);
+    }
+    T result;
+    memcpy(&result, words, sizeof(T));
+    return result;
+  }
+
+  // Reduces the value of every thread of the CTA, the result is valid in thread 0
+  CUTLASS_DEVICE
+  static ElementCompute
+  block_reduce(Params const& params, SharedStorage& shared_storage, ElementCompute accum) {
+    int lane_idx = int(threadIdx.x) % NumThreadsPerWarp;
+    int warp_idx = int(threadIdx.x) / NumThreadsPerWarp;
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+      accum = params.reduction_op(accum, shfl_xor(accum, offset));
+    }
+    if constexpr (NumWarps > 1) {
+      if (lane_idx == 0) {
+        shared_storage.warp_partials[warp_idx] = accum;
+      }
+      __syncthreads();
+      if (warp_idx == 0) {
+        accum = lane_idx < NumWarps ? shared_storage.warp_partials[lane_idx] : params.reduction_identity;
+        CUTLASS_PRAGMA_UNROLL
+        for (int offset = NumThreadsPerWarp / 2; offset > 0; offset /= 2) {
+          accum = params.reduction_op(accum, shfl_xor(accum, offset));
+        }
+      }
+      // The partials are overwritten by the next output
+      __syncthreads();
+    }
+    return accum;
+  }
+
+  // Combines the partial results at the same index of every CTA of the cluster, the result is
+  // valid in the first CTA. Every thread of every CTA must call this.
+  CUTLASS_DEVICE
+  static ElementCompute
+  cluster_reduce(Params const& params, SharedStorage& shared_storage, ElementCompute accum,
+                 int index, int buffer, int rank) {
+    if constexpr (ClusterSize == 1) {
+      return accum;
+    }
+    else {
+      ClusterPartial* partial = &shared_storage.cluster_partials[buffer][index];
+      partial->value = accum;
+      cute::cluster_sync();
+      if (rank == 0) {
+        uint32_t partial_addr = cute::cast_smem_ptr_to_uint(partial);
+        CUTLASS_PRAGMA_UNROLL
+        for (int peer = 1; peer < ClusterSize; ++peer) {
+          accum = params.reduction_op(accum, load_remote(partial_addr, peer).value);
+        }
+      }
+      return accum;
+    }
+  }
+
+  // Loads the partial result of the CTA with rank cta_id in the cluster
+  CUTLASS_DEVICE
+  static ClusterPartial
+  load_remote(uint32_t smem_addr, uint32_t cta_id) {
+    constexpr int Words = int(sizeof(ClusterPartial)) / 4;
+    uint32_t words[Words];
+    uint32_t remote_addr = cute::set_block_rank(smem_addr, cta_id);
+    CUTLASS_PRAGMA_UNROLL
+    for (int w = 0; w < Words; ++w) {
+#if defined(CUTE_ARCH_CLUSTER_SM90_ENABLED)
+      asm volatile(
+          "ld.shared::cluster.b32 %0, [%1];\n"
+          : "=r"(words[w])
+          : "r"(remote_addr + uint32_t(w * 4))
+          : "memory");
+#else
+      words[w] = 0;
+#endif
+    }
+    ClusterPartial partial;
+    memcpy(&partial, words, sizeof(ClusterPartial));
+    return partial;
+  }
+
+  // Length in elements of chunk `chunk` of the reduced range, and its source offset relative to
+  // the kept offset of the output
+  CUTLASS_DEVICE
+  static int64_t
+  chunk_offset(Params const& params, int64_t chunk, int& length) {
+    int64_t row = chunk / params.chunks_per_row;
+    int col = int(chunk % params.chunks_per_row) * StageElements;
+    length = cute::min(StageElements, params.row_length - col);
+    return params.layout_reduced(row * params.row_length) + col;
+  }
+
+  CUTLASS_DEVICE
+  static void
+  reduce_contiguous(Params const& params, SharedStorage& shared_storage, int cluster_idx, int rank) {
+    int thread_idx = int(threadIdx.x);
+
+    // Chunks rank, rank + ClusterSize, ... of the reduced range of every output belong to this CTA
+    int64_t local_chunks = params.chunk_count > rank
+      ? (params.chunk_count - rank + ClusterSize - 1) / ClusterSize : 0;
+    int64_t local_outputs = (params.output_count - cluster_idx + params.cluster_count - 1) / params.cluster_count;
+
+#if defined(CUTE_ARCH_TMA_SM90_ENABLED)
+    if (params.bulk_copy) {
+      using Barrier = cutlass::arch::ClusterTransactionBarrier;
+
+      if (thread_idx == 0) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int stage = 0; stage < Stages; ++stage) {
+          Barrier::init(&shared_storage.barriers[stage], 1);
+        }
+        cutlass::arch::fence_barrier_init();
+      }
+      __syncthreads();
+
+      // The chunks of consecutive outputs form a single stream, so the loads of the next output
+      // overlap the reduction of the current one
+      int64_t load_count = local_outputs * local_chunks;
+      auto issue = [&](int64_t load) {
+        int64_t output = cluster_idx + (load / local_chunks) * params.cluster_count;
+        int64_t chunk = rank + (load % local_chunks) * ClusterSize;
+        int length;
+        int64_t offset = params.layout_kept(output) + chunk_offset(params, chunk, length);
+        int stage = int(load % Stages);
+        uint32_t bytes = uint32_t(length) * uint32_t(sizeof(ElementSource));
+        Barrier::arrive_and_expect_tx(&shared_storage.barriers[stage], bytes);
+        cute::SM90_BULK_COPY_G2S::copy(params.ptr_src + offset, &shared_storage.barriers[stage],
+                                       shared_storage.stages[stage], int32_t(bytes));
+      };
+
+      if (thread_idx == 0) {
+        for (int64_t load = 0; load < cute::min(load_count, int64_t(Stages)); ++load) {
+          issue(load);
+        }
+      }
+
+      NumericConverter<ElementCompute, ElementSource> convert;
+      int64_t load = 0;
+      for (int64_t iter = 0; iter < local_outputs; ++iter) {
+        ElementCompute accum = params.reduction_identity;
+        for (int64_t i = 0; i < local_chunks; ++i, ++load) {
+          int stage = int(load % Stages);
+          int length;
+          chunk_offset(params, rank + i * ClusterSize, length);
+          Barrier::wait(&shared_storage.barriers[stage], uint32_t((load / Stages) & 1));
+          for (int e = thread_idx; e < length; e += Threads) {
+            accum = params.reduction_op(accum, params.pre_map(convert(shared_storage.stages[stage][e])));
+          }
+          // Every thread is done with the stage before it is refilled
+          __syncthreads();
+          if (thread_idx == 0 && load + Stages < load_count) {
+            issue(load + Stages);
+          }
+        }
+        finish_output(params, shared_storage, cluster_idx + iter * params.cluster_count, accum, iter, rank);
+      }
+      return;
+    }
+#endif
+
+    for (int64_t iter = 0; iter < local_outputs; ++iter) {
+      int64_t output = cluster_idx + iter * params.cluster_count;
+      int64_t kept_offset = params.layout_kept(output);
+      ElementCompute accum = params.reduction_identity;
+      for (int64_t i = 0; i < local_chunks; ++i) {
+        int length;
+        int64_t offset = kept_offset + chunk_offset(params, rank + i * ClusterSize, length);
+        for (int e = thread_idx; e < length; e += Threads) {
+          accum = params.reduction_op(accum, load(params, offset + e));
+        }
+      }
+      finish_output(params, shared_storage, output, accum, iter, rank);
+    }
+  }
+
+  CUTLASS_DEVICE
+  static void
+  finish_output(Params const& params, SharedStorage& shared_storage, int64_t output,
+                ElementCompute accum, int64_t iter, int rank) {
+    accum = block_reduce(params, shared_storage, accum);
+    accum = cluster_reduce(params, shared_storage, accum, 0, int(iter & 1), rank);
+    if (rank == 0 && threadIdx.x == 0) {
+      store(params, output, accum);
+    }
+  }
+
+  CUTLASS_DEVICE
+  static void
+  reduce_strided(Params const& params, SharedStorage& shared_storage, int cluster_idx, int rank) {
+    int thread_idx = int(threadIdx.x);
+    int64_t tile_count = cute::ceil_div(params.output_count, int64_t(Threads));
+
+    // Reduced coordinates [begin, end) belong to this CTA
+    int64_t begin = rank * params.reduced_count / ClusterSize;
+    int64_t end = (rank + 1) * params.reduced_count / ClusterSize;
+    int64_t row_stride = cute::stride<0>(params.layout_reduced);
+
+    int64_t iter = 0;
+    for (int64_t tile = cluster_idx; tile < tile_count; tile += params.cluster_count, ++iter) {
+      int64_t output = tile * Threads + thread_idx;
+      bool is_valid = output < params.output_count;
+
+      ElementCompute accum = params.reduction_identity;
+      if (is_valid && begin < end) {
+        int64_t kept_offset = params.layout_kept(output);
+        // Walk mode 0 incrementally and evaluate the reduced layout once per row
+        int64_t row = begin / params.row_length;
+        int col = int(begin % params.row_length);
+        int64_t row_offset = kept_offset + params.layout_reduced(row * params.row_length);
+        for (int64_t idx = begin; idx < end; ++idx) {
+          accum = params.reduction_op(accum, load(params, row_offset + col * row_stride));
+          if (++col == params.row_length) {
+            col = 0;
+            ++row;
+            row_offset = kept_offset + params.layout_reduced(row * params.row_length);
+          }
+        }
+      }
+
+      accum = cluster_reduce(params, shared_storage, accum, thread_idx, int(iter & 1), rank);
+      if (rank == 0 && is_valid) {
+        store(params, output, accum);
+      }
+    }
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::reduction::kernel
+
+///////////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,7 @@
 #include "cutlass/numeric_types.h"
 #include "cutlass/array.h"
 #include "cutlass/functional.h"
+#include "cutlass/fast_math.h"
 #include "cutlass/numeric_conversion.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -105,6 +106,82 @@ struct ReduceAdd {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+//
+// Element-wise maps fused before (pre-map) and after (post-map) a reduction by
+// cutlass::reduction::device::TensorReduceModes. Maps may carry state, which is passed by value
+// to the kernel.
+//
+
+/// Returns its argument
+template <typename T>
+struct MapIdentity {
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &x) const {
+    return x;
+  }
+};
+
+/// Returns the absolute value, e.g. as the pre-map of an amax reduction
+template <typename T>
+struct MapAbsolute {
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &x) const {
+    absolute_value_op<T> abs_op;
+    return abs_op(x);
+  }
+};
+
+/// Returns the square, e.g. as the pre-map of a sum of squares
+template <typename T>
+struct MapSquare {
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &x) const {
+    square<T> square_op;
+    return square_op(x);
+  }
+};
+
+/// Returns the square root, e.g. as the post-map of an L2 norm
+template <typename T>
+struct MapSqrt {
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &x) const {
+    if constexpr (platform::is_same<T, double>::value) {
+      return fast_sqrt(x);
+    }
+    else {
+      return T(fast_sqrt(float(x)));
+    }
+  }
+};
+
+/// Multiplies by a scalar, e.g. 1/N to turn a sum into a mean
+template <typename T>
+struct MapScale {
+  T alpha = T(1);
+
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &x) const {
+    multiplies<T> mul_op;
+    return mul_op(alpha, x);
+  }
+};
+
+/// Applies Inner, then Outer, e.g. MapCompose<MapScale<float>, MapSqrt<float>> for an RMS norm
+template <typename Inner, typename Outer>
+struct MapCompose {
+  Inner inner{};
+  Outer outer{};
+
+  template <typename T>
+  CUTLASS_HOST_DEVICE
+  T operator()(T const &x) const {
+    return outer(inner(x));
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace detail {
 
 /// Special handling for binary operators
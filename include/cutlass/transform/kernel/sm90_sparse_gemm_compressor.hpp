@@ -53,6 +53,64 @@ namespace cutlass::transform::kernel {
 
 using namespace cute;
 
+namespace detail {
+
+// Magnitude ordering key of one ElementAMmaRaw unit holding ElemsPerUnit packed ElementA.
+// Floating point formats are sign-magnitude, so clearing the sign bit yields a key that orders
+// like |x| without decoding the element (this also covers the type-erased runtime formats).
+// Packed e2m1 pairs sum the decoded magnitudes of both halves, in units of 0.5.
+template <class ElementA, int ElemsPerUnit, class Unit>
+CUTE_HOST_DEVICE
+uint32_t
+structured_sparse_magnitude_key(Unit unit) {
+  constexpr int ElementABits = cute::sizeof_bits_v<ElementA>;
+  const uint32_t bits = static_cast<uint32_t>(unit);
+
+  if constexpr (ElemsPerUnit == 2) {
+    static_assert(ElementABits == 4, "Only e2m1 is packed in pairs");
+    constexpr uint32_t e2m1_magnitude[8] = {0, 1, 2, 3, 4, 6, 8, 12};
+    return e2m1_magnitude[bits & 0x7] + e2m1_magnitude[(bits >> 4) & 0x7];
+  }
+  else if constexpr (cute::is_same_v<ElementA, int8_t>) {
+    const int value = static_cast<int8_t>(bits);
+    return static_cast<uint32_t>(value < 0 ? -value : value);
+  }
+  else if constexpr (cute::is_same_v<ElementA, uint8_t>) {
+    return bits;
+  }
+  else {
+    return bits & ((1u << (ElementABits - 1)) - 1u);
+  }
+}
+
+// Keeps the KeepCount largest-magnitude units of one logical chunk and zeroes the rest.
+// Ties keep the lower index. A chunk never straddles a scale-factor block, so comparing raw
+// magnitudes selects the same elements as comparing scaled values for block-scaled inputs.
+template <class ElementA, int ElemsPerUnit, int KeepCount, class Unit, int ChunkSize>
+CUTE_HOST_DEVICE
+void
+structured_sparse_magnitude_prune(Unit (&chunk)[ChunkSize]) {
+  uint32_t keys[ChunkSize];
+  CUTE_UNROLL
+  for (int i = 0; i < ChunkSize; ++i) {
+    keys[i] = structured_sparse_magnitude_key<ElementA, ElemsPerUnit>(chunk[i]);
+  }
+
+  CUTE_UNROLL
+  for (int i = 0; i < ChunkSize; ++i) {
+    int rank = 0;
+    CUTE_UNROLL
+    for (int j = 0; j < ChunkSize; ++j) {
+      rank += (keys[j] > keys[i]) || (keys[j] == keys[i] && j < i);
+    }
+    if (rank >= KeepCount) {
+      chunk[i] = Unit{0};
+    }
+  }
+}
+
+} // namespace detail
+
 template<
   class ProblemShape_,
   class ElementA_,
@@ -123,6 +181,9 @@ public:
     StrideA dA{};
     void* ptr_ACompress{nullptr};
     void* ptr_E{nullptr};
+    // Prune each chunk of a dense A to its largest-magnitude elements before compressing.
+    // When false, A must already satisfy the sparsity pattern.
+    bool prune{false};
   };
 
   using TransformParams = TransformArguments;
@@ -145,7 +206,7 @@ public:
   to_underlying_arguments(Arguments const& args, void* workspace = nullptr) {
     CUTLASS_TRACE_HOST("SM90StructuredSparseCompressor::to_underlying_arguments()");
     return Params{{args.problem_shape},
-                  {args.transform.ptr_A, args.transform.dA, args.transform.ptr_ACompress, args.transform.ptr_E},
+                  {args.transform.ptr_A, args.transform.dA, args.transform.ptr_ACompress, args.transform.ptr_E, args.transform.prune},
                   {args.hw_info},
                   workspace};
   }
@@ -297,7 +358,7 @@ private:
   structure_sparse_compress(Params params, void* smem_buf) {
     // * Input Params
     auto [GemmM, GemmN, GemmK, GemmL] = params.problem_shape;
-    auto [ptr_A, dA, ptr_ACompress, ptr_E] = params.transform;
+    auto [ptr_A, dA, ptr_ACompress, ptr_E, prune] = params.transform;
     SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(smem_buf);
 
     [[maybe_unused]] const int gridDim_X = gridDim.x;
@@ -434,11 +495,22 @@ private:
           //  non_zero_elt_log_idx = [0, 3]
           int non_zero_elt_log_idx[OneChunkSizeAC{}] = { 0 };
 
+          ElementAMmaRawUnit chunk[OneChunkSizeA{}];
+          CUTE_UNROLL
+          for (int elt_log_idx = 0; elt_log_idx < OneChunkSizeA{}; ++elt_log_idx) {
+            chunk[elt_log_idx] = tAsA[elt_log_idx];
+          }
+
+          // * Prune Dense Chunk to Sparsity Pattern
+          if (prune) {
+            detail::structured_sparse_magnitude_prune<ElementA, ElemsARawPerElementAMmaRaw, OneChunkSizeAC{}>(chunk);
+          }
+
           // * Find None Zero Element Idx within Chunk
           CUTE_UNROLL
           for (int elt_log_idx = 0; elt_log_idx < OneChunkSizeA{}; ++elt_log_idx) {
             // Iterate through all ElementAMma within one logical chunk
-            ElementAMmaRawUnit tAsA_i = tAsA[elt_log_idx];
+            ElementAMmaRawUnit tAsA_i = chunk[elt_log_idx];
             
             // Mask off the signed bit s.t. negative zero is same as positive zero
             ElementAMmaRawUnit tAsA_i_negzero_masked_out = tAsA_i;
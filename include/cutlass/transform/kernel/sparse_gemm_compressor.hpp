@@ -221,6 +221,39 @@ public:
     }    // end of chunk_idx
   }
 
+  /**
+   * @brief Prune a dense host TensorA in place to the sparsity pattern, keeping the
+   *        largest-magnitude elements of each chunk as the device compressor does with `prune` set
+   */
+  void structure_sparse_magnitude_prune(void* host_a_ptr) {
+
+    constexpr int ChunkSize = LogicalElemsAMmaRawPerChunk;
+    constexpr int KeepSize = PhysicalElemsAMmaRawPerChunk;
+    using ChunkElement = cute::uint_bit_t<cute::sizeof_bits_v<ElementAMmaRaw>>;
+
+    cute::Tensor gA_eltA = cute::make_tensor(
+        cute::recast_ptr<ElementA>(host_a_ptr),
+        cute::make_layout(make_shape(M, K, L), dA));
+
+    // Input TensorA is handled in unit of ElementAMmaRaw instead of ElementA
+    cute::Tensor gA = cute::recast<ChunkElement>(gA_eltA);
+
+    // Extract out the Chunk from K-mode
+    Tensor gA_chunk = cute::zipped_divide(gA, cute::Shape<_1,cute::Int<ChunkSize>>{}); // (Chunk, Rest)
+
+    auto rest_shape = cute::shape<1>(gA_chunk);
+    for (auto iter = cute::make_coord_iterator(rest_shape); iter != cute::ForwardCoordIteratorSentinel{}; ++iter) {
+      ChunkElement chunk[ChunkSize];
+      for (int c = 0; c < ChunkSize; ++c) {
+        chunk[c] = gA_chunk(c, *iter);
+      }
+      detail::structured_sparse_magnitude_prune<ElementA, ElemsARawPerElementAMmaRaw, KeepSize>(chunk);
+      for (int c = 0; c < ChunkSize; ++c) {
+        gA_chunk(c, *iter) = chunk[c];
+      }
+    }
+  }
+
   int M{-1};
   int K{-1};
   int L{-1};
@@ -89,6 +89,7 @@ from .cute.typing import *
 from . import utils as utils
 from . import pipeline as pipeline
 from . import testing as testing
+from .testing import autotune
 
 # Used as internal symbol
 from . import cutlass_dsl as _dsl
@@ -19,6 +19,7 @@ import io
 import sys
 import uuid
 import random
+import shutil
 import tempfile
 import time
 from typing import Any
@@ -329,6 +330,149 @@ def dump_cache_to_path(
         )
 
 
+class FileJitCache:
+    """
+    On-disk cache of compiled modules shared by all processes using the same
+    cache directory. Entries are keyed by the module hash, which covers the
+    generated IR (and thus the function body and constexpr arguments), the
+    environment including the target arch, the compile options, and the DSL
+    version.
+
+    Entries are written atomically by ``save_ir``, so concurrent processes never
+    observe partial files. An entry that already exists is not rewritten by
+    other processes compiling the same module.
+
+    If ``max_bytes`` is not None, the least recently used entries are evicted
+    once the entries of the DSL exceed ``max_bytes`` in total, until they fit in
+    ``_EVICTION_WATERMARK`` of it. Recency is tracked by the modification time,
+    which is refreshed on every hit.
+
+    :param dsl_name: The name of the DSL.
+    :type dsl_name: str
+    :param path: The path to the cache directory, defaults to get_default_generated_ir_path(dsl_name)
+    :type path: str, optional
+    :param max_bytes: The maximum total size of the cached files. If None, the cache is unlimited.
+    :type max_bytes: int | None
+    """
+
+    # Fraction of max_bytes retained after an eviction, so that eviction is not run on every store
+    _EVICTION_WATERMARK = 0.9
+    # Age after which temporary directories left behind by interrupted writes are removed
+    _STALE_TEMP_DIR_SECONDS = 3600
+
+    def __init__(
+        self, dsl_name: str, path: str | None = None, max_bytes: int | None = None
+    ):
+        self.dsl_name = dsl_name
+        self._path = path
+        self.max_bytes = max_bytes
+
+    @property
+    def path(self) -> str:
+        """
+        The cache directory, resolved on each access so that changes to the
+        cache directory environment variable take effect.
+        """
+        return self._path or get_default_generated_ir_path(self.dsl_name)
+
+    def file_path(self, key: str) -> Path:
+        """
+        :param key: The module hash.
+        :type key: str
+        :return: The path of the file holding the entry for ``key``.
+        :rtype: Path
+        """
+        return Path(self.path) / f"{self.dsl_name.lower()}_{key}.mlir"
+
+    def load(self, key: str) -> JitCompiledFunction | None:
+        """
+        Load the compiled module for the given key.
+
+        :param key: The module hash.
+        :type key: str
+        :return: The cached function, or None if the key is not in the cache.
+        :rtype: JitCompiledFunction | None
+        """
+        fn = load_cache_from_path(
+            self.dsl_name,
+            key,
+            self.path,
+            bytecode_reader=read_bytecode_and_check_crc32,
+        )
+        if fn is not None:
+            try:
+                os.utime(self.file_path(key))
+            except OSError:
+                # Evicted by another process or a read-only cache; the hit is still valid
+                pass
+        return fn
+
+    def store(self, key: str, jit_function: JitCompiledFunction) -> None:
+        """
+        Store the compiled module of ``jit_function`` for the given key, then
+        evict entries if the cache exceeds its size limit.
+
+        :param key: The module hash.
+        :type key: str
+        :param jit_function: The JitCompiledFunction to store.
+        :type jit_function: JitCompiledFunction
+        """
+        if self.file_path(key).exists():
+            return
+        dump_cache_to_path(
+            self.dsl_name,
+            jit_function,
+            key,
+            self.path,
+            bytecode_writer=lambda f: write_bytecode_with_crc32(
+                f, jit_function.ir_module
+            ),
+        )
+        self.evict()
+
+    def evict(self) -> None:
+        """
+        Remove the least recently used entries while the total size of the
+        entries exceeds the size limit. Temporary directories left behind by
+        interrupted writes are removed once they are stale.
+
+        Files removed concurrently by other processes are skipped.
+        """
+        if self.max_bytes is None or not os.path.isdir(self.path):
+            return
+
+        prefix = f"{self.dsl_name.lower()}_"
+        now = time.time()
+        entries = []
+        total = 0
+        with os.scandir(self.path) as it:
+            for entry in it:
+                try:
+                    if entry.name.startswith(prefix) and entry.name.endswith(".mlir"):
+                        stat = entry.stat()
+                        entries.append((stat.st_mtime, stat.st_size, entry.path))
+                        total += stat.st_size
+                    elif entry.name.startswith("tmp.pid_") and entry.is_dir():
+                        if now - entry.stat().st_mtime > self._STALE_TEMP_DIR_SECONDS:
+                            shutil.rmtree(entry.path, ignore_errors=True)
+                except FileNotFoundError:
+                    continue
+
+        if total <= self.max_bytes:
+            return
+
+        target = self.max_bytes * self._EVICTION_WATERMARK
+        for _, size, file in sorted(entries):
+            if total <= target:
+                break
+            try:
+                os.remove(file)
+                log().info("JIT cache : evicted file=[%s]", file)
+            except FileNotFoundError:
+                pass
+            total -= size
+
+
 class JitCacheDict:
     def __init__(self, max_elems: int | None = None):
         """
@@ -17,10 +17,12 @@ and executes it using MLIR's ExecutionEngine.
 
 from typing import Any
 import collections.abc
+import concurrent.futures
 import os
 import re
 import sys
 import inspect
+import threading
 import types
 from .common import DSLRuntimeError
 from .utils.logger import log
@@ -955,6 +957,24 @@ def _parse_compile_options_from_str(options: str) -> CompileOptions:
     return compile_options
 
 
+_async_compile_executor: "concurrent.futures.ThreadPoolExecutor | None" = None
+_async_compile_executor_lock = threading.Lock()
+
+
+def _get_async_compile_executor() -> "concurrent.futures.ThreadPoolExecutor":
+    """Return the thread on which ``CompileCallable.compile_async`` compiles, creating it on first use.
+
+    A single thread suffices since compilations of a DSL are serialized.
+    """
+    global _async_compile_executor
+    with _async_compile_executor_lock:
+        if _async_compile_executor is None:
+            _async_compile_executor = concurrent.futures.ThreadPoolExecutor(
+                max_workers=1, thread_name_prefix="dsl_async_compile"
+            )
+        return _async_compile_executor
+
+
 class CompileCallable:
     """Compile a ``@cute.jit`` callable into an executable host wrapper.
 
@@ -1020,6 +1040,47 @@ class CompileCallable:
         """
         return self._compile(*args, **kwargs)
 
+    def compile_async(
+        self, func: Any, *args: Any, fallback: Any = None, **kwargs: Any
+    ) -> "AsyncJitCompiledFunction":
+        """Compile ``func`` on a background thread.
+
+        The returned callable runs ``fallback``, typically a generic
+        specialization compiled earlier, until the compilation completes,
+        and the compiled function afterwards. Without a fallback, calls
+        wait for the compilation to complete.
+
+        .. code-block:: python
+
+            generic = cute.compile(gemm, fake_a, fake_b, fake_c, tile=128)
+            gemm_fn = cute.compile.compile_async(
+                gemm, fake_a, fake_b, fake_c, tile=256, fallback=generic
+            )
+            gemm_fn(a, b, c)  # runs ``generic`` while compiling
+
+        Background compilations are run one at a time, and hold the DSL
+        while lowering the IR, so that ``@cute.jit`` functions called
+        meanwhile wait for them. Calls of functions that were already
+        compiled are not affected.
+
+        :param func: The ``@cute.jit`` callable to compile.
+        :param args: Representative compile-time arguments, as for
+            ``cute.compile``. They are retained until the compilation
+            completes.
+        :param fallback: Function called in place of the compiled function
+            until it is ready, defaults to None.
+        :param kwargs: Optional compile controls, as for ``cute.compile``.
+        :return: A callable dispatching to ``fallback`` or the compiled
+            function. Its ``future`` holds the compiled function or the
+            compilation error.
+        """
+        from .jit_executor import AsyncJitCompiledFunction
+
+        future = _get_async_compile_executor().submit(
+            self._compile, func, *args, **kwargs
+        )
+        return AsyncJitCompiledFunction(future, fallback)
+
     def to_precompiled_mlir(self, func: Any, *args: Any, **kwargs: Any) -> Any:
         """Return a PreCompiledMlirArtifact containing the pre-pass MLIR module."""
         kwargs["compile_to_precompiled_mlir"] = True
@@ -1158,19 +1219,22 @@ class CompileCallable:
             compile_options = _parse_compile_options_from_str(options)
         else:
             compile_options = self._compile_options
-        func._dsl_object.compile_options = compile_options
-
-        # Preprocess the function if not already preprocessed
-        func._dsl_object._preprocess_and_replace_code(func)
-
-        # Route based on DeviceTarget option: compiles as __device__ function.
-        if compile_options.options[DeviceTarget].value:
-            # Device functions are always relocatable objects.
-            compile_options.options[RDC].value = True
-            # Force artifact dumping so .o and .ptx are available after compilation.
-            compile_options.options[KeepPTX].value = True
-            compile_options.options[KeepCUBIN].value = True
-            return func._dsl_object._device_func(func, *args, **kwargs)
-
-        # Default: host wrapper + kernel
-        return func._dsl_object._func(func, *args, **kwargs)
+
+        # The compile options are held by the DSL until the compilation completes
+        with func._dsl_object.compile_lock:
+            func._dsl_object.compile_options = compile_options
+
+            # Preprocess the function if not already preprocessed
+            func._dsl_object._preprocess_and_replace_code(func)
+
+            # Route based on DeviceTarget option: compiles as __device__ function.
+            if compile_options.options[DeviceTarget].value:
+                # Device functions are always relocatable objects.
+                compile_options.options[RDC].value = True
+                # Force artifact dumping so .o and .ptx are available after compilation.
+                compile_options.options[KeepPTX].value = True
+                compile_options.options[KeepCUBIN].value = True
+                return func._dsl_object._device_func(func, *args, **kwargs)
+
+            # Default: host wrapper + kernel
+            return func._dsl_object._func(func, *args, **kwargs)
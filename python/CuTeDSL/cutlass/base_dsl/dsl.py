@@ -694,6 +694,13 @@ class BaseDSL(metaclass=DSLSingletonMeta):
         self.jit_cache: JitCacheDict = JitCacheDict(
             max_elems=self.envar.jit_cache_max_elems
         )
+        # Serializes IR generation and compilation, which mutate the state of this DSL,
+        # between the calling thread and background compilations
+        self.compile_lock: threading.RLock = threading.RLock()
+        # On-disk cache shared across processes, consulted on in-memory cache misses
+        self.file_cache: FileJitCache = FileJitCache(
+            self.name, max_bytes=self.envar.file_cache_max_bytes
+        )
 
         self.host_jit_decorator_name: str = f"@{BaseDSL.jit.__name__}"
         self.device_jit_decorator_name: str = f"@{BaseDSL.kernel.__name__}"
@@ -1752,17 +1759,19 @@ class BaseDSL(metaclass=DSLSingletonMeta):
             compile_gpu_arch,  # type: ignore[arg-type]
         )
         shared_libs = self.get_shared_libs()
-        # try load the file cache
+        cached_jit_func = None if no_cache else self.jit_cache.get(module_hash)
+
+        # try load the file cache if the compiled module is not in memory
         load_from_file_cache = False
-        if not no_cache:
-            fn = load_cache_from_path(
-                self.name, module_hash, bytecode_reader=read_bytecode_and_check_crc32
-            )
+        if (
+            not no_cache
+            and (cached_jit_func is None or cached_jit_func.ir_module is None)
+        ):
+            fn = self.file_cache.load(module_hash)
             if fn is not None:
                 load_from_file_cache = True
                 self.jit_cache.set(module_hash, fn, funcBody=funcBody)
-
-        cached_jit_func = None if no_cache else self.jit_cache.get(module_hash)
+                cached_jit_func = fn
 
         if no_cache or cached_jit_func is None or cached_jit_func.ir_module is None:
             if self.envar.jit_time_profiling:
@@ -1850,14 +1859,7 @@ class BaseDSL(metaclass=DSLSingletonMeta):
             self.jit_cache.set(module_hash, fn, funcBody=funcBody)
             # write through the file cache if enabled.
             if not self.envar.disable_file_caching and not load_from_file_cache:
-                dump_cache_to_path(
-                    self.name,
-                    fn,
-                    module_hash,
-                    bytecode_writer=lambda f: write_bytecode_with_crc32(
-                        f, fn.ir_module
-                    ),
-                )
+                self.file_cache.store(module_hash, fn)
 
         return fn
 
@@ -2370,23 +2372,24 @@ class BaseDSL(metaclass=DSLSingletonMeta):
         elif ir.InsertionPoint.current is not None:
             return funcBody(*args, **kwargs)
 
-        setup = self._prepare_compilation(funcBody, *args, **kwargs)
-
-        log().debug(f"Generating MLIR for function '{setup.function_name}'")
-        result = self.generate_mlir(
-            funcBody,
-            setup.function_name,
-            setup.gpu_module_attrs,
-            setup.canonicalized_args,
-            setup.canonicalized_kwargs,
-            setup.sig,
-            setup.pipeline,
-            setup.no_cache,
-            setup.no_jit_engine,
-            setup.compile_only,
-            location=setup.location,
-            compile_to_precompiled_mlir=setup.compile_to_precompiled_mlir,
-        )
+        with self.compile_lock:
+            setup = self._prepare_compilation(funcBody, *args, **kwargs)
+
+            log().debug(f"Generating MLIR for function '{setup.function_name}'")
+            result = self.generate_mlir(
+                funcBody,
+                setup.function_name,
+                setup.gpu_module_attrs,
+                setup.canonicalized_args,
+                setup.canonicalized_kwargs,
+                setup.sig,
+                setup.pipeline,
+                setup.no_cache,
+                setup.no_jit_engine,
+                setup.compile_only,
+                location=setup.location,
+                compile_to_precompiled_mlir=setup.compile_to_precompiled_mlir,
+            )
         return result
 
     class _KernelGenHelper(ABC):
@@ -461,6 +461,7 @@ class EnvironmentVarManager(LogEnvironmentManager):
     - [DSL_NAME]_JIT_CACHE_MAX_ELEMS: Maximum number of JIT compiled functions to cache in memory (default: None). If None, the cache is unbounded.
     - [DSL_NAME]_NO_CACHE: Disable JIT cache (default: False)
     - [DSL_NAME]_DISABLE_FILE_CACHING: Disable file caching (default: False)
+    - [DSL_NAME]_FILE_CACHE_MAX_BYTES: Maximum total size in bytes of the file cache, beyond which the least recently used files are evicted (default: None). If None, the file cache is unbounded.
     - [DSL_NAME]_LIBS: Path to dependent shared libraries (default: None)
     - [DSL_NAME]_ENABLE_TVM_FFI: Enable TVM-FFI or not (default: False)
     - [DSL_NAME]_LOC_TRACEBACKS: Maximum depth of location tracebacks (default: 0)
@@ -551,6 +552,9 @@ class EnvironmentVarManager(LogEnvironmentManager):
         self.disable_file_caching = get_bool_env_var(
             f"{prefix}_DISABLE_FILE_CACHING", False
         )
+        self.file_cache_max_bytes = get_int_or_none_env_var(
+            f"{prefix}_FILE_CACHE_MAX_BYTES", None
+        )
         self.compiler_opt = get_str_env_var(f"{prefix}_COMPILER_OPT", "")
 
         # set mlir shared libraries
@@ -14,6 +14,7 @@ from .export import (
     get_export_module,
     encode_metadata_into_ir_module,
     decode_metadata_from_execution_engine,
+    export_family_to_c,
 )
 
 from .export import SignatureProcessor
@@ -25,6 +26,7 @@ __all__ = [
     "get_export_module",
     "encode_metadata_into_ir_module",
     "decode_metadata_from_execution_engine",
+    "export_family_to_c",
     "SignatureProcessor",
     "ExternalBinaryModule",
     "LoadProvider",
@@ -35,6 +35,7 @@ from ..._mlir import ir
 from dataclasses import dataclass
 from typing import Any, Union, get_origin, get_args
 import inspect
+import re
 from inspect import isclass
 import cuda.bindings.driver as cuda
 
@@ -457,6 +458,86 @@ extern const unsigned char {varname}[];
 """
         return binary
 
+    @staticmethod
+    def _split_c_argument(argument: str) -> tuple[str, str]:
+        """
+        Split a generated C argument such as ``gemm_Tensor_a_t *a`` into its type and name.
+        """
+        name = re.search(r"[A-Za-z_]\w*$", argument)
+        if name is None:
+            raise DSLRuntimeError(f"Cannot find the name of the C argument: {argument}")
+        return argument[: name.start()].strip(), name.group()
+
+    def generate_family_dispatch(
+        self,
+        dsl_name: str,
+        function_prefix: str,
+        symbol_prefixes: list[str],
+        arguments: list[list[str]],
+        conditions: list[str | None],
+    ) -> str:
+        """
+        Generate the module and dispatch function of a family of exported functions sharing the same C signature.
+        The dispatch function calls the wrapper of the first function whose condition holds and returns its index,
+        or -1 if no condition holds. The conditions are C expressions over the arguments of the dispatch function.
+        """
+        module_fields = "\n    ".join(
+            f"{prefix}_Kernel_Module_t variant_{i};"
+            for i, prefix in enumerate(symbol_prefixes)
+        )
+        module_loads = "\n    ".join(
+            f"{prefix}_Kernel_Module_Load(&module->variant_{i});"
+            for i, prefix in enumerate(symbol_prefixes)
+        )
+        module_unloads = "\n    ".join(
+            f"{prefix}_Kernel_Module_Unload(&module->variant_{i});"
+            for i, prefix in enumerate(symbol_prefixes)
+        )
+
+        # The arguments of the family are those of its first function. The arguments of the other
+        # functions only differ by their prefix, so pointers to their declarations are casted.
+        family_arguments = [self._split_c_argument(arg) for arg in arguments[0]]
+        branches = []
+        for i, (prefix, variant_arguments, condition) in enumerate(
+            zip(symbol_prefixes, arguments, conditions)
+        ):
+            call_args = [f"&module->variant_{i}"]
+            for (family_type, name), variant_argument in zip(
+                family_arguments, variant_arguments
+            ):
+                variant_type, _ = self._split_c_argument(variant_argument)
+                call_args.append(
+                    name if variant_type == family_type else f"({variant_type}){name}"
+                )
+            call = f"(void){dsl_name.lower()}_{prefix}_wrapper({', '.join(call_args)});"
+            if condition:
+                branches.append(
+                    f"if ({condition}) {{\n        {call}\n        return {i};\n    }}"
+                )
+            else:
+                branches.append(f"{call}\n    return {i};")
+        if conditions[-1]:
+            branches.append("return -1;")
+        branches_str = "\n    ".join(branches)
+
+        return f"""
+typedef struct {{
+    {module_fields}
+}} {function_prefix}_Family_Module_t;
+
+static inline void {function_prefix}_Family_Module_Load({function_prefix}_Family_Module_t *module) {{
+    {module_loads}
+}}
+
+static inline void {function_prefix}_Family_Module_Unload({function_prefix}_Family_Module_t *module) {{
+    {module_unloads}
+}}
+
+static inline int32_t {dsl_name.lower()}_{function_prefix}_dispatch({function_prefix}_Family_Module_t *module, {", ".join(arguments[0])}) {{
+    {branches_str}
+}}
+"""
+
     def __call__(
         self,
         symbol_prefix: str,
@@ -240,3 +240,122 @@ def decode_metadata_from_execution_engine(
     kernel_info = json.loads(kernel_info_str)  # type: ignore[arg-type]
 
     return args_spec, function_name, kernel_info, version_str
+
+
+def export_family_to_c(
+    functions: "list[tuple[JitCompiledFunction, str | None]]",  # type: ignore[name-defined]
+    file_path: str,
+    file_name: str,
+    function_prefix: str = "",
+) -> None:
+    """Export a family of jit-compiled functions, e.g. the specializations of a kernel for different
+    tile configurations, with a C dispatch function selecting the specialization at runtime.
+
+    All functions must have the same C signature, i.e. the same arguments with the same dynamic
+    shapes and strides. Each function is given with a condition, a C boolean expression over the
+    arguments, e.g. ``a->dynamic_shapes[0] >= 4096``. The dispatch function calls the first function
+    whose condition holds and returns its index, or -1 if no condition holds. The condition of the
+    last function may be None to make it the default.
+
+    The following files are generated:
+    1. ``{file_name}.h``: The header of all functions, followed by the family module
+       ``{function_prefix}_Family_Module_t`` with its load/unload functions, and the dispatch function
+       ``{dsl_name}_{function_prefix}_dispatch``.
+    2. ``{file_name}_{i}.o``: The object file of the i-th function, with the symbol prefix
+       ``{function_prefix}_{i}``. All object files are meant to be linked into a single library, e.g.
+       ``g++ -shared -o lib{file_name}.so {file_name}_*.o``.
+
+    @param functions: The jit-compiled functions with their dispatch conditions, in dispatch order.
+    @param file_path: The path to the directory where the header and object files will be saved.
+    @param file_name: The name of the header and the base name of the object files.
+    @param function_prefix: The prefix of the family. Default to the `file_name`.
+    """
+    if not functions:
+        raise DSLRuntimeError("Cannot export an empty family of functions.")
+    if function_prefix is None or function_prefix == "":
+        function_prefix = file_name
+
+    conditions = [condition for _, condition in functions]
+    for idx, condition in enumerate(conditions[:-1]):
+        if not condition:
+            raise DSLRuntimeError(
+                f"Only the last function of a family may have no condition, but function #{idx} has none."
+            )
+
+    first_function = functions[0][0]
+    export_provider = first_function.export_provider
+    assert export_provider is not None, (
+        "Export provider is not set for JitCompiledFunction."
+    )
+    assert export_provider.c_header_generator is not None
+    assert export_provider.dsl is not None
+    c_header_generator = export_provider.c_header_generator
+    dsl_name = export_provider.dsl._get_dsl().name
+
+    def get_c_header_arguments(idx: int, jit_function: Any) -> Any:
+        c_header_arguments = jit_function.c_header_arguments
+        if not c_header_arguments:
+            raise DSLRuntimeError(
+                f"Error generating c header arguments of function #{idx}: {c_header_arguments}"
+            )
+        if len(jit_function.kernel_info) == 0:
+            raise DSLRuntimeError(
+                f"Function #{idx} of the family does not launch any kernel."
+            )
+        return c_header_arguments
+
+    first_arguments = get_c_header_arguments(0, first_function)
+    headers = []
+    symbol_prefixes = []
+    arguments = []
+    for idx, (jit_function, _) in enumerate(functions):
+        c_header_arguments = get_c_header_arguments(idx, jit_function)
+        if (
+            c_header_arguments.arguments != first_arguments.arguments
+            or c_header_arguments.declarations != first_arguments.declarations
+        ):
+            raise DSLRuntimeError(
+                f"Function #{idx} of the family has a different C signature than function #0: "
+                f"{c_header_arguments.arguments} vs {first_arguments.arguments}"
+            )
+
+        symbol_prefix = f"{function_prefix}_{idx}"
+        export_module = get_export_module(jit_function.ir_module, symbol_prefix)
+        header = c_header_generator(
+            symbol_prefix,
+            export_module,
+            jit_function.execution_args,
+            jit_function.function_name,
+            jit_function.kernel_info,
+            c_header_arguments,
+            dsl_name,
+        )
+        # Only keep the includes of the first header
+        if idx > 0 and header.startswith(c_header_generator.includes):
+            header = header[len(c_header_generator.includes) :]
+        headers.append(header)
+        symbol_prefixes.append(symbol_prefix)
+        arguments.append(
+            [
+                arg.replace(c_header_arguments.dummy_prefix_name, symbol_prefix)
+                for arg in c_header_arguments.arguments
+            ]
+        )
+
+        object_file_content = jit_function.dump_to_object(symbol_prefix)
+        try:
+            with open(os.path.join(file_path, f"{file_name}_{idx}.o"), "wb") as f:
+                f.write(object_file_content)
+        except Exception as e:
+            raise DSLRuntimeError(f"Error writing object file: {e}") from e
+
+    headers.append(
+        c_header_generator.generate_family_dispatch(
+            dsl_name, function_prefix, symbol_prefixes, arguments, conditions
+        )
+    )
+    try:
+        with open(os.path.join(file_path, file_name + ".h"), "w") as f:
+            f.write("".join(headers))
+    except Exception as e:
+        raise DSLRuntimeError(f"Error writing header file: {e}") from e
@@ -370,6 +370,31 @@ class ExecutionArgs:
 
         return exe_args, adapted_args
 
+    def get_arg_c_pointers(self, index: int, arg: Any) -> tuple[list[Any], Any]:
+        """
+        Convert a single runtime argument to its C pointers, as done for each
+        argument by `generate_execution_args`. This is used to repack one
+        argument of a `BoundJitLauncher` without converting the others.
+
+        :param index: The index of the argument in the runtime signature.
+        :param arg: The argument value.
+        :return: The C pointers of the argument and the adapted argument, which
+            must be kept alive while the pointers are used, or None.
+        """
+        cptr_method = getattr(arg, "__c_pointers__", None)
+        if cptr_method is not None:
+            return cptr_method(), None
+
+        if self._meta.numeric_flags[index]:
+            arg = t.cast(arg, self._meta.annotated_types[index])  # type: ignore[arg-type]
+            return get_c_pointers(arg), arg
+
+        adapter = JitArgAdapterRegistry.get_registered_adapter(arg)
+        if adapter is None:
+            return get_c_pointers(arg), None
+        arg = adapter(arg)
+        return get_c_pointers(arg), arg
+
     def get_kwargs_wrapper_spec(
         self, exclude_arg_names: Sequence[str] = ()
     ) -> KwargsWrapperSpec:
@@ -709,6 +734,116 @@ class JitExecutor:
         exe_args, adapted_args = self.generate_execution_args(*args, **kwargs)
         return self.run_compiled_program(exe_args)
 
+    def bind(self, *args: Any, **kwargs: Any) -> "BoundJitLauncher":
+        """Bind the arguments of this executor for repeated low-overhead launches.
+
+        :return: A launcher of this executor with the given arguments.
+        :rtype: BoundJitLauncher
+        """
+        return BoundJitLauncher(self, args, kwargs)
+
+
+class BoundJitLauncher:
+    """Launches a compiled function with arguments bound once.
+
+    The arguments are rectified against the signature, converted to their C
+    pointers, and packed when the launcher is created. Launches reuse the
+    packed arguments, and replacing an argument, such as a tensor or the
+    stream, converts and repacks only that argument. A launch thus costs a
+    single call of the compiled function.
+
+    .. code-block:: python
+
+        compiled = cute.compile(decode, q, k, v, o, stream)
+        launch = compiled.bind(q, k, v, o, stream)
+        launch()                      # launches with the bound arguments
+        launch(q=q_next, o=o_next)    # replaces q and o, then launches
+
+    Replacement arguments must have the same type as the bound ones and
+    convert to the same number of C pointers. The launcher keeps the bound
+    arguments alive.
+
+    :param executor: The executor to launch.
+    :type executor: JitExecutor
+    :param args: The positional runtime arguments.
+    :param kwargs: The keyword runtime arguments.
+    """
+
+    def __init__(
+        self, executor: JitExecutor, args: tuple[Any, ...], kwargs: dict[str, Any]
+    ) -> None:
+        self._executor = executor
+        self._execution_args = executor.jit_module.execution_args
+        self._args = self._execution_args.get_rectified_args(args, kwargs)
+
+        exe_args = []
+        self._adapted_args = []
+        self._slots: list[tuple[int, int]] = []
+        for index, arg in enumerate(self._args):
+            chunk, adapted = self._execution_args.get_arg_c_pointers(index, arg)
+            self._slots.append((len(exe_args), len(chunk)))
+            self._adapted_args.append(adapted)
+            exe_args.extend(chunk)
+
+        # Copy out of the thread-local buffer shared with other calls of the executor
+        packed_args = executor._get_invoke_packed_args(exe_args)
+        total_args = len(exe_args) + executor._num_extra_args
+        self._packed_args = (ctypes.c_void_p * total_args)(*packed_args[:total_args])
+
+    def set_arg(self, name: str | int, value: Any) -> None:
+        """Replace one bound argument without launching.
+
+        :param name: The name or index of the argument in the runtime signature.
+        :param value: The new value of the argument.
+        :raises DSLRuntimeError: If the argument is unknown or converts to a
+            different number of C pointers than the bound one.
+        """
+        meta = self._execution_args._meta
+        index = name if isinstance(name, int) else meta.name_to_index.get(name)
+        if index is None or not 0 <= index < meta.arg_count:
+            raise DSLRuntimeError(
+                "unexpected argument for bound launcher",
+                context={"argument": name},
+            )
+
+        chunk, adapted = self._execution_args.get_arg_c_pointers(index, value)
+        start, count = self._slots[index]
+        if len(chunk) != count:
+            raise DSLRuntimeError(
+                "replacement argument does not match the bound argument",
+                context={
+                    "argument": meta.all_names[index],
+                    "bound pointer count": count,
+                    "replacement pointer count": len(chunk),
+                },
+            )
+        for offset, ptr in enumerate(chunk):
+            self._packed_args[start + offset] = (
+                ptr if type(ptr) is ctypes.c_void_p else ctypes.c_void_p(ptr).value
+            )
+        self._args[index] = value
+        self._adapted_args[index] = adapted
+
+    def __call__(self, **kwargs: Any) -> int | None:
+        """Launch with the bound arguments, replacing those given by name first.
+
+        :return: The CUDA result code if the function returns one, None otherwise.
+        """
+        for name, value in kwargs.items():
+            self.set_arg(name, value)
+
+        executor = self._executor
+        try:
+            executor.capi_func(self._packed_args)
+        except Exception as e:
+            raise DSLRuntimeError(f"💥💥💥 Runtime Crash 💥💥💥", cause=e)
+        if not executor._has_cuda_result:
+            return None
+        error_code = executor.cuda_result.value  # type: ignore[union-attr]
+        if error_code == 0:
+            return error_code
+        raise create_cuda_runtime_error(error_code)
+
 
 @dataclass
 class JitFunctionArtifacts:
@@ -1003,6 +1138,10 @@ class JitCompiledFunction:
         CUDA errors. If you need to call the kernel on multiple devices use `to`
         to return a per-device function.
         """
+        return self._get_default_executor().run_compiled_program(exe_args)
+
+    def _get_default_executor(self) -> JitExecutor:
+        """Returns the executor for the current device, creating it on first use."""
         with self._executor_lock:
             if self._default_executor is None:
                 log().debug("Creating default executor.")
@@ -1011,7 +1150,18 @@ class JitCompiledFunction:
                 proxy_self = weakref.proxy(self)
                 self._default_executor = proxy_self.to(None)
         assert self._default_executor is not None
-        return self._default_executor.run_compiled_program(exe_args)
+        return self._default_executor
+
+    def bind(self, *args: Any, **kwargs: Any) -> "BoundJitLauncher":
+        """Bind runtime arguments for repeated launches that skip argument processing.
+
+        The launcher runs under the currently active CUDA context, like calls
+        of this function. Use `to` followed by `JitExecutor.bind` for other devices.
+
+        :return: A launcher of this function with the given arguments.
+        :rtype: BoundJitLauncher
+        """
+        return self._get_default_executor().bind(*args, **kwargs)
 
     def _generate_c_header_arguments(
         self,
@@ -1212,3 +1362,52 @@ class JitCompiledFunction:
                 f.write(object_file_content)
         except Exception as e:
             raise DSLRuntimeError(f"Error writing object file: {e}") from e
+
+
+class AsyncJitCompiledFunction:
+    """Dispatches to a fallback function until a background compilation completes.
+
+    Returned by ``cute.compile.compile_async``. Once the compilation succeeds,
+    the compiled ``JitCompiledFunction`` replaces the fallback for all later
+    calls. If it fails, calls raise the compilation error instead.
+
+    :param future: Future holding the compiled function.
+    :type future: concurrent.futures.Future
+    :param fallback: Function called until the compiled function is ready. If None,
+        calls wait for the compilation to complete.
+    :type fallback: Callable, optional
+    """
+
+    def __init__(self, future: Any, fallback: Callable[..., Any] | None = None) -> None:
+        self.future = future
+        self.fallback = fallback
+        self._compiled: JitCompiledFunction | None = None
+
+    @property
+    def ready(self) -> bool:
+        """Whether the compilation has completed, successfully or not."""
+        return self._compiled is not None or self.future.done()
+
+    def result(self, timeout: float | None = None) -> JitCompiledFunction:
+        """Wait for the compilation to complete and return the compiled function.
+
+        :param timeout: Maximum number of seconds to wait, defaults to waiting indefinitely.
+        :type timeout: float, optional
+        :raises TimeoutError: If the compilation does not complete in time.
+        :return: The compiled function.
+        :rtype: JitCompiledFunction
+        """
+        if self._compiled is None:
+            # Raises the compilation error, if any
+            self._compiled = self.future.result(timeout)
+        return self._compiled
+
+    def __call__(self, *args: Any, **kwargs: Any) -> Any:
+        """Call the compiled function if it is ready, or the fallback otherwise."""
+        compiled = self._compiled
+        if compiled is None:
+            if self.fallback is not None and not self.future.done():
+                return self.fallback(*args, **kwargs)
+            compiled = self.result()
+            log().info("Switching to asynchronously compiled function")
+        return compiled(*args, **kwargs)
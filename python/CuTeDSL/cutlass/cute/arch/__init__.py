@@ -119,6 +119,7 @@ __all__ = [
     "nsmid",
     "clock",
     "clock64",
+    "globaltimer",
     "match_sync",
     "clz",
     "bfind",
@@ -3447,6 +3447,25 @@ def clock64(
     return Int64(nvvm.read_ptx_sreg_clock64(T.i64(), loc=loc, ip=ip))
 
 
+@dsl_user_op
+def globaltimer(
+    *, loc: Optional[ir.Location] = None, ip: Optional[ir.InsertionPoint] = None
+) -> Int64:
+    """
+    Returns the 64-bit global nanosecond timer value.
+
+    Unlike clock64(), the global timer is shared by all SMs of the device, so
+    its values can be compared across CTAs. Its resolution is implementation
+    defined and usually coarser than the one of clock64().
+
+    See https://docs.nvidia.com/cuda/parallel-thread-execution/#special-registers-globaltimer
+
+    :return: 64-bit global timer value in nanoseconds
+    :rtype: Int64
+    """
+    return Int64(nvvm.read_ptx_sreg_globaltimer(T.i64(), loc=loc, ip=ip))
+
+
 @dsl_user_op
 def match_sync(
     mask: Union[int, Int32, Uint32, Int64, Uint64],
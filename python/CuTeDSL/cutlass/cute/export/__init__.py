@@ -29,6 +29,7 @@ _CudaDialectJitCompiledFunction.export_provider = _ExportProvider(
     mlirExecutionEngine=_mlirExecutionEngine,
 )
 
+from ...base_dsl.export import export_family_to_c
 from ...base_dsl.export import ExternalBinaryModule as _ExternalBinaryModule
 from ...base_dsl.export import LoadProvider as _LoadProvider
 from .load import version_checker as _version_checker
@@ -46,4 +47,5 @@ _ExternalBinaryModule.load_provider = _LoadProvider(
 
 __all__ = [
     "CuteCHeaderGenerator",
+    "export_family_to_c",
 ]
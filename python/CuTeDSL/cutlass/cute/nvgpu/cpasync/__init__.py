@@ -42,6 +42,7 @@ __all__ = [
     "copy_tensormap",
     "update_tma_descriptor",
     "fence_tma_desc_acquire",
+    "prefetch_tma_desc",
     "cp_fence_tma_desc_release",
     "fence_tma_desc_release",
     "group_bulk_copy_modes",
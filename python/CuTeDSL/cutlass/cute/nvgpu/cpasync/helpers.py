@@ -823,6 +823,35 @@ def fence_tma_desc_acquire(
     )
 
 
+@dsl_user_op
+def prefetch_tma_desc(
+    tma_desc_ptr: Pointer,
+    *,
+    loc: Optional[ir.Location] = None,
+    ip: Optional[ir.InsertionPoint] = None,
+) -> None:
+    """
+    Prefetches the TMA descriptor in global memory pointed to by the provided pointer into the
+    tensormap cache. Unlike ``prefetch_descriptor``, the descriptor need not be held by a TMA Atom.
+
+    See the `PTX documentation <https://docs.nvidia.com/cuda/parallel-thread-execution/#data-movement-and-conversion-instructions-prefetch-prefetchu>`__.
+    """
+    tma_desc_ptr_i64 = (
+        cast(Any, tma_desc_ptr).toint(loc=loc, ip=ip).ir_value(loc=loc, ip=ip)
+    )
+    llvm.inline_asm(
+        None,
+        [tma_desc_ptr_i64],
+        "prefetch.tensormap [$0];",
+        "l",
+        has_side_effects=True,
+        is_align_stack=False,
+        asm_dialect=llvm.AsmDialect.AD_ATT,
+        loc=loc,
+        ip=ip,
+    )
+
+
 @dsl_user_op
 def cp_fence_tma_desc_release(
     tma_desc_global_ptr: Pointer,
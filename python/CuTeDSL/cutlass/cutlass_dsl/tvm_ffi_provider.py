@@ -523,6 +523,16 @@ class TVMFFIJitCompiledFunctionBase(CudaDialectJitCompiledFunction):
         """Run the compiled program. This override is needed for implicit compile and execution."""
         return cast(int | None, self.__call__(*exe_args))  # type: ignore[misc]
 
+    def bind(self, *args: Any, **kwargs: Any) -> "TVMFFIBoundLauncher":
+        """Bind runtime arguments for repeated launches.
+
+        TVM FFI functions convert their arguments in C++, so the launcher only
+        avoids rectifying keyword and default arguments on each call.
+        """
+        return TVMFFIBoundLauncher(
+            self, self.execution_args.get_rectified_args(args, kwargs)
+        )
+
     def export_to_c(  # type: ignore[override]
         self,
         object_file_path: str,
@@ -598,6 +608,45 @@ class TVMFFIJitCompiledFunctionBase(CudaDialectJitCompiledFunction):
         return None
 
 
+class TVMFFIBoundLauncher:
+    """Launches a TVM FFI function with its arguments rectified once.
+
+    This mirrors ``BoundJitLauncher`` for functions compiled with TVM FFI
+    enabled. Launches from C++ need no launcher: the ``tvm_ffi.Function`` of
+    the compiled function (the function itself, or ``__tvm_ffi_object__()``
+    when keyword arguments are supported) can be passed to C++ and called
+    there with the runtime arguments directly.
+
+    :param function: The compiled function.
+    :param args: The rectified positional runtime arguments.
+    """
+
+    def __init__(self, function: TVMFFIJitCompiledFunctionBase, args: List[Any]):
+        self._function = function
+        self._args = args
+
+    def set_arg(self, name: "str | int", value: Any) -> None:
+        """Replace one bound argument without launching.
+
+        :param name: The name or index of the argument in the runtime signature.
+        :param value: The new value of the argument.
+        """
+        meta = self._function.execution_args._meta
+        index = name if isinstance(name, int) else meta.name_to_index.get(name)
+        if index is None or not 0 <= index < meta.arg_count:
+            raise DSLRuntimeError(
+                "unexpected argument for bound launcher",
+                context={"argument": name},
+            )
+        self._args[index] = value
+
+    def __call__(self, **kwargs: Any) -> Any:
+        """Launch with the bound arguments, replacing those given by name first."""
+        for name, value in kwargs.items():
+            self.set_arg(name, value)
+        return self._function(*self._args)
+
+
 class TVMFFIJitCompiledFunction(tvm_ffi.Function, TVMFFIJitCompiledFunctionBase):
     """TVM FFI Function that directly subclasses the tvm_ffi.Function for pos only arguments."""
 
@@ -58,6 +58,7 @@ if is_available():
         JaxArray,
         TensorSpec,
     )
+    from .sharding import ShardingRule
     from .compile import (
         release_compile_cache,
     )
@@ -84,6 +85,7 @@ if is_available():
         "JaxArray",
         "TensorSpec",
         "TensorMode",
+        "ShardingRule",
         "release_compile_cache",
         "get_export_disabled_safety_checks",
         "is_ffi_registered",
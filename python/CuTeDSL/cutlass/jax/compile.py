@@ -228,6 +228,10 @@ def get_or_compile_kernel(fn: Callable[..., None], spec: FunctionSpec) -> Compil
     # the above check in compile cache,
     compiled_fn = None
     with _compile_lock:
+        # Another thread may have compiled the same kernel while we waited, e.g. when
+        # the shards of a partitioned call are lowered concurrently.
+        if cache_key in _CUTLASS_COMPILE_CACHE:
+            return _CUTLASS_COMPILE_CACHE[cache_key]
         start = time.time()
         try:
             cute_compile = cutlass.cute.compile
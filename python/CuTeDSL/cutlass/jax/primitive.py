@@ -10,6 +10,7 @@
 # is strictly prohibited.
 
 from typing import Any, Sequence, Callable
+from functools import partial
 import logging
 
 
@@ -27,6 +28,7 @@ from .types import (
     TensorSpec,
 )
 from .ffi import get_cutlass_call_ffi_name, is_ffi_registered, register_ffi
+from .sharding import ShardingRule
 
 
 logger = logging.getLogger(__name__)
@@ -47,6 +49,7 @@ def cutlass_call(
     allow_cuda_graph: bool = True,
     compile_options: str | None = None,
     use_static_tensors: bool = False,
+    sharding_rule: str | ShardingRule | None = None,
     **kwargs: Any,
 ) -> Callable[..., Any]:
     """Create a callable that invokes a ``@cute.jit`` function from JAX.
@@ -96,6 +99,12 @@ def cutlass_call(
         use_static_tensors: If ``True``, tensor shapes and strides are baked in
             as compile-time constants, improving performance when shapes are
             fixed across calls.  Defaults to ``False``.
+        sharding_rule: A :class:`ShardingRule` or its rule string, e.g.
+            ``"m k, k n -> m n"``, declaring how operand and result dimensions
+            are partitioned. When set, sharded operands under ``jax.jit`` are not
+            gathered: the kernel is compiled for the per-shard shapes and runs on
+            each shard. ``None`` leaves partitioning to XLA, which replicates the
+            operands.
         **kwargs: Additional keyword arguments forwarded to *fn* as compile-time
             constants.
 
@@ -130,6 +139,9 @@ def cutlass_call(
     if output_mode:
         output_spec = output_mode
 
+    if isinstance(sharding_rule, str):
+        sharding_rule = ShardingRule(sharding_rule)
+
     return _cutlass_call_impl(
         fn,
         output_shape_dtype=output_shape_dtype,
@@ -139,6 +151,7 @@ def cutlass_call(
         allow_cuda_graph=allow_cuda_graph,
         compile_options=compile_options,
         use_static_tensors=use_static_tensors,
+        sharding_rule=sharding_rule,
         **kwargs,
     )
 
@@ -233,6 +246,7 @@ def _cutlass_call_impl(
     allow_cuda_graph: bool,
     compile_options: str | None,
     use_static_tensors: bool,
+    sharding_rule: ShardingRule | None = None,
     **kwargs: Any,
 ) -> Callable[..., Any]:
     # A single ShapeDtypeStruct means one output; a sequence means multiple.
@@ -251,20 +265,31 @@ def _cutlass_call_impl(
         _validate_specs("Input", args_flat, input_spec_flat)
         _validate_specs("Output", output_shape_dtype_flat, output_spec_flat)
 
-        output_flat = cutlass_call_inner_p.bind(
-            *args_flat,
-            fn=fn,
-            args_tree=args_tree,
-            output_shape_dtype_flat=tuple(output_shape_dtype_flat),
-            output_tree=output_tree,
-            input_spec_flat=input_spec_flat,
-            output_spec_flat=output_spec_flat,
-            input_output_aliases=tuple(input_output_aliases.items()),
-            allow_cuda_graph=allow_cuda_graph,
-            compile_options=compile_options,
-            use_static_tensors=use_static_tensors,
-            **kwargs,
-        )
+        def make_call(
+            output_shape_dtype_flat: tuple[jax.ShapeDtypeStruct, ...],
+        ) -> Callable[..., Any]:
+            return partial(
+                cutlass_call_inner_p.bind,
+                fn=fn,
+                args_tree=args_tree,
+                output_shape_dtype_flat=output_shape_dtype_flat,
+                output_tree=output_tree,
+                input_spec_flat=input_spec_flat,
+                output_spec_flat=output_spec_flat,
+                input_output_aliases=tuple(input_output_aliases.items()),
+                allow_cuda_graph=allow_cuda_graph,
+                compile_options=compile_options,
+                use_static_tensors=use_static_tensors,
+                **kwargs,
+            )
+
+        if sharding_rule is None:
+            output_flat = make_call(tuple(output_shape_dtype_flat))(*args_flat)
+        else:
+            sharding_rule.validate(args_flat, output_shape_dtype_flat)
+            output_flat = sharding_rule.partitioned_call(
+                make_call, tuple(output_shape_dtype_flat)
+            )(*args_flat)
 
         output = jax.tree.unflatten(output_tree, output_flat)
         return output if multiple_results else output[0]
@@ -0,0 +1,164 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+#
+# Use of this software is governed by the terms and conditions of the
+# NVIDIA End User License Agreement (EULA), available at:
+# https://docs.nvidia.com/cutlass/latest/media/docs/pythonDSL/license.html
+#
+# Any use, reproduction, disclosure, or distribution of this software
+# and related documentation outside the scope permitted by the EULA
+# is strictly prohibited.
+
+from typing import Any, Callable, Sequence
+from dataclasses import dataclass, field
+import math
+
+import jax
+from jax.sharding import NamedSharding, PartitionSpec
+from jax.experimental.custom_partitioning import custom_partitioning
+
+
+@dataclass(frozen=True)
+class ShardingRule:
+    """Declares how the dimensions of a ``cutlass_call`` map between its operands and results.
+
+    The rule uses an einsum-like notation with one space-separated factor name per
+    dimension, commas between tensors, and ``->`` between operands and results.
+    For example, a GEMM ``D = A @ B`` with ``A: (m, k)``, ``B: (k, n)``, and
+    ``D: (m, n)`` is declared as::
+
+        ShardingRule("m k, k n -> m n")
+
+    Dimensions sharing a factor name are partitioned identically. Factors that
+    appear in the results are partitioned along the mesh axes of the operands, so
+    the kernel runs on each shard without an all-gather. Factors that appear only in
+    the operands, such as ``k`` above, are replicated since partial results would
+    require a reduction across shards. A dimension that must never be partitioned
+    is declared with a unique name that appears only once.
+
+    Args:
+        rule: The sharding rule string.
+
+    Note:
+        This API is experimental and subject to change.
+    """
+
+    rule: str
+    operands: tuple[tuple[str, ...], ...] = field(init=False, compare=False)
+    results: tuple[tuple[str, ...], ...] = field(init=False, compare=False)
+
+    def __post_init__(self) -> None:
+        if self.rule.count("->") != 1:
+            raise ValueError(f"Sharding rule '{self.rule}' must contain a single '->'.")
+        operands, results = self.rule.split("->")
+
+        def parse(side: str) -> tuple[tuple[str, ...], ...]:
+            tensors = tuple(tuple(t.split()) for t in side.split(","))
+            # Allow an empty side, e.g. for a kernel without operands
+            return () if tensors == ((),) else tensors
+
+        object.__setattr__(self, "operands", parse(operands))
+        object.__setattr__(self, "results", parse(results))
+        result_factors = {f for r in self.results for f in r}
+        operand_factors = {f for o in self.operands for f in o}
+        if not result_factors <= operand_factors:
+            raise ValueError(
+                f"Sharding rule '{self.rule}' has result factors "
+                f"{sorted(result_factors - operand_factors)} not present in any operand."
+            )
+
+    def validate(self, operands: Sequence[Any], results: Sequence[Any]) -> None:
+        """Checks that the rule matches the number and ranks of the operands and results."""
+        for label, tensors, factors in (
+            ("operand", operands, self.operands),
+            ("result", results, self.results),
+        ):
+            if len(tensors) != len(factors):
+                raise ValueError(
+                    f"Sharding rule '{self.rule}' has {len(factors)} {label}s but "
+                    f"{len(tensors)} were given."
+                )
+            for idx, (tensor, names) in enumerate(zip(tensors, factors)):
+                if len(tensor.shape) != len(names):
+                    raise ValueError(
+                        f"Sharding rule '{self.rule}' has rank {len(names)} for {label} "
+                        f"#{idx} but its shape is {tensor.shape}."
+                    )
+
+    def _factor_axes(self, mesh: Any, operands: Sequence[Any]) -> dict[str, Any]:
+        """Chooses the mesh axes of each factor from the shardings of the operands."""
+        result_factors = {f for r in self.results for f in r}
+        factor_size: dict[str, int] = {}
+        factor_axes: dict[str, Any] = {}
+        used_axes: set[str] = set()
+        for operand, names in zip(operands, self.operands):
+            spec = getattr(getattr(operand, "sharding", None), "spec", None) or ()
+            for dim, name in enumerate(names):
+                factor_size.setdefault(name, operand.shape[dim])
+                axes = spec[dim] if dim < len(spec) else None
+                if name in factor_axes or name not in result_factors or axes is None:
+                    continue
+                axes_tuple = axes if isinstance(axes, tuple) else (axes,)
+                # A mesh axis can only partition one factor, and the partition must be even
+                shard_count = math.prod(mesh.shape[a] for a in axes_tuple)
+                if used_axes.intersection(axes_tuple) or factor_size[name] % shard_count:
+                    continue
+                factor_axes[name] = axes
+                used_axes.update(axes_tuple)
+        return factor_axes
+
+    def _shardings(
+        self, mesh: Any, factor_axes: dict[str, Any], tensors: Sequence[Sequence[str]]
+    ) -> tuple[NamedSharding, ...]:
+        return tuple(
+            NamedSharding(mesh, PartitionSpec(*(factor_axes.get(n) for n in names)))
+            for names in tensors
+        )
+
+    def partitioned_call(
+        self,
+        make_call: Callable[[tuple[jax.ShapeDtypeStruct, ...]], Callable[..., Any]],
+        output_shape_dtype_flat: tuple[jax.ShapeDtypeStruct, ...],
+    ) -> Callable[..., Any]:
+        """Returns a function that partitions the call built by *make_call* following this rule.
+
+        Args:
+            make_call: Builds the call of the kernel for the given (per-shard)
+                output shapes. The call takes the flat operands and returns the
+                flat results.
+            output_shape_dtype_flat: The global shapes of the flat results.
+        """
+
+        @custom_partitioning
+        def call(*args_flat: Any) -> Any:
+            return tuple(make_call(output_shape_dtype_flat)(*args_flat))
+
+        def infer_sharding_from_operands(
+            mesh: Any, arg_shapes: Any, result_shape: Any
+        ) -> Any:
+            del result_shape
+            factor_axes = self._factor_axes(mesh, arg_shapes)
+            return self._shardings(mesh, factor_axes, self.results)
+
+        def partition(mesh: Any, arg_shapes: Any, result_shape: Any) -> Any:
+            del result_shape
+            factor_axes = self._factor_axes(mesh, arg_shapes)
+            arg_shardings = self._shardings(mesh, factor_axes, self.operands)
+            result_shardings = self._shardings(mesh, factor_axes, self.results)
+            local_output_shape_dtype_flat = tuple(
+                jax.ShapeDtypeStruct(s.shard_shape(x.shape), x.dtype)
+                for s, x in zip(result_shardings, output_shape_dtype_flat)
+            )
+
+            # Each shard compiles (or reuses) the kernel for its local shapes
+            def lower_fn(*args_flat: Any) -> Any:
+                return tuple(make_call(local_output_shape_dtype_flat)(*args_flat))
+
+            return mesh, lower_fn, result_shardings, arg_shardings
+
+        call.def_partition(
+            infer_sharding_from_operands=infer_sharding_from_operands,
+            partition=partition,
+            sharding_rule=self.rule,
+        )
+        return call
@@ -51,7 +51,7 @@ def dump_profiling_metadata(dump_dir: str, extra: Optional[dict] = None) -> None
     """Dump ``kernel_symbols.json`` to ``dump_dir``.
 
     Call after ``cute.compile()`` returns. Merges the symbol registry
-    (barriers + warps) with any extra metadata.
+    (barriers + warps + traces) with any extra metadata.
 
     :param dump_dir: Output directory.
     :type dump_dir: str
@@ -60,7 +60,7 @@ def dump_profiling_metadata(dump_dir: str, extra: Optional[dict] = None) -> None
     :raises RuntimeError: If the output file cannot be written.
     """
     data = dump_kernel_symbols()
-    if not data.get("bar_alloc") and not data.get("warps"):
+    if not (data.get("bar_alloc") or data.get("warps") or data.get("traces")):
         return
     if extra:
         data.update(extra)
@@ -11,8 +11,12 @@
 
 
 import argparse
+import ast
+import functools
+import json
 import logging
 import os
+import tempfile
 from dataclasses import dataclass
 from functools import partial
 from itertools import product
@@ -770,6 +774,24 @@ def _benchmark_for_autotune(
     return time_us
 
 
+def _get_autotune_logger() -> logging.Logger:
+    """Returns the logger of the tuning utilities, enabled by setting ``CUTE_DSL_LOG_AUTOTUNE``."""
+    logger = logging.getLogger(__name__ + "_Autotune")
+    if not logger.handlers:
+        handler = logging.StreamHandler()
+        formatter = logging.Formatter(
+            "%(asctime)s - %(name)s - %(levelname)s - %(message)s"
+        )
+        handler.setFormatter(formatter)
+        logger.addHandler(handler)
+    if (
+        os.environ.get("CUTE_DSL_LOG_AUTOTUNE") is not None
+        and os.environ.get("CUTE_DSL_LOG_AUTOTUNE") != "0"
+    ):
+        logger.setLevel(logging.INFO)
+    return logger
+
+
 def tune(
     func: Callable[..., Callable[[], Any]],
     params_dict: Optional[Dict[str, List[Any]]] = None,
@@ -805,19 +827,7 @@ def tune(
     :return: Best configuration
     :rtype: Dict[str, Any]
     """
-    logger = logging.getLogger(__name__ + "_Autotune")
-    if not logger.handlers:
-        handler = logging.StreamHandler()
-        formatter = logging.Formatter(
-            "%(asctime)s - %(name)s - %(levelname)s - %(message)s"
-        )
-        handler.setFormatter(formatter)
-        logger.addHandler(handler)
-    if (
-        os.environ.get("CUTE_DSL_LOG_AUTOTUNE") is not None
-        and os.environ.get("CUTE_DSL_LOG_AUTOTUNE") != "0"
-    ):
-        logger.setLevel(logging.INFO)
+    logger = _get_autotune_logger()
 
     if stream is None:
         stream = cuda_driver.CUstream(cuda_driver.CUstream_flags.CU_STREAM_DEFAULT)
@@ -882,6 +892,243 @@ def tune(
     return best_config
 
 
+class autotune:
+    """Decorator tuning the parameters of a ``@cute.jit`` function for each input shape.
+
+    Each combination of the values in ``params_dict`` is compiled with ``cute.compile`` and benchmarked with
+    CUDA events on the arguments of the first call for a given key. The fastest compiled function is then
+    used for all calls with the same key. By default, the key is made of the shapes and data types of the
+    tensor arguments. For example:
+
+    .. code-block:: python
+
+        @cutlass.autotune(params_dict={
+            "mma_tiler_mn": [(128, 128), (256, 128)],
+            "cluster_shape_mn": [(1, 1), (2, 1)],
+            "use_2cta_instrs": [False, True],
+        })
+        @cute.jit
+        def gemm(a: cute.Tensor, b: cute.Tensor, c: cute.Tensor, mma_tiler_mn: cutlass.Constexpr,
+                 cluster_shape_mn: cutlass.Constexpr, use_2cta_instrs: cutlass.Constexpr):
+            ...
+
+        gemm(a, b, c)   # tunes for the shapes of a, b, and c
+        gemm(a, b, c)   # runs the best function found
+
+    Variants are compiled on a background thread via ``cute.compile.compile_async`` while the previously
+    compiled ones are benchmarked. Variants failing to compile or run are skipped.
+
+    If ``persist`` is set, the best parameters for each key are recorded in ``autotune.json`` in the JIT
+    cache directory, along with the target arch. Later processes compile only the recorded parameters,
+    and the compilation itself is usually served from the JIT file cache. Only parameters whose values
+    can be written as Python literals, such as numbers, booleans, strings, and tuples, are recorded.
+
+    The logs of the tuning are enabled by setting ``CUTE_DSL_LOG_AUTOTUNE=1``.
+
+    :param params_dict: Dictionary containing parameter names and their possible values
+    :type params_dict: Dict[str, List[Any]]
+    :param key: Function of the call arguments returning the hashable key for which to tune, defaults to
+        the shapes and data types of the arguments with a ``shape`` attribute
+    :type key: Callable, optional
+    :param warmup_iterations: Number of warmup iterations, defaults to 10
+    :type warmup_iterations: int, optional
+    :param iterations: Number of benchmark iterations, defaults to 100
+    :type iterations: int, optional
+    :param persist: Whether to record the best parameters in the JIT cache directory, defaults to True
+    :type persist: bool, optional
+    """
+
+    _RECORDS_FILE = "autotune.json"
+
+    def __init__(
+        self,
+        params_dict: Dict[str, List[Any]],
+        key: Optional[Callable[..., Any]] = None,
+        warmup_iterations: int = 10,
+        iterations: int = 100,
+        persist: bool = True,
+    ) -> None:
+        if not params_dict:
+            raise ValueError("params_dict must be provided")
+        self.params_dict = params_dict
+        self.key = key if key is not None else autotune.shape_key
+        self.warmup_iterations = warmup_iterations
+        self.iterations = iterations
+        self.persist = persist
+
+    @staticmethod
+    def shape_key(*args: Any, **kwargs: Any) -> tuple[Any, ...]:
+        """Returns the shapes and data types of the arguments having a ``shape`` attribute, such as tensors."""
+        key = []
+        for arg in list(args) + [kwargs[name] for name in sorted(kwargs)]:
+            shape = getattr(arg, "shape", None)
+            if shape is not None:
+                key.append((str(tuple(shape)), str(getattr(arg, "dtype", None))))
+        return tuple(key)
+
+    def __call__(self, func: Callable[..., Any]) -> Callable[..., Any]:
+        """Wraps ``func``, which must be decorated with ``@cute.jit``."""
+        best_kernels: Dict[Any, Any] = dict()
+        best_configs: Dict[Any, Dict[str, Any]] = dict()
+
+        @functools.wraps(func)
+        def tuning_wrapper(*args: Any, **kwargs: Any) -> Any:
+            tuning_key = self.key(*args, **kwargs)
+            if tuning_key not in best_kernels:
+                config = self._load_record(func, tuning_key) if self.persist else None
+                if config is not None:
+                    compiled_func = self._compile(func, args, kwargs, config)
+                else:
+                    compiled_func, config = self._tune(func, args, kwargs)
+                    if self.persist:
+                        self._store_record(func, tuning_key, config)
+                best_kernels[tuning_key] = compiled_func
+                best_configs[tuning_key] = config
+
+            compiled_func = best_kernels[tuning_key]
+            merged_kwargs = {**kwargs, **best_configs[tuning_key]}
+            return compiled_func(
+                *compiled_func.execution_args.get_rectified_args_from_original_args(
+                    args, merged_kwargs
+                )
+            )
+
+        tuning_wrapper.best_configs = best_configs  # type: ignore[attr-defined]
+        return tuning_wrapper
+
+    @staticmethod
+    def _compile(
+        func: Callable[..., Any],
+        args: tuple[Any, ...],
+        kwargs: Dict[str, Any],
+        config: Dict[str, Any],
+    ) -> Any:
+        from cutlass.cute import compile
+
+        return compile(func, *args, **{**kwargs, **config})
+
+    def _tune(
+        self, func: Callable[..., Any], args: tuple[Any, ...], kwargs: Dict[str, Any]
+    ) -> tuple[Any, Dict[str, Any]]:
+        """Compiles and benchmarks all configurations, returning the fastest compiled function and its configuration."""
+        from cutlass.cute import compile
+
+        logger = _get_autotune_logger()
+        keys = list(self.params_dict.keys())
+        configs = [
+            dict(zip(keys, values)) for values in product(*self.params_dict.values())
+        ]
+
+        start = time()
+        # The configurations are compiled one after another in the background so that
+        # the compilation of later configurations overlaps the benchmarking of earlier ones
+        pending = [
+            compile.compile_async(func, *args, **{**kwargs, **config})
+            for config in configs
+        ]
+
+        min_time = float("inf")
+        best_kernel = None
+        best_config: Dict[str, Any] = dict()
+        for config, compiled in zip(configs, pending):
+            logger.info(f"Tuning configuration: {config}")
+            try:
+                compiled_func = compiled.result()
+                runtime_args = compiled_func.execution_args.get_rectified_args_from_original_args(
+                    args, {**kwargs, **config}
+                )
+                cur_time = _benchmark_for_autotune(
+                    compiled_func,
+                    *runtime_args,
+                    warmup_iterations=self.warmup_iterations,
+                    iterations=self.iterations,
+                    use_cold_l2=True,
+                    print_verbose=False,
+                )
+            except NotImplementedError as e:
+                logger.info(f"   Encountered unimplemented error, abort execution: {e}")
+                raise e
+            except Exception as e:
+                logger.info(f"   Configuration skipping: {e}")
+                continue
+
+            logger.info(f"   Execution time: {cur_time} us")
+            if cur_time < min_time:
+                min_time = cur_time
+                best_kernel = compiled_func
+                best_config = config
+
+        if best_kernel is None:
+            raise ValueError("No best kernel found")
+
+        logger.info(f"Best configuration: {best_config}, execution time: {min_time} us")
+        logger.info(f"Total tuning time: {time() - start} s")
+        return best_kernel, best_config
+
+    @classmethod
+    def _records_path(cls) -> str:
+        from cutlass.base_dsl.cache_helpers import get_default_generated_ir_path
+
+        return os.path.join(get_default_generated_ir_path("CUTE_DSL"), cls._RECORDS_FILE)
+
+    @staticmethod
+    def _record_name(func: Callable[..., Any]) -> str:
+        """Returns the name under which the records of ``func`` are kept, which includes the target arch."""
+        from cutlass.base_dsl.dsl import BaseDSL
+
+        BaseDSL._lazy_initialize_dsl(func)
+        dsl = getattr(func, "_dsl_object", None)
+        arch = getattr(getattr(dsl, "envar", None), "arch", "")
+        return f"{func.__module__}.{func.__qualname__}@{arch}"
+
+    @classmethod
+    def _read_records(cls) -> Dict[str, Dict[str, str]]:
+        try:
+            with open(cls._records_path()) as f:
+                return json.load(f)
+        except (OSError, ValueError):
+            return dict()
+
+    def _load_record(
+        self, func: Callable[..., Any], tuning_key: Any
+    ) -> Optional[Dict[str, Any]]:
+        record = self._read_records().get(self._record_name(func), {}).get(repr(tuning_key))
+        if record is None:
+            return None
+        try:
+            config = ast.literal_eval(record)
+        except (ValueError, SyntaxError):
+            return None
+        # Ignore records of a different parameter space
+        if not isinstance(config, dict) or set(config) != set(self.params_dict):
+            return None
+        _get_autotune_logger().info(f"Using recorded configuration: {config}")
+        return config
+
+    def _store_record(
+        self, func: Callable[..., Any], tuning_key: Any, config: Dict[str, Any]
+    ) -> None:
+        record = repr(config)
+        try:
+            if ast.literal_eval(record) != config:
+                raise ValueError(record)
+        except (ValueError, SyntaxError):
+            _get_autotune_logger().info(f"Configuration {config} cannot be recorded")
+            return
+
+        path = self._records_path()
+        records = self._read_records()
+        records.setdefault(self._record_name(func), {})[repr(tuning_key)] = record
+        try:
+            # Replace the file atomically so that concurrent readers never see a partial write
+            fd, temp_path = tempfile.mkstemp(dir=os.path.dirname(path), suffix=".tmp")
+            with os.fdopen(fd, "w") as f:
+                json.dump(records, f, indent=2)
+            os.replace(temp_path, path)
+        except OSError as e:
+            _get_autotune_logger().info(f"Failed to record configuration: {e}")
+
+
 class CantImplementError(Exception):
     """Exception raised when a function is not implemented."""
 
@@ -69,6 +69,10 @@ from .grouped_gemm_persistent_tile_scheduler import (
     GroupedGemmTileSchedulerHelper,
 )
 
+from .grouped_gemm_dynamic_persistent_tile_scheduler import (
+    ClcDynamicPersistentGroupTileScheduler,
+)
+
 from .tensormap_manager import (
     TensorMapUpdateMode,
     TensorMapManager,
@@ -185,6 +189,7 @@ __all__ = [
     "block_copy",
     "ClcDynamicPersistentTileSchedulerParams",
     "ClcDynamicPersistentTileScheduler",
+    "ClcDynamicPersistentGroupTileScheduler",
     "print_latex",
     "print_latex_tv",
     "is_fp8_dtype",
@@ -0,0 +1,256 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+#
+# Use of this software is governed by the terms and conditions of the
+# NVIDIA End User License Agreement (EULA), available at:
+# https://docs.nvidia.com/cutlass/latest/media/docs/pythonDSL/license.html
+#
+# Any use, reproduction, disclosure, or distribution of this software
+# and related documentation outside the scope permitted by the EULA
+# is strictly prohibited.
+
+from typing import Any, Optional, Tuple
+
+import cutlass.cute as cute
+from cutlass.cutlass_dsl import (
+    Int32,
+    Integer,
+    extract_mlir_values,
+    new_from_mlir_values,
+    dsl_user_op,
+)
+from cutlass._mlir import ir
+
+from cutlass.utils.static_persistent_tile_scheduler import WorkTileInfo
+from cutlass.utils.dynamic_persistent_tile_scheduler import (
+    ClcDynamicPersistentTileSchedulerParams,
+    ClcDynamicPersistentTileScheduler,
+)
+from cutlass.utils.grouped_gemm_persistent_tile_scheduler import GroupedWorkTileInfo
+from cutlass.utils.grouped_gemm_tile_scheduler_helper import (
+    GroupedGemmGroupSearchState,
+    GroupedGemmTileSchedulerHelper,
+    create_initial_search_state,
+)
+
+
+class ClcDynamicPersistentGroupTileScheduler(ClcDynamicPersistentTileScheduler):
+    """A scheduler for dynamic persistent group-based tile execution in CUTLASS/CuTe kernels.
+
+    Work is distributed with cluster launch control (CLC) as in ClcDynamicPersistentTileScheduler,
+    so that clusters finishing early keep taking the remaining tiles of any group. This avoids the
+    idle SMs at the tail of the static grouped schedule when groups have very different sizes, e.g.
+    the experts of a MoE layer.
+
+    One cluster is launched per cluster tile of all groups. The params must therefore be created
+    with problem_shape_ntile_mnl = (cluster_shape_m, cluster_shape_n, total_num_clusters), without
+    swizzle and rastered along M, so that the z index of a cluster is the linear index of its
+    cluster tile. The linear index is mapped to the group and to the CTA tile coordinates with
+    GroupedGemmTileSchedulerHelper.
+
+    The group search is a warp-wide operation, so get_current_work and initial_work_tile_info must
+    be called by all threads of a warp.
+
+    :ivar helper: Helper mapping the linear cluster tile index to the group and CTA tile coordinates
+    :type helper: GroupedGemmTileSchedulerHelper
+    :ivar problem_shape_mnkl: Problem shape tensor for groups
+    :type problem_shape_mnkl: cute.Tensor
+    """
+
+    def __init__(
+        self,
+        params: ClcDynamicPersistentTileSchedulerParams,
+        cta_id_in_cluster: cute.Coord,
+        num_tiles_executed: Int32,
+        clc_response_ptr: cute.Pointer,
+        block_idx: Tuple[Integer, Integer, Integer],
+        helper: GroupedGemmTileSchedulerHelper,
+        problem_shape_mnkl: cute.Tensor,
+        insert_fence: bool = True,
+    ):
+        """
+        Initializes the ClcDynamicPersistentGroupTileScheduler with the given parameters.
+
+        :param params: Tile schedule related params, including cluster shape.
+        :type params: ClcDynamicPersistentTileSchedulerParams
+        :param cta_id_in_cluster: ID of the CTA within its cluster.
+        :type cta_id_in_cluster: cute.Coord
+        :param num_tiles_executed: Counter for executed tiles.
+        :type num_tiles_executed: Int32
+        :param clc_response_ptr: Pointer of the clc response.
+        :type clc_response_ptr: cute.Pointer
+        :param block_idx: The block index.
+        :type block_idx: Tuple[Integer, Integer, Integer]
+        :param helper: Helper mapping the linear cluster tile index to the group and CTA tile coordinates.
+        :type helper: GroupedGemmTileSchedulerHelper
+        :param problem_shape_mnkl: Tensor containing gemm problem size (M, N, K, L) for each group.
+        :type problem_shape_mnkl: cute.Tensor
+        :param insert_fence: Whether to insert a fence after loading the CLC response, see
+            ClcDynamicPersistentTileScheduler.
+        :type insert_fence: bool
+        """
+        super().__init__(
+            params,
+            cta_id_in_cluster,
+            num_tiles_executed,
+            clc_response_ptr,
+            block_idx,
+            insert_fence,
+        )
+        self.helper = helper
+        self.problem_shape_mnkl = problem_shape_mnkl
+
+    def __extract_mlir_values__(self) -> list[ir.Value]:
+        values = super().__extract_mlir_values__()
+        values.extend(extract_mlir_values(self.helper))
+        values.extend(extract_mlir_values(self.problem_shape_mnkl))
+        return values
+
+    def __new_from_mlir_values__(
+        self, values: list[ir.Value]
+    ) -> "ClcDynamicPersistentGroupTileScheduler":
+        n_helper_values = len(extract_mlir_values(self.helper))
+        if len(values) != 8 + n_helper_values + 1:
+            raise ValueError("Length of mlir values extracted is incorrect.")
+        new_cta_id_in_cluster = new_from_mlir_values(
+            self.cta_id_in_cluster, values[0:3]
+        )
+        new_num_tiles_executed = new_from_mlir_values(
+            self._num_tiles_executed, [values[3]]
+        )
+        new_clc_response_ptr = new_from_mlir_values(self._clc_response_ptr, [values[4]])
+        new_block_idx = new_from_mlir_values(self._block_idx, values[5:8])
+        new_helper = new_from_mlir_values(self.helper, values[8 : 8 + n_helper_values])
+        new_problem_shape_mnkl = new_from_mlir_values(
+            self.problem_shape_mnkl, values[8 + n_helper_values :]
+        )
+        return ClcDynamicPersistentGroupTileScheduler(
+            self.params,
+            new_cta_id_in_cluster,
+            new_num_tiles_executed,
+            new_clc_response_ptr,
+            new_block_idx,
+            new_helper,
+            new_problem_shape_mnkl,
+            self.insert_fence,
+        )
+
+    @dsl_user_op
+    @staticmethod
+    def create(  # type: ignore[override]
+        params: ClcDynamicPersistentTileSchedulerParams,
+        block_idx: Tuple[Integer, Integer, Integer],
+        grid_dim: Tuple[Integer, Integer, Integer],
+        clc_response_ptr: cute.Pointer,
+        cluster_tile_shape_mnk: tuple[int, int, int],
+        group_count: int,
+        problem_shape_mnkl: cute.Tensor,
+        initial_search_state: Optional[GroupedGemmGroupSearchState] = None,
+        insert_fence: bool = True,
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> "ClcDynamicPersistentGroupTileScheduler":
+        """Initialize the dynamic persistent group-based tile scheduler.
+
+        :param params: Parameters for the persistent tile scheduler, with the total number of
+            clusters of all groups as L dimension.
+        :type params: ClcDynamicPersistentTileSchedulerParams
+        :param block_idx: The 3d block index in the format (bidx, bidy, bidz).
+        :type block_idx: Tuple[Integer, Integer, Integer]
+        :param grid_dim: The 3d grid dimensions for kernel launch.
+        :type grid_dim: Tuple[Integer, Integer, Integer]
+        :param clc_response_ptr: Pointer of the clc response.
+        :type clc_response_ptr: cute.Pointer
+        :param cluster_tile_shape_mnk: The shape of cluster tile as (m, n, k)
+        :type cluster_tile_shape_mnk: tuple[int, int, int]
+        :param group_count: Number of groups in current grouped gemm problem
+        :type group_count: int
+        :param problem_shape_mnkl: Tensor containing gemm problem size (M, N, K, L) for each group
+        :type problem_shape_mnkl: cute.Tensor
+        :param initial_search_state: The initial search state, defaults to create_initial_search_state()
+        :type initial_search_state: GroupedGemmGroupSearchState, optional
+        :param insert_fence: Whether to insert a fence after loading the CLC response.
+        :type insert_fence: bool
+
+        :return: A ClcDynamicPersistentGroupTileScheduler object.
+        :rtype: ClcDynamicPersistentGroupTileScheduler
+
+        :raises ValueError: If the params use swizzle or raster along N.
+        """
+        if params.swizzle_size != 1 or not params._raster_along_m:
+            raise ValueError(
+                "grouped gemm dynamic scheduling requires swizzle_size == 1 and raster_along_m"
+            )
+        if initial_search_state is None:
+            initial_search_state = create_initial_search_state()
+
+        tile_sched = ClcDynamicPersistentTileScheduler.create(
+            params, block_idx, grid_dim, clc_response_ptr, insert_fence, loc=loc, ip=ip
+        )
+        helper = GroupedGemmTileSchedulerHelper(
+            group_count,
+            params,  # type: ignore[arg-type]
+            cluster_tile_shape_mnk,
+            initial_search_state,
+        )
+        return ClcDynamicPersistentGroupTileScheduler(
+            params,
+            tile_sched.cta_id_in_cluster,
+            tile_sched._num_tiles_executed,
+            clc_response_ptr,
+            block_idx,
+            helper,
+            problem_shape_mnkl,
+            insert_fence,
+        )
+
+    @cute.jit
+    def _delinearize_z(self, work_tile: WorkTileInfo) -> GroupedWorkTileInfo:
+        """Maps the linear cluster tile index of ``work_tile`` to its group and CTA tile coordinates."""
+        state = self.helper.search_state
+        start_group_idx = state.start_group_idx
+        tile_count_prev_group = state.tile_count_prev_group
+        tile_count_searched = state.tile_count_searched
+
+        linear_idx = work_tile.tile_idx[2]
+        # The response of a failed cancellation carries no tile. Search the start of the
+        # current group instead, which always terminates, and keep the tile invalid.
+        if not work_tile.is_valid_tile:
+            linear_idx = tile_count_prev_group
+        # The group search only moves forward. Restart it if CLC hands out a tile of an
+        # earlier group.
+        if linear_idx < tile_count_prev_group:
+            start_group_idx = Int32(0)
+            tile_count_prev_group = Int32(0)
+            tile_count_searched = Int32(0)
+        self.helper.search_state = GroupedGemmGroupSearchState(
+            start_group_idx, tile_count_prev_group, tile_count_searched
+        )
+
+        group_search_result = self.helper.delinearize_z(
+            (work_tile.tile_idx[0], work_tile.tile_idx[1], linear_idx),
+            self.problem_shape_mnkl,
+        )
+        return GroupedWorkTileInfo(
+            work_tile.tile_idx, work_tile.is_valid_tile, group_search_result
+        )
+
+    @dsl_user_op
+    def get_current_work(
+        self,
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> WorkTileInfo:
+        # Without swizzle, the M and N coordinates of the raw work tile are those of the CTA
+        # in the cluster and its L coordinate is the linear cluster tile index
+        work_tile = super().get_current_work(loc=loc, ip=ip)
+        return self._delinearize_z(work_tile)
+
+    @dsl_user_op
+    def initial_work_tile_info(
+        self, *, loc: Any = None, ip: Any = None
+    ) -> WorkTileInfo:
+        work_tile = super().initial_work_tile_info(loc=loc, ip=ip)
+        return self._delinearize_z(work_tile)
@@ -56,6 +56,20 @@ def register_symbol(name: str, kind: str, **metadata: Any) -> None:
         _symbol_registry[name] = existing
 
 
+def register_trace_symbol(name: str) -> int:
+    """Register a timeline trace event and return its id.
+
+    Ids are assigned in registration order, so the ids of one kernel are
+    dense and start at 0 after the registry has been cleared.
+    """
+    existing = _symbol_registry.get(name)
+    if existing is not None and existing.get("kind") == "trace":
+        return existing["id"]
+    trace_id = sum(1 for m in _symbol_registry.values() if m.get("kind") == "trace")
+    register_symbol(name, kind="trace", id=trace_id)
+    return trace_id
+
+
 def get_symbol_registry() -> dict[str, dict[str, Any]]:
     """Return the current symbol registry (for inspection)."""
     return dict(_symbol_registry)
@@ -69,16 +83,20 @@ def dump_kernel_symbols() -> dict[str, Any]:
         {
             "warps": {"Softmax0Warp": {"warp_start": 0, "warp_end": 4}, ...},
             "barriers": {"load_q": {"num_stages": 2, "pipeline_type": "..."}, ...},
+            "traces": {"LoadStage": {"id": 0}, ...},
         }
     """
     warps = {}
     barriers = {}
+    traces = {}
     for name, meta in _symbol_registry.items():
         kind = meta.pop("kind", "")
         if kind == "warp":
             warps[name] = meta
         elif kind == "barrier":
             barriers[name] = meta
+        elif kind == "trace":
+            traces[name] = meta
         # other kinds can be added later
     result: dict[str, Any] = {}
     if warps:
@@ -91,6 +109,8 @@ def dump_kernel_symbols() -> dict[str, Any]:
             alloc_parts.append(f"{bname}:{stages}")
         result["bar_alloc"] = ", ".join(alloc_parts)
         result["barriers"] = barriers
+    if traces:
+        result["traces"] = traces
     _symbol_registry.clear()
     return result
 
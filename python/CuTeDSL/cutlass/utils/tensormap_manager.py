@@ -11,12 +11,12 @@
 
 from dataclasses import dataclass
 from enum import Enum, auto
-from typing import Optional, Tuple
+from typing import Optional, Tuple, Union
 
 import cutlass._mlir.dialects.cute as _cute_ir
 import cutlass._mlir.dialects.cute_nvgpu as _cute_nvgpu_ir
 from cutlass._mlir import ir
-from cutlass.cutlass_dsl import dsl_user_op
+from cutlass.cutlass_dsl import Int32, Int64, dsl_user_op
 
 import cutlass.cute as cute
 from cutlass import const_expr
@@ -32,10 +32,14 @@ class TensorMapUpdateMode(Enum):
     GMEM: Update tensormap in global memory
     SMEM: Load tensormap from global memory to shared memory,
     update it in shared memory, then store back to global memory
+    SMEM_PREFETCH: Update tensormap in shared memory as SMEM, but store it to one of
+    two global memory stages. `prefetch_tensormap` then prepares, acquires and prefetches
+    the tensormap of the next group while the current group still uses the other stage
     """
 
     GMEM = auto()  # Update tensormap in global memory
     SMEM = auto()  # Update tensormap in shared memory
+    SMEM_PREFETCH = auto()  # Update tensormap in shared memory ahead of its use
 
 
 @dataclass(frozen=True)
@@ -48,13 +52,23 @@ class TensorMapManager:
     tensormap_update_mode: TensorMapUpdateMode
     bytes_per_tensormap: int
 
+    # number of tensormaps in global memory per descriptor.
+    # SMEM_PREFETCH mode alternates between two stages so that a tensormap can be updated while the other is in use
+    @property
+    def num_tensormap_stages(self) -> int:
+        if self.tensormap_update_mode == TensorMapUpdateMode.SMEM_PREFETCH:
+            return 2
+        return 1
+
     # convert given cute.Pointer or cutlass.Int64 to a cute.Pointer to tensormap.
     # address_space: the address space of the resulting tensormap pointer. It could be generic or gmem
+    # stage: the index of the tensormap stage, for buffers holding num_tensormap_stages consecutive tensormaps
     @dsl_user_op
     def get_tensormap_ptr(
         self,
         ptr: cute.Pointer,
         address_space: _cute_ir.AddressSpace = _cute_ir.AddressSpace.gmem,
+        stage: Union[int, Int32] = 0,
         *,
         loc: Optional[ir.Location] = None,
         ip: Optional[ir.InsertionPoint] = None,
@@ -65,7 +79,10 @@ class TensorMapManager:
         ]:
             raise ValueError(f"Invalid address space: {address_space} for tensormap")
 
-        gmem_ptr_i64 = ptr.toint().ir_value(loc=loc, ip=ip)
+        gmem_ptr_int = ptr.toint()
+        if not (isinstance(stage, int) and stage == 0):
+            gmem_ptr_int = gmem_ptr_int + Int64(stage) * self.bytes_per_tensormap
+        gmem_ptr_i64 = gmem_ptr_int.ir_value(loc=loc, ip=ip)
         gmem_ptr_i64_align_ty = _cute_ir.ConstrainedIntType.get(
             self.bytes_per_tensormap, gmem_ptr_i64.type.width
         )
@@ -113,6 +130,69 @@ class TensorMapManager:
             cute.arch.fence_acq_rel_cta(loc=loc, ip=ip)
         return
 
+    # update the tensormaps staged in shared memory for group `group_idx` and release them to its global
+    # memory stage, group_idx % num_tensormap_stages, while the current group keeps using the other stage.
+    # tensormap_gmem_ptr points to the first of the num_tensormap_stages tensormaps of each descriptor.
+    # The updating warp then acquires the released tensormaps and prefetches them into the tensormap cache,
+    # so the descriptor update, both fences and the descriptor fetch overlap with the mainloop of the
+    # current group. Returns the tensormap pointers of the group's stage for its TMA loads and stores.
+    # Other warps issuing TMA with these tensormaps still call `fence_tensormap_update` on the group switch.
+    @dsl_user_op
+    def prefetch_tensormap(
+        self,
+        tensor_gmem: Tuple[cute.Tensor, ...],
+        tma_copy_atom: Tuple[cute.CopyAtom, ...],
+        tensormap_gmem_ptr: Tuple[cute.Pointer, ...],
+        warp_id: int,
+        tensormap_smem_ptr: Tuple[cute.Pointer, ...],
+        group_idx: Union[int, Int32],
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> Tuple[cute.Pointer, ...]:
+        if self.tensormap_update_mode != TensorMapUpdateMode.SMEM_PREFETCH:
+            raise ValueError(
+                f"prefetch_tensormap requires SMEM_PREFETCH mode, got {self.tensormap_update_mode}"
+            )
+        stage = group_idx % self.num_tensormap_stages
+        stage_gmem_ptr = tuple(
+            self.get_tensormap_ptr(ptr, stage=stage, loc=loc, ip=ip)
+            for ptr in tensormap_gmem_ptr
+        )
+        self.update_tensormap(
+            tensor_gmem,
+            tma_copy_atom,
+            stage_gmem_ptr,
+            warp_id,
+            tensormap_smem_ptr,
+            loc=loc,
+            ip=ip,
+        )
+        self._acquire_and_prefetch_tensormap(stage_gmem_ptr, warp_id, loc=loc, ip=ip)
+        return stage_gmem_ptr
+
+    # acquire the tensormaps released by `update_tensormap` in the updating warp and start fetching them
+    @dsl_user_op
+    @cute.jit
+    def _acquire_and_prefetch_tensormap(
+        self,
+        tensormap_gmem_ptr: Tuple[cute.Pointer, ...],
+        warp_id: int,
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> None:
+        warp_idx = cute.arch.make_warp_uniform(
+            cute.arch.warp_idx(loc=loc, ip=ip), loc=loc, ip=ip
+        )
+        if warp_idx == warp_id:
+            for gmem_ptr in tensormap_gmem_ptr:
+                cute.nvgpu.cpasync.fence_tma_desc_acquire(gmem_ptr, loc=loc, ip=ip)
+            with cute.arch.elect_one(loc=loc, ip=ip):
+                for gmem_ptr in tensormap_gmem_ptr:
+                    cute.nvgpu.cpasync.prefetch_tma_desc(gmem_ptr, loc=loc, ip=ip)
+        return
+
     # Perform a fence operation to ensure previous `update_tensormap` calls have been completed
     @dsl_user_op
     def fence_tensormap_update(
@@ -141,7 +221,7 @@ class TensorMapManager:
         warp_idx = cute.arch.make_warp_uniform(
             cute.arch.warp_idx(loc=loc, ip=ip), loc=loc, ip=ip
         )
-        if const_expr(self.tensormap_update_mode == TensorMapUpdateMode.SMEM):
+        if const_expr(self.tensormap_update_mode != TensorMapUpdateMode.GMEM):
             # Hoist SMEM pointer integer values into warp-uniform registers before
             # entering predicated blocks. This avoids predicated R2UR lowering on sm_90a.
             uniform_smem_ptrs = tuple(
@@ -157,7 +237,7 @@ class TensorMapManager:
             uniform_smem_ptrs = tensormap_smem_ptr
         # updates before touching tensormap in global memory
         if warp_idx == warp_id:
-            if const_expr(self.tensormap_update_mode == TensorMapUpdateMode.SMEM):
+            if const_expr(self.tensormap_update_mode != TensorMapUpdateMode.GMEM):
                 for copy_atom, tensor, smem_ptr in zip(
                     tma_copy_atom, tensor_gmem, uniform_smem_ptrs
                 ):
@@ -170,7 +250,7 @@ class TensorMapManager:
                 cute.arch.cp_async_bulk_wait_group(0, read=True, loc=loc, ip=ip)
             cute.arch.sync_warp(loc=loc, ip=ip)
             # updates to tensormap in global memory
-            if const_expr(self.tensormap_update_mode == TensorMapUpdateMode.SMEM):
+            if const_expr(self.tensormap_update_mode != TensorMapUpdateMode.GMEM):
                 for gmem_ptr, smem_ptr in zip(tensormap_gmem_ptr, uniform_smem_ptrs):
                     cute.nvgpu.cpasync.cp_fence_tma_desc_release(
                         gmem_ptr, smem_ptr, loc=loc, ip=ip
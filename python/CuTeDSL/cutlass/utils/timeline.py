@@ -0,0 +1,291 @@
+# SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: LicenseRef-NvidiaProprietary
+#
+# Use of this software is governed by the terms and conditions of the
+# NVIDIA End User License Agreement (EULA), available at:
+# https://docs.nvidia.com/cutlass/latest/media/docs/pythonDSL/license.html
+#
+# Any use, reproduction, disclosure, or distribution of this software
+# and related documentation outside the scope permitted by the EULA
+# is strictly prohibited.
+
+"""Intra-kernel timeline tracing.
+
+``TimelineTracer`` records per-warp timestamps of named events into a ring
+buffer in global memory. Event names are registered in the shared symbol
+registry (``cutlass.utils.profiling``) with ``kind="trace"``, and
+``export_chrome_trace()`` turns the buffer into a Chrome trace that can be
+opened with Perfetto or ``chrome://tracing``.
+
+The buffer is an Int64 tensor of shape ``(num_ctas * warps_per_cta,
+capacity + 1, 2)``, zero-initialized by the host. Each warp owns one slot:
+entry 0 holds the number of events recorded by the warp, entries
+``1..capacity`` hold ``(timestamp, metadata)`` pairs. Once a slot is full,
+new events overwrite the oldest ones.
+
+Usage::
+
+    from cutlass.utils.timeline import TimelineTracer, export_chrome_trace
+    from cutlass.utils.profiling import dump_kernel_symbols
+
+    # Inside @cute.kernel:
+    tracer = TimelineTracer(trace_buffer, warps_per_cta=6)
+    tracer.begin("ProducerAcquire")
+    ab_producer.acquire_and_advance()
+    tracer.end("ProducerAcquire")
+
+    # On the host, after cute.compile() and the launch:
+    symbols = dump_kernel_symbols()
+    export_chrome_trace(trace_buffer.cpu().numpy(), symbols, 6, "trace.json")
+"""
+
+import json
+from enum import IntEnum
+from typing import Any, Optional
+
+import numpy as np
+
+import cutlass.cute as cute
+from cutlass import const_expr
+from cutlass.cutlass_dsl import Int32, Int64, dsl_user_op
+from cutlass._mlir import ir
+
+from cutlass.utils.profiling import register_trace_symbol
+
+
+class TraceEventKind(IntEnum):
+    """Kind of a timeline event, stored in bits 16-17 of the event metadata."""
+
+    BEGIN = 0
+    END = 1
+    INSTANT = 2
+
+
+_SYMBOL_ID_BITS = 16
+_KIND_SHIFT = 16
+_SMID_SHIFT = 32
+
+
+class TimelineTracer:
+    """Records timestamps of named events of the current warp into a trace buffer.
+
+    Only lane 0 of a warp writes events, so the events of warp-specialized
+    roles cost one counter load and three stores each. Timestamps are read
+    from the global timer by default, which is comparable across SMs; set
+    ``use_globaltimer=False`` to read the finer-grained per-SM clock64 counter.
+
+    :param buffer: Int64 trace buffer of shape (num_ctas * warps_per_cta, capacity + 1, 2)
+    :type buffer: cute.Tensor
+    :param warps_per_cta: Number of warps of a CTA, used to find the slot of a warp
+    :type warps_per_cta: int
+    :param use_globaltimer: Whether to read the global timer instead of clock64
+    :type use_globaltimer: bool
+    """
+
+    def __init__(
+        self,
+        buffer: cute.Tensor,
+        warps_per_cta: int,
+        use_globaltimer: bool = True,
+    ):
+        self.buffer = buffer
+        self.warps_per_cta = warps_per_cta
+        self.use_globaltimer = use_globaltimer
+
+    @dsl_user_op
+    def begin(
+        self,
+        name: str,
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> None:
+        """Records the beginning of the range ``name`` for the current warp."""
+        self.record(name, TraceEventKind.BEGIN, loc=loc, ip=ip)
+
+    @dsl_user_op
+    def end(
+        self,
+        name: str,
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> None:
+        """Records the end of the range ``name`` for the current warp."""
+        self.record(name, TraceEventKind.END, loc=loc, ip=ip)
+
+    @dsl_user_op
+    def record(
+        self,
+        name: str,
+        kind: TraceEventKind = TraceEventKind.INSTANT,
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> None:
+        """Records an event ``name`` of the given kind for the current warp.
+
+        :raises ValueError: If more events are registered than fit in the metadata.
+        """
+        symbol_id = register_trace_symbol(name)
+        if symbol_id >= (1 << _SYMBOL_ID_BITS):
+            raise ValueError(
+                f"Too many trace events, at most {1 << _SYMBOL_ID_BITS} are supported"
+            )
+        self._store(symbol_id | (int(kind) << _KIND_SHIFT), loc=loc, ip=ip)
+
+    @dsl_user_op
+    @cute.jit
+    def _store(
+        self,
+        metadata: int,
+        *,
+        loc: Optional[ir.Location] = None,
+        ip: Optional[ir.InsertionPoint] = None,
+    ) -> None:
+        # Read the timer first so that the slot computation is not part of the event
+        if const_expr(self.use_globaltimer):
+            timestamp = cute.arch.globaltimer(loc=loc, ip=ip)
+        else:
+            timestamp = cute.arch.clock64(loc=loc, ip=ip)
+        if cute.arch.lane_idx(loc=loc, ip=ip) == 0:
+            bidx, bidy, bidz = cute.arch.block_idx(loc=loc, ip=ip)
+            gdimx, gdimy, _ = cute.arch.grid_dim(loc=loc, ip=ip)
+            cta_linear_idx = (bidz * gdimy + bidy) * gdimx + bidx
+            slot = (
+                Int32(cta_linear_idx) * self.warps_per_cta
+                + cute.arch.warp_idx(loc=loc, ip=ip)
+            )
+            capacity = cute.size(self.buffer, mode=[1], loc=loc, ip=ip) - 1
+            count = self.buffer[slot, 0, 0]
+            entry = Int32(count % capacity) + 1
+            self.buffer[slot, entry, 0] = timestamp
+            self.buffer[slot, entry, 1] = Int64(metadata) | (
+                Int64(cute.arch.smid(loc=loc, ip=ip)) << _SMID_SHIFT
+            )
+            self.buffer[slot, 0, 0] = count + 1
+
+
+def _warp_names(symbols: dict[str, Any], warps_per_cta: int) -> list[str]:
+    names = [f"warp {w}" for w in range(warps_per_cta)]
+    for name, meta in symbols.get("warps", {}).items():
+        start, end = meta.get("warp_start", 0), meta.get("warp_end", 0)
+        for w in range(start, min(end, warps_per_cta)):
+            names[w] = f"{name} (warp {w})"
+    return names
+
+
+def export_chrome_trace(
+    buffer: Any,
+    symbols: dict[str, Any],
+    warps_per_cta: int,
+    path: Optional[str] = None,
+    ticks_per_us: float = 1000.0,
+) -> dict[str, Any]:
+    """Converts a trace buffer into the Chrome trace event format.
+
+    Every CTA is shown as a process and every warp as a thread of it. Warps
+    registered with ``WarpScope`` are named after their role.
+
+    :param buffer: The trace buffer copied to the host, e.g. a numpy array
+    :type buffer: Any
+    :param symbols: The symbols of the kernel as returned by ``dump_kernel_symbols()``
+    :type symbols: dict
+    :param warps_per_cta: Number of warps of a CTA, as passed to ``TimelineTracer``
+    :type warps_per_cta: int
+    :param path: If given, the trace is also written to this file
+    :type path: str, optional
+    :param ticks_per_us: Timer ticks per microsecond, 1000 for the global timer
+        and the SM clock rate in MHz for clock64
+    :type ticks_per_us: float
+    :return: The trace as a dict with a ``traceEvents`` list
+    :rtype: dict
+    :raises ValueError: If the buffer does not have the expected shape.
+    """
+    data = np.asarray(buffer, dtype=np.int64)
+    if data.ndim != 3 or data.shape[2] != 2 or data.shape[1] < 2:
+        raise ValueError(
+            f"Expected a trace buffer of shape (slots, capacity + 1, 2), got {data.shape}"
+        )
+    capacity = data.shape[1] - 1
+    id_to_name = {
+        meta["id"]: name for name, meta in symbols.get("traces", {}).items()
+    }
+    warp_names = _warp_names(symbols, warps_per_cta)
+    phases = {
+        TraceEventKind.BEGIN: "B",
+        TraceEventKind.END: "E",
+        TraceEventKind.INSTANT: "i",
+    }
+
+    recorded = [(slot, int(data[slot, 0, 0])) for slot in range(data.shape[0])]
+    recorded = [(slot, count) for slot, count in recorded if count > 0]
+    # Rebase the timestamps so that the trace starts at zero
+    t0 = min(
+        (
+            int(data[slot, 1 : min(count, capacity) + 1, 0].min())
+            for slot, count in recorded
+        ),
+        default=0,
+    )
+
+    events: list[dict[str, Any]] = []
+    named_ctas: set[int] = set()
+    for slot, count in recorded:
+        cta, warp = divmod(slot, warps_per_cta)
+        tid = warp
+        if cta not in named_ctas:
+            named_ctas.add(cta)
+            events.append(
+                {
+                    "ph": "M",
+                    "name": "process_name",
+                    "pid": cta,
+                    "args": {"name": f"CTA {cta}"},
+                }
+            )
+        events.append(
+            {
+                "ph": "M",
+                "name": "thread_name",
+                "pid": cta,
+                "tid": tid,
+                "args": {"name": warp_names[warp]},
+            }
+        )
+        # Oldest event first, the ring buffer wraps after `capacity` events
+        num_events = min(count, capacity)
+        first = count - num_events
+        for i in range(first, count):
+            timestamp, metadata = (int(v) for v in data[slot, i % capacity + 1])
+            symbol_id = metadata & ((1 << _SYMBOL_ID_BITS) - 1)
+            kind = TraceEventKind((metadata >> _KIND_SHIFT) & 0x3)
+            event = {
+                "ph": phases[kind],
+                "name": id_to_name.get(symbol_id, f"event {symbol_id}"),
+                "pid": cta,
+                "tid": tid,
+                "ts": (timestamp - t0) / ticks_per_us,
+                "args": {"smid": metadata >> _SMID_SHIFT},
+            }
+            if kind == TraceEventKind.INSTANT:
+                event["s"] = "t"
+            events.append(event)
+        if first > 0:
+            # Ends of ranges whose beginning was overwritten are dropped by the viewers
+            events.append(
+                {
+                    "ph": "i",
+                    "s": "t",
+                    "name": f"{first} events dropped",
+                    "pid": cta,
+                    "tid": tid,
+                    "ts": events[-num_events]["ts"],
+                }
+            )
+
+    trace = {"traceEvents": events, "displayTimeUnit": "ns"}
+    if path is not None:
+        with open(path, "w") as f:
+            json.dump(trace, f)
+    return trace
@@ -81,7 +81,16 @@ def cuda_install_path():
         _CUDA_INSTALL_PATH = os.getenv("CUDA_INSTALL_PATH", _cuda_install_path_from_nvcc())
     return _CUDA_INSTALL_PATH
 
-CACHE_FILE = "compiled_cache.db"
+CACHE_FILE = os.getenv("CUTLASS_CACHE_FILE", "compiled_cache.db")
+
+# Maximum total size, in bytes, of the compiled images kept in CACHE_FILE. 0 disables eviction
+CACHE_MAX_SIZE = int(os.getenv("CUTLASS_CACHE_MAX_SIZE", "0"))
+
+# Read-only caches, such as ones exported with ``compiler.cache.export_bundle()``, consulted when CACHE_FILE misses
+PREBUILT_CACHE_FILES = [p for p in os.getenv("CUTLASS_PREBUILT_CACHE", "").split(os.pathsep) if p]
+
+# Number of modules compiled concurrently when several operations are compiled at once. 0 uses one per CPU
+COMPILE_JOBS = int(os.getenv("CUTLASS_COMPILE_JOBS", "1"))
 
 from cutlass_library import (
     DataType,
@@ -107,6 +116,15 @@ if (sys.version_info.major == 3 and sys.version_info.minor > 8) or sys.version_i
 else:
     this.use_rmm = False
 
+# Device memory for arguments and workspaces comes from RMM when it is installed and otherwise from the
+# device's stream-ordered CUDA memory pool. CUTLASS_MEMORY_POOL set to "rmm", "stream_ordered", or "none"
+# (plain cudaMalloc) overrides this choice
+_memory_pool_kind = os.getenv("CUTLASS_MEMORY_POOL", "rmm" if this.use_rmm else "stream_ordered")
+if _memory_pool_kind not in ["rmm", "stream_ordered", "none"]:
+    raise Exception(f"Invalid CUTLASS_MEMORY_POOL value {_memory_pool_kind}. Expected rmm, stream_ordered, or none")
+this.use_rmm = this.use_rmm and _memory_pool_kind == "rmm"
+this.use_stream_ordered_pool = _memory_pool_kind == "stream_ordered" or (_memory_pool_kind == "rmm" and not this.use_rmm)
+
 
 def set_log_level(level: int):
     """
@@ -140,7 +158,7 @@ from cutlass_cppgen.emit.pytorch import pytorch
 from cutlass_cppgen.op.gemm import Gemm
 from cutlass_cppgen.op.conv import Conv2d, Conv2dFprop, Conv2dDgrad, Conv2dWgrad
 from cutlass_cppgen.op.gemm_grouped import GroupedGemm
-from cutlass_cppgen.op.op import OperationBase
+from cutlass_cppgen.op.op import OperationBase, compile_all
 from cutlass_cppgen.backend.evt.ir.tensor import Tensor
 from cutlass_cppgen.utils.lazy_import import lazy_import
 
@@ -151,7 +169,7 @@ def get_memory_pool():
     Helper method for on-demand memory pool. This avoids allocating the memory pool unnecessarily
     whe CUTLASS is imported.
     """
-    if this.use_rmm and this.memory_pool is None:
+    if (this.use_rmm or this.use_stream_ordered_pool) and this.memory_pool is None:
         this.memory_pool = create_memory_pool(init_pool_size=2 ** 30, max_pool_size=2 ** 32)
     return this.memory_pool
 
@@ -40,8 +40,8 @@ cudart = lazy_import("cuda.cudart")
 import numpy as np
 
 import cutlass_cppgen
-from cutlass_cppgen.backend.frontend import CupyFrontend, NumpyFrontend, TorchFrontend
-from cutlass_cppgen.backend.memory_manager import DevicePtrWrapper
+from cutlass_cppgen.backend.frontend import CupyFrontend, DLPackFrontend, NumpyFrontend, TorchFrontend
+from cutlass_cppgen.backend.memory_manager import device_mem_free
 from cutlass_cppgen.utils.datatypes import is_cupy_tensor, is_numpy_tensor, is_torch_tensor
 
 
@@ -86,7 +86,7 @@ class ArgumentBase:
         if is_numpy_tensor(tensor):
             if is_output:
                 assert name
-            self.buffers[name] = NumpyFrontend.argument(tensor, is_output)
+            self.buffers[name] = NumpyFrontend.argument(tensor, is_output, self.stream)
             if is_output:
                 self.host_tensors[name] = tensor
             return self.buffers[name].ptr
@@ -96,8 +96,10 @@ class ArgumentBase:
             return tensor
         elif is_cupy_tensor(tensor):
             return CupyFrontend.argument(tensor)
+        elif DLPackFrontend.is_dlpack_tensor(tensor):
+            return DLPackFrontend.argument(tensor)
         else:
-            raise TypeError("Unsupported Frontend. Only support numpy and torch")
+            raise TypeError("Unsupported Frontend. Only support numpy, torch, cupy, and DLPack tensors")
 
     def sync(self, stream_sync=True):
         if stream_sync:
@@ -124,13 +126,8 @@ class ArgumentBase:
         # Free any device memory allocated manually
         if not cutlass_cppgen.use_rmm:
             for name, buf in self.buffers.items():
-                if isinstance(buf, DevicePtrWrapper):
-                    err, = cudart.cudaFree(buf.ptr)
-                    if err != cudart.cudaError_t.cudaSuccess:
-                        raise RuntimeError(f"cudaFree failed with error {err}")
-
-            if hasattr(self, "workspace_buffer") and isinstance(self.workspace_buffer, DevicePtrWrapper):
-                err, = cudart.cudaFree(self.workspace_buffer.ptr)
-                if err != cudart.cudaError_t.cudaSuccess:
-                    raise RuntimeError(f"cudaFree failed with error {err}")
+                device_mem_free(buf)
+
+            if hasattr(self, "workspace_buffer"):
+                device_mem_free(self.workspace_buffer)
                 del self.workspace_buffer
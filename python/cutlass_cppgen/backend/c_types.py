@@ -357,6 +357,25 @@ def get_gemm_grouped_arguments(epilogue_functor):
     return _GEMMGroupedArguments, _EpilogueOutputOpParams
 
 
+def get_gemm_grouped_visitor_arguments(epilogue_functor):
+    _EpilogueOutputOpParams = epilogue_functor.epilogue_type
+
+    class _GEMMGroupedVisitorArguments(ctypes.Structure):
+        _fields_ = [
+            ("problem_sizes", ctypes.c_void_p),
+            ("problem_count", ctypes.c_int),
+            ("threadblock_count", ctypes.c_int),
+            ("ptr_epilogue", ctypes.c_void_p),
+            ("ptr_A", ctypes.c_void_p),
+            ("ptr_B", ctypes.c_void_p),
+            ("lda", ctypes.c_void_p),
+            ("ldb", ctypes.c_void_p),
+            ("host_problem_sizes", ctypes.c_void_p)
+        ]
+
+    return _GEMMGroupedVisitorArguments, _EpilogueOutputOpParams
+
+
 ############################################################################################
 # Convolution2D
 ############################################################################################
@@ -0,0 +1,210 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+On-disk cache of compiled modules, safe to share between processes
+"""
+
+import contextlib
+import hashlib
+import os
+import sqlite3
+import time
+
+try:
+    import fcntl
+except ImportError:
+    fcntl = None
+
+from cutlass_cppgen import logger
+
+
+class CompiledKernelCache:
+    """
+    SQLite database of compiled operations keyed by a content hash of their source and compilation settings.
+
+    Many processes may use the same database at once: it is opened in write-ahead-log mode so readers do not
+    block writers, and ``lock()`` serializes processes compiling the same operations so that only the first of
+    them compiles while the others wait and then load its result. When ``max_size`` is non-zero, the least
+    recently used operations are evicted once the compiled images exceed that many bytes.
+
+    Lookups missing the database fall back to read-only prebuilt databases, such as one written by
+    ``export_bundle()`` and shipped in a container, so processes start without compiling.
+
+    :param path: path of the database
+    :type path: str
+    :param max_size: maximum total size, in bytes, of the compiled images kept in the database, or 0 for no limit
+    :type max_size: int
+    :param prebuilt_paths: paths of read-only prebuilt databases
+    :type prebuilt_paths: list
+    """
+
+    # Seconds a connection waits for another process holding a write lock on the database
+    busy_timeout = 600
+
+    def __init__(self, path, max_size=0, prebuilt_paths=()):
+        self.path = path
+        self.max_size = max_size
+        self.prebuilt_paths = [p for p in prebuilt_paths if os.path.isfile(p)]
+        self._prebuilt_connections = None
+
+        with contextlib.closing(self._connect()) as connection:
+            connection.execute("PRAGMA journal_mode=WAL")
+            connection.execute("""
+                CREATE TABLE IF NOT EXISTS compiled_operations(op_key TEXT NOT NULL UNIQUE,
+                                                               cubin BLOB NOT NULL,
+                                                               hostbin BLOB NOT NULL,
+                                                               op_name TEXT NOT NULL,
+                                                               op_attrs TEXT NOT NULL)
+            """)
+
+            # Databases written before eviction was supported lack the columns it uses
+            columns = [row[1] for row in connection.execute("PRAGMA table_info(compiled_operations)")]
+            for column in ("size INTEGER NOT NULL DEFAULT 0", "last_access REAL NOT NULL DEFAULT 0"):
+                if column.split(" ")[0] not in columns:
+                    try:
+                        connection.execute(f"ALTER TABLE compiled_operations ADD COLUMN {column}")
+                    except sqlite3.OperationalError:
+                        # Another process added the column first
+                        pass
+            connection.commit()
+
+    def _connect(self):
+        return sqlite3.connect(self.path, timeout=self.busy_timeout)
+
+    def _prebuilt(self):
+        if self._prebuilt_connections is None:
+            self._prebuilt_connections = []
+            for path in self.prebuilt_paths:
+                try:
+                    self._prebuilt_connections.append(
+                        sqlite3.connect(f"file:{path}?mode=ro&immutable=1", uri=True, check_same_thread=False))
+                except sqlite3.Error as e:
+                    logger.warning(f"Unable to open prebuilt kernel cache {path}: {e}")
+        return self._prebuilt_connections
+
+    @staticmethod
+    def make_key(*parts):
+        """
+        Returns the content-addressed key of an operation
+
+        :param parts: strings determining the compiled operation, such as its source, the target architecture,
+                      the CUDA version and the compilation flags
+        :return: hexadecimal SHA-256 digest of the parts
+        :rtype: str
+        """
+        digest = hashlib.sha256()
+        for part in parts:
+            digest.update(str(part).encode())
+            digest.update(b"\0")
+        return digest.hexdigest()
+
+    def lookup(self, op_key):
+        """
+        Returns the (cubin, hostbin, op_name, op_attrs) record of an operation, or None if no database holds it
+        """
+        query = "SELECT cubin, hostbin, op_name, op_attrs FROM compiled_operations WHERE op_key = ?"
+
+        with contextlib.closing(self._connect()) as connection:
+            record = connection.execute(query, (op_key,)).fetchone()
+            if record is not None:
+                connection.execute(
+                    "UPDATE compiled_operations SET last_access = ? WHERE op_key = ?", (time.time(), op_key))
+                connection.commit()
+                return record
+
+        for connection in self._prebuilt():
+            record = connection.execute(query, (op_key,)).fetchone()
+            if record is not None:
+                return record
+
+        return None
+
+    def insert(self, op_key, cubin, hostbin, op_name, op_attrs):
+        """
+        Adds a compiled operation, then evicts least recently used operations if the database exceeds its size
+        """
+        with contextlib.closing(self._connect()) as connection:
+            connection.execute(
+                """INSERT OR IGNORE INTO compiled_operations (op_key, cubin, hostbin, op_name, op_attrs, size, last_access)
+                   VALUES (?, ?, ?, ?, ?, ?, ?)""",
+                (op_key, cubin, hostbin, op_name, op_attrs, len(cubin) + len(hostbin), time.time()))
+            connection.commit()
+
+            if self.max_size > 0:
+                self._evict(connection)
+
+    def _evict(self, connection):
+        total_size, = connection.execute("SELECT COALESCE(SUM(size), 0) FROM compiled_operations").fetchone()
+        if total_size <= self.max_size:
+            return
+
+        evicted = []
+        for op_key, size in connection.execute("SELECT op_key, size FROM compiled_operations ORDER BY last_access"):
+            if total_size <= self.max_size:
+                break
+            evicted.append((op_key,))
+            total_size -= size
+
+        connection.executemany("DELETE FROM compiled_operations WHERE op_key = ?", evicted)
+        connection.commit()
+        logger.info(f"Evicted {len(evicted)} operations from the kernel cache {self.path}")
+
+    def export_bundle(self, path):
+        """
+        Writes a compacted copy of the database, to be used as a read-only prebuilt database by other processes
+        """
+        if os.path.exists(path):
+            os.remove(path)
+        with contextlib.closing(self._connect()) as connection:
+            connection.execute("VACUUM INTO ?", (path,))
+
+    @contextlib.contextmanager
+    def lock(self, op_keys):
+        """
+        Context manager holding an exclusive inter-process lock on a set of operation keys, so that processes
+        compiling the same operations wait for the first of them instead of compiling them again
+        """
+        if fcntl is None:
+            yield
+            return
+
+        lock_dir = self.path + ".locks"
+        os.makedirs(lock_dir, exist_ok=True)
+        lock_path = os.path.join(lock_dir, self.make_key(*sorted(op_keys)) + ".lock")
+
+        with open(lock_path, "a") as lock_file:
+            fcntl.flock(lock_file, fcntl.LOCK_EX)
+            try:
+                yield
+            finally:
+                fcntl.flock(lock_file, fcntl.LOCK_UN)
@@ -30,10 +30,10 @@
 #
 #################################################################################################
 
+from concurrent.futures import ThreadPoolExecutor
 import ctypes
 import json
 import os
-import sqlite3
 import subprocess
 import tempfile
 
@@ -44,7 +44,8 @@ nvrtc = lazy_import("cuda.nvrtc")
 from cutlass_library import SubstituteTemplate
 
 import cutlass_cppgen
-from cutlass_cppgen import CACHE_FILE, CUTLASS_PATH, cuda_install_path, logger
+from cutlass_cppgen import CACHE_FILE, CACHE_MAX_SIZE, COMPILE_JOBS, CUTLASS_PATH, PREBUILT_CACHE_FILES, cuda_install_path, logger
+from cutlass_cppgen.backend.compiled_cache import CompiledKernelCache
 from cutlass_cppgen.backend.gemm_operation import GemmOperationUniversal
 from cutlass_cppgen.backend.library import ApiVersion
 from cutlass_cppgen.backend.utils.device import device_cc
@@ -138,19 +139,7 @@ class ArtifactManager:
     """
 
     def __init__(self) -> None:
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        # Create the table if it does not already exist
-        sqlite_create_table_query = """
-        CREATE TABLE IF NOT EXISTS compiled_operations(op_key TEXT NOT NULL UNIQUE,
-                                                        cubin BLOB NOT NULL,
-                                                        hostbin BLOB NOT NULL,
-                                                        op_name TEXT NOT NULL,
-                                                        op_attrs TEXT NOT NULL)
-        """
-        cursor.execute(sqlite_create_table_query)
-        connection.commit()
-        cursor.close()
+        self.cache = CompiledKernelCache(CACHE_FILE, CACHE_MAX_SIZE, PREBUILT_CACHE_FILES)
 
         self._nvrtc_compile_options = ["-std=c++17", "-default-device"]
         self._nvcc_compile_options = [
@@ -159,6 +148,7 @@ class ArtifactManager:
             "-Xcudafe --diag_suppress=esa_on_defaulted_function_ignored",
         ]
         self.nvcc()
+        self.compile_jobs = COMPILE_JOBS
         self.compiled_cache_device = {}
         self.compiled_cache_host = {}
 
@@ -171,60 +161,47 @@ class ArtifactManager:
         self.default_compile_options = self._nvcc_compile_options
 
     def insert_operation(self, op_key, cubin, hostfile, op_name, op_attrs):
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        sqlite_insert_blob_query = """ INSERT OR IGNORE INTO compiled_operations (op_key, cubin, hostbin, op_name, op_attrs) VALUES (?, ?, ?, ?, ?)"""
-
         hostbin = convertToBinaryData(hostfile)
-
-        data_tuple = (op_key, cubin, hostbin, op_name, json.dumps(op_attrs))
-
-        cursor.execute(sqlite_insert_blob_query, data_tuple)
-        connection.commit()
-        cursor.close()
+        self.cache.insert(op_key, cubin, hostbin, op_name, json.dumps(op_attrs))
 
     def load_operation(self, op_key, extra_funcs):
-        connection = sqlite3.connect(CACHE_FILE)
-        cursor = connection.cursor()
-        sqlite_fetch_blob_query = """SELECT * from compiled_operations where op_key = ?"""
-        cursor.execute(sqlite_fetch_blob_query, (op_key,))
-        record = cursor.fetchall()
-        if len(record) == 0:
+        record = self.cache.lookup(op_key)
+        if record is None:
             return False
-        for row in record:
-            key, cubin_image, host_binary, operation_name, op_attr = row
-            op_attr = json.loads(op_attr)
-            err, module = cuda.cuModuleLoadData(cubin_image)
-            if err != cuda.CUresult.CUDA_SUCCESS:
-                raise RuntimeError("Cuda Error: {}".format(err))
 
-            err, kernel = cuda.cuModuleGetFunction(module, bytes(str.encode(operation_name)))
-            self.compiled_cache_device[key] = kernel
+        cubin_image, host_binary, operation_name, op_attr = record
+        op_attr = json.loads(op_attr)
+        err, module = cuda.cuModuleLoadData(cubin_image)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("Cuda Error: {}".format(err))
 
-            compiled_host_fns = {}
-            host_lib = CDLLBin(host_binary)
+        err, kernel = cuda.cuModuleGetFunction(module, bytes(str.encode(operation_name)))
+        self.compiled_cache_device[op_key] = kernel
 
-            func_name = operation_name + "_get_params"
-            func = getattr(host_lib, func_name)
-            func.restype = ctypes.POINTER(ctypes.c_char * op_attr[0])
-            compiled_host_fns["get_args"] = func
+        compiled_host_fns = {}
+        host_lib = CDLLBin(host_binary)
 
-            func_name = operation_name + "_shared_memory_size"
-            func = getattr(host_lib, func_name)
-            compiled_host_fns["shared_memory_capacity"] = func()
+        func_name = operation_name + "_get_params"
+        func = getattr(host_lib, func_name)
+        func.restype = ctypes.POINTER(ctypes.c_char * op_attr[0])
+        compiled_host_fns["get_args"] = func
 
-            for attr in op_attr:
-                if isinstance(attr, str):
-                    func_name = operation_name + "_" + attr
-                    func = getattr(host_lib, func_name)
+        func_name = operation_name + "_shared_memory_size"
+        func = getattr(host_lib, func_name)
+        compiled_host_fns["shared_memory_capacity"] = func()
 
-                    # Set the return type of the function
-                    if attr in extra_funcs and extra_funcs[attr] != None:
-                        func.restype = extra_funcs[attr]
+        for attr in op_attr:
+            if isinstance(attr, str):
+                func_name = operation_name + "_" + attr
+                func = getattr(host_lib, func_name)
 
-                    compiled_host_fns[attr] = func
+                # Set the return type of the function
+                if attr in extra_funcs and extra_funcs[attr] != None:
+                    func.restype = extra_funcs[attr]
 
-            self.compiled_cache_host[key] = compiled_host_fns
+                compiled_host_fns[attr] = func
+
+        self.compiled_cache_host[op_key] = compiled_host_fns
         return True
 
     def emit_compile_(self, operation_list, compilation_options, host_compilation_options):
@@ -355,9 +332,13 @@ class ArtifactManager:
 
         return cubin_image, host_lib, temp_dst
 
-    def add_module(self, operations, compile_options=None, bypass_cache=False):
+    def add_module(self, operations, compile_options=None, bypass_cache=False, jobs=None):
         """
         Insert a new compiled device module
+
+        Operations missing from the cache are split into up to ``jobs`` independent modules that are compiled
+        concurrently. ``jobs`` defaults to ``compile_jobs``, which is set from ``CUTLASS_COMPILE_JOBS``; a value of
+        0 uses one job per CPU.
         """
         include_paths = [
             cuda_install_path() + "/include",
@@ -374,89 +355,145 @@ class ArtifactManager:
         if compile_options is None:
             compile_options = CompilationOptions(
                 self.default_compile_options, arch, include_paths)
+        # The key of an operation covers everything its compiled images depend on, so that entries are never
+        # reused across CUDA versions, architectures, or compilation flags
+        key_settings = (arch, self.backend, cutlass_cppgen.nvcc_version(),
+                        compile_options.get_str(), host_compile_options.get_str())
+
         # save the cubin
         operation_key = []
         operation_list = []
         for operation in operations:
             # step 1: get kernel string as key
-            key = operation.rt_module.emit() + operation.procedural_name() + self.backend
+            key = CompiledKernelCache.make_key(operation.rt_module.emit(), operation.procedural_name(), *key_settings)
             # step 1: check if the operation is in cache
-            compiled_kernel = self.compiled_cache_device.get(key)
-
-            if compiled_kernel is None and not bypass_cache:
-                hit = self.load_operation(key, getattr( operation.rt_module, "extra_funcs", {}))
-                if hit:
-                    compiled_kernel = self.compiled_cache_device.get(key)
-                    assert compiled_kernel is not None
-            if compiled_kernel is not None:
-                operation.rt_module.kernel = compiled_kernel
-                compiled_host_fns = self.compiled_cache_host.get(key)
-                assert compiled_host_fns is not None
-                for key in compiled_host_fns.keys():
-                    setattr(operation.rt_module, key, compiled_host_fns[key])
-                operation.rt_module.initialize()
-            else:
+            if not self._load_cached(operation.rt_module, key, bypass_cache):
                 operation_list.append(operation.rt_module)
                 operation_key.append(key)
 
-        if len(operation_list) > 0:
-            cubin_image, host_lib, host_file = self.emit_compile_(
-                operation_list, compile_options, host_compile_options)
-
-            err, module = cuda.cuModuleLoadData(cubin_image)
-            if err != cuda.CUresult.CUDA_SUCCESS:
-                raise RuntimeError("Cuda Error: {}".format(err))
-
-            operation_name = []
-            operation_attr = []
-            for operation, key in zip(operation_list, operation_key):
-                # get device kernels
-                err, operation.kernel = cuda.cuModuleGetFunction(
-                    module,
-                    bytes(str.encode(operation.name()))
-                )
-                operation_name.append(operation.name())
-                self.compiled_cache_device[key] = operation.kernel
-                # get host functions
-                compiled_host_fns = {}
-                op_attr = []
-
-                # get param size
-                func_name = operation.name() + "_get_param_size"
-                func = getattr(host_lib, func_name)
-                param_size = func()
+        if len(operation_list) == 0:
+            return
 
-                func_name = operation.name() + "_get_params"
-                func = getattr(host_lib, func_name)
-                func.argtype = operation.argtype
-                func.restype = ctypes.POINTER(ctypes.c_char * param_size)
-                setattr(operation, "get_args", func)
-                compiled_host_fns["get_args"] = func
+        # Hold the lock while compiling so that other processes needing the same operations wait for them to be
+        # inserted rather than compiling them again
+        with self.cache.lock(operation_key):
+            if not bypass_cache:
+                missing = [(operation, key) for operation, key in zip(operation_list, operation_key)
+                           if not self._load_cached(operation, key, bypass_cache)]
+                operation_list = [operation for operation, _ in missing]
+                operation_key = [key for _, key in missing]
 
-                # set shared memory size
-                func_name = operation.name() + "_shared_memory_size"
-                func = getattr(host_lib, func_name)
-                setattr(operation, "shared_memory_capacity", func())
-                compiled_host_fns["shared_memory_capacity"] = func()
-                # set the maximum dynamic shared size
-                operation.initialize()
-
-                # get extra functions
-                op_attr.append(param_size)
-
-                if hasattr(operation, "extra_funcs"):
-                    for suffix, ret_type  in operation.extra_funcs.items():
-                        func_name = operation.name() + "_" + suffix
-                        func = getattr(host_lib, func_name)
-                        if ret_type is not None:
-                            func.restype = ret_type
-                        setattr(operation, suffix, func)
-                        compiled_host_fns[suffix] = func
-                        op_attr.append(suffix)
-
-                operation_attr.append(op_attr)
-                self.compiled_cache_host[key] = compiled_host_fns
-
-            for (key, operation_name, operation_attr,) in zip(operation_key, operation_name, operation_attr):
-                self.insert_operation(
-                    key, cubin_image, host_file.name, operation_name, operation_attr)
+            self._compile_and_insert(operation_list, operation_key, compile_options, host_compile_options, jobs)
+
+    def _load_cached(self, rt_module, key, bypass_cache):
+        """
+        Sets up ``rt_module`` from the in-memory or on-disk cache. Returns whether the operation was found
+        """
+        compiled_kernel = self.compiled_cache_device.get(key)
+
+        if compiled_kernel is None and not bypass_cache:
+            hit = self.load_operation(key, getattr(rt_module, "extra_funcs", {}))
+            if hit:
+                compiled_kernel = self.compiled_cache_device.get(key)
+                assert compiled_kernel is not None
+        if compiled_kernel is None:
+            return False
+
+        rt_module.kernel = compiled_kernel
+        compiled_host_fns = self.compiled_cache_host.get(key)
+        assert compiled_host_fns is not None
+        for name in compiled_host_fns.keys():
+            setattr(rt_module, name, compiled_host_fns[name])
+        rt_module.initialize()
+        return True
+
+    def _compile_and_insert(self, operation_list, operation_key, compile_options, host_compile_options, jobs=None):
+        """
+        Compiles operations into modules and inserts them into the cache
+        """
+        if len(operation_list) == 0:
+            return
+
+        if jobs is None:
+            jobs = self.compile_jobs
+        if jobs <= 0:
+            jobs = os.cpu_count() or 1
+        jobs = min(jobs, len(operation_list))
+
+        # Each job compiles every jobs-th operation as its own module
+        groups = [(operation_list[i::jobs], operation_key[i::jobs]) for i in range(jobs)]
+
+        if jobs == 1:
+            modules = [self.emit_compile_(operation_list, compile_options, host_compile_options)]
+        else:
+            # nvcc runs as a subprocess and NVRTC releases the GIL while compiling, so threads are sufficient
+            # and avoid pickling the operations for a process pool
+            with ThreadPoolExecutor(max_workers=jobs) as executor:
+                modules = list(executor.map(
+                    lambda group: self.emit_compile_(group[0], compile_options, host_compile_options), groups))
+
+        # Modules are loaded on the calling thread, which owns the CUDA context
+        for (group_operations, group_keys), (cubin_image, host_lib, host_file) in zip(groups, modules):
+            self._insert_module(group_operations, group_keys, cubin_image, host_lib, host_file)
+
+    def _insert_module(self, operation_list, operation_key, cubin_image, host_lib, host_file):
+        """
+        Loads a compiled module, sets up its operations, and inserts them into the cache
+        """
+        err, module = cuda.cuModuleLoadData(cubin_image)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("Cuda Error: {}".format(err))
+
+        operation_name = []
+        operation_attr = []
+        for operation, key in zip(operation_list, operation_key):
+            # get device kernels
+            err, operation.kernel = cuda.cuModuleGetFunction(
+                module,
+                bytes(str.encode(operation.name()))
+            )
+            operation_name.append(operation.name())
+            self.compiled_cache_device[key] = operation.kernel
+            # get host functions
+            compiled_host_fns = {}
+            op_attr = []
+
+            # get param size
+            func_name = operation.name() + "_get_param_size"
+            func = getattr(host_lib, func_name)
+            param_size = func()
+
+            func_name = operation.name() + "_get_params"
+            func = getattr(host_lib, func_name)
+            func.argtype = operation.argtype
+            func.restype = ctypes.POINTER(ctypes.c_char * param_size)
+            setattr(operation, "get_args", func)
+            compiled_host_fns["get_args"] = func
+
+            # set shared memory size
+            func_name = operation.name() + "_shared_memory_size"
+            func = getattr(host_lib, func_name)
+            setattr(operation, "shared_memory_capacity", func())
+            compiled_host_fns["shared_memory_capacity"] = func()
+            # set the maximum dynamic shared size
+            operation.initialize()
+
+            # get extra functions
+            op_attr.append(param_size)
+
+            if hasattr(operation, "extra_funcs"):
+                for suffix, ret_type  in operation.extra_funcs.items():
+                    func_name = operation.name() + "_" + suffix
+                    func = getattr(host_lib, func_name)
+                    if ret_type is not None:
+                        func.restype = ret_type
+                    setattr(operation, suffix, func)
+                    compiled_host_fns[suffix] = func
+                    op_attr.append(suffix)
+
+            operation_attr.append(op_attr)
+            self.compiled_cache_host[key] = compiled_host_fns
+
+        for (key, operation_name, operation_attr,) in zip(operation_key, operation_name, operation_attr):
+            self.insert_operation(
+                key, cubin_image, host_file.name, operation_name, operation_attr)
@@ -52,6 +52,7 @@ from cutlass_cppgen.backend.evt.passes import (
     PassGetArgumentType,
     PassGetImpl,
     PassFixElementD,
+    PassFusionPartition,
     PassLayoutManipulateElimination,
     PassPreprocessRed,
     PassShapeTypePropagation,
@@ -125,6 +126,25 @@ class EVTFrontendBase:
             self.arg_d_type = self.dag_ir.arg_d_type
         self.reduction_names = self.dag_ir.reduction_names
 
+    def plan_fusion(self, *args, register_budget: int = 128, smem_budget: int = 48 << 10, **kwargs):
+        """
+        Parses the epilogue and partitions it into the fewest fused epilogues within the given budgets,
+        without compiling it. This is useful for epilogues that consume the result of a reduction, which
+        cannot be traced into a single epilogue. The human-readable plan, including the estimated DRAM
+        traffic saved, is available in ``self.dag_ir.fusion_report`` afterwards.
+
+        :param register_budget: registers per thread available for epilogue values
+        :type register_budget: int
+        :param smem_budget: bytes of shared memory available to the epilogue
+        :type smem_budget: int
+
+        :return: the fused epilogues, in execution order
+        :rtype: list[cutlass_cppgen.backend.evt.passes.FusionPartition]
+        """
+        self.parse(*args, **kwargs)
+        PassFusionPartition(self.dag_ir, register_budget=register_budget, smem_budget=smem_budget)()
+        return self.dag_ir.fusion_partitions
+
     #
     # Helper functions for DAG IR manipulation
     #
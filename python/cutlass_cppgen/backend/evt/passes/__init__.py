@@ -35,6 +35,7 @@ from cutlass_cppgen.backend.evt.passes.pass_argument_type import PassGetArgument
 from cutlass_cppgen.backend.evt.passes.pass_dag_2_tree import PassDAG2Tree
 from cutlass_cppgen.backend.evt.passes.pass_get_impl import PassGetImpl
 from cutlass_cppgen.backend.evt.passes.pass_fix_element_d import PassFixElementD
+from cutlass_cppgen.backend.evt.passes.pass_fusion_partition import FusionPartition, PassFusionPartition
 from cutlass_cppgen.backend.evt.passes.pass_layout_elimination import PassLayoutManipulateElimination
 from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassManager
 from cutlass_cppgen.backend.evt.passes.pass_preprocess_red import PassPreprocessRed
@@ -0,0 +1,378 @@
+#################################################################################################
+#
+# Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Partition an epilogue DAG into the fewest fused epilogues.
+
+A traced epilogue can consume the result of a reduction, which is only complete once every CTA
+has reduced its tile, or can need more registers or shared memory than a single epilogue provides.
+This pass assigns each node to a fused epilogue such that:
+* a node consuming a reduction result runs in a later epilogue than the reduction,
+* the estimated registers and shared memory of each epilogue stay within budget.
+
+The first epilogue is the one fused with the GEMM mainloop. Values crossing epilogues are written to
+and read back from global memory, and the DRAM traffic saved compared with running each node as its
+own kernel is estimated from the tensor sizes.
+
+This is an analysis pass: it records the plan in ``dag_ir.fusion_partitions`` and a human-readable
+summary in ``dag_ir.fusion_report`` without modifying the DAG. It must run on the traced DAG, before
+``PassPreprocessRed`` folds reductions into their stores.
+"""
+
+from math import prod
+
+from cutlass_cppgen.backend.evt.ir import ComputeNode, LayoutNode, LoadNode, StoreNode
+from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassBase
+from cutlass_cppgen.backend.library import DataTypeSize
+
+
+class FusionPartition:
+    """
+    A fused epilogue of the fusion plan
+
+    :param index: position of the epilogue in execution order. Epilogue 0 is fused with the GEMM mainloop
+    :type index: int
+    """
+    def __init__(self, index: int) -> None:
+        self.index = index
+        # Nodes computed by the epilogue, in topological order
+        self.nodes = []
+        # Values read from global memory, including values materialized by earlier epilogues
+        self.inputs = []
+        # Values written to global memory: outputs of the epilogue DAG and values consumed by later epilogues
+        self.outputs = []
+        self.registers = 0
+        self.smem_bytes = 0
+        self.dram_read_bytes = 0
+        self.dram_write_bytes = 0
+
+    def __repr__(self) -> str:
+        return (f"FusionPartition({self.index}, nodes={self.nodes}, inputs={self.inputs}, "
+                f"outputs={self.outputs})")
+
+
+class PassFusionPartition(EVTPassBase):
+    """
+    Partition the DAG IR into the minimum number of fused epilogues within the register and shared
+    memory budgets
+
+    :param register_budget: registers per thread available for epilogue values
+    :type register_budget: int
+    :param smem_budget: bytes of shared memory available to the epilogue
+    :type smem_budget: int
+    :param cta_tile_mn: CTA tile shape (M, N)
+    :type cta_tile_mn: tuple
+    :param epilogue_tile_mn: epilogue subtile shape (M, N) processed by the threads at once
+    :type epilogue_tile_mn: tuple
+    :param threads: number of threads executing the epilogue
+    :type threads: int
+    """
+    dependencies = []
+
+    def __init__(self, dag_ir, register_budget: int = 128, smem_budget: int = 48 << 10,
+                 cta_tile_mn: tuple = (128, 128), epilogue_tile_mn: tuple = (64, 32), threads: int = 128) -> None:
+        super().__init__(dag_ir)
+        self.register_budget = register_budget
+        self.smem_budget = smem_budget
+        self.cta_tile_mn = cta_tile_mn
+        self.epilogue_tile_mn = epilogue_tile_mn
+        self.threads = threads
+        # Number of stages of the buffers staging tensors between global memory and registers
+        self.smem_stages = 2
+
+    def requires(self) -> None:
+        for node_meta in self.dag_ir.nodes_meta:
+            if isinstance(node_meta, StoreNode) and hasattr(node_meta, "reg_reduce_fn"):
+                raise RuntimeError(
+                    "PassFusionPartition must run before PassPreprocessRed folds reductions into their stores")
+
+    #
+    # Value properties
+    #
+
+    def is_reduction(self, node):
+        meta = self.dag_ir.get_node_meta(node)
+        return isinstance(meta, ComputeNode) and type(meta.fn) == tuple
+
+    def is_replicable(self, node):
+        """
+        Loads other than the accumulator can be issued again by any epilogue consuming them
+        """
+        meta = self.dag_ir.get_node_meta(node)
+        return isinstance(meta, LoadNode) and node != "accum"
+
+    def is_output(self, node):
+        meta = self.dag_ir.get_node_meta(node)
+        return isinstance(meta, StoreNode) and meta.is_output
+
+    def shape(self, node):
+        if node in self._shapes:
+            return self._shapes[node]
+
+        meta = self.dag_ir.get_node_meta(node)
+        inputs = self.dag_ir.get_all_inputs(node)
+        if isinstance(meta, LoadNode):
+            shape = tuple(meta.tensor.shape)
+        elif isinstance(meta, StoreNode) and meta.store_tensor is not None:
+            shape = tuple(meta.store_tensor.shape)
+        elif self.is_reduction(node):
+            # The reduced shape is that of the store receiving the reduction
+            users = self.dag_ir.get_users(node)
+            shape = self.shape(users[0]) if len(users) == 1 else self.shape(inputs[0])
+        elif isinstance(meta, (StoreNode, LayoutNode)):
+            shape = self.shape(inputs[0])
+        else:
+            # Elementwise nodes broadcast their inputs
+            shapes = [self.shape(input) for input in inputs]
+            rank = max(len(s) for s in shapes)
+            shapes = [(1,) * (rank - len(s)) + tuple(s) for s in shapes]
+            shape = tuple(max(dims) for dims in zip(*shapes))
+
+        self._shapes[node] = shape
+        return shape
+
+    def element_bits(self, node):
+        meta = self.dag_ir.get_node_meta(node)
+        if isinstance(meta, LoadNode):
+            return 0 if meta.tensor.is_constant else DataTypeSize[meta.tensor.element]
+        elif isinstance(meta, StoreNode) and meta.is_output:
+            return DataTypeSize[meta.store_tensor.element]
+        elif isinstance(meta, ComputeNode):
+            return DataTypeSize[meta.element_compute]
+        else:
+            return self.element_bits(self.dag_ir.get_all_inputs(node)[0])
+
+    def dram_bytes(self, node):
+        """
+        Bytes moved when the value of ``node`` is read from or written to global memory
+        """
+        return prod(self.shape(node)) * self.element_bits(node) // 8
+
+    def kind(self, node):
+        """
+        Returns whether the value of ``node`` is a "scalar", a "row" vector, a "column" vector, or a "tile"
+        """
+        shape = self.shape(node)
+        m = shape[-2] if len(shape) >= 2 else 1
+        n = shape[-1] if len(shape) >= 1 else 1
+        if m == 1 and n == 1:
+            return "scalar"
+        elif m == 1:
+            return "row"
+        elif n == 1:
+            return "column"
+        return "tile"
+
+    #
+    # Resource estimates
+    #
+
+    def value_registers(self, node):
+        if self.kind(node) == "scalar":
+            return 1
+        # Values are held in registers of at least 32 bits
+        elements_per_thread = prod(self.epilogue_tile_mn) // self.threads
+        return max(1, elements_per_thread * max(self.element_bits(node), 32) // 32)
+
+    def staging_smem(self, node):
+        """
+        Shared memory staging a value read from or written to global memory
+        """
+        bytes_per_element = self.element_bits(node) // 8
+        kind = self.kind(node)
+        if kind == "scalar":
+            return 0
+        elif kind == "row":
+            return self.cta_tile_mn[1] * bytes_per_element
+        elif kind == "column":
+            return self.cta_tile_mn[0] * bytes_per_element
+        return prod(self.epilogue_tile_mn) * bytes_per_element * self.smem_stages
+
+    def partition_resources(self, partition_nodes, imports, exports):
+        """
+        Returns the peak registers per thread and the shared memory of an epilogue computing
+        ``partition_nodes`` in order, reading ``imports`` and writing ``exports``
+        """
+        position = {node: idx for idx, node in enumerate(partition_nodes)}
+        last_use = {}
+        first_use = {}
+        for idx, node in enumerate(partition_nodes):
+            for input in self.dag_ir.get_all_inputs(node):
+                last_use[input] = idx
+                first_use.setdefault(input, idx)
+
+        registers = 0
+        for idx in range(len(partition_nodes)):
+            live = 0
+            for value, end in last_use.items():
+                start = position.get(value, first_use[value])
+                if start <= idx <= end:
+                    live += self.value_registers(value)
+            live += self.value_registers(partition_nodes[idx])
+            registers = max(registers, live)
+
+        smem = sum(self.staging_smem(value) for value in imports)
+        smem += sum(self.staging_smem(value) for value in exports)
+        for node in partition_nodes:
+            if self.is_reduction(node):
+                # Partial reductions of the threads are combined through shared memory
+                smem += self.threads * DataTypeSize[self.dag_ir.get_node_meta(node).element_compute] // 8
+        return registers, smem
+
+    #
+    # Partitioning
+    #
+
+    def levels(self, order):
+        """
+        Assigns each non-replicable node the earliest epilogue allowed by the reductions it depends on
+        """
+        level = {}
+        for node in order:
+            if self.is_replicable(node):
+                continue
+            level[node] = 0
+            for input in self.dag_ir.get_all_inputs(node):
+                if input not in level:
+                    continue
+                # The result of a reduction, stored by the node consuming it, is final only after the epilogue
+                producer_inputs = self.dag_ir.get_all_inputs(input)
+                reduced = (isinstance(self.dag_ir.get_node_meta(input), StoreNode) and
+                           len(producer_inputs) == 1 and self.is_reduction(producer_inputs[0]))
+                level[node] = max(level[node], level[input] + (1 if reduced else 0))
+        return level
+
+    def boundary(self, partition_nodes):
+        """
+        Returns the values read from and written to global memory by an epilogue computing ``partition_nodes``
+        """
+        members = set(partition_nodes)
+        imports = []
+        exports = []
+        for node in partition_nodes:
+            for input in self.dag_ir.get_all_inputs(node):
+                if input not in members and input not in imports:
+                    imports.append(input)
+            if self.is_output(node) or any(user not in members for user in self.dag_ir.get_users(node)):
+                exports.append(node)
+        # Constants are folded into the epilogue rather than read
+        imports = [value for value in imports if self.dram_bytes(value) > 0 or not self.is_replicable(value)]
+        return imports, exports
+
+    def call(self):
+        self._shapes = {}
+        order = self.dag_ir.nodes_topological_order()
+        level = self.levels(order)
+
+        # Greedily pack the nodes of each level into epilogues, starting a new one when a budget is exceeded
+        groups = []
+        for lvl in range(max(level.values(), default=-1) + 1):
+            current = []
+            for node in order:
+                if level.get(node) != lvl:
+                    continue
+                meta = self.dag_ir.get_node_meta(node)
+                if isinstance(meta, (LoadNode, StoreNode)):
+                    # The accumulator and stores cost no more than the value they name, so they join the
+                    # epilogue holding that value
+                    inputs = self.dag_ir.get_all_inputs(node)
+                    owner = next((group for group in groups if inputs and inputs[0] in group), current)
+                    owner.append(node)
+                    continue
+                candidate = current + [node]
+                imports, exports = self.boundary(candidate)
+                registers, smem = self.partition_resources(candidate, imports, exports)
+                computes = [n for n in current if not isinstance(self.dag_ir.get_node_meta(n), (LoadNode, StoreNode))]
+                if computes and (registers > self.register_budget or smem > self.smem_budget):
+                    groups.append(current)
+                    candidate = [node]
+                current = candidate
+            if current:
+                groups.append(current)
+
+        partitions = []
+        for idx, nodes in enumerate(groups):
+            partition = FusionPartition(idx)
+            partition.nodes = nodes
+            partition.inputs, partition.outputs = self.boundary(nodes)
+            partition.registers, partition.smem_bytes = self.partition_resources(
+                nodes, partition.inputs, partition.outputs)
+            partition.dram_read_bytes = sum(self.dram_bytes(value) for value in partition.inputs)
+            partition.dram_write_bytes = sum(self.dram_bytes(value) for value in partition.outputs)
+            partitions.append(partition)
+
+        fused_bytes = sum(p.dram_read_bytes + p.dram_write_bytes for p in partitions)
+        unfused_bytes = self.unfused_dram_bytes(order)
+
+        self.dag_ir.fusion_partitions = partitions
+        self.dag_ir.fusion_dram_bytes = fused_bytes
+        self.dag_ir.unfused_dram_bytes = unfused_bytes
+        self.dag_ir.fusion_dram_bytes_saved = unfused_bytes - fused_bytes
+        self.dag_ir.fusion_report = self.report(partitions, unfused_bytes, fused_bytes)
+
+    def unfused_dram_bytes(self, order):
+        """
+        Estimated DRAM traffic when the GEMM writes the accumulator and every other node runs as its own kernel
+        """
+        traffic = 0
+        for node in order:
+            meta = self.dag_ir.get_node_meta(node)
+            if isinstance(meta, LoadNode):
+                if node == "accum":
+                    traffic += self.dram_bytes(node)
+            elif isinstance(meta, StoreNode):
+                # Non-output stores only name a value. Outputs were written by their producer
+                continue
+            else:
+                traffic += sum(self.dram_bytes(input) for input in self.dag_ir.get_all_inputs(node))
+                traffic += self.dram_bytes(node)
+        return traffic
+
+    @staticmethod
+    def report(partitions, unfused_bytes, fused_bytes):
+        def fmt(nbytes):
+            for unit in ["B", "KiB", "MiB", "GiB"]:
+                if abs(nbytes) < 1024 or unit == "GiB":
+                    return f"{nbytes:.1f} {unit}" if unit != "B" else f"{nbytes} B"
+                nbytes /= 1024
+
+        lines = [f"EVT fusion plan: {len(partitions)} fused epilogue(s), epilogue 0 fused with the GEMM mainloop"]
+        for p in partitions:
+            lines.append(
+                f"  epilogue {p.index}: nodes {p.nodes}, reads {p.inputs}, writes {p.outputs}, "
+                f"~{p.registers} registers/thread, ~{p.smem_bytes} B smem, "
+                f"{fmt(p.dram_read_bytes)} read, {fmt(p.dram_write_bytes)} written")
+        saved = unfused_bytes - fused_bytes
+        percent = 100.0 * saved / unfused_bytes if unfused_bytes > 0 else 0.0
+        lines.append(f"Estimated DRAM traffic: {fmt(unfused_bytes)} unfused, {fmt(fused_bytes)} fused, "
+                     f"{fmt(saved)} saved ({percent:.1f}%)")
+        return "\n".join(lines)
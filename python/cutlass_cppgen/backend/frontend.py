@@ -31,6 +31,8 @@
 #################################################################################################
 from __future__ import annotations
 
+import ctypes
+
 from cutlass_cppgen.utils.lazy_import import lazy_import
 cuda = lazy_import("cuda.cuda")
 import numpy as np
@@ -45,19 +47,20 @@ class NumpyFrontend:
     """
 
     @staticmethod
-    def argument(np_tensor: "np.ndarray", is_output: "bool") -> cuda.CUdeviceptr:
+    def argument(np_tensor: "np.ndarray", is_output: "bool", stream=None) -> cuda.CUdeviceptr:
         """Convert the input numpy tensor to CUDA device pointer
 
         :param np_tensor: input numpy nd array
         :param is_output: whether the tensor is output
+        :param stream: stream on which the device memory is allocated and the data is copied
 
         :return: CUDA device pointer
         """
         # copy the data to device
         if is_output:
-            return device_mem_alloc(np_tensor.size * np_tensor.itemsize)
+            return device_mem_alloc(np_tensor.size * np_tensor.itemsize, stream)
         else:
-            return todevice(np_tensor)
+            return todevice(np_tensor, stream=stream)
 
 
 class TorchFrontend:
@@ -92,18 +95,70 @@ class CupyFrontend:
         return cuda.CUdeviceptr(int(cupy_ndarray.data.ptr))
 
 
+class _DLDevice(ctypes.Structure):
+    _fields_ = [("device_type", ctypes.c_int32), ("device_id", ctypes.c_int32)]
+
+
+class _DLDataType(ctypes.Structure):
+    _fields_ = [("code", ctypes.c_uint8), ("bits", ctypes.c_uint8), ("lanes", ctypes.c_uint16)]
+
+
+class _DLTensor(ctypes.Structure):
+    _fields_ = [
+        ("data", ctypes.c_void_p),
+        ("device", _DLDevice),
+        ("ndim", ctypes.c_int32),
+        ("dtype", _DLDataType),
+        ("shape", ctypes.POINTER(ctypes.c_int64)),
+        ("strides", ctypes.POINTER(ctypes.c_int64)),
+        ("byte_offset", ctypes.c_uint64),
+    ]
+
+
+class DLPackFrontend:
+    """
+    Frontend node for any tensor implementing the DLPack protocol (``__dlpack__`` and ``__dlpack_device__``),
+    such as JAX arrays. The device pointer is read from the exported tensor without copying
+    """
+
+    # DLPack device types of memory addressable by CUDA kernels: kDLCUDA, kDLCUDAHost, kDLCUDAManaged
+    cuda_device_types = [2, 3, 13]
+
+    @staticmethod
+    def is_dlpack_tensor(tensor) -> bool:
+        return hasattr(tensor, "__dlpack__") and hasattr(tensor, "__dlpack_device__")
+
+    @staticmethod
+    def argument(tensor) -> cuda.CUdeviceptr:
+        device_type, _ = tensor.__dlpack_device__()
+        if int(device_type) not in DLPackFrontend.cuda_device_types:
+            raise TypeError(f"DLPack tensor with device type {device_type} is not accessible by CUDA kernels")
+
+        capsule = tensor.__dlpack__()
+        get_pointer = ctypes.pythonapi.PyCapsule_GetPointer
+        get_pointer.restype = ctypes.c_void_p
+        get_pointer.argtypes = [ctypes.py_object, ctypes.c_char_p]
+
+        # DLManagedTensor begins with its DLTensor. The capsule is not consumed, so its destructor
+        # releases the export while ``tensor`` keeps owning the memory
+        dl_tensor = _DLTensor.from_address(get_pointer(capsule, b"dltensor"))
+        return cuda.CUdeviceptr((dl_tensor.data or 0) + dl_tensor.byte_offset)
+
+
 class TensorFrontend:
     """
     Universal Frontend for client-provide tensors
     """
 
     @staticmethod
-    def argument(tensor, is_output=False):
+    def argument(tensor, is_output=False, stream=None):
         if is_numpy_tensor(tensor):
-            return NumpyFrontend.argument(tensor, is_output)
+            return NumpyFrontend.argument(tensor, is_output, stream)
         elif is_torch_tensor(tensor):
             return TorchFrontend.argument(tensor)
         elif is_cupy_tensor(tensor):
             return CupyFrontend.argument(tensor)
+        elif DLPackFrontend.is_dlpack_tensor(tensor):
+            return DLPackFrontend.argument(tensor)
         else:
             raise NotImplementedError("Unknown Tensor Type")
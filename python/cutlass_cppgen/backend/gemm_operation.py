@@ -85,6 +85,7 @@ from cutlass_cppgen.backend.c_types import (
     get_gemm_arguments_3x,
     get_gemm_arguments_streamk,
     get_gemm_grouped_arguments,
+    get_gemm_grouped_visitor_arguments,
     get_mainloop_arguments_3x,
     get_tile_scheduler_arguments_3x,
 )
@@ -97,7 +98,7 @@ from cutlass_cppgen.backend.library import (
     TileDescription,
     api_version,
 )
-from cutlass_cppgen.backend.memory_manager import device_mem_alloc, todevice
+from cutlass_cppgen.backend.memory_manager import DevicePtrWrapper, device_mem_alloc, todevice
 from cutlass_cppgen.backend.operation import ExecutableOperation, LaunchConfiguration
 from cutlass_cppgen.backend.type_hint import GemmOperation, Tensor
 from cutlass_cppgen.backend.utils.device import device_sm_count
@@ -272,10 +273,10 @@ class GemmArguments2x(ArgumentBase):
                 ptr_C_addr += stride_C
                 ptr_D_addr += stride_D
 
-            self.ptr_A_array_buffer = todevice(self.ptr_A_array, dtype=np.int64)
-            self.ptr_B_array_buffer = todevice(self.ptr_B_array, dtype=np.int64)
-            self.ptr_C_array_buffer = todevice(self.ptr_C_array, dtype=np.int64)
-            self.ptr_D_array_buffer = todevice(self.ptr_D_array, dtype=np.int64)
+            self.ptr_A_array_buffer = todevice(self.ptr_A_array, dtype=np.int64, stream=self.stream)
+            self.ptr_B_array_buffer = todevice(self.ptr_B_array, dtype=np.int64, stream=self.stream)
+            self.ptr_C_array_buffer = todevice(self.ptr_C_array, dtype=np.int64, stream=self.stream)
+            self.ptr_D_array_buffer = todevice(self.ptr_D_array, dtype=np.int64, stream=self.stream)
 
         if isinstance(self.operation, GemmOperationUniversal):
             self.initialize()
@@ -332,10 +333,10 @@ class GemmArguments2x(ArgumentBase):
         device_workspace_size = self.operation.rt_module.get_device_workspace_size(self)
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -346,12 +347,9 @@ class GemmArguments2x(ArgumentBase):
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
 
-        self.get_arguments()
-
-        arguments, grid_tiled_shape, gemm_k_size = self.arguments
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(arguments), ctypes.c_void_p(int(device_workspace)))
-        host_workspace = bytearray(res_arg.contents)
+        self.device_workspace_size = device_workspace_size
+        self.device_workspace_ptr = device_workspace
+        host_workspace = self.pack_params()
 
         device_workspace = None
 
@@ -359,6 +357,17 @@ class GemmArguments2x(ArgumentBase):
         self.device_workspace = device_workspace
         self.launch_config = launch_config
 
+    def pack_params(self):
+        """
+        Returns the kernel parameters packed for the current operand pointers
+        """
+        self.get_arguments()
+
+        arguments, grid_tiled_shape, gemm_k_size = self.arguments
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(arguments), ctypes.c_void_p(int(self.device_workspace_ptr)))
+        return bytearray(res_arg.contents)
+
     def sync(self, stream_sync=True):
         super().sync(stream_sync)
         if hasattr(self.output_op, "sync"):
@@ -436,10 +445,10 @@ class GemmArguments2xStreamK(GemmArguments2x):
         )
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -450,16 +459,11 @@ class GemmArguments2xStreamK(GemmArguments2x):
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
 
+        self.device_workspace_size = device_workspace_size
+        self.device_workspace_ptr = device_workspace
+        host_workspace = self.pack_params()
         arguments = self.get_arguments()
 
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(arguments),
-            ctypes.c_void_p(int(device_workspace)),
-            device_sm_count(),
-            self.operation.rt_module.occupancy
-        )
-        host_workspace = bytearray(res_arg.contents)
-
         grid = self.operation.rt_module.get_grid_shape(
             ctypes.byref(arguments),
             device_sm_count(),
@@ -476,6 +480,18 @@ class GemmArguments2xStreamK(GemmArguments2x):
             self.operation.rt_module.shared_memory_capacity
         )
 
+    def pack_params(self):
+        """
+        Returns the kernel parameters packed for the current operand pointers
+        """
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(self.get_arguments()),
+            ctypes.c_void_p(int(self.device_workspace_ptr)),
+            device_sm_count(),
+            self.operation.rt_module.occupancy
+        )
+        return bytearray(res_arg.contents)
+
 
 class GemmArguments3x(GemmArguments2x):
     """
@@ -589,10 +605,10 @@ class GemmArguments3x(GemmArguments2x):
         device_workspace_size = self.operation.rt_module.get_device_workspace_size(self)
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -603,12 +619,9 @@ class GemmArguments3x(GemmArguments2x):
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
 
-        self.get_arguments()
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(self.arguments),
-            ctypes.c_void_p(int(device_workspace)),
-        )
-        host_workspace = bytearray(res_arg.contents)
+        self.device_workspace_size = device_workspace_size
+        self.device_workspace_ptr = device_workspace
+        host_workspace = self.pack_params()
 
         grid = self.operation.rt_module.get_grid_shape(
             ctypes.byref(self.arguments),
@@ -626,6 +639,17 @@ class GemmArguments3x(GemmArguments2x):
             self.operation.rt_module.shared_memory_capacity,
         )
 
+    def pack_params(self):
+        """
+        Returns the kernel parameters packed for the current operand pointers
+        """
+        self.get_arguments()
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(self.arguments),
+            ctypes.c_void_p(int(self.device_workspace_ptr)),
+        )
+        return bytearray(res_arg.contents)
+
 
 def GemmArguments(operation, problem_size, A, B, C, D, gemm_mode=GemmUniversalMode.Gemm, **kwargs):
     """
@@ -689,7 +713,8 @@ class GemmGroupedArguments:
     :param D: list of tensor D
     :type D: list[cuda.CUdeviceptr | numpy.ndarray | torch.Tensor | cupy.ndarray]
 
-    :param output_op: output operator, optional
+    :param output_op: output operator, optional. For operations with an epilogue visitor, this may
+                      also be a list holding one set of visitor arguments per problem
     :type output_op: :class:`cutlass_cppgen.backend.LinearCombinationFunctorArguments`
 
     :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
@@ -736,13 +761,17 @@ class GemmGroupedArguments:
 
         self.stream = kwargs.get("stream", cuda.CUstream(0))
 
+        # Per-problem visitor arguments are collected below rather than by each GemmArguments2x
+        per_problem_kwargs = {"output_op": None} if operation.uses_visitor else {}
+
         # Process the input arguments
         for idx, problem_size in enumerate(problem_sizes):
             M, N, K = problem_size.m, problem_size.n, problem_size.k
             temp_argument = GemmArguments2x(
                 operation=operation,
                 problem_size=GemmCoord(M, N, K),
-                A=A[idx], B=B[idx], C=C[idx], D=D[idx])
+                A=A[idx], B=B[idx], C=C[idx], D=D[idx],
+                **per_problem_kwargs)
             self.gemm_arguments.append(temp_argument)
 
             problem_size_host.append(
@@ -773,16 +802,41 @@ class GemmGroupedArguments:
             )
             self.total_tiles += grid.x * grid.y * grid.z
 
-        self.problem_size_buffer = todevice(problem_size_host, np.int32)
-        self.ptr_A_buffer = todevice(self.ptr_A_host, np.int64)
-        self.ptr_B_buffer = todevice(self.ptr_B_host, np.int64)
-        self.ptr_C_buffer = todevice(self.ptr_C_host, np.int64)
-        self.ptr_D_buffer = todevice(self.ptr_D_host, np.int64)
+        self.problem_size_buffer = todevice(problem_size_host, np.int32, stream=self.stream)
+        self.ptr_A_buffer = todevice(self.ptr_A_host, np.int64, stream=self.stream)
+        self.ptr_B_buffer = todevice(self.ptr_B_host, np.int64, stream=self.stream)
+        self.lda_buffer = todevice(lda_host, np.int64, stream=self.stream)
+        self.ldb_buffer = todevice(ldb_host, np.int64, stream=self.stream)
 
-        self.lda_buffer = todevice(lda_host, np.int64)
-        self.ldb_buffer = todevice(ldb_host, np.int64)
-        self.ldc_buffer = todevice(ldc_host, np.int64)
-        self.ldd_buffer = todevice(ldd_host, np.int64)
+        # Operations with an epilogue visitor load and store C and D through the visitor
+        if not self.operation.uses_visitor:
+            self.ptr_C_buffer = todevice(self.ptr_C_host, np.int64, stream=self.stream)
+            self.ptr_D_buffer = todevice(self.ptr_D_host, np.int64, stream=self.stream)
+            self.ldc_buffer = todevice(ldc_host, np.int64, stream=self.stream)
+            self.ldd_buffer = todevice(ldd_host, np.int64, stream=self.stream)
+
+        self._set_output_op(kwargs)
+
+        # Get host problem size
+        self.host_problem_size_ptr = np.array(problem_size_host, dtype=np.int32).__array_interface__["data"][0]
+
+        self.arguments = self.get_arguments()
+
+        self.initialize()
+
+    def _set_output_op(self, kwargs):
+        if self.operation.uses_visitor:
+            # One set of visitor arguments per problem, copied to the device as a contiguous array
+            output_op = kwargs["output_op"]
+            if not isinstance(output_op, (list, tuple)):
+                output_op = [output_op] * self.problem_count
+            if len(output_op) != self.problem_count:
+                raise Exception(f"Expected {self.problem_count} sets of epilogue visitor arguments, "
+                                f"got {len(output_op)}")
+            self.output_ops = list(output_op)
+            self.epilogue_buffer = todevice(
+                b"".join(bytes(op) for op in self.output_ops), stream=self.stream)
+            return
 
         if "output_op" in kwargs.keys():
             self.alpha = kwargs["output_op"].alpha
@@ -796,14 +850,20 @@ class GemmGroupedArguments:
         else:
             self.output_op = self.operation.epilogue_type(1.0, 0.0)
 
-        # Get host problem size
-        self.host_problem_size_ptr = np.array(problem_size_host, dtype=np.int32).__array_interface__["data"][0]
-
-        self.arguments = self.get_arguments()
-
-        self.initialize()
-
     def get_arguments(self):
+        if self.operation.uses_visitor:
+            return self.operation.argument_type(
+                int(self.problem_size_buffer.ptr),
+                self.problem_count,
+                self.total_tiles,
+                int(self.epilogue_buffer.ptr),
+                int(self.ptr_A_buffer.ptr),
+                int(self.ptr_B_buffer.ptr),
+                int(self.lda_buffer.ptr),
+                int(self.ldb_buffer.ptr),
+                ctypes.c_void_p(int(self.host_problem_size_ptr)),
+            )
+
         return self.operation.argument_type(
             self.problem_size_buffer.ptr,
             self.problem_count,
@@ -828,10 +888,10 @@ class GemmGroupedArguments:
         device_workspace_size = self.operation.rt_module.get_device_workspace_size(self)
 
         if device_workspace_size > 0:
-            self.workspace_buffer = device_mem_alloc(device_workspace_size)
+            self.workspace_buffer = device_mem_alloc(device_workspace_size, self.stream)
             workspace_ptr = self.workspace_buffer.ptr
-            err, = cuda.cuMemsetD32(
-                workspace_ptr, 0, device_workspace_size // 4)
+            err, = cuda.cuMemsetD32Async(
+                workspace_ptr, 0, device_workspace_size // 4, self.stream)
         else:
             workspace_ptr = None
 
@@ -860,6 +920,85 @@ class GemmGroupedArguments:
             raise RuntimeError("CUDA Error %s" % str(err))
         for arg in self.gemm_arguments:
             arg.sync(stream_sync=False)
+        for output_op in getattr(self, "output_ops", []):
+            if hasattr(output_op, "sync"):
+                output_op.sync()
+
+
+class GemmGroupedDeviceArguments(GemmGroupedArguments):
+    """
+    Argument wrapper for GEMM Grouped whose problem sizes, operand pointers, and leading
+    dimensions already reside in device memory, e.g., when produced by a preceding routing kernel.
+    None of these arrays are read on the host, so the group can be launched without a device-to-host
+    round trip.
+
+    Since the number of tiles is not known on the host, the persistent kernel is launched with
+    ``threadblock_count`` threadblocks, which defaults to the number of threadblocks that can be
+    resident on the device at once. This requires the operation to be scheduled on the device
+    (``SchedulerMode.Device``).
+
+    :param operation: the GEMM Grouped operation to take the argument
+    :type operation: :class:`cutlass_cppgen.backend.GemmOperationGrouped`
+    :param problem_count: number of problems in the group
+    :type problem_count: int
+    :param problem_sizes: device pointer to ``problem_count`` ``cutlass::gemm::GemmCoord`` (three int32 each)
+    :type problem_sizes: int
+    :param ptr_A: device pointer to ``problem_count`` int64 addresses of operands A
+    :param ptr_B: device pointer to ``problem_count`` int64 addresses of operands B
+    :param ptr_C: device pointer to ``problem_count`` int64 addresses of operands C. Unused with an epilogue visitor
+    :param ptr_D: device pointer to ``problem_count`` int64 addresses of operands D. Unused with an epilogue visitor
+    :param lda: device pointer to ``problem_count`` int64 leading dimensions of operands A
+    :param ldb: device pointer to ``problem_count`` int64 leading dimensions of operands B
+    :param ldc: device pointer to ``problem_count`` int64 leading dimensions of operands C. Unused with an epilogue visitor
+    :param ldd: device pointer to ``problem_count`` int64 leading dimensions of operands D. Unused with an epilogue visitor
+    :param threadblock_count: number of persistent threadblocks to launch, optional
+    :type threadblock_count: int
+    :param output_op: output operator, optional. For operations with an epilogue visitor, this may
+                      also be a list holding one set of visitor arguments per problem
+    :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+    :type stream: :class:`cuda.cuda.CUstream`
+    """
+
+    def __init__(self, operation, problem_count, problem_sizes, ptr_A, ptr_B, ptr_C, ptr_D,
+                 lda, ldb, ldc, ldd, threadblock_count=None, **kwargs):
+        if operation.precompute_mode != SchedulerMode.Device:
+            raise Exception("Device-resident problem arrays require SchedulerMode.Device")
+        if operation.switched:
+            raise Exception("Device-resident problem arrays are only supported for row-major C and D, "
+                            "as the kernel cannot exchange operands A and B of each problem")
+
+        self.operation = operation
+        self.problem_count = problem_count
+        self.partitions = 1
+        self.gemm_arguments = []
+        self.stream = kwargs.get("stream", cuda.CUstream(0))
+
+        # The arrays are owned by the caller. Wrap them so that they are accessed like buffers
+        # allocated by ``GemmGroupedArguments``
+        def wrap(ptr):
+            return DevicePtrWrapper(int(ptr) if ptr is not None else 0)
+
+        self.problem_size_buffer = wrap(problem_sizes)
+        self.ptr_A_buffer = wrap(ptr_A)
+        self.ptr_B_buffer = wrap(ptr_B)
+        self.ptr_C_buffer = wrap(ptr_C)
+        self.ptr_D_buffer = wrap(ptr_D)
+        self.lda_buffer = wrap(lda)
+        self.ldb_buffer = wrap(ldb)
+        self.ldc_buffer = wrap(ldc)
+        self.ldd_buffer = wrap(ldd)
+
+        if threadblock_count is None:
+            threadblock_count = device_sm_count() * operation.rt_module.occupancy
+        self.total_tiles = threadblock_count
+
+        self._set_output_op(kwargs)
+
+        self.host_problem_size_ptr = 0
+
+        self.arguments = self.get_arguments()
+
+        self.initialize()
 
 
 ################################################################################
@@ -1455,9 +1594,26 @@ ${operation_name}(${operation_name}${operation_suffix}::Params params) {
             "get_grid_shape": dim3_,
         }
         self.emitter = EmitGemmGroupedInstance("_type")
-        self.argument_type, self.epilogue_type = get_gemm_grouped_arguments(operation.epilogue_functor)
+        self._occupancy = None
+        if hasattr(operation.epilogue_functor, "visitor"):
+            self.argument_type, self.epilogue_type = get_gemm_grouped_visitor_arguments(operation.epilogue_functor)
+        else:
+            self.argument_type, self.epilogue_type = get_gemm_grouped_arguments(operation.epilogue_functor)
         self.argtype = [ctypes.POINTER(self.argument_type), ctypes.c_int, ctypes.c_void_p]
 
+    @property
+    def occupancy(self):
+        if self._occupancy is None:
+            err, self._occupancy = cuda.cuOccupancyMaxActiveBlocksPerMultiprocessorWithFlags(
+                self.kernel, self.threads, self.shared_memory_capacity,
+                cuda.CUoccupancy_flags.CU_OCCUPANCY_DISABLE_CACHING_OVERRIDE)
+
+            if err != cuda.CUresult.CUDA_SUCCESS:
+                raise RuntimeError(
+                    "CUDA error on call to cuOccupancyMaxActiveBlocksPerMultiprocessorWithFlags: "
+                    f"{cuda.cuGetErrorString(err)[1]}")
+        return self._occupancy
+
     def host_precompute(self, arguments, workspace_bytes):
         self.precompute.argtype = [
             self.argtype[0], ctypes.c_int, ctypes.c_longlong]
@@ -1470,7 +1626,7 @@ ${operation_name}(${operation_name}${operation_suffix}::Params params) {
         problem_info_array = bytearray(problem_info.contents)
 
         # copy to device memory
-        return todevice(problem_info_array).ptr
+        return todevice(problem_info_array, stream=arguments.stream).ptr
 
     def plan(self, arguments):
         return LaunchConfiguration(
@@ -1781,6 +1937,9 @@ class GemmOperationGrouped(GemmOperationBase):
                                                    A, B, C, epilogue_functor, swizzling_functor, **kwargs)
         assert "precompute_mode" in kwargs.keys(), "missing keyword arguement 'precompute_mode'."
         self.precompute_mode = kwargs["precompute_mode"]
+        self.uses_visitor = hasattr(epilogue_functor, "visitor")
+        if self.uses_visitor and self.switched:
+            raise Exception("Grouped GEMM with an epilogue visitor only supports row-major C and D")
         self.rt_module = GemmRTGrouped(self)
         self.argument_type = self.rt_module.argument_type
         self.epilogue_type = self.rt_module.epilogue_type
@@ -2083,6 +2242,43 @@ struct ${operation_name}${operation_suffix} :
 using DeviceKernel = cutlass::gemm::device::GemmGrouped<${operation_name}_base>;
 """
         )
+        self.gemm_template_kernel_visitor = """
+
+using OutputTileThreadMap = cutlass::epilogue::threadblock::OutputTileThreadLayout<
+    cutlass::gemm::GemmShape<${threadblock_shape_m}, ${threadblock_shape_n}, ${threadblock_shape_k}>,
+    cutlass::gemm::GemmShape<${warp_shape_m}, ${warp_shape_n}, ${warp_shape_k}>,
+    ${element_c},
+    ${align_c},
+    ${epilogue_stages} /* epilogue stages */
+>;
+
+${callback_decl}
+
+// Gemm operator ${operation_name}
+using ${operation_name}_base =
+  typename cutlass::gemm::kernel::DefaultGemmGroupedWithVisitor<
+    ${element_a}, ${layout_a}, ${transform_a}, ${align_a},
+    ${element_b}, ${layout_b}, ${transform_b}, ${align_b},
+    ${element_c}, ${layout_c}, ${align_c},
+    ${element_accumulator},
+    ${element_epilogue},
+    ${opcode_class},
+    ${arch},
+    cutlass::gemm::GemmShape<${threadblock_shape_m}, ${threadblock_shape_n}, ${threadblock_shape_k}>,
+    cutlass::gemm::GemmShape<${warp_shape_m}, ${warp_shape_n}, ${warp_shape_k}>,
+    cutlass::gemm::GemmShape<${instruction_shape_m}, ${instruction_shape_n}, ${instruction_shape_k}>,
+    ${callback_name},
+    ${swizzling_functor},
+    ${stages},
+    ${precompute_mode},
+    ${math_operation},
+    ${epilogue_stages} /* epilogue stages */
+>::GemmKernel;
+
+// Define named type
+struct ${operation_name}${operation_suffix} :
+  public ${operation_name}_base { };
+"""
 
     def instance_template(self):
         return """
@@ -2102,9 +2298,6 @@ ${compile_guard_end}
         instance_layout_A, instance_layout_B, instance_layout_C = \
             (operation.A.layout, operation.B.layout, operation.C.layout)
 
-        # Support built-in epilogue functors or user-defined functions
-        epilogue_functor = operation.epilogue_functor.emit()
-
         values = {
             "operation_name": operation.procedural_name(),
             "operation_suffix": self.operation_suffix,
@@ -2126,7 +2319,6 @@ ${compile_guard_end}
             "instruction_shape_m": str(operation.tile_description.math_instruction.instruction_shape[0]),
             "instruction_shape_n": str(operation.tile_description.math_instruction.instruction_shape[1]),
             "instruction_shape_k": str(operation.tile_description.math_instruction.instruction_shape[2]),
-            "epilogue_functor": epilogue_functor,
             "swizzling_functor": SwizzlingFunctorTag[operation.swizzling_functor],
             "stages": str(operation.tile_description.stages),
             "align_a": str(operation.A.alignment),
@@ -2137,6 +2329,28 @@ ${compile_guard_end}
             "math_operation": MathOperationTag[operation.tile_description.math_instruction.math_operation],
         }
 
+        if hasattr(operation.epilogue_functor, "visitor"):
+            if operation.emission_type != EmissionType.Kernel:
+                raise Exception("Grouped GEMM with an epilogue visitor is only emitted as a kernel")
+            self.includes += [
+                "cutlass/epilogue/threadblock/fusion/visitors.hpp",
+                "cutlass/gemm/kernel/default_gemm_grouped_with_visitor.h"
+            ]
+            callback_name, callback_decl = operation.epilogue_functor.emit(operation)
+            values["callback_name"] = callback_name
+            values["callback_decl"] = callback_decl
+            values["align_c"] = str(operation.C.alignment)
+            values["element_epilogue"] = DataTypeTag[operation.epilogue_functor.element_epilogue]
+            if hasattr(operation.epilogue_functor, "epilogue_stages"):
+                epilogue_stages = operation.epilogue_functor.epilogue_stages
+            else:
+                epilogue_stages = 1
+            values["epilogue_stages"] = str(epilogue_stages)
+            return SubstituteTemplate(self.gemm_template_kernel_visitor, values)
+
+        # Support built-in epilogue functors or user-defined functions
+        values["epilogue_functor"] = operation.epilogue_functor.emit()
+
         if operation.emission_type == EmissionType.Kernel:
             gemm_template = self.gemm_template_kernel
         else:
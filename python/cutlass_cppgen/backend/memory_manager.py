@@ -30,6 +30,9 @@
 #
 #################################################################################################
 
+import ctypes
+import threading
+
 import numpy as np
 
 import cutlass_cppgen
@@ -39,6 +42,7 @@ from cutlass_cppgen.utils.lazy_import import lazy_import
 if cutlass_cppgen.use_rmm:
     import rmm
 else:
+    cuda = lazy_import("cuda.cuda")
     cudart = lazy_import("cuda.cudart")
 
 
@@ -56,57 +60,186 @@ class PoolMemoryManager:
         return self.pool.pool_size()
 
 
+class PinnedStagingPool:
+    """
+    Page-locked host buffers used as the source of asynchronous host-to-device copies. A buffer is reused
+    once the event recorded after the last copy issued from it has completed, so staging never waits on
+    the device and pinned memory is only allocated while the pool grows.
+    """
+    def __init__(self) -> None:
+        self.buffers = []
+        self.lock = threading.Lock()
+
+    def _acquire(self, nbytes):
+        with self.lock:
+            for i, (ptr, size, event) in enumerate(self.buffers):
+                if size >= nbytes and cudart.cudaEventQuery(event)[0] == cudart.cudaError_t.cudaSuccess:
+                    # Remove the buffer while in use so that concurrent copies do not share it
+                    return self.buffers.pop(i)
+
+        size = align_size(max(nbytes, 4096), 4096)
+        err, ptr = cudart.cudaHostAlloc(size, cudart.cudaHostAllocDefault)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaHostAlloc failed with error {err}")
+        err, event = cudart.cudaEventCreateWithFlags(cudart.cudaEventDisableTiming)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaEventCreateWithFlags failed with error {err}")
+        return ptr, size, event
+
+    def copy_to_device(self, dev_ptr, host_bytes, stream):
+        """
+        Copies ``host_bytes`` to ``dev_ptr`` asynchronously on ``stream``
+        """
+        nbytes = len(host_bytes)
+        ptr, size, event = self._acquire(nbytes)
+        ctypes.memmove(ptr, host_bytes, nbytes)
+
+        err, = cudart.cudaMemcpyAsync(dev_ptr, ptr, nbytes, cudart.cudaMemcpyKind.cudaMemcpyHostToDevice, stream)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaMemcpyAsync failed with error {err}")
+        err, = cudart.cudaEventRecord(event, stream)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaEventRecord failed with error {err}")
+
+        with self.lock:
+            self.buffers.append((ptr, size, event))
+
+
+class StreamOrderedMemoryManager:
+    """
+    Allocates device memory from the current device's default CUDA memory pool with ``cudaMallocAsync``.
+    Allocations and frees are ordered on the stream of the operation using them, and the pool keeps up to
+    ``max_pool_size`` bytes of freed memory reserved so that steady-state allocations never reach the driver.
+    """
+    def __init__(self, max_pool_size: int) -> None:
+        err, device = cudart.cudaGetDevice()
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaGetDevice failed with error {err}")
+        err, self.pool = cudart.cudaDeviceGetDefaultMemPool(device)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaDeviceGetDefaultMemPool failed with error {err}")
+        err, = cudart.cudaMemPoolSetAttribute(
+            self.pool, cudart.cudaMemPoolAttr.cudaMemPoolAttrReleaseThreshold, cuda.cuuint64_t(max_pool_size))
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaMemPoolSetAttribute failed with error {err}")
+        self.staging = PinnedStagingPool()
+
+    @staticmethod
+    def is_supported():
+        err, device = cudart.cudaGetDevice()
+        if err != cudart.cudaError_t.cudaSuccess:
+            return False
+        err, supported = cudart.cudaDeviceGetAttribute(cudart.cudaDeviceAttr.cudaDevAttrMemoryPoolsSupported, device)
+        return err == cudart.cudaError_t.cudaSuccess and supported != 0
+
+    def allocate(self, size, stream):
+        err, ptr = cudart.cudaMallocAsync(size, stream)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaMallocAsync failed with error {err}")
+        return DevicePtrWrapper(ptr, stream)
+
+    def pool_size(self):
+        err, size = cudart.cudaMemPoolGetAttribute(self.pool, cudart.cudaMemPoolAttr.cudaMemPoolAttrReservedMemCurrent)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise Exception(f"cudaMemPoolGetAttribute failed with error {err}")
+        return int(size)
+
+
 class DevicePtrWrapper:
     """
     Wrapper around a pointer to device memory to provide a uniform interface with the RMM DeviceBuffer
-    (at least in terms of the interface used by the CUTLASS Python interface)
+    (at least in terms of the interface used by the CUTLASS Python interface). ``stream`` is the stream
+    on which memory allocated from a stream-ordered pool is freed, or None for memory from ``cudaMalloc``
     """
-    def __init__(self, dev_ptr):
+    def __init__(self, dev_ptr, stream=None):
         self.dev_ptr = dev_ptr
+        self.stream = stream
 
     @property
     def ptr(self):
         return self.dev_ptr
 
 
-def _todevice(host_data):
+def _stream_ordered_pool():
+    pool = cutlass_cppgen.get_memory_pool()
+    return pool if isinstance(pool, StreamOrderedMemoryManager) else None
+
+
+def _todevice(host_data, stream=None):
     """
     Helper for transferring host data to device memory
     """
     if cutlass_cppgen.use_rmm:
         return rmm.DeviceBuffer.to_device(host_data.tobytes())
-    else:
-        nbytes = len(host_data.tobytes())
-        dev_ptr_wrapper = device_mem_alloc(nbytes)
-        err, = cudart.cudaMemcpy(
-            dev_ptr_wrapper.ptr,
-            host_data.__array_interface__['data'][0],
-            nbytes,
-            cudart.cudaMemcpyKind.cudaMemcpyHostToDevice
-        )
-        if err != cudart.cudaError_t.cudaSuccess:
-            raise Exception(f"cudaMemcpy failed with error {err}")
+
+    host_bytes = host_data.tobytes()
+    nbytes = len(host_bytes)
+    pool = _stream_ordered_pool()
+    if pool is not None:
+        if stream is None:
+            stream = cuda.CUstream(0)
+        dev_ptr_wrapper = pool.allocate(nbytes, stream)
+        pool.staging.copy_to_device(dev_ptr_wrapper.ptr, host_bytes, stream)
         return dev_ptr_wrapper
 
+    dev_ptr_wrapper = device_mem_alloc(nbytes)
+    err, = cudart.cudaMemcpy(
+        dev_ptr_wrapper.ptr,
+        host_data.__array_interface__['data'][0],
+        nbytes,
+        cudart.cudaMemcpyKind.cudaMemcpyHostToDevice
+    )
+    if err != cudart.cudaError_t.cudaSuccess:
+        raise Exception(f"cudaMemcpy failed with error {err}")
+    return dev_ptr_wrapper
 
-def todevice(host_data, dtype=np.float32):
+
+def todevice(host_data, dtype=np.float32, stream=None):
     """
-    Pass the host_data to device memory
+    Pass the host_data to device memory. With a stream-ordered memory pool the copy is asynchronous on
+    ``stream`` and goes through pinned staging memory
     """
     if isinstance(host_data, list):
-        return _todevice(np.array(host_data, dtype=dtype))
+        return _todevice(np.array(host_data, dtype=dtype), stream)
     elif is_numpy_tensor(host_data):
-        return _todevice(host_data)
+        return _todevice(host_data, stream)
+    elif isinstance(host_data, (bytes, bytearray)):
+        return _todevice(np.frombuffer(host_data, dtype=np.uint8), stream)
 
 
-def device_mem_alloc(size):
+def device_mem_alloc(size, stream=None):
+    """
+    Allocates ``size`` bytes of device memory. With a stream-ordered memory pool the allocation is ordered
+    on ``stream``
+    """
     if cutlass_cppgen.use_rmm:
         return rmm.DeviceBuffer(size=size)
+
+    pool = _stream_ordered_pool()
+    if pool is not None:
+        return pool.allocate(size, stream if stream is not None else cuda.CUstream(0))
+
+    err, ptr = cudart.cudaMalloc(size)
+    if err != cudart.cudaError_t.cudaSuccess:
+        raise Exception(f"cudaMalloc failed with error {err}")
+    return DevicePtrWrapper(ptr)
+
+
+def device_mem_free(buffer):
+    """
+    Frees memory returned by ``device_mem_alloc`` or ``todevice``. RMM buffers are freed when destroyed
+    """
+    if not isinstance(buffer, DevicePtrWrapper):
+        return
+
+    if buffer.stream is not None:
+        err, = cudart.cudaFreeAsync(buffer.ptr, buffer.stream)
+        if err != cudart.cudaError_t.cudaSuccess:
+            raise RuntimeError(f"cudaFreeAsync failed with error {err}")
     else:
-        err, ptr = cudart.cudaMalloc(size)
+        err, = cudart.cudaFree(buffer.ptr)
         if err != cudart.cudaError_t.cudaSuccess:
-            raise Exception(f"cudaMalloc failed with error {err}")
-        return DevicePtrWrapper(ptr)
+            raise RuntimeError(f"cudaFree failed with error {err}")
 
 
 def align_size(size, alignment=256):
@@ -117,5 +250,11 @@ def create_memory_pool(init_pool_size=0, max_pool_size=2 ** 34):
     if cutlass_cppgen.use_rmm:
         memory_pool = PoolMemoryManager(init_pool_size=init_pool_size, max_pool_size=max_pool_size)
         return memory_pool
+    elif cutlass_cppgen.use_stream_ordered_pool:
+        if not StreamOrderedMemoryManager.is_supported():
+            cutlass_cppgen.logger.info("CUDA memory pools are not supported by the device. Using cudaMalloc")
+            cutlass_cppgen.use_stream_ordered_pool = False
+            return None
+        return StreamOrderedMemoryManager(max_pool_size=max_pool_size)
     else:
         return None
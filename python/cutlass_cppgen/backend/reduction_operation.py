@@ -51,7 +51,7 @@ import cutlass_cppgen
 from cutlass_cppgen.backend.c_types import MatrixCoord_, TensorRef2D_, get_reduction_params
 from cutlass_cppgen.backend.frontend import NumpyFrontend, TorchFrontend
 from cutlass_cppgen.backend.library import TensorDescription
-from cutlass_cppgen.backend.memory_manager import DevicePtrWrapper
+from cutlass_cppgen.backend.memory_manager import device_mem_free
 from cutlass_cppgen.backend.operation import ExecutableOperation, LaunchConfiguration
 from cutlass_cppgen.shape import MatrixCoord
 from cutlass_cppgen.utils.datatypes import is_numpy_tensor, is_torch_tensor
@@ -95,8 +95,8 @@ class ReductionArguments:
 
         if is_numpy_tensor(destination):
             self.host_D = destination
-            self.destination_buffer = NumpyFrontend.argument(destination, True)
-            self.source_buffer = NumpyFrontend.argument(source, False)
+            self.destination_buffer = NumpyFrontend.argument(destination, True, self.stream)
+            self.source_buffer = NumpyFrontend.argument(source, False, self.stream)
             self.ptr_destination = cuda.CUdeviceptr(self.destination_buffer.ptr)
             self.ptr_source = cuda.CUdeviceptr(self.source_buffer.ptr)
         elif is_torch_tensor(destination):
@@ -203,12 +203,7 @@ class ReductionArguments:
         if not cutlass_cppgen.use_rmm:
             for attr in ["destination_buffer", "source_buffer"]:
                 if hasattr(self, attr):
-                    buf = getattr(self, attr)
-                    if isinstance(buf, DevicePtrWrapper):
-                        err, = cudart.cudaFree(buf.ptr)
-                        if err != cudart.cudaError_t.cudaSuccess:
-                            raise RuntimeError(f"cudaFree failed with error {err}")
-                        del buf
+                    device_mem_free(getattr(self, attr))
 
 
 class ReductionRT(ExecutableOperation):
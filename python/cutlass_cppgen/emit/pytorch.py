@@ -76,32 +76,51 @@ The module can later be used in Python via:
 
     # Run the module
     D = cutlass_gemm.run(A, B, C)
+
+A module that dispatches among several kernels tuned for a known set of problem sizes can be
+generated via ``pytorch_tuned_gemm``, which profiles candidate kernels on those problem sizes when
+the source is generated:
+
+.. highlight:: python
+.. code-block:: python
+
+    plan = cutlass_cppgen.op.Gemm(element=torch.float16, layout=cutlass_cppgen.LayoutType.RowMajor)
+    shapes = [(4096, 4096, 4096), (128, 4096, 4096), (8, 4096, 1024)]
+    cutlass_cppgen.emit.pytorch_tuned_gemm(plan, 'cutlass_gemm', 80, shapes, max_kernels=2, sourcedir='output')
+
+In this case, ``output`` contains ``setup.py``, ``cutlass_gemm.cpp``, and one file ``cutlass_gemm_<i>_kernel.cu``
+per selected kernel. The resulting module exposes the same ``run`` method as above.
 """
 
+import copy
 import logging
+import math
 import os
 
-from cutlass_library import ConvKind, ConvKindNames, DataType, SubstituteTemplate
+from cutlass_library import ConvKind, ConvKindNames, DataType, LayoutType, SubstituteTemplate
 
 from cutlass_cppgen import CUTLASS_PATH, logger, swizzle
 from cutlass_cppgen.backend.gemm_operation import GemmOperationGrouped, GemmOperationUniversal
 from cutlass_cppgen.backend.conv2d_operation import Conv2dOperation
 from cutlass_cppgen.backend.library import ApiVersion
 from cutlass_cppgen.emit import common
+from cutlass_cppgen.utils import datatypes
 from cutlass_cppgen.utils.datatypes import is_torch_available
 
 if is_torch_available():
     import torch
 
 
-_PYTORCH_CUDA_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
+_PYTORCH_CUDA_INCLUDES = """
 #include <cuda_runtime.h>
 #include <torch/extension.h>
 #include <ATen/ATen.h>
 #include <ATen/cuda/CUDAContext.h>
 #include "cutlass/cutlass.h"
 #include "cutlass/util/device_memory.h"
+"""
 
+_PYTORCH_DEVICE_MEMORY_ALLOCATION = """
 // helper function allocating the memory
 void* device_memory_allocation(size_t size, int device_id=0) {
     if (size > 0) {
@@ -114,10 +133,28 @@ void* device_memory_allocation(size_t size, int device_id=0) {
         return nullptr;
     }
 }
+"""
+
+_PYTORCH_CUDA_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + _PYTORCH_CUDA_INCLUDES + _PYTORCH_DEVICE_MEMORY_ALLOCATION + """
+${includes}
+${declaration}
+${impl}
+"""
 
+# Each kernel of a tuned extension is compiled in its own translation unit. Its definitions are
+# placed in a namespace so that the helpers and aliases shared by all kernels do not collide at link time.
+_PYTORCH_TUNED_GEMM_CUDA_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + _PYTORCH_CUDA_INCLUDES + """
 ${includes}
+
+namespace ${name}_impl {
+""" + _PYTORCH_DEVICE_MEMORY_ALLOCATION + """
 ${declaration}
 ${impl}
+} // namespace ${name}_impl
+
+at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C, float alpha, float beta) {
+    return ${name}_impl::${name}_kernel(A, B, C, alpha, beta);
+}
 """
 
 _PYTORCH_GEMM_CPP_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
@@ -138,6 +175,88 @@ PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
 }
 """
 
+_PYTORCH_TUNED_GEMM_CPP_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <torch/extension.h>
+#include <ATen/ATen.h>
+#include <pybind11/stl.h>
+
+// CUDA forward declarations
+${declarations}
+
+using KernelFn = at::Tensor (*)(const at::Tensor&, const at::Tensor&, at::optional<const at::Tensor>, float, float);
+
+namespace {
+
+struct DispatchEntry {
+  int64_t m, n, k;
+  int kernel;
+};
+
+// Problem sizes profiled when the extension was generated and the kernel selected for each
+const DispatchEntry kDispatchTable[] = {
+${dispatch_entries}
+};
+
+const KernelFn kKernels[] = {
+${kernels}
+};
+
+// Alignment, in elements, that each kernel requires of the contiguous extents of A, B, and C
+const int64_t kAlignments[][3] = {
+${alignments}
+};
+
+bool is_supported(int kernel, int64_t extent_A, int64_t extent_B, int64_t extent_C) {
+  return (extent_A % kAlignments[kernel][0] == 0) &&
+         (extent_B % kAlignments[kernel][1] == 0) &&
+         (extent_C % kAlignments[kernel][2] == 0);
+}
+
+// Empty extents are measured as extents of one, whose logarithm is finite
+double log_extent(int64_t extent) {
+  return std::log(double(std::max<int64_t>(extent, 1)));
+}
+
+} // namespace
+
+// C++ interface. Problem sizes that were not profiled use the kernel of the nearest profiled size,
+// measured as the distance between the logarithms of the extents, whose alignment the operands satisfy.
+at::Tensor ${name}(const at::Tensor& A, const at::Tensor& B, at::optional<const at::Tensor> C=at::nullopt, float alpha=1.f, float beta=0.f) {
+  int64_t M = A.size(0);
+  int64_t N = B.size(1);
+  int64_t K = A.size(1);
+
+  int selected = -1;
+  double nearest = std::numeric_limits<double>::infinity();
+  for (const DispatchEntry& entry : kDispatchTable) {
+    if (!is_supported(entry.kernel, ${extent_A}, ${extent_B}, ${extent_C})) {
+      continue;
+    }
+    double distance = std::abs(log_extent(M) - log_extent(entry.m)) +
+                      std::abs(log_extent(N) - log_extent(entry.n)) +
+                      std::abs(log_extent(K) - log_extent(entry.k));
+    if (distance < nearest) {
+      nearest = distance;
+      selected = entry.kernel;
+      if (distance == 0.) {
+        break;
+      }
+    }
+  }
+
+  TORCH_CHECK(selected >= 0, "No kernel of ${name} supports the alignment of a GEMM of size ", M, "x", N, "x", K);
+  return kKernels[selected](A, B, C, alpha, beta);
+}
+
+PYBIND11_MODULE(TORCH_EXTENSION_NAME, m) {
+  m.def("run", py::overload_cast<const at::Tensor&, const at::Tensor&, at::optional<const at::Tensor>, float, float>(&${name}), py::arg("A"), py::arg("B"), py::arg("C") = nullptr, py::arg("alpha") = 1.f, py::arg("beta") = 0.f);
+}
+"""
+
 _PYTORCH_GROUPED_GEMM_CPP_TEMPLATE = common._CSTYLE_AUTOGEN_COMMENT + """
 #include <torch/extension.h>
 #include <ATen/ATen.h>
@@ -268,14 +387,14 @@ at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional
 
     typename DeviceKernel::ElementC* ptrC = (C == at::nullopt) ?
                                             nullptr :
-                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C->contiguous().data_ptr());
-    at::Tensor D = B.new_empty({M, N}, ${torch_type_C});
+                                            reinterpret_cast<typename DeviceKernel::ElementC*>(${tensor_C}.data_ptr());
+    at::Tensor D = ${tensor_D};
 
     cutlass::Status status = ${name}_kernel_run(M, N, K,
-                                                reinterpret_cast<typename DeviceKernel::ElementA*>(A.contiguous().data_ptr()),
-                                                reinterpret_cast<typename DeviceKernel::ElementB*>(B.contiguous().data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementA*>(${tensor_A}.data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementB*>(${tensor_B}.data_ptr()),
                                                 ptrC,
-                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.contiguous().data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.data_ptr()),
                                                 ElementCompute(alpha), ElementCompute(beta));
 
     TORCH_CHECK(status == cutlass::Status::kSuccess, "CUTLASS kernel failed");
@@ -304,14 +423,14 @@ at::Tensor ${name}_kernel(const at::Tensor& A, const at::Tensor& B, at::optional
 
     typename DeviceKernel::ElementC* ptrC = (C == at::nullopt) ?
                                             nullptr :
-                                            reinterpret_cast<typename DeviceKernel::ElementC*>(C->contiguous().data_ptr());
-    at::Tensor D = B.new_empty({M, N}, ${torch_type_C});
+                                            reinterpret_cast<typename DeviceKernel::ElementC*>(${tensor_C}.data_ptr());
+    at::Tensor D = ${tensor_D};
 
     cutlass::Status status = ${name}_kernel_run(M, N, K, L,
-                                                reinterpret_cast<typename DeviceKernel::ElementA*>(A.contiguous().data_ptr()),
-                                                reinterpret_cast<typename DeviceKernel::ElementB*>(B.contiguous().data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementA*>(${tensor_A}.data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementB*>(${tensor_B}.data_ptr()),
                                                 ptrC,
-                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.contiguous().data_ptr()),
+                                                reinterpret_cast<typename DeviceKernel::ElementC*>(D.data_ptr()),
                                                 ElementCompute(alpha), ElementCompute(beta),
                                                 hw_info);
 
@@ -580,8 +699,7 @@ setup(
     name='${name}',
     ext_modules=[
         CUDAExtension('${name}', [
-            '${name}.cpp',
-            '${name}_kernel.cu',
+${sources}
         ],
         include_dirs=['${cutlass_path}/include', '${cutlass_path}/tools/util/include'],
         extra_compile_args={
@@ -598,7 +716,7 @@ setup(
 """
 
 
-def _generate_setup(name: str, sourcedir: str, extra_compile_args: str=""):
+def _generate_setup(name: str, sourcedir: str, extra_compile_args: str="", sources: list = None):
     """
     Generates a setup.py file for the extension
 
@@ -608,10 +726,21 @@ def _generate_setup(name: str, sourcedir: str, extra_compile_args: str=""):
     :type sourcedir: str
     :param extra_compile_args: additional arguments to pass to setup.py
     :type extra_args: str
+    :param sources: names of the source files of the extension, relative to ``sourcedir``. Defaults
+                    to ``<name>.cpp`` and ``<name>_kernel.cu``
+    :type sources: list
     """
+    if sources is None:
+        sources = [f"{name}.cpp", f"{name}_kernel.cu"]
     setup_py_file = os.path.join(sourcedir, "setup.py")
     setup_source = SubstituteTemplate(
-        _PYTORCH_SETUP_PY, {"name": name, "cutlass_path": CUTLASS_PATH, "extra_compile_args": extra_compile_args}
+        _PYTORCH_SETUP_PY,
+        {
+            "name": name,
+            "cutlass_path": CUTLASS_PATH,
+            "extra_compile_args": extra_compile_args,
+            "sources": "\n".join(f"            '{source}'," for source in sources),
+        }
     )
     with open(setup_py_file, "w") as outfile:
         outfile.write(setup_source)
@@ -670,7 +799,7 @@ class _ArchListSetter:
             os.environ[_ArchListSetter._TORCH_CUDA_ARCH_LIST] = self.old_arch_list
 
 
-def _jit(name: str, cc: int, cpp_file: str, cuda_file: str):
+def _jit(name: str, cc: int, cpp_file: str, cuda_file):
     """
     JIT compiles and loads a PyTorch CUDA extension.
 
@@ -680,8 +809,8 @@ def _jit(name: str, cc: int, cpp_file: str, cuda_file: str):
     :type cc: int
     :param cpp_file: path to file containing extension's C++ interface
     :type cpp_file: str
-    :param cuda_file: path to file containing extension's CUDA interface
-    :type cuda_file: str
+    :param cuda_file: path to file containing extension's CUDA interface, or a list of such paths
+    :type cuda_file: str or list
 
     :return: loaded PyTorch module
     """
@@ -694,10 +823,12 @@ def _jit(name: str, cc: int, cpp_file: str, cuda_file: str):
         # 9.0 is set within TORCH_CUDA_ARCH_LIST. Thus, we manually add the sm_90a target.
         extra_cuda_cflags.append(f"-gencode=arch=compute_{cc}a,code=sm_{cc}a")
 
+    cuda_files = cuda_file if isinstance(cuda_file, list) else [cuda_file]
+
     with _ArchListSetter(cc):
         jitmodule = load(
             name,
-            [cpp_file, cuda_file],
+            [cpp_file, *cuda_files],
             extra_cuda_cflags=extra_cuda_cflags,
             extra_include_paths=[
                 os.path.join(CUTLASS_PATH, "include"),
@@ -731,6 +862,38 @@ def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""
         os.makedirs(sourcedir)
 
     cuda_file = os.path.join(sourcedir, name + "_kernel.cu")
+    with open(cuda_file, "w") as outfile:
+        outfile.write(_gemm_cuda_source(op, name, _PYTORCH_CUDA_TEMPLATE))
+
+    cpp_file = os.path.join(sourcedir, name + ".cpp")
+    cpp_source = SubstituteTemplate(
+        _PYTORCH_GEMM_CPP_TEMPLATE,
+        {"name": name, "description": f"CUTLASS {op.procedural_name()} GEMM"},
+    )
+    with open(cpp_file, "w") as outfile:
+        outfile.write(cpp_source)
+
+    _generate_setup(name, sourcedir, _arch_specific_compile_args(cc))
+
+    if jit:
+        return _jit(name, cc, cpp_file, cuda_file)
+
+    return None
+
+
+def _gemm_cuda_source(op, name: str, template: str) -> str:
+    """
+    Returns the CUDA source defining ``<name>_kernel``, which runs the CUTLASS GEMM ``op`` on PyTorch tensors
+
+    :param op: operation to emit
+    :param name: prefix of the names of the functions defined in the source
+    :type name: str
+    :param template: template into which the declaration and implementation of the kernel are substituted
+    :type template: str
+
+    :return: CUDA source
+    :rtype: str
+    """
     extra_kw = {}
     if op.api == ApiVersion.v3x:
         impl_template = _PYTORCH_GEMM_IMPL_TEMPLATE_3x
@@ -740,40 +903,264 @@ def _pytorch_gemm(op, name: str, cc: int, jit: bool = False, sourcedir: str = ""
             extra_kw["args"] = common._CUTLASS_KERNEL_ARGS_2x_STREAM_K
         else:
             extra_kw["args"] = common._CUTLASS_KERNEL_ARGS_2x
-    impl_template = (
-        _PYTORCH_GEMM_IMPL_TEMPLATE_3x
-        if op.api == ApiVersion.v3x
-        else _PYTORCH_GEMM_IMPL_TEMPLATE_2x
-    )
     cuda_impl = SubstituteTemplate(impl_template, {"name": name, **extra_kw})
-    cuda_source = SubstituteTemplate(
-        _PYTORCH_CUDA_TEMPLATE,
+    return SubstituteTemplate(
+        template,
         {
+            "name": name,
             "includes": _PYTORCH_GEMM_INCLUDES[op.api],
             "declaration": op.rt_module.emit(),
             "procedural_name": op.procedural_name(),
             "impl": cuda_impl,
             "torch_type_C": _CUTLASS_TYPE_TO_TORCH_TYPE[op.C.element],
+            "tensor_A": _tensor_in_layout("A", op.A.layout),
+            "tensor_B": _tensor_in_layout("B", op.B.layout),
+            "tensor_C": _tensor_in_layout("(*C)", op.C.layout),
+            "tensor_D": _new_tensor_in_layout(op.C.layout, "M", "N", _CUTLASS_TYPE_TO_TORCH_TYPE[op.C.element]),
         },
     )
-    with open(cuda_file, "w") as outfile:
-        outfile.write(cuda_source)
+
+
+def _tensor_in_layout(tensor: str, layout) -> str:
+    """
+    Returns a C++ expression of a tensor whose storage holds the matrix ``tensor`` in ``layout``
+
+    :param tensor: C++ expression of the matrix
+    :type tensor: str
+    :param layout: layout in which the kernel reads the matrix
+    :type layout: cutlass_library.LayoutType
+
+    :return: C++ expression
+    :rtype: str
+    """
+    if layout == LayoutType.ColumnMajor:
+        return f"{tensor}.t().contiguous()"
+    return f"{tensor}.contiguous()"
+
+
+def _new_tensor_in_layout(layout, rows: str, columns: str, torch_type: str) -> str:
+    """
+    Returns a C++ expression allocating a ``rows`` x ``columns`` matrix whose storage is in ``layout``
+    """
+    if layout == LayoutType.ColumnMajor:
+        return f"B.new_empty({{{columns}, {rows}}}, {torch_type}).t()"
+    return f"B.new_empty({{{rows}, {columns}}}, {torch_type})"
+
+
+def _arch_specific_compile_args(cc: int) -> str:
+    """
+    Returns the nvcc arguments to be added to setup.py for targeting the architecture-specific
+    features of compute capability ``cc``
+
+    :param cc: compute capability of the device the module should target
+    :type cc: int
+
+    :return: quoted, comma-separated arguments
+    :rtype: str
+    """
+    if cc in [90, 100, 101, 103]:
+        return f"'--generate-code=arch=compute_{cc}a,code=[sm_{cc}a]'"
+    return ""
+
+
+def _contiguous_extent(layout, rows: str, columns: str) -> str:
+    """
+    Returns the name of the extent of a matrix with ``rows`` rows and ``columns`` columns that is
+    contiguous in memory under ``layout``
+    """
+    return columns if layout == LayoutType.RowMajor else rows
+
+
+def _random_matrix(rows: int, columns: int, dtype, layout):
+    """
+    Returns a random ``rows`` x ``columns`` PyTorch matrix on the device whose storage is in ``layout``
+    """
+    if layout == LayoutType.ColumnMajor:
+        return torch.rand((columns, rows), device="cuda").to(dtype).t()
+    return torch.rand((rows, columns), device="cuda").to(dtype)
+
+
+def _select_kernels(runtimes: list, max_kernels: int) -> list:
+    """
+    Greedily selects up to ``max_kernels`` kernels that minimize the total runtime of a set of problems
+    when each problem is run with the fastest of the selected kernels
+
+    :param runtimes: runtimes[i][j] is the runtime of problem ``i`` with kernel ``j``, or ``math.inf``
+                     if the kernel does not support the problem
+    :type runtimes: list
+    :param max_kernels: maximum number of kernels to select
+    :type max_kernels: int
+
+    :return: indices of the selected kernels
+    :rtype: list
+    """
+    def cost(best):
+        # Problems left unsupported outweigh any difference in runtime
+        return (sum(1 for b in best if b == math.inf), sum(b for b in best if b != math.inf))
+
+    num_kernels = len(runtimes[0]) if runtimes else 0
+    selected = []
+    best = [math.inf] * len(runtimes)
+    while len(selected) < max_kernels:
+        candidate, candidate_cost = None, cost(best)
+        for j in range(num_kernels):
+            if j in selected:
+                continue
+            total = cost([min(b, row[j]) for b, row in zip(best, runtimes)])
+            if total < candidate_cost:
+                candidate, candidate_cost = j, total
+        if candidate is None:
+            break
+        selected.append(candidate)
+        best = [min(b, row[candidate]) for b, row in zip(best, runtimes)]
+    return selected
+
+
+def pytorch_tuned_gemm(
+    plan, name: str, cc: int, shapes: list, tile_descriptions: list = None, max_kernels: int = 4,
+    warmup_iterations: int = 20, iterations: int = 100, jit: bool = False, sourcedir: str = ""):
+    """
+    Generates source for building a PyTorch CUDA module that dispatches each GEMM to one of a small set of
+    CUTLASS kernels selected by profiling the GEMMs of ``plan`` on the problem sizes in ``shapes``. Profiling
+    is performed once, when the source is generated, so that the built module runs without JIT compilation
+    or profiling.
+
+    Each candidate tile description is profiled on each problem size, and up to ``max_kernels`` kernels
+    minimizing the total runtime of the problem sizes are retained. The module records the kernel to use
+    for each profiled problem size. Other problem sizes use the kernel of the nearest profiled one whose
+    alignment requirements the operands satisfy. Operands are profiled in the layouts of ``plan``, which
+    is not modified.
+
+    .. highlight:: python
+    .. code-block:: python
+
+        plan = cutlass_cppgen.op.Gemm(element=torch.float16, layout=cutlass_cppgen.LayoutType.RowMajor)
+        shapes = [(4096, 4096, 4096), (128, 4096, 4096), (8, 4096, 1024)]
+        cutlass_cppgen.emit.pytorch_tuned_gemm(plan, 'cutlass_gemm', 80, shapes, sourcedir='output')
+
+    :param plan: GEMM plan whose data types, layouts, and epilogue are used by all kernels
+    :type plan: cutlass_cppgen.op.Gemm
+    :param name: name of the module to generate
+    :type name: str
+    :param cc: compute capability of the device the module should target
+    :type cc: int
+    :param shapes: problem sizes (M, N, K) on which to profile the kernels. Extents must be positive
+    :type shapes: list
+    :param tile_descriptions: candidate tile descriptions. Defaults to ``plan.tile_descriptions()``
+    :type tile_descriptions: list
+    :param max_kernels: maximum number of kernels to include in the module
+    :type max_kernels: int
+    :param warmup_iterations: number of untimed runs preceding the measurement of each kernel and problem size
+    :type warmup_iterations: int
+    :param iterations: number of timed runs of each kernel and problem size
+    :type iterations: int
+    :param jit: whether the module should be just-in-time compiled
+    :type jit: bool
+    :param sourcedir: directory to which generated source files should be written
+    :type sourcedir: str
+
+    :return: loaded PyTorch module if ``jit=True`` or ``None`` otherwise
+    """
+    from cutlass_cppgen.utils.profiler import CUDAEventProfiler
+
+    if not is_torch_available():
+        raise Exception("PyTorch is required for profiling the kernels of a tuned PyTorch module.")
+    if len(shapes) == 0:
+        raise Exception("At least one problem size must be provided for profiling.")
+    if tile_descriptions is None:
+        tile_descriptions = plan.tile_descriptions()
+
+    for shape in shapes:
+        if min(shape) <= 0:
+            raise Exception(f"Problem size {shape} is empty and cannot be profiled.")
+
+    # Candidates are profiled on a copy of the plan so that the tile description of ``plan`` is left unchanged
+    plan = copy.copy(plan)
+
+    dtypes = [datatypes.torch_type(element) for element in [plan._element_a, plan._element_b, plan._element_c]]
+
+    # Each tile description may yield kernels of different alignments for different problem sizes.
+    # Kernels are therefore identified by procedural name.
+    operations = {}
+    runtimes = {}
+    for shape in shapes:
+        M, N, K = shape
+        A = _random_matrix(M, K, dtypes[0], plan._layout_a)
+        B = _random_matrix(K, N, dtypes[1], plan._layout_b)
+        C = _random_matrix(M, N, dtypes[2], plan._layout_c)
+        D = torch.empty_like(C)
+        for td in tile_descriptions:
+            try:
+                plan.tile_description = td
+                profiler = CUDAEventProfiler(plan, warmup_iterations, iterations, A, B, C, D)
+                runtime = profiler()
+            except Exception as e:
+                logger.debug(f"Skipping tile description {td} for problem size {shape}: {e}")
+                continue
+            key = profiler.operation.procedural_name()
+            operations.setdefault(key, profiler.operation)
+            runtimes[(tuple(shape), key)] = runtime
+
+    keys = list(operations.keys())
+    table = [[runtimes.get((tuple(shape), key), math.inf) for key in keys] for shape in shapes]
+    for shape, row in zip(shapes, table):
+        if min(row, default=math.inf) == math.inf:
+            raise Exception(f"No candidate kernel supports the problem size {shape}.")
+
+    selected = _select_kernels(table, max_kernels)
+    assignment = [min(range(len(selected)), key=lambda i: row[selected[i]]) for row in table]
+    for shape, row, i in zip(shapes, table, assignment):
+        if row[selected[i]] == math.inf:
+            raise Exception(f"None of the {max_kernels} kernels selected supports the problem size {shape}. "
+                            "Consider increasing max_kernels.")
+
+    if sourcedir != "" and not os.path.isdir(sourcedir):
+        os.makedirs(sourcedir)
+
+    sources = [f"{name}.cpp"]
+    cuda_files = []
+    alignments = []
+    for i, j in enumerate(selected):
+        op = operations[keys[j]].device_op()
+        kernel_name = f"{name}_{i}"
+        logger.info(f"Kernel {kernel_name} of module {name} is {op.procedural_name()}")
+
+        sources.append(f"{kernel_name}_kernel.cu")
+        cuda_files.append(os.path.join(sourcedir, sources[-1]))
+        with open(cuda_files[-1], "w") as outfile:
+            outfile.write(_gemm_cuda_source(op, kernel_name, _PYTORCH_TUNED_GEMM_CUDA_TEMPLATE))
+
+        alignments.append((op.A.alignment, op.B.alignment, op.C.alignment))
+
+    # The contiguous extents are determined by the layouts, which are shared by all kernels
+    extent_A = _contiguous_extent(plan._layout_a, "M", "K")
+    extent_B = _contiguous_extent(plan._layout_b, "K", "N")
+    extent_C = _contiguous_extent(plan._layout_c, "M", "N")
 
     cpp_file = os.path.join(sourcedir, name + ".cpp")
     cpp_source = SubstituteTemplate(
-        _PYTORCH_GEMM_CPP_TEMPLATE,
-        {"name": name, "description": f"CUTLASS {op.procedural_name()} GEMM"},
+        _PYTORCH_TUNED_GEMM_CPP_TEMPLATE,
+        {
+            "name": name,
+            "declarations": "\n".join(
+                f"at::Tensor {name}_{i}_kernel(const at::Tensor& A, const at::Tensor& B, "
+                f"at::optional<const at::Tensor> C, float alpha, float beta);" for i in range(len(selected))),
+            "kernels": "\n".join(f"  &{name}_{i}_kernel," for i in range(len(selected))),
+            "dispatch_entries": "\n".join(
+                f"  {{{M}, {N}, {K}, {i}}}," for (M, N, K), i in zip(shapes, assignment)),
+            "alignments": "\n".join(f"  {{{a}, {b}, {c}}}," for a, b, c in alignments),
+            "extent_A": extent_A,
+            "extent_B": extent_B,
+            "extent_C": extent_C,
+        },
     )
     with open(cpp_file, "w") as outfile:
         outfile.write(cpp_source)
 
-    extra_compile_args = ""
-    if cc in [90, 100, 101, 103]:
-        extra_compile_args = f"'--generate-code=arch=compute_{cc}a,code=[sm_{cc}a]'"
-    _generate_setup(name, sourcedir, extra_compile_args)
+    _generate_setup(name, sourcedir, _arch_specific_compile_args(cc), sources)
 
     if jit:
-        return _jit(name, cc, cpp_file, cuda_file)
+        return _jit(name, cc, cpp_file, cuda_files)
 
     return None
 
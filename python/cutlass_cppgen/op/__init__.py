@@ -33,4 +33,4 @@
 from cutlass_cppgen.op.conv import Conv2d, Conv2dFprop, Conv2dDgrad, Conv2dWgrad
 from cutlass_cppgen.op.gemm import Gemm
 from cutlass_cppgen.op.gemm_grouped import GroupedGemm
-from cutlass_cppgen.op.op import OperationBase
+from cutlass_cppgen.op.op import OperationBase, compile_all
@@ -112,6 +112,19 @@
         # Do other work...
 
         args.sync()
+
+    Small GEMMs launched repeatedly with operands of fixed shapes can bind their arguments once, avoiding
+    argument construction on each launch, and optionally capture the launch into a CUDA graph:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        bound = plan.bind(A0, B0, C0, D0)
+        for A, D in inputs:
+            bound.run(A=A, D=D)
+
+        bound.capture(stream)
+        bound.replay(stream)
 """
 from __future__ import annotations
 from typing import Optional
@@ -135,6 +148,7 @@ from cutlass_cppgen.backend.library import TensorDescription, TileDescription
 from cutlass_cppgen.op.op import OperationBase
 from cutlass_cppgen.shape import GemmCoord
 from cutlass_cppgen.utils import check, datatypes
+from cutlass_cppgen.utils.datatypes import is_numpy_tensor
 
 
 class Gemm(OperationBase):
@@ -629,39 +643,11 @@ class Gemm(OperationBase):
                                 f'does not match the expected type and '
                                 f'layout of ({ref_type}, {ref_layout}) and transpose failed.')
 
-    def run(self, A=None, B=None, C=None, D=None,
-            alpha=None, beta=None, sync: bool = True, print_module: bool = False, visitor_args: dict = None,
-            stream: Optional[cuda.CUstream] = None) -> GemmArguments:
+    def _construct_arguments(self, A, B, C, D, alpha, beta, print_module, visitor_args, stream) -> GemmArguments:
         """
-        Runs the kernel currently specified. If it has not already been, the kernel is emitted and
-        compiled. Tensors holding operands and outputs of the kernel are sourced either from the
-        ``A``, ``B``, ``C``, ``D``, ``alpha``, and ``beta``
-        parameters provided in this call, or from those
-        passed in on the construction of this object -- one of the two must be specified.
-
-        By default, this call returns only once the kernel has completed. To launch the kernel
-        and immediately return, set ``sync=False``. In this case, it is the responsibility of the
-        caller to syncrhonize the results of the kernel before attempting to access outputs
-        by calling ``sync()`` on the arguments returned from this call.
-
-        :param A: tensor representing data type and layout of operand A
-        :param B: tensor representing data type and layout of operand B
-        :param C: tensor representing data type and layout of operand C
-        :param D: tensor representing data type and layout of operand D
-        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
-        :param beta: scalar parameter beta from GEMM operation that scales operand C
-        :param sync: whether the call should wait for the kernel to complete before returning
-        :type sync: bool
-        :param print_module: whether to print the emitted C++ code
-        :type print_module: bool
-        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
-        :type stream: :class:`cuda.cuda.CUstream`
-
-        :return: arguments passed in to the kernel
-        :rtype: cutlass_cppgen.backend.GemmArguments
+        Verifies the operands, compiles the kernel if needed, and returns the arguments for running it.
+        See ``run()`` for a description of the parameters
         """
-        if not stream:
-            stream = cuda.CUstream(0)
         super().run_setup()
         A = self._verify_tensor(A, self.A, self._element_a, self._layout_a, "A")
         B = self._verify_tensor(B, self.B, self._element_b, self._layout_b, "B")
@@ -717,9 +703,263 @@ class Gemm(OperationBase):
             **kwargs
         )
 
+        return arguments
+
+    def run(self, A=None, B=None, C=None, D=None,
+            alpha=None, beta=None, sync: bool = True, print_module: bool = False, visitor_args: dict = None,
+            stream: Optional[cuda.CUstream] = None) -> GemmArguments:
+        """
+        Runs the kernel currently specified. If it has not already been, the kernel is emitted and
+        compiled. Tensors holding operands and outputs of the kernel are sourced either from the
+        ``A``, ``B``, ``C``, ``D``, ``alpha``, and ``beta``
+        parameters provided in this call, or from those
+        passed in on the construction of this object -- one of the two must be specified.
+
+        By default, this call returns only once the kernel has completed. To launch the kernel
+        and immediately return, set ``sync=False``. In this case, it is the responsibility of the
+        caller to syncrhonize the results of the kernel before attempting to access outputs
+        by calling ``sync()`` on the arguments returned from this call.
+
+        :param A: tensor representing data type and layout of operand A
+        :param B: tensor representing data type and layout of operand B
+        :param C: tensor representing data type and layout of operand C
+        :param D: tensor representing data type and layout of operand D
+        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
+        :param beta: scalar parameter beta from GEMM operation that scales operand C
+        :param sync: whether the call should wait for the kernel to complete before returning
+        :type sync: bool
+        :param print_module: whether to print the emitted C++ code
+        :type print_module: bool
+        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+        :type stream: :class:`cuda.cuda.CUstream`
+
+        :return: arguments passed in to the kernel
+        :rtype: cutlass_cppgen.backend.GemmArguments
+        """
+        if not stream:
+            stream = cuda.CUstream(0)
+        arguments = self._construct_arguments(A, B, C, D, alpha, beta, print_module, visitor_args, stream)
+
         self.operation.run(arguments)
 
         if sync:
             arguments.sync()
 
         return arguments
+
+    def bind(self, A=None, B=None, C=None, D=None, alpha=None, beta=None, visitor_args: dict = None,
+             stream: Optional[cuda.CUstream] = None) -> BoundGemm:
+        """
+        Compiles the kernel and fixes its problem size, data types, scalars, and packed kernel parameters,
+        returning an object whose launches skip the argument construction performed by ``run()``.
+        Operands must reside in device memory. Later launches may substitute operands of the same shape
+        and layout, for which only the operand pointers are updated.
+
+        .. highlight:: python
+        .. code-block:: python
+
+            bound = plan.bind(A, B, C, D)
+            bound.run()                     # Launches with A, B, C, and D
+            bound.run(A=A1, D=D1)           # Launches with new A and D tensors
+
+            graph = bound.capture(stream)   # Captures the launch into a CUDA graph
+            graph.replay(stream)
+
+        The parameters are the same as those of ``run()``.
+
+        :return: bound GEMM
+        :rtype: cutlass_cppgen.op.gemm.BoundGemm
+        """
+        if not stream:
+            stream = cuda.CUstream(0)
+        for name, tensor in zip(["A", "B", "C", "D"], [A, B, C, D]):
+            if is_numpy_tensor(tensor):
+                raise Exception(f"Tensor {name} must reside in device memory to be bound. Received a numpy array")
+        arguments = self._construct_arguments(A, B, C, D, alpha, beta, False, visitor_args, stream)
+        return BoundGemm(arguments)
+
+
+class BoundGemm:
+    """
+    GEMM launch whose arguments were constructed once by ``Gemm.bind()``. The packed kernel parameters and
+    device workspace are reused across launches. Pointers to operands that are replaced are written directly
+    into the packed parameters when the kernel stores them verbatim, and the parameters are otherwise re-packed
+    from the cached ctypes arguments, for example when they are embedded in TMA descriptors.
+
+    :param arguments: arguments constructed for the GEMM
+    :type arguments: cutlass_cppgen.backend.GemmArguments
+    """
+
+    # Distinct, suitably aligned addresses used to find where operand pointers are stored in the packed parameters
+    _sentinels = (0x7F0000000000, 0x7E0000000000)
+
+    def __init__(self, arguments):
+        self.arguments = arguments
+        self.operation = arguments.operation
+
+        # Operands A and B are exchanged when the kernel computes the transposed problem
+        if self.operation.switched:
+            self._pointer_attrs = {"A": "ptr_B", "B": "ptr_A", "C": "ptr_C", "D": "ptr_D"}
+        else:
+            self._pointer_attrs = {"A": "ptr_A", "B": "ptr_B", "C": "ptr_C", "D": "ptr_D"}
+
+        self._pointer_offsets = {name: self._find_pointer_offsets(attr) for name, attr in self._pointer_attrs.items()}
+        self.graph = None
+        self.graph_exec = None
+        self.capture_stream = None
+
+    def _find_pointer_offsets(self, attr):
+        """
+        Returns the byte offsets at which the packed parameters hold the pointer ``attr`` verbatim, or None
+        if it is transformed before being stored
+        """
+        original = getattr(self.arguments, attr)
+        packed = []
+        for sentinel in self._sentinels:
+            setattr(self.arguments, attr, cuda.CUdeviceptr(sentinel))
+            packed.append(self.arguments.pack_params())
+        setattr(self.arguments, attr, original)
+
+        if int(original) == 0:
+            # A null operand, such as a void C, is not read by the kernel and need not be patched
+            return None
+
+        first, second = packed
+        differing = [i for i in range(len(first)) if first[i] != second[i]]
+        offsets = sorted(set(i - i % 8 for i in differing))
+        for offset in offsets:
+            if (int.from_bytes(first[offset:offset + 8], "little") != self._sentinels[0] or
+                int.from_bytes(second[offset:offset + 8], "little") != self._sentinels[1]):
+                return None
+        return offsets
+
+    def _update_pointers(self, operands):
+        repack = False
+        for name, tensor in operands.items():
+            if tensor is None:
+                continue
+            if is_numpy_tensor(tensor):
+                raise Exception(f"Tensor {name} must reside in device memory. Received a numpy array")
+
+            ptr = self.arguments.tensor_to_ptr(tensor, name)
+            setattr(self.arguments, self._pointer_attrs[name], ptr)
+
+            offsets = self._pointer_offsets[name]
+            if offsets is None:
+                repack = True
+            else:
+                for offset in offsets:
+                    self.arguments.host_workspace[offset:offset + 8] = int(ptr).to_bytes(8, "little")
+
+        if repack:
+            self.arguments.host_workspace = self.arguments.pack_params()
+
+    def _launch(self, stream):
+        workspace_size = getattr(self.arguments, "device_workspace_size", 0)
+        if workspace_size > 0:
+            # Semaphores and partial results in the workspace must be cleared before each launch
+            err, = cuda.cuMemsetD32Async(self.arguments.workspace_buffer.ptr, 0, workspace_size // 4, stream)
+            if err != cuda.CUresult.CUDA_SUCCESS:
+                raise RuntimeError("CUDA Error %s" % str(err))
+
+        err = self.operation.rt_module.run(
+            self.arguments.host_workspace,
+            self.arguments.device_workspace,
+            self.arguments.launch_config,
+            stream
+        )
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+
+    def run(self, A=None, B=None, C=None, D=None, sync: bool = False, stream: Optional[cuda.CUstream] = None):
+        """
+        Launches the kernel, optionally with new operands of the same shapes and layouts as the bound ones.
+        If a CUDA graph was captured, it is updated and launched instead.
+
+        :param A: new operand A, or None to keep the bound one
+        :param B: new operand B, or None to keep the bound one
+        :param C: new operand C, or None to keep the bound one
+        :param D: new output D, or None to keep the bound one
+        :param sync: whether the call should wait for the kernel to complete before returning
+        :type sync: bool
+        :param stream: stream on which to launch, defaults to the stream passed to ``Gemm.bind()``
+        :type stream: :class:`cuda.cuda.CUstream`
+        """
+        if stream is None:
+            stream = self.arguments.stream
+
+        operands = {"A": A, "B": B, "C": C, "D": D}
+        changed = any(tensor is not None for tensor in operands.values())
+        if changed:
+            self._update_pointers(operands)
+
+        if self.graph_exec is not None:
+            if changed:
+                self.capture(self.capture_stream)
+            self.replay(stream)
+        else:
+            self._launch(stream)
+
+        if sync:
+            err, = cuda.cuStreamSynchronize(stream)
+            if err != cuda.CUresult.CUDA_SUCCESS:
+                raise RuntimeError("CUDA Error %s" % str(err))
+
+    def capture(self, stream: Optional[cuda.CUstream] = None) -> BoundGemm:
+        """
+        Captures the launch into a CUDA graph that ``replay()`` and later calls to ``run()`` launch. Capturing
+        again updates the instantiated graph in place when possible.
+
+        :param stream: non-default stream used for capture. A private stream is created if None
+        :type stream: :class:`cuda.cuda.CUstream`
+
+        :return: this object
+        :rtype: cutlass_cppgen.op.gemm.BoundGemm
+        """
+        if stream is None or int(stream) == 0:
+            # The legacy default stream cannot be captured
+            if self.capture_stream is None or int(self.capture_stream) == 0:
+                err, stream = cuda.cuStreamCreate(cuda.CUstream_flags.CU_STREAM_NON_BLOCKING)
+                if err != cuda.CUresult.CUDA_SUCCESS:
+                    raise RuntimeError("CUDA Error %s" % str(err))
+            else:
+                stream = self.capture_stream
+        self.capture_stream = stream
+
+        err, = cuda.cuStreamBeginCapture(stream, cuda.CUstreamCaptureMode.CU_STREAM_CAPTURE_MODE_THREAD_LOCAL)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+        self._launch(stream)
+        err, graph = cuda.cuStreamEndCapture(stream)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+
+        if self.graph_exec is not None:
+            err = cuda.cuGraphExecUpdate(self.graph_exec, graph)[0]
+            if err == cuda.CUresult.CUDA_SUCCESS:
+                cuda.cuGraphDestroy(self.graph)
+                self.graph = graph
+                return self
+            cuda.cuGraphExecDestroy(self.graph_exec)
+            cuda.cuGraphDestroy(self.graph)
+
+        err, self.graph_exec = cuda.cuGraphInstantiate(graph, 0)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
+        self.graph = graph
+        return self
+
+    def replay(self, stream: Optional[cuda.CUstream] = None):
+        """
+        Launches the captured CUDA graph
+
+        :param stream: stream on which to launch, defaults to the stream passed to ``Gemm.bind()``
+        :type stream: :class:`cuda.cuda.CUstream`
+        """
+        if self.graph_exec is None:
+            raise Exception("capture() must be called before replay()")
+        if stream is None:
+            stream = self.arguments.stream
+        err, = cuda.cuGraphLaunch(self.graph_exec, stream)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError("CUDA Error %s" % str(err))
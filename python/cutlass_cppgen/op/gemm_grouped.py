@@ -49,6 +49,31 @@
         # As, Bs, Cs, and Ds are torch/numpy/cupy tensor objects
         plan = cutlass_cppgen.op.GroupedGemm(element=cutlass_cppgen.DataType.f16, layout=cutlass_cppgen.LayoutType.RowMajor)
         plan.run([A0, A1], [B0, B1], [C0, C1], [D0, D1])
+
+    Grouped GEMMs may also use an epilogue visitor traced for SM80. Each problem may receive its own
+    visitor arguments. Since the strides of the visitor's auxiliary tensors are taken from the example
+    tensors, all problems must share the N extent of the traced example:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        def bias_relu(accum, bias):
+            D = relu(accum + bias)
+            return D
+
+        plan.epilogue_visitor = cutlass_cppgen.epilogue.trace(bias_relu, examples, cc=80)
+        plan.run([A0, A1], [B0, B1], None, None,
+                 visitor_args=[{"bias": bias0, "D": D0}, {"bias": bias1, "D": D1}])
+
+    When the problem sizes and operand pointers are produced on the device (e.g., by a routing kernel),
+    ``run_device`` launches the group directly from device-resident arrays without copying them
+    through the host:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        # problem_sizes is an int32 tensor of shape (count, 3), ptrs_* and ld* are int64 tensors of shape (count,)
+        plan.run_device(count, problem_sizes, ptrs_A, ptrs_B, lda, ldb, ptrs_C, ptrs_D, ldc, ldd)
 """
 from __future__ import annotations
 from typing import Optional
@@ -56,10 +81,13 @@ from cutlass_library import DataTypeSize
 
 from cutlass_cppgen.utils.lazy_import import lazy_import
 cuda = lazy_import("cuda.cuda")
+from cutlass_cppgen.backend.evt import EpilogueFunctorVisitor
 from cutlass_cppgen.backend.gemm_operation import (
     GemmGroupedArguments,
+    GemmGroupedDeviceArguments,
     GemmOperationGrouped,
 )
+from cutlass_cppgen.backend.frontend import TensorFrontend
 from cutlass_cppgen.backend.library import (
     SchedulerMode,
     TensorDescription,
@@ -68,6 +96,7 @@ from cutlass_cppgen.backend.library import (
 from cutlass_cppgen.op.gemm import Gemm
 from cutlass_cppgen.shape import GemmCoord
 from cutlass_cppgen.utils import check, datatypes
+from cutlass_cppgen.utils.datatypes import is_numpy_tensor
 
 
 class GroupedGemm(Gemm):
@@ -146,6 +175,17 @@ class GroupedGemm(Gemm):
         """
         raise Exception('Grouped GEMM does not currently support different swizzling functors')
 
+    @Gemm.epilogue_visitor.setter
+    def epilogue_visitor(self, visitor):
+        """
+        Sets the epilogue visitor. Grouped GEMMs are emitted as SM80 kernels, so the visitor must be
+        traced for SM80
+        """
+        if getattr(visitor, "cc", 80) != 80:
+            raise Exception('Grouped GEMM requires an epilogue visitor traced with cc=80. '
+                            f'Received a visitor traced for cc={visitor.cc}')
+        self.epilogue_functor = EpilogueFunctorVisitor(80, visitor)
+
     def construct(self, tile_description: TileDescription = None,
                   alignment_A: int = None,
                   alignment_B: int = None,
@@ -195,9 +235,26 @@ class GroupedGemm(Gemm):
 
         return operation
 
+    def _epilogue_arguments(self, alpha, beta, visitor_args):
+        """
+        Returns the epilogue arguments: one set of visitor arguments per problem when using an
+        epilogue visitor and the linear combination parameters otherwise
+        """
+        if isinstance(self.epilogue_functor, EpilogueFunctorVisitor):
+            if visitor_args is None:
+                raise Exception("visitor_args must be provided when using an epilogue visitor")
+            if isinstance(visitor_args, dict):
+                return self.operation.epilogue_type(visitor_args)
+            return [self.operation.epilogue_type(args) for args in visitor_args]
+
+        alpha = self._verify_scalar(alpha, self.alpha, self._element_c, "alpha")
+        beta = self._verify_scalar(beta, self.beta, self._element_c, "beta")
+        return self.operation.epilogue_type(alpha, beta)
+
     def run(self, A, B, C, D,
             alpha=None, beta=None, sync: bool = True,
             print_module: bool = False,
+            visitor_args=None,
             stream: Optional[cuda.CUstream] = None) -> GemmGroupedArguments:
         """
         Runs the kernel currently specified.
@@ -211,9 +268,9 @@ class GroupedGemm(Gemm):
         :type A: list
         :param B: list of tensors representing data type and layout of operand B
         :type B: list
-        :param C: list of tensors representing data type and layout of operand C
+        :param C: list of tensors representing data type and layout of operand C. Ignored with an epilogue visitor
         :type C: list
-        :param D: list of tensors representing data type and layout of operand D
+        :param D: list of tensors representing data type and layout of operand D. Ignored with an epilogue visitor
         :type D: list
         :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
         :param beta: scalar parameter beta from GEMM operation that scales operand C
@@ -221,6 +278,8 @@ class GroupedGemm(Gemm):
         :type sync: bool
         :param print_module: whether to print the emitted C++ code
         :type print_module: bool
+        :param visitor_args: arguments of the epilogue visitor, either shared by all problems or one per problem
+        :type visitor_args: dict or list[dict]
         :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
         :type stream: :class:`cuda.cuda.CUstream`
 
@@ -232,6 +291,11 @@ class GroupedGemm(Gemm):
 
         super().run_setup()
 
+        uses_visitor = isinstance(self.epilogue_functor, EpilogueFunctorVisitor)
+        if uses_visitor:
+            C = [None] * len(A) if C is None else C
+            D = [None] * len(A) if D is None else D
+
         if len(A) != len(B) or len(A) != len(C) or len(A) != len(D):
             raise Exception("Lengths of A, B, C, and D lists must be equal")
 
@@ -240,16 +304,15 @@ class GroupedGemm(Gemm):
         for i in range(len(A)):
             As[i] = self._verify_tensor(A[i], self.A, self._element_a, self._layout_a, "A")
             Bs[i] = self._verify_tensor(B[i], self.B, self._element_b, self._layout_b, "B")
-            Cs[i] = self._verify_tensor(C[i], self.C, self._element_c, self._layout_c, "C")
-            Ds[i] = self._verify_tensor(D[i], self.D, self._element_d, self._layout_d, "D")
+            if not uses_visitor:
+                Cs[i] = self._verify_tensor(C[i], self.C, self._element_c, self._layout_c, "C")
+                Ds[i] = self._verify_tensor(D[i], self.D, self._element_d, self._layout_d, "D")
             problem_sizes.append(GemmCoord(A[i].shape[0], B[i].shape[1], A[i].shape[1]))
 
-        alpha = self._verify_scalar(alpha, self.alpha, self._element_c, "alpha")
-        beta = self._verify_scalar(beta, self.beta, self._element_c, "beta")
-
         alignment_a = min((self.possible_operations.find_alignment(A.shape, self._layout_a, operand="A") for A in As))
         alignment_b = min((self.possible_operations.find_alignment(B.shape, self._layout_b, operand="B") for B in Bs))
-        alignment_c = min((self.possible_operations.find_alignment(C.shape, self._layout_c, operand="C") for C in Cs))
+        alignment_c = min((self.possible_operations.find_alignment((ps.m, ps.n), self._layout_c, operand="C")
+                           for ps in problem_sizes))
         self.compile(self.tile_description, alignment_A=alignment_a, alignment_B=alignment_b,
                      alignment_C=alignment_c, print_module=print_module)
 
@@ -257,7 +320,109 @@ class GroupedGemm(Gemm):
             operation=self.operation,
             problem_sizes=problem_sizes,
             A=As, B=Bs, C=Cs, D=Ds,
-            output_op=self.operation.epilogue_type(alpha, beta),
+            output_op=self._epilogue_arguments(alpha, beta, visitor_args),
+            stream=stream
+        )
+
+        self.operation.run(arguments)
+
+        if sync:
+            arguments.sync()
+
+        return arguments
+
+    @staticmethod
+    def _device_array_ptr(array, name: str) -> int:
+        """
+        Returns the device address of a device-resident array given as a pointer or a device tensor
+        """
+        if array is None:
+            return 0
+        if isinstance(array, int):
+            return array
+        if isinstance(array, cuda.CUdeviceptr):
+            return int(array)
+        if is_numpy_tensor(array):
+            raise Exception(f"Array {name} must reside in device memory. Received a numpy array")
+        return int(TensorFrontend.argument(array))
+
+    def run_device(self, problem_count: int, problem_sizes, ptr_A, ptr_B, lda, ldb,
+                   ptr_C=None, ptr_D=None, ldc=None, ldd=None,
+                   alpha=None, beta=None, sync: bool = True,
+                   print_module: bool = False,
+                   visitor_args=None,
+                   threadblock_count: int = None,
+                   alignment_A: int = None, alignment_B: int = None, alignment_C: int = None,
+                   stream: Optional[cuda.CUstream] = None) -> GemmGroupedDeviceArguments:
+        """
+        Runs the kernel currently specified on problems described by device-resident arrays.
+
+        The arrays are read only by the kernel, so they may be written by a preceding kernel on the
+        same stream without synchronizing with the host. Since operand shapes are not known on the
+        host, the kernel is compiled for the largest alignments supported unless ``alignment_A``,
+        ``alignment_B``, and ``alignment_C`` are provided, and it is the caller's responsibility that
+        every problem satisfies them. C and D must be row-major.
+
+        :param problem_count: number of problems in the group
+        :type problem_count: int
+        :param problem_sizes: device array of ``problem_count`` (M, N, K) int32 triples
+        :param ptr_A: device array of ``problem_count`` int64 addresses of operands A
+        :param ptr_B: device array of ``problem_count`` int64 addresses of operands B
+        :param lda: device array of ``problem_count`` int64 leading dimensions of operands A
+        :param ldb: device array of ``problem_count`` int64 leading dimensions of operands B
+        :param ptr_C: device array of ``problem_count`` int64 addresses of operands C. Ignored with an epilogue visitor
+        :param ptr_D: device array of ``problem_count`` int64 addresses of operands D. Ignored with an epilogue visitor
+        :param ldc: device array of ``problem_count`` int64 leading dimensions of operands C. Ignored with an epilogue visitor
+        :param ldd: device array of ``problem_count`` int64 leading dimensions of operands D. Ignored with an epilogue visitor
+        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
+        :param beta: scalar parameter beta from GEMM operation that scales operand C
+        :param sync: whether the call should wait for the kernel to complete before returning
+        :type sync: bool
+        :param print_module: whether to print the emitted C++ code
+        :type print_module: bool
+        :param visitor_args: arguments of the epilogue visitor, either shared by all problems or one per problem
+        :type visitor_args: dict or list[dict]
+        :param threadblock_count: number of persistent threadblocks to launch. Defaults to the number
+                                  of threadblocks that can be resident on the device at once
+        :type threadblock_count: int
+        :param alignment_A: alignment of operand A
+        :type alignment_A: int
+        :param alignment_B: alignment of operand B
+        :type alignment_B: int
+        :param alignment_C: alignment of operand C
+        :type alignment_C: int
+        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+        :type stream: :class:`cuda.cuda.CUstream`
+
+        :return: arguments passed in to the kernel
+        :rtype: cutlass_cppgen.backend.GemmGroupedDeviceArguments
+        """
+        if not stream:
+            stream = cuda.CUstream(0)
+
+        super().run_setup()
+
+        uses_visitor = isinstance(self.epilogue_functor, EpilogueFunctorVisitor)
+        if not uses_visitor and (ptr_C is None or ptr_D is None or ldc is None or ldd is None):
+            raise Exception("ptr_C, ptr_D, ldc, and ldd must be provided when not using an epilogue visitor")
+
+        self.compile(self.tile_description, alignment_A=alignment_A, alignment_B=alignment_B,
+                     alignment_C=alignment_C, print_module=print_module)
+
+        arguments = GemmGroupedDeviceArguments(
+            operation=self.operation,
+            problem_count=problem_count,
+            problem_sizes=self._device_array_ptr(problem_sizes, "problem_sizes"),
+            ptr_A=self._device_array_ptr(ptr_A, "ptr_A"),
+            ptr_B=self._device_array_ptr(ptr_B, "ptr_B"),
+            ptr_C=self._device_array_ptr(ptr_C, "ptr_C"),
+            ptr_D=self._device_array_ptr(ptr_D, "ptr_D"),
+            lda=self._device_array_ptr(lda, "lda"),
+            ldb=self._device_array_ptr(ldb, "ldb"),
+            ldc=self._device_array_ptr(ldc, "ldc"),
+            ldd=self._device_array_ptr(ldd, "ldd"),
+            threadblock_count=threadblock_count,
+            output_op=self._epilogue_arguments(alpha, beta, visitor_args),
             stream=stream
         )
 
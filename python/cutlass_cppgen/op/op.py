@@ -46,6 +46,7 @@ from cutlass_library import (
 
 import cutlass_cppgen
 from cutlass_cppgen import get_option_registry
+from cutlass_cppgen.backend import compiler
 from cutlass_cppgen.backend.evt import EpilogueFunctorVisitor
 from cutlass_cppgen.backend.evt.passes.util import cc_map
 from cutlass_cppgen.backend.utils.device import device_cc
@@ -429,3 +430,33 @@ class OperationBase:
         """
         # Initialize the memory pool if, if not already done
         cutlass_cppgen.get_memory_pool()
+
+
+def compile_all(plans: list, jobs: int = None) -> list:
+    """
+    Emits and compiles the kernels currently specified by several plans at once, compiling the kernels
+    missing from the cache concurrently. This is equivalent to calling ``plan.compile()`` on each plan
+    with default arguments, but avoids compiling the kernels one after another.
+
+    .. highlight:: python
+    .. code-block:: python
+
+        plans = [cutlass_cppgen.op.Gemm(element=torch.float16, layout=cutlass_cppgen.LayoutType.RowMajor,
+                                        element_accumulator=acc) for acc in (torch.float16, torch.float32)]
+        cutlass_cppgen.compile_all(plans, jobs=0)
+
+    :param plans: plans to compile, such as ``cutlass_cppgen.op.Gemm`` or ``cutlass_cppgen.op.Conv2d`` objects
+    :type plans: list
+    :param jobs: number of modules compiled concurrently, 0 for one per CPU, or None to use ``CUTLASS_COMPILE_JOBS``
+    :type jobs: int
+
+    :return: operations that were compiled, in the order of ``plans``
+    :rtype: list
+    """
+    operations = []
+    for plan in plans:
+        plan.operation = plan.construct()
+        operations.append(plan.operation)
+
+    compiler.add_module(operations, jobs=jobs)
+    return operations
@@ -0,0 +1,156 @@
+#################################################################################################
+#
+# Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Memoization of kernel configuration enumeration across generator runs
+
+Functions decorated with @persistent are memoized on the values of their arguments. Once enable()
+is given a file, results are also loaded from and saved to it, so that a build regenerating the
+library skips enumerating the configurations it has enumerated before. A cache file is only reused
+with the generator sources it was written by.
+
+Arguments may be any nesting of enums, containers, plain values and objects of those. Results may
+be nestings of lists, tuples, plain values and enums defined in the module of the decorated function.
+"""
+
+import enum
+import functools
+import glob
+import hashlib
+import json
+import logging
+import os
+
+_LOGGER = logging.getLogger(__name__)
+
+_CACHE_VERSION = 1
+
+_path = None
+_entries = {}
+_dirty = False
+
+
+def _sources_fingerprint():
+  digest = hashlib.sha256()
+  for source in sorted(glob.glob(os.path.join(os.path.dirname(os.path.abspath(__file__)), "*.py"))):
+    with open(source, "rb") as file:
+      digest.update(file.read())
+  return digest.hexdigest()
+
+
+def _key(value):
+  """Canonical JSON-serializable form of an argument"""
+  if isinstance(value, enum.Enum):
+    return f"{type(value).__name__}.{value.name}"
+  if value is None or isinstance(value, (bool, int, float, str)):
+    return value
+  if isinstance(value, dict):
+    return {"dict": sorted(([_key(k), _key(v)] for k, v in value.items()), key=json.dumps)}
+  if isinstance(value, (set, frozenset)):
+    return {"set": sorted((_key(v) for v in value), key=json.dumps)}
+  if isinstance(value, (list, tuple)):
+    return [_key(v) for v in value]
+  return {type(value).__name__: _key(vars(value))}
+
+
+def _encode(value):
+  if isinstance(value, enum.Enum):
+    return {"enum": type(value).__name__, "name": value.name}
+  if isinstance(value, tuple):
+    return {"tuple": [_encode(v) for v in value]}
+  if isinstance(value, list):
+    return [_encode(v) for v in value]
+  if value is None or isinstance(value, (bool, int, float, str)):
+    return value
+  raise TypeError(f"Can't cache a value of type {type(value).__name__}")
+
+
+def _decode(value, namespace):
+  if isinstance(value, dict):
+    if "enum" in value:
+      return namespace[value["enum"]][value["name"]]
+    return tuple(_decode(v, namespace) for v in value["tuple"])
+  if isinstance(value, list):
+    return [_decode(v, namespace) for v in value]
+  return value
+
+
+def enable(path):
+  """Loads the results cached in a file, to which save() writes them back"""
+  global _path, _entries
+  _path = path
+
+  try:
+    with open(path) as file:
+      cache = json.load(file)
+  except (OSError, ValueError):
+    return
+
+  if cache.get("version") == _CACHE_VERSION and cache.get("fingerprint") == _sources_fingerprint():
+    _entries.update(cache.get("entries", {}))
+    _LOGGER.info(f"Loaded {len(_entries)} cached kernel configurations from {path}")
+  else:
+    _LOGGER.info(f"Ignoring kernel configurations cached by other generator sources in {path}")
+
+
+def save():
+  """Writes the cached results to the file given to enable(), if any were added"""
+  global _dirty
+  if _path is None or not _dirty:
+    return
+
+  cache = {"version": _CACHE_VERSION, "fingerprint": _sources_fingerprint(), "entries": _entries}
+  temporary = f"{_path}.{os.getpid()}.tmp"
+  with open(temporary, "w") as file:
+    json.dump(cache, file)
+  os.replace(temporary, _path)
+  _dirty = False
+
+
+def persistent(func):
+  """Memoizes a function on its arguments, across runs once enable() is called"""
+
+  @functools.wraps(func)
+  def wrapper(*args, **kwargs):
+    global _dirty
+    key = json.dumps([func.__qualname__, _key(list(args)), _key(kwargs)], sort_keys=True)
+    key = hashlib.sha256(key.encode()).hexdigest()
+
+    if key in _entries:
+      return _decode(_entries[key], func.__globals__)
+
+    result = func(*args, **kwargs)
+    _entries[key] = _encode(result)
+    _dirty = True
+    return result
+
+  return wrapper
@@ -92,11 +92,13 @@ try:
   from cutlass_library.manifest import *
   from cutlass_library.heuristics import *
   from cutlass_library.emit_kernel_listing import emit_gemm_kernel_testlist 
+  from cutlass_library import config_cache
 except ImportError:
   from library import *
   from manifest import *
   from heuristics import *
   from emit_kernel_listing import emit_gemm_kernel_testlist 
+  import config_cache
 ###################################################################################################
 
 #
@@ -10871,6 +10873,98 @@ def GenerateSM100_TensorOp_FastF32_UMMA_gemm_complex_stream_k(manifest, cuda_ver
       tile_schedulers=tile_schedulers)
 
 
+def GenerateSM100_TensorOp_FastF32_UMMA_gemm(manifest, cuda_version):
+  if not CudaToolkitVersionSatisfies(cuda_version, 12, 8):
+    return
+
+  # layouts for ABC and their alignments.
+  layouts = [
+    [[LayoutType.ColumnMajor, 4], [LayoutType.ColumnMajor, 4], [LayoutType.ColumnMajor, 4]],
+    [[LayoutType.ColumnMajor, 4], [LayoutType.RowMajor,    4], [LayoutType.ColumnMajor, 4]],
+    [[LayoutType.RowMajor,    4], [LayoutType.ColumnMajor, 4], [LayoutType.ColumnMajor, 4]],
+    [[LayoutType.RowMajor,    4], [LayoutType.RowMajor,    4], [LayoutType.ColumnMajor, 4]],
+    [[LayoutType.RowMajor,    4], [LayoutType.ColumnMajor, 4], [LayoutType.RowMajor,    4]],
+  ]
+
+  # FP32 operands are split into three BF16 matrices in the mainloop. The number of bands
+  # (6/8/9 products) is chosen at runtime through GemmUniversalArguments::emulation_bands.
+  data_types = [
+    {
+      "a_type"   : DataType.f32,
+      "b_type"   : DataType.f32,
+      "c_type"   : DataType.f32,
+      "d_type"   : DataType.f32,
+      "acc_type" : DataType.f32,
+      "epi_type" : DataType.f32,
+    }
+  ]
+
+  min_cc = 100
+  max_cc = 100
+
+  tile_schedulers = [
+    TileSchedulerType.Default, TileSchedulerType.StreamK,
+  ]
+
+  # 1xSM MMA kernels
+  math_instructions_1sm = [
+    MathInstruction(
+      [128, 128, 16],
+      DataType.bf16, DataType.bf16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+  ]
+
+  cluster_shapes_1sm = [
+    [1,1,1], [2,1,1]
+    , DynamicClusterShape
+  ]
+
+  for math_inst in math_instructions_1sm:
+    tile_descriptions = []
+    for cluster_shape in cluster_shapes_1sm:
+      multiplier = (1, 1, 1) if cluster_shape == DynamicClusterShape else cluster_shape
+      tile_descriptions.append(
+        TileDescription([
+          math_inst.instruction_shape[0] * multiplier[0],
+          math_inst.instruction_shape[1] * multiplier[1],
+          math_inst.instruction_shape[2]],
+          0, [4, 1, 1], math_inst, min_cc, max_cc, cluster_shape))
+
+    CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_types,
+      [[KernelScheduleType.TmaWarpSpecialized1SmFastFP32Sm100, EpilogueScheduleType.FastF32NoSmemWarpSpecialized1Sm]],
+      tile_schedulers=tile_schedulers)
+
+  # 2xSM MMA kernels
+  math_instructions_2sm = [
+    MathInstruction(
+      [256, 128, 16],
+      DataType.bf16, DataType.bf16, DataType.f32,
+      OpcodeClass.TensorOp,
+      MathOperation.multiply_add),
+  ]
+
+  cluster_shapes_2sm = [
+    [2,1,1], [4,1,1]
+    , DynamicClusterShape
+  ]
+
+  for math_inst in math_instructions_2sm:
+    tile_descriptions = []
+    for cluster_shape in cluster_shapes_2sm:
+      multiplier_2sm = (1, 1, 1) if cluster_shape == DynamicClusterShape else (cluster_shape[0] // 2, cluster_shape[1], cluster_shape[2])
+      tile_descriptions.append(
+        TileDescription([
+          math_inst.instruction_shape[0] * multiplier_2sm[0],
+          math_inst.instruction_shape[1] * multiplier_2sm[1],
+          math_inst.instruction_shape[2]],
+          0, [4, 1, 1], math_inst, min_cc, max_cc, cluster_shape))
+
+    CreateGemmUniversal3xOperator(manifest, layouts, tile_descriptions, data_types,
+      [[KernelScheduleType.TmaWarpSpecialized2SmFastFP32Sm100, EpilogueScheduleType.FastF32NoSmemWarpSpecialized2Sm]],
+      tile_schedulers=tile_schedulers)
+
+
 # Conv Utility functions
 def make_dims_and_alignments_triple(dim: int, bit_per_element_A: int, bit_per_element_B: int, bit_per_element_C: int):
   bit_alignment_required_by_tma = 128
@@ -11052,7 +11146,7 @@ def GenerateSM100_TensorOp_16b_UMMA_conv3x(manifest, cuda_version,
 
 def GenerateSM100_TensorOp_fp8_UMMA_conv3x(manifest, cuda_version,
                                            log_indent_level: int = 0):
-  # Instantiate Fp8 Fprop kernels with e4m3 A/B, f32 Acc, e4m3/bf16/f16/f32 C/D
+  # Instantiate Fp8 Fprop/Dgrad/Wgrad kernels with e4m3 A/B, f32 Acc, e4m3/bf16/f16/f32 C/D
   log_debug_line('GenerateSM100_TensorOp_fp8_UMMA_conv3x', log_indent_level)
   log_indent_level = log_indent_level + 1
 
@@ -11067,6 +11161,13 @@ def GenerateSM100_TensorOp_fp8_UMMA_conv3x(manifest, cuda_version,
 
 
   spatial_dims = [2, 3]
+
+  conv_kinds = [
+    ConvKind.Fprop,
+    ConvKind.Dgrad,
+    ConvKind.Wgrad
+  ]
+
   stages = 0 # zero means "deduce the number of stages automatically"
 
   data_types_and_instruction_shapes_1sm = [
@@ -11126,13 +11227,17 @@ def GenerateSM100_TensorOp_fp8_UMMA_conv3x(manifest, cuda_version,
         (mainloop_schedule, epilogue_schedule)
       ]
 
-      CreateConvOperator3x(manifest,
-                          dims_and_alignments = dims_and_alignments,
-                          tile_descriptions = tile_descriptions,
-                          data_types = data_type,
-                          schedule_pairs = schedule_pairs,
-                          conv_kind = ConvKind.Fprop,
-                          log_indent_level = log_indent_level)
+      for conv_kind in conv_kinds:
+        # Weight gradients are not emitted in 8 bits
+        if conv_kind == ConvKind.Wgrad and output_type == DataType.e4m3:
+          continue
+        CreateConvOperator3x(manifest,
+                            dims_and_alignments = dims_and_alignments,
+                            tile_descriptions = tile_descriptions,
+                            data_types = data_type,
+                            schedule_pairs = schedule_pairs,
+                            conv_kind = conv_kind,
+                            log_indent_level = log_indent_level)
 
   data_types_and_instruction_shapes_2sm = [
     # ((A,B,Acc,C/D), (InstM,InstN,InstK))
@@ -11191,13 +11296,17 @@ def GenerateSM100_TensorOp_fp8_UMMA_conv3x(manifest, cuda_version,
         (mainloop_schedule, epilogue_schedule)
       ]
 
-      CreateConvOperator3x(manifest,
-                          dims_and_alignments = dims_and_alignments,
-                          tile_descriptions = tile_descriptions,
-                          data_types = data_type,
-                          schedule_pairs = schedule_pairs,
-                          conv_kind = ConvKind.Fprop,
-                          log_indent_level = log_indent_level)
+      for conv_kind in conv_kinds:
+        # Weight gradients are not emitted in 8 bits
+        if conv_kind == ConvKind.Wgrad and output_type == DataType.e4m3:
+          continue
+        CreateConvOperator3x(manifest,
+                            dims_and_alignments = dims_and_alignments,
+                            tile_descriptions = tile_descriptions,
+                            data_types = data_type,
+                            schedule_pairs = schedule_pairs,
+                            conv_kind = conv_kind,
+                            log_indent_level = log_indent_level)
 
 def GenerateSM120_TensorOp_mixed_8bits_UMMA_gemm_with_block_scaled(manifest, cuda_version, gemm_kind=GemmKind.BlockScaledUniversal3x):
   # SM120 MMA with mixed F4/F6/F8 inputs + block scale
@@ -12049,6 +12158,8 @@ def GenerateSM100(manifest, cuda_version):
   GenerateSM100_TensorOp_32b_UMMA_gemm_complex(manifest, cuda_version)
   # CGemm with 9xBF16
   GenerateSM100_TensorOp_FastF32_UMMA_gemm_complex_stream_k(manifest, cuda_version)
+  # SGemm with 9xBF16
+  GenerateSM100_TensorOp_FastF32_UMMA_gemm(manifest, cuda_version)
 
   #
   # Sparse Gemm
@@ -12143,6 +12254,7 @@ def GenerateSM90_Conv3x(manifest, cuda_version,
   #
   # For performance on sm90, generally CUTLASS generates 64x128
   # instead of 128x64.
+  mma_64x64x32  = ( 64,  64,  32)
   mma_64x64x16  = ( 64,  64,  16)
   mma_64x64x8   = ( 64,  64,   8)
 
@@ -12160,6 +12272,7 @@ def GenerateSM90_Conv3x(manifest, cuda_version,
   fp32 = DataType.f32
   s8   = DataType.s8
   s32  = DataType.s32
+  e4m3 = DataType.e4m3
 
   # When generating kernels, the usual way is to specify 4 types,
   # (A, B, Acc, C/D).  Tests instead have 5 types,
@@ -12213,6 +12326,19 @@ def GenerateSM90_Conv3x(manifest, cuda_version,
     'alignment_B': 16,
     'alignment_C': 4,
   }
+  # FP8 WGMMA needs K-major A and B, which only fprop provides.
+  # Per-tensor dequantization scales fold into alpha.
+  e4m3_fp32_fp32_fp32 = {
+    'a_type':   e4m3,
+    'b_type':   e4m3,
+    'c_type':   fp32,
+    'd_type':   fp32,
+    'acc_type': fp32,
+    'epi_type': fp32,
+    'alignment_A': 16,
+    'alignment_B': 16,
+    'alignment_C': 4,
+  }
 
   # Other NVIDIA libraries may have the habit of specifying data types like this.
   bf16bf16_bf16f32_f32 = {
@@ -12308,6 +12434,19 @@ def GenerateSM90_Conv3x(manifest, cuda_version,
       ),
       cluster_shapes
     ),
+    product(
+      (
+        ConvKind.Fprop,
+      ),
+      spatial_dims,
+      (
+        e4m3_fp32_fp32_fp32,
+      ),
+      (
+        mma_64x64x32,
+      ),
+      cluster_shapes
+    ),
     product(
       (
         ConvKind.Dgrad,
@@ -12390,6 +12529,13 @@ def GenerateSM90_Conv3x(manifest, cuda_version,
       (ConvKind.Fprop, 2,       i8i8_i8i32_f32, (256, 128, 16), (2, 1, 1)),
       (ConvKind.Fprop, 2,       i8i8_i8i32_f32, (256, 128, 32), (2, 1, 1)),
       #
+      # e4m3_fp32_fp32_fp32
+      #
+      # cluster shape (2, 1, 1)
+      #
+      (ConvKind.Fprop, 2,  e4m3_fp32_fp32_fp32, (128, 256, 32), (2, 1, 1)),
+      (ConvKind.Fprop, 2,  e4m3_fp32_fp32_fp32, (256, 128, 32), (2, 1, 1)),
+      #
       # Dgrad
       #
       # bf16bf16_bf16f32_f32
@@ -12554,18 +12700,33 @@ def define_parser():
   parser.add_argument("--filter-by-cc", default='True', type=str, help='If enabled, kernels whose compute capability range is not satisfied by the build target are excluded.')
   parser.add_argument("--cuda-version", default="11.0.0", help="Semantic version string of CUDA Toolkit")
   parser.add_argument('--kernel-filter-file',   type=str, default=None, required=False, help='Full path of filter file')
+  parser.add_argument('--kernel-selection-database', type=str, default=None, required=False,
+                      help='Semicolon-delimited list of kernel selection databases written by cutlass_profiler ' +
+                      '--kernel-selection-output, or of files listing one kernel name per line. Only the kernels ' +
+                      'listed are emitted, along with the most general kernel of each of their functional keys ' +
+                      'as a fallback.')
   parser.add_argument('--heuristics-problems-file',   type=str, default=None, required=False, help='Full path of heuristics problem size description file, as a json list')
   parser.add_argument('--heuristics-testlist-file',   type=str, default=None, required=False, help='Full path of heuristics testlist CSV file, to be passed to cutlass_profiler')
   parser.add_argument('--heuristics-gpu',   type=str, default=None, required=False, help='GPU to use for evaluating heuristics offline. None or `auto` to autodetect using cuda', choices=['', 'auto', 'H100_SXM', 'H100_PCIE', 'H100_NVL', 'H200_SXM', 'H20_SXM', 'B200', 'GB200_NVL', 'RTX_5080', 'RTX_5090', 'RTX_PRO_6000'])
+  parser.add_argument('--heuristics-provider', type=str, default='nvmmh', required=False, choices=['nvmmh', 'learned'],
+                      help='Heuristics provider: nvidia-matmul-heuristics, or a cost model learned from cutlass_profiler results')
+  parser.add_argument('--heuristics-training-files', type=str, default=None, required=False,
+                      help='Semicolon-delimited list of cutlass_profiler CSV reports, or of models saved as json, training the learned heuristics provider')
   parser.add_argument('--heuristics-configs-per-problem',   type=int, default=10, required=False, help='Number of kernel configs to generate for each problem in the problem list')
   parser.add_argument('--heuristics-restrict-kernels', action='store_true', help='Restrict heuristics mode to use only the default set of kernels emitted by generator.py')
   parser.add_argument('--selected-kernel-list',   type=str, default=None, required=False,
                         help='Specify the output log file containing all enabled kernels in this build')
   parser.add_argument("--interface-dir", default=None, required=False, help="Interface header to kernels")
+  parser.add_argument('--kernels-per-shard', type=int, default=0, required=False,
+                      help='Target number of kernels compiled in each generated translation unit. Zero compiles each configuration file on its own.')
+  parser.add_argument('--generator-jobs', type=int, default=1, required=False,
+                      help='Number of processes emitting library sources of different operation kinds and architectures. Zero uses one per core.')
   parser.add_argument("--disable-full-archs-compilation", action="store_true", required=False, help="Disable compilation for every archs in --architectures")
   parser.add_argument("--log-level", default='info', type=numeric_log_level, required=False,
                       help='Logging level to be used by the generator script')
   parser.add_argument('--instantiation-level', type=str, default="", required=False, help="Instantiation level for SM90 kernels. Set to `max` and make sure `--kernels` is not empty to generate all possible configurations.")
+  parser.add_argument('--config-cache', type=str, default=None, required=False,
+                      help='File caching enumerated kernel configurations across runs. It is rewritten when the generator sources change.')
   _add_package_disablement_flag(parser)
   return parser
 
@@ -12579,10 +12740,14 @@ if __name__ == "__main__":
 
   manifest = Manifest(args)
 
+  if args.config_cache:
+    config_cache.enable(args.config_cache)
+
   archs = args.architectures.split(';')
 
+  heuristics_configs_and_operations = []
   if args.heuristics_problems_file:
-    filter_manifest_and_write_heuristics_file(manifest, args)
+    heuristics_configs_and_operations = filter_manifest_and_write_heuristics_file(manifest, args)
 
   GenerateSM50(manifest, args.cuda_version)
   GenerateSM60(manifest, args.cuda_version)
@@ -12606,6 +12771,11 @@ if __name__ == "__main__":
     GenerateSM100(manifest, args.cuda_version)
     GenerateSM120(manifest, args.cuda_version)
 
+  config_cache.save()
+
+  if args.heuristics_problems_file:
+    write_conv_heuristics_testlists(manifest, heuristics_configs_and_operations, args)
+
   if 'library' in args.generator_target.split(','):
     manifest.emit(GeneratorTarget.Library)
 
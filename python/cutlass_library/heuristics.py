@@ -35,6 +35,8 @@ Utilities for selecting CUTLASS library kernels based on problem description
 """
 import json
 import csv
+import os
+import re
 
 try:
   import builtins
@@ -122,19 +124,110 @@ def get_single_gemm_config(m, n, k, batch_count, layouts, dtypes, alignment_a, a
     provider = MatmulHeuristics()
   return provider.get_configs(m, n, k, batch_count, dtypes, layouts, alignment_a, alignment_b, voidC=voidC, use_fast_acc=use_fast_acc, count=count)
 
+# Implicit GEMM layouts (A, B, D) of each convolution kind, for channels-last tensors
+conv_implicit_gemm_layouts = {
+  'fprop': 'tnt',
+  'dgrad': 'ttt',
+  'wgrad': 'ntt',
+}
+
+def conv_problem_to_gemm(problem):
+  """
+  Map a conv2d or conv3d problem to the implicit GEMM computing it.
+
+  args:
+    problem: dictionary describing the convolution with the following keys:
+      - 'operation': 'conv2d' or 'conv3d'
+      - 'conv_kind': 'fprop', 'dgrad' or 'wgrad' (default: 'fprop')
+      - 'n', 'c', 'k': batch size, input channels and output channels (required)
+      - 'h', 'w' ('d' for conv3d): input extents (required)
+      - 'r', 's' ('t' for conv3d): filter extents (required)
+      - 'pad_h', 'pad_w', 'stride_h', 'stride_w', 'dilation_h', 'dilation_w' (and '_d' for conv3d): default 0, 1 and 1
+
+  returns:
+    (m, n, k, layout): implicit GEMM dimensions, and its layout as a 3-character string
+  """
+  spatial = ['h', 'w'] if problem['operation'] == 'conv2d' else ['d', 'h', 'w']
+  filter_extents = {'d': 't', 'h': 'r', 'w': 's'}
+
+  input_size = 1
+  output_size = 1
+  filter_size = 1
+  for dim in spatial:
+    extent = problem[dim]
+    filter_extent = problem[filter_extents[dim]]
+    pad = problem.get(f'pad_{dim}', 0)
+    stride = problem.get(f'stride_{dim}', 1)
+    dilation = problem.get(f'dilation_{dim}', 1)
+    input_size *= extent
+    output_size *= (extent + 2 * pad - dilation * (filter_extent - 1) - 1) // stride + 1
+    filter_size *= filter_extent
+
+  conv_kind = problem.get('conv_kind', 'fprop')
+  batch, channels, filters = problem['n'], problem['c'], problem['k']
+
+  if conv_kind == 'fprop':
+    m, n, k = batch * output_size, filters, channels * filter_size
+  elif conv_kind == 'dgrad':
+    m, n, k = batch * input_size, channels, filters * filter_size
+  elif conv_kind == 'wgrad':
+    m, n, k = filters, channels * filter_size, batch * output_size
+  else:
+    raise ValueError(f"Unsupported conv_kind {conv_kind}")
+
+  return m, n, k, conv_implicit_gemm_layouts[conv_kind]
+
+def _config_key(config):
+  """Attributes of a config which determine the kernel instantiated from it"""
+  return tuple(config[key] for key in (
+    'cta_tile_m', 'cta_tile_n', 'cta_tile_k', 'cluster_m', 'cluster_n', 'cluster_k'))
+
+def get_grouped_gemm_configs(groups, layouts, dtypes, alignment_a, alignment_b, voidC=False, use_fast_acc=True, count=1, provider=None):
+  """
+  Get heuristic-suggested kernel configurations for a grouped GEMM, given the distribution of its group shapes.
+
+  Each distinct group shape is ranked by the heuristic, and configurations are scored by their rank for each
+  shape weighted by the share of the grouped GEMM's FLOPs that shape accounts for.
+
+  args:
+    groups: list of dictionaries with keys 'm', 'n', 'k' and 'count' (number of groups of that shape, default: 1)
+    layouts, dtypes, alignment_a, alignment_b, voidC, use_fast_acc, count, provider: see get_single_gemm_config
+
+  returns:
+    A list of at most `count` kernel configurations, as returned by get_single_gemm_config
+  """
+  total_flops = sum(g['m'] * g['n'] * g['k'] * g.get('count', 1) for g in groups)
+
+  scores = {}
+  configs = {}
+  for group in groups:
+    weight = group['m'] * group['n'] * group['k'] * group.get('count', 1) / max(total_flops, 1)
+    group_configs = get_single_gemm_config(group['m'], group['n'], group['k'], 1, layouts, dtypes,
+                                           alignment_a, alignment_b, voidC, use_fast_acc, count, provider)
+    for rank, config in enumerate(group_configs):
+      key = _config_key(config)
+      scores[key] = scores.get(key, 0.0) + weight * (count - rank)
+      configs.setdefault(key, config)
+
+  ranked = sorted(scores.keys(), key=lambda key: scores[key], reverse=True)
+  return [configs[key] for key in ranked[:count]]
+
 def get_gemm_configs(problems, provider=None, count=1):
   """
   Get heuristic-suggested GEMM kernel configurations for a set of GEMM problems.
 
   args:
     problems: List of dictionaries describing GEMM problems with the following keys:
-      - 'm', 'n', 'k': Matrix dimensions (required)
+      - 'operation': 'gemm' (default), 'grouped_gemm', 'conv2d' or 'conv3d'
+      - 'm', 'n', 'k': Matrix dimensions (required for 'gemm')
+      - 'groups': List of group shapes, each a dictionary with keys 'm', 'n', 'k' and 'count' (required for 'grouped_gemm')
+      - Convolution problem sizes for 'conv2d' and 'conv3d' (see conv_problem_to_gemm)
       - 'dtype_a': Data type of matrix A (required)
       - 'dtype_b': Data type of matrix B (required)
       - 'dtype_c': Data type of matrix C (default: None)
       - 'dtype_d': Data type of matrix D (required)
       - 'dtype_acc': Compute data type (default 'f32')
-      - 'layout': Operation layout (e.g. 'tnt')
+      - 'layout': Operation layout (e.g. 'tnt'), required for 'gemm' and 'grouped_gemm'. Convolutions use the layout of their implicit GEMM
       - 'alignment_a': Memory access granularity of A, in units of elements (default: 16 bytes equivalent elements)
       - 'alignment_b': Memory access granularity of B, in units of elements (default: 16 bytes equivalent elements)
       - 'alpha': Scalar multiplier for A*B (default: 1.0)
@@ -152,19 +245,28 @@ def get_gemm_configs(problems, provider=None, count=1):
   for problem in problems:
     problem = problem.copy()
 
+    operation = problem.get('operation', 'gemm')
+
     try:
-      m = problem['m']
-      n = problem['n']
-      k = problem['k']
+      if operation == OperationKindNames[OperationKind.Gemm]:
+        m = problem['m']
+        n = problem['n']
+        k = problem['k']
+        layout = problem['layout']
+      elif operation == 'grouped_gemm':
+        groups = problem['groups']
+        layout = problem['layout']
+      elif operation in (OperationKindNames[OperationKind.Conv2d], OperationKindNames[OperationKind.Conv3d]):
+        m, n, k, layout = conv_problem_to_gemm(problem)
+      else:
+        raise ValueError(f"Unsupported operation {operation}")
       dtype_a = problem['dtype_a']
       dtype_b = problem['dtype_b']
       dtype_d = problem['dtype_d']
-      layout = problem['layout']
     except KeyError as e:
       _LOGGER.error(f"Missing required parameter {e} for problem {problem}")
       raise
 
-    operation = problem.get('operation', 'gemm')
     batch_count = problem.get('batch_count', 1)
     dtype_acc = problem.get('dtype_acc', 'f32')
     dtype_c = problem.get('dtype_c', None)
@@ -172,8 +274,6 @@ def get_gemm_configs(problems, provider=None, count=1):
     beta = problem.get('beta', 0.0)
     use_fast_acc = problem.get('use_fast_acc', True)
 
-    if operation != OperationKindNames[OperationKind.Gemm]:
-      raise ValueError(f"Unsupported operation {operation}")
     if not (len(layout) == 3 and all(c in "nt" for c in layout)):
       raise ValueError(f"layout must be a 3-character string containing only 'n' or 't', got {layout}")
     layouts = tuple(LayoutType.RowMajor if l == 't' else LayoutType.ColumnMajor for l in layout)
@@ -188,7 +288,10 @@ def get_gemm_configs(problems, provider=None, count=1):
     alignment_a = problem.get('alignment_a', 128 // DataTypeSize[dtypes[0]])
     alignment_b = problem.get('alignment_b', 128 // DataTypeSize[dtypes[1]])
 
-    configs = get_single_gemm_config(m, n, k, batch_count, layouts, dtypes, alignment_a, alignment_b, beta==0.0, use_fast_acc, count, provider)
+    if operation == 'grouped_gemm':
+      configs = get_grouped_gemm_configs(groups, layouts, dtypes, alignment_a, alignment_b, beta==0.0, use_fast_acc, count, provider)
+    else:
+      configs = get_single_gemm_config(m, n, k, batch_count, layouts, dtypes, alignment_a, alignment_b, beta==0.0, use_fast_acc, count, provider)
     problem['configs'] = configs
 
     ret.append(problem)
@@ -196,7 +299,7 @@ def get_gemm_configs(problems, provider=None, count=1):
   return ret
 
 
-def generate_sm100_from_heuristics_configs(manifest, cuda_version, kernel_configs):
+def generate_sm100_from_heuristics_configs(manifest, cuda_version, kernel_configs, gemm_kind=GemmKind.Universal3x):
   """
   Generate CUTLASS operations based on the list of configs provided by the heuristic provider
 
@@ -204,6 +307,7 @@ def generate_sm100_from_heuristics_configs(manifest, cuda_version, kernel_config
     manifest: manifest argument to which to add operations, or None to just return the operations without a manifest (for pruning an existing manifest)
     cuda_version: Cuda compiler version for generating cutlass operations
     kernel_configs: list of configs generated by the heuristic
+    gemm_kind: GemmKind.Universal3x, or GemmKind.GroupedUniversal3x for grouped GEMM
       
   returns:
     (configs, operations): a list of heuristic-provided kernel configs along with a one-to-one corresponding list of the generated operations
@@ -254,13 +358,14 @@ def generate_sm100_from_heuristics_configs(manifest, cuda_version, kernel_config
       cluster_shape=(config['cluster_m'], config['cluster_n'], config['cluster_k'])
     )
 
+    grouped = is_grouped(gemm_kind)
     schedules = []
     if is_2sm:
-      schedules.append([KernelScheduleType.TmaWarpSpecialized2SmSm100, EpilogueScheduleType.TmaWarpSpecialized2Sm])
+      schedules.append([to_grouped_schedule(KernelScheduleType.TmaWarpSpecialized2SmSm100, grouped), to_grouped_schedule(EpilogueScheduleType.TmaWarpSpecialized2Sm, grouped)])
     else:
-      schedules.append([KernelScheduleType.TmaWarpSpecialized1SmSm100, EpilogueScheduleType.TmaWarpSpecialized1Sm])
+      schedules.append([to_grouped_schedule(KernelScheduleType.TmaWarpSpecialized1SmSm100, grouped), to_grouped_schedule(EpilogueScheduleType.TmaWarpSpecialized1Sm, grouped)])
 
-    for o in CreateGemmUniversal3xOperator(manifest, [layout], [tile_description], data_types, schedules, tile_schedulers=[TileSchedulerType.Default, TileSchedulerType.StreamK], gemm_kind=GemmKind.Universal3x):
+    for o in CreateGemmUniversal3xOperator(manifest, [layout], [tile_description], data_types, schedules, tile_schedulers=[TileSchedulerType.Default, TileSchedulerType.StreamK], gemm_kind=gemm_kind):
       configs.append(config)
       operations.append(o)
 
@@ -268,7 +373,7 @@ def generate_sm100_from_heuristics_configs(manifest, cuda_version, kernel_config
   return configs, operations
 
 
-def generate_sm90_from_heuristics_configs(manifest, cuda_version, kernel_configs):
+def generate_sm90_from_heuristics_configs(manifest, cuda_version, kernel_configs, gemm_kind=GemmKind.Universal3x):
   """
   Generate CUTLASS operations based on the list of configs provided by the heuristic provider
 
@@ -276,6 +381,7 @@ def generate_sm90_from_heuristics_configs(manifest, cuda_version, kernel_configs
     manifest: manifest argument to which to add operations, or None to just return the operations without a manifest (for pruning an existing manifest)
     cuda_version: Cuda compiler version for generating cutlass operations
     kernel_configs: list of configs generated by the heuristic
+    gemm_kind: GemmKind.Universal3x, or GemmKind.GroupedUniversal3x for grouped GEMM
       
   returns:
     (configs, operations): a list of heuristic-provided kernel configs along with a one-to-one corresponding list of the generated operations
@@ -326,68 +432,191 @@ def generate_sm90_from_heuristics_configs(manifest, cuda_version, kernel_configs
       data_types=data_types,
       instantiation_level=9000, # don't prune schedules: we didn't get any schedule suggestion from the heuristic
       layout=layout,
-      gemm_kind=GemmKind.Universal3x,
+      gemm_kind=gemm_kind,
       enable_fp8_fast_acc=config['use_fast_acc']
     )
 
     if len(schedules):
-      for o in CreateGemmUniversal3xOperator(manifest, [layout], [tile_description], data_types, schedules, gemm_kind=GemmKind.Universal3x):
+      for o in CreateGemmUniversal3xOperator(manifest, [layout], [tile_description], data_types, schedules, gemm_kind=gemm_kind):
         configs.append(config)
         operations.append(o)
 
     if len(stream_k_schedules):
       for o in CreateGemmUniversal3xOperator(manifest, [layout], [tile_description], data_types,
                                     stream_k_schedules,
-                                    tile_schedulers=[TileSchedulerType.StreamK]):
+                                    tile_schedulers=[TileSchedulerType.StreamK],
+                                    gemm_kind=gemm_kind):
         configs.append(config)
         operations.append(o)
 
 
   return configs, operations
 
+def get_heuristics_provider(args):
+  """
+  Construct the heuristics provider selected by generator.py args
+
+  args:
+    args: generator.py args, uses:
+      - args.heuristics_provider: 'nvmmh' (default) for nvidia-matmul-heuristics, or 'learned' for a cost model
+        trained on cutlass_profiler results
+      - args.heuristics_gpu: GPU for nvidia-matmul-heuristics
+      - args.heuristics_training_files: semicolon-delimited list of cutlass_profiler CSV reports or saved models,
+        for the learned cost model
+
+  returns:
+    A heuristics provider implementing get_configs()
+  """
+  if getattr(args, 'heuristics_provider', 'nvmmh') == 'learned':
+    if not getattr(args, 'heuristics_training_files', None):
+      raise ValueError("The learned heuristics provider requires --heuristics-training-files")
+    return LearnedCostModelHeuristics(args.heuristics_training_files)
+
+  gpu = None if (args.heuristics_gpu == "auto" or args.heuristics_gpu == "") else args.heuristics_gpu
+  return MatmulHeuristics(gpu=gpu)
+
+def conv_kernel_filter(problem, config, cc):
+  """
+  Regular expression matching the names of the CUTLASS 3.x convolution kernels instantiated with a config
+
+  args:
+    problem: conv2d or conv3d problem the config was suggested for
+    config: config suggested by the heuristic for the implicit GEMM of the problem
+    cc: 90 or 100, the architecture of the kernels to match
+
+  returns:
+    A regular expression string
+  """
+  cluster = (config['cluster_m'], config['cluster_n'], config['cluster_k'])
+  tile = (config['cta_tile_m'], config['cta_tile_n'], config['cta_tile_k'])
+
+  # SM100 kernel names give the tile of a cluster
+  if cc >= 100:
+    tile = tuple(t * c for t, c in zip(tile, cluster))
+
+  layout = 'nhwc' if problem['operation'] == OperationKindNames[OperationKind.Conv2d] else 'ndhwc'
+
+  return (f"^cutlass3x_sm{cc}_tensorop_{problem.get('conv_kind', 'fprop')}_"
+          f"{problem['dtype_a'].lower()}{layout}_{problem['dtype_b'].lower()}{layout}_{problem.get('dtype_acc', 'f32').lower()}_\\w+_"
+          f"{tile[0]}x{tile[1]}x{tile[2]}_{cluster[0]}x{cluster[1]}x{cluster[2]}_")
+
+def heuristics_testlist_path(testlist_file, operation):
+  """Testlist of an operation: the given path for GEMMs, and `<stem>_<operation><ext>` for other operations"""
+  if operation == OperationKindNames[OperationKind.Gemm]:
+    return testlist_file
+  stem, ext = os.path.splitext(testlist_file)
+  return f"{stem}_{operation}{ext}"
+
 def filter_manifest_and_write_heuristics_file(manifest, args):
   """
   Prune a manifest according to heuristics suggestions from the problems file
 
+  GEMM and grouped GEMM problems generate the suggested kernels. Convolution problems keep the
+  convolution kernels instantiated by the generator whose tile and cluster shapes were suggested for
+  their implicit GEMMs; since their names are known only once the generator ran, their testlists are
+  written by write_conv_heuristics_testlists().
+
   args:
     manifest: Cutlass manifest to prune
     args: generator.py args, requires:
       - args.heuristics_problems_file
       - args.heuristics_gpu
       - args.heuristics_testlist_file
+      and optionally args.heuristics_provider and args.heuristics_training_files (see get_heuristics_provider())
       
   returns:
-    A list of dictionaries, each of which has information about an operation and a problem from the input problems
+    A list of dictionaries, each of which has information about an operation and a problem from the input problems.
+    Entries of convolution problems have an 'operation_name' of None and the 'kernel_filter' matching their kernels.
   """
   heuristics_problems = []
   with open(args.heuristics_problems_file, 'r') as f:
     heuristics_problems = json.load(f)
-  gpu = None if (args.heuristics_gpu == "auto" or args.heuristics_gpu == "") else args.heuristics_gpu
-  mmh = MatmulHeuristics(gpu=gpu)
+  provider = get_heuristics_provider(args)
   if any(('100' in arch) for arch in args.architectures.split(';')):
-    mmh.set_cta_div_n(64)
-  problems_with_configs = get_gemm_configs(heuristics_problems, provider=mmh, count=args.heuristics_configs_per_problem)
+    provider.set_cta_div_n(64)
+  problems_with_configs = get_gemm_configs(heuristics_problems, provider=provider, count=args.heuristics_configs_per_problem)
+
+  archs = args.architectures.split(';')
+  enable_sm90 = any('90' in arch for arch in archs)
+  enable_sm100 = any(('100' in arch) or ('101' in arch) for arch in archs)
 
   all_configs_and_operations = []
   operations = []
   for problem in problems_with_configs:
-    if any('90' in arch for arch in args.architectures.split(';')):
-        problem_configs, problem_operations = generate_sm90_from_heuristics_configs(None if args.heuristics_restrict_kernels else manifest, args.cuda_version, problem['configs'])
-    if any(('100' in arch) or ('101' in arch) for arch in args.architectures.split(';')):
-        problem_configs, problem_operations = generate_sm100_from_heuristics_configs(None if args.heuristics_restrict_kernels else manifest, args.cuda_version, problem['configs'])
-        
+    operation = problem.get('operation', 'gemm')
+    problem_without_configs = {k: v for k, v in problem.items() if k not in ('configs', 'groups')}
+
+    if operation in (OperationKindNames[OperationKind.Conv2d], OperationKindNames[OperationKind.Conv3d]):
+      for config in problem['configs']:
+        for cc, enabled in ((90, enable_sm90), (100, enable_sm100)):
+          if enabled:
+            kernel_filter = conv_kernel_filter(problem, config, cc)
+            manifest.add_kernel_filter(kernel_filter)
+            all_configs_and_operations.append({'operation_name': None, **problem_without_configs, **config, 'kernel_filter': kernel_filter})
+      continue
+
+    gemm_kind = GemmKind.GroupedUniversal3x if operation == 'grouped_gemm' else GemmKind.Universal3x
+    problem_configs, problem_operations = [], []
+    if enable_sm90:
+      configs, ops = generate_sm90_from_heuristics_configs(None if args.heuristics_restrict_kernels else manifest, args.cuda_version, problem['configs'], gemm_kind)
+      problem_configs += configs
+      problem_operations += ops
+    if enable_sm100:
+      configs, ops = generate_sm100_from_heuristics_configs(None if args.heuristics_restrict_kernels else manifest, args.cuda_version, problem['configs'], gemm_kind)
+      problem_configs += configs
+      problem_operations += ops
+
     operations += problem_operations
-    problem_without_configs = {k: v for k, v in problem.items() if k != 'configs'}
-    with_problem_size = [{'operation_name': o.procedural_name(), **problem_without_configs, **c} for c, o in zip(problem_configs, problem_operations)]
-    all_configs_and_operations += with_problem_size
+
+    # Grouped GEMMs are profiled once per group shape, with as many groups as the distribution has of that shape
+    if operation == 'grouped_gemm':
+      testcases = [{**problem_without_configs, 'm': g['m'], 'n': g['n'], 'k': g['k'], 'num_groups': g.get('count', 1)} for g in problem['groups']]
+    else:
+      testcases = [problem_without_configs]
+
+    all_configs_and_operations += [
+      {'operation_name': o.procedural_name(), **testcase, **c}
+      for c, o in zip(problem_configs, problem_operations) for testcase in testcases]
 
   for operation in operations:
     manifest.add_kernel_filter(f"^{operation.procedural_name()}$")
   if not all_configs_and_operations:
     raise Exception("No valid configurations generated")
-  write_profiler_testlist_to_csv(all_configs_and_operations, args.heuristics_testlist_file)
+
+  testlists = {}
+  for testcase in all_configs_and_operations:
+    if testcase['operation_name'] is not None:
+      testlists.setdefault(testcase.get('operation', 'gemm'), []).append(testcase)
+  for operation, testcases in testlists.items():
+    write_profiler_testlist_to_csv(testcases, heuristics_testlist_path(args.heuristics_testlist_file, operation))
   return all_configs_and_operations
 
+def write_conv_heuristics_testlists(manifest, configs_and_operations, args):
+  """
+  Write the testlists of the convolution problems pruned by filter_manifest_and_write_heuristics_file(),
+  once the generator added the convolution kernels to the manifest
+
+  args:
+    manifest: Cutlass manifest the generator added kernels to
+    configs_and_operations: list returned by filter_manifest_and_write_heuristics_file()
+    args: generator.py args, requires args.heuristics_testlist_file
+
+  returns:
+    None
+  """
+  testlists = {}
+  for testcase in configs_and_operations:
+    if testcase['operation_name'] is not None:
+      continue
+    kernel_filter = re.compile(testcase['kernel_filter'])
+    testcase = {k: v for k, v in testcase.items() if k != 'kernel_filter'}
+    for name in manifest.operations_by_name.keys():
+      if kernel_filter.search(name):
+        testlists.setdefault(testcase['operation'], []).append({**testcase, 'operation_name': name})
+
+  for operation, testcases in testlists.items():
+    write_profiler_testlist_to_csv(testcases, heuristics_testlist_path(args.heuristics_testlist_file, operation))
+
 def write_profiler_testlist_to_csv(configs_list, outfile_path):
   """
   Write a list of configs to a testlist to be consumed by cutlass_profiler
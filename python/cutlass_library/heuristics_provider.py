@@ -36,8 +36,11 @@ Providers for kernel selection heuristics
 
 import sys
 import os
+import csv
 import glob
+import json
 import logging
+import math
 import ctypes
 import functools
 
@@ -46,9 +49,11 @@ try:
   import builtins
   if hasattr(builtins, "CUTLASS_IGNORE_PACKAGE") and CUTLASS_IGNORE_PACKAGE == True:
     raise ImportError("Disabling attempt to import cutlass_library")
-  from cutlass_library.library import DataType, LayoutType
+  from cutlass_library.library import DataType, DataTypeNames, LayoutType
 except ImportError:
-  from library import DataType, LayoutType
+  from library import DataType, DataTypeNames, LayoutType
+
+_LOGGER = logging.getLogger(__name__)
 
 class MatmulHeuristics:
 
@@ -228,3 +233,316 @@ class MatmulHeuristics:
 
     return ret
 
+
+class LearnedCostModelHeuristics:
+  """
+  Heuristics provider ranking the kernel configurations measured by cutlass_profiler with a cost model
+  trained on those measurements. It implements the interface of MatmulHeuristics, so it may be passed as
+  the provider of get_gemm_configs().
+
+  The model is a ridge regression of the logarithm of the runtime on features of the problem (M, N, K,
+  batch count, data types, layouts) and of the kernel (tile and cluster shapes, schedule, split-K slices),
+  including the tile quantization and the number of mainloop iterations. Candidate configurations are the
+  ones present in the training data. Feeding the results of each tuning run back with add_profiler_results()
+  refines the model on the hardware the results were measured on.
+  """
+
+  # Substrings of kernel names identifying their schedule
+  schedule_keywords = (
+    'warpspecialized', 'cooperative', 'pingpong', 'stream_k', '1sm', '2sm', 'epi_nosmem', 'epi_tma', 'fp8_fast_accum'
+  )
+
+  # Columns of a cutlass_profiler CSV report copied into each sample
+  integer_columns = (
+    'm', 'n', 'k', 'batch_count', 'split_k_slices', 'swizzle_size',
+    'cta_m', 'cta_n', 'cta_k', 'cluster_m', 'cluster_n', 'cluster_k',
+    'inst_m', 'inst_n', 'inst_k', 'min_cc',
+  )
+
+  def __init__(self, profiler_results=None, ridge=1e-3):
+    """
+    args:
+      profiler_results: path or list of paths of cutlass_profiler CSV reports, or of models saved with save()
+      ridge: L2 regularization of the regression
+    """
+    self.ridge = ridge
+    self.samples = []
+    self.vocabulary = []
+    self.weights = []
+    self.cta_div_m = 1
+    self.cta_div_n = 1
+
+    if isinstance(profiler_results, str):
+      profiler_results = [path for path in profiler_results.split(';') if path]
+
+    for path in (profiler_results or []):
+      if path.endswith('.json'):
+        self.load(path)
+      else:
+        self.add_profiler_results(path, fit=False)
+
+    self.fit()
+
+  #
+  # Training data
+  #
+
+  @staticmethod
+  def _tensor_from_profiler(value):
+    """Parses a tensor column such as 'f16:column' into a (DataType name, 'n' or 't') pair"""
+    element, _, layout = value.partition(':')
+    if layout == 'column':
+      return element, 'n'
+    if layout == 'row':
+      return element, 't'
+    return None
+
+  def add_profiler_results(self, path, fit=True):
+    """
+    Adds the GEMMs measured by a cutlass_profiler CSV report to the training data
+
+    args:
+      path: path of the CSV report written by cutlass_profiler --output
+      fit: refit the model after adding the results
+
+    returns:
+      Number of samples added
+    """
+    added = 0
+
+    with open(path, 'r', newline='') as ifile:
+      for row in csv.DictReader(ifile):
+        if row.get('OperationKind', 'gemm') != 'gemm' or row.get('Provider', 'CUTLASS') != 'CUTLASS':
+          continue
+        if row.get('Status', 'success') != 'success':
+          continue
+
+        try:
+          runtime = float(row['Runtime'])
+          tensors = [self._tensor_from_profiler(row[operand]) for operand in ('A', 'B', 'D')]
+          sample = {column: int(float(row[column])) for column in self.integer_columns if row.get(column, '') != ''}
+        except (KeyError, ValueError):
+          continue
+
+        if runtime <= 0 or None in tensors or not all(c in sample for c in ('m', 'n', 'k', 'cta_m', 'cta_n', 'cta_k')):
+          continue
+
+        operation = row.get('Operation', '')
+        sample['runtime'] = runtime
+        sample['operation'] = operation
+        sample['dtype_a'], sample['dtype_b'], sample['dtype_d'] = (tensor[0] for tensor in tensors)
+        sample['layout'] = ''.join(tensor[1] for tensor in tensors)
+        sample['raster_order'] = row.get('raster_order', 'heuristic')
+        sample['schedule'] = [keyword for keyword in self.schedule_keywords if keyword in operation]
+
+        self.samples.append(sample)
+        added += 1
+
+    _LOGGER.info(f"Added {added} samples from {path} to the learned cost model")
+
+    if fit:
+      self.fit()
+
+    return added
+
+  def save(self, path):
+    """Saves the training data as json, so later tuning runs can keep refining the model"""
+    with open(path, 'w') as ofile:
+      json.dump({'ridge': self.ridge, 'samples': self.samples}, ofile)
+
+  def load(self, path):
+    """Adds the training data saved by save() and refits the model"""
+    with open(path, 'r') as ifile:
+      saved = json.load(ifile)
+    self.samples += saved.get('samples', [])
+    self.fit()
+
+  #
+  # Model
+  #
+
+  @staticmethod
+  def _log2(x):
+    return math.log2(max(float(x), 1.0))
+
+  def _numeric_features(self, sample):
+    m, n, k = sample['m'], sample['n'], sample['k']
+    batch_count = max(sample.get('batch_count', 1), 1)
+    split_k = max(sample.get('split_k_slices', 1), 1)
+    cta_m, cta_n, cta_k = sample['cta_m'], sample['cta_n'], sample['cta_k']
+    cluster_size = max(sample.get('cluster_m', 1), 1) * max(sample.get('cluster_n', 1), 1) * max(sample.get('cluster_k', 1), 1)
+
+    tiles_m = -(-m // cta_m)
+    tiles_n = -(-n // cta_n)
+    k_iterations = -(-k // (cta_k * split_k))
+
+    return [
+      1.0,
+      self._log2(m), self._log2(n), self._log2(k), self._log2(batch_count),
+      self._log2(2.0 * m * n * k * batch_count),
+      self._log2(cta_m), self._log2(cta_n), self._log2(cta_k), self._log2(cluster_size),
+      self._log2(tiles_m * tiles_n * batch_count * split_k),
+      self._log2(k_iterations),
+      (m * n) / float(tiles_m * cta_m * tiles_n * cta_n),
+      self._log2(split_k),
+    ]
+
+  @staticmethod
+  def _categories(sample):
+    categories = [
+      'dtype_a=' + sample['dtype_a'],
+      'dtype_b=' + sample['dtype_b'],
+      'dtype_d=' + sample['dtype_d'],
+      'layout=' + sample['layout'],
+      'raster_order=' + sample.get('raster_order', 'heuristic'),
+    ]
+    categories += ['schedule=' + keyword for keyword in sample.get('schedule', [])]
+    return categories
+
+  def _features(self, sample):
+    features = self._numeric_features(sample)
+    categories = set(self._categories(sample))
+    return features + [1.0 if category in categories else 0.0 for category in self.vocabulary]
+
+  def fit(self):
+    """Fits the regression to the training data"""
+    if not self.samples:
+      self.vocabulary = []
+      self.weights = []
+      return
+
+    self.vocabulary = sorted(set(category for sample in self.samples for category in self._categories(sample)))
+
+    rows = [self._features(sample) for sample in self.samples]
+    targets = [math.log(sample['runtime']) for sample in self.samples]
+    dim = len(rows[0])
+
+    # Solve the normal equations (X^T X + ridge * I) w = X^T y by Gaussian elimination
+    gram = [[0.0] * (dim + 1) for _ in range(dim)]
+    for row, target in zip(rows, targets):
+      for i in range(dim):
+        if row[i] == 0.0:
+          continue
+        gram_i = gram[i]
+        for j in range(dim):
+          gram_i[j] += row[i] * row[j]
+        gram_i[dim] += row[i] * target
+
+    for i in range(dim):
+      gram[i][i] += self.ridge * len(rows)
+
+    for col in range(dim):
+      pivot = max(range(col, dim), key=lambda r: abs(gram[r][col]))
+      gram[col], gram[pivot] = gram[pivot], gram[col]
+      if gram[col][col] == 0.0:
+        continue
+      for r in range(dim):
+        if r != col and gram[r][col] != 0.0:
+          factor = gram[r][col] / gram[col][col]
+          for c in range(col, dim + 1):
+            gram[r][c] -= factor * gram[col][c]
+
+    self.weights = [gram[i][dim] / gram[i][i] if gram[i][i] != 0.0 else 0.0 for i in range(dim)]
+
+  def predict_runtime(self, sample):
+    """Returns the runtime in milliseconds the model predicts for a problem and kernel configuration"""
+    if not self.weights:
+      raise RuntimeError("The learned cost model has no training data")
+    return math.exp(sum(w * x for w, x in zip(self.weights, self._features(sample))))
+
+  #
+  # Heuristics provider interface
+  #
+
+  def set_cta_div_n(self, div_n):
+    self.cta_div_n = div_n
+
+  def set_cta_div_m(self, div_m):
+    self.cta_div_m = div_m
+
+  @staticmethod
+  def _candidate_key(sample):
+    return tuple(sample.get(column, 1) for column in (
+      'cta_m', 'cta_n', 'cta_k', 'cluster_m', 'cluster_n', 'cluster_k', 'inst_m', 'inst_n', 'inst_k',
+      'split_k_slices', 'swizzle_size', 'min_cc')) + (sample.get('raster_order', 'heuristic'), tuple(sample.get('schedule', [])))
+
+  def get_configs(self, m, n, k, batch_count, dtypes, layouts, align_a, align_b, voidC=False, use_fast_acc=True, count=1):
+    dtype_a, dtype_b, dtype_acc, dtype_c, dtype_d = dtypes
+    layout = ''.join('t' if l == LayoutType.RowMajor else 'n' for l in layouts)
+    dtype_names = (DataTypeNames[dtype_a], DataTypeNames[dtype_b], DataTypeNames[dtype_d])
+
+    # Prefer configurations measured with the same data types and layouts
+    candidates = {}
+    for sample in self.samples:
+      if (sample['dtype_a'], sample['dtype_b'], sample['dtype_d']) == dtype_names and sample['layout'] == layout:
+        candidates.setdefault(self._candidate_key(sample), sample)
+    if not candidates:
+      for sample in self.samples:
+        candidates.setdefault(self._candidate_key(sample), sample)
+
+    ranked = []
+    for candidate in candidates.values():
+      query = dict(candidate)
+      query.update({
+        'm': m, 'n': n, 'k': k, 'batch_count': batch_count,
+        'dtype_a': dtype_names[0], 'dtype_b': dtype_names[1], 'dtype_d': dtype_names[2],
+        'layout': layout,
+      })
+      ranked.append((self.predict_runtime(query), candidate))
+    ranked.sort(key=lambda ranked_candidate: ranked_candidate[0])
+
+    ret = []
+    emitted = set()
+    for runtime, candidate in ranked:
+      cluster_m = max(candidate.get('cluster_m', 1), 1)
+      cluster_n = max(candidate.get('cluster_n', 1), 1)
+      cluster_k = max(candidate.get('cluster_k', 1), 1)
+
+      # SM100 and newer kernels report the tile of a cluster, while configurations describe the tile of a CTA
+      if candidate.get('min_cc', 90) >= 100:
+        cta_tile = (candidate['cta_m'] // cluster_m, candidate['cta_n'] // cluster_n, candidate['cta_k'] // cluster_k)
+      else:
+        cta_tile = (candidate['cta_m'], candidate['cta_n'], candidate['cta_k'])
+
+      if cta_tile[0] % self.cta_div_m or cta_tile[1] % self.cta_div_n:
+        continue
+
+      r = {}
+      r['estimated_runtime'] = runtime
+      r['cta_tile_m'], r['cta_tile_n'], r['cta_tile_k'] = cta_tile
+      r['instr_tile_m'] = candidate.get('inst_m', 0)
+      r['instr_tile_n'] = candidate.get('inst_n', 0)
+      r['instr_tile_k'] = candidate.get('inst_k', 0)
+      r['warp_tile_m'] = 0
+      r['warp_tile_n'] = 0
+      r['warp_tile_k'] = 0
+      r['cluster_m'] = cluster_m
+      r['cluster_n'] = cluster_n
+      r['cluster_k'] = cluster_k
+      r['layout_a'] = layouts[0]
+      r['layout_b'] = layouts[1]
+      r['layout_d'] = layouts[2]
+      r['dtype_a'] = dtypes[0]
+      r['dtype_b'] = dtypes[1]
+      r['dtype_acc'] = dtypes[2]
+      r['dtype_c'] = dtypes[3]
+      r['dtype_d'] = dtypes[4]
+      r['alignment_a'] = align_a
+      r['alignment_b'] = align_b
+      r['swizzle_size'] = candidate.get('swizzle_size', 1)
+      r['raster_order'] = candidate.get('raster_order', 'heuristic')
+      r['split_k_slices'] = candidate.get('split_k_slices', 1)
+      r['use_fast_acc'] = use_fast_acc
+      r['voidC'] = voidC
+
+      # Kernels differing only in schedule are emitted from the same configuration
+      config_key = (cta_tile, (cluster_m, cluster_n, cluster_k), r['swizzle_size'], r['raster_order'], r['split_k_slices'])
+      if config_key in emitted:
+        continue
+      emitted.add(config_key)
+
+      ret.append(r)
+      if len(ret) == count:
+        break
+
+    return ret
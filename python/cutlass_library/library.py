@@ -1214,19 +1214,41 @@ SharedMemPerCC = {
 
 ###################################################################################################
 
+# Patterns matching any of the keys of a substitution
+_SUBSTITUTION_PATTERNS = {}
+
 #
 def SubstituteTemplate(template, values):
+  # Values with backslashes are expanded as re.sub() replacement strings, one key at a time
+  if any("\\" in value for value in values.values()):
+    text = template
+    changed = True
+    while changed:
+      changed = False
+      for key, value in values.items():
+        regex = "\\$\\{%s\\}" % key
+        newtext = re.sub(regex, value, text)
+        if newtext != text:
+          changed = True
+        text = newtext
+    return text
+
+  if not values:
+    return template
+
+  # Otherwise all keys are substituted in one pass, repeated while values name other keys
+  keys = tuple(values.keys())
+  pattern = _SUBSTITUTION_PATTERNS.get(keys)
+  if pattern is None:
+    pattern = re.compile("\\$\\{(%s)\\}" % "|".join(re.escape(key) for key in keys))
+    _SUBSTITUTION_PATTERNS[keys] = pattern
+
   text = template
-  changed = True
-  while changed:
-    changed = False
-    for key, value in values.items():
-      regex = "\\$\\{%s\\}" % key
-      newtext = re.sub(regex, value, text)
-      if newtext != text:
-        changed = True
-      text = newtext
-  return text
+  while True:
+    newtext = pattern.sub(lambda match: values[match.group(1)], text)
+    if newtext == text:
+      return text
+    text = newtext
 
 ###################################################################################################
 
@@ -35,8 +35,12 @@ Utilities for filtering CUTLASS library kernels and emitting library intitializa
 and building code
 """
 
+import concurrent.futures
 import enum
+import hashlib
+import json
 import logging
+import os
 import os.path
 import shutil
 
@@ -116,7 +120,10 @@ namespace library {
 void initialize_all_${operation_name}_operations(Manifest &manifest) {
 """
     self.configuration_prototype_template = "void initialize_${configuration_name}(Manifest &manifest);\n"
-    self.configuration_template ="  initialize_${configuration_name}(manifest);\n"
+    self.configuration_template = """  if (manifest.is_enabled(${min_cc}, "${configuration_name}")) {
+    initialize_${configuration_name}(manifest);
+  }
+"""
 
     self.epilogue_template ="""}
 
@@ -157,9 +164,9 @@ void initialize_all_${operation_name}_operations(Manifest &manifest) {
     for min_cc, configurations in sorted(operations.items()):
       _LOGGER.debug(f"***   min_cc={min_cc}")
 
-      for configuration_name, _ in configurations.items():
+      for configuration_name in sorted(configurations.keys()):
         _LOGGER.debug(f"***     configuration_name={configuration_name}")
-        self.configurations.append(configuration_name)
+        self.configurations.append((min_cc, configuration_name))
         self.top_level_file.write(SubstituteTemplate(self.configuration_prototype_template, {'configuration_name': configuration_name} ))
 
   #
@@ -168,8 +175,11 @@ void initialize_all_${operation_name}_operations(Manifest &manifest) {
 
     self.top_level_file.write(SubstituteTemplate(self.entry_template, {'operation_name': OperationKindNames[self.kind]}))
 
-    for configuration_name in self.configurations:
-      self.top_level_file.write(SubstituteTemplate(self.configuration_template, {'configuration_name': configuration_name}))
+    for min_cc, configuration_name in self.configurations:
+      self.top_level_file.write(SubstituteTemplate(self.configuration_template, {
+        'min_cc': str(min_cc),
+        'configuration_name': configuration_name
+      }))
 
     self.top_level_file.write(self.epilogue_template)
     self.top_level_file.close()
@@ -212,6 +222,9 @@ class EmitOperationKindLibrary:
     self.min_cc = min_cc
     self.kind = kind
     self.args = args
+
+    # Target number of kernels compiled per translation unit, or zero to compile each configuration file on its own
+    self.kernels_per_shard = int(getattr(args, 'kernels_per_shard', 0) or 0)
     self.emitters = {
       OperationKind.Gemm: EmitGemmConfigurationLibrary,
       OperationKind.Conv2d: EmitConv2dConfigurationLibrary,
@@ -245,9 +258,13 @@ namespace library {
 void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Manifest &manifest) {
 """
     self.configuration_prototype_template = "void initialize_${configuration_name}(Manifest &manifest);\n"
-    self.configuration_template = "  initialize_${configuration_name}(manifest);\n"
+    self.configuration_template = """  if (manifest.is_enabled(${min_cc}, "${configuration_name}")) {
+    initialize_${configuration_name}(manifest);
+  }
+"""
     self.subclass_call_template = "  initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(manifest);\n"
     self.subclass_prototype_template = "void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Manifest &manifest);\n"
+    self.shard_include_template = "#include \"${configuration_file}\"\n"
     self.epilogue_template ="""}
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +301,9 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
     # Configurations in each sub class
     self.subclass_configurations = {}
 
+    # Number of kernels in each configuration file
+    self.kernel_counts = {}
+
     return self
 
   #
@@ -328,6 +348,7 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
       _LOGGER.debug('***   configuration_emitter.configuration_path: ' +
                     str(configuration_emitter.configuration_path))
       self.source_files[extended_name].append(configuration_emitter.configuration_path)
+      self.kernel_counts[configuration_emitter.configuration_path] = len(operations)
 
     self.subclass_configurations[extended_name].append(configuration_name)
     self.subclass_files[extended_name].write(SubstituteTemplate(self.configuration_prototype_template, {'configuration_name': configuration_name} ))
@@ -362,6 +383,7 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
       for configuration in self.subclass_configurations[subclass_name]:
         subclass_file.write(
           SubstituteTemplate(self.configuration_template, {
+            'min_cc': str(self.min_cc),
             'configuration_name': configuration
           }))
 
@@ -371,9 +393,44 @@ void initialize_all_sm${min_cc}_${subclass_name}_${operation_name}_operations(Ma
       # Write the call to initialize_all for this subclass to the top-level file
       self.top_level_file.write(SubstituteTemplate(self.subclass_call_template, subclass_cfg))
 
+      if self.kernels_per_shard > 0:
+        self.emit_shards(subclass_name, subclass_file.name)
+
     self.top_level_file.write(self.epilogue_template)
     self.top_level_file.close()
 
+  #
+  def emit_shards(self, subclass_name, subclass_top_level_path):
+    """
+    Replaces the configuration files of a subclass in its list of source files by shard files,
+    each including consecutive configuration files until it holds about kernels_per_shard kernels.
+    Since each configuration file holds a different number of kernels, this balances the compile
+    time of the translation units better than batching a fixed number of files.
+    """
+    shards = [[]]
+    shard_kernels = 0
+
+    for configuration_path in self.source_files[subclass_name][1:]:
+      if shards[-1] and shard_kernels + self.kernel_counts[configuration_path] > self.kernels_per_shard:
+        shards.append([])
+        shard_kernels = 0
+      shards[-1].append(configuration_path)
+      shard_kernels += self.kernel_counts[configuration_path]
+
+    subclass_dir = os.path.dirname(subclass_top_level_path)
+    self.source_files[subclass_name] = [subclass_top_level_path]
+
+    for shard_idx, configuration_paths in enumerate(shard for shard in shards if shard):
+      shard_path = os.path.join(
+        subclass_dir, f"all_sm{self.min_cc}_{subclass_name}_{OperationKindNames[self.kind]}_shard_{shard_idx}.cu").replace('\\', '/')
+      with open(shard_path, "w") as shard_file:
+        shard_file.write("\n/*\n Generated by manifest.py - Do not edit.\n*/\n\n")
+        for configuration_path in configuration_paths:
+          shard_file.write(SubstituteTemplate(self.shard_include_template, {
+            'configuration_file': os.path.basename(configuration_path)
+          }))
+      self.source_files[subclass_name].append(shard_path)
+
 class EmitInterfaceLibrary:
   """
   Emit the topmost-level CUTLASS library initialization code.
@@ -481,6 +538,67 @@ ${fn_calls}
     self.top_level_file.write(self.top_level_suffix)
     self.top_level_file.close()
 
+###################################################################################################
+
+def _emit_operation_kind_library(emitter, generated_path, min_cc, operation_kind, args, configurations):
+  """
+  Emits the library initialization code of one {operation_kind x min_cc} combination and returns
+  its source files by subclass. Defined at module level so that it may run in a worker process.
+  """
+  with emitter(generated_path, min_cc, operation_kind, args) as operation_kind_emitter:
+    # Configurations are emitted in sorted order so regenerating the same kernels reproduces the same sources
+    for configuration_name, operations in sorted(configurations.items()):
+      _LOGGER.info(f"Emitting {configuration_name} with {len(operations)} operation{'' if len(operations) == 1 else 's'}.")
+      operation_kind_emitter.emit(configuration_name, operations)
+
+  return operation_kind_emitter.source_files
+
+def _file_digest(path):
+  with open(path, 'rb') as file_reader:
+    return hashlib.sha256(file_reader.read()).digest()
+
+def _sync_generated_directory(staging_path, generated_path):
+  """
+  Moves the files emitted into staging_path to generated_path, replacing only the files whose
+  content changed and removing the files no longer emitted. Unchanged files keep their timestamps,
+  so the build system recompiles only the translation units whose generated source changed.
+  Returns the number of files written.
+  """
+  staged_files = set()
+  written = 0
+
+  for dirpath, _, filenames in os.walk(staging_path):
+    relative_dir = os.path.relpath(dirpath, staging_path)
+    os.makedirs(os.path.join(generated_path, relative_dir), exist_ok=True)
+
+    for filename in filenames:
+      relative_path = os.path.normpath(os.path.join(relative_dir, filename))
+      staged_files.add(relative_path)
+
+      staged_file = os.path.join(staging_path, relative_path)
+      generated_file = os.path.join(generated_path, relative_path)
+
+      if os.path.isfile(generated_file) and \
+         os.path.getsize(generated_file) == os.path.getsize(staged_file) and \
+         _file_digest(generated_file) == _file_digest(staged_file):
+        continue
+
+      os.replace(staged_file, generated_file)
+      written += 1
+
+  for dirpath, dirnames, filenames in os.walk(generated_path, topdown=False):
+    for filename in filenames:
+      relative_path = os.path.normpath(os.path.relpath(os.path.join(dirpath, filename), generated_path))
+      if relative_path not in staged_files:
+        os.remove(os.path.join(dirpath, filename))
+
+    if dirpath != generated_path and not os.listdir(dirpath):
+      os.rmdir(dirpath)
+
+  shutil.rmtree(staging_path)
+
+  return written
+
 ###################################################################################################
 ###################################################################################################
 
@@ -511,6 +629,12 @@ class Manifest:
     self.compute_capabilities_feature_set = ['50',]
     self.curr_build_dir = '.'
     self.filter_by_cc = True
+    self.generator_jobs = 1
+
+    # Names of the kernels selected by a kernel selection database, or None to keep every kernel
+    self.kernel_selection_names = None
+    # Most general unselected kernel of each functional key, kept as a fallback
+    self.kernel_selection_fallbacks = {}
 
     if self.args:
       self.kernel_filter = self.args.kernels
@@ -555,6 +679,17 @@ class Manifest:
               filter_count = len(self.kernel_filter_list),
               filter_file = args.kernel_filter_file))
 
+      if getattr(args, 'kernel_selection_database', None):
+          self.kernel_selection_names = self.get_kernel_selection_names(args.kernel_selection_database)
+          _LOGGER.info("Keeping {count} kernels selected in {path} and a fallback per functional key".format(
+              count = len(self.kernel_selection_names),
+              path = args.kernel_selection_database))
+
+      # Number of worker processes emitting {operation_kind x min_cc} combinations, or zero for one per core
+      self.generator_jobs = int(getattr(args, 'generator_jobs', 1) or 0)
+      if self.generator_jobs <= 0:
+        self.generator_jobs = os.cpu_count() or 1
+
       self.operation_count = 0
       self.operations_by_name = {}
       self.disable_full_archs_compilation = args.disable_full_archs_compilation
@@ -601,6 +736,64 @@ class Manifest:
     else:
         return []
 
+  def get_kernel_selection_names(self, paths):
+    ''' Returns the kernel names listed by a semicolon-delimited list of files. Each file is either a
+        JSON kernel selection database written by cutlass_profiler --kernel-selection-output, or a
+        list of kernel names with one name per line such as a usage log. '''
+    names = set()
+
+    for path in [x for x in paths.split(';') if x != '']:
+      with open(path, 'r') as file_reader:
+        text = file_reader.read()
+
+      if text.lstrip().startswith('{'):
+        database = json.loads(text)
+        names.update(selection['operation'] for selection in database.get('selections', []))
+      else:
+        names.update(line.strip() for line in text.splitlines() if line.strip() and not line.startswith('#'))
+
+    return names
+
+  #
+  def _functional_key(self, operation):
+    ''' Returns the operation attributes which select among kernels at runtime, as the library's
+        functional keys do. '''
+    tensors = tuple(
+      (tensor.element, tensor.layout) for tensor in
+      [getattr(operation, name, None) for name in ('A', 'B', 'C', 'D')] if tensor is not None)
+
+    return (
+      operation.operation_kind,
+      getattr(operation, 'gemm_kind', None),
+      getattr(operation, 'conv_kind', None),
+      operation.tile_description.math_instruction.element_accumulator,
+      getattr(operation, 'element_epilogue', None),
+      tensors)
+
+  #
+  def _maximum_alignment(self, operation):
+    ''' Returns the largest operand alignment an operation requires '''
+    return max([tensor.alignment for tensor in
+      [getattr(operation, name, None) for name in ('A', 'B', 'C')] if tensor is not None] + [1])
+
+  #
+  def add_kernel_selection_fallbacks(self):
+    ''' Inserts the fallback of each functional key with a selected kernel, unless a selected kernel
+        is already as general. Fallbacks keep problems outside the profiled buckets and problems with
+        smaller alignment running. '''
+    selected = {}
+
+    for operation in self.operations_by_name.values():
+      key = self._functional_key(operation)
+      selected[key] = min(selected.get(key, self._maximum_alignment(operation)), self._maximum_alignment(operation))
+
+    for key, operation in self.kernel_selection_fallbacks.items():
+      if key in selected and self._maximum_alignment(operation) < selected[key]:
+        _LOGGER.debug("Kernel {} included as the fallback of its functional key.".format(operation.procedural_name()))
+        self._insert(operation)
+
+    self.kernel_selection_fallbacks = {}
+
   #
   def filter_out_kernels(self, kernel_name, kernel_filter_list):
 
@@ -707,29 +900,47 @@ class Manifest:
 
     if self.filter(operation):
 
-      self.selected_kernels.append(operation.procedural_name())
+      # Kernels absent from the kernel selection database only compete to be a fallback
+      if self.kernel_selection_names is not None and operation.procedural_name() not in self.kernel_selection_names:
+        key = self._functional_key(operation)
+        fallback = self.kernel_selection_fallbacks.get(key)
 
-      self.operations_by_name[operation.procedural_name()] = operation
+        if fallback is None or self._maximum_alignment(operation) < self._maximum_alignment(fallback):
+          self.kernel_selection_fallbacks[key] = operation
 
-      # add the configuration
-      configuration_name = operation.configuration_name()
+        _LOGGER.debug("Culled {} from manifest as it is not in the kernel selection database".format(operation.procedural_name()))
+        return
 
-      # Split operations by minimum CC
-      min_cc = operation.arch
+      self._insert(operation)
+    else:
+      _LOGGER.debug("Culled {} from manifest".format(operation.procedural_name()))
+  #
 
-      if operation.operation_kind not in self.operations.keys():
-        self.operations[operation.operation_kind] = {}
+  #
+  def _insert(self, operation):
+    ''' Inserts an operation that passed filtering. '''
 
-      if min_cc not in self.operations[operation.operation_kind]:
-        self.operations[operation.operation_kind][min_cc] = {}
+    self.selected_kernels.append(operation.procedural_name())
 
-      if configuration_name not in self.operations[operation.operation_kind][min_cc].keys():
-        self.operations[operation.operation_kind][min_cc][configuration_name] = []
+    self.operations_by_name[operation.procedural_name()] = operation
 
-      self.operations[operation.operation_kind][min_cc][configuration_name].append(operation)
-      self.operation_count += 1
-    else:
-      _LOGGER.debug("Culled {} from manifest".format(operation.procedural_name()))
+    # add the configuration
+    configuration_name = operation.configuration_name()
+
+    # Split operations by minimum CC
+    min_cc = operation.arch
+
+    if operation.operation_kind not in self.operations.keys():
+      self.operations[operation.operation_kind] = {}
+
+    if min_cc not in self.operations[operation.operation_kind]:
+      self.operations[operation.operation_kind][min_cc] = {}
+
+    if configuration_name not in self.operations[operation.operation_kind][min_cc].keys():
+      self.operations[operation.operation_kind][min_cc][configuration_name] = []
+
+    self.operations[operation.operation_kind][min_cc][configuration_name].append(operation)
+    self.operation_count += 1
   #
 
   def emit_manifest_cmake(self, manifest_path, top_level_path, source_files):
@@ -754,6 +965,10 @@ class Manifest:
 """, { 'min_cc': str(min_cc), 'kind': OperationKindNames[kind], 'subclass': subclass })
             manifest_file.write(target_text + '\n\n')
 
+            # Shards already balance the kernels compiled per translation unit
+            if self.args and getattr(self.args, 'kernels_per_shard', 0):
+              manifest_file.write("    BATCH_SOURCES OFF\n")
+
             for source_file in source_files[kind][min_cc][subclass]:
               manifest_file.write("    %s\n" % str(source_file.replace('\\', '/')))
 
@@ -812,6 +1027,8 @@ class Manifest:
   #
   def emit(self, target = GeneratorTarget.Library):
 
+    self.add_kernel_selection_fallbacks()
+
     operation_emitters = {
       GeneratorTarget.Library: EmitOperationKindLibrary
     }
@@ -827,14 +1044,19 @@ class Manifest:
 
     generated_path = os.path.join(self.curr_build_dir, 'generated')
 
-    # create generated/
-    if os.path.exists(generated_path):
-      shutil.rmtree(generated_path)
+    # Emit into a staging directory, then move only the files whose content changed into generated/
+    staging_path = os.path.join(self.curr_build_dir, 'generated.staging')
 
-    os.mkdir(generated_path)
+    def generated_file(staged_file):
+      return os.path.join(generated_path, os.path.relpath(staged_file, staging_path)).replace('\\', '/')
 
-    with interface_emitters[target](generated_path, self.operation_count, self.args) as iface_emitter:
-      top_level_path = iface_emitter.top_level_path
+    if os.path.exists(staging_path):
+      shutil.rmtree(staging_path)
+
+    os.mkdir(staging_path)
+
+    with interface_emitters[target](staging_path, self.operation_count, self.args) as iface_emitter:
+      top_level_path = generated_file(iface_emitter.top_level_path)
       for operation_kind in self.operations.keys():
         iface_emitter.emit(OperationKindNames[operation_kind])
 
@@ -844,25 +1066,48 @@ class Manifest:
       for min_cc in self.operations[kind].keys():
         source_files[kind][min_cc] = {}
 
-    for operation_kind, ops in self.operations.items():
-      for min_cc, configurations in sorted(ops.items()):
-        with operation_emitters[target](generated_path, min_cc, operation_kind, self.args) as operation_kind_emitter:
-          for configuration_name, operations in configurations.items():
-            _LOGGER.info(f"Emitting {configuration_name} with {len(operations)} operation{'' if len(operations) == 1 else 's'}.")
-            operation_kind_emitter.emit(configuration_name, operations)
-
-          for subclass, files in operation_kind_emitter.source_files.items():
-            if subclass not in source_files[operation_kind][min_cc]:
-              source_files[operation_kind][min_cc][subclass] = []
-            source_files[operation_kind][min_cc][subclass].extend(operation_kind_emitter.source_files[subclass])
+    # Each {operation_kind x min_cc} combination is emitted into its own directory, so the
+    # combinations are emitted in parallel
+    emission_jobs = [
+      (operation_kind, min_cc, configurations)
+      for operation_kind, ops in self.operations.items()
+      for min_cc, configurations in sorted(ops.items())
+    ]
+
+    worker_count = min(self.generator_jobs, len(emission_jobs))
+    if worker_count > 1:
+      _LOGGER.info(f"Emitting {len(emission_jobs)} operation kind and architecture combinations with {worker_count} processes.")
+      with concurrent.futures.ProcessPoolExecutor(max_workers=worker_count) as executor:
+        futures = [
+          executor.submit(_emit_operation_kind_library,
+            operation_emitters[target], staging_path, min_cc, operation_kind, self.args, configurations)
+          for operation_kind, min_cc, configurations in emission_jobs
+        ]
+        emitted_source_files = [future.result() for future in futures]
+    else:
+      emitted_source_files = [
+        _emit_operation_kind_library(
+          operation_emitters[target], staging_path, min_cc, operation_kind, self.args, configurations)
+        for operation_kind, min_cc, configurations in emission_jobs
+      ]
+
+    for (operation_kind, min_cc, _), subclass_files in zip(emission_jobs, emitted_source_files):
+      for subclass, files in subclass_files.items():
+        if subclass not in source_files[operation_kind][min_cc]:
+          source_files[operation_kind][min_cc][subclass] = []
+        source_files[operation_kind][min_cc][subclass].extend(generated_file(f) for f in files)
 
+    for operation_kind, ops in self.operations.items():
       # Emit top level all_{gemm, conv2d, ...}_operations.cu files
-      with kind_emitters[target](generated_path, operation_kind, self.args) as operation_kind_emitter:
+      with kind_emitters[target](staging_path, operation_kind, self.args) as operation_kind_emitter:
         operation_kind_emitter.emit(ops)
 
     # write the manifest.cmake file containing paths from all targets
-    manifest_path = os.path.join(generated_path, "manifest.cmake")
+    manifest_path = os.path.join(staging_path, "manifest.cmake")
 
     self.emit_manifest_cmake(manifest_path, top_level_path, source_files)
 
+    written = _sync_generated_directory(staging_path, generated_path)
+    _LOGGER.info(f"Rewrote {written} generated file{'' if written == 1 else 's'} whose content changed.")
+
 ###################################################################################################
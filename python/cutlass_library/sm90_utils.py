@@ -50,8 +50,10 @@ try:
   if hasattr(builtins, "CUTLASS_IGNORE_PACKAGE") and CUTLASS_IGNORE_PACKAGE == True:
     raise ImportError("Disabling attempt to import cutlass_library")
   from cutlass_library.library import *
+  from cutlass_library.config_cache import persistent
 except ImportError:
   from library import *
+  from config_cache import persistent
 
 # NOTE: this is a duplicate of CudaToolkitVersionSatisfies in generator.py
 def CudaToolkitVersionSatisfies(semantic_ver_string, major, minor, patch = 0):
@@ -440,6 +442,7 @@ def can_tile_desc_use_shmem_in_epilogue(tile_description, data_types):
     return True
 
 
+@persistent
 def get_valid_schedules(tile_description, cuda_version, is_aligned, data_types, layout,
                         instantiation_level, enable_fp8_fast_acc=True, gemm_kind=GemmKind.Universal3x):
     # Level 0: prune according to existing generator.py behavior
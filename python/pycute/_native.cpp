@@ -0,0 +1,296 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Native implementation of the flat-layout kernels of pycute's layout algebra
+
+    The functions below take layouts flattened to lists of Python ints and follow layout.py step
+    for step, including Python's floor division and modulo of negative strides. They return None
+    whenever layout.py would fail an assertion or an intermediate value would overflow 64 bits, in
+    which case layout.py recomputes the result in Python, raising its own errors.
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace {
+
+using IntVector = std::vector<int64_t>;
+
+/// Flat layout: shape and stride of each mode
+struct FlatLayout {
+  IntVector shape;
+  IntVector stride;
+};
+
+/// Python's a // b
+int64_t floor_div(int64_t a, int64_t b) {
+  int64_t q = a / b;
+  if ((a % b != 0) && ((a < 0) != (b < 0))) {
+    --q;
+  }
+  return q;
+}
+
+/// Python's a % b
+int64_t floor_mod(int64_t a, int64_t b) {
+  int64_t r = a % b;
+  if (r != 0 && ((r < 0) != (b < 0))) {
+    r += b;
+  }
+  return r;
+}
+
+/// a * b, or false if it overflows. Operands never equal INT64_MIN: layout.py only passes values
+/// of magnitude below _NATIVE_LIMIT and products are bounded by INT64_MAX.
+bool checked_mul(int64_t a, int64_t b, int64_t &result) {
+  if (a != 0 && std::abs(b) > std::numeric_limits<int64_t>::max() / std::abs(a)) {
+    return false;
+  }
+  result = a * b;
+  return true;
+}
+
+/// coalesce() of a flattened layout
+std::optional<FlatLayout> coalesce(IntVector const &shape, IntVector const &stride) {
+  FlatLayout result{{1}, {0}};
+
+  for (size_t i = 0; i < std::min(shape.size(), stride.size()); ++i) {
+    int64_t curr_shape = shape[i];
+    int64_t curr_stride = stride[i];
+
+    // skip their shape-1s
+    if (curr_shape == 1) {
+      continue;
+    }
+
+    // replace our shape-1 with anything
+    if (result.shape.back() == 1) {
+      result.shape.back() = curr_shape;
+      result.stride.back() = curr_stride;
+      continue;
+    }
+
+    int64_t extent;
+    if (!checked_mul(result.shape.back(), result.stride.back(), extent)) {
+      return std::nullopt;
+    }
+
+    // merge modes if the shape*stride match
+    if (extent == curr_stride) {
+      if (!checked_mul(result.shape.back(), curr_shape, result.shape.back())) {
+        return std::nullopt;
+      }
+    }
+    // append a new mode
+    else {
+      result.shape.push_back(curr_shape);
+      result.stride.push_back(curr_stride);
+    }
+  }
+
+  return result;
+}
+
+/// composition() of layout A with a single-mode layout B
+std::optional<FlatLayout> composition(
+  IntVector const &shape_A, IntVector const &stride_A, int64_t shape_B, int64_t stride_B) {
+
+  if (stride_B == 0) {
+    return FlatLayout{{shape_B}, {0}};
+  }
+
+  auto flat_A = coalesce(shape_A, stride_A);
+  if (!flat_A) {
+    return std::nullopt;
+  }
+
+  FlatLayout result;
+  int64_t rest_shape = shape_B;
+  int64_t rest_stride = stride_B;
+
+  for (size_t i = 0; i + 1 < flat_A->shape.size(); ++i) {
+    int64_t curr_shape = flat_A->shape[i];
+    int64_t curr_stride = flat_A->stride[i];
+
+    if (curr_shape <= 0 || rest_stride == 0 ||
+        (floor_mod(curr_shape, rest_stride) != 0 && floor_mod(rest_stride, curr_shape) != 0)) {
+      return std::nullopt;
+    }
+    int64_t new_shape = std::min(std::max(int64_t(1), floor_div(curr_shape, rest_stride)), rest_shape);
+
+    if (new_shape != 1) {
+      int64_t new_stride;
+      if (!checked_mul(rest_stride, curr_stride, new_stride)) {
+        return std::nullopt;
+      }
+      result.shape.push_back(new_shape);
+      result.stride.push_back(new_stride);
+    }
+
+    rest_shape = floor_div(rest_shape, new_shape);
+    rest_stride = -floor_div(-rest_stride, curr_shape);
+  }
+
+  if (rest_shape != 1 || result.shape.empty()) {
+    int64_t new_stride;
+    if (!checked_mul(rest_stride, flat_A->stride.back(), new_stride)) {
+      return std::nullopt;
+    }
+    result.shape.push_back(rest_shape);
+    result.stride.push_back(new_stride);
+  }
+
+  return result;
+}
+
+/// complement() of a flattened layout with respect to max_idx
+std::optional<FlatLayout> complement(IntVector const &shape, IntVector const &stride, int64_t max_idx) {
+  std::vector<std::pair<int64_t, int64_t>> sorted_DS;
+  for (size_t i = 0; i < std::min(shape.size(), stride.size()); ++i) {
+    sorted_DS.emplace_back(stride[i], shape[i]);
+  }
+  std::sort(sorted_DS.begin(), sorted_DS.end());
+
+  IntVector result_shape;
+  IntVector result_stride;
+  int64_t current_idx = 1;
+
+  for (auto const &[curr_stride, curr_shape] : sorted_DS) {
+    if (curr_stride == 0 || curr_shape == 1) {
+      continue;
+    }
+
+    int64_t extent;
+    if (!checked_mul(curr_shape, curr_stride, extent) || !(current_idx <= extent)) {
+      return std::nullopt;
+    }
+
+    result_shape.push_back(floor_div(curr_stride, current_idx));
+    result_stride.push_back(current_idx);
+    current_idx = extent;
+  }
+
+  // current_idx is positive here
+  if (max_idx > std::numeric_limits<int64_t>::max() - (current_idx - 1)) {
+    return std::nullopt;
+  }
+  result_shape.push_back(floor_div(max_idx + current_idx - 1, current_idx));
+  result_stride.push_back(current_idx);
+
+  return coalesce(result_shape, result_stride);
+}
+
+/// logical_divide() of layout A by a single-mode layout B: the composition of A with B and with
+/// each mode of the complement of B
+std::optional<std::pair<FlatLayout, std::vector<FlatLayout>>> logical_divide(
+  IntVector const &shape_A, IntVector const &stride_A, int64_t shape_B, int64_t stride_B) {
+
+  int64_t size_A = 1;
+  for (int64_t extent : shape_A) {
+    if (!checked_mul(size_A, extent, size_A)) {
+      return std::nullopt;
+    }
+  }
+
+  auto tile = composition(shape_A, stride_A, shape_B, stride_B);
+  auto rest = complement({shape_B}, {stride_B}, size_A);
+  if (!tile || !rest) {
+    return std::nullopt;
+  }
+
+  std::vector<FlatLayout> rest_modes;
+  for (size_t i = 0; i < rest->shape.size(); ++i) {
+    auto mode = composition(shape_A, stride_A, rest->shape[i], rest->stride[i]);
+    if (!mode) {
+      return std::nullopt;
+    }
+    rest_modes.push_back(std::move(*mode));
+  }
+
+  return std::make_pair(std::move(*tile), std::move(rest_modes));
+}
+
+/// Converts a flat layout to a (shape, stride) pair of tuples
+py::tuple to_python(FlatLayout const &layout) {
+  return py::make_tuple(py::tuple(py::cast(layout.shape)), py::tuple(py::cast(layout.stride)));
+}
+
+template <typename T>
+py::object to_python(std::optional<T> const &layout) {
+  if (!layout) {
+    return py::none();
+  }
+  return to_python(*layout);
+}
+
+} // namespace
+
+PYBIND11_MODULE(_native, m) {
+  m.doc() = "Native implementation of the flat-layout kernels of pycute's layout algebra";
+
+  m.def("coalesce", [](IntVector const &shape, IntVector const &stride) {
+    return to_python(coalesce(shape, stride));
+  }, "coalesce() of a flattened layout as (shape, stride) tuples, or None", py::arg("shape"), py::arg("stride"));
+
+  m.def("composition", [](IntVector const &shape_A, IntVector const &stride_A, int64_t shape_B, int64_t stride_B) {
+    return to_python(composition(shape_A, stride_A, shape_B, stride_B));
+  }, "composition() of a flattened layout with a single-mode layout as (shape, stride) tuples, or None",
+    py::arg("shape_A"), py::arg("stride_A"), py::arg("shape_B"), py::arg("stride_B"));
+
+  m.def("complement", [](IntVector const &shape, IntVector const &stride, int64_t max_idx) {
+    return to_python(complement(shape, stride, max_idx));
+  }, "complement() of a flattened layout as (shape, stride) tuples, or None",
+    py::arg("shape"), py::arg("stride"), py::arg("max_idx"));
+
+  m.def("logical_divide", [](IntVector const &shape_A, IntVector const &stride_A, int64_t shape_B, int64_t stride_B) -> py::object {
+    auto result = logical_divide(shape_A, stride_A, shape_B, stride_B);
+    if (!result) {
+      return py::none();
+    }
+    py::list rest;
+    for (FlatLayout const &mode : result->second) {
+      rest.append(to_python(mode));
+    }
+    return py::make_tuple(to_python(result->first), rest);
+  }, "logical_divide() of a flattened layout by a single-mode layout as the (shape, stride) tuples of the tile "
+    "and a list of those of each mode of the rest, or None",
+    py::arg("shape_A"), py::arg("stride_A"), py::arg("shape_B"), py::arg("stride_B"));
+}
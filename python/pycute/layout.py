@@ -35,10 +35,27 @@ Definition of CuTe Layouts and functions to manipulate them
 """
 
 from itertools import chain
+import os
 from typing import Union
 
 from .int_tuple import *
 
+# Compiled implementation of the flat-layout kernels below. Set PYCUTE_DISABLE_NATIVE=1 to use the
+# pure-Python implementation only.
+try:
+  if os.environ.get("PYCUTE_DISABLE_NATIVE", "0") == "1":
+    raise ImportError("pycute native backend disabled")
+  from . import _native
+except ImportError:
+  _native = None
+
+# Magnitude of the values the native backend is given, keeping its 64-bit arithmetic exact
+_NATIVE_LIMIT = 1 << 31
+
+
+def _is_native(*values):
+  return _native is not None and all(type(v) is int and -_NATIVE_LIMIT < v < _NATIVE_LIMIT for v in values)
+
 
 class LayoutBase:
   pass
@@ -112,6 +129,14 @@ class Layout(LayoutBase):
     return f"Layout({self.shape},{self.stride})"
 
 
+# Make Layout from the shape and stride tuples of a flat layout, unwrapping a single mode
+def _make_flat_layout(shape, stride):
+  if len(shape) == 1:
+    return Layout(shape[0], stride[0])
+  else:
+    return Layout(tuple(shape), tuple(stride))
+
+
 # Make Layout from a list of layouts (each layout it's own mode in the result)
 def make_layout(*layouts):
   if len(layouts) == 1 and not is_layout(layouts[0]):
@@ -140,9 +165,15 @@ def coalesce(layout, profile=None):
     return make_layout(chain((coalesce(layout[i], profile[i]) for i in range(           0,len(profile))),
                              (layout[i]                       for i in range(len(profile),len(layout)))))
 
+  flat_shape, flat_stride = flatten(layout.shape), flatten(layout.stride)
+  if _is_native(*flat_shape, *flat_stride):
+    result = _native.coalesce(flat_shape, flat_stride)
+    if result is not None:
+      return _make_flat_layout(*result)
+
   result_shape  = [1]
   result_stride = [0]
-  for (shape,stride) in zip(flatten(layout.shape),flatten(layout.stride)):
+  for (shape,stride) in zip(flat_shape,flat_stride):
     # skip their shape-1s
     if shape == 1:
       continue
@@ -202,12 +233,18 @@ def composition(layoutA, layoutB):
   if layoutB.stride == 0:
     return Layout(layoutB.shape, 0)
   else:
+    flat_A = coalesce(layoutA)
+    flat_A_shape, flat_A_stride = flatten(flat_A.shape), flatten(flat_A.stride)
+    if _is_native(layoutB.shape, layoutB.stride, *flat_A_shape, *flat_A_stride):
+      result = _native.composition(flat_A_shape, flat_A_stride, layoutB.shape, layoutB.stride)
+      if result is not None:
+        return _make_flat_layout(*result)
+
     result_shape  = []
     result_stride = []
     rest_shape    = layoutB.shape
     rest_stride   = layoutB.stride
-    flat_A = coalesce(layoutA)
-    for (curr_shape, curr_stride) in zip(flatten(flat_A.shape)[:-1], flatten(flat_A.stride)[:-1]):
+    for (curr_shape, curr_stride) in zip(flat_A_shape[:-1], flat_A_stride[:-1]):
       assert curr_shape % rest_stride == 0 or rest_stride % curr_shape == 0
       new_shape = min(max(1, curr_shape // rest_stride), rest_shape)
 
@@ -220,7 +257,7 @@ def composition(layoutA, layoutB):
 
     if rest_shape != 1 or len(result_shape) == 0:
       result_shape.append(rest_shape)
-      result_stride.append(rest_stride * flatten(flat_A.stride)[-1])
+      result_stride.append(rest_stride * flat_A_stride[-1])
 
     if len(result_shape) == 1:
       return Layout(result_shape[0], result_stride[0])
@@ -233,11 +270,17 @@ def complement(layout, max_idx=1):
   if is_int(layout):
     return complement(Layout(layout))
 
+  flat_shape, flat_stride = flatten(layout.shape), flatten(layout.stride)
+  if _is_native(max_idx, *flat_shape, *flat_stride):
+    result = _native.complement(flat_shape, flat_stride, max_idx)
+    if result is not None:
+      return _make_flat_layout(*result)
+
   result_shape  = []
   result_stride = []
   current_idx = 1
 
-  sorted_DS = sorted(zip(flatten(layout.stride), flatten(layout.shape)))
+  sorted_DS = sorted(zip(flat_stride, flat_shape))
   for (stride, shape) in sorted_DS:
     if stride == 0 or shape == 1:
       continue
@@ -304,6 +347,17 @@ def logical_divide(layoutA, layoutB):
     return make_layout(chain((logical_divide(layoutA[i], layoutB[i]) for i in range(           0,len(layoutB))),
                              (layoutA[i]                             for i in range(len(layoutB),len(layoutA)))))
 
+  if not is_tuple(layoutB.shape):
+    flat_shape, flat_stride = flatten(layoutA.shape), flatten(layoutA.stride)
+    if _is_native(layoutB.shape, layoutB.stride, *flat_shape, *flat_stride):
+      result = _native.logical_divide(flat_shape, flat_stride, layoutB.shape, layoutB.stride)
+      if result is not None:
+        tile, rest = result
+        if len(rest) == 1:
+          return make_layout(_make_flat_layout(*tile), _make_flat_layout(*rest[0]))
+        else:
+          return make_layout(_make_flat_layout(*tile), make_layout(_make_flat_layout(*mode) for mode in rest))
+
   return composition(layoutA, make_layout(layoutB, complement(layoutB, size(layoutA))))
 
 
@@ -33,12 +33,24 @@
 from setuptools import setup
 
 
+def native_extensions():
+    # The compiled layout algebra backend is optional: pycute falls back to its Python
+    # implementation when pybind11 is unavailable.
+    try:
+        from pybind11.setup_helpers import Pybind11Extension
+    except ImportError:
+        return []
+
+    return [Pybind11Extension('pycute._native', ['pycute/_native.cpp'], cxx_std=17)]
+
+
 def perform_setup():
     setup(
         name='pycute',
         version='4.6.0',
         description='Python implementation of CuTe',
         packages=['pycute'],
+        ext_modules=native_extensions(),
     )
 
 
@@ -0,0 +1,97 @@
+#################################################################################################
+#
+# Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Summarizes the `nvcc --time` reports of the compile-time benchmark targets.
+
+Usage: compile_time_report.py <name>_<variant>.csv ...
+
+Prints, for every builder translation unit, the time spent in each nvcc phase for each
+layout algebra variant and the ratio of the generic variant to the static one.
+"""
+
+import csv
+import os
+import sys
+from collections import OrderedDict
+
+
+def read_report(path):
+  """Returns an ordered {phase: milliseconds} of the most recent compilation recorded in path."""
+  phases = OrderedDict()
+  if not os.path.exists(path):
+    return phases
+
+  with open(path, newline='') as f:
+    rows = [[c.strip() for c in row] for row in csv.reader(f) if row]
+
+  header = None
+  for row in rows:
+    lowered = [c.lower() for c in row]
+    if any('phase' in c for c in lowered):
+      # nvcc appends to an existing report, so a new header starts a new compilation
+      header = lowered
+      phases = OrderedDict()
+      continue
+    if header is None:
+      continue
+    record = dict(zip(header, row))
+    phase = next((v for k, v in record.items() if 'phase' in k), None)
+    metric = next((v for k, v in record.items() if 'metric' in k), None)
+    try:
+      phases[phase] = phases.get(phase, 0.0) + float(metric)
+    except (TypeError, ValueError):
+      pass
+  return phases
+
+
+def main(paths):
+  builders = OrderedDict()
+  for path in paths:
+    name, variant = os.path.splitext(os.path.basename(path))[0].rsplit('_', 1)
+    builders.setdefault(name, {})[variant] = read_report(path)
+
+  for name, variants in builders.items():
+    static = variants.get('static', {})
+    generic = variants.get('generic', {})
+    print(name)
+    print('  {:<40} {:>12} {:>12} {:>8}'.format('phase', 'static (ms)', 'generic (ms)', 'ratio'))
+    for phase in list(OrderedDict.fromkeys(list(static) + list(generic))) + ['total']:
+      s = sum(static.values()) if phase == 'total' else static.get(phase, 0.0)
+      g = sum(generic.values()) if phase == 'total' else generic.get(phase, 0.0)
+      ratio = '{:.2f}'.format(g / s) if s > 0 else '-'
+      print('  {:<40} {:>12.1f} {:>12.1f} {:>8}'.format(phase, s, g, ratio))
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(main(sys.argv[1:]))
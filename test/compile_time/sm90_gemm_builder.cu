@@ -0,0 +1,69 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Compile-time benchmark: SM90 TMA warp-specialized GEMM collective builders.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+
+#include "gemm_builder.hpp"
+
+using namespace cute;
+
+int cutlass_compile_time_sm90_gemm_builder() {
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+  using RowMajor = cutlass::layout::RowMajor;
+  using ColMajor = cutlass::layout::ColumnMajor;
+
+  return test::compile_time::instantiate_kernels<
+    // f16 x f16 -> f16, all three kernel schedules
+    test::compile_time::GemmBuilder<cutlass::arch::Sm90, cutlass::half_t, RowMajor, cutlass::half_t, ColMajor, cutlass::half_t, ColMajor,
+                                    Shape<_128,_128,_64>, Shape<_1,_1,_1>, cutlass::gemm::KernelTmaWarpSpecialized>,
+    test::compile_time::GemmBuilder<cutlass::arch::Sm90, cutlass::half_t, RowMajor, cutlass::half_t, ColMajor, cutlass::half_t, ColMajor,
+                                    Shape<_128,_128,_64>, Shape<_2,_1,_1>, cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+                                    cutlass::epilogue::TmaWarpSpecialized>,
+    test::compile_time::GemmBuilder<cutlass::arch::Sm90, cutlass::half_t, RowMajor, cutlass::half_t, ColMajor, cutlass::half_t, ColMajor,
+                                    Shape<_256,_128,_64>, Shape<_1,_2,_1>, cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+                                    cutlass::epilogue::TmaWarpSpecializedCooperative>,
+    // MN-major operands
+    test::compile_time::GemmBuilder<cutlass::arch::Sm90, cutlass::bfloat16_t, ColMajor, cutlass::bfloat16_t, RowMajor, cutlass::bfloat16_t, RowMajor,
+                                    Shape<_128,_256,_64>, Shape<_2,_1,_1>, cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+                                    cutlass::epilogue::TmaWarpSpecializedCooperative>,
+    // fp8
+    test::compile_time::GemmBuilder<cutlass::arch::Sm90, cutlass::float_e4m3_t, RowMajor, cutlass::float_e4m3_t, ColMajor, cutlass::bfloat16_t, ColMajor,
+                                    Shape<_128,_128,_128>, Shape<_1,_2,_1>, cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+                                    cutlass::epilogue::TmaWarpSpecialized>
+  >();
+#else
+  return 0;
+#endif
+}
@@ -150,6 +150,43 @@ class PyTorchExtensionTest(unittest.TestCase):
         D = mod.run(A, B, C, alpha, beta)
         assert torch.allclose(D, D_ref)
 
+    def test_tuned_gemm(self):
+        random.seed(2023)
+
+        dtype = torch.float16
+        for layout in [cutlass_cppgen.LayoutType.RowMajor, cutlass_cppgen.LayoutType.ColumnMajor]:
+            plan = cutlass_cppgen.op.Gemm(element=dtype, layout=layout)
+            tile_descriptions = plan.tile_descriptions()[:3]
+            shapes = [(1024, 256, 512), (128, 512, 256), (0, 256, 512)]
+
+            # Empty problem sizes cannot be profiled
+            with self.assertRaises(Exception):
+                cutlass_cppgen.emit.pytorch_tuned_gemm(plan, 'tuned_gemm_mod', plan.cc, shapes,
+                                                       tile_descriptions=tile_descriptions)
+
+            with tempfile.TemporaryDirectory() as tmpdir:
+                mod = cutlass_cppgen.emit.pytorch_tuned_gemm(plan, f'tuned_gemm_mod_{layout.name.lower()}', plan.cc,
+                                                             shapes[:2], tile_descriptions=tile_descriptions,
+                                                             max_kernels=2, warmup_iterations=1, iterations=1,
+                                                             sourcedir=tmpdir, jit=True)
+
+            # Profiling does not change the tile description of the plan
+            assert plan.tile_description is None
+
+            # Profiled problem sizes, one that was not profiled, and one with an empty K
+            for M, N, K in shapes[:2] + [(256, 128, 64), (64, 128, 0)]:
+                A, B, C, _ = _initialize(dtype, M, N, K)
+
+                D_ref = A @ B
+                D = mod.run(A, B)
+                assert torch.allclose(D, D_ref)
+
+                alpha = 2.0
+                beta = -1.0
+                D_ref = (A @ B) * alpha + (beta * C)
+                D = mod.run(A, B, C, alpha, beta)
+                assert torch.allclose(D, D_ref)
+
     def test_grouped_gemm(self):
         random.seed(2023)
 
@@ -0,0 +1,118 @@
+################################################################################
+#
+# Copyright (c) 2023 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+"""
+Unit test for grouped GEMMs with epilogue visitors in SM80
+"""
+
+import logging
+import unittest
+
+import torch
+
+import cutlass_cppgen
+from cutlass_cppgen.backend import *
+from cutlass_cppgen.epilogue import *
+
+from utils.evt_testbed import EVTTestCaseBase
+
+cutlass_cppgen.set_log_level(logging.WARNING)
+
+
+def evt_bias_relu(accum, bias, aux):
+    D = relu(accum + bias) + aux
+    return D
+
+
+@unittest.skipIf(device_cc() not in [80, 86, 89, 90], "This unittest is only supported on CC [80, 86, 89, 90]")
+class TestEVTGrouped(EVTTestCaseBase):
+
+    def setUp(self):
+        # Problems share N, as the strides of the visitor tensors are fixed at trace time
+        self.n, self.k = 256, 128
+        self.ms = [128, 8, 264, 512 - 24]
+
+        example_inputs = {
+            "accum": self.fake_tensor(self.element, (self.m, self.n)),
+            "bias": self.fake_tensor(self.element, (self.n,)),
+            "aux": self.fake_tensor(self.element, (self.m, self.n)),
+            "D": self.fake_tensor(self.element, (self.m, self.n)),
+        }
+        self.plan = cutlass_cppgen.op.GroupedGemm(
+            element=self.element, layout=cutlass_cppgen.LayoutType.RowMajor, element_accumulator=torch.float32)
+        self.plan.epilogue_visitor = cutlass_cppgen.epilogue.trace(evt_bias_relu, example_inputs, cc=80)
+
+    def tensor(self, shape, fill=None):
+        if fill is not None:
+            return torch.full(shape, fill, dtype=torch.float16, device="cuda")
+        return torch.ceil(torch.empty(size=shape, dtype=torch.float16, device="cuda").uniform_(-4.5, 3.5))
+
+    def make_problems(self):
+        As = [self.tensor((m, self.k)) for m in self.ms]
+        Bs = [self.tensor((self.k, self.n)) for _ in self.ms]
+        visitor_args = [
+            {"bias": self.tensor((self.n,)), "aux": self.tensor((m, self.n)), "D": self.tensor((m, self.n), fill=0)}
+            for m in self.ms
+        ]
+        return As, Bs, visitor_args
+
+    def verify(self, As, Bs, visitor_args):
+        for A, B, args in zip(As, Bs, visitor_args):
+            accum = (A.float() @ B.float())
+            ref = (torch.relu(accum + args["bias"].float()) + args["aux"].float()).half()
+            assert torch.equal(args["D"], ref)
+
+    def test_grouped_host_problems(self):
+        """
+        Per-problem visitor arguments with host-provided problem lists
+        """
+        As, Bs, visitor_args = self.make_problems()
+        self.plan.run(As, Bs, None, None, visitor_args=visitor_args)
+        self.verify(As, Bs, visitor_args)
+
+    def test_grouped_device_problems(self):
+        """
+        Problem sizes, pointers, and leading dimensions resident in device memory
+        """
+        As, Bs, visitor_args = self.make_problems()
+        problem_sizes = torch.tensor([[m, self.n, self.k] for m in self.ms], dtype=torch.int32, device="cuda")
+        ptr_A = torch.tensor([A.data_ptr() for A in As], dtype=torch.int64, device="cuda")
+        ptr_B = torch.tensor([B.data_ptr() for B in Bs], dtype=torch.int64, device="cuda")
+        lda = torch.full((len(self.ms),), self.k, dtype=torch.int64, device="cuda")
+        ldb = torch.full((len(self.ms),), self.n, dtype=torch.int64, device="cuda")
+
+        self.plan.run_device(len(self.ms), problem_sizes, ptr_A, ptr_B, lda, ldb, visitor_args=visitor_args)
+        self.verify(As, Bs, visitor_args)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,104 @@
+#################################################################################################
+#
+# Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Unit tests comparing the native backend of pycute with its Python implementation
+"""
+
+import logging
+import random
+import unittest
+
+from pycute import *
+from pycute import layout as pycute_layout
+
+_LOGGER = logging.getLogger(__name__)
+
+
+def random_layout(rank, allow_negative=False):
+  shape  = tuple(random.choice([1, 2, 3, 4, 8, 16]) for _ in range(rank))
+  stride = tuple(random.choice([0, 1, 2, 4, 8, 16, 32, 64] + ([-1, -2, -4] if allow_negative else []))
+                 for _ in range(rank))
+  if rank == 1:
+    return Layout(shape[0], stride[0])
+  if rank > 2 and random.random() < 0.5:
+    return Layout((shape[0], shape[1:]), (stride[0], stride[1:]))
+  return Layout(shape, stride)
+
+
+def evaluate(func, *args):
+  try:
+    return repr(func(*args))
+  except (AssertionError, ZeroDivisionError) as e:
+    return type(e).__name__
+
+
+@unittest.skipIf(pycute_layout._native is None, "pycute native backend is not built")
+class TestNative(unittest.TestCase):
+  def helper_test_native(self, func, *args):
+    native = evaluate(func, *args)
+    backend = pycute_layout._native
+    try:
+      pycute_layout._native = None
+      python = evaluate(func, *args)
+    finally:
+      pycute_layout._native = backend
+
+    _LOGGER.debug(f"{func.__name__}{args}  =>  {native}")
+
+    self.assertEqual(native, python, f"{func.__name__}{args}")
+
+  def test_native(self):
+    random.seed(2026)
+
+    for _ in range(1000):
+      self.helper_test_native(coalesce, random_layout(random.randint(1, 4), allow_negative=True))
+
+      self.helper_test_native(composition,
+                              random_layout(random.randint(1, 4), allow_negative=True),
+                              random_layout(1, allow_negative=True))
+
+      self.helper_test_native(complement,
+                              random_layout(random.randint(1, 3)),
+                              random.choice([1, 16, 64, 1024]))
+
+      self.helper_test_native(logical_divide,
+                              random_layout(random.randint(1, 3)),
+                              random_layout(1))
+
+    # Values the native backend leaves to Python
+    self.helper_test_native(coalesce, Layout((1 << 40, 2), (1, 1 << 40)))
+    self.helper_test_native(composition, Layout((4, 6), (1, 4)), Layout(8, 3))
+
+
+if __name__ == "__main__":
+  unittest.main()
@@ -0,0 +1,241 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for implicit GEMM fprop with a fused ReLU + pooling 2.x EVT epilogue
+*/
+
+#include "../../common/cutlass_unit_test.h"
+#include "cutlass/cutlass.h"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/conv/kernel/default_conv2d_fprop_with_visitor.h"
+#include "cutlass/conv/device/implicit_gemm_convolution.h"
+#include "cutlass/epilogue/threadblock/fusion/visitors.hpp"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+namespace {
+
+using namespace cute;
+
+template <cutlass::epilogue::fusion::PoolingMode Mode>
+struct PooledConv2dFpropSm80 {
+  using ElementA           = cutlass::half_t;
+  using ElementB           = cutlass::half_t;
+  using ElementC           = float;
+  using ElementAccumulator = float;
+
+  using ThreadblockShape = cutlass::gemm::GemmShape<128, 128, 32>;
+  using WarpShape        = cutlass::gemm::GemmShape<64, 64, 32>;
+  using InstructionShape = cutlass::gemm::GemmShape<16, 8, 16>;
+  static constexpr int AlignmentC = 4;
+  static constexpr int EpilogueStages = 1;
+
+  using OutputTileThreadMap = cutlass::epilogue::threadblock::OutputTileThreadLayout<
+    ThreadblockShape, WarpShape, ElementC, AlignmentC, EpilogueStages>;
+
+  using ReLU = cutlass::epilogue::threadblock::Sm80EVT<
+    cutlass::epilogue::threadblock::VisitorCompute<
+      cutlass::epilogue::thread::ReLu, float, float, cutlass::FloatRoundStyle::round_to_nearest>,
+    cutlass::epilogue::threadblock::VisitorAccFetch>;
+
+  using FusionCallbacks = cutlass::epilogue::threadblock::Sm80EVT<
+    cutlass::epilogue::threadblock::VisitorPoolingStore<
+      Mode, OutputTileThreadMap, float, float, cutlass::FloatRoundStyle::round_to_nearest>,
+    ReLU>;
+
+  using Conv2dFpropKernel = typename cutlass::conv::kernel::DefaultConv2dFpropWithVisitor<
+    ElementA, cutlass::layout::TensorNHWC,
+    ElementB, cutlass::layout::TensorNHWC,
+    ElementC, cutlass::layout::TensorNHWC,
+    ElementAccumulator,
+    cutlass::arch::OpClassTensorOp,
+    cutlass::arch::Sm80,
+    ThreadblockShape,
+    WarpShape,
+    InstructionShape,
+    FusionCallbacks,
+    cutlass::gemm::threadblock::GemmIdentityThreadblockSwizzle<>,
+    3,
+    cutlass::arch::OpMultiplyAdd,
+    cutlass::conv::IteratorAlgorithm::kOptimized,
+    cutlass::conv::StrideSupport::kStrided,
+    8,
+    8,
+    AlignmentC,
+    EpilogueStages
+  >::Kernel;
+
+  using Conv2dFprop = cutlass::conv::device::ImplicitGemmConvolution<Conv2dFpropKernel>;
+};
+
+template <cutlass::epilogue::fusion::PoolingMode Mode>
+bool
+run_pooled_conv2d_fprop(cutlass::conv::Conv2dProblemSize const& problem_size, int window, int stride, int pad) {
+  using Config = PooledConv2dFpropSm80<Mode>;
+  using Conv2dFprop = typename Config::Conv2dFprop;
+  using ElementA = typename Config::ElementA;
+  using ElementB = typename Config::ElementB;
+  constexpr bool IsMax = Mode == cutlass::epilogue::fusion::PoolingMode::Max;
+
+  int PH = (problem_size.P + 2 * pad - window) / stride + 1;
+  int PW = (problem_size.Q + 2 * pad - window) / stride + 1;
+
+  cutlass::HostTensor<ElementA, cutlass::layout::TensorNHWC> tensor_A(problem_size.activation_extent());
+  cutlass::HostTensor<ElementB, cutlass::layout::TensorNHWC> tensor_B(problem_size.filter_extent());
+  cutlass::HostTensor<float, cutlass::layout::TensorNHWC> tensor_D(problem_size.output_extent());
+  cutlass::HostTensor<float, cutlass::layout::TensorNHWC> tensor_pool({problem_size.N, PH, PW, problem_size.K});
+  cutlass::HostTensor<float, cutlass::layout::TensorNHWC> tensor_pool_ref({problem_size.N, PH, PW, problem_size.K});
+
+  cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), 2023, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), 2024, 4, -4, 0);
+  // The 2.x epilogue does not initialize the pooled tensor
+  cutlass::reference::host::TensorFill(tensor_pool.host_view(),
+    IsMax ? -std::numeric_limits<float>::infinity() : 0.0f);
+  tensor_A.sync_device();
+  tensor_B.sync_device();
+  tensor_pool.sync_device();
+
+  typename Config::FusionCallbacks::Arguments callback_args{
+    {
+      {},                                   // Accum
+      {}                                    // ReLU
+    },
+    {
+      tensor_pool.device_data(),
+      problem_size.P, problem_size.Q,
+      window, window,
+      stride, stride,
+      pad, pad
+    }                                       // Pool
+  };
+
+  typename Conv2dFprop::Arguments arguments{
+    problem_size,
+    tensor_A.device_ref(),
+    tensor_B.device_ref(),
+    callback_args
+  };
+
+  Conv2dFprop conv2d_fprop;
+  EXPECT_EQ(conv2d_fprop.can_implement(arguments), cutlass::Status::kSuccess);
+  EXPECT_EQ(conv2d_fprop.initialize(arguments), cutlass::Status::kSuccess);
+  EXPECT_EQ(conv2d_fprop(), cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+  tensor_pool.sync_host();
+
+  cutlass::reference::host::Conv2dFprop<
+      ElementA, cutlass::layout::TensorNHWC,
+      ElementB, cutlass::layout::TensorNHWC,
+      float, cutlass::layout::TensorNHWC,
+      float, float>(
+    problem_size,
+    tensor_A.host_ref(),
+    tensor_B.host_ref(),
+    tensor_D.host_ref(),
+    tensor_D.host_ref(),
+    1.0f,
+    0.0f);
+
+  for (int n = 0; n < problem_size.N; ++n) {
+    for (int ph = 0; ph < PH; ++ph) {
+      for (int pw = 0; pw < PW; ++pw) {
+        for (int k = 0; k < problem_size.K; ++k) {
+          float pooled = IsMax ? -std::numeric_limits<float>::infinity() : 0.0f;
+          for (int r = 0; r < window; ++r) {
+            for (int s = 0; s < window; ++s) {
+              int p = ph * stride - pad + r;
+              int q = pw * stride - pad + s;
+              if (p < 0 || p >= problem_size.P || q < 0 || q >= problem_size.Q) {
+                continue;
+              }
+              float y = std::max(tensor_D.at({n, p, q, k}), 0.0f);
+              pooled = IsMax ? std::max(pooled, y) : pooled + y / float(window * window);
+            }
+          }
+          tensor_pool_ref.at({n, ph, pw, k}) = pooled;
+        }
+      }
+    }
+  }
+
+  bool passed = IsMax ?
+    cutlass::reference::host::TensorEquals(tensor_pool_ref.host_view(), tensor_pool.host_view()) :
+    cutlass::reference::host::TensorRelativelyEquals(tensor_pool_ref.host_view(), tensor_pool.host_view(), 1e-5f, 1e-3f);
+  EXPECT_TRUE(passed);
+  return passed;
+}
+
+template <cutlass::epilogue::fusion::PoolingMode Mode>
+bool
+test_all_pooled_conv2d_fprop() {
+  // 2x2 windows aligned to the output tile
+  cutlass::conv::Conv2dProblemSize aligned(
+    {1, 16, 16, 64},      // input size  (NHWC)
+    {64, 3, 3, 64},       // filter size (KRSC)
+    {1, 1, 1, 1},         // padding (pad_h, _, pad_w, _)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation);
+  // Overlapping padded 3x3 windows whose halos cross threadblock tiles
+  cutlass::conv::Conv2dProblemSize overlapping(
+    {2, 13, 11, 72},      // input size  (NHWC)
+    {136, 3, 3, 72},      // filter size (KRSC)
+    {1, 1, 1, 1},         // padding (pad_h, _, pad_w, _)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation);
+
+  return run_pooled_conv2d_fprop<Mode>(aligned, 2, 2, 0) &&
+         run_pooled_conv2d_fprop<Mode>(overlapping, 3, 2, 1);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM80_Device_Conv2d_Fprop_With_Pooling_Optimized_ImplicitGemm_f16nhwc_f16nhwc_f32nhwc_tensor_op_f32,
+  128x128_32x3_64x64x32_relu_max_pool) {
+  EXPECT_TRUE(test_all_pooled_conv2d_fprop<cutlass::epilogue::fusion::PoolingMode::Max>());
+}
+
+TEST(SM80_Device_Conv2d_Fprop_With_Pooling_Optimized_ImplicitGemm_f16nhwc_f16nhwc_f32nhwc_tensor_op_f32,
+  128x128_32x3_64x64x32_relu_avg_pool) {
+  EXPECT_TRUE(test_all_pooled_conv2d_fprop<cutlass::epilogue::fusion::PoolingMode::Average>());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+#endif // CUTLASS_ARCH_MMA_SM80_SUPPORTED
@@ -893,6 +893,100 @@ get_grouped_conv_problem_vector<3, cutlass::conv::Operator::kWgrad>(int GroupsPe
   return problem_shapes;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// Grouped Fprop
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Get problem size vectors for grouped fprop problems with the given filters and channels per group
+template<int SpatialDim>
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, SpatialDim>>
+inline
+get_grouped_fprop_problem_vector(int filters_per_group, int channels_per_group);
+
+// Specialization for 2D fprop problems
+template<>
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>> inline
+get_grouped_fprop_problem_vector<2>(int filters_per_group, int channels_per_group) {
+  using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>;
+  std::vector<ProblemShape> problem_shapes;
+  // 4 groups, filter 3x3, padding 1
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 8, 8, 4 * channels_per_group},                        // nhwc
+    {4 * filters_per_group, 3, 3, channels_per_group},        // krsc
+    {1, 1},                                                   // padding lower (pad_h, pad_w)
+    {1, 1},                                                   // padding upper (pad_h, pad_w)
+    {1, 1},                                                   // stride (stride_h, stride_w)
+    {1, 1},                                                   // dilation (dilation_h, dilation_w)
+    4                                                         // groups
+  });
+  // 2 groups, filter 1x3, asymmetric padding and stride
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2, 9, 7, 2 * channels_per_group},                        // nhwc
+    {2 * filters_per_group, 1, 3, channels_per_group},        // krsc
+    {0, 1},                                                   // padding lower (pad_h, pad_w)
+    {0, 0},                                                   // padding upper (pad_h, pad_w)
+    {2, 1},                                                   // stride (stride_h, stride_w)
+    {1, 1},                                                   // dilation (dilation_h, dilation_w)
+    2                                                         // groups
+  });
+  return problem_shapes;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+// Fprop with fused scale-bias-ReLU input transform
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Get problem size vectors for fused scale-bias-ReLU fprop problems, whose channels (per group) are
+// a multiple of the K tile. All of them pad the activation, which must stay zero after the transform.
+template<int SpatialDim>
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, SpatialDim>>
+inline
+get_fprop_scale_bias_relu_problem_vector(int channels);
+
+// Specialization for 2D fprop problems
+template<>
+std::vector<cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>> inline
+get_fprop_scale_bias_relu_problem_vector<2>(int channels) {
+  using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>;
+  std::vector<ProblemShape> problem_shapes;
+  // filter 3x3, padding 1
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 8, 8, channels},                                      // nhwc
+    {64, 3, 3, channels},                                     // krsc
+    {1, 1},                                                   // padding lower (pad_h, pad_w)
+    {1, 1},                                                   // padding upper (pad_h, pad_w)
+    {1, 1},                                                   // stride (stride_h, stride_w)
+    {1, 1},                                                   // dilation (dilation_h, dilation_w)
+    1                                                         // groups
+  });
+  // filter 3x3, asymmetric padding, stride 2 and dilation 2
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2, 13, 11, 2 * channels},                                // nhwc
+    {128, 3, 3, 2 * channels},                                // krsc
+    {2, 1},                                                   // padding lower (pad_h, pad_w)
+    {1, 2},                                                   // padding upper (pad_h, pad_w)
+    {2, 2},                                                   // stride (stride_h, stride_w)
+    {2, 2},                                                   // dilation (dilation_h, dilation_w)
+    1                                                         // groups
+  });
+  // 2 groups, filter 3x3, padding 1, so the scale and bias are read at the group's channel offset
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 8, 8, 2 * channels},                                  // nhwc
+    {128, 3, 3, channels},                                    // krsc
+    {1, 1},                                                   // padding lower (pad_h, pad_w)
+    {1, 1},                                                   // padding upper (pad_h, pad_w)
+    {1, 1},                                                   // stride (stride_h, stride_w)
+    {1, 1},                                                   // dilation (dilation_h, dilation_w)
+    2                                                         // groups
+  });
+  return problem_shapes;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 // Unit Stride Dgrad
 /////////////////////////////////////////////////////////////////////////////////////////////////
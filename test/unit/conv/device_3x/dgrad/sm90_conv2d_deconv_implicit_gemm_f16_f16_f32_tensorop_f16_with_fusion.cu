@@ -0,0 +1,221 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for transposed convolution on SM90 dgrad kernels with fused bias and activation
+*/
+
+#include "cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/conv/device/conv_universal_deconv_adapter.hpp"
+#include "cutlass/conv/kernel/conv_universal.hpp"
+#include "cutlass/conv/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "../testbed_conv.hpp"
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+namespace {
+
+// Strided transposed convolutions: input nhwk, filter krsc with c output channels
+template <class Conv>
+std::vector<typename Conv::ProblemShape>
+deconv_problems() {
+  using ProblemShape = typename Conv::ProblemShape;
+  std::vector<ProblemShape> problem_shapes;
+  // 3x3 filter, stride 2, output_padding 1: 8x8 -> 16x16
+  problem_shapes.push_back(Conv::make_problem_shape(
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1,  8, 8, 64},    // nhwk
+    {64, 3, 3, 64},    // krsc
+    {1, 1},            // padding lower (pad_h, pad_w)
+    {1, 1},            // padding upper (pad_h, pad_w)
+    {1, 1},            // output padding (pad_h, pad_w)
+    {2, 2},            // stride (stride_h, stride_w)
+    {1, 1}             // dilation (dilation_h, dilation_w)
+  ));
+  // 4x4 filter, stride 2, channel count change: 7x9 -> 14x18
+  problem_shapes.push_back(Conv::make_problem_shape(
+    cutlass::conv::Mode::kCrossCorrelation,
+    {2,   7, 9, 128},
+    {128, 4, 4, 64},
+    {1, 1},
+    {1, 1},
+    {0, 0},
+    {2, 2},
+    {1, 1}
+  ));
+  // 3x3 filter, stride 3, no padding: 4x4 -> 12x12
+  problem_shapes.push_back(Conv::make_problem_shape(
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1,  4, 4, 64},
+    {64, 3, 3, 64},
+    {0, 0},
+    {0, 0},
+    {0, 0},
+    {3, 3},
+    {1, 1}
+  ));
+  // Mixed strides: 8x8 -> 16x8
+  problem_shapes.push_back(Conv::make_problem_shape(
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1,  8, 8, 64},
+    {64, 3, 3, 64},
+    {1, 1},
+    {1, 1},
+    {1, 0},
+    {2, 1},
+    {1, 1}
+  ));
+  return problem_shapes;
+}
+
+template <class Conv>
+bool TestDeconv(float alpha, float beta) {
+  test::conv::device::ConvTestbed<Conv> testbed;
+  for (auto const& problem_shape : deconv_problems<Conv>()) {
+    if (!testbed.run(problem_shape, alpha, beta)) {
+      printf("Failed test for "); print(problem_shape);
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// Tile shape 64x64x64
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+// alpha != 1 && beta != 0 && bias && relu
+TEST(SM90_device_conv2d_deconv_implicitgemm_f16nhwc_f16nhwc_f16nhwc_tensor_op_f32, 64x64x64_1x1x1_alpha_beta_bias_relu) {
+  using ElementAct     = cutlass::half_t;
+  using ElementFlt     = cutlass::half_t;
+  using ElementOut     = cutlass::half_t;
+  using ElementAcc     = float;
+  using ElementCompute = float;
+  using ElementBias    = cutlass::half_t;
+  using TileShapeMNK = Shape<_64, _64, Shape<_64>>;
+  using ClusterShapeMNK = Shape<_1,_1,_1>;
+
+  using FusionOperation = cutlass::epilogue::fusion::LinCombPerColBiasEltAct<
+      cutlass::epilogue::thread::ReLu, ElementOut, ElementCompute, ElementBias>;
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAcc, ElementCompute,
+      ElementOut, cutlass::layout::TensorNHWC, 8,
+      ElementOut, cutlass::layout::TensorNHWC, 8,
+      cutlass::epilogue::TmaWarpSpecialized,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::conv::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::conv::Operator::kDgrad,
+      ElementAct, cutlass::layout::TensorNHWC, 8,
+      ElementFlt, cutlass::layout::TensorNHWC, 8,
+      ElementAcc,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::conv::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::conv::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using ProblemShape=cutlass::conv::ConvProblemShape<CollectiveMainloop::DispatchPolicy::ConvOp, CollectiveMainloop::DispatchPolicy::NumSpatialDimensions>;
+  using ConvKernel = cutlass::conv::kernel::ConvUniversal<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Conv = cutlass::conv::device::ConvUniversalDeconvAdapter<ConvKernel>;
+  static_assert(not Conv::kNativeStridedDgrad);
+
+  EXPECT_TRUE(TestDeconv<Conv>(2.0f, 1.0f));
+}
+
+// beta == 0 && bias && gelu, cluster 2x1x1
+TEST(SM90_device_conv2d_deconv_implicitgemm_f16nhwc_f16nhwc_f16nhwc_tensor_op_f32, 64x64x64_2x1x1_bias_gelu) {
+  using ElementAct     = cutlass::half_t;
+  using ElementFlt     = cutlass::half_t;
+  using ElementOut     = cutlass::half_t;
+  using ElementAcc     = float;
+  using ElementCompute = float;
+  using ElementBias    = cutlass::half_t;
+  using TileShapeMNK = Shape<_64, _64, Shape<_64>>;
+  using ClusterShapeMNK = Shape<_2,_1,_1>;
+
+  using FusionOperation = cutlass::epilogue::fusion::LinCombPerColBiasEltAct<
+      cutlass::epilogue::thread::GELU_taylor, ElementOut, ElementCompute, ElementBias>;
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAcc, ElementCompute,
+      ElementOut, cutlass::layout::TensorNHWC, 8,
+      ElementOut, cutlass::layout::TensorNHWC, 8,
+      cutlass::epilogue::TmaWarpSpecialized,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::conv::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::conv::Operator::kDgrad,
+      ElementAct, cutlass::layout::TensorNHWC, 8,
+      ElementFlt, cutlass::layout::TensorNHWC, 8,
+      ElementAcc,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::conv::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::conv::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using ProblemShape=cutlass::conv::ConvProblemShape<CollectiveMainloop::DispatchPolicy::ConvOp, CollectiveMainloop::DispatchPolicy::NumSpatialDimensions>;
+  using ConvKernel = cutlass::conv::kernel::ConvUniversal<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Conv = cutlass::conv::device::ConvUniversalDeconvAdapter<ConvKernel>;
+
+  EXPECT_TRUE(TestDeconv<Conv>(1.0f, 0.0f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,222 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Pointwise fprop directly on NCHW tensors through a 3.x GEMM, checked against the 2.x host conv reference
+*/
+
+#include "cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/convnd_problem_shape.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/nchw_pointwise_fprop.hpp"
+#include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+namespace {
+
+template <class Gemm>
+bool
+run_nchw_pointwise_fprop(cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2> const& problem_shape,
+                         float alpha, float beta) {
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementD = typename Gemm::ElementD;
+
+  EXPECT_TRUE(cutlass::can_implement_nchw_pointwise_fprop(problem_shape));
+
+  int N = problem_shape.shape_A[0];
+  int H = problem_shape.shape_A[1];
+  int W = problem_shape.shape_A[2];
+  int C = problem_shape.shape_A[3];
+  int K = problem_shape.shape_B[0];
+  int P = problem_shape.shape_C[1];
+  int Q = problem_shape.shape_C[2];
+
+  cutlass::HostTensor<ElementA, cutlass::layout::TensorNCHW> tensor_x({N, H, W, C});
+  cutlass::HostTensor<ElementB, cutlass::layout::TensorNHWC> tensor_w({K, 1, 1, C});
+  cutlass::HostTensor<ElementC, cutlass::layout::TensorNCHW> tensor_y_in({N, P, Q, K});
+  cutlass::HostTensor<ElementD, cutlass::layout::TensorNCHW> tensor_y_out({N, P, Q, K});
+  cutlass::HostTensor<ElementD, cutlass::layout::TensorNCHW> tensor_y_ref({N, P, Q, K});
+
+  cutlass::reference::host::TensorFillRandomUniform(tensor_x.host_view(), 2023, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_w.host_view(), 2024, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_y_in.host_view(), 2025, 4, -4, 0);
+  tensor_x.sync_device();
+  tensor_w.sync_device();
+  tensor_y_in.sync_device();
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    cutlass::make_nchw_pointwise_fprop_problem_shape(problem_shape),
+    {
+      tensor_x.device_data(), cutlass::make_nchw_pointwise_fprop_stride_A(problem_shape),
+      tensor_w.device_data(), cutlass::make_nchw_pointwise_fprop_stride_B(problem_shape)
+    },
+    {
+      {alpha, beta},
+      tensor_y_in.device_data(), cutlass::make_nchw_pointwise_fprop_stride_C(problem_shape),
+      tensor_y_out.device_data(), cutlass::make_nchw_pointwise_fprop_stride_C(problem_shape)
+    },
+    hw_info
+  };
+
+  Gemm gemm_op;
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  EXPECT_EQ(gemm_op.can_implement(arguments), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm_op.initialize(arguments, workspace.get()), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm_op.run(), cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+  tensor_y_out.sync_host();
+
+  cutlass::conv::Conv2dProblemSize problem_size(
+      N, H, W, C, K, 1, 1, P, Q,
+      /*pad_h=*/0, /*pad_w=*/0, /*stride_h=*/1, /*stride_w=*/1, /*dilation_h=*/1, /*dilation_w=*/1,
+      cutlass::conv::Mode::kCrossCorrelation);
+
+  cutlass::reference::host::Conv2dFprop<
+      ElementA, cutlass::layout::TensorNCHW,
+      ElementB, cutlass::layout::TensorNHWC,
+      ElementC, cutlass::layout::TensorNCHW,
+      float, float, ElementD>(
+    problem_size,
+    tensor_x.host_ref(),
+    tensor_w.host_ref(),
+    tensor_y_in.host_ref(),
+    tensor_y_ref.host_ref(),
+    alpha,
+    beta);
+
+  bool passed = cutlass::reference::host::TensorEquals(tensor_y_ref.host_view(), tensor_y_out.host_view());
+  EXPECT_TRUE(passed);
+  return passed;
+}
+
+template <class Gemm>
+bool
+test_all_nchw_pointwise_fprop() {
+  using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>;
+  std::vector<ProblemShape> problem_shapes;
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {1, 8, 8, 64},        // nhwc
+    {64, 1, 1, 64},       // krsc
+    {0, 0},               // padding lower (pad_h, pad_w)
+    {0, 0},               // padding upper (pad_h, pad_w)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    1                     // groups
+  });
+  // Residue in every GEMM mode
+  problem_shapes.push_back({
+    cutlass::conv::Mode::kCrossCorrelation,
+    {3, 17, 24, 72},      // nhwc
+    {200, 1, 1, 72},      // krsc
+    {0, 0},               // padding lower (pad_h, pad_w)
+    {0, 0},               // padding upper (pad_h, pad_w)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    1                     // groups
+  });
+
+  for (auto const& problem_shape : problem_shapes) {
+    if (!run_nchw_pointwise_fprop<Gemm>(problem_shape, 1.0f, 0.0f) ||
+        !run_nchw_pointwise_fprop<Gemm>(problem_shape, 2.0f, 1.0f)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_device_conv2d_fprop_nchw_pointwise_f16nchw_f16nhwc_f32nchw_tensor_op_f32, 128x128x64_1x1x1) {
+  using ElementAct     = cutlass::half_t;
+  using ElementFlt     = cutlass::half_t;
+  using ElementOut     = float;
+  using ElementAcc     = float;
+  using ElementCompute = float;
+  using TileShapeMNK = Shape<_128, _128, _64>;
+  using ClusterShapeMNK = Shape<_1,_1,_1>;
+
+  // NCHW activation and output are spatial (M) major, the KRSC filter is channel (K) major
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAcc, ElementCompute,
+      ElementOut, cutlass::layout::ColumnMajor, 128 / cutlass::sizeof_bits<ElementOut>::value,
+      ElementOut, cutlass::layout::ColumnMajor, 128 / cutlass::sizeof_bits<ElementOut>::value,
+      cutlass::epilogue::collective::EpilogueScheduleAuto
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      ElementAct, cutlass::layout::ColumnMajor, 8,
+      ElementFlt, cutlass::layout::ColumnMajor, 8,
+      ElementAcc,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+
+  EXPECT_TRUE(test_all_nchw_pointwise_fprop<Gemm>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
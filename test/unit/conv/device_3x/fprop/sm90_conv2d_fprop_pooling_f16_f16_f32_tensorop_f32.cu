@@ -0,0 +1,278 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Implicit GEMM fprop with a fused ReLU + max/avg pooling EVT epilogue, checked against host conv and pooling
+*/
+
+#include "cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/convnd_problem_shape.hpp"
+#include "cutlass/conv/device/conv_universal_adapter.hpp"
+#include "cutlass/conv/kernel/conv_universal.hpp"
+#include "cutlass/conv/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+namespace {
+
+// ReLU(acc) reduced into the pooled tensor, the conv output itself is never written. The persistent
+// kernel initializes the epilogue workspace, which fills the pooled tensor with the reduction identity.
+template <cutlass::epilogue::fusion::PoolingMode Mode>
+struct PooledConv2dFprop {
+  using ElementAct = cutlass::half_t;
+  using ElementFlt = cutlass::half_t;
+  using ElementAcc = float;
+  using TileShapeMNK = Shape<_128, _128, Shape<_64>>;
+  using ClusterShapeMNK = Shape<_1,_1,_1>;
+
+  static constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+  using ReLU = cutlass::epilogue::fusion::Sm90EVT<
+      cutlass::epilogue::fusion::Sm90Compute<cutlass::epilogue::thread::ReLu, float, float, RoundStyle>,
+      cutlass::epilogue::fusion::Sm90AccFetch>;
+  using FusionCallbacks = cutlass::epilogue::fusion::Sm90EVT<
+      cutlass::epilogue::fusion::Sm90PoolingStore<Mode, float, float, RoundStyle>,
+      ReLU>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAcc, float,
+      void, cutlass::layout::TensorNHWC, 4,
+      void, cutlass::layout::TensorNHWC, 4,
+      cutlass::epilogue::TmaWarpSpecializedCooperative,
+      FusionCallbacks
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::conv::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::conv::Operator::kFprop,
+      ElementAct, cutlass::layout::TensorNHWC, 8,
+      ElementFlt, cutlass::layout::TensorNHWC, 8,
+      ElementAcc,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::conv::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::conv::KernelImplicitTmaWarpSpecializedSm90Cooperative
+    >::CollectiveOp;
+
+  using ProblemShape = cutlass::conv::ConvProblemShape<cutlass::conv::Operator::kFprop, 2>;
+  using ConvKernel = cutlass::conv::kernel::ConvUniversal<
+      ProblemShape,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Conv = cutlass::conv::device::ConvUniversalAdapter<ConvKernel>;
+};
+
+struct PoolingProblem {
+  cutlass::conv::Conv2dProblemSize conv;
+  int window;
+  int stride;
+  int pad;
+};
+
+template <cutlass::epilogue::fusion::PoolingMode Mode>
+bool
+run_pooled_conv2d_fprop(PoolingProblem const& problem) {
+  using Config = PooledConv2dFprop<Mode>;
+  using Conv = typename Config::Conv;
+  using ElementAct = typename Config::ElementAct;
+  using ElementFlt = typename Config::ElementFlt;
+
+  cutlass::conv::Conv2dProblemSize const& problem_size = problem.conv;
+  int PH = (problem_size.P + 2 * problem.pad - problem.window) / problem.stride + 1;
+  int PW = (problem_size.Q + 2 * problem.pad - problem.window) / problem.stride + 1;
+
+  cutlass::HostTensor<ElementAct, cutlass::layout::TensorNHWC> tensor_x(problem_size.activation_extent());
+  cutlass::HostTensor<ElementFlt, cutlass::layout::TensorNHWC> tensor_w(problem_size.filter_extent());
+  cutlass::HostTensor<float, cutlass::layout::TensorNHWC> tensor_y(problem_size.output_extent());
+  cutlass::HostTensor<float, cutlass::layout::TensorNHWC> tensor_pool({problem_size.N, PH, PW, problem_size.K});
+  cutlass::HostTensor<float, cutlass::layout::TensorNHWC> tensor_pool_ref({problem_size.N, PH, PW, problem_size.K});
+
+  cutlass::reference::host::TensorFillRandomUniform(tensor_x.host_view(), 2023, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_w.host_view(), 2024, 4, -4, 0);
+  tensor_x.sync_device();
+  tensor_w.sync_device();
+
+  typename Config::ProblemShape problem_shape(
+    cutlass::conv::Mode::kCrossCorrelation,
+    {problem_size.N, problem_size.H, problem_size.W, problem_size.C},
+    {problem_size.K, problem_size.R, problem_size.S, problem_size.C},
+    {problem_size.pad_h, problem_size.pad_w},
+    {problem_size.pad_h, problem_size.pad_w},
+    {problem_size.stride_h, problem_size.stride_w},
+    {problem_size.dilation_h, problem_size.dilation_w},
+    1);
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Conv::Arguments arguments{
+    problem_shape,
+    {tensor_x.device_data(), tensor_w.device_data()},
+    {{}, nullptr, {}, nullptr, {}},
+    hw_info
+  };
+
+  // {{acc}, relu}, pool
+  auto& pool_args = arguments.epilogue.thread.op_1;
+  pool_args.ptr_pool = tensor_pool.device_data();
+  pool_args.window_h = pool_args.window_w = problem.window;
+  pool_args.stride_h = pool_args.stride_w = problem.stride;
+  pool_args.pad_h = pool_args.pad_w = problem.pad;
+
+  Conv conv_op;
+  EXPECT_EQ(conv_op.can_implement(arguments), cutlass::Status::kSuccess);
+  cutlass::device_memory::allocation<uint8_t> workspace(Conv::get_workspace_size(arguments));
+  EXPECT_EQ(conv_op.initialize(arguments, workspace.get()), cutlass::Status::kSuccess);
+  EXPECT_EQ(conv_op.run(), cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+  tensor_pool.sync_host();
+
+  cutlass::reference::host::Conv2dFprop<
+      ElementAct, cutlass::layout::TensorNHWC,
+      ElementFlt, cutlass::layout::TensorNHWC,
+      float, cutlass::layout::TensorNHWC,
+      float, float>(
+    problem_size,
+    tensor_x.host_ref(),
+    tensor_w.host_ref(),
+    tensor_y.host_ref(),
+    tensor_y.host_ref(),
+    1.0f,
+    0.0f);
+
+  for (int n = 0; n < problem_size.N; ++n) {
+    for (int ph = 0; ph < PH; ++ph) {
+      for (int pw = 0; pw < PW; ++pw) {
+        for (int k = 0; k < problem_size.K; ++k) {
+          float pooled = Mode == cutlass::epilogue::fusion::PoolingMode::Max ?
+            -std::numeric_limits<float>::infinity() : 0.0f;
+          for (int r = 0; r < problem.window; ++r) {
+            for (int s = 0; s < problem.window; ++s) {
+              int p = ph * problem.stride - problem.pad + r;
+              int q = pw * problem.stride - problem.pad + s;
+              if (p < 0 || p >= problem_size.P || q < 0 || q >= problem_size.Q) {
+                continue;
+              }
+              float y = std::max(tensor_y.at({n, p, q, k}), 0.0f);
+              if constexpr (Mode == cutlass::epilogue::fusion::PoolingMode::Max) {
+                pooled = std::max(pooled, y);
+              }
+              else {
+                pooled += y / float(problem.window * problem.window);
+              }
+            }
+          }
+          tensor_pool_ref.at({n, ph, pw, k}) = pooled;
+        }
+      }
+    }
+  }
+
+  bool passed = false;
+  if constexpr (Mode == cutlass::epilogue::fusion::PoolingMode::Max) {
+    passed = cutlass::reference::host::TensorEquals(tensor_pool_ref.host_view(), tensor_pool.host_view());
+  }
+  else {
+    // Window contributions are accumulated by atomics in arbitrary order
+    passed = cutlass::reference::host::TensorRelativelyEquals(
+      tensor_pool_ref.host_view(), tensor_pool.host_view(), 1e-5f, 1e-3f);
+  }
+  EXPECT_TRUE(passed);
+  return passed;
+}
+
+template <cutlass::epilogue::fusion::PoolingMode Mode>
+bool
+test_all_pooled_conv2d_fprop() {
+  std::vector<PoolingProblem> problems;
+  // 2x2 windows aligned to the output tile
+  problems.push_back({cutlass::conv::Conv2dProblemSize(
+    {1, 16, 16, 64},      // input size  (NHWC)
+    {64, 3, 3, 64},       // filter size (KRSC)
+    {1, 1, 1, 1},         // padding (pad_h, _, pad_w, _)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation), 2, 2, 0});
+  // Overlapping padded 3x3 windows, halos cross CTA tiles and images; odd extents drop the last row and column
+  problems.push_back({cutlass::conv::Conv2dProblemSize(
+    {2, 13, 11, 72},      // input size  (NHWC)
+    {136, 3, 3, 72},      // filter size (KRSC)
+    {1, 1, 1, 1},         // padding (pad_h, _, pad_w, _)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation), 3, 2, 1});
+  // 2x2 windows over a strided conv with partial pooled coverage
+  problems.push_back({cutlass::conv::Conv2dProblemSize(
+    {3, 23, 19, 32},      // input size  (NHWC)
+    {48, 3, 3, 32},       // filter size (KRSC)
+    {1, 1, 1, 1},         // padding (pad_h, _, pad_w, _)
+    {2, 2},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation), 2, 2, 0});
+
+  for (auto const& problem : problems) {
+    if (!run_pooled_conv2d_fprop<Mode>(problem)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_device_conv2d_fprop_implicitgemm_f16nhwc_f16nhwc_f32nhwc_tensor_op_f32, 128x128x64_1x1x1_cooperative_relu_max_pool) {
+  EXPECT_TRUE(test_all_pooled_conv2d_fprop<cutlass::epilogue::fusion::PoolingMode::Max>());
+}
+
+TEST(SM90_device_conv2d_fprop_implicitgemm_f16nhwc_f16nhwc_f32nhwc_tensor_op_f32, 128x128x64_1x1x1_cooperative_relu_avg_pool) {
+  EXPECT_TRUE(test_all_pooled_conv2d_fprop<cutlass::epilogue::fusion::PoolingMode::Average>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
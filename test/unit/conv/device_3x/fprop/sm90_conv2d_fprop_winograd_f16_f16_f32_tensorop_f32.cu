@@ -0,0 +1,222 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Winograd F(2x2, 3x3) and F(4x4, 3x3) fprop over a batched 3.x GEMM, checked against the 2.x host conv reference
+*/
+
+#include "cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/device/winograd_fprop.h"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/convolution.h"
+#include "cutlass/util/reference/host/tensor_compare.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+namespace {
+
+// Transformed operands are K-major; the transformed output M is row-major fp32
+template <class ElementAct, class ElementFlt>
+struct WinogradBatchedGemm {
+  using ElementAcc = float;
+  using TileShapeMNK = Shape<_128, _128, _64>;
+  using ClusterShapeMNK = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAcc, ElementAcc,
+      void, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      cutlass::epilogue::collective::EpilogueScheduleAuto
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      ElementAct, cutlass::layout::RowMajor, 8,
+      ElementFlt, cutlass::layout::ColumnMajor, 8,
+      ElementAcc,
+      TileShapeMNK, ClusterShapeMNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::collective::KernelScheduleAuto
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class WinogradFprop>
+bool
+run_winograd_fprop(cutlass::conv::Conv2dProblemSize const& problem_size, float alpha, float beta) {
+  using ElementA = typename WinogradFprop::ElementA;
+  using ElementB = typename WinogradFprop::ElementB;
+  using ElementOutput = typename WinogradFprop::ElementOutput;
+
+  cutlass::HostTensor<ElementA, cutlass::layout::TensorNHWC> tensor_x(problem_size.activation_extent());
+  cutlass::HostTensor<ElementB, cutlass::layout::TensorNHWC> tensor_w(problem_size.filter_extent());
+  cutlass::HostTensor<ElementOutput, cutlass::layout::TensorNHWC> tensor_y_in(problem_size.output_extent());
+  cutlass::HostTensor<ElementOutput, cutlass::layout::TensorNHWC> tensor_y_out(problem_size.output_extent());
+  cutlass::HostTensor<ElementOutput, cutlass::layout::TensorNHWC> tensor_y_ref(problem_size.output_extent());
+
+  cutlass::reference::host::TensorFillRandomUniform(tensor_x.host_view(), 2023, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_w.host_view(), 2024, 4, -4, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_y_in.host_view(), 2025, 4, -4, 0);
+  tensor_x.sync_device();
+  tensor_w.sync_device();
+  tensor_y_in.sync_device();
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename WinogradFprop::Arguments arguments;
+  arguments.problem_size = problem_size;
+  arguments.ptr_A = tensor_x.device_data();
+  arguments.ptr_B = tensor_w.device_data();
+  arguments.ptr_C = tensor_y_in.device_data();
+  arguments.ptr_D = tensor_y_out.device_data();
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.hw_info = hw_info;
+
+  WinogradFprop winograd_op;
+  EXPECT_EQ(WinogradFprop::can_implement(arguments), cutlass::Status::kSuccess);
+  cutlass::device_memory::allocation<uint8_t> workspace(WinogradFprop::get_workspace_size(arguments));
+  EXPECT_EQ(winograd_op.initialize(arguments, workspace.get()), cutlass::Status::kSuccess);
+  EXPECT_EQ(winograd_op.run(), cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+  tensor_y_out.sync_host();
+
+  cutlass::reference::host::Conv2dFprop<
+      ElementA, cutlass::layout::TensorNHWC,
+      ElementB, cutlass::layout::TensorNHWC,
+      ElementOutput, cutlass::layout::TensorNHWC,
+      float, float, ElementOutput>(
+    problem_size,
+    tensor_x.host_ref(),
+    tensor_w.host_ref(),
+    tensor_y_in.host_ref(),
+    tensor_y_ref.host_ref(),
+    alpha,
+    beta);
+
+  bool passed = false;
+  if constexpr (WinogradFprop::kOutputTile == 2) {
+    // Every F(2x2, 3x3) transform coefficient is a power of two: exact for small integers
+    passed = cutlass::reference::host::TensorEquals(tensor_y_ref.host_view(), tensor_y_out.host_view());
+  }
+  else {
+    // The F(4x4, 3x3) filter transform rounds multiples of 1/6 and 1/12 to the operand type
+    passed = cutlass::reference::host::TensorRelativelyEquals(
+      tensor_y_ref.host_view(), tensor_y_out.host_view(), ElementOutput(0.02f), ElementOutput(1.0f));
+  }
+  EXPECT_TRUE(passed);
+  return passed;
+}
+
+template <class WinogradFprop>
+bool
+test_all_winograd_fprop() {
+  std::vector<cutlass::conv::Conv2dProblemSize> problem_sizes;
+  problem_sizes.push_back(cutlass::conv::Conv2dProblemSize(
+    {1, 8, 8, 64},        // input size  (NHWC)
+    {64, 3, 3, 64},       // filter size (KRSC)
+    {1, 1, 1, 1},         // padding (pad_h, _, pad_w, _)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation));
+  // Partial output tiles in both spatial dimensions, residue in every GEMM mode
+  problem_sizes.push_back(cutlass::conv::Conv2dProblemSize(
+    {2, 13, 11, 72},      // input size  (NHWC)
+    {200, 3, 3, 72},      // filter size (KRSC)
+    {1, 1, 1, 1},         // padding (pad_h, _, pad_w, _)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation));
+  // No padding
+  problem_sizes.push_back(cutlass::conv::Conv2dProblemSize(
+    {1, 10, 14, 32},      // input size  (NHWC)
+    {48, 3, 3, 32},       // filter size (KRSC)
+    {0, 0, 0, 0},         // padding (pad_h, _, pad_w, _)
+    {1, 1},               // stride (stride_h, stride_w)
+    {1, 1},               // dilation (dilation_h, dilation_w)
+    cutlass::conv::Mode::kCrossCorrelation));
+
+  for (auto const& problem_size : problem_sizes) {
+    if (!run_winograd_fprop<WinogradFprop>(problem_size, 1.0f, 0.0f) ||
+        !run_winograd_fprop<WinogradFprop>(problem_size, 2.0f, 1.0f)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_device_conv2d_fprop_winograd_f16nhwc_f16nhwc_f32nhwc_tensor_op_f32, 2x2_3x3) {
+  using Gemm = typename WinogradBatchedGemm<cutlass::half_t, cutlass::half_t>::Gemm;
+  using WinogradFprop = cutlass::conv::device::WinogradFprop<Gemm, float, 2>;
+  EXPECT_TRUE(test_all_winograd_fprop<WinogradFprop>());
+}
+
+TEST(SM90_device_conv2d_fprop_winograd_f16nhwc_f16nhwc_f32nhwc_tensor_op_f32, 4x4_3x3) {
+  using Gemm = typename WinogradBatchedGemm<cutlass::half_t, cutlass::half_t>::Gemm;
+  using WinogradFprop = cutlass::conv::device::WinogradFprop<Gemm, float, 4>;
+  EXPECT_TRUE(test_all_winograd_fprop<WinogradFprop>());
+}
+
+TEST(SM90_device_conv2d_fprop_winograd_bf16nhwc_bf16nhwc_f32nhwc_tensor_op_f32, 2x2_3x3) {
+  using Gemm = typename WinogradBatchedGemm<cutlass::bfloat16_t, cutlass::bfloat16_t>::Gemm;
+  using WinogradFprop = cutlass::conv::device::WinogradFprop<Gemm, float, 2>;
+  EXPECT_TRUE(test_all_winograd_fprop<WinogradFprop>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -40,6 +40,7 @@
 #include "cutlass/kernel_hardware_info.hpp"
 #include "cutlass/conv/convolution.h"
 #include "cutlass/conv/convnd_problem_shape.hpp"
+#include "cutlass/conv/dispatch_policy.hpp"
 #include "../test/unit/gemm/device/gemm_testbed_3x.hpp"
 
 #include "thrust/universal_vector.h"
@@ -57,6 +58,7 @@
 #include "conv_problem_sizes.hpp"
 #include "../cache_testbed_output.h"
 
+#include <cmath>
 #include <iostream>
 
 #include "cute/layout.hpp"
@@ -136,6 +138,56 @@ template <class Conv>
 struct SparseConvParams {
 };
 
+// Per-channel scale and bias of the activation for the fused scale-bias-ReLU fprop schedules
+template <class Conv>
+struct ScaleBiasReluConvParams : DenseConvParams<Conv> {
+  using ElementA = typename Conv::ConvKernel::ElementA;
+  using ElementB = typename Conv::ConvKernel::ElementB;
+  using ProblemShape = typename DenseConvParams<Conv>::ProblemShape;
+
+  thrust::universal_vector<ElementA> tensor_scale;
+  thrust::universal_vector<ElementA> tensor_bias;
+
+  bool initialize(ProblemShape const& problem_shape, uint64_t seed) {
+    int channels = problem_shape.shape_A[ProblemShape::RankT-1];
+    tensor_scale.resize(channels);
+    tensor_bias.resize(channels);
+    // Small integers keep the transformed activation, and thus the reference, exact
+    cutlass::reference::host::BlockFillRandomUniform(tensor_scale.data().get(), tensor_scale.size(), seed, 2, -2, 0);
+    cutlass::reference::host::BlockFillRandomUniform(tensor_bias.data().get(), tensor_bias.size(), seed * 3, 2, -2, 0);
+    return true;
+  }
+
+  auto get_mainloop_arguments(
+    [[maybe_unused]] ProblemShape const& problem_shape,
+    thrust::universal_vector<ElementA>& tensor_A,
+    thrust::universal_vector<ElementB>& tensor_B
+  ) {
+    auto args = typename Conv::ConvKernel::MainloopArguments {
+      tensor_A.data().get(),
+      tensor_B.data().get(),
+      tensor_scale.data().get(),
+      tensor_bias.data().get()
+    };
+    return args;
+  }
+
+  // Applies the fused input transform to the packed NHWC activation on the host. The reference
+  // zero pads the transformed activation, matching the kernel that keeps padding at zero.
+  void transform_activation(ProblemShape const& problem_shape, thrust::universal_vector<ElementA>& tensor_A) {
+    int channels = problem_shape.shape_A[ProblemShape::RankT-1];
+    ElementA* ptr_A = tensor_A.data().get();
+    ElementA const* ptr_scale = tensor_scale.data().get();
+    ElementA const* ptr_bias = tensor_bias.data().get();
+    for (size_t i = 0; i < tensor_A.size(); ++i) {
+      float x = static_cast<float>(ptr_A[i]);
+      float scale = static_cast<float>(ptr_scale[i % channels]);
+      float bias = static_cast<float>(ptr_bias[i % channels]);
+      ptr_A[i] = static_cast<ElementA>(std::max(std::fma(x, scale, bias), 0.f));
+    }
+  }
+};
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 template <class Conv, bool isSparseEnabled_ = false>
 struct ConvTestbed {
@@ -149,7 +201,11 @@ struct ConvTestbed {
 
   // ConvTest for sparse kernel
   static constexpr bool isSparseEnabled = isSparseEnabled_;
-  using ConvParams = cute::conditional_t<isSparseEnabled, SparseConvParams<Conv>, DenseConvParams<Conv>>;
+  // ConvTest for fused scale-bias-ReLU fprop kernel
+  static constexpr bool IsFpropScaleBiasRelu =
+      cute::is_base_of_v<cutlass::conv::KernelScheduleSm90FpropScaleBiasRelu, typename Conv::DispatchPolicy::Schedule>;
+  using ConvParams = cute::conditional_t<isSparseEnabled, SparseConvParams<Conv>,
+                     cute::conditional_t<IsFpropScaleBiasRelu, ScaleBiasReluConvParams<Conv>, DenseConvParams<Conv>>>;
   ConvParams params;
 
   //
@@ -239,6 +295,9 @@ struct ConvTestbed {
     if constexpr (isSparseEnabled) {
       flag &= params.initialize(problem_shape, tensor_B, static_cast<int>(seed + 2023));
     }
+    if constexpr (IsFpropScaleBiasRelu) {
+      flag &= params.initialize(problem_shape, seed * 29);
+    }
 
     return flag;
   }
@@ -476,6 +535,11 @@ struct ConvTestbed {
     EXPECT_EQ(result, cudaSuccess) << " Kernel execution error: "
                                    << cudaGetErrorString(result);
 
+    // The reference consumes the activation after the fused input transform
+    if constexpr (IsFpropScaleBiasRelu) {
+      params.transform_activation(problem_shape, tensor_A);
+    }
+
     // Create cute::Tensors using the logical rank-3 MNK multi-mode shapes the mainloop gives us
     auto [shape_mA, shape_mB, shape_mC, stride_mA, stride_mB, stride_mC] =
       transform_shape_and_stride_with_groups(problem_shape);
@@ -763,6 +827,62 @@ bool TestAllConv(double alpha = 1.0, double beta = 0.0, float epsilon = 0.0f,
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+template <typename Conv>
+bool TestAllGroupedFpropConv(int filters_per_group, int channels_per_group,
+                             double alpha = 1.0, double beta = 0.0) {
+  using ElementScalar = typename Conv::EpilogueOutputOp::ElementScalar;
+
+  bool passed = true;
+  ConvTestbed<Conv> testbed;
+  auto problem_vector = get_grouped_fprop_problem_vector<Conv::NumSpatialDimensions>(
+      filters_per_group, channels_per_group);
+
+  for (auto conv_problem : problem_vector) {
+    #if CUTLASS_DEBUG_TRACE_LEVEL > 0
+    print(conv_problem);
+    #endif
+    passed = testbed.run(
+      conv_problem,
+      cutlass::from_real<ElementScalar>(alpha),
+      cutlass::from_real<ElementScalar>(beta));
+    if (!passed) {
+      printf("Failed test for "); print(conv_problem);
+      return false;
+    }
+  }
+
+  return passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Conv>
+bool TestAllFpropScaleBiasReluConv(int channels, double alpha = 1.0, double beta = 0.0) {
+  using ElementScalar = typename Conv::EpilogueOutputOp::ElementScalar;
+
+  bool passed = true;
+  ConvTestbed<Conv> testbed;
+  auto problem_vector = get_fprop_scale_bias_relu_problem_vector<Conv::NumSpatialDimensions>(channels);
+
+  for (auto conv_problem : problem_vector) {
+    #if CUTLASS_DEBUG_TRACE_LEVEL > 0
+    print(conv_problem);
+    #endif
+    passed = testbed.run(
+      conv_problem,
+      cutlass::from_real<ElementScalar>(alpha),
+      cutlass::from_real<ElementScalar>(beta));
+    if (!passed) {
+      printf("Failed test for "); print(conv_problem);
+      return false;
+    }
+  }
+
+  return passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace test::conv::device
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
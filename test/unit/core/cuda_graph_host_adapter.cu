@@ -0,0 +1,119 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the graph-recording cutlass::CudaGraphHostAdapter
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/cuda_graph_host_adapter.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct AxpyParams {
+  int const* x;
+  int* y;
+  int alpha;
+  int n;
+};
+
+__global__ void axpy_kernel(AxpyParams params) {
+  int i = blockIdx.x * blockDim.x + threadIdx.x;
+  if (i < params.n) {
+    params.y[i] += params.alpha * params.x[i];
+  }
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(CudaGraphHostAdapter, record_and_update) {
+  int const n = 1000;
+  std::vector<int> host_x(n);
+  for (int i = 0; i < n; ++i) {
+    host_x[i] = i;
+  }
+  cutlass::device_memory::allocation<int> x(n);
+  cutlass::device_memory::allocation<int> y0(n);
+  cutlass::device_memory::allocation<int> y1(n);
+  cutlass::device_memory::copy_to_device(x.get(), host_x.data(), n);
+
+  cutlass::CudaGraphRecorder recorder;
+  cutlass::CudaGraphHostAdapter adapter(recorder, reinterpret_cast<void*>(axpy_kernel));
+
+  // Each step clears y and accumulates alpha * x into it twice; steps alternate between outputs
+  for (int step = 0; step < 4; ++step) {
+    AxpyParams params{x.get(), step % 2 ? y1.get() : y0.get(), step + 1, n};
+    void* kernel_params[] = {&params};
+
+    recorder.begin_step();
+    ASSERT_EQ(adapter.memsetDevice(params.y, 0, n, nullptr), cutlass::Status::kSuccess);
+    for (int launch = 0; launch < 2; ++launch) {
+      ASSERT_EQ(adapter.launch(dim3((n + 127) / 128), dim3(128), 0, nullptr, kernel_params, 0),
+                cutlass::Status::kSuccess);
+    }
+    EXPECT_EQ(recorder.recorded(), step > 0);
+    ASSERT_EQ(recorder.launch(nullptr), cutlass::Status::kSuccess);
+    ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+    EXPECT_EQ(recorder.node_count(), 3u);
+
+    std::vector<int> host_y(n);
+    cutlass::device_memory::copy_to_host(host_y.data(), params.y, n);
+    for (int i = 0; i < n; ++i) {
+      ASSERT_EQ(host_y[i], 2 * (step + 1) * i) << "step " << step << " element " << i;
+    }
+  }
+
+  // A step with a different sequence of launches is rejected
+  AxpyParams params{x.get(), y0.get(), 1, n};
+  void* kernel_params[] = {&params};
+  recorder.begin_step();
+  ASSERT_EQ(adapter.launch(dim3((n + 127) / 128), dim3(128), 0, nullptr, kernel_params, 0),
+            cutlass::Status::kErrorInvalidProblem);
+  EXPECT_EQ(recorder.launch(nullptr), cutlass::Status::kErrorInvalidProblem);
+
+  // ... until the graph is reset and recorded again
+  recorder.reset();
+  recorder.begin_step();
+  ASSERT_EQ(adapter.launch(dim3((n + 127) / 128), dim3(128), 0, nullptr, kernel_params, 0),
+            cutlass::Status::kSuccess);
+  ASSERT_EQ(recorder.launch(nullptr), cutlass::Status::kSuccess);
+  ASSERT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+  EXPECT_EQ(recorder.node_count(), 1u);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
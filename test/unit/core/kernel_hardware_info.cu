@@ -0,0 +1,95 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the memoized device queries of cutlass::KernelHardwareInfo
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/kernel_hardware_info.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(KernelHardwareInfoCache, insert_find_invalidate) {
+  using Cache = cutlass::detail::KernelHardwareInfoCache;
+  Cache cache;
+
+  int value = 0;
+  EXPECT_FALSE(cache.find_sm_count(0, value));
+
+  cache.insert_sm_count(0, 132);
+  cache.insert_sm_count(1, 148);
+  Cache::ClusterOccupancyKey key0{0, nullptr, 2, 1, 1, 384, 0, nullptr};
+  Cache::ClusterOccupancyKey key1{1, nullptr, 2, 1, 1, 384, 0, nullptr};
+  cache.insert_max_active_clusters(key0, 66);
+  cache.insert_max_active_clusters(key1, 74);
+
+#if !defined(CUTLASS_DISABLE_KERNEL_HARDWARE_INFO_CACHE)
+  EXPECT_TRUE(cache.find_sm_count(0, value));
+  EXPECT_EQ(value, 132);
+
+  // Different cluster shapes are distinct entries
+  Cache::ClusterOccupancyKey key2{0, nullptr, 1, 1, 1, 384, 0, nullptr};
+  EXPECT_FALSE(cache.find_max_active_clusters(key2, value));
+  EXPECT_TRUE(cache.find_max_active_clusters(key0, value));
+  EXPECT_EQ(value, 66);
+
+  // Invalidating one device leaves the others
+  cache.invalidate(0);
+  EXPECT_FALSE(cache.find_sm_count(0, value));
+  EXPECT_FALSE(cache.find_max_active_clusters(key0, value));
+  EXPECT_TRUE(cache.find_sm_count(1, value));
+  EXPECT_EQ(value, 148);
+  EXPECT_TRUE(cache.find_max_active_clusters(key1, value));
+  EXPECT_EQ(value, 74);
+
+  cache.invalidate();
+  EXPECT_FALSE(cache.find_sm_count(1, value));
+  EXPECT_FALSE(cache.find_max_active_clusters(key1, value));
+#endif
+}
+
+TEST(KernelHardwareInfoCache, sm_count_matches_runtime) {
+  int device_id = 0;
+  ASSERT_EQ(cudaGetDevice(&device_id), cudaSuccess);
+  int expected = 0;
+  ASSERT_EQ(cudaDeviceGetAttribute(&expected, cudaDevAttrMultiProcessorCount, device_id), cudaSuccess);
+
+  cutlass::KernelHardwareInfo::invalidate_cached_queries();
+  EXPECT_EQ(cutlass::KernelHardwareInfo::query_device_multiprocessor_count(device_id), expected);
+  // Served from the cache
+  EXPECT_EQ(cutlass::KernelHardwareInfo::query_device_multiprocessor_count(device_id), expected);
+
+  cutlass::KernelHardwareInfo::invalidate_cached_queries(device_id);
+  EXPECT_EQ(cutlass::KernelHardwareInfo::query_device_multiprocessor_count(device_id), expected);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
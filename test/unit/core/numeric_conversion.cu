@@ -39,6 +39,8 @@
 #include "cutlass/layout/matrix.h"
 #include "cutlass/util/host_tensor.h"
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace test {
@@ -153,6 +155,75 @@ void run_test_with_scalefactor(const char dest_name[], const char source_name[],
   }
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Stochastic rounding conversion: each thread converts the same source with its own random bits
+template <typename Destination, int Count>
+__global__ void convert_stochastic(
+  cutlass::Array<Destination, Count> *destination,
+  cutlass::Array<float, Count> const *source) {
+
+  using Converter = cutlass::NumericArrayConverter<Destination, float, Count, cutlass::FloatRoundStyle::round_stochastic>;
+  typename Converter::random_type rbits;
+  for (int i = 0; i < int(rbits.size()); ++i) {
+    // murmur3 finalizer of (thread, word)
+    uint32_t h = threadIdx.x * 0x9E3779B9u + uint32_t(i) * 0x85EBCA6Bu + 1u;
+    h ^= h >> 16; h *= 0x85EBCA6Bu; h ^= h >> 13; h *= 0xC2B2AE35u; h ^= h >> 16;
+    rbits[i] = h;
+  }
+  Converter convert;
+  destination[threadIdx.x] = convert(*source, rbits);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename Destination, int Count>
+void run_test_stochastic(const char dest_name[], float base, float step) {
+  const int kN = Count;
+  const int kSamples = 1024;
+
+  dim3 grid(1, 1);
+  dim3 block(kSamples, 1);
+
+  cutlass::HostTensor<Destination, cutlass::layout::RowMajor> destination({kSamples, kN});
+  cutlass::HostTensor<float, cutlass::layout::RowMajor> source({1, kN});
+  auto source_ref = source.host_ref();
+  auto destination_ref = destination.host_ref();
+
+  for (int i = 0; i < kN; ++i) {
+    source_ref.at({0, i}) = (i % 2 ? -1.f : 1.f) * (base + step * float(i));
+  }
+
+  source.sync_device();
+
+  convert_stochastic<Destination, kN><<< grid, block >>>(
+    reinterpret_cast<cutlass::Array<Destination, kN> *>(destination.device_data()),
+    reinterpret_cast<cutlass::Array<float, kN> const *>(source.device_data())
+  );
+
+  destination.sync_host();
+
+  for (int i = 0; i < kN; ++i) {
+    float x = source_ref.at({0, i});
+    float nearest = float(Destination(x));
+    float lo = nearest, hi = nearest;
+    double mean = 0;
+    for (int s = 0; s < kSamples; ++s) {
+      float d = float(destination_ref.at({s, i}));
+      lo = std::min(lo, d);
+      hi = std::max(hi, d);
+      mean += d;
+    }
+    mean /= kSamples;
+
+    // Only the two neighbors of x are produced, and their mix is unbiased
+    EXPECT_TRUE(lo <= x && x <= hi)
+      << "Destination type: " << dest_name << ", source " << x << ", range [" << lo << ", " << hi << "]";
+    EXPECT_NEAR(mean, x, 0.1 * (hi - lo) + 1e-6)
+      << "Destination type: " << dest_name << ", source " << x << ", idx: " << i;
+  }
+}
+
 } // namespace kernel
 } // namespace core
 } // namespace test
@@ -637,6 +708,22 @@ TEST(NumericConversion, int_to_fe4m3_t_array_32) {
   test::core::kernel::run_test<Destination, Source, kN>(dest_name, source_name);
 }
 
+TEST(NumericConversion, f32x8_to_bf16x8_rs) {
+  test::core::kernel::run_test_stochastic<cutlass::bfloat16_t, 8>("bfloat16_t", 1.3f, 0.37f);
+}
+
+TEST(NumericConversion, f32x8_to_fe4m3x8_rs) {
+  test::core::kernel::run_test_stochastic<cutlass::float_e4m3_t, 8>("float_e4m3_t", 0.3f, 1.7f);
+}
+
+TEST(NumericConversion, f32x8_to_fe5m2x8_rs) {
+  test::core::kernel::run_test_stochastic<cutlass::float_e5m2_t, 8>("float_e5m2_t", 0.3f, 1.7f);
+}
+
+TEST(NumericConversion, f32x8_to_fe2m1x8_rs) {
+  test::core::kernel::run_test_stochastic<cutlass::float_e2m1_t, 8>("float_e2m1_t", 0.2f, 0.7f);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <typename T>
@@ -130,6 +130,27 @@ TEST(Quaternion, spinor_rotation_inv) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+TEST(Quaternion, product_matrix_4x4) {
+
+  cutlass::Quaternion<float> p(1, -2, 3, 0.5f);
+  cutlass::Quaternion<float> q(-0.25f, 4, 2, -3);
+
+  cutlass::Quaternion<float> pq = p * q;
+  cutlass::Matrix4x1<float> q_vec(q.x(), q.y(), q.z(), q.w());
+  cutlass::Matrix4x1<float> p_vec(p.x(), p.y(), p.z(), p.w());
+
+  // p * q == L(p) q == R(q) p
+  cutlass::Matrix4x1<float> left = p.as_left_product_matrix_4x4().product(q_vec);
+  cutlass::Matrix4x1<float> right = q.as_right_product_matrix_4x4().product(p_vec);
+
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_FLOAT_EQ(left.at(i), pq[i]);
+    EXPECT_FLOAT_EQ(right.at(i), pq[i]);
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 TEST(Quaternion, as_rotation_matrix3x3) {
   
   cutlass::Matrix3x1<float> x(1.0f, 0.0f, 0.0f);
@@ -0,0 +1,149 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#include "cutlass_unit_test.h"
+
+#include <cute/tensor.hpp>
+
+TEST(CuTe_algorithm, CopyAutoVecBits)
+{
+  using namespace cute;
+
+  half_t g_buf[256];
+  half_t s_buf[256];
+
+  Tensor g_row = make_tensor(make_gmem_ptr(g_buf), make_layout(Shape<_16,_16>{}, LayoutRight{}));
+  Tensor s_row = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_16,_16>{}, LayoutRight{}));
+  Tensor s_col = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_16,_16>{}, LayoutLeft{}));
+
+  // Contiguous in both: widest vector capped by MaxVecBits
+  EXPECT_EQ(int(decltype(copy_auto_vec_bits<128>(g_row, s_row))::value), 128);
+  EXPECT_EQ(int(decltype(copy_auto_vec_bits< 32>(g_row, s_row))::value),  32);
+  // Transposed: no common vector, fall back to the element
+  EXPECT_EQ(int(decltype(copy_auto_vec_bits<128>(g_row, s_col))::value),  16);
+
+  // A dynamic leading stride restricts the vector to the statically known contiguous elements
+  Tensor g_pad = make_tensor(make_gmem_ptr(g_buf), make_layout(Shape<_16,_4>{}, make_stride(_1{}, 20)));
+  Tensor s_pad = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_16,_4>{}));
+  EXPECT_EQ(int(decltype(copy_auto_vec_bits<128>(g_pad, s_pad))::value), 128);
+  Tensor g_odd = make_tensor(make_gmem_ptr(g_buf), make_layout(Shape<_6,_4>{}, make_stride(_1{}, 8)));
+  Tensor s_odd = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_6,_4>{}));
+  EXPECT_EQ(int(decltype(copy_auto_vec_bits<128>(g_odd, s_odd))::value),  32);
+}
+
+TEST(CuTe_algorithm, CopyAutoBulkCopyable)
+{
+  using namespace cute;
+
+  float g_buf[256];
+  float s_buf[256];
+
+  Tensor g = make_tensor(make_gmem_ptr(g_buf), make_layout(Shape<_8,_32>{}, LayoutRight{}));
+  Tensor s = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_8,_32>{}, LayoutRight{}));
+  Tensor t = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_8,_32>{}, LayoutLeft{}));
+  Tensor r = make_tensor(static_cast<float*>(s_buf), make_layout(Shape<_8,_32>{}, LayoutRight{}));
+  Tensor n = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_8,_32>{}, Stride<_32,_2>{}));
+
+  EXPECT_TRUE ((decltype(is_bulk_copyable(g, s))::value));
+  EXPECT_TRUE ((decltype(is_bulk_copyable(s, g))::value));
+  EXPECT_FALSE((decltype(is_bulk_copyable(g, t))::value));
+  EXPECT_FALSE((decltype(is_bulk_copyable(g, r))::value));
+  EXPECT_FALSE((decltype(is_bulk_copyable(s, s))::value));
+  EXPECT_FALSE((decltype(is_bulk_copyable(g, n))::value));
+  EXPECT_FALSE((decltype(is_bulk_copyable<64>(g, s))::value));
+}
+
+TEST(CuTe_algorithm, CopyAuto)
+{
+  using namespace cute;
+
+  alignas(16) half_t g_buf[256];
+  alignas(16) half_t s_buf[256];
+  for (int i = 0; i < 256; ++i) {
+    g_buf[i] = half_t(float(i));
+    s_buf[i] = half_t(-1.0f);
+  }
+
+  Tensor g = make_tensor(make_gmem_ptr(static_cast<half_t const*>(g_buf)), make_layout(Shape<_16,_16>{}, LayoutRight{}));
+  Tensor s = make_tensor(make_smem_ptr(s_buf), make_layout(Shape<_16,_16>{}, Stride<_1,_16>{}));
+
+  copy_auto(g, s);
+  for (int i = 0; i < size(g); ++i) {
+    EXPECT_EQ(s(i), g(i));
+  }
+
+  // Dynamic shapes are vectorized by the static alignment only
+  Tensor g_d = make_tensor(make_gmem_ptr(static_cast<half_t const*>(g_buf)), make_layout(make_shape(16,16), LayoutRight{}));
+  Tensor s_d = make_tensor(make_smem_ptr(s_buf), make_layout(make_shape(16,16), LayoutLeft{}));
+  copy_auto(g_d, s_d);
+  for (int i = 0; i < size(g_d); ++i) {
+    EXPECT_EQ(s_d(i), g_d(i));
+  }
+}
+
+TEST(CuTe_algorithm, CooperativeCopyAuto)
+{
+  using namespace cute;
+
+  constexpr uint32_t NumThreads = 32;
+
+  alignas(16) float g_buf[512];
+  alignas(16) float s_buf[512];
+  for (int i = 0; i < 512; ++i) {
+    g_buf[i] = float(i);
+    s_buf[i] = -1.0f;
+  }
+
+  Tensor g = make_tensor(make_gmem_ptr(static_cast<float const*>(g_buf)), make_layout(Shape<_32,_16>{}, LayoutRight{}));
+  Tensor s = make_tensor(make_smem_ptr(s_buf), composition(Swizzle<2,2,3>{}, make_layout(Shape<_32,_16>{}, LayoutRight{})));
+
+  // Each thread's partition is independent, so the threads can be emulated in sequence
+  for (uint32_t tid = 0; tid < NumThreads; ++tid) {
+    cooperative_copy_auto<NumThreads>(tid, g, s);
+  }
+  for (int i = 0; i < size(g); ++i) {
+    EXPECT_EQ(s(i), g(i));
+  }
+}
+
+TEST(CuTe_algorithm, TmemCopyAutoOp)
+{
+  using namespace cute;
+
+  Tensor t64  = make_tensor(make_tmem_ptr<float>(),  make_layout(Shape<_128,_64>{}, Stride<TMEM::DP<float>,_1>{}));
+  Tensor t16  = make_tensor(make_tmem_ptr<float>(),  make_layout(Shape<_128,_24>{}, Stride<TMEM::DP<float>,_1>{}));
+  Tensor t16h = make_tensor(make_tmem_ptr<half_t>(), make_layout(Shape<_128,_32>{}, Stride<TMEM::DP<half_t>,_1>{}));
+
+  EXPECT_TRUE((is_same_v<decltype(tmem_load_op_auto(t64)),  SM100_TMEM_LOAD_32dp32b64x>));
+  EXPECT_TRUE((is_same_v<decltype(tmem_load_op_auto(t16)),  SM100_TMEM_LOAD_32dp32b8x>));
+  EXPECT_TRUE((is_same_v<decltype(tmem_load_op_auto(t16h)), SM100_TMEM_LOAD_32dp32b16x>));
+  EXPECT_TRUE((is_same_v<decltype(TMEM::tmem_load_to_store(tmem_load_op_auto(t64))), SM100_TMEM_STORE_32dp32b64x>));
+}
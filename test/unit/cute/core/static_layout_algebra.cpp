@@ -0,0 +1,86 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#include "cutlass_unit_test.h"
+
+#include <cute/layout.hpp>
+
+using namespace cute;
+
+TEST(CuTe_core, StaticCoalesce)
+{
+  // Hierarchical and flat spellings of the same layout share one canonical form
+  using L0 = Layout<Shape<Shape<_2,_4>,_8>, Stride<Stride<_1,_2>,_8>>;
+  using L1 = Layout<Shape<_2,_4,_8>, Stride<_1,_2,_8>>;
+  static_assert(cute::is_same_v<decltype(coalesce(L0{})), Layout<_64,_1>>);
+  static_assert(cute::is_same_v<decltype(coalesce(L1{})), Layout<_64,_1>>);
+  static_assert(cute::is_same_v<typename detail::StaticCoalesce<Shape<_2,_4,_8>, Stride<_1,_2,_8>, false>::type, Layout<_64,_1>>);
+
+  // Shape-1 modes are dropped, unmergeable modes are kept in order
+  static_assert(cute::is_same_v<decltype(coalesce(Layout<Shape<_1,_4,_1,_8>, Stride<_7,_8,_0,_1>>{})),
+                                Layout<Shape<_4,_8>, Stride<_8,_1>>>);
+
+  // All shape-1 modes coalesce to _1:_0
+  static_assert(cute::is_same_v<decltype(coalesce(Layout<Shape<_1,_1>, Stride<_3,_5>>{})), Layout<_1,_0>>);
+
+  // Any dynamic mode takes the generic path
+  auto dyn = coalesce(make_layout(make_shape(_2{}, 4), make_stride(_1{}, _2{})));
+  static_assert(cute::is_same_v<decltype(dyn), Layout<Shape<_2,int>, Stride<_1,_2>>>);
+  EXPECT_EQ(size(dyn), 8);
+}
+
+TEST(CuTe_core, StaticComposition)
+{
+  using A = Layout<Shape<_4,_8>, Stride<_8,_1>>;
+
+  static_assert(cute::is_same_v<decltype(composition(A{}, Layout<_8,_2>{})), Layout<Shape<_2,_4>, Stride<_16,_1>>>);
+  static_assert(cute::is_same_v<decltype(composition(A{}, Layout<_4,_1>{})), Layout<_4,_8>>);
+  static_assert(cute::is_same_v<decltype(logical_divide(Layout<Shape<_16,_32>>{}, make_tile(Layout<_4,_2>{}, _8{}))),
+                                decltype(logical_divide(Layout<Shape<_16,_32>>{}, make_tile(Layout<_4,_2>{}, Layout<_8,_1>{})))>);
+
+  auto result = composition(A{}, Layout<_8,_2>{});
+  for (int i = 0; i < size(result); ++i) {
+    EXPECT_EQ(result(i), A{}(2*i));
+  }
+}
+
+TEST(CuTe_core, StaticRightInverse)
+{
+  using A = Layout<Shape<_4,_8>, Stride<_8,_1>>;
+  auto inv = right_inverse(A{});
+  static_assert(cute::is_same_v<decltype(inv), Layout<Shape<_8,_4>, Stride<_4,_1>>>);
+  for (int i = 0; i < size(inv); ++i) {
+    EXPECT_EQ(A{}(inv(i)), i);
+  }
+
+  // Stride-0 modes are not part of the inverse
+  static_assert(cute::is_same_v<decltype(right_inverse(Layout<Shape<_4,_2>, Stride<_1,_0>>{})), Layout<_4,_1>>);
+}
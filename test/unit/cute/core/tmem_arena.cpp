@@ -0,0 +1,86 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#include "cutlass_unit_test.h"
+
+#include <cute/arch/tmem_arena_sm100.hpp>
+
+TEST(CuTe_core, TmemArena_Disjoint)
+{
+  using namespace cute::TMEM;
+
+  // Two accumulators live at the same time are packed back to back
+  using Plan = ArenaPlan<Region<128>, Region<64>>;
+  static_assert(Plan::offset<0> == 0);
+  static_assert(Plan::offset<1> == 128);
+  static_assert(Plan::UsedColumns == 192);
+  static_assert(Plan::AllocationColumns == 256);
+  static_assert(not Plan::aliases<0, 1>);
+
+  EXPECT_EQ(Plan::address<1>(0x00100000u), 0x00100000u + 128u);
+}
+
+TEST(CuTe_core, TmemArena_PhaseReuse)
+{
+  using namespace cute::TMEM;
+
+  // Back-to-back GEMM: GEMM2's accumulator reuses GEMM1's columns once GEMM1 has been consumed,
+  // while a softmax-style statistics region stays live across both phases
+  using Plan = ArenaPlan<
+    Region<256, 0>,       // GEMM1 accumulator
+    Region< 32, 0, 1>,    // statistics
+    Region<256, 1>>;      // GEMM2 accumulator
+  static_assert(Plan::offset<0> == 0);
+  static_assert(Plan::offset<1> == 256);
+  static_assert(Plan::offset<2> == 0);
+  static_assert(Plan::aliases<0, 2>);
+  static_assert(not Plan::aliases<1, 2>);
+  static_assert(Plan::UsedColumns == 288);
+  static_assert(Plan::AllocationColumns == 512);
+
+  // Without reuse the same regions would need 544 columns and fail to plan
+  EXPECT_EQ(Plan::columns<0> + Plan::columns<1> + Plan::columns<2>, 544);
+}
+
+TEST(CuTe_core, TmemArena_Alignment)
+{
+  using namespace cute::TMEM;
+
+  using Plan = ArenaPlanAligned<32, Region<16>, Region<16>, Region<8, 1>>;
+  static_assert(Plan::offset<0> == 0);
+  static_assert(Plan::offset<1> == 32);
+  static_assert(Plan::offset<2> == 0);
+  static_assert(Plan::UsedColumns == 48);
+  static_assert(Plan::AllocationColumns == 64);
+
+  // A small arena still requests one full allocation slice
+  static_assert(ArenaPlan<Region<8>>::AllocationColumns == 32);
+}
@@ -0,0 +1,107 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#include "cutlass_unit_test.h"
+
+#include <cstring>
+
+#include <thrust/device_vector.h>
+
+#include <cute/tensor.hpp>
+
+using namespace cute;
+
+#if CUDA_12_0_SM90_FEATURES_SUPPORTED
+
+namespace {
+
+template <class T, class GmemLayout, class SmemLayout>
+TmaDescriptor
+make_descriptor(T const* ptr, GmemLayout const& gmem_layout, SmemLayout const& smem_layout)
+{
+  Tensor gA = make_tensor(make_gmem_ptr(ptr), gmem_layout);
+  auto tma = make_tma_copy(SM90_TMA_LOAD{}, gA, smem_layout);
+  return *tma.get_tma_descriptor();
+}
+
+bool
+equal(TmaDescriptor const& lhs, TmaDescriptor const& rhs)
+{
+  return std::memcmp(&lhs, &rhs, sizeof(TmaDescriptor)) == 0;
+}
+
+} // end namespace
+
+TEST(SM90_CuTe_Hopper, Tma_Descriptor_Cache)
+{
+  using T = half_t;
+  auto& cache = TMA::DescriptorCache::get();
+  cache.clear();
+
+  thrust::device_vector<T> d_a(256 * 512);
+  thrust::device_vector<T> d_b(256 * 512);
+  T const* ptr_a = thrust::raw_pointer_cast(d_a.data());
+  T const* ptr_b = thrust::raw_pointer_cast(d_b.data());
+
+  auto gmem_layout = make_layout(make_shape(256, 512), GenColMajor{});
+  auto smem_layout = tile_to_shape(GMMA::Layout_MN_SW128_Atom<T>{}, Shape<_64,_64>{});
+
+  // Encodings with the cache disabled are the reference
+  cache.set_enabled(false);
+  TmaDescriptor ref_a = make_descriptor(ptr_a, gmem_layout, smem_layout);
+  TmaDescriptor ref_b = make_descriptor(ptr_b, gmem_layout, smem_layout);
+  cache.set_enabled(true);
+  EXPECT_EQ(cache.size(), size_t(0));
+
+  // A new problem is encoded, a repeated one is returned as is
+  EXPECT_TRUE(equal(make_descriptor(ptr_a, gmem_layout, smem_layout), ref_a));
+  EXPECT_TRUE(equal(make_descriptor(ptr_a, gmem_layout, smem_layout), ref_a));
+  EXPECT_EQ(cache.statistics().misses, uint64_t(1));
+  EXPECT_EQ(cache.statistics().hits, uint64_t(1));
+
+  // A new pointer only replaces the base address
+  EXPECT_TRUE(equal(make_descriptor(ptr_b, gmem_layout, smem_layout), ref_b));
+  EXPECT_TRUE(equal(make_descriptor(ptr_a, gmem_layout, smem_layout), ref_a));
+  EXPECT_EQ(cache.statistics().address_replacements, uint64_t(2));
+  EXPECT_EQ(cache.size(), size_t(1));
+
+  // Any other change of the problem is a new entry
+  auto gmem_layout_n = make_layout(make_shape(256, 448), GenColMajor{});
+  auto smem_layout_sw64 = tile_to_shape(GMMA::Layout_MN_SW64_Atom<T>{}, Shape<_64,_64>{});
+  make_descriptor(ptr_a, gmem_layout_n, smem_layout);
+  make_descriptor(ptr_a, gmem_layout, smem_layout_sw64);
+  EXPECT_EQ(cache.statistics().misses, uint64_t(3));
+  EXPECT_EQ(cache.size(), size_t(3));
+
+  cache.clear();
+}
+
+#endif
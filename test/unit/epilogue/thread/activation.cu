@@ -32,6 +32,9 @@
     \brief Unit tests for thread-level GEMM
 */
 
+#include <cstdint>
+#include <cstring>
+
 #include "../../common/cutlass_unit_test.h"
 
 #include "cutlass/layout/layout.h"
@@ -51,6 +54,22 @@ __global__ void test_Epilogue_thread_activation(T *out, T *in) {
   vec_out[threadIdx.x] = func(vec_in[threadIdx.x]);
 }
 
+/// Applies an activation to arrays of N elements, and its scalar form element by element
+template <typename T, int N, template <typename> class Func>
+__global__ void test_Epilogue_thread_activation_packed_vs_scalar(T *packed_out, T *scalar_out, T *in) {
+
+  cutlass::Array<T, N> *vec_out = reinterpret_cast<cutlass::Array<T, N> *>(packed_out);
+  cutlass::Array<T, N> *vec_in = reinterpret_cast<cutlass::Array<T, N> *>(in);
+
+  Func<cutlass::Array<T, N>> packed_func;
+  vec_out[threadIdx.x] = packed_func(vec_in[threadIdx.x]);
+
+  Func<T> scalar_func;
+  for (int i = 0; i < N; ++i) {
+    scalar_out[threadIdx.x * N + i] = scalar_func(in[threadIdx.x * N + i]);
+  }
+}
+
 template <typename T, int N, typename Func>
 __global__ void test_Epilogue_thread_activation_binary(T *out, T *x, T *alpha){
     cutlass::Array<T, N> *vec_out = reinterpret_cast<cutlass::Array<T, N> *>(out);
@@ -650,3 +669,151 @@ TEST(Epilogue_thread_gelu_taylor, device_f16) {
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Epilogue_thread_squared_relu, device_f32) {
+
+    int const kN = 256;
+    int const kV = 4;
+
+    using Element = float;
+    using Func = cutlass::epilogue::thread::SquaredReLu<cutlass::Array<Element, kV>>;
+
+    //
+    // Construct workspace
+    //
+    cutlass::HostTensor<Element, cutlass::layout::RowMajor> tensor_Destination({1, kN});
+    cutlass::HostTensor<Element, cutlass::layout::RowMajor> tensor_Source({1, kN});
+
+    for (int i = 0; i < kN; ++i) {
+        tensor_Source.host_data(i) = Element(GELU_golden_input[i]);
+    }
+
+    tensor_Destination.sync_device();
+    tensor_Source.sync_device();
+
+    //
+    // Launch the kernel
+    //
+    dim3 grid(1,1,1);
+    dim3 block(kN / kV, 1, 1);
+
+    test_Epilogue_thread_activation<Element, kV, Func><<< grid, block >>>(
+        tensor_Destination.device_data(),
+        tensor_Source.device_data());
+
+    tensor_Destination.sync_host();
+
+    //
+    // Verify
+    //
+
+    for (int i = 0; i < kN; ++i) {
+        Element input = Element(GELU_golden_input[i]);
+        Element relu = input > Element(0) ? input : Element(0);
+        Element expected = relu * relu;
+        Element got = tensor_Destination.host_data(i);
+
+        EXPECT_EQ(got, expected)
+            << "Input[" << i << "]: " << input << ", Got: " << got << ", expected: " << expected;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the number of representable values between a and b
+template <typename T>
+int64_t ulp_distance(T a, T b) {
+  static_assert(sizeof(T) == 4 || sizeof(T) == 2, "Only 32b and 16b floating-point types are supported");
+
+  auto ordered = [] (T x) -> int64_t {
+    if constexpr (sizeof(T) == 4) {
+      int32_t bits;
+      std::memcpy(&bits, &x, sizeof(bits));
+      return bits < 0 ? int64_t(INT32_MIN) - bits : bits;
+    }
+    else {
+      int16_t bits;
+      std::memcpy(&bits, &x, sizeof(bits));
+      return bits < 0 ? int64_t(INT16_MIN) - bits : bits;
+    }
+  };
+
+  return std::abs(ordered(a) - ordered(b));
+}
+
+/// Compares an activation applied to arrays of N elements with its scalar form, on inputs
+/// evenly spaced over [-8, 8]
+template <typename Element, int kV, template <typename> class Func>
+void test_activation_packed_vs_scalar(int64_t max_ulp) {
+
+  int const kN = 256;
+
+  //
+  // Construct workspace
+  //
+  cutlass::HostTensor<Element, cutlass::layout::RowMajor> tensor_Packed({1, kN * kV});
+  cutlass::HostTensor<Element, cutlass::layout::RowMajor> tensor_Scalar({1, kN * kV});
+  cutlass::HostTensor<Element, cutlass::layout::RowMajor> tensor_Source({1, kN * kV});
+
+  for (int i = 0; i < kN * kV; ++i) {
+    tensor_Source.host_data(i) = Element(-8.0f + 16.0f * float(i) / float(kN * kV - 1));
+  }
+
+  tensor_Packed.sync_device();
+  tensor_Scalar.sync_device();
+  tensor_Source.sync_device();
+
+  //
+  // Launch the kernel
+  //
+  dim3 grid(1,1,1);
+  dim3 block(kN, 1, 1);
+
+  test_Epilogue_thread_activation_packed_vs_scalar<Element, kV, Func><<< grid, block >>>(
+      tensor_Packed.device_data(),
+      tensor_Scalar.device_data(),
+      tensor_Source.device_data());
+
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  tensor_Packed.sync_host();
+  tensor_Scalar.sync_host();
+
+  //
+  // Verify
+  //
+
+  for (int i = 0; i < kN * kV; ++i) {
+    Element input = tensor_Source.host_data(i);
+    Element got = tensor_Packed.host_data(i);
+    Element expected = tensor_Scalar.host_data(i);
+
+    EXPECT_LE(ulp_distance(got, expected), max_ulp)
+        << "Input[" << i << "]: " << input << ", Got: " << got << ", expected: " << expected;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Epilogue_thread_tanh, device_bf16_packed_vs_scalar) {
+  test_activation_packed_vs_scalar<cutlass::bfloat16_t, 8, cutlass::epilogue::thread::Tanh>(2);
+  // Odd array sizes take the single-element tanh.approx.bf16 for the last element
+  test_activation_packed_vs_scalar<cutlass::bfloat16_t, 5, cutlass::epilogue::thread::Tanh>(2);
+}
+
+TEST(Epilogue_thread_sigmoid, device_f32_packed_vs_scalar) {
+  test_activation_packed_vs_scalar<float, 8, cutlass::epilogue::thread::Sigmoid>(1);
+  test_activation_packed_vs_scalar<float, 5, cutlass::epilogue::thread::Sigmoid>(1);
+}
+
+TEST(Epilogue_thread_silu, device_f32_packed_vs_scalar) {
+  test_activation_packed_vs_scalar<float, 8, cutlass::epilogue::thread::SiLu>(1);
+  test_activation_packed_vs_scalar<float, 5, cutlass::epilogue::thread::SiLu>(1);
+}
+
+TEST(Epilogue_thread_gelu_taylor, device_f32_packed_vs_scalar) {
+  test_activation_packed_vs_scalar<float, 8, cutlass::epilogue::thread::GELU_taylor>(1);
+  test_activation_packed_vs_scalar<float, 5, cutlass::epilogue::thread::GELU_taylor>(1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
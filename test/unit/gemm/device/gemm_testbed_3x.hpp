@@ -124,6 +124,12 @@ inline constexpr auto raster_order_to_string =
     else if (mode == Mode::AlongN) {
       return "AlongN";
     }
+    else if (mode == Mode::L2Aware) {
+      return "L2Aware";
+    }
+    else if (mode == Mode::Morton) {
+      return "Morton";
+    }
     else {
       return "Unknown";
     }
@@ -2708,10 +2714,17 @@ struct TestbedImpl {
   static constexpr uint32_t mma_promotion_interval = 4;
   using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90::RasterOrderOptions;
   using DecompositionMode = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams::DecompositionMode;
+  using ReductionMode = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams::ReductionMode;
 
   HostCollectiveMainloopType collective_mma_inputs;
   CollectiveEpilogue collective_epilogue;
 
+  // Reduction mode of stream-K and split-K kernels
+  ReductionMode reduction_mode = ReductionMode::Deterministic;
+  // Number of further launches of stream-K and split-K kernels on the workspace of the first one,
+  // each with barrier_workspace_initialized set and verified against the reference
+  int workspace_reuse_launches = 0;
+
   //
   // Methods
   //
@@ -2944,6 +2957,7 @@ struct TestbedImpl {
     typename Gemm::GemmKernel::TileScheduler::Arguments scheduler_args;
     if constexpr (cute::is_same_v<typename Gemm::GemmKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
       scheduler_args = { static_cast<int>(splits), static_cast<int>(max_swizzle), raster_order, decomposition_mode };
+      scheduler_args.reduction_mode = reduction_mode;
     }
     else {
       scheduler_args = { static_cast<int>(max_swizzle), raster_order };
@@ -3060,6 +3074,30 @@ struct TestbedImpl {
       }
 #endif
 
+      if constexpr (cute::is_same_v<typename Gemm::GemmKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
+        // Each launch returns the barrier flags to zero, so the following ones need not clear them
+        arguments.scheduler.barrier_workspace_initialized = true;
+        for (int launch = 0; passed && launch < workspace_reuse_launches; ++launch) {
+          cutlass::reference::host::TensorFill(collective_epilogue.tensor_D.host_view());
+          collective_epilogue.tensor_D.sync_device();
+
+          status = gemm_op.initialize(arguments, workspace.get());
+          EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
+          status = gemm_op.run();
+          EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
+          result = cudaDeviceSynchronize();
+          if (result != cudaSuccess) {
+            EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+            return false;
+          }
+
+          passed = this->verify(problem_size, alpha, beta);
+          if (!passed) {
+            std::cout << "Error : Failed : on launch " << launch + 1 << " reusing the workspace\n";
+          }
+        }
+      }
+
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
       CUTLASS_TRACE_HOST("TestbedImpl::run: Reached end");
 #endif
@@ -3871,6 +3909,11 @@ bool TestAll(double alpha = 1.0, double beta = cute::is_same_v<typename Gemm::Ge
 
   using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90::RasterOrderOptions;
   std::vector<RasterOrderOptions> raster_orders = {RasterOrderOptions::AlongM, RasterOrderOptions::AlongN};
+  // The super-tile orders are supported by the data-parallel persistent scheduler
+  if constexpr (cute::is_same_v<typename Gemm::GemmKernel::TileScheduler, cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90>) {
+    raster_orders.push_back(RasterOrderOptions::L2Aware);
+    raster_orders.push_back(RasterOrderOptions::Morton);
+  }
   std::vector max_swizzle_sizes{detail::MaxSwizzleSize{1}, detail::MaxSwizzleSize{4}};
 
   bool passed = true;
@@ -0,0 +1,201 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Testbed for epilogue fusions checked against a custom host reference
+
+    A, B and C are filled with small integers, so the accumulator is exact and a test can
+    reproduce each fused output from acc(m,n,l) and c(m,n,l) instead of a HostEVT tree.
+*/
+
+#pragma once
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/gemm.h"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+namespace test::gemm::device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Host copy and device allocation of one packed (rows, cols, L) operand
+template <class Element, class Stride>
+struct FusionOperand {
+  std::vector<Element> host;
+  cutlass::DeviceAllocation<Element> device;
+  Stride stride{};
+
+  void reset(int rows, int cols, int L) {
+    stride = cutlass::make_cute_packed_stride(Stride{}, cute::make_shape(rows, cols, L));
+    host.assign(size_t(rows) * cols * L, Element(0));
+    device.reset(host.size());
+  }
+
+  Element& at(int row, int col, int l) {
+    return host[row * int64_t(cute::get<0>(stride)) + col * int64_t(cute::get<1>(stride)) +
+                l * int64_t(cute::get<2>(stride))];
+  }
+
+  Element const& at(int row, int col, int l) const {
+    return const_cast<FusionOperand*>(this)->at(row, col, l);
+  }
+
+  /// Fills with integers in [-range, range]
+  void fill(uint32_t seed, int range) {
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> dist(-range, range);
+    for (auto& x : host) {
+      x = Element(float(dist(gen)));
+    }
+  }
+
+  void to_device() { device.copy_from_host(host.data()); }
+  void to_host() { device.copy_to_host(host.data()); }
+};
+
+/// Runs a GEMM with caller-provided fusion arguments and keeps the exact accumulator on the host
+template <class Gemm>
+struct FusionTestbed {
+  using GemmKernel = typename Gemm::GemmKernel;
+  using CollectiveEpilogue = typename GemmKernel::CollectiveEpilogue;
+  using ElementA = typename GemmKernel::ElementA;
+  using ElementB = typename GemmKernel::ElementB;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+  // Void C or D is replaced by float on the host and passed as nullptr
+  static constexpr bool HasC = not cute::is_void_v<typename CollectiveEpilogue::ElementC>;
+  static constexpr bool HasD = not cute::is_void_v<typename CollectiveEpilogue::ElementD>;
+  using ElementC = cute::conditional_t<HasC, typename CollectiveEpilogue::ElementC, float>;
+  using ElementD = cute::conditional_t<HasD, typename CollectiveEpilogue::ElementD, float>;
+  using FusionArguments = decltype(typename Gemm::Arguments{}.epilogue.thread);
+
+  int M = 0, N = 0, K = 0, L = 1;
+  FusionOperand<ElementA, StrideA> tensor_A;
+  FusionOperand<ElementB, StrideB> tensor_B;
+  FusionOperand<ElementC, StrideC> tensor_C;
+  FusionOperand<ElementD, StrideD> tensor_D;
+  std::vector<double> accumulator;
+
+  FusionTestbed(int M_, int N_, int K_, int L_ = 1, uint32_t seed = 2026) : M(M_), N(N_), K(K_), L(L_) {
+    tensor_A.reset(M, K, L);
+    tensor_B.reset(N, K, L);
+    tensor_C.reset(M, N, L);
+    tensor_D.reset(M, N, L);
+    tensor_A.fill(seed, 2);
+    tensor_B.fill(seed + 1, 2);
+    tensor_C.fill(seed + 2, 4);
+    tensor_A.to_device();
+    tensor_B.to_device();
+    tensor_C.to_device();
+    tensor_D.to_device();
+
+    accumulator.assign(size_t(M) * N * L, 0.0);
+    for (int l = 0; l < L; ++l) {
+      for (int m = 0; m < M; ++m) {
+        for (int n = 0; n < N; ++n) {
+          double sum = 0;
+          for (int k = 0; k < K; ++k) {
+            sum += double(tensor_A.at(m, k, l)) * double(tensor_B.at(n, k, l));
+          }
+          accumulator[(size_t(l) * M + m) * N + n] = sum;
+        }
+      }
+    }
+  }
+
+  double acc(int m, int n, int l = 0) const { return accumulator[(size_t(l) * M + m) * N + n]; }
+  double c(int m, int n, int l = 0) const { return double(tensor_C.at(m, n, l)); }
+  double d(int m, int n, int l = 0) const { return double(tensor_D.at(m, n, l)); }
+
+  /// Runs the GEMM and copies D back, false if it cannot be implemented or fails.
+  /// With null_C the C pointer is nullptr, so a fusion that should skip the C load faults if it reads C.
+  bool run(FusionArguments const& fusion_args, bool null_C = false) {
+    cutlass::KernelHardwareInfo hw_info;
+    hw_info.device_id = 0;
+    hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+    typename Gemm::Arguments arguments{
+      cutlass::gemm::GemmUniversalMode::kGemm,
+      {M, N, K, L},
+      {tensor_A.device.get(), tensor_A.stride, tensor_B.device.get(), tensor_B.stride},
+      {fusion_args,
+       HasC && !null_C ? tensor_C.device.get() : nullptr, tensor_C.stride,
+       HasD ? tensor_D.device.get() : nullptr, tensor_D.stride},
+      hw_info
+    };
+
+    Gemm gemm;
+    if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+      std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << "x" << L << std::endl;
+      return false;
+    }
+    cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+    if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+        gemm.run() != cutlass::Status::kSuccess) {
+      std::cerr << "GEMM failed to launch" << std::endl;
+      return false;
+    }
+    cudaError_t result = cudaDeviceSynchronize();
+    if (result != cudaSuccess) {
+      std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+      return false;
+    }
+    if constexpr (HasD) {
+      tensor_D.to_host();
+    }
+    return true;
+  }
+};
+
+/// Relative and absolute tolerance comparison that reports the first mismatch
+inline bool
+fusion_close(double actual, double expected, double rel_tol, double abs_tol, char const* what, int m, int n, int l = 0) {
+  if (std::abs(actual - expected) <= rel_tol * std::abs(expected) + abs_tol) {
+    return true;
+  }
+  std::cerr << "Mismatch in " << what << " at (" << m << "," << n << "," << l << "): "
+            << actual << " != " << expected << std::endl;
+  return false;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace test::gemm::device
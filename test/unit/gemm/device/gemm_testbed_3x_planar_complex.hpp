@@ -158,6 +158,10 @@ struct Testbed3xPlanarComplex {
   cutlass::ComplexTransform TransformA = Gemm::kTransformA;
   cutlass::ComplexTransform TransformB = Gemm::kTransformB;
 
+  // Number of further launches of stream-K and split-K kernels on the workspace of the first one,
+  // each with barrier_workspace_initialized set and verified against the reference
+  int workspace_reuse_launches = 0;
+
   //
   // Methods
   //
@@ -471,6 +475,30 @@ struct Testbed3xPlanarComplex {
                 << "\n";
     }
 
+    if constexpr (cute::is_same_v<typename Gemm::GemmKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
+      // Each launch returns the barrier flags to zero, so the following ones need not clear them
+      arguments.scheduler.barrier_workspace_initialized = true;
+      for (int launch = 0; passed && launch < workspace_reuse_launches; ++launch) {
+        cutlass::reference::host::TensorFill(tensor_D.host_view(), cutlass::complex<ElementC>());
+        tensor_D.sync_device();
+
+        status = gemm_op.initialize(arguments, workspace.get());
+        EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
+        status = gemm_op.run();
+        EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
+        result = cudaDeviceSynchronize();
+        if (result != cudaSuccess) {
+          EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+          return false;
+        }
+
+        passed = this->verify(problem_size, alpha, beta);
+        if (!passed) {
+          std::cout << "Error : Failed : on launch " << launch + 1 << " reusing the workspace\n";
+        }
+      }
+    }
+
     return passed;
   }
 };
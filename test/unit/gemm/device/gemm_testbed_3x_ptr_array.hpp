@@ -160,6 +160,17 @@ struct IsDefaultEpilogue<cutlass::epilogue::collective::detail::Sm90TmaWarpSpeci
   static constexpr bool value = true;
 };
 
+// Whether the tile scheduler arguments are those of the grouped stream-K scheduler
+template<class Arguments, class = void>
+struct IsGroupStreamKSchedulerArguments {
+  static constexpr bool value = false;
+};
+
+template<class Arguments>
+struct IsGroupStreamKSchedulerArguments<Arguments, std::void_t<decltype(Arguments{}.max_splits)>> {
+  static constexpr bool value = true;
+};
+
 // The number of splits to test.
 //
 // This class makes it harder to confuse the order of arguments
@@ -388,9 +399,11 @@ struct HostCollectiveMainloop {
       EXPECT_TRUE(initialize_tensor(tensors_B[i].host_view(), init_B, seed + 2021 + i));
 
       // It is possible to randomly initialize to all zeros, so override this with non-zeros
-      // in the upper left corner of each operand.
-      tensors_A[i].host_view().at({0, 0}) = ElementA(1);
-      tensors_B[i].host_view().at({0, 0}) = ElementB(1);
+      // in the upper left corner of each operand. Operands of groups with K == 0 are empty.
+      if (K > 0) {
+        tensors_A[i].host_view().at({0, 0}) = ElementA(1);
+        tensors_B[i].host_view().at({0, 0}) = ElementB(1);
+      }
 
       tensors_A[i].sync_device();
       tensors_B[i].sync_device();
@@ -644,9 +657,11 @@ struct HostCollectiveMainloop<cutlass::gemm::KernelPtrArrayTmaWarpSpecializedBlo
       EXPECT_TRUE(initialize_tensor(tensors_B[i].host_view(), init_B, seed + 2021 + i));
 
       // It is possible to randomly initialize to all zeros, so override this with non-zeros
-      // in the upper left corner of each operand.
-      tensors_A[i].host_view().at({0, 0}) = ElementA(1);
-      tensors_B[i].host_view().at({0, 0}) = ElementB(1);
+      // in the upper left corner of each operand. Operands of groups with K == 0 are empty.
+      if (K > 0) {
+        tensors_A[i].host_view().at({0, 0}) = ElementA(1);
+        tensors_B[i].host_view().at({0, 0}) = ElementB(1);
+      }
 
       tensors_A[i].sync_device();
       tensors_B[i].sync_device();
@@ -1900,11 +1915,20 @@ struct TestbedImpl {
   using RasterOrderOptions = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90::RasterOrderOptions;
   using DecompositionMode = typename cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams::DecompositionMode;
 
+  using TileSchedulerArguments = typename Gemm::GemmKernel::TileScheduler::Arguments;
+  static constexpr bool IsGroupStreamK = IsGroupStreamKSchedulerArguments<TileSchedulerArguments>::value;
+
   HostCollectiveMainloopType collective_mma_inputs;
   CollectiveEpilogue collective_epilogue;
 
   static constexpr bool IsGroupGemm = CollectiveEpilogue::IsGroupGemm;
 
+  // Tile scheduler arguments, such as the maximum number of splits of grouped stream-K kernels
+  TileSchedulerArguments scheduler_args{};
+  // Number of further launches of grouped stream-K kernels on the workspace of the first one,
+  // each with barrier_workspace_initialized set and verified against the reference
+  int workspace_reuse_launches = 0;
+
   //
   // Methods
   //
@@ -2085,7 +2109,7 @@ struct TestbedImpl {
         hw_info
       };
     }
-
+    arguments.scheduler = scheduler_args;
 
     Gemm gemm_op;
 
@@ -2124,6 +2148,32 @@ struct TestbedImpl {
                 << "\n";
     }
 
+    if constexpr (IsGroupStreamK) {
+      // Each launch returns the barrier flags to zero, so the following ones need not clear them
+      arguments.scheduler.barrier_workspace_initialized = true;
+      for (int launch = 0; passed && launch < workspace_reuse_launches; ++launch) {
+        for (auto& tensor_D : collective_epilogue.tensors_D) {
+          cutlass::reference::host::TensorFill(tensor_D.host_view());
+          tensor_D.sync_device();
+        }
+
+        status = gemm_op.initialize(arguments, workspace.get());
+        EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
+        status = gemm_op.run();
+        EXPECT_TRUE(status == cutlass::Status::kSuccess) << to_string(status);
+        result = cudaDeviceSynchronize();
+        if (result != cudaSuccess) {
+          EXPECT_EQ(result, cudaSuccess) << "Error at Kernel Sync.";
+          return false;
+        }
+
+        passed = this->verify(problem_shapes, alpha, beta);
+        if (!passed) {
+          std::cout << "Error : Failed : on launch " << launch + 1 << " reusing the workspace\n";
+        }
+      }
+    }
+
     return passed;
   }
 };
@@ -0,0 +1,331 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Unit tests for block scaled GEMMs quantizing a 16b A operand in the mainloop
+
+    * A tensor:
+      * Types: bf16, quantized to the block scaled type of B
+      * Layout: Row Major (T)
+    * B tensor:
+      * Types: {e2m1}xue4m3, {e2m1}xue8m0
+      * Layout: Column Major (N)
+
+    A 16b A tile takes four times the smem of its quantized form, so the tiles use a K of 128
+    to leave room for the fp32 epilogue. The reference quantizes A on the host the way the mainloop does, with the scale factor
+    rounded up so that no element of a vector exceeds the largest e2m1 value, and runs a
+    block scaled GEMM on the quantized operands.
+*/
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "../../../common/cutlass_unit_test.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class ElementPairB, class MmaTileShape_MNK, class ClusterShape_MNK>
+struct InputQuantGemm {
+  using ElementA = cutlass::bfloat16_t;
+  using GmemLayoutA = cutlass::layout::RowMajor;
+  using GmemLayoutB = cutlass::layout::ColumnMajor;
+  using ElementC = float;
+  using ElementD = float;
+  using GmemLayoutC = cutlass::layout::RowMajor;
+  using ElementAccumulator = float;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      MmaTileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAccumulator, float,
+      ElementC, GmemLayoutC, 4,
+      ElementD, GmemLayoutC, 4,
+      cutlass::epilogue::TmaWarpSpecialized1Sm
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassBlockScaledTensorOp,
+      ElementA, GmemLayoutA, 8,
+      ElementPairB, GmemLayoutB, 32,
+      ElementAccumulator,
+      MmaTileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecialized1SmBlockScaledInputQuantSm100
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Quantizes one vector of A as the mainloop does and returns its scale factor
+template <class ElementSF, class ElementQ, int SFVecSize>
+ElementSF
+quantize_vector_host(float const* src, ElementQ* dst, float scale_A) {
+  constexpr float MaxQuantizedValue = 6.0f;
+  float values[SFVecSize];
+  float amax = 0.0f;
+  for (int i = 0; i < SFVecSize; ++i) {
+    values[i] = src[i] * scale_A;
+    amax = std::max(amax, std::abs(values[i]));
+  }
+
+  float sf_target = amax / MaxQuantizedValue;
+  ElementSF sf = cutlass::NumericConverter<ElementSF, float>{}(sf_target);
+  if (static_cast<float>(sf) < sf_target) {
+    ElementSF sf_next = ElementSF::bitcast(sf.storage + 1);
+    if (static_cast<float>(sf_next) > static_cast<float>(sf)) {
+      sf = sf_next;
+    }
+  }
+  float sf_value = static_cast<float>(sf);
+  float inv_sf = (sf_value == 0.0f) ? 0.0f : 1.0f / sf_value;
+
+  for (int i = 0; i < SFVecSize; ++i) {
+    float scaled = values[i] * inv_sf;
+    // Rounding up the scale factor keeps every element in range, so nothing saturates
+    if (std::abs(scaled) > MaxQuantizedValue) {
+      std::cerr << "Quantized value " << scaled << " exceeds the largest e2m1 value" << std::endl;
+    }
+    dst[i] = cutlass::NumericConverter<ElementQ, float>{}(scaled);
+  }
+  return sf;
+}
+
+template <class GemmType>
+bool
+test_input_quant_gemm(int M, int N, int K, float scale_A, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using CollectiveMainloop = typename GemmKernel::CollectiveMainloop;
+  using ElementA = typename CollectiveMainloop::ElementA;
+  using ElementB = typename CollectiveMainloop::ElementB;
+  using ElementSF = typename CollectiveMainloop::ElementSF;
+  using Sm1xxBlkScaledConfig = typename CollectiveMainloop::Sm1xxBlkScaledConfig;
+  constexpr int SFVecSize = CollectiveMainloop::SFVecSize;
+  static_assert(cute::sizeof_bits_v<ElementB> == 4);
+
+  auto problem_shape = make_shape(M, N, K, 1);
+  auto layout_SFB = Sm1xxBlkScaledConfig::tile_atom_to_shape_SFB(problem_shape);
+
+  // Operands: A spans several binades so that the scale factors round in both directions
+  std::vector<ElementA> host_A(size_t(M) * K);
+  std::vector<uint8_t> host_B(size_t(N) * K / 2, 0);
+  std::vector<float> host_B_value(size_t(N) * K);
+  std::vector<ElementSF> host_SFB(size(filter_zeros(layout_SFB)));
+  std::vector<float> host_C(size_t(M) * N);
+
+  uint32_t state = 2025;
+  auto next_random = [&]() {
+    state = state * 1664525u + 1013904223u;
+    return state >> 8;
+  };
+  for (auto& a : host_A) {
+    float magnitude = float(1 << (next_random() % 6)) * (1.0f + float(next_random() % 1000) / 1000.0f);
+    a = ElementA(((next_random() & 1) ? 1.0f : -1.0f) * magnitude / 8.0f);
+  }
+  for (int n = 0; n < N; ++n) {
+    for (int k = 0; k < K; ++k) {
+      ElementB b = ElementB(float(int(next_random() % 7) - 3));
+      size_t idx = size_t(n) * K + k;
+      host_B[idx / 2] |= uint8_t((b.raw() & 0xF) << ((idx % 2) * 4));
+      host_B_value[idx] = float(b);
+    }
+  }
+  for (auto& sf : host_SFB) {
+    sf = ElementSF(float(1 << (next_random() % 3)));
+  }
+  for (auto& c : host_C) {
+    c = float(int(next_random() % 9) - 4);
+  }
+
+  // Reference: quantize A per vector along K, then run the block scaled GEMM
+  std::vector<float> host_A_dequant(size_t(M) * K);
+  for (int m = 0; m < M; ++m) {
+    for (int k = 0; k < K; k += SFVecSize) {
+      float src[SFVecSize];
+      ElementB quantized[SFVecSize];
+      for (int i = 0; i < SFVecSize; ++i) {
+        src[i] = float(host_A[size_t(m) * K + k + i]);
+      }
+      float sf = float(quantize_vector_host<ElementSF, ElementB, SFVecSize>(src, quantized, scale_A));
+      for (int i = 0; i < SFVecSize; ++i) {
+        host_A_dequant[size_t(m) * K + k + i] = float(quantized[i]) * sf;
+      }
+    }
+  }
+  Tensor tensor_SFB_full = make_tensor(host_SFB.data(), layout_SFB);
+
+  std::vector<float> reference_D(size_t(M) * N);
+  std::vector<float> reference_abs(size_t(M) * N);
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < N; ++n) {
+      double accum = 0.0;
+      double accum_abs = 0.0;
+      for (int k = 0; k < K; ++k) {
+        double product = double(host_A_dequant[size_t(m) * K + k]) *
+                         double(host_B_value[size_t(n) * K + k]) * double(float(tensor_SFB_full(n, k, 0)));
+        accum += product;
+        accum_abs += std::abs(product);
+      }
+      reference_D[size_t(m) * N + n] = float(alpha * accum + beta * host_C[size_t(m) * N + n]);
+      reference_abs[size_t(m) * N + n] = float(std::abs(alpha) * accum_abs + std::abs(beta * host_C[size_t(m) * N + n]));
+    }
+  }
+
+  cutlass::DeviceAllocation<ElementA> device_A(host_A.size());
+  cutlass::DeviceAllocation<uint8_t> device_B(host_B.size());
+  cutlass::DeviceAllocation<ElementSF> device_SFB(host_SFB.size());
+  cutlass::DeviceAllocation<float> device_C(host_C.size());
+  cutlass::DeviceAllocation<float> device_D(host_C.size());
+  device_A.copy_from_host(host_A.data());
+  device_B.copy_from_host(host_B.data());
+  device_SFB.copy_from_host(host_SFB.data());
+  device_C.copy_from_host(host_C.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {M, K, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {N, K, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {M, N, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {M, N, 1});
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, 1},
+    {device_A.get(), stride_A,
+     reinterpret_cast<ElementB const*>(device_B.get()), stride_B,
+     device_SFB.get(), layout_SFB,
+     scale_A},
+    {{alpha, beta}, device_C.get(), stride_C, device_D.get(), stride_D},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+
+  std::vector<float> host_D(host_C.size());
+  device_D.copy_to_host(host_D.data());
+  for (size_t i = 0; i < host_D.size(); ++i) {
+    // The products are exact; only the order of the fp32 accumulation differs
+    float tolerance = 1e-5f * reference_abs[i] + 1e-6f;
+    if (!(std::abs(host_D[i] - reference_D[i]) <= tolerance)) {
+      std::cerr << "Mismatch at (" << i / N << "," << i % N << "): "
+                << host_D[i] << " != " << reference_D[i] << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_input_quant_gemm_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 136}) {
+      for (int k : {256, 1024}) {
+        if (!test_input_quant_gemm<GemmType>(m, n, k, 1.0f, 1.0f, 0.0f) ||
+            !test_input_quant_gemm<GemmType>(m, n, k, 16.0f, 0.0625f, 1.0f)) {
+          std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM100Only_Device_Gemm_bf16t_NVue4m3xe2m1n_f32t_bstensorop_f32_input_quant, 128x128x128_1x1x1_1sm) {
+  using GemmType = test::gemm::device::InputQuantGemm<
+    cutlass::nv_float4_t<cutlass::float_e2m1_t>, Shape<_128,_128,_128>, Shape<_1,_1,_1>>;
+  EXPECT_TRUE(test::gemm::device::test_input_quant_gemm_all<GemmType>());
+}
+
+TEST(SM100Only_Device_Gemm_bf16t_NVue4m3xe2m1n_f32t_bstensorop_f32_input_quant, 128x256x128_2x1x1_1sm) {
+  using GemmType = test::gemm::device::InputQuantGemm<
+    cutlass::nv_float4_t<cutlass::float_e2m1_t>, Shape<_128,_256,_128>, Shape<_2,_1,_1>>;
+  EXPECT_TRUE(test::gemm::device::test_input_quant_gemm_all<GemmType>());
+}
+
+TEST(SM100Only_Device_Gemm_bf16t_MXue8m0xe2m1n_f32t_bstensorop_f32_input_quant, 128x128x128_1x1x1_1sm) {
+  using GemmType = test::gemm::device::InputQuantGemm<
+    cutlass::mx_float4_t<cutlass::float_e2m1_t>, Shape<_128,_128,_128>, Shape<_1,_1,_1>>;
+  EXPECT_TRUE(test::gemm::device::test_input_quant_gemm_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
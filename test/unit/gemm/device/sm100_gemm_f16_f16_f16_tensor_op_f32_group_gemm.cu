@@ -117,6 +117,81 @@ using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
   EXPECT_TRUE(result);
 }
 
+TEST(SM100_Device_Gemm_f16t_f16n_f16n_tensor_op_1sm_f32_group, 128x128x64_1x2x1_longest_k_first) {
+// A matrix configuration
+using         ElementA    = cutlass::half_t;                                // Element type for A matrix operand
+using         LayoutA     = cutlass::layout::RowMajor;                      // Layout type for A matrix operand
+constexpr int AlignmentA  = 128 / cutlass::sizeof_bits<ElementA>::value;    // Memory access granularity/alignment of A matrix in units of elements (up to 16 bytes)
+// B matrix configuration
+using         ElementB    = cutlass::half_t;                                // Element type for B matrix operand
+using         LayoutB     = cutlass::layout::ColumnMajor;                   // Layout type for B matrix operand
+constexpr int AlignmentB  = 128 / cutlass::sizeof_bits<ElementB>::value;    // Memory access granularity/alignment of B matrix in units of elements (up to 16 bytes)
+// C matrix configuration
+using         ElementC    = cutlass::half_t;                                // Element type for C matrix operands
+using         LayoutC     = cutlass::layout::ColumnMajor;                   // Layout type for C matrix operands
+constexpr int AlignmentC  = 128 / cutlass::sizeof_bits<ElementC>::value;    // Memory access granularity/alignment of C matrix in units of elements (up to 16 bytes)
+// D matrix configuration
+using         ElementD    = cutlass::half_t;                                // Element type for D matrix operands
+using         LayoutD     = cutlass::layout::ColumnMajor;                   // Layout type for D matrix operands
+constexpr int AlignmentD  = 128 / cutlass::sizeof_bits<ElementD>::value;    // Memory access granularity/alignment of D matrix in units of elements (up to 16 bytes)
+// Core kernel configurations
+using ElementAccumulator  = float;                                           // Element type for internal accumulation
+using ArchTag             = cutlass::arch::Sm100;                            // Tag indicating the minimum SM that supports the intended feature
+using OperatorClass       = cutlass::arch::OpClassTensorOp;                  // Operator class tag
+using MmaTileShape = Shape<_128,_64,_64>;
+using ClusterShape = Shape<_1,_2,_1>;
+using KernelSchedule   = cutlass::gemm::KernelPtrArrayTmaWarpSpecialized1SmSm100;   // Kernel to launch
+using EpilogueSchedule = cutlass::epilogue::PtrArrayTmaWarpSpecialized1Sm;          // Epilogue to launch
+
+using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+    cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+    MmaTileShape, ClusterShape,
+    cutlass::epilogue::collective::EpilogueTileAuto,
+    ElementAccumulator, ElementAccumulator,
+    ElementC, LayoutC *, AlignmentC,
+    ElementD, LayoutD *, AlignmentD,
+    EpilogueSchedule
+  >::CollectiveOp;
+
+using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+    ArchTag, OperatorClass,
+    ElementA, LayoutA *, AlignmentA,
+    ElementB, LayoutB *, AlignmentB,
+    ElementAccumulator,
+    MmaTileShape, ClusterShape,
+    cutlass::gemm::collective::StageCountAutoCarveout<
+      static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+    KernelSchedule
+  >::CollectiveOp;
+
+using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+    cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+    CollectiveMainloop,
+    CollectiveEpilogue
+>;
+  using namespace test::gemm::device;
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  using ProblemShapeType = typename Gemm::GemmKernel::ProblemShape;
+
+  Testbed3x<Gemm> testbed(CheckEquality::RELATIVE, ScalarLoc::ON_DEVICE, VectorScale::DISABLED);
+  testbed.impl_.scheduler_args.group_order = cutlass::gemm::kernel::detail::GroupOrder::LongestKFirst;
+
+  // More groups than lanes in a warp, with K extents spread over several buckets of K tiles,
+  // partial K tiles and groups of K == 0 that only compute beta * C
+  std::vector<typename ProblemShapeType::UnderlyingProblemShape> problem_sizes_host;
+  int const problem_size_k[] = {2048, 64, 520, 0, 200, 1024, 0, 136};
+  for (int i = 0; i < 40; ++i) {
+    problem_sizes_host.push_back({64 * ((i % 3) + 1) + 8 * (i % 2), 64 * ((i % 4) + 1), problem_size_k[i % 8]});
+  }
+  cutlass::DeviceAllocation<typename ProblemShapeType::UnderlyingProblemShape> problem_sizes_device;
+  problem_sizes_device.reset(problem_sizes_host.size());
+  problem_sizes_device.copy_from_host(problem_sizes_host.data());
+
+  EXPECT_TRUE(testbed.run(
+    ProblemShapeType{static_cast<int>(problem_sizes_host.size()), problem_sizes_device.get(), problem_sizes_host.data()},
+    1.0f, 1.0f));
+}
+
 TEST(SM100Only_Device_Gemm_f16t_f16n_f16n_tensor_op_1sm_f32_group, 128x64x64_1x2x1) {
 // A matrix configuration
 using         ElementA    = cutlass::half_t;                                // Element type for A matrix operand
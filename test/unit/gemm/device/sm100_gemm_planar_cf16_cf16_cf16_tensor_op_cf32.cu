@@ -160,4 +160,67 @@ TEST(SM100_Device_Gemm_Planar_cf16n_cf16t_f32t_tensorop_1sm, 512x512x64_4x4x1) {
   EXPECT_TRUE(test::gemm::device::TestPlanarComplexSmall<Gemm>());
 }
 
+// Relaunches split-K and stream-K GEMMs, which reduce the real and imaginary accumulators separately,
+// on one workspace with barrier_workspace_initialized set
+TEST(SM100_Device_Gemm_Planar_cf16n_cf16t_f32t_tensorop_1sm, 64x64x64_1x1x1_stream_k_workspace_reuse) {
+  using ElementA = cutlass::half_t;
+  using TransformA = cute::identity;
+  using ElementPairA = cute::tuple<ElementA, TransformA>;
+  using LayoutA = cutlass::layout::ColumnMajor;
+
+  using ElementB = cutlass::half_t;
+  using TransformB = cute::identity;
+  using ElementPairB = cute::tuple<ElementB, TransformB>;
+  using LayoutB = cutlass::layout::RowMajor;
+
+  using ElementAccumulator = float;
+  using LayoutC = cutlass::layout::RowMajor;
+
+  using MmaTileShape = cute::Shape<_64,_64,_64>;
+  using ClusterShape = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      MmaTileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::half_t, LayoutC, 8,
+      cutlass::half_t, LayoutC, 8,
+      cutlass::epilogue::PlanarComplexTmaWarpSpecialized1Sm
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      ElementPairA, LayoutA, 8,
+      ElementPairB, LayoutB, 8,
+      ElementAccumulator,
+      MmaTileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<
+        static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecialized1SmPlanarComplexSm100
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  using Testbed = test::gemm::device::Testbed3xPlanarComplex<Gemm>;
+  using DecompositionMode = typename Testbed::DecompositionMode;
+  using RasterOrderOptions = typename Testbed::RasterOrderOptions;
+
+  Testbed testbed;
+  testbed.workspace_reuse_launches = 4;
+
+  // 25 output tiles, leaving a partial wave on 16 SMs
+  Shape<int,int,int,int> problem_size{320, 320, 512, 1};
+  EXPECT_TRUE(testbed.run(problem_size, 1.0f, 1.0f, RasterOrderOptions::Heuristic,
+    test::gemm::device::detail::MaxSwizzleSize(1), test::gemm::device::detail::Splits(3), DecompositionMode::SplitK));
+  EXPECT_TRUE(testbed.run(problem_size, 1.0f, 1.0f, RasterOrderOptions::Heuristic,
+    test::gemm::device::detail::MaxSwizzleSize(1), test::gemm::device::detail::Splits(1), DecompositionMode::StreamK));
+}
+
 #endif // #if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
@@ -0,0 +1,255 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM100 CpAsync mainloop that gathers the rows of A through an index buffer
+
+    D is checked against a host GEMM on the gathered rows of the source A. The index buffer
+    repeats and skips source rows, and the source has more rows than the logical M.
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../../common/cutlass_unit_test.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class MmaTileShape_MNK, int AlignmentA, class EpilogueSchedule>
+struct GatherAGemm {
+  using ElementA = cutlass::half_t;
+  using ElementB = cutlass::half_t;
+  using ElementD = cutlass::half_t;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      MmaTileShape_MNK, Shape<_1,_1,_1>,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementD, cutlass::layout::RowMajor, 8,
+      ElementD, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      ElementA, cutlass::layout::RowMajor, AlignmentA,
+      ElementB, cutlass::layout::ColumnMajor, 8,
+      float,
+      MmaTileShape_MNK, Shape<_1,_1,_1>,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelWarpSpecialized1SmGatherASm100
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// D(m,n,l) = alpha * sum_k A_src(gather[m],k,l) * B(n,k,l) + beta * C(m,n,l)
+template <class GemmType>
+bool
+test_gather_a(int M, int N, int K, int L, int source_rows, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename GemmType::ElementA;
+  using ElementB = typename GemmType::ElementB;
+  using ElementD = typename GemmType::ElementD;
+
+  std::mt19937 gen(2026 + M + N + K + L);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::uniform_int_distribution<int> row_dist(0, source_rows - 1);
+
+  // Packed K-major source with its own row count, the logical A is (M,K,L)
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {source_rows, K, L});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {N, K, L});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {M, N, L});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {M, N, L});
+
+  std::vector<ElementA> host_A(size_t(source_rows) * K * L);
+  std::vector<ElementB> host_B(size_t(N) * K * L);
+  std::vector<ElementD> host_C(size_t(M) * N * L);
+  std::vector<ElementD> host_D(size_t(M) * N * L, ElementD(0));
+  for (auto& x : host_A) { x = ElementA(float(dist(gen))); }
+  for (auto& x : host_B) { x = ElementB(float(dist(gen))); }
+  for (auto& x : host_C) { x = ElementD(float(dist(gen))); }
+
+  // Reversed rows with every 7th row drawn at random, so rows are skipped and repeated
+  std::vector<int32_t> host_gather(M);
+  for (int m = 0; m < M; ++m) {
+    host_gather[m] = (m % 7 == 0) ? row_dist(gen) : (source_rows - 1 - m % source_rows);
+  }
+
+  cutlass::DeviceAllocation<ElementA> block_A(host_A.size());
+  cutlass::DeviceAllocation<ElementB> block_B(host_B.size());
+  cutlass::DeviceAllocation<ElementD> block_C(host_C.size());
+  cutlass::DeviceAllocation<ElementD> block_D(host_D.size());
+  cutlass::DeviceAllocation<int32_t> block_gather(host_gather.size());
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+  block_D.copy_from_host(host_D.data());
+  block_gather.copy_from_host(host_gather.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename GemmKernel::MainloopArguments mainloop_args{};
+  mainloop_args.ptr_A = block_A.get();
+  mainloop_args.dA = stride_A;
+  mainloop_args.ptr_B = block_B.get();
+  mainloop_args.dB = stride_B;
+  mainloop_args.ptr_gather_A = block_gather.get();
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    mainloop_args,
+    {{alpha, beta}, block_C.get(), stride_C, block_D.get(), stride_D},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << "x" << L << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+  block_D.copy_to_host(host_D.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      int64_t row_A = host_gather[m] * int64_t(get<0>(stride_A)) + l * int64_t(get<2>(stride_A));
+      for (int n = 0; n < N; ++n) {
+        int64_t row_B = n * int64_t(get<0>(stride_B)) + l * int64_t(get<2>(stride_B));
+        float acc = 0;
+        for (int k = 0; k < K; ++k) {
+          acc += float(host_A[row_A + k]) * float(host_B[row_B + k]);
+        }
+        int64_t idx_C = m * int64_t(get<0>(stride_C)) + n + l * int64_t(get<2>(stride_C));
+        // Small integers keep the GEMM exact, only the f16 output rounds
+        float expected = float(ElementD(alpha * acc + beta * float(host_C[idx_C])));
+        float actual = float(host_D[idx_C]);
+        if (actual != expected) {
+          std::cerr << "Mismatch at (" << m << "," << n << "," << l << "), source row " << host_gather[m]
+                    << ": " << actual << " != " << expected << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_gather_a_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 136}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          for (int source_rows : {m / 2 + 1, m + 37}) {
+            if (!test_gather_a<GemmType>(m, n, k, l, source_rows, 1.0f, 0.0f) ||
+                !test_gather_a<GemmType>(m, n, k, l, source_rows, 0.5f, 1.0f)) {
+              std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l
+                        << " and " << source_rows << " source rows" << std::endl;
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_gather_a, 128x128x64_1x1x1_1sm_align8) {
+  using GemmType = test::gemm::device::GatherAGemm<
+    Shape<_128,_128,_64>, 8, cutlass::epilogue::NoSmemWarpSpecialized1Sm>;
+  EXPECT_TRUE(test::gemm::device::test_gather_a_all<GemmType>());
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_gather_a, 64x128x64_1x1x1_1sm_align8) {
+  using GemmType = test::gemm::device::GatherAGemm<
+    Shape<_64,_128,_64>, 8, cutlass::epilogue::NoSmemWarpSpecialized1Sm>;
+  EXPECT_TRUE(test::gemm::device::test_gather_a_all<GemmType>());
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_gather_a, 128x128x64_1x1x1_1sm_align4) {
+  using GemmType = test::gemm::device::GatherAGemm<
+    Shape<_128,_128,_64>, 4, cutlass::epilogue::NoSmemWarpSpecialized1Sm>;
+  EXPECT_TRUE(test::gemm::device::test_gather_a_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
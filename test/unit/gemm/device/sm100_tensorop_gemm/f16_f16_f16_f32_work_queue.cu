@@ -0,0 +1,536 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM100 work-queue persistent tile scheduler
+
+    Checks that clusters claim every queued cluster tile exactly once and terminate at the end of
+    the queue: D is compared against a host GEMM for the default order, a host-built reversed
+    queue, a queue sorted on device by populate_work_queue() and a partial queue whose missing
+    tiles must stay untouched. The grid is also shrunk to a few clusters so most tiles are
+    claimed through the atomic counter, whose final value must equal the number of handed out
+    entries since each cluster makes one claim past the end of the queue. Rank-k updates
+    (C = A * A^T) run from a queue of the triangle tiles written by populate_triangular_work_queue(),
+    and the tiles of the opposite triangle must stay untouched.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+
+#include "cutlass/epilogue/dispatch_policy.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../../common/cutlass_unit_test.h"
+
+using namespace cute;
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class MmaTileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct WorkQueueGemm {
+  using Element = cutlass::half_t;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      MmaTileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm100, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::ColumnMajor, 8,
+      float,
+      MmaTileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::WorkQueueScheduler
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+enum class QueueKind {
+  Default,   // no queue, M-major order
+  Reversed,  // every cluster tile, last tile first
+  Sorted,    // populate_work_queue() with TileCost
+  Partial    // every other cluster tile, the others are not computed
+};
+
+/// Uneven cost spread over several log2 buckets
+struct TileCost {
+  CUTLASS_HOST_DEVICE uint32_t
+  operator()(int m, int n, int l) const {
+    return uint32_t((m * 7 + n * 3 + l * 11) % 29) * 37u + 1u;
+  }
+};
+
+inline int
+cost_bucket(uint32_t cost) {
+  int bucket = 0;
+  while (cost != 0) {
+    ++bucket;
+    cost >>= 1;
+  }
+  return bucket;
+}
+
+template <class GemmType>
+bool
+test_work_queue(int M, int N, int K, int L, QueueKind kind, int max_clusters) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+  using TileScheduler = typename GemmKernel::TileScheduler;
+  using WorkQueueEntry = cutlass::gemm::kernel::detail::WorkQueueEntry;
+  using ClusterShape = typename GemmKernel::ClusterShape;
+  using CtaShape = typename GemmKernel::CtaShape_MNK;
+
+  std::mt19937 gen(2026 + M + N + K + L);
+  std::uniform_int_distribution<int> dist(-2, 2);
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {M, K, L});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {N, K, L});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {M, N, L});
+
+  std::vector<Element> host_A(size_t(M) * K * L);
+  std::vector<Element> host_B(size_t(N) * K * L);
+  for (auto& x : host_A) { x = Element(float(dist(gen))); }
+  for (auto& x : host_B) { x = Element(float(dist(gen))); }
+  // Tiles missing from a partial queue keep the sentinel
+  Element const sentinel = Element(-1000.f);
+  std::vector<Element> host_D(size_t(M) * N * L, sentinel);
+
+  cutlass::DeviceAllocation<Element> block_A(host_A.size());
+  cutlass::DeviceAllocation<Element> block_B(host_B.size());
+  cutlass::DeviceAllocation<Element> block_C(host_D.size());
+  cutlass::DeviceAllocation<Element> block_D(host_D.size());
+  cudaMemset(block_C.get(), 0, host_D.size() * sizeof(Element));
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_D.copy_from_host(host_D.data());
+
+  dim3 queue_shape = TileScheduler::get_work_queue_shape(
+    make_shape(M, N, K, L), typename GemmKernel::TileShape{}, typename GemmKernel::AtomThrShapeMNK{}, ClusterShape{});
+  int const cluster_tile_m = size<0>(CtaShape{}) * size<0>(ClusterShape{});
+  int const cluster_tile_n = size<1>(CtaShape{}) * size<1>(ClusterShape{});
+  uint32_t const num_tiles = queue_shape.x * queue_shape.y * queue_shape.z;
+
+  // Whether cluster tile (m, n, l) is handed out
+  std::vector<bool> queued(num_tiles, kind != QueueKind::Partial);
+  auto tile_index = [&](int m, int n, int l) { return (uint32_t(l) * queue_shape.y + n) * queue_shape.x + m; };
+
+  std::vector<WorkQueueEntry> host_queue;
+  if (kind == QueueKind::Reversed || kind == QueueKind::Partial) {
+    for (int i = int(num_tiles) - 1; i >= 0; --i) {
+      int m = i % queue_shape.x;
+      int n = (i / queue_shape.x) % queue_shape.y;
+      int l = i / (queue_shape.x * queue_shape.y);
+      if (kind == QueueKind::Partial && (m + n + l) % 2 == 1) {
+        continue;
+      }
+      host_queue.push_back(WorkQueueEntry{m, n, l, 1});
+      queued[tile_index(m, n, l)] = true;
+    }
+  }
+  else if (kind == QueueKind::Sorted) {
+    host_queue.resize(num_tiles);
+  }
+  cutlass::DeviceAllocation<WorkQueueEntry> block_queue(std::max<size_t>(host_queue.size(), 1));
+  if (kind == QueueKind::Reversed || kind == QueueKind::Partial) {
+    block_queue.copy_from_host(host_queue.data());
+  }
+  else if (kind == QueueKind::Sorted) {
+    if (cutlass::gemm::kernel::detail::populate_work_queue(block_queue.get(), queue_shape, TileCost{}) != cutlass::Status::kSuccess ||
+        cudaDeviceSynchronize() != cudaSuccess) {
+      std::cerr << "populate_work_queue failed" << std::endl;
+      return false;
+    }
+    block_queue.copy_to_host(host_queue.data());
+
+    // A permutation of the tiles with non-increasing cost buckets
+    std::vector<bool> seen(num_tiles, false);
+    for (uint32_t i = 0; i < num_tiles; ++i) {
+      WorkQueueEntry const& entry = host_queue[i];
+      uint32_t t = tile_index(entry.M_idx, entry.N_idx, entry.L_idx);
+      if (seen[t] || entry.cost != TileCost{}(entry.M_idx, entry.N_idx, entry.L_idx) ||
+          (i > 0 && cost_bucket(entry.cost) > cost_bucket(host_queue[i - 1].cost))) {
+        std::cerr << "Work queue entry " << i << " (" << entry.M_idx << "," << entry.N_idx << ","
+                  << entry.L_idx << ") with cost " << entry.cost << " is out of order or repeated" << std::endl;
+        return false;
+      }
+      seen[t] = true;
+    }
+  }
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+  if (max_clusters > 0) {
+    hw_info.sm_count = std::min(hw_info.sm_count, max_clusters * int(size(ClusterShape{})));
+  }
+
+  typename GemmKernel::TileSchedulerArguments scheduler_args{};
+  if (kind != QueueKind::Default) {
+    scheduler_args.work_queue = block_queue.get();
+  }
+  if (kind == QueueKind::Partial) {
+    scheduler_args.num_work_queue_entries = uint32_t(host_queue.size());
+  }
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    {block_A.get(), stride_A, block_B.get(), stride_B},
+    {{1.0f, 0.0f}, block_C.get(), stride_D, block_D.get(), stride_D},
+    hw_info,
+    scheduler_args
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << "x" << L << std::endl;
+    return false;
+  }
+  // The epilogue needs no workspace, so the tile counter of the scheduler is its first word
+  if (GemmKernel::CollectiveEpilogue::get_workspace_size(arguments.problem_shape, arguments.epilogue) != 0) {
+    std::cerr << "Unexpected epilogue workspace" << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  // Runs twice to check that the counter is reset by initialize()
+  for (int run = 0; run < 2; ++run) {
+    if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+        gemm.run() != cutlass::Status::kSuccess) {
+      std::cerr << "GEMM failed to launch" << std::endl;
+      return false;
+    }
+    cudaError_t result = cudaDeviceSynchronize();
+    if (result != cudaSuccess) {
+      std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+      return false;
+    }
+    uint32_t counter = 0;
+    cutlass::device_memory::copy_to_host(&counter, reinterpret_cast<uint32_t const*>(workspace.get()), 1);
+    uint32_t handed_out = kind == QueueKind::Partial ? uint32_t(host_queue.size()) : num_tiles;
+    if (counter != handed_out) {
+      std::cerr << "Tile counter is " << counter << " after run " << run << ", expected " << handed_out << std::endl;
+      return false;
+    }
+  }
+  block_D.copy_to_host(host_D.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float expected = float(sentinel);
+        if (queued[tile_index(m / cluster_tile_m, n / cluster_tile_n, l)]) {
+          float acc = 0;
+          for (int k = 0; k < K; ++k) {
+            acc += float(host_A[(size_t(l) * M + m) * K + k]) * float(host_B[(size_t(l) * N + n) * K + k]);
+          }
+          // Small integers keep the GEMM exact in f16
+          expected = float(Element(acc));
+        }
+        float actual = float(host_D[(size_t(l) * M + m) * N + n]);
+        if (actual != expected) {
+          std::cerr << "Mismatch at (" << m << "," << n << "," << l << "): " << actual << " != " << expected << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_work_queue_all() {
+  for (auto kind : {QueueKind::Default, QueueKind::Reversed, QueueKind::Sorted, QueueKind::Partial}) {
+    for (int max_clusters : {0, 3}) {
+      for (auto [m, n, k, l] : {std::make_tuple(128, 128, 64, 1), std::make_tuple(520, 392, 136, 2),
+                                std::make_tuple(1024, 768, 64, 3)}) {
+        if (!test_work_queue<GemmType>(m, n, k, l, kind, max_clusters)) {
+          std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << ", queue kind "
+                    << int(kind) << " and " << max_clusters << " clusters" << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/// Rank-k update D = A * A^T of M x M x K with L batches, whose queue holds only the cluster tiles
+/// that intersect the Fill triangle, written on device by populate_triangular_work_queue()
+template <class GemmType, cutlass::FillMode Fill>
+bool
+test_triangular_work_queue(int M, int K, int L, int max_clusters) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+  using TileScheduler = typename GemmKernel::TileScheduler;
+  using WorkQueueEntry = cutlass::gemm::kernel::detail::WorkQueueEntry;
+  using ClusterShape = typename GemmKernel::ClusterShape;
+  using CtaShape = typename GemmKernel::CtaShape_MNK;
+
+  std::mt19937 gen(2026 + M + K + L);
+  std::uniform_int_distribution<int> dist(-2, 2);
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {M, K, L});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {M, K, L});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {M, M, L});
+
+  std::vector<Element> host_A(size_t(M) * K * L);
+  for (auto& x : host_A) { x = Element(float(dist(gen))); }
+  // Tiles of the opposite triangle keep the sentinel
+  Element const sentinel = Element(-1000.f);
+  std::vector<Element> host_D(size_t(M) * M * L, sentinel);
+
+  cutlass::DeviceAllocation<Element> block_A(host_A.size());
+  cutlass::DeviceAllocation<Element> block_C(host_D.size());
+  cutlass::DeviceAllocation<Element> block_D(host_D.size());
+  cudaMemset(block_C.get(), 0, host_D.size() * sizeof(Element));
+  block_A.copy_from_host(host_A.data());
+  block_D.copy_from_host(host_D.data());
+
+  dim3 queue_shape = TileScheduler::get_work_queue_shape(
+    make_shape(M, M, K, L), typename GemmKernel::TileShape{}, typename GemmKernel::AtomThrShapeMNK{}, ClusterShape{});
+  int const cluster_tile_m = size<0>(CtaShape{}) * size<0>(ClusterShape{});
+  int const cluster_tile_n = size<1>(CtaShape{}) * size<1>(ClusterShape{});
+
+  // Whether a cluster tile holds an element (m, n) of the triangle, i.e. m >= n for kLower
+  auto in_triangle = [&](int tile_m, int tile_n) {
+    int last_row = (tile_m + 1) * cluster_tile_m - 1, first_row = tile_m * cluster_tile_m;
+    int last_col = (tile_n + 1) * cluster_tile_n - 1, first_col = tile_n * cluster_tile_n;
+    return Fill == cutlass::FillMode::kLower ? last_row >= first_col : first_row <= last_col;
+  };
+  uint32_t expected_entries = 0;
+  for (uint32_t n = 0; n < queue_shape.y; ++n) {
+    for (uint32_t m = 0; m < queue_shape.x; ++m) {
+      expected_entries += in_triangle(int(m), int(n)) ? queue_shape.z : 0;
+    }
+  }
+  uint32_t const num_entries = cutlass::gemm::kernel::detail::get_triangular_work_queue_size(
+    queue_shape, cluster_tile_m, cluster_tile_n, Fill);
+  if (num_entries != expected_entries) {
+    std::cerr << "Triangular work queue size is " << num_entries << ", expected " << expected_entries << std::endl;
+    return false;
+  }
+
+  cutlass::DeviceAllocation<WorkQueueEntry> block_queue(num_entries);
+  if (cutlass::gemm::kernel::detail::populate_triangular_work_queue(
+        block_queue.get(), queue_shape, cluster_tile_m, cluster_tile_n, Fill) != cutlass::Status::kSuccess ||
+      cudaDeviceSynchronize() != cudaSuccess) {
+    std::cerr << "populate_triangular_work_queue failed" << std::endl;
+    return false;
+  }
+
+  // Each triangle tile once, batch by batch
+  std::vector<WorkQueueEntry> host_queue(num_entries);
+  block_queue.copy_to_host(host_queue.data());
+  std::vector<bool> seen(size_t(queue_shape.x) * queue_shape.y * queue_shape.z, false);
+  for (uint32_t i = 0; i < num_entries; ++i) {
+    WorkQueueEntry const& entry = host_queue[i];
+    size_t t = (size_t(entry.L_idx) * queue_shape.y + entry.N_idx) * queue_shape.x + entry.M_idx;
+    if (entry.M_idx < 0 || entry.M_idx >= int(queue_shape.x) || entry.N_idx < 0 || entry.N_idx >= int(queue_shape.y) ||
+        entry.L_idx < 0 || entry.L_idx >= int(queue_shape.z) || seen[t] || !in_triangle(entry.M_idx, entry.N_idx) ||
+        (i > 0 && entry.L_idx < host_queue[i - 1].L_idx)) {
+      std::cerr << "Triangular work queue entry " << i << " (" << entry.M_idx << "," << entry.N_idx << ","
+                << entry.L_idx << ") is out of range, out of order or repeated" << std::endl;
+      return false;
+    }
+    seen[t] = true;
+  }
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+  if (max_clusters > 0) {
+    hw_info.sm_count = std::min(hw_info.sm_count, max_clusters * int(size(ClusterShape{})));
+  }
+
+  typename GemmKernel::TileSchedulerArguments scheduler_args{};
+  scheduler_args.work_queue = block_queue.get();
+  scheduler_args.num_work_queue_entries = num_entries;
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, M, K, L},
+    {block_A.get(), stride_A, block_A.get(), stride_B},
+    {{1.0f, 0.0f}, block_C.get(), stride_D, block_D.get(), stride_D},
+    hw_info,
+    scheduler_args
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << M << "x" << K << "x" << L << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+  block_D.copy_to_host(host_D.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < M; ++n) {
+        float expected = float(sentinel);
+        if (in_triangle(m / cluster_tile_m, n / cluster_tile_n)) {
+          float acc = 0;
+          for (int k = 0; k < K; ++k) {
+            acc += float(host_A[(size_t(l) * M + m) * K + k]) * float(host_A[(size_t(l) * M + n) * K + k]);
+          }
+          // Small integers keep the GEMM exact in f16
+          expected = float(Element(acc));
+        }
+        float actual = float(host_D[(size_t(l) * M + m) * M + n]);
+        if (actual != expected) {
+          std::cerr << "Mismatch at (" << m << "," << n << "," << l << "): " << actual << " != " << expected << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType, cutlass::FillMode Fill>
+bool
+test_triangular_work_queue_all() {
+  for (int max_clusters : {0, 3}) {
+    for (auto [m, k, l] : {std::make_tuple(128, 64, 1), std::make_tuple(520, 136, 2), std::make_tuple(1024, 64, 3)}) {
+      if (!test_triangular_work_queue<GemmType, Fill>(m, k, l, max_clusters)) {
+        std::cerr << "Failed with problem size " << m << "x" << m << "x" << k << "x" << l
+                  << " and " << max_clusters << " clusters" << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_work_queue, 128x128x64_1x1x1_1sm) {
+  using GemmType = test::gemm::device::WorkQueueGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized1SmSm100, cutlass::epilogue::TmaWarpSpecialized1Sm>;
+  EXPECT_TRUE(test::gemm::device::test_work_queue_all<GemmType>());
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_work_queue, 128x128x64_2x2x1_1sm) {
+  using GemmType = test::gemm::device::WorkQueueGemm<
+    Shape<_128,_128,_64>, Shape<_2,_2,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized1SmSm100, cutlass::epilogue::TmaWarpSpecialized1Sm>;
+  EXPECT_TRUE(test::gemm::device::test_work_queue_all<GemmType>());
+}
+
+TEST(SM100Only_Device_Gemm_f16t_f16n_f16t_tensor_op_f32_work_queue, 256x128x64_2x1x1_2sm) {
+  using GemmType = test::gemm::device::WorkQueueGemm<
+    Shape<_256,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized2SmSm100, cutlass::epilogue::TmaWarpSpecialized2Sm>;
+  EXPECT_TRUE(test::gemm::device::test_work_queue_all<GemmType>());
+}
+
+TEST(SM100Only_Device_Syrk_f16t_f16t_tensor_op_f32_work_queue, 128x128x64_1x1x1_1sm_lower) {
+  using GemmType = test::gemm::device::WorkQueueGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized1SmSm100, cutlass::epilogue::TmaWarpSpecialized1Sm>;
+  EXPECT_TRUE((test::gemm::device::test_triangular_work_queue_all<GemmType, cutlass::FillMode::kLower>()));
+}
+
+TEST(SM100Only_Device_Syrk_f16t_f16t_tensor_op_f32_work_queue, 128x128x64_1x1x1_1sm_upper) {
+  using GemmType = test::gemm::device::WorkQueueGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized1SmSm100, cutlass::epilogue::TmaWarpSpecialized1Sm>;
+  EXPECT_TRUE((test::gemm::device::test_triangular_work_queue_all<GemmType, cutlass::FillMode::kUpper>()));
+}
+
+// Cluster tiles of 256x128 straddle the diagonal over two tile columns
+TEST(SM100Only_Device_Syrk_f16t_f16t_tensor_op_f32_work_queue, 256x128x64_2x1x1_2sm_lower) {
+  using GemmType = test::gemm::device::WorkQueueGemm<
+    Shape<_256,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized2SmSm100, cutlass::epilogue::TmaWarpSpecialized2Sm>;
+  EXPECT_TRUE((test::gemm::device::test_triangular_work_queue_all<GemmType, cutlass::FillMode::kLower>()));
+}
+
+TEST(SM100Only_Device_Syrk_f16t_f16t_tensor_op_f32_work_queue, 256x128x64_2x1x1_2sm_upper) {
+  using GemmType = test::gemm::device::WorkQueueGemm<
+    Shape<_256,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecialized2SmSm100, cutlass::epilogue::TmaWarpSpecialized2Sm>;
+  EXPECT_TRUE((test::gemm::device::test_triangular_work_queue_all<GemmType, cutlass::FillMode::kUpper>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
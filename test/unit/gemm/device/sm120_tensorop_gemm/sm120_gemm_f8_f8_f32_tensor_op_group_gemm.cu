@@ -355,4 +355,54 @@ TEST(SM120_Device_Gemm_e4m3t_e4m3n_bf16t_tensorop_f32_group_cooperative, 128x128
   EXPECT_TRUE(test::gemm::device::TestSmall<Gemm>(1.0, 0.5));
 }
 
+// Cooperative + grouped stream-K: groups in the last partial wave split their K mode across CTAs
+TEST(SM120_Device_Gemm_e4m3t_e4m3n_f32t_tensorop_f32_group_cooperative, 128x128x128_1x1x1_group_stream_k) {
+  using ElementA           = cutlass::float_e4m3_t;
+  using ElementB           = cutlass::float_e4m3_t;
+  using ElementC           = float;
+  using ElementD           = float;
+  using ElementAccumulator = float;
+  using ElementCompute     = float;
+  using LayoutA            = cutlass::layout::RowMajor;
+  using LayoutB            = cutlass::layout::ColumnMajor;
+  using LayoutC            = cutlass::layout::RowMajor;
+
+  constexpr int Alignment  = 128 / cutlass::sizeof_bits<ElementA>::value;
+  constexpr int AlignmentC = 128 / cutlass::sizeof_bits<ElementC>::value;
+
+  using TileShape_MNK    = Shape<_128, _128, _128>;
+  using ClusterShape_MNK = Shape<_1, _1, _1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm120, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAccumulator, ElementCompute,
+      ElementC, LayoutC *, AlignmentC,
+      ElementD, LayoutC *, AlignmentC,
+      cutlass::epilogue::collective::EpilogueScheduleAuto
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm120, cutlass::arch::OpClassTensorOp,
+      ElementA, LayoutA *, Alignment,
+      ElementB, LayoutB *, Alignment,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<
+          static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperativeSm120<2>
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int, int, int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::GroupStreamKScheduler>;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  EXPECT_TRUE(test::gemm::device::TestSmall<Gemm>(1.0, 0.5));
+  EXPECT_TRUE(test::gemm::device::TestSmall<Gemm>(1.0, 0.0));
+}
+
 #endif // CUTLASS_ARCH_MMA_SM120_SUPPORTED
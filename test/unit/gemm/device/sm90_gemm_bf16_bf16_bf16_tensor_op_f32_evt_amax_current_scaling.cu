@@ -0,0 +1,229 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 amax epilogue and the current scaling quantization pass
+
+    The GEMM writes activation(alpha * acc + beta * C) in bf16 with its amax, which is checked
+    against the host. quantize_current_scaling then converts D to e4m3 with the scale derived
+    on device from that amax, and the quantized tensor and its dequantization factor are
+    checked against D.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+
+#include "cutlass/util/device_current_scaling.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <template <class> class ActivationFn, class TileShape_MNK, class ClusterShape_MNK,
+          class KernelSchedule, class EpilogueSchedule>
+struct CurrentScalingGemm {
+  using ElementD = cutlass::bfloat16_t;
+  using FusionOperation = cutlass::epilogue::fusion::LinCombEltActAmax<ActivationFn, ElementD, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementD, cutlass::layout::RowMajor, 8,
+      ElementD, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor, 8,
+      cutlass::bfloat16_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class GemmType, template <class> class ActivationFn>
+bool
+test_current_scaling(int M, int N, int K, int L, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using ElementD = typename GemmType::ElementD;
+  using ElementQ = cutlass::float_e4m3_t;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  // amax is reduced with atomic max, so it starts from zero
+  cutlass::DeviceAllocation<float> amax(1);
+  cudaMemset(amax.get(), 0, sizeof(float));
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.amax_D_ptr = amax.get();
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+  float host_amax = 0;
+  amax.copy_to_host(&host_amax);
+
+  ActivationFn<float> activation{};
+  double ref_amax = 0;
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float z = activation(float(alpha * testbed.acc(m, n, l) + beta * testbed.c(m, n, l)));
+        ref_amax = std::max(ref_amax, double(std::abs(z)));
+        if (!fusion_close(testbed.d(m, n, l), double(ElementD(z)), 1e-2, 1e-3, "D", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  // The amax is taken before D is rounded to bf16, the device activation may differ in the last bits
+  if (!fusion_close(host_amax, ref_amax, 1e-4, 1e-5, "amax", 0, 0, 0)) {
+    return false;
+  }
+
+  // Second phase, quantize the staged D with the device amax
+  int64_t count = int64_t(M) * N * L;
+  cutlass::DeviceAllocation<ElementQ> quantized(count);
+  cutlass::DeviceAllocation<float> scale_inv(1);
+  cutlass::quantize_current_scaling(quantized.get(), scale_inv.get(), testbed.tensor_D.device.get(), amax.get(), count);
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "Quantization failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+  std::vector<ElementQ> host_quantized(count);
+  float host_scale_inv = 0;
+  quantized.copy_to_host(host_quantized.data());
+  scale_inv.copy_to_host(&host_scale_inv);
+
+  float const q_max = float(cutlass::platform::numeric_limits<ElementQ>::max());
+  double scale = host_amax > 0 ? q_max / host_amax : 1.0;
+  if (!fusion_close(host_scale_inv, 1.0 / scale, 1e-6, 0, "scale_inv", 0, 0, 0)) {
+    return false;
+  }
+  for (int64_t i = 0; i < count; ++i) {
+    double d = double(testbed.tensor_D.host[i]);
+    // One e4m3 rounding step
+    if (!fusion_close(double(host_quantized[i]), d * scale, 0.0625, 1.0 / 512,
+                      "quantized D", int(i / N), int(i % N))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class GemmType, template <class> class ActivationFn>
+bool
+test_current_scaling_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 264}) {
+      for (int k : {64, 520}) {
+        for (int l : {1, 2}) {
+          // A negative alpha makes the amax come from negative values
+          if (!test_current_scaling<GemmType, ActivationFn>(m, n, k, l, 1.0f, 0.0f) ||
+              !test_current_scaling<GemmType, ActivationFn>(m, n, k, l, -0.5f, 2.0f)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_bf16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_Amax_CurrentScaling) {
+  using GemmType = test::gemm::device::CurrentScalingGemm<cutlass::epilogue::thread::Identity,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_current_scaling_all<GemmType, cutlass::epilogue::thread::Identity>()));
+}
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_bf16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_ReLU_Amax_CurrentScaling) {
+  using GemmType = test::gemm::device::CurrentScalingGemm<cutlass::epilogue::thread::ReLu,
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_current_scaling_all<GemmType, cutlass::epilogue::thread::ReLu>()));
+}
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_bf16t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_GELU_Amax_CurrentScaling) {
+  using GemmType = test::gemm::device::CurrentScalingGemm<cutlass::epilogue::thread::GELU,
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_current_scaling_all<GemmType, cutlass::epilogue::thread::GELU>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,219 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 fused cross entropy loss epilogue
+
+    Loss and logsumexp of every row of alpha * acc + beta * C are checked against a double
+    precision host reference, including rows whose target is the ignore index.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct CrossEntropyGemm {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombCrossEntropyCol<cutlass::bfloat16_t, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor, 8,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor, 8,
+      cutlass::bfloat16_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class GemmType>
+bool
+test_cross_entropy(int M, int N, int K, int L, int32_t ignore_index, bool with_lse, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  // (M,L) targets with stride (1,M), every 5th row ignored
+  std::mt19937 gen(2028 + M + N);
+  std::uniform_int_distribution<int32_t> target_dist(0, N - 1);
+  std::vector<int32_t> host_targets(size_t(M) * L);
+  for (size_t i = 0; i < host_targets.size(); ++i) {
+    host_targets[i] = (i % 5 == 3) ? ignore_index : target_dist(gen);
+  }
+  cutlass::DeviceAllocation<int32_t> targets(host_targets.size());
+  targets.copy_from_host(host_targets.data());
+
+  float const sentinel = -1234.5f;
+  std::vector<float> host_loss(size_t(M) * L, sentinel), host_lse(size_t(M) * L, sentinel);
+  cutlass::DeviceAllocation<float> loss(host_loss.size()), lse(host_lse.size());
+  loss.copy_from_host(host_loss.data());
+  lse.copy_from_host(host_lse.data());
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.targets_ptr = targets.get();
+  fusion_args.loss_ptr = loss.get();
+  fusion_args.lse_ptr = with_lse ? lse.get() : nullptr;
+  fusion_args.ignore_index = ignore_index;
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+  loss.copy_to_host(host_loss.data());
+  lse.copy_to_host(host_lse.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      double row_max = -std::numeric_limits<double>::infinity();
+      for (int n = 0; n < N; ++n) {
+        row_max = std::max(row_max, alpha * testbed.acc(m, n, l) + beta * testbed.c(m, n, l));
+      }
+      double sum = 0;
+      for (int n = 0; n < N; ++n) {
+        sum += std::exp(alpha * testbed.acc(m, n, l) + beta * testbed.c(m, n, l) - row_max);
+      }
+      double ref_lse = row_max + std::log(sum);
+
+      int32_t t = host_targets[m + size_t(M) * l];
+      double ref_loss = t == ignore_index ? 0.0 : ref_lse - (alpha * testbed.acc(m, t, l) + beta * testbed.c(m, t, l));
+      if (!fusion_close(host_loss[m + size_t(M) * l], ref_loss, 1e-5, 1e-4, "loss", m, t, l)) {
+        return false;
+      }
+      if (with_lse && t != ignore_index &&
+          !fusion_close(host_lse[m + size_t(M) * l], ref_lse, 1e-5, 1e-4, "lse", m, 0, l)) {
+        return false;
+      }
+      if (!with_lse && host_lse[m + size_t(M) * l] != sentinel) {
+        std::cerr << "lse written without an lse pointer at row " << m << "," << l << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_cross_entropy_all() {
+  for (int m : {128, 200}) {
+    // Several N tiles, with and without a partial last tile
+    for (int n : {128, 520, 1024}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          if (!test_cross_entropy<GemmType>(m, n, k, l, -100, true, 1.0f, 0.0f) ||
+              !test_cross_entropy<GemmType>(m, n, k, l, -1, true, 0.25f, 1.0f) ||
+              !test_cross_entropy<GemmType>(m, n, k, l, -100, false, 0.5f, 0.5f)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_bf16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_CrossEntropy) {
+  using GemmType = test::gemm::device::CrossEntropyGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_cross_entropy_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_bf16t_tensor_op_gmma_f32_cooperative_epilogue, 128x256x64_1x2x1_CrossEntropy) {
+  using GemmType = test::gemm::device::CrossEntropyGemm<
+    Shape<_128,_256,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_cross_entropy_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_bf16t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_CrossEntropy) {
+  using GemmType = test::gemm::device::CrossEntropyGemm<
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE(test::gemm::device::test_cross_entropy_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
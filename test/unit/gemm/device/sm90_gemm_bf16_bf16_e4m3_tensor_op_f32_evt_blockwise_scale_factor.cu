@@ -0,0 +1,202 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 fp8 output fusion with 1 x SFVecSize blockwise scale generation
+
+    Scales are checked against amax / max(e4m3) of each row block of alpha * acc + beta * C,
+    and D against the block-quantized values.
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape_MNK, class ClusterShape_MNK, class EpilogueTile, int SFVecSize,
+          class KernelSchedule, class EpilogueSchedule>
+struct BlockwiseScaleFactorGemm {
+  using ElementD = cutlass::float_e4m3_t;
+  using ElementC = cutlass::bfloat16_t;
+  using FusionOperation = cutlass::epilogue::fusion::LinCombBlockwiseScaleFactor<
+      SFVecSize, ElementD, float, float, ElementC>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      EpilogueTile,
+      float, float,
+      ElementC, cutlass::layout::RowMajor, 8,
+      ElementD, cutlass::layout::RowMajor, 16,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::bfloat16_t, cutlass::layout::RowMajor, 8,
+      cutlass::bfloat16_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class GemmType, int SFVecSize>
+bool
+test_blockwise_scale_factor(int M, int N, int K, int L, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  int blocks_n = (N + SFVecSize - 1) / SFVecSize;
+  cutlass::DeviceAllocation<float> block_scale(size_t(M) * blocks_n * L);
+  cudaMemset(block_scale.get(), 0, block_scale.bytes());
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.block_scale_ptr = block_scale.get();
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+  std::vector<float> host_scale(block_scale.size());
+  block_scale.copy_to_host(host_scale.data());
+
+  float const fp_max = float(cutlass::platform::numeric_limits<cutlass::float_e4m3_t>::max());
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int b = 0; b < blocks_n; ++b) {
+        int n_begin = b * SFVecSize;
+        int n_end = std::min(N, n_begin + SFVecSize);
+        double amax = 0;
+        for (int n = n_begin; n < n_end; ++n) {
+          amax = std::max(amax, std::abs(alpha * testbed.acc(m, n, l) + beta * testbed.c(m, n, l)));
+        }
+
+        // MN-major scales, batch stride M * ceil(N / SFVecSize)
+        double scale = host_scale[m + size_t(M) * b + size_t(M) * blocks_n * l];
+        if (!fusion_close(scale, amax / fp_max, 1e-5, 0, "block scale", m, n_begin, l)) {
+          return false;
+        }
+
+        for (int n = n_begin; n < n_end; ++n) {
+          double x = alpha * testbed.acc(m, n, l) + beta * testbed.c(m, n, l);
+          double quantized = amax > 0 ? x * fp_max / amax : 0;
+          // One e4m3 rounding step, plus the approximate reciprocal of amax on device
+          if (!fusion_close(testbed.d(m, n, l), quantized, 0.0625, 1.0 / 512, "D", m, n, l)) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType, int SFVecSize>
+bool
+test_blockwise_scale_factor_all() {
+  for (int m : {128, 200}) {
+    for (int n : {256, 320}) {
+      for (int k : {64, 512}) {
+        for (int l : {1, 2}) {
+          if (!test_blockwise_scale_factor<GemmType, SFVecSize>(m, n, k, l, 1.0f, 0.0f) ||
+              !test_blockwise_scale_factor<GemmType, SFVecSize>(m, n, k, l, 0.5f, 2.0f)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_e4m3t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_BlockwiseScaleFactor_1x128) {
+  using GemmType = test::gemm::device::BlockwiseScaleFactorGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>, Shape<_128,_128>, 128,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_blockwise_scale_factor_all<GemmType, 128>()));
+}
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_e4m3t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_BlockwiseScaleFactor_1x64) {
+  using GemmType = test::gemm::device::BlockwiseScaleFactorGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>, Shape<_128,_64>, 64,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_blockwise_scale_factor_all<GemmType, 64>()));
+}
+
+TEST(SM90_Device_Gemm_bf16t_bf16n_e4m3t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_BlockwiseScaleFactor_1x128) {
+  using GemmType = test::gemm::device::BlockwiseScaleFactorGemm<
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>, Shape<_64,_128>, 128,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_blockwise_scale_factor_all<GemmType, 128>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
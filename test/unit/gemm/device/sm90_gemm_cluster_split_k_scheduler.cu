@@ -0,0 +1,272 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests that the cluster split-K scheduler covers the entire problem space.
+*/
+
+#include "cutlass/cluster_launch.hpp"
+#include "cutlass/kernel_hardware_info.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_cluster_split_k.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+// Grids are launched with clusters enabled in these tests,
+// so the CTK version must support cluster launching.
+#if defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
+
+using namespace cute;
+using ProblemShape_MNKL = Shape<int, int, int, int>;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel for getting each piece of work for a given block from the scheduler and logging
+/// the K iterations visited by the block, as well as the output tiles whose epilogue it computes.
+template <
+  class Scheduler
+>
+__global__
+void
+run_scheduler(int* visit_counters, int* epilogue_counters, typename Scheduler::Params params,
+              int tiles_m, int tiles_n, int k_tiles) {
+  Scheduler scheduler{params};
+  auto work_tile_info = scheduler.get_current_work();
+
+  while (work_tile_info.is_valid()) {
+    int tile_idx = (work_tile_info.L_idx * tiles_m + work_tile_info.M_idx) * tiles_n + work_tile_info.N_idx;
+    for (uint32_t i = 0; i < work_tile_info.k_tile_count; ++i) {
+      // Use atomicAdd because the visit counters are shared by the splits of a cluster.
+      atomicAdd(visit_counters + tile_idx * k_tiles + work_tile_info.K_idx + i, 1);
+    }
+    if (Scheduler::compute_epilogue(work_tile_info, params)) {
+      atomicAdd(epilogue_counters + tile_idx, 1);
+    }
+
+    auto [next_work_tile_info, increment_pipe] = scheduler.fetch_next_work(work_tile_info);
+    work_tile_info = next_work_tile_info;
+  }
+}
+
+/// Host-side wrapper for launching the kernel to test the scheduler.
+template <
+  class TileShape,
+  class ClusterShape
+>
+bool
+test_scheduler(
+  ProblemShape_MNKL problem_shape_mnkl,
+  TileShape tile_shape,
+  ClusterShape cluster_shape,
+  int sm_count) {
+
+  using Scheduler = cutlass::gemm::kernel::detail::PersistentTileSchedulerSm90ClusterSplitK<TileShape, ClusterShape>;
+
+  cutlass::KernelHardwareInfo hw_info{0, sm_count};
+  typename Scheduler::Arguments args{};
+  auto params = Scheduler::to_underlying_arguments(problem_shape_mnkl, tile_shape, cluster_shape, hw_info, args);
+
+  dim3 grid = Scheduler::get_grid_shape(params, problem_shape_mnkl, tile_shape, cluster_shape, hw_info, args);
+
+  auto print_info = [&]() {
+    std::cout << "Failed with problem size "
+      << size<0>(problem_shape_mnkl) << "x"
+      << size<1>(problem_shape_mnkl) << "x"
+      << size<2>(problem_shape_mnkl) << "x"
+      << size<3>(problem_shape_mnkl)
+      << " and grid size " << grid.x << "x"
+      << grid.y << "x" << grid.z
+      << " splits=" << Scheduler::Splits
+      << " k_tiles=" << params.k_tiles_per_output_tile_ << std::endl;
+  };
+
+  if (grid.z != static_cast<uint32_t>(Scheduler::Splits)) {
+    print_info();
+    std::cout << "Expected one block per split along the third grid mode." << std::endl;
+    return false;
+  }
+
+  dim3 tiles = Scheduler::get_tiled_cta_shape_mnl(problem_shape_mnkl, tile_shape);
+  int tiles_m = static_cast<int>(tiles.x);
+  int tiles_n = static_cast<int>(tiles.y);
+  int k_tiles = static_cast<int>(params.k_tiles_per_output_tile_);
+  int total_tiles = static_cast<int>(tiles.x * tiles.y * tiles.z);
+  int total_counters = total_tiles * k_tiles;
+
+  cutlass::DeviceAllocation<int> visit_counters(total_counters);
+  cutlass::DeviceAllocation<int> epilogue_counters(total_tiles);
+
+  cudaError_t err = cudaMemset((void*)visit_counters.get(), 0, sizeof(int) * total_counters);
+  if (err == cudaSuccess) {
+    err = cudaMemset((void*)epilogue_counters.get(), 0, sizeof(int) * total_tiles);
+  }
+  if (err != cudaSuccess) {
+    print_info();
+    std::cout << __FILE__ << ":" << __LINE__ << " cudaMemset failed with error: " << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // The scheduler derives the split of a block from its coordinate within the cluster,
+  // so the grid must be launched with clusters.
+  cudaLaunchConfig_t launch_config;
+  launch_config.gridDim = grid;
+  launch_config.blockDim = {1, 1, 1};
+  launch_config.dynamicSmemBytes = 0;
+  launch_config.stream = NULL;
+
+  cudaLaunchAttribute launch_attribute[1];
+  launch_attribute[0].id = cudaLaunchAttributeClusterDimension;
+  launch_attribute[0].val.clusterDim.x = cute::get<0>(ClusterShape{});
+  launch_attribute[0].val.clusterDim.y = cute::get<1>(ClusterShape{});
+  launch_attribute[0].val.clusterDim.z = cute::get<2>(ClusterShape{});
+
+  launch_config.attrs = launch_attribute;
+  launch_config.numAttrs = 1;
+
+  void const* kernel = (void const*) run_scheduler<Scheduler>;
+  int* visit_ptr = visit_counters.get();
+  int* epilogue_ptr = epilogue_counters.get();
+  void* kernel_params[] = {
+    &visit_ptr,
+    &epilogue_ptr,
+    &params,
+    &tiles_m,
+    &tiles_n,
+    &k_tiles
+  };
+
+  err = cudaLaunchKernelExC(&launch_config, kernel, kernel_params);
+  if (err != cudaSuccess) {
+    print_info();
+    std::cout << __FILE__ << ":" << __LINE__
+              << " cudaLaunchKernelExC failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  err = cudaDeviceSynchronize();
+  if (err != cudaSuccess) {
+    print_info();
+    std::cout << __FILE__ << ":" << __LINE__
+              << " scheduler kernel failed with error: "
+              << cudaGetErrorString(err) << std::endl;
+    return false;
+  }
+
+  // Every K tile of every output tile is computed by exactly one split
+  std::vector<int> host_visit_counts(total_counters);
+  visit_counters.copy_to_host(host_visit_counts.data());
+  for (size_t i = 0; i < host_visit_counts.size(); ++i) {
+    if (host_visit_counts[i] != 1) {
+      print_info();
+      std::cout << "Error at K tile idx: " << i << ". Got count " << host_visit_counts[i] << std::endl;
+      return false;
+    }
+  }
+
+  // Every output tile is written by exactly one block, including when some splits are empty
+  std::vector<int> host_epilogue_counts(total_tiles);
+  epilogue_counters.copy_to_host(host_epilogue_counts.data());
+  for (size_t i = 0; i < host_epilogue_counts.size(); ++i) {
+    if (host_epilogue_counts[i] != 1) {
+      print_info();
+      std::cout << "Error at output tile idx: " << i << ". Got epilogue count " << host_epilogue_counts[i] << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// Executes tests of the scheduler over a range of output tile counts, batch counts and problem
+/// sizes K, including fewer K tiles than splits.
+template <
+  class TileShape,
+  class ClusterShape
+>
+bool
+test_cluster_split_k(
+  TileShape tile_shape,
+  ClusterShape cluster_shape,
+  int sm_count) {
+
+  int tile_m = size<0>(tile_shape);
+  int tile_n = size<1>(tile_shape);
+  int tile_k = size<2>(tile_shape);
+
+  for (int m_blocks = 1; m_blocks <= 12; m_blocks += 3) {
+    for (int n_blocks = 1; n_blocks <= 12; n_blocks += 5) {
+      for (int l = 1; l < 3; ++l) {
+        for (int k_blocks = 1; k_blocks <= 3 * size<2>(cluster_shape) + 1; ++k_blocks) {
+          // Also cover a residue in the last K tile
+          for (int k_residue : {0, tile_k / 2}) {
+            int k = k_blocks * tile_k - k_residue;
+            ProblemShape_MNKL problem{m_blocks * tile_m, n_blocks * tile_n, k, l};
+            if (!test_scheduler(problem, tile_shape, cluster_shape, sm_count)) {
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_cluster_split_k_scheduler, 128x128x64_1x1x2) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_2>;
+
+  TileShape_MNK tile_shape;
+  ClusterShape_MNK cluster_shape;
+
+  EXPECT_TRUE(test_cluster_split_k(tile_shape, cluster_shape, /*sm_count=*/ 16));
+  EXPECT_TRUE(test_cluster_split_k(tile_shape, cluster_shape, /*sm_count=*/132));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_cluster_split_k_scheduler, 128x128x64_1x1x4) {
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_4>;
+
+  TileShape_MNK tile_shape;
+  ClusterShape_MNK cluster_shape;
+
+  EXPECT_TRUE(test_cluster_split_k(tile_shape, cluster_shape, /*sm_count=*/ 16));
+  EXPECT_TRUE(test_cluster_split_k(tile_shape, cluster_shape, /*sm_count=*/132));
+}
+
+#endif // defined(CUTLASS_SM90_CLUSTER_LAUNCH_ENABLED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1011,4 +1011,109 @@ TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_stream_k_epi
   EXPECT_TRUE(test::gemm::device::TestAllBiasElementwise<Gemm>(1.0, 1.0));
 }
 
+// Relaunches split-K and stream-K GEMMs on one workspace with barrier_workspace_initialized set,
+// relying on each launch to return the barrier flags to zero
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_stream_k, 128x128x64_1x1x1_workspace_reuse) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, LayoutC, 4,
+      float, LayoutC, 4,
+      cutlass::epilogue::TmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  using Testbed = test::gemm::device::Testbed3x<Gemm>;
+  using DecompositionMode = typename Testbed::DecompositionMode;
+  using RasterOrderOptions = typename Testbed::RasterOrderOptions;
+
+  Testbed testbed(test::gemm::device::CheckEquality::RELATIVE);
+  testbed.impl_.workspace_reuse_launches = 4;
+
+  // 4 output tiles with a long K extent, and 25 output tiles leaving a partial wave on 16 SMs
+  for (auto problem_size : {Shape<int,int,int,int>{256, 256, 4096, 1}, Shape<int,int,int,int>{640, 520, 1024, 1}}) {
+    EXPECT_TRUE(testbed.run(problem_size, 1.0f, 1.0f, RasterOrderOptions::Heuristic,
+      test::gemm::device::detail::MaxSwizzleSize(1), test::gemm::device::detail::Splits(3), DecompositionMode::SplitK));
+    EXPECT_TRUE(testbed.run(problem_size, 1.0f, 1.0f, RasterOrderOptions::Heuristic,
+      test::gemm::device::detail::MaxSwizzleSize(1), test::gemm::device::detail::Splits(1), DecompositionMode::StreamK));
+  }
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_stream_k, 128x128x64_1x1x1_atomic_reduction) {
+  using LayoutA = cutlass::layout::RowMajor;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using LayoutC = cutlass::layout::RowMajor;
+  using TileShape_MNK = Shape<_128,_128,_64>;
+  using ClusterShape_MNK = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, LayoutC, 4,
+      float, LayoutC, 4,
+      cutlass::epilogue::TmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, LayoutA, 8,
+      cutlass::half_t, LayoutB, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::StreamKScheduler
+  >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  using Testbed = test::gemm::device::Testbed3x<Gemm>;
+  using DecompositionMode = typename Testbed::DecompositionMode;
+  using RasterOrderOptions = typename Testbed::RasterOrderOptions;
+
+  Testbed testbed(test::gemm::device::CheckEquality::RELATIVE);
+  // Partial tiles are accumulated into the workspace with atomic adds instead of in turn
+  testbed.impl_.reduction_mode = Testbed::TestBedImpl::ReductionMode::Atomic;
+
+  // 4 output tiles with a long K extent, and 25 output tiles leaving a partial wave on 16 SMs
+  for (auto problem_size : {Shape<int,int,int,int>{256, 256, 4096, 1}, Shape<int,int,int,int>{640, 520, 1024, 1}}) {
+    EXPECT_TRUE(testbed.run(problem_size, 1.0f, 1.0f, RasterOrderOptions::Heuristic,
+      test::gemm::device::detail::MaxSwizzleSize(1), test::gemm::device::detail::Splits(3), DecompositionMode::SplitK));
+    EXPECT_TRUE(testbed.run(problem_size, 1.0f, 1.0f, RasterOrderOptions::Heuristic,
+      test::gemm::device::detail::MaxSwizzleSize(1), test::gemm::device::detail::Splits(1), DecompositionMode::StreamK));
+  }
+}
+
 #endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
@@ -0,0 +1,256 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 Philox dropout epilogue
+
+    D = beta * C + dropout(activation(alpha * acc + bias)) and the emitted keep bit mask are
+    checked against a host reference that regenerates the mask from (seed, offset) with the
+    same Philox4x32 counter mapping, so the test also pins the mask down for a backward pass.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_dropout.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <template <class> class ActivationFn, class TileShape_MNK, class ClusterShape_MNK,
+          class KernelSchedule, class EpilogueSchedule>
+struct DropoutGemm {
+  using ElementD = cutlass::half_t;
+  using FusionOperation = cutlass::epilogue::fusion::PerColResAddPerColBiasEltActDropout<
+      cutlass::layout::RowMajor, ActivationFn, ElementD, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementD, cutlass::layout::RowMajor, 8,
+      ElementD, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Host keep decision for linear index (l * M + m) * N + n, mirrors Sm90Dropout
+inline bool
+dropout_keep(uint64_t idx, float probability, uint64_t seed, uint64_t offset) {
+  uint32_t threshold = static_cast<uint32_t>(std::min(double(probability) * 4294967296.0, 4294967295.0));
+  uint64_t group = idx >> 2;
+  auto random = cutlass::epilogue::fusion::detail::Philox4x32::generate(
+    {static_cast<uint32_t>(group), static_cast<uint32_t>(group >> 32),
+     static_cast<uint32_t>(offset), static_cast<uint32_t>(offset >> 32)}, seed);
+  return random[idx & 3] >= threshold;
+}
+
+template <class GemmType, template <class> class ActivationFn>
+bool
+test_dropout(int M, int N, int K, int L, float probability, bool use_device_state) {
+  using Gemm = typename GemmType::Gemm;
+  using ElementD = typename GemmType::ElementD;
+  using FusionArguments = typename FusionTestbed<Gemm>::FusionArguments;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  float const alpha = 0.5f;
+  float const beta = 1.0f;
+  uint64_t const seed = 0x1234'5678'9abc'def0ull;
+  uint64_t const offset = 0x0000'0003'0000'0010ull;
+  // The device state must be preferred over the fields, which are set to decoys
+  uint64_t const decoy = 77;
+
+  std::vector<cutlass::half_t> bias(N);
+  for (int n = 0; n < N; ++n) {
+    bias[n] = cutlass::half_t(float(n % 7 - 3));
+  }
+  cutlass::DeviceAllocation<cutlass::half_t> device_bias(N);
+  device_bias.copy_from_host(bias.data());
+
+  cutlass::DeviceAllocation<uint64_t> device_seed(1), device_offset(1);
+  device_seed.copy_from_host(&seed);
+  device_offset.copy_from_host(&offset);
+
+  // One bit per element, packed along the linear index
+  int64_t count = int64_t(M) * N * L;
+  size_t mask_bytes = size_t((count + 7) / 8);
+  cutlass::DeviceAllocation<uint8_t> device_mask(mask_bytes);
+  cudaMemset(device_mask.get(), 0, mask_bytes);
+
+  FusionArguments fusion_args;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.bias_ptr = device_bias.get();
+  fusion_args.dropout_probability = probability;
+  if (use_device_state) {
+    fusion_args.seed = decoy;
+    fusion_args.offset = decoy;
+    fusion_args.seed_ptr = device_seed.get();
+    fusion_args.offset_ptr = device_offset.get();
+  }
+  else {
+    fusion_args.seed = seed;
+    fusion_args.offset = offset;
+  }
+  fusion_args.mask_ptr = reinterpret_cast<cutlass::uint1b_t*>(device_mask.get());
+  fusion_args.dMask = {int64_t(N), _1{}, int64_t(M) * N};
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+  std::vector<uint8_t> mask(mask_bytes);
+  device_mask.copy_to_host(mask.data());
+
+  ActivationFn<float> activation{};
+  float const scale = 1.f / (1.f - probability);
+  int64_t kept = 0;
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        uint64_t idx = (uint64_t(l) * M + m) * N + n;
+        bool keep = dropout_keep(idx, probability, seed, offset);
+        bool mask_bit = (mask[idx / 8] >> (idx % 8)) & 1;
+        if (mask_bit != keep) {
+          std::cerr << "Mismatch in mask at (" << m << "," << n << "," << l << "): "
+                    << mask_bit << " != " << keep << std::endl;
+          return false;
+        }
+        kept += keep;
+        float z = activation(float(alpha * testbed.acc(m, n, l) + float(bias[n])));
+        double expected = beta * testbed.c(m, n, l) + (keep ? double(z * scale) : 0.0);
+        if (!fusion_close(testbed.d(m, n, l), double(ElementD(float(expected))), 2e-3, 1e-3, "D", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+
+  // The reference decides every element, this only guards against a degenerate generator
+  double keep_rate = double(kept) / double(count);
+  if (std::abs(keep_rate - (1.0 - probability)) > 0.05) {
+    std::cerr << "Keep rate " << keep_rate << " is far from " << 1.0 - probability << std::endl;
+    return false;
+  }
+  return true;
+}
+
+template <class GemmType, template <class> class ActivationFn>
+bool
+test_dropout_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 384}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          if (!test_dropout<GemmType, ActivationFn>(m, n, k, l, 0.0f, false) ||
+              !test_dropout<GemmType, ActivationFn>(m, n, k, l, 0.5f, false) ||
+              !test_dropout<GemmType, ActivationFn>(m, n, k, l, 0.1f, true)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_Bias_Dropout) {
+  using GemmType = test::gemm::device::DropoutGemm<cutlass::epilogue::thread::Identity,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_dropout_all<GemmType, cutlass::epilogue::thread::Identity>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_Bias_ReLU_Dropout) {
+  using GemmType = test::gemm::device::DropoutGemm<cutlass::epilogue::thread::ReLu,
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_dropout_all<GemmType, cutlass::epilogue::thread::ReLu>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_Bias_ReLU_Dropout) {
+  using GemmType = test::gemm::device::DropoutGemm<cutlass::epilogue::thread::ReLu,
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_dropout_all<GemmType, cutlass::epilogue::thread::ReLu>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,212 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 fused LayerNorm / RMSNorm row normalization epilogue
+
+    Each row of alpha * acc + beta * C is normalized on the host in double precision and
+    compared against D, with and without the per-column gamma and shift vectors.
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <bool IsRMSNorm, class TileShape_MNK, class ClusterShape_MNK, class EpilogueTile,
+          class KernelSchedule, class EpilogueSchedule>
+struct RowNormGemm {
+  using Element = cutlass::half_t;
+  using FusionOperation = cutlass::epilogue::fusion::LinCombRowNorm<IsRMSNorm, Element, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      EpilogueTile,
+      float, float,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class GemmType, bool IsRMSNorm>
+bool
+test_row_norm(int M, int N, int K, int L, bool with_affine, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using Element = typename GemmType::Element;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  std::mt19937 gen(2027 + N);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<Element> host_gamma(N), host_shift(N);
+  for (int n = 0; n < N; ++n) {
+    host_gamma[n] = Element(0.5f * float(dist(gen) + 3));
+    host_shift[n] = Element(0.25f * float(dist(gen)));
+  }
+  cutlass::DeviceAllocation<Element> gamma(N), shift(N);
+  gamma.copy_from_host(host_gamma.data());
+  shift.copy_from_host(host_shift.data());
+
+  float const epsilon = 1e-5f;
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.epsilon = epsilon;
+  fusion_args.gamma_ptr = with_affine ? gamma.get() : nullptr;
+  fusion_args.shift_ptr = with_affine ? shift.get() : nullptr;
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+
+  std::vector<double> row(N);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      double mean = 0;
+      for (int n = 0; n < N; ++n) {
+        row[n] = alpha * testbed.acc(m, n, l) + beta * testbed.c(m, n, l);
+        mean += row[n] / N;
+      }
+      double second_moment = 0;
+      for (int n = 0; n < N; ++n) {
+        double centered = IsRMSNorm ? row[n] : row[n] - mean;
+        second_moment += centered * centered / N;
+      }
+      double rstd = 1.0 / std::sqrt(second_moment + epsilon);
+      for (int n = 0; n < N; ++n) {
+        double y = (IsRMSNorm ? row[n] : row[n] - mean) * rstd;
+        if (with_affine) {
+          y = y * double(host_gamma[n]) + double(host_shift[n]);
+        }
+        if (!fusion_close(testbed.d(m, n, l), y, 2e-3, 2e-3, "D", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType, bool IsRMSNorm, int TileN>
+bool
+test_row_norm_all() {
+  for (int m : {128, 200}) {
+    // Full tile rows and partial rows, the reduction must skip out of bounds columns
+    for (int n : {TileN, TileN - 32, 40}) {
+      for (int k : {64, 520}) {
+        for (int l : {1, 2}) {
+          for (bool with_affine : {false, true}) {
+            if (!test_row_norm<GemmType, IsRMSNorm>(m, n, k, l, with_affine, 1.0f, 0.0f) ||
+                !test_row_norm<GemmType, IsRMSNorm>(m, n, k, l, with_affine, 0.5f, 2.0f)) {
+              std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l
+                        << (with_affine ? " with gamma and shift" : "") << std::endl;
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_LayerNorm) {
+  using GemmType = test::gemm::device::RowNormGemm<false,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>, Shape<_128,_128>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_row_norm_all<GemmType, false, 128>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_RMSNorm) {
+  using GemmType = test::gemm::device::RowNormGemm<true,
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>, Shape<_128,_128>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_row_norm_all<GemmType, true, 128>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_LayerNorm) {
+  using GemmType = test::gemm::device::RowNormGemm<false,
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>, Shape<_64,_128>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_row_norm_all<GemmType, false, 128>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,352 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 grouped store EVT node with a runtime output type per group
+
+    A Grouped GEMM with void C and D writes alpha * acc through Sm90GroupedStore. Groups cycle
+    through every GroupOutputType, the fp8 groups carry a scale, and output rows are padded
+    so the descriptor strides are exercised. Padding and groups of type None must be untouched.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_grouped_store.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape, class ClusterShape, class KernelSchedule, class EpilogueSchedule>
+struct GroupedStoreGemm {
+  using Element = cutlass::half_t;
+  static constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  using CustomEVT =  // D_g = convert<type_g>(scale_g * alpha * acc)
+    cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90GroupedStore<float, RoundStyle>,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::multiplies, float, float, RoundStyle>,
+        cutlass::epilogue::fusion::Sm90ScalarBroadcast<float>, // alpha
+        cutlass::epilogue::fusion::Sm90AccFetch                // acc
+      >
+    >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor *, 8,
+      void, cutlass::layout::RowMajor *, 8,
+      EpilogueSchedule,
+      CustomEVT
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor *, 8,
+      Element, cutlass::layout::ColumnMajor *, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Compares one padded output against convert<Element>(scale * z), padding must keep its bytes
+template <class Element>
+bool
+check_grouped_output(std::vector<uint8_t> const& actual, std::vector<uint8_t> const& initial,
+                     std::vector<double> const& z, int M, int N, int ld, float scale, double rel_tol, int group) {
+  Element const* out = reinterpret_cast<Element const*>(actual.data());
+  Element const* init = reinterpret_cast<Element const*>(initial.data());
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < ld; ++n) {
+      double value = double(out[m * ld + n]);
+      if (n >= N) {
+        if (std::memcmp(&out[m * ld + n], &init[m * ld + n], sizeof(Element)) != 0) {
+          std::cerr << "Padding of group " << group << " overwritten at (" << m << "," << n << ")" << std::endl;
+          return false;
+        }
+        continue;
+      }
+      float v = scale * float(z[size_t(m) * N + n]);
+      if (!fusion_close(value, double(Element(v)), rel_tol, 0, "grouped output", m, n, group)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_grouped_store(std::vector<int> const& group_m, std::vector<int> const& group_n, std::vector<int> const& group_k) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using InternalStrideA = typename GemmKernel::InternalStrideA;
+  using InternalStrideB = typename GemmKernel::InternalStrideB;
+  using OutputType = cutlass::epilogue::fusion::GroupOutputType;
+
+  int groups = int(group_m.size());
+  std::mt19937 gen(2026 + groups);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  float const alpha = 0.5f;
+  OutputType const types[] = {OutputType::F32, OutputType::F16, OutputType::BF16,
+                              OutputType::E4M3, OutputType::E5M2, OutputType::None};
+  auto element_bytes = [](OutputType type) {
+    return type == OutputType::F32 ? 4 : (type == OutputType::E4M3 || type == OutputType::E5M2) ? 1 : 2;
+  };
+
+  std::vector<typename ProblemShape::UnderlyingProblemShape> problem_sizes;
+  std::vector<std::vector<Element>> host_A(groups), host_B(groups);
+  std::vector<cutlass::DeviceAllocation<Element>> block_A(groups), block_B(groups);
+  std::vector<Element const*> ptr_A(groups), ptr_B(groups);
+  std::vector<InternalStrideA> stride_A(groups);
+  std::vector<InternalStrideB> stride_B(groups);
+  std::vector<std::vector<uint8_t>> host_out(groups), initial_out(groups);
+  std::vector<cutlass::DeviceAllocation<uint8_t>> block_out(groups);
+  std::vector<float> scales(groups);
+  std::vector<int> ld_out(groups);
+  for (int g = 0; g < groups; ++g) {
+    int M = group_m[g], N = group_n[g], K = group_k[g];
+    problem_sizes.push_back({M, N, K});
+    host_A[g].resize(size_t(M) * K);
+    host_B[g].resize(size_t(N) * K);
+    for (auto& x : host_A[g]) { x = Element(float(dist(gen))); }
+    for (auto& x : host_B[g]) { x = Element(float(dist(gen))); }
+    block_A[g].reset(host_A[g].size());
+    block_B[g].reset(host_B[g].size());
+    block_A[g].copy_from_host(host_A[g].data());
+    block_B[g].copy_from_host(host_B[g].data());
+    ptr_A[g] = block_A[g].get();
+    ptr_B[g] = block_B[g].get();
+    stride_A[g] = cutlass::make_cute_packed_stride(InternalStrideA{}, {M, K, 1});
+    stride_B[g] = cutlass::make_cute_packed_stride(InternalStrideB{}, {N, K, 1});
+
+    // Bytes of a non-zero pattern so untouched outputs are recognizable in every type
+    ld_out[g] = N + 16;
+    initial_out[g].assign(size_t(M) * ld_out[g] * element_bytes(types[g % 6]), uint8_t(0x3c));
+    host_out[g] = initial_out[g];
+    block_out[g].reset(host_out[g].size());
+    block_out[g].copy_from_host(host_out[g].data());
+    // Keeps scaled fp8 outputs far below their saturation limit
+    scales[g] = types[g % 6] == OutputType::E4M3 ? 0.25f : types[g % 6] == OutputType::E5M2 ? 2.0f : 1.0f;
+  }
+  cutlass::DeviceAllocation<float> block_scales(groups);
+  block_scales.copy_from_host(scales.data());
+
+  std::vector<cutlass::epilogue::fusion::GroupOutputDescriptor> descriptors(groups);
+  for (int g = 0; g < groups; ++g) {
+    OutputType type = types[g % 6];
+    descriptors[g].ptr = block_out[g].get();
+    descriptors[g].stride_m = ld_out[g];
+    descriptors[g].stride_n = 1;
+    descriptors[g].type = type;
+    // Unscaled groups alternate between a nullptr and an explicit unit scale
+    bool scaled = type == OutputType::E4M3 || type == OutputType::E5M2 || g % 2 == 1;
+    descriptors[g].scale_ptr = scaled ? block_scales.get() + g : nullptr;
+  }
+  cutlass::DeviceAllocation<cutlass::epilogue::fusion::GroupOutputDescriptor> block_descriptors(groups);
+  block_descriptors.copy_from_host(descriptors.data());
+
+  cutlass::DeviceAllocation<typename ProblemShape::UnderlyingProblemShape> block_problem_sizes(groups);
+  cutlass::DeviceAllocation<Element const*> block_ptr_A(groups), block_ptr_B(groups);
+  cutlass::DeviceAllocation<InternalStrideA> block_stride_A(groups);
+  cutlass::DeviceAllocation<InternalStrideB> block_stride_B(groups);
+  block_problem_sizes.copy_from_host(problem_sizes.data());
+  block_ptr_A.copy_from_host(ptr_A.data());
+  block_ptr_B.copy_from_host(ptr_B.data());
+  block_stride_A.copy_from_host(stride_A.data());
+  block_stride_B.copy_from_host(stride_B.data());
+
+  typename GemmKernel::EpilogueArguments epilogue_args{};
+  epilogue_args.thread = {
+    {                          // binary op : alpha * acc
+      {{alpha}},               // leaf args : alpha
+      {},                      // leaf args : acc
+      {}                       // binary args : multiplies
+    },                         // end binary op
+    {block_descriptors.get()}  // unary args : grouped store
+  };
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {groups, block_problem_sizes.get(), problem_sizes.data()},
+    {block_ptr_A.get(), block_stride_A.get(), block_ptr_B.get(), block_stride_B.get()},
+    epilogue_args,
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << groups << " groups" << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+
+  for (int g = 0; g < groups; ++g) {
+    int M = group_m[g], N = group_n[g], K = group_k[g];
+    block_out[g].copy_to_host(host_out[g].data());
+    // Small integers keep the GEMM exact, so z is exact in float
+    std::vector<double> z(size_t(M) * N);
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        double acc = 0;
+        for (int k = 0; k < K; ++k) {
+          acc += double(host_A[g][m * K + k]) * double(host_B[g][n * K + k]);
+        }
+        z[size_t(m) * N + n] = alpha * acc;
+      }
+    }
+
+    bool passed = true;
+    switch (types[g % 6]) {
+      case OutputType::F32:
+        passed = check_grouped_output<float>(host_out[g], initial_out[g], z, M, N, ld_out[g], scales[g], 0, g);
+        break;
+      case OutputType::F16:
+        passed = check_grouped_output<cutlass::half_t>(host_out[g], initial_out[g], z, M, N, ld_out[g], scales[g], 0, g);
+        break;
+      case OutputType::BF16:
+        passed = check_grouped_output<cutlass::bfloat16_t>(host_out[g], initial_out[g], z, M, N, ld_out[g], scales[g], 0, g);
+        break;
+      // Host and device fp8 conversions may break ties differently, allow one rounding step
+      case OutputType::E4M3:
+        passed = check_grouped_output<cutlass::float_e4m3_t>(host_out[g], initial_out[g], z, M, N, ld_out[g], scales[g], 0.0625, g);
+        break;
+      case OutputType::E5M2:
+        passed = check_grouped_output<cutlass::float_e5m2_t>(host_out[g], initial_out[g], z, M, N, ld_out[g], scales[g], 0.125, g);
+        break;
+      default:
+        if (host_out[g] != initial_out[g]) {
+          std::cerr << "Group " << g << " of type None was written" << std::endl;
+          passed = false;
+        }
+        break;
+    }
+    if (!passed) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_grouped_store_all() {
+  // Every output type appears at least once, with extents below, at and above the tile shape
+  std::vector<int> group_m = {128, 64, 200, 8, 136, 256, 17, 96};
+  std::vector<int> group_n = {128, 264, 64, 136, 200, 72, 128, 8};
+  for (int k : {64, 264}) {
+    std::vector<int> group_k(group_m.size());
+    for (size_t g = 0; g < group_m.size(); ++g) {
+      group_k[g] = k + 8 * int(g % 3);
+    }
+    if (!test_grouped_store<GemmType>(group_m, group_n, group_k)) {
+      std::cerr << "Failed with K = " << k << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_voidt_tensor_op_gmma_f32_group_gemm_grouped_store, 128x128x64_2x1x1_cooperative) {
+  using GemmType = test::gemm::device::GroupedStoreGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_grouped_store_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_voidt_tensor_op_gmma_f32_group_gemm_grouped_store, 64x128x64_1x2x1_pingpong) {
+  using GemmType = test::gemm::device::GroupedStoreGemm<
+    Shape<_64,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpong,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedPingpong>;
+  EXPECT_TRUE(test::gemm::device::test_grouped_store_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,290 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 segmented-A Grouped GEMM mainloop
+
+    Every group multiplies a row segment of one shared A with its own B. Segments are placed
+    out of group order, so results depend on the segment offsets rather than on prefix sums
+    of the group M extents.
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape, class ClusterShape, class KernelSchedule, class EpilogueSchedule>
+struct SegmentedAGroupedGemm {
+  using Element = cutlass::half_t;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      Element, cutlass::layout::RowMajor *, 8,
+      Element, cutlass::layout::RowMajor *, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor *, 8,
+      Element, cutlass::layout::ColumnMajor *, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// D_g = alpha * A[offset_g : offset_g + M_g, :] * B_g + beta * C_g for each group g
+template <class GemmType>
+bool
+test_segmented_a(std::vector<int> const& group_m, std::vector<int> const& group_n, int K, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using InternalStrideA = typename GemmKernel::InternalStrideA;
+  using InternalStrideB = typename GemmKernel::InternalStrideB;
+  using InternalStrideC = typename GemmKernel::InternalStrideC;
+  using InternalStrideD = typename GemmKernel::InternalStrideD;
+
+  int groups = int(group_m.size());
+  std::mt19937 gen(2026 + K + groups);
+  std::uniform_int_distribution<int> dist(-2, 2);
+
+  // Segments are stacked in reverse group order
+  std::vector<int32_t> offsets(groups);
+  int M_total = 0;
+  for (int g = groups - 1; g >= 0; --g) {
+    offsets[g] = M_total;
+    M_total += group_m[g];
+  }
+
+  std::vector<Element> host_A(size_t(M_total) * K);
+  for (auto& x : host_A) { x = Element(float(dist(gen))); }
+  cutlass::DeviceAllocation<Element> block_A(host_A.size());
+  block_A.copy_from_host(host_A.data());
+  cutlass::DeviceAllocation<int32_t> block_offsets(groups);
+  block_offsets.copy_from_host(offsets.data());
+
+  std::vector<typename ProblemShape::UnderlyingProblemShape> problem_sizes;
+  std::vector<std::vector<Element>> host_B(groups), host_C(groups), host_D(groups);
+  std::vector<cutlass::DeviceAllocation<Element>> block_B(groups), block_C(groups), block_D(groups);
+  std::vector<Element const*> ptr_B(groups), ptr_C(groups);
+  std::vector<Element*> ptr_D(groups);
+  std::vector<InternalStrideB> stride_B(groups);
+  std::vector<InternalStrideC> stride_C(groups);
+  std::vector<InternalStrideD> stride_D(groups);
+  for (int g = 0; g < groups; ++g) {
+    int M = group_m[g], N = group_n[g];
+    problem_sizes.push_back({M, N, K});
+    host_B[g].resize(size_t(N) * K);
+    host_C[g].resize(size_t(M) * N);
+    host_D[g].assign(size_t(M) * N, Element(0));
+    for (auto& x : host_B[g]) { x = Element(float(dist(gen))); }
+    for (auto& x : host_C[g]) { x = Element(float(dist(gen))); }
+    block_B[g].reset(host_B[g].size());
+    block_C[g].reset(host_C[g].size());
+    block_D[g].reset(host_D[g].size());
+    block_B[g].copy_from_host(host_B[g].data());
+    block_C[g].copy_from_host(host_C[g].data());
+    block_D[g].copy_from_host(host_D[g].data());
+    ptr_B[g] = block_B[g].get();
+    ptr_C[g] = block_C[g].get();
+    ptr_D[g] = block_D[g].get();
+    stride_B[g] = cutlass::make_cute_packed_stride(InternalStrideB{}, {N, K, 1});
+    stride_C[g] = cutlass::make_cute_packed_stride(InternalStrideC{}, {M, N, 1});
+    stride_D[g] = cutlass::make_cute_packed_stride(InternalStrideD{}, {M, N, 1});
+  }
+
+  cutlass::DeviceAllocation<typename ProblemShape::UnderlyingProblemShape> block_problem_sizes(groups);
+  cutlass::DeviceAllocation<Element const*> block_ptr_B(groups), block_ptr_C(groups);
+  cutlass::DeviceAllocation<Element*> block_ptr_D(groups);
+  cutlass::DeviceAllocation<InternalStrideB> block_stride_B(groups);
+  cutlass::DeviceAllocation<InternalStrideC> block_stride_C(groups);
+  cutlass::DeviceAllocation<InternalStrideD> block_stride_D(groups);
+  block_problem_sizes.copy_from_host(problem_sizes.data());
+  block_ptr_B.copy_from_host(ptr_B.data());
+  block_ptr_C.copy_from_host(ptr_C.data());
+  block_ptr_D.copy_from_host(ptr_D.data());
+  block_stride_B.copy_from_host(stride_B.data());
+  block_stride_C.copy_from_host(stride_C.data());
+  block_stride_D.copy_from_host(stride_D.data());
+
+  typename GemmKernel::MainloopArguments mainloop_args{};
+  mainloop_args.ptr_A = block_A.get();
+  mainloop_args.M_total = M_total;
+  mainloop_args.K = K;
+  mainloop_args.dA = cutlass::make_cute_packed_stride(InternalStrideA{}, {M_total, K, 1});
+  mainloop_args.segment_offsets = block_offsets.get();
+  mainloop_args.ptr_B = block_ptr_B.get();
+  mainloop_args.dB = block_stride_B.get();
+
+  typename GemmKernel::EpilogueArguments epilogue_args{};
+  epilogue_args.thread.alpha = alpha;
+  epilogue_args.thread.beta = beta;
+  epilogue_args.ptr_C = block_ptr_C.get();
+  epilogue_args.dC = block_stride_C.get();
+  epilogue_args.ptr_D = block_ptr_D.get();
+  epilogue_args.dD = block_stride_D.get();
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {groups, block_problem_sizes.get(), problem_sizes.data()},
+    mainloop_args,
+    epilogue_args,
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << groups << " groups with K = " << K << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+
+  for (int g = 0; g < groups; ++g) {
+    int M = group_m[g], N = group_n[g];
+    block_D[g].copy_to_host(host_D[g].data());
+    Element const* A = host_A.data() + size_t(offsets[g]) * K;
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float acc = 0;
+        for (int k = 0; k < K; ++k) {
+          acc += float(A[m * K + k]) * float(host_B[g][n * K + k]);
+        }
+        // Small integers keep the GEMM exact, only the f16 output rounds
+        float expected = float(Element(alpha * acc + beta * float(host_C[g][m * N + n])));
+        float actual = float(host_D[g][m * N + n]);
+        if (actual != expected) {
+          std::cerr << "Mismatch in group " << g << " at (" << m << "," << n << "): "
+                    << actual << " != " << expected << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_segmented_a_all() {
+  // Segment extents below, at and above the tile M, including a segment shorter than one tile
+  std::vector<std::vector<int>> group_ms = {{128}, {64, 200, 8, 136}, {17, 256, 96, 40, 128, 72}};
+  for (auto const& group_m : group_ms) {
+    std::vector<int> group_n(group_m.size());
+    for (size_t g = 0; g < group_m.size(); ++g) {
+      group_n[g] = 64 * int(g % 3 + 1) + 8 * int(g % 2);
+    }
+    for (int k : {64, 520}) {
+      if (!test_segmented_a<GemmType>(group_m, group_n, k, 1.0f, 0.0f) ||
+          !test_segmented_a<GemmType>(group_m, group_n, k, 0.5f, 1.0f)) {
+        std::cerr << "Failed with " << group_m.size() << " groups and K = " << k << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_group_gemm_segmented_a, 128x128x64_2x1x1_cooperative) {
+  using GemmType = test::gemm::device::SegmentedAGroupedGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperativeSegmentedA,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_segmented_a_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_group_gemm_segmented_a, 64x128x64_1x2x1_pingpong) {
+  using GemmType = test::gemm::device::SegmentedAGroupedGemm<
+    Shape<_64,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpongSegmentedA,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedPingpong>;
+  EXPECT_TRUE(test::gemm::device::test_segmented_a_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,284 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for Ptr-Array GEMM operands addressed on device from a base pointer and an index vector
+
+    Batches of A and C read pages of shared pools through index vectors with repeats, D is
+    written through a permutation, and B is strided off its base. A second run mixes indexed
+    operands with materialized pointer arrays, which take precedence.
+*/
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/indexed_ptr_array.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape, class ClusterShape, class KernelSchedule, class EpilogueSchedule>
+struct IndexedPtrArrayGemm {
+  using Element = cutlass::half_t;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::ArrayProblemShape<Shape<int,int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// D[d_index[i]] = alpha * A[a_index[i]] * B[i] + beta * C[c_index[i]] for each batch i.
+/// With materialize_B_D, B and D are passed as pointer arrays next to their indexed descriptions.
+template <class GemmType>
+bool
+test_indexed_ptr_array(int M, int N, int K, int L, bool materialize_B_D, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+
+  std::mt19937 gen(2026 + M + N + K + L);
+  std::uniform_int_distribution<int> dist(-2, 2);
+
+  // A and C share pools smaller than the batch count, so pages are reused across batches
+  int pages_A = (L + 1) / 2;
+  int pages_C = 2;
+  int64_t batch_stride_A = int64_t(M) * K;
+  int64_t batch_stride_B = int64_t(N) * K;
+  int64_t batch_stride_C = int64_t(M) * N;
+
+  std::vector<Element> host_A(pages_A * batch_stride_A);
+  std::vector<Element> host_B(L * batch_stride_B);
+  std::vector<Element> host_C(pages_C * batch_stride_C);
+  std::vector<Element> host_D(L * batch_stride_C, Element(0));
+  for (auto& x : host_A) { x = Element(float(dist(gen))); }
+  for (auto& x : host_B) { x = Element(float(dist(gen))); }
+  for (auto& x : host_C) { x = Element(float(dist(gen))); }
+
+  std::vector<int32_t> index_A(L), index_C(L), index_D(L);
+  for (int i = 0; i < L; ++i) {
+    index_A[i] = (L - 1 - i) % pages_A;
+    index_C[i] = i % pages_C;
+    index_D[i] = (i + 1) % L;
+  }
+
+  cutlass::DeviceAllocation<Element> block_A(host_A.size());
+  cutlass::DeviceAllocation<Element> block_B(host_B.size());
+  cutlass::DeviceAllocation<Element> block_C(host_C.size());
+  cutlass::DeviceAllocation<Element> block_D(host_D.size());
+  cutlass::DeviceAllocation<int32_t> block_index_A(L), block_index_C(L), block_index_D(L);
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+  block_C.copy_from_host(host_C.data());
+  block_D.copy_from_host(host_D.data());
+  block_index_A.copy_from_host(index_A.data());
+  block_index_C.copy_from_host(index_C.data());
+  block_index_D.copy_from_host(index_D.data());
+
+  // Pointer arrays following the same mapping, only passed with materialize_B_D
+  std::vector<Element const*> host_ptr_B(L);
+  std::vector<Element*> host_ptr_D(L);
+  for (int i = 0; i < L; ++i) {
+    host_ptr_B[i] = block_B.get() + i * batch_stride_B;
+    host_ptr_D[i] = block_D.get() + index_D[i] * batch_stride_C;
+  }
+  cutlass::DeviceAllocation<Element const*> block_ptr_B(L);
+  cutlass::DeviceAllocation<Element*> block_ptr_D(L);
+  block_ptr_B.copy_from_host(host_ptr_B.data());
+  block_ptr_D.copy_from_host(host_ptr_D.data());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::InternalStrideA{}, {M, K, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::InternalStrideB{}, {N, K, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::InternalStrideC{}, {M, N, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::InternalStrideD{}, {M, N, 1});
+
+  typename GemmKernel::MainloopArguments mainloop_args{};
+  mainloop_args.ptr_A = nullptr;
+  mainloop_args.dA = stride_A;
+  mainloop_args.ptr_B = materialize_B_D ? block_ptr_B.get() : nullptr;
+  mainloop_args.dB = stride_B;
+  mainloop_args.indexed_A = {block_A.get(), block_index_A.get(), batch_stride_A};
+  // The pointer array takes precedence, a stale base must not be used
+  mainloop_args.indexed_B = {materialize_B_D ? block_A.get() : block_B.get(), nullptr, batch_stride_B};
+
+  typename GemmKernel::EpilogueArguments epilogue_args{};
+  epilogue_args.thread.alpha = alpha;
+  epilogue_args.thread.beta = beta;
+  epilogue_args.ptr_C = nullptr;
+  epilogue_args.dC = stride_C;
+  epilogue_args.ptr_D = materialize_B_D ? block_ptr_D.get() : nullptr;
+  epilogue_args.dD = stride_D;
+  epilogue_args.indexed_C = {block_C.get(), block_index_C.get(), batch_stride_C};
+  epilogue_args.indexed_D = {materialize_B_D ? nullptr : block_D.get(), block_index_D.get(), batch_stride_C};
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kArray,
+    {{M, N, K, L}},
+    mainloop_args,
+    epilogue_args,
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << "x" << L << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+  block_D.copy_to_host(host_D.data());
+
+  for (int i = 0; i < L; ++i) {
+    Element const* A = host_A.data() + index_A[i] * batch_stride_A;
+    Element const* B = host_B.data() + i * batch_stride_B;
+    Element const* C = host_C.data() + index_C[i] * batch_stride_C;
+    Element const* D = host_D.data() + index_D[i] * batch_stride_C;
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float acc = 0;
+        for (int k = 0; k < K; ++k) {
+          acc += float(A[m * K + k]) * float(B[n * K + k]);
+        }
+        // Small integers keep the GEMM exact, only the f16 output rounds
+        float expected = float(Element(alpha * acc + beta * float(C[m * N + n])));
+        float actual = float(D[m * N + n]);
+        if (actual != expected) {
+          std::cerr << "Mismatch in batch " << i << " at (" << m << "," << n << "): "
+                    << actual << " != " << expected << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_indexed_ptr_array_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 264}) {
+      for (int k : {64, 520}) {
+        for (int l : {1, 5}) {
+          for (bool materialize_B_D : {false, true}) {
+            if (!test_indexed_ptr_array<GemmType>(m, n, k, l, materialize_B_D, 1.0f, 0.0f) ||
+                !test_indexed_ptr_array<GemmType>(m, n, k, l, materialize_B_D, 0.5f, 1.0f)) {
+              std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l
+                        << (materialize_B_D ? " and materialized B/D pointer arrays" : "") << std::endl;
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_ptr_array_indexed, 128x128x64_2x1x1_cooperative) {
+  using GemmType = test::gemm::device::IndexedPtrArrayGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_indexed_ptr_array_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f16t_tensor_op_gmma_f32_ptr_array_indexed, 64x128x64_1x2x1_pingpong) {
+  using GemmType = test::gemm::device::IndexedPtrArrayGemm<
+    Shape<_64,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpong,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedPingpong>;
+  EXPECT_TRUE(test::gemm::device::test_indexed_ptr_array_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,311 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for GEMMs whose (M, N) extents are read from device memory by the tile scheduler
+
+    The GEMM is set up and launched for a maximum problem shape, and the scheduler restricts the
+    tile space to the extents of StaticPersistentTileScheduler::Arguments::device_problem_shape_mn
+    at kernel start. Outputs within the device extents must match the reference. Outputs beyond them
+    may only be written by the tiles the restricted space is rounded up to, i.e. whole swizzles of
+    clusters or whole super-tiles of the L2-aware and Morton orders, and must be untouched elsewhere.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape, class ClusterShape, class KernelSchedule, class EpilogueSchedule>
+struct DeviceProblemShapeGemm {
+  using Element = cutlass::half_t;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Extent of the outputs along one mode that a tile space restricted to `extent` may write: the
+/// tiles covering it rounded up to whole granules of tiles, within the maximum extent
+inline int
+written_extent(int extent, int max_extent, int tile, int granule) {
+  int tiles = (extent + tile - 1) / tile;
+  tiles = (tiles + granule - 1) / granule * granule;
+  return std::min(tiles * tile, max_extent);
+}
+
+template <class GemmType>
+bool
+test_device_problem_shape(
+    int max_m, int max_n, int k,
+    std::vector<std::pair<int,int>> const& device_extents,
+    cutlass::gemm::kernel::detail::RasterOrderOptions raster_order,
+    int max_swizzle_size) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+  using TileOrder = typename GemmKernel::TileScheduler::Params::TileOrder;
+  using RasterOrder = typename GemmKernel::TileScheduler::Params::RasterOrder;
+
+  constexpr int TileM = size<0>(typename GemmKernel::TileShape{});
+  constexpr int TileN = size<1>(typename GemmKernel::TileShape{});
+  constexpr int ClusterM = size<0>(typename GemmKernel::ClusterShape{});
+  constexpr int ClusterN = size<1>(typename GemmKernel::ClusterShape{});
+
+  // Small integers keep the GEMM exact in float
+  std::mt19937 gen(2026);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<Element> host_A(size_t(max_m) * k), host_B(size_t(max_n) * k);
+  for (auto& x : host_A) { x = Element(float(dist(gen))); }
+  for (auto& x : host_B) { x = Element(float(dist(gen))); }
+  cutlass::DeviceAllocation<Element> block_A(host_A.size()), block_B(host_B.size());
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+
+  std::vector<float> reference(size_t(max_m) * max_n);
+  for (int m = 0; m < max_m; ++m) {
+    for (int n = 0; n < max_n; ++n) {
+      float acc = 0;
+      for (int i = 0; i < k; ++i) {
+        acc += float(host_A[size_t(m) * k + i]) * float(host_B[size_t(n) * k + i]);
+      }
+      reference[size_t(m) * max_n + n] = acc;
+    }
+  }
+
+  // No exact product of the inputs takes this value
+  float const untouched = -1.0e30f;
+  std::vector<float> host_D(reference.size());
+  cutlass::DeviceAllocation<float> block_D(host_D.size());
+  cutlass::DeviceAllocation<int> block_extents(2);
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {max_m, max_n, k, 1},
+    {block_A.get(), cutlass::make_cute_packed_stride(StrideA{}, {max_m, k, 1}),
+     block_B.get(), cutlass::make_cute_packed_stride(StrideB{}, {max_n, k, 1})},
+    {{}, nullptr, cutlass::make_cute_packed_stride(StrideC{}, {max_m, max_n, 1}),
+     block_D.get(), cutlass::make_cute_packed_stride(StrideD{}, {max_m, max_n, 1})},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = 1.0f;
+  arguments.epilogue.thread.beta = 0.0f;
+  arguments.scheduler.raster_order = raster_order;
+  arguments.scheduler.max_swizzle_size = max_swizzle_size;
+  arguments.scheduler.device_problem_shape_mn = block_extents.get();
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << max_m << "x" << max_n << "x" << k << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to initialize" << std::endl;
+    return false;
+  }
+
+  // Granules in CTA tiles the restricted tile counts are rounded up to along M and N
+  auto const& scheduler = gemm.params().scheduler;
+  int granule_m = ClusterM << scheduler.log_swizzle_size_;
+  int granule_n = ClusterN << scheduler.log_swizzle_size_;
+  if (scheduler.tile_order_ == TileOrder::SuperTile) {
+    int height = static_cast<int>(scheduler.divmod_super_tile_.divisor);
+    if (scheduler.raster_order_ == RasterOrder::AlongN) {
+      granule_m *= height;
+    }
+    else {
+      granule_n *= height;
+    }
+  }
+  else if (scheduler.tile_order_ == TileOrder::Morton) {
+    granule_m <<= scheduler.log_super_tile_size_;
+    granule_n <<= scheduler.log_super_tile_size_;
+  }
+
+  for (auto [M, N] : device_extents) {
+    int extents[2] = {M, N};
+    block_extents.copy_from_host(extents);
+    std::fill(host_D.begin(), host_D.end(), untouched);
+    block_D.copy_from_host(host_D.data());
+
+    if (gemm.run() != cutlass::Status::kSuccess) {
+      std::cerr << "GEMM failed to launch" << std::endl;
+      return false;
+    }
+    cudaError_t result = cudaDeviceSynchronize();
+    if (result != cudaSuccess) {
+      std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+      return false;
+    }
+    block_D.copy_to_host(host_D.data());
+
+    // An empty mode leaves the whole tile space empty
+    bool empty = M == 0 || N == 0;
+    int written_m = empty ? 0 : written_extent(M, max_m, TileM, granule_m);
+    int written_n = empty ? 0 : written_extent(N, max_n, TileN, granule_n);
+    for (int m = 0; m < max_m; ++m) {
+      for (int n = 0; n < max_n; ++n) {
+        float got = host_D[size_t(m) * max_n + n];
+        float expected = reference[size_t(m) * max_n + n];
+        bool passed;
+        if (m < M && n < N) {
+          passed = got == expected;
+        }
+        else if (m < written_m && n < written_n) {
+          passed = got == expected || got == untouched;
+        }
+        else {
+          passed = got == untouched;
+        }
+        if (!passed) {
+          std::cerr << "Device extents " << M << "x" << N << " of " << max_m << "x" << max_n
+                    << ", written up to " << written_m << "x" << written_n
+                    << ": D(" << m << "," << n << ") = " << got << ", expected " << expected << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_device_problem_shape_all() {
+  using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+
+  // The maximum extents are no multiples of the tile shape. The device extents include empty modes,
+  // single elements, extents below, at and just above tile and swizzle boundaries, and the maximum.
+  int const max_m = 1000, max_n = 776, k = 256;
+  std::vector<std::pair<int,int>> device_extents = {
+    {0, 0}, {0, max_n}, {max_m, 0}, {1, 1}, {130, 250}, {257, 129}, {513, 600}, {999, 775}, {max_m, max_n}
+  };
+
+  struct Config {
+    RasterOrderOptions raster_order;
+    int max_swizzle_size;
+  };
+  Config const configs[] = {
+    {RasterOrderOptions::Heuristic, 1},
+    {RasterOrderOptions::AlongM, 2},
+    {RasterOrderOptions::AlongN, 4},
+    {RasterOrderOptions::L2Aware, 1},
+    {RasterOrderOptions::Morton, 1}
+  };
+  for (auto const& config : configs) {
+    if (!test_device_problem_shape<GemmType>(max_m, max_n, k, device_extents, config.raster_order, config.max_swizzle_size)) {
+      std::cerr << "Failed with raster order " << int(config.raster_order)
+                << " and max swizzle size " << config.max_swizzle_size << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_device_problem_shape, 128x128x64_2x1x1_cooperative) {
+  using GemmType = test::gemm::device::DeviceProblemShapeGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_device_problem_shape_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_device_problem_shape, 64x128x64_1x2x1_pingpong) {
+  using GemmType = test::gemm::device::DeviceProblemShapeGemm<
+    Shape<_64,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE(test::gemm::device::test_device_problem_shape_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,246 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 dual-B (gated) GEMM mainloop
+
+    The fused output ActivationFn(A*B) * (A*B1) is checked against two host GEMMs, A*B and A*B1,
+    combined on the host.
+*/
+
+#include <iostream>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/packed_stride.hpp"
+#include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct DualBGemm {
+  using ElementA = cutlass::half_t;
+  using LayoutA = cutlass::layout::RowMajor;
+  using ElementB = cutlass::half_t;
+  using LayoutB = cutlass::layout::ColumnMajor;
+  using ElementC = float;
+  using LayoutC = cutlass::layout::RowMajor;
+  using ElementAccumulator = float;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      ElementAccumulator, ElementAccumulator,
+      ElementC, LayoutC, 4,
+      ElementC, LayoutC, 4,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      ElementA, LayoutA, 8,
+      ElementB, LayoutB, 8,
+      ElementAccumulator,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Runs D = alpha * ActivationFn(A*B) * (A*B1) + beta * C and compares D against the
+/// combination of the host GEMMs A*B and A*B1
+template <class GemmType, template <class> class ActivationFn>
+bool
+test_dual_b_gemm(int M, int N, int K, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename GemmType::ElementA;
+  using ElementB = typename GemmType::ElementB;
+  using ElementC = typename GemmType::ElementC;
+  using LayoutA = typename GemmType::LayoutA;
+  using LayoutB = typename GemmType::LayoutB;
+  using LayoutC = typename GemmType::LayoutC;
+
+  cutlass::HostTensor<ElementA, LayoutA> tensor_A({M, K});
+  cutlass::HostTensor<ElementB, LayoutB> tensor_B({K, N});
+  cutlass::HostTensor<ElementB, LayoutB> tensor_B1({K, N});
+  cutlass::HostTensor<ElementC, LayoutC> tensor_C({M, N});
+  cutlass::HostTensor<ElementC, LayoutC> tensor_D({M, N});
+  cutlass::HostTensor<float, LayoutC> reference_AB({M, N});
+  cutlass::HostTensor<float, LayoutC> reference_AB1({M, N});
+
+  // Small integers keep both GEMMs exact, so only the activation contributes rounding error
+  cutlass::reference::host::TensorFillRandomUniform(tensor_A.host_view(), 2023, 2, -2, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B.host_view(), 2024, 2, -2, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_B1.host_view(), 2025, 2, -2, 0);
+  cutlass::reference::host::TensorFillRandomUniform(tensor_C.host_view(), 2026, 4, -4, 0);
+  cutlass::reference::host::TensorFill(tensor_D.host_view(), ElementC(0));
+  tensor_A.sync_device();
+  tensor_B.sync_device();
+  tensor_B1.sync_device();
+  tensor_C.sync_device();
+  tensor_D.sync_device();
+
+  cutlass::reference::host::Gemm<ElementA, LayoutA, ElementB, LayoutB, float, LayoutC, float, float> reference_gemm;
+  reference_gemm({M, N, K}, 1.0f, tensor_A.host_ref(), tensor_B.host_ref(), 0.0f, reference_AB.host_ref());
+  reference_gemm({M, N, K}, 1.0f, tensor_A.host_ref(), tensor_B1.host_ref(), 0.0f, reference_AB1.host_ref());
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {M, K, 1});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {N, K, 1});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {M, N, 1});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {M, N, 1});
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, 1},
+    {tensor_A.device_data(), stride_A,
+     tensor_B.device_data(), stride_B,
+     tensor_B1.device_data(), stride_B},
+    {{alpha, beta}, tensor_C.device_data(), stride_C, tensor_D.device_data(), stride_D},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+  tensor_D.sync_host();
+
+  ActivationFn<float> activation{};
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < N; ++n) {
+      float expected = alpha * activation(reference_AB.at({m, n})) * reference_AB1.at({m, n}) +
+                       beta * float(tensor_C.at({m, n}));
+      float actual = float(tensor_D.at({m, n}));
+      if (!(std::abs(actual - expected) <= 1e-4f * std::abs(expected) + 1e-4f)) {
+        std::cerr << "Mismatch at (" << m << "," << n << "): " << actual << " != " << expected
+                  << " (A*B = " << reference_AB.at({m, n}) << ", A*B1 = " << reference_AB1.at({m, n}) << ")"
+                  << std::endl;
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+template <class GemmType, template <class> class ActivationFn>
+bool
+test_dual_b_gemm_all() {
+  for (int m : {128, 264}) {
+    for (int n : {128, 200}) {
+      for (int k : {64, 520, 1024}) {
+        if (!test_dual_b_gemm<GemmType, ActivationFn>(m, n, k, 1.0f, 0.0f) ||
+            !test_dual_b_gemm<GemmType, ActivationFn>(m, n, k, 0.5f, 2.0f)) {
+          std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_dual_b_cooperative, 128x128x64_1x1x1_identity) {
+  using GemmType = test::gemm::device::DualBGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperativeDualB<cutlass::epilogue::thread::Identity>,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_dual_b_gemm_all<GemmType, cutlass::epilogue::thread::Identity>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_dual_b_cooperative, 128x128x64_2x1x1_silu) {
+  using GemmType = test::gemm::device::DualBGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperativeDualB<cutlass::epilogue::thread::SiLu>,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_dual_b_gemm_all<GemmType, cutlass::epilogue::thread::SiLu>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_dual_b_pingpong, 64x128x64_1x2x1_relu) {
+  using GemmType = test::gemm::device::DualBGemm<
+    Shape<_64,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpongDualB<cutlass::epilogue::thread::ReLu>,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_dual_b_gemm_all<GemmType, cutlass::epilogue::thread::ReLu>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
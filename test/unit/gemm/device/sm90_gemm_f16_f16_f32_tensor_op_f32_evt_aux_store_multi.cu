@@ -0,0 +1,508 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 multi-output aux store EVT node
+
+    One Sm90AuxStoreMulti node writes a f16 and a f32 output from independent subtrees:
+      Aux0 = alpha * acc,  Aux1 = ReLU(C + acc),  D = alpha * acc
+    The Grouped GEMM variant stores through Sm90AuxArrayStore outputs, so the node must forward
+    the tensormap callbacks of both, and pads every output row to check the per-group strides.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"
+#include "cutlass/epilogue/thread/activation.h"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct AuxStoreMultiGemm {
+  static constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  using EpilogueDescriptor = cutlass::epilogue::collective::detail::EpilogueDescriptor<
+    TileShape_MNK, cutlass::epilogue::collective::EpilogueTileAuto, float, float, EpilogueSchedule>;
+  template <class Element>
+  using AuxStore = cutlass::epilogue::collective::detail::AuxStoreDescriptor<
+    EpilogueDescriptor, cutlass::layout::RowMajor, Element>;
+  template <class Element>
+  using Sm90AuxStore = cutlass::epilogue::fusion::Sm90AuxStore<
+    AuxStore<Element>::Stages, typename EpilogueDescriptor::EpilogueTile, Element, RoundStyle,
+    typename AuxStore<Element>::Stride, typename AuxStore<Element>::SmemLayoutAtom,
+    typename AuxStore<Element>::CopyOpR2S>;
+
+  using CustomEVT =  // D = Aux0 = alpha * acc, Aux1 = ReLU(C + acc)
+    cutlass::epilogue::fusion::Sm90EVT<
+      cutlass::epilogue::fusion::Sm90AuxStoreMulti<Sm90AuxStore<cutlass::half_t>, Sm90AuxStore<float>>,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::multiplies, float, float, RoundStyle>,
+        cutlass::epilogue::fusion::Sm90ScalarBroadcast<float>,  // alpha
+        cutlass::epilogue::fusion::Sm90AccFetch                 // acc
+      >,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::epilogue::thread::ReLu, float, float, RoundStyle>,
+        cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::plus, float, float, RoundStyle>,
+          cutlass::epilogue::fusion::Sm90SrcFetch<float>,       // C
+          cutlass::epilogue::fusion::Sm90AccFetch               // acc
+        >
+      >
+    >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      EpilogueSchedule,
+      CustomEVT
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+template <class GemmType>
+bool
+test_aux_store_multi(int M, int N, int K, int L) {
+  using Gemm = typename GemmType::Gemm;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+  float const alpha = 0.5f;
+
+  FusionOperand<cutlass::half_t, typename GemmType::template AuxStore<cutlass::half_t>::Stride> aux0;
+  FusionOperand<float, typename GemmType::template AuxStore<float>::Stride> aux1;
+  aux0.reset(M, N, L);
+  aux1.reset(M, N, L);
+  aux0.to_device();
+  aux1.to_device();
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args{
+    {                                   // binary op : alpha * acc
+      {{alpha}},                        // leaf args : alpha
+      {},                               // leaf args : acc
+      {}                                // binary args : multiplies
+    },                                  // end binary op
+    {                                   // unary op : ReLU(C + acc)
+      {                                 // binary op : C + acc
+        {},                             // leaf args : C
+        {},                             // leaf args : acc
+        {}                              // binary args : plus
+      },                                // end binary op
+      {}                                // unary args : ReLU
+    },                                  // end unary op
+    {                                   // multi aux store args
+      {aux0.device.get(), aux0.stride}, // Aux0
+      {aux1.device.get(), aux1.stride}  // Aux1
+    }
+  };
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+  aux0.to_host();
+  aux1.to_host();
+
+  // Inputs are small integers, so every output is exact in its element type
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        double z = alpha * testbed.acc(m, n, l);
+        double relu = std::max(testbed.c(m, n, l) + testbed.acc(m, n, l), 0.0);
+        if (!fusion_close(testbed.d(m, n, l), z, 0, 0, "D", m, n, l) ||
+            !fusion_close(double(aux0.at(m, n, l)), z, 0, 0, "Aux0", m, n, l) ||
+            !fusion_close(double(aux1.at(m, n, l)), relu, 0, 0, "Aux1", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_aux_store_multi_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 264}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          if (!test_aux_store_multi<GemmType>(m, n, k, l)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct AuxStoreMultiGroupedGemm {
+  using Element = cutlass::half_t;
+  static constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  // D is void, the builder picks the epilogue tile for the first aux output instead
+  using EpilogueDescriptor = cutlass::epilogue::collective::detail::EpilogueDescriptor<
+    TileShape_MNK, cutlass::epilogue::collective::EpilogueTileAuto, void, cutlass::half_t, EpilogueSchedule>;
+  using StrideAux = cutlass::detail::TagToStrideC_t<cutlass::layout::RowMajor *>;
+  template <class ElementAux>
+  using AuxStore = cutlass::epilogue::collective::detail::AuxStoreDescriptor<
+    EpilogueDescriptor, cutlass::layout::RowMajor, ElementAux>;
+  template <class ElementAux>
+  using Sm90AuxArrayStore = cutlass::epilogue::fusion::Sm90AuxArrayStore<
+    AuxStore<ElementAux>::Stages, EpilogueSchedule::NumEpilogueWarpGroups,
+    typename EpilogueDescriptor::EpilogueTile, ElementAux, RoundStyle, StrideAux,
+    typename AuxStore<ElementAux>::SmemLayoutAtom, typename AuxStore<ElementAux>::CopyOpR2S>;
+
+  using CustomEVT =  // Aux0_g = alpha * acc, Aux1_g = ReLU(acc)
+    cutlass::epilogue::fusion::Sm90EVT<
+      cutlass::epilogue::fusion::Sm90AuxStoreMulti<Sm90AuxArrayStore<cutlass::half_t>, Sm90AuxArrayStore<float>>,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::multiplies, float, float, RoundStyle>,
+        cutlass::epilogue::fusion::Sm90ScalarBroadcast<float>,  // alpha
+        cutlass::epilogue::fusion::Sm90AccFetch                 // acc
+      >,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::epilogue::thread::ReLu, float, float, RoundStyle>,
+        cutlass::epilogue::fusion::Sm90AccFetch                 // acc
+      >
+    >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor *, 8,
+      void, cutlass::layout::RowMajor *, 8,
+      EpilogueSchedule,
+      CustomEVT
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor *, 8,
+      Element, cutlass::layout::ColumnMajor *, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      cutlass::gemm::GroupProblemShape<Shape<int,int,int>>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Checks one padded output of a group, the padding must keep its sentinel
+template <class ElementAux>
+bool
+check_multi_output(std::vector<ElementAux> const& out, std::vector<double> const& expected,
+                   int M, int N, int ld, ElementAux sentinel, char const* what, int group) {
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < ld; ++n) {
+      double value = double(out[size_t(m) * ld + n]);
+      double ref = n < N ? expected[size_t(m) * N + n] : double(sentinel);
+      if (!fusion_close(value, ref, 0, 0, what, m, n, group)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_aux_store_multi_grouped(std::vector<int> const& group_m, std::vector<int> const& group_n, std::vector<int> const& group_k) {
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+  using ProblemShape = typename GemmKernel::ProblemShape;
+  using InternalStrideA = typename GemmKernel::InternalStrideA;
+  using InternalStrideB = typename GemmKernel::InternalStrideB;
+  using InternalStrideAux = cute::remove_pointer_t<typename GemmType::StrideAux>;
+
+  int groups = int(group_m.size());
+  std::mt19937 gen(2026 + groups);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  float const alpha = 0.5f;
+  // Neither output can produce these: |alpha * acc| stays below 2048 and ReLU is non-negative
+  cutlass::half_t const sentinel0 = cutlass::half_t(-2047.f);
+  float const sentinel1 = -12345.f;
+
+  std::vector<typename ProblemShape::UnderlyingProblemShape> problem_sizes;
+  std::vector<std::vector<Element>> host_A(groups), host_B(groups);
+  std::vector<cutlass::DeviceAllocation<Element>> block_A(groups), block_B(groups);
+  std::vector<Element const*> ptr_A(groups), ptr_B(groups);
+  std::vector<InternalStrideA> stride_A(groups);
+  std::vector<InternalStrideB> stride_B(groups);
+  std::vector<std::vector<cutlass::half_t>> host_aux0(groups);
+  std::vector<std::vector<float>> host_aux1(groups);
+  std::vector<cutlass::DeviceAllocation<cutlass::half_t>> block_aux0(groups);
+  std::vector<cutlass::DeviceAllocation<float>> block_aux1(groups);
+  std::vector<cutlass::half_t*> ptr_aux0(groups);
+  std::vector<float*> ptr_aux1(groups);
+  std::vector<InternalStrideAux> stride_aux0(groups), stride_aux1(groups);
+  std::vector<int> ld_aux0(groups), ld_aux1(groups);
+  for (int g = 0; g < groups; ++g) {
+    int M = group_m[g], N = group_n[g], K = group_k[g];
+    problem_sizes.push_back({M, N, K});
+    host_A[g].resize(size_t(M) * K);
+    host_B[g].resize(size_t(N) * K);
+    for (auto& x : host_A[g]) { x = Element(float(dist(gen))); }
+    for (auto& x : host_B[g]) { x = Element(float(dist(gen))); }
+    block_A[g].reset(host_A[g].size());
+    block_B[g].reset(host_B[g].size());
+    block_A[g].copy_from_host(host_A[g].data());
+    block_B[g].copy_from_host(host_B[g].data());
+    ptr_A[g] = block_A[g].get();
+    ptr_B[g] = block_B[g].get();
+    stride_A[g] = cutlass::make_cute_packed_stride(InternalStrideA{}, {M, K, 1});
+    stride_B[g] = cutlass::make_cute_packed_stride(InternalStrideB{}, {N, K, 1});
+
+    // The two outputs get different padded row strides
+    ld_aux0[g] = N + 8;
+    ld_aux1[g] = N + 4 * (g % 3 + 1);
+    host_aux0[g].assign(size_t(M) * ld_aux0[g], sentinel0);
+    host_aux1[g].assign(size_t(M) * ld_aux1[g], sentinel1);
+    block_aux0[g].reset(host_aux0[g].size());
+    block_aux1[g].reset(host_aux1[g].size());
+    block_aux0[g].copy_from_host(host_aux0[g].data());
+    block_aux1[g].copy_from_host(host_aux1[g].data());
+    ptr_aux0[g] = block_aux0[g].get();
+    ptr_aux1[g] = block_aux1[g].get();
+    stride_aux0[g] = InternalStrideAux{int64_t(ld_aux0[g]), _1{}, _0{}};
+    stride_aux1[g] = InternalStrideAux{int64_t(ld_aux1[g]), _1{}, _0{}};
+  }
+
+  cutlass::DeviceAllocation<typename ProblemShape::UnderlyingProblemShape> block_problem_sizes(groups);
+  cutlass::DeviceAllocation<Element const*> block_ptr_A(groups), block_ptr_B(groups);
+  cutlass::DeviceAllocation<InternalStrideA> block_stride_A(groups);
+  cutlass::DeviceAllocation<InternalStrideB> block_stride_B(groups);
+  cutlass::DeviceAllocation<cutlass::half_t*> block_ptr_aux0(groups);
+  cutlass::DeviceAllocation<float*> block_ptr_aux1(groups);
+  cutlass::DeviceAllocation<InternalStrideAux> block_stride_aux0(groups), block_stride_aux1(groups);
+  block_problem_sizes.copy_from_host(problem_sizes.data());
+  block_ptr_A.copy_from_host(ptr_A.data());
+  block_ptr_B.copy_from_host(ptr_B.data());
+  block_stride_A.copy_from_host(stride_A.data());
+  block_stride_B.copy_from_host(stride_B.data());
+  block_ptr_aux0.copy_from_host(ptr_aux0.data());
+  block_ptr_aux1.copy_from_host(ptr_aux1.data());
+  block_stride_aux0.copy_from_host(stride_aux0.data());
+  block_stride_aux1.copy_from_host(stride_aux1.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename GemmKernel::EpilogueArguments epilogue_args{};
+  epilogue_args.thread = {
+    {                                                                         // binary op : alpha * acc
+      {{alpha}},                                                              // leaf args : alpha
+      {},                                                                     // leaf args : acc
+      {}                                                                      // binary args : multiplies
+    },                                                                        // end binary op
+    {                                                                         // unary op : ReLU(acc)
+      {},                                                                     // leaf args : acc
+      {}                                                                      // unary args : ReLU
+    },                                                                        // end unary op
+    {                                                                         // multi aux store args
+      {block_ptr_aux0.get(), block_stride_aux0.get(), hw_info.sm_count},      // Aux0
+      {block_ptr_aux1.get(), block_stride_aux1.get(), hw_info.sm_count}       // Aux1
+    }
+  };
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGrouped,
+    {groups, block_problem_sizes.get(), problem_sizes.data()},
+    {block_ptr_A.get(), block_stride_A.get(), block_ptr_B.get(), block_stride_B.get()},
+    epilogue_args,
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << groups << " groups" << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+
+  for (int g = 0; g < groups; ++g) {
+    int M = group_m[g], N = group_n[g], K = group_k[g];
+    block_aux0[g].copy_to_host(host_aux0[g].data());
+    block_aux1[g].copy_to_host(host_aux1[g].data());
+    std::vector<double> z(size_t(M) * N), relu(size_t(M) * N);
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        double acc = 0;
+        for (int k = 0; k < K; ++k) {
+          acc += double(host_A[g][m * K + k]) * double(host_B[g][n * K + k]);
+        }
+        z[size_t(m) * N + n] = alpha * acc;
+        relu[size_t(m) * N + n] = std::max(acc, 0.0);
+      }
+    }
+    if (!check_multi_output(host_aux0[g], z, M, N, ld_aux0[g], sentinel0, "Aux0", g) ||
+        !check_multi_output(host_aux1[g], relu, M, N, ld_aux1[g], sentinel1, "Aux1", g)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_aux_store_multi_grouped_all() {
+  // Extents below, at and above the tile shape, so groups switch tensormaps mid-wave
+  std::vector<int> group_m = {128, 64, 200, 8, 136, 256, 17};
+  std::vector<int> group_n = {128, 264, 64, 136, 200, 72, 128};
+  for (int k : {64, 264}) {
+    std::vector<int> group_k(group_m.size());
+    for (size_t g = 0; g < group_m.size(); ++g) {
+      group_k[g] = k + 8 * int(g % 3);
+    }
+    if (!test_aux_store_multi_grouped<GemmType>(group_m, group_n, group_k)) {
+      std::cerr << "Failed with K = " << k << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_AuxStoreMulti_F16_F32) {
+  using GemmType = test::gemm::device::AuxStoreMultiGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_aux_store_multi_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_AuxStoreMulti_F16_F32) {
+  using GemmType = test::gemm::device::AuxStoreMultiGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_aux_store_multi_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_AuxStoreMulti_F16_F32) {
+  using GemmType = test::gemm::device::AuxStoreMultiGemm<
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE(test::gemm::device::test_aux_store_multi_all<GemmType>());
+}
+
+#if defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+TEST(SM90_Device_Gemm_f16t_f16n_voidt_tensor_op_gmma_f32_group_gemm_aux_store_multi, 128x128x64_2x1x1_cooperative_F16_F32) {
+  using GemmType = test::gemm::device::AuxStoreMultiGroupedGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedCooperative,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_aux_store_multi_grouped_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_voidt_tensor_op_gmma_f32_group_gemm_aux_store_multi, 64x128x64_1x2x1_pingpong_F16_F32) {
+  using GemmType = test::gemm::device::AuxStoreMultiGroupedGemm<
+    Shape<_64,_128,_64>, Shape<_1,_2,_1>,
+    cutlass::gemm::KernelPtrArrayTmaWarpSpecializedPingpong,
+    cutlass::epilogue::PtrArrayTmaWarpSpecializedPingpong>;
+  EXPECT_TRUE(test::gemm::device::test_aux_store_multi_grouped_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_MODIFIABLE_TMA_SM90_SUPPORTED)
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
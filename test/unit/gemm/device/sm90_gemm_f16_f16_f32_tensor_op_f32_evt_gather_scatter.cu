@@ -0,0 +1,253 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 indexed gather broadcast and scatter store EVT nodes
+
+    A custom tree scales each row by a gathered per-row weight and scatters it through a row
+    index, the way an MoE expert GEMM combines its tokens back into the unpermuted output:
+      Z(m,n,l) = weight(gather(m,l),l) * acc(m,n,l),  P(scatter(m,l),n,l) (+)= Z(m,n,l),  D = Z
+    Weights are multiples of 1/8, so every product and atomic sum is exact in float.
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_gather_scatter.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <bool AtomicAdd, class TileShape_MNK, class ClusterShape_MNK,
+          class KernelSchedule, class EpilogueSchedule>
+struct GatherScatterGemm {
+  static constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  using WeightGather = cutlass::epilogue::fusion::Sm90ColBroadcastGather<float, float>;
+  using ScatterStore = cutlass::epilogue::fusion::Sm90ScatterRowStore<
+      float, float, RoundStyle, Stride<int64_t,_1,int64_t>, int32_t, AtomicAdd>;
+
+  using CustomEVT =  // P(scatter(m)) (+)= weight(gather(m)) * acc
+    cutlass::epilogue::fusion::Sm90EVT<ScatterStore,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::multiplies, float, float, RoundStyle>,
+        WeightGather,                              // weight(gather(m))
+        cutlass::epilogue::fusion::Sm90AccFetch    // acc
+      >
+    >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      EpilogueSchedule,
+      CustomEVT
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+// Without AtomicAdd, rows are scattered through a permutation of [0, M) with every 9th row
+// dropped. With AtomicAdd, rows 2t and 2t+1 (the top-2 experts of token t) accumulate into
+// output row t, and the weights use the identity gather.
+template <class GemmType, bool AtomicAdd>
+bool
+test_gather_scatter(int M, int N, int K, int L) {
+  using Gemm = typename GemmType::Gemm;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  // Weights are longer than M so the gather is not a permutation of them
+  int const num_weights = M + 13;
+  int const rows_out = AtomicAdd ? (M + 1) / 2 : M;
+  float const null_default = 0.5f;
+  float const sentinel = -12345.f;
+
+  std::vector<float> weight(size_t(num_weights) * L);
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = float(int(i % 17) - 8) / 8.f;
+  }
+  std::vector<int32_t> gather(size_t(M) * L), scatter(size_t(M) * L);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      gather[size_t(l) * M + m] = m % 11 == 10 ? -1 : (m * 5 + l + 1) % num_weights;
+      // 7 is coprime to the tested M, so the scatter is a permutation before dropping rows
+      scatter[size_t(l) * M + m] = AtomicAdd ? m / 2 : (m % 9 == 4 ? -1 : (m * 7 + 3) % M);
+    }
+  }
+
+  cutlass::DeviceAllocation<float> device_weight(weight.size());
+  cutlass::DeviceAllocation<int32_t> device_gather(gather.size()), device_scatter(scatter.size());
+  device_weight.copy_from_host(weight.data());
+  device_gather.copy_from_host(gather.data());
+  device_scatter.copy_from_host(scatter.data());
+
+  // Atomic outputs accumulate from zero, plain outputs keep the sentinel in rows nobody writes
+  std::vector<float> out(size_t(rows_out) * N * L, AtomicAdd ? 0.f : sentinel);
+  cutlass::DeviceAllocation<float> device_out(out.size());
+  device_out.copy_from_host(out.data());
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args{
+    {                                                    // binary op : weight * acc
+      {device_weight.get(), AtomicAdd ? nullptr : device_gather.get(), null_default,
+       {_1{}, _0{}, int64_t(num_weights)}, {_1{}, _0{}, int64_t(M)}}, // leaf args : weight(gather(m))
+      {},                                                // leaf args : acc
+      {}                                                 // binary args : multiplies
+    },                                                   // end binary op
+    {device_out.get(), device_scatter.get(),
+     {int64_t(N), _1{}, int64_t(rows_out) * N}, {_1{}, _0{}, int64_t(M)}} // unary args : scatter store
+  };
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+  device_out.copy_to_host(out.data());
+
+  std::vector<float> expected(out.size(), AtomicAdd ? 0.f : sentinel);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      double w = null_default;
+      if (AtomicAdd) {
+        w = weight[size_t(l) * num_weights + m];
+      }
+      else if (int32_t g = gather[size_t(l) * M + m]; g >= 0) {
+        w = weight[size_t(l) * num_weights + g];
+      }
+      int32_t s = scatter[size_t(l) * M + m];
+      for (int n = 0; n < N; ++n) {
+        double z = w * testbed.acc(m, n, l);
+        if (!fusion_close(testbed.d(m, n, l), z, 0, 0, "D", m, n, l)) {
+          return false;
+        }
+        if (s >= 0) {
+          float& p = expected[(size_t(l) * rows_out + s) * N + n];
+          p = AtomicAdd ? p + float(z) : float(z);
+        }
+      }
+    }
+  }
+  for (int l = 0; l < L; ++l) {
+    for (int r = 0; r < rows_out; ++r) {
+      for (int n = 0; n < N; ++n) {
+        size_t i = (size_t(l) * rows_out + r) * N + n;
+        if (!fusion_close(out[i], expected[i], 0, 0, "scattered output", r, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType, bool AtomicAdd>
+bool
+test_gather_scatter_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 264}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          if (!test_gather_scatter<GemmType, AtomicAdd>(m, n, k, l)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_VoidC_GatherScale_ScatterStore) {
+  using GemmType = test::gemm::device::GatherScatterGemm<false,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_gather_scatter_all<GemmType, false>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_VoidC_Scale_ScatterAtomicAdd) {
+  using GemmType = test::gemm::device::GatherScatterGemm<true,
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_gather_scatter_all<GemmType, true>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_VoidC_GatherScale_ScatterStore) {
+  using GemmType = test::gemm::device::GatherScatterGemm<false,
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_gather_scatter_all<GemmType, false>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,242 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 online softmax row statistics epilogue
+
+    The (row, N tile) partials are merged on the host and checked against the logsumexp and the
+    largest values of each row of alpha * acc + beta * C. Integer inputs produce many ties, so
+    top-k indices are checked by the values they point to.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <set>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/operations.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <int TopK, class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct OnlineSoftmaxGemm {
+  using FusionOperation = cutlass::epilogue::fusion::LinCombOnlineSoftmaxCol<TopK, float, float>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      EpilogueSchedule,
+      FusionOperation
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+  using Reduction = typename CollectiveEpilogue::FusionCallbacks::Reduction;
+};
+
+template <class GemmType, int TopK>
+bool
+test_online_softmax(int M, int N, int K, int L, float alpha, float beta) {
+  using Gemm = typename GemmType::Gemm;
+  using Reduction = typename GemmType::Reduction;
+  using Partial = typename Reduction::Partial;
+  using Candidates = typename Reduction::Candidates;
+  using TileShape = typename Gemm::GemmKernel::TileShape;
+  constexpr int TileM = size<0>(TileShape{});
+  constexpr int TileN = size<1>(TileShape{});
+
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  // Compact m-major (round_nearest(M,CTA_M), ceil_div(N,CTA_N), L) partials
+  int round_M = (M + TileM - 1) / TileM * TileM;
+  int tiles_N = (N + TileN - 1) / TileN;
+  size_t num_partials = size_t(round_M) * tiles_N * L;
+  cutlass::DeviceAllocation<Partial> partials(num_partials);
+  cutlass::DeviceAllocation<Candidates> topk(num_partials);
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args;
+  fusion_args.alpha = alpha;
+  fusion_args.beta = beta;
+  fusion_args.partials_ptr = partials.get();
+  fusion_args.topk_ptr = TopK > 0 ? topk.get() : nullptr;
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+  std::vector<Partial> host_partials(num_partials);
+  std::vector<Candidates> host_topk(num_partials);
+  partials.copy_to_host(host_partials.data());
+  if constexpr (TopK > 0) {
+    topk.copy_to_host(host_topk.data());
+  }
+
+  std::vector<double> row(N);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      double row_max = -std::numeric_limits<double>::infinity();
+      for (int n = 0; n < N; ++n) {
+        row[n] = alpha * testbed.acc(m, n, l) + beta * testbed.c(m, n, l);
+        row_max = std::max(row_max, row[n]);
+        // Values are passed through to D
+        if (!fusion_close(testbed.d(m, n, l), row[n], 0, 0, "D", m, n, l)) {
+          return false;
+        }
+      }
+      double sum = 0;
+      for (int n = 0; n < N; ++n) {
+        sum += std::exp(row[n] - row_max);
+      }
+
+      Partial merged;
+      Candidates merged_topk;
+      for (int j = 0; j < tiles_N; ++j) {
+        size_t idx = m + size_t(round_M) * j + size_t(round_M) * tiles_N * l;
+        merged.merge(host_partials[idx]);
+        if constexpr (TopK > 0) {
+          merged_topk.merge(host_topk[idx]);
+        }
+      }
+      if (!fusion_close(merged.max_, row_max, 0, 0, "row max", m, 0, l) ||
+          !fusion_close(merged.logsumexp(), row_max + std::log(sum), 1e-5, 1e-5, "logsumexp", m, 0, l)) {
+        return false;
+      }
+
+      if constexpr (TopK > 0) {
+        std::vector<double> sorted(row);
+        std::sort(sorted.begin(), sorted.end(), std::greater<double>());
+        std::set<int32_t> seen;
+        for (int j = 0; j < TopK && j < N; ++j) {
+          int32_t n = merged_topk.index_[j];
+          if (!fusion_close(merged_topk.value_[j], sorted[j], 0, 0, "top-k value", m, j, l)) {
+            return false;
+          }
+          if (n < 0 || n >= N || !seen.insert(n).second || row[n] != sorted[j]) {
+            std::cerr << "Bad top-k index " << n << " at rank " << j << " of row " << m << "," << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType, int TopK>
+bool
+test_online_softmax_all() {
+  for (int m : {128, 200}) {
+    // Several N tiles, with and without a partial last tile
+    for (int n : {256, 520}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          if (!test_online_softmax<GemmType, TopK>(m, n, k, l, 1.0f, 0.0f) ||
+              !test_online_softmax<GemmType, TopK>(m, n, k, l, 0.25f, 1.0f)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_OnlineSoftmax) {
+  using GemmType = test::gemm::device::OnlineSoftmaxGemm<0,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_online_softmax_all<GemmType, 0>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_OnlineSoftmax_Top4) {
+  using GemmType = test::gemm::device::OnlineSoftmaxGemm<4,
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_online_softmax_all<GemmType, 4>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_OnlineSoftmax_Top8) {
+  using GemmType = test::gemm::device::OnlineSoftmaxGemm<8,
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_online_softmax_all<GemmType, 8>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,246 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 peer memory store EVT node and its per-tile completion flags
+
+    The "peer" buffer is local device memory, which is what a peer-mapped pointer looks like to
+    the kernel, so the stores, the atomic accumulation and the tile flags are checked on a
+    single device. The multimem reduction needs a multicast object and is not covered here.
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"
+#include "cutlass/epilogue/fusion/sm90_visitor_peer_store.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <cutlass::epilogue::fusion::PeerStoreMode Mode, class TileShape_MNK, class ClusterShape_MNK,
+          class KernelSchedule, class EpilogueSchedule>
+struct PeerStoreGemm {
+  static constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+  using TileShape = TileShape_MNK;
+
+  using PeerStore = cutlass::epilogue::fusion::Sm90PeerStore<float, RoundStyle, Mode>;
+
+  using CustomEVT =  // P (+)= alpha * acc, D = alpha * acc
+    cutlass::epilogue::fusion::Sm90EVT<PeerStore,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::multiplies, float, float, RoundStyle>,
+        cutlass::epilogue::fusion::Sm90ScalarBroadcast<float>, // alpha
+        cutlass::epilogue::fusion::Sm90AccFetch                // acc
+      >
+    >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      EpilogueSchedule,
+      CustomEVT
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+// Runs the GEMM twice into the same peer buffer and flags. Plain stores leave P = Z, atomic
+// adds give P = P0 + 2Z, and every tile flag must have advanced exactly once per run.
+template <class GemmType, cutlass::epilogue::fusion::PeerStoreMode Mode>
+bool
+test_peer_store(int M, int N, int K, int L) {
+  using Gemm = typename GemmType::Gemm;
+  constexpr bool IsAtomic = Mode == cutlass::epilogue::fusion::PeerStoreMode::AtomicAdd;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  float const alpha = 0.5f;
+  // The peer buffer is padded along n to check that dPeer is honored
+  int const ld_peer = N + 8;
+  std::vector<float> peer(size_t(M) * ld_peer * L);
+  for (size_t i = 0; i < peer.size(); ++i) {
+    peer[i] = float(int(i % 13) - 6);
+  }
+  std::vector<float> expected = peer;
+  cutlass::DeviceAllocation<float> device_peer(peer.size());
+  device_peer.copy_from_host(peer.data());
+
+  int tiles_m = (M + size<0>(typename GemmType::TileShape{}) - 1) / size<0>(typename GemmType::TileShape{});
+  int tiles_n = (N + size<1>(typename GemmType::TileShape{}) - 1) / size<1>(typename GemmType::TileShape{});
+  std::vector<uint32_t> flags(size_t(tiles_m) * tiles_n * L, 0);
+  cutlass::DeviceAllocation<uint32_t> device_flags(flags.size());
+  device_flags.copy_from_host(flags.data());
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args{
+    {                          // binary op : alpha * acc
+      {{alpha}},               // leaf args : alpha
+      {},                      // leaf args : acc
+      {}                       // binary args : multiplies
+    },                         // end binary op
+    {device_peer.get(), {int64_t(ld_peer), _1{}, int64_t(M) * ld_peer}, device_flags.get()} // unary args : peer store
+  };
+
+  int const runs = 2;
+  for (int run = 0; run < runs; ++run) {
+    if (!testbed.run(fusion_args)) {
+      return false;
+    }
+  }
+  device_peer.copy_to_host(peer.data());
+  device_flags.copy_to_host(flags.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        double z = alpha * testbed.acc(m, n, l);
+        if (!fusion_close(testbed.d(m, n, l), z, 0, 0, "D", m, n, l)) {
+          return false;
+        }
+        float& p = expected[(size_t(l) * M + m) * ld_peer + n];
+        p = IsAtomic ? p + float(runs * z) : float(z);
+      }
+    }
+  }
+  // Padding columns must be untouched
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < ld_peer; ++n) {
+        size_t i = (size_t(l) * M + m) * ld_peer + n;
+        if (!fusion_close(peer[i], expected[i], 0, 0, "peer", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  for (int l = 0; l < L; ++l) {
+    for (int tn = 0; tn < tiles_n; ++tn) {
+      for (int tm = 0; tm < tiles_m; ++tm) {
+        uint32_t flag = flags[(size_t(l) * tiles_n + tn) * tiles_m + tm];
+        if (flag != uint32_t(runs)) {
+          std::cerr << "Tile flag (" << tm << "," << tn << "," << l << ") is " << flag
+                    << ", expected " << runs << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType, cutlass::epilogue::fusion::PeerStoreMode Mode>
+bool
+test_peer_store_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 264}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          if (!test_peer_store<GemmType, Mode>(m, n, k, l)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_VoidC_PeerStore) {
+  constexpr auto Mode = cutlass::epilogue::fusion::PeerStoreMode::Store;
+  using GemmType = test::gemm::device::PeerStoreGemm<Mode,
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_peer_store_all<GemmType, Mode>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_VoidC_PeerAtomicAdd) {
+  constexpr auto Mode = cutlass::epilogue::fusion::PeerStoreMode::AtomicAdd;
+  using GemmType = test::gemm::device::PeerStoreGemm<Mode,
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE((test::gemm::device::test_peer_store_all<GemmType, Mode>()));
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_VoidC_PeerAtomicAdd) {
+  constexpr auto Mode = cutlass::epilogue::fusion::PeerStoreMode::AtomicAdd;
+  using GemmType = test::gemm::device::PeerStoreGemm<Mode,
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE((test::gemm::device::test_peer_store_all<GemmType, Mode>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,250 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 scale * C tree visitor that folds to zero without loading C
+
+    A custom tree computes D = plus(scale * C, acc) with the scale * C product as its own node,
+    which is the shape Sm90TreeVisitor<Sm90Compute<multiplies>, InputScaleOp, Sm90SrcFetch>
+    specializes. A zero scale passes C as nullptr, so a C load would fault instead of being
+    masked by the zero product. A per-batch scale of zero must also discard a NaN source.
+*/
+
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+#include "cutlass/epilogue/fusion/sm90_callbacks_tma_warpspecialized.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct ScaledSourceGemm {
+  static constexpr auto RoundStyle = cutlass::FloatRoundStyle::round_to_nearest;
+
+  // The batch stride of the scale is dynamic so one kernel covers scalar and per-batch scales
+  using Scale = cutlass::epilogue::fusion::Sm90ScalarBroadcast<float, Stride<_0,_0,int64_t>>;
+
+  using CustomEVT =  // D = scale * C + acc
+    cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::plus, float, float, RoundStyle>,
+      cutlass::epilogue::fusion::Sm90EVT<cutlass::epilogue::fusion::Sm90Compute<cutlass::multiplies, float, float, RoundStyle>,
+        Scale,                                           // scale
+        cutlass::epilogue::fusion::Sm90SrcFetch<float>   // C
+      >,
+      cutlass::epilogue::fusion::Sm90AccFetch            // acc
+    >;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      float, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      EpilogueSchedule,
+      CustomEVT
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cutlass::half_t, cutlass::layout::RowMajor, 8,
+      cutlass::half_t, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// A scalar scale, with C passed as nullptr when it is zero
+template <class GemmType>
+bool
+test_scaled_source(int M, int N, int K, int L, float scale) {
+  using Gemm = typename GemmType::Gemm;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args{
+    {                                     // binary op : scale * C
+      {{scale}, {nullptr}, {{}}},         // leaf args : scale
+      {},                                 // leaf args : C
+      {}                                  // binary args : multiplies
+    },                                    // end binary op
+    {},                                   // leaf args : acc
+    {}                                    // binary args : plus
+  };
+  if (!testbed.run(fusion_args, /*null_C=*/scale == 0.f)) {
+    return false;
+  }
+
+  // Inputs are small integers and the scales dyadic, so D is exact
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        double expected = scale == 0.f ? testbed.acc(m, n, l) : scale * testbed.c(m, n, l) + testbed.acc(m, n, l);
+        if (!fusion_close(testbed.d(m, n, l), expected, 0, 0, "D", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+/// A per-batch scale read from device memory, zero in even batches whose C is all NaN
+template <class GemmType>
+bool
+test_scaled_source_batched(int M, int N, int K, int L) {
+  using Gemm = typename GemmType::Gemm;
+  FusionTestbed<Gemm> testbed(M, N, K, L);
+
+  std::vector<float> scale(L);
+  for (int l = 0; l < L; ++l) {
+    scale[l] = l % 2 == 0 ? 0.f : 0.25f * float(l + 1);
+    if (scale[l] == 0.f) {
+      for (int m = 0; m < M; ++m) {
+        for (int n = 0; n < N; ++n) {
+          testbed.tensor_C.at(m, n, l) = std::numeric_limits<float>::quiet_NaN();
+        }
+      }
+    }
+  }
+  testbed.tensor_C.to_device();
+  cutlass::DeviceAllocation<float> device_scale(L);
+  device_scale.copy_from_host(scale.data());
+
+  typename FusionTestbed<Gemm>::FusionArguments fusion_args{
+    {                                                         // binary op : scale * C
+      {{}, {device_scale.get()}, {{_0{}, _0{}, int64_t(1)}}}, // leaf args : scale(l)
+      {},                                                     // leaf args : C
+      {}                                                      // binary args : multiplies
+    },                                                        // end binary op
+    {},                                                       // leaf args : acc
+    {}                                                        // binary args : plus
+  };
+  if (!testbed.run(fusion_args)) {
+    return false;
+  }
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        double expected = scale[l] == 0.f ? testbed.acc(m, n, l) : scale[l] * testbed.c(m, n, l) + testbed.acc(m, n, l);
+        if (!fusion_close(testbed.d(m, n, l), expected, 0, 0, "D", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_scaled_source_all() {
+  for (int m : {128, 200}) {
+    for (int n : {128, 264}) {
+      for (int k : {64, 264}) {
+        for (int l : {1, 2}) {
+          if (!test_scaled_source<GemmType>(m, n, k, l, 0.f) ||
+              !test_scaled_source<GemmType>(m, n, k, l, 0.5f) ||
+              !test_scaled_source<GemmType>(m, n, k, l, -2.f)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+        if (!test_scaled_source_batched<GemmType>(m, n, k, 3)) {
+          std::cerr << "Failed with batched scale and problem size " << m << "x" << n << "x" << k << "x3" << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_1x1x1_ScaledSource_PlusAcc) {
+  using GemmType = test::gemm::device::ScaledSourceGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_scaled_source_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_cooperative_epilogue, 128x128x64_2x1x1_ScaledSource_PlusAcc) {
+  using GemmType = test::gemm::device::ScaledSourceGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_scaled_source_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_f16t_f16n_f32t_tensor_op_gmma_f32_pingpong_epilogue, 64x128x64_1x1x1_ScaledSource_PlusAcc) {
+  using GemmType = test::gemm::device::ScaledSourceGemm<
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE(test::gemm::device::test_scaled_source_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,277 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 triangular tile scheduler
+
+    SYRK (C = A * A^T with B = A) must compute the output tiles that intersect the Fill triangle
+    against a host GEMM and leave the tiles of the opposite triangle untouched. TRMM (C = A * B with
+    a triangular A) must match a host GEMM over the whole output while each tile only visits the
+    K tiles of its rows of the triangle; the opposite triangle of A holds garbage beyond one tile
+    of the diagonal, so reading skipped K tiles would show in the result.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/blas3_types.h"
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <cutlass::BlasMode Mode, cutlass::FillMode Fill>
+struct TriangularGemm {
+  using Element = cutlass::half_t;
+  using TileShape = Shape<_128,_128,_64>;
+  using ClusterShape = Shape<_1,_1,_1>;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape, ClusterShape,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      void, cutlass::layout::RowMajor, 4,
+      float, cutlass::layout::RowMajor, 4,
+      cutlass::epilogue::TmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      Element, cutlass::layout::RowMajor, 8,
+      Element, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape, ClusterShape,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      cutlass::gemm::KernelTmaWarpSpecializedCooperative
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue,
+      cutlass::gemm::TriangularScheduler<Mode, Fill>
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Whether element (m, n) lies in the Fill triangle, including the diagonal
+template <cutlass::FillMode Fill>
+bool
+in_triangle(int m, int n) {
+  return Fill == cutlass::FillMode::kLower ? m >= n : m <= n;
+}
+
+/// Runs D = A * B for a M x N x K problem with L batches and compares D against a host GEMM.
+/// For SYRK, B is A and N == K is unused. For TRMM, A is M x M with the opposite triangle zeroed
+/// within one tile of the diagonal and garbage beyond. `max_ctas` limits the grid if positive.
+template <cutlass::BlasMode Mode, cutlass::FillMode Fill>
+bool
+test_triangular(int M, int N, int K, int L, int max_ctas) {
+  using GemmType = TriangularGemm<Mode, Fill>;
+  using Gemm = typename GemmType::Gemm;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Element = typename GemmType::Element;
+  constexpr bool IsSyrk = Mode == cutlass::BlasMode::kSymmetric;
+  constexpr int TileM = size<0>(typename GemmType::TileShape{});
+  constexpr int TileN = size<1>(typename GemmType::TileShape{});
+
+  if constexpr (IsSyrk) {
+    N = M;
+  }
+  else {
+    K = M;
+  }
+
+  // Small integers keep the GEMM exact in float
+  std::mt19937 gen(2026 + M + N + K + L);
+  std::uniform_int_distribution<int> dist(-2, 2);
+  std::vector<Element> host_A(size_t(M) * K * L), host_B(size_t(N) * K * L);
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int k = 0; k < K; ++k) {
+        float value = float(dist(gen));
+        if constexpr (!IsSyrk) {
+          if (!in_triangle<Fill>(m, k)) {
+            // Zeros next to the diagonal, where K tiles straddle it, and garbage in the skipped ones
+            value = (m / TileM == k / TileM) ? 0.f : 100.f;
+          }
+        }
+        host_A[(size_t(l) * M + m) * K + k] = Element(value);
+      }
+    }
+  }
+  for (auto& x : host_B) { x = Element(float(dist(gen))); }
+
+  auto stride_A = cutlass::make_cute_packed_stride(typename GemmKernel::StrideA{}, {M, K, L});
+  auto stride_B = cutlass::make_cute_packed_stride(typename GemmKernel::StrideB{}, {N, K, L});
+  auto stride_C = cutlass::make_cute_packed_stride(typename GemmKernel::StrideC{}, {M, N, L});
+  auto stride_D = cutlass::make_cute_packed_stride(typename GemmKernel::StrideD{}, {M, N, L});
+
+  cutlass::DeviceAllocation<Element> block_A(host_A.size()), block_B(host_B.size());
+  block_A.copy_from_host(host_A.data());
+  block_B.copy_from_host(host_B.data());
+
+  // No exact product of the inputs takes this value
+  float const untouched = -1.0e30f;
+  std::vector<float> host_D(size_t(M) * N * L, untouched);
+  cutlass::DeviceAllocation<float> block_D(host_D.size());
+  block_D.copy_from_host(host_D.data());
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+  if (max_ctas > 0) {
+    hw_info.sm_count = std::min(hw_info.sm_count, max_ctas);
+  }
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    {block_A.get(), stride_A, IsSyrk ? block_A.get() : block_B.get(), stride_B},
+    {{}, nullptr, stride_C, block_D.get(), stride_D},
+    hw_info
+  };
+  arguments.epilogue.thread.alpha = 1.0f;
+  arguments.epilogue.thread.beta = 0.0f;
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << "x" << L << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+  block_D.copy_to_host(host_D.data());
+
+  std::vector<Element> const& operand_B = IsSyrk ? host_A : host_B;
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float expected = untouched;
+        // SYRK computes the tiles holding an element of the triangle, TRMM computes all tiles
+        bool computed = IsSyrk ? in_triangle<Fill>((m / TileM) * TileM + (Fill == cutlass::FillMode::kLower ? TileM - 1 : 0),
+                                                   (n / TileN) * TileN + (Fill == cutlass::FillMode::kLower ? 0 : TileN - 1))
+                               : true;
+        if (computed) {
+          float acc = 0;
+          for (int k = 0; k < K; ++k) {
+            // The garbage of a triangular A is outside of the operation
+            float a = float(host_A[(size_t(l) * M + m) * K + k]);
+            if (!IsSyrk && !in_triangle<Fill>(m, k)) {
+              a = 0.f;
+            }
+            acc += a * float(operand_B[(size_t(l) * N + n) * K + k]);
+          }
+          expected = acc;
+        }
+        float actual = host_D[(size_t(l) * M + m) * N + n];
+        if (actual != expected) {
+          std::cerr << "Mismatch at (" << m << "," << n << "," << l << "): " << actual << " != " << expected << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <cutlass::BlasMode Mode, cutlass::FillMode Fill>
+bool
+test_triangular_all() {
+  // Single tile, partial last tiles with batches, and more tiles than CTAs
+  for (int max_ctas : {0, 3}) {
+    for (auto [m, n, k, l] : {std::make_tuple(128, 128, 64, 1), std::make_tuple(520, 264, 136, 2),
+                              std::make_tuple(1024, 392, 256, 1)}) {
+      if (!test_triangular<Mode, Fill>(m, n, k, l, max_ctas)) {
+        std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l
+                  << " and " << max_ctas << " CTAs" << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Syrk_f16t_f32t_tensor_op_gmma_f32_triangular_scheduler, 128x128x64_1x1x1_lower) {
+  EXPECT_TRUE((test::gemm::device::test_triangular_all<cutlass::BlasMode::kSymmetric, cutlass::FillMode::kLower>()));
+}
+
+TEST(SM90_Device_Syrk_f16t_f32t_tensor_op_gmma_f32_triangular_scheduler, 128x128x64_1x1x1_upper) {
+  EXPECT_TRUE((test::gemm::device::test_triangular_all<cutlass::BlasMode::kSymmetric, cutlass::FillMode::kUpper>()));
+}
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32t_tensor_op_gmma_f32_triangular_scheduler, 128x128x64_1x1x1_lower) {
+  EXPECT_TRUE((test::gemm::device::test_triangular_all<cutlass::BlasMode::kTriangular, cutlass::FillMode::kLower>()));
+}
+
+TEST(SM90_Device_Trmm_f16t_f16n_f32t_tensor_op_gmma_f32_triangular_scheduler, 128x128x64_1x1x1_upper) {
+  EXPECT_TRUE((test::gemm::device::test_triangular_all<cutlass::BlasMode::kTriangular, cutlass::FillMode::kUpper>()));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
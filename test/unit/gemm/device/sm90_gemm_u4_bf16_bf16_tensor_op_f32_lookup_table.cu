@@ -0,0 +1,269 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 mixed-input mainloop with lookup-table dequantization
+
+    A holds 4-bit indices and every (row, K group) of A carries its own 16-entry bf16 table,
+    D = table[A] * B. The tables are rotations of a non-uniform integer codebook that differ
+    between neighbouring rows, groups and batches, so the products stay exact and any table
+    or index mix-up shows up in D.
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cute/atom/mma_atom.hpp"
+
+#include "cutlass/numeric_types.h"
+
+#include "cutlass/gemm/device/gemm_universal_adapter.h"
+#include "cutlass/gemm/kernel/gemm_universal.hpp"
+#include "cutlass/gemm/collective/collective_builder.hpp"
+#include "cutlass/epilogue/collective/collective_builder.hpp"
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "gemm_testbed_3x_fusion.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+template <class TileShape_MNK, class ClusterShape_MNK, class KernelSchedule, class EpilogueSchedule>
+struct LookupTableGemm {
+  using ElementA = cutlass::uint4b_t;
+  using ElementMma = cutlass::bfloat16_t;
+  // An Array of 16 16-bit values as the scale type selects ConversionMode::ConvertWithLookupTable
+  using ElementTable = cutlass::Array<ElementMma, 16>;
+  using ElementD = cutlass::bfloat16_t;
+
+  using CollectiveEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::epilogue::collective::EpilogueTileAuto,
+      float, float,
+      ElementD, cutlass::layout::RowMajor, 8,
+      ElementD, cutlass::layout::RowMajor, 8,
+      EpilogueSchedule
+    >::CollectiveOp;
+
+  using CollectiveMainloop = typename cutlass::gemm::collective::CollectiveBuilder<
+      cutlass::arch::Sm90, cutlass::arch::OpClassTensorOp,
+      cute::tuple<ElementA, ElementTable>, cutlass::layout::RowMajor, 32,
+      ElementMma, cutlass::layout::ColumnMajor, 8,
+      float,
+      TileShape_MNK, ClusterShape_MNK,
+      cutlass::gemm::collective::StageCountAutoCarveout<static_cast<int>(sizeof(typename CollectiveEpilogue::SharedStorage))>,
+      KernelSchedule
+    >::CollectiveOp;
+
+  using GemmKernel = cutlass::gemm::kernel::GemmUniversal<
+      Shape<int,int,int,int>,
+      CollectiveMainloop,
+      CollectiveEpilogue
+    >;
+
+  using Gemm = cutlass::gemm::device::GemmUniversalAdapter<GemmKernel>;
+};
+
+/// Non-uniform codebook, the entry of index i in the table of (m, g, l) is rotated by m, g and l
+inline float
+lookup_table_entry(int i, int m, int g, int l) {
+  static constexpr int codebook[16] = {-8, -6, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 7, 9, 12, 16};
+  return float(codebook[(i + 3 * m + 5 * g + 7 * l) % 16]);
+}
+
+template <class GemmType>
+bool
+test_lookup_table(int M, int N, int K, int L, int group_size) {
+  using Gemm = typename GemmType::Gemm;
+  using ElementMma = typename GemmType::ElementMma;
+  using ElementTable = typename GemmType::ElementTable;
+  using ElementD = typename GemmType::ElementD;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using StrideA = typename GemmKernel::StrideA;
+  using StrideB = typename GemmKernel::StrideB;
+  using StrideC = typename GemmKernel::StrideC;
+  using StrideD = typename GemmKernel::StrideD;
+  using StrideS = typename GemmKernel::CollectiveMainloop::StrideScale;
+
+  int const scale_k = (K + group_size - 1) / group_size;
+
+  // Packed row-major 4-bit indices, two per byte with the lower index in the low nibble
+  std::vector<int> index(size_t(M) * K * L);
+  std::vector<uint8_t> packed_A((index.size() + 1) / 2, 0);
+  for (size_t i = 0; i < index.size(); ++i) {
+    index[i] = int((i * 2654435761ull >> 7) % 16);
+    packed_A[i / 2] |= uint8_t(index[i] << (4 * (i % 2)));
+  }
+  cutlass::DeviceAllocation<uint8_t> device_A(packed_A.size());
+  device_A.copy_from_host(packed_A.data());
+  StrideA stride_A = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(M, K, L));
+
+  // The tables are M-major like the scales, one per (m, g, l)
+  std::vector<ElementTable> tables(size_t(M) * scale_k * L);
+  for (int l = 0; l < L; ++l) {
+    for (int g = 0; g < scale_k; ++g) {
+      for (int m = 0; m < M; ++m) {
+        for (int i = 0; i < 16; ++i) {
+          tables[(size_t(l) * scale_k + g) * M + m][i] = ElementMma(lookup_table_entry(i, m, g, l));
+        }
+      }
+    }
+  }
+  cutlass::DeviceAllocation<ElementTable> device_tables(tables.size());
+  device_tables.copy_from_host(tables.data());
+  StrideS stride_S = cutlass::make_cute_packed_stride(StrideS{}, cute::make_shape(M, scale_k, L));
+
+  FusionOperand<ElementMma, StrideB> tensor_B;
+  FusionOperand<ElementD, StrideC> tensor_C;
+  FusionOperand<ElementD, StrideD> tensor_D;
+  tensor_B.reset(N, K, L);
+  tensor_C.reset(M, N, L);
+  tensor_D.reset(M, N, L);
+  tensor_B.fill(2026, 2);
+  tensor_B.to_device();
+  tensor_C.to_device();
+  tensor_D.to_device();
+
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.device_id = 0;
+  hw_info.sm_count = cutlass::KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+
+  typename Gemm::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    {reinterpret_cast<typename GemmType::ElementA const*>(device_A.get()), stride_A,
+     tensor_B.device.get(), tensor_B.stride,
+     device_tables.get(), stride_S, group_size},
+    {{1.f, 0.f},
+     tensor_C.device.get(), tensor_C.stride,
+     tensor_D.device.get(), tensor_D.stride},
+    hw_info
+  };
+
+  Gemm gemm;
+  if (gemm.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM cannot implement " << M << "x" << N << "x" << K << "x" << L
+              << " with group size " << group_size << std::endl;
+    return false;
+  }
+  cutlass::device_memory::allocation<uint8_t> workspace(Gemm::get_workspace_size(arguments));
+  if (gemm.initialize(arguments, workspace.get()) != cutlass::Status::kSuccess ||
+      gemm.run() != cutlass::Status::kSuccess) {
+    std::cerr << "GEMM failed to launch" << std::endl;
+    return false;
+  }
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMM failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+  tensor_D.to_host();
+
+  for (int l = 0; l < L; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        // Integer products stay exact in the f32 accumulator
+        double sum = 0;
+        for (int k = 0; k < K; ++k) {
+          int i = index[(size_t(l) * M + m) * K + k];
+          sum += double(lookup_table_entry(i, m, k / group_size, l)) * double(tensor_B.at(n, k, l));
+        }
+        if (!fusion_close(double(tensor_D.at(m, n, l)), double(ElementD(float(sum))), 0.0, 0.0, "D", m, n, l)) {
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+
+template <class GemmType>
+bool
+test_lookup_table_all() {
+  constexpr int TileK = size<2>(typename GemmType::GemmKernel::TileShape{});
+  for (int m : {128, 200}) {
+    for (int n : {128, 264}) {
+      for (int k : {4 * TileK, 5 * TileK + 32}) {
+        for (int l : {1, 2}) {
+          // One table per k-tile, per two k-tiles with a partial last group, and per row
+          for (int group_size : {TileK, 2 * TileK, k}) {
+            if (!test_lookup_table<GemmType>(m, n, k, l, group_size)) {
+              std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l
+                        << " and group size " << group_size << std::endl;
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemm_u4t_bf16n_bf16t_tensor_op_gmma_f32_cooperative_lookup_table, 128x128x64_1x1x1) {
+  using GemmType = test::gemm::device::LookupTableGemm<
+    Shape<_128,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_lookup_table_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_u4t_bf16n_bf16t_tensor_op_gmma_f32_cooperative_lookup_table, 128x128x64_2x1x1) {
+  using GemmType = test::gemm::device::LookupTableGemm<
+    Shape<_128,_128,_64>, Shape<_2,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedCooperative,
+    cutlass::epilogue::TmaWarpSpecializedCooperative>;
+  EXPECT_TRUE(test::gemm::device::test_lookup_table_all<GemmType>());
+}
+
+TEST(SM90_Device_Gemm_u4t_bf16n_bf16t_tensor_op_gmma_f32_pingpong_lookup_table, 64x128x64_1x1x1) {
+  using GemmType = test::gemm::device::LookupTableGemm<
+    Shape<_64,_128,_64>, Shape<_1,_1,_1>,
+    cutlass::gemm::KernelTmaWarpSpecializedPingpong,
+    cutlass::epilogue::TmaWarpSpecialized>;
+  EXPECT_TRUE(test::gemm::device::test_lookup_table_all<GemmType>());
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,251 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the SM90 TMA GEMV kernel with cluster split-K
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/gemm/device/gemv_universal_adapter.h"
+#include "cutlass/gemm/kernel/sm90_gemv_tma_split_k.hpp"
+#include "cutlass/util/device_memory.h"
+
+#include "../../common/cutlass_unit_test.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+using namespace cute;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace test::gemm::device {
+
+/// Fills a tensor with small integers, which the kernel and the reference compute exactly
+template <class Element>
+void
+fill_integers(std::vector<Element>& data, uint32_t seed, int min_value, int max_value) {
+  uint32_t state = seed;
+  for (auto& value : data) {
+    state = state * 1664525u + 1013904223u;
+    value = Element(float(min_value + int((state >> 16) % uint32_t(max_value - min_value + 1))));
+  }
+}
+
+/// Runs the GEMV on an M x N x K x L problem and checks D against a host reference.
+/// With PDL, a second GEMV consuming the output of the first as C is launched with programmatic
+/// dependent launch, which only reads the right C if it waits for the first one.
+template <class Gemv>
+bool
+test_gemv(int M, int N, int K, int L, float alpha, float beta, bool use_pdl = false) {
+  using GemvKernel = typename Gemv::GemvKernel;
+  using ElementA = typename GemvKernel::ElementA;
+  using ElementB = typename GemvKernel::ElementB;
+  using ElementC = typename GemvKernel::ElementC;
+  using ElementD = typename GemvKernel::ElementD;
+  using ElementScale = typename GemvKernel::NonVoidElementScale;
+  constexpr bool IsScaled = GemvKernel::IsScaled;
+  constexpr int ScaleGranularityK = GemvKernel::ScaleGranularityK;
+  static_assert(cute::is_same_v<ElementC, ElementD>);
+
+  int scale_k = IsScaled ? cute::ceil_div(K, ScaleGranularityK) : 1;
+
+  std::vector<ElementA> host_A(size_t(M) * K * L);
+  std::vector<ElementB> host_B(size_t(N) * K * L);
+  std::vector<ElementC> host_C(size_t(M) * N * L);
+  std::vector<ElementScale> host_S(size_t(M) * scale_k * L);
+  fill_integers(host_A, 2023, -2, 2);
+  fill_integers(host_B, 2024, -2, 2);
+  fill_integers(host_C, 2025, -4, 4);
+  // Powers of two keep the scaled products exact
+  for (size_t i = 0; i < host_S.size(); ++i) {
+    host_S[i] = ElementScale(float(1 << (i % 3)) * 0.5f);
+  }
+
+  cutlass::DeviceAllocation<ElementA> A(host_A.size());
+  cutlass::DeviceAllocation<ElementB> B(host_B.size());
+  cutlass::DeviceAllocation<ElementC> C(host_C.size());
+  cutlass::DeviceAllocation<ElementScale> S(host_S.size());
+  cutlass::DeviceAllocation<ElementD> D(host_C.size());
+  cutlass::DeviceAllocation<ElementD> D_dependent(host_C.size());
+  A.copy_from_host(host_A.data());
+  B.copy_from_host(host_B.data());
+  C.copy_from_host(host_C.data());
+  S.copy_from_host(host_S.data());
+  cudaMemset(D.get(), 0, D.bytes());
+  cudaMemset(D_dependent.get(), 0, D_dependent.bytes());
+
+  typename GemvKernel::StrideA stride_A{int64_t(K), {}, int64_t(M) * K};
+  typename GemvKernel::StrideB stride_B{int64_t(K), {}, int64_t(N) * K};
+  typename GemvKernel::StrideC stride_C{{}, int64_t(M), int64_t(M) * N};
+  typename GemvKernel::StrideD stride_D{{}, int64_t(M), int64_t(M) * N};
+  typename GemvKernel::StrideScale stride_S{{}, int64_t(M), int64_t(M) * scale_k};
+
+  typename Gemv::Arguments arguments{
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    {M, N, K, L},
+    {A.get(), stride_A, B.get(), stride_B, IsScaled ? S.get() : nullptr, stride_S},
+    {{alpha, beta}, C.get(), stride_C, D.get(), stride_D}
+  };
+
+  Gemv gemv;
+  if (gemv.can_implement(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMV cannot implement " << M << "x" << N << "x" << K << "x" << L << std::endl;
+    return false;
+  }
+  if (gemv.run(arguments) != cutlass::Status::kSuccess) {
+    std::cerr << "GEMV failed to launch" << std::endl;
+    return false;
+  }
+
+  // D_dependent = alpha * A * B + 1 * D
+  Gemv gemv_dependent;
+  if (use_pdl) {
+    typename Gemv::Arguments arguments_dependent = arguments;
+    arguments_dependent.epilogue.thread = {alpha, 1.0f};
+    arguments_dependent.epilogue.ptr_C = D.get();
+    arguments_dependent.epilogue.ptr_D = D_dependent.get();
+    if (gemv_dependent.run(arguments_dependent, nullptr, nullptr, nullptr, /* launch_with_pdl = */ true) !=
+        cutlass::Status::kSuccess) {
+      std::cerr << "GEMV failed to launch with PDL" << std::endl;
+      return false;
+    }
+  }
+
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    std::cerr << "GEMV failed with error: " << cudaGetErrorString(result) << std::endl;
+    return false;
+  }
+
+  std::vector<ElementD> host_D(host_C.size());
+  std::vector<ElementD> host_D_dependent(host_C.size());
+  D.copy_to_host(host_D.data());
+  D_dependent.copy_to_host(host_D_dependent.data());
+
+  for (int l = 0; l < L; ++l) {
+    for (int n = 0; n < N; ++n) {
+      for (int m = 0; m < M; ++m) {
+        float accum = 0.0f;
+        for (int k = 0; k < K; ++k) {
+          float scale = IsScaled ? float(host_S[(size_t(l) * scale_k + k / ScaleGranularityK) * M + m]) : 1.0f;
+          accum += scale * float(host_A[(size_t(l) * M + m) * K + k]) * float(host_B[(size_t(l) * N + n) * K + k]);
+        }
+        size_t idx = (size_t(l) * N + n) * M + m;
+        ElementD expected = ElementD(alpha * accum + beta * float(host_C[idx]));
+        if (float(host_D[idx]) != float(expected)) {
+          std::cerr << "Mismatch of D at (" << m << "," << n << "," << l << "): "
+                    << float(host_D[idx]) << " != " << float(expected) << std::endl;
+          return false;
+        }
+        if (use_pdl) {
+          ElementD expected_dependent = ElementD(alpha * accum + float(expected));
+          if (float(host_D_dependent[idx]) != float(expected_dependent)) {
+            std::cerr << "Mismatch of the dependent D at (" << m << "," << n << "," << l << "): "
+                      << float(host_D_dependent[idx]) << " != " << float(expected_dependent) << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/// Sweeps problem sizes K which are not multiples of the tile K, split into fewer K tiles than
+/// splits, and split into a number of K tiles not divisible by the number of splits
+template <class Gemv>
+bool
+test_gemv_sweep(int max_n) {
+  constexpr int TileM = Gemv::GemvKernel::TileM;
+  int alignment_k = Gemv::kAlignmentA > Gemv::kAlignmentB ? Gemv::kAlignmentA : Gemv::kAlignmentB;
+  // M stays a multiple of 8 so the M-major scale tensor meets the TMA alignment
+  for (int m : {TileM, 3 * TileM + 8}) {
+    for (int n : {1, max_n}) {
+      for (int k : {256, 512 + alignment_k, 5 * 256 + 64, 4096}) {
+        for (int l : {1, 2}) {
+          if (!test_gemv<Gemv>(m, n, k, l, 1.0f, 0.0f) || !test_gemv<Gemv>(m, n, k, l, 2.0f, 1.0f)) {
+            std::cerr << "Failed with problem size " << m << "x" << n << "x" << k << "x" << l << std::endl;
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace test::gemm::device
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(SM90_Device_Gemv_bf16t_bf16t_bf16n_tma_split_k, 32x8x256_1x1x4) {
+  using Gemv = cutlass::gemm::device::GemvUniversalAdapter<
+    cutlass::gemm::kernel::Sm90GemvTmaSplitK<
+      cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+      Shape<_32,_8,_256>, Shape<_1,_1,_4>, 6>>;
+  EXPECT_TRUE(test::gemm::device::test_gemv_sweep<Gemv>(8));
+  EXPECT_TRUE(test::gemm::device::test_gemv<Gemv>(128, 8, 2048, 1, 1.0f, 0.0f, /* use_pdl = */ true));
+}
+
+TEST(SM90_Device_Gemv_bf16t_bf16t_bf16n_tma_split_k, 16x16x256_1x1x1) {
+  using Gemv = cutlass::gemm::device::GemvUniversalAdapter<
+    cutlass::gemm::kernel::Sm90GemvTmaSplitK<
+      cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+      Shape<_16,_16,_256>, Shape<_1,_1,_1>, 6>>;
+  EXPECT_TRUE(test::gemm::device::test_gemv_sweep<Gemv>(16));
+}
+
+TEST(SM90_Device_Gemv_e4m3t_e4m3t_bf16n_tma_split_k, 32x8x256_1x1x4) {
+  using Gemv = cutlass::gemm::device::GemvUniversalAdapter<
+    cutlass::gemm::kernel::Sm90GemvTmaSplitK<
+      cutlass::float_e4m3_t, cutlass::float_e4m3_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+      Shape<_32,_8,_256>, Shape<_1,_1,_4>, 8>>;
+  EXPECT_TRUE(test::gemm::device::test_gemv_sweep<Gemv>(8));
+  EXPECT_TRUE(test::gemm::device::test_gemv<Gemv>(128, 8, 2048, 1, 1.0f, 0.0f, /* use_pdl = */ true));
+}
+
+TEST(SM90_Device_Gemv_e4m3t_bf16t_bf16n_tma_split_k_scaled, 32x8x256_1x1x2_group128) {
+  using Gemv = cutlass::gemm::device::GemvUniversalAdapter<
+    cutlass::gemm::kernel::Sm90GemvTmaSplitK<
+      cutlass::float_e4m3_t, cutlass::bfloat16_t, cutlass::bfloat16_t, cutlass::bfloat16_t,
+      Shape<_32,_8,_256>, Shape<_1,_1,_2>, 6, cutlass::bfloat16_t, 128>>;
+  EXPECT_TRUE(test::gemm::device::test_gemv_sweep<Gemv>(8));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,217 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the batched GEMM of tiny problems
+*/
+
+#include <iostream>
+#include <vector>
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/gemm/device/tiny_gemm_batched.hpp"
+
+#include "cutlass/util/device_memory.h"
+
+#include "cute/tensor.hpp"
+
+#if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs a batch of problems with the given batch strides and compares against a host reference.
+/// Operands hold small integers, so the products and sums are exact.
+template <typename Gemm>
+bool TestTinyGemmBatched(
+  int batch_count,
+  int64_t batch_stride_A,
+  int64_t batch_stride_B,
+  int64_t batch_stride_C,
+  float alpha = 1.f,
+  float beta = 0.f) {
+
+  using namespace cute;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using ElementA = typename Gemm::ElementA;
+  using ElementB = typename Gemm::ElementB;
+  using ElementC = typename Gemm::ElementC;
+  using ElementCompute = typename GemmKernel::ElementCompute;
+
+  constexpr int M = GemmKernel::M;
+  constexpr int N = GemmKernel::N;
+  constexpr int K = GemmKernel::K;
+  typename GemmKernel::ProblemLayoutA layout_A;
+  typename GemmKernel::ProblemLayoutB layout_B;
+  typename GemmKernel::ProblemLayoutC layout_C;
+
+  int64_t capacity_A = int64_t(batch_count - 1) * batch_stride_A + M * K;
+  int64_t capacity_B = int64_t(batch_count - 1) * batch_stride_B + N * K;
+  int64_t capacity_C = int64_t(batch_count - 1) * batch_stride_C + M * N;
+
+  std::vector<ElementA> host_A(capacity_A);
+  std::vector<ElementB> host_B(capacity_B);
+  std::vector<ElementC> host_C(capacity_C);
+  for (int64_t i = 0; i < capacity_A; ++i) {
+    host_A[i] = ElementA(int((i * 7919) % 5) - 2);
+  }
+  for (int64_t i = 0; i < capacity_B; ++i) {
+    host_B[i] = ElementB(int((i * 104729) % 5) - 2);
+  }
+  for (int64_t i = 0; i < capacity_C; ++i) {
+    host_C[i] = ElementC(int((i * 31) % 7) - 3);
+  }
+
+  cutlass::DeviceAllocation<ElementA> device_A(capacity_A);
+  cutlass::DeviceAllocation<ElementB> device_B(capacity_B);
+  cutlass::DeviceAllocation<ElementC> device_C(capacity_C);
+  cutlass::DeviceAllocation<ElementC> device_D(capacity_C);
+  device_A.copy_from_host(host_A.data());
+  device_B.copy_from_host(host_B.data());
+  device_C.copy_from_host(host_C.data());
+
+  typename Gemm::Arguments args;
+  args.batch_count = batch_count;
+  args.ptr_A = device_A.get();
+  args.batch_stride_A = batch_stride_A;
+  args.ptr_B = device_B.get();
+  args.batch_stride_B = batch_stride_B;
+  args.ptr_C = device_C.get();
+  args.batch_stride_C = batch_stride_C;
+  args.ptr_D = device_D.get();
+  args.batch_stride_D = batch_stride_C;
+  args.epilogue = {ElementCompute(alpha), ElementCompute(beta)};
+
+  Gemm gemm;
+  EXPECT_EQ(gemm.can_implement(args), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm(args), cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  std::vector<ElementC> host_D(capacity_C);
+  device_D.copy_to_host(host_D.data());
+
+  //
+  // Reference check
+  //
+  for (int l = 0; l < batch_count; ++l) {
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0.f;
+        for (int k = 0; k < K; ++k) {
+          accum += float(host_A[l * batch_stride_A + layout_A(m, k)]) *
+                   float(host_B[l * batch_stride_B + layout_B(n, k)]);
+        }
+        int64_t offset = l * batch_stride_C + layout_C(m, n);
+        float expected = alpha * accum + beta * float(host_C[offset]);
+        float got = float(host_D[offset]);
+        EXPECT_EQ(expected, got);
+        if (expected != got) {
+          std::cerr
+            << "Error in problem " << l << " at (" << m << ", " << n << ")" << std::endl
+            << "  expected: " << expected << std::endl
+            << "       got: " << got << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Densely packed 16x16x16 problems, each operand of a stage is one contiguous copy. The batch
+/// counts leave partial tiles and exceed one wave of persistent CTAs.
+TEST(SM80_Device_TinyGemmBatched, f16t_f16n_f32t_16x16x16_packed) {
+
+  using GemmKernel = cutlass::gemm::kernel::TinyGemmBatched<
+    cutlass::half_t, cutlass::layout::RowMajor,
+    cutlass::half_t, cutlass::layout::ColumnMajor,
+    float, cutlass::layout::RowMajor,
+    cute::Shape<cute::_16, cute::_16, cute::_16>>;
+  using Gemm = cutlass::gemm::device::TinyGemmBatched<GemmKernel>;
+
+  int const batch_counts[] = {1, 7, 1000, 100003};
+  for (int batch_count : batch_counts) {
+    EXPECT_TRUE(TestTinyGemmBatched<Gemm>(batch_count, 16 * 16, 16 * 16, 16 * 16));
+  }
+}
+
+/// 64x64x64 problems with column-major A and a padded batch stride, so every problem is a
+/// separate copy, with beta scaling of C
+TEST(SM80_Device_TinyGemmBatched, f16n_f16n_f16t_64x64x64_padded) {
+
+  using GemmKernel = cutlass::gemm::kernel::TinyGemmBatched<
+    cutlass::half_t, cutlass::layout::ColumnMajor,
+    cutlass::half_t, cutlass::layout::ColumnMajor,
+    cutlass::half_t, cutlass::layout::RowMajor,
+    cute::Shape<cute::_64, cute::_64, cute::_64>,
+    float, cute::SM80_16x8x16_F32F16F16F32_TN, 4, 1, 2, float>;
+  using Gemm = cutlass::gemm::device::TinyGemmBatched<GemmKernel>;
+
+  EXPECT_TRUE(TestTinyGemmBatched<Gemm>(517, 64 * 64 + 8, 64 * 64 + 64, 64 * 64, 1.f, 2.f));
+}
+
+/// Unaligned batch strides fall back to element-wise loads
+TEST(SM80_Device_TinyGemmBatched, bf16t_bf16t_f32n_32x16x32_unaligned) {
+
+  using GemmKernel = cutlass::gemm::kernel::TinyGemmBatched<
+    cutlass::bfloat16_t, cutlass::layout::RowMajor,
+    cutlass::bfloat16_t, cutlass::layout::RowMajor,
+    float, cutlass::layout::ColumnMajor,
+    cute::Shape<cute::_32, cute::_16, cute::_32>>;
+  using Gemm = cutlass::gemm::device::TinyGemmBatched<GemmKernel>;
+
+  EXPECT_TRUE(TestTinyGemmBatched<Gemm>(333, 32 * 32 + 1, 16 * 32 + 3, 32 * 16 + 5, 1.f, -1.f));
+}
+
+/// Double-precision 16x16x16 problems with several problems per warp
+TEST(SM80_Device_TinyGemmBatched, f64t_f64n_f64t_16x16x16) {
+
+  using GemmKernel = cutlass::gemm::kernel::TinyGemmBatched<
+    double, cutlass::layout::RowMajor,
+    double, cutlass::layout::ColumnMajor,
+    double, cutlass::layout::RowMajor,
+    cute::Shape<cute::_16, cute::_16, cute::_16>,
+    double, cute::SM80_8x8x4_F64F64F64F64_TN, 4, 3>;
+  using Gemm = cutlass::gemm::device::TinyGemmBatched<GemmKernel>;
+
+  EXPECT_TRUE(TestTinyGemmBatched<Gemm>(2049, 16 * 16, 16 * 16, 16 * 16, 2.f, 1.f));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // #if defined(CUTLASS_ARCH_MMA_SM80_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
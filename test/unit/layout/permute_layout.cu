@@ -0,0 +1,96 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+\brief unit tests for permuted CuTe operand layouts
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/layout/permute_layout.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Layout_PermuteLayout, bhsd_matrix_layout) {
+  using namespace cute;
+  int B = 2, S = 5, H = 3, D = 8;
+  auto layout = cutlass::layout::make_bhsd_matrix_layout(B, S, H, D);
+
+  EXPECT_EQ(size<0>(layout), B * S);
+  EXPECT_EQ(size<1>(layout), H * D);
+
+  // Row m = b*S + s, column n = h*D + d lands at the packed [B,H,S,D] offset
+  for (int b = 0; b < B; ++b) {
+    for (int s = 0; s < S; ++s) {
+      for (int h = 0; h < H; ++h) {
+        for (int d = 0; d < D; ++d) {
+          int64_t reference = ((int64_t(b) * H + h) * S + s) * D + d;
+          EXPECT_EQ(layout(b * S + s, h * D + d, 0), reference);
+        }
+      }
+    }
+  }
+
+  EXPECT_TRUE(cutlass::layout::is_tma_expressible<cutlass::half_t>(layout));
+  // A 4-element head dimension of fp16 is only 8B, which is not a valid TMA stride
+  EXPECT_FALSE(cutlass::layout::is_tma_expressible<cutlass::half_t>(
+    cutlass::layout::make_bhsd_matrix_layout(B, S, H, 4)));
+}
+
+TEST(Layout_PermuteLayout, permuted_layout_head_split) {
+  using namespace cute;
+  using X = cutlass::layout::X;
+  // [B*S, H*D] row-major GEMM output stored as a packed [B,H,S,D] tensor
+  constexpr int S = 4, D = 16;
+  int B = 3, H = 2;
+  auto packed = make_layout(make_shape(B * S, H * D, 1), make_stride(H * D, _1{}, B * S * H * D));
+  auto layout = cutlass::layout::make_permuted_layout(packed,
+    Shape<Shape<Int<S>, X>, Shape<Int<D>, X>, Shape<X>>{},
+    Step<Step<_1, _3>, Step<_0, _2>, Step<_4>>{});
+  auto reference = cutlass::layout::make_bhsd_matrix_layout(B, S, H, D);
+
+  for (int m = 0; m < B * S; ++m) {
+    for (int n = 0; n < H * D; ++n) {
+      EXPECT_EQ(int64_t(layout(m, n, 0)), int64_t(reference(m, n, 0)));
+    }
+  }
+  EXPECT_TRUE(cutlass::layout::is_tma_expressible<float>(layout));
+}
+
+TEST(Layout_PermuteLayout, tma_rank_limit) {
+  using namespace cute;
+  // Six non-contiguous modes cannot be described by a single TMA descriptor
+  auto layout = make_layout(
+    make_shape(make_shape(2, 2, 2), make_shape(8, 2, 2), 1),
+    make_stride(make_stride(8, 64, 512), make_stride(_1{}, 16, 128), 0));
+  EXPECT_FALSE(cutlass::layout::is_tma_expressible<float>(layout));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
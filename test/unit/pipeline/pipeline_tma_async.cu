@@ -79,7 +79,7 @@ void pipeline_device(uint32_t const NumIterations)
   using SharedStorage = SharedStorage<NumStages>;
   SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(shared_memory);
 
-  [[maybe_unused]] auto cta_layout = Layout<ClusterShape>{}; // (m,n) -> cta_id
+  [[maybe_unused]] auto cta_layout = Layout<ClusterShape>{}; // (m,n,k) -> cta_id
   int warp_idx = __shfl_sync(0xffffffff, threadIdx.x / 32, 0);
   int warp_group_thread_idx = threadIdx.x % 128;
   dim3 block_id_in_cluster = cute::block_id_in_cluster();
@@ -198,7 +198,7 @@ struct PipelineTest {
     // Pipeline (multistage pipeline)
     [[maybe_unused]] auto num_stages = Int<Stages>{};
 
-    auto cluster_shape = Shape<Int<ClusterShape::kM>, Int<ClusterShape::kN>, _1>{};
+    auto cluster_shape = Shape<Int<ClusterShape::kM>, Int<ClusterShape::kN>, Int<ClusterShape::kK>>{};
 
     //
     // Configure and launch
@@ -231,8 +231,8 @@ struct PipelineTest {
         smem_size);
 
       // Launch a single Cluster, with 128 thread per CTA
-      dim3 dimCluster(size<0>(cluster_shape), size<1>(cluster_shape), 1);
-      dim3 dimGrid(size<0>(cluster_shape), size<1>(cluster_shape), 1);
+      dim3 dimCluster(size<0>(cluster_shape), size<1>(cluster_shape), size<2>(cluster_shape));
+      dim3 dimGrid(size<0>(cluster_shape), size<1>(cluster_shape), size<2>(cluster_shape));
       dim3 dimBlock(kBlockSize,1,1);
 
       const void* kernel = (const void*)pipeline_device<decltype(cluster_shape), Stages>;
@@ -460,4 +460,32 @@ TEST(SM90_Verify_PipelineTmaAsync, Cluster4x2_Stage7) {
   Testbed<Test> testbed(options);
   EXPECT_TRUE(testbed.verification());
 }
+
+// Clusters extending along the third mode hold independent pipelines in every (m,n) slice
+TEST(SM90_Verify_PipelineTmaAsync, Cluster1x1x2_Stage5) {
+  Options options;
+  using ClusterShape = cutlass::gemm::GemmShape<1, 1, 2>;
+  static constexpr uint32_t Stages = 5;
+  using Test = PipelineTest<Stages, ClusterShape>;
+  Testbed<Test> testbed(options);
+  EXPECT_TRUE(testbed.verification());
+}
+
+TEST(SM90_Verify_PipelineTmaAsync, Cluster1x1x4_Stage7) {
+  Options options;
+  using ClusterShape = cutlass::gemm::GemmShape<1, 1, 4>;
+  static constexpr uint32_t Stages = 7;
+  using Test = PipelineTest<Stages, ClusterShape>;
+  Testbed<Test> testbed(options);
+  EXPECT_TRUE(testbed.verification());
+}
+
+TEST(SM90_Verify_PipelineTmaAsync, Cluster2x2x2_Stage5) {
+  Options options;
+  using ClusterShape = cutlass::gemm::GemmShape<2, 2, 2>;
+  static constexpr uint32_t Stages = 5;
+  using Test = PipelineTest<Stages, ClusterShape>;
+  Testbed<Test> testbed(options);
+  EXPECT_TRUE(testbed.verification());
+}
 #endif
@@ -0,0 +1,316 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Unit test for PipelineTmaAsync driven by PipelineState<Stages, true>
+
+    The pipeline is sized for Stages buffers, but the states only cycle through a runtime
+    number of active stages. The producer stamps each buffer with its iteration count, and
+    the consumers check that they read the expected count from an active buffer, so a wrong
+    index or phase wrap shows up as a mismatch or a hang instead of passing silently.
+*/
+
+#define KERNEL_DBG_TRACE false
+
+#include "../common/cutlass_unit_test.h"
+#include <thrust/host_vector.h>
+#include <thrust/device_vector.h>
+
+#include <cute/tensor.hpp>
+#include <cute/arch/cluster_sm90.hpp>
+
+#include <cutlass/cluster_launch.hpp>
+
+#include "cutlass/util/print_error.hpp"
+
+#include "testbed.h"
+#include "cutlass/pipeline/pipeline.hpp"
+#include "cutlass/arch/barrier.h"
+
+using namespace cute;
+
+//////////////////// KERNELS /////////////////////////
+
+// Records (index, phase, count) after every step of a sequence of increments and advances
+template <uint32_t Stages>
+__global__ static
+void pipeline_state_device(uint32_t active_stages, uint32_t const* steps, int num_steps, uint32_t* out)
+{
+  auto state = cutlass::PipelineState<Stages, true>{0, 1, 0, active_stages};
+  for (int i = 0; i < num_steps; ++i) {
+    if (steps[i] == 0) {
+      ++state;
+    }
+    else {
+      state += steps[i];
+    }
+    // The static state handed to the pipeline classes must keep index and phase
+    cutlass::PipelineState<Stages> static_state = state;
+    out[4 * i + 0] = static_cast<uint32_t>(static_state.index());
+    out[4 * i + 1] = static_state.phase();
+    out[4 * i + 2] = static_state.count();
+    out[4 * i + 3] = state.stages();
+  }
+}
+
+template <uint32_t Stages>
+struct SharedStorage
+{
+  typename cutlass::PipelineTmaAsync<Stages>::SharedStorage storage;
+  uint32_t payload[Stages];
+};
+
+// Completes deadlock-free and counts the stages read with an unexpected payload or index
+template <class ClusterShape, uint32_t NumStages>
+__global__ static
+void pipeline_device(uint32_t const NumIterations, uint32_t const active_stages, uint32_t* errors)
+{
+
+  extern __shared__ char shared_memory[];
+  using MainloopPipeline = cutlass::PipelineTmaAsync<NumStages>;
+  using PipelineState = cutlass::PipelineState<NumStages, true>;
+
+  using SharedStorage = SharedStorage<NumStages>;
+  SharedStorage& shared_storage = *reinterpret_cast<SharedStorage*>(shared_memory);
+
+  int warp_group_thread_idx = threadIdx.x % 128;
+
+  auto cluster_shape = ClusterShape{};
+
+  // #Producers = #RowsInCluster + #ColsInCluster - 1
+  uint32_t const NumProducers = cute::size<0>(cluster_shape) + cute::size<1>(cluster_shape) - 1;
+  uint32_t const TmaTransactionBytes = sizeof(uint32_t) * NumProducers;
+  uint32_t const per_cta_bytes = sizeof(uint32_t);
+
+  // mbarrier.init
+  typename MainloopPipeline::Params params;
+  params.transaction_bytes = TmaTransactionBytes;
+  params.role = MainloopPipeline::ThreadCategory::ProducerConsumer;
+  params.is_leader = warp_group_thread_idx == 0;
+  params.num_consumers = 128;
+
+  MainloopPipeline pipeline(shared_storage.storage, params, cluster_shape);
+
+  __syncthreads();
+
+  // Ensure All CTAs in Cluster have completed init before issuing commits
+  cute::cluster_arrive_relaxed();
+  cute::cluster_wait();
+
+  PipelineState smem_pipe_read = cutlass::make_consumer_start_state<MainloopPipeline>(active_stages);
+  PipelineState smem_pipe_write = cutlass::make_producer_start_state<MainloopPipeline>(active_stages);
+  PipelineState smem_pipe_release = smem_pipe_read;
+
+  auto produce = [&]() {
+    pipeline.producer_acquire(smem_pipe_write);
+    if (params.is_leader) {
+      shared_storage.payload[smem_pipe_write.index()] = smem_pipe_write.count();
+      __threadfence_block();
+    }
+    pipeline.producer_commit(smem_pipe_write, per_cta_bytes);
+    ++smem_pipe_write;
+  };
+
+  auto consume = [&]() {
+    pipeline.consumer_wait(smem_pipe_read);
+    if (smem_pipe_read.index() >= static_cast<int>(active_stages) ||
+        shared_storage.payload[smem_pipe_read.index()] != smem_pipe_read.count()) {
+      atomicAdd(errors, 1u);
+    }
+    ++smem_pipe_read;
+  };
+
+  uint32_t tma_k_iterations = NumIterations;
+  uint32_t k_pipe_tma_prologue = min(active_stages, tma_k_iterations);
+
+  // DMA Prologue (Loads)
+  for (uint32_t i = 0; i < k_pipe_tma_prologue; ++i) {
+    produce();
+  }
+  tma_k_iterations -= k_pipe_tma_prologue;
+
+  // MMA Prologue (Compute) - modeling one inflight MMA
+  consume();
+
+  CUTLASS_PRAGMA_NO_UNROLL
+  for (uint32_t iter = 1; iter < NumIterations; ++iter) {
+    consume();
+    pipeline.consumer_release(smem_pipe_release);
+    ++smem_pipe_release;
+
+    if (warp_group_thread_idx == 0 && tma_k_iterations > 0) {
+      produce();
+      --tma_k_iterations;
+    }
+  }
+  pipeline.consumer_release(smem_pipe_release);
+
+  // Only the active stages need to drain before exit
+  if (warp_group_thread_idx == 0) {
+    pipeline.producer_tail(smem_pipe_write);
+  }
+
+  // To make sure remote SMEM doesn't get destoryed
+  cute::cluster_arrive();
+  cute::cluster_wait();
+}
+/////////////////////////////////////////////////////
+
+/// Runs the state sequence on the device and returns the number of mismatching steps
+template <uint32_t Stages>
+int
+run_pipeline_state_test(uint32_t active_stages) {
+  // 0 stands for ++, crossing the boundary of active_stages by 0, 1 and several wraps
+  thrust::host_vector<uint32_t> steps;
+  for (uint32_t step : {0u, 0u, 1u, active_stages - 1, active_stages, active_stages + 1, 0u,
+                        2 * active_stages, 2 * active_stages + 3, 3 * active_stages - 1, 0u, 7u}) {
+    steps.push_back(step);
+  }
+  for (uint32_t i = 0; i < 3 * active_stages; ++i) {
+    steps.push_back(0u);
+  }
+  int num_steps = int(steps.size());
+  thrust::device_vector<uint32_t> device_steps = steps;
+  thrust::device_vector<uint32_t> device_out(4 * num_steps, 0);
+
+  pipeline_state_device<Stages><<<1, 1>>>(active_stages, device_steps.data().get(), num_steps,
+                                          device_out.data().get());
+  CUTE_CHECK_LAST();
+  thrust::host_vector<uint32_t> out = device_out;
+
+  // The producer start phase of 1 flips on every odd crossing of active_stages
+  int mismatches = 0;
+  uint64_t total = 0;
+  for (int i = 0; i < num_steps; ++i) {
+    total += steps[i] == 0 ? 1 : steps[i];
+    uint32_t index = uint32_t(total % active_stages);
+    uint32_t phase = 1u ^ uint32_t((total / active_stages) & 1);
+    if (out[4 * i + 0] != index || out[4 * i + 1] != phase ||
+        out[4 * i + 2] != uint32_t(total) || out[4 * i + 3] != active_stages) {
+      std::cerr << "Stages = " << Stages << " active stages = " << active_stages << " step " << i
+                << ": (" << out[4 * i + 0] << "," << out[4 * i + 1] << "," << out[4 * i + 2]
+                << ") != (" << index << "," << phase << "," << total << ")" << std::endl;
+      ++mismatches;
+    }
+  }
+  return mismatches;
+}
+
+/// Device NT GMMA + TMA specialized, cycling through a runtime number of stages
+template<uint32_t Stages_, typename ClusterShape_>
+struct PipelineTest {
+
+  static constexpr uint32_t Stages = Stages_;
+  static constexpr uint32_t kBlockSize = 128;
+  using ClusterShape = ClusterShape_;
+
+  // Returns the number of stages read with an unexpected payload, or -1 on a launch error
+  int run(uint32_t const kNumIters, uint32_t const active_stages, cudaStream_t stream = 0) {
+    auto cluster_shape = Shape<Int<ClusterShape::kM>, Int<ClusterShape::kN>, Int<ClusterShape::kK>>{};
+    int smem_size = int(sizeof(SharedStorage<Stages>));
+
+    cudaError_t result = cudaFuncSetAttribute(
+      pipeline_device<decltype(cluster_shape), Stages>,
+      cudaFuncAttributeMaxDynamicSharedMemorySize,
+      smem_size);
+    if (result != cudaSuccess) {
+      std::cerr << "Error: Failed to set the shared memory size." << std::endl;
+      return -1;
+    }
+
+    thrust::device_vector<uint32_t> errors(1, 0);
+
+    // Launch a single Cluster, with 128 thread per CTA
+    dim3 dimCluster(size<0>(cluster_shape), size<1>(cluster_shape), size<2>(cluster_shape));
+    dim3 dimGrid(size<0>(cluster_shape), size<1>(cluster_shape), size<2>(cluster_shape));
+    dim3 dimBlock(kBlockSize,1,1);
+
+    const void* kernel = (const void*)pipeline_device<decltype(cluster_shape), Stages>;
+    uint32_t iters = kNumIters;
+    uint32_t active = active_stages;
+    uint32_t* errors_ptr = errors.data().get();
+    void* kernel_params[] = {reinterpret_cast<void*>(&iters), reinterpret_cast<void*>(&active),
+                             reinterpret_cast<void*>(&errors_ptr)};
+    cutlass::ClusterLauncher::launch(dimGrid, dimCluster, dimBlock, smem_size, stream, kernel, kernel_params);
+
+    result = cudaDeviceSynchronize();
+    if (result != cudaSuccess) {
+      std::cerr << "Error: cudaDeviceSynchronize() failed" << std::endl;
+      return -1;
+    }
+    return int(errors[0]);
+  }
+
+  /// Iteration counts below, at and well above the active stages
+  bool verification(uint32_t const active_stages) {
+    for (uint32_t n : {1u, active_stages - 1, active_stages, active_stages + 1, 4 * active_stages + 3, 997u}) {
+      if (n == 0) {
+        continue;
+      }
+      int errors = run(n, active_stages);
+      if (errors != 0) {
+        std::cerr << "Stages = " << Stages << " active stages = " << active_stages
+                  << " kNumIters = " << n << ": " << errors << " errors" << std::endl;
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+TEST(SM90_Verify_PipelineState_DynamicStages, Stage8) {
+  for (uint32_t active_stages : {1u, 2u, 3u, 5u, 8u}) {
+    EXPECT_EQ(run_pipeline_state_test<8>(active_stages), 0);
+  }
+}
+
+#if CUDA_12_0_SM90_FEATURES_SUPPORTED
+TEST(SM90_Verify_PipelineTmaAsync_DynamicStages, Cluster1x1_Stage8) {
+  using Test = PipelineTest<8, cutlass::gemm::GemmShape<1, 1, 1>>;
+  for (uint32_t active_stages : {2u, 3u, 5u, 8u}) {
+    EXPECT_TRUE(Test{}.verification(active_stages));
+  }
+}
+
+TEST(SM90_Verify_PipelineTmaAsync_DynamicStages, Cluster2x2_Stage8) {
+  using Test = PipelineTest<8, cutlass::gemm::GemmShape<2, 2, 1>>;
+  for (uint32_t active_stages : {2u, 5u, 8u}) {
+    EXPECT_TRUE(Test{}.verification(active_stages));
+  }
+}
+
+TEST(SM90_Verify_PipelineTmaAsync_DynamicStages, Cluster1x2_Stage10) {
+  using Test = PipelineTest<10, cutlass::gemm::GemmShape<1, 2, 1>>;
+  for (uint32_t active_stages : {3u, 7u, 10u}) {
+    EXPECT_TRUE(Test{}.verification(active_stages));
+  }
+}
+#endif
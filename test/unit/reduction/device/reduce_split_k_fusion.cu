@@ -0,0 +1,295 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the 3.x split-K reduction fused with epilogue fusion operations
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/epilogue/fusion/operations.hpp"
+#include "cutlass/reduction/device/reduce_split_k.hpp"
+
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/packed_stride.hpp"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reduces `splits` packed partial slices of an MxN problem and compares D, Aux and the amax values
+/// against a host reference. Partials hold multiples of 1/4 of small magnitude and the scalars are
+/// powers of two, so the reference is exact in float.
+template <typename Kernel>
+bool TestReduceSplitKFusion(
+  int M,
+  int N,
+  int splits,
+  typename Kernel::FusionArguments fusion = {},
+  bool use_bias = false,
+  bool launch_with_pdl = false) {
+
+  using namespace cute;
+  using FusionOp = typename Kernel::FusionOp;
+  using ElementAccumulator = typename Kernel::ElementAccumulator;
+  using ElementC = typename Kernel::ElementC;
+  using ElementD = typename Kernel::ElementD;
+  using ElementAux = typename Kernel::ElementAux;
+  using ElementBias = typename Kernel::ElementBias;
+  using ElementAmax = typename Kernel::ElementAmax;
+  using ElementCompute = typename Kernel::ElementCompute;
+  using Reduction = cutlass::reduction::device::ReduceSplitKFusion<Kernel>;
+
+  auto dPartials = cutlass::make_cute_packed_stride(typename Kernel::StrideAccumulator{}, make_shape(M, N, splits));
+  auto dC = cutlass::make_cute_packed_stride(typename Kernel::StrideC{}, make_shape(M, N, 1));
+  auto dD = cutlass::make_cute_packed_stride(typename Kernel::StrideD{}, make_shape(M, N, 1));
+  auto dAux = cutlass::make_cute_packed_stride(typename Kernel::StrideAux{}, make_shape(M, N, 1));
+  auto layout_partials = make_layout(make_shape(M, N, splits), dPartials);
+  auto layout_C = make_layout(make_shape(M, N), take<0,2>(dC));
+  auto layout_D = make_layout(make_shape(M, N), take<0,2>(dD));
+  auto layout_aux = make_layout(make_shape(M, N), take<0,2>(dAux));
+
+  int64_t count = int64_t(M) * N;
+  int bias_count = FusionOp::IsPerRowBiasSupported ? M : N;
+
+  std::vector<ElementAccumulator> partials_host(count * splits);
+  for (int64_t i = 0; i < count * splits; ++i) {
+    partials_host[i] = ElementAccumulator(float(int((i * 7919) % 41) - 20) * 0.25f);
+  }
+  std::vector<ElementC> C_host(count);
+  for (int64_t i = 0; i < count; ++i) {
+    C_host[i] = ElementC(float(int((i * 104729) % 17) - 8) * 0.5f);
+  }
+  std::vector<ElementBias> bias_host(bias_count);
+  for (int i = 0; i < bias_count; ++i) {
+    bias_host[i] = ElementBias(float(i % 9 - 4));
+  }
+
+  cutlass::DeviceAllocation<ElementAccumulator> partials_device(count * splits);
+  cutlass::DeviceAllocation<ElementC> C_device(count);
+  cutlass::DeviceAllocation<ElementD> D_device(count);
+  cutlass::DeviceAllocation<ElementAux> aux_device(count);
+  cutlass::DeviceAllocation<ElementBias> bias_device(bias_count);
+  cutlass::DeviceAllocation<ElementAmax> amax_device(2);
+  partials_device.copy_from_host(partials_host.data());
+  C_device.copy_from_host(C_host.data());
+  bias_device.copy_from_host(bias_host.data());
+  ElementAmax const amax_zero[2] = {ElementAmax(0), ElementAmax(0)};
+  amax_device.copy_from_host(amax_zero);
+
+  typename Reduction::Arguments args;
+  args.problem_shape = make_shape(M, N, splits);
+  args.ptr_partials = partials_device.get();
+  args.dPartials = dPartials;
+  args.ptr_C = FusionOp::IsSourceSupported ? C_device.get() : nullptr;
+  args.dC = dC;
+  args.ptr_D = D_device.get();
+  args.dD = dD;
+  args.fusion = fusion;
+  args.fusion.bias_ptr = use_bias ? bias_device.get() : nullptr;
+  args.fusion.amax_D_ptr = amax_device.get();
+  args.fusion.amax_aux_ptr = amax_device.get() + 1;
+  args.fusion.aux_ptr = aux_device.get();
+  args.fusion.dAux = dAux;
+
+  Reduction reduction;
+  EXPECT_EQ(reduction.can_implement(args), cutlass::Status::kSuccess);
+  EXPECT_EQ(reduction(args, nullptr, nullptr, launch_with_pdl), cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  std::vector<ElementD> D_host(count);
+  std::vector<ElementAux> aux_host(count);
+  ElementAmax amax_host[2];
+  D_device.copy_to_host(D_host.data());
+  aux_device.copy_to_host(aux_host.data());
+  amax_device.copy_to_host(amax_host);
+
+  //
+  // Reference check
+  //
+  typename Kernel::ActivationFn activation;
+  cutlass::NumericConverter<ElementD, ElementCompute> convert_output;
+  cutlass::NumericConverter<ElementAux, ElementCompute> convert_aux;
+  float scale_ab = Kernel::IsScaleFactor ? float(fusion.scale_a) * float(fusion.scale_b) : 1.f;
+  float scale_c = Kernel::IsScaleFactor ? float(fusion.scale_c) : 1.f;
+  float amax_D = 0;
+  float amax_aux = 0;
+
+  for (int m = 0; m < M; ++m) {
+    for (int n = 0; n < N; ++n) {
+      float acc = 0;
+      for (int s = 0; s < splits; ++s) {
+        acc += float(partials_host[layout_partials(m, n, s)]);
+      }
+      float source = FusionOp::IsSourceSupported ? float(C_host[layout_C(m, n)]) : 0.f;
+      float z = scale_ab * float(fusion.alpha) * acc;
+      if (!FusionOp::IsResidualSupported) {
+        z += scale_c * float(fusion.beta) * source;
+      }
+      if (use_bias) {
+        z += float(bias_host[FusionOp::IsPerRowBiasSupported ? m : n]);
+      }
+      float d;
+      if constexpr (cute::is_same_v<typename Kernel::ActivationArguments,
+                                    cutlass::reduction::kernel::detail::EmptyActivationArguments>) {
+        d = activation(z);
+      }
+      else {
+        d = activation(z, fusion.activation);
+      }
+      if (FusionOp::IsResidualSupported) {
+        d += scale_c * float(fusion.beta) * source;
+      }
+      amax_D = std::max(amax_D, std::abs(d));
+      amax_aux = std::max(amax_aux, std::abs(z));
+
+      float expected = float(convert_output(Kernel::IsScaleD ? d * float(fusion.scale_d) : d));
+      float got = float(D_host[layout_D(m, n)]);
+      bool equal = expected == got;
+      if (Kernel::IsAux) {
+        float expected_aux = float(convert_aux(Kernel::IsScaleAux ? z * float(fusion.scale_aux) : z));
+        equal &= expected_aux == float(aux_host[layout_aux(m, n)]);
+      }
+      EXPECT_TRUE(equal);
+      if (!equal) {
+        std::cerr
+          << "Error at (" << m << ", " << n << ")" << std::endl
+          << "  expected: " << expected << std::endl
+          << "       got: " << got << std::endl
+          << "Problem: " << M << "x" << N << " with " << splits << " splits" << std::endl;
+        return false;
+      }
+    }
+  }
+
+  if (Kernel::IsAmaxD) {
+    EXPECT_EQ(float(amax_host[0]), amax_D);
+  }
+  if (Kernel::IsAmaxAux) {
+    EXPECT_EQ(float(amax_host[1]), amax_aux);
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// D = alpha * sum(partials) + beta * C, with split counts below, at and above the slices in flight
+TEST(Reduction_ReduceSplitKFusion, lincomb_f32_f16_row_major) {
+
+  using FusionOp = cutlass::epilogue::fusion::LinearCombination<cutlass::half_t, float>;
+  using Kernel = cutlass::reduction::kernel::ReduceSplitKFusion<FusionOp, float, cutlass::layout::RowMajor>;
+
+  typename Kernel::FusionArguments fusion;
+  fusion.alpha = 0.5f;
+  fusion.beta = 2.f;
+
+  int const split_indices[] = {1, 3, 4, 9};
+
+  for (int splits : split_indices) {
+    EXPECT_TRUE(TestReduceSplitKFusion<Kernel>(77, 264, splits, fusion));
+  }
+}
+
+/// D = ReLU(sum(partials) + beta * C + per-column bias) on column-major tensors
+TEST(Reduction_ReduceSplitKFusion, per_col_bias_relu_f32_bf16_column_major) {
+
+  using FusionOp = cutlass::epilogue::fusion::LinCombPerColBiasEltAct<
+    cutlass::epilogue::thread::ReLu, cutlass::bfloat16_t, float>;
+  using Kernel = cutlass::reduction::kernel::ReduceSplitKFusion<FusionOp, float, cutlass::layout::ColumnMajor>;
+
+  typename Kernel::FusionArguments fusion;
+  fusion.beta = 1.f;
+
+  EXPECT_TRUE(TestReduceSplitKFusion<Kernel>(128, 97, 6, fusion, true));
+}
+
+/// FP8 D and Aux with scale factors, per-row bias and amax of both outputs
+TEST(Reduction_ReduceSplitKFusion, scaled_per_row_bias_amax_aux_fp8) {
+
+  using FusionOp = cutlass::epilogue::fusion::ScaledLinCombPerRowBiasEltActAmaxAux<
+    cutlass::layout::RowMajor, cutlass::epilogue::thread::ReLu,
+    cutlass::float_e4m3_t, float, cutlass::float_e5m2_t, float, cutlass::half_t, cutlass::half_t>;
+  using Kernel = cutlass::reduction::kernel::ReduceSplitKFusion<FusionOp, float, cutlass::layout::RowMajor>;
+
+  typename Kernel::FusionArguments fusion;
+  fusion.alpha = 0.5f;
+  fusion.beta = 0.25f;
+  fusion.scale_a = 2.f;
+  fusion.scale_b = 0.5f;
+  fusion.scale_c = 4.f;
+  fusion.scale_d = 0.125f;
+  fusion.scale_aux = 0.5f;
+
+  EXPECT_TRUE(TestReduceSplitKFusion<Kernel>(200, 136, 5, fusion, true));
+}
+
+/// Aux in a layout other than D's is stored element-wise
+TEST(Reduction_ReduceSplitKFusion, per_row_bias_aux_column_major_f16) {
+
+  using FusionOp = cutlass::epilogue::fusion::LinCombPerRowBiasEltActAux<
+    cutlass::layout::ColumnMajor, cutlass::epilogue::thread::Clamp, cutlass::half_t, float>;
+  using Kernel = cutlass::reduction::kernel::ReduceSplitKFusion<FusionOp, float, cutlass::layout::RowMajor>;
+
+  typename Kernel::FusionArguments fusion;
+  fusion.beta = 1.f;
+  fusion.activation.lower_bound = -2.f;
+  fusion.activation.upper_bound = 3.f;
+
+  EXPECT_TRUE(TestReduceSplitKFusion<Kernel>(64, 64, 2, fusion, true));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/// Launched with programmatic dependent launch
+TEST(Reduction_ReduceSplitKFusion, sm90_lincomb_pdl) {
+
+  using FusionOp = cutlass::epilogue::fusion::LinearCombination<float, float>;
+  using Kernel = cutlass::reduction::kernel::ReduceSplitKFusion<FusionOp, float, cutlass::layout::RowMajor>;
+
+  typename Kernel::FusionArguments fusion;
+  fusion.beta = 1.f;
+
+  EXPECT_TRUE(TestReduceSplitKFusion<Kernel>(512, 512, 8, fusion, false, true));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,251 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the CuTe-based reduction of arbitrary tensor modes
+*/
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../../common/cutlass_unit_test.h"
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/reduction/thread/reduction_operators.h"
+#include "cutlass/reduction/device/tensor_reduce_modes.hpp"
+
+#include "cutlass/util/device_memory.h"
+
+#include "cute/tensor.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reduces the Reduced... modes of a source with the given layout and compares against a host
+/// reference. Sources hold multiples of 1/4 of small magnitude, so sums are exact in float.
+template <
+  typename TensorReduction,
+  typename SrcLayout,
+  typename DstLayout,
+  int... Kept,
+  int... Reduced
+>
+bool TestTensorReduceModes(
+  SrcLayout src_layout,
+  DstLayout dst_layout,
+  cute::seq<Kept...>,
+  cute::seq<Reduced...> reduced_modes,
+  typename TensorReduction::ElementCompute reduction_identity,
+  typename TensorReduction::PreMap pre_map = {},
+  typename TensorReduction::PostMap post_map = {},
+  float tolerance = 0) {
+
+  using namespace cute;
+  using ElementOutput = typename TensorReduction::ElementOutput;
+  using ElementSource = typename TensorReduction::ElementSource;
+  using ElementCompute = typename TensorReduction::ElementCompute;
+  typename TensorReduction::ReductionOp reduction_op;
+
+  int64_t src_capacity = cosize(src_layout);
+  int64_t dst_capacity = cosize(dst_layout);
+
+  std::vector<ElementSource> src_host(src_capacity);
+  for (int64_t i = 0; i < src_capacity; ++i) {
+    src_host[i] = ElementSource(float(int((i * 7919) % 41) - 20) * 0.25f);
+  }
+
+  cutlass::DeviceAllocation<ElementSource> src_device(src_capacity);
+  cutlass::DeviceAllocation<ElementOutput> dst_device(dst_capacity);
+  src_device.copy_from_host(src_host.data());
+
+  cutlass::Status status = TensorReduction::reduce(
+    make_tensor(make_gmem_ptr(dst_device.get()), dst_layout),
+    make_tensor(make_gmem_ptr(src_device.get()), src_layout),
+    reduced_modes,
+    reduction_identity,
+    reduction_op,
+    pre_map,
+    post_map);
+
+  EXPECT_EQ(status, cutlass::Status::kSuccess);
+  EXPECT_EQ(cudaDeviceSynchronize(), cudaSuccess);
+
+  std::vector<ElementOutput> dst_host(dst_capacity);
+  dst_device.copy_to_host(dst_host.data());
+
+  //
+  // Reference check
+  //
+  std::vector<ElementCompute> reference(dst_capacity, reduction_identity);
+  for (int64_t i = 0; i < size(src_layout); ++i) {
+    auto coord = idx2crd(i, shape(src_layout));
+    int64_t dst_offset = 0;
+    if constexpr (sizeof...(Kept) > 0) {
+      dst_offset = dst_layout(make_coord(get<Kept>(coord)...));
+    }
+    reference[dst_offset] = reduction_op(
+      reference[dst_offset], pre_map(ElementCompute(src_host[src_layout(coord)])));
+  }
+
+  for (int64_t o = 0; o < size(dst_layout); ++o) {
+    int64_t dst_offset = dst_layout(o);
+    float expected = float(post_map(reference[dst_offset]));
+    float got = float(dst_host[dst_offset]);
+    bool equal = std::abs(expected - got) <= tolerance * std::abs(expected);
+    EXPECT_TRUE(equal);
+    if (!equal) {
+      std::cerr
+        << "Error at output " << o << std::endl
+        << "  expected: " << expected << std::endl
+        << "       got: " << got << std::endl
+        << "Problem: " << src_layout << " -> " << dst_layout << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Sum over the contiguous C mode of an NHWC tensor, the extents of C range over aligned and
+/// unaligned rows as well as rows spanning several shared memory stages
+TEST(Reduction_TensorReduceModes, nhwc_reduce_c_f32) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReduceModes<
+    float, float, float, cutlass::plus<float>>;
+
+  int const C_indices[] = {1, 3, 8, 64, 1027, 4096, 9000};
+
+  for (int C : C_indices) {
+    auto src_layout = cute::make_layout(cute::make_shape(3, 5, 7, C), cute::LayoutRight{});
+    auto dst_layout = cute::make_layout(cute::make_shape(3, 5, 7), cute::LayoutRight{});
+    EXPECT_TRUE(TestTensorReduceModes<TensorReduction>(
+      src_layout, dst_layout, cute::seq<0, 1, 2>{}, cute::seq<3>{}, 0.f));
+  }
+}
+
+/// Sum over the strided N and H modes of an NHWC tensor of half-precision elements
+TEST(Reduction_TensorReduceModes, nhwc_reduce_nh_f16) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReduceModes<
+    float, cutlass::half_t, float, cutlass::plus<float>>;
+
+  auto src_layout = cute::make_layout(cute::make_shape(13, 17, 19, 24), cute::LayoutRight{});
+  auto dst_layout = cute::make_layout(cute::make_shape(19, 24), cute::LayoutRight{});
+  EXPECT_TRUE(TestTensorReduceModes<TensorReduction>(
+    src_layout, dst_layout, cute::seq<2, 3>{}, cute::seq<0, 1>{}, 0.f));
+}
+
+/// Sum over the non-adjacent modes 1 and 3 of a padded tensor with a hierarchical mode
+TEST(Reduction_TensorReduceModes, hierarchical_reduce_modes_1_3) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReduceModes<
+    float, float, float, cutlass::plus<float>>;
+
+  auto src_layout = cute::make_layout(
+    cute::make_shape(6, cute::make_shape(4, 5), 3, 40),
+    cute::make_stride(int64_t(1), cute::make_stride(int64_t(8), int64_t(32)), int64_t(200), int64_t(700)));
+  auto dst_layout = cute::make_layout(cute::make_shape(6, 3));
+  EXPECT_TRUE(TestTensorReduceModes<TensorReduction>(
+    src_layout, dst_layout, cute::seq<0, 2>{}, cute::seq<1, 3>{}, 0.f));
+}
+
+/// amax of a whole tensor fused into one launch
+TEST(Reduction_TensorReduceModes, amax_reduce_all_f16) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReduceModes<
+    cutlass::half_t, cutlass::half_t, float, cutlass::maximum<float>,
+    cutlass::reduction::thread::MapAbsolute<float>>;
+
+  auto src_layout = cute::make_layout(cute::make_shape(64, 33, 9));
+  auto dst_layout = cute::make_layout(cute::Int<1>{});
+  EXPECT_TRUE(TestTensorReduceModes<TensorReduction>(
+    src_layout, dst_layout, cute::seq<>{}, cute::seq<0, 1, 2>{}, 0.f));
+}
+
+/// RMS norm of every row of a row-major matrix, i.e. sqrt(sum(x^2) / N)
+TEST(Reduction_TensorReduceModes, rms_norm_rows_f32) {
+
+  using PostMap = cutlass::reduction::thread::MapCompose<
+    cutlass::reduction::thread::MapScale<float>, cutlass::reduction::thread::MapSqrt<float>>;
+  using TensorReduction = cutlass::reduction::device::TensorReduceModes<
+    float, float, float, cutlass::plus<float>, cutlass::reduction::thread::MapSquare<float>, PostMap>;
+
+  int const M = 77;
+  int const N = 2560;
+  auto src_layout = cute::make_layout(cute::make_shape(M, N), cute::LayoutRight{});
+  auto dst_layout = cute::make_layout(cute::make_shape(M));
+
+  PostMap post_map;
+  post_map.inner.alpha = 1.f / N;
+  EXPECT_TRUE(TestTensorReduceModes<TensorReduction>(
+    src_layout, dst_layout, cute::seq<0>{}, cute::seq<1>{}, 0.f, {}, post_map, 1e-5f));
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/// Few long rows, each split across the CTAs of a cluster
+TEST(Reduction_TensorReduceModes, sm90_cluster_reduce_contiguous_f32) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReduceModes<
+    float, float, float, cutlass::plus<float>,
+    cutlass::reduction::thread::MapIdentity<float>, cutlass::reduction::thread::MapIdentity<float>, 4>;
+
+  int const N_indices[] = {1000, 65536, 100000};
+
+  for (int N : N_indices) {
+    auto src_layout = cute::make_layout(cute::make_shape(3, N), cute::LayoutRight{});
+    auto dst_layout = cute::make_layout(cute::make_shape(3));
+    EXPECT_TRUE(TestTensorReduceModes<TensorReduction>(
+      src_layout, dst_layout, cute::seq<0>{}, cute::seq<1>{}, 0.f));
+  }
+}
+
+/// Column sums of a tall row-major matrix, the rows split across the CTAs of a cluster
+TEST(Reduction_TensorReduceModes, sm90_cluster_reduce_strided_f32) {
+
+  using TensorReduction = cutlass::reduction::device::TensorReduceModes<
+    float, float, float, cutlass::maximum<float>,
+    cutlass::reduction::thread::MapAbsolute<float>, cutlass::reduction::thread::MapIdentity<float>, 8>;
+
+  auto src_layout = cute::make_layout(cute::make_shape(20000, 300), cute::LayoutRight{});
+  auto dst_layout = cute::make_layout(cute::make_shape(300));
+  EXPECT_TRUE(TestTensorReduceModes<TensorReduction>(
+    src_layout, dst_layout, cute::seq<1>{}, cute::seq<0>{}, 0.f));
+}
+
+#endif // defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
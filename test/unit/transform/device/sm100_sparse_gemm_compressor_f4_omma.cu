@@ -89,4 +89,27 @@ TEST(SM100_Structured_Sparse_Gemm_Compressor_Device, omma_f4_runtimedtype_t)
   EXPECT_TRUE(testbed.run_auto_small());
 }
 
+TEST(SM100_Structured_Sparse_Gemm_Compressor_Device, omma_f4_t_prune)
+{
+  // Test Settings
+  using ElementA = cutlass::float_e2m1_t;
+  using LayoutATag = cutlass::layout::RowMajor;
+
+  // Deduct From Test Setting
+  using ElementAMma = cute::sparse_elem<4, uint8_t>;
+  using ElementEMma = cute::sparse_elem<16, uint8_t>;
+
+  using Sm1xxSparseConfig = cutlass::Sm1xxGemmSparseConfig<ElementAMma, LayoutATag, ElementEMma>;
+
+  using CompressorKernel = cutlass::transform::kernel::
+      StructuredSparseCompressor<cute::Shape<int, int, int, int>, ElementA, LayoutATag, Sm1xxSparseConfig, cutlass::arch::Sm100>;
+
+  using Compressor = cutlass::transform::device::TransformUniversalAdapter<CompressorKernel>;
+
+  // Test Bed (dense A pruned on device)
+  test::transform::device::TestbedSparseGemmCompressor<Compressor> testbed(
+    cutlass::Distribution::Uniform, cutlass::Distribution::Uniform, cutlass::Distribution::Uniform, 7, true);
+  EXPECT_TRUE(testbed.run_auto_small());
+}
+
 #endif // #if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
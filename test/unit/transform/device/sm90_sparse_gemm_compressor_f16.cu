@@ -92,4 +92,28 @@ TEST(SM90_Structured_Sparse_Gemm_Compressor_Device, f16_n)
   EXPECT_TRUE(testbed.run_auto());
 }
 
+TEST(SM90_Structured_Sparse_Gemm_Compressor_Device, f16_t_prune)
+{
+  // Test Settings
+  using ElementA = cutlass::half_t;
+  using LayoutATag = cutlass::layout::RowMajor;
+
+  // Deduct From Test Setting
+  static constexpr cute::GMMA::Major GmmaMajorA = cutlass::gemm::collective::detail::gmma_rs_tag_to_major_A<LayoutATag>();
+  using ElementAMma = cute::sparse_elem<2, ElementA>;
+  using ElementEMma = cute::sparse_elem<8, uint8_t>;
+
+  using SparseConfig = cutlass::Sm90GemmSparseConfig<ElementAMma, GmmaMajorA, ElementEMma, cute::Int<32>>;
+
+  using CompressorKernel = cutlass::transform::kernel::
+      StructuredSparseCompressor<cute::Shape<int, int, int, int>, ElementA, LayoutATag, SparseConfig, cutlass::arch::Sm90>;
+
+  using Compressor = cutlass::transform::device::TransformUniversalAdapter<CompressorKernel>;
+
+  // Test Bed (dense A pruned on device)
+  test::transform::device::TestbedSparseGemmCompressor<Compressor> testbed(
+    cutlass::Distribution::Uniform, cutlass::Distribution::Uniform, cutlass::Distribution::Uniform, 7, true);
+  EXPECT_TRUE(testbed.run_auto());
+}
+
 #endif // #if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
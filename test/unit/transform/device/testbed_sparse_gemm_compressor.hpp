@@ -225,11 +225,13 @@ public:
       cutlass::Distribution::Kind init_A_ = cutlass::Distribution::Uniform,
       cutlass::Distribution::Kind init_E_ = cutlass::Distribution::Uniform,
       cutlass::Distribution::Kind init_A_Comp_ = cutlass::Distribution::Uniform,
-      uint64_t seed_ = 7)
+      uint64_t seed_ = 7,
+      bool prune_ = false)
       : init_A(init_A_)
       , init_E(init_E_)
       , init_A_Comp(init_A_Comp_)
       , seed(seed_)
+      , prune(prune_)
   {
   }
 
@@ -304,7 +306,10 @@ public:
     EXPECT_TRUE(initialize_tensor(datas.tensor_A_Comp.host_view(), init_A_Comp, seed + 4));
     EXPECT_TRUE(initialize_tensor(datas.tensor_A_Comp_ref.host_view(), init_A_Comp, seed + 5));
 
-    compressor_utility.structure_sparse_zero_mask_fill(datas.tensor_A.host_data(), seed + 6);
+    // When pruning, the device compressor consumes dense A
+    if (not prune) {
+      compressor_utility.structure_sparse_zero_mask_fill(datas.tensor_A.host_data(), seed + 6);
+    }
 
     // Check for failed device
     CUDA_CHECK_FALSE(cudaGetLastError());
@@ -313,6 +318,11 @@ public:
     datas.tensor_A_Comp.sync_device();
     datas.tensor_E.sync_device();
 
+    // Legacy host compressor consumes A pruned on host
+    if (prune) {
+      compressor_utility.structure_sparse_magnitude_prune(datas.tensor_A.host_data());
+    }
+
     // Check for failed device
     CUDA_CHECK_FALSE(cudaGetLastError());
 
@@ -338,7 +348,8 @@ public:
         {datas.tensor_A.device_data(),
          stride_a,
          datas.tensor_A_Comp.device_data(),
-         datas.tensor_E.device_data()},
+         datas.tensor_E.device_data(),
+         prune},
         {hw_info}
     };
 
@@ -866,6 +877,7 @@ public:
   cutlass::Distribution::Kind init_A_Comp;
   cutlass::Distribution::Kind init_E;
   uint64_t seed;
+  bool prune;
 };
 
 }  // namespace device
@@ -0,0 +1,236 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#include "../common/cutlass_unit_test.h"
+
+#include <cmath>
+
+#include "cutlass/util/device_fused_norm.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/tensor_fill.h"
+
+namespace {
+
+template <typename T>
+struct FusedNormTestbed {
+
+  using Layout = cutlass::layout::RowMajor;
+
+  int M;
+  int N;
+  cutlass::HostTensor<T, Layout> input, residual, residual_out, gamma, beta;
+  std::vector<float> reference;
+  std::vector<float> reference_residual;
+
+  FusedNormTestbed(int M_, int N_): M(M_), N(N_) {
+    input.reset({M, N});
+    residual.reset({M, N});
+    residual_out.reset({M, N});
+    gamma.reset({1, N});
+    beta.reset({1, N});
+
+    cutlass::reference::host::TensorFillRandomUniform(input.host_view(), 2022, T(5), T(-5), 2);
+    cutlass::reference::host::TensorFillRandomUniform(residual.host_view(), 2023, T(2), T(-2), 2);
+    cutlass::reference::host::TensorFillRandomUniform(gamma.host_view(), 2024, T(2), T(-2), 2);
+    cutlass::reference::host::TensorFillRandomUniform(beta.host_view(), 2025, T(1), T(-1), 2);
+
+    input.sync_device();
+    residual.sync_device();
+    gamma.sync_device();
+    beta.sync_device();
+  }
+
+  /// Computes the reference normalization with a fused residual add
+  void compute_reference(cutlass::FusedNormKind kind, bool use_residual) {
+    reference.assign(size_t(M) * N, 0.0f);
+    reference_residual.assign(size_t(M) * N, 0.0f);
+
+    for (int m = 0; m < M; ++m) {
+      std::vector<float> h(N);
+      double sum = 0;
+      for (int n = 0; n < N; ++n) {
+        float v = float(input.at({m, n}));
+        if (use_residual) {
+          v = float(T(v + float(residual.at({m, n}))));
+        }
+        h[n] = v;
+        reference_residual[size_t(m) * N + n] = v;
+        sum += v;
+      }
+
+      double mean = (kind == cutlass::FusedNormKind::kLayerNorm) ? sum / N : 0;
+      double sq_sum = 0;
+      for (int n = 0; n < N; ++n) {
+        sq_sum += (h[n] - mean) * (h[n] - mean);
+      }
+      double rstd = 1.0 / std::sqrt(sq_sum / N + 1e-5);
+
+      for (int n = 0; n < N; ++n) {
+        double b = (kind == cutlass::FusedNormKind::kLayerNorm) ? float(beta.at({0, n})) : 0;
+        reference[size_t(m) * N + n] = float((h[n] - mean) * rstd * float(gamma.at({0, n})) + b);
+      }
+    }
+  }
+
+  template <typename ElementOutput, typename ElementScaleFactor>
+  cutlass::FusedNormArguments<T, ElementOutput, ElementScaleFactor> arguments(
+    cutlass::FusedNormKind kind, bool use_residual, ElementOutput *output, ElementScaleFactor *scale_factors,
+    float norm_constant) {
+
+    cutlass::FusedNormArguments<T, ElementOutput, ElementScaleFactor> args;
+    args.m = M;
+    args.n = N;
+    args.input = input.device_data();
+    args.residual = use_residual ? residual.device_data() : nullptr;
+    args.residual_out = use_residual ? residual_out.device_data() : nullptr;
+    args.gamma = gamma.device_data();
+    args.beta = (kind == cutlass::FusedNormKind::kLayerNorm) ? beta.device_data() : nullptr;
+    args.output = output;
+    args.scale_factors = scale_factors;
+    args.norm_constant = norm_constant;
+    return args;
+  }
+
+  bool verify_residual() {
+    residual_out.sync_host();
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        if (float(residual_out.at({m, n})) != reference_residual[size_t(m) * N + n]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  /// Checks an unquantized or per-tensor scaled output with a relative tolerance
+  template <typename ElementOutput, cutlass::FusedNormKind Kind>
+  void run(bool use_residual, float norm_constant, float tolerance) {
+    cutlass::HostTensor<ElementOutput, Layout> output({M, N});
+
+    compute_reference(Kind, use_residual);
+    auto args = arguments<ElementOutput, void>(Kind, use_residual, output.device_data(), nullptr, norm_constant);
+
+    ASSERT_EQ(cudaSuccess, cutlass::fused_add_norm<Kind>(args));
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+    output.sync_host();
+
+    int errors = 0;
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float expected = reference[size_t(m) * N + n];
+        float got = float(output.at({m, n})) / norm_constant;
+        if (std::abs(got - expected) > tolerance * std::abs(expected) + 1e-2f) {
+          ++errors;
+        }
+      }
+    }
+
+    EXPECT_EQ(errors, 0);
+    if (use_residual) {
+      EXPECT_TRUE(verify_residual());
+    }
+  }
+
+  /// Checks a block-scaled output after dequantizing it with its scale factors
+  template <typename ElementOutput, typename ElementScaleFactor, int SFVecSize, cutlass::FusedNormKind Kind>
+  void run_block_scaled(bool use_residual, float norm_constant, float tolerance) {
+    cutlass::HostTensor<ElementOutput, Layout> output({M, N});
+    size_t sf_count = cutlass::fused_norm_scale_factor_count<SFVecSize>(M, N);
+    cutlass::HostTensor<ElementScaleFactor, cutlass::layout::PackedVectorLayout> scale_factors(cutlass::make_Coord(int(sf_count)));
+    auto layout_sf = cutlass::detail::FusedNormScaleFactorLayout<SFVecSize>::get(M, N);
+
+    compute_reference(Kind, use_residual);
+    auto args = arguments<ElementOutput, ElementScaleFactor>(
+      Kind, use_residual, output.device_data(), scale_factors.device_data(), norm_constant);
+
+    ASSERT_EQ(cudaSuccess, (cutlass::fused_add_norm<Kind, SFVecSize>(args)));
+    ASSERT_EQ(cudaSuccess, cudaDeviceSynchronize());
+    output.sync_host();
+    scale_factors.sync_host();
+
+    int errors = 0;
+    for (int m = 0; m < M; ++m) {
+      for (int k = 0; k < N; k += SFVecSize) {
+        float amax = 0;
+        for (int v = 0; v < SFVecSize; ++v) {
+          amax = std::max(amax, std::abs(reference[size_t(m) * N + k + v]));
+        }
+        float sf = float(scale_factors.host_data(layout_sf(m, k, 0)));
+        for (int v = 0; v < SFVecSize; ++v) {
+          float expected = reference[size_t(m) * N + k + v];
+          float got = float(output.at({m, k + v})) * sf / norm_constant;
+          if (std::abs(got - expected) > tolerance * amax + 1e-2f) {
+            ++errors;
+          }
+        }
+      }
+    }
+
+    EXPECT_EQ(errors, 0);
+    if (use_residual) {
+      EXPECT_TRUE(verify_residual());
+    }
+  }
+};
+
+} // namespace
+
+TEST(FusedNorm, rmsnorm_residual_f16_16x4096) {
+  FusedNormTestbed<cutlass::half_t> testbed(16, 4096);
+  testbed.run<cutlass::half_t, cutlass::FusedNormKind::kRMSNorm>(true, 1.0f, 0.01f);
+}
+
+TEST(FusedNorm, layernorm_f16_7x16384) {
+  FusedNormTestbed<cutlass::half_t> testbed(7, 16384);
+  testbed.run<cutlass::half_t, cutlass::FusedNormKind::kLayerNorm>(false, 1.0f, 0.01f);
+}
+
+TEST(FusedNorm, layernorm_residual_f32_9x1000) {
+  FusedNormTestbed<float> testbed(9, 1000);
+  testbed.run<float, cutlass::FusedNormKind::kLayerNorm>(true, 1.0f, 0.001f);
+}
+
+TEST(FusedNorm, rmsnorm_residual_bf16_e4m3_8x2048) {
+  FusedNormTestbed<cutlass::bfloat16_t> testbed(8, 2048);
+  testbed.run<cutlass::float_e4m3_t, cutlass::FusedNormKind::kRMSNorm>(true, 4.0f, 0.07f);
+}
+
+TEST(FusedNorm, rmsnorm_residual_f16_nvfp4_5x2048) {
+  FusedNormTestbed<cutlass::half_t> testbed(5, 2048);
+  testbed.run_block_scaled<cutlass::float_e2m1_t, cutlass::float_ue4m3_t, 16, cutlass::FusedNormKind::kRMSNorm>(
+    true, 1.0f, 0.25f);
+}
+
+TEST(FusedNorm, layernorm_f32_mxfp8_3x1024) {
+  FusedNormTestbed<float> testbed(3, 1024);
+  testbed.run_block_scaled<cutlass::float_e4m3_t, cutlass::float_ue8m0_t, 32, cutlass::FusedNormKind::kLayerNorm>(
+    false, 1.0f, 0.07f);
+}
@@ -813,6 +813,56 @@ struct ConvDescription : public OperationDescription {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Description of all fused multi-head attention (forward) operations
+//
+// O = softmax(scale * Q K^T + mask) V, with Q/O packed as [batch, seqlen_q, heads_q, head_dim] and
+// K/V as [batch, seqlen_kv, heads_kv, head_dim] (or [pages, page_size, heads_kv, head_dim] when paged).
+// The tile description's threadblock shape holds the (query, key, head_dim) tile of the kernel.
+//
+struct AttentionDescription : public OperationDescription {
+
+  /// Describes the query operand
+  TensorDescription Q;
+
+  /// Describes the key operand
+  TensorDescription K;
+
+  /// Describes the value operand
+  TensorDescription V;
+
+  /// Describes the output operand
+  TensorDescription O;
+
+  /// Head dimension the kernel is compiled for
+  int head_dim;
+
+  /// Mask applied to the scores
+  AttentionMask mask;
+
+  /// True if K and V are gathered through a page table
+  bool paged;
+
+  //
+  // Methods
+  //
+
+  AttentionDescription(
+    TensorDescription const &Q = TensorDescription(),
+    TensorDescription const &K = TensorDescription(),
+    TensorDescription const &V = TensorDescription(),
+    TensorDescription const &O = TensorDescription(),
+    int head_dim = 0,
+    AttentionMask mask = AttentionMask::kInvalid,
+    bool paged = false
+  ):
+    Q(Q), K(K), V(V), O(O),
+    head_dim(head_dim),
+    mask(mask),
+    paged(paged) { }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace library
 } // namespace cutlass
 
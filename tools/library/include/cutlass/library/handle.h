@@ -34,7 +34,13 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include "cutlass/library/library.h"
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,10 +50,69 @@ namespace library {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+class KernelSelectionDatabase;
+class GemmDispatchCache;
+
+/// Policy choosing among the kernels compatible with a GEMM problem
+enum class GemmSelectionPolicy {
+  kFirstMatch,          ///< first compatible kernel of the highest compute capability
+  kProblemSize,         ///< SM90+ kernel with the lowest cost estimated from tile waves, tile quantization, and K depth,
+                        ///< or the first stream-K kernel if no other kernel of that compute capability is compatible
+  kProblemSizeStreamK   ///< as kProblemSize, also considering stream-K kernels
+};
+
 /// Handle object
+//
+// A handle may be shared by threads. Each thread launches on its own stream, set by set_stream(),
+// and keeps its own last operation and dispatch cache until it exits. Launches from different
+// threads proceed concurrently; setters of the handle's configuration wait for launches in progress.
+// Launches of the same grouped GEMM operation are serialized, since the operation owns per-group
+// device state.
+//
 class Handle {
+public:
+
+  /// Allocates device memory ordered on a stream. Returns nullptr on failure.
+  using WorkspaceAllocator = std::function<void *(size_t bytes, cudaStream_t stream)>;
+
+  /// Releases device memory obtained from a WorkspaceAllocator, ordered on a stream
+  using WorkspaceDeallocator = std::function<cudaError_t (void *ptr, cudaStream_t stream)>;
+
 private:
 
+  /// Device workspace owned by one stream
+  struct StreamWorkspace {
+    void *ptr{nullptr};
+    size_t capacity{0};
+  };
+
+  /// State private to each thread using the handle
+  struct ThreadState {
+
+    /// CUDA stream the thread launches on
+    cudaStream_t stream{nullptr};
+
+    /// Pointer to the most recently executed operation
+    Operation const *last_operation{nullptr};
+
+    /// Operations selected by the thread's recent gemm() and gemm_universal() calls with their
+    /// initialized host workspaces, so repeated calls with the same problem skip selection and
+    /// initialization. Kept per thread since operations update their host workspace when run.
+    std::unique_ptr<GemmDispatchCache> dispatch_cache;
+  };
+
+  /// States of the threads using a handle. Shared with each such thread, which erases its state on exit.
+  struct ThreadStates {
+
+    /// Guards states
+    std::mutex mutex;
+
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadState>> states;
+  };
+
+  /// Erases the state of the exiting thread from the handles it used
+  struct ThreadExitHook;
+
   /// Host workspace
   static int const kHostWorkspaceSize = (4 << 10);
 
@@ -57,23 +122,66 @@ private:
   /// CUDA device properties
   cudaDeviceProp device_;
 
-  /// CUDA stream
-  cudaStream_t stream_;
-
-  /// Device workspace
-  void *workspace_;
+  /// CUDA stream of threads which have not called set_stream()
+  cudaStream_t default_stream_;
 
   /// Size of device workspace in bytes
   size_t workspace_size_;
 
+  /// Device workspaces of each stream the handle has launched on. Kernels in flight on different
+  /// streams never share a workspace.
+  std::unordered_map<cudaStream_t, StreamWorkspace> stream_workspaces_;
+
+  /// Stream-ordered allocator of device workspaces
+  WorkspaceAllocator workspace_allocator_;
+
+  /// Stream-ordered deallocator of device workspaces
+  WorkspaceDeallocator workspace_deallocator_;
+
   /// Indicates whether scalars are host or device pointers
   ScalarPointerMode scalar_pointer_mode_;
 
-  /// Pointer to the most recently executed operation
-  Operation const *last_operation_;
-
   int device_idx_;
 
+  /// Profiled kernel selections consulted before the default preference heuristic
+  std::shared_ptr<KernelSelectionDatabase const> kernel_selection_database_;
+
+  /// Policy choosing among kernels compatible with a gemm_universal() problem
+  GemmSelectionPolicy gemm_selection_policy_;
+
+  /// Number of calls whose dispatch decisions each thread caches
+  size_t dispatch_cache_capacity_;
+
+  /// Number of output tiles per batch computed by device reference GEMMs, 0 computes all
+  int reference_sample_tiles_;
+
+  /// State of each thread using the handle
+  std::shared_ptr<ThreadStates> thread_states_;
+
+  /// Guards the handle's configuration. Launches hold it shared; setters hold it exclusively.
+  mutable std::shared_mutex mutex_;
+
+  /// Guards stream_workspaces_ while launches hold mutex_ shared
+  mutable std::mutex workspaces_mutex_;
+
+private:
+
+  /// Returns the state of the calling thread
+  ThreadState &thread_state_() const;
+
+  /// Returns the workspace of a stream, allocating it if needed. Guarded by workspaces_mutex_.
+  void *stream_workspace_(cudaStream_t stream);
+
+  /// Ensures a stream owns a workspace of at least workspace_size_ bytes, setting *allocated if it
+  /// was allocated, and so cleared, by this call
+  StreamWorkspace &acquire_workspace_(cudaStream_t stream, bool *allocated = nullptr);
+
+  /// Releases the workspaces of all streams after synchronizing the device. Returns the first error.
+  cudaError_t release_workspaces_();
+
+  /// Discards the cached dispatch decisions of all threads. Requires mutex_ held exclusively.
+  void clear_dispatch_caches_();
+
 public:
 
   /// Constructor
@@ -95,10 +203,12 @@ public:
   /// Returns compute capability of the selected device
   int compute_capability() const;
 
-  /// Sets the current CUDA stream
+  /// Sets the CUDA stream of the calling thread. Threads which have not called set_stream() use the
+  /// stream given to the constructor. Each stream is given its own device workspace, kept until
+  /// release_stream_workspace() or the handle is destroyed.
   void set_stream(cudaStream_t stream);
 
-  /// Gets the current CUDA stream
+  /// Gets the CUDA stream of the calling thread
   cudaStream_t get_stream() const;
 
   /// Gets the current provider
@@ -110,21 +220,62 @@ public:
   /// Gets the device workspace size
   size_t get_workspace_size() const;
 
-  /// Gets a pointer to the device workspace allocation in Global Memory
+  /// Gets a pointer to the device workspace allocation of the calling thread's stream
   void *get_workspace() const;
 
   /// Sets the size of device workspace, invalidating calls to get_device_workspace()
   void set_workspace_size(size_t bytes);
 
+  /// Sets the stream-ordered allocator of device workspaces, releasing those already allocated.
+  /// The default allocator uses cudaMallocAsync() when the device supports memory pools.
+  void set_workspace_allocator(WorkspaceAllocator allocator, WorkspaceDeallocator deallocator);
+
+  /// Releases the device workspace of a stream in the order of that stream. Call it before
+  /// destroying a stream the handle has launched on. A later launch on the stream allocates a new one.
+  void release_stream_workspace(cudaStream_t stream);
+
   /// Gets the scalar pointer mode
   ScalarPointerMode get_scalar_pointer_mode() const;
 
   /// Sets the scalar pointer mode
   void set_scalar_pointer_mode(ScalarPointerMode mode);
 
-  /// Gets the most recently executed operation
+  /// Gets the operation most recently executed by the calling thread
   Operation const *get_last_operation() const;
 
+  /// Sets the database of profiled kernel selections used by gemm() and gemm_universal()
+  void set_kernel_selection_database(std::shared_ptr<KernelSelectionDatabase const> database);
+
+  /// Loads a database of profiled kernel selections written by cutlass_profiler --kernel-selection-output
+  Status load_kernel_selection_database(std::string const &path);
+
+  /// Gets the database of profiled kernel selections
+  std::shared_ptr<KernelSelectionDatabase const> get_kernel_selection_database() const;
+
+  /// Sets the policy choosing among kernels compatible with a gemm_universal() problem when the
+  /// kernel selection database has no entry for it
+  void set_gemm_selection_policy(GemmSelectionPolicy policy);
+
+  /// Gets the policy choosing among kernels compatible with a gemm_universal() problem
+  GemmSelectionPolicy get_gemm_selection_policy() const;
+
+  /// Sets the number of GEMM calls whose dispatch decisions each thread caches. Zero disables the cache.
+  void set_dispatch_cache_capacity(size_t capacity);
+
+  /// Gets the number of GEMM calls whose dispatch decisions each thread caches
+  size_t get_dispatch_cache_capacity() const;
+
+  /// Discards the cached dispatch decisions of all threads
+  void clear_dispatch_cache();
+
+  /// Sets the number of pseudo-randomly chosen output tiles per batch that gemm_universal()
+  /// computes with Provider::kReferenceDevice. Elements of D outside them are not written. Zero
+  /// (the default) computes the whole output.
+  void set_reference_sample_tiles(int sample_tiles);
+
+  /// Gets the number of output tiles per batch computed by device reference GEMMs
+  int get_reference_sample_tiles() const;
+
   //
   // Computations
   //
@@ -225,6 +376,59 @@ public:
     int64_t batch_stride_D = 0                /// Batch stride of D operand
   );
 
+  /// Executes a GEMM computation split along K, D <= alpha * A*B + beta * C, in a single launch.
+  //
+  // Partial sums are reduced inside the kernel rather than by a separate reduction operation: CUTLASS
+  // 2.x kernels accumulate slices in turn under a semaphore and CUTLASS 3.x stream-K kernels reduce
+  // slices in their fixup. Only kernels capable of either are considered. A split_k_slices of zero
+  // chooses the number of slices from the number of output tiles the problem leaves for each SM.
+  //
+  Status gemm_split_k(
+
+    int M,                                    /// GEMM M dimension
+    int N,                                    /// GEMM N dimension
+    int K,                                    /// GEMM K dimension
+
+    int split_k_slices,                       /// Number of partitions of K dimension, or zero
+
+    int cluster_m,                            /// cluster shape M dimension
+    int cluster_n,                            /// cluster shape N dimension
+    int cluster_k,                            /// cluster shape K dimension
+    int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+    int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+    int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A matrix elements
+    LayoutTypeID layout_A,                    /// Layout of A matrix
+    ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+    void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+    int64_t lda,                              /// Leading dimension of A matrix
+
+    NumericTypeID element_B,                  /// Data type of B matrix elements
+    LayoutTypeID layout_B,                    /// Layout of B matrix
+    ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+    void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+    int64_t ldb,                              /// Leading dimension of B matrix
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C matrix
+    LayoutTypeID layout_C,                    /// Layout of C matrix
+    void const * ptr_C,                       /// Pointer to C matrix
+    int64_t ldc,                              /// Leading dimension of C matrix
+
+    NumericTypeID element_D,                  /// Data type of D matrix
+    LayoutTypeID layout_D,                    /// Layout of D matrix
+    void * ptr_D,                             /// Pointer to D matrix
+    int64_t ldd                               /// Leading dimension of D matrix
+  );
+
   /// Planar complex GEMM
   ///
   /// Note, all data types are the real-valued base types used by the planar-complex GEMM kernel.
@@ -343,6 +547,225 @@ public:
     int64_t ldd_imag                          /// Leading dimension of imaginary part of D matrix
   );
 
+  /// Grouped GEMM: D[i] <= alpha * A[i]*B[i] + beta * C[i] for each of problem_count problems.
+  //
+  // Dispatches to SM90 or newer grouped kernels. Problem sizes are read from device memory. When only
+  // host problem sizes are given, they are staged in the handle's device workspace ahead of the
+  // kernel's own workspace. Leading dimensions are copied to device storage owned by the operation.
+  // The alignment of kernels considered is derived from the host problem sizes; without them, only
+  // kernels of the lowest alignment qualify.
+  //
+  Status gemm_grouped(
+
+    int problem_count,                        /// Number of GEMMs in the group
+
+    cute::Shape<int, int, int> const *problem_sizes,       /// Device array of (M, N, K) per problem, or nullptr
+    cute::Shape<int, int, int> const *problem_sizes_host,  /// Host array of (M, N, K) per problem, or nullptr
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A matrix elements
+    LayoutTypeID layout_A,                    /// Layout of A matrix
+    ComplexTransform transform_A,             /// Complex transformation applied to A matrix
+    void const * const * ptr_A,               /// Device array of pointers to A matrices
+    int64_t const *lda,                       /// Host array of leading dimensions of A matrices
+
+    NumericTypeID element_B,                  /// Data type of B matrix elements
+    LayoutTypeID layout_B,                    /// Layout of B matrix
+    ComplexTransform transform_B,             /// Complex transformation applied to B matrix
+    void const * const * ptr_B,               /// Device array of pointers to B matrices
+    int64_t const *ldb,                       /// Host array of leading dimensions of B matrices
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C matrices
+    LayoutTypeID layout_C,                    /// Layout of C matrices
+    void const * const * ptr_C,               /// Device array of pointers to C matrices
+    int64_t const *ldc,                       /// Host array of leading dimensions of C and D matrices
+
+    NumericTypeID element_D,                  /// Data type of D matrices
+    LayoutTypeID layout_D,                    /// Layout of D matrices
+    void * const * ptr_D                      /// Device array of pointers to D matrices
+  );
+
+  /// Block-scaled GEMM: D <= alpha * (SFA * A)*(SFB * B) + beta * C
+  //
+  // Dispatches to SM100 or newer kernels scaling each sf_vec_size elements of A and B along K by an
+  // entry of SFA and SFB, such as NVFP4 (16) and MXFP4/MXFP8 (32) kernels. Kernels generating output
+  // scale factors also write SFD. Others are selected with element_SFD = NumericTypeID::kVoid,
+  // layout_SFD = layout_D and epilogue_sf_vec_size = sf_vec_size. Cluster shapes of zero select the
+  // kernel's default.
+  //
+  Status gemm_block_scaled(
+
+    int M,                                    /// GEMM M dimension
+    int N,                                    /// GEMM N dimension
+    int K,                                    /// GEMM K dimension
+
+    int cluster_m,                            /// cluster shape M dimension
+    int cluster_n,                            /// cluster shape N dimension
+    int cluster_k,                            /// cluster shape K dimension
+    int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+    int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+    int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A matrix elements
+    LayoutTypeID layout_A,                    /// Layout of A matrix
+    void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+    int64_t lda,                              /// Leading dimension of A matrix
+
+    NumericTypeID element_SFA,                /// Data type of A scale factors
+    void const * ptr_SFA,                     /// Pointer to A scale factors in Global Memory
+
+    NumericTypeID element_B,                  /// Data type of B matrix elements
+    LayoutTypeID layout_B,                    /// Layout of B matrix
+    void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+    int64_t ldb,                              /// Leading dimension of B matrix
+
+    NumericTypeID element_SFB,                /// Data type of B scale factors
+    void const * ptr_SFB,                     /// Pointer to B scale factors in Global Memory
+
+    int sf_vec_size,                          /// Number of elements along K sharing a scale factor
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C matrix
+    LayoutTypeID layout_C,                    /// Layout of C matrix
+    void const * ptr_C,                       /// Pointer to C matrix
+    int64_t ldc,                              /// Leading dimension of C matrix
+
+    NumericTypeID element_D,                  /// Data type of D matrix
+    LayoutTypeID layout_D,                    /// Layout of D matrix
+    void * ptr_D,                             /// Pointer to D matrix
+    int64_t ldd,                              /// Leading dimension of D matrix
+
+    NumericTypeID element_SFD,                /// Data type of D scale factors, or kVoid
+    LayoutTypeID layout_SFD,                  /// Layout of D scale factors
+    void * ptr_SFD,                           /// Pointer to D scale factors, or nullptr
+    int epilogue_sf_vec_size,                 /// Number of elements of D sharing a scale factor
+    void const * norm_constant,               /// Pointer to the normalization constant of SFD, or nullptr
+
+    int batch_count = 1,                      /// Batch count
+
+    int64_t batch_stride_A = 0,               /// Batch stride of A operand
+    int64_t batch_stride_B = 0,               /// Batch stride of B operand
+    int64_t batch_stride_C = 0,               /// Batch stride of C operand
+    int64_t batch_stride_D = 0                /// Batch stride of D operand
+  );
+
+  /// Blockwise-scaled GEMM: D <= alpha * (SFA * A)*(SFB * B) + beta * C
+  //
+  // Dispatches to SM90 or newer kernels scaling blocks of sf_m_vec_size x sf_k_vec_size elements of A
+  // and sf_n_vec_size x sf_k_vec_size elements of B by an entry of SFA and SFB, as in DeepSeek-style
+  // FP8 GEMMs. Cluster shapes of zero select the kernel's default.
+  //
+  Status gemm_blockwise(
+
+    int M,                                    /// GEMM M dimension
+    int N,                                    /// GEMM N dimension
+    int K,                                    /// GEMM K dimension
+
+    int cluster_m,                            /// cluster shape M dimension
+    int cluster_n,                            /// cluster shape N dimension
+    int cluster_k,                            /// cluster shape K dimension
+    int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+    int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+    int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+    NumericTypeID element_compute,            /// Data type of internal accumulation
+
+    NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+    void const *alpha,                        /// Pointer to alpha scalar
+
+    NumericTypeID element_A,                  /// Data type of A matrix elements
+    LayoutTypeID layout_A,                    /// Layout of A matrix
+    void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+    int64_t lda,                              /// Leading dimension of A matrix
+
+    NumericTypeID element_SFA,                /// Data type of A scale factors
+    void const * ptr_SFA,                     /// Pointer to A scale factors in Global Memory
+
+    NumericTypeID element_B,                  /// Data type of B matrix elements
+    LayoutTypeID layout_B,                    /// Layout of B matrix
+    void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+    int64_t ldb,                              /// Leading dimension of B matrix
+
+    NumericTypeID element_SFB,                /// Data type of B scale factors
+    void const * ptr_SFB,                     /// Pointer to B scale factors in Global Memory
+
+    int sf_m_vec_size,                        /// Rows of A sharing a scale factor
+    int sf_n_vec_size,                        /// Columns of B sharing a scale factor
+    int sf_k_vec_size,                        /// Elements along K sharing a scale factor
+
+    void const * beta,                        /// Pointer to beta scalar
+
+    NumericTypeID element_C,                  /// Data type of C matrix
+    LayoutTypeID layout_C,                    /// Layout of C matrix
+    void const * ptr_C,                       /// Pointer to C matrix
+    int64_t ldc,                              /// Leading dimension of C matrix
+
+    NumericTypeID element_D,                  /// Data type of D matrix
+    LayoutTypeID layout_D,                    /// Layout of D matrix
+    void * ptr_D,                             /// Pointer to D matrix
+    int64_t ldd,                              /// Leading dimension of D matrix
+
+    int batch_count = 1,                      /// Batch count
+
+    int64_t batch_stride_A = 0,               /// Batch stride of A operand
+    int64_t batch_stride_B = 0,               /// Batch stride of B operand
+    int64_t batch_stride_C = 0,               /// Batch stride of C operand
+    int64_t batch_stride_D = 0                /// Batch stride of D operand
+  );
+
+  /// Fused multi-head attention (forward)
+  //
+  // O = softmax(scale * Q K^T + mask) V with Q and O packed as [batch, seqlen_q, heads_q, head_dim],
+  // and K and V as [batch, seqlen_kv, heads_kv, head_dim]. Passing a page table reads K and V as
+  // [page_count, page_size, heads_kv, head_dim] pages instead.
+  //
+  Status attention(
+
+    int batch_count,                          /// Number of sequences
+    int num_heads_q,                          /// Number of query heads
+    int num_heads_kv,                         /// Number of key/value heads
+    int seqlen_q,                             /// Query sequence length
+    int seqlen_kv,                            /// Key/value sequence length
+    int head_dim,                             /// Head dimension
+
+    AttentionMask mask,                       /// Mask applied to the scores
+
+    NumericTypeID element_accumulator,        /// Data type of internal accumulation
+
+    NumericTypeID element_Q,                  /// Data type of Q elements
+    void const * ptr_Q,                       /// Pointer to Q in Global Memory
+
+    NumericTypeID element_KV,                 /// Data type of K and V elements
+    void const * ptr_K,                       /// Pointer to K in Global Memory
+    void const * ptr_V,                       /// Pointer to V in Global Memory
+
+    NumericTypeID element_O,                  /// Data type of O elements
+    void * ptr_O,                             /// Pointer to O in Global Memory
+
+    void * ptr_LSE = nullptr,                 /// Optional pointer to the float LSE, [batch, heads_q, seqlen_q]
+
+    float scale_softmax = 0,                  /// Softmax scale (0 selects 1/sqrt(head_dim))
+
+    int const * page_table = nullptr,         /// Optional page table, [batch, ceil(seqlen_kv / page_size)]
+    int page_size = 0,                        /// Tokens per page
+    int page_count = 0                        /// Number of pages
+  );
+
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
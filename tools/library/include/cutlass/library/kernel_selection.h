@@ -0,0 +1,132 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Database of profiled GEMM kernel selections consumed by library::Handle.
+
+    The database maps a bucket of problem sizes and a GEMM functional signature to the kernel and
+    runtime arguments that profiled fastest. It is produced by `cutlass_profiler
+    --kernel-selection-output=<path>` and loaded with Handle::load_kernel_selection_database().
+*/
+
+#pragma once
+
+#include <array>
+#include <iosfwd>
+#include <map>
+#include <string>
+#include <utility>
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/operation_table.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel and runtime arguments selected for a bucket of GEMM problems
+struct KernelSelection {
+
+  /// Problem size the kernel was profiled on
+  gemm::GemmCoord problem_size{};
+
+  /// Batch count the kernel was profiled on
+  int batch_count{1};
+
+  /// Name of the selected operation
+  std::string operation_name;
+
+  /// Runtime arguments the kernel was profiled with
+  RasterOrder raster_order{RasterOrder::kHeuristic};
+  int swizzle_size{1};
+  int split_k_slices{1};
+  gemm::GemmCoord cluster_shape{};
+  gemm::GemmCoord cluster_shape_fallback{};
+
+  /// Profiled runtime (ms)
+  double runtime{0};
+};
+
+/// Maps buckets of GEMM problem sizes to the fastest profiled kernel of each functional signature.
+/// Each of M, N, K, and batch count is bucketed by rounding up to a power of two.
+class KernelSelectionDatabase {
+public:
+
+  /// Bucket of a problem: log2 of M, N, K, and batch count rounded up
+  using Bucket = std::array<int, 4>;
+
+  /// (functional signature, bucket)
+  using Key = std::pair<std::string, Bucket>;
+
+  /// Version of the serialized format
+  static int const kVersion = 1;
+
+public:
+
+  /// Returns the bucket containing a problem
+  static Bucket bucket(int M, int N, int K, int batch_count);
+
+  /// Returns a string uniquely identifying the functional signature of a GEMM
+  static std::string signature(GemmFunctionalKey const &key);
+
+  /// Records a profiled kernel, keeping the fastest for each bucket and signature
+  void insert(GemmFunctionalKey const &key, KernelSelection const &selection);
+
+  /// Merges another database, keeping the fastest selection for each bucket and signature
+  void merge(KernelSelectionDatabase const &other);
+
+  /// Returns the selection for a problem or nullptr if its bucket was not profiled
+  KernelSelection const *find(GemmFunctionalKey const &key, int M, int N, int K, int batch_count) const;
+
+  /// Number of selections
+  size_t size() const { return selections_.size(); }
+
+  bool empty() const { return selections_.empty(); }
+
+  /// Writes the database as JSON
+  std::ostream &write(std::ostream &out) const;
+
+  /// Reads a database written by write(), replacing the current contents
+  Status read(std::istream &in);
+
+private:
+
+  std::map<Key, KernelSelection> selections_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -70,6 +70,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass {
+
+struct CudaHostAdapter;
+
 namespace library {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -79,6 +82,74 @@ using GemmUniversalMode = cutlass::gemm::GemmUniversalMode;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Location of an operand address within kernel parameters exported by Operation::export_arguments()
+struct OperationArgumentPatch {
+
+  /// How the address is stored
+  enum class Kind {
+    kPointer,                     ///< device pointer
+    kTensorMap                    ///< global address of a TMA descriptor
+  };
+
+  /// Operand whose address is stored
+  enum class Operand {
+    kA,
+    kB,
+    kC,
+    kD
+  };
+
+  Kind kind{Kind::kPointer};
+  Operand operand{Operand::kA};
+
+  /// Offset in bytes of the pointer or TMA descriptor within the kernel parameters
+  uint64_t offset{0};
+};
+
+/// Kernel parameters of an initialized operation, which may be relaunched with other operands
+/// without running can_implement() or initialize() again
+struct OperationArgumentPacket {
+
+  /// Kernel parameters as launched
+  std::vector<uint8_t> params;
+
+  /// Locations of operand addresses within params
+  std::vector<OperationArgumentPatch> patches;
+};
+
+/// Resources of the kernel of an operation as reported by the CUDA runtime for the current device
+struct KernelResourceUsage {
+
+  /// Registers per thread
+  int registers_per_thread{0};
+
+  /// Local memory per thread in bytes, holding register spills and the call stack
+  int64_t local_bytes_per_thread{0};
+
+  /// Statically allocated shared memory per CTA in bytes
+  int64_t static_smem_bytes{0};
+
+  /// Dynamically allocated shared memory per CTA in bytes, as requested at launch
+  int64_t dynamic_smem_bytes{0};
+
+  /// Threads per CTA, as launched
+  int threads_per_cta{0};
+
+  /// Maximum number of resident CTAs per SM
+  int max_ctas_per_sm{0};
+
+  /// Cluster size in CTAs, zero if the cluster shape is only known at runtime
+  int cluster_size{0};
+
+  /// Maximum number of co-resident clusters on the device, zero if unknown
+  int max_active_clusters{0};
+
+  /// Architecture of the SASS that was loaded, e.g. 90 for sm_90
+  int binary_version{0};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Base class for all operations
 class Operation {
 public:
@@ -128,6 +199,43 @@ public:
     return Status::kSuccess;
   }
 
+  // Initializes the device workspace as run() would and exports the resulting kernel parameters,
+  // along with the locations of operand addresses within them.
+  virtual Status export_arguments(
+    void const *arguments,
+    void *host_workspace,
+    void *device_workspace,
+    OperationArgumentPacket *packet,
+    cudaStream_t stream = nullptr) const {
+    return Status::kErrorNotSupported;
+  }
+
+  // Rewrites the operand addresses of exported kernel parameters in place. TMA descriptors are
+  // updated through cuda_adapter when given and through the CUDA driver otherwise.
+  virtual Status update_arguments(
+    OperationArgumentPacket *packet,
+    void const *ptr_A,
+    void const *ptr_B,
+    void const *ptr_C,
+    void *ptr_D,
+    CudaHostAdapter *cuda_adapter = nullptr) const;
+
+  // Launches the kernel with exported kernel parameters. The device workspace initialized by
+  // export_arguments() must not be in use by another launch.
+  virtual Status run_with_arguments(
+    OperationArgumentPacket const &packet,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter *cuda_adapter = nullptr,
+    bool launch_with_pdl = false) const {
+    return Status::kErrorNotSupported;
+  }
+
+  // Queries the register, local memory and shared memory usage and the occupancy of the kernel
+  // on the current device.
+  virtual Status get_kernel_resources(KernelResourceUsage *usage) const {
+    return Status::kErrorNotSupported;
+  }
+
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +437,17 @@ struct GemmUniversalArguments {
   library::RuntimeDatatype runtime_input_datatype_b{};
   int swizzle_size{1};
   int split_k_slices{1};
+  // Decomposition of stream-K kernels, ignored by other kernels
+  library::DecompositionMode decomposition_mode{library::DecompositionMode::kHeuristic};
+  // Fraction of A prefetched into L2 ahead of the preceding grid and fraction of the mainloop after
+  // which dependent grids are launched, ignored by kernels without weight prefetch
+  float prefetch_ratio{-1.0f};
+  float overlap_ratio{0.5f};
+  // Number of BF16 bands computed by emulated FP32 (9xBF16) kernels, 0 selects the kernel's default
+  int emulation_bands{0};
+  // Number of pseudo-randomly chosen output tiles per batch computed by device reference
+  // operations, 0 computes the whole output. Ignored by other operations.
+  int reference_sample_tiles{0};
 
   // For SM90 mixed input dtype kernels
   bool is_sm90_mixed_dtype{false};
@@ -991,6 +1110,67 @@ struct ReductionArguments {
   bool use_pdl{false};
 };
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Configuration for fused multi-head attention (forward)
+//
+// OperationKind: Attention
+//
+struct AttentionConfiguration {
+
+  /// Number of sequences in the batch
+  int batch_count{1};
+
+  /// Number of query heads
+  int num_heads_q{1};
+
+  /// Number of key/value heads (num_heads_q must be a multiple of it)
+  int num_heads_kv{1};
+
+  /// Query sequence length
+  int seqlen_q{0};
+
+  /// Key/value sequence length
+  int seqlen_kv{0};
+
+  /// Head dimension
+  int head_dim{0};
+
+  /// Tokens per KV cache page (paged operations only)
+  int page_size{0};
+
+  /// Number of pages in the KV cache (paged operations only)
+  int page_count{0};
+};
+
+/// Arguments for fused multi-head attention (forward)
+struct AttentionArguments {
+
+  /// Pointer to Q, packed as [batch, seqlen_q, num_heads_q, head_dim]
+  void const *Q{nullptr};
+
+  /// Pointer to K, packed as [batch, seqlen_kv, num_heads_kv, head_dim] or [page_count, page_size, num_heads_kv, head_dim]
+  void const *K{nullptr};
+
+  /// Pointer to V, packed like K
+  void const *V{nullptr};
+
+  /// Pointer to O, packed as [batch, seqlen_q, num_heads_q, head_dim]
+  void *O{nullptr};
+
+  /// Optional pointer to the float log-sum-exp of each row, packed as [batch, num_heads_q, seqlen_q]
+  void *lse{nullptr};
+
+  /// Pointer to the int page table, packed as [batch, ceil(seqlen_kv / page_size)] (paged operations only)
+  int const *page_table{nullptr};
+
+  /// Scale applied to Q K^T before the softmax (0 selects 1/sqrt(head_dim))
+  float scale_softmax{0};
+
+  /// Number of SMs to launch persistent kernels on (0 queries the device)
+  int sm_count{0};
+};
+
 } // namespace library
 } // namespace cutlass
 
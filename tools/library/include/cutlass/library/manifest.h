@@ -40,6 +40,9 @@
 #include <list>
 #include <memory>
 #include <map>
+#include <string>
+#include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +63,12 @@ void initialize_all(Manifest &manifest);
 // init and insert all reduction op in manifest object (manually instantiated in library/reduction)
 void initialize_all_reduction_op(Manifest &manifest);
 
+// init and insert all gemv op in manifest object (manually instantiated in library/gemv)
+void initialize_all_gemv_op(Manifest &manifest);
+
+// init and insert all attention op in manifest object (manually instantiated in library/attention)
+void initialize_all_attention_op(Manifest &manifest);
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// List of operations
@@ -77,9 +86,73 @@ private:
   /// Global list of operations
   OperationVector operations_;
 
+  /// Compute capability of the device operations are constructed for. Zero constructs operations
+  /// for all architectures.
+  int compute_capability_ = 0;
+
+  /// Filters selecting the configurations constructed by initialize(). Empty selects all.
+  std::vector<std::string> kernel_filters_;
+
 public:
   Manifest (Provider provider = library::Provider::kCUTLASS) : provider_(provider) { }
 
+  /// Restricts initialize() to operations whose minimum compute capability does not exceed the
+  /// given one. Zero constructs operations for all architectures.
+  void set_compute_capability(int compute_capability) {
+    compute_capability_ = compute_capability;
+  }
+
+  /// Restricts initialize() to configurations whose names match one of the filters. A filter is a
+  /// sequence of '*'-separated substrings which must appear in the name in order.
+  void set_kernel_filters(std::vector<std::string> filters) {
+    kernel_filters_ = std::move(filters);
+  }
+
+  /// Returns true if initialize() constructs the operations of a configuration. Called by the
+  /// generated initialization code before instantiating each configuration.
+  bool is_enabled(int min_compute_capability, char const *configuration_name) const {
+    // This function is inline s.t. it is present in generated libraries
+    // without having to compile or link in manifest.cpp
+    if (compute_capability_ && min_compute_capability > compute_capability_) {
+      return false;
+    }
+
+    if (kernel_filters_.empty()) {
+      return true;
+    }
+
+    std::string name(configuration_name);
+
+    for (std::string const &filter : kernel_filters_) {
+
+      size_t start = 0;
+      size_t begin = 0;
+      bool matches = true;
+
+      while (matches && begin <= filter.size()) {
+        size_t end = filter.find('*', begin);
+        if (end == std::string::npos) {
+          end = filter.size();
+        }
+
+        size_t idx = name.find(filter.substr(begin, end - begin), start);
+        if (idx == std::string::npos) {
+          matches = false;
+        }
+        else {
+          start = idx + (end - begin);
+        }
+        begin = end + 1;
+      }
+
+      if (matches) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
   /// Top-level initialization
   Status initialize();
 
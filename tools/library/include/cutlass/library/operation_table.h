@@ -861,6 +861,117 @@ using ReductionOperationFunctionalMap = std::unordered_map<
   ReductionFunctionalKeyHasher
 >;
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+//                          Data Structures for Attention Operations
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Tuple uniquely identifying attention functional behavior
+struct AttentionFunctionalKey {
+  library::Provider provider;
+  library::NumericTypeID element_Q;
+  library::NumericTypeID element_KV;
+  library::NumericTypeID element_O;
+  library::NumericTypeID element_accumulator;
+  int head_dim;
+  library::AttentionMask mask;
+  bool paged;
+
+  //
+  // Methods
+  //
+
+  inline
+  AttentionFunctionalKey(
+    library::Provider provider = library::Provider::kInvalid,
+    library::NumericTypeID element_Q = library::NumericTypeID::kF16,
+    library::NumericTypeID element_KV = library::NumericTypeID::kF16,
+    library::NumericTypeID element_O = library::NumericTypeID::kF16,
+    library::NumericTypeID element_accumulator = library::NumericTypeID::kF32,
+    int head_dim = 128,
+    library::AttentionMask mask = library::AttentionMask::kNone,
+    bool paged = false
+  ):
+    provider(provider),
+    element_Q(element_Q),
+    element_KV(element_KV),
+    element_O(element_O),
+    element_accumulator(element_accumulator),
+    head_dim(head_dim),
+    mask(mask),
+    paged(paged)
+  { }
+
+  inline
+  bool operator==(AttentionFunctionalKey const &rhs) const {
+    return
+      (provider == rhs.provider) &&
+      (element_Q == rhs.element_Q) &&
+      (element_KV == rhs.element_KV) &&
+      (element_O == rhs.element_O) &&
+      (element_accumulator == rhs.element_accumulator) &&
+      (head_dim == rhs.head_dim) &&
+      (mask == rhs.mask) &&
+      (paged == rhs.paged);
+  }
+
+  inline
+  bool operator!=(AttentionFunctionalKey const &rhs) const {
+    return !(*this == rhs);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline
+std::ostream& operator<< (std::ostream& out, const AttentionFunctionalKey& key) {
+    out << "{\n"
+      << "provider: " << library::to_string(key.provider) << std::endl
+      << "element_Q           : " << library::to_string(key.element_Q) << std::endl
+      << "element_KV          : " << library::to_string(key.element_KV) << std::endl
+      << "element_O           : " << library::to_string(key.element_O) << std::endl
+      << "element_accumulator : " << library::to_string(key.element_accumulator) << std::endl
+      << "head_dim            : " << key.head_dim << std::endl
+      << "mask                : " << library::to_string(key.mask) << std::endl
+      << "paged               : " << library::to_string(key.paged) << std::endl
+      << "}";
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct AttentionFunctionalKeyHasher {
+  using IntHash = std::hash<int>;
+
+  inline
+  static size_t rotl(size_t key, int shl) {
+    return (key << shl) | (key >> (sizeof(key)*8u - static_cast<size_t>(shl)));
+  }
+
+  inline
+  size_t operator()(AttentionFunctionalKey const &key) const {
+    IntHash hash;
+
+    return
+      rotl(hash(int(key.provider)), 1) ^
+      rotl(hash(int(key.element_Q)), 2) ^
+      rotl(hash(int(key.element_KV)), 3) ^
+      rotl(hash(int(key.element_O)), 4) ^
+      rotl(hash(int(key.element_accumulator)), 5) ^
+      rotl(hash(key.head_dim), 6) ^
+      rotl(hash(int(key.mask)), 7) ^
+      rotl(hash(int(key.paged)), 8);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Maps an AttentionFunctionalKey onto a vector of attention operations sorted by (cc, alignment)
+using AttentionOperationFunctionalMap = std::unordered_map<
+  AttentionFunctionalKey,
+  GemmOperationVectorMap,
+  AttentionFunctionalKeyHasher
+>;
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Table of cutlass::library::Operation instances
@@ -889,6 +1000,10 @@ public:
   // provider (kCUTLASS)
   ReductionOperationFunctionalMap reduction_operations;
 
+  /// Map of all operations of type kAttention
+  // provider (kCUTLASS, kReferenceDevice)
+  AttentionOperationFunctionalMap attention_operations;
+
 public:
 
   void append(Manifest const &manifest);
@@ -0,0 +1,93 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Emits the source of the 3.x GEMM kernel of a GemmDescription for runtime compilation.
+
+    Together with cutlass/util/nvrtc_runtime.hpp, this lets an application carry only the host side
+    of a kernel and compile its device code with NVRTC for the exact tile shape, cluster shape and
+    alignments it runs with, instead of shipping a fatbin of every configuration.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "cutlass/library/library.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Choices of a runtime GEMM instantiation that a GemmDescription does not record
+struct RuntimeGemmSourceOptions {
+
+  /// Target compute capability. The minimum compute capability of the tile description when 0.
+  int compute_capability{0};
+
+  /// Mainloop and epilogue schedules passed to the collective builders
+  std::string kernel_schedule{"cutlass::gemm::collective::KernelScheduleAuto"};
+  std::string epilogue_schedule{"cutlass::epilogue::collective::EpilogueScheduleAuto"};
+
+  /// Tile scheduler of the kernel
+  std::string tile_scheduler{"void"};
+};
+
+/// Name of the kernel type declared by the emitted source
+extern char const *kRuntimeGemmKernelName;
+
+/// NVRTC name expression of the entry point of the emitted kernel
+extern char const *kRuntimeGemmEntryPoint;
+
+/// Names of the extern "C" __device__ variables the emitted source defines to let a host-side
+/// declaration of the kernel be checked against the compiled one: sizeof(Params) (uint64_t),
+/// SharedStorageSize and MaxThreadsPerBlock (both uint32_t).
+extern char const *kRuntimeGemmParamsSizeSymbol;
+extern char const *kRuntimeGemmSharedStorageSizeSymbol;
+extern char const *kRuntimeGemmMaxThreadsSymbol;
+
+/// Emits a translation unit declaring a GemmUniversal over the collective builders for the
+/// operands, tile shape, cluster shape and alignments of a description, with a linear combination
+/// epilogue. Returns kErrorNotSupported for descriptions the builders cannot express (complex or
+/// interleaved operands, non-tensor-op math, or a pre-SM90 target).
+Status emit_gemm_universal_3x_source(
+  GemmDescription const &desc,
+  std::string &source,
+  RuntimeGemmSourceOptions const &options = RuntimeGemmSourceOptions());
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
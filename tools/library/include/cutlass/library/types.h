@@ -154,6 +154,7 @@ enum class OperationKind {
   kSparseGemm,
   kReduction,
   kGroupedGemm,
+  kAttention,
   kInvalid
 };
 
@@ -285,6 +286,25 @@ enum class RasterOrder {
   kAlongN,
   kAlongM,
   kHeuristic,
+  kL2Aware,
+  kMorton,
+  kInvalid
+};
+
+/// Decomposition of the output tiles used by stream-K tile schedulers
+enum class DecompositionMode {
+  kHeuristic,
+  kDataParallel,
+  kSplitK,
+  kStreamK,
+  kInvalid
+};
+
+/// Attention mask applied to the scores before the softmax
+enum class AttentionMask {
+  kNone,
+  kCausal,              ///< query i attends to keys j <= i
+  kCausalBottomRight,   ///< query i attends to keys j <= i + seqlen_kv - seqlen_q
   kInvalid
 };
 
@@ -187,6 +187,20 @@ char const *to_string(RasterOrder type, bool pretty = false);
 template<>
 RasterOrder from_string<RasterOrder>(std::string const &str);
 
+/// Converts a DecompositionMode enumerant to a string
+char const *to_string(DecompositionMode type, bool pretty = false);
+
+/// Convers a DecompositionMode enumerant from a string
+template<>
+DecompositionMode from_string<DecompositionMode>(std::string const &str);
+
+/// Converts an AttentionMask enumerant to a string
+char const *to_string(AttentionMask type, bool pretty = false);
+
+/// Converts an AttentionMask enumerant from a string
+template<>
+AttentionMask from_string<AttentionMask>(std::string const &str);
+
 /// Converts a bool to a string
 char const *to_string(bool type, bool pretty = false);
 
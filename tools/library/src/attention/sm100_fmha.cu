@@ -0,0 +1,182 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Instances of the SM100 forward FMHA kernel (examples/77_blackwell_fmha) in CUTLASS Library.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+#include "device/fmha.hpp"
+#include "collective/fmha_fusion.hpp"
+#include "collective/sm100_fmha_fwd_mainloop_tma_warpspecialized.hpp"
+#include "collective/sm100_fmha_fwd_epilogue_tma_warpspecialized.hpp"
+#include "kernel/fmha_tile_scheduler.hpp"
+#include "kernel/sm100_fmha_fwd_kernel_tma_warpspecialized.hpp"
+
+#include "attention_operation_3x.hpp"
+#endif
+
+namespace cutlass {
+namespace library {
+
+// naming convention cutlass3x_sm100_tensorop_fmha_fwd_[ElementQKV]_[ElementO]_[ElementAccumulator]_[TileShape]_[Mask][_paged]
+
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+namespace {
+
+template <int HeadDim>
+using Sm100FmhaFwdTileShape = cute::Shape<cute::_256, cute::_128, cute::Int<HeadDim>>;
+
+using StrideQ = cute::tuple<int, cute::_1, cute::tuple<cute::tuple<int, int>, int>>;    // Q D ((H_R, H_K), B)
+using StrideK = cute::tuple<int, cute::_1, cute::tuple<cute::tuple<cute::_0, int>, int>>;  // K D ((H_R, H_K), B)
+using StrideLSE = cute::tuple<cute::_1, cute::tuple<cute::tuple<int, int>, int>>;         // Q ((H_R, H_K), B)
+
+template <
+  class Element,
+  int HeadDim,
+  class Mask
+>
+using Sm100FmhaFwdMainloop = cutlass::fmha::collective::Sm100FmhaFwdMainloopTmaWarpspecialized<
+  Element, float, float,
+  Sm100FmhaFwdTileShape<HeadDim>, StrideQ, StrideK, StrideK,
+  Mask
+>;
+
+template <
+  class Element,
+  class ElementOut,
+  int HeadDim,
+  class Mask
+>
+using Sm100FmhaFwd = cutlass::fmha::device::FMHA<
+  cutlass::fmha::kernel::Sm100FmhaFwdKernelTmaWarpspecialized<
+    // Q K D ((H_R, H_K) B)
+    cute::tuple<int, int, int, cute::tuple<cute::tuple<int, int>, int>>,
+    Sm100FmhaFwdMainloop<Element, HeadDim, Mask>,
+    cutlass::fmha::collective::Sm100FmhaFwdEpilogueTmaWarpspecialized<
+      ElementOut, float,
+      typename Sm100FmhaFwdMainloop<Element, HeadDim, Mask>::TileShapePV,
+      StrideQ, StrideLSE
+    >,
+    cutlass::fmha::kernel::PersistentTileScheduler
+  >
+>;
+
+template <
+  class Element,
+  class ElementOut,
+  int HeadDim,
+  class Mask
+>
+using Sm100FmhaFwdOperation = Sm100FmhaOperation<
+  Sm100FmhaFwd<Element, ElementOut, HeadDim, Mask>,
+  Element, ElementOut, Sm100FmhaFwdTileShape<HeadDim>>;
+
+// the residual mask covers seqlen_kv that is not a multiple of the kv tile
+using NoMask = cutlass::fmha::collective::ResidualMask;
+using CausalMask = cutlass::fmha::collective::CausalMask<true>;
+using CausalBottomRightMask = cutlass::fmha::collective::CausalMask<false>;
+
+} // namespace
+#endif
+
+void initialize_attention_sm100_fmha_fwd_f16(Manifest &manifest) {
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+  // every kernel is registered once for contiguous and once for paged K/V
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 64, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x64_none", AttentionMask::kNone));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 64, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x64_none_paged", AttentionMask::kNone, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 64, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x64_causal", AttentionMask::kCausal));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 64, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x64_causal_paged", AttentionMask::kCausal, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 64, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x64_causal_br", AttentionMask::kCausalBottomRight));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 64, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x64_causal_br_paged", AttentionMask::kCausalBottomRight, true));
+
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 128, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x128_none", AttentionMask::kNone));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 128, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x128_none_paged", AttentionMask::kNone, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 128, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x128_causal", AttentionMask::kCausal));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 128, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x128_causal_paged", AttentionMask::kCausal, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 128, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x128_causal_br", AttentionMask::kCausalBottomRight));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::half_t, cutlass::half_t, 128, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_f16_f16_f32_256x128x128_causal_br_paged", AttentionMask::kCausalBottomRight, true));
+#endif
+}
+
+void initialize_attention_sm100_fmha_fwd_bf16(Manifest &manifest) {
+#if defined(CUTLASS_ARCH_MMA_SM100_SUPPORTED)
+
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 64, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x64_none", AttentionMask::kNone));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 64, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x64_none_paged", AttentionMask::kNone, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 64, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x64_causal", AttentionMask::kCausal));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 64, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x64_causal_paged", AttentionMask::kCausal, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 64, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x64_causal_br", AttentionMask::kCausalBottomRight));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 64, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x64_causal_br_paged", AttentionMask::kCausalBottomRight, true));
+
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 128, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x128_none", AttentionMask::kNone));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 128, NoMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x128_none_paged", AttentionMask::kNone, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 128, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x128_causal", AttentionMask::kCausal));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 128, CausalMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x128_causal_paged", AttentionMask::kCausal, true));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 128, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x128_causal_br", AttentionMask::kCausalBottomRight));
+  manifest.append(new Sm100FmhaFwdOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 128, CausalBottomRightMask>(
+    "cutlass3x_sm100_tensorop_fmha_fwd_bf16_bf16_f32_256x128x128_causal_br_paged", AttentionMask::kCausalBottomRight, true));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
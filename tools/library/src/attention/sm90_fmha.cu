@@ -0,0 +1,123 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Instances of the SM90 forward FMHA kernel (examples/88_hopper_fmha) in CUTLASS Library.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+#include "collective/fmha_fusion.hpp"
+#include "device/device_universal.hpp"
+#include "kernel/fmha_kernel_builder.hpp"
+
+#include "attention_operation_3x.hpp"
+#endif
+
+namespace cutlass {
+namespace library {
+
+// naming convention cutlass3x_sm90_tensorop_fmha_fwd_[ElementQKV]_[ElementO]_[ElementAccumulator]_[TileShape]_[Mask]_warpspecialized_cooperative
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+namespace {
+
+// tile shapes of the cooperative kernels in examples/88_hopper_fmha
+template <int HeadDim>
+using Sm90FmhaFwdTileShape = cute::Shape<cute::_128, cute::Int<HeadDim == 64 ? 64 : 128>, cute::Int<HeadDim>>;
+
+using Stride = cute::tuple<int, cute::_1, cute::tuple<int, int>>;  // S D (B H)
+
+template <
+  class Element,
+  int HeadDim,
+  class Fusion
+>
+using Sm90FmhaFwd = cutlass::device::Universal<
+  typename cutlass::fmha::kernel::FmhaBuilder<
+    Element, float, float,
+    Sm90FmhaFwdTileShape<HeadDim>, Stride, Stride, Stride,
+    Fusion, cutlass::gemm::KernelTmaWarpSpecializedCooperative
+  >::Kernel
+>;
+
+template <
+  class Element,
+  int HeadDim,
+  class Fusion
+>
+using Sm90FmhaFwdOperation = Sm90FmhaOperation<
+  Sm90FmhaFwd<Element, HeadDim, Fusion>,
+  Element, Element, Sm90FmhaFwdTileShape<HeadDim>>;
+
+// the residual fusion covers seqlen_kv that is not a multiple of the kv tile
+using NoMask = cutlass::fmha::collective::ResidualFusion;
+using CausalMask = cutlass::fmha::collective::CausalFusion;
+
+} // namespace
+#endif
+
+void initialize_attention_sm90_fmha_fwd_f16(Manifest &manifest) {
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::half_t, 64, NoMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_f16_f16_f32_128x64x64_none_warpspecialized_cooperative", AttentionMask::kNone));
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::half_t, 64, CausalMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_f16_f16_f32_128x64x64_causal_warpspecialized_cooperative", AttentionMask::kCausal));
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::half_t, 128, NoMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_f16_f16_f32_128x128x128_none_warpspecialized_cooperative", AttentionMask::kNone));
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::half_t, 128, CausalMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_f16_f16_f32_128x128x128_causal_warpspecialized_cooperative", AttentionMask::kCausal));
+#endif
+}
+
+void initialize_attention_sm90_fmha_fwd_bf16(Manifest &manifest) {
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::bfloat16_t, 64, NoMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_bf16_bf16_f32_128x64x64_none_warpspecialized_cooperative", AttentionMask::kNone));
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::bfloat16_t, 64, CausalMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_bf16_bf16_f32_128x64x64_causal_warpspecialized_cooperative", AttentionMask::kCausal));
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::bfloat16_t, 128, NoMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_bf16_bf16_f32_128x128x128_none_warpspecialized_cooperative", AttentionMask::kNone));
+  manifest.append(new Sm90FmhaFwdOperation<cutlass::bfloat16_t, 128, CausalMask>(
+    "cutlass3x_sm90_tensorop_fmha_fwd_bf16_bf16_f32_128x128x128_causal_warpspecialized_cooperative", AttentionMask::kCausal));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
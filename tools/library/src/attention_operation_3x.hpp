@@ -0,0 +1,412 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Defines the attention operations of the CUTLASS Library backed by the FMHA example kernels.
+
+   The kernel headers (examples/77_blackwell_fmha, examples/88_hopper_fmha) must be included
+   before this file, and the operations are only instantiated by translation units that do so.
+*/
+
+#pragma once
+
+#include <cmath>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/library/library.h"
+#include "library_internal.h"
+#include "cute/tensor.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Attention operation whose Operator is a device adapter (cutlass::fmha::device::FMHA or
+/// cutlass::device::Universal) over a forward FMHA kernel. The configuration is kept in the host
+/// workspace next to the Operator, since run() only receives the arguments.
+template <
+  typename Operator_,
+  typename Element_,
+  typename ElementOut_,
+  typename TileShape_        // (TileQ, TileKV, HeadDim)
+>
+class AttentionOperation3xBase : public Operation {
+public:
+
+  using Operator = Operator_;
+  using OperatorArguments = typename Operator::Arguments;
+  using Element = Element_;
+  using ElementOut = ElementOut_;
+  using TileShape = TileShape_;
+  using ElementAccumulator = float;
+
+  static int const kHeadDim = cute::size<2>(TileShape{});
+  static int const kAlignment = 128 / cutlass::sizeof_bits<Element>::value;
+
+  struct HostWorkspace {
+    AttentionConfiguration configuration;
+    Operator op;
+  };
+
+protected:
+
+  AttentionDescription description_;
+
+public:
+
+  /// Constructor
+  AttentionOperation3xBase(
+      char const *name,
+      int cc_min,
+      int cc_max,
+      AttentionMask mask,
+      bool paged) {
+
+    description_.name = name;
+    description_.provider = Provider::kCUTLASS;
+    description_.kind = OperationKind::kAttention;
+
+    description_.tile_description.threadblock_shape = make_Coord(
+      int(cute::size<0>(TileShape{})),
+      int(cute::size<1>(TileShape{})),
+      kHeadDim);
+
+    description_.tile_description.math_instruction.element_accumulator =
+      NumericTypeMap<ElementAccumulator>::kId;
+    description_.tile_description.math_instruction.opcode_class = OpcodeClassID::kTensorOp;
+    description_.tile_description.math_instruction.math_operation = MathOperationID::kMultiplyAdd;
+    description_.tile_description.minimum_compute_capability = cc_min;
+    description_.tile_description.maximum_compute_capability = cc_max;
+
+    description_.Q = make_TensorDescription<Element, layout::RowMajor>(kAlignment);
+    description_.K = make_TensorDescription<Element, layout::RowMajor>(kAlignment);
+    description_.V = make_TensorDescription<Element, layout::RowMajor>(kAlignment);
+    description_.O = make_TensorDescription<ElementOut, layout::RowMajor>(
+      128 / cutlass::sizeof_bits<ElementOut>::value);
+    description_.head_dim = kHeadDim;
+    description_.mask = mask;
+    description_.paged = paged;
+  }
+
+  /// Returns the description of the attention operation
+  OperationDescription const & description() const override {
+    return description_;
+  }
+
+protected:
+
+  /// Maps the library configuration and arguments onto the kernel arguments
+  virtual Status update_arguments_(
+      OperatorArguments &operator_args,
+      AttentionConfiguration const &configuration,
+      AttentionArguments const &arguments,
+      void *device_workspace) const = 0;
+
+  /// Bytes of device workspace the operation needs ahead of the kernel's own workspace
+  virtual uint64_t extra_workspace_size_(AttentionConfiguration const &configuration) const {
+    return 0;
+  }
+
+  /// Checks the problem against what the operation was compiled for
+  Status check_configuration_(AttentionConfiguration const &configuration) const {
+    if (configuration.head_dim != kHeadDim ||
+        configuration.num_heads_kv <= 0 ||
+        configuration.num_heads_q % configuration.num_heads_kv != 0 ||
+        configuration.seqlen_q <= 0 || configuration.seqlen_kv <= 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    if (description_.paged && (configuration.page_size <= 0 || configuration.page_count <= 0)) {
+      return Status::kErrorInvalidProblem;
+    }
+    return Status::kSuccess;
+  }
+
+  /// Fills the hardware info, querying the SM count if the arguments leave it unset
+  static KernelHardwareInfo make_hw_info_(AttentionArguments const &arguments) {
+    KernelHardwareInfo hw_info;
+    cudaGetDevice(&hw_info.device_id);
+    hw_info.sm_count = arguments.sm_count > 0 ? arguments.sm_count :
+      KernelHardwareInfo::query_device_multiprocessor_count(hw_info.device_id);
+    return hw_info;
+  }
+
+public:
+
+  /// Returns success if the operation can proceed
+  Status can_implement(
+      void const *configuration_ptr, void const *arguments_ptr) const override {
+
+    AttentionConfiguration const &configuration = *static_cast<AttentionConfiguration const *>(configuration_ptr);
+
+    Status status = check_configuration_(configuration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    OperatorArguments args;
+    status = update_arguments_(
+      args, configuration, *static_cast<AttentionArguments const *>(arguments_ptr), nullptr);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    return Operator::can_implement(args);
+  }
+
+  /// Gets the host-side workspace
+  uint64_t get_host_workspace_size(void const *configuration) const override {
+    return sizeof(HostWorkspace);
+  }
+
+  /// Gets the device-side workspace
+  uint64_t get_device_workspace_size(
+      void const *configuration_ptr, void const *arguments_ptr = nullptr) const override {
+
+    AttentionConfiguration const &configuration = *static_cast<AttentionConfiguration const *>(configuration_ptr);
+
+    OperatorArguments args;
+    AttentionArguments arguments;
+    if (arguments_ptr != nullptr) {
+      arguments = *static_cast<AttentionArguments const *>(arguments_ptr);
+    }
+    if (update_arguments_(args, configuration, arguments, nullptr) != Status::kSuccess) {
+      return 0;
+    }
+
+    return extra_workspace_size_(configuration) + Operator::get_workspace_size(args);
+  }
+
+  /// Initializes the workspace
+  Status initialize(
+      void const *configuration_ptr,
+      void *host_workspace,
+      void *device_workspace,
+      cudaStream_t stream = nullptr) const override {
+
+    AttentionConfiguration const &configuration = *static_cast<AttentionConfiguration const *>(configuration_ptr);
+
+    Status status = check_configuration_(configuration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    HostWorkspace *workspace = new (host_workspace) HostWorkspace;
+    workspace->configuration = configuration;
+    return Status::kSuccess;
+  }
+
+  /// Runs the kernel
+  Status run(
+      void const *arguments_ptr,
+      void *host_workspace,
+      void *device_workspace = nullptr,
+      cudaStream_t stream = nullptr) const override {
+
+    HostWorkspace *workspace = static_cast<HostWorkspace *>(host_workspace);
+
+    OperatorArguments args;
+    Status status = update_arguments_(
+      args, workspace->configuration, *static_cast<AttentionArguments const *>(arguments_ptr), device_workspace);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    uint8_t *kernel_workspace = static_cast<uint8_t *>(device_workspace);
+    if (kernel_workspace != nullptr) {
+      kernel_workspace += extra_workspace_size_(workspace->configuration);
+    }
+
+    // The TMA descriptors are rebuilt for every new set of arguments
+    return workspace->op.run(args, kernel_workspace, stream);
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Attention operation over the SM100 forward FMHA kernel (examples/77_blackwell_fmha).
+/// Supports grouped query attention, any softmax scale and paged K/V.
+template <
+  typename Operator_,
+  typename Element_,
+  typename ElementOut_,
+  typename TileShape_
+>
+class Sm100FmhaOperation : public AttentionOperation3xBase<Operator_, Element_, ElementOut_, TileShape_> {
+public:
+
+  using Base = AttentionOperation3xBase<Operator_, Element_, ElementOut_, TileShape_>;
+  using typename Base::OperatorArguments;
+  using typename Base::Element;
+  using typename Base::ElementOut;
+  using typename Base::ElementAccumulator;
+
+  /// Constructor
+  Sm100FmhaOperation(char const *name, AttentionMask mask, bool paged = false):
+    Base(name,
+      ArchMap<arch::Sm100, arch::OpClassTensorOp>::kMin,
+      ArchMap<arch::Sm100, arch::OpClassTensorOp>::kMax,
+      mask, paged) { }
+
+protected:
+
+  Status update_arguments_(
+      OperatorArguments &operator_args,
+      AttentionConfiguration const &c,
+      AttentionArguments const &arguments,
+      void *device_workspace) const override {
+
+    using namespace cute;
+
+    int H = c.num_heads_q;
+    int H_K = c.num_heads_kv;
+    int H_R = H / H_K;
+    int D = c.head_dim;
+    int SQ = c.seqlen_q;
+    int SK = c.seqlen_kv;
+    bool paged = this->description_.paged;
+
+    // Q K D ((H_R, H_K) B)
+    operator_args.problem_shape = make_shape(SQ, SK, D, make_shape(make_shape(H_R, H_K), c.batch_count));
+
+    auto& load = operator_args.mainloop.load;
+    load.ptr_Q = static_cast<Element const *>(arguments.Q);
+    load.dQ = make_stride(H*D, _1{}, make_stride(make_stride(D, H_R*D), H*D*SQ));
+    load.ptr_K = static_cast<Element const *>(arguments.K);
+    load.dK = make_stride(H_K*D, _1{}, make_stride(make_stride(_0{}, D), H_K*D*(paged ? c.page_size : SK)));
+    load.ptr_V = static_cast<Element const *>(arguments.V);
+    load.dV = load.dK;
+
+    if (paged) {
+      load.ptr_page_table = arguments.page_table;
+      load.stride_page_table = ceil_div(SK, c.page_size);
+      load.page_count = c.page_count;
+      load.page_size = c.page_size;
+    }
+
+    operator_args.mainloop.scale_softmax = arguments.scale_softmax;
+
+    operator_args.epilogue.ptr_O = static_cast<ElementOut *>(arguments.O);
+    operator_args.epilogue.dO = load.dQ;
+    operator_args.epilogue.ptr_LSE = static_cast<ElementAccumulator *>(arguments.lse);
+    operator_args.epilogue.dLSE = make_stride(_1{}, make_stride(make_stride(SQ, SQ*H_R), SQ*H));
+
+    operator_args.hw_info = this->make_hw_info_(arguments);
+
+    return Status::kSuccess;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Attention operation over the SM90 forward FMHA kernel (examples/88_hopper_fmha).
+/// The kernel needs as many K/V heads as query heads, applies the default 1/sqrt(head_dim) softmax
+/// scale and always writes the LSE, which goes to the device workspace if the arguments omit it.
+template <
+  typename Operator_,
+  typename Element_,
+  typename ElementOut_,
+  typename TileShape_
+>
+class Sm90FmhaOperation : public AttentionOperation3xBase<Operator_, Element_, ElementOut_, TileShape_> {
+public:
+
+  using Base = AttentionOperation3xBase<Operator_, Element_, ElementOut_, TileShape_>;
+  using typename Base::OperatorArguments;
+  using typename Base::Element;
+  using typename Base::ElementOut;
+  using typename Base::ElementAccumulator;
+
+  /// Constructor
+  Sm90FmhaOperation(char const *name, AttentionMask mask):
+    Base(name,
+      ArchMap<arch::Sm90, arch::OpClassTensorOp>::kMin,
+      ArchMap<arch::Sm90, arch::OpClassTensorOp>::kMax,
+      mask, false) { }
+
+protected:
+
+  uint64_t extra_workspace_size_(AttentionConfiguration const &c) const override {
+    uint64_t lse_size = uint64_t(c.batch_count) * c.num_heads_q * c.seqlen_q * sizeof(ElementAccumulator);
+    // keep the kernel's workspace aligned
+    return (lse_size + 127) / 128 * 128;
+  }
+
+  Status update_arguments_(
+      OperatorArguments &operator_args,
+      AttentionConfiguration const &c,
+      AttentionArguments const &arguments,
+      void *device_workspace) const override {
+
+    using namespace cute;
+
+    int H = c.num_heads_q;
+    int D = c.head_dim;
+    int SQ = c.seqlen_q;
+    int SK = c.seqlen_kv;
+
+    if (c.num_heads_kv != H) {
+      return Status::kErrorNotSupported;
+    }
+    if (arguments.scale_softmax != 0 &&
+        std::abs(arguments.scale_softmax * std::sqrt(float(D)) - 1.0f) > 1e-6f) {
+      return Status::kErrorNotSupported;
+    }
+
+    // B H Q K D
+    operator_args.problem_size = make_shape(c.batch_count, H, SQ, SK, D);
+
+    auto& mainloop = operator_args.mainloop;
+    mainloop.ptr_Q = static_cast<Element const *>(arguments.Q);
+    mainloop.dQ = make_stride(H*D, _1{}, make_stride(SQ*H*D, D));
+    mainloop.ptr_K = static_cast<Element const *>(arguments.K);
+    mainloop.dK = make_stride(H*D, _1{}, make_stride(SK*H*D, D));
+    mainloop.ptr_V = static_cast<Element const *>(arguments.V);
+    mainloop.dV = mainloop.dK;
+
+    operator_args.epilogue.ptr_O = static_cast<ElementOut *>(arguments.O);
+    operator_args.epilogue.dO = mainloop.dQ;
+    operator_args.epilogue.ptr_LSE = static_cast<ElementAccumulator *>(
+      arguments.lse != nullptr ? arguments.lse : device_workspace);
+    operator_args.epilogue.dLSE = make_stride(_1{}, make_stride(H*SQ, SQ));
+
+    operator_args.hw_info = this->make_hw_info_(arguments);
+
+    return Status::kSuccess;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass::library
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
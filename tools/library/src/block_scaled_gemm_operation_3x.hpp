@@ -290,11 +290,19 @@ template <typename FusionArgs>
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
+        case RasterOrder::kMorton:
+          operator_args.scheduler.raster_order = Enum_t::Morton;
+          break;
         default: 
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
     }
 
+    GemmOperation3xBase<Operator_>::update_operand_element_bits_(operator_args.scheduler);
+
     if constexpr (std::is_same_v<typename Operator::GemmKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
       operator_args.scheduler.splits = arguments->split_k_slices;
     }
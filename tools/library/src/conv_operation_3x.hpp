@@ -37,12 +37,18 @@
 #include "cutlass/cutlass.h"
 #include "cutlass/library/library.h"
 #include "library_internal.h"
+#include "operation_argument_packet.h"
+#include "kernel_resources.h"
 #include "cutlass/conv/convnd_problem_shape.hpp"
 #include "cutlass/util/packed_stride.hpp"
 #include "cutlass/detail/dependent_false.hpp"
 #include "cutlass/trace.h"
+#include <cstring>
+#include <list>
+#include <mutex>
 #include <utility>
 #include <variant>
+#include <vector>
 #if defined(CUTLASS_DEBUG_TRACE_LEVEL)
 #include <sstream>
 #endif
@@ -184,6 +190,21 @@ public:
     return static_cast<OperationDescription const&>(description_);
   }
 
+  /// Queries the resource usage and occupancy of the kernel on the current device
+  Status get_kernel_resources(KernelResourceUsage *usage) const override {
+    using ConvKernel = typename Operator::ConvKernel;
+    dim3 cluster(
+      Operator::ClusterShape::kM,
+      Operator::ClusterShape::kN,
+      Operator::ClusterShape::kK);
+    return query_kernel_resources(
+      (void const *)device_kernel<ConvKernel>,
+      ConvKernel::get_block_shape(),
+      ConvKernel::SharedStorageSize,
+      cluster,
+      usage);
+  }
+
 private:
   Status update_operator_arguments_from_configuration_2d_or_3d(
     typename Operator::Arguments& out_args,
@@ -359,8 +380,81 @@ public:
       return status;
     }
 
+    // Relaunch the kernel parameters cached for this problem, patching in the new operands
+    ArgumentCacheKey key;
+    bool cacheable = make_argument_cache_key_(key, out_args, *in_args_ptr);
+
+    OperationArgumentPacket packet;
+    if (cacheable && find_cached_arguments_(key, packet) &&
+        update_arguments(&packet, in_args_ptr->A, in_args_ptr->B, in_args_ptr->C, in_args_ptr->D) == Status::kSuccess) {
+      return run_with_arguments(packet, stream);
+    }
+
     auto* op = reinterpret_cast<Operator*>(host_workspace);
-    return op->run(out_args, device_workspace, stream, nullptr, in_args_ptr->use_pdl);
+    status = op->run(out_args, device_workspace, stream, nullptr, in_args_ptr->use_pdl);
+
+    if (status == Status::kSuccess && cacheable) {
+      cache_arguments_(key, op->params(), out_args, device_workspace);
+    }
+    return status;
+  }
+
+  /// Initializes the device workspace and exports the kernel parameters for a set of arguments.
+  /// The problem is the configuration of the last successful initialize() call.
+  Status export_arguments(
+    void const* arguments,
+    void* host_workspace,
+    void* device_workspace,
+    OperationArgumentPacket* packet,
+    cudaStream_t stream = nullptr) const override
+  {
+    using Params = typename Operator::Params;
+
+    if (arguments == nullptr || host_workspace == nullptr || packet == nullptr) {
+      return Status::kInvalid;
+    }
+
+    typename Operator::Arguments out_args{};
+    Status status = update_operator_arguments_from_stored_configuration(out_args);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    status = update_operator_arguments_from_arguments(out_args, *reinterpret_cast<ConvArguments const*>(arguments));
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    auto* op = reinterpret_cast<Operator*>(host_workspace);
+    status = op->initialize(out_args, device_workspace, stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    packet->params.resize(sizeof(Params));
+    std::memcpy(packet->params.data(), &op->params(), sizeof(Params));
+
+    return locate_argument_patches_(out_args, device_workspace, packet->patches);
+  }
+
+  /// Launches the kernel with exported kernel parameters. ConvUniversalAdapter launches do not
+  /// support programmatic dependent launch, so launch_with_pdl is ignored.
+  Status run_with_arguments(
+    OperationArgumentPacket const& packet,
+    cudaStream_t stream = nullptr,
+    CudaHostAdapter* cuda_adapter = nullptr,
+    bool /* launch_with_pdl */ = false) const override
+  {
+    using Params = typename Operator::Params;
+
+    if (packet.params.size() != sizeof(Params)) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    alignas(Params) uint8_t storage[sizeof(Params)];
+    std::memcpy(storage, packet.params.data(), sizeof(Params));
+
+    return Operator::run(*reinterpret_cast<Params*>(storage), stream, cuda_adapter);
   }
 
 private:
@@ -440,6 +534,193 @@ private:
     return std::visit(ConfigurationVisitor{out_args}, last_successful_config_);
   }
 
+  // Number of problems whose kernel parameters run() keeps for relaunch. Applications whose
+  // activation extents vary per call (e.g. detection on images of several sizes) pay for
+  // argument construction once per distinct problem.
+  static constexpr size_t kArgumentCacheCapacity = 16;
+
+  // Identifies kernel parameters cached by run(). Operand addresses are not part of the key;
+  // they are patched into the cached parameters on every launch.
+  struct ArgumentCacheKey {
+    typename Operator::ConvKernel::ProblemShape problem_shape{};
+    int device{0};
+    ScalarPointerMode pointer_mode{};
+    uint8_t alpha[sizeof(ElementCompute)]{};
+    uint8_t beta[sizeof(ElementCompute)]{};
+    void const* alpha_ptr{nullptr};
+    void const* beta_ptr{nullptr};
+    bool has_C{false};
+
+    bool operator==(ArgumentCacheKey const& rhs) const {
+      return
+        (problem_shape == rhs.problem_shape) &&
+        (device == rhs.device) &&
+        (pointer_mode == rhs.pointer_mode) &&
+        !std::memcmp(alpha, rhs.alpha, sizeof(alpha)) &&
+        !std::memcmp(beta, rhs.beta, sizeof(beta)) &&
+        (alpha_ptr == rhs.alpha_ptr) &&
+        (beta_ptr == rhs.beta_ptr) &&
+        (has_C == rhs.has_C);
+    }
+  };
+
+  // Guards the members below, since run() may be called concurrently.
+  mutable std::mutex argument_cache_mutex_;
+
+  // Cached kernel parameters in order of most recent use
+  mutable std::list<std::pair<ArgumentCacheKey, OperationArgumentPacket>> argument_cache_;
+
+  // Locations of the operand addresses within the kernel parameters. Params has the same layout
+  // for every problem, so these are located once, by the first run() that caches parameters.
+  mutable std::vector<OperationArgumentPatch> argument_patches_;
+  mutable bool argument_patches_located_{false};
+
+  // Set when the kernel parameters depend on an operand address other than through a pointer or
+  // a TMA descriptor, in which case run() always constructs them from scratch.
+  mutable bool argument_cache_disabled_{false};
+
+  // Builds the cache key of a launch. Returns false if the launch may not use cached parameters
+  // because the kernel initializes a device workspace (e.g. stream-K partial reductions).
+  bool make_argument_cache_key_(
+    ArgumentCacheKey& key,
+    typename Operator::Arguments const& out_args,
+    ConvArguments const& in_args) const
+  {
+    if (Operator::get_workspace_size(out_args) != 0) {
+      return false;
+    }
+
+    if (cudaGetDevice(&key.device) != cudaSuccess) {
+      return false;
+    }
+
+    key.problem_shape = out_args.problem_shape;
+    key.pointer_mode = in_args.pointer_mode;
+
+    if (in_args.pointer_mode == ScalarPointerMode::kHost) {
+      if (in_args.alpha) {
+        std::memcpy(key.alpha, in_args.alpha, sizeof(key.alpha));
+      }
+      if (in_args.beta) {
+        std::memcpy(key.beta, in_args.beta, sizeof(key.beta));
+      }
+    }
+    else {
+      key.alpha_ptr = in_args.alpha;
+      key.beta_ptr = in_args.beta;
+    }
+
+    key.has_C = (in_args.C != nullptr);
+    return true;
+  }
+
+  // Copies the kernel parameters cached for a key, marking them most recently used
+  bool find_cached_arguments_(ArgumentCacheKey const& key, OperationArgumentPacket& packet) const {
+    std::lock_guard<std::mutex> lock(argument_cache_mutex_);
+
+    if (argument_cache_disabled_) {
+      return false;
+    }
+
+    for (auto it = argument_cache_.begin(); it != argument_cache_.end(); ++it) {
+      if (it->first == key) {
+        argument_cache_.splice(argument_cache_.begin(), argument_cache_, it);
+        packet = argument_cache_.front().second;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Caches the kernel parameters of a launch, evicting the least recently used ones if full
+  void cache_arguments_(
+    ArgumentCacheKey const& key,
+    typename Operator::Params const& params,
+    typename Operator::Arguments const& out_args,
+    void* device_workspace) const
+  {
+    std::lock_guard<std::mutex> lock(argument_cache_mutex_);
+
+    if (!argument_patches_located_) {
+      argument_patches_located_ = true;
+      if (locate_argument_patches_(out_args, device_workspace, argument_patches_) != Status::kSuccess) {
+        argument_patches_.clear();
+        argument_cache_disabled_ = true;
+      }
+    }
+
+    if (argument_cache_disabled_) {
+      return;
+    }
+
+    argument_cache_.remove_if([&](auto const& entry) { return entry.first == key; });
+    while (argument_cache_.size() >= kArgumentCacheCapacity) {
+      argument_cache_.pop_back();
+    }
+
+    OperationArgumentPacket packet;
+    packet.params.resize(sizeof(params));
+    std::memcpy(packet.params.data(), &params, sizeof(params));
+    packet.patches = argument_patches_;
+
+    argument_cache_.emplace_front(key, std::move(packet));
+  }
+
+  // Locates each operand within the kernel parameters by building them with the operand at two
+  // probe addresses
+  static Status locate_argument_patches_(
+    typename Operator::Arguments const& out_args,
+    void* device_workspace,
+    std::vector<OperationArgumentPatch>& patches)
+  {
+    using Params = typename Operator::Params;
+
+    patches.clear();
+
+    OperationArgumentPatch::Operand const operands[] = {
+      OperationArgumentPatch::Operand::kA,
+      OperationArgumentPatch::Operand::kB,
+      OperationArgumentPatch::Operand::kC,
+      OperationArgumentPatch::Operand::kD
+    };
+
+    for (OperationArgumentPatch::Operand operand : operands) {
+
+      std::vector<uint8_t> probe_params[2];
+
+      for (int probe = 0; probe < 2; ++probe) {
+
+        typename Operator::Arguments probe_args = out_args;
+        uint64_t address = kOperandProbeAddresses[probe];
+
+        switch (operand) {
+          case OperationArgumentPatch::Operand::kA:
+            probe_args.mainloop.ptr_A = reinterpret_cast<ElementA const*>(address); break;
+          case OperationArgumentPatch::Operand::kB:
+            probe_args.mainloop.ptr_B = reinterpret_cast<ElementB const*>(address); break;
+          case OperationArgumentPatch::Operand::kC:
+            probe_args.epilogue.ptr_C = reinterpret_cast<ElementC const*>(address); break;
+          case OperationArgumentPatch::Operand::kD:
+            probe_args.epilogue.ptr_D = reinterpret_cast<ElementD*>(address); break;
+        }
+
+        Params params = Operator::ConvKernel::to_underlying_arguments(probe_args, device_workspace);
+
+        probe_params[probe].resize(sizeof(Params));
+        std::memcpy(probe_params[probe].data(), &params, sizeof(Params));
+      }
+
+      Status status = locate_operand_patches(
+        probe_params[0].data(), probe_params[1].data(), sizeof(Params), operand, patches);
+
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+
+    return Status::kSuccess;
+  }
+
   template<class FusionArgs, class = void>
   struct UpdateFusionArgs {
     static Status update_(
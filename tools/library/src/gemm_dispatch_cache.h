@@ -0,0 +1,215 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Per-handle cache of GEMM dispatch decisions and initialized host workspaces.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/kernel_selection.h"
+#include "cutlass/library/operation_table.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Least-recently-used cache mapping a GEMM call to the operation selected for it and the host
+/// workspace that operation was initialized with. A hit skips the operation table lookups, the
+/// kernel selection database, and the host-side initialization of the operation.
+class GemmDispatchCache {
+public:
+
+  /// Identifies a GEMM call. Operations bake the problem size and leading dimensions into their
+  /// host workspace during initialize(), so these are matched exactly.
+  struct Key {
+    GemmFunctionalKey functional_key;
+    GemmUniversalMode mode;
+    int alignment;
+    int m, n, k;
+    int batch_count;
+    int cluster_m, cluster_n, cluster_k;
+    int cluster_m_fallback, cluster_n_fallback, cluster_k_fallback;
+    int64_t lda, ldb, ldc, ldd;
+
+    inline
+    bool operator==(Key const &rhs) const {
+      return
+        (functional_key == rhs.functional_key) &&
+        (mode == rhs.mode) &&
+        (alignment == rhs.alignment) &&
+        (m == rhs.m) && (n == rhs.n) && (k == rhs.k) &&
+        (batch_count == rhs.batch_count) &&
+        (cluster_m == rhs.cluster_m) &&
+        (cluster_n == rhs.cluster_n) &&
+        (cluster_k == rhs.cluster_k) &&
+        (cluster_m_fallback == rhs.cluster_m_fallback) &&
+        (cluster_n_fallback == rhs.cluster_n_fallback) &&
+        (cluster_k_fallback == rhs.cluster_k_fallback) &&
+        (lda == rhs.lda) && (ldb == rhs.ldb) && (ldc == rhs.ldc) && (ldd == rhs.ldd);
+    }
+  };
+
+  struct KeyHasher {
+    inline
+    size_t operator()(Key const &key) const {
+      std::hash<int64_t> hash;
+
+      size_t h = GemmFunctionalKeyHasher()(key.functional_key);
+      int64_t const fields[] = {
+        int64_t(key.mode), key.alignment, key.m, key.n, key.k, key.batch_count,
+        key.cluster_m, key.cluster_n, key.cluster_k,
+        key.cluster_m_fallback, key.cluster_n_fallback, key.cluster_k_fallback,
+        key.lda, key.ldb, key.ldc, key.ldd
+      };
+      for (int64_t field : fields) {
+        h ^= hash(field) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+      }
+      return h;
+    }
+  };
+
+  /// Cached dispatch decision
+  struct Entry {
+
+    /// Selected operation
+    Operation const *operation{nullptr};
+
+    /// True if the operation came from the handle's kernel selection database
+    bool has_selection{false};
+
+    /// Copy of the kernel selection the operation came from
+    KernelSelection selection;
+
+    /// Host workspace initialized for the call
+    std::vector<uint8_t> host_workspace;
+
+    /// Device workspace needed by the operation. Operations needing none are not re-initialized
+    /// on a hit; others re-initialize to reset their device workspace (e.g. split-K semaphores).
+    uint64_t device_workspace_size{0};
+  };
+
+private:
+
+  using List = std::list<std::pair<Key, Entry>>;
+
+  /// Maximum number of entries
+  size_t capacity_;
+
+  /// Entries in order of most recent use
+  List entries_;
+
+  /// Index into entries_
+  std::unordered_map<Key, List::iterator, KeyHasher> index_;
+
+public:
+
+  /// Number of entries kept when no capacity is given
+  static size_t const kDefaultCapacity = 64;
+
+  explicit GemmDispatchCache(size_t capacity = kDefaultCapacity): capacity_(capacity) { }
+
+  /// Returns the cached entry for a call, marking it most recently used, or nullptr
+  Entry *find(Key const &key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &it->second->second;
+  }
+
+  /// Inserts an entry, evicting the least recently used one if the cache is full
+  Entry *insert(Key const &key, Entry &&entry) {
+    if (!capacity_) {
+      return nullptr;
+    }
+
+    erase(key);
+
+    while (entries_.size() >= capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+
+    entries_.emplace_front(key, std::move(entry));
+    index_[key] = entries_.begin();
+    return &entries_.front().second;
+  }
+
+  /// Removes the entry for a call, if any
+  void erase(Key const &key) {
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+      entries_.erase(it->second);
+      index_.erase(it);
+    }
+  }
+
+  /// Removes all entries
+  void clear() {
+    index_.clear();
+    entries_.clear();
+  }
+
+  /// Sets the maximum number of entries, evicting the least recently used ones as needed
+  void set_capacity(size_t capacity) {
+    capacity_ = capacity;
+    while (entries_.size() > capacity_) {
+      index_.erase(entries_.back().first);
+      entries_.pop_back();
+    }
+  }
+
+  size_t capacity() const {
+    return capacity_;
+  }
+
+  size_t size() const {
+    return entries_.size();
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -40,14 +40,19 @@
 #include "cutlass/array_subbyte.h"
 #include "cutlass/library/library.h"
 #include "library_internal.h"
+#include "operation_argument_packet.h"
+#include "kernel_resources.h"
 #include "cutlass/gemm/dispatch_policy.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler.hpp"
 #include "cutlass/util/packed_stride.hpp"
 #include "cutlass/util/mixed_dtype_utils.hpp"
 #include "cutlass/util/device_memory.h"
 #include "cutlass/util/reference/device/tensor_fill.h"
 #include "cutlass/util/reference/device/tensor_compare.h"
 #include "cute/tensor.hpp"
+#include <cstring>
 #include <unordered_map>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -145,6 +150,44 @@ public:
   GemmDescription const& get_gemm_description() const {
     return description_;
   }
+
+  /// Queries the resource usage and occupancy of the kernel on the current device
+  Status get_kernel_resources(KernelResourceUsage *usage) const override {
+    using GemmKernel = typename Operator::GemmKernel;
+    dim3 cluster(
+      Operator::ClusterShape::kM,
+      Operator::ClusterShape::kN,
+      Operator::ClusterShape::kK);
+    return query_kernel_resources(
+      (void const *)device_kernel<GemmKernel>,
+      GemmKernel::get_block_shape(),
+      GemmKernel::SharedStorageSize,
+      cluster,
+      usage);
+  }
+
+protected:
+
+  template<class SchedulerArgs, class = void>
+  struct UpdateOperandElementBits {
+    static void update_(SchedulerArgs&) { }
+  };
+
+  template<class SchedulerArgs>
+  struct UpdateOperandElementBits<SchedulerArgs, cute::void_t<decltype(SchedulerArgs{}.operand_element_bits)>> {
+    static void update_(SchedulerArgs& scheduler_args) {
+      // The wider of A and B bounds the operand footprint of a tile
+      scheduler_args.operand_element_bits = static_cast<int>(cute::max(
+        cutlass::sizeof_bits<ElementA>::value, cutlass::sizeof_bits<ElementB>::value));
+    }
+  };
+
+  /// Sets the operand width from which RasterOrderOptions::L2Aware sizes its stripes, for tile
+  /// schedulers which take one
+  template<class SchedulerArgs>
+  static void update_operand_element_bits_(SchedulerArgs& scheduler_args) {
+    UpdateOperandElementBits<SchedulerArgs>::update_(scheduler_args);
+  }
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -204,6 +247,44 @@ protected:
     return Status::kSuccess;
   }
 
+  template<class MainloopArgs, class = void>
+  struct UpdatePrefetchArgs {
+    static void update_(MainloopArgs&, GemmUniversalArguments const&) { }
+  };
+
+  template<class MainloopArgs>
+  struct UpdatePrefetchArgs<MainloopArgs, cute::void_t<decltype(MainloopArgs{}.prefetch_ratio)>> {
+    static void update_(MainloopArgs& mainloop_args, GemmUniversalArguments const &arguments) {
+      mainloop_args.prefetch_ratio = arguments.prefetch_ratio;
+    }
+  };
+
+  template<class MainloopArgs, class = void>
+  struct UpdateOverlapArgs {
+    static void update_(MainloopArgs&, GemmUniversalArguments const&) { }
+  };
+
+  template<class MainloopArgs>
+  struct UpdateOverlapArgs<MainloopArgs, cute::void_t<decltype(MainloopArgs{}.overlap_ratio)>> {
+    static void update_(MainloopArgs& mainloop_args, GemmUniversalArguments const &arguments) {
+      mainloop_args.overlap_ratio = arguments.overlap_ratio;
+    }
+  };
+
+  template<class MainloopArgs, class = void>
+  struct UpdateEmulationArgs {
+    static void update_(MainloopArgs&, GemmUniversalArguments const&) { }
+  };
+
+  template<class MainloopArgs>
+  struct UpdateEmulationArgs<MainloopArgs, cute::void_t<decltype(MainloopArgs{}.num_bands)>> {
+    static void update_(MainloopArgs& mainloop_args, GemmUniversalArguments const &arguments) {
+      if (arguments.emulation_bands > 0) {
+        mainloop_args.num_bands = arguments.emulation_bands;
+      }
+    }
+  };
+
   template<class FusionArgs, class = void>
   struct UpdateFusionArgs {
     static Status update_(FusionArgs const& fusion_args, GemmUniversalArguments const &arguments) {
@@ -559,14 +640,7 @@ protected:
       }  // End of "if constexpr(has_scale)"
 
       // Handle the shuffling
-      using ValueShuffle = std::conditional_t<
-        cutlass::sizeof_bits<ElementNarrow>::value == 4,
-        cute::Layout<cute::Shape<cute::_2,cute::_4>, cute::Stride<cute::_4,cute::_1>>,
-        cute::Layout<cute::Shape<cute::_2,cute::_2>, cute::Stride<cute::_2,cute::_1>>
-      >;
-      constexpr int NumShuffleAtoms = 1;
-      using MmaAtomShape = cute::Layout<cute::Shape<cute::_1,cute::Int<NumShuffleAtoms>>>;
-      using LayoutAtomQuant = decltype(compute_memory_reordering_atom<ElementWide, MmaAtomShape, ValueShuffle>());
+      using LayoutAtomQuant = typename MixedDtypeOperandFormat<CollectiveMainloop>::LayoutAtomQuant;
       // The generator only generates row-major A and col-major B at the moment
       // Need a way to read out the actual layout and stride of A/B later
       if constexpr(wider_operand == Sm90MixedInputWiderOperand::A && is_StrideB_Layout) {
@@ -603,15 +677,42 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
+        case RasterOrder::kMorton:
+          operator_args.scheduler.raster_order = Enum_t::Morton;
+          break;
         default:
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
     }
 
+    GemmOperation3xBase<Operator_>::update_operand_element_bits_(operator_args.scheduler);
+
     if constexpr (std::is_same_v<typename Operator::GemmKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
       operator_args.scheduler.splits = arguments->split_k_slices;
+      using Mode_t = decltype(operator_args.scheduler.decomposition_mode);
+      switch (arguments->decomposition_mode) {
+        case DecompositionMode::kDataParallel:
+          operator_args.scheduler.decomposition_mode = Mode_t::DataParallel;
+          break;
+        case DecompositionMode::kSplitK:
+          operator_args.scheduler.decomposition_mode = Mode_t::SplitK;
+          break;
+        case DecompositionMode::kStreamK:
+          operator_args.scheduler.decomposition_mode = Mode_t::StreamK;
+          break;
+        default:
+          operator_args.scheduler.decomposition_mode = Mode_t::Heuristic;
+      }
     }
 
+    using MainloopArgs = decltype(operator_args.mainloop);
+    UpdatePrefetchArgs<MainloopArgs>::update_(operator_args.mainloop, *arguments);
+    UpdateOverlapArgs<MainloopArgs>::update_(operator_args.mainloop, *arguments);
+    UpdateEmulationArgs<MainloopArgs>::update_(operator_args.mainloop, *arguments);
+
     if constexpr (Operator::ArchTag::kMinComputeCapability >= 100) {
       operator_args.hw_info.cluster_shape = dim3(
         arguments->cluster_shape.m(),
@@ -709,6 +810,108 @@ public:
                      static_cast<GemmUniversalArguments const *>(arguments_ptr)->use_pdl);
     return status;
   }
+
+  /// Initializes the device workspace and exports the kernel parameters for a set of arguments
+  Status export_arguments(
+      void const *arguments_ptr,
+      void *host_workspace,
+      void *device_workspace,
+      OperationArgumentPacket *packet,
+      cudaStream_t stream = nullptr) const override {
+
+    using Params = typename Operator::Params;
+    using MainloopPolicy = typename CollectiveMainloop::DispatchPolicy;
+
+    // These mainloops transform operands on the device while constructing arguments
+    if constexpr (IsRuntimeDataType || is_sm90_mixed_dtype_mainloop_(MainloopPolicy{})) {
+      return Status::kErrorNotSupported;
+    }
+    else {
+      GemmUniversalArguments const *arguments =
+        static_cast<GemmUniversalArguments const *>(arguments_ptr);
+
+      OperatorArguments args;
+      Status status = update_arguments_(args, arguments, stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      Operator *op = static_cast<Operator *>(host_workspace);
+      status = op->initialize(args, device_workspace, stream);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+
+      packet->params.resize(sizeof(Params));
+      std::memcpy(packet->params.data(), &op->params(), sizeof(Params));
+      packet->patches.clear();
+
+      // Locate each operand by building the parameters with the operand at two probe addresses
+      OperationArgumentPatch::Operand const operands[] = {
+        OperationArgumentPatch::Operand::kA,
+        OperationArgumentPatch::Operand::kB,
+        OperationArgumentPatch::Operand::kC,
+        OperationArgumentPatch::Operand::kD
+      };
+
+      for (OperationArgumentPatch::Operand operand : operands) {
+
+        std::vector<uint8_t> probe_params[2];
+
+        for (int probe = 0; probe < 2; ++probe) {
+
+          GemmUniversalArguments probe_arguments = *arguments;
+          void *address = reinterpret_cast<void *>(kOperandProbeAddresses[probe]);
+
+          switch (operand) {
+            case OperationArgumentPatch::Operand::kA: probe_arguments.A = address; break;
+            case OperationArgumentPatch::Operand::kB: probe_arguments.B = address; break;
+            case OperationArgumentPatch::Operand::kC: probe_arguments.C = address; break;
+            case OperationArgumentPatch::Operand::kD: probe_arguments.D = address; break;
+          }
+
+          OperatorArguments probe_args;
+          status = update_arguments_(probe_args, &probe_arguments);
+          if (status != Status::kSuccess) {
+            return status;
+          }
+
+          Params params = Operator::GemmKernel::to_underlying_arguments(probe_args, device_workspace);
+
+          probe_params[probe].resize(sizeof(Params));
+          std::memcpy(probe_params[probe].data(), &params, sizeof(Params));
+        }
+
+        status = locate_operand_patches(
+          probe_params[0].data(), probe_params[1].data(), sizeof(Params), operand, packet->patches);
+
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+
+      return Status::kSuccess;
+    }
+  }
+
+  /// Launches the kernel with exported kernel parameters
+  Status run_with_arguments(
+      OperationArgumentPacket const &packet,
+      cudaStream_t stream = nullptr,
+      CudaHostAdapter *cuda_adapter = nullptr,
+      bool launch_with_pdl = false) const override {
+
+    using Params = typename Operator::Params;
+
+    if (packet.params.size() != sizeof(Params)) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    alignas(Params) uint8_t storage[sizeof(Params)];
+    std::memcpy(storage, packet.params.data(), sizeof(Params));
+
+    return Operator::run(*reinterpret_cast<Params *>(storage), stream, cuda_adapter, launch_with_pdl);
+  }
 };
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,109 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Instances of the SM90 TMA GEMV kernel with cluster split-K in CUTLASS Library.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+#include "cutlass/gemm/device/gemv_universal_adapter.h"
+#include "cutlass/gemm/kernel/sm90_gemv_tma_split_k.hpp"
+
+#include "gemv_operation_3x.hpp"
+#endif
+
+namespace cutlass {
+namespace library {
+
+// naming convention cutlass3x_sm90_simt_gemv_[ElementA]_[ElementB]_[ElementAccumulator]_[ElementC]_[ElementD]_[TileShape]_[ClusterShape]_[Stages]_[Layouts]_align[AlignmentA]_tma_splitk
+
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+namespace {
+
+template <
+  class ElementAB,
+  class ElementCD,
+  int TileM,
+  int TileN,
+  int Splits,
+  int Stages
+>
+using Sm90GemvTmaSplitKOperation = cutlass::gemm::device::GemvUniversalAdapter<
+  cutlass::gemm::kernel::Sm90GemvTmaSplitK<
+    ElementAB, ElementAB, ElementCD, ElementCD,
+    cute::Shape<cute::Int<TileM>, cute::Int<TileN>, cute::_256>,
+    cute::Shape<cute::_1, cute::_1, cute::Int<Splits>>,
+    Stages
+  >
+>;
+
+} // namespace
+#endif
+
+void initialize_gemv_sm90_tma_split_k_e4m3_e4m3_f32_bf16_bf16(Manifest &manifest) {
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+  manifest.append(new GemvUniversal3xOperation<
+    Sm90GemvTmaSplitKOperation<cutlass::float_e4m3_t, cutlass::bfloat16_t, 32, 8, 4, 8>>(
+      "cutlass3x_sm90_simt_gemv_e4m3_e4m3_f32_bf16_bf16_32x8x256_1x1x4_8_tnn_align16_tma_splitk"
+  ));
+
+  manifest.append(new GemvUniversal3xOperation<
+    Sm90GemvTmaSplitKOperation<cutlass::float_e4m3_t, cutlass::bfloat16_t, 16, 16, 4, 8>>(
+      "cutlass3x_sm90_simt_gemv_e4m3_e4m3_f32_bf16_bf16_16x16x256_1x1x4_8_tnn_align16_tma_splitk"
+  ));
+#endif
+}
+
+void initialize_gemv_sm90_tma_split_k_bf16_bf16_f32_bf16_bf16(Manifest &manifest) {
+#if defined(CUTLASS_ARCH_MMA_SM90_SUPPORTED)
+
+  manifest.append(new GemvUniversal3xOperation<
+    Sm90GemvTmaSplitKOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 32, 8, 4, 6>>(
+      "cutlass3x_sm90_simt_gemv_bf16_bf16_f32_bf16_bf16_32x8x256_1x1x4_6_tnn_align8_tma_splitk"
+  ));
+
+  manifest.append(new GemvUniversal3xOperation<
+    Sm90GemvTmaSplitKOperation<cutlass::bfloat16_t, cutlass::bfloat16_t, 16, 16, 4, 6>>(
+      "cutlass3x_sm90_simt_gemv_bf16_bf16_f32_bf16_bf16_16x16x256_1x1x4_6_tnn_align8_tma_splitk"
+  ));
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
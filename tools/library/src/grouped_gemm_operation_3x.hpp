@@ -248,6 +248,12 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
+        case RasterOrder::kMorton:
+          operator_args.scheduler.raster_order = Enum_t::Morton;
+          break;
         default:
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
@@ -1018,6 +1024,12 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
+        case RasterOrder::kMorton:
+          operator_args.scheduler.raster_order = Enum_t::Morton;
+          break;
         default:
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
@@ -32,14 +32,22 @@
 /*! \file
     \brief CUTLASS Library handle.
 */
+#include <algorithm>
 #include <iostream>
+#include <fstream>
 #include <stdexcept>
 #include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
 
 #include "cutlass/library/handle.h"
+#include "cutlass/library/kernel_selection.h"
 #include "cutlass/library/singleton.h"
 #include "cutlass/library/util.h"
 
+#include "gemm_dispatch_cache.h"
+
 namespace cutlass {
 namespace library {
 
@@ -51,11 +59,13 @@ Handle::Handle(
   size_t workspace_size
 ):
   provider_(Provider::kCUTLASS),
-  stream_(stream),
-  workspace_(nullptr),
+  default_stream_(stream),
   workspace_size_(0),
   scalar_pointer_mode_(ScalarPointerMode::kHost),
-  last_operation_(nullptr) {
+  gemm_selection_policy_(GemmSelectionPolicy::kProblemSize),
+  dispatch_cache_capacity_(GemmDispatchCache::kDefaultCapacity),
+  reference_sample_tiles_(0),
+  thread_states_(std::make_shared<ThreadStates>()) {
 
   cudaError_t error = cudaGetDevice(&device_idx_);
   if (error != cudaSuccess) {
@@ -67,6 +77,29 @@ Handle::Handle(
     throw std::runtime_error("cudaGetDeviceProperties() failed");
   }
 
+  // Grow workspaces in stream order when the device supports memory pools
+  int memory_pools_supported = 0;
+  cudaDeviceGetAttribute(&memory_pools_supported, cudaDevAttrMemoryPoolsSupported, device_idx_);
+
+  if (memory_pools_supported) {
+    workspace_allocator_ = [](size_t bytes, cudaStream_t stream) -> void * {
+      void *ptr = nullptr;
+      return (cudaMallocAsync(&ptr, bytes, stream) == cudaSuccess) ? ptr : nullptr;
+    };
+    workspace_deallocator_ = [](void *ptr, cudaStream_t stream) {
+      return cudaFreeAsync(ptr, stream);
+    };
+  }
+  else {
+    workspace_allocator_ = [](size_t bytes, cudaStream_t) -> void * {
+      void *ptr = nullptr;
+      return (cudaMalloc(&ptr, bytes) == cudaSuccess) ? ptr : nullptr;
+    };
+    workspace_deallocator_ = [](void *ptr, cudaStream_t) {
+      return cudaFree(ptr);
+    };
+  }
+
   set_workspace_size(workspace_size);
 
   Singleton::get();
@@ -74,51 +107,71 @@ Handle::Handle(
 
 /// Destructor
 Handle::~Handle() {
-  if (workspace_) {
-
-    int device_before;
-    cudaGetDevice(&device_before);
-    if (device_before != device_idx_) {
-      cudaSetDevice(device_idx_);
-    }
-    cudaFree(workspace_);
-    if (device_before != device_idx_) {
-      cudaSetDevice(device_before);
-    }
-
-    workspace_ = nullptr;
-    workspace_size_ = 0;
-  }
+  // Errors cannot be reported from the destructor
+  release_workspaces_();
+  workspace_size_ = 0;
 }
 
 /// Move constructor
 Handle::Handle(Handle && handle) {
+
+  std::unique_lock<std::shared_mutex> lock(handle.mutex_);
+
   cudaError_t error = cudaGetDevice(&device_idx_);
   if (error != cudaSuccess) {
     throw std::runtime_error("cudaGetDevice() failed");
   }
+  provider_ = handle.provider_;
   device_ = handle.device_;
+  default_stream_ = handle.default_stream_;
   workspace_size_ = handle.workspace_size_;
-  workspace_ = handle.workspace_;
-  stream_ = handle.stream_;
+  stream_workspaces_ = std::move(handle.stream_workspaces_);
+  workspace_allocator_ = std::move(handle.workspace_allocator_);
+  workspace_deallocator_ = std::move(handle.workspace_deallocator_);
   scalar_pointer_mode_ = handle.scalar_pointer_mode_;
+  kernel_selection_database_ = std::move(handle.kernel_selection_database_);
+  gemm_selection_policy_ = handle.gemm_selection_policy_;
+  dispatch_cache_capacity_ = handle.dispatch_cache_capacity_;
+  reference_sample_tiles_ = handle.reference_sample_tiles_;
+  thread_states_ = std::move(handle.thread_states_);
 
-  handle.workspace_ = nullptr;
   handle.workspace_size_ = 0;
+  handle.stream_workspaces_.clear();
+  handle.thread_states_ = std::make_shared<ThreadStates>();
 }
 
 /// Move assignment operator
 Handle & Handle::operator=(Handle && handle) {
 
+  if (this == &handle) {
+    return *this;
+  }
+
+  std::unique_lock<std::shared_mutex> lock(mutex_, std::defer_lock);
+  std::unique_lock<std::shared_mutex> other_lock(handle.mutex_, std::defer_lock);
+  std::lock(lock, other_lock);
+
+  if (release_workspaces_() != cudaSuccess) {
+    throw std::runtime_error("Failed to release workspaces");
+  }
+
   provider_ = handle.provider_;
   device_ = handle.device_;
+  default_stream_ = handle.default_stream_;
   workspace_size_ = handle.workspace_size_;
-  workspace_ = handle.workspace_;
-  stream_ = handle.stream_;
+  stream_workspaces_ = std::move(handle.stream_workspaces_);
+  workspace_allocator_ = std::move(handle.workspace_allocator_);
+  workspace_deallocator_ = std::move(handle.workspace_deallocator_);
   scalar_pointer_mode_ = handle.scalar_pointer_mode_;
+  kernel_selection_database_ = std::move(handle.kernel_selection_database_);
+  gemm_selection_policy_ = handle.gemm_selection_policy_;
+  dispatch_cache_capacity_ = handle.dispatch_cache_capacity_;
+  reference_sample_tiles_ = handle.reference_sample_tiles_;
+  thread_states_ = std::move(handle.thread_states_);
 
-  handle.workspace_ = nullptr;
   handle.workspace_size_ = 0;
+  handle.stream_workspaces_.clear();
+  handle.thread_states_ = std::make_shared<ThreadStates>();
 
   device_idx_ = handle.device_idx_;
 
@@ -129,94 +182,391 @@ int Handle::compute_capability() const {
   return device_.major * 10 + device_.minor;
 }
 
-/// Sets the current CUDA stream
+/// Erases the state of the exiting thread from the handles it used, so that neither the states of
+/// exited threads accumulate nor a thread reusing an exited thread's id inherits its state
+struct Handle::ThreadExitHook {
+
+  std::vector<std::weak_ptr<ThreadStates>> thread_states;
+
+  ~ThreadExitHook() {
+    for (auto &weak_states : thread_states) {
+      if (std::shared_ptr<ThreadStates> states = weak_states.lock()) {
+        std::lock_guard<std::mutex> lock(states->mutex);
+        states->states.erase(std::this_thread::get_id());
+      }
+    }
+  }
+};
+
+/// Returns the state of the calling thread
+Handle::ThreadState &Handle::thread_state_() const {
+
+  static thread_local ThreadExitHook exit_hook;
+
+  std::lock_guard<std::mutex> lock(thread_states_->mutex);
+
+  std::unique_ptr<ThreadState> &state = thread_states_->states[std::this_thread::get_id()];
+
+  if (!state) {
+    state.reset(new ThreadState);
+    state->stream = default_stream_;
+    state->dispatch_cache.reset(new GemmDispatchCache(dispatch_cache_capacity_));
+
+    // Forget handles destroyed since the thread last started using one
+    auto &hooked_states = exit_hook.thread_states;
+    hooked_states.erase(
+      std::remove_if(hooked_states.begin(), hooked_states.end(),
+        [](std::weak_ptr<ThreadStates> const &states) { return states.expired(); }),
+      hooked_states.end());
+
+    hooked_states.push_back(thread_states_);
+  }
+
+  return *state;
+}
+
+/// Sets the CUDA stream of the calling thread. Each stream is given its own device workspace.
 void Handle::set_stream(cudaStream_t stream) {
-  stream_ = stream;
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  thread_state_().stream = stream;
+  stream_workspace_(stream);
 }
 
-/// Gets the current CUDA stream
+/// Gets the CUDA stream of the calling thread
 cudaStream_t Handle::get_stream() const {
-  return stream_;
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return thread_state_().stream;
 }
 
 /// Gets the current provider
 Provider Handle::get_provider() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
   return provider_;
 }
 
 /// Sets the provider of operations
 void Handle::set_provider(Provider provider) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
   provider_ = provider;
 }
 
 /// Gets the device workspace size
 size_t Handle::get_workspace_size() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
   return workspace_size_;
 }
 
-/// Gets a pointer to the device workspace allocation in Global Memory
+/// Gets a pointer to the device workspace allocation of the calling thread's stream
 void *Handle::get_workspace() const {
-  return workspace_;
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  cudaStream_t stream = thread_state_().stream;
+
+  std::lock_guard<std::mutex> workspaces_lock(workspaces_mutex_);
+  auto it = stream_workspaces_.find(stream);
+
+  return (workspace_size_ && it != stream_workspaces_.end()) ? it->second.ptr : nullptr;
 }
 
 /// Sets the size of device workspace, invalidating previous calls to get_device_workspace()
 void Handle::set_workspace_size(size_t bytes) {
-  int device_before;
-  cudaGetDevice(&device_before);
-  if (device_before != device_idx_) {
-    cudaSetDevice(device_idx_);
-  }
 
-  if (bytes != workspace_size_) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
 
-    if (workspace_) {
-      cudaFree(workspace_);
-    }
+  // Cached operations were initialized with the previous workspace
+  clear_dispatch_caches_();
 
-    workspace_ = nullptr;
-    workspace_size_ = bytes;
+  workspace_size_ = bytes;
 
-    if (workspace_size_) {
+  // Every stream already seen grows now; streams seen later are allocated at their first launch
+  stream_workspaces_[thread_state_().stream];
 
-      cudaError_t error = cudaMalloc((void **)&workspace_, workspace_size_);
+  for (auto &stream_workspace : stream_workspaces_) {
+    bool allocated = false;
+    StreamWorkspace &workspace = acquire_workspace_(stream_workspace.first, &allocated);
+
+    // Newly allocated workspaces are already cleared
+    if (!allocated && workspace.ptr && workspace_size_) {
+      cudaError_t error = cudaMemsetAsync(workspace.ptr, 0, workspace_size_, stream_workspace.first);
 
       if (error != cudaSuccess) {
-        throw std::runtime_error("Failed to allocate workspace");
+        throw std::runtime_error("Failed to clear workspace");
       }
     }
   }
+}
+
+/// Sets the stream-ordered allocator of device workspaces, releasing those already allocated
+void Handle::set_workspace_allocator(WorkspaceAllocator allocator, WorkspaceDeallocator deallocator) {
+
+  if (!allocator || !deallocator) {
+    throw std::invalid_argument("Workspace allocator and deallocator must both be provided");
+  }
+
+  size_t bytes = 0;
+
+  {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    bytes = workspace_size_;
 
-  if (workspace_) {
-    cudaError_t error = cudaMemset(workspace_, 0, workspace_size_);
+    clear_dispatch_caches_();
+    cudaError_t error = release_workspaces_();
+
+    workspace_allocator_ = std::move(allocator);
+    workspace_deallocator_ = std::move(deallocator);
 
     if (error != cudaSuccess) {
-      throw std::runtime_error("Failed to clear workspace");
+      throw std::runtime_error("Failed to release workspaces");
+    }
+  }
+
+  set_workspace_size(bytes);
+}
+
+/// Releases the device workspace of a stream in the order of that stream
+void Handle::release_stream_workspace(cudaStream_t stream) {
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+
+  auto it = stream_workspaces_.find(stream);
+  if (it == stream_workspaces_.end()) {
+    return;
+  }
+
+  // Cached operations were initialized with the released workspace
+  clear_dispatch_caches_();
+
+  cudaError_t error = cudaSuccess;
+
+  if (it->second.ptr) {
+    int device_before;
+    cudaGetDevice(&device_before);
+    if (device_before != device_idx_) {
+      cudaSetDevice(device_idx_);
+    }
+
+    error = workspace_deallocator_(it->second.ptr, stream);
+
+    if (device_before != device_idx_) {
+      cudaSetDevice(device_before);
+    }
+  }
+
+  stream_workspaces_.erase(it);
+
+  if (error != cudaSuccess) {
+    throw std::runtime_error("Failed to release workspace");
+  }
+}
+
+/// Returns the workspace of a stream, allocating it if needed
+void *Handle::stream_workspace_(cudaStream_t stream) {
+
+  std::lock_guard<std::mutex> lock(workspaces_mutex_);
+
+  StreamWorkspace &workspace = acquire_workspace_(stream);
+
+  return workspace_size_ ? workspace.ptr : nullptr;
+}
+
+/// Ensures a stream owns a workspace of at least workspace_size_ bytes
+Handle::StreamWorkspace &Handle::acquire_workspace_(cudaStream_t stream, bool *allocated) {
+
+  StreamWorkspace &workspace = stream_workspaces_[stream];
+
+  if (allocated) {
+    *allocated = false;
+  }
+
+  // Workspaces only grow. The previous allocation is released in the order of the stream that may
+  // still be using it, so growing never synchronizes the device.
+  if (workspace.capacity < workspace_size_) {
+
+    int device_before;
+    cudaGetDevice(&device_before);
+    if (device_before != device_idx_) {
+      cudaSetDevice(device_idx_);
+    }
+
+    cudaError_t error = cudaSuccess;
+
+    if (workspace.ptr) {
+      error = workspace_deallocator_(workspace.ptr, stream);
+    }
+
+    workspace.ptr = (error == cudaSuccess) ? workspace_allocator_(workspace_size_, stream) : nullptr;
+    workspace.capacity = workspace.ptr ? workspace_size_ : 0;
+
+    if (workspace.ptr) {
+      error = cudaMemsetAsync(workspace.ptr, 0, workspace_size_, stream);
+    }
+
+    if (device_before != device_idx_) {
+      cudaSetDevice(device_before);
+    }
+
+    if (!workspace.ptr || error != cudaSuccess) {
+      throw std::runtime_error("Failed to allocate workspace");
+    }
+
+    if (allocated) {
+      *allocated = true;
+    }
+  }
+
+  return workspace;
+}
+
+/// Releases the workspaces of all streams. The streams may have been destroyed since their last
+/// launch, so the device is synchronized and the workspaces are released on the legacy default stream.
+cudaError_t Handle::release_workspaces_() {
+
+  if (stream_workspaces_.empty()) {
+    return cudaSuccess;
+  }
+
+  int device_before;
+  cudaGetDevice(&device_before);
+  if (device_before != device_idx_) {
+    cudaSetDevice(device_idx_);
+  }
+
+  cudaError_t result = cudaDeviceSynchronize();
+
+  for (auto &stream_workspace : stream_workspaces_) {
+    if (stream_workspace.second.ptr) {
+      cudaError_t error = workspace_deallocator_(stream_workspace.second.ptr, nullptr);
+      if (result == cudaSuccess) {
+        result = error;
+      }
     }
   }
+
   if (device_before != device_idx_) {
     cudaSetDevice(device_before);
   }
+
+  stream_workspaces_.clear();
+
+  return result;
+}
+
+/// Discards the cached dispatch decisions of all threads
+void Handle::clear_dispatch_caches_() {
+
+  std::lock_guard<std::mutex> lock(thread_states_->mutex);
+
+  for (auto &thread_state : thread_states_->states) {
+    thread_state.second->dispatch_cache->clear();
+  }
 }
 
 /// Gets the scalar pointer mode
 ScalarPointerMode Handle::get_scalar_pointer_mode() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
   return scalar_pointer_mode_;
 }
 
 /// Sets the scalar pointer mode
 void Handle::set_scalar_pointer_mode(ScalarPointerMode mode) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
   scalar_pointer_mode_ = mode;
 }
 
-/// Gets the last operation
+/// Gets the operation most recently executed by the calling thread
 Operation const *Handle::get_last_operation() const {
-  return last_operation_;
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return thread_state_().last_operation;
+}
+
+/// Sets the database of profiled kernel selections used by gemm() and gemm_universal()
+void Handle::set_kernel_selection_database(std::shared_ptr<KernelSelectionDatabase const> database) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  kernel_selection_database_ = std::move(database);
+  clear_dispatch_caches_();
+}
+
+/// Loads a database of profiled kernel selections written by cutlass_profiler --kernel-selection-output
+Status Handle::load_kernel_selection_database(std::string const &path) {
+
+  std::ifstream file(path);
+  if (!file.good()) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  auto database = std::make_shared<KernelSelectionDatabase>();
+
+  Status status = database->read(file);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  set_kernel_selection_database(std::move(database));
+  return Status::kSuccess;
+}
+
+/// Gets the database of profiled kernel selections
+std::shared_ptr<KernelSelectionDatabase const> Handle::get_kernel_selection_database() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return kernel_selection_database_;
+}
+
+/// Sets the number of GEMM calls whose dispatch decisions each thread caches. Zero disables the cache.
+void Handle::set_dispatch_cache_capacity(size_t capacity) {
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  std::lock_guard<std::mutex> states_lock(thread_states_->mutex);
+
+  dispatch_cache_capacity_ = capacity;
+
+  for (auto &thread_state : thread_states_->states) {
+    thread_state.second->dispatch_cache->set_capacity(capacity);
+  }
+}
+
+/// Gets the number of GEMM calls whose dispatch decisions each thread caches
+size_t Handle::get_dispatch_cache_capacity() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return dispatch_cache_capacity_;
+}
+
+/// Sets the number of output tiles per batch computed by device reference GEMMs
+void Handle::set_reference_sample_tiles(int sample_tiles) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  reference_sample_tiles_ = sample_tiles;
+}
+
+/// Gets the number of output tiles per batch computed by device reference GEMMs
+int Handle::get_reference_sample_tiles() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return reference_sample_tiles_;
+}
+
+/// Sets the policy choosing among kernels compatible with a gemm_universal() problem
+void Handle::set_gemm_selection_policy(GemmSelectionPolicy policy) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  gemm_selection_policy_ = policy;
+  clear_dispatch_caches_();
+}
+
+/// Gets the policy choosing among kernels compatible with a gemm_universal() problem
+GemmSelectionPolicy Handle::get_gemm_selection_policy() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return gemm_selection_policy_;
+}
+
+/// Discards the cached dispatch decisions of all threads
+void Handle::clear_dispatch_cache() {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  clear_dispatch_caches_();
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Returns the maximum required alignment for each operator
-static int maximum_alignment_requirement(GemmDescription const &desc) {
+template <typename Description>
+static int maximum_alignment_requirement(Description const &desc) {
   return std::max(
     std::max(desc.A.alignment, desc.B.alignment), desc.C.alignment);
 }
@@ -346,97 +696,1475 @@ static Operation const * find_gemm_operation(
   return operation;
 }
 
-///////////////////////////////////////////////////////////////////////////////////////////////////
-
-/// Executes a GEMM computation: D <= alpha * A*B + beta * C
-Status Handle::gemm(
+/// Estimates the relative runtime of an SM90 or newer GEMM kernel on a problem from the number of
+/// waves of output tiles, the work wasted by partial tiles, and the depth of the K loop.
+static double estimate_gemm_cost(
+  OperationDescription const &desc,
+  int M, int N, int K,
+  int batch_count,
+  gemm::GemmCoord cluster_shape,
+  int sm_count) {
 
-  int M,                                    /// GEMM M dimension
-  int N,                                    /// GEMM N dimension
-  int K,                                    /// GEMM K dimension
+  gemm::GemmCoord tile = desc.tile_description.threadblock_shape;
 
-  NumericTypeID element_compute,            /// Data type of internal accumulation
+  if (tile.m() <= 0 || tile.n() <= 0 || tile.k() <= 0 || sm_count <= 0) {
+    return std::numeric_limits<double>::max();
+  }
 
-  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+  // 2SM kernels compute each tile on a pair of SMs
+  bool const two_sm = std::string(desc.name).find("_2sm") != std::string::npos;
+  int const sms_per_tile = two_sm ? 2 : 1;
+  int const tile_slots = std::max(1, sm_count / sms_per_tile);
 
-  void const *alpha,                        /// Pointer to alpha scalar
+  // Dynamic cluster shapes are given at runtime
+  if (!desc.tile_description.cluster_shape.m() || !desc.tile_description.cluster_shape.n()) {
+    cluster_shape = {std::max(1, cluster_shape.m() / sms_per_tile), std::max(1, cluster_shape.n()), 1};
+  }
+  else {
+    cluster_shape = {
+      std::max(1, desc.tile_description.cluster_shape.m() / sms_per_tile),
+      std::max(1, desc.tile_description.cluster_shape.n()),
+      1};
+  }
 
-  NumericTypeID element_A,                  /// Data type of A matrix elements
-  LayoutTypeID layout_A,                    /// Layout of A matrix
-  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+  // Tiles are launched in whole clusters
+  int64_t tiles_m = (M + tile.m() - 1) / tile.m();
+  int64_t tiles_n = (N + tile.n() - 1) / tile.n();
+  tiles_m = (tiles_m + cluster_shape.m() - 1) / cluster_shape.m() * cluster_shape.m();
+  tiles_n = (tiles_n + cluster_shape.n() - 1) / cluster_shape.n() * cluster_shape.n();
 
-  void const * ptr_A,                       /// Pointer to A matrix in Global Memory
-  int64_t lda,                              /// Leading dimension of A matrix
+  int64_t tiles = tiles_m * tiles_n * std::max(1, batch_count);
+  int64_t k_iterations = std::max<int64_t>(1, (K + tile.k() - 1) / tile.k());
 
-  NumericTypeID element_B,                  /// Data type of B matrix elements
-  LayoutTypeID layout_B,                    /// Layout of B matrix
-  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+  // Small tiles reuse fewer operands per MMA and fall short of peak throughput. A 128x128 tile per SM
+  // saturates the math pipe.
+  double const tile_m_per_sm = double(tile.m()) / sms_per_tile;
+  double const intensity = tile_m_per_sm * tile.n() / (tile_m_per_sm + tile.n());
+  double const efficiency = std::min(1.0, intensity / 64.0);
 
-  void const * ptr_B,                       /// Pointer to B matrix in Global Memory
-  int64_t ldb,                              /// Leading dimension of B matrix
+  double const iteration_cost = double(tile.m()) * tile.n() * tile.k() / (efficiency * sms_per_tile);
 
-  void const * beta,                        /// Pointer to beta scalar
+  bool const stream_k = std::string(desc.name).find("_stream_k") != std::string::npos;
 
-  NumericTypeID element_C,                  /// Data type of C and D matrices
+  if (stream_k) {
+    // K iterations are spread evenly across SMs, plus a fixup of partial tiles
+    return (double(tiles * k_iterations) / tile_slots + 2) * iteration_cost;
+  }
 
-  void const * ptr_C,                       /// Pointer to C matrix
-  int64_t ldc,                              /// Leading dimension of C matrix
+  // Each wave of tiles runs the full K loop plus its prologue and epilogue
+  int64_t waves = (tiles + tile_slots - 1) / tile_slots;
+  return double(waves) * (k_iterations + 1) * iteration_cost;
+}
 
-  void * ptr_D,                             /// Pointer to D matrix
-  int64_t ldd                               /// Leading dimension of D matrix
-) {
+/// Finds the kernel with the lowest estimated cost on a problem among the SM90 or newer kernels of
+/// the highest compute capability satisfying the preference key. Falls back to the first
+/// satisfying kernel for older architectures.
+static Operation const * find_gemm_operation_for_problem(
+  GemmOperationFunctionalMap::const_iterator operators_it,
+  GemmPreferenceKey const preference_key,
+  GemmSelectionPolicy policy,
+  int M, int N, int K,
+  int batch_count,
+  gemm::GemmCoord cluster_shape,
+  int sm_count) {
+
+  if (policy == GemmSelectionPolicy::kFirstMatch) {
+    return find_gemm_operation(operators_it, preference_key);
+  }
 
-  //
-  // Find the operation
-  //
+  auto cc_it = operators_it->second.upper_bound(preference_key);
 
-  GemmFunctionalKey key(
-    provider_,
-    GemmKind::kGemm,
-    element_compute,
-    element_scalar,
-    element_A,
-    layout_A,
-    transform_A,
-    element_B,
-    layout_B,
-    transform_B,
-    element_C,  // C/D are same type and col major default
-    LayoutTypeID::kColumnMajor,
-    element_C,
-    LayoutTypeID::kColumnMajor
-  );
+  while (cc_it != operators_it->second.begin()) {
+    --cc_it;
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+    Operation const *best = nullptr;
+    Operation const *first_stream_k = nullptr;
+    double best_cost = std::numeric_limits<double>::max();
 
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
+    for (auto const * op : cc_it->second) {
 
-  if (operators_it->second.empty()) {
-    return cutlass::Status::kErrorNotSupported;
-  }
+      GemmDescription const &desc = static_cast<GemmDescription const &>(op->description());
 
-  //
-  // Compute the largest alignment restriction the kernel can satisfy.
-  //
+      int min_cc = desc.tile_description.minimum_compute_capability;
+      int max_cc = desc.tile_description.maximum_compute_capability;
 
-  // Maximum alignment expectation among all kernels (in units of bytes)
-  int const kMaximumAlignmentSize = 16;
+      if (!((min_cc <= preference_key.compute_capability) &&
+        (preference_key.compute_capability <= max_cc) &&
+        (maximum_alignment_requirement(desc) <= preference_key.alignment))) {
+        continue;
+      }
 
-  int alignment = gemm_problem_alignment(
-    M, N, K,
-    element_A, ptr_A, lda, 0,
-    element_B, ptr_B, ldb, 0,
-    element_C, ptr_C, ldc, 0,
-    ptr_D, ldd, 0, kMaximumAlignmentSize
-  );
+      if (min_cc < 90) {
+        return op;
+      }
 
-  //
-  // Find the best kernel in descending order of preference.
-  //
+      // Stream-K kernels are only ranked by kProblemSizeStreamK, but one is still chosen over
+      // falling through to an older compute capability
+      if (policy != GemmSelectionPolicy::kProblemSizeStreamK &&
+        std::string(desc.name).find("_stream_k") != std::string::npos) {
+        if (!first_stream_k) {
+          first_stream_k = op;
+        }
+        continue;
+      }
 
-  GemmPreferenceKey preference_key(compute_capability(), alignment);
+      double cost = estimate_gemm_cost(desc, M, N, K, batch_count, cluster_shape, sm_count);
+
+      if (!best || cost < best_cost) {
+        best = op;
+        best_cost = cost;
+      }
+    }
+
+    if (best) {
+      return best;
+    }
+    if (first_stream_k) {
+      return first_stream_k;
+    }
+  }
+
+  return nullptr;
+}
+
+/// Finds the best SM90 or newer grouped kernel in descending order of preference.
+static Operation const * find_grouped_gemm_operation(
+  GemmOperationFunctionalMap::const_iterator operators_it,
+  GemmPreferenceKey const preference_key) {
+
+  auto cc_it = operators_it->second.upper_bound(preference_key);
+
+  while (cc_it != operators_it->second.begin()) {
+    --cc_it;
+
+    for (auto const * op : cc_it->second) {
+
+      if (op->description().kind != OperationKind::kGroupedGemm) {
+        continue;
+      }
+
+      GroupedGemmDescription const &grouped_desc =
+        static_cast<GroupedGemmDescription const &>(op->description());
+      GemmDescription const &desc = grouped_desc.gemm;
+
+      int min_cc = desc.tile_description.minimum_compute_capability;
+      int max_cc = desc.tile_description.maximum_compute_capability;
+
+      // MoE kernels additionally expect per-expert token counts
+      if (grouped_desc.is_moe || min_cc < 90) {
+        continue;
+      }
+
+      if ((min_cc <= preference_key.compute_capability) &&
+        (preference_key.compute_capability <= max_cc) &&
+        (maximum_alignment_requirement(desc) <= preference_key.alignment)) {
+
+        return op;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+/// Returns the mutex serializing launches of a grouped GEMM operation.
+///
+/// Grouped operations keep the per-group strides and scale factor layouts of the problem they were
+/// last initialized with in device buffers owned by the operation, which initialize() reallocates
+/// and refills. Operations are shared by every handle of the process, so the lock is process-wide
+/// and held from initialization through launch. Releasing the previous buffers synchronizes the
+/// device, so a launch still reading them has completed before they are replaced.
+static std::mutex &grouped_gemm_operation_mutex(Operation const *operation) {
+
+  static std::mutex map_mutex;
+  static std::unordered_map<Operation const *, std::unique_ptr<std::mutex>> operation_mutexes;
+
+  std::lock_guard<std::mutex> lock(map_mutex);
+
+  std::unique_ptr<std::mutex> &operation_mutex = operation_mutexes[operation];
+  if (!operation_mutex) {
+    operation_mutex.reset(new std::mutex);
+  }
+
+  return *operation_mutex;
+}
+
+/// Returns true if a kernel reduces the partial sums of K slices within its own launch
+static bool reduces_split_k_in_kernel(GemmDescription const &desc) {
+
+  std::string name(desc.name);
+
+  // CUTLASS 3.x kernels split K only with the stream-K tile scheduler, reducing slices in its fixup
+  if (name.find("cutlass3x_") == 0) {
+    return name.find("_stream_k") != std::string::npos;
+  }
+
+  // CUTLASS 2.x universal kernels accumulate slices in turn under a semaphore
+  return true;
+}
+
+/// Finds the best kernel reducing split-K partial sums within its own launch. SM90 or newer kernels
+/// are chosen by estimated cost; older ones in descending order of preference.
+static Operation const * find_split_k_gemm_operation(
+  GemmOperationFunctionalMap::const_iterator operators_it,
+  GemmPreferenceKey const preference_key,
+  int M, int N, int K,
+  gemm::GemmCoord cluster_shape,
+  int sm_count) {
+
+  auto cc_it = operators_it->second.upper_bound(preference_key);
+
+  while (cc_it != operators_it->second.begin()) {
+    --cc_it;
+
+    Operation const *best = nullptr;
+    double best_cost = std::numeric_limits<double>::max();
+
+    for (auto const * op : cc_it->second) {
+
+      GemmDescription const &desc = static_cast<GemmDescription const &>(op->description());
+
+      int min_cc = desc.tile_description.minimum_compute_capability;
+      int max_cc = desc.tile_description.maximum_compute_capability;
+
+      if (!((min_cc <= preference_key.compute_capability) &&
+        (preference_key.compute_capability <= max_cc) &&
+        (maximum_alignment_requirement(desc) <= preference_key.alignment) &&
+        reduces_split_k_in_kernel(desc))) {
+        continue;
+      }
+
+      if (min_cc < 90) {
+        return op;
+      }
+
+      double cost = estimate_gemm_cost(desc, M, N, K, 1, cluster_shape, sm_count);
+
+      if (!best || cost < best_cost) {
+        best = op;
+        best_cost = cost;
+      }
+    }
+
+    if (best) {
+      return best;
+    }
+  }
+
+  return nullptr;
+}
+
+/// Chooses the number of K slices filling the SMs left idle by a problem's output tiles, keeping
+/// enough K iterations in each slice to amortize its prologue and reduction.
+static int split_k_slices_for_problem(
+  GemmDescription const &desc,
+  int M, int N, int K,
+  int sm_count) {
+
+  // Minimum number of mainloop iterations per slice
+  int const kMinimumIterationsPerSlice = 4;
+
+  gemm::GemmCoord tile = desc.tile_description.threadblock_shape;
+
+  if (tile.m() <= 0 || tile.n() <= 0 || tile.k() <= 0) {
+    return 1;
+  }
+
+  int64_t tiles = int64_t((M + tile.m() - 1) / tile.m()) * ((N + tile.n() - 1) / tile.n());
+  int64_t k_iterations = (K + tile.k() - 1) / tile.k();
+
+  int64_t slices = std::min<int64_t>(
+    sm_count / std::max<int64_t>(1, tiles),
+    k_iterations / kMinimumIterationsPerSlice);
+
+  return int(std::max<int64_t>(1, slices));
+}
+
+/// Returns true for structured sparse block-scaled kernels
+static bool is_sparse_gemm(BlockScaledGemmDescription const &desc) {
+  return desc.E.element != NumericTypeID::kInvalid;
+}
+
+/// Blockwise kernels are dense
+static bool is_sparse_gemm(BlockwiseGemmDescription const &) {
+  return false;
+}
+
+/// Finds the block-scaled or blockwise kernel with the lowest estimated cost on a problem among the
+/// dense kernels of the highest compute capability satisfying the preference key.
+template <typename Description, typename FunctionalMapIterator>
+static Operation const * find_scaled_gemm_operation(
+  FunctionalMapIterator operators_it,
+  GemmPreferenceKey const preference_key,
+  GemmSelectionPolicy policy,
+  int M, int N, int K,
+  int batch_count,
+  gemm::GemmCoord cluster_shape,
+  int sm_count) {
+
+  auto cc_it = operators_it->second.upper_bound(preference_key);
+
+  while (cc_it != operators_it->second.begin()) {
+    --cc_it;
+
+    Operation const *best = nullptr;
+    Operation const *first_stream_k = nullptr;
+    double best_cost = std::numeric_limits<double>::max();
+
+    for (auto const * op : cc_it->second) {
+
+      Description const &desc = static_cast<Description const &>(op->description());
+
+      int min_cc = desc.tile_description.minimum_compute_capability;
+      int max_cc = desc.tile_description.maximum_compute_capability;
+
+      if (!((min_cc <= preference_key.compute_capability) &&
+        (preference_key.compute_capability <= max_cc) &&
+        (maximum_alignment_requirement(desc) <= preference_key.alignment))) {
+        continue;
+      }
+
+      // Sparse kernels expect A compressed by the profiler
+      if (is_sparse_gemm(desc)) {
+        continue;
+      }
+
+      if (policy == GemmSelectionPolicy::kFirstMatch) {
+        return op;
+      }
+
+      // Stream-K kernels are only ranked by kProblemSizeStreamK, but one is still chosen over
+      // falling through to an older compute capability
+      if (policy != GemmSelectionPolicy::kProblemSizeStreamK &&
+        std::string(desc.name).find("_stream_k") != std::string::npos) {
+        if (!first_stream_k) {
+          first_stream_k = op;
+        }
+        continue;
+      }
+
+      double cost = estimate_gemm_cost(desc, M, N, K, batch_count, cluster_shape, sm_count);
+
+      if (!best || cost < best_cost) {
+        best = op;
+        best_cost = cost;
+      }
+    }
+
+    if (best) {
+      return best;
+    }
+    if (first_stream_k) {
+      return first_stream_k;
+    }
+  }
+
+  return nullptr;
+}
+
+/// Returns the cluster shape to launch a kernel with. Kernels with a dynamic cluster shape default
+/// to the cluster the profiler defaults to when none is given.
+static gemm::GemmCoord scaled_gemm_cluster_shape(
+  OperationDescription const &desc,
+  gemm::GemmCoord cluster_shape) {
+
+  gemm::GemmCoord static_shape = desc.tile_description.cluster_shape;
+
+  if (static_shape.m() && static_shape.n() && static_shape.k()) {
+    return static_shape;
+  }
+
+  if (cluster_shape.m() > 0 && cluster_shape.n() > 0 && cluster_shape.k() > 0) {
+    return cluster_shape;
+  }
+
+  int cluster_m = (std::string(desc.name).find("_2sm") != std::string::npos) ? 2 : 1;
+  return {cluster_m, 1, 1};
+}
+
+/// Finds a kernel by name among those satisfying the preference key
+static Operation const * find_gemm_operation_by_name(
+  GemmOperationFunctionalMap::const_iterator operators_it,
+  GemmPreferenceKey const preference_key,
+  std::string const &operation_name) {
+
+  for (auto const & cc_operations : operators_it->second) {
+    for (auto const * op : cc_operations.second) {
+
+      GemmDescription const &desc = static_cast<GemmDescription const &>(op->description());
+
+      if (desc.name != operation_name) {
+        continue;
+      }
+
+      int min_cc = desc.tile_description.minimum_compute_capability;
+      int max_cc = desc.tile_description.maximum_compute_capability;
+
+      if ((min_cc <= preference_key.compute_capability) &&
+        (preference_key.compute_capability <= max_cc) &&
+        (maximum_alignment_requirement(desc) <= preference_key.alignment)) {
+
+        return op;
+      }
+      return nullptr;
+    }
+  }
+
+  return nullptr;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a GEMM computation: D <= alpha * A*B + beta * C
+Status Handle::gemm(
+
+  int M,                                    /// GEMM M dimension
+  int N,                                    /// GEMM N dimension
+  int K,                                    /// GEMM K dimension
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+
+  void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+  int64_t lda,                              /// Leading dimension of A matrix
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+
+  void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+  int64_t ldb,                              /// Leading dimension of B matrix
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C and D matrices
+
+  void const * ptr_C,                       /// Pointer to C matrix
+  int64_t ldc,                              /// Leading dimension of C matrix
+
+  void * ptr_D,                             /// Pointer to D matrix
+  int64_t ldd                               /// Leading dimension of D matrix
+) {
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kGemm,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,  // C/D are same type and col major default
+    LayoutTypeID::kColumnMajor,
+    element_C,
+    LayoutTypeID::kColumnMajor
+  );
+
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  int alignment = gemm_problem_alignment(
+    M, N, K,
+    element_A, ptr_A, lda, 0,
+    element_B, ptr_B, ldb, 0,
+    element_C, ptr_C, ldc, 0,
+    ptr_D, ldd, 0, kMaximumAlignmentSize
+  );
+
+  // Reuse the operation selected and initialized by an identical previous call
+  GemmDispatchCache::Key cache_key{
+    key, GemmUniversalMode::kGemm, alignment, M, N, K, 1,
+    0, 0, 0, 0, 0, 0,
+    lda, ldb, ldc, ldd
+  };
+
+  bool const use_cache = thread.dispatch_cache && thread.dispatch_cache->capacity();
+
+  GemmDispatchCache::Entry *entry = use_cache ? thread.dispatch_cache->find(cache_key) : nullptr;
+  bool const cached = (entry != nullptr);
+
+  Operation const *operation = nullptr;
+
+  if (cached) {
+    operation = entry->operation;
+  }
+  else {
+
+    auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+
+    if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    if (operators_it->second.empty()) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    //
+    // Find the best kernel in descending order of preference.
+    //
+
+    GemmPreferenceKey preference_key(compute_capability(), alignment);
+
+    // Prefer the kernel that profiled fastest for this bucket of problem sizes
+    if (kernel_selection_database_) {
+      KernelSelection const *selection = kernel_selection_database_->find(key, M, N, K, 1);
+      if (selection) {
+        operation = find_gemm_operation_by_name(operators_it, preference_key, selection->operation_name);
+      }
+    }
+
+    if (!operation) {
+      operation = find_gemm_operation(operators_it, preference_key);
+    }
+
+    if (!operation) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+  }
+
+  thread.last_operation = operation;
+
+  //
+  // Configure operation
+  //
+
+  GemmConfiguration configuration{
+    {M, N, K},
+    lda,
+    ldb,
+    ldc,
+    ldd,
+    1
+  };
+
+  char host_workspace_buffer[kHostWorkspaceSize];
+
+  if (!cached) {
+
+    // Query host work space size
+    uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+    if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    // Query device workspace size
+    uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
+
+    if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    if (use_cache) {
+      GemmDispatchCache::Entry new_entry;
+      new_entry.operation = operation;
+      new_entry.host_workspace.resize(kHostWorkspaceSize);
+      new_entry.device_workspace_size = device_workspace_size_needed;
+
+      entry = thread.dispatch_cache->insert(cache_key, std::move(new_entry));
+    }
+  }
+
+  void *host_workspace = entry ? static_cast<void *>(entry->host_workspace.data()) : host_workspace_buffer;
+
+  // Initialize host and device workspaces. Cached operations needing no device workspace keep the
+  // host workspace initialized by the call that cached them.
+  if (!cached || entry->device_workspace_size) {
+
+    Status status = operation->initialize(
+      &configuration,
+      host_workspace,
+      workspace,
+      stream);
+
+    if (status != cutlass::Status::kSuccess) {
+      if (entry) {
+        thread.dispatch_cache->erase(cache_key);
+      }
+      return status;
+    }
+  }
+
+  // Run the operator
+  GemmArguments arguments{
+    ptr_A,
+    ptr_B,
+    ptr_C,
+    ptr_D,
+    alpha,
+    beta,
+    scalar_pointer_mode_
+  };
+
+  return operation->run(&arguments, host_workspace, workspace, stream);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a GEMM computation: D <= alpha * A*B + beta * C.
+//
+// Supports batched-strided, batched array or split-K serial or split-K parallel.
+//
+Status Handle::gemm_universal(
+
+  GemmUniversalMode mode,                   /// indicates the mode in which the kUniversal GEMM is launched
+
+  int M,                                    /// GEMM M dimension
+  int N,                                    /// GEMM N dimension
+  int K,                                    /// GEMM K dimension
+  
+  int cluster_m,                            /// cluster shape M dimension
+  int cluster_n,                            /// cluster shape N dimension
+  int cluster_k,                            /// cluster shape K dimension
+  int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+  int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+  int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+  
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+  void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+  int64_t lda,                              /// Leading dimension of A matrix
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+  void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+  int64_t ldb,                              /// Leading dimension of B matrix
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C matrix
+  LayoutTypeID layout_C,                    /// Layout of D matrix
+  void const * ptr_C,                       /// Pointer to C matrix
+  int64_t ldc,                              /// Leading dimension of C matrix
+
+  NumericTypeID element_D,                  /// Data type of D matrix
+  LayoutTypeID layout_D,                    /// Layout of D matrix
+  void * ptr_D,                             /// Pointer to D matrix
+  int64_t ldd,                              /// Leading dimension of D matrix
+
+  int batch_count,                          /// Batch count or number of split-K slices
+
+  int64_t batch_stride_A,                   /// Batch stride of A operand
+  int64_t batch_stride_B,                   /// Batch stride of B operand
+  int64_t batch_stride_C,                   /// Batch stride of C operand
+  int64_t batch_stride_D                    /// Batch stride of D operand
+) {
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kUniversal,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,
+    layout_C,
+    element_D,
+    layout_D
+  );
+
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  void const *ptr_A_check = ptr_A;
+  void const *ptr_B_check = ptr_B;
+  void const *ptr_C_check = ptr_C;
+  void *      ptr_D_check = ptr_D;
+
+  // Ignore alignment of pointers to pointers. We can't check this from the host,
+  // as each batch index has its own pointer in device memory.
+  if (mode == GemmUniversalMode::kArray) {
+    ptr_A_check = nullptr;
+    ptr_B_check = nullptr;
+    ptr_C_check = nullptr;
+    ptr_D_check = nullptr;
+  }
+
+  int alignment = gemm_problem_alignment(
+    M, N, K,
+    element_A, ptr_A_check, lda, 0,
+    element_B, ptr_B_check, ldb, 0,
+    element_C, ptr_C_check, ldc, 0,
+    ptr_D_check, ldd, 0, kMaximumAlignmentSize
+  );
+
+  // Reuse the operation selected and initialized by an identical previous call
+  GemmDispatchCache::Key cache_key{
+    key, mode, alignment, M, N, K, batch_count,
+    cluster_m, cluster_n, cluster_k,
+    cluster_m_fallback, cluster_n_fallback, cluster_k_fallback,
+    lda, ldb, ldc, ldd
+  };
+
+  bool const use_cache = thread.dispatch_cache && thread.dispatch_cache->capacity();
+
+  GemmDispatchCache::Entry *entry = use_cache ? thread.dispatch_cache->find(cache_key) : nullptr;
+  bool const cached = (entry != nullptr);
+
+  Operation const *operation = nullptr;
+
+  // Prefer the kernel that profiled fastest for this bucket of problem sizes, along with the
+  // runtime arguments it was profiled with
+  KernelSelection const *selection = nullptr;
+
+  if (cached) {
+    operation = entry->operation;
+    selection = entry->has_selection ? &entry->selection : nullptr;
+  }
+  else {
+
+    auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+
+    if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    if (operators_it->second.empty()) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    //
+    // Find the best kernel in descending order of preference.
+    //
+
+    GemmPreferenceKey preference_key(compute_capability(), alignment);
+
+    if (kernel_selection_database_) {
+      selection = kernel_selection_database_->find(
+        key, M, N, K, (mode == GemmUniversalMode::kGemm ? 1 : batch_count));
+      if (selection) {
+        operation = find_gemm_operation_by_name(operators_it, preference_key, selection->operation_name);
+      }
+    }
+
+    if (!operation) {
+      selection = nullptr;
+      operation = find_gemm_operation_for_problem(
+        operators_it,
+        preference_key,
+        gemm_selection_policy_,
+        M, N, K,
+        (mode == GemmUniversalMode::kGemm ? 1 : batch_count),
+        {cluster_m, cluster_n, cluster_k},
+        device_.multiProcessorCount);
+    }
+
+    if (!operation) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+  }
+
+  thread.last_operation = operation;
+
+  if (selection) {
+    cluster_m = selection->cluster_shape.m();
+    cluster_n = selection->cluster_shape.n();
+    cluster_k = selection->cluster_shape.k();
+    cluster_m_fallback = selection->cluster_shape_fallback.m();
+    cluster_n_fallback = selection->cluster_shape_fallback.n();
+    cluster_k_fallback = selection->cluster_shape_fallback.k();
+
+    // Serial split-K slices are passed through the batch count in kGemm mode
+    if (mode == GemmUniversalMode::kGemm) {
+      batch_count = selection->split_k_slices;
+    }
+  }
+
+  //
+  // Configure operation
+  //
+
+  GemmUniversalConfiguration configuration{
+    mode,
+    {M, N, K},
+    {cluster_m, cluster_n, cluster_k}, 
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
+    batch_count,
+    lda,
+    ldb,
+    ldc,
+    ldd
+  };
+
+  GemmUniversalArguments arguments{
+    {M, N, K},
+    {cluster_m, cluster_n, cluster_k}, 
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
+    batch_count,
+    ptr_A,
+    ptr_B,
+    ptr_C,
+    ptr_D,
+    alpha,
+    beta,
+    scalar_pointer_mode_,
+    lda,
+    ldb,
+    ldc,
+    ldd,
+    batch_stride_A,
+    batch_stride_B,
+    batch_stride_C,
+    batch_stride_D
+  };
+
+  if (selection) {
+    arguments.raster_order = selection->raster_order;
+    arguments.swizzle_size = selection->swizzle_size;
+    arguments.split_k_slices = selection->split_k_slices;
+  }
+
+  arguments.reference_sample_tiles = reference_sample_tiles_;
+
+  char host_workspace_buffer[kHostWorkspaceSize];
+
+  if (!cached) {
+
+    // Query host work space size
+    uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+    if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    // Query device workspace size
+    uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
+
+    if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+
+    if (use_cache) {
+      GemmDispatchCache::Entry new_entry;
+      new_entry.operation = operation;
+      new_entry.has_selection = (selection != nullptr);
+      if (selection) {
+        new_entry.selection = *selection;
+      }
+      new_entry.host_workspace.resize(kHostWorkspaceSize);
+      new_entry.device_workspace_size = device_workspace_size_needed;
+
+      entry = thread.dispatch_cache->insert(cache_key, std::move(new_entry));
+    }
+  }
+
+  void *host_workspace = entry ? static_cast<void *>(entry->host_workspace.data()) : host_workspace_buffer;
+
+  // Initialize host and device workspaces. Cached operations needing no device workspace keep the
+  // host workspace initialized by the call that cached them.
+  if (!cached || entry->device_workspace_size) {
+
+    Status status = operation->initialize(
+      &configuration,
+      host_workspace,
+      workspace,
+      stream);
+
+    if (status != cutlass::Status::kSuccess) {
+      if (entry) {
+        thread.dispatch_cache->erase(cache_key);
+      }
+      return status;
+    }
+  }
+
+  // Run the operator
+
+  return operation->run(&arguments, host_workspace, workspace, stream);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes a GEMM computation split along K in a single launch
+Status Handle::gemm_split_k(
+
+  int M,                                    /// GEMM M dimension
+  int N,                                    /// GEMM N dimension
+  int K,                                    /// GEMM K dimension
+
+  int split_k_slices,                       /// Number of partitions of K dimension, or zero
+
+  int cluster_m,                            /// cluster shape M dimension
+  int cluster_n,                            /// cluster shape N dimension
+  int cluster_k,                            /// cluster shape K dimension
+  int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+  int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+  int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
+  void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+  int64_t lda,                              /// Leading dimension of A matrix
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
+  void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+  int64_t ldb,                              /// Leading dimension of B matrix
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C matrix
+  LayoutTypeID layout_C,                    /// Layout of C matrix
+  void const * ptr_C,                       /// Pointer to C matrix
+  int64_t ldc,                              /// Leading dimension of C matrix
+
+  NumericTypeID element_D,                  /// Data type of D matrix
+  LayoutTypeID layout_D,                    /// Layout of D matrix
+  void * ptr_D,                             /// Pointer to D matrix
+  int64_t ldd                               /// Leading dimension of D matrix
+) {
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kUniversal,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,
+    layout_C,
+    element_D,
+    layout_D
+  );
+
+  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+
+  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  if (operators_it->second.empty()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  int alignment = gemm_problem_alignment(
+    M, N, K,
+    element_A, ptr_A, lda, 0,
+    element_B, ptr_B, ldb, 0,
+    element_C, ptr_C, ldc, 0,
+    ptr_D, ldd, 0, kMaximumAlignmentSize
+  );
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  GemmPreferenceKey preference_key(compute_capability(), alignment);
+
+  Operation const *operation = find_split_k_gemm_operation(
+    operators_it,
+    preference_key,
+    M, N, K,
+    {cluster_m, cluster_n, cluster_k},
+    device_.multiProcessorCount);
+
+  if (!operation) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  thread.last_operation = operation;
+
+  GemmDescription const &desc = static_cast<GemmDescription const &>(operation->description());
+
+  if (split_k_slices <= 0) {
+    split_k_slices = split_k_slices_for_problem(desc, M, N, K, device_.multiProcessorCount);
+  }
+
+  // CUTLASS 2.x kernels take serial split-K slices through the batch count of kGemm mode, while
+  // stream-K kernels take them as a scheduler argument
+  bool const is_3x = (std::string(desc.name).find("cutlass3x_") == 0);
+  int const batch_count = is_3x ? 1 : split_k_slices;
+
+  //
+  // Configure operation
+  //
+
+  GemmUniversalConfiguration configuration{
+    GemmUniversalMode::kGemm,
+    {M, N, K},
+    {cluster_m, cluster_n, cluster_k},
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback},
+    batch_count,
+    lda,
+    ldb,
+    ldc,
+    ldd
+  };
+
+  GemmUniversalArguments arguments{
+    {M, N, K},
+    {cluster_m, cluster_n, cluster_k},
+    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback},
+    batch_count,
+    ptr_A,
+    ptr_B,
+    ptr_C,
+    ptr_D,
+    alpha,
+    beta,
+    scalar_pointer_mode_,
+    lda,
+    ldb,
+    ldc,
+    ldd,
+    0,
+    0,
+    0,
+    0
+  };
+
+  arguments.split_k_slices = split_k_slices;
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  // Query device workspace size, which holds the semaphores or partial sums of the slices
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
+
+  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  Status status = operation->can_implement(&configuration, &arguments);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Initialize host and device workspaces
+  status = operation->initialize(
+    &configuration,
+    host_workspace,
+    workspace,
+    stream);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Run the operator
+
+  return operation->run(&arguments, host_workspace, workspace, stream);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Planar complex GEMM
+Status Handle::gemm_planar_complex(
+
+  int M,                                    /// GEMM M dimension
+  int N,                                    /// GEMM N dimension
+  int K,                                    /// GEMM K dimension
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix
+
+  void const * ptr_A_real,                  /// Pointer to real part of A matrix
+  void const * ptr_A_imag,                  /// Pointer to imaginary part of A matrix
+  int64_t lda_real,                         /// Leading dimension of real part of A matrix
+  int64_t lda_imag,                         /// Leading dimension of imaginary part of A matrix
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix
+
+  void const * ptr_B_real,                  /// Pointer to real part of B matrix
+  void const * ptr_B_imag,                  /// Pointer to imaginary part of B matrix
+  int64_t ldb_real,                             /// Leading dimension of real part of B matrix
+  int64_t ldb_imag,                             /// Leading dimension of imaginary part of B matrix
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C and D matrix
+
+  void const * ptr_C_real,                  /// Pointer to real part of C matrix
+  void const * ptr_C_imag,                  /// Pointer to imaginary part of C matrix
+  int64_t ldc_real,                             /// Leading dimension of real part of C matrix
+  int64_t ldc_imag,                             /// Leading dimension of imaginary part of C matrix
+
+  void * ptr_D_real,                        /// Pointer to real part of D matrix
+  void * ptr_D_imag,                        /// Pointer to imaginary part of D matrix
+  int64_t ldd_real,                             /// Leading dimension of real part of D matrix
+  int64_t ldd_imag,                             /// Leading dimension of imaginary part of D matrix
+
+  int batch_count,                          /// Number of batched GEMMs to execute
+
+  int64_t batch_stride_A_real,
+  int64_t batch_stride_A_imag,
+
+  int64_t batch_stride_B_real,
+  int64_t batch_stride_B_imag,
+
+  int64_t batch_stride_C_real,
+  int64_t batch_stride_C_imag,
+
+  int64_t batch_stride_D_real,
+  int64_t batch_stride_D_imag
+) {
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kPlanarComplex,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,  // C/D are same type
+    LayoutTypeID::kColumnMajor,
+    element_C,
+    LayoutTypeID::kColumnMajor
+  );
+
+  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+
+  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  if (operators_it->second.empty()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  int alignment = std::max(
+    gemm_problem_alignment(
+      M, N, K,
+      element_A, ptr_A_real, lda_real, batch_stride_A_real,
+      element_B, ptr_B_real, ldb_real, batch_stride_B_real,
+      element_C, ptr_C_real, ldc_real, batch_stride_C_real,
+      ptr_D_real, ldd_real, batch_stride_D_real, kMaximumAlignmentSize
+    ),
+    gemm_problem_alignment(
+      M, N, K,
+      element_A, ptr_A_imag, lda_imag, batch_stride_A_imag,
+      element_B, ptr_B_imag, ldb_imag, batch_stride_B_imag,
+      element_C, ptr_C_imag, ldc_imag, batch_stride_C_imag,
+      ptr_D_imag, ldd_imag, batch_stride_D_imag, kMaximumAlignmentSize
+    )
+  );
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  GemmPreferenceKey preference_key(compute_capability(), alignment);
+
+  Operation const *operation = find_gemm_operation(operators_it, preference_key);
+
+  if (!operation) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  thread.last_operation = operation;
+
+  //
+  // Configure operation
+  //
+
+  GemmPlanarComplexConfiguration configuration{
+    GemmUniversalMode::kBatched,
+    {M, N, K},
+    batch_count,
+    lda_real,
+    lda_imag,
+    ldb_real,
+    ldb_imag,
+    ldc_real,
+    ldc_imag,
+    ldd_real,
+    ldd_imag
+  };
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  // Query device workspace size
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
+
+  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Initialize host and device workspaces
+  Status status = operation->initialize(
+    &configuration,
+    host_workspace,
+    workspace,
+    stream);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Run the operator
+  GemmPlanarComplexArguments arguments{
+    ptr_A_real,
+    ptr_A_imag,
+    ptr_B_real,
+    ptr_B_imag,
+    ptr_C_real,
+    ptr_C_imag,
+    ptr_D_real,
+    ptr_D_imag,
+    alpha,
+    beta,
+    scalar_pointer_mode_,
+    batch_stride_A_real,
+    batch_stride_A_imag,
+    batch_stride_B_real,
+    batch_stride_B_imag,
+    batch_stride_C_real,
+    batch_stride_C_imag,
+    batch_stride_D_real,
+    batch_stride_D_imag
+  };
+
+  return operation->run(&arguments, host_workspace, workspace, stream);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Planar complex batched GEMM loading pointers from arrays in global memory
+Status Handle::gemm_planar_complex_array(
+
+  int expected_M,                           /// Expected GEMM M dimension (used for sizing CUDA grid)
+  int expected_N,                           /// Expected GEMM N dimension (used for sizing CUDA grid)
+  int expected_K,                           /// Expected GEMM K dimension
+  int batch_count,                          /// Number of independent GEMM computations to execute
+
+  int const *M,                             /// Array containing the GEMM M dimension for each batch index
+  int const *N,                             /// Array containing the GEMM N dimension for each batch index
+  int const *K,                             /// Array containing the GEMM K dimension for each batch index
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix
+
+  void const * const * ptr_A_real,          /// Pointer to array containing pointers to real part of A matrices
+  void const * const * ptr_A_imag,          /// Pointer to array containing pointers to imaginary part of A matrices
+
+  int64_t lda_real,                             /// Leading dimension of real part of A matrix
+  int64_t lda_imag,                             /// Leading dimension of imaginary part of A matrix
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix
+
+  void const * const * ptr_B_real,          /// Pointer to array containing pointers to real part of B matrices
+  void const * const * ptr_B_imag,          /// Pointer to array containing pointers to imaginary part of B matrices
+
+  int64_t ldb_real,                             /// Leading dimension of real part of B matrix
+  int64_t ldb_imag,                             /// Leading dimension of imaginary part of B matrix
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C and D matrix
+
+  void const * const * ptr_C_real,          /// Pointer to array containing pointers to real part of C matrices
+  void const * const * ptr_C_imag,          /// Pointer to array containing pointers to imaginary part of C matrices
+
+  int64_t ldc_real,                             /// Leading dimension of real part of C matrix
+  int64_t ldc_imag,                             /// Leading dimension of imaginary part of C matrix
+
+  void * const * ptr_D_real,                /// Pointer to array containing pointers to real part of D matrices
+  void * const * ptr_D_imag,                /// Pointer to array containing pointers to imaginary part of D matrices
+
+  int64_t ldd_real,                             /// Leading dimension of real part of D matrix
+  int64_t ldd_imag                              /// Leading dimension of imaginary part of D matrix
+) {
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kPlanarComplexArray,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,  // C/D are same type
+    LayoutTypeID::kColumnMajor,
+    element_C,
+    LayoutTypeID::kColumnMajor
+  );
+
+  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+
+  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  if (operators_it->second.empty()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  //
+  // Compute the largest alignment restriction the kernel can satisfy.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  int alignment = std::max(
+    gemm_problem_alignment(
+      expected_M, expected_N, expected_K,
+      element_A, nullptr, lda_real, 0,
+      element_B, nullptr, ldb_real, 0,
+      element_C, nullptr, ldc_real, 0,
+      nullptr, ldd_real, 0, kMaximumAlignmentSize
+    ),
+    gemm_problem_alignment(
+      expected_M, expected_N, expected_K,
+      element_A, nullptr, lda_imag, 0,
+      element_B, nullptr, ldb_imag, 0,
+      element_C, nullptr, ldc_imag, 0,
+      nullptr, ldd_imag, 0, kMaximumAlignmentSize
+    )
+  );
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  GemmPreferenceKey preference_key(compute_capability(), alignment);
 
   Operation const *operation = find_gemm_operation(operators_it, preference_key);
 
@@ -444,20 +2172,262 @@ Status Handle::gemm(
     return cutlass::Status::kErrorNotSupported;
   }
 
-  last_operation_ = operation;
+  thread.last_operation = operation;
+
+  //
+  // Configure operation
+  //
+
+  GemmPlanarComplexArrayConfiguration configuration{
+    {expected_M, expected_N, expected_K},
+    batch_count,
+    lda_real,
+    lda_imag,
+    ldb_real,
+    ldb_imag,
+    ldc_real,
+    ldc_imag,
+    ldd_real,
+    ldd_imag
+  };
+
+  // Query host work space size
+  uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
+
+  if (uint64_t(kHostWorkspaceSize) < host_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  char host_workspace[kHostWorkspaceSize];
+
+  // Query device workspace size
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
+
+  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  // Initialize host and device workspaces
+  Status status = operation->initialize(
+    &configuration,
+    host_workspace,
+    workspace,
+    stream);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  // Run the operator
+  GemmPlanarComplexArrayArguments arguments{
+    M, N, K,
+    ptr_A_real,
+    ptr_A_imag,
+    ptr_B_real,
+    ptr_B_imag,
+    ptr_C_real,
+    ptr_C_imag,
+    ptr_D_real,
+    ptr_D_imag,
+    alpha,
+    beta,
+    scalar_pointer_mode_
+  };
+
+  return operation->run(&arguments, host_workspace, workspace, stream);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Grouped GEMM: D[i] <= alpha * A[i]*B[i] + beta * C[i] for each of problem_count problems.
+Status Handle::gemm_grouped(
+
+  int problem_count,                        /// Number of GEMMs in the group
+
+  cute::Shape<int, int, int> const *problem_sizes,       /// Device array of (M, N, K) per problem, or nullptr
+  cute::Shape<int, int, int> const *problem_sizes_host,  /// Host array of (M, N, K) per problem, or nullptr
+
+  NumericTypeID element_compute,            /// Data type of internal accumulation
+
+  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+
+  void const *alpha,                        /// Pointer to alpha scalar
+
+  NumericTypeID element_A,                  /// Data type of A matrix elements
+  LayoutTypeID layout_A,                    /// Layout of A matrix
+  ComplexTransform transform_A,             /// Complex transformation applied to A matrix
+  void const * const * ptr_A,               /// Device array of pointers to A matrices
+  int64_t const *lda,                       /// Host array of leading dimensions of A matrices
+
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  ComplexTransform transform_B,             /// Complex transformation applied to B matrix
+  void const * const * ptr_B,               /// Device array of pointers to B matrices
+  int64_t const *ldb,                       /// Host array of leading dimensions of B matrices
+
+  void const * beta,                        /// Pointer to beta scalar
+
+  NumericTypeID element_C,                  /// Data type of C matrices
+  LayoutTypeID layout_C,                    /// Layout of C matrices
+  void const * const * ptr_C,               /// Device array of pointers to C matrices
+  int64_t const *ldc,                       /// Host array of leading dimensions of C and D matrices
+
+  NumericTypeID element_D,                  /// Data type of D matrices
+  LayoutTypeID layout_D,                    /// Layout of D matrices
+  void * const * ptr_D                      /// Device array of pointers to D matrices
+) {
+
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
+  if (problem_count <= 0 || !lda || !ldb || !ldc) {
+    return cutlass::Status::kErrorInvalidProblem;
+  }
+
+  if (!problem_sizes && !problem_sizes_host) {
+    return cutlass::Status::kErrorInvalidProblem;
+  }
+
+  //
+  // Find the operation
+  //
+
+  GemmFunctionalKey key(
+    provider_,
+    GemmKind::kGrouped,
+    element_compute,
+    element_scalar,
+    element_A,
+    layout_A,
+    transform_A,
+    element_B,
+    layout_B,
+    transform_B,
+    element_C,
+    layout_C,
+    element_D,
+    layout_D
+  );
+
+  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+
+  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  if (operators_it->second.empty()) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  //
+  // Compute the largest alignment restriction every problem in the group can satisfy. Pointers
+  // reside in device memory and can't be checked from the host. Problem sizes known only on the
+  // device can't be checked either, so they are assumed to satisfy nothing beyond the lowest
+  // alignment, which restricts the search to kernels without a wider alignment requirement.
+  //
+
+  // Maximum alignment expectation among all kernels (in units of bytes)
+  int const kMaximumAlignmentSize = 16;
+
+  int alignment = std::numeric_limits<int>::max();
+
+  for (int idx = 0; idx < problem_count; ++idx) {
+    int M = problem_sizes_host ? cute::get<0>(problem_sizes_host[idx]) : 1;
+    int N = problem_sizes_host ? cute::get<1>(problem_sizes_host[idx]) : 1;
+    int K = problem_sizes_host ? cute::get<2>(problem_sizes_host[idx]) : 1;
+
+    alignment = std::min(alignment, gemm_problem_alignment(
+      M, N, K,
+      element_A, nullptr, lda[idx], 0,
+      element_B, nullptr, ldb[idx], 0,
+      element_C, nullptr, ldc[idx], 0,
+      nullptr, ldc[idx], 0, kMaximumAlignmentSize
+    ));
+  }
+
+  //
+  // Find the best kernel in descending order of preference.
+  //
+
+  GemmPreferenceKey preference_key(compute_capability(), alignment);
+
+  Operation const *operation = find_grouped_gemm_operation(operators_it, preference_key);
+
+  if (!operation) {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  thread.last_operation = operation;
+
+  // Other threads launching the same operation would replace its per-group device buffers
+  std::lock_guard<std::mutex> operation_lock(grouped_gemm_operation_mutex(operation));
+
+  //
+  // Stage host problem sizes at the front of the device workspace if they are not on the device.
+  //
+
+  size_t const kWorkspaceAlignment = 128;
+
+  size_t staged_bytes = 0;
+  if (!problem_sizes) {
+    staged_bytes = sizeof(cute::Shape<int, int, int>) * problem_count;
+    staged_bytes = (staged_bytes + kWorkspaceAlignment - 1) / kWorkspaceAlignment * kWorkspaceAlignment;
+
+    if (workspace_size_ < staged_bytes) {
+      return cutlass::Status::kErrorNotSupported;
+    }
+  }
 
   //
   // Configure operation
   //
 
-  GemmConfiguration configuration{
-    {M, N, K},
-    lda,
-    ldb,
-    ldc,
-    ldd,
-    1
-  };
+  GemmGroupedConfiguration configuration;
+  configuration.problem_count = problem_count;
+  configuration.lda = const_cast<int64_t *>(lda);
+  configuration.ldb = const_cast<int64_t *>(ldb);
+  configuration.ldc = const_cast<int64_t *>(ldc);
+  configuration.problem_sizes_3x_host = const_cast<cute::Shape<int, int, int> *>(problem_sizes_host);
+
+  GemmGroupedArguments arguments;
+  arguments.problem_count = problem_count;
+  arguments.problem_sizes_3x = problem_sizes ?
+    const_cast<cute::Shape<int, int, int> *>(problem_sizes) :
+    static_cast<cute::Shape<int, int, int> *>(workspace);
+  arguments.problem_sizes_3x_host = const_cast<cute::Shape<int, int, int> *>(problem_sizes_host);
+  arguments.ptr_A = const_cast<void **>(ptr_A);
+  arguments.ptr_B = const_cast<void **>(ptr_B);
+  arguments.ptr_C = const_cast<void **>(ptr_C);
+  arguments.ptr_D = const_cast<void **>(ptr_D);
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+  arguments.sm_count = device_.multiProcessorCount;
+
+  GroupedGemmDescription const &grouped_desc =
+    static_cast<GroupedGemmDescription const &>(operation->description());
+
+  // Kernels with a dynamic cluster shape default to the cluster the profiler defaults to
+  gemm::GemmCoord cluster_shape = grouped_desc.gemm.tile_description.cluster_shape;
+
+  if (!cluster_shape.m() || !cluster_shape.n() || !cluster_shape.k()) {
+    int cluster_m = (std::string(grouped_desc.gemm.name).find("_2sm") != std::string::npos) ? 2 : 1;
+    arguments.cluster_shape = {cluster_m, 1, 1};
+    arguments.cluster_shape_fallback = {cluster_m, 1, 1};
+  }
+  else {
+    arguments.cluster_shape = cluster_shape;
+    arguments.cluster_shape_fallback = cluster_shape;
+  }
+
+  Status status = operation->initialize_with_arguments(&arguments);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
 
   // Query host work space size
   uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
@@ -469,58 +2439,64 @@ Status Handle::gemm(
   char host_workspace[kHostWorkspaceSize];
 
   // Query device workspace size
-  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
 
-  if (uint64_t(workspace_size_) < device_workspace_size_needed) {
+  if (uint64_t(workspace_size_) < staged_bytes + device_workspace_size_needed) {
     return cutlass::Status::kErrorNotSupported;
   }
 
+  void *device_workspace = static_cast<char *>(workspace) + staged_bytes;
+
+  if (!problem_sizes) {
+    cudaError_t error = cudaMemcpyAsync(
+      workspace,
+      problem_sizes_host,
+      sizeof(cute::Shape<int, int, int>) * problem_count,
+      cudaMemcpyHostToDevice,
+      stream);
+
+    if (error != cudaSuccess) {
+      return cutlass::Status::kErrorInternal;
+    }
+  }
+
   // Initialize host and device workspaces
-  Status status = operation->initialize(
+  status = operation->initialize(
     &configuration,
     host_workspace,
-    workspace_,
-    stream_);
+    device_workspace,
+    stream);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
+  status = operation->can_implement(&configuration, &arguments);
 
   if (status != cutlass::Status::kSuccess) {
     return status;
   }
 
   // Run the operator
-  GemmArguments arguments{
-    ptr_A,
-    ptr_B,
-    ptr_C,
-    ptr_D,
-    alpha,
-    beta,
-    scalar_pointer_mode_
-  };
 
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+  return operation->run(&arguments, host_workspace, device_workspace, stream);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Executes a GEMM computation: D <= alpha * A*B + beta * C.
-//
-// Supports batched-strided, batched array or split-K serial or split-K parallel.
-//
-Status Handle::gemm_universal(
-
-  GemmUniversalMode mode,                   /// indicates the mode in which the kUniversal GEMM is launched
+/// Block-scaled GEMM: D <= alpha * (SFA * A)*(SFB * B) + beta * C
+Status Handle::gemm_block_scaled(
 
   int M,                                    /// GEMM M dimension
   int N,                                    /// GEMM N dimension
   int K,                                    /// GEMM K dimension
-  
+
   int cluster_m,                            /// cluster shape M dimension
   int cluster_n,                            /// cluster shape N dimension
   int cluster_k,                            /// cluster shape K dimension
   int cluster_m_fallback,                   /// Fallback cluster shape M dimension
   int cluster_n_fallback,                   /// Fallback cluster shape N dimension
   int cluster_k_fallback,                   /// Fallback cluster shape K dimension
-  
 
   NumericTypeID element_compute,            /// Data type of internal accumulation
 
@@ -530,20 +2506,26 @@ Status Handle::gemm_universal(
 
   NumericTypeID element_A,                  /// Data type of A matrix elements
   LayoutTypeID layout_A,                    /// Layout of A matrix
-  ComplexTransform transform_A,             /// Complex transformation applied to A matrix - ignored for real-valued matrices
   void const * ptr_A,                       /// Pointer to A matrix in Global Memory
   int64_t lda,                              /// Leading dimension of A matrix
 
+  NumericTypeID element_SFA,                /// Data type of A scale factors
+  void const * ptr_SFA,                     /// Pointer to A scale factors in Global Memory
+
   NumericTypeID element_B,                  /// Data type of B matrix elements
   LayoutTypeID layout_B,                    /// Layout of B matrix
-  ComplexTransform transform_B,             /// Complex transformation applied to B matrix - ignored for real-valued matrices
   void const * ptr_B,                       /// Pointer to B matrix in Global Memory
   int64_t ldb,                              /// Leading dimension of B matrix
 
+  NumericTypeID element_SFB,                /// Data type of B scale factors
+  void const * ptr_SFB,                     /// Pointer to B scale factors in Global Memory
+
+  int sf_vec_size,                          /// Number of elements along K sharing a scale factor
+
   void const * beta,                        /// Pointer to beta scalar
 
   NumericTypeID element_C,                  /// Data type of C matrix
-  LayoutTypeID layout_C,                    /// Layout of D matrix
+  LayoutTypeID layout_C,                    /// Layout of C matrix
   void const * ptr_C,                       /// Pointer to C matrix
   int64_t ldc,                              /// Leading dimension of C matrix
 
@@ -552,7 +2534,13 @@ Status Handle::gemm_universal(
   void * ptr_D,                             /// Pointer to D matrix
   int64_t ldd,                              /// Leading dimension of D matrix
 
-  int batch_count,                          /// Batch count or number of split-K slices
+  NumericTypeID element_SFD,                /// Data type of D scale factors, or kVoid
+  LayoutTypeID layout_SFD,                  /// Layout of D scale factors
+  void * ptr_SFD,                           /// Pointer to D scale factors, or nullptr
+  int epilogue_sf_vec_size,                 /// Number of elements of D sharing a scale factor
+  void const * norm_constant,               /// Pointer to the normalization constant of SFD, or nullptr
+
+  int batch_count,                          /// Batch count
 
   int64_t batch_stride_A,                   /// Batch stride of A operand
   int64_t batch_stride_B,                   /// Batch stride of B operand
@@ -560,30 +2548,41 @@ Status Handle::gemm_universal(
   int64_t batch_stride_D                    /// Batch stride of D operand
 ) {
 
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
   //
   // Find the operation
   //
 
-  GemmFunctionalKey key(
+  BlockScaledGemmFunctionalKey key(
     provider_,
     GemmKind::kUniversal,
+    OperationKind::kBlockScaledGemm,
     element_compute,
     element_scalar,
     element_A,
     layout_A,
-    transform_A,
+    element_SFA,
     element_B,
     layout_B,
-    transform_B,
+    element_SFB,
     element_C,
     layout_C,
     element_D,
-    layout_D
+    layout_D,
+    element_SFD,
+    layout_SFD,
+    sf_vec_size,
+    epilogue_sf_vec_size
   );
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+  auto operators_it = Singleton::get().operation_table.block_scaled_gemm_operations.find(key);
 
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+  if (operators_it == Singleton::get().operation_table.block_scaled_gemm_operations.end()) {
     return cutlass::Status::kErrorNotSupported;
   }
 
@@ -598,26 +2597,12 @@ Status Handle::gemm_universal(
   // Maximum alignment expectation among all kernels (in units of bytes)
   int const kMaximumAlignmentSize = 16;
 
-  void const *ptr_A_check = ptr_A;
-  void const *ptr_B_check = ptr_B;
-  void const *ptr_C_check = ptr_C;
-  void *      ptr_D_check = ptr_D;
-
-  // Ignore alignment of pointers to pointers. We can't check this from the host,
-  // as each batch index has its own pointer in device memory.
-  if (mode == GemmUniversalMode::kArray) {
-    ptr_A_check = nullptr;
-    ptr_B_check = nullptr;
-    ptr_C_check = nullptr;
-    ptr_D_check = nullptr;
-  }
-
   int alignment = gemm_problem_alignment(
     M, N, K,
-    element_A, ptr_A_check, lda, 0,
-    element_B, ptr_B_check, ldb, 0,
-    element_C, ptr_C_check, ldc, 0,
-    ptr_D_check, ldd, 0, kMaximumAlignmentSize
+    element_A, ptr_A, lda, batch_stride_A,
+    element_B, ptr_B, ldb, batch_stride_B,
+    element_C, ptr_C, ldc, batch_stride_C,
+    ptr_D, ldd, batch_stride_D, kMaximumAlignmentSize
   );
 
   //
@@ -626,23 +2611,36 @@ Status Handle::gemm_universal(
 
   GemmPreferenceKey preference_key(compute_capability(), alignment);
 
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
+  Operation const *operation = find_scaled_gemm_operation<BlockScaledGemmDescription>(
+    operators_it,
+    preference_key,
+    gemm_selection_policy_,
+    M, N, K,
+    batch_count,
+    {cluster_m, cluster_n, cluster_k},
+    device_.multiProcessorCount);
 
   if (!operation) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  last_operation_ = operation;
+  thread.last_operation = operation;
+
+  gemm::GemmCoord cluster_shape = scaled_gemm_cluster_shape(
+    operation->description(), {cluster_m, cluster_n, cluster_k});
+
+  gemm::GemmCoord cluster_shape_fallback = scaled_gemm_cluster_shape(
+    operation->description(), {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback});
 
   //
   // Configure operation
   //
 
   GemmUniversalConfiguration configuration{
-    mode,
+    (batch_count > 1 ? GemmUniversalMode::kBatched : GemmUniversalMode::kGemm),
     {M, N, K},
-    {cluster_m, cluster_n, cluster_k}, 
-    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
+    cluster_shape,
+    cluster_shape_fallback,
     batch_count,
     lda,
     ldb,
@@ -650,6 +2648,34 @@ Status Handle::gemm_universal(
     ldd
   };
 
+  BlockScaledGemmArguments arguments;
+
+  arguments.problem_size = {M, N, K};
+  arguments.cluster_shape = cluster_shape;
+  arguments.cluster_shape_fallback = cluster_shape_fallback;
+  arguments.batch_count = batch_count;
+  arguments.A = ptr_A;
+  arguments.B = ptr_B;
+  arguments.SFA = ptr_SFA;
+  arguments.SFB = ptr_SFB;
+  arguments.C = ptr_C;
+  arguments.D = ptr_D;
+  arguments.SFD = ptr_SFD;
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+  arguments.lda = lda;
+  arguments.ldb = ldb;
+  arguments.ldc = ldc;
+  arguments.ldd = ldd;
+  arguments.batch_stride_A = batch_stride_A;
+  arguments.batch_stride_B = batch_stride_B;
+  arguments.batch_stride_C = batch_stride_C;
+  arguments.batch_stride_D = batch_stride_D;
+  arguments.norm_constant = norm_constant;
+  arguments.sm_count = device_.multiProcessorCount;
+  arguments.device_index = device_idx_;
+
   // Query host work space size
   uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
 
@@ -659,28 +2685,6 @@ Status Handle::gemm_universal(
 
   char host_workspace[kHostWorkspaceSize];
 
-  GemmUniversalArguments arguments{
-    {M, N, K},
-    {cluster_m, cluster_n, cluster_k}, 
-    {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback}, 
-    batch_count,
-    ptr_A,
-    ptr_B,
-    ptr_C,
-    ptr_D,
-    alpha,
-    beta,
-    scalar_pointer_mode_,
-    lda,
-    ldb,
-    ldc,
-    ldd,
-    batch_stride_A,
-    batch_stride_B,
-    batch_stride_C,
-    batch_stride_D
-  };
-
   // Query device workspace size
   uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
 
@@ -688,12 +2692,18 @@ Status Handle::gemm_universal(
     return cutlass::Status::kErrorNotSupported;
   }
 
+  Status status = operation->can_implement(&configuration, &arguments);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
   // Initialize host and device workspaces
-  Status status = operation->initialize(
+  status = operation->initialize(
     &configuration,
     host_workspace,
-    workspace_,
-    stream_);
+    workspace,
+    stream);
 
   if (status != cutlass::Status::kSuccess) {
     return status;
@@ -701,18 +2711,25 @@ Status Handle::gemm_universal(
 
   // Run the operator
 
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+  return operation->run(&arguments, host_workspace, workspace, stream);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Planar complex GEMM
-Status Handle::gemm_planar_complex(
+/// Blockwise-scaled GEMM: D <= alpha * (SFA * A)*(SFB * B) + beta * C
+Status Handle::gemm_blockwise(
 
   int M,                                    /// GEMM M dimension
   int N,                                    /// GEMM N dimension
   int K,                                    /// GEMM K dimension
 
+  int cluster_m,                            /// cluster shape M dimension
+  int cluster_n,                            /// cluster shape N dimension
+  int cluster_k,                            /// cluster shape K dimension
+  int cluster_m_fallback,                   /// Fallback cluster shape M dimension
+  int cluster_n_fallback,                   /// Fallback cluster shape N dimension
+  int cluster_k_fallback,                   /// Fallback cluster shape K dimension
+
   NumericTypeID element_compute,            /// Data type of internal accumulation
 
   NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
@@ -721,75 +2738,78 @@ Status Handle::gemm_planar_complex(
 
   NumericTypeID element_A,                  /// Data type of A matrix elements
   LayoutTypeID layout_A,                    /// Layout of A matrix
-  ComplexTransform transform_A,             /// Complex transformation applied to A matrix
-
-  void const * ptr_A_real,                  /// Pointer to real part of A matrix
-  void const * ptr_A_imag,                  /// Pointer to imaginary part of A matrix
-  int64_t lda_real,                         /// Leading dimension of real part of A matrix
-  int64_t lda_imag,                         /// Leading dimension of imaginary part of A matrix
-
-  NumericTypeID element_B,                  /// Data type of B matrix elements
-  LayoutTypeID layout_B,                    /// Layout of B matrix
-  ComplexTransform transform_B,             /// Complex transformation applied to B matrix
-
-  void const * ptr_B_real,                  /// Pointer to real part of B matrix
-  void const * ptr_B_imag,                  /// Pointer to imaginary part of B matrix
-  int64_t ldb_real,                             /// Leading dimension of real part of B matrix
-  int64_t ldb_imag,                             /// Leading dimension of imaginary part of B matrix
+  void const * ptr_A,                       /// Pointer to A matrix in Global Memory
+  int64_t lda,                              /// Leading dimension of A matrix
 
-  void const * beta,                        /// Pointer to beta scalar
+  NumericTypeID element_SFA,                /// Data type of A scale factors
+  void const * ptr_SFA,                     /// Pointer to A scale factors in Global Memory
 
-  NumericTypeID element_C,                  /// Data type of C and D matrix
+  NumericTypeID element_B,                  /// Data type of B matrix elements
+  LayoutTypeID layout_B,                    /// Layout of B matrix
+  void const * ptr_B,                       /// Pointer to B matrix in Global Memory
+  int64_t ldb,                              /// Leading dimension of B matrix
 
-  void const * ptr_C_real,                  /// Pointer to real part of C matrix
-  void const * ptr_C_imag,                  /// Pointer to imaginary part of C matrix
-  int64_t ldc_real,                             /// Leading dimension of real part of C matrix
-  int64_t ldc_imag,                             /// Leading dimension of imaginary part of C matrix
+  NumericTypeID element_SFB,                /// Data type of B scale factors
+  void const * ptr_SFB,                     /// Pointer to B scale factors in Global Memory
 
-  void * ptr_D_real,                        /// Pointer to real part of D matrix
-  void * ptr_D_imag,                        /// Pointer to imaginary part of D matrix
-  int64_t ldd_real,                             /// Leading dimension of real part of D matrix
-  int64_t ldd_imag,                             /// Leading dimension of imaginary part of D matrix
+  int sf_m_vec_size,                        /// Rows of A sharing a scale factor
+  int sf_n_vec_size,                        /// Columns of B sharing a scale factor
+  int sf_k_vec_size,                        /// Elements along K sharing a scale factor
 
-  int batch_count,                          /// Number of batched GEMMs to execute
+  void const * beta,                        /// Pointer to beta scalar
 
-  int64_t batch_stride_A_real,
-  int64_t batch_stride_A_imag,
+  NumericTypeID element_C,                  /// Data type of C matrix
+  LayoutTypeID layout_C,                    /// Layout of C matrix
+  void const * ptr_C,                       /// Pointer to C matrix
+  int64_t ldc,                              /// Leading dimension of C matrix
 
-  int64_t batch_stride_B_real,
-  int64_t batch_stride_B_imag,
+  NumericTypeID element_D,                  /// Data type of D matrix
+  LayoutTypeID layout_D,                    /// Layout of D matrix
+  void * ptr_D,                             /// Pointer to D matrix
+  int64_t ldd,                              /// Leading dimension of D matrix
 
-  int64_t batch_stride_C_real,
-  int64_t batch_stride_C_imag,
+  int batch_count,                          /// Batch count
 
-  int64_t batch_stride_D_real,
-  int64_t batch_stride_D_imag
+  int64_t batch_stride_A,                   /// Batch stride of A operand
+  int64_t batch_stride_B,                   /// Batch stride of B operand
+  int64_t batch_stride_C,                   /// Batch stride of C operand
+  int64_t batch_stride_D                    /// Batch stride of D operand
 ) {
 
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
   //
   // Find the operation
   //
 
-  GemmFunctionalKey key(
+  BlockwiseGemmFunctionalKey key(
     provider_,
-    GemmKind::kPlanarComplex,
+    GemmKind::kUniversal,
+    OperationKind::kBlockwiseGemm,
     element_compute,
     element_scalar,
     element_A,
     layout_A,
-    transform_A,
+    element_SFA,
     element_B,
     layout_B,
-    transform_B,
-    element_C,  // C/D are same type
-    LayoutTypeID::kColumnMajor,
+    element_SFB,
     element_C,
-    LayoutTypeID::kColumnMajor
+    layout_C,
+    element_D,
+    layout_D,
+    sf_m_vec_size,
+    sf_n_vec_size,
+    sf_k_vec_size
   );
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+  auto operators_it = Singleton::get().operation_table.blockwise_gemm_operations.find(key);
 
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+  if (operators_it == Singleton::get().operation_table.blockwise_gemm_operations.end()) {
     return cutlass::Status::kErrorNotSupported;
   }
 
@@ -804,21 +2824,12 @@ Status Handle::gemm_planar_complex(
   // Maximum alignment expectation among all kernels (in units of bytes)
   int const kMaximumAlignmentSize = 16;
 
-  int alignment = std::max(
-    gemm_problem_alignment(
-      M, N, K,
-      element_A, ptr_A_real, lda_real, batch_stride_A_real,
-      element_B, ptr_B_real, ldb_real, batch_stride_B_real,
-      element_C, ptr_C_real, ldc_real, batch_stride_C_real,
-      ptr_D_real, ldd_real, batch_stride_D_real, kMaximumAlignmentSize
-    ),
-    gemm_problem_alignment(
-      M, N, K,
-      element_A, ptr_A_imag, lda_imag, batch_stride_A_imag,
-      element_B, ptr_B_imag, ldb_imag, batch_stride_B_imag,
-      element_C, ptr_C_imag, ldc_imag, batch_stride_C_imag,
-      ptr_D_imag, ldd_imag, batch_stride_D_imag, kMaximumAlignmentSize
-    )
+  int alignment = gemm_problem_alignment(
+    M, N, K,
+    element_A, ptr_A, lda, batch_stride_A,
+    element_B, ptr_B, ldb, batch_stride_B,
+    element_C, ptr_C, ldc, batch_stride_C,
+    ptr_D, ldd, batch_stride_D, kMaximumAlignmentSize
   );
 
   //
@@ -827,32 +2838,71 @@ Status Handle::gemm_planar_complex(
 
   GemmPreferenceKey preference_key(compute_capability(), alignment);
 
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
+  Operation const *operation = find_scaled_gemm_operation<BlockwiseGemmDescription>(
+    operators_it,
+    preference_key,
+    gemm_selection_policy_,
+    M, N, K,
+    batch_count,
+    {cluster_m, cluster_n, cluster_k},
+    device_.multiProcessorCount);
 
   if (!operation) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  last_operation_ = operation;
+  thread.last_operation = operation;
+
+  gemm::GemmCoord cluster_shape = scaled_gemm_cluster_shape(
+    operation->description(), {cluster_m, cluster_n, cluster_k});
+
+  gemm::GemmCoord cluster_shape_fallback = scaled_gemm_cluster_shape(
+    operation->description(), {cluster_m_fallback, cluster_n_fallback, cluster_k_fallback});
 
   //
   // Configure operation
   //
 
-  GemmPlanarComplexConfiguration configuration{
-    GemmUniversalMode::kBatched,
+  GemmUniversalConfiguration configuration{
+    (batch_count > 1 ? GemmUniversalMode::kBatched : GemmUniversalMode::kGemm),
     {M, N, K},
+    cluster_shape,
+    cluster_shape_fallback,
     batch_count,
-    lda_real,
-    lda_imag,
-    ldb_real,
-    ldb_imag,
-    ldc_real,
-    ldc_imag,
-    ldd_real,
-    ldd_imag
+    lda,
+    ldb,
+    ldc,
+    ldd
   };
 
+  BlockwiseGemmArguments arguments;
+
+  arguments.problem_size = {M, N, K};
+  arguments.cluster_shape = cluster_shape;
+  arguments.cluster_shape_fallback = cluster_shape_fallback;
+  arguments.batch_count = batch_count;
+  arguments.A = ptr_A;
+  arguments.B = ptr_B;
+  arguments.SFA = ptr_SFA;
+  arguments.SFB = ptr_SFB;
+  arguments.C = ptr_C;
+  arguments.D = ptr_D;
+  arguments.alpha = alpha;
+  arguments.beta = beta;
+  arguments.pointer_mode = scalar_pointer_mode_;
+  arguments.lda = lda;
+  arguments.ldb = ldb;
+  arguments.ldc = ldc;
+  arguments.ldd = ldd;
+  arguments.batch_stride_A = batch_stride_A;
+  arguments.batch_stride_B = batch_stride_B;
+  arguments.batch_stride_C = batch_stride_C;
+  arguments.batch_stride_D = batch_stride_D;
+  arguments.sf_m_vec_size = sf_m_vec_size;
+  arguments.sf_n_vec_size = sf_n_vec_size;
+  arguments.sf_k_vec_size = sf_k_vec_size;
+  arguments.sm_count = device_.multiProcessorCount;
+
   // Query host work space size
   uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
 
@@ -863,130 +2913,152 @@ Status Handle::gemm_planar_complex(
   char host_workspace[kHostWorkspaceSize];
 
   // Query device workspace size
-  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
 
   if (uint64_t(workspace_size_) < device_workspace_size_needed) {
     return cutlass::Status::kErrorNotSupported;
   }
 
+  Status status = operation->can_implement(&configuration, &arguments);
+
+  if (status != cutlass::Status::kSuccess) {
+    return status;
+  }
+
   // Initialize host and device workspaces
-  Status status = operation->initialize(
+  status = operation->initialize(
     &configuration,
     host_workspace,
-    workspace_,
-    stream_);
+    workspace,
+    stream);
 
   if (status != cutlass::Status::kSuccess) {
     return status;
   }
 
   // Run the operator
-  GemmPlanarComplexArguments arguments{
-    ptr_A_real,
-    ptr_A_imag,
-    ptr_B_real,
-    ptr_B_imag,
-    ptr_C_real,
-    ptr_C_imag,
-    ptr_D_real,
-    ptr_D_imag,
-    alpha,
-    beta,
-    scalar_pointer_mode_,
-    batch_stride_A_real,
-    batch_stride_A_imag,
-    batch_stride_B_real,
-    batch_stride_B_imag,
-    batch_stride_C_real,
-    batch_stride_C_imag,
-    batch_stride_D_real,
-    batch_stride_D_imag
-  };
 
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+  return operation->run(&arguments, host_workspace, workspace, stream);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
-/// Planar complex batched GEMM loading pointers from arrays in global memory
-Status Handle::gemm_planar_complex_array(
+/// Returns the largest alignment (in elements) of the rows of an attention operand
+static int attention_operand_alignment(
+  NumericTypeID element,
+  void const *ptr,
+  int head_dim,
+  int kMaximumAlignmentSize) {
 
-  int expected_M,                           /// Expected GEMM M dimension (used for sizing CUDA grid)
-  int expected_N,                           /// Expected GEMM N dimension (used for sizing CUDA grid)
-  int expected_K,                           /// Expected GEMM K dimension
-  int batch_count,                          /// Number of independent GEMM computations to execute
+  int element_size = library::sizeof_bits(element);
+  int alignment = kMaximumAlignmentSize * 8 / element_size;
 
-  int const *M,                             /// Array containing the GEMM M dimension for each batch index
-  int const *N,                             /// Array containing the GEMM N dimension for each batch index
-  int const *K,                             /// Array containing the GEMM K dimension for each batch index
+  for (; alignment > 1; alignment /= 2) {
+    if ((head_dim % alignment) == 0 &&
+        (reinterpret_cast<uintptr_t>(ptr) % (alignment * element_size / 8)) == 0) {
+      break;
+    }
+  }
 
-  NumericTypeID element_compute,            /// Data type of internal accumulation
+  return alignment;
+}
 
-  NumericTypeID element_scalar,             /// Data type of alpha/beta scalars
+/// Finds the first attention kernel in descending order of compute capability that supports the problem
+static Operation const * find_attention_operation(
+  AttentionOperationFunctionalMap::const_iterator operators_it,
+  GemmPreferenceKey const preference_key,
+  AttentionConfiguration const &configuration,
+  AttentionArguments const &arguments) {
 
-  void const *alpha,                        /// Pointer to alpha scalar
+  auto cc_it = operators_it->second.upper_bound(preference_key);
 
-  NumericTypeID element_A,                  /// Data type of A matrix elements
-  LayoutTypeID layout_A,                    /// Layout of A matrix
-  ComplexTransform transform_A,             /// Complex transformation applied to A matrix
+  if (cc_it == operators_it->second.begin()) {
+    return nullptr;
+  }
 
-  void const * const * ptr_A_real,          /// Pointer to array containing pointers to real part of A matrices
-  void const * const * ptr_A_imag,          /// Pointer to array containing pointers to imaginary part of A matrices
+  // Search in descending order of compute capability
+  do {
+    --cc_it;
 
-  int64_t lda_real,                             /// Leading dimension of real part of A matrix
-  int64_t lda_imag,                             /// Leading dimension of imaginary part of A matrix
+    for (auto const * op : cc_it->second) {
 
-  NumericTypeID element_B,                  /// Data type of B matrix elements
-  LayoutTypeID layout_B,                    /// Layout of B matrix
-  ComplexTransform transform_B,             /// Complex transformation applied to B matrix
+      AttentionDescription const &desc = static_cast<AttentionDescription const &>(op->description());
 
-  void const * const * ptr_B_real,          /// Pointer to array containing pointers to real part of B matrices
-  void const * const * ptr_B_imag,          /// Pointer to array containing pointers to imaginary part of B matrices
+      int min_cc = desc.tile_description.minimum_compute_capability;
+      int max_cc = desc.tile_description.maximum_compute_capability;
 
-  int64_t ldb_real,                             /// Leading dimension of real part of B matrix
-  int64_t ldb_imag,                             /// Leading dimension of imaginary part of B matrix
+      int op_alignment = std::max(std::max(desc.Q.alignment, desc.K.alignment), desc.O.alignment);
 
-  void const * beta,                        /// Pointer to beta scalar
+      if ((min_cc <= preference_key.compute_capability) &&
+        (preference_key.compute_capability <= max_cc) &&
+        (op_alignment <= preference_key.alignment) &&
+        op->can_implement(&configuration, &arguments) == Status::kSuccess) {
 
-  NumericTypeID element_C,                  /// Data type of C and D matrix
+        return op;
+      }
+    }
+  } while (cc_it != operators_it->second.begin());
 
-  void const * const * ptr_C_real,          /// Pointer to array containing pointers to real part of C matrices
-  void const * const * ptr_C_imag,          /// Pointer to array containing pointers to imaginary part of C matrices
+  return nullptr;
+}
 
-  int64_t ldc_real,                             /// Leading dimension of real part of C matrix
-  int64_t ldc_imag,                             /// Leading dimension of imaginary part of C matrix
+/// Fused multi-head attention (forward)
+Status Handle::attention(
 
-  void * const * ptr_D_real,                /// Pointer to array containing pointers to real part of D matrices
-  void * const * ptr_D_imag,                /// Pointer to array containing pointers to imaginary part of D matrices
+  int batch_count,                          /// Number of sequences
+  int num_heads_q,                          /// Number of query heads
+  int num_heads_kv,                         /// Number of key/value heads
+  int seqlen_q,                             /// Query sequence length
+  int seqlen_kv,                            /// Key/value sequence length
+  int head_dim,                             /// Head dimension
 
-  int64_t ldd_real,                             /// Leading dimension of real part of D matrix
-  int64_t ldd_imag                              /// Leading dimension of imaginary part of D matrix
+  AttentionMask mask,                       /// Mask applied to the scores
+
+  NumericTypeID element_accumulator,        /// Data type of internal accumulation
+
+  NumericTypeID element_Q,                  /// Data type of Q elements
+  void const * ptr_Q,                       /// Pointer to Q in Global Memory
+
+  NumericTypeID element_KV,                 /// Data type of K and V elements
+  void const * ptr_K,                       /// Pointer to K in Global Memory
+  void const * ptr_V,                       /// Pointer to V in Global Memory
+
+  NumericTypeID element_O,                  /// Data type of O elements
+  void * ptr_O,                             /// Pointer to O in Global Memory
+
+  void * ptr_LSE,                           /// Optional pointer to the float LSE, [batch, heads_q, seqlen_q]
+
+  float scale_softmax,                      /// Softmax scale (0 selects 1/sqrt(head_dim))
+
+  int const * page_table,                   /// Optional page table, [batch, ceil(seqlen_kv / page_size)]
+  int page_size,                            /// Tokens per page
+  int page_count                            /// Number of pages
 ) {
 
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+
+  ThreadState &thread = thread_state_();
+  cudaStream_t stream = thread.stream;
+  void *workspace = stream_workspace_(stream);
+
   //
   // Find the operation
   //
 
-  GemmFunctionalKey key(
+  AttentionFunctionalKey key(
     provider_,
-    GemmKind::kPlanarComplexArray,
-    element_compute,
-    element_scalar,
-    element_A,
-    layout_A,
-    transform_A,
-    element_B,
-    layout_B,
-    transform_B,
-    element_C,  // C/D are same type
-    LayoutTypeID::kColumnMajor,
-    element_C,
-    LayoutTypeID::kColumnMajor
+    element_Q,
+    element_KV,
+    element_O,
+    element_accumulator,
+    head_dim,
+    mask,
+    page_table != nullptr
   );
 
-  auto operators_it = Singleton::get().operation_table.gemm_operations.find(key);
+  auto operators_it = Singleton::get().operation_table.attention_operations.find(key);
 
-  if (operators_it == Singleton::get().operation_table.gemm_operations.end()) {
+  if (operators_it == Singleton::get().operation_table.attention_operations.end()) {
     return cutlass::Status::kErrorNotSupported;
   }
 
@@ -994,6 +3066,32 @@ Status Handle::gemm_planar_complex_array(
     return cutlass::Status::kErrorNotSupported;
   }
 
+  //
+  // Configure operation
+  //
+
+  AttentionConfiguration configuration;
+
+  configuration.batch_count = batch_count;
+  configuration.num_heads_q = num_heads_q;
+  configuration.num_heads_kv = num_heads_kv;
+  configuration.seqlen_q = seqlen_q;
+  configuration.seqlen_kv = seqlen_kv;
+  configuration.head_dim = head_dim;
+  configuration.page_size = page_size;
+  configuration.page_count = page_count;
+
+  AttentionArguments arguments;
+
+  arguments.Q = ptr_Q;
+  arguments.K = ptr_K;
+  arguments.V = ptr_V;
+  arguments.O = ptr_O;
+  arguments.lse = ptr_LSE;
+  arguments.page_table = page_table;
+  arguments.scale_softmax = scale_softmax;
+  arguments.sm_count = device_.multiProcessorCount;
+
   //
   // Compute the largest alignment restriction the kernel can satisfy.
   //
@@ -1001,22 +3099,12 @@ Status Handle::gemm_planar_complex_array(
   // Maximum alignment expectation among all kernels (in units of bytes)
   int const kMaximumAlignmentSize = 16;
 
-  int alignment = std::max(
-    gemm_problem_alignment(
-      expected_M, expected_N, expected_K,
-      element_A, nullptr, lda_real, 0,
-      element_B, nullptr, ldb_real, 0,
-      element_C, nullptr, ldc_real, 0,
-      nullptr, ldd_real, 0, kMaximumAlignmentSize
-    ),
-    gemm_problem_alignment(
-      expected_M, expected_N, expected_K,
-      element_A, nullptr, lda_imag, 0,
-      element_B, nullptr, ldb_imag, 0,
-      element_C, nullptr, ldc_imag, 0,
-      nullptr, ldd_imag, 0, kMaximumAlignmentSize
-    )
-  );
+  int alignment = std::min({
+    attention_operand_alignment(element_Q, ptr_Q, head_dim, kMaximumAlignmentSize),
+    attention_operand_alignment(element_KV, ptr_K, head_dim, kMaximumAlignmentSize),
+    attention_operand_alignment(element_KV, ptr_V, head_dim, kMaximumAlignmentSize),
+    attention_operand_alignment(element_O, ptr_O, head_dim, kMaximumAlignmentSize)
+  });
 
   //
   // Find the best kernel in descending order of preference.
@@ -1024,30 +3112,13 @@ Status Handle::gemm_planar_complex_array(
 
   GemmPreferenceKey preference_key(compute_capability(), alignment);
 
-  Operation const *operation = find_gemm_operation(operators_it, preference_key);
+  Operation const *operation = find_attention_operation(operators_it, preference_key, configuration, arguments);
 
   if (!operation) {
     return cutlass::Status::kErrorNotSupported;
   }
 
-  last_operation_ = operation;
-
-  //
-  // Configure operation
-  //
-
-  GemmPlanarComplexArrayConfiguration configuration{
-    {expected_M, expected_N, expected_K},
-    batch_count,
-    lda_real,
-    lda_imag,
-    ldb_real,
-    ldb_imag,
-    ldc_real,
-    ldc_imag,
-    ldd_real,
-    ldd_imag
-  };
+  thread.last_operation = operation;
 
   // Query host work space size
   uint64_t host_workspace_size_needed = operation->get_host_workspace_size(&configuration);
@@ -1059,7 +3130,7 @@ Status Handle::gemm_planar_complex_array(
   char host_workspace[kHostWorkspaceSize];
 
   // Query device workspace size
-  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration);
+  uint64_t device_workspace_size_needed = operation->get_device_workspace_size(&configuration, &arguments);
 
   if (uint64_t(workspace_size_) < device_workspace_size_needed) {
     return cutlass::Status::kErrorNotSupported;
@@ -1069,30 +3140,16 @@ Status Handle::gemm_planar_complex_array(
   Status status = operation->initialize(
     &configuration,
     host_workspace,
-    workspace_,
-    stream_);
+    workspace,
+    stream);
 
   if (status != cutlass::Status::kSuccess) {
     return status;
   }
 
   // Run the operator
-  GemmPlanarComplexArrayArguments arguments{
-    M, N, K,
-    ptr_A_real,
-    ptr_A_imag,
-    ptr_B_real,
-    ptr_B_imag,
-    ptr_C_real,
-    ptr_C_imag,
-    ptr_D_real,
-    ptr_D_imag,
-    alpha,
-    beta,
-    scalar_pointer_mode_
-  };
 
-  return operation->run(&arguments, host_workspace, workspace_, stream_);
+  return operation->run(&arguments, host_workspace, workspace, stream);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
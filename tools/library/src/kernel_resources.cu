@@ -0,0 +1,111 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Resource usage and occupancy of the kernels of operations.
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/trace.h"
+
+#include "kernel_resources.h"
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+Status query_kernel_resources(
+  void const *kernel,
+  dim3 block,
+  int dynamic_smem_bytes,
+  dim3 cluster,
+  KernelResourceUsage *usage) {
+
+  if (!kernel || !usage) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  cudaFuncAttributes attributes;
+  cudaError_t result = cudaFuncGetAttributes(&attributes, kernel);
+  if (result != cudaSuccess) {
+    CUTLASS_TRACE_HOST("  cudaFuncGetAttributes() returned error " << cudaGetErrorString(result));
+    cudaGetLastError(); // to clear the error bit
+    return Status::kErrorInternal;
+  }
+
+  int threads_per_cta = int(block.x * block.y * block.z);
+
+  usage->registers_per_thread = attributes.numRegs;
+  usage->local_bytes_per_thread = int64_t(attributes.localSizeBytes);
+  usage->static_smem_bytes = int64_t(attributes.sharedSizeBytes);
+  usage->dynamic_smem_bytes = dynamic_smem_bytes;
+  usage->threads_per_cta = threads_per_cta;
+  usage->binary_version = attributes.binaryVersion;
+
+  // Occupancy queries fail unless the kernel may use the requested dynamic shared memory, which
+  // initializing the operation normally permits
+  if (dynamic_smem_bytes > attributes.maxDynamicSharedSizeBytes) {
+    result = cudaFuncSetAttribute(kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, dynamic_smem_bytes);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error " << cudaGetErrorString(result));
+      cudaGetLastError(); // to clear the error bit
+      return Status::kErrorInternal;
+    }
+  }
+
+  int max_ctas_per_sm = 0;
+  result = cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+    &max_ctas_per_sm, kernel, threads_per_cta, size_t(dynamic_smem_bytes));
+  if (result != cudaSuccess) {
+    CUTLASS_TRACE_HOST("  cudaOccupancyMaxActiveBlocksPerMultiprocessor() returned error "
+      << cudaGetErrorString(result));
+    cudaGetLastError(); // to clear the error bit
+    max_ctas_per_sm = 0;
+  }
+  usage->max_ctas_per_sm = max_ctas_per_sm;
+
+  usage->cluster_size = int(cluster.x * cluster.y * cluster.z);
+  usage->max_active_clusters = 0;
+  if (usage->cluster_size > 0 && attributes.binaryVersion >= 90) {
+    usage->max_active_clusters = KernelHardwareInfo::query_device_max_active_clusters(
+      cluster, uint32_t(threads_per_cta), kernel, nullptr, dynamic_smem_bytes);
+  }
+
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,357 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Database of profiled GEMM kernel selections consumed by library::Handle.
+*/
+
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "cutlass/library/kernel_selection.h"
+#include "cutlass/library/util.h"
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Rounds up to the next power of two and returns its log2
+int log2_ceil(int x) {
+  int log2 = 0;
+  while (log2 < 31 && (1 << log2) < x) {
+    ++log2;
+  }
+  return log2;
+}
+
+/// Attribute-value pairs of a flat JSON object (values are kept as unparsed text)
+using JsonObject = std::unordered_map<std::string, std::string>;
+
+/// Minimal reader for the flat JSON objects emitted by KernelSelectionDatabase::write()
+class JsonObjectReader {
+public:
+
+  explicit JsonObjectReader(std::string const &text): text_(text), pos_(0) { }
+
+  /// Advances past the next occurrence of a token. Returns false if it is not found.
+  bool seek(std::string const &token) {
+    size_t found = text_.find(token, pos_);
+    if (found == std::string::npos) {
+      return false;
+    }
+    pos_ = found + token.size();
+    return true;
+  }
+
+  /// Reads the next object within the current array. Returns false at the end of the array.
+  bool next_object(JsonObject &object, bool &ok) {
+
+    object.clear();
+    ok = true;
+
+    skip_space_();
+    if (peek_() == ',') {
+      ++pos_;
+      skip_space_();
+    }
+    if (peek_() != '{') {
+      return false;
+    }
+    ++pos_;
+
+    while (true) {
+      skip_space_();
+      if (peek_() == '}') {
+        ++pos_;
+        return true;
+      }
+      if (peek_() == ',') {
+        ++pos_;
+        continue;
+      }
+
+      std::string name, value;
+      if (!read_string_(name)) {
+        ok = false;
+        return false;
+      }
+      skip_space_();
+      if (peek_() != ':') {
+        ok = false;
+        return false;
+      }
+      ++pos_;
+      skip_space_();
+
+      if (!next_value(value)) {
+        ok = false;
+        return false;
+      }
+      object[name] = value;
+    }
+  }
+
+  /// Reads the string or number at the current position
+  bool next_value(std::string &value) {
+    skip_space_();
+    if (peek_() == '"') {
+      return read_string_(value);
+    }
+    while (pos_ < text_.size() && text_[pos_] != ',' && text_[pos_] != '}' && text_[pos_] != ']' &&
+           !std::isspace(text_[pos_])) {
+      value.push_back(text_[pos_++]);
+    }
+    return !value.empty();
+  }
+
+private:
+
+  char peek_() const {
+    return pos_ < text_.size() ? text_[pos_] : '\0';
+  }
+
+  void skip_space_() {
+    while (pos_ < text_.size() && std::isspace(text_[pos_])) {
+      ++pos_;
+    }
+  }
+
+  bool read_string_(std::string &str) {
+    if (peek_() != '"') {
+      return false;
+    }
+    ++pos_;
+    while (pos_ < text_.size() && text_[pos_] != '"') {
+      if (text_[pos_] == '\\' && pos_ + 1 < text_.size()) {
+        ++pos_;
+      }
+      str.push_back(text_[pos_++]);
+    }
+    if (pos_ >= text_.size()) {
+      return false;
+    }
+    ++pos_;
+    return true;
+  }
+
+  std::string const &text_;
+  size_t pos_;
+};
+
+/// Returns an integer attribute of a JSON object
+bool json_int(JsonObject const &object, char const *name, int &value) {
+  auto it = object.find(name);
+  if (it == object.end()) {
+    return false;
+  }
+  std::istringstream ss(it->second);
+  ss >> value;
+  return !ss.fail();
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the bucket containing a problem
+KernelSelectionDatabase::Bucket KernelSelectionDatabase::bucket(int M, int N, int K, int batch_count) {
+  return Bucket{log2_ceil(M), log2_ceil(N), log2_ceil(K), log2_ceil(batch_count)};
+}
+
+/// Returns a string uniquely identifying the functional signature of a GEMM
+std::string KernelSelectionDatabase::signature(GemmFunctionalKey const &key) {
+
+  std::stringstream ss;
+
+  ss << to_string(key.provider) << ":"
+     << to_string(key.gemm_kind) << ":"
+     << to_string(key.element_compute) << ":"
+     << to_string(key.element_scalar) << ":"
+     << to_string(key.element_A) << ":" << to_string(key.layout_A) << ":" << to_string(key.transform_A) << ":"
+     << to_string(key.element_B) << ":" << to_string(key.layout_B) << ":" << to_string(key.transform_B) << ":"
+     << to_string(key.element_C) << ":" << to_string(key.layout_C) << ":"
+     << to_string(key.element_D) << ":" << to_string(key.layout_D);
+
+  return ss.str();
+}
+
+/// Records a profiled kernel, keeping the fastest for each bucket and signature
+void KernelSelectionDatabase::insert(GemmFunctionalKey const &key, KernelSelection const &selection) {
+
+  Key db_key(signature(key), bucket(
+    selection.problem_size.m(), selection.problem_size.n(), selection.problem_size.k(), selection.batch_count));
+
+  auto it = selections_.find(db_key);
+  if (it == selections_.end() || selection.runtime < it->second.runtime) {
+    selections_[db_key] = selection;
+  }
+}
+
+/// Merges another database, keeping the fastest selection for each bucket and signature
+void KernelSelectionDatabase::merge(KernelSelectionDatabase const &other) {
+
+  for (auto const &entry : other.selections_) {
+    auto it = selections_.find(entry.first);
+    if (it == selections_.end() || entry.second.runtime < it->second.runtime) {
+      selections_[entry.first] = entry.second;
+    }
+  }
+}
+
+/// Returns the selection for a problem or nullptr if its bucket was not profiled
+KernelSelection const *KernelSelectionDatabase::find(
+  GemmFunctionalKey const &key, int M, int N, int K, int batch_count) const {
+
+  auto it = selections_.find(Key(signature(key), bucket(M, N, K, batch_count)));
+  if (it == selections_.end()) {
+    return nullptr;
+  }
+  return &it->second;
+}
+
+/// Writes the database as JSON
+std::ostream &KernelSelectionDatabase::write(std::ostream &out) const {
+
+  out << "{\n"
+      << "  \"version\": " << kVersion << ",\n"
+      << "  \"selections\": [\n";
+
+  out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  int idx = 0;
+  for (auto const &entry : selections_) {
+    KernelSelection const &selection = entry.second;
+
+    out << (idx++ ? ",\n" : "")
+        << "    {"
+        << "\"signature\": \"" << entry.first.first << "\", "
+        << "\"m\": " << selection.problem_size.m() << ", "
+        << "\"n\": " << selection.problem_size.n() << ", "
+        << "\"k\": " << selection.problem_size.k() << ", "
+        << "\"batch_count\": " << selection.batch_count << ", "
+        << "\"operation\": \"" << selection.operation_name << "\", "
+        << "\"raster_order\": \"" << to_string(selection.raster_order) << "\", "
+        << "\"swizzle_size\": " << selection.swizzle_size << ", "
+        << "\"split_k_slices\": " << selection.split_k_slices << ", "
+        << "\"cluster_m\": " << selection.cluster_shape.m() << ", "
+        << "\"cluster_n\": " << selection.cluster_shape.n() << ", "
+        << "\"cluster_k\": " << selection.cluster_shape.k() << ", "
+        << "\"cluster_m_fallback\": " << selection.cluster_shape_fallback.m() << ", "
+        << "\"cluster_n_fallback\": " << selection.cluster_shape_fallback.n() << ", "
+        << "\"cluster_k_fallback\": " << selection.cluster_shape_fallback.k() << ", "
+        << "\"runtime_ms\": " << selection.runtime
+        << "}";
+  }
+
+  out << "\n  ]\n}\n";
+
+  return out;
+}
+
+/// Reads a database written by write(), replacing the current contents
+Status KernelSelectionDatabase::read(std::istream &in) {
+
+  std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+  JsonObjectReader reader(text);
+
+  std::string version;
+  if (!reader.seek("\"version\":") || !reader.next_value(version)) {
+    return Status::kInvalid;
+  }
+  if (version != std::to_string(kVersion)) {
+    return Status::kErrorNotSupported;
+  }
+
+  if (!reader.seek("\"selections\":") || !reader.seek("[")) {
+    return Status::kInvalid;
+  }
+
+  std::map<Key, KernelSelection> selections;
+
+  JsonObject object;
+  bool ok = true;
+  while (reader.next_object(object, ok)) {
+
+    KernelSelection selection;
+    int m = 0, n = 0, k = 0;
+    int cluster[6] = {0, 0, 0, 0, 0, 0};
+
+    if (!object.count("signature") || !object.count("operation") ||
+        !json_int(object, "m", m) || !json_int(object, "n", n) || !json_int(object, "k", k) ||
+        !json_int(object, "batch_count", selection.batch_count) ||
+        !json_int(object, "swizzle_size", selection.swizzle_size) ||
+        !json_int(object, "split_k_slices", selection.split_k_slices) ||
+        !json_int(object, "cluster_m", cluster[0]) ||
+        !json_int(object, "cluster_n", cluster[1]) ||
+        !json_int(object, "cluster_k", cluster[2]) ||
+        !json_int(object, "cluster_m_fallback", cluster[3]) ||
+        !json_int(object, "cluster_n_fallback", cluster[4]) ||
+        !json_int(object, "cluster_k_fallback", cluster[5])) {
+      return Status::kInvalid;
+    }
+
+    selection.problem_size = {m, n, k};
+    selection.operation_name = object["operation"];
+    selection.raster_order = from_string<RasterOrder>(object["raster_order"]);
+    selection.cluster_shape = {cluster[0], cluster[1], cluster[2]};
+    selection.cluster_shape_fallback = {cluster[3], cluster[4], cluster[5]};
+    std::istringstream(object["runtime_ms"]) >> selection.runtime;
+
+    if (selection.raster_order == RasterOrder::kInvalid) {
+      return Status::kInvalid;
+    }
+
+    selections[Key(object["signature"], bucket(m, n, k, selection.batch_count))] = selection;
+  }
+
+  if (!ok) {
+    return Status::kInvalid;
+  }
+
+  selections_ = std::move(selections);
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
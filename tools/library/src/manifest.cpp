@@ -63,6 +63,12 @@ Status Manifest::initialize() {
   // initialize manually instanced reduction reference op in manifest object
   initialize_all_reduction_op(*this);
 
+  // initialize manually instanced gemv op in manifest object
+  initialize_all_gemv_op(*this);
+
+  // initialize manually instanced attention op in manifest object
+  initialize_all_attention_op(*this);
+
   return Status::kSuccess;
 }
 
@@ -0,0 +1,218 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Export and in-place update of the kernel parameters of initialized operations.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/library/library.h"
+
+#include "operation_argument_packet.h"
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Size in bytes of a TMA descriptor
+static size_t const kTensorMapSize = 128;
+
+/// Alignment in bytes of a TMA descriptor
+static size_t const kTensorMapAlignment = 64;
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+/// Replaces the global address of a TMA descriptor stored at an arbitrary location
+static Status replace_tensor_map_address(
+  uint8_t *tensor_map_bytes,
+  void const *address,
+  CudaHostAdapter *cuda_adapter) {
+
+  // The driver expects a descriptor aligned to 64B
+  CUtensorMap tensor_map;
+  std::memcpy(&tensor_map, tensor_map_bytes, sizeof(tensor_map));
+
+  CUresult result = cuda_adapter ?
+    cuda_adapter->tensorMapReplaceAddress(&tensor_map, const_cast<void *>(address)) :
+    CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapReplaceAddress)(&tensor_map, const_cast<void *>(address));
+
+  if (result != CUDA_SUCCESS) {
+    return Status::kErrorInternal;
+  }
+
+  std::memcpy(tensor_map_bytes, &tensor_map, sizeof(tensor_map));
+  return Status::kSuccess;
+}
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Locates an operand within kernel parameters built with each of kOperandProbeAddresses
+Status locate_operand_patches(
+  void const *params_probe_0,
+  void const *params_probe_1,
+  size_t params_size,
+  OperationArgumentPatch::Operand operand,
+  std::vector<OperationArgumentPatch> &patches) {
+
+  uint8_t const *bytes_0 = static_cast<uint8_t const *>(params_probe_0);
+  uint8_t const *bytes_1 = static_cast<uint8_t const *>(params_probe_1);
+
+  // Bytes of the parameters depending on the operand's address and not yet explained by a patch
+  std::vector<bool> differs(params_size, false);
+
+  for (size_t i = 0; i < params_size; ++i) {
+    differs[i] = (bytes_0[i] != bytes_1[i]);
+  }
+
+  // Pointers hold the address itself
+  for (size_t offset = 0; offset + sizeof(uint64_t) <= params_size; offset += sizeof(uint64_t)) {
+
+    uint64_t value_0;
+    uint64_t value_1;
+    std::memcpy(&value_0, bytes_0 + offset, sizeof(value_0));
+    std::memcpy(&value_1, bytes_1 + offset, sizeof(value_1));
+
+    if (value_0 == kOperandProbeAddresses[0] && value_1 == kOperandProbeAddresses[1]) {
+      patches.push_back({OperationArgumentPatch::Kind::kPointer, operand, offset});
+      std::fill(differs.begin() + offset, differs.begin() + offset + sizeof(uint64_t), false);
+    }
+  }
+
+  for (size_t i = 0; i < params_size; ++i) {
+
+    if (!differs[i]) {
+      continue;
+    }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+    // TMA descriptors encode the address. A candidate descriptor containing the byte is accepted if
+    // replacing its address by the second probe reproduces the second parameters exactly.
+    bool found = false;
+
+    size_t last = i / kTensorMapAlignment * kTensorMapAlignment;
+    size_t first = (last >= kTensorMapSize - kTensorMapAlignment) ? last - (kTensorMapSize - kTensorMapAlignment) : 0;
+
+    for (size_t offset = first; offset <= last && offset + kTensorMapSize <= params_size; offset += kTensorMapAlignment) {
+
+      uint8_t tensor_map[kTensorMapSize];
+      std::memcpy(tensor_map, bytes_0 + offset, kTensorMapSize);
+
+      Status status = replace_tensor_map_address(
+        tensor_map, reinterpret_cast<void const *>(kOperandProbeAddresses[1]), nullptr);
+
+      if (status == Status::kSuccess && !std::memcmp(tensor_map, bytes_1 + offset, kTensorMapSize)) {
+        patches.push_back({OperationArgumentPatch::Kind::kTensorMap, operand, offset});
+        std::fill(differs.begin() + offset, differs.begin() + offset + kTensorMapSize, false);
+        found = true;
+        break;
+      }
+    }
+
+    if (!found) {
+      return Status::kErrorNotSupported;
+    }
+
+#else
+
+    return Status::kErrorNotSupported;
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+  }
+
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Rewrites the operand addresses of exported kernel parameters in place
+Status Operation::update_arguments(
+  OperationArgumentPacket *packet,
+  void const *ptr_A,
+  void const *ptr_B,
+  void const *ptr_C,
+  void *ptr_D,
+  CudaHostAdapter *cuda_adapter) const {
+
+  if (!packet) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  for (OperationArgumentPatch const &patch : packet->patches) {
+
+    void const *address = nullptr;
+
+    switch (patch.operand) {
+      case OperationArgumentPatch::Operand::kA: address = ptr_A; break;
+      case OperationArgumentPatch::Operand::kB: address = ptr_B; break;
+      case OperationArgumentPatch::Operand::kC: address = ptr_C; break;
+      case OperationArgumentPatch::Operand::kD: address = ptr_D; break;
+      default: return Status::kErrorInvalidProblem;
+    }
+
+    if (patch.offset + (patch.kind == OperationArgumentPatch::Kind::kPointer ? sizeof(void *) : kTensorMapSize) >
+      packet->params.size()) {
+      return Status::kErrorInvalidProblem;
+    }
+
+    uint8_t *location = packet->params.data() + patch.offset;
+
+    if (patch.kind == OperationArgumentPatch::Kind::kPointer) {
+      std::memcpy(location, &address, sizeof(address));
+    }
+    else {
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+      Status status = replace_tensor_map_address(location, address, cuda_adapter);
+
+      if (status != Status::kSuccess) {
+        return status;
+      }
+#else
+      return Status::kErrorNotSupported;
+#endif
+    }
+  }
+
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -122,6 +122,33 @@ void OperationTable::append(Manifest const &manifest) {
       blockwise_gemm_operations[functional_key][preference_key].push_back(op);
     }
 
+    // insert all attention operations into operation table
+    if (desc.kind == OperationKind::kAttention) {
+      AttentionDescription const &attention_desc = static_cast<AttentionDescription const &>(desc);
+
+      AttentionFunctionalKey functional_key(
+        attention_desc.provider,
+        attention_desc.Q.element,
+        attention_desc.K.element,
+        attention_desc.O.element,
+        attention_desc.tile_description.math_instruction.element_accumulator,
+        attention_desc.head_dim,
+        attention_desc.mask,
+        attention_desc.paged
+      );
+
+      Operation const *op = operation.get();
+
+      int cc = attention_desc.tile_description.minimum_compute_capability;
+
+      int alignment = std::max(std::max(
+        attention_desc.Q.alignment, attention_desc.K.alignment), attention_desc.O.alignment);
+
+      GemmPreferenceKey preference_key(cc, alignment);
+
+      attention_operations[functional_key][preference_key].push_back(op);
+    }
+
     // insert all gemm operation into operation table
     if (desc.kind == OperationKind::kGemm) {
       GemmDescription const &gemm_desc = static_cast<GemmDescription const &>(desc);
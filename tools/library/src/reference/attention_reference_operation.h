@@ -0,0 +1,227 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+  \brief Defines the reference operations for attention in CUTLASS Library
+*/
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <cstring>
+
+#include "cutlass/cutlass.h"
+
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+#include "cutlass/library/util.h"
+#include "library_internal.h"
+
+#include "cutlass/util/reference/device/attention.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Device-side reference of the attention operations. The head dimension, mask and paging are
+/// part of the functional key, so one instance is registered for each of them.
+template <
+  typename Element_,
+  typename ElementOut_,
+  typename ElementAccumulator_ = float
+>
+class AttentionReferenceOperation : public Operation {
+public:
+  static Provider const kProvider = Provider::kReferenceDevice;
+  static int const kMaxHeadDim = 256;
+
+  using Element = Element_;
+  using ElementOut = ElementOut_;
+  using ElementAccumulator = ElementAccumulator_;
+
+protected:
+
+  /// Storage for the name string
+  std::string name_;
+
+  ///
+  AttentionDescription description_;
+
+public:
+
+  /// Constructor
+  AttentionReferenceOperation(int head_dim, AttentionMask mask, bool paged) {
+
+    // Basic information
+    description_.provider = kProvider;
+    description_.kind = OperationKind::kAttention;
+
+    // Tensor description
+    description_.Q = make_TensorDescription<Element, layout::RowMajor>();
+    description_.K = make_TensorDescription<Element, layout::RowMajor>();
+    description_.V = make_TensorDescription<Element, layout::RowMajor>();
+    description_.O = make_TensorDescription<ElementOut, layout::RowMajor>();
+    description_.head_dim = head_dim;
+    description_.mask = mask;
+    description_.paged = paged;
+
+    description_.tile_description.math_instruction.element_accumulator =
+      NumericTypeMap<ElementAccumulator>::kId;
+
+    description_.tile_description.minimum_compute_capability = 50;
+    description_.tile_description.maximum_compute_capability = 1024;
+
+    // Procedural name
+    std::stringstream ss;
+
+    ss << "attention_reference_" << to_string(description_.provider)
+      << "_" << to_string(description_.Q.element)
+      << "_" << to_string(description_.O.element)
+      << "_" << to_string(description_.tile_description.math_instruction.element_accumulator)
+      << "_d" << head_dim << "_" << to_string(mask) << (paged ? "_paged" : "");
+
+    name_ = ss.str();
+
+    description_.name = name_.c_str();
+  }
+
+  /// Returns the description of the attention operation
+  virtual OperationDescription const & description() const {
+    return description_;
+  }
+
+  virtual Status can_implement(
+    void const *configuration_ptr,
+    void const *arguments) const {
+
+    AttentionConfiguration const &configuration = *static_cast<AttentionConfiguration const *>(configuration_ptr);
+
+    if (configuration.head_dim != description_.head_dim ||
+        configuration.head_dim > kMaxHeadDim ||
+        configuration.num_heads_kv <= 0 ||
+        configuration.num_heads_q % configuration.num_heads_kv != 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    if (description_.paged && configuration.page_size <= 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    return Status::kSuccess;
+  }
+
+  virtual uint64_t get_host_workspace_size(
+    void const *configuration) const {
+
+    return sizeof(AttentionConfiguration);
+  }
+
+  virtual uint64_t get_device_workspace_size(
+    void const *configuration,
+    void const *arguments = nullptr) const {
+
+    return 0;
+  }
+
+  virtual Status initialize(
+    void const *configuration,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const {
+
+    std::memcpy(host_workspace, configuration, get_host_workspace_size(configuration));
+
+    return Status::kSuccess;
+  }
+
+  virtual Status run(
+    void const *arguments,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const {
+
+    AttentionConfiguration const &config = *static_cast<AttentionConfiguration const *>(host_workspace);
+    AttentionArguments const &args = *static_cast<AttentionArguments const *>(arguments);
+
+    bool causal = description_.mask != AttentionMask::kNone;
+    int causal_offset = description_.mask == AttentionMask::kCausalBottomRight ?
+      config.seqlen_kv - config.seqlen_q : 0;
+
+    cutlass::reference::device::Attention<Element, ElementOut, ElementAccumulator>(
+      config.batch_count,
+      config.num_heads_q,
+      config.num_heads_kv,
+      config.seqlen_q,
+      config.seqlen_kv,
+      config.head_dim,
+      static_cast<Element const *>(args.Q),
+      static_cast<Element const *>(args.K),
+      static_cast<Element const *>(args.V),
+      static_cast<ElementOut *>(args.O),
+      static_cast<ElementAccumulator *>(args.lse),
+      ElementAccumulator(args.scale_softmax),
+      causal,
+      causal_offset,
+      description_.paged ? args.page_table : nullptr,
+      description_.paged ? config.page_size : 0,
+      stream);
+
+    return cudaGetLastError() == cudaSuccess ? Status::kSuccess : Status::kErrorInternal;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Constructs the attention reference operators for every mask, with and without paging.
+template <
+  typename Element_,
+  typename ElementOut_,
+  typename ElementAccumulator_ = float
+>
+void make_attention(Manifest &manifest, int head_dim) {
+#if !defined(CUTLASS_PROFILER_DISABLE_REFERENCE)
+  for (AttentionMask mask : {AttentionMask::kNone, AttentionMask::kCausal, AttentionMask::kCausalBottomRight}) {
+    for (bool paged : {false, true}) {
+      manifest.append(new AttentionReferenceOperation<
+        Element_, ElementOut_, ElementAccumulator_
+      >(head_dim, mask, paged));
+    }
+  }
+#endif // !defined(CUTLASS_PROFILER_DISABLE_REFERENCE)
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
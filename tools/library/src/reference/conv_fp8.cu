@@ -0,0 +1,104 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Reference convolutions with FP8 operands
+*/
+
+#include "cutlass/cutlass.h"
+#include "cutlass/library/library.h"
+#include "cutlass/library/manifest.h"
+
+#include "conv_reference_operation.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template <int kConvDim, typename Layout>
+void make_conv_fp8_all(Manifest &manifest) {
+  make_conv_all<
+    kConvDim,
+    float_e4m3_t, Layout,
+    float_e4m3_t, Layout,
+    float_e4m3_t, Layout,
+    float,
+    float
+  >(manifest);
+
+  make_conv_all<
+    kConvDim,
+    float_e4m3_t, Layout,
+    float_e4m3_t, Layout,
+    cutlass::half_t, Layout,
+    float,
+    float
+  >(manifest);
+
+  make_conv_all<
+    kConvDim,
+    float_e4m3_t, Layout,
+    float_e4m3_t, Layout,
+    cutlass::bfloat16_t, Layout,
+    float,
+    float
+  >(manifest);
+
+  make_conv_all<
+    kConvDim,
+    float_e4m3_t, Layout,
+    float_e4m3_t, Layout,
+    float, Layout,
+    float,
+    float
+  >(manifest);
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+// FP8 (e4m3) 2-D and 3-D convolutions with e4m3/f16/bf16/f32 output
+void initialize_conv_reference_operations_fp8(Manifest &manifest) {
+  make_conv_fp8_all<2, cutlass::layout::TensorNHWC>(manifest);
+  make_conv_fp8_all<3, cutlass::layout::TensorNDHWC>(manifest);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
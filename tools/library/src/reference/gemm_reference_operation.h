@@ -266,7 +266,8 @@ public:
         args.batch_stride_A,
         args.batch_stride_B,
         args.batch_stride_C,
-        args.batch_stride_D
+        args.batch_stride_D,
+        args.reference_sample_tiles
       );
 
       return Status::kSuccess;
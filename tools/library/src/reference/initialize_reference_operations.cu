@@ -78,12 +78,15 @@ void initialize_gemm_reference_operations_int_mixed_input(Manifest &manifest);
 
 void initialize_conv2d_reference_operations(Manifest &manifest);
 void initialize_conv3d_reference_operations(Manifest &manifest);
+void initialize_conv_reference_operations_fp8(Manifest &manifest);
+void initialize_attention_reference_operations(Manifest &manifest);
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
 void initialize_reference_operations(Manifest &manifest) {
   initialize_conv2d_reference_operations(manifest);
   initialize_conv3d_reference_operations(manifest);
+  initialize_conv_reference_operations_fp8(manifest);
 
   initialize_gemm_reference_operations_int4(manifest);
 
@@ -120,6 +123,8 @@ void initialize_reference_operations(Manifest &manifest) {
   initialize_blockwise_gemm_reference_operations_fp32out(manifest);
   initialize_blockwise_gemm_reference_operations_fp16out(manifest);
   initialize_blockwise_gemm_reference_operations_bf16out(manifest);
+
+  initialize_attention_reference_operations(manifest);
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,197 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Emits the source of the 3.x GEMM kernel of a GemmDescription for runtime compilation.
+*/
+
+#include <sstream>
+#include <string>
+
+#include "cutlass/library/runtime_gemm_source.h"
+
+namespace cutlass {
+namespace library {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+char const *kRuntimeGemmKernelName = "CutlassRuntimeGemmKernel";
+char const *kRuntimeGemmEntryPoint = "cutlass::device_kernel<CutlassRuntimeGemmKernel>";
+char const *kRuntimeGemmParamsSizeSymbol = "cutlass_runtime_gemm_params_size";
+char const *kRuntimeGemmSharedStorageSizeSymbol = "cutlass_runtime_gemm_shared_storage_size";
+char const *kRuntimeGemmMaxThreadsSymbol = "cutlass_runtime_gemm_max_threads";
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// C++ type of a real numeric type, or nullptr
+char const *element_type_name(NumericTypeID type) {
+  switch (type) {
+    case NumericTypeID::kVoid:   return "void";
+    case NumericTypeID::kU8:     return "uint8_t";
+    case NumericTypeID::kS8:     return "int8_t";
+    case NumericTypeID::kS32:    return "int32_t";
+    case NumericTypeID::kFE4M3:  return "cutlass::float_e4m3_t";
+    case NumericTypeID::kFE5M2:  return "cutlass::float_e5m2_t";
+    case NumericTypeID::kF16:    return "cutlass::half_t";
+    case NumericTypeID::kBF16:   return "cutlass::bfloat16_t";
+    case NumericTypeID::kTF32:   return "cutlass::tfloat32_t";
+    case NumericTypeID::kF32:    return "float";
+    case NumericTypeID::kF64:    return "double";
+    default: break;
+  }
+  return nullptr;
+}
+
+/// C++ type of a row- or column-major layout, or nullptr
+char const *layout_type_name(LayoutTypeID layout) {
+  switch (layout) {
+    case LayoutTypeID::kColumnMajor: return "cutlass::layout::ColumnMajor";
+    case LayoutTypeID::kRowMajor:    return "cutlass::layout::RowMajor";
+    default: break;
+  }
+  return nullptr;
+}
+
+/// Architecture tag of a compute capability, or nullptr
+char const *arch_tag_name(int cc) {
+  switch (cc) {
+    case 90:  return "cutlass::arch::Sm90";
+    case 100: return "cutlass::arch::Sm100";
+    case 103: return "cutlass::arch::Sm103";
+    case 120: return "cutlass::arch::Sm120";
+    default: break;
+  }
+  return nullptr;
+}
+
+std::string static_shape(gemm::GemmCoord coord) {
+  std::ostringstream ss;
+  ss << "cute::Shape<cute::_" << coord.m() << ", cute::_" << coord.n() << ", cute::_" << coord.k() << ">";
+  return ss.str();
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+Status emit_gemm_universal_3x_source(
+  GemmDescription const &desc,
+  std::string &source,
+  RuntimeGemmSourceOptions const &options) {
+
+  TileDescription const &tile = desc.tile_description;
+  int cc = options.compute_capability ? options.compute_capability : tile.minimum_compute_capability;
+
+  char const *arch = arch_tag_name(cc);
+  char const *element_a = element_type_name(desc.A.element);
+  char const *element_b = element_type_name(desc.B.element);
+  char const *element_c = element_type_name(desc.C.element);
+  char const *element_d = element_type_name(desc.D.element);
+  char const *element_accumulator = element_type_name(tile.math_instruction.element_accumulator);
+  char const *element_epilogue = element_type_name(desc.element_epilogue);
+  char const *layout_a = layout_type_name(desc.A.layout);
+  char const *layout_b = layout_type_name(desc.B.layout);
+  char const *layout_c = layout_type_name(desc.C.layout);
+  char const *layout_d = layout_type_name(desc.D.layout);
+
+  bool const supported =
+    arch && element_a && element_b && element_c && element_d && element_accumulator && element_epilogue &&
+    layout_a && layout_b && layout_c && layout_d &&
+    (desc.gemm_kind == GemmKind::kGemm || desc.gemm_kind == GemmKind::kUniversal) &&
+    tile.math_instruction.opcode_class == OpcodeClassID::kTensorOp &&
+    desc.transform_A == ComplexTransform::kNone && desc.transform_B == ComplexTransform::kNone &&
+    desc.D.element != NumericTypeID::kVoid &&
+    tile.threadblock_shape.product() > 0 && tile.cluster_shape.product() > 0;
+
+  if (!supported) {
+    return Status::kErrorNotSupported;
+  }
+
+  // A void source takes the alignment of the destination
+  int alignment_c = desc.C.element == NumericTypeID::kVoid ? desc.D.alignment : desc.C.alignment;
+
+  std::ostringstream ss;
+  ss << "// Runtime instantiation of " << (desc.name ? desc.name : "a GEMM") << "\n"
+     << "#include \"cutlass/cutlass.h\"\n"
+     << "#include \"cute/tensor.hpp\"\n"
+     << "#include \"cutlass/device_kernel.h\"\n"
+     << "#include \"cutlass/epilogue/collective/collective_builder.hpp\"\n"
+     << "#include \"cutlass/gemm/collective/collective_builder.hpp\"\n"
+     << "#include \"cutlass/gemm/kernel/gemm_universal.hpp\"\n"
+     << "\n"
+     << "using CutlassRuntimeGemmTileShape = " << static_shape(tile.threadblock_shape) << ";\n"
+     << "using CutlassRuntimeGemmClusterShape = " << static_shape(tile.cluster_shape) << ";\n"
+     << "\n"
+     << "using CutlassRuntimeGemmEpilogue = typename cutlass::epilogue::collective::CollectiveBuilder<\n"
+     << "    " << arch << ", cutlass::arch::OpClassTensorOp,\n"
+     << "    CutlassRuntimeGemmTileShape, CutlassRuntimeGemmClusterShape,\n"
+     << "    cutlass::epilogue::collective::EpilogueTileAuto,\n"
+     << "    " << element_accumulator << ", " << element_epilogue << ",\n"
+     << "    " << element_c << ", " << layout_c << ", " << alignment_c << ",\n"
+     << "    " << element_d << ", " << layout_d << ", " << desc.D.alignment << ",\n"
+     << "    " << options.epilogue_schedule << "\n"
+     << "  >::CollectiveOp;\n"
+     << "\n"
+     << "using CutlassRuntimeGemmMainloop = typename cutlass::gemm::collective::CollectiveBuilder<\n"
+     << "    " << arch << ", cutlass::arch::OpClassTensorOp,\n"
+     << "    " << element_a << ", " << layout_a << ", " << desc.A.alignment << ",\n"
+     << "    " << element_b << ", " << layout_b << ", " << desc.B.alignment << ",\n"
+     << "    " << element_accumulator << ",\n"
+     << "    CutlassRuntimeGemmTileShape, CutlassRuntimeGemmClusterShape,\n"
+     << "    cutlass::gemm::collective::StageCountAutoCarveout<\n"
+     << "      static_cast<int>(sizeof(typename CutlassRuntimeGemmEpilogue::SharedStorage))>,\n"
+     << "    " << options.kernel_schedule << "\n"
+     << "  >::CollectiveOp;\n"
+     << "\n"
+     << "using " << kRuntimeGemmKernelName << " = cutlass::gemm::kernel::GemmUniversal<\n"
+     << "    cute::Shape<int, int, int, int>,\n"
+     << "    CutlassRuntimeGemmMainloop,\n"
+     << "    CutlassRuntimeGemmEpilogue,\n"
+     << "    " << options.tile_scheduler << ">;\n"
+     << "\n"
+     << "extern \"C\" __device__ uint64_t " << kRuntimeGemmParamsSizeSymbol
+     << " = sizeof(" << kRuntimeGemmKernelName << "::Params);\n"
+     << "extern \"C\" __device__ uint32_t " << kRuntimeGemmSharedStorageSizeSymbol
+     << " = " << kRuntimeGemmKernelName << "::SharedStorageSize;\n"
+     << "extern \"C\" __device__ uint32_t " << kRuntimeGemmMaxThreadsSymbol
+     << " = " << kRuntimeGemmKernelName << "::MaxThreadsPerBlock;\n";
+
+  source = ss.str();
+  return Status::kSuccess;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
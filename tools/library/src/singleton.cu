@@ -29,7 +29,12 @@
  *
  **************************************************************************************************/
 
+#include <cstdlib>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "cutlass/library/library.h"
 #include "cutlass/library/manifest.h"
 #include "cutlass/library/operation_table.h"
@@ -44,6 +49,39 @@ namespace library {
 
 Singleton::Singleton() {
 
+  // A process launching a handful of kernels may avoid constructing every operation in the library.
+  //
+  //   CUTLASS_LIBRARY_RUNTIME_KERNELS  - comma-separated kernel name filters (e.g. "cutlass3x_sm90*f16*tnn")
+  //   CUTLASS_LIBRARY_RUNTIME_ARCH     - compute capability to construct operations for, or "current"
+  //                                      for the current device
+  if (char const *kernels = std::getenv("CUTLASS_LIBRARY_RUNTIME_KERNELS")) {
+    std::vector<std::string> filters;
+    std::istringstream ss(kernels);
+    std::string filter;
+    while (std::getline(ss, filter, ',')) {
+      if (!filter.empty()) {
+        filters.push_back(filter);
+      }
+    }
+    manifest.set_kernel_filters(filters);
+  }
+
+  if (char const *arch = std::getenv("CUTLASS_LIBRARY_RUNTIME_ARCH")) {
+    int compute_capability = 0;
+    if (std::string(arch) == "current") {
+      int device_idx = 0;
+      cudaDeviceProp properties;
+      if (cudaGetDevice(&device_idx) == cudaSuccess &&
+          cudaGetDeviceProperties(&properties, device_idx) == cudaSuccess) {
+        compute_capability = properties.major * 10 + properties.minor;
+      }
+    }
+    else {
+      compute_capability = std::atoi(arch);
+    }
+    manifest.set_compute_capability(compute_capability);
+  }
+
   manifest.initialize();
 
   operation_table.append(manifest);
@@ -250,13 +250,35 @@ protected:
         case RasterOrder::kAlongM:
           operator_args.scheduler.raster_order = Enum_t::AlongM;
           break;
+        case RasterOrder::kL2Aware:
+          operator_args.scheduler.raster_order = Enum_t::L2Aware;
+          break;
+        case RasterOrder::kMorton:
+          operator_args.scheduler.raster_order = Enum_t::Morton;
+          break;
         default:
           operator_args.scheduler.raster_order = Enum_t::Heuristic;
       }
     }
 
+    GemmOperation3xBase<Operator_>::update_operand_element_bits_(operator_args.scheduler);
+
     if constexpr (std::is_same_v<typename Operator::GemmKernel::TileSchedulerTag, cutlass::gemm::StreamKScheduler>) {
       operator_args.scheduler.splits = arguments->split_k_slices;
+      using Mode_t = decltype(operator_args.scheduler.decomposition_mode);
+      switch (arguments->decomposition_mode) {
+        case DecompositionMode::kDataParallel:
+          operator_args.scheduler.decomposition_mode = Mode_t::DataParallel;
+          break;
+        case DecompositionMode::kSplitK:
+          operator_args.scheduler.decomposition_mode = Mode_t::SplitK;
+          break;
+        case DecompositionMode::kStreamK:
+          operator_args.scheduler.decomposition_mode = Mode_t::StreamK;
+          break;
+        default:
+          operator_args.scheduler.decomposition_mode = Mode_t::Heuristic;
+      }
     }
 
     if constexpr (Operator::ArchTag::kMinComputeCapability >= 100) {
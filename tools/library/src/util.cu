@@ -343,6 +343,7 @@ static struct {
   {"conv3d", "Conv3d", OperationKind::kConv3d},
   {"spgemm", "SparseGemm", OperationKind::kSparseGemm},
   {"grouped_gemm", "GroupedGemm", OperationKind::kGroupedGemm},
+  {"attention", "Attention", OperationKind::kAttention},
 };
 
 /// Converts a Status enumerant to a string
@@ -1103,6 +1104,8 @@ RasterOrder_enumerants[] = {
   {"along_n", "<along_n>", "N", RasterOrder::kAlongN},
   {"along_m", "<along_m>", "M", RasterOrder::kAlongM},
   {"heuristic", "<heuristic>", "H", RasterOrder::kHeuristic},
+  {"l2_aware", "<l2_aware>", "L", RasterOrder::kL2Aware},
+  {"morton", "<morton>", "Z", RasterOrder::kMorton},
 };
 
 /// Converts a RasterOrder enumerant to a string
@@ -1140,6 +1143,98 @@ RasterOrder from_string<RasterOrder>(std::string const &str) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+static struct {
+  char const *text;
+  char const *pretty;
+  char const *character;
+  DecompositionMode enumerant;
+}
+DecompositionMode_enumerants[] = {
+  {"heuristic", "<heuristic>", "H", DecompositionMode::kHeuristic},
+  {"data_parallel", "<data_parallel>", "D", DecompositionMode::kDataParallel},
+  {"split_k", "<split_k>", "S", DecompositionMode::kSplitK},
+  {"stream_k", "<stream_k>", "K", DecompositionMode::kStreamK},
+};
+
+/// Converts a DecompositionMode enumerant to a string
+char const *to_string(DecompositionMode type, bool pretty) {
+
+  for (auto const & possible : DecompositionMode_enumerants) {
+    if (type == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+
+/// Converts a DecompositionMode enumerant from a string
+template <>
+DecompositionMode from_string<DecompositionMode>(std::string const &str) {
+
+  for (auto const & possible : DecompositionMode_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0) ||
+        (str.compare(possible.character) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return DecompositionMode::kInvalid;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+static struct {
+  char const *text;
+  char const *pretty;
+  AttentionMask enumerant;
+}
+AttentionMask_enumerants[] = {
+  {"none", "<none>", AttentionMask::kNone},
+  {"causal", "<causal>", AttentionMask::kCausal},
+  {"causal_br", "<causal_bottom_right>", AttentionMask::kCausalBottomRight},
+};
+
+/// Converts an AttentionMask enumerant to a string
+char const *to_string(AttentionMask type, bool pretty) {
+
+  for (auto const & possible : AttentionMask_enumerants) {
+    if (type == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Converts an AttentionMask enumerant from a string
+template <>
+AttentionMask from_string<AttentionMask>(std::string const &str) {
+
+  for (auto const & possible : AttentionMask_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return AttentionMask::kInvalid;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 static struct {
   char const *text;
   char const *pretty;
@@ -76,6 +76,12 @@ private:
   /// Profiles all operations
   int profile_();
 
+  /// Launches one profiler process per shard and merges their reports
+  int profile_sharded_();
+
+  /// Constructs one profiler for each operation kind
+  static OperationProfilerVector make_operation_profilers_(Options const &options);
+
 public:
 
   CutlassProfiler(Options const &options);
@@ -40,6 +40,7 @@
 
 #include "cutlass/library/library.h"
 #include "cutlass/util/distribution.h"
+#include "cutlass/util/reference/device/tensor_compare.h"
 
 #include "enumerated_types.h"
 
@@ -122,6 +123,17 @@ public:
     double epsilon,
     double nonzero_floor);
 
+  /// Compares two blocks in one pass on the device, returning the mismatch count, the largest
+  /// errors, and the indices of the first mismatches
+  static reference::device::BlockCompareSummary block_compare_summary(
+    library::NumericTypeID numeric_type,
+    void const *ptr_A,
+    void const *ptr_B,
+    size_t capacity,
+    bool relative,
+    double epsilon,
+    double nonzero_floor);
+
 public:
   //
   // Methods
@@ -125,6 +125,23 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Indicates the state of the L2 cache in which kernels are timed
+enum class CacheMode {
+  kCold,      ///< rotate through workspaces to avoid cache-resident working sets
+  kHot,       ///< repeatedly launch on the same workspace so operands stay resident in L2
+  kBoth,      ///< measure both, reporting cold runtimes alongside hot runtimes
+  kInvalid
+};
+
+/// Converts a CacheMode enumerant to a string
+char const *to_string(CacheMode cache_mode, bool pretty = false);
+
+/// Parses a CacheMode enumerant from a string
+template <>
+CacheMode from_string<CacheMode>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Indicates the type of kernel argument
 // ArgumentType can be both ScalarType or NumericType. Thus, enums kScalar and kNumeric
 // 1) kScalar: e.g. of a Scalar ArgumentType is u32 is a Scalar type.
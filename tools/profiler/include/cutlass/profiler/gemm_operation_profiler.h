@@ -102,6 +102,7 @@ public:
     int batch_count{1};
 
     cutlass::library::RasterOrder raster_order{cutlass::library::RasterOrder::kHeuristic};
+    cutlass::library::DecompositionMode decomposition_mode{cutlass::library::DecompositionMode::kHeuristic};
     int swizzle_size{1};
     cutlass::library::RuntimeDatatype runtime_input_datatype_a{};
     cutlass::library::RuntimeDatatype runtime_input_datatype_b{};
@@ -114,6 +115,9 @@ public:
     std::vector<uint8_t> beta_zero;
 
     bool use_pdl{false};
+    float prefetch_ratio{-1.0f};
+    float overlap_ratio{0.5f};
+    int emulation_bands{0};
 
     bool enable_sm90_mixed_dtype_shuffle_test{false};
 
@@ -318,6 +322,12 @@ protected:
     void *host_workspace,
     void *device_workspace);
 
+  /// Method to profile copies of a CUTLASS Operation launched concurrently on several streams
+  Status profile_cutlass_concurrent_(
+    PerformanceResult &result,
+    Options const &options,
+    library::Operation const *operation);
+
   /// Initialize reduction problem dimensions and library::Operation
   bool initialize_reduction_configuration_(
     library::Operation const *operation,
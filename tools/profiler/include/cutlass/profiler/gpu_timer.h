@@ -34,6 +34,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <cuda_runtime.h>
 #include "cutlass/cutlass.h"
 
@@ -73,5 +75,35 @@ struct GpuTimer {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Times each launch of a sequence individually by recording an event at every boundary
+struct GpuLaunchTimer {
+
+  /// Boundary events: launch i is bracketed by events[i] and events[i + 1]
+  std::vector<cudaEvent_t> events;
+
+  /// Whether each boundary event has been recorded
+  std::vector<bool> recorded;
+
+  //
+  // Methods
+  //
+
+  explicit GpuLaunchTimer(int launches);
+
+  GpuLaunchTimer(GpuLaunchTimer const&) = delete;
+
+  GpuLaunchTimer(GpuLaunchTimer &&launch_timer) noexcept;
+
+  ~GpuLaunchTimer();
+
+  /// Records the boundary event preceding launch idx (or following the last launch if idx == launches)
+  void record(int idx, cudaStream_t stream = nullptr);
+
+  /// Returns the duration in milliseconds of each launch whose boundary events were both recorded
+  std::vector<double> durations() const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace profiler
 } // namespace cutlass
@@ -36,6 +36,7 @@
 
 #include <vector>
 #include <string>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 
@@ -62,6 +63,20 @@ namespace profiler {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Launch functions of the steps of a kernel sequence captured so far (see SequenceProfiler).
+/// Launch functions refer to the state of the profilers' stack frames, so each step continues
+/// the sequence with next() before returning.
+struct SequenceCapture {
+
+  /// Launch function of each captured step
+  std::vector<std::function<Status(cudaStream_t, int)>> launches;
+
+  /// Profiles the remaining steps of the sequence
+  std::function<Status()> next;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Abstract base class for each math function
 class OperationProfiler {
 public:
@@ -91,6 +106,13 @@ protected:
   /// Performance result vector constructed by profiling the operation
   PerformanceResultVector results_;
 
+  /// Fastest fully profiled runtime for the current problem, against which candidates are
+  /// raced when pruning is enabled (zero if none has been profiled yet)
+  double pruning_best_runtime_{0};
+
+  /// If set, the next profiled kernel is appended to this sequence
+  SequenceCapture *sequence_capture_{nullptr};
+
 public:
 
   //
@@ -118,6 +140,12 @@ public:
   /// Returns a reference to the arguments
   ArgumentDescriptionVector const &arguments() const { return arguments_; }
 
+  /// Appends the next kernel profiled by profile() to a sequence instead of only timing it
+  void capture_sequence(SequenceCapture *capture) { sequence_capture_ = capture; }
+
+  /// Returns the results of the last profiled operation
+  PerformanceResultVector const &results() const { return results_; }
+
 public:
 
   //
@@ -194,13 +222,19 @@ public:
     ProblemSpace const &problem_space,
     ProblemSpace::Problem const &problem);
   
-  /// Compares tensors for equality
+  /// Compares tensors for equality. Prints a summary of the mismatches if verbose.
   static Disposition compare_tensors(
     Options const &options,
     DeviceAllocation &experimental,
     DeviceAllocation &reference,
     int64_t count = 0);
 
+  /// Prints the mismatch count, largest errors, and recorded mismatching coordinates of a comparison
+  static void print_compare_summary(
+    std::ostream &out,
+    reference::device::BlockCompareSummary const &summary,
+    DeviceAllocation const &allocation);
+
   static void save_workspace(
     DeviceContext &device_context,
     Options const &options,
@@ -260,6 +294,15 @@ protected:
     std::function<Status(cudaStream_t, int)> const& func,
     cudaStream_t stream = nullptr);
 
+  /// Profiles copies of the GPU kernel launched in `func` running concurrently on `streams` of
+  /// the current device. `func` receives the stream index, the stream, and a launch index which
+  /// is unique across all streams.
+  Status profile_kernel_concurrent_(
+    PerformanceResult& result,
+    Options const& options,
+    std::function<Status(int, cudaStream_t, int)> const& func,
+    std::vector<cudaStream_t> const& streams);
+
   /// Profiles the GPU kernel launched in `func` on the `stream`
   Status profile_kernel_no_cuda_graphs_(
     PerformanceResult& result,
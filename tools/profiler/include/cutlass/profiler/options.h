@@ -94,6 +94,11 @@ public:
     /// Total memory allocation on each device
     size_t maximum_capacity;
 
+    /// Peak math throughput (GFLOP/s) and DRAM bandwidth (GiB/s) overriding those derived for
+    /// the roofline. Zero if not overridden.
+    double peak_gflops{0};
+    double peak_bandwidth{0};
+
   private:
     /// SM Count
     /// Limits the number of SMs to use on each device 
@@ -178,6 +183,9 @@ public:
     /// List of providers used to verify each result
     ProviderVector providers;
 
+    /// Number of output tiles per batch checked by the device reference GEMM, 0 checks all
+    int sample_tiles;
+
     /// Indicates when to save the workspace
     SaveWorkspace save_workspace;
 
@@ -203,6 +211,9 @@ public:
     /// Number of workspaces to rotate through to avoid cache-resident working sets
     int workspace_count{0};
 
+    /// State of the L2 cache in which kernels are timed
+    CacheMode cache_mode{CacheMode::kCold};
+
     /// Number of iterations to warmup each kernel prior to profiling
     int warmup_iterations{10};
 
@@ -219,6 +230,24 @@ public:
     /// If true, profiling with cuda graph enabled.
     bool use_cuda_graphs{false};
 
+    /// If true, each timed launch is bracketed by events to report latency percentiles and jitter
+    bool latency_percentiles{false};
+
+    /// If true, SM clock, power, and temperature are sampled through NVML while kernels are timed
+    bool power_sampling{false};
+
+    /// Period between NVML samples (ms)
+    int power_sample_interval{10};
+
+    /// Minimum time to run each kernel before it is timed, extended until its batch times settle (ms)
+    int sustained_duration{0};
+
+    /// Number of streams on which copies of each kernel are launched concurrently
+    int concurrent_streams{1};
+
+    /// If true, each concurrent stream's kernel is limited to an equal share of the device's SMs
+    bool concurrent_sm_partition{false};
+
     /// If enabled, the CUTLASS profiler searches for the best-performing kernel 
     /// within the subset of kernels matching a kernel filter regex. The best 
     /// performance is determined by screening over a set of predefined M/N/K 
@@ -233,6 +262,23 @@ public:
     /// For now, it only supports legacy GEMM and blockscaled GEMM.
     bool enable_best_kernel_for_fixed_shape{false};
 
+    /// Relative margin from the fastest kernel profiled so far for the current problem beyond
+    /// which a candidate is pruned after a short probe. Zero disables pruning.
+    double pruning_margin{0};
+
+    /// Number of timed iterations in the probe deciding whether a candidate is pruned
+    int pruning_iterations{5};
+
+    /// If true, candidates are probed before verification and pruned kernels are not verified
+    bool pruning_skip_verification{false};
+
+    /// Number of shards the (operation x problem) space is distributed over
+    int shard_count{1};
+
+    /// Shard profiled by this process. If negative and shard_count > 1, the profiler launches
+    /// one process per shard, distributed over the selected devices, and merges their reports.
+    int shard_index{-1};
+
     /// Number of ms to sleep between profiling periods (ms)
     int sleep_duration{50};
 
@@ -263,6 +309,9 @@ public:
 
     /// Returns the index of a provider if its enabled
     size_t index(library::Provider provider) const;
+
+    /// Returns true if candidates are raced against the fastest kernel for each problem
+    bool pruning_enabled() const;
   };
 
   /// Options related to reporting
@@ -277,6 +326,9 @@ public:
     /// Path to a file containing junit xml results
     std::string junit_output_path;
 
+    /// Path to a JSON database of the fastest GEMM kernel per problem bucket, loadable by library::Handle
+    std::string kernel_selection_output_path;
+
     /// Sequence of tags to attach to each result
     std::vector<std::pair<std::string, std::string>> pivot_tags;
 
@@ -297,6 +349,12 @@ public:
     /// This is useful for determining which kernel is causing a run of the profiler to hang
     bool print_kernel_before_running;
 
+    /// If true, results are placed on the device roofline and classified as memory or compute bound
+    bool roofline;
+
+    /// If true, results report the register, shared memory and occupancy of their kernel
+    bool kernel_resources;
+
     //
     // Methods
     //
@@ -331,6 +389,19 @@ public:
     static void print_version(std::ostream &out);
   };
 
+  /// Problem taken from a production workload trace along with its observed frequency
+  struct WorkloadProblem {
+
+    /// Problem arguments (global command line arguments overridden by the trace row)
+    CommandLine cmdline;
+
+    /// Number of times the problem was issued by the traced workload
+    int64_t count{1};
+
+    /// Stream the traced workload issued the problem on
+    int stream{0};
+  };
+
 public:
 
   //
@@ -353,6 +424,17 @@ public:
   /// Vector of operation name substrings
   std::vector<std::string> excluded_operation_names;
 
+  /// Weighted problem histogram parsed from --workload-trace. Each problem is profiled against
+  /// every kernel passing the name filters, and per-kernel results are aggregated by frequency.
+  std::vector<WorkloadProblem> workload_problems;
+
+  /// Maximum number of kernels selected to cover the workload trace
+  int workload_kernel_set_size{1};
+
+  /// Chain of kernels parsed from --sequence-file, each step specified by its own command line
+  /// (operation kind, kernel name, and problem arguments). The chain is captured in one CUDA graph.
+  std::vector<CommandLine> sequence;
+
 
   //
   // Detailed configuration options
@@ -83,6 +83,14 @@ private:
   /// Collection of all results
   PerformanceResultVector concatenated_results_;
 
+  /// Results of the current problem, retained to compare cold-L2 and hot-L2 rankings
+  PerformanceResultVector problem_results_;
+
+private:
+
+  /// Reports kernels of the current problem whose cold-L2 and hot-L2 rankings differ
+  void report_cache_rank_flips_();
+
 public:
 
   PerformanceReport(Options const &options, std::vector<std::string> const &argument_names, library::OperationKind const &op_kind);
@@ -34,6 +34,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 #include "cutlass/cutlass.h"
@@ -89,6 +91,56 @@ struct PerformanceResult {
   /// Average runtime in ms per device
   std::vector<double> runtime_vector;
 
+  /// Average runtime in ms with operands resident in L2 (only measured with --cache-mode=both)
+  double runtime_hot;
+
+  /// Number of streams launching the kernel concurrently (--concurrent-streams)
+  int concurrent_streams;
+
+  /// Number of SMs made available to the kernel on each concurrent stream
+  int concurrent_sm_count;
+
+  /// Average wall-clock time in ms for every concurrent stream to complete one launch
+  double concurrent_runtime;
+
+  /// Largest 99th-percentile per-launch latency in ms among the concurrent streams
+  double concurrent_tail_latency;
+
+  /// Per-launch latency percentiles in ms (only measured with --latency-percentiles)
+  double latency_p50;
+  double latency_p90;
+  double latency_p99;
+  double latency_max;
+
+  /// Relative standard deviation of per-launch latencies (standard deviation divided by mean)
+  double latency_jitter;
+
+  /// Average SM clock (MHz) while the kernel was timed (only measured with --power-sampling)
+  double sm_clock_mhz;
+
+  /// Maximum SM clock supported by the device (MHz)
+  double sm_clock_max_mhz;
+
+  /// Average board power draw (W) while the kernel was timed
+  double power_watts;
+
+  /// Highest GPU temperature (C) observed while the kernel was timed
+  double temperature_c;
+
+  /// Peak math throughput of the operation's math pipe (GFLOP/s) and DRAM bandwidth (GiB/s) of
+  /// the device (only set with --roofline)
+  double peak_gflops;
+  double peak_gbytes;
+
+  /// True if the kernel was pruned after a short probe (--pruning-margin). The runtime is then
+  /// the probe's estimate rather than a full measurement.
+  bool pruned;
+
+  /// Register, local memory and shared memory usage and occupancy of the kernel (only set with
+  /// --kernel-resources)
+  bool has_kernel_resources;
+  library::KernelResourceUsage kernel_resources;
+
   //
   // Members
   //
@@ -102,7 +154,25 @@ struct PerformanceResult {
     status(Status::kInvalid),
     bytes(0), 
     flops(0), 
-    runtime(0)
+    runtime(0),
+    runtime_hot(0),
+    concurrent_streams(1),
+    concurrent_sm_count(0),
+    concurrent_runtime(0),
+    concurrent_tail_latency(0),
+    latency_p50(0),
+    latency_p90(0),
+    latency_p99(0),
+    latency_max(0),
+    latency_jitter(0),
+    sm_clock_mhz(0),
+    sm_clock_max_mhz(0),
+    power_watts(0),
+    temperature_c(0),
+    peak_gflops(0),
+    peak_gbytes(0),
+    pruned(false),
+    has_kernel_resources(false)
   { }
 
   // Copy constructor for deep copy
@@ -126,6 +196,105 @@ struct PerformanceResult {
     return double(bytes) / double(1 << 30) / runtime * 1000.0;
   }
 
+  /// Returns true if the hot-L2 runtime is valid
+  bool good_hot() const {
+    return runtime_hot > 0;
+  }
+
+  /// Math throughput with operands resident in L2 in units of GFLOP/s
+  double gflops_per_sec_hot() const {
+    return double(flops) / runtime_hot / 1.0e6;
+  }
+
+  /// Returns true if concurrent streams were profiled
+  bool good_concurrent() const {
+    return concurrent_streams > 1 && concurrent_runtime > 0;
+  }
+
+  /// Aggregate math throughput of all concurrent streams in units of GFLOP/s
+  double concurrent_gflops_per_sec() const {
+    return double(flops) * double(concurrent_streams) / concurrent_runtime / 1.0e6;
+  }
+
+  /// Returns true if per-launch latencies were measured
+  bool good_latency() const {
+    return latency_max > 0;
+  }
+
+  /// Returns true if clock and power telemetry was collected
+  bool good_power() const {
+    return good() && power_watts > 0 && sm_clock_mhz > 0;
+  }
+
+  /// Energy efficiency in units of TFLOP/s per watt
+  double tflops_per_watt() const {
+    return gflops_per_sec() / 1.0e3 / power_watts;
+  }
+
+  /// Math throughput scaled to the maximum SM clock in units of GFLOP/s
+  double clock_normalized_gflops_per_sec() const {
+    return gflops_per_sec() * sm_clock_max_mhz / sm_clock_mhz;
+  }
+
+  /// Returns true if the result can be placed on the roofline
+  bool good_roofline() const {
+    return good() && bytes > 0 && peak_gflops > 0 && peak_gbytes > 0;
+  }
+
+  /// Arithmetic intensity in units of FLOP/byte
+  double arithmetic_intensity() const {
+    return double(flops) / double(bytes);
+  }
+
+  /// Throughput attainable at the result's arithmetic intensity in units of GFLOP/s
+  double roofline_gflops_per_sec() const {
+    return std::min(peak_gflops, arithmetic_intensity() * peak_gbytes * double(1 << 30) / 1.0e9);
+  }
+
+  /// Returns true if DRAM bandwidth rather than math throughput bounds the roofline
+  bool memory_bound() const {
+    return roofline_gflops_per_sec() < peak_gflops;
+  }
+
+  /// Fraction of the attainable throughput achieved
+  double roofline_fraction() const {
+    return gflops_per_sec() / roofline_gflops_per_sec();
+  }
+
+  /// Returns the nearest-rank percentile (fraction in (0, 1]) of a sorted, non-empty sample vector
+  static double percentile(std::vector<double> const &sorted_samples, double fraction) {
+    size_t rank = size_t(std::ceil(fraction * double(sorted_samples.size())));
+    return sorted_samples[std::min(sorted_samples.size(), std::max(rank, size_t(1))) - 1];
+  }
+
+  /// Computes latency percentiles and jitter from per-launch latencies in ms
+  void set_latencies(std::vector<double> latencies) {
+    if (latencies.empty()) {
+      return;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    latency_p50 = percentile(latencies, 0.50);
+    latency_p90 = percentile(latencies, 0.90);
+    latency_p99 = percentile(latencies, 0.99);
+    latency_max = latencies.back();
+
+    double mean = 0;
+    for (double latency : latencies) {
+      mean += latency;
+    }
+    mean /= double(latencies.size());
+
+    double variance = 0;
+    for (double latency : latencies) {
+      variance += (latency - mean) * (latency - mean);
+    }
+    variance /= double(latencies.size());
+
+    latency_jitter = (mean > 0 ? std::sqrt(variance) / mean : 0);
+  }
+
 };
 
 using PerformanceResultVector = std::vector<PerformanceResult>;
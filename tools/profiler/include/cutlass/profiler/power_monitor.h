@@ -0,0 +1,124 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Samples SM clock, power, and temperature through NVML while kernels are profiled
+*/
+
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Average device telemetry over a sampling window
+struct PowerSample {
+
+  /// Number of samples taken on each device
+  int samples{0};
+
+  /// Average SM clock (MHz)
+  double sm_clock_mhz{0};
+
+  /// Maximum SM clock supported by the device (MHz)
+  double sm_clock_max_mhz{0};
+
+  /// Average board power draw (W)
+  double power_watts{0};
+
+  /// Highest GPU temperature observed (C)
+  double temperature_c{0};
+
+  /// Returns true if telemetry was collected
+  bool good() const {
+    return samples > 0;
+  }
+};
+
+/// Samples device telemetry from a background thread between start() and stop(). If the profiler
+/// was built without NVML, or NVML fails to initialize, stop() returns an empty sample.
+class PowerMonitor {
+public:
+
+  /// Returns true if the profiler was built with NVML support
+  static bool available();
+
+  /// Monitors the given CUDA device ordinals
+  PowerMonitor(std::vector<int> const &devices, int interval_ms);
+
+  PowerMonitor(PowerMonitor const &) = delete;
+  PowerMonitor &operator=(PowerMonitor const &) = delete;
+
+  ~PowerMonitor();
+
+  /// Begins sampling
+  void start();
+
+  /// Ends sampling and returns telemetry averaged over the window and over devices
+  PowerSample stop();
+
+private:
+
+  /// Samples every monitored device once
+  void sample_();
+
+  /// Opaque NVML device handles
+  std::vector<void *> handles_;
+
+  /// Average over devices of the maximum SM clock (MHz)
+  double sm_clock_max_mhz_{0};
+
+  /// Sampling period (ms)
+  int interval_ms_;
+
+  /// Sampling thread
+  std::thread thread_;
+  std::atomic<bool> running_{false};
+
+  /// Running sums over the sampling window
+  std::mutex mutex_;
+  int samples_{0};
+  double sm_clock_sum_{0};
+  double power_sum_{0};
+  double temperature_max_{0};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
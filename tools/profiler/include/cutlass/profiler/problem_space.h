@@ -964,6 +964,16 @@ bool arg_as_RasterOrder(
   ProblemSpace const &problem_space, 
   ProblemSpace::Problem const &problem);
 
+/// Lexically casts an argument to a DecompositionMode if it is defined. Returns true if not null.
+bool arg_as_DecompositionMode(library::DecompositionMode &decomposition_mode, KernelArgument::Value const *value_ptr);
+
+/// Lexically casts an argument to a DecompositionMode if it is defined. Returns true if not null.
+bool arg_as_DecompositionMode(
+  library::DecompositionMode &decomposition_mode,
+  char const *name,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem);
+
 /// Lexically casts an argument to an int64 if it is defined. Returns true if not null.
 bool arg_as_ProviderID(library::Provider &provider, KernelArgument::Value const *value_ptr);
 
@@ -1031,6 +1041,18 @@ bool iterator_algorithm_satisfies(
   ProblemSpace const &problem_space, 
   ProblemSpace::Problem const &problem);
 
+/// Returns true if an attention mask satisfies the value
+bool attention_mask_satisfies(
+  library::AttentionMask const &mask,
+  EnumeratedTypeArgument::EnumeratedTypeValue const *value_ptr);
+
+/// Returns true if an attention mask satisfies the value
+bool attention_mask_satisfies(
+  library::AttentionMask const &mask,
+  char const *name,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem);
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace profiler
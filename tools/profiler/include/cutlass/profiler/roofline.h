@@ -0,0 +1,89 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Roofline model bounding profiled operations by device peak math and memory throughput
+*/
+
+#pragma once
+
+#include "cutlass/library/library.h"
+
+#include "options.h"
+#include "performance_result.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Peak math throughput and DRAM bandwidth available to an operation on the profiled device
+struct Roofline {
+
+  /// Peak dense math throughput of the operation's math pipe (GFLOP/s)
+  double peak_gflops{0};
+
+  /// Peak DRAM bandwidth (GiB/s)
+  double peak_gbytes{0};
+
+  //
+  // Methods
+  //
+
+  Roofline() = default;
+
+  /// Derives peaks for the first selected device unless overridden by --peak-gflops and
+  /// --peak-bandwidth. Peaks are zero if they are not known for the device or operation.
+  Roofline(Options const &options, library::OperationDescription const &operation_desc);
+
+  /// Returns true if both peaks are known
+  bool good() const {
+    return peak_gflops > 0 && peak_gbytes > 0;
+  }
+
+  /// Records the peaks in a result
+  void apply(PerformanceResult &result) const;
+
+  /// Returns the element type whose math pipe executes the operation
+  static library::NumericTypeID math_element(library::OperationDescription const &operation_desc);
+
+  /// Returns the dense math throughput of one SM per clock (FLOP), or zero if not known
+  static double peak_flops_per_clock(
+    int compute_capability,
+    library::OpcodeClassID opcode_class,
+    library::NumericTypeID element);
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
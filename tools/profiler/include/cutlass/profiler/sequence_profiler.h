@@ -0,0 +1,123 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Profiles a chain of heterogeneous kernels captured in one CUDA graph
+*/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "cutlass/library/library.h"
+
+#include "options.h"
+#include "operation_profiler.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Profiles the kernel sequence given by --sequence-file. Each step is configured and timed by its
+/// own operation profiler, after which the whole chain is launched back to back on one stream and
+/// as one CUDA graph, measuring the launch overhead a real workload would see. Steps do not
+/// consume each other's outputs; each has its own operands.
+class SequenceProfiler {
+public:
+
+  /// Creates a fresh operation profiler for each kind
+  using ProfilerFactory = std::function<OperationProfilerVector()>;
+
+  SequenceProfiler(Options const &options, ProfilerFactory const &make_profilers);
+
+  ~SequenceProfiler();
+
+  /// Profiles the sequence and returns zero on success
+  int operator()();
+
+private:
+
+  /// State of one step of the sequence
+  struct Step {
+    std::unique_ptr<OperationProfiler> profiler;
+    library::Operation const *operation{nullptr};
+    std::unique_ptr<ProblemSpace> problem_space;
+    ProblemSpace::Problem problem;
+    std::unique_ptr<DeviceContext> device_context;
+    std::unique_ptr<PerformanceReport> report;
+    double runtime{0};
+  };
+
+  /// Resolves the operation profiler, kernel, and problem of each step
+  Status initialize_steps_();
+
+  /// Configures and profiles a step, then continues with the next step
+  Status profile_step_(size_t step_idx);
+
+  /// Times the captured chain launched on a stream and as a CUDA graph
+  Status profile_sequence_();
+
+  /// Prints a summary of the sequence
+  std::ostream &print_summary_(std::ostream &out) const;
+
+  /// Writes the sequence results as CSV
+  std::ostream &print_csv_(std::ostream &out) const;
+
+private:
+
+  /// Global options
+  Options const &options_;
+
+  /// Options used to configure steps. Per-step reports are not written.
+  Options step_options_;
+
+  ProfilerFactory make_profilers_;
+
+  std::vector<Step> steps_;
+
+  SequenceCapture capture_;
+
+  /// Average runtime of the chain (ms) launched on a stream and as a CUDA graph
+  double stream_runtime_{0};
+  double graph_runtime_{0};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
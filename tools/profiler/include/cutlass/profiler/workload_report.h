@@ -0,0 +1,129 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Aggregates profiling results over a frequency-weighted workload trace
+*/
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+
+// CUTLASS Profiler includes
+#include "options.h"
+#include "performance_result.h"
+
+// CUTLASS Library includes
+#include "cutlass/library/library.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Accumulates the runtime of each kernel over all problems of a workload trace, weighting each
+/// problem by the number of times the traced workload issued it.
+class WorkloadReport {
+public:
+
+  /// Key identifying a kernel: (provider, operation name)
+  using KernelKey = std::pair<library::Provider, std::string>;
+
+  /// Aggregate statistics for one kernel
+  struct KernelSummary {
+
+    /// Sum of count * runtime over all covered problems (ms)
+    double total_runtime{0};
+
+    /// Frequency-weighted runtime per stream (ms)
+    std::map<int, double> stream_runtime;
+
+    /// Number of trace problems the kernel could run
+    size_t problems_covered{0};
+
+    /// Sum of counts of covered trace problems
+    int64_t count_covered{0};
+
+    /// Critical-path time assuming the traced streams execute concurrently
+    double critical_stream_runtime() const;
+  };
+
+  /// Best runtime observed for each trace problem index (ms)
+  using ProblemRuntimeMap = std::map<size_t, double>;
+
+private:
+
+  /// Reference to options
+  Options const &options_;
+
+  /// Operation kind
+  library::OperationKind op_kind_;
+
+  /// Per-kernel runtimes of each trace problem
+  std::map<KernelKey, ProblemRuntimeMap> kernels_;
+
+  /// Sum of counts over all problems of the trace
+  int64_t total_count_;
+
+private:
+
+  /// Greedily selects up to `set_size` kernels minimizing the aggregate workload time, where
+  /// each problem is executed by the fastest selected kernel.
+  std::vector<KernelKey> select_kernel_set_(int set_size, double &total_runtime) const;
+
+  /// Computes the frequency-weighted aggregates of one kernel
+  KernelSummary summarize_(ProblemRuntimeMap const &runtimes) const;
+
+public:
+
+  WorkloadReport(Options const &options, library::OperationKind op_kind);
+
+  /// Records the results obtained for trace problem `problem_index`
+  void append_results(size_t problem_index, PerformanceResultVector const &results);
+
+  /// True if no result has been recorded
+  bool empty() const { return kernels_.empty(); }
+
+  /// Prints a ranking of kernels by frequency-weighted runtime
+  std::ostream & print_summary(std::ostream &out) const;
+
+  /// Prints per-kernel aggregates in CSV form
+  std::ostream & print_csv(std::ostream &out) const;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,696 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Execution environment
+*/
+
+#include <iostream>
+#include <stdexcept>
+#include <iomanip>
+#include <ios>
+#include <numeric>
+#include <random>
+
+#include "cutlass/core_io.h"
+
+#include "cutlass/profiler/attention_operation_profiler.h"
+#include "cutlass/profiler/gpu_timer.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Ctor
+AttentionOperationProfiler::AttentionOperationProfiler(Options const &options):
+  OperationProfiler(
+    options,
+    library::OperationKind::kAttention,
+    {
+      {ArgumentTypeID::kTensor, {"Q"}, "Tensor storing the Q operand"},
+      {ArgumentTypeID::kTensor, {"K"}, "Tensor storing the K and V operands"},
+      {ArgumentTypeID::kTensor, {"O"}, "Tensor storing the O operand"},
+      {ArgumentTypeID::kEnumerated, {"mask"}, "Mask applied to the scores (none, causal, causal_br)"},
+      {ArgumentTypeID::kInteger, {"batch_count", "batch-count"}, "Number of sequences in the batch"},
+      {ArgumentTypeID::kInteger, {"h", "heads"}, "Number of query heads"},
+      {ArgumentTypeID::kInteger, {"h_k", "heads_kv"}, "Number of key/value heads (defaults to h)"},
+      {ArgumentTypeID::kInteger, {"q", "seqlen_q"}, "Query sequence length"},
+      {ArgumentTypeID::kInteger, {"k", "seqlen_kv"}, "Key/value sequence length (defaults to q)"},
+      {ArgumentTypeID::kInteger, {"d", "head_dim"}, "Head dimension (defaults to the kernel's)"},
+      {ArgumentTypeID::kInteger, {"page_size", "page-size"}, "Tokens per KV cache page of paged kernels"},
+    },
+    { library::Provider::kReferenceDevice }
+  ) {
+  description_ = "      Fused multi-head attention. O = softmax(scale * Q*K^T + mask) * V";
+}
+
+/// Destructor
+AttentionOperationProfiler::~AttentionOperationProfiler() {
+
+}
+
+/// Prints usage statement for the math function
+void AttentionOperationProfiler::print_usage(std::ostream &out) const {
+  out << "Attention" << "\n\n";
+
+  OperationProfiler::print_usage(out);
+}
+
+/// Prints examples
+void AttentionOperationProfiler::print_examples(std::ostream &out) const {
+
+  out << "\nExamples:\n\n"
+    << "Profile a particular problem size:\n"
+    << "  $ cutlass_profiler --operation=attention --batch_count=4 --h=16 --q=4096 --d=128\n\n"
+
+    << "Profile causal prefill with grouped query attention:\n"
+    << "  $ cutlass_profiler --operation=attention --mask=causal --h=32 --h_k=8 --q=8192\n\n"
+
+    << "Profile decode-like chunks against a longer paged KV cache:\n"
+    << "  $ cutlass_profiler --operation=attention --mask=causal_br --q=128 --k=16384 --page_size=128\n\n"
+
+    << "Schmoo over sequence length:\n"
+    << "  $ cutlass_profiler --operation=attention --mask=none,causal --q=1024:16384:1024\n\n"
+
+    << "Run when Q and K/V are bf16:\n"
+    << "  $ cutlass_profiler --operation=attention --Q=bf16:row --K=bf16:row\n\n";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+Status AttentionOperationProfiler::AttentionProblem::parse(
+  library::AttentionDescription const &operation_desc,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (!arg_as_int(this->batch_count, "batch_count", problem_space, problem)) {
+    // default value
+    this->batch_count = 1;
+  }
+
+  if (!arg_as_int(this->heads, "h", problem_space, problem)) {
+    // default value
+    this->heads = 16;
+  }
+
+  if (!arg_as_int(this->heads_kv, "h_k", problem_space, problem)) {
+    // default value
+    this->heads_kv = this->heads;
+  }
+
+  if (!arg_as_int(this->seqlen_q, "q", problem_space, problem)) {
+    // default value
+    this->seqlen_q = 1024;
+  }
+
+  if (!arg_as_int(this->seqlen_kv, "k", problem_space, problem)) {
+    // default value
+    this->seqlen_kv = this->seqlen_q;
+  }
+
+  if (!arg_as_int(this->head_dim, "d", problem_space, problem)) {
+    // default value
+    this->head_dim = operation_desc.head_dim;
+  }
+
+  if (this->batch_count <= 0 || this->heads <= 0 || this->heads_kv <= 0 ||
+      this->seqlen_q <= 0 || this->seqlen_kv <= 0 || this->heads % this->heads_kv != 0) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  // Kernels are compiled for a single head dimension
+  if (this->head_dim != operation_desc.head_dim) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!attention_mask_satisfies(operation_desc.mask, "mask", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  this->mask = operation_desc.mask;
+
+  if (!tensor_description_satisfies(operation_desc.Q, "Q", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.K, "K", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  if (!tensor_description_satisfies(operation_desc.O, "O", problem_space, problem)) {
+    return Status::kErrorInvalidProblem;
+  }
+
+  bool page_size_set = arg_as_int(this->page_size, "page_size", problem_space, problem);
+
+  if (operation_desc.paged) {
+    if (!page_size_set) {
+      // default value: one KV tile per page
+      this->page_size = operation_desc.tile_description.threadblock_shape.n();
+    }
+    if (this->page_size <= 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    this->page_count = this->batch_count * ((this->seqlen_kv + this->page_size - 1) / this->page_size);
+  }
+  else {
+    if (page_size_set && this->page_size > 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    this->page_size = 0;
+    this->page_count = 0;
+  }
+
+  return Status::kSuccess;
+}
+
+/// Number of rows of the packed K and V tensors
+int64_t AttentionOperationProfiler::AttentionProblem::kv_rows(
+  library::AttentionDescription const &operation_desc) const {
+
+  return (operation_desc.paged ? page_count * page_size : batch_count * seqlen_kv) * heads_kv;
+}
+
+/// Number of (query, key) pairs left visible by the mask, summed over one head
+int64_t AttentionOperationProfiler::AttentionProblem::visible_pairs() const {
+
+  if (mask == library::AttentionMask::kNone) {
+    return seqlen_q * seqlen_kv;
+  }
+
+  // Top-left causal masks query i to keys [0, i]; bottom-right aligns the last query with
+  // the last key and masks query i to keys [0, i + seqlen_kv - seqlen_q]
+  int64_t offset = (mask == library::AttentionMask::kCausalBottomRight) ? seqlen_kv - seqlen_q : 0;
+
+  int64_t pairs = 0;
+  for (int64_t i = 0; i < seqlen_q; ++i) {
+    pairs += std::max<int64_t>(0, std::min<int64_t>(seqlen_kv, i + offset + 1));
+  }
+
+  return pairs;
+}
+
+/// Total number of bytes loaded
+int64_t AttentionOperationProfiler::AttentionProblem::bytes(
+  library::AttentionDescription const &operation_desc) const {
+
+  // Q and O are touched once per query row; K and V once per key row
+  int64_t bytes =
+    int64_t(library::sizeof_bits(operation_desc.Q.element) * head_dim / 8) * batch_count * seqlen_q * heads +
+    int64_t(library::sizeof_bits(operation_desc.K.element) * head_dim / 8) * batch_count * seqlen_kv * heads_kv * 2 +
+    int64_t(library::sizeof_bits(operation_desc.O.element) * head_dim / 8) * batch_count * seqlen_q * heads;
+
+  return bytes;
+}
+
+/// Total number of flops computed
+int64_t AttentionOperationProfiler::AttentionProblem::flops(
+  library::AttentionDescription const &operation_desc) const {
+
+  // FLOPs = 2 * D [Q*K^T] + 2 * D [P*V] per visible (query, key) pair. Masked-out pairs are
+  // not counted, so causal problems report the work a tile-skipping kernel actually has to do.
+  return 4 * batch_count * heads * head_dim * visible_pairs();
+}
+
+/// Initializes a performance result
+void AttentionOperationProfiler::AttentionProblem::initialize_result(
+  PerformanceResult &result,
+  library::AttentionDescription const &operation_desc,
+  ProblemSpace const &problem_space) {
+
+  result.arguments.resize(problem_space.rank());
+
+  set_argument(result, "Q", problem_space,
+    std::string(library::to_string(operation_desc.Q.element)) + ":" + library::to_string(operation_desc.Q.layout));
+
+  set_argument(result, "K", problem_space,
+    std::string(library::to_string(operation_desc.K.element)) + ":" + library::to_string(operation_desc.K.layout));
+
+  set_argument(result, "O", problem_space,
+    std::string(library::to_string(operation_desc.O.element)) + ":" + library::to_string(operation_desc.O.layout));
+
+  set_argument(result, "mask", problem_space, library::to_string(operation_desc.mask));
+
+  set_argument(result, "batch_count", problem_space, batch_count);
+  set_argument(result, "h", problem_space, heads);
+  set_argument(result, "h_k", problem_space, heads_kv);
+  set_argument(result, "q", problem_space, seqlen_q);
+  set_argument(result, "k", problem_space, seqlen_kv);
+  set_argument(result, "d", problem_space, head_dim);
+  set_argument(result, "page_size", problem_space, page_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Extracts the problem dimensions
+Status AttentionOperationProfiler::initialize_configuration(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  library::AttentionDescription const &operation_desc =
+    static_cast<library::AttentionDescription const &>(operation->description());
+
+  Status status = problem_.parse(operation_desc, problem_space, problem);
+
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  attention_workspace_.configuration.batch_count = int(problem_.batch_count);
+  attention_workspace_.configuration.num_heads_q = int(problem_.heads);
+  attention_workspace_.configuration.num_heads_kv = int(problem_.heads_kv);
+  attention_workspace_.configuration.seqlen_q = int(problem_.seqlen_q);
+  attention_workspace_.configuration.seqlen_kv = int(problem_.seqlen_kv);
+  attention_workspace_.configuration.head_dim = int(problem_.head_dim);
+  attention_workspace_.configuration.page_size = int(problem_.page_size);
+  attention_workspace_.configuration.page_count = int(problem_.page_count);
+
+  attention_workspace_.arguments = library::AttentionArguments();
+  attention_workspace_.arguments.sm_count = options.device.get_sm_count(0);
+
+  initialize_result_(this->model_result_, options, operation_desc, problem_space);
+
+  return operation->can_implement(&attention_workspace_.configuration, &attention_workspace_.arguments);
+}
+
+/// Initializes the performance result
+void AttentionOperationProfiler::initialize_result_(
+  PerformanceResult &result,
+  Options const &options,
+  library::AttentionDescription const &operation_desc,
+  ProblemSpace const &problem_space) {
+
+  result.provider = library::Provider::kCUTLASS;
+  result.disposition = Disposition::kNotRun;
+  result.status = Status::kSuccess;
+  result.operation_name = operation_desc.name;
+
+  problem_.initialize_result(result, operation_desc, problem_space);
+
+  OperationProfiler::initialize_result_(result, operation_desc, problem_space);
+
+  result.bytes = problem_.bytes(operation_desc);
+  result.flops = problem_.flops(operation_desc);
+
+  result.runtime = 0;
+}
+
+/// Initializes workspace
+Status AttentionOperationProfiler::initialize_workspace(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (options.device.devices.size() != 1) {
+    throw std::runtime_error("This operation profiler only supports a single "
+                             "device.");
+  }
+
+  cudaError_t result;
+  result = cudaSetDevice(options.device.device_id(0));
+  if (result != cudaSuccess) {
+    throw std::runtime_error("cudaSetDevice() failed.");
+  }
+
+  library::AttentionDescription const &operation_desc =
+    static_cast<library::AttentionDescription const &>(operation->description());
+
+  attention_workspace_.PageTable = nullptr;
+
+  if (options.execution_mode != ExecutionMode::kDryRun) {
+    int seed_shift = 0;
+    int q_rows = int(problem_.batch_count * problem_.seqlen_q * problem_.heads);
+    int kv_rows = int(problem_.kv_rows(operation_desc));
+    int d = int(problem_.head_dim);
+
+    attention_workspace_.Q = device_context.allocate_and_initialize_tensor(
+      options,
+      "Q",
+      operation_desc.Q.element,
+      operation_desc.Q.layout,
+      {q_rows, d},
+      {int64_t(d)},
+      1, // batch_count
+      seed_shift++,
+      0 // device_index
+    );
+
+    attention_workspace_.K = device_context.allocate_and_initialize_tensor(
+      options,
+      "K",
+      operation_desc.K.element,
+      operation_desc.K.layout,
+      {kv_rows, d},
+      {int64_t(d)},
+      1, // batch_count
+      seed_shift++,
+      0 // device_index
+    );
+
+    attention_workspace_.V = device_context.allocate_and_initialize_tensor(
+      options,
+      "V",
+      operation_desc.V.element,
+      operation_desc.V.layout,
+      {kv_rows, d},
+      {int64_t(d)},
+      1, // batch_count
+      seed_shift++,
+      0 // device_index
+    );
+
+    attention_workspace_.Computed = device_context.allocate_tensor(
+      options,
+      "O",
+      operation_desc.O.element,
+      operation_desc.O.layout,
+      {q_rows, d},
+      {int64_t(d)},
+      1, // batch_count
+      0 // device_index
+    );
+
+    attention_workspace_.Reference = device_context.allocate_tensor(
+      options,
+      "Reference",
+      operation_desc.O.element,
+      operation_desc.O.layout,
+      {q_rows, d},
+      {int64_t(d)},
+      1, // batch_count
+      0 // device_index
+    );
+
+    if (operation_desc.paged) {
+
+      // Scatter the pages of every sequence across the cache so the kernel cannot rely on
+      // logically adjacent pages being physically adjacent
+      std::vector<int> page_table(size_t(problem_.page_count));
+      std::iota(page_table.begin(), page_table.end(), 0);
+      std::shuffle(page_table.begin(), page_table.end(), std::mt19937(options.initialization.seed));
+
+      attention_workspace_.PageTable = device_context.allocate_block(
+        options,
+        "PageTable",
+        library::NumericTypeID::kS32,
+        page_table.size(),
+        0 // device_index
+      );
+
+      attention_workspace_.PageTable->copy_from_host(page_table.data());
+    }
+  }
+
+  //
+  // Initialize the CUTLASS operation
+  //
+  Status status = Status::kSuccess;
+
+  if (options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+    if (options.execution_mode != ExecutionMode::kDryRun) {
+
+      uint64_t workspace_size = operation->get_host_workspace_size(&attention_workspace_.configuration);
+      attention_workspace_.host_workspace.resize(workspace_size, 0);
+
+      workspace_size = operation->get_device_workspace_size(&attention_workspace_.configuration);
+      attention_workspace_.device_workspace.reset(library::NumericTypeID::kU8, workspace_size);
+
+      status = operation->initialize(
+        &attention_workspace_.configuration,
+        attention_workspace_.host_workspace.data(),
+        attention_workspace_.device_workspace.data());
+    }
+
+    //
+    // If CUTLASS is enabled, generate a result for it
+    //
+    results_.push_back(model_result_);
+    results_.back().provider = library::Provider::kCUTLASS;
+    results_.back().op_kind = library::OperationKind::kAttention;
+    results_.back().disposition = Disposition::kNotRun;
+
+    for(auto provider : verification_providers_) {
+      results_.back().verification_map[provider] = Disposition::kNotRun;
+    }
+  }
+
+  return status;
+}
+
+/// Binds the workspace allocations to the operation arguments
+void AttentionOperationProfiler::set_arguments_(DeviceAllocation *output) {
+
+  attention_workspace_.arguments.Q = attention_workspace_.Q->data();
+  attention_workspace_.arguments.K = attention_workspace_.K->data();
+  attention_workspace_.arguments.V = attention_workspace_.V->data();
+  attention_workspace_.arguments.O = output->data();
+  attention_workspace_.arguments.page_table = attention_workspace_.PageTable ?
+    static_cast<int const *>(attention_workspace_.PageTable->data()) : nullptr;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Verifies CUTLASS against references
+bool AttentionOperationProfiler::verify_cutlass(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (!options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+    return true;
+  }
+
+  if (options.execution_mode == ExecutionMode::kDryRun) {
+    return true;
+  }
+
+  set_arguments_(attention_workspace_.Computed);
+
+  //
+  // Run the CUTLASS operation
+  //
+
+  results_.back().status = operation->run(
+    &attention_workspace_.arguments,
+    attention_workspace_.host_workspace.data(),
+    attention_workspace_.device_workspace.data());
+
+  if (results_.back().status != Status::kSuccess) {
+    results_.back().disposition = Disposition::kFailed;
+    return false;
+  }
+
+  cudaError_t result = cudaDeviceSynchronize();
+  if (result != cudaSuccess) {
+    results_.back().disposition = Disposition::kFailed;
+    return false;
+  }
+
+  // CUTLASS op ran the but not yet verified against any verification provider
+  results_.back().disposition = Disposition::kNotVerified;
+
+  //
+  // Run verification providers
+  //
+
+  if (options.verification.enabled) {
+
+    // Run verification device reference
+    if (options.verification.provider_enabled(library::Provider::kReferenceDevice)) {
+
+      verify_with_device_reference_(
+        options,
+        report,
+        device_context,
+        operation,
+        problem_space,
+        problem);
+    }
+
+    // Update disposition to worst case verification outcome among all
+    // verification providers which are supported
+    bool is_any_verification_run_passed = false;
+    for(auto &m : results_.back().verification_map) {
+      if(m.second == Disposition::kFailed || m.second == Disposition::kIncorrect) {
+        results_.back().disposition = m.second;
+        return true;
+      }
+      if(!is_any_verification_run_passed && m.second == Disposition::kPassed) {
+        is_any_verification_run_passed = true;
+      }
+    }
+
+    if(is_any_verification_run_passed) {
+      results_.back().disposition = Disposition::kPassed;
+    }
+  }
+
+  // Return true means continue profiling
+  return true;
+}
+
+/// Verifies CUTLASS against the device reference
+bool AttentionOperationProfiler::verify_with_device_reference_(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  Status status;
+
+  //
+  // Find device reference operation using attention functional description key
+  //
+  auto &attention_desc = static_cast<library::AttentionDescription const &>(operation->description());
+
+  library::AttentionFunctionalKey attention_key(
+    library::Provider::kReferenceDevice,
+    attention_desc.Q.element,
+    attention_desc.K.element,
+    attention_desc.O.element,
+    attention_desc.tile_description.math_instruction.element_accumulator,
+    attention_desc.head_dim,
+    attention_desc.mask,
+    attention_desc.paged);
+
+  auto operators_it = library::Singleton::get().operation_table.attention_operations.find(attention_key);
+
+  if (operators_it == library::Singleton::get().operation_table.attention_operations.end() ||
+      operators_it->second.empty() || operators_it->second.begin()->second.empty()) {
+
+    results_.back().verification_map[library::Provider::kReferenceDevice] = Disposition::kNotRun;
+
+    return true;
+  }
+
+  // device reference has only one instance per functional key
+  library::Operation const *reference_op = operators_it->second.begin()->second[0];
+
+  //
+  // Initialize device reference operation
+  //
+  std::vector<uint8_t> host_workspace_reference_op;
+
+  uint64_t workspace_size = reference_op->get_host_workspace_size(&attention_workspace_.configuration);
+  host_workspace_reference_op.resize(workspace_size, 0);
+
+  reference_op->initialize(
+    &attention_workspace_.configuration,
+    host_workspace_reference_op.data());
+
+  set_arguments_(attention_workspace_.Reference);
+
+  //
+  // Run device reference operation
+  //
+  status = reference_op->run(
+    &attention_workspace_.arguments,
+    host_workspace_reference_op.data());
+
+  // Handle errors
+  if (status != Status::kSuccess) {
+    results_.back().verification_map[library::Provider::kReferenceDevice] = Disposition::kNotVerified;
+    return true;
+  }
+
+  //
+  // Verify results
+  //
+  results_.back().verification_map[library::Provider::kReferenceDevice] = compare_tensors(
+    options,
+    *attention_workspace_.Computed,
+    *attention_workspace_.Reference
+  );
+
+  // Save workspace if incorrect
+  if (options.verification.save_workspace == SaveWorkspace::kIncorrect &&
+    results_.back().verification_map[library::Provider::kReferenceDevice] == Disposition::kIncorrect) {
+
+    save_workspace(
+      device_context,
+      options,
+      attention_desc,
+      library::Provider::kCUTLASS,
+      library::Provider::kReferenceDevice);
+  }
+
+  // Return true means continue profiling
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Measures performance results
+bool AttentionOperationProfiler::profile(
+  Options const &options,
+  PerformanceReport &report,
+  DeviceContext &device_context,
+  library::Operation const *operation,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  if (options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+    set_arguments_(attention_workspace_.Computed);
+
+    results_.back().status = profile_cutlass_(
+      results_.back(),
+      options,
+      operation,
+      &attention_workspace_.arguments,
+      attention_workspace_.host_workspace.data(),
+      attention_workspace_.device_workspace.data()
+    );
+  }
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
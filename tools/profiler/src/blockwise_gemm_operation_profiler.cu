@@ -83,7 +83,7 @@ BlockwiseGemmOperationProfiler::BlockwiseGemmOperationProfiler(Options const &op
       {ArgumentTypeID::kInteger, {"batch_count", "batch-count"}, "Number of GEMMs computed in one batch"},
       {ArgumentTypeID::kEnumerated, {"runtime_input_datatype_a", "runtime-input-datatype::a"}, "Runtime datatype (e4m3, e5m2, e3m2, e2m3, e2m1)"}, 
       {ArgumentTypeID::kEnumerated, {"runtime_input_datatype_b", "runtime-input-datatype::b"}, "Runtime datatype (e4m3, e5m2, e3m2, e2m3, e2m1)"}, 
-      {ArgumentTypeID::kEnumerated, {"raster_order", "raster-order"}, "Raster order (heuristic, along_n, along_m)"},
+      {ArgumentTypeID::kEnumerated, {"raster_order", "raster-order"}, "Raster order (heuristic, along_n, along_m, l2_aware, morton)"},
       {ArgumentTypeID::kInteger, {"swizzle_size", "swizzle-size"}, "Size to swizzle"},
       {ArgumentTypeID::kEnumerated, {"use_pdl", "use_pdl"}, "Use PDL (true, false)"},
     },
@@ -1497,7 +1497,7 @@ Status BlockwiseGemmOperationProfiler::profile_cutlass_(
     }
   }
 
-  auto func = [&](cudaStream_t, int iteration) {
+  auto func = [&](cudaStream_t stream, int iteration) {
     // Iterate over copies of the problem in memory
     int problem_idx = (iteration % gemm_workspace_.problem_count) * problem_.batch_count;
 
@@ -1518,7 +1518,7 @@ Status BlockwiseGemmOperationProfiler::profile_cutlass_(
       arguments,
       host_workspace,
       device_workspace,
-      nullptr);
+      stream);
 
     if (status != Status::kSuccess) {
       return status;
@@ -1530,7 +1530,7 @@ Status BlockwiseGemmOperationProfiler::profile_cutlass_(
         &gemm_workspace_.reduction_arguments,
         gemm_workspace_.reduction_host_workspace.data(),
         nullptr,
-        nullptr);
+        stream);
 
       if (status != Status::kSuccess) {
         return status;
@@ -1292,7 +1292,7 @@ Status Conv2dOperationProfiler::profile_cutlass_(
     }
   }
 
-  auto func = [&](cudaStream_t, int iteration) {
+  auto func = [&](cudaStream_t stream, int iteration) {
     // Setup rotating workspace
     int problem_idx = iteration % conv_workspace_.problem_count;
 
@@ -1315,7 +1315,8 @@ Status Conv2dOperationProfiler::profile_cutlass_(
     Status status = underlying_operation->run(
       arguments,
       host_workspace,
-      device_workspace);
+      device_workspace,
+      stream);
 
     // Run parallel reduction kernel for parallel split_k_mode
     if (conv_workspace_.configuration.split_k_mode == conv::SplitKMode::kParallel) {
@@ -1323,7 +1324,8 @@ Status Conv2dOperationProfiler::profile_cutlass_(
       status = reduction_op_->run(
         &conv_workspace_.reduction_arguments,
         conv_workspace_.reduction_host_workspace.data(),
-        nullptr);
+        nullptr,
+        stream);
     }
 
     if (status != Status::kSuccess) {
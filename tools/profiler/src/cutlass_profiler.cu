@@ -32,10 +32,20 @@
    \brief Execution environment
 */
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 // Profiler includes
+#include "cutlass/profiler/attention_operation_profiler.h"
 #include "cutlass/profiler/block_scaled_gemm_operation_profiler.h"
 #include "cutlass/profiler/blockwise_gemm_operation_profiler.h"
 #include "cutlass/profiler/conv2d_operation_profiler.h"
@@ -45,10 +55,13 @@
 #include "cutlass/profiler/grouped_gemm_operation_profiler.h"
 #include "cutlass/profiler/rank_2k_operation_profiler.h"
 #include "cutlass/profiler/rank_k_operation_profiler.h"
+#include "cutlass/profiler/sequence_profiler.h"
 #include "cutlass/profiler/sparse_gemm_operation_profiler.h"
 #include "cutlass/profiler/symm_operation_profiler.h"
 #include "cutlass/profiler/trmm_operation_profiler.h"
 
+#include "cutlass/library/kernel_selection.h"
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass {
@@ -61,27 +74,39 @@ CutlassProfiler::CutlassProfiler(
 ):
   options_(options) {
 
-  operation_profilers_.emplace_back(new GemmOperationProfiler(options));
+  operation_profilers_ = make_operation_profilers_(options);
+}
+
+/// Constructs one profiler for each operation kind
+OperationProfilerVector CutlassProfiler::make_operation_profilers_(Options const &options) {
+
+  OperationProfilerVector operation_profilers;
 
-  operation_profilers_.emplace_back(new BlockScaledGemmOperationProfiler(options));
+  operation_profilers.emplace_back(new GemmOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new BlockwiseGemmOperationProfiler(options));   
+  operation_profilers.emplace_back(new BlockScaledGemmOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new SparseGemmOperationProfiler(options));
+  operation_profilers.emplace_back(new BlockwiseGemmOperationProfiler(options));   
 
-  operation_profilers_.emplace_back(new Conv2dOperationProfiler(options));
+  operation_profilers.emplace_back(new SparseGemmOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new Conv3dOperationProfiler(options));
+  operation_profilers.emplace_back(new Conv2dOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new RankKOperationProfiler(options));
+  operation_profilers.emplace_back(new Conv3dOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new Rank2KOperationProfiler(options));
+  operation_profilers.emplace_back(new RankKOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new TrmmOperationProfiler(options));
+  operation_profilers.emplace_back(new Rank2KOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new SymmOperationProfiler(options));
+  operation_profilers.emplace_back(new TrmmOperationProfiler(options));
 
-  operation_profilers_.emplace_back(new GroupedGemmOperationProfiler(options));
+  operation_profilers.emplace_back(new SymmOperationProfiler(options));
+
+  operation_profilers.emplace_back(new GroupedGemmOperationProfiler(options));
+
+  operation_profilers.emplace_back(new AttentionOperationProfiler(options));
+
+  return operation_profilers;
 }
 
 CutlassProfiler::~CutlassProfiler() {
@@ -132,6 +157,18 @@ int CutlassProfiler::operator()() {
     options_.execution_mode == ExecutionMode::kDryRun ||
     options_.execution_mode == ExecutionMode::kTrace) {
 
+    // Profiles a chain of kernels captured in one CUDA graph
+    if (!options_.sequence.empty() && options_.execution_mode == ExecutionMode::kProfile) {
+      SequenceProfiler sequence_profiler(options_, [this]() { return make_operation_profilers_(options_); });
+      return sequence_profiler();
+    }
+
+    // Distributes the operation x problem space over one process per shard
+    if (options_.profiling.shard_count > 1 && options_.profiling.shard_index < 0 &&
+      options_.execution_mode == ExecutionMode::kProfile) {
+      return profile_sharded_();
+    }
+
     // Profiles all operations
     return profile_();
   }
@@ -174,6 +211,195 @@ int CutlassProfiler::profile_() {
   return result;
 }
 
+/// Launches one profiler process per shard and merges their reports
+int CutlassProfiler::profile_sharded_() {
+
+  int shard_count = options_.profiling.shard_count;
+
+  if (options_.report.output_path.empty()) {
+    std::cerr << "Error: --shard-count requires --output to merge the shard reports" << std::endl;
+    return 1;
+  }
+
+#if defined(__unix__)
+
+  // Shards are dealt round-robin over the selected devices, or all visible devices by default
+  std::vector<int> devices = options_.device.devices;
+  if (!options_.cmdline.check_cmd_line_flag("devices")) {
+    devices.clear();
+    for (int device = 0; device < options_.device.num_devices; ++device) {
+      devices.push_back(device);
+    }
+  }
+
+  std::string base_path = options_.report.output_path;
+  base_path = base_path.substr(0, base_path.rfind(".csv"));
+
+  auto shard_suffix = [](int shard) {
+    return ".shard" + std::to_string(shard);
+  };
+
+  // Arguments forwarded unchanged to every shard
+  std::vector<std::string> common_args;
+  for (size_t i = 0; i < options_.cmdline.keys.size(); ++i) {
+    std::string const &key = options_.cmdline.keys[i];
+    if (key == "devices" || key == "output" || key == "junit-output" || key == "append" ||
+        key == "kernel-selection-output" || key == "shard-index" || key == "verbose") {
+      continue;
+    }
+    std::string arg = "--" + key;
+    if (!options_.cmdline.values[i].empty()) {
+      arg += "=" + options_.cmdline.values[i];
+    }
+    common_args.push_back(arg);
+  }
+
+  std::vector<pid_t> children;
+  for (int shard = 0; shard < shard_count; ++shard) {
+
+    std::vector<std::string> args;
+    args.push_back(options_.cmdline.program_path);
+    args.insert(args.end(), common_args.begin(), common_args.end());
+    args.push_back("--shard-index=" + std::to_string(shard));
+    args.push_back("--devices=" + std::to_string(devices.at(shard % devices.size())));
+    args.push_back("--output=" + base_path + shard_suffix(shard) + ".csv");
+    args.push_back("--verbose=false");
+    if (!options_.report.junit_output_path.empty()) {
+      args.push_back("--junit-output=" + options_.report.junit_output_path + shard_suffix(shard));
+    }
+    if (!options_.report.kernel_selection_output_path.empty()) {
+      args.push_back("--kernel-selection-output=" +
+        options_.report.kernel_selection_output_path + shard_suffix(shard));
+    }
+
+    pid_t pid = fork();
+    if (pid == 0) {
+      std::vector<char *> argv;
+      for (auto &arg : args) {
+        argv.push_back(const_cast<char *>(arg.c_str()));
+      }
+      argv.push_back(nullptr);
+
+      execvp(argv[0], argv.data());
+      std::cerr << "Error: failed to launch shard " << shard << ": " << args[0] << std::endl;
+      _exit(127);
+    }
+    else if (pid < 0) {
+      std::cerr << "Error: failed to fork shard " << shard << std::endl;
+      break;
+    }
+
+    if (options_.report.verbose) {
+      std::cout << "Launched shard " << shard << "/" << shard_count << " on device "
+                << devices.at(shard % devices.size()) << std::endl;
+    }
+    children.push_back(pid);
+  }
+
+  int result = (int(children.size()) == shard_count ? 0 : 1);
+  for (pid_t pid : children) {
+    int status = 0;
+    if (waitpid(pid, &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      result = 1;
+    }
+  }
+
+  // Concatenates the per-shard reports of each operation kind, keeping a single header
+  for (auto &profiler : operation_profilers_) {
+
+    std::string kind_str = library::to_string(profiler->kind());
+    std::string file_name = base_path + "." + kind_str + ".csv";
+
+    bool print_header = true;
+    if (options_.report.append) {
+      std::ifstream test_output_file(file_name);
+      print_header = !test_output_file.is_open();
+    }
+
+    std::ofstream output_file;
+    for (int shard = 0; shard < shard_count; ++shard) {
+
+      std::string shard_file_name = base_path + shard_suffix(shard) + "." + kind_str + ".csv";
+      std::ifstream shard_file(shard_file_name);
+      if (!shard_file.is_open()) {
+        continue;
+      }
+
+      if (!output_file.is_open()) {
+        output_file.open(file_name, options_.report.append ? std::ios::app : std::ios::out);
+        if (!output_file.good()) {
+          std::cerr << "Could not open output file at path '" << file_name << "'" << std::endl;
+          return 1;
+        }
+      }
+
+      std::string line;
+      bool header = true;
+      while (std::getline(shard_file, line)) {
+        if (!header || print_header) {
+          output_file << line << "\n";
+        }
+        header = false;
+      }
+      print_header = false;
+
+      shard_file.close();
+      std::remove(shard_file_name.c_str());
+    }
+
+    if (output_file.is_open() && options_.report.verbose) {
+      std::cout << "Merged " << shard_count << " shards into '" << file_name << "'" << std::endl;
+    }
+  }
+
+  // Merges the kernel selections of all shards, keeping the fastest per bucket
+  if (!options_.report.kernel_selection_output_path.empty()) {
+
+    library::KernelSelectionDatabase kernel_selections;
+    for (int shard = 0; shard < shard_count; ++shard) {
+
+      std::string shard_file_name = options_.report.kernel_selection_output_path + shard_suffix(shard);
+      std::ifstream shard_file(shard_file_name);
+      if (!shard_file.is_open()) {
+        continue;
+      }
+
+      library::KernelSelectionDatabase shard_selections;
+      if (shard_selections.read(shard_file) != Status::kSuccess) {
+        std::cerr << "Could not parse kernel selections at path '" << shard_file_name << "'" << std::endl;
+        result = 1;
+        continue;
+      }
+      kernel_selections.merge(shard_selections);
+
+      shard_file.close();
+      std::remove(shard_file_name.c_str());
+    }
+
+    if (!kernel_selections.empty()) {
+      std::ofstream output_file(options_.report.kernel_selection_output_path);
+      if (output_file.good()) {
+        kernel_selections.write(output_file);
+      }
+      else {
+        std::cerr << "Could not open kernel selection output file at path '"
+                  << options_.report.kernel_selection_output_path << "'" << std::endl;
+        result = 1;
+      }
+    }
+  }
+
+  return result;
+
+#else
+
+  std::cerr << "Error: launching shards is only supported on POSIX systems. "
+            << "Run one profiler per shard with --shard-index instead." << std::endl;
+  return 1;
+
+#endif
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// Prints all options
@@ -208,6 +434,7 @@ void CutlassProfiler::print_usage_(std::ostream &out) {
     << "  $ cutlass_profiler --operation=Conv2d --help\n\n"
     << "  $ cutlass_profiler --operation=SparseGemm --help\n\n"
     << "  $ cutlass_profiler --operation=GroupedGemm --help\n\n"
+    << "  $ cutlass_profiler --operation=Attention --help\n\n"
   ;
 }
 
@@ -576,7 +576,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
 
   switch (type_) {
   case library::NumericTypeID::kF16:
-    cutlass::reference::device::BlockFillRandom<cutlass::half_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::half_t>(
       reinterpret_cast<cutlass::half_t *>(pointer_),
       capacity_,
       seed,
@@ -584,7 +584,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kBF16:
-    cutlass::reference::device::BlockFillRandom<cutlass::bfloat16_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::bfloat16_t>(
       reinterpret_cast<cutlass::bfloat16_t *>(pointer_),
       capacity_,
       seed,
@@ -592,7 +592,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kTF32:
-    cutlass::reference::device::BlockFillRandom<cutlass::tfloat32_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::tfloat32_t>(
       reinterpret_cast<cutlass::tfloat32_t *>(pointer_),
       capacity_,
       seed,
@@ -600,7 +600,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF32:
-    cutlass::reference::device::BlockFillRandom<float>(
+    cutlass::reference::device::BlockFillRandomPacked<float>(
       reinterpret_cast<float *>(pointer_),
       capacity_,
       seed,
@@ -608,7 +608,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCBF16:
-    cutlass::reference::device::BlockFillRandom<complex<bfloat16_t>>(
+    cutlass::reference::device::BlockFillRandomPacked<complex<bfloat16_t>>(
       reinterpret_cast<complex<bfloat16_t> *>(pointer_),
       capacity_,
       seed,
@@ -616,7 +616,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCTF32:
-    cutlass::reference::device::BlockFillRandom<cutlass::complex<cutlass::tfloat32_t>>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::complex<cutlass::tfloat32_t>>(
       reinterpret_cast<cutlass::complex<cutlass::tfloat32_t> *>(pointer_),
       capacity_,
       seed,
@@ -624,7 +624,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCF32:
-    cutlass::reference::device::BlockFillRandom<cutlass::complex<float>>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::complex<float>>(
       reinterpret_cast<cutlass::complex<float> *>(pointer_),
       capacity_,
       seed,
@@ -632,7 +632,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE4M3:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e4m3_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::float_e4m3_t>(
       reinterpret_cast<cutlass::float_e4m3_t *>(pointer_),
       capacity_,
       seed,
@@ -640,7 +640,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE5M2:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e5m2_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::float_e5m2_t>(
       reinterpret_cast<cutlass::float_e5m2_t *>(pointer_),
       capacity_,
       seed,
@@ -648,7 +648,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFUE4M3:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_ue4m3_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::float_ue4m3_t>(
       reinterpret_cast<cutlass::float_ue4m3_t *>(pointer_),
       capacity_,
       seed,
@@ -656,7 +656,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFUE8M0:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_ue8m0_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::float_ue8m0_t>(
       reinterpret_cast<cutlass::float_ue8m0_t *>(pointer_),
       capacity_,
       seed,
@@ -664,7 +664,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE2M3:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e2m3_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::float_e2m3_t>(
       reinterpret_cast<cutlass::float_e2m3_t *>(pointer_),
       capacity_,
       seed,
@@ -672,7 +672,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE3M2:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e3m2_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::float_e3m2_t>(
       reinterpret_cast<cutlass::float_e3m2_t *>(pointer_),
       capacity_,
       seed,
@@ -680,7 +680,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kFE2M1:
-    cutlass::reference::device::BlockFillRandom<cutlass::float_e2m1_t>(
+    cutlass::reference::device::BlockFillRandomPacked<cutlass::float_e2m1_t>(
       reinterpret_cast<cutlass::float_e2m1_t *>(pointer_),
       capacity_,
       seed,
@@ -688,7 +688,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kF64:
-    cutlass::reference::device::BlockFillRandom<double>(
+    cutlass::reference::device::BlockFillRandomPacked<double>(
       reinterpret_cast<double *>(pointer_),
       capacity_,
       seed,
@@ -696,7 +696,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kCF64:
-    cutlass::reference::device::BlockFillRandom<complex<double>>(
+    cutlass::reference::device::BlockFillRandomPacked<complex<double>>(
       reinterpret_cast<complex<double> *>(pointer_),
       capacity_,
       seed,
@@ -704,7 +704,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS2:
-    cutlass::reference::device::BlockFillRandom<int2b_t>(
+    cutlass::reference::device::BlockFillRandomPacked<int2b_t>(
       reinterpret_cast<int2b_t *>(pointer_),
       capacity_,
       seed,
@@ -712,7 +712,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS4:
-    cutlass::reference::device::BlockFillRandom<int4b_t>(
+    cutlass::reference::device::BlockFillRandomPacked<int4b_t>(
       reinterpret_cast<int4b_t *>(pointer_),
       capacity_,
       seed,
@@ -720,7 +720,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS8:
-    cutlass::reference::device::BlockFillRandom<int8_t>(
+    cutlass::reference::device::BlockFillRandomPacked<int8_t>(
       reinterpret_cast<int8_t *>(pointer_),
       capacity_,
       seed,
@@ -728,7 +728,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS16:
-    cutlass::reference::device::BlockFillRandom<int16_t>(
+    cutlass::reference::device::BlockFillRandomPacked<int16_t>(
       reinterpret_cast<int16_t *>(pointer_),
       capacity_,
       seed,
@@ -736,7 +736,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS32:
-    cutlass::reference::device::BlockFillRandom<int32_t>(
+    cutlass::reference::device::BlockFillRandomPacked<int32_t>(
       reinterpret_cast<int32_t *>(pointer_),
       capacity_,
       seed,
@@ -744,7 +744,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kS64:
-    cutlass::reference::device::BlockFillRandom<int64_t>(
+    cutlass::reference::device::BlockFillRandomPacked<int64_t>(
       reinterpret_cast<int64_t *>(pointer_),
       capacity_,
       seed,
@@ -752,7 +752,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kB1:
-    cutlass::reference::device::BlockFillRandom<uint1b_t>(
+    cutlass::reference::device::BlockFillRandomPacked<uint1b_t>(
       reinterpret_cast<uint1b_t *>(pointer_),
       capacity_,
       seed,
@@ -760,7 +760,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU2:
-    cutlass::reference::device::BlockFillRandom<uint2b_t>(
+    cutlass::reference::device::BlockFillRandomPacked<uint2b_t>(
       reinterpret_cast<uint2b_t *>(pointer_),
       capacity_,
       seed,
@@ -768,7 +768,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU4:
-    cutlass::reference::device::BlockFillRandom<uint4b_t>(
+    cutlass::reference::device::BlockFillRandomPacked<uint4b_t>(
       reinterpret_cast<uint4b_t *>(pointer_),
       capacity_,
       seed,
@@ -776,7 +776,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU8:
-    cutlass::reference::device::BlockFillRandom<uint8_t>(
+    cutlass::reference::device::BlockFillRandomPacked<uint8_t>(
       reinterpret_cast<uint8_t *>(pointer_),
       capacity_,
       seed,
@@ -784,7 +784,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU16:
-    cutlass::reference::device::BlockFillRandom<uint16_t>(
+    cutlass::reference::device::BlockFillRandomPacked<uint16_t>(
       reinterpret_cast<uint16_t *>(pointer_),
       capacity_,
       seed,
@@ -792,7 +792,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU32:
-    cutlass::reference::device::BlockFillRandom<uint32_t>(
+    cutlass::reference::device::BlockFillRandomPacked<uint32_t>(
       reinterpret_cast<uint32_t *>(pointer_),
       capacity_,
       seed,
@@ -800,7 +800,7 @@ void DeviceAllocation::initialize_random_device(int seed, Distribution dist) {
     );
     break;
   case library::NumericTypeID::kU64:
-    cutlass::reference::device::BlockFillRandom<uint64_t>(
+    cutlass::reference::device::BlockFillRandomPacked<uint64_t>(
       reinterpret_cast<uint64_t *>(pointer_),
       capacity_,
       seed,
@@ -2121,6 +2121,287 @@ bool DeviceAllocation::block_compare_relatively_equal(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Compares two blocks in one pass on the device, relatively if relative is true
+reference::device::BlockCompareSummary DeviceAllocation::block_compare_summary(
+  library::NumericTypeID numeric_type,
+  void const *ptr_A,
+  void const *ptr_B,
+  size_t capacity,
+  bool relative,
+  double epsilon,
+  double nonzero_floor) {
+
+  switch (numeric_type) {
+  case library::NumericTypeID::kFE4M3:
+    return reference::device::BlockCompareSummarize<float_e4m3_t>(
+      reinterpret_cast<float_e4m3_t const *>(ptr_A),
+      reinterpret_cast<float_e4m3_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float_e4m3_t>(epsilon),
+      static_cast<float_e4m3_t>(nonzero_floor));
+
+  case library::NumericTypeID::kFE5M2:
+    return reference::device::BlockCompareSummarize<float_e5m2_t>(
+      reinterpret_cast<float_e5m2_t const *>(ptr_A),
+      reinterpret_cast<float_e5m2_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float_e5m2_t>(epsilon),
+      static_cast<float_e5m2_t>(nonzero_floor));
+
+  case library::NumericTypeID::kFUE4M3:
+    return reference::device::BlockCompareSummarize<float_ue4m3_t>(
+      reinterpret_cast<float_ue4m3_t const *>(ptr_A),
+      reinterpret_cast<float_ue4m3_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float_ue4m3_t>(epsilon),
+      static_cast<float_ue4m3_t>(nonzero_floor));
+
+  case library::NumericTypeID::kFUE8M0:
+    return reference::device::BlockCompareSummarize<float_ue8m0_t>(
+      reinterpret_cast<float_ue8m0_t const *>(ptr_A),
+      reinterpret_cast<float_ue8m0_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float_ue8m0_t>(epsilon),
+      static_cast<float_ue8m0_t>(nonzero_floor));
+
+  case library::NumericTypeID::kFE2M3:
+    return reference::device::BlockCompareSummarize<float_e2m3_t>(
+      reinterpret_cast<float_e2m3_t const *>(ptr_A),
+      reinterpret_cast<float_e2m3_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float_e2m3_t>(epsilon),
+      static_cast<float_e2m3_t>(nonzero_floor));
+
+  case library::NumericTypeID::kFE3M2:
+    return reference::device::BlockCompareSummarize<float_e3m2_t>(
+      reinterpret_cast<float_e3m2_t const *>(ptr_A),
+      reinterpret_cast<float_e3m2_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float_e3m2_t>(epsilon),
+      static_cast<float_e3m2_t>(nonzero_floor));
+
+  case library::NumericTypeID::kFE2M1:
+    return reference::device::BlockCompareSummarize<float_e2m1_t>(
+      reinterpret_cast<float_e2m1_t const *>(ptr_A),
+      reinterpret_cast<float_e2m1_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float_e2m1_t>(epsilon),
+      static_cast<float_e2m1_t>(nonzero_floor));
+
+  case library::NumericTypeID::kF16:
+    return reference::device::BlockCompareSummarize<half_t>(
+      reinterpret_cast<half_t const *>(ptr_A),
+      reinterpret_cast<half_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<half_t>(epsilon),
+      static_cast<half_t>(nonzero_floor));
+
+  case library::NumericTypeID::kBF16:
+    return reference::device::BlockCompareSummarize<bfloat16_t>(
+      reinterpret_cast<bfloat16_t const *>(ptr_A),
+      reinterpret_cast<bfloat16_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<bfloat16_t>(epsilon),
+      static_cast<bfloat16_t>(nonzero_floor));
+
+  case library::NumericTypeID::kTF32:
+    return reference::device::BlockCompareSummarize<tfloat32_t>(
+      reinterpret_cast<tfloat32_t const *>(ptr_A),
+      reinterpret_cast<tfloat32_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<tfloat32_t>(epsilon),
+      static_cast<tfloat32_t>(nonzero_floor));
+
+  case library::NumericTypeID::kF32:
+    return reference::device::BlockCompareSummarize<float>(
+      reinterpret_cast<float const *>(ptr_A),
+      reinterpret_cast<float const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<float>(epsilon),
+      static_cast<float>(nonzero_floor));
+
+  case library::NumericTypeID::kF64:
+    return reference::device::BlockCompareSummarize<double>(
+      reinterpret_cast<double const *>(ptr_A),
+      reinterpret_cast<double const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<double>(epsilon),
+      static_cast<double>(nonzero_floor));
+
+  case library::NumericTypeID::kS2:
+    return reference::device::BlockCompareSummarize<int2b_t>(
+      reinterpret_cast<int2b_t const *>(ptr_A),
+      reinterpret_cast<int2b_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<int2b_t>(epsilon),
+      static_cast<int2b_t>(nonzero_floor));
+
+  case library::NumericTypeID::kS4:
+    return reference::device::BlockCompareSummarize<int4b_t>(
+      reinterpret_cast<int4b_t const *>(ptr_A),
+      reinterpret_cast<int4b_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<int4b_t>(epsilon),
+      static_cast<int4b_t>(nonzero_floor));
+
+  case library::NumericTypeID::kS8:
+    return reference::device::BlockCompareSummarize<int8_t>(
+      reinterpret_cast<int8_t const *>(ptr_A),
+      reinterpret_cast<int8_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<int8_t>(epsilon),
+      static_cast<int8_t>(nonzero_floor));
+
+  case library::NumericTypeID::kS16:
+    return reference::device::BlockCompareSummarize<int16_t>(
+      reinterpret_cast<int16_t const *>(ptr_A),
+      reinterpret_cast<int16_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<int16_t>(epsilon),
+      static_cast<int16_t>(nonzero_floor));
+
+  case library::NumericTypeID::kS32:
+    return reference::device::BlockCompareSummarize<int32_t>(
+      reinterpret_cast<int32_t const *>(ptr_A),
+      reinterpret_cast<int32_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<int32_t>(epsilon),
+      static_cast<int32_t>(nonzero_floor));
+
+  case library::NumericTypeID::kS64:
+    return reference::device::BlockCompareSummarize<int64_t>(
+      reinterpret_cast<int64_t const *>(ptr_A),
+      reinterpret_cast<int64_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<int64_t>(epsilon),
+      static_cast<int64_t>(nonzero_floor));
+
+  case library::NumericTypeID::kB1:
+    return reference::device::BlockCompareSummarize<uint1b_t>(
+      reinterpret_cast<uint1b_t const *>(ptr_A),
+      reinterpret_cast<uint1b_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<uint1b_t>(epsilon),
+      static_cast<uint1b_t>(nonzero_floor));
+
+  case library::NumericTypeID::kU2:
+    return reference::device::BlockCompareSummarize<uint2b_t>(
+      reinterpret_cast<uint2b_t const *>(ptr_A),
+      reinterpret_cast<uint2b_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<uint2b_t>(epsilon),
+      static_cast<uint2b_t>(nonzero_floor));
+
+  case library::NumericTypeID::kU4:
+    return reference::device::BlockCompareSummarize<uint4b_t>(
+      reinterpret_cast<uint4b_t const *>(ptr_A),
+      reinterpret_cast<uint4b_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<uint4b_t>(epsilon),
+      static_cast<uint4b_t>(nonzero_floor));
+
+  case library::NumericTypeID::kU8:
+    return reference::device::BlockCompareSummarize<uint8_t>(
+      reinterpret_cast<uint8_t const *>(ptr_A),
+      reinterpret_cast<uint8_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<uint8_t>(epsilon),
+      static_cast<uint8_t>(nonzero_floor));
+
+  case library::NumericTypeID::kU16:
+    return reference::device::BlockCompareSummarize<uint16_t>(
+      reinterpret_cast<uint16_t const *>(ptr_A),
+      reinterpret_cast<uint16_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<uint16_t>(epsilon),
+      static_cast<uint16_t>(nonzero_floor));
+
+  case library::NumericTypeID::kU32:
+    return reference::device::BlockCompareSummarize<uint32_t>(
+      reinterpret_cast<uint32_t const *>(ptr_A),
+      reinterpret_cast<uint32_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<uint32_t>(epsilon),
+      static_cast<uint32_t>(nonzero_floor));
+
+  case library::NumericTypeID::kU64:
+    return reference::device::BlockCompareSummarize<uint64_t>(
+      reinterpret_cast<uint64_t const *>(ptr_A),
+      reinterpret_cast<uint64_t const *>(ptr_B),
+      capacity,
+      relative,
+      static_cast<uint64_t>(epsilon),
+      static_cast<uint64_t>(nonzero_floor));
+
+  // Complex elements are compared for equality, as in block_compare_relatively_equal()
+  case library::NumericTypeID::kCF16:
+    return reference::device::BlockCompareSummarize<complex<half_t>>(
+      reinterpret_cast<complex<half_t> const *>(ptr_A),
+      reinterpret_cast<complex<half_t> const *>(ptr_B),
+      capacity,
+      false);
+
+  case library::NumericTypeID::kCBF16:
+    return reference::device::BlockCompareSummarize<complex<bfloat16_t>>(
+      reinterpret_cast<complex<bfloat16_t> const *>(ptr_A),
+      reinterpret_cast<complex<bfloat16_t> const *>(ptr_B),
+      capacity,
+      false);
+
+  case library::NumericTypeID::kCTF32:
+    return reference::device::BlockCompareSummarize<complex<tfloat32_t>>(
+      reinterpret_cast<complex<tfloat32_t> const *>(ptr_A),
+      reinterpret_cast<complex<tfloat32_t> const *>(ptr_B),
+      capacity,
+      false);
+
+  case library::NumericTypeID::kCF32:
+    return reference::device::BlockCompareSummarize<complex<float>>(
+      reinterpret_cast<complex<float> const *>(ptr_A),
+      reinterpret_cast<complex<float> const *>(ptr_B),
+      capacity,
+      false);
+
+  case library::NumericTypeID::kCF64:
+    return reference::device::BlockCompareSummarize<complex<double>>(
+      reinterpret_cast<complex<double> const *>(ptr_A),
+      reinterpret_cast<complex<double> const *>(ptr_B),
+      capacity,
+      false);
+
+  default:
+    {
+      throw std::runtime_error(std::string("Unsupported numeric type: ") + to_string(numeric_type));
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Permits copying dynamic vectors into static-length vectors
 template <typename TensorCoord, int Rank>
 struct vector_to_coord {
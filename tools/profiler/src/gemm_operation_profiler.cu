@@ -74,12 +74,16 @@ GemmOperationProfiler::GemmOperationProfiler(Options const &options):
       {ArgumentTypeID::kEnumerated, {"split_k_mode", "split-k-mode"}, "Variant of split K mode(serial, parallel)"},
       {ArgumentTypeID::kInteger, {"split_k_slices", "split-k-slices"}, "Number of partitions of K dimension"},
       {ArgumentTypeID::kInteger, {"batch_count", "batch-count"}, "Number of GEMMs computed in one batch"},
-      {ArgumentTypeID::kEnumerated, {"raster_order", "raster-order"}, "Raster order (heuristic, along_n, along_m)"},
+      {ArgumentTypeID::kEnumerated, {"raster_order", "raster-order"}, "Raster order (heuristic, along_n, along_m, l2_aware, morton)"},
+      {ArgumentTypeID::kEnumerated, {"decomposition_mode", "decomposition-mode"}, "Decomposition of stream-K kernels (heuristic, data_parallel, split_k, stream_k)"},
       {ArgumentTypeID::kEnumerated, {"runtime_input_datatype_a", "runtime-input-datatype::a"}, "Runtime datatype (e4m3, e5m2, e3m2, e2m3, e2m1)"}, 
       {ArgumentTypeID::kEnumerated, {"runtime_input_datatype_b", "runtime-input-datatype::b"}, "Runtime datatype (e4m3, e5m2, e3m2, e2m3, e2m1)"}, 
       {ArgumentTypeID::kInteger, {"use_pdl", "use-pdl"}, "Use PDL (true, false)"}, 
       {ArgumentTypeID::kEnumerated, {"enable_sm90_mixed_dtype_shuffle_test", "enable-sm90-mixed-dtype-shuffle-test"}, "Enable SM90 mixed input data type kernel shuffle layout test (true, false)"},
       {ArgumentTypeID::kInteger, {"swizzle_size", "swizzle-size"}, "Size to swizzle"},
+      {ArgumentTypeID::kScalar, {"prefetch_ratio", "prefetch-ratio"}, "Fraction of A prefetched into L2 ahead of the preceding kernel by weight prefetch kernels"},
+      {ArgumentTypeID::kScalar, {"overlap_ratio", "overlap-ratio"}, "Fraction of the mainloop after which weight prefetch kernels launch dependent kernels"},
+      {ArgumentTypeID::kInteger, {"emulation_bands", "emulation-bands"}, "Number of BF16 bands (3, 4, 5 for 6, 8, 9 products) computed by emulated FP32 kernels, 0 for the kernel default"},
     },
     { library::Provider::kCUBLAS}
   ) {
@@ -118,6 +122,12 @@ void GemmOperationProfiler::print_examples(std::ostream &out) const {
     << "Profile a particular problem size with split K and parallel reduction:\n"
     << "  $ cutlass_profiler --operation=Gemm --split_k_mode=parallel --split_k_slices=2 --m=1024 --n=1024 --k=128\n\n"
 
+    << "Sweep the decomposition modes and splits of stream-K kernels, e.g. to calibrate the stream-K heuristic:\n"
+    << "  $ cutlass_profiler --operation=Gemm --kernels=*stream_k* --decomposition_mode=heuristic,data_parallel,split_k,stream_k --split_k_slices=1:8 --m=1024 --n=1024 --k=8192\n\n"
+
+    << "Profile the GEMV kernels, which split K across the CTAs of a cluster, on skinny problems:\n"
+    << "  $ cutlass_profiler --operation=Gemm --kernels=*gemv* --m=8192 --n=1,8,16 --k=8192\n\n"
+
     << "Using various input value distribution:\n"
     << "  $ cutlass_profiler --operation=Gemm --dist=uniform,min:0,max:3\n"
     << "  $ cutlass_profiler --operation=Gemm --dist=gaussian,mean:0,stddev:3\n"
@@ -209,6 +219,19 @@ Status GemmOperationProfiler::GemmProblem::parse(
     this->use_pdl = false;
   }
 
+  std::string ratio;
+  // default value
+  this->prefetch_ratio = -1.0f;
+  if (arg_as_string(ratio, "prefetch_ratio", problem_space, problem)) {
+    this->prefetch_ratio = std::stof(ratio);
+  }
+
+  // default value
+  this->overlap_ratio = 0.5f;
+  if (arg_as_string(ratio, "overlap_ratio", problem_space, problem)) {
+    this->overlap_ratio = std::stof(ratio);
+  }
+
   if (!arg_as_bool(this->enable_sm90_mixed_dtype_shuffle_test, "enable_sm90_mixed_dtype_shuffle_test", problem_space, problem)) {
     // default value
     this->enable_sm90_mixed_dtype_shuffle_test = false;
@@ -253,11 +276,21 @@ Status GemmOperationProfiler::GemmProblem::parse(
     this->swizzle_size = 1;
   }
 
+  if (!arg_as_int(this->emulation_bands, "emulation_bands", problem_space, problem)) {
+    // default value
+    this->emulation_bands = 0;
+  }
+
   if (!arg_as_RasterOrder(this->raster_order, "raster_order", problem_space, problem)) {
     // default value
     this->raster_order = library::RasterOrder::kHeuristic;
   }
 
+  if (!arg_as_DecompositionMode(this->decomposition_mode, "decomposition_mode", problem_space, problem)) {
+    // default value
+    this->decomposition_mode = library::DecompositionMode::kHeuristic;
+  }
+
   if (this->split_k_slices > 1 && this->batch_count > 1) {
     // At least one of these must be one
     return Status::kErrorInvalidProblem;
@@ -454,8 +487,12 @@ void GemmOperationProfiler::GemmProblem::initialize_result(
   set_argument(result, "split_k_slices", problem_space, split_k_slices);
   set_argument(result, "batch_count", problem_space, batch_count);
   set_argument(result, "raster_order", problem_space, library::to_string(raster_order));
+  set_argument(result, "decomposition_mode", problem_space, library::to_string(decomposition_mode));
   set_argument(result, "swizzle_size", problem_space, swizzle_size);
   set_argument(result, "use_pdl", problem_space, library::to_string(use_pdl));
+  set_argument(result, "prefetch_ratio", problem_space, std::to_string(prefetch_ratio));
+  set_argument(result, "overlap_ratio", problem_space, std::to_string(overlap_ratio));
+  set_argument(result, "emulation_bands", problem_space, emulation_bands);
   set_argument(result, "enable_sm90_mixed_dtype_shuffle_test", problem_space, library::to_string(enable_sm90_mixed_dtype_shuffle_test));
 
   
@@ -534,6 +571,9 @@ Status GemmOperationProfiler::initialize_configuration(
     gemm_workspace_[i].configuration.device_count = static_cast<int>(device_count);
     gemm_workspace_[i].arguments.device_index = static_cast<int>(i);
     gemm_workspace_[i].arguments.use_pdl = problem_.use_pdl;
+    gemm_workspace_[i].arguments.prefetch_ratio = problem_.prefetch_ratio;
+    gemm_workspace_[i].arguments.overlap_ratio = problem_.overlap_ratio;
+    gemm_workspace_[i].arguments.emulation_bands = problem_.emulation_bands;
 
     if (problem_.mode == library::GemmUniversalMode::kBatched) {
       gemm_workspace_[i].configuration.batch_count = problem_.batch_count;
@@ -564,6 +604,7 @@ Status GemmOperationProfiler::initialize_configuration(
     gemm_workspace_[i].arguments.cluster_shape = {int(problem_.cluster_m), int(problem_.cluster_n), int(problem_.cluster_k)}; 
     gemm_workspace_[i].arguments.cluster_shape_fallback = {int(problem_.cluster_m_fallback), int(problem_.cluster_n_fallback), int(problem_.cluster_k_fallback)}; 
     gemm_workspace_[i].arguments.split_k_slices = problem_.split_k_slices;
+    gemm_workspace_[i].arguments.decomposition_mode = problem_.decomposition_mode;
 
     
     gemm_workspace_[i].arguments.runtime_input_datatype_a = problem_.runtime_input_datatype_a;
@@ -971,6 +1012,7 @@ Status GemmOperationProfiler::initialize_workspace(
       gemm_workspace_[i].arguments.cluster_shape = {int(problem_.cluster_m), int(problem_.cluster_n), int(problem_.cluster_k)}; 
       gemm_workspace_[i].arguments.cluster_shape_fallback = {int(problem_.cluster_m_fallback), int(problem_.cluster_n_fallback), int(problem_.cluster_k_fallback)};
       gemm_workspace_[i].arguments.split_k_slices = problem_.split_k_slices;
+      gemm_workspace_[i].arguments.decomposition_mode = problem_.decomposition_mode;
       gemm_workspace_[i].arguments.batch_count = problem_.batch_count;
       gemm_workspace_[i].arguments.lda = problem_.lda;
       gemm_workspace_[i].arguments.ldb = problem_.ldb;
@@ -1477,6 +1519,13 @@ bool GemmOperationProfiler::verify_with_reference_(
 
       handle.set_provider(provider);
 
+      // A sampled device reference only writes the sampled tiles, so the rest of the reference
+      // starts out equal to the result under test
+      if (provider == library::Provider::kReferenceDevice && options.verification.sample_tiles > 0) {
+        gemm_workspace_[i].Reference->copy_from_device(gemm_workspace_[i].Computed->data());
+        handle.set_reference_sample_tiles(options.verification.sample_tiles);
+      }
+
       Status status = handle.gemm_universal(
         problem_.mode,
         gemm_workspace_[i].configuration.problem_size.m(),
@@ -1842,7 +1891,7 @@ Status GemmOperationProfiler::profile_cutlass_(
         &gemm_workspace_[dev_id].reduction_arguments,
         gemm_workspace_[dev_id].reduction_host_workspace.data(),
         nullptr,
-        gemm_workspace_[dev_id].stream);
+        stream);
 
       if (status != Status::kSuccess) {
         return status;
@@ -1855,7 +1904,115 @@ Status GemmOperationProfiler::profile_cutlass_(
   for (size_t i = 0; i < streams.size(); i++) {
     streams[i] = gemm_workspace_[i].stream;
   }
-  return profile_kernel_(result, options, launch_gemm, streams);
+
+  Status status = profile_kernel_(result, options, launch_gemm, streams);
+
+  if (status == Status::kSuccess && options.profiling.concurrent_streams > 1 && !result.pruned) {
+    Status concurrent_status = profile_cutlass_concurrent_(result, options, operation);
+    if (concurrent_status != Status::kSuccess && concurrent_status != Status::kErrorNotSupported) {
+      status = concurrent_status;
+    }
+  }
+
+  return status;
+}
+
+/// Method to profile copies of a CUTLASS Operation launched concurrently on several streams
+Status GemmOperationProfiler::profile_cutlass_concurrent_(
+  PerformanceResult &result,
+  Options const &options,
+  library::Operation const *operation) {
+
+  library::GemmDescription const &operation_desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  // Sparse kernels keep the compressed operand in the device workspace and parallel split-K
+  // shares a reduction workspace, so neither can be replicated per stream. Concurrency is
+  // measured within a single device only.
+  if (operation_desc.tile_description.math_instruction.opcode_class == library::OpcodeClassID::kSparseTensorOp ||
+      problem_.split_k_mode == library::SplitKMode::kParallel ||
+      gemm_workspace_.size() != 1) {
+    return Status::kErrorNotSupported;
+  }
+
+  GemmWorkspace &workspace = gemm_workspace_[0];
+  int stream_count = options.profiling.concurrent_streams;
+
+  std::vector<cudaStream_t> streams(stream_count);
+  for (auto &stream : streams) {
+    CUDA_CHECK(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+  }
+
+  int sm_count = workspace.arguments.sm_count;
+  void *D = workspace.arguments.D;
+  if (options.profiling.concurrent_sm_partition) {
+    workspace.arguments.sm_count = std::max(1, options.device.get_sm_count(0) / stream_count);
+  }
+
+  // Each stream owns its own operator state, device workspace and output. The first stream
+  // writes the profiled output, so concurrent launches never write the same D.
+  std::vector<std::vector<uint8_t>> host_workspaces(stream_count);
+  std::vector<DeviceAllocation> device_workspaces(stream_count);
+  std::vector<DeviceAllocation> outputs(stream_count);
+
+  Status status = Status::kSuccess;
+
+  for (int s = 0; s < stream_count && status == Status::kSuccess; ++s) {
+    if (s) {
+      outputs[s].reset(
+        workspace.Computed->type(),
+        workspace.Computed->layout(),
+        workspace.Computed->extent(),
+        workspace.Computed->stride(),
+        workspace.Computed->batch_count());
+    }
+
+    host_workspaces[s].resize(operation->get_host_workspace_size(&workspace.configuration), 0);
+    device_workspaces[s].reset(
+      library::NumericTypeID::kU8,
+      operation->get_device_workspace_size(&workspace.configuration, &workspace.arguments));
+
+    status = operation->initialize(
+      &workspace.configuration,
+      host_workspaces[s].data(),
+      device_workspaces[s].data(),
+      streams[s]);
+  }
+
+  auto launch_gemm = [&](int s, cudaStream_t stream, int launch) {
+    int problem_idx = (launch % workspace.problem_count) * problem_.batch_count;
+
+    workspace.arguments.A = workspace.A->batch_data(problem_idx);
+    workspace.arguments.B = workspace.B->batch_data(problem_idx);
+    workspace.arguments.C = workspace.C->batch_data(problem_idx);
+    workspace.arguments.D = s ? outputs[s].batch_data(problem_idx) : workspace.Computed->batch_data(problem_idx);
+
+    if (workspace.arguments.is_sm90_mixed_dtype) {
+      workspace.arguments.generate_scale_and_zero = false;
+      workspace.arguments.generate_dequantized_AB = false;
+    }
+
+    return operation->run(
+      &workspace.arguments,
+      host_workspaces[s].data(),
+      device_workspaces[s].data(),
+      stream);
+  };
+
+  if (status == Status::kSuccess) {
+    status = profile_kernel_concurrent_(result, options, launch_gemm, streams);
+    result.concurrent_sm_count = workspace.arguments.sm_count;
+  }
+
+  workspace.arguments.sm_count = sm_count;
+  workspace.arguments.D = D;
+
+  for (auto stream : streams) {
+    CUDA_CHECK(cudaStreamSynchronize(stream));
+    CUDA_CHECK(cudaStreamDestroy(stream));
+  }
+
+  return status;
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
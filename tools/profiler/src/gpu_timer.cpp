@@ -118,5 +118,60 @@ double GpuTimer::duration(int iterations) const {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+GpuLaunchTimer::GpuLaunchTimer(int launches): events(launches + 1, nullptr), recorded(launches + 1, false) {
+  for (auto & event : events) {
+    if (cudaEventCreate(&event) != cudaSuccess) {
+      throw std::runtime_error("Failed to create CUDA event");
+    }
+  }
+}
+
+GpuLaunchTimer::GpuLaunchTimer(GpuLaunchTimer&& launch_timer) noexcept:
+  events(std::move(launch_timer.events)),
+  recorded(std::move(launch_timer.recorded)) {
+  launch_timer.events.clear();
+  launch_timer.recorded.clear();
+}
+
+GpuLaunchTimer::~GpuLaunchTimer() {
+  for (const auto & event : events) {
+    if (event != nullptr) {
+      cudaEventDestroy(event);
+    }
+  }
+}
+
+/// Records the boundary event preceding launch idx (or following the last launch if idx == launches)
+void GpuLaunchTimer::record(int idx, cudaStream_t stream) {
+  cudaError_t result = cudaEventRecord(events.at(idx), stream);
+  if (result != cudaSuccess) {
+    throw std::runtime_error("Failed to record launch boundary event.");
+  }
+  recorded[idx] = true;
+}
+
+/// Returns the duration in milliseconds of each launch whose boundary events were both recorded
+std::vector<double> GpuLaunchTimer::durations() const {
+
+  std::vector<double> result;
+  result.reserve(events.size() - 1);
+
+  for (size_t i = 1; i < events.size(); ++i) {
+    // Querying an event that was never recorded fails, e.g. after the launch loop stopped early
+    if (!recorded[i - 1] || !recorded[i]) {
+      continue;
+    }
+    float ms;
+    if (cudaEventElapsedTime(&ms, events[i - 1], events[i]) != cudaSuccess) {
+      throw std::runtime_error("Failed to query elapsed time from CUDA events.");
+    }
+    result.push_back(double(ms));
+  }
+
+  return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // namespace profiler
 } // namespace cutlass
@@ -113,7 +113,7 @@ GroupedGemmOperationProfiler::GroupedGemmOperationProfiler(Options const& option
          {ArgumentTypeID::kEnumerated, {"runtime_input_datatype_b", "runtime-input-datatype::b"},
           "Runtime datatype (e4m3, e5m2, e3m2, e2m3, e2m1)"},
          {ArgumentTypeID::kEnumerated, {"raster_order", "raster-order"},
-          "Raster order (heuristic, along_n, along_m)"},
+          "Raster order (heuristic, along_n, along_m, l2_aware, morton)"},
          {ArgumentTypeID::kInteger, {"swizzle_size", "swizzle-size"}, "Size to swizzle"},
          {ArgumentTypeID::kEnumerated, {"use_pdl", "use_pdl"}, "Use PDL (true, false)"},
          {ArgumentTypeID::kScalar,
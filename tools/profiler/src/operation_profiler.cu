@@ -33,9 +33,12 @@
 */
 
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <stdexcept>
 #include <iomanip>
 #include <cstring>
+#include <memory>
 #include <fstream>
 #include <sstream>
 
@@ -52,7 +55,11 @@
 #include "cutlass/profiler/options.h"
 #include "cutlass/profiler/operation_profiler.h"
 #include "cutlass/profiler/gpu_timer.h"
+#include "cutlass/profiler/power_monitor.h"
+#include "cutlass/profiler/roofline.h"
+#include "cutlass/profiler/workload_report.h"
 
+#include "cutlass/library/kernel_selection.h"
 #include "cutlass/trace.h"
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -334,6 +341,9 @@ std::ostream& operator<<(std::ostream& out, library::OperationKind op_kind) {
   else if (op_kind == library::OperationKind::kGroupedGemm) {
     out << "kGroupedGemm";
   }
+  else if (op_kind == library::OperationKind::kAttention) {
+    out << "kAttention";
+  }
   else {
     out << "kInvalid";
   }
@@ -343,6 +353,96 @@ std::ostream& operator<<(std::ostream& out, library::OperationKind op_kind) {
 
 #endif // defined(CUTLASS_DEBUG_TRACE_LEVEL) && (CUTLASS_DEBUG_TRACE_LEVEL > 1)
 
+namespace {
+
+/// Returns the value of a profiled argument or an empty string if it is not present
+std::string result_argument(PerformanceResult const &result, char const *name) {
+  for (auto const &arg : result.arguments) {
+    if (arg.first == name) {
+      return arg.second;
+    }
+  }
+  return std::string();
+}
+
+/// Returns an integer-valued profiled argument
+int result_argument_int(PerformanceResult const &result, char const *name, int default_value) {
+  std::string value = result_argument(result, name);
+  return value.empty() ? default_value : std::atoi(value.c_str());
+}
+
+/// Records the profiled CUTLASS GEMM results of an operation in the kernel selection database
+void append_kernel_selections(
+  library::KernelSelectionDatabase &database,
+  library::Operation const *operation,
+  PerformanceResultVector const &results) {
+
+  if (operation->description().kind != library::OperationKind::kGemm) {
+    return;
+  }
+
+  library::GemmDescription const &desc =
+    static_cast<library::GemmDescription const &>(operation->description());
+
+  library::GemmFunctionalKey key(
+    desc.provider,
+    desc.gemm_kind,
+    desc.tile_description.math_instruction.element_accumulator,
+    desc.element_epilogue,
+    desc.A.element,
+    desc.A.layout,
+    desc.transform_A,
+    desc.B.element,
+    desc.B.layout,
+    desc.transform_B,
+    desc.C.element,
+    desc.C.layout,
+    desc.D.element,
+    desc.D.layout);
+
+  for (auto const &result : results) {
+
+    // Only record kernels that ran correctly. Parallel split-K needs a separate reduction
+    // kernel which library::Handle does not launch.
+    if (result.provider != library::Provider::kCUTLASS || !result.good() ||
+        result.status != Status::kSuccess ||
+        (result.disposition != Disposition::kPassed && result.disposition != Disposition::kNotVerified) ||
+        result_argument(result, "split_k_mode") == library::to_string(library::SplitKMode::kParallel)) {
+      continue;
+    }
+
+    library::KernelSelection selection;
+
+    selection.problem_size = {
+      result_argument_int(result, "m", 0),
+      result_argument_int(result, "n", 0),
+      result_argument_int(result, "k", 0)};
+
+    selection.batch_count = result_argument_int(result, "batch_count", 1);
+    selection.operation_name = result.operation_name;
+    selection.raster_order = library::from_string<library::RasterOrder>(result_argument(result, "raster_order"));
+    selection.swizzle_size = result_argument_int(result, "swizzle_size", 1);
+    selection.split_k_slices = result_argument_int(result, "split_k_slices", 1);
+    selection.cluster_shape = {
+      result_argument_int(result, "cluster_m", 0),
+      result_argument_int(result, "cluster_n", 0),
+      result_argument_int(result, "cluster_k", 0)};
+    selection.cluster_shape_fallback = {
+      result_argument_int(result, "cluster_m_fallback", 0),
+      result_argument_int(result, "cluster_n_fallback", 0),
+      result_argument_int(result, "cluster_k_fallback", 0)};
+    selection.runtime = result.runtime;
+
+    if (selection.raster_order == library::RasterOrder::kInvalid) {
+      selection.raster_order = library::RasterOrder::kHeuristic;
+    }
+
+    database.insert(key, selection);
+  }
+}
+
+} // namespace
+
 /// Entry point to profile all operations in the manifest
 int OperationProfiler::profile_all(
   Options const &options,
@@ -351,6 +451,8 @@ int OperationProfiler::profile_all(
   ProblemSpace cmdline_problem_space(arguments_, options.cmdline);
 
   bool do_testlist_run = !options.operation_problems.empty();
+  bool do_workload_run = !options.workload_problems.empty();
+  bool do_problem_list_run = do_testlist_run || do_workload_run;
 
   std::vector<std::pair<std::string, std::unique_ptr<ProblemSpace>>> all_operations_and_problems;
   if (do_testlist_run) {
@@ -360,18 +462,45 @@ int OperationProfiler::profile_all(
       }
     }
   }
+  else if (do_workload_run) {
+    // Workload trace problems apply to every kernel passing the name filters
+    for (auto const & workload_problem : options.workload_problems) {
+      all_operations_and_problems.push_back({std::string(), std::make_unique<ProblemSpace>(arguments_, workload_problem.cmdline)});
+    }
+  }
 
   // 1. Construct performance report
   PerformanceReport report(options, cmdline_problem_space.argument_names(), kind_);
 
+  // Frequency-weighted aggregation of results over the workload trace
+  WorkloadReport workload_report(options, kind_);
+
+  // Fastest GEMM kernel per problem bucket, exported for library::Handle
+  library::KernelSelectionDatabase kernel_selections;
+  bool do_kernel_selection_export = !options.report.kernel_selection_output_path.empty() &&
+    kind_ == library::OperationKind::kGemm;
+
+  // With pruning, candidates may be probed before verification so that pruned kernels are not
+  // verified. Workspaces are then prepared by verify_cutlass() with verification disabled, and
+  // only surviving kernels are verified after profiling.
+  bool do_verify_after_profile = options.profiling.pruning_enabled() &&
+    options.profiling.pruning_skip_verification && options.profiling.enabled;
+
+  Options unverified_options(options);
+  unverified_options.verification.enabled = false;
+
+  // Matched (operation, problem) pairs are dealt round-robin over the shards
+  bool do_shard_run = options.profiling.shard_index >= 0;
+  int64_t shard_work_item = 0;
+
   //
   int retval = 0;
 
   size_t bound = (all_operations_and_problems.empty() ? 1 : all_operations_and_problems.size());
   for (size_t i = 0; i < bound; i++) {
 
-    // New problem space for each operation if we are running a testlist
-    ProblemSpace& problem_space = do_testlist_run ? *all_operations_and_problems[i].second : cmdline_problem_space;
+    // New problem space for each operation if we are running a testlist, and for each row of a workload trace
+    ProblemSpace& problem_space = do_problem_list_run ? *all_operations_and_problems[i].second : cmdline_problem_space;
 
     // 2. For each problem in problem space
     ProblemSpace::Iterator problem_it = problem_space.begin();
@@ -384,6 +513,9 @@ int OperationProfiler::profile_all(
       ProblemSpace::Problem problem = problem_it.at();
       report.next_problem();
 
+      // Candidates for each problem race against the fastest kernel profiled for it
+      pruning_best_runtime_ = 0;
+
       // For each operation in manifest
       int matched_operation_count = 0;
       int profiled_operation_count = 0;
@@ -455,8 +587,9 @@ int OperationProfiler::profile_all(
             }
           }
 
-          // Problems list uses exact match on operation names
-          if (do_testlist_run && !(all_operations_and_problems[i].first == operation_name)) {
+          // Problems list uses exact match on operation names, workload trace rows apply to every operation
+          if (do_problem_list_run && !all_operations_and_problems[i].first.empty() &&
+              !(all_operations_and_problems[i].first == operation_name)) {
             filtered_by_name = false;
           }
 
@@ -467,6 +600,12 @@ int OperationProfiler::profile_all(
           // we have found a kernel match, so increment the counter for match kernels
           ++matched_operation_count;
 
+          // Work items belonging to other shards are profiled by other processes
+          if (do_shard_run &&
+              (shard_work_item++ % options.profiling.shard_count) != options.profiling.shard_index) {
+            continue;
+          }
+
           // A. Initialize configuration
           Status status = this->initialize_configuration(
             options,
@@ -528,7 +667,7 @@ int OperationProfiler::profile_all(
           if (continue_profiling && options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
 
             continue_profiling = this->verify_cutlass(
-              options,
+              do_verify_after_profile ? unverified_options : options,
               report,
               device_context,
               operation,
@@ -572,6 +711,55 @@ int OperationProfiler::profile_all(
 
             // Count op as profiled, even it failed to profile
             profiled_operation_count++;
+
+            // Verify kernels which survived pruning, preserving any profiling failure
+            if (continue_profiling && do_verify_after_profile &&
+                !results_.empty() && !results_.back().pruned &&
+                options.profiling.provider_enabled(library::Provider::kCUTLASS)) {
+
+              Status profile_status = results_.back().status;
+
+              continue_profiling = this->verify_cutlass(
+                options,
+                report,
+                device_context,
+                operation,
+                problem_space,
+                problem);
+
+              retval |= (not continue_profiling);
+
+              if (profile_status != Status::kSuccess) {
+                results_.back().status = profile_status;
+              }
+            }
+          }
+
+          if (options.report.roofline) {
+            Roofline roofline(options, operation->description());
+            for (auto &result : results_) {
+              roofline.apply(result);
+            }
+          }
+
+          if (options.report.kernel_resources) {
+            library::KernelResourceUsage usage;
+            if (operation->get_kernel_resources(&usage) == Status::kSuccess) {
+              for (auto &result : results_) {
+                if (result.provider == library::Provider::kCUTLASS) {
+                  result.has_kernel_resources = true;
+                  result.kernel_resources = usage;
+                }
+              }
+            }
+          }
+
+          if (do_workload_run) {
+            workload_report.append_results(i, results_);
+          }
+
+          if (do_kernel_selection_export) {
+            append_kernel_selections(kernel_selections, operation, results_);
           }
 
           report.append_results(results_);
@@ -595,7 +783,9 @@ int OperationProfiler::profile_all(
         continue_profiling = false;
       }
 
-      if (options.profiling.error_if_nothing_is_profiled && options.profiling.enabled && profiled_operation_count <= 0) {
+      // A shard may legitimately own none of the kernels matching this problem
+      if (options.profiling.error_if_nothing_is_profiled && options.profiling.enabled && !do_shard_run &&
+          profiled_operation_count <= 0) {
         #if !NDEBUG
         std::cerr << "Error: No kernels profiled found with kernel selection filters [--error_if_nothing_is_profiled]" << std::endl;
         #endif
@@ -607,6 +797,44 @@ int OperationProfiler::profile_all(
     } // for each problem in problem space
   }
 
+  if (do_workload_run && !workload_report.empty()) {
+    if (options.report.verbose) {
+      workload_report.print_summary(std::cout) << std::endl;
+    }
+
+    if (!options.report.output_path.empty()) {
+      std::string base_path = options.report.output_path;
+      base_path = base_path.substr(0, base_path.rfind(".csv"));
+      std::string file_name = base_path + "." + library::to_string(kind_) + ".workload.csv";
+
+      std::ofstream output_file(file_name);
+      if (output_file.good()) {
+        workload_report.print_csv(output_file);
+        if (options.report.verbose) {
+          std::cout << "\nWrote workload results to '" << file_name << "'" << std::endl;
+        }
+      }
+      else {
+        std::cerr << "Could not open workload output file at path '" << file_name << "'" << std::endl;
+      }
+    }
+  }
+
+  if (do_kernel_selection_export && !kernel_selections.empty()) {
+    std::ofstream output_file(options.report.kernel_selection_output_path);
+    if (output_file.good()) {
+      kernel_selections.write(output_file);
+      if (options.report.verbose) {
+        std::cout << "\nWrote " << kernel_selections.size() << " kernel selections to '"
+                  << options.report.kernel_selection_output_path << "'" << std::endl;
+      }
+    }
+    else {
+      std::cerr << "Could not open kernel selection output file at path '"
+                << options.report.kernel_selection_output_path << "'" << std::endl;
+    }
+  }
+
   return retval;
 }
 
@@ -637,34 +865,73 @@ Disposition OperationProfiler::compare_tensors(
     return Disposition::kIncorrect;
   }
 
-  bool passed = false;
-
   if (count == 0) {
     count = reference.capacity();
   }
 
-  if (options.verification.epsilon == 0) {
+  // Bit-level equality if epsilon is zero, relative error function otherwise. The comparison
+  // runs on the device in one pass; only its summary is copied back.
+  reference::device::BlockCompareSummary summary = DeviceAllocation::block_compare_summary(
+    experimental.type(),
+    experimental.data(),
+    reference.data(),
+    count,
+    options.verification.epsilon != 0,
+    options.verification.epsilon,
+    options.verification.nonzero_floor);
 
-    // bit-level equality
-    passed = DeviceAllocation::block_compare_equal(
-      experimental.type(),
-      experimental.data(),
-      reference.data(),
-      count);
+  if (!summary.passed() && options.report.verbose) {
+    print_compare_summary(std::cout, summary, experimental);
   }
-  else {
 
-    // relative error function
-    passed = DeviceAllocation::block_compare_relatively_equal(
-      experimental.type(),
-      experimental.data(),
-      reference.data(),
-      count,
-      options.verification.epsilon,
-      options.verification.nonzero_floor);
+  return summary.passed() ? Disposition::kPassed : Disposition::kIncorrect;
+}
+
+/// Prints the mismatch count, largest errors, and recorded mismatching coordinates of a comparison
+void OperationProfiler::print_compare_summary(
+  std::ostream &out,
+  reference::device::BlockCompareSummary const &summary,
+  DeviceAllocation const &allocation) {
+
+  out << "\n         Mismatches: " << summary.mismatch_count << " of " << summary.capacity
+      << " elements (max abs error: " << summary.max_abs_error
+      << ", max rel error: " << summary.max_rel_error << ")\n";
+
+  if (!summary.recorded_mismatches) {
+    return;
   }
 
-  return passed ? Disposition::kPassed : Disposition::kIncorrect;
+  // Coordinates are (batch, row, column) for matrices and linear offsets otherwise
+  bool is_matrix = allocation.stride().size() == 1 &&
+    (allocation.layout() == library::LayoutTypeID::kRowMajor ||
+     allocation.layout() == library::LayoutTypeID::kColumnMajor);
+
+  int64_t batch_stride = (allocation.batch_stride() ? allocation.batch_stride() : int64_t(summary.capacity));
+
+  out << "   Mismatching elements:";
+
+  for (int i = 0; i < summary.recorded_mismatches; ++i) {
+    int64_t idx = int64_t(summary.mismatch_index[i]);
+
+    if (is_matrix) {
+      int64_t ld = allocation.stride().front();
+      int64_t batch = idx / batch_stride;
+      int64_t offset = idx % batch_stride;
+      int64_t row = (allocation.layout() == library::LayoutTypeID::kRowMajor) ? offset / ld : offset % ld;
+      int64_t column = (allocation.layout() == library::LayoutTypeID::kRowMajor) ? offset % ld : offset / ld;
+
+      out << " (" << batch << ", " << row << ", " << column << ")";
+    }
+    else {
+      out << " " << idx;
+    }
+  }
+
+  if (summary.mismatch_count > static_cast<unsigned long long>(summary.recorded_mismatches)) {
+    out << " ...";
+  }
+
+  out << "\n";
 }
 
 /// Saves the workspace
@@ -750,6 +1017,144 @@ Status predict_iters(
   return Status::kSuccess;
 };
 
+/// Estimates the runtime of `func` from a few launches, used to race candidates before
+/// spending full profiling iterations on them
+Status probe_runtime(
+  double &runtime,
+  Options const &options,
+  std::function<Status(cudaStream_t, int)> const &func,
+  cudaStream_t stream) {
+
+  // One untimed launch absorbs first-launch overheads such as module loading
+  Status status = func(stream, 0);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  GpuTimer timer;
+  timer.start(stream);
+  for (int iteration = 0; iteration < options.profiling.pruning_iterations; ++iteration) {
+    status = func(stream, iteration);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+  }
+  timer.stop_and_wait(stream);
+
+  runtime = timer.duration(options.profiling.pruning_iterations);
+  return Status::kSuccess;
+}
+
+/// Keeps the devices busy for at least the sustained duration and then until clocks and temperature
+/// have settled, judged by batches of launches taking the same time, before the kernel is timed
+Status sustain_load(
+  Options const &options,
+  std::function<Status(int, cudaStream_t, int)> const &func,
+  std::vector<cudaStream_t> const &streams) {
+
+  // Launches are enqueued in batches so that the host does not run far ahead of the devices
+  constexpr int kLaunchesPerBatch = 64;
+
+  // Settled once the last kSettleBatches batch times are within kSettleTolerance of their mean.
+  // Throttling keeps changing them, so the load gives up after kMaxDurationFactor times the duration.
+  constexpr int kSettleBatches = 8;
+  constexpr double kSettleTolerance = 0.02;
+  constexpr int kMaxDurationFactor = 4;
+
+  using Clock = std::chrono::steady_clock;
+
+  auto start = Clock::now();
+  auto duration = std::chrono::milliseconds(options.profiling.sustained_duration);
+
+  std::vector<double> batch_times;
+
+  auto settled = [&]() {
+    if (int(batch_times.size()) < kSettleBatches) {
+      return false;
+    }
+    auto first = batch_times.end() - kSettleBatches;
+    double mean = 0;
+    for (auto it = first; it != batch_times.end(); ++it) {
+      mean += *it / kSettleBatches;
+    }
+    for (auto it = first; it != batch_times.end(); ++it) {
+      if (std::abs(*it - mean) > kSettleTolerance * mean) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  for (int iteration = 0; ; iteration += kLaunchesPerBatch) {
+    auto elapsed = Clock::now() - start;
+    if (elapsed >= duration && settled()) {
+      break;
+    }
+    if (elapsed >= kMaxDurationFactor * duration) {
+      std::cerr << "WARNING: batch times did not settle within " << kMaxDurationFactor
+                << " times --sustained-duration." << std::endl;
+      break;
+    }
+
+    auto batch_start = Clock::now();
+    for (size_t i = 0; i < streams.size(); ++i) {
+      if (streams.size() > 1) {
+        CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+      }
+      for (int launch = 0; launch < kLaunchesPerBatch; ++launch) {
+        Status status = func(int(i), streams[i], iteration + launch);
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+    }
+    for (size_t i = 0; i < streams.size(); ++i) {
+      if (streams.size() > 1) {
+        CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+      }
+      CUDA_CHECK(cudaStreamSynchronize(streams[i]));
+    }
+    batch_times.push_back(std::chrono::duration<double>(Clock::now() - batch_start).count());
+  }
+
+  return Status::kSuccess;
+}
+
+/// Returns a monitor for the first device_count profiled devices if --power-sampling is enabled
+std::unique_ptr<PowerMonitor> make_power_monitor(Options const &options, size_t device_count) {
+
+  if (!options.profiling.power_sampling) {
+    return nullptr;
+  }
+
+  if (!PowerMonitor::available()) {
+    static bool warned = false;
+    if (!warned) {
+      std::cerr << "WARNING: --power-sampling requires a profiler built with NVML. "
+                << "Clock and power are not reported." << std::endl;
+      warned = true;
+    }
+    return nullptr;
+  }
+
+  std::vector<int> devices;
+  for (size_t i = 0; i < device_count; ++i) {
+    devices.push_back(options.device.device_id(i));
+  }
+
+  return std::unique_ptr<PowerMonitor>(new PowerMonitor(devices, options.profiling.power_sample_interval));
+}
+
+/// Stores telemetry sampled while the kernel was timed
+void set_power_sample(PerformanceResult &result, PowerSample const &sample) {
+  if (sample.good()) {
+    result.sm_clock_mhz = sample.sm_clock_mhz;
+    result.sm_clock_max_mhz = sample.sm_clock_max_mhz;
+    result.power_watts = sample.power_watts;
+    result.temperature_c = sample.temperature_c;
+  }
+}
+
 } // namespace
 
 /// This profiling method is designed to run a kernel on several GPUs to
@@ -764,9 +1169,21 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
   PerformanceResult& result,
   Options const& options,
   std::function<Status(int, cudaStream_t, int)> const& func,
-  std::vector<cudaStream_t> const& streams) {
+  std::vector<cudaStream_t> const& launch_streams) {
+
+  auto dev_count = launch_streams.size();
 
-  auto dev_count = streams.size();
+  // The legacy default stream cannot be captured, so launches destined for it are captured
+  // on a temporary non-blocking stream of the same device
+  std::vector<cudaStream_t> streams(launch_streams);
+  std::vector<size_t> capture_stream_devices;
+  for (size_t i = 0; i < dev_count; ++i) {
+    if (streams[i] == nullptr) {
+      CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+      CUDA_CHECK(cudaStreamCreateWithFlags(&streams[i], cudaStreamNonBlocking));
+      capture_stream_devices.push_back(i);
+    }
+  }
 
   cuda::atomic<bool> *release;
 
@@ -800,6 +1217,13 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
     return status;
   }
 
+  if (options.profiling.sustained_duration > 0) {
+    status = sustain_load(options, func, streams);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+  }
+
   for (size_t i = 0; i < dev_count; ++i) {
     CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
     CUDA_CHECK(cudaStreamBeginCapture(streams[i], cudaStreamCaptureModeGlobal));
@@ -829,6 +1253,11 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
     CUDA_CHECK(cudaGraphInstantiate(&graphExecs[i], graphs[i], nullptr, nullptr, 0));
   }
 
+  std::unique_ptr<PowerMonitor> power_monitor = make_power_monitor(options, dev_count);
+  if (power_monitor) {
+    power_monitor->start();
+  }
+
   for (size_t i = 0; i < dev_count; ++i) {
     CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
     CUDA_CHECK(cudaGraphLaunch(graphExecs[i], streams[i]));
@@ -844,6 +1273,10 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
     CUDA_CHECK(cudaStreamSynchronize(streams[i]));
   }
 
+  if (power_monitor) {
+    set_power_sample(result, power_monitor->stop());
+  }
+
   result.runtime = 0;
   for (size_t i = 0; i < dev_count; ++i) {
     CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
@@ -867,6 +1300,11 @@ Status OperationProfiler::profile_kernel_w_cuda_graphs_(
     timer.pop_back();
   }
 
+  for (size_t i : capture_stream_devices) {
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(i)));
+    CUDA_CHECK(cudaStreamDestroy(streams[i]));
+  }
+
   return Status::kSuccess;
 }
 
@@ -876,16 +1314,85 @@ Status OperationProfiler::profile_kernel_(
   const std::function<Status(int, cudaStream_t, int)> &func,
   const std::vector<cudaStream_t> &streams) {
 
-  if (options.profiling.use_cuda_graphs) {
-    return profile_kernel_w_cuda_graphs_(result, options, func, streams);
-  }
-  else if (streams.size() == 1) {
-    auto single_device_func = [&](cudaStream_t stream, int iteration) {
+  // A kernel of a sequence is timed on its own, then the sequence continues with the remaining
+  // steps while this launch function is still valid
+  if (sequence_capture_ && streams.size() == 1) {
+    SequenceCapture *capture = sequence_capture_;
+    sequence_capture_ = nullptr;
+
+    Status status = profile_kernel_(result, options, func, streams);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    capture->launches.push_back([&func](cudaStream_t stream, int iteration) {
       return func(0, stream, iteration);
-    };
-    return profile_kernel_no_cuda_graphs_(result, options, single_device_func, streams[0]);
+    });
+
+    // The next step replaces capture->next
+    auto next = capture->next;
+    return next();
   }
-  return Status::kErrorNotSupported;
+
+  auto measure = [&](PerformanceResult &measured_result, std::function<Status(int, cudaStream_t, int)> const &measured_func) {
+    if (options.profiling.use_cuda_graphs) {
+      return profile_kernel_w_cuda_graphs_(measured_result, options, measured_func, streams);
+    }
+    else if (streams.size() == 1) {
+      auto single_device_func = [&](cudaStream_t stream, int iteration) {
+        return measured_func(0, stream, iteration);
+      };
+      return profile_kernel_no_cuda_graphs_(measured_result, options, single_device_func, streams[0]);
+    }
+    return Status::kErrorNotSupported;
+  };
+
+  // Launch functions select the workspace copy from the iteration index. Holding the index
+  // fixed relaunches on the same operands, which remain resident in L2 across iterations.
+  auto hot_func = [&](int dev_id, cudaStream_t stream, int) {
+    return func(dev_id, stream, 0);
+  };
+
+  std::function<Status(int, cudaStream_t, int)> measured_func = func;
+  if (options.profiling.cache_mode == CacheMode::kHot) {
+    measured_func = hot_func;
+  }
+
+  // Race the candidate against the fastest kernel fully profiled for this problem so far
+  if (options.profiling.pruning_enabled() && pruning_best_runtime_ > 0) {
+    double probe = 0;
+    CUDA_CHECK(cudaSetDevice(options.device.device_id(0)));
+    Status status = probe_runtime(
+      probe,
+      options,
+      [&](cudaStream_t stream, int iteration) { return measured_func(0, stream, iteration); },
+      streams[0]);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    if (probe > pruning_best_runtime_ * (1 + options.profiling.pruning_margin)) {
+      result.runtime = probe;
+      result.runtime_vector.assign(streams.size(), probe);
+      result.pruned = true;
+      return Status::kSuccess;
+    }
+  }
+
+  Status status = measure(result, measured_func);
+
+  if (status == Status::kSuccess && options.profiling.cache_mode == CacheMode::kBoth) {
+    PerformanceResult hot_result(result);
+    status = measure(hot_result, hot_func);
+    result.runtime_hot = hot_result.runtime;
+  }
+
+  if (status == Status::kSuccess && result.good() &&
+      (pruning_best_runtime_ <= 0 || result.runtime < pruning_best_runtime_)) {
+    pruning_best_runtime_ = result.runtime;
+  }
+
+  return status;
 }
 
 /// Method to profile GPU execution time of a kernel launched in func
@@ -895,15 +1402,120 @@ Status OperationProfiler::profile_kernel_(
   std::function<Status(cudaStream_t, int)> const& func,
   cudaStream_t stream) {
 
-  if (options.profiling.use_cuda_graphs) {
-    auto graph_func = [&](int dev_id, cudaStream_t stream, int iteration) {
-      return func(stream, iteration);
-    };
-    return profile_kernel_w_cuda_graphs_(result, options, graph_func, {stream});
-  } else {
-    return profile_kernel_no_cuda_graphs_(result, options, func, stream);
+  auto device_func = [&](int dev_id, cudaStream_t stream, int iteration) {
+    return func(stream, iteration);
+  };
+  return profile_kernel_(result, options, device_func, std::vector<cudaStream_t>{stream});
+}
+
+/// Method to profile concurrent launches of a kernel across several streams of one device
+Status OperationProfiler::profile_kernel_concurrent_(
+  PerformanceResult& result,
+  Options const& options,
+  std::function<Status(int, cudaStream_t, int)> const& func,
+  std::vector<cudaStream_t> const& streams) {
+
+  // Every launch boundary is recorded as an event, so bound the number of iterations
+  constexpr int kMaxConcurrentIterations = 1000;
+
+  int stream_count = int(streams.size());
+
+  sleep(options.profiling.sleep_duration);
+
+  int iterations;
+  Status status = predict_iters(
+    iterations,
+    options,
+    [&](cudaStream_t stream, int iter) { return func(0, stream, iter * stream_count); },
+    streams[0]);
+  if (status != Status::kSuccess) {
+    return status;
   }
-  return Status::kSuccess;
+  iterations = std::max(1, std::min(iterations, kMaxConcurrentIterations));
+
+  for (int iteration = 0; iteration < options.profiling.warmup_iterations; ++iteration) {
+    for (int s = 0; s < stream_count; ++s) {
+      status = func(s, streams[s], iteration * stream_count + s);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+  }
+
+  for (auto stream : streams) {
+    CUDA_CHECK(cudaStreamSynchronize(stream));
+  }
+
+  // Fork: all streams wait on a common start event so their first launches coincide
+  GpuTimer timer;
+  timer.start(streams[0]);
+
+  // Destroys the join events on every return path, including a failed launch
+  struct JoinEvents {
+    std::vector<cudaEvent_t> events;
+
+    explicit JoinEvents(int count): events(count, nullptr) {}
+
+    ~JoinEvents() {
+      for (auto event : events) {
+        if (event != nullptr) {
+          (void)cudaEventDestroy(event);
+        }
+      }
+    }
+  } join_events(stream_count);
+
+  for (int s = 0; s < stream_count; ++s) {
+    CUDA_CHECK(cudaEventCreateWithFlags(&join_events.events[s], cudaEventDisableTiming));
+    if (s) {
+      CUDA_CHECK(cudaStreamWaitEvent(streams[s], timer.events[0], 0));
+    }
+  }
+
+  std::vector<GpuLaunchTimer> launch_timers;
+  launch_timers.reserve(stream_count);
+  for (int s = 0; s < stream_count; ++s) {
+    launch_timers.emplace_back(iterations);
+  }
+
+  // Launches are interleaved across streams from the host so that all streams progress together
+  int launch_base = options.profiling.warmup_iterations * stream_count;
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    for (int s = 0; s < stream_count; ++s) {
+      launch_timers[s].record(iteration, streams[s]);
+      status = func(s, streams[s], launch_base + iteration * stream_count + s);
+      if (status != Status::kSuccess) {
+        result.status = status;
+        return status;
+      }
+    }
+  }
+
+  for (int s = 0; s < stream_count; ++s) {
+    launch_timers[s].record(iterations, streams[s]);
+  }
+
+  // Join: the stop event on the first stream completes after every stream has drained
+  for (int s = 1; s < stream_count; ++s) {
+    CUDA_CHECK(cudaEventRecord(join_events.events[s], streams[s]));
+    CUDA_CHECK(cudaStreamWaitEvent(streams[0], join_events.events[s], 0));
+  }
+  timer.stop_and_wait(streams[0]);
+
+  result.concurrent_streams = stream_count;
+  result.concurrent_runtime = timer.duration(iterations);
+  result.concurrent_tail_latency = 0;
+
+  for (int s = 0; s < stream_count; ++s) {
+    std::vector<double> latencies = launch_timers[s].durations();
+    std::sort(latencies.begin(), latencies.end());
+
+    result.concurrent_tail_latency = std::max(
+      result.concurrent_tail_latency, PerformanceResult::percentile(latencies, 0.99));
+  }
+
+  result.status = status;
+  return status;
 }
 
 /// Method to profile GPU execution time of a kernel launched in func
@@ -932,10 +1544,39 @@ Status OperationProfiler::profile_kernel_no_cuda_graphs_(
     }
   }
 
+  if (options.profiling.sustained_duration > 0) {
+    status = sustain_load(
+      options,
+      [&](int, cudaStream_t stream, int iteration) { return func(stream, iteration); },
+      std::vector<cudaStream_t>{stream});
+    if (status != Status::kSuccess) {
+      return status;
+    }
+  }
+
+  // Per-launch latencies are sampled from the leading iterations of the timed loop
+  constexpr int kMaxLatencySamples = 100000;
+
+  std::unique_ptr<GpuLaunchTimer> launch_timer;
+  int latency_samples = 0;
+  if (options.profiling.latency_percentiles) {
+    latency_samples = std::min(iterations, kMaxLatencySamples);
+    launch_timer.reset(new GpuLaunchTimer(latency_samples));
+  }
+
+  std::unique_ptr<PowerMonitor> power_monitor = make_power_monitor(options, 1);
+  if (power_monitor) {
+    power_monitor->start();
+  }
+
   timer.start(stream);
 
   int iteration = 0;
   for (; iteration < iterations; ++iteration) {
+    if (launch_timer && iteration <= latency_samples) {
+      launch_timer->record(iteration, stream);
+    }
+
     status = func(stream, iteration + options.profiling.warmup_iterations);
 
     if (status != Status::kSuccess) {
@@ -944,11 +1585,23 @@ Status OperationProfiler::profile_kernel_no_cuda_graphs_(
     }
   }
 
+  if (launch_timer && iteration == latency_samples) {
+    launch_timer->record(latency_samples, stream);
+  }
+
   timer.stop_and_wait(stream);
 
+  if (power_monitor) {
+    set_power_sample(result, power_monitor->stop());
+  }
+
   result.runtime = timer.duration(iteration);
   result.status  = status;
 
+  if (launch_timer) {
+    result.set_latencies(launch_timer->durations());
+  }
+
   return status;
 }
 
@@ -961,7 +1614,9 @@ Status OperationProfiler::profile_cutlass_(
   void *host_workspace,
   void *device_workspace) {
 
-  auto op = [=](cudaStream_t, int) { return operation->run(arguments, host_workspace, device_workspace); };
+  auto op = [=](cudaStream_t stream, int) {
+    return operation->run(arguments, host_workspace, device_workspace, stream);
+  };
   return profile_kernel_(result, options, op);
 }
 
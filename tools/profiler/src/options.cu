@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <fstream>
 #include <set>
+#include <sstream>
 
 #include "cutlass/cutlass.h"
 #include "cutlass/version.h"
@@ -144,6 +145,10 @@ Options::Device::Device(cutlass::CommandLine const &cmdline) {
     // Permit overriding the sm_count
     cmdline.get_cmd_line_argument("sm-count", sm_count, 0);
   }
+
+  // Permit overriding the peaks of the roofline
+  cmdline.get_cmd_line_argument("peak-gflops", peak_gflops, 0.0);
+  cmdline.get_cmd_line_argument("peak-bandwidth", peak_bandwidth, 0.0);
 }
 
 int Options::Device::get_sm_count(int device_index) const {
@@ -199,7 +204,13 @@ void Options::Device::print_usage(std::ostream &out) const {
      << "  --sm-count=<int>                             "
      << "    Override the number of SMs. This is used to limit the number of " << end_of_line
      << "      during profiling. If this is set, profiling attempts to limit the sm_count " << end_of_line
-     << "      to user-set value. This is not possible on all architectures and all kernel types. \n\n";
+     << "      to user-set value. This is not possible on all architectures and all kernel types. \n\n"
+
+    << "  --peak-gflops=<float>                        "
+    << "    Override the peak math throughput (GFLOP/s) bounding the roofline.\n\n"
+
+    << "  --peak-bandwidth=<float>                     "
+    << "    Override the peak DRAM bandwidth (GiB/s) bounding the roofline.\n\n";
 
 }
 
@@ -497,9 +508,37 @@ Options::Profiling::Profiling(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("profiling-duration", duration, 10);
   cmdline.get_cmd_line_argument("min-iterations", min_iterations, 10);
   cmdline.get_cmd_line_argument("use-cuda-graphs", use_cuda_graphs, false);
+  cmdline.get_cmd_line_argument("latency-percentiles", latency_percentiles, false);
+  cmdline.get_cmd_line_argument("power-sampling", power_sampling, false);
+  cmdline.get_cmd_line_argument("power-sample-interval", power_sample_interval, 10);
+  cmdline.get_cmd_line_argument("sustained-duration", sustained_duration, 0);
+  cmdline.get_cmd_line_argument("pruning-margin", pruning_margin, 0.0);
+  cmdline.get_cmd_line_argument("pruning-iterations", pruning_iterations, 5);
+  cmdline.get_cmd_line_argument("pruning-skip-verification", pruning_skip_verification, false);
+  if (pruning_margin < 0 || pruning_iterations < 1) {
+    throw std::runtime_error("Invalid --pruning-margin or --pruning-iterations");
+  }
+  cmdline.get_cmd_line_argument("shard-count", shard_count, 1);
+  cmdline.get_cmd_line_argument("shard-index", shard_index, -1);
+  if (shard_count < 1 || shard_index >= shard_count) {
+    throw std::runtime_error("Invalid --shard-index/--shard-count: " +
+      std::to_string(shard_index) + "/" + std::to_string(shard_count));
+  }
+  cmdline.get_cmd_line_argument("concurrent-streams", concurrent_streams, 1);
+  cmdline.get_cmd_line_argument("concurrent-sm-partition", concurrent_sm_partition, false);
+  concurrent_streams = std::max(concurrent_streams, 1);
   cmdline.get_cmd_line_argument("enable-kernel-performance-search", enable_kernel_performance_search, false);
   cmdline.get_cmd_line_argument("enable-best-kernel-for-fixed-shape", enable_best_kernel_for_fixed_shape, false);
 
+  if (cmdline.check_cmd_line_flag("cache-mode")) {
+    std::string token;
+    cmdline.get_cmd_line_argument("cache-mode", token);
+    cache_mode = from_string<CacheMode>(token);
+    if (cache_mode == CacheMode::kInvalid) {
+      throw std::runtime_error("Invalid --cache-mode: " + token);
+    }
+  }
+
   if (cmdline.check_cmd_line_flag("providers")) {
 
     std::vector<std::string> tokens;
@@ -527,6 +566,12 @@ void Options::Profiling::print_usage(std::ostream &out) const {
     << "    If zero (default), the amount is chosen for each workload based on " << end_of_line
     << "    capacity of the last-level cache.\n\n"
 
+    << "  --cache-mode=<mode>                          "
+    << "    State of the L2 cache in which kernels are timed {cold*, hot, both}." << end_of_line
+    << "       --cache-mode=cold  rotate through workspaces sized from the L2 capacity" << end_of_line
+    << "       --cache-mode=hot   relaunch on a single workspace so operands stay L2 resident" << end_of_line
+    << "       --cache-mode=both  report both runtimes and flag kernels whose ranking flips\n\n"
+
     << "  --profiling-iterations=<iterations>          "
     << "    Number of iterations to profile each kernel. If zero, kernels" << end_of_line
     << "      are launched up to the profiling duration. If non-zero, this overrides" << end_of_line
@@ -544,6 +589,53 @@ void Options::Profiling::print_usage(std::ostream &out) const {
     << "  --warmup-iterations=<iterations>             "
     << "    Number of iterations to execute each kernel prior to profiling.\n\n"
 
+    << "  --latency-percentiles=<bool>                 "
+    << "    If true, times each launch individually and reports p50/p90/p99/max latency" << end_of_line
+    << "      and jitter (standard deviation / mean). Not measured with --use-cuda-graphs.\n\n"
+
+    << "  --power-sampling=<bool>                      "
+    << "    If true, samples SM clock, power, and temperature through NVML while each kernel" << end_of_line
+    << "      is timed and reports TFLOP/s per watt and throughput normalized to the maximum SM clock." << end_of_line
+    << "      Requires a profiler built with NVML.\n\n"
+
+    << "  --power-sample-interval=<ms>                 "
+    << "    Period between NVML samples (ms).\n\n"
+
+    << "  --sustained-duration=<ms>                    "
+    << "    Minimum time to run each kernel before it is timed (ms). The load then continues until" << end_of_line
+    << "      consecutive batches of launches take the same time, as clocks and temperature settle," << end_of_line
+    << "      for at most four times this duration. Consider --sleep-duration=0 to avoid cooling between kernels.\n\n"
+
+    << "  --concurrent-streams=<int>                   "
+    << "    Number of streams on which copies of each GEMM are launched concurrently." << end_of_line
+    << "      Reports aggregate throughput and the worst per-stream p99 launch latency.\n\n"
+
+    << "  --concurrent-sm-partition=<bool>             "
+    << "    If true, each concurrent stream's kernel is limited to an equal share of" << end_of_line
+    << "      the device's SMs (for kernels honoring KernelHardwareInfo::sm_count).\n\n"
+
+    << "  --pruning-margin=<float>                     "
+    << "    If nonzero, each candidate is first timed for a few iterations and pruned without" << end_of_line
+    << "      full profiling if it is slower than the fastest kernel so far for the problem" << end_of_line
+    << "      by more than this relative margin (e.g. 0.1 for 10%). Not applied with" << end_of_line
+    << "      --enable-kernel-performance-search.\n\n"
+
+    << "  --pruning-iterations=<int>                   "
+    << "    Number of timed iterations used to decide whether a candidate is pruned.\n\n"
+
+    << "  --pruning-skip-verification=<bool>           "
+    << "    If true, candidates are probed before verification and pruned kernels are" << end_of_line
+    << "      not verified.\n\n"
+
+    << "  --shard-count=<int>                          "
+    << "    Distributes the (operation x problem) space over this many shards. Without" << end_of_line
+    << "      --shard-index, one profiler process is launched per shard on the selected" << end_of_line
+    << "      devices (all visible devices if --devices is omitted) and their --output" << end_of_line
+    << "      reports are merged. Requires --output.\n\n"
+
+    << "  --shard-index=<int>                          "
+    << "    Profiles only the work items of this shard (0 <= index < shard-count).\n\n"
+
     << "  --sleep-duration=<duration>                  "
     << "    Number of ms to sleep between profiling periods (ms).\n\n"
 
@@ -560,6 +652,13 @@ void Options::Profiling::print_options(std::ostream &out, int indent) const {
 
   out
     << indent_str(indent) << "profiling_iterations: " << iterations << "\n"
+    << indent_str(indent) << "cache_mode: " << to_string(cache_mode) << "\n"
+    << indent_str(indent) << "latency_percentiles: " << latency_percentiles << "\n"
+    << indent_str(indent) << "power_sampling: " << power_sampling << "\n"
+    << indent_str(indent) << "sustained_duration: " << sustained_duration << "\n"
+    << indent_str(indent) << "pruning_margin: " << pruning_margin << "\n"
+    << indent_str(indent) << "shard: " << shard_index << "/" << shard_count << "\n"
+    << indent_str(indent) << "concurrent_streams: " << concurrent_streams << "\n"
     << indent_str(indent) << "sleep_duration: " << sleep_duration << "\n"
     << indent_str(indent) << "profiling_enabled: " << enabled << "\n"
     << indent_str(indent) << "providers: [";
@@ -576,6 +675,13 @@ bool Options::Profiling::provider_enabled(library::Provider provider) const {
   return std::find(providers.begin(), providers.end(), provider) != providers.end();
 }
 
+/// Returns true if candidates are raced against the fastest kernel for each problem. Kernel
+/// performance search profiles several problem shapes per candidate, whose runtimes are not
+/// comparable, so pruning does not apply to it.
+bool Options::Profiling::pruning_enabled() const {
+  return pruning_margin > 0 && !enable_kernel_performance_search;
+}
+
 /// Returns the index of a provider if its enabled
 size_t Options::Profiling::index(library::Provider provider) const {
   size_t idx = 0;
@@ -604,6 +710,8 @@ Options::Verification::Verification(cutlass::CommandLine const &cmdline) {
 
   cmdline.get_cmd_line_argument("nonzero-floor", nonzero_floor, 1.0 / 256.0);
 
+  cmdline.get_cmd_line_argument("verification-sample-tiles", sample_tiles, 0);
+
   if (cmdline.check_cmd_line_flag("save-workspace")) {
     std::string value;
     cmdline.get_cmd_line_argument("save-workspace", value);
@@ -659,6 +767,11 @@ void Options::Verification::print_usage(std::ostream &out) const {
     << "    List of providers used to verify result. (default: '*')" << end_of_line
     << "      Gemm verification-providers {cublas*}" << end_of_line
     << "      Conv2d verification-providers {cudnn*, device*, host}"
+    << "\n\n"
+
+    << "  --verification-sample-tiles=<int>            "
+    << "    Number of pseudo-randomly chosen output tiles per batch (64x32 elements each)" << end_of_line
+    << "      the device reference computes and checks for GEMMs. 0 (default) checks the whole output."
     << "\n\n";
 }
 
@@ -667,6 +780,7 @@ void Options::Verification::print_options(std::ostream &out, int indent) const {
   out
     << indent_str(indent) << "verification_enabled: " << enabled << "\n"
     << indent_str(indent) << "epsilon: " << epsilon << "\n"
+    << indent_str(indent) << "sample_tiles: " << sample_tiles << "\n"
     << indent_str(indent) << "save_workspace: " << to_string(save_workspace) << "\n"
     << indent_str(indent) << "verification_providers: [";
 
@@ -701,6 +815,7 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("append", append, false);
   cmdline.get_cmd_line_argument("output", output_path);
   cmdline.get_cmd_line_argument("junit-output", junit_output_path);
+  cmdline.get_cmd_line_argument("kernel-selection-output", kernel_selection_output_path);
 
   if (cmdline.check_cmd_line_flag("tags")) {
     cmdline.get_cmd_line_argument_pairs("tags", pivot_tags);
@@ -715,6 +830,10 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("sort-results-flops-per-sec", sort_flops_per_sec, false);
 
   cmdline.get_cmd_line_argument("print-kernel-before-running", print_kernel_before_running, false);
+
+  cmdline.get_cmd_line_argument("roofline", roofline, false);
+
+  cmdline.get_cmd_line_argument("kernel-resources", kernel_resources, false);
 }
 
 void Options::Report::print_usage(std::ostream &out) const {
@@ -731,10 +850,22 @@ void Options::Report::print_usage(std::ostream &out) const {
     << "  --junit-output=<path>                        "
     << "    Path to junit output file for result reporting. Operation kind and '.junit.xml' is appended.\n\n"
 
+    << "  --kernel-selection-output=<path>             "
+    << "    Path to a JSON database recording the fastest GEMM kernel and its runtime arguments" << end_of_line
+    << "      for each bucket of problem sizes. Load it with library::Handle::load_kernel_selection_database().\n\n"
+
     << "  --print-kernel-before-running=<bool>                "
     << "    Prints the name of the kernel being profiled before running the kernel." << end_of_line
     << "      This is useful for determining which kernel is causing a run of the profiler to hang\n\n"
 
+    << "  --roofline=<bool>                            "
+    << "    If true, reports the throughput attainable at each problem's arithmetic intensity," << end_of_line
+    << "      the fraction of it achieved, and whether the problem is memory or compute bound.\n\n"
+
+    << "  --kernel-resources=<bool>                    "
+    << "    If true, reports the registers per thread, local memory (spills) per thread," << end_of_line
+    << "      static and dynamic shared memory, CTAs per SM and active clusters of each kernel.\n\n"
+
     << "  --report-not-run=<bool>                      "
     << "    If true, reports the status of all kernels including those that" << end_of_line
     << "      do not satisfy the given arguments.\n\n"
@@ -756,8 +887,11 @@ void Options::Report::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "append: " << append << "\n"
     << indent_str(indent) << "output: " << output_path << "\n"
     << indent_str(indent) << "junit-output: " << junit_output_path << "\n"
+    << indent_str(indent) << "kernel-selection-output: " << kernel_selection_output_path << "\n"
     << indent_str(indent) << "print-kernel-before-running: " << print_kernel_before_running << "\n"
     << indent_str(indent) << "report-not-run: " << report_not_run << "\n"
+    << indent_str(indent) << "roofline: " << roofline << "\n"
+    << indent_str(indent) << "kernel-resources: " << kernel_resources << "\n"
     << indent_str(indent) << "tags:\n";
 
   for (auto const & tag : pivot_tags) {
@@ -901,6 +1035,109 @@ Options::Options(cutlass::CommandLine const &cmdline):
     }
   }
 
+  if (cmdline.check_cmd_line_flag("workload-trace")) {
+    // Workload trace is a CSV where each row is a problem observed in production. The columns
+    // 'count' and 'stream' are the frequency of the problem and the stream it was issued on.
+    // All other columns are problem arguments, which override those given on the command line.
+    if (!operation_problems.empty()) {
+      throw std::runtime_error("--workload-trace cannot be combined with --testlist-file");
+    }
+    if (profiling.shard_count > 1) {
+      throw std::runtime_error("--workload-trace cannot be combined with --shard-count");
+    }
+
+    std::string filename;
+    cmdline.get_cmd_line_argument("workload-trace", filename, {});
+    std::ifstream input(filename);
+    if (!input.good()) {
+      throw std::runtime_error("failed to open: " + filename);
+    }
+
+    std::unordered_map<std::string, std::string> default_arguments;
+    for (size_t i = 0; i < cmdline.keys.size(); ++i) {
+      default_arguments[cmdline.keys[i]] = cmdline.values[i];
+    }
+
+    std::string line;
+    std::vector<std::string> col_names;
+    if (std::getline(input, line)) {
+      std::stringstream ss(line);
+      std::string header;
+      while (std::getline(ss, header, ',')) {
+        col_names.push_back(header);
+      }
+    }
+
+    while (std::getline(input, line)) {
+      if (line.empty() || line[0] == '#') {
+        continue;
+      }
+
+      std::stringstream ss(line);
+      std::string item;
+      std::unordered_map<std::string, std::string> arguments(default_arguments);
+      int64_t count = 1;
+      int stream = 0;
+
+      for (size_t colIdx = 0; std::getline(ss, item, ',') && colIdx < col_names.size(); ++colIdx) {
+        if (col_names[colIdx] == "count") {
+          count = std::stoll(item);
+        }
+        else if (col_names[colIdx] == "stream") {
+          stream = std::stoi(item);
+        }
+        else if (!item.empty()) {
+          arguments[col_names[colIdx]] = item;
+        }
+      }
+
+      if (count <= 0) {
+        continue;
+      }
+
+      workload_problems.push_back({CommandLine(arguments), count, stream});
+    }
+
+    if (workload_problems.empty()) {
+      throw std::runtime_error("no problems found in workload trace: " + filename);
+    }
+  }
+
+  cmdline.get_cmd_line_argument("workload-kernel-set-size", workload_kernel_set_size, 1);
+  workload_kernel_set_size = std::max(workload_kernel_set_size, 1);
+
+  if (cmdline.check_cmd_line_flag("sequence-file")) {
+    // Each non-empty line not starting with '#' is the command line of one step of the sequence
+    std::string filename;
+    cmdline.get_cmd_line_argument("sequence-file", filename, {});
+    std::ifstream input(filename);
+    if (!input.good()) {
+      throw std::runtime_error("failed to open: " + filename);
+    }
+
+    std::string line;
+    while (std::getline(input, line)) {
+      std::istringstream tokens(line);
+      std::vector<std::string> args{cmdline.program_path};
+      for (std::string token; tokens >> token;) {
+        args.push_back(token);
+      }
+      if (args.size() == 1 || args[1][0] == '#') {
+        continue;
+      }
+
+      std::vector<char const *> argv;
+      for (auto const &arg : args) {
+        argv.push_back(arg.c_str());
+      }
+      sequence.emplace_back(int(argv.size()), argv.data());
+    }
+
+    if (sequence.empty()) {
+      throw std::runtime_error("no kernels in sequence file: " + filename);
+    }
+  }
+
   if (cmdline.check_cmd_line_flag("ignore-kernels")) {
     cmdline.get_cmd_line_arguments("ignore-kernels", excluded_operation_names);
   }
@@ -955,6 +1192,24 @@ void Options::print_usage(std::ostream &out) const {
     << "  --testlist-file=<filename>               "
     << "    A CSV, where each row is a problem, where the first column is the kernel name and the rest are the problem arguments" << end_of_line
 	<< "    The column names should match cutlass_profiler cmd line arguments. \n\n"
+
+    << "  --workload-trace=<filename>                  "
+    << "    A CSV histogram of problems issued by a production workload. Columns are" << end_of_line
+    << "      cutlass_profiler cmd line arguments plus 'count' (frequency of the problem)" << end_of_line
+    << "      and 'stream' (stream the problem was issued on). Every kernel matching the" << end_of_line
+    << "      filters is profiled on every row, and a frequency-weighted end-to-end time" << end_of_line
+    << "      is reported per kernel. Arguments not present in the trace are taken from" << end_of_line
+    << "      the command line.\n\n"
+
+    << "  --workload-kernel-set-size=<int>             "
+    << "    Number of kernels greedily selected to minimize the aggregate time of the" << end_of_line
+    << "      workload trace (default: 1).\n\n"
+
+    << "  --sequence-file=<filename>                   "
+    << "    Profiles a chain of kernels captured in one CUDA graph. Each line holds the" << end_of_line
+    << "      arguments of one step: --operation, --kernels naming the kernel, and its" << end_of_line
+    << "      problem arguments. Reports each kernel's runtime and the runtime of the" << end_of_line
+    << "      whole chain launched on a stream and as a graph.\n\n"
     ;
 
   //
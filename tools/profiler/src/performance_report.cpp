@@ -136,13 +136,71 @@ PerformanceReport::PerformanceReport(
 }
 
 void PerformanceReport::next_problem() {
+  report_cache_rank_flips_();
   ++problem_index_;
 }
 
+void PerformanceReport::report_cache_rank_flips_() {
+
+  PerformanceResultVector results;
+  results.swap(problem_results_);
+
+  if (results.size() < 2 || !options_.report.verbose) {
+    return;
+  }
+
+  // Rank kernels of the problem by cold-L2 and by hot-L2 runtime
+  std::vector<size_t> cold_order(results.size());
+  for (size_t i = 0; i < cold_order.size(); ++i) {
+    cold_order[i] = i;
+  }
+  std::vector<size_t> hot_order(cold_order);
+
+  std::stable_sort(cold_order.begin(), cold_order.end(), [&](size_t a, size_t b) {
+    return results[a].runtime < results[b].runtime;
+  });
+  std::stable_sort(hot_order.begin(), hot_order.end(), [&](size_t a, size_t b) {
+    return results[a].runtime_hot < results[b].runtime_hot;
+  });
+
+  std::vector<size_t> cold_rank(results.size());
+  std::vector<size_t> hot_rank(results.size());
+  for (size_t r = 0; r < results.size(); ++r) {
+    cold_rank[cold_order[r]] = r + 1;
+    hot_rank[hot_order[r]] = r + 1;
+  }
+
+  bool header = false;
+  for (size_t r = 0; r < results.size(); ++r) {
+    size_t idx = cold_order[r];
+    if (cold_rank[idx] == hot_rank[idx]) {
+      continue;
+    }
+    if (!header) {
+      std::cout << "\n=============================\n"
+        << "  Problem ID: " << problem_index_ << " - L2 ranking flips"
+        << (cold_order.front() != hot_order.front() ? " (best kernel differs)" : "") << "\n\n"
+        << "  Cold rank  Hot rank  Cold (ms)     Hot (ms)      Operation\n";
+      header = true;
+    }
+    std::cout << "  " << std::left
+      << std::setw(11) << cold_rank[idx]
+      << std::setw(10) << hot_rank[idx]
+      << std::setw(14) << results[idx].runtime
+      << std::setw(14) << results[idx].runtime_hot
+      << library::to_string(results[idx].provider, true) << " " << results[idx].operation_name
+      << std::right << "\n";
+  }
+}
+
 void PerformanceReport::append_result(PerformanceResult result) {
 
   result.problem_index = problem_index_;
 
+  if (options_.profiling.cache_mode == CacheMode::kBoth && result.good() && result.good_hot()) {
+    problem_results_.push_back(result);
+  }
+
   if (options_.report.verbose) {
     std::cout << "\n";
     print_result_pretty_(std::cout, result) << std::flush;
@@ -203,6 +261,8 @@ void PerformanceReport::append_results(PerformanceResultVector const &results) {
 
 PerformanceReport::~PerformanceReport() {
 
+  report_cache_rank_flips_();
+
   //
   // Output results to stdout if they were not written to a file already.
   //
@@ -326,6 +386,65 @@ std::ostream & PerformanceReport::print_result_pretty_(
       << "          Memory: " << result.gbytes_per_sec() << " GiB/s\n"
       << "\n            Math: " << result.gflops_per_sec() << " GFLOP/s\n";
 
+    if (result.good_roofline()) {
+      out
+        << "\n        Roofline: " << result.roofline_gflops_per_sec() << " GFLOP/s  ("
+        << (result.memory_bound() ? "memory" : "compute") << " bound, peak "
+        << result.peak_gflops << " GFLOP/s, " << result.peak_gbytes << " GiB/s)\n"
+        << "   % of roofline: " << 100.0 * result.roofline_fraction() << "\n";
+    }
+
+    if (result.pruned) {
+      out << "          Pruned: runtime estimated from " << options_.profiling.pruning_iterations
+          << " iterations\n";
+    }
+
+    if (result.has_kernel_resources) {
+      library::KernelResourceUsage const &usage = result.kernel_resources;
+      out
+        << "\n       Registers: " << usage.registers_per_thread << " per thread  ("
+        << usage.local_bytes_per_thread << " B local memory per thread)\n"
+        << "   Shared memory: " << usage.static_smem_bytes << " B static, "
+        << usage.dynamic_smem_bytes << " B dynamic per CTA\n"
+        << "       Occupancy: " << usage.max_ctas_per_sm << " CTAs/SM of " << usage.threads_per_cta << " threads";
+      if (usage.max_active_clusters > 0) {
+        out << ", " << usage.max_active_clusters << " active clusters of " << usage.cluster_size << " CTAs";
+      }
+      out << "\n";
+    }
+
+    if (result.good_hot()) {
+      out
+        << "\n  Runtime (hot L2): " << result.runtime_hot << "  ms\n"
+        << "     Math (hot L2): " << result.gflops_per_sec_hot() << " GFLOP/s\n";
+    }
+
+    if (result.good_power()) {
+      out
+        << "\n        SM clock: " << result.sm_clock_mhz << " MHz  (max " << result.sm_clock_max_mhz << " MHz)\n"
+        << "           Power: " << result.power_watts << " W  (peak temperature " << result.temperature_c << " C)\n"
+        << "      Efficiency: " << result.tflops_per_watt() << " TFLOP/s/W\n"
+        << "  Math (max SM clock): " << result.clock_normalized_gflops_per_sec() << " GFLOP/s\n";
+    }
+
+    if (result.good_latency()) {
+      out
+        << "\n         Latency: p50 " << result.latency_p50
+        << "  p90 " << result.latency_p90
+        << "  p99 " << result.latency_p99
+        << "  max " << result.latency_max << "  ms\n"
+        << "          Jitter: " << result.latency_jitter << "\n";
+    }
+
+    if (result.good_concurrent()) {
+      out
+        << "\n         Streams: " << result.concurrent_streams
+        << "  (" << (result.concurrent_sm_count ? std::to_string(result.concurrent_sm_count) : std::string("all"))
+        << " SMs per stream)\n"
+        << "  Runtime (concurrent): " << result.concurrent_runtime << "  ms\n"
+        << "     Math (concurrent): " << result.concurrent_gflops_per_sec() << " GFLOP/s\n"
+        << "  Stream tail latency: " << result.concurrent_tail_latency << "  ms (p99)\n";
+    }
   }
 
   return out;
@@ -367,6 +486,34 @@ std::ostream & PerformanceReport::print_csv_header_(
     << ",GFLOPs"
     ;
 
+  if (options_.profiling.cache_mode == CacheMode::kBoth) {
+    out << ",Runtime_hot,GFLOPs_hot";
+  }
+
+  if (options_.profiling.power_sampling) {
+    out << ",SMClock_MHz,Power_W,Temperature_C,TFLOPs_per_W,GFLOPs_max_clock";
+  }
+
+  if (options_.profiling.latency_percentiles) {
+    out << ",Latency_p50,Latency_p90,Latency_p99,Latency_max,Jitter";
+  }
+
+  if (options_.profiling.concurrent_streams > 1) {
+    out << ",Streams,SMsPerStream,ConcurrentRuntime,ConcurrentGFLOPs,StreamTailLatency";
+  }
+
+  if (options_.profiling.pruning_enabled()) {
+    out << ",Pruned";
+  }
+
+  if (options_.report.roofline) {
+    out << ",ArithmeticIntensity,Roofline_GFLOPs,PctRoofline,Bound";
+  }
+
+  if (options_.report.kernel_resources) {
+    out << ",Registers,LocalBytes,StaticSmem,DynamicSmem,ThreadsPerCTA,MaxCTAsPerSM,ClusterSize,MaxActiveClusters";
+  }
+
   return out;
 }
 
@@ -425,6 +572,92 @@ std::ostream & PerformanceReport::print_result_csv_(
     );
   }
 
+  if (options_.profiling.cache_mode == CacheMode::kBoth) {
+    if (result.good_hot()) {
+      out << "," << result.runtime_hot << "," << result.gflops_per_sec_hot();
+    }
+    else {
+      out << ",,";
+    }
+  }
+
+  if (options_.profiling.power_sampling) {
+    if (result.good_power()) {
+      out
+        << "," << result.sm_clock_mhz
+        << "," << result.power_watts
+        << "," << result.temperature_c
+        << "," << result.tflops_per_watt()
+        << "," << result.clock_normalized_gflops_per_sec();
+    }
+    else {
+      out << std::string(5, ',');
+    }
+  }
+
+  if (options_.profiling.latency_percentiles) {
+    if (result.good_latency()) {
+      out
+        << "," << result.latency_p50
+        << "," << result.latency_p90
+        << "," << result.latency_p99
+        << "," << result.latency_max
+        << "," << result.latency_jitter;
+    }
+    else {
+      out << std::string(5, ',');
+    }
+  }
+
+  if (options_.profiling.concurrent_streams > 1) {
+    if (result.good_concurrent()) {
+      out
+        << "," << result.concurrent_streams
+        << "," << result.concurrent_sm_count
+        << "," << result.concurrent_runtime
+        << "," << result.concurrent_gflops_per_sec()
+        << "," << result.concurrent_tail_latency;
+    }
+    else {
+      out << std::string(5, ',');
+    }
+  }
+
+  if (options_.profiling.pruning_enabled()) {
+    out << "," << (result.pruned ? "true" : "false");
+  }
+
+  if (options_.report.roofline) {
+    if (result.good_roofline()) {
+      out
+        << "," << result.arithmetic_intensity()
+        << "," << result.roofline_gflops_per_sec()
+        << "," << 100.0 * result.roofline_fraction()
+        << "," << (result.memory_bound() ? "memory" : "compute");
+    }
+    else {
+      out << std::string(4, ',');
+    }
+  }
+
+  if (options_.report.kernel_resources) {
+    if (result.has_kernel_resources) {
+      library::KernelResourceUsage const &usage = result.kernel_resources;
+      out
+        << "," << usage.registers_per_thread
+        << "," << usage.local_bytes_per_thread
+        << "," << usage.static_smem_bytes
+        << "," << usage.dynamic_smem_bytes
+        << "," << usage.threads_per_cta
+        << "," << usage.max_ctas_per_sm
+        << "," << usage.cluster_size
+        << "," << usage.max_active_clusters;
+    }
+    else {
+      out << std::string(8, ',');
+    }
+  }
+
   return out;
 }
 
@@ -515,6 +748,16 @@ std::ostream & PerformanceReport::print_junit_result_(std::ostream &out, Perform
     out << "    <error message=\"" << to_string(result.disposition) << "\" />" << std::endl;
   }
 
+  if (result.good_latency()) {
+    out << "    <properties>" << std::endl;
+    print_junit_result_property_(out, "latency_p50", result.latency_p50);
+    print_junit_result_property_(out, "latency_p90", result.latency_p90);
+    print_junit_result_property_(out, "latency_p99", result.latency_p99);
+    print_junit_result_property_(out, "latency_max", result.latency_max);
+    print_junit_result_property_(out, "jitter", result.latency_jitter);
+    out << "    </properties>" << std::endl;
+  }
+
   out << "    <system-out><![CDATA[" << std::endl;
   std::stringstream ss;
   print_result_pretty_(ss, result, false);
@@ -0,0 +1,213 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Samples SM clock, power, and temperature through NVML while kernels are profiled
+*/
+
+#include <algorithm>
+#include <chrono>
+
+#include <cuda_runtime.h>
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+#include <nvml.h>
+#endif
+
+#include "cutlass/profiler/power_monitor.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+/// Initializes NVML once for the lifetime of the process
+bool nvml_initialized() {
+  struct NvmlSession {
+    bool good;
+    NvmlSession(): good(nvmlInit_v2() == NVML_SUCCESS) { }
+    ~NvmlSession() {
+      if (good) {
+        nvmlShutdown();
+      }
+    }
+  };
+  static NvmlSession session;
+  return session.good;
+}
+#endif
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool PowerMonitor::available() {
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  return nvml_initialized();
+#else
+  return false;
+#endif
+}
+
+PowerMonitor::PowerMonitor(std::vector<int> const &devices, int interval_ms):
+  interval_ms_(std::max(interval_ms, 1)) {
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  if (!nvml_initialized()) {
+    return;
+  }
+
+  for (int device : devices) {
+
+    // Match by PCI bus id so that CUDA_VISIBLE_DEVICES remapping is honored
+    char bus_id[32];
+    if (cudaDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != cudaSuccess) {
+      handles_.clear();
+      return;
+    }
+
+    nvmlDevice_t handle;
+    if (nvmlDeviceGetHandleByPciBusId_v2(bus_id, &handle) != NVML_SUCCESS) {
+      handles_.clear();
+      return;
+    }
+
+    unsigned int max_clock = 0;
+    nvmlDeviceGetMaxClockInfo(handle, NVML_CLOCK_SM, &max_clock);
+    sm_clock_max_mhz_ += double(max_clock);
+
+    handles_.push_back(handle);
+  }
+
+  if (!handles_.empty()) {
+    sm_clock_max_mhz_ /= double(handles_.size());
+  }
+#endif
+}
+
+PowerMonitor::~PowerMonitor() {
+  if (running_) {
+    stop();
+  }
+}
+
+/// Begins sampling
+void PowerMonitor::start() {
+
+  if (handles_.empty() || running_) {
+    return;
+  }
+
+  samples_ = 0;
+  sm_clock_sum_ = 0;
+  power_sum_ = 0;
+  temperature_max_ = 0;
+
+  running_ = true;
+  thread_ = std::thread([this]() {
+    while (running_) {
+      sample_();
+      std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms_));
+    }
+  });
+}
+
+/// Ends sampling and returns telemetry averaged over the window and over devices
+PowerSample PowerMonitor::stop() {
+
+  PowerSample result;
+
+  if (!running_) {
+    return result;
+  }
+
+  running_ = false;
+  thread_.join();
+
+  // Windows shorter than the sampling period still report the state at their end
+  sample_();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  double device_samples = double(samples_) * double(handles_.size());
+
+  result.samples = samples_;
+  result.sm_clock_mhz = sm_clock_sum_ / device_samples;
+  result.sm_clock_max_mhz = sm_clock_max_mhz_;
+  result.power_watts = power_sum_ / device_samples;
+  result.temperature_c = temperature_max_;
+
+  return result;
+}
+
+/// Samples every monitored device once
+void PowerMonitor::sample_() {
+
+#if defined(CUTLASS_PROFILER_ENABLE_NVML)
+  double sm_clock = 0;
+  double power = 0;
+  double temperature = 0;
+
+  for (void *handle : handles_) {
+    nvmlDevice_t device = static_cast<nvmlDevice_t>(handle);
+
+    unsigned int clock_mhz = 0;
+    unsigned int power_mw = 0;
+    unsigned int temperature_c = 0;
+
+    if (nvmlDeviceGetClockInfo(device, NVML_CLOCK_SM, &clock_mhz) != NVML_SUCCESS ||
+        nvmlDeviceGetPowerUsage(device, &power_mw) != NVML_SUCCESS ||
+        nvmlDeviceGetTemperature(device, NVML_TEMPERATURE_GPU, &temperature_c) != NVML_SUCCESS) {
+      return;
+    }
+
+    sm_clock += double(clock_mhz);
+    power += double(power_mw) / 1000.0;
+    temperature = std::max(temperature, double(temperature_c));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  ++samples_;
+  sm_clock_sum_ += sm_clock;
+  power_sum_ += power;
+  temperature_max_ = std::max(temperature_max_, temperature);
+#endif
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -945,6 +945,46 @@ bool arg_as_RasterOrder(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Lexically casts an argument to a DecompositionMode if it is defined. Returns true if not null.
+bool arg_as_DecompositionMode(
+  library::DecompositionMode &decomposition_mode,
+  KernelArgument::Value const *value_ptr) {
+
+  if (value_ptr->not_null) {
+    if (value_ptr->argument->description->type == ArgumentTypeID::kEnumerated) {
+
+      decomposition_mode = library::from_string<library::DecompositionMode>(
+        static_cast<EnumeratedTypeArgument::EnumeratedTypeValue const *>(value_ptr)->element);
+
+      if (decomposition_mode == library::DecompositionMode::kInvalid) {
+        throw std::runtime_error(
+          "arg_as_DecompositionMode() - illegal cast.");
+      }
+    }
+    else {
+      throw std::runtime_error(
+        "arg_as_DecompositionMode() - illegal cast.");
+    }
+    return true;
+  }
+  return false;
+}
+
+/// Lexically casts an argument to a DecompositionMode if it is defined. Returns true if not null.
+bool arg_as_DecompositionMode(
+  library::DecompositionMode &decomposition_mode,
+  char const *name,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  size_t idx = problem_space.argument_index(name);
+  KernelArgument::Value const *value_ptr = problem.at(idx).get();
+
+  return arg_as_DecompositionMode(decomposition_mode, value_ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Lexically casts an argument to an int64 if it is defined. Returns true if not null.
 bool arg_as_LayoutTypeID(
   library::LayoutTypeID &layout_type, 
@@ -1363,6 +1403,49 @@ bool iterator_algorithm_satisfies(
   return false;
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns true if an attention mask satisfies the value
+bool attention_mask_satisfies(
+  library::AttentionMask const &mask,
+  EnumeratedTypeArgument::EnumeratedTypeValue const *value_ptr) {
+
+  if (value_ptr->not_null) {
+    library::AttentionMask mask_cmd_line =
+      library::from_string<library::AttentionMask>(value_ptr->element);
+
+    if (mask_cmd_line != library::AttentionMask::kInvalid &&
+      mask_cmd_line != mask) {
+
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/// Returns true if an attention mask satisfies the value
+bool attention_mask_satisfies(
+  library::AttentionMask const &mask,
+  char const *name,
+  ProblemSpace const &problem_space,
+  ProblemSpace::Problem const &problem) {
+
+  size_t idx = problem_space.argument_index(name);
+  KernelArgument::Value const *value_ptr = problem.at(idx).get();
+
+  if (value_ptr->argument->description->type == ArgumentTypeID::kEnumerated) {
+    return attention_mask_satisfies(
+      mask,
+      static_cast<EnumeratedTypeArgument::EnumeratedTypeValue const *>(value_ptr));
+  }
+  else {
+    throw std::runtime_error("Kernel argument mismatch");
+  }
+
+  return false;
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 } // namespace profiler
 } // namespace cutlass
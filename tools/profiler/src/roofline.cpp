@@ -0,0 +1,197 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Roofline model bounding profiled operations by device peak math and memory throughput
+*/
+
+#include <cuda_runtime.h>
+
+#include "cutlass/library/util.h"
+
+#include "cutlass/profiler/roofline.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Derives peaks for the first selected device
+Roofline::Roofline(Options const &options, library::OperationDescription const &operation_desc) {
+
+  int device = options.device.device_id(0);
+
+  peak_gflops = options.device.peak_gflops;
+  if (peak_gflops <= 0) {
+    int clock_KHz = 0;
+    cudaDeviceGetAttribute(&clock_KHz, cudaDevAttrClockRate, device);
+
+    double flops_per_clock = peak_flops_per_clock(
+      options.device.compute_capability(0),
+      operation_desc.tile_description.math_instruction.opcode_class,
+      math_element(operation_desc));
+
+    peak_gflops = flops_per_clock * options.device.get_sm_count(0) * double(clock_KHz) / 1.0e6;
+  }
+
+  peak_gbytes = options.device.peak_bandwidth;
+  if (peak_gbytes <= 0) {
+    int memory_clock_KHz = 0;
+    int bus_width_bits = 0;
+    cudaDeviceGetAttribute(&memory_clock_KHz, cudaDevAttrMemoryClockRate, device);
+    cudaDeviceGetAttribute(&bus_width_bits, cudaDevAttrGlobalMemoryBusWidth, device);
+
+    // Double data rate
+    peak_gbytes = 2.0 * double(memory_clock_KHz) * 1.0e3 * double(bus_width_bits / 8) / double(1 << 30);
+  }
+}
+
+/// Records the peaks in a result
+void Roofline::apply(PerformanceResult &result) const {
+  result.peak_gflops = peak_gflops;
+  result.peak_gbytes = peak_gbytes;
+}
+
+/// Returns the element type whose math pipe executes the operation
+library::NumericTypeID Roofline::math_element(library::OperationDescription const &operation_desc) {
+
+  switch (operation_desc.kind) {
+  case library::OperationKind::kGemm:
+  case library::OperationKind::kSparseGemm:
+    return static_cast<library::GemmDescription const &>(operation_desc).A.element;
+  case library::OperationKind::kGroupedGemm:
+    return static_cast<library::GroupedGemmDescription const &>(operation_desc).gemm.A.element;
+  case library::OperationKind::kBlockScaledGemm:
+    return static_cast<library::BlockScaledGemmDescription const &>(operation_desc).A.element;
+  case library::OperationKind::kBlockwiseGemm:
+    return static_cast<library::BlockwiseGemmDescription const &>(operation_desc).A.element;
+  case library::OperationKind::kRankK:
+  case library::OperationKind::kRank2K:
+    return static_cast<library::RankKDescription const &>(operation_desc).A.element;
+  case library::OperationKind::kTrmm:
+    return static_cast<library::TrmmDescription const &>(operation_desc).A.element;
+  case library::OperationKind::kSymm:
+    return static_cast<library::SymmDescription const &>(operation_desc).A.element;
+  case library::OperationKind::kConv2d:
+  case library::OperationKind::kConv3d:
+    return static_cast<library::ConvDescription const &>(operation_desc).A.element;
+  case library::OperationKind::kAttention:
+    return static_cast<library::AttentionDescription const &>(operation_desc).Q.element;
+  default:
+    break;
+  }
+  return library::NumericTypeID::kInvalid;
+}
+
+/// Returns the dense math throughput of one SM per clock (FLOP), or zero if not known. These are
+/// nominal datasheet rates of the flagship part of each architecture.
+double Roofline::peak_flops_per_clock(
+  int compute_capability,
+  library::OpcodeClassID opcode_class,
+  library::NumericTypeID element) {
+
+  if (element == library::NumericTypeID::kInvalid) {
+    return 0;
+  }
+
+  int bits = library::sizeof_bits(element);
+  bool is_float = library::is_float_type(element);
+
+  if (opcode_class == library::OpcodeClassID::kSimt) {
+
+    // FP32 FMA lanes per SM
+    double f32 = 0;
+    switch (compute_capability) {
+    case 70: case 72: case 75: case 80: f32 = 128; break;
+    case 86: case 87: case 89: case 90: case 100: case 103: case 110: case 120: case 121: f32 = 256; break;
+    default: return 0;
+    }
+
+    if (is_float && bits == 64) {
+      switch (compute_capability) {
+      case 70: case 80: return 64;
+      case 90: case 100: return 128;
+      default: return f32 / 64;
+      }
+    }
+    if (is_float && bits == 16 && (compute_capability == 70 || compute_capability == 80 || compute_capability == 90)) {
+      return 2 * f32;
+    }
+    return f32;
+  }
+
+  // Dense 16-bit tensor core throughput per SM
+  double f16 = 0;
+  switch (compute_capability) {
+  case 70: case 72: case 75: f16 = 1024; break;
+  case 80: f16 = 2048; break;
+  case 86: case 87: case 89: case 120: case 121: f16 = 1024; break;
+  case 90: f16 = 4096; break;
+  case 100: case 103: case 110: f16 = 8192; break;
+  default: return 0;
+  }
+
+  double rate = 0;
+  if (is_float && bits == 64) {
+    switch (compute_capability) {
+    case 80: rate = 128; break;
+    case 90: case 100: rate = 256; break;
+    default: return peak_flops_per_clock(compute_capability, library::OpcodeClassID::kSimt, element);
+    }
+  }
+  else if (bits == 32) {
+    // TF32 and its emulations run on the TF32 pipe
+    rate = (compute_capability >= 80 ? f16 / 2 : 0);
+  }
+  else if (bits == 16) {
+    rate = f16;
+  }
+  else if (bits == 8 || bits == 6) {
+    rate = (compute_capability >= 75 ? 2 * f16 : 0);
+  }
+  else if (bits <= 4) {
+    bool has_4bit = (compute_capability >= 100 || (compute_capability >= 75 && compute_capability < 89));
+    rate = (has_4bit ? 4 * f16 : 2 * f16);
+  }
+
+  // Structured sparsity doubles the logical throughput
+  if (opcode_class == library::OpcodeClassID::kSparseTensorOp) {
+    rate *= 2;
+  }
+
+  return rate;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,367 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Profiles a chain of heterogeneous kernels captured in one CUDA graph
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+#include "cutlass/library/singleton.h"
+#include "cutlass/library/util.h"
+
+#include "cutlass/profiler/gpu_timer.h"
+#include "cutlass/profiler/sequence_profiler.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+SequenceProfiler::SequenceProfiler(Options const &options, ProfilerFactory const &make_profilers):
+  options_(options), step_options_(options), make_profilers_(make_profilers) {
+
+  step_options_.report.output_path.clear();
+  step_options_.report.junit_output_path.clear();
+  step_options_.report.kernel_selection_output_path.clear();
+  step_options_.report.verbose = false;
+}
+
+SequenceProfiler::~SequenceProfiler() {
+
+}
+
+/// Profiles the sequence and returns zero on success
+int SequenceProfiler::operator()() {
+
+  if (options_.device.devices.size() != 1) {
+    std::cerr << "Error: --sequence-file profiles a single device" << std::endl;
+    return 1;
+  }
+
+  if (initialize_steps_() != Status::kSuccess) {
+    return 1;
+  }
+
+  Status status = profile_step_(0);
+  if (status != Status::kSuccess || graph_runtime_ <= 0) {
+    std::cerr << "Error: failed to profile sequence: " << library::to_string(status) << std::endl;
+    return 1;
+  }
+
+  for (auto &step : steps_) {
+    if (!step.profiler->results().empty()) {
+      step.runtime = step.profiler->results().back().runtime;
+    }
+  }
+
+  if (options_.report.verbose) {
+    print_summary_(std::cout) << std::endl;
+  }
+
+  if (!options_.report.output_path.empty()) {
+    std::string base_path = options_.report.output_path;
+    base_path = base_path.substr(0, base_path.rfind(".csv"));
+    std::string file_name = base_path + ".sequence.csv";
+
+    std::ofstream output_file(file_name);
+    if (!output_file.good()) {
+      std::cerr << "Could not open sequence output file at path '" << file_name << "'" << std::endl;
+      return 1;
+    }
+    print_csv_(output_file);
+
+    if (options_.report.verbose) {
+      std::cout << "Wrote sequence results to '" << file_name << "'" << std::endl;
+    }
+  }
+
+  return 0;
+}
+
+/// Resolves the operation profiler, kernel, and problem of each step
+Status SequenceProfiler::initialize_steps_() {
+
+  library::Manifest const &manifest = library::Singleton::get().manifest;
+  int cc = options_.device.compute_capability(0);
+
+  for (size_t step_idx = 0; step_idx < options_.sequence.size(); ++step_idx) {
+
+    CommandLine const &cmdline = options_.sequence[step_idx];
+    Step step;
+
+    std::string kind_str;
+    cmdline.get_cmd_line_argument("operation", kind_str);
+    library::OperationKind kind = library::from_string<library::OperationKind>(kind_str);
+
+    // Steps sharing an operation kind need their own profilers, since workspaces of every step
+    // must remain valid until the sequence is captured
+    for (auto &profiler : make_profilers_()) {
+      if (profiler->kind() == kind) {
+        step.profiler = std::move(profiler);
+        break;
+      }
+    }
+
+    if (!step.profiler) {
+      std::cerr << "Error: sequence step " << step_idx << " has invalid --operation=" << kind_str << std::endl;
+      return Status::kErrorInvalidProblem;
+    }
+
+    step.problem_space = std::make_unique<ProblemSpace>(step.profiler->arguments(), cmdline);
+    step.problem = step.problem_space->begin().at();
+
+    // The kernel is given by name, falling back to the first kernel containing it which
+    // supports the problem
+    std::string kernel_name;
+    cmdline.get_cmd_line_argument("kernels", kernel_name);
+
+    library::Operation const *fallback = nullptr;
+    for (auto const &operation_ptr : manifest) {
+      library::Operation const *operation = operation_ptr.get();
+      auto const &desc = operation->description();
+
+      if (desc.kind != kind || desc.provider != library::Provider::kCUTLASS ||
+          cc < desc.tile_description.minimum_compute_capability ||
+          cc > desc.tile_description.maximum_compute_capability) {
+        continue;
+      }
+
+      if (kernel_name == desc.name) {
+        step.operation = operation;
+        break;
+      }
+
+      if (!fallback && std::string(desc.name).find(kernel_name) != std::string::npos &&
+          OperationProfiler::satisfies(desc, *step.problem_space, step.problem)) {
+        fallback = operation;
+      }
+    }
+
+    if (!step.operation) {
+      step.operation = fallback;
+    }
+
+    if (!step.operation) {
+      std::cerr << "Error: no kernel matching '" << kernel_name << "' for sequence step " << step_idx << std::endl;
+      return Status::kErrorNotSupported;
+    }
+
+    step.device_context = std::make_unique<DeviceContext>();
+    step.report = std::make_unique<PerformanceReport>(
+      step_options_, step.problem_space->argument_names(), kind);
+
+    steps_.push_back(std::move(step));
+  }
+
+  return Status::kSuccess;
+}
+
+/// Configures and profiles a step, then continues with the next step
+Status SequenceProfiler::profile_step_(size_t step_idx) {
+
+  if (step_idx == steps_.size()) {
+    return profile_sequence_();
+  }
+
+  Step &step = steps_[step_idx];
+
+  Status status = step.profiler->initialize_configuration(
+    step_options_, *step.report, *step.device_context, step.operation, *step.problem_space, step.problem);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  status = step.profiler->initialize_workspace(
+    step_options_, *step.report, *step.device_context, step.operation, *step.problem_space, step.problem);
+  if (status != Status::kSuccess) {
+    return status;
+  }
+
+  if (!step.profiler->verify_cutlass(
+      step_options_, *step.report, *step.device_context, step.operation, *step.problem_space, step.problem)) {
+    return Status::kErrorInternal;
+  }
+
+  // profile() times the kernel, then continues with the remaining steps from within
+  // profile_kernel_() while the step's launch function remains valid
+  Status sequence_status = Status::kErrorNotSupported;
+  capture_.next = [this, step_idx, &sequence_status]() {
+    sequence_status = profile_step_(step_idx + 1);
+    return sequence_status;
+  };
+
+  step.profiler->capture_sequence(&capture_);
+  step.profiler->profile(
+    step_options_, *step.report, *step.device_context, step.operation, *step.problem_space, step.problem);
+  step.profiler->capture_sequence(nullptr);
+
+  if (capture_.launches.size() <= step_idx) {
+    std::cerr << "Error: sequence step " << step_idx << " (" << step.operation->description().name
+              << ") could not be captured" << std::endl;
+  }
+
+  return sequence_status;
+}
+
+/// Times the captured chain launched on a stream and as a CUDA graph
+Status SequenceProfiler::profile_sequence_() {
+
+  cudaStream_t stream;
+  CUDA_CHECK(cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking));
+
+  auto launch_sequence = [&](int iteration) {
+    for (auto const &launch : capture_.launches) {
+      Status status = launch(stream, iteration);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+    }
+    return Status::kSuccess;
+  };
+
+  GpuTimer timer;
+  Status status = Status::kSuccess;
+
+  // Run for profiling-iterations if requested, otherwise for profiling-duration
+  int iterations = options_.profiling.iterations;
+  if (iterations == 0) {
+    constexpr int kCalibrationIterations = 5;
+    timer.start(stream);
+    for (int iteration = 0; iteration < kCalibrationIterations && status == Status::kSuccess; ++iteration) {
+      status = launch_sequence(iteration);
+    }
+    timer.stop_and_wait(stream);
+
+    double estimated = options_.profiling.duration / std::max(timer.duration(kCalibrationIterations), 1e-6);
+    iterations = std::max(options_.profiling.min_iterations, int(std::min(std::ceil(estimated), 1.0e5)));
+  }
+
+  for (int iteration = 0; iteration < options_.profiling.warmup_iterations && status == Status::kSuccess; ++iteration) {
+    status = launch_sequence(iteration);
+  }
+
+  // Chain launched back to back on a stream
+  timer.start(stream);
+  for (int iteration = 0; iteration < iterations && status == Status::kSuccess; ++iteration) {
+    status = launch_sequence(iteration);
+  }
+  timer.stop_and_wait(stream);
+
+  if (status != Status::kSuccess) {
+    cudaStreamDestroy(stream);
+    return status;
+  }
+  stream_runtime_ = timer.duration(iterations);
+
+  // Chain captured in one graph, launched once per iteration
+  cudaGraph_t graph;
+  cudaGraphExec_t graph_exec;
+
+  CUDA_CHECK(cudaStreamBeginCapture(stream, cudaStreamCaptureModeGlobal));
+  status = launch_sequence(0);
+  CUDA_CHECK(cudaStreamEndCapture(stream, &graph));
+
+  if (status != Status::kSuccess) {
+    cudaGraphDestroy(graph);
+    cudaStreamDestroy(stream);
+    return status;
+  }
+
+  CUDA_CHECK(cudaGraphInstantiate(&graph_exec, graph, nullptr, nullptr, 0));
+
+  for (int iteration = 0; iteration < options_.profiling.warmup_iterations; ++iteration) {
+    CUDA_CHECK(cudaGraphLaunch(graph_exec, stream));
+  }
+
+  timer.start(stream);
+  for (int iteration = 0; iteration < iterations; ++iteration) {
+    CUDA_CHECK(cudaGraphLaunch(graph_exec, stream));
+  }
+  timer.stop_and_wait(stream);
+  graph_runtime_ = timer.duration(iterations);
+
+  CUDA_CHECK(cudaGraphExecDestroy(graph_exec));
+  CUDA_CHECK(cudaGraphDestroy(graph));
+  CUDA_CHECK(cudaStreamDestroy(stream));
+
+  return Status::kSuccess;
+}
+
+/// Prints a summary of the sequence
+std::ostream &SequenceProfiler::print_summary_(std::ostream &out) const {
+
+  double kernel_runtime = 0;
+
+  out << "\n=============================\n"
+      << "  Sequence of " << steps_.size() << " kernels\n\n";
+
+  for (size_t step_idx = 0; step_idx < steps_.size(); ++step_idx) {
+    Step const &step = steps_[step_idx];
+    out << "  [" << step_idx << "] " << library::to_string(step.profiler->kind()) << " "
+        << step.operation->description().name << ": " << step.runtime << " ms\n";
+    kernel_runtime += step.runtime;
+  }
+
+  out << "\n    Sum of kernel runtimes: " << kernel_runtime << " ms\n"
+      << "  Sequence (stream launches): " << stream_runtime_ << " ms\n"
+      << "      Sequence (CUDA graph): " << graph_runtime_ << " ms\n";
+
+  return out;
+}
+
+/// Writes the sequence results as CSV
+std::ostream &SequenceProfiler::print_csv_(std::ostream &out) const {
+
+  out << "Step,OperationKind,Operation,Runtime\n";
+
+  for (size_t step_idx = 0; step_idx < steps_.size(); ++step_idx) {
+    Step const &step = steps_[step_idx];
+    out << step_idx << "," << library::to_string(step.profiler->kind()) << ","
+        << step.operation->description().name << "," << step.runtime << "\n";
+  }
+
+  out << "stream,,sequence," << stream_runtime_ << "\n"
+      << "graph,,sequence," << graph_runtime_ << "\n";
+
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
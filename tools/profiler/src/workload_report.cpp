@@ -0,0 +1,314 @@
+/***************************************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Aggregates profiling results over a frequency-weighted workload trace
+*/
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <set>
+
+#include "cutlass/library/util.h"
+
+#include "cutlass/profiler/workload_report.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+double WorkloadReport::KernelSummary::critical_stream_runtime() const {
+  double runtime = 0;
+  for (auto const & stream : stream_runtime) {
+    runtime = std::max(runtime, stream.second);
+  }
+  return runtime;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+WorkloadReport::WorkloadReport(
+  Options const &options,
+  library::OperationKind op_kind
+):
+  options_(options), op_kind_(op_kind), total_count_(0) {
+
+  for (auto const & problem : options_.workload_problems) {
+    total_count_ += problem.count;
+  }
+}
+
+void WorkloadReport::append_results(size_t problem_index, PerformanceResultVector const &results) {
+
+  if (problem_index >= options_.workload_problems.size()) {
+    return;
+  }
+
+  for (auto const & result : results) {
+
+    // Only results that actually ran contribute to the workload time
+    if (result.status != Status::kSuccess || !result.good() ||
+        result.disposition == Disposition::kFailed ||
+        result.disposition == Disposition::kIncorrect) {
+      continue;
+    }
+
+    ProblemRuntimeMap &runtimes = kernels_[{result.provider, result.operation_name}];
+
+    // Keep the best configuration if several were profiled for the same problem
+    auto it = runtimes.find(problem_index);
+    if (it == runtimes.end()) {
+      runtimes.emplace(problem_index, result.runtime);
+    }
+    else {
+      it->second = std::min(it->second, result.runtime);
+    }
+  }
+}
+
+WorkloadReport::KernelSummary WorkloadReport::summarize_(ProblemRuntimeMap const &runtimes) const {
+
+  KernelSummary summary;
+
+  for (auto const & entry : runtimes) {
+    Options::WorkloadProblem const &problem = options_.workload_problems.at(entry.first);
+    double weighted = double(problem.count) * entry.second;
+
+    summary.total_runtime += weighted;
+    summary.stream_runtime[problem.stream] += weighted;
+    summary.problems_covered++;
+    summary.count_covered += problem.count;
+  }
+
+  return summary;
+}
+
+std::vector<WorkloadReport::KernelKey> WorkloadReport::select_kernel_set_(
+  int set_size,
+  double &total_runtime) const {
+
+  size_t problem_count = options_.workload_problems.size();
+  double const kInfinity = std::numeric_limits<double>::infinity();
+
+  // Runtime of each problem using the best kernel selected so far
+  std::vector<double> best(problem_count, kInfinity);
+  std::vector<KernelKey> selected;
+
+  auto aggregate = [&](std::vector<double> const &runtimes, size_t &uncovered) {
+    double total = 0;
+    uncovered = 0;
+    for (size_t i = 0; i < problem_count; ++i) {
+      if (runtimes[i] == kInfinity) {
+        ++uncovered;
+      }
+      else {
+        total += double(options_.workload_problems[i].count) * runtimes[i];
+      }
+    }
+    return total;
+  };
+
+  for (int s = 0; s < set_size; ++s) {
+
+    KernelKey const *best_kernel = nullptr;
+    std::vector<double> best_candidate;
+    size_t best_uncovered = problem_count + 1;
+    double best_total = kInfinity;
+
+    for (auto const & kernel : kernels_) {
+      if (std::find(selected.begin(), selected.end(), kernel.first) != selected.end()) {
+        continue;
+      }
+
+      std::vector<double> candidate(best);
+      for (auto const & entry : kernel.second) {
+        candidate[entry.first] = std::min(candidate[entry.first], entry.second);
+      }
+
+      // Prefer kernel sets covering more of the trace, then lower aggregate time
+      size_t uncovered = 0;
+      double total = aggregate(candidate, uncovered);
+      if (uncovered < best_uncovered || (uncovered == best_uncovered && total < best_total)) {
+        best_kernel = &kernel.first;
+        best_candidate.swap(candidate);
+        best_uncovered = uncovered;
+        best_total = total;
+      }
+    }
+
+    // Stop once no kernel improves on the current set
+    size_t current_uncovered = 0;
+    double current_total = aggregate(best, current_uncovered);
+    if (!best_kernel ||
+        (best_uncovered == current_uncovered && !(best_total < current_total))) {
+      break;
+    }
+
+    selected.push_back(*best_kernel);
+    best.swap(best_candidate);
+  }
+
+  size_t uncovered = 0;
+  total_runtime = aggregate(best, uncovered);
+  if (uncovered) {
+    total_runtime = kInfinity;
+  }
+
+  return selected;
+}
+
+std::ostream & WorkloadReport::print_summary(std::ostream &out) const {
+
+  struct Entry {
+    KernelKey const *key;
+    KernelSummary summary;
+  };
+
+  std::vector<Entry> entries;
+  for (auto const & kernel : kernels_) {
+    entries.push_back({&kernel.first, summarize_(kernel.second)});
+  }
+
+  // Kernels covering the whole trace first, ordered by aggregate runtime
+  size_t problem_count = options_.workload_problems.size();
+  std::stable_sort(entries.begin(), entries.end(), [&](Entry const &a, Entry const &b) {
+    bool a_full = a.summary.problems_covered == problem_count;
+    bool b_full = b.summary.problems_covered == problem_count;
+    if (a_full != b_full) {
+      return a_full;
+    }
+    if (!a_full && a.summary.count_covered != b.summary.count_covered) {
+      return a.summary.count_covered > b.summary.count_covered;
+    }
+    return a.summary.total_runtime < b.summary.total_runtime;
+  });
+
+  // Per-problem best over all kernels is a lower bound for any kernel set
+  double oracle_runtime = 0;
+  bool oracle_complete = true;
+  for (size_t i = 0; i < problem_count; ++i) {
+    double best = std::numeric_limits<double>::infinity();
+    for (auto const & kernel : kernels_) {
+      auto it = kernel.second.find(i);
+      if (it != kernel.second.end()) {
+        best = std::min(best, it->second);
+      }
+    }
+    if (best == std::numeric_limits<double>::infinity()) {
+      oracle_complete = false;
+      continue;
+    }
+    oracle_runtime += double(options_.workload_problems[i].count) * best;
+  }
+
+  out << "\n\n=============================\n\n"
+      << "Workload Trace Results (" << library::to_string(op_kind_) << "):\n\n"
+      << "        Problems: " << problem_count << "\n"
+      << "     Total count: " << total_count_ << "\n"
+      << "  Per-shape best: " << oracle_runtime << " ms"
+      << (oracle_complete ? "" : " (some problems not covered by any kernel)") << "\n\n";
+
+  double set_runtime = 0;
+  std::vector<KernelKey> kernel_set = select_kernel_set_(options_.workload_kernel_set_size, set_runtime);
+
+  if (!kernel_set.empty()) {
+    out << "  Selected kernel set (" << kernel_set.size() << "): ";
+    if (set_runtime == std::numeric_limits<double>::infinity()) {
+      out << "does not cover the workload\n";
+    }
+    else {
+      out << set_runtime << " ms\n";
+    }
+    for (auto const & key : kernel_set) {
+      out << "    " << library::to_string(key.first, true) << " " << key.second << "\n";
+    }
+    out << "\n";
+  }
+
+  out << "  Rank  Total (ms)    Critical stream (ms)  Coverage    Operation\n";
+
+  int rank = 0;
+  for (auto const & entry : entries) {
+    out << "  " << std::left << std::setw(6) << ++rank
+        << std::setw(14) << entry.summary.total_runtime
+        << std::setw(22) << entry.summary.critical_stream_runtime()
+        << std::setw(12) << (std::to_string(entry.summary.problems_covered) + "/" + std::to_string(problem_count))
+        << library::to_string(entry.key->first, true) << " " << entry.key->second << "\n";
+  }
+  out << std::right;
+
+  return out;
+}
+
+std::ostream & WorkloadReport::print_csv(std::ostream &out) const {
+
+  std::set<int> streams;
+  for (auto const & problem : options_.workload_problems) {
+    streams.insert(problem.stream);
+  }
+
+  out << "Provider,OperationKind,Operation,ProblemsCovered,Problems,CountCovered,Count,TotalRuntime,CriticalStreamRuntime";
+  for (int stream : streams) {
+    out << ",Runtime_stream" << stream;
+  }
+  out << "\n";
+
+  for (auto const & kernel : kernels_) {
+    KernelSummary summary = summarize_(kernel.second);
+
+    out << library::to_string(kernel.first.first, true)
+        << "," << library::to_string(op_kind_)
+        << "," << kernel.first.second
+        << "," << summary.problems_covered
+        << "," << options_.workload_problems.size()
+        << "," << summary.count_covered
+        << "," << total_count_
+        << "," << summary.total_runtime
+        << "," << summary.critical_stream_runtime();
+
+    for (int stream : streams) {
+      auto it = summary.stream_runtime.find(stream);
+      out << "," << (it == summary.stream_runtime.end() ? 0.0 : it->second);
+    }
+    out << "\n";
+  }
+
+  return out;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
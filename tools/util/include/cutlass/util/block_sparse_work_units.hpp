@@ -0,0 +1,104 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host construction of the work units of the 3.x block sparse (BSR) GEMM scheduler.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_block_sparse.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct BlockSparseWorkUnits {
+  std::vector<gemm::kernel::detail::BlockSparseWorkUnit> units;
+  // Number of block rows split into more than one unit, the num_split_rows scheduler argument
+  int32_t num_split_rows = 0;
+};
+
+/// Builds the work units of the BlockSparseScheduler from the block row pointers of a BSR matrix,
+/// i.e. block row r holds the nonzero blocks [block_row_ptr[r], block_row_ptr[r + 1]).
+///
+/// A block row with more than max_blocks_per_unit nonzero blocks is split into the fewest units
+/// of at most max_blocks_per_unit blocks, of balanced lengths; 0 never splits. A good value is the
+/// average number of blocks per unit that fills the SMs with one wave of (unit, N tile) pairs.
+/// The units are ordered by decreasing length so that the short units fill the tail of the grid,
+/// and empty block rows have no unit.
+inline BlockSparseWorkUnits
+make_block_sparse_work_units(std::vector<int32_t> const& block_row_ptr, int32_t max_blocks_per_unit = 0) {
+  BlockSparseWorkUnits result;
+  int32_t block_rows = static_cast<int32_t>(block_row_ptr.size()) - 1;
+
+  for (int32_t row = 0; row < block_rows; ++row) {
+    int32_t start = block_row_ptr[row];
+    int32_t count = block_row_ptr[row + 1] - start;
+    if (count <= 0) {
+      continue;
+    }
+
+    int32_t splits = 1;
+    if (max_blocks_per_unit > 0) {
+      splits = (count + max_blocks_per_unit - 1) / max_blocks_per_unit;
+    }
+    int32_t partial_idx = 0;
+    if (splits > 1) {
+      partial_idx = result.num_split_rows++;
+    }
+
+    // The first count % splits units hold one more block than the others
+    for (int32_t split = 0; split < splits; ++split) {
+      int32_t length = count / splits + (split < count % splits ? 1 : 0);
+      result.units.push_back({row, start, length, split, splits, partial_idx});
+      start += length;
+    }
+  }
+
+  // Stable, and the earlier splits of a row are never shorter, so every split of a row is handed
+  // out before the splits that wait on it during the reduction
+  std::stable_sort(result.units.begin(), result.units.end(),
+    [](auto const& lhs, auto const& rhs) { return lhs.block_count > rhs.block_count; });
+
+  return result;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
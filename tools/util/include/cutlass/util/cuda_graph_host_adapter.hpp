@@ -0,0 +1,504 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief A CudaHostAdapter that records launches into a CUDA graph and replays them.
+
+    A sequence of CUTLASS operators run through CudaGraphHostAdapters sharing one CudaGraphRecorder
+    is recorded into a graph on the first step and, on every later step, is replayed with a single
+    cudaGraphLaunch() after the parameters of each recorded node are updated in place:
+
+      cutlass::CudaGraphRecorder recorder;
+      cutlass::CudaGraphHostAdapter adapter_0(recorder, (void*)cutlass::device_kernel<Kernel0>);
+      cutlass::CudaGraphHostAdapter adapter_1(recorder, (void*)cutlass::device_kernel<Kernel1>);
+
+      for (int step = 0; step < steps; ++step) {
+        recorder.begin_step();
+        gemm_0.initialize(arguments_0[step], workspace_0, stream, &adapter_0);
+        gemm_0.run(stream, &adapter_0);
+        gemm_1.initialize(arguments_1[step], workspace_1, stream, &adapter_1);
+        gemm_1.run(stream, &adapter_1);
+        recorder.launch(stream);
+      }
+
+    Operators must be compiled with CUTLASS_ENABLE_CUDA_HOST_ADAPTER=1. Launches and workspace
+    fills are not executed when the operator issues them but when the graph is launched. TMA
+    descriptors live in the kernel Params, so the descriptors re-encoded by initialize() for new
+    pointers travel with the updated kernel node parameters.
+
+    Kernel node parameters (grid, block, shared memory and arguments) and memset node parameters
+    may change from step to step. The kernel, cluster shape and fill element size of each node may
+    not; a step that departs from the recorded sequence fails with kErrorInvalidProblem, after
+    which reset() discards the graph so the next step records anew.
+*/
+
+#pragma once
+
+#include <cuda_runtime.h>
+
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/trace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// The graph shared by the CudaGraphHostAdapters of a sequence of operators
+class CudaGraphRecorder {
+public:
+
+  CudaGraphRecorder() = default;
+  CudaGraphRecorder(CudaGraphRecorder const&) = delete;
+  CudaGraphRecorder& operator=(CudaGraphRecorder const&) = delete;
+
+  ~CudaGraphRecorder() {
+    reset();
+  }
+
+  /// Starts a step: the following launches are matched to the recorded nodes in order
+  void begin_step() {
+    cursor_ = 0;
+    step_failed_ = false;
+  }
+
+  /// Launches the graph of the current step, instantiating it after the first step
+  Status launch(cudaStream_t stream) {
+    if (step_failed_ || (exec_ != nullptr && cursor_ != nodes_.size())) {
+      CUTLASS_TRACE_HOST("CudaGraphRecorder::launch() step does not match the recorded graph");
+      return Status::kErrorInvalidProblem;
+    }
+    if (nodes_.empty()) {
+      return Status::kSuccess;
+    }
+    cudaError_t result = cudaSuccess;
+    if (exec_ == nullptr) {
+      result = cudaGraphInstantiate(&exec_, graph_, 0);
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaGraphInstantiate() returned error " << cudaGetErrorString(result));
+        exec_ = nullptr;
+        return Status::kErrorInternal;
+      }
+    }
+    result = cudaGraphLaunch(exec_, stream);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaGraphLaunch() returned error " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+  }
+
+  /// Discards the recorded graph
+  void reset() {
+    if (exec_ != nullptr) {
+      (void) cudaGraphExecDestroy(exec_);
+      exec_ = nullptr;
+    }
+    if (graph_ != nullptr) {
+      (void) cudaGraphDestroy(graph_);
+      graph_ = nullptr;
+    }
+    nodes_.clear();
+    cursor_ = 0;
+    step_failed_ = false;
+  }
+
+  /// Whether the graph has been instantiated, i.e. launches update nodes instead of adding them
+  bool recorded() const { return exec_ != nullptr; }
+
+  /// Number of nodes of the graph
+  size_t node_count() const { return nodes_.size(); }
+
+private:
+
+  friend class CudaGraphHostAdapter;
+
+  enum class NodeKind { kKernel, kMemset };
+
+  /// A node and the parameters a later step may not change
+  struct Node {
+    NodeKind kind;
+    cudaGraphNode_t node;
+    void const* func;
+    dim3 cluster;
+    unsigned int element_size;
+  };
+
+  Status add_kernel(cudaKernelNodeParams const& params, dim3 cluster, dim3 preferred_cluster) {
+    if (exec_ != nullptr) {
+      if (!match_(NodeKind::kKernel, params.func, cluster, 0)) {
+        return Status::kErrorInvalidProblem;
+      }
+      cudaError_t result = cudaGraphExecKernelNodeSetParams(exec_, nodes_[cursor_++].node, &params);
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaGraphExecKernelNodeSetParams() returned error " << cudaGetErrorString(result));
+        step_failed_ = true;
+        return Status::kErrorInternal;
+      }
+      return Status::kSuccess;
+    }
+
+    Node node{NodeKind::kKernel, nullptr, params.func, cluster, 0};
+    if (!create_graph_()) {
+      return Status::kErrorInternal;
+    }
+    cudaError_t result = cudaGraphAddKernelNode(&node.node, graph_, dependency_(), dependency_count_(), &params);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaGraphAddKernelNode() returned error " << cudaGetErrorString(result));
+      step_failed_ = true;
+      return Status::kErrorInternal;
+    }
+
+    if (cluster.x * cluster.y * cluster.z > 1) {
+#if (CUDART_VERSION >= 12000)
+      cudaLaunchAttributeValue value;
+      value.clusterDim.x = cluster.x;
+      value.clusterDim.y = cluster.y;
+      value.clusterDim.z = cluster.z;
+      result = cudaGraphKernelNodeSetAttribute(node.node, cudaLaunchAttributeClusterDimension, &value);
+#if (CUDART_VERSION >= 12080)
+      if (result == cudaSuccess && preferred_cluster.x * preferred_cluster.y * preferred_cluster.z > 1) {
+        value.preferredClusterDim.x = preferred_cluster.x;
+        value.preferredClusterDim.y = preferred_cluster.y;
+        value.preferredClusterDim.z = preferred_cluster.z;
+        result = cudaGraphKernelNodeSetAttribute(node.node, cudaLaunchAttributePreferredClusterDimension, &value);
+      }
+#endif
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaGraphKernelNodeSetAttribute() returned error " << cudaGetErrorString(result));
+        step_failed_ = true;
+        return Status::kErrorInternal;
+      }
+#else
+      step_failed_ = true;
+      return Status::kErrorNotSupported;
+#endif
+    }
+
+    nodes_.push_back(node);
+    ++cursor_;
+    return Status::kSuccess;
+  }
+
+  Status add_memset(cudaMemsetParams const& params) {
+    if (exec_ != nullptr) {
+      if (!match_(NodeKind::kMemset, nullptr, dim3(1, 1, 1), params.elementSize)) {
+        return Status::kErrorInvalidProblem;
+      }
+      cudaError_t result = cudaGraphExecMemsetNodeSetParams(exec_, nodes_[cursor_++].node, &params);
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaGraphExecMemsetNodeSetParams() returned error " << cudaGetErrorString(result));
+        step_failed_ = true;
+        return Status::kErrorInternal;
+      }
+      return Status::kSuccess;
+    }
+
+    Node node{NodeKind::kMemset, nullptr, nullptr, dim3(1, 1, 1), params.elementSize};
+    if (!create_graph_()) {
+      return Status::kErrorInternal;
+    }
+    cudaError_t result = cudaGraphAddMemsetNode(&node.node, graph_, dependency_(), dependency_count_(), &params);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaGraphAddMemsetNode() returned error " << cudaGetErrorString(result));
+      step_failed_ = true;
+      return Status::kErrorInternal;
+    }
+    nodes_.push_back(node);
+    ++cursor_;
+    return Status::kSuccess;
+  }
+
+  bool match_(NodeKind kind, void const* func, dim3 cluster, unsigned int element_size) {
+    bool matches = !step_failed_ && cursor_ < nodes_.size();
+    if (matches) {
+      Node const& node = nodes_[cursor_];
+      matches = node.kind == kind && node.func == func && node.element_size == element_size &&
+                node.cluster.x == cluster.x && node.cluster.y == cluster.y && node.cluster.z == cluster.z;
+    }
+    if (!matches) {
+      CUTLASS_TRACE_HOST("CudaGraphRecorder: launch " << cursor_ << " does not match the recorded graph");
+      step_failed_ = true;
+    }
+    return matches;
+  }
+
+  bool create_graph_() {
+    if (graph_ == nullptr) {
+      cudaError_t result = cudaGraphCreate(&graph_, 0);
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaGraphCreate() returned error " << cudaGetErrorString(result));
+        graph_ = nullptr;
+        step_failed_ = true;
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Launches are serialized, as they would be on a stream
+  cudaGraphNode_t const* dependency_() const {
+    return nodes_.empty() ? nullptr : &nodes_.back().node;
+  }
+
+  size_t dependency_count_() const {
+    return nodes_.empty() ? 0 : 1;
+  }
+
+  cudaGraph_t graph_ = nullptr;
+  cudaGraphExec_t exec_ = nullptr;
+  std::vector<Node> nodes_;
+  size_t cursor_ = 0;
+  bool step_failed_ = false;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// CudaHostAdapter of one operator whose launches are recorded by a CudaGraphRecorder. Kernel
+/// handles are runtime API entry points, e.g. (void*)cutlass::device_kernel<GemmKernel>.
+class CudaGraphHostAdapter : public CudaHostAdapter {
+public:
+
+  CudaGraphHostAdapter(CudaGraphRecorder& recorder, void* kernel_handle)
+    : CudaHostAdapter(&kernel_handle, 1), recorder_(&recorder) { }
+
+  CudaGraphHostAdapter(CudaGraphRecorder& recorder, void** kernel_handles_, int32_t kernel_count_)
+    : CudaHostAdapter(kernel_handles_, kernel_count_), recorder_(&recorder) { }
+
+  Status
+  query_occupancy(
+      int32_t* device_sms,
+      int32_t* sm_occupancy,
+      int32_t kernel_index,
+      int32_t thread_count,
+      int32_t smem_size) const override {
+    if (kernel_index < 0 || kernel_index >= kernel_count) {
+      return Status::kErrorInvalidProblem;
+    }
+    int device_id = 0;
+    cudaError_t result = cudaGetDevice(&device_id);
+    if (result == cudaSuccess) {
+      result = cudaDeviceGetAttribute(device_sms, cudaDevAttrMultiProcessorCount, device_id);
+    }
+    if (result == cudaSuccess && smem_size >= (48 << 10)) {
+      result = cudaFuncSetAttribute(kernel_handles[kernel_index], cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size);
+    }
+    if (result == cudaSuccess) {
+      result = cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+        sm_occupancy, kernel_handles[kernel_index], thread_count, smem_size);
+    }
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("CudaGraphHostAdapter::query_occupancy() returned error " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+  }
+
+  Status
+  launch(
+      dim3 const grid_dims,
+      dim3 const block_dims,
+      size_t const smem_size,
+      cudaStream_t /* cuda_stream */,
+      void** kernel_params,
+      int32_t kernel_index) const override {
+    return record_(grid_dims, dim3(1, 1, 1), dim3(1, 1, 1), block_dims, smem_size, kernel_params, kernel_index);
+  }
+
+  Status
+  launch(
+      dim3 const grid_dims,
+      dim3 const cluster_dims,
+      dim3 const block_dims,
+      size_t const smem_size,
+      cudaStream_t /* cuda_stream */,
+      void** kernel_params,
+      int32_t kernel_index) const override {
+    return record_(grid_dims, cluster_dims, dim3(1, 1, 1), block_dims, smem_size, kernel_params, kernel_index);
+  }
+
+  /// The node is recorded with the fallback cluster shape and prefers the other one
+  Status
+  launch(
+      dim3 const grid_dims,
+      dim3 const cluster_dims,
+      dim3 const fallback_cluster_dims,
+      dim3 const block_dims,
+      size_t const smem_size,
+      cudaStream_t /* cuda_stream */,
+      void** kernel_params,
+      int32_t kernel_index) const override {
+    bool has_fallback = fallback_cluster_dims.x * fallback_cluster_dims.y * fallback_cluster_dims.z > 0;
+    if (!has_fallback) {
+      return record_(grid_dims, cluster_dims, dim3(1, 1, 1), block_dims, smem_size, kernel_params, kernel_index);
+    }
+    return record_(grid_dims, fallback_cluster_dims, cluster_dims, block_dims, smem_size, kernel_params, kernel_index);
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  CUresult
+  tensorMapEncodeIm2col(
+      CUtensorMap* tensorMap,
+      CUtensorMapDataType tensorDataType,
+      cuuint32_t tensorRank,
+      void* globalAddress,
+      const cuuint64_t* globalDim,
+      const cuuint64_t* globalStrides,
+      const int* pixelBoxLowerCorner,
+      const int* pixelBoxUpperCorner,
+      cuuint32_t channelsPerPixel,
+      cuuint32_t pixelsPerColumn,
+      const cuuint32_t* elementStrides,
+      CUtensorMapInterleave interleave,
+      CUtensorMapSwizzle swizzle,
+      CUtensorMapL2promotion l2Promotion,
+      CUtensorMapFloatOOBfill oobFill) const override {
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeIm2col)(
+        tensorMap, tensorDataType, tensorRank, globalAddress, globalDim, globalStrides,
+        pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel, pixelsPerColumn, elementStrides,
+        interleave, swizzle, l2Promotion, oobFill);
+  }
+
+  CUresult
+  tensorMapEncodeTiled(
+      CUtensorMap* tensorMap,
+      CUtensorMapDataType tensorDataType,
+      cuuint32_t tensorRank,
+      void* globalAddress,
+      const cuuint64_t* globalDim,
+      const cuuint64_t* globalStrides,
+      const cuuint32_t* boxDim,
+      const cuuint32_t* elementStrides,
+      CUtensorMapInterleave interleave,
+      CUtensorMapSwizzle swizzle,
+      CUtensorMapL2promotion l2Promotion,
+      CUtensorMapFloatOOBfill oobFill) const override {
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+        tensorMap, tensorDataType, tensorRank, globalAddress, globalDim, globalStrides,
+        boxDim, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+  }
+
+  CUresult
+  tensorMapReplaceAddress(CUtensorMap* tensorMap, void* globalAddress) const override {
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapReplaceAddress)(tensorMap, globalAddress);
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+protected:
+
+  /// Fills become memset nodes; elements of 1, 2 and 4 bytes are supported
+  Status
+  memsetDeviceImpl(
+      void* destination,
+      void const* fill_value,
+      size_t fill_size,
+      size_t count,
+      cudaStream_t /* stream */) const override {
+    cudaMemsetParams params = {};
+    params.dst = destination;
+    params.elementSize = static_cast<unsigned int>(fill_size);
+    params.width = count;
+    params.height = 1;
+    params.pitch = 0;
+    if (fill_size == 1) {
+      params.value = *static_cast<uint8_t const*>(fill_value);
+    }
+    else if (fill_size == 2) {
+      params.value = *static_cast<uint16_t const*>(fill_value);
+    }
+    else if (fill_size == 4) {
+      params.value = *static_cast<uint32_t const*>(fill_value);
+    }
+    else {
+      CUTLASS_TRACE_HOST("CudaGraphHostAdapter: fills of " << fill_size << " byte elements are not supported");
+      return Status::kErrorNotSupported;
+    }
+    return count == 0 ? Status::kSuccess : recorder_->add_memset(params);
+  }
+
+private:
+
+  Status
+  record_(
+      dim3 grid_dims,
+      dim3 cluster_dims,
+      dim3 preferred_cluster_dims,
+      dim3 block_dims,
+      size_t smem_size,
+      void** kernel_params,
+      int32_t kernel_index) const {
+    if (kernel_index < 0 || kernel_index >= kernel_count) {
+      return Status::kErrorInvalidProblem;
+    }
+    void* func = kernel_handles[kernel_index];
+
+    // Nodes launch with the attributes the kernel has when the graph is launched
+    if (smem_size >= (48 << 10)) {
+      cudaError_t result = cudaFuncSetAttribute(func, cudaFuncAttributeMaxDynamicSharedMemorySize, int(smem_size));
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error " << cudaGetErrorString(result));
+        return Status::kErrorInternal;
+      }
+    }
+#if (CUDART_VERSION >= 12000)
+    if (cluster_dims.x * cluster_dims.y * cluster_dims.z > 8 ||
+        preferred_cluster_dims.x * preferred_cluster_dims.y * preferred_cluster_dims.z > 8) {
+      cudaError_t result = cudaFuncSetAttribute(func, cudaFuncAttributeNonPortableClusterSizeAllowed, 1);
+      if (result != cudaSuccess) {
+        CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error " << cudaGetErrorString(result));
+        return Status::kErrorInternal;
+      }
+    }
+#endif
+
+    cudaKernelNodeParams params = {};
+    params.func = func;
+    params.gridDim = grid_dims;
+    params.blockDim = block_dims;
+    params.sharedMemBytes = static_cast<unsigned int>(smem_size);
+    params.kernelParams = kernel_params;
+    params.extra = nullptr;
+    return recorder_->add_kernel(params, cluster_dims, preferred_cluster_dims);
+  }
+
+  CudaGraphRecorder* recorder_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
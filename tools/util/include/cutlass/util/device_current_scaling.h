@@ -0,0 +1,142 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Quantization pass for just-in-time (current) per-tensor scaling
+
+    Pairs with the fusion::LinCombEltActAmax epilogue: the GEMM writes its output in high
+    precision together with the amax of that output, and this pass converts the staged tensor
+    to a narrow type using a scale computed on device from the amax of the same iteration.
+    No host round trip or separate amax kernel is needed between the two launches.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/numeric_types.h"
+
+#include <iostream>
+
+namespace cutlass {
+
+/// Returns the quantization scale max(ElementOutput) / amax, or 1 for an all zero or non-finite amax
+template <typename ElementOutput>
+CUTLASS_DEVICE
+float current_scaling_scale(float amax) {
+  float max_output = static_cast<float>(cutlass::platform::numeric_limits<ElementOutput>::max());
+  return (amax > 0.f && isfinite(amax)) ? max_output / amax : 1.f;
+}
+
+template <typename ElementOutput, typename ElementInput, typename ElementAmax, int VectorSize>
+__global__ void quantize_current_scaling_kernel(ElementOutput* output,
+                                                float* scale_inv,
+                                                const ElementInput* input,
+                                                const ElementAmax* amax,
+                                                int64_t count)
+{
+  using InputVector = cutlass::Array<ElementInput, VectorSize>;
+  using OutputVector = cutlass::Array<ElementOutput, VectorSize>;
+  using ComputeVector = cutlass::Array<float, VectorSize>;
+
+  cutlass::NumericArrayConverter<float, ElementInput, VectorSize> convert_input;
+  cutlass::NumericArrayConverter<ElementOutput, float, VectorSize> convert_output;
+  cutlass::multiplies<ComputeVector> mul;
+
+  const float scale = current_scaling_scale<ElementOutput>(static_cast<float>(*amax));
+  const int64_t tid = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+  const int64_t stride = int64_t(gridDim.x) * blockDim.x;
+
+  // The dequantization factor consumers of the quantized tensor apply, e.g. as scale_a/scale_b
+  if (tid == 0 && scale_inv != nullptr) {
+    *scale_inv = 1.f / scale;
+  }
+
+  const int64_t vector_count = count / VectorSize;
+  const InputVector* input_vec = reinterpret_cast<const InputVector*>(input);
+  OutputVector* output_vec = reinterpret_cast<OutputVector*>(output);
+
+  for (int64_t i = tid; i < vector_count; i += stride) {
+    output_vec[i] = convert_output(mul(convert_input(input_vec[i]), scale));
+  }
+
+  for (int64_t i = vector_count * VectorSize + tid; i < count; i += stride) {
+    output[i] = static_cast<ElementOutput>(static_cast<float>(input[i]) * scale);
+  }
+}
+
+/// Quantizes count contiguous elements of input into output with the per-tensor scale
+/// max(ElementOutput) / (*amax), where amax is a device pointer, typically the amax_D_ptr
+/// written by a fusion::LinCombEltActAmax epilogue earlier on the same stream.
+/// If scale_inv is not null, the reciprocal of the applied scale is written to it.
+template <typename ElementOutput, typename ElementInput, typename ElementAmax>
+void quantize_current_scaling(ElementOutput* output,
+                              float* scale_inv,
+                              const ElementInput* input,
+                              const ElementAmax* amax,
+                              int64_t count,
+                              cudaStream_t stream = nullptr)
+{
+  static_assert(cutlass::sizeof_bits<ElementOutput>::value >= 8,
+      "Sub-byte outputs need block scale factors, use the block scaled epilogues instead.");
+
+  constexpr int VectorSize = 128 / cutlass::sizeof_bits<ElementInput>::value;
+  constexpr int kThreads = 256;
+  constexpr int64_t kMaxBlocks = 4096;
+
+  bool is_aligned =
+      reinterpret_cast<uintptr_t>(input) % (VectorSize * sizeof(ElementInput)) == 0 &&
+      reinterpret_cast<uintptr_t>(output) % (VectorSize * sizeof(ElementOutput)) == 0;
+
+  int64_t work = is_aligned ? (count + VectorSize - 1) / VectorSize : count;
+  dim3 grid(static_cast<unsigned>(cutlass::platform::max(int64_t(1),
+                cutlass::platform::min(kMaxBlocks, (work + kThreads - 1) / kThreads))));
+  dim3 block(kThreads);
+
+  if (is_aligned) {
+    quantize_current_scaling_kernel<ElementOutput, ElementInput, ElementAmax, VectorSize><<<grid, block, 0, stream>>>(
+        output, scale_inv, input, amax, count);
+  }
+  else {
+    quantize_current_scaling_kernel<ElementOutput, ElementInput, ElementAmax, 1><<<grid, block, 0, stream>>>(
+        output, scale_inv, input, amax, count);
+  }
+
+  auto result = cudaGetLastError();
+  if (result != cudaSuccess) {
+    std::cerr << "CUDA error: " << cudaGetErrorString(result) << std::endl;
+    abort();
+  }
+}
+
+} // namespace cutlass
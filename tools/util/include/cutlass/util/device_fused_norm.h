@@ -0,0 +1,410 @@
+/******************************************************************************
+ * Copyright (c) 2017 - 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ******************************************************************************/
+
+
+#pragma once
+
+/**
+ * \file
+ * \brief Single-pass residual add and RMSNorm/LayerNorm on device memory tensors with RowMajor layout,
+ *        optionally quantizing the output with block scale factors laid out for SM100 block-scaled GEMMs.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/detail/sm100_blockscaled_layout.hpp"
+#include "device_utils.h"
+#include <cfloat>
+
+namespace cutlass {
+
+/// Normalization computed by fused_add_norm()
+enum class FusedNormKind {
+  kRMSNorm,
+  kLayerNorm
+};
+
+/**
+ * Arguments of fused_add_norm(). Tensors are [m, n] row-major and vectors are [n], all in device memory.
+ *
+ *   h            = input + residual            (residual is optional)
+ *   residual_out = h                           (optional)
+ *   y            = norm(h) * gamma + beta      (beta is optional and only used by LayerNorm)
+ *
+ * Without scale factors, output = ElementOutput(y * norm_constant). With them, each SFVecSize consecutive
+ * elements of a row share sf = ElementScaleFactor(amax(y) * norm_constant / max(ElementOutput)) and
+ * output = ElementOutput(y * norm_constant / sf), as in the block scale factor epilogue of SM100 GEMMs.
+ */
+template <typename T, typename ElementOutput, typename ElementScaleFactor = void>
+struct FusedNormArguments {
+  int m = 0;
+  int n = 0;
+  T const *input = nullptr;
+  T const *residual = nullptr;
+  T *residual_out = nullptr;
+  T const *gamma = nullptr;
+  T const *beta = nullptr;
+  ElementOutput *output = nullptr;
+  ElementScaleFactor *scale_factors = nullptr;    ///< tile_atom_to_shape_SFA() layout of an [m, n] operand A
+  float epsilon = 1e-5f;
+  float norm_constant = 1.0f;
+};
+
+namespace detail {
+
+/// Elements of T per 128-bit access
+template <typename T>
+struct FusedNormVector {
+  static int const kElements = 16 / int(sizeof(T));
+};
+
+/// Layout of the scale factors written for an [m, n] output
+template <int SFVecSize>
+struct FusedNormScaleFactorLayout {
+  using Config = cutlass::detail::Sm1xxBlockScaledConfig<SFVecSize>;
+  using Layout = decltype(Config::tile_atom_to_shape_SFA(cute::make_shape(int(0), int(1), int(0), int(1))));
+
+  static Layout get(int m, int n) {
+    return Config::tile_atom_to_shape_SFA(cute::make_shape(m, int(1), n, int(1)));
+  }
+};
+
+/// Partial Welford statistics
+struct WelfordState {
+  float count;
+  float mean;
+  float m2;
+};
+
+CUTLASS_DEVICE
+WelfordState welford_combine(WelfordState a, WelfordState b) {
+  float count = a.count + b.count;
+  if (count == 0.0f) {
+    return a;
+  }
+  float delta = b.mean - a.mean;
+  float b_ratio = b.count / count;
+  WelfordState result;
+  result.count = count;
+  result.mean = a.mean + delta * b_ratio;
+  result.m2 = a.m2 + b.m2 + delta * delta * a.count * b_ratio;
+  return result;
+}
+
+CUTLASS_DEVICE
+WelfordState welford_warp_reduce(WelfordState state) {
+  #pragma unroll
+  for (int mask = 16; mask > 0; mask >>= 1) {
+    WelfordState other;
+    other.count = __shfl_xor_sync(FINAL_MASK, state.count, mask, 32);
+    other.mean = __shfl_xor_sync(FINAL_MASK, state.mean, mask, 32);
+    other.m2 = __shfl_xor_sync(FINAL_MASK, state.m2, mask, 32);
+    state = welford_combine(state, other);
+  }
+  return state;
+}
+
+/// Result is valid in warp 0
+CUTLASS_DEVICE
+WelfordState welford_block_reduce(WelfordState state) {
+  __shared__ WelfordState shared[32];
+  int lane = threadIdx.x & 0x1f;
+  int wid = threadIdx.x >> 5;
+
+  state = welford_warp_reduce(state);
+  if (lane == 0) {
+    shared[wid] = state;
+  }
+  __syncthreads();
+
+  if (wid == 0) {
+    state = lane < (blockDim.x >> 5) ? shared[lane] : WelfordState{0.0f, 0.0f, 0.0f};
+    state = welford_warp_reduce(state);
+  }
+  return state;
+}
+
+} // namespace detail
+
+/**
+ * grid(m)
+ * block(block_size) -- each block normalizes one row held in registers ; each thread holds
+ *                      CHUNK_PER_THREAD 128-bit chunks of the row
+ */
+template <FusedNormKind Kind, typename T, typename ElementOutput, typename ElementScaleFactor,
+          int SFVecSize, int CHUNK_PER_THREAD, typename LayoutSF>
+__global__ void fused_add_norm_onePassAlgo(FusedNormArguments<T, ElementOutput, ElementScaleFactor> args,
+                                           LayoutSF layout_sf)
+{
+  static int const kVec = detail::FusedNormVector<T>::kElements;
+  static bool const kBlockScaled = !platform::is_same<ElementScaleFactor, void>::value;
+  static int const kLanesPerScaleFactor = kBlockScaled ? SFVecSize / kVec : 1;
+
+  static_assert(!kBlockScaled || (SFVecSize % kVec == 0 && kLanesPerScaleFactor <= 32),
+    "A scale factor must cover a whole number of chunks within a warp.");
+
+  using InputVec = AlignedArray<T, kVec>;
+  using OutputVec = AlignedArray<ElementOutput, kVec>;
+  using ComputeVec = Array<float, kVec>;
+
+  NumericArrayConverter<float, T, kVec> to_float;
+  NumericArrayConverter<T, float, kVec> to_input;
+  NumericArrayConverter<ElementOutput, float, kVec> to_output;
+
+  const int m_idx = blockIdx.x;
+  const int tid = threadIdx.x;
+  const int bdimx = blockDim.x;
+  const int n_vec = args.n / kVec;
+  const size_t offset = size_t(m_idx) * args.n;
+
+  InputVec const *input = reinterpret_cast<InputVec const *>(args.input + offset);
+  InputVec const *residual = reinterpret_cast<InputVec const *>(args.residual + offset);
+  InputVec *residual_out = reinterpret_cast<InputVec *>(args.residual_out + offset);
+  InputVec const *gamma = reinterpret_cast<InputVec const *>(args.gamma);
+  InputVec const *beta = reinterpret_cast<InputVec const *>(args.beta);
+  OutputVec *output = reinterpret_cast<OutputVec *>(args.output) + offset / kVec;
+
+  __shared__ float s_mean, s_rstd;
+
+  // Read the row once, adding the residual and keeping the sum in registers
+  ComputeVec local_val[CHUNK_PER_THREAD];
+  detail::WelfordState welford{0.0f, 0.0f, 0.0f};
+  float local_sums[1] = {0.0f};
+
+  #pragma unroll
+  for (int i = 0; i < CHUNK_PER_THREAD; i++) {
+    int index = tid + i * bdimx;
+    local_val[i].fill(0.0f);
+    if (index < n_vec) {
+      local_val[i] = to_float(input[index]);
+      if (args.residual) {
+        local_val[i] = plus<ComputeVec>{}(local_val[i], to_float(residual[index]));
+        // Normalize the sum as it is seen by the next residual add
+        Array<T, kVec> sum = to_input(local_val[i]);
+        local_val[i] = to_float(sum);
+        if (args.residual_out) {
+          static_cast<Array<T, kVec> &>(residual_out[index]) = sum;
+        }
+      }
+
+      #pragma unroll
+      for (int j = 0; j < kVec; j++) {
+        float v = local_val[i][j];
+        if (Kind == FusedNormKind::kRMSNorm) {
+          local_sums[0] += v * v;
+        }
+        else {
+          welford.count += 1.0f;
+          float delta = v - welford.mean;
+          welford.mean += delta / welford.count;
+          welford.m2 += delta * (v - welford.mean);
+        }
+      }
+    }
+  }
+
+  if (Kind == FusedNormKind::kRMSNorm) {
+    if (blockDim.x <= 32) {
+      warpReduceSum<float, 1>(local_sums);
+    }
+    else {
+      blockReduceSum<float, 1>(local_sums);
+    }
+    if (threadIdx.x == 0) {
+      s_mean = 0.0f;
+      s_rstd = rsqrtf(local_sums[0] / args.n + args.epsilon);
+    }
+  }
+  else {
+    welford = detail::welford_block_reduce(welford);
+    if (threadIdx.x == 0) {
+      s_mean = welford.mean;
+      s_rstd = rsqrtf(welford.m2 / args.n + args.epsilon);
+    }
+  }
+  __syncthreads();
+
+  float const mean = s_mean;
+  float const rstd = s_rstd;
+
+  #pragma unroll
+  for (int i = 0; i < CHUNK_PER_THREAD; i++) {
+    int index = tid + i * bdimx;
+    bool valid = index < n_vec;
+
+    ComputeVec y;
+    y.fill(0.0f);
+    if (valid) {
+      ComputeVec g = to_float(gamma[index]);
+      ComputeVec b;
+      b.fill(0.0f);
+      if (Kind == FusedNormKind::kLayerNorm && args.beta) {
+        b = to_float(beta[index]);
+      }
+
+      #pragma unroll
+      for (int j = 0; j < kVec; j++) {
+        y[j] = (local_val[i][j] - mean) * rstd * g[j] + b[j];
+      }
+    }
+
+    if constexpr (kBlockScaled) {
+      // Lanes holding the chunks of one scale factor vector are adjacent
+      float amax = 0.0f;
+      #pragma unroll
+      for (int j = 0; j < kVec; j++) {
+        amax = fmaxf(amax, fabsf(y[j]));
+      }
+      #pragma unroll
+      for (int mask = kLanesPerScaleFactor / 2; mask > 0; mask >>= 1) {
+        amax = fmaxf(amax, __shfl_xor_sync(FINAL_MASK, amax, mask, 32));
+      }
+
+      float const fp_max = float(platform::numeric_limits<ElementOutput>::max());
+      ElementScaleFactor sf = NumericConverter<ElementScaleFactor, float>{}(amax * args.norm_constant / fp_max);
+      float acc_scale = fminf(args.norm_constant / float(sf), FLT_MAX);
+
+      #pragma unroll
+      for (int j = 0; j < kVec; j++) {
+        y[j] *= acc_scale;
+      }
+
+      if (valid && (index % kLanesPerScaleFactor) == 0) {
+        args.scale_factors[layout_sf(m_idx, index * kVec, 0)] = sf;
+      }
+    }
+    else {
+      #pragma unroll
+      for (int j = 0; j < kVec; j++) {
+        y[j] *= args.norm_constant;
+      }
+    }
+
+    if (valid) {
+      static_cast<Array<ElementOutput, kVec> &>(output[index]) = to_output(y);
+    }
+  }
+}
+
+/// Returns the number of scale factors fused_add_norm() addresses for an [m, n] output, including the padding
+/// of the block-scaled layout
+template <int SFVecSize>
+size_t fused_norm_scale_factor_count(int m, int n) {
+  return size_t(cute::size(cute::filter_zeros(detail::FusedNormScaleFactorLayout<SFVecSize>::get(m, n))));
+}
+
+namespace detail {
+
+template <FusedNormKind Kind, int SFVecSize, int CHUNK_PER_THREAD, typename T, typename ElementOutput,
+          typename ElementScaleFactor>
+void fused_add_norm_launch(FusedNormArguments<T, ElementOutput, ElementScaleFactor> const &args,
+                           dim3 grid, dim3 block, cudaStream_t stream) {
+  if constexpr (platform::is_same<ElementScaleFactor, void>::value) {
+    fused_add_norm_onePassAlgo<Kind, T, ElementOutput, ElementScaleFactor, SFVecSize, CHUNK_PER_THREAD, int>
+      <<<grid, block, 0, stream>>>(args, 0);
+  }
+  else {
+    auto layout_sf = FusedNormScaleFactorLayout<SFVecSize>::get(args.m, args.n);
+    fused_add_norm_onePassAlgo<Kind, T, ElementOutput, ElementScaleFactor, SFVecSize, CHUNK_PER_THREAD, decltype(layout_sf)>
+      <<<grid, block, 0, stream>>>(args, layout_sf);
+  }
+}
+
+} // namespace detail
+
+/** \brief Residual add and RMSNorm/LayerNorm of each row in a single read of global memory, optionally
+ *         quantizing the output with SFVecSize-element block scale factors.
+ *
+ * Requires n to be a multiple of 128 bits of T (and of SFVecSize when block scaled), 16B aligned tensors,
+ * and n <= 8192 * 128 bits of T, i.e. 65536 half-precision or 32768 single-precision elements.
+ * \tparam T: input, residual, gamma and beta type (half_t, bfloat16_t, or float)
+ */
+template <FusedNormKind Kind, int SFVecSize = 16, typename T, typename ElementOutput, typename ElementScaleFactor>
+cudaError_t fused_add_norm(FusedNormArguments<T, ElementOutput, ElementScaleFactor> const &args,
+                           cudaStream_t stream = nullptr) {
+
+  static int const kVec = detail::FusedNormVector<T>::kElements;
+  static bool const kBlockScaled = !platform::is_same<ElementScaleFactor, void>::value;
+
+  auto misaligned = [](void const *ptr) {
+    return (reinterpret_cast<uintptr_t>(ptr) % 16) != 0;
+  };
+
+  if (args.m <= 0 || args.n <= 0 || args.n % kVec != 0 || (kBlockScaled && args.n % SFVecSize != 0) ||
+      !args.input || !args.gamma || !args.output || (kBlockScaled && !args.scale_factors) ||
+      misaligned(args.input) || misaligned(args.residual) || misaligned(args.residual_out) ||
+      misaligned(args.gamma) || misaligned(args.beta)) {
+    return cudaErrorInvalidValue;
+  }
+
+  int const n_vec = args.n / kVec;
+  dim3 grid(args.m);
+  dim3 block;
+
+  auto block_size = [n_vec](int chunk_per_thread) {
+    return ((n_vec + chunk_per_thread - 1) / chunk_per_thread + 31) / 32 * 32;
+  };
+
+  if constexpr (kBlockScaled) {
+    // Scale factors beyond the extent of the output pad the layout and are cleared
+    cudaError_t result = cudaMemsetAsync(args.scale_factors, 0,
+      fused_norm_scale_factor_count<SFVecSize>(args.m, args.n) * sizeof(ElementScaleFactor), stream);
+    if (result != cudaSuccess) {
+      return result;
+    }
+  }
+
+  if (block_size(1) <= 1024) {
+    block.x = block_size(1);
+    detail::fused_add_norm_launch<Kind, SFVecSize, 1>(args, grid, block, stream);
+  }
+  else if (block_size(2) <= 1024) {
+    block.x = block_size(2);
+    detail::fused_add_norm_launch<Kind, SFVecSize, 2>(args, grid, block, stream);
+  }
+  else if (block_size(4) <= 1024) {
+    block.x = block_size(4);
+    detail::fused_add_norm_launch<Kind, SFVecSize, 4>(args, grid, block, stream);
+  }
+  else if (block_size(8) <= 1024) {
+    block.x = block_size(8);
+    detail::fused_add_norm_launch<Kind, SFVecSize, 8>(args, grid, block, stream);
+  }
+  else {
+    return cudaErrorInvalidValue;
+  }
+
+  return cudaGetLastError();
+}
+
+} // namespace cutlass
@@ -0,0 +1,141 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Device-side arguments for K-grouped GEMMs such as MoE weight gradients
+
+    A K-grouped GEMM computes, for every group e, D_e = alpha * A_e * B_e^T + beta * C_e, where all
+    groups share M and N while the K extent of each group is ragged. In the MoE backward pass
+    dW_e = dY_e^T * X_e, K is the number of tokens routed to expert e, and the tokens of all experts
+    are stored contiguously: dY is [tokens, M] and X is [tokens, N], both row-major. Viewed as GEMM
+    operands, A_e is M x K_e and B_e is N x K_e, both MN-major, and start at token offset_e.
+
+    make_k_grouped_gemm_arguments() builds the per-group problem shapes, operand pointers and
+    strides of a ptr-array grouped GEMM (mode kGrouped) from tokens_per_group on device, so the
+    router's counts never travel to the host. The grouped tile schedulers then walk each group's
+    M x N tiles over that group's K segment. Since M and N are fixed, the C/D pointer and stride
+    arrays do not depend on the routing and can be built once on the host; accumulating into fp32
+    main gradients is C_e = D_e with beta = 1.
+
+    Groups without tokens are given an empty M extent so that no tile is scheduled and D_e is left
+    untouched, which is exact for beta = 1 (a GEMM with K = 0 would otherwise store an accumulator
+    that no MMA has cleared). Users of beta != 1 must handle empty groups themselves.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cute/tensor.hpp"
+#include "cutlass/util/packed_stride.hpp"
+
+#include <iostream>
+
+namespace cutlass {
+
+namespace detail {
+
+template <class ProblemShape, class ElementA, class StrideA, class ElementB, class StrideB>
+__global__ void make_k_grouped_gemm_arguments_kernel(
+    int num_groups, int m, int n,
+    int32_t const* tokens_per_group,
+    int64_t const* token_offsets,
+    ElementA const* ptr_A_base,
+    ElementB const* ptr_B_base,
+    ProblemShape* problem_shapes,
+    ElementA const** ptr_A, StrideA* stride_A,
+    ElementB const** ptr_B, StrideB* stride_B)
+{
+  for (int group = blockIdx.x * blockDim.x + threadIdx.x; group < num_groups; group += gridDim.x * blockDim.x) {
+    int k = tokens_per_group[group];
+
+    int64_t offset = 0;
+    if (token_offsets != nullptr) {
+      offset = token_offsets[group];
+    }
+    else {
+      // Groups are few (experts per rank), so each thread sums its prefix directly
+      for (int i = 0; i < group; ++i) {
+        offset += tokens_per_group[i];
+      }
+    }
+
+    problem_shapes[group] = ProblemShape{k > 0 ? m : 0, n, k};
+    ptr_A[group] = ptr_A_base + offset * m;
+    ptr_B[group] = ptr_B_base + offset * n;
+    stride_A[group] = cutlass::make_cute_packed_stride(StrideA{}, cute::make_shape(m, cute::max(k, 1), 1));
+    stride_B[group] = cutlass::make_cute_packed_stride(StrideB{}, cute::make_shape(n, cute::max(k, 1), 1));
+  }
+}
+
+} // namespace detail
+
+/// Fills the per-group problem shapes, A/B pointers and A/B strides of a K-grouped GEMM on device.
+///
+/// tokens_per_group is a device array of num_groups K extents. token_offsets is an optional device
+/// array of their exclusive prefix sums; when null it is recomputed. A and B are token-major
+/// ([tokens, m] and [tokens, n] row-major) allocations starting at ptr_A_base and ptr_B_base.
+/// All output arrays are device arrays of num_groups entries.
+template <class ProblemShape, class ElementA, class StrideA, class ElementB, class StrideB>
+void make_k_grouped_gemm_arguments(
+    int num_groups, int m, int n,
+    int32_t const* tokens_per_group,
+    int64_t const* token_offsets,
+    ElementA const* ptr_A_base,
+    ElementB const* ptr_B_base,
+    ProblemShape* problem_shapes,
+    ElementA const** ptr_A, StrideA* stride_A,
+    ElementB const** ptr_B, StrideB* stride_B,
+    cudaStream_t stream = nullptr)
+{
+  static_assert(cute::is_constant<1, decltype(cute::get<0>(StrideA{}))>::value,
+      "K-grouped A must be M-major: consecutive tokens are m elements apart.");
+  static_assert(cute::is_constant<1, decltype(cute::get<0>(StrideB{}))>::value,
+      "K-grouped B must be N-major: consecutive tokens are n elements apart.");
+
+  if (num_groups <= 0) {
+    return;
+  }
+
+  constexpr int kThreads = 128;
+  dim3 grid((num_groups + kThreads - 1) / kThreads);
+  dim3 block(kThreads);
+
+  detail::make_k_grouped_gemm_arguments_kernel<<<grid, block, 0, stream>>>(
+      num_groups, m, n, tokens_per_group, token_offsets, ptr_A_base, ptr_B_base,
+      problem_shapes, ptr_A, stride_A, ptr_B, stride_B);
+
+  auto result = cudaGetLastError();
+  if (result != cudaSuccess) {
+    std::cerr << "CUDA error: " << cudaGetErrorString(result) << std::endl;
+    abort();
+  }
+}
+
+} // namespace cutlass
@@ -90,6 +90,38 @@ void free(T* ptr) {
   }
 }
 
+/// Allocate a buffer of \p count elements of type \p T in page-locked host memory
+template <typename T>
+T* allocate_host_pinned(size_t count = 1) {
+
+  T* ptr = 0;
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+
+  cudaError_t cuda_error = cudaMallocHost((void**)&ptr, bytes);
+
+  if (cuda_error != cudaSuccess) {
+#if (CUTLASS_DEBUG_TRACE_LEVEL > 0)
+    std::ostringstream os;
+    os << "cutlass::device_memory::allocate_host_pinned: cudaMallocHost failed: bytes=" << bytes;
+    CUTLASS_TRACE_HOST(os.str());
+#endif
+    throw cuda_exception("Failed to allocate pinned host memory", cuda_error);
+  }
+
+  return ptr;
+}
+
+/// Free the page-locked host buffer pointed to by \p ptr
+template <typename T>
+void free_host_pinned(T* ptr) {
+  if (ptr) {
+    cudaError_t cuda_error = (cudaFreeHost(ptr));
+    if (cuda_error != cudaSuccess) {
+      throw cuda_exception("Failed to free pinned host memory", cuda_error);
+    }
+  }
+}
+
 /******************************************************************************
  * Data movement
  ******************************************************************************/
@@ -130,6 +162,26 @@ void copy(T* dst, T const* src, size_t count, cudaMemcpyKind kind) {
   }
 }
 
+/// Enqueues a copy on \p stream. The copy is only asynchronous with respect to the host if the
+/// host-side buffer is page-locked.
+template <typename T>
+void copy_async(T* dst, T const* src, size_t count, cudaMemcpyKind kind, cudaStream_t stream) {
+  size_t bytes = count * sizeof_bits<T>::value / 8;
+  if (bytes == 0 && count > 0) {
+    bytes = 1;
+  }
+  cudaError_t cuda_error = (cudaMemcpyAsync(dst, src, bytes, kind, stream));
+  if (cuda_error != cudaSuccess) {
+    std::ostringstream os;
+    os << "cutlass::device_memory::copy_async: cudaMemcpyAsync() failed: "
+       << "dst=" << dst << ", src=" << src
+       << ", bytes=" << bytes << ", count=" << count
+       << ", error: " << cudaGetErrorString(cuda_error);
+
+    throw cuda_exception(os.str().c_str(), cuda_error);
+  }
+}
+
 template <typename T>
 void copy_to_device(T* dst, T const* src, size_t count = 1) {
   copy(dst, src, count, cudaMemcpyHostToDevice);
@@ -150,6 +202,16 @@ void copy_host_to_host(T* dst, T const* src, size_t count = 1) {
   copy(dst, src, count, cudaMemcpyHostToHost);
 }
 
+template <typename T>
+void copy_to_device_async(T* dst, T const* src, size_t count = 1, cudaStream_t stream = nullptr) {
+  copy_async(dst, src, count, cudaMemcpyHostToDevice, stream);
+}
+
+template <typename T>
+void copy_to_host_async(T* dst, T const* src, size_t count = 1, cudaStream_t stream = nullptr) {
+  copy_async(dst, src, count, cudaMemcpyDeviceToHost, stream);
+}
+
 /// Copies elements from device memory to host-side range
 template <typename OutputIterator, typename T>
 void insert_to_host(OutputIterator begin, OutputIterator end, T const* device_begin) {
@@ -0,0 +1,107 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+#pragma once
+
+/**
+ * \file
+ * \brief cuda kernels to expand a quaternion matrix into its real right-product form.
+ *
+ * A quaternion GEMM C = A * B, with A (M x K) and C (M x N) row-major quaternion matrices, is
+ * exactly the real GEMM C_real = A_real * B_real where
+ *   - A_real (M x 4K) and C_real (M x 4N) are the same buffers viewed as row-major real matrices
+ *   - B_real (4K x 4N) holds the 4x4 right-product matrix of every element of B
+ * so any tensor core GEMM (e.g. SM90/SM100 CollectiveBuilder kernels) can compute it after B is
+ * expanded once. This is the 16-product form; the reduced 8-multiplication form trades products
+ * for additions and does not map onto MMA instructions.
+ */
+
+#include "cutlass/cutlass.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/matrix_coord.h"
+#include "cutlass/quaternion.h"
+#include "cutlass/tensor_ref.h"
+
+namespace cutlass {
+
+/** \brief expands a K x N quaternion matrix into the (4K) x (4N) real column-major matrix of right products
+ * \tparam Element: real data type of the quaternion components
+ * \tparam LayoutB: layout of the quaternion matrix
+ */
+template <typename Element, typename LayoutB>
+void quaternion_right_product_expand(cutlass::MatrixCoord extent,
+                                     TensorRef<Quaternion<Element> const, LayoutB> ref_B,
+                                     TensorRef<Element, layout::ColumnMajor> ref_B_real,
+                                     cudaStream_t stream);
+
+template <typename Element, typename LayoutB>
+__global__ void quaternion_right_product_expand_kernel(const int32_t k,
+                                                       const int32_t n,
+                                                       TensorRef<Quaternion<Element> const, LayoutB> ref_B,
+                                                       TensorRef<Element, layout::ColumnMajor> ref_B_real) {
+
+  const int64_t idx_jump       = int64_t(blockDim.x) * gridDim.x;
+  const int64_t total_elements = int64_t(k) * n;
+
+  // Consecutive threads walk down a column of B so that the expanded writes stay contiguous in K
+  for (int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < total_elements; idx += idx_jump) {
+    int32_t k_idx = int32_t(idx % k);
+    int32_t n_idx = int32_t(idx / k);
+
+    Matrix4x4<Element> right = ref_B.at({k_idx, n_idx}).as_right_product_matrix_4x4();
+
+    CUTLASS_PRAGMA_UNROLL
+    for (int c = 0; c < 4; ++c) {
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < 4; ++j) {
+        ref_B_real.at({4 * k_idx + j, 4 * n_idx + c}) = right.at(c, j);
+      }
+    }
+  }
+}
+
+template <typename Element, typename LayoutB>
+void quaternion_right_product_expand(cutlass::MatrixCoord extent,
+                                     TensorRef<Quaternion<Element> const, LayoutB> ref_B,
+                                     TensorRef<Element, layout::ColumnMajor> ref_B_real,
+                                     cudaStream_t stream) {
+
+  int32_t k = extent.row();
+  int32_t n = extent.column();
+
+  dim3 block(256);
+  int64_t blocks = (int64_t(k) * n + block.x - 1) / block.x;
+  dim3 grid(int32_t(blocks < 65535 ? blocks : 65535));
+
+  quaternion_right_product_expand_kernel<<<grid, block, 0, stream>>>(k, n, ref_B, ref_B_real);
+}
+
+} // namespace cutlass
@@ -0,0 +1,188 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Kernel parameters of a persistent 3.x GEMM pre-initialized per green context partition.
+*/
+
+#pragma once
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/trace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns the number of SMs kernels launched onto a stream may run on: the SM count of the
+/// green context the stream was created in, or of the whole device for any other stream.
+/// Green contexts are queried through the CUDA driver API, which callers have to link.
+inline int
+query_stream_multiprocessor_count(cudaStream_t stream, int device_id = 0) {
+#if defined(CUDA_VERSION) && (CUDA_VERSION >= 12040)
+  if (stream != nullptr) {
+    CUgreenCtx green_ctx = nullptr;
+    CUresult result = cuStreamGetGreenCtx(static_cast<CUstream>(stream), &green_ctx);
+    if (result == CUDA_SUCCESS && green_ctx != nullptr) {
+      CUdevResource resource;
+      result = cuGreenCtxGetDevResource(green_ctx, &resource, CU_DEV_RESOURCE_TYPE_SM);
+      if (result == CUDA_SUCCESS) {
+        return static_cast<int>(resource.sm.smCount);
+      }
+      CUTLASS_TRACE_HOST("  cuGreenCtxGetDevResource() returned error " << result);
+    }
+  }
+#endif
+  return KernelHardwareInfo::query_device_multiprocessor_count(device_id);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel parameters of a persistent GEMM (a 3.x GemmUniversalAdapter) initialized once for each
+/// SM partition size a device is split into with green contexts. Launching onto a partition picks
+/// the parameters of its SM count, so a server can reshape its partitions between launches
+/// without calling initialize() again: the launch path does no occupancy query, TMA descriptor
+/// encoding or smem attribute setup. All partitions compute the problem of the arguments they
+/// were added with.
+///
+/// The grid of a persistent kernel follows the SM count and max active clusters it was
+/// initialized with, hence one set of parameters per partition size. Partitions of the same size
+/// share parameters. Kernels that need a device workspace (e.g. stream-K) are not supported, since
+/// it would have to be re-initialized before every launch.
+template <class Gemm_>
+class GemmPartitionParams {
+public:
+  using Gemm = Gemm_;
+  using GemmKernel = typename Gemm::GemmKernel;
+  using Arguments = typename Gemm::Arguments;
+  using Params = typename Gemm::Params;
+
+  struct Partition {
+    KernelHardwareInfo hw_info;
+    Params params;
+  };
+
+  /// Hardware info of the partition a stream launches onto. The max active clusters are queried
+  /// against the stream, i.e. scoped to its green context.
+  static KernelHardwareInfo
+  make_hw_info(cudaStream_t stream, int device_id = 0, int cta_budget = 0) {
+    return KernelHardwareInfo::make_kernel_hardware_info<GemmKernel>(
+        device_id, query_stream_multiprocessor_count(stream, device_id), 0, stream, cta_budget);
+  }
+
+  /// Initializes the parameters of the partition of a stream, replacing those of an earlier
+  /// partition with the same SM count. Of args.hw_info, only the device and CTA budget are used.
+  Status
+  add_partition(Arguments args, cudaStream_t stream) {
+    args.hw_info = make_hw_info(stream, args.hw_info.device_id, args.hw_info.cta_budget);
+
+    if (Gemm::get_workspace_size(args) != 0) {
+      CUTLASS_TRACE_HOST("GemmPartitionParams::add_partition() - kernels with a workspace are not supported");
+      return Status::kErrorNotSupported;
+    }
+
+    Status status = Gemm::can_implement(args);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    Gemm gemm;
+    status = gemm.initialize(args, nullptr, stream);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+
+    Partition* partition = find_(args.hw_info.sm_count);
+    if (partition != nullptr) {
+      *partition = Partition{args.hw_info, gemm.params()};
+    }
+    else {
+      partitions_.push_back(Partition{args.hw_info, gemm.params()});
+    }
+    CUTLASS_TRACE_HOST("GemmPartitionParams::add_partition() - sm_count: " << args.hw_info.sm_count
+        << ", max_active_clusters: " << args.hw_info.max_active_clusters);
+    return Status::kSuccess;
+  }
+
+  /// Parameters initialized for partitions of sm_count SMs, or nullptr
+  Partition const*
+  find(int sm_count) const {
+    for (Partition const& partition : partitions_) {
+      if (partition.hw_info.sm_count == sm_count) {
+        return &partition;
+      }
+    }
+    return nullptr;
+  }
+
+  /// Launches onto a stream of a partition of sm_count SMs, with the parameters initialized for it
+  Status
+  run(int sm_count, cudaStream_t stream, bool launch_with_pdl = false) {
+    Partition* partition = find_(sm_count);
+    if (partition == nullptr) {
+      CUTLASS_TRACE_HOST("GemmPartitionParams::run() - no partition of " << sm_count << " SMs");
+      return Status::kErrorInvalidProblem;
+    }
+    return Gemm::run(partition->params, stream, /* cuda_adapter = */ nullptr, launch_with_pdl);
+  }
+
+  /// Launches onto a stream with the parameters of its partition. Queries the SM count of the
+  /// stream's green context; callers that track partition sizes can use run(sm_count, stream).
+  Status
+  run(cudaStream_t stream, bool launch_with_pdl = false) {
+    int device_id = partitions_.empty() ? 0 : partitions_.front().hw_info.device_id;
+    return run(query_stream_multiprocessor_count(stream, device_id), stream, launch_with_pdl);
+  }
+
+  size_t size() const { return partitions_.size(); }
+
+  void clear() { partitions_.clear(); }
+
+private:
+  Partition*
+  find_(int sm_count) {
+    return const_cast<Partition*>(static_cast<GemmPartitionParams const*>(this)->find(sm_count));
+  }
+
+  std::vector<Partition> partitions_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,9 +39,17 @@
 
   Call {host, device}_{data, ref, view}() for accessing host or device memory.
 
+  The host-side storage is selected by HostTensorAllocation. Pinned host memory allows
+  sync_{host, device}_async() to overlap with other work on the stream, and device-only tensors
+  skip the host allocation altogether for operands that are initialized and consumed on the device.
+
   See cutlass/tensor_ref.h and cutlass/tensor_view.h for more details.
 */
 
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "cutlass/cutlass.h"
@@ -55,6 +63,65 @@ namespace cutlass {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Host-side storage of a HostTensor
+enum class HostTensorAllocation {
+  kPageable,        ///< host memory is obtained from the C++ allocator
+  kPinned,          ///< host memory is page-locked with cudaMallocHost()
+  kDeviceOnly       ///< no host memory is allocated; host accessors return null
+};
+
+namespace detail {
+
+/// Allocator of HostTensor host storage which is either pageable or page-locked
+template <typename T>
+struct HostTensorAllocator {
+
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  bool pinned = false;
+
+  HostTensorAllocator() = default;
+
+  explicit HostTensorAllocator(bool pinned_): pinned(pinned_) { }
+
+  template <typename U>
+  HostTensorAllocator(HostTensorAllocator<U> const &other): pinned(other.pinned) { }
+
+  T *allocate(size_t count) {
+    if (pinned) {
+      return device_memory::allocate_host_pinned<T>(count);
+    }
+    return std::allocator<T>().allocate(count);
+  }
+
+  void deallocate(T *ptr, size_t count) {
+    if (pinned) {
+      // noexcept
+      cudaFreeHost(ptr);
+    }
+    else {
+      std::allocator<T>().deallocate(ptr, count);
+    }
+  }
+
+  template <typename U>
+  bool operator==(HostTensorAllocator<U> const &other) const {
+    return pinned == other.pinned;
+  }
+
+  template <typename U>
+  bool operator!=(HostTensorAllocator<U> const &other) const {
+    return pinned != other.pinned;
+  }
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Host tensor
 template <
   /// Data type of element stored within tensor (concept: NumericType)
@@ -124,8 +191,11 @@ private:
   /// Layout object
   Layout layout_;
 
+  /// Host-side storage selection
+  HostTensorAllocation allocation_ = HostTensorAllocation::kPageable;
+
   /// Host-side memory allocation
-  std::vector<StorageUnit> host_;
+  std::vector<StorageUnit, detail::HostTensorAllocator<StorageUnit>> host_;
 
   /// Device-side memory
   device_memory::allocation<StorageUnit> device_;
@@ -135,6 +205,18 @@ private:
     return (count + kContainerTypeNumLogicalElements - 1) / kContainerTypeNumLogicalElements * kContainerTypeNumStorageUnit;
   }
 
+  /// Number of storage units reserved, which are held by the device alone for device-only tensors
+  size_t container_storage_unit_count() const {
+    return allocation_ == HostTensorAllocation::kDeviceOnly ? device_.size() : host_.size();
+  }
+
+  /// Copies through host memory are rejected for device-only tensors, which have none
+  void require_host_backed(char const *operation) const {
+    if (!host_backed()) {
+      throw std::logic_error(std::string("cutlass::HostTensor::") + operation + "() on a device-only tensor");
+    }
+  }
+
 public:
   //
   // Device and Host Methods
@@ -162,6 +244,25 @@ public:
     this->reset(extent, layout, device_backed);
   }
 
+  /// Constructs a device-backed tensor given an extent and host storage selection. Assumes a packed layout
+  HostTensor(
+    TensorCoord const &extent,
+    HostTensorAllocation allocation
+  ) {
+
+    this->reset(extent, Layout::packed(extent), allocation);
+  }
+
+  /// Constructs a device-backed tensor given an extent, layout, and host storage selection
+  HostTensor(
+    TensorCoord const &extent,
+    Layout const &layout,
+    HostTensorAllocation allocation
+  ) {
+
+    this->reset(extent, layout, allocation);
+  }
+
   ~HostTensor() { }
 
   /// Clears the HostTensor allocation to size/capacity = 0
@@ -173,7 +274,8 @@ public:
     device_.reset();
   }
 
-  /// Resizes internal memory allocations without affecting layout or extent
+  /// Resizes internal memory allocations without affecting layout or extent. The host storage
+  /// selection of the most recent allocation is retained.
   void reserve(
     size_t count,                                        ///< size of tensor in elements
     bool device_backed_ = true) {                        ///< if true, device memory is also allocated
@@ -181,14 +283,21 @@ public:
     CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve(count=" << count << ", device_backed_=" << (device_backed_ ? "true" : "false") << ")");
 #endif
 
+    // A device-only tensor has no other storage
+    if (allocation_ == HostTensorAllocation::kDeviceOnly) {
+      device_backed_ = true;
+    }
+
     device_.reset();
-    host_.clear();
+    host_ = decltype(host_)(detail::HostTensorAllocator<StorageUnit>(allocation_ == HostTensorAllocation::kPinned));
 
     size_t count_container = count_to_container_storage_unit_count(count);
+    if (allocation_ != HostTensorAllocation::kDeviceOnly) {
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
-    CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve: host_.resize(" << count_container << ")");
-#endif    
-    host_.resize(count_container);
+      CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve: host_.resize(" << count_container << ")");
+#endif
+      host_.resize(count_container);
+    }
 
     // Allocate memory
     StorageUnit* device_memory = nullptr;
@@ -201,6 +310,16 @@ public:
     device_.reset(device_memory, device_backed_ ? count_container : 0);
   }
 
+  /// Resizes internal memory allocations with the given host storage selection. Device memory
+  /// is always allocated.
+  void reserve(
+    size_t count,                                        ///< size of tensor in elements
+    HostTensorAllocation allocation) {                   ///< host-side storage selection
+
+    allocation_ = allocation;
+    reserve(count, true);
+  }
+
   /// Updates the extent and layout of the HostTensor. Allocates memory according to the new
   /// extent and layout.
   void reset(
@@ -223,6 +342,28 @@ public:
     reset(extent, Layout::packed(extent), device_backed_);
   }
 
+  /// Updates the extent, layout, and host storage selection of the HostTensor. Allocates memory
+  /// according to the new extent and layout. Device memory is always allocated.
+  void reset(
+    TensorCoord const &extent,                           ///< extent of logical tensor
+    Layout const &layout,                                ///< layout object of tensor
+    HostTensorAllocation allocation) {                   ///< host-side storage selection
+
+    extent_ = extent;
+    layout_ = layout;
+
+    reserve(size_t(layout_.capacity(extent_)), allocation);
+  }
+
+  /// Updates the extent and host storage selection of the HostTensor. Allocates memory according
+  /// to the new extent. Assumes a packed tensor configuration.
+  void reset(
+    TensorCoord const &extent,                           ///< extent of logical tensor
+    HostTensorAllocation allocation) {                   ///< host-side storage selection
+
+    reset(extent, Layout::packed(extent), allocation);
+  }
+
   /// Changes the size of the logical tensor. Only allocates memory if new capacity exceeds reserved capacity.
   /// To force allocation, call reset().
   void resize(
@@ -236,7 +377,7 @@ public:
     LongIndex new_size = size_t(layout_.capacity(extent_));
     LongIndex new_size_container = count_to_container_storage_unit_count((layout_.capacity(extent_)));
 
-    if (static_cast<decltype(host_.size())>(new_size_container) > host_.size()) {
+    if (static_cast<size_t>(new_size_container) > container_storage_unit_count()) {
       reserve(new_size, device_backed_);
     }
   }
@@ -257,7 +398,7 @@ public:
 
   /// Returns the logical capacity in terms of number of elements. May be larger than the size().
   LongIndex capacity() const {
-    return host_.size() / kContainerTypeNumStorageUnit * kContainerTypeNumLogicalElements;
+    return container_storage_unit_count() / kContainerTypeNumStorageUnit * kContainerTypeNumLogicalElements;
   }
 
   /// Gets pointer to host data
@@ -335,6 +476,16 @@ public:
     return (device_.get() == nullptr) ? false : true;
   }
 
+  /// Returns true if host memory is allocated
+  bool host_backed() const {
+    return allocation_ != HostTensorAllocation::kDeviceOnly;
+  }
+
+  /// Returns the host-side storage selection
+  HostTensorAllocation allocation() const {
+    return allocation_;
+  }
+
 
   /// Returns the layout object
   Layout & layout() {
@@ -393,7 +544,7 @@ public:
 
   /// Copies data from device to host
   void sync_host() {
-    if (device_backed()) {
+    if (device_backed() && host_backed()) {
       device_memory::copy_to_host(
           host_.data(), device_.get(), device_.size());
     }
@@ -401,17 +552,37 @@ public:
 
   /// Copies data from host to device
   void sync_device() {
-    if (device_backed()) {
+    if (device_backed() && host_backed()) {
       device_memory::copy_to_device(
           device_.get(), host_.data(), host_.size());
     }
   }
 
+  /// Enqueues a copy of data from device to host on a stream. Host memory must not be accessed
+  /// before the stream is synchronized. Overlaps with host execution only if host memory is pinned.
+  void sync_host_async(cudaStream_t stream = nullptr) {
+    if (device_backed() && host_backed()) {
+      device_memory::copy_to_host_async(
+          host_.data(), device_.get(), device_.size(), stream);
+    }
+  }
+
+  /// Enqueues a copy of data from host to device on a stream. Host memory must not be modified
+  /// before the stream is synchronized. Overlaps with host execution only if host memory is pinned.
+  void sync_device_async(cudaStream_t stream = nullptr) {
+    if (device_backed() && host_backed()) {
+      device_memory::copy_to_device_async(
+          device_.get(), host_.data(), host_.size(), stream);
+    }
+  }
+
   /// Copy data from a caller-supplied device pointer into host memory.
   void copy_in_device_to_host(
     Element const* ptr_device,        ///< source device memory
     LongIndex count = -1) {           ///< number of elements to transfer; if negative, entire tensor is overwritten.
 
+    require_host_backed("copy_in_device_to_host");
+
     if (count < 0) {
       count = capacity();
     }
@@ -460,6 +631,8 @@ public:
     Element const* ptr_host,          ///< source host memory
     LongIndex count = -1) {           ///< number of elements to transfer; if negative, entire tensor is overwritten.
 
+    require_host_backed("copy_in_host_to_host");
+
     if (count < 0) {
       count = capacity();
     }
@@ -508,6 +681,8 @@ public:
     Element * ptr_device,             ///< source host memory
     LongIndex count = -1) const {     ///< number of elements to transfer; if negative, entire tensor is overwritten.
 
+    require_host_backed("copy_out_host_to_device");
+
     if (count < 0) {
       count = capacity();
     }
@@ -524,6 +699,8 @@ public:
     Element * ptr_host,               ///< source host memory
     LongIndex count = -1) const {     ///< number of elements to transfer; if negative, entire tensor is overwritten.
 
+    require_host_backed("copy_out_host_to_host");
+
     if (count < 0) {
       count = capacity();
     }
@@ -524,6 +524,112 @@ void reorder_tensor(
   cutlass::device_memory::copy_device_to_device(data, temp.get(), static_cast<size_t>(size(layout_src)));
 }
 
+namespace detail {
+
+// Value order within each thread for which the register conversion of the narrow type to the MMA type
+// is specialized (see LayoutAwareConvertImpl), or the identity if it is not.
+template <class ElementQuant, class ElementMma>
+constexpr auto get_mixed_dtype_value_shuffle() {
+  using namespace cute;
+  constexpr bool IsMma16b = is_same_v<ElementMma, cutlass::half_t> || is_same_v<ElementMma, cutlass::bfloat16_t>;
+  if constexpr (IsMma16b && (is_same_v<ElementQuant, cutlass::int4b_t> || is_same_v<ElementQuant, cutlass::uint4b_t>)) {
+    return Layout<Shape<_2,_4>, Stride<_4,_1>>{}; // order [0,2,4,6,1,3,5,7]
+  }
+  else if constexpr ((IsMma16b && is_same_v<ElementQuant, int8_t>) ||
+                     (is_same_v<ElementMma, cutlass::half_t> && is_same_v<ElementQuant, cutlass::float_e5m2_t>)) {
+    return Layout<Shape<_2,_2>, Stride<_2,_1>>{}; // order [0,2,1,3]
+  }
+  else {
+    return Layout<_1>{};
+  }
+}
+
+} // namespace detail
+
+// Formats of the narrow operand and of its scales with which a Hopper mixed-input collective mainloop
+// dequantizes in registers with the fewest instructions:
+// - If the mainloop takes a layout as the stride of the narrow operand, the operand is reordered so that
+//   the values of each thread are contiguous in memory (see compute_memory_reordering_atom), in the value
+//   order for which the conversion to the MMA type is specialized.
+// - INT4 weights converted to FP8 through a lookup table are re-encoded (see unified_encode_int4b) and
+//   their scales packed into the table entries (see pack_scale_fp8).
+template <class CollectiveMainloop>
+struct MixedDtypeOperandFormat {
+  using ElementQuant = typename CollectiveMainloop::RealSwappedElementA;
+  using ElementMma = typename CollectiveMainloop::RealSwappedElementB;
+  using ElementScale = typename CollectiveMainloop::ElementScale;
+  using StrideQuant = typename CollectiveMainloop::SwappedStrideA;
+  using ConversionMode = typename CollectiveMainloop::ConversionMode;
+  static constexpr ConversionMode KernelConversionMode = CollectiveMainloop::KernelConversionMode;
+
+  static constexpr bool IsReordered = cute::is_layout<StrideQuant>::value;
+  static constexpr bool IsUnifiedEncoding = CollectiveMainloop::UseScaleLookupTable &&
+                                            cute::is_same_v<ElementQuant, cutlass::int4b_t>;
+  static constexpr bool IsPackedScale = CollectiveMainloop::UseScaleLookupTable;
+
+  // Lookup tables index the weights in their natural order
+  using ValueShuffle = cute::conditional_t<
+    KernelConversionMode == ConversionMode::ConvertWithLookupTable,
+    cute::Layout<cute::_1>,
+    decltype(detail::get_mixed_dtype_value_shuffle<ElementQuant, ElementMma>())>;
+  // The mainloop copies the narrow operand to registers one MMA instruction at a time
+  using MmaAtomShape = cute::Layout<cute::Shape<cute::_1,cute::_1>>;
+  using LayoutAtomQuant = decltype(compute_memory_reordering_atom<ElementMma, MmaAtomShape, ValueShuffle>());
+
+  // Returns the layout of the formatted narrow operand of shape (MN,K,L)
+  template <class ShapeMKL>
+  static auto get_layout_quant(ShapeMKL const& shape_mkl) {
+    return cute::tile_to_shape(LayoutAtomQuant{}, shape_mkl);
+  }
+};
+
+// Formats the narrow operand of CollectiveMainloop with layout layout_src into dst, and returns the value
+// to pass as its stride in the mainloop arguments.
+template <class CollectiveMainloop, class T, class LayoutSrc>
+auto format_mixed_dtype_operand(
+  T const* src,
+  LayoutSrc const& layout_src,
+  T* dst)
+{
+  using Format = MixedDtypeOperandFormat<CollectiveMainloop>;
+  static_assert(cute::is_same_v<T, typename Format::ElementQuant>, "Type mismatch");
+
+  auto const size_src = static_cast<size_t>(cute::size(layout_src));
+  if constexpr (Format::IsUnifiedEncoding) {
+    unified_encode_int4b(src, dst, size_src);
+  }
+  else {
+    cutlass::device_memory::copy_device_to_device(dst, src, size_src);
+  }
+
+  if constexpr (Format::IsReordered) {
+    typename Format::StrideQuant layout_dst = Format::get_layout_quant(cute::shape(layout_src));
+    reorder_tensor(dst, layout_src, layout_dst);
+    return layout_dst;
+  }
+  else {
+    return cute::stride(layout_src);
+  }
+}
+
+// Formats block_size scales of the narrow operand of CollectiveMainloop into dst.
+template <class CollectiveMainloop>
+bool format_mixed_dtype_scales(
+  typename UnderlyingElement<typename CollectiveMainloop::ElementScale>::type const* src,
+  typename CollectiveMainloop::ElementScale* dst,
+  size_t block_size)
+{
+  using Format = MixedDtypeOperandFormat<CollectiveMainloop>;
+  if constexpr (Format::IsPackedScale) {
+    using ElementScale = typename UnderlyingElement<typename Format::ElementScale>::type;
+    return pack_scale_fp8<ElementScale, typename Format::ElementQuant>(src, dst, block_size);
+  }
+  else {
+    cutlass::device_memory::copy_device_to_device(dst, src, block_size);
+    return true;
+  }
+}
+
 #undef CUDA_CHECK
 
 }  // namespace cutlass
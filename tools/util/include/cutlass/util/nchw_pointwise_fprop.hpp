@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Utilities for running pointwise fprop directly on NCHW tensors as a batched 3.x GEMM.
+
+    A 1x1, unit stride, unpadded fprop over packed NCHW tensors is, for every image n, the GEMM
+
+      Y[n](pq, k) = sum_c X[n](hw = pq, c) * W(k, c)
+
+    whose activation and output operands are spatial-major: the pixels of one channel are contiguous.
+    A 3.x GEMM with column-major A, C and D and a K-major (column-major) B therefore loads the NCHW
+    activation and stores the NCHW output directly, without the NCHW -> NHWC and NHWC -> NCHW
+    transposes (device_nchw_to_nhwc.h, device_nhwc_to_nchw.h) around an NHWC implicit GEMM conv.
+    The problem is described with the usual ConvProblemShape extents; the tensors are assumed packed
+    NCHW (NCDHW) for the activation and output, and packed KRSC for the filter.
+*/
+
+#pragma once
+
+#include "cute/layout.hpp"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/convnd_problem_shape.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Returns true if the fprop problem is pointwise, so that it maps onto a GEMM over NCHW tensors
+template <conv::Operator ConvOp, int NumSpatialDimensions>
+bool
+can_implement_nchw_pointwise_fprop(conv::ConvProblemShape<ConvOp, NumSpatialDimensions> const& problem_shape) {
+  static_assert(ConvOp == conv::Operator::kFprop, "Only fprop maps onto a GEMM over NCHW tensors.");
+  bool implementable = problem_shape.groups == 1;
+  for (int i = 0; i < NumSpatialDimensions; ++i) {
+    // filter extents [k,t,r,s,c] hold the spatial modes at [1, RankS]
+    implementable &= problem_shape.shape_B[i + 1] == 1;
+    implementable &= problem_shape.traversal_stride[i] == 1;
+    implementable &= problem_shape.lower_padding[i] == 0 && problem_shape.upper_padding[i] == 0;
+  }
+  return implementable;
+}
+
+/// GEMM problem shape (M,N,K,L) = (pixels per image, filters, channels, images)
+template <conv::Operator ConvOp, int NumSpatialDimensions>
+cute::Shape<int,int,int,int>
+make_nchw_pointwise_fprop_problem_shape(conv::ConvProblemShape<ConvOp, NumSpatialDimensions> const& problem_shape) {
+  constexpr int RankT = NumSpatialDimensions + 2;
+  int pixels = 1;
+  for (int i = 0; i < NumSpatialDimensions; ++i) {
+    pixels *= problem_shape.shape_C[i + 1];
+  }
+  return {pixels, problem_shape.shape_B[0], problem_shape.shape_B[RankT - 1], problem_shape.shape_A[0]};
+}
+
+/// Strides of the packed NCHW activation as GEMM operand A (M,K,L) = (pixels, channels, images)
+template <conv::Operator ConvOp, int NumSpatialDimensions>
+cute::Stride<cute::Int<1>, int64_t, int64_t>
+make_nchw_pointwise_fprop_stride_A(conv::ConvProblemShape<ConvOp, NumSpatialDimensions> const& problem_shape) {
+  auto [M, N, K, L] = make_nchw_pointwise_fprop_problem_shape(problem_shape);
+  return {cute::Int<1>{}, int64_t(M), int64_t(M) * K};
+}
+
+/// Strides of the packed KRSC filter as GEMM operand B (N,K,L) = (filters, channels, images)
+template <conv::Operator ConvOp, int NumSpatialDimensions>
+cute::Stride<int64_t, cute::Int<1>, int64_t>
+make_nchw_pointwise_fprop_stride_B(conv::ConvProblemShape<ConvOp, NumSpatialDimensions> const& problem_shape) {
+  auto [M, N, K, L] = make_nchw_pointwise_fprop_problem_shape(problem_shape);
+  // Every image shares the filter
+  return {int64_t(K), cute::Int<1>{}, int64_t(0)};
+}
+
+/// Strides of the packed NCHW output as GEMM operands C and D (M,N,L) = (pixels, filters, images)
+template <conv::Operator ConvOp, int NumSpatialDimensions>
+cute::Stride<cute::Int<1>, int64_t, int64_t>
+make_nchw_pointwise_fprop_stride_C(conv::ConvProblemShape<ConvOp, NumSpatialDimensions> const& problem_shape) {
+  auto [M, N, K, L] = make_nchw_pointwise_fprop_problem_shape(problem_shape);
+  return {cute::Int<1>{}, int64_t(M), int64_t(M) * N};
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,650 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Runtime compilation of CUTLASS kernels with NVRTC, cached on disk, and a CudaHostAdapter
+           launching the compiled kernels through the CUDA driver API.
+
+    The host side of a kernel (its Params and the device adapter building them) is compiled ahead of
+    time with CUTLASS_ENABLE_CUDA_HOST_ADAPTER set, so that none of the kernel's device code is
+    emitted into the binary. The device code is compiled on first use for the architecture of the
+    current device, and the resulting cubin is stored in a cache directory keyed by a hash of the
+    source, the compile options and the NVRTC version. Callers link NVRTC and the CUDA driver.
+*/
+
+#pragma once
+
+#include <cuda.h>
+#include <cuda_runtime.h>
+#include <nvrtc.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/trace.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace nvrtc {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Options of a runtime compilation
+struct CompileOptions {
+  /// Target architecture, e.g. "sm_90a". Queried from the current device when empty.
+  std::string arch;
+
+  /// Include directories, typically those of CUTLASS and of the CUDA toolkit (and CCCL)
+  std::vector<std::string> include_paths;
+
+  /// Preprocessor definitions, "NAME" or "NAME=VALUE"
+  std::vector<std::string> defines;
+
+  /// Further options passed to nvrtcCompileProgram() verbatim
+  std::vector<std::string> extra_options;
+
+  /// Directory of the cubin cache. Taken from the CUTLASS_NVRTC_CACHE_DIR environment variable when
+  /// empty; compiled modules are not cached if neither is set.
+  std::string cache_dir;
+};
+
+/// 64-bit FNV-1a hash, used to key the cache
+inline uint64_t
+fnv1a_hash(std::string const& str, uint64_t hash = 0xcbf29ce484222325ull) {
+  for (unsigned char c : str) {
+    hash = (hash ^ c) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+/// Returns the NVRTC architecture of a device, using the architecture-specific target ("sm_90a")
+/// for the architectures whose kernels rely on arch-specific features
+inline std::string
+query_device_arch(int device_id = 0) {
+  int major = 0;
+  int minor = 0;
+  if (cudaDeviceGetAttribute(&major, cudaDevAttrComputeCapabilityMajor, device_id) != cudaSuccess ||
+      cudaDeviceGetAttribute(&minor, cudaDevAttrComputeCapabilityMinor, device_id) != cudaSuccess) {
+    CUTLASS_TRACE_HOST("  cudaDeviceGetAttribute() failed to query the compute capability");
+    return std::string();
+  }
+  std::string arch = "sm_" + std::to_string(major * 10 + minor);
+  if (major >= 9) {
+    arch += "a";
+  }
+  return arch;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// A module compiled at runtime (or loaded from the cache) and loaded into the current context
+class CompiledModule {
+public:
+
+  CompiledModule() = default;
+  CompiledModule(CompiledModule const&) = delete;
+  CompiledModule& operator=(CompiledModule const&) = delete;
+
+  ~CompiledModule() {
+    if (module_ != nullptr) {
+      (void) cuModuleUnload(module_);
+    }
+  }
+
+  /// Compiles a translation unit and loads it. Name expressions (e.g.
+  /// "cutlass::device_kernel<GemmKernel>") name the kernels later retrieved with function();
+  /// they are resolved to the lowered names of their instantiations by NVRTC.
+  Status
+  compile(
+      std::string const& source,
+      std::vector<std::string> const& name_expressions,
+      CompileOptions const& options = {}) {
+
+    std::vector<std::string> opts = make_options_(options);
+    if (opts.empty()) {
+      return Status::kErrorInternal;
+    }
+
+    int nvrtc_major = 0;
+    int nvrtc_minor = 0;
+    nvrtcVersion(&nvrtc_major, &nvrtc_minor);
+
+    // Key of the cache: source, options, name expressions and NVRTC version
+    uint64_t key = fnv1a_hash(source);
+    for (auto const& opt : opts) {
+      key = fnv1a_hash(opt, fnv1a_hash(std::string(1, '\0'), key));
+    }
+    for (auto const& expr : name_expressions) {
+      key = fnv1a_hash(expr, fnv1a_hash(std::string(1, '\n'), key));
+    }
+    key = fnv1a_hash(std::to_string(nvrtc_major) + "." + std::to_string(nvrtc_minor), key);
+
+    std::string cache_dir = options.cache_dir;
+    if (cache_dir.empty()) {
+      char const* env = std::getenv("CUTLASS_NVRTC_CACHE_DIR");
+      cache_dir = env ? env : "";
+    }
+    std::string cache_path;
+    if (!cache_dir.empty()) {
+      char hex[17];
+      std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(key));
+      cache_path = cache_dir + "/cutlass_" + hex;
+    }
+
+    std::string cubin;
+    lowered_names_.clear();
+    from_cache_ = !cache_path.empty() && load_cache_(cache_path, name_expressions, cubin);
+
+    if (!from_cache_) {
+      Status status = compile_(source, name_expressions, opts, cubin);
+      if (status != Status::kSuccess) {
+        return status;
+      }
+      if (!cache_path.empty()) {
+        store_cache_(cache_path, cubin);
+      }
+    }
+
+    if (module_ != nullptr) {
+      (void) cuModuleUnload(module_);
+      module_ = nullptr;
+    }
+    CUresult result = cuModuleLoadData(&module_, cubin.data());
+    if (result != CUDA_SUCCESS) {
+      CUTLASS_TRACE_HOST("  cuModuleLoadData() returned error " << result);
+      module_ = nullptr;
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+  }
+
+  /// Returns the kernel of a name expression given to compile(), or nullptr
+  CUfunction
+  function(std::string const& name_expression) const {
+    auto it = lowered_names_.find(name_expression);
+    if (module_ == nullptr || it == lowered_names_.end()) {
+      return nullptr;
+    }
+    CUfunction function = nullptr;
+    CUresult result = cuModuleGetFunction(&function, module_, it->second.c_str());
+    if (result != CUDA_SUCCESS) {
+      CUTLASS_TRACE_HOST("  cuModuleGetFunction() returned error " << result);
+      return nullptr;
+    }
+    return function;
+  }
+
+  /// Copies the value of an extern "C" __device__ variable of the module to the host
+  Status
+  get_global(char const* name, void* value, size_t size) const {
+    CUdeviceptr ptr = 0;
+    size_t bytes = 0;
+    if (module_ == nullptr || cuModuleGetGlobal(&ptr, &bytes, module_, name) != CUDA_SUCCESS || bytes != size) {
+      CUTLASS_TRACE_HOST("  module has no global " << name << " of " << size << " bytes");
+      return Status::kErrorInternal;
+    }
+    return cuMemcpyDtoH(value, ptr, size) == CUDA_SUCCESS ? Status::kSuccess : Status::kErrorInternal;
+  }
+
+  /// Whether the last compile() was served by the cache
+  bool loaded_from_cache() const { return from_cache_; }
+
+  /// Compilation log of the last compile() that invoked NVRTC
+  std::string const& log() const { return log_; }
+
+private:
+
+  std::vector<std::string>
+  make_options_(CompileOptions const& options) const {
+    std::string arch = options.arch;
+    if (arch.empty()) {
+      int device_id = 0;
+      if (cudaGetDevice(&device_id) != cudaSuccess) {
+        return {};
+      }
+      arch = query_device_arch(device_id);
+      if (arch.empty()) {
+        return {};
+      }
+    }
+    std::vector<std::string> opts = {
+      "--gpu-architecture=" + arch,
+      "-std=c++17",
+      "--device-as-default-execution-space"
+    };
+    for (auto const& path : options.include_paths) {
+      opts.push_back("--include-path=" + path);
+    }
+    for (auto const& define : options.defines) {
+      opts.push_back("-D" + define);
+    }
+    opts.insert(opts.end(), options.extra_options.begin(), options.extra_options.end());
+    return opts;
+  }
+
+  Status
+  compile_(
+      std::string const& source,
+      std::vector<std::string> const& name_expressions,
+      std::vector<std::string> const& opts,
+      std::string& cubin) {
+
+    nvrtcProgram program;
+    nvrtcResult result = nvrtcCreateProgram(&program, source.c_str(), "cutlass_runtime.cu", 0, nullptr, nullptr);
+    if (result != NVRTC_SUCCESS) {
+      CUTLASS_TRACE_HOST("  nvrtcCreateProgram() returned error " << nvrtcGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+    for (auto const& expr : name_expressions) {
+      nvrtcAddNameExpression(program, expr.c_str());
+    }
+
+    std::vector<char const*> opt_ptrs;
+    for (auto const& opt : opts) {
+      opt_ptrs.push_back(opt.c_str());
+    }
+    nvrtcResult compile_result = nvrtcCompileProgram(program, static_cast<int>(opt_ptrs.size()), opt_ptrs.data());
+
+    size_t log_size = 0;
+    nvrtcGetProgramLogSize(program, &log_size);
+    log_.assign(log_size, '\0');
+    if (log_size > 1) {
+      nvrtcGetProgramLog(program, &log_[0]);
+    }
+
+    Status status = Status::kSuccess;
+    if (compile_result != NVRTC_SUCCESS) {
+      CUTLASS_TRACE_HOST("  nvrtcCompileProgram() returned error " << nvrtcGetErrorString(compile_result)
+          << "\n" << log_);
+      status = Status::kErrorInternal;
+    }
+
+    for (size_t i = 0; status == Status::kSuccess && i < name_expressions.size(); ++i) {
+      char const* lowered = nullptr;
+      if (nvrtcGetLoweredName(program, name_expressions[i].c_str(), &lowered) != NVRTC_SUCCESS) {
+        CUTLASS_TRACE_HOST("  nvrtcGetLoweredName() failed for " << name_expressions[i]);
+        status = Status::kErrorInternal;
+        break;
+      }
+      lowered_names_[name_expressions[i]] = lowered;
+    }
+
+    size_t cubin_size = 0;
+    if (status == Status::kSuccess && nvrtcGetCUBINSize(program, &cubin_size) == NVRTC_SUCCESS) {
+      cubin.resize(cubin_size);
+      if (nvrtcGetCUBIN(program, &cubin[0]) != NVRTC_SUCCESS) {
+        status = Status::kErrorInternal;
+      }
+    }
+    else {
+      status = Status::kErrorInternal;
+    }
+
+    nvrtcDestroyProgram(&program);
+    return status;
+  }
+
+  // The cache stores the cubin in <path>.cubin and the lowered names, one "expression\tname" per
+  // line, in <path>.names. Both are published by renaming a temporary file, so concurrent
+  // processes at worst compile the same module twice.
+  bool
+  load_cache_(std::string const& path, std::vector<std::string> const& name_expressions, std::string& cubin) {
+    std::ifstream names_file(path + ".names");
+    std::ifstream cubin_file(path + ".cubin", std::ios::binary);
+    if (!names_file || !cubin_file) {
+      return false;
+    }
+    std::string line;
+    while (std::getline(names_file, line)) {
+      auto tab = line.find('\t');
+      if (tab != std::string::npos) {
+        lowered_names_[line.substr(0, tab)] = line.substr(tab + 1);
+      }
+    }
+    for (auto const& expr : name_expressions) {
+      if (lowered_names_.find(expr) == lowered_names_.end()) {
+        lowered_names_.clear();
+        return false;
+      }
+    }
+    cubin.assign(std::istreambuf_iterator<char>(cubin_file), std::istreambuf_iterator<char>());
+    CUTLASS_TRACE_HOST("  loaded " << path << ".cubin from the cache");
+    return !cubin.empty();
+  }
+
+  void
+  store_cache_(std::string const& path, std::string const& cubin) const {
+    std::string suffix = ".tmp" + std::to_string(reinterpret_cast<uintptr_t>(this));
+    {
+      std::ofstream cubin_file(path + ".cubin" + suffix, std::ios::binary);
+      cubin_file.write(cubin.data(), static_cast<std::streamsize>(cubin.size()));
+      std::ofstream names_file(path + ".names" + suffix);
+      for (auto const& [expr, lowered] : lowered_names_) {
+        names_file << expr << '\t' << lowered << '\n';
+      }
+      if (!cubin_file || !names_file) {
+        CUTLASS_TRACE_HOST("  failed to write " << path << " to the cache");
+        std::remove((path + ".cubin" + suffix).c_str());
+        std::remove((path + ".names" + suffix).c_str());
+        return;
+      }
+    }
+    // The cubin goes first: a names file without its cubin is never read
+    std::rename((path + ".cubin" + suffix).c_str(), (path + ".cubin").c_str());
+    std::rename((path + ".names" + suffix).c_str(), (path + ".names").c_str());
+  }
+
+  CUmodule module_ = nullptr;
+  std::map<std::string, std::string> lowered_names_;
+  std::string log_;
+  bool from_cache_ = false;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// CudaHostAdapter launching kernels given as driver API functions, e.g. those of a CompiledModule.
+/// The dynamic shared memory limit of a kernel is raised on its first launch that needs it, since
+/// device adapters leave function attributes to the host adapter.
+class HostAdapter : public CudaHostAdapter {
+public:
+
+  /// Cluster dimensions, preferred cluster dimensions and the attributes of launch_attributes
+  static constexpr int kMaximumLaunchAttributeCount = 8;
+
+  HostAdapter() = default;
+  HostAdapter(HostAdapter const&) = delete;
+  HostAdapter& operator=(HostAdapter const&) = delete;
+
+  explicit HostAdapter(CUfunction kernel) {
+    add_kernel(kernel);
+  }
+
+  /// Appends a kernel, returning its index or -1 if the adapter is full
+  int32_t
+  add_kernel(CUfunction kernel) {
+    if (kernel == nullptr || kernel_count + 1 >= kMaximumKernelCount) {
+      return -1;
+    }
+    kernel_handles[kernel_count] = reinterpret_cast<void*>(kernel);
+    smem_limit_[kernel_count].store(0);
+    return kernel_count++;
+  }
+
+  Status
+  query_occupancy(
+      int32_t* device_sms,
+      int32_t* sm_occupancy,
+      int32_t kernel_index,
+      int32_t thread_count,
+      int32_t smem_size) const override {
+    CUfunction kernel = kernel_(kernel_index);
+    CUdevice device;
+    if (kernel == nullptr || cuCtxGetDevice(&device) != CUDA_SUCCESS ||
+        prepare_(kernel_index, static_cast<size_t>(smem_size), false) != Status::kSuccess) {
+      return Status::kErrorInternal;
+    }
+    int sms = 0;
+    int occupancy = 0;
+    if (cuDeviceGetAttribute(&sms, CU_DEVICE_ATTRIBUTE_MULTIPROCESSOR_COUNT, device) != CUDA_SUCCESS ||
+        cuOccupancyMaxActiveBlocksPerMultiprocessor(&occupancy, kernel, thread_count, smem_size) != CUDA_SUCCESS) {
+      return Status::kErrorInternal;
+    }
+    *device_sms = sms;
+    *sm_occupancy = occupancy;
+    return Status::kSuccess;
+  }
+
+  Status
+  launch(
+      dim3 const grid_dims,
+      dim3 const block_dims,
+      size_t const smem_size,
+      cudaStream_t cuda_stream,
+      void** kernel_params,
+      int32_t kernel_index) const override {
+    return launch_(grid_dims, dim3(0, 0, 0), dim3(0, 0, 0), block_dims, smem_size, cuda_stream, kernel_params, kernel_index);
+  }
+
+  Status
+  launch(
+      dim3 const grid_dims,
+      dim3 const cluster_dims,
+      dim3 const block_dims,
+      size_t const smem_size,
+      cudaStream_t cuda_stream,
+      void** kernel_params,
+      int32_t kernel_index) const override {
+    return launch_(grid_dims, cluster_dims, dim3(0, 0, 0), block_dims, smem_size, cuda_stream, kernel_params, kernel_index);
+  }
+
+  Status
+  launch(
+      dim3 const grid_dims,
+      dim3 const cluster_dims,
+      dim3 const fallback_cluster_dims,
+      dim3 const block_dims,
+      size_t const smem_size,
+      cudaStream_t cuda_stream,
+      void** kernel_params,
+      int32_t kernel_index) const override {
+    return launch_(grid_dims, cluster_dims, fallback_cluster_dims, block_dims, smem_size, cuda_stream, kernel_params, kernel_index);
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  CUresult
+  tensorMapEncodeIm2col(
+      CUtensorMap* tensorMap,
+      CUtensorMapDataType tensorDataType,
+      cuuint32_t tensorRank,
+      void* globalAddress,
+      const cuuint64_t* globalDim,
+      const cuuint64_t* globalStrides,
+      const int* pixelBoxLowerCorner,
+      const int* pixelBoxUpperCorner,
+      cuuint32_t channelsPerPixel,
+      cuuint32_t pixelsPerColumn,
+      const cuuint32_t* elementStrides,
+      CUtensorMapInterleave interleave,
+      CUtensorMapSwizzle swizzle,
+      CUtensorMapL2promotion l2Promotion,
+      CUtensorMapFloatOOBfill oobFill) const override {
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeIm2col)(
+        tensorMap, tensorDataType, tensorRank, globalAddress, globalDim, globalStrides,
+        pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel, pixelsPerColumn, elementStrides,
+        interleave, swizzle, l2Promotion, oobFill);
+  }
+
+  CUresult
+  tensorMapEncodeTiled(
+      CUtensorMap* tensorMap,
+      CUtensorMapDataType tensorDataType,
+      cuuint32_t tensorRank,
+      void* globalAddress,
+      const cuuint64_t* globalDim,
+      const cuuint64_t* globalStrides,
+      const cuuint32_t* boxDim,
+      const cuuint32_t* elementStrides,
+      CUtensorMapInterleave interleave,
+      CUtensorMapSwizzle swizzle,
+      CUtensorMapL2promotion l2Promotion,
+      CUtensorMapFloatOOBfill oobFill) const override {
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+        tensorMap, tensorDataType, tensorRank, globalAddress, globalDim, globalStrides,
+        boxDim, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+  }
+
+  CUresult
+  tensorMapReplaceAddress(CUtensorMap* tensorMap, void* globalAddress) const override {
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapReplaceAddress)(tensorMap, globalAddress);
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+protected:
+
+  Status
+  memsetDeviceImpl(
+      void* destination,
+      void const* fill_value,
+      size_t fill_size,
+      size_t count,
+      cudaStream_t stream) const override {
+    CUdeviceptr ptr = reinterpret_cast<CUdeviceptr>(destination);
+    CUstream cu_stream = reinterpret_cast<CUstream>(stream);
+    CUresult result = CUDA_ERROR_INVALID_VALUE;
+    if (fill_size == 1) {
+      result = cuMemsetD8Async(ptr, *static_cast<uint8_t const*>(fill_value), count, cu_stream);
+    }
+    else if (fill_size == 2) {
+      result = cuMemsetD16Async(ptr, *static_cast<uint16_t const*>(fill_value), count, cu_stream);
+    }
+    else if (fill_size == 4) {
+      result = cuMemsetD32Async(ptr, *static_cast<uint32_t const*>(fill_value), count, cu_stream);
+    }
+    if (result != CUDA_SUCCESS) {
+      CUTLASS_TRACE_HOST("  cuMemsetD" << fill_size * 8 << "Async() returned error " << result);
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+  }
+
+private:
+
+  CUfunction
+  kernel_(int32_t kernel_index) const {
+    if (kernel_index < 0 || kernel_index >= kernel_count) {
+      return nullptr;
+    }
+    return reinterpret_cast<CUfunction>(kernel_handles[kernel_index]);
+  }
+
+  // Raises the dynamic shared memory limit of a kernel (once per new maximum) and allows
+  // non-portable cluster sizes for cluster launches
+  Status
+  prepare_(int32_t kernel_index, size_t smem_size, bool cluster_launch) const {
+    CUfunction kernel = kernel_(kernel_index);
+    int limit = smem_limit_[kernel_index].load(std::memory_order_relaxed);
+    if (smem_size >= (48 << 10) && static_cast<int>(smem_size) > limit) {
+      CUresult result = cuFuncSetAttribute(kernel, CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES, static_cast<int>(smem_size));
+      if (result != CUDA_SUCCESS) {
+        CUTLASS_TRACE_HOST("  cuFuncSetAttribute() returned error " << result);
+        return Status::kErrorInternal;
+      }
+      smem_limit_[kernel_index].store(static_cast<int>(smem_size), std::memory_order_relaxed);
+    }
+    if (cluster_launch) {
+      (void) cuFuncSetAttribute(kernel, CU_FUNC_ATTRIBUTE_NON_PORTABLE_CLUSTER_SIZE_ALLOWED, 1);
+    }
+    return Status::kSuccess;
+  }
+
+  Status
+  launch_(
+      dim3 grid_dims,
+      dim3 cluster_dims,
+      dim3 fallback_cluster_dims,
+      dim3 block_dims,
+      size_t smem_size,
+      cudaStream_t cuda_stream,
+      void** kernel_params,
+      int32_t kernel_index) const {
+    CUfunction kernel = kernel_(kernel_index);
+    bool const cluster_launch = cluster_dims.x * cluster_dims.y * cluster_dims.z > 0;
+    if (kernel == nullptr || prepare_(kernel_index, smem_size, cluster_launch) != Status::kSuccess) {
+      return Status::kErrorInternal;
+    }
+
+    CUlaunchAttribute attrs[kMaximumLaunchAttributeCount];
+    unsigned int num_attrs = 0;
+    if (cluster_launch) {
+      bool const have_fallback = fallback_cluster_dims.x * fallback_cluster_dims.y * fallback_cluster_dims.z > 0;
+      dim3 const required = have_fallback ? fallback_cluster_dims : cluster_dims;
+      attrs[num_attrs].id = CU_LAUNCH_ATTRIBUTE_CLUSTER_DIMENSION;
+      attrs[num_attrs].value.clusterDim.x = required.x;
+      attrs[num_attrs].value.clusterDim.y = required.y;
+      attrs[num_attrs].value.clusterDim.z = required.z;
+      ++num_attrs;
+#if defined(CUDA_VERSION) && (CUDA_VERSION >= 12080)
+      if (have_fallback) {
+        attrs[num_attrs].id = CU_LAUNCH_ATTRIBUTE_PREFERRED_CLUSTER_DIMENSION;
+        attrs[num_attrs].value.preferredClusterDim.x = cluster_dims.x;
+        attrs[num_attrs].value.preferredClusterDim.y = cluster_dims.y;
+        attrs[num_attrs].value.preferredClusterDim.z = cluster_dims.z;
+        ++num_attrs;
+      }
+#endif
+    }
+#if defined(CUDA_HOST_ADAPTER_LAUNCH_ATTRIBUTES_ENABLED)
+    for (size_t i = 0; i < launch_attributes.size() && num_attrs < kMaximumLaunchAttributeCount; ++i) {
+      attrs[num_attrs++] = launch_attributes.data()[i];
+    }
+#endif
+
+    CUlaunchConfig config{};
+    config.gridDimX = grid_dims.x;
+    config.gridDimY = grid_dims.y;
+    config.gridDimZ = grid_dims.z;
+    config.blockDimX = block_dims.x;
+    config.blockDimY = block_dims.y;
+    config.blockDimZ = block_dims.z;
+    config.sharedMemBytes = static_cast<unsigned int>(smem_size);
+    config.hStream = reinterpret_cast<CUstream>(cuda_stream);
+    config.attrs = attrs;
+    config.numAttrs = num_attrs;
+
+    CUresult result = cuLaunchKernelEx(&config, kernel, kernel_params, nullptr);
+    if (result != CUDA_SUCCESS) {
+      CUTLASS_TRACE_HOST("  cuLaunchKernelEx() returned error " << result);
+      return Status::kErrorInternal;
+    }
+    return Status::kSuccess;
+  }
+
+  mutable std::atomic<int> smem_limit_[kMaximumKernelCount] = {};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace nvrtc
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,127 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host utilities for reporting the per-warp pipeline wait counters of a kernel.
+
+    Kernels must be compiled with CUTLASS_ENABLE_PIPELINE_INSTRUMENTATION defined, and launched
+    from the translation unit that registers the counters:
+
+      cutlass::DeviceAllocation<cutlass::PipelineWaitCounters> counters(cutlass::PipelineInstrumentationMaxWarps);
+      cutlass::pipeline_instrumentation_begin(counters.get());
+      // ... run the GEMM ...
+      std::vector<cutlass::PipelineWaitCounters> host(cutlass::PipelineInstrumentationMaxWarps);
+      cutlass::pipeline_instrumentation_end(host.data(), counters.get());
+      cutlass::summarize_pipeline_wait_counters(host).print(std::cout);
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+#include "cutlass/pipeline/pipeline_instrumentation.hpp"
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Pipeline waits of a kernel, per warp index and in total
+struct PipelineWaitSummary {
+  /// Warp indices which waited on a pipeline, and their counters
+  std::vector<int> warps;
+  std::vector<PipelineWaitCounters> counters;
+
+  /// Totals over all warps
+  PipelineWaitCounters total;
+
+  /// Fraction of the blocked cycles spent by consumers waiting on data: close to 1 for kernels
+  /// bound by loads, close to 0 for kernels bound by their consumers (MMA). This spans all
+  /// pipelines of the kernel; the per-warp counters tell mainloop and epilogue warps apart.
+  double consumer_wait_fraction() const {
+    double blocked = double(total.producer_wait_cycles) + double(total.consumer_wait_cycles);
+    return blocked > 0 ? double(total.consumer_wait_cycles) / blocked : 0;
+  }
+
+  void print(std::ostream& out) const {
+    out << "Pipeline waits: " << warps.size() << " warps\n"
+        << "  warp   producer cycles   waits  try fails   consumer cycles   waits  try fails\n";
+    for (size_t i = 0; i < warps.size(); ++i) {
+      auto const& c = counters[i];
+      out << "  " << std::setw(4) << warps[i]
+          << std::setw(18) << c.producer_wait_cycles
+          << std::setw(8) << c.producer_waits
+          << std::setw(11) << c.producer_try_acquire_failures
+          << std::setw(18) << c.consumer_wait_cycles
+          << std::setw(8) << c.consumer_waits
+          << std::setw(11) << c.consumer_try_wait_failures << "\n";
+    }
+    out << "  total"
+        << std::setw(17) << total.producer_wait_cycles
+        << std::setw(8) << total.producer_waits
+        << std::setw(11) << total.producer_try_acquire_failures
+        << std::setw(18) << total.consumer_wait_cycles
+        << std::setw(8) << total.consumer_waits
+        << std::setw(11) << total.consumer_try_wait_failures << "\n"
+        << std::fixed << std::setprecision(1)
+        << "  consumers waited for " << consumer_wait_fraction() * 100 << " % of blocked cycles ("
+        << (consumer_wait_fraction() > 0.5 ? "load-bound" : "consumer/MMA-bound") << ")\n";
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Summarizes host copies of the per-warp counters of a launch
+inline PipelineWaitSummary
+summarize_pipeline_wait_counters(std::vector<PipelineWaitCounters> const& counters) {
+  PipelineWaitSummary summary;
+  for (size_t warp = 0; warp < counters.size(); ++warp) {
+    auto const& c = counters[warp];
+    if (c.producer_waits == 0 && c.producer_try_acquire_failures == 0 &&
+        c.consumer_waits == 0 && c.consumer_try_wait_failures == 0) {
+      continue;
+    }
+    summary.warps.push_back(static_cast<int>(warp));
+    summary.counters.push_back(c);
+    summary.total.producer_wait_cycles += c.producer_wait_cycles;
+    summary.total.producer_waits += c.producer_waits;
+    summary.total.producer_try_acquire_failures += c.producer_try_acquire_failures;
+    summary.total.consumer_wait_cycles += c.consumer_wait_cycles;
+    summary.total.consumer_waits += c.consumer_waits;
+    summary.total.consumer_try_wait_failures += c.consumer_try_wait_failures;
+  }
+  return summary;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
@@ -0,0 +1,230 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Reference implementation for fused multi-head attention (forward) in device-side code.
+
+    Q and O are packed as [batch, seqlen_q, heads_q, head_dim], K and V as
+    [batch, seqlen_kv, heads_kv, head_dim], or as [pages, page_size, heads_kv, head_dim] when a page
+    table of [batch, ceil(seqlen_kv / page_size)] entries maps the keys of each sequence to pages.
+*/
+
+#pragma once
+
+#include <cmath>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/numeric_conversion.h"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace reference {
+namespace device {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace kernel {
+
+/// One thread block computes one query row of one head; the keys are visited in tiles of
+/// kBlockSize with an online softmax, so the scores never leave shared memory.
+template <
+  typename Element,
+  typename ElementOut,
+  typename ElementAccumulator,
+  int kBlockSize = 128,
+  int kMaxHeadDim = 256
+>
+__global__ void Attention(
+  int heads_q,
+  int heads_kv,
+  int seqlen_q,
+  int seqlen_kv,
+  int head_dim,
+  Element const *ptr_Q,
+  Element const *ptr_K,
+  Element const *ptr_V,
+  ElementOut *ptr_O,
+  ElementAccumulator *ptr_LSE,            /// optional, [batch, heads_q, seqlen_q]
+  ElementAccumulator scale,
+  bool causal,
+  int causal_offset,                      /// key j is visible to query i if j <= i + causal_offset
+  int const *page_table,                  /// optional
+  int page_size) {
+
+  static int const kElementsPerThread = kMaxHeadDim / kBlockSize;
+
+  __shared__ ElementAccumulator s_Q[kMaxHeadDim];
+  __shared__ ElementAccumulator s_P[kBlockSize];
+
+  int i = blockIdx.x;
+  int h = blockIdx.y;
+  int b = blockIdx.z;
+  int h_kv = h / (heads_q / heads_kv);
+  int pages_per_batch = page_table ? (seqlen_kv + page_size - 1) / page_size : 0;
+
+  NumericConverter<ElementAccumulator, Element> to_acc;
+  NumericConverter<ElementOut, ElementAccumulator> to_out;
+
+  int64_t offset_Q = ((int64_t(b) * seqlen_q + i) * heads_q + h) * head_dim;
+  for (int d = threadIdx.x; d < head_dim; d += kBlockSize) {
+    s_Q[d] = to_acc(ptr_Q[offset_Q + d]);
+  }
+
+  auto offset_KV = [&](int j) {
+    int64_t row = int64_t(b) * seqlen_kv + j;
+    if (page_table) {
+      row = int64_t(page_table[b * pages_per_batch + j / page_size]) * page_size + j % page_size;
+    }
+    return (row * heads_kv + h_kv) * head_dim;
+  };
+
+  int kv_end = seqlen_kv;
+  if (causal) {
+    kv_end = max(0, min(seqlen_kv, i + causal_offset + 1));
+  }
+
+  ElementAccumulator row_max = -INFINITY;
+  ElementAccumulator row_sum = 0;
+  ElementAccumulator acc[kElementsPerThread];
+  for (int e = 0; e < kElementsPerThread; ++e) {
+    acc[e] = 0;
+  }
+
+  __syncthreads();
+
+  for (int kv_begin = 0; kv_begin < kv_end; kv_begin += kBlockSize) {
+
+    int j = kv_begin + threadIdx.x;
+    ElementAccumulator score = -INFINITY;
+    if (j < kv_end) {
+      int64_t offset = offset_KV(j);
+      score = 0;
+      for (int d = 0; d < head_dim; ++d) {
+        score += s_Q[d] * to_acc(ptr_K[offset + d]);
+      }
+      score *= scale;
+    }
+    s_P[threadIdx.x] = score;
+
+    __syncthreads();
+
+    // Every thread rescales its own copy of the running max and sum
+    ElementAccumulator tile_max = row_max;
+    for (int k = 0; k < kBlockSize; ++k) {
+      tile_max = max(tile_max, s_P[k]);
+    }
+    ElementAccumulator correction = exp(row_max - tile_max);
+    row_max = tile_max;
+    row_sum *= correction;
+    for (int e = 0; e < kElementsPerThread; ++e) {
+      acc[e] *= correction;
+    }
+
+    for (int k = 0; k < kBlockSize && kv_begin + k < kv_end; ++k) {
+      ElementAccumulator p = exp(s_P[k] - row_max);
+      row_sum += p;
+      int64_t offset = offset_KV(kv_begin + k);
+      for (int e = 0; e < kElementsPerThread; ++e) {
+        int d = threadIdx.x + e * kBlockSize;
+        if (d < head_dim) {
+          acc[e] += p * to_acc(ptr_V[offset + d]);
+        }
+      }
+    }
+
+    __syncthreads();
+  }
+
+  // Rows without visible keys produce zeros
+  ElementAccumulator inv_sum = row_sum > 0 ? ElementAccumulator(1) / row_sum : ElementAccumulator(0);
+  for (int e = 0; e < kElementsPerThread; ++e) {
+    int d = threadIdx.x + e * kBlockSize;
+    if (d < head_dim) {
+      ptr_O[offset_Q + d] = to_out(acc[e] * inv_sum);
+    }
+  }
+
+  if (ptr_LSE && threadIdx.x == 0) {
+    ptr_LSE[(int64_t(b) * heads_q + h) * seqlen_q + i] = row_max + log(row_sum);
+  }
+}
+
+} // namespace kernel
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Computes O = softmax(scale * Q K^T) V, where a causal mask hides key j from query i
+/// unless j <= i + causal_offset
+template <
+  typename Element,
+  typename ElementOut,
+  typename ElementAccumulator = float
+>
+void Attention(
+  int batch_count,
+  int heads_q,
+  int heads_kv,
+  int seqlen_q,
+  int seqlen_kv,
+  int head_dim,
+  Element const *ptr_Q,
+  Element const *ptr_K,
+  Element const *ptr_V,
+  ElementOut *ptr_O,
+  ElementAccumulator *ptr_LSE = nullptr,
+  ElementAccumulator scale = 0,
+  bool causal = false,
+  int causal_offset = 0,
+  int const *page_table = nullptr,
+  int page_size = 0,
+  cudaStream_t stream = nullptr) {
+
+  int const kBlockSize = 128;
+
+  if (scale == ElementAccumulator(0)) {
+    scale = ElementAccumulator(1) / ElementAccumulator(std::sqrt(double(head_dim)));
+  }
+
+  dim3 block(kBlockSize);
+  dim3 grid(seqlen_q, heads_q, batch_count);
+
+  kernel::Attention<Element, ElementOut, ElementAccumulator, kBlockSize><<< grid, block, 0, stream >>>(
+    heads_q, heads_kv, seqlen_q, seqlen_kv, head_dim,
+    ptr_Q, ptr_K, ptr_V, ptr_O, ptr_LSE,
+    scale, causal, causal_offset, page_table, page_size);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace device
+} // namespace reference
+} // namespace cutlass
@@ -43,12 +43,57 @@
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
 
+#include <numeric>
+
 namespace cutlass {
 namespace reference {
 namespace device {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace detail {
+
+/// Pseudo-random subset of a GEMM's output tiles. CTA i of a sampled launch computes tile
+/// (i * stride + offset) % tile_count; stride is coprime with tile_count, so the tiles are distinct.
+struct GemmTileSample {
+  int count = 0;
+  int64_t stride = 1;
+  int64_t offset = 0;
+};
+
+/// Selects sample_tiles of tile_count output tiles. Returns an empty sample (compute every tile)
+/// when sample_tiles is not positive or covers the whole output.
+inline GemmTileSample make_gemm_tile_sample(int64_t tile_count, int sample_tiles, uint64_t seed) {
+
+  GemmTileSample sample;
+
+  if (sample_tiles <= 0 || tile_count <= sample_tiles) {
+    return sample;
+  }
+
+  // splitmix64 finalizer, so neighbouring seeds select unrelated tiles
+  uint64_t z = seed + 0x9e3779b97f4a7c15ull;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  z = z ^ (z >> 31);
+
+  // A stride near tile_count / phi spreads the sampled tiles evenly across rows and columns
+  int64_t stride = int64_t(double(tile_count) * 0.6180339887498949);
+  stride = (stride < 1) ? 1 : stride;
+  while (std::gcd(stride, tile_count) != 1) {
+    ++stride;
+  }
+
+  sample.count = sample_tiles;
+  sample.stride = stride;
+  sample.offset = int64_t(z % uint64_t(tile_count));
+  return sample;
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace kernel {
 
 /// Computes a general matrix product among matrices (tensors of rank=2) pointed to by TensorRef
@@ -88,7 +133,8 @@ __global__ void GemmComplex(
   int64_t batch_stride_A = 0,
   int64_t batch_stride_B = 0,
   int64_t batch_stride_C = 0,
-  int64_t batch_stride_D = 0) {
+  int64_t batch_stride_D = 0,
+  detail::GemmTileSample sample = detail::GemmTileSample()) {
 
   static_assert(
     LayoutA::kRank == 2 &&
@@ -101,9 +147,21 @@ __global__ void GemmComplex(
 
   ConvertOp convert_op;
   InnerProductOp inner_product_op;
-  
-  int row_block = (blockIdx.x * blockDim.x + threadIdx.x) * kMblock;
-  int col_block = (blockIdx.y * blockDim.y + threadIdx.y) * kNblock; 
+
+  int tile_m = blockIdx.x;
+  int tile_n = blockIdx.y;
+
+  // A sampled launch has one CTA per sampled tile along x
+  if (sample.count) {
+    int tiles_m = (M + blockDim.x * kMblock - 1) / (blockDim.x * kMblock);
+    int tiles_n = (N + blockDim.y * kNblock - 1) / (blockDim.y * kNblock);
+    int64_t tile = (int64_t(blockIdx.x) * sample.stride + sample.offset) % (int64_t(tiles_m) * tiles_n);
+    tile_m = int(tile % tiles_m);
+    tile_n = int(tile / tiles_m);
+  }
+
+  int row_block = (tile_m * blockDim.x + threadIdx.x) * kMblock;
+  int col_block = (tile_n * blockDim.y + threadIdx.y) * kNblock;
   int batch_idx = blockIdx.z;
 
   tensor_a.add_pointer_offset(batch_idx * batch_stride_A);
@@ -127,30 +185,34 @@ __global__ void GemmComplex(
     }
 
     for (int k_block = 0; k_block < K; ++k_block) {
-      CUTLASS_PRAGMA_UNROLL
-      for (int j = 0; j < kNblock; j++) {
-        CUTLASS_PRAGMA_UNROLL
-        for (int i = 0; i < kMblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
 
-          if (row < M && col < N) {
-            ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-            ElementB b = tensor_b.at(MatrixCoord(k_block, col));
+      // Load and convert each operand once per k rather than once per output element
+      ComputeType a_frag[kMblock];
+      ComputeType b_frag[kNblock];
 
-            ComputeType a_ik = ComputeType(a);
-            ComputeType b_kj = ComputeType(b);
-
-            if (transform_a == ComplexTransform::kConjugate) {
-              a_ik = conj(a_ik);
-            }
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < kMblock; i++) {
+        int row = row_block + i;
+        a_frag[i] = (row < M) ? ComputeType(ElementA(tensor_a.at(MatrixCoord(row, k_block)))) : ComputeType(0);
+        if (transform_a == ComplexTransform::kConjugate) {
+          a_frag[i] = conj(a_frag[i]);
+        }
+      }
 
-            if (transform_b == ComplexTransform::kConjugate) {
-              b_kj = conj(b_kj);
-            }
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < kNblock; j++) {
+        int col = col_block + j;
+        b_frag[j] = (col < N) ? ComputeType(ElementB(tensor_b.at(MatrixCoord(k_block, col)))) : ComputeType(0);
+        if (transform_b == ComplexTransform::kConjugate) {
+          b_frag[j] = conj(b_frag[j]);
+        }
+      }
 
-            accum[i][j] = inner_product_op(a_ik, b_kj,  accum[i][j]);
-          }
+      CUTLASS_PRAGMA_UNROLL
+      for (int j = 0; j < kNblock; j++) {
+        CUTLASS_PRAGMA_UNROLL
+        for (int i = 0; i < kMblock; i++) {
+          accum[i][j] = inner_product_op(a_frag[i], b_frag[j], accum[i][j]);
         }
       }
     }
@@ -195,6 +257,11 @@ __global__ void GemmComplex(
 /// accumulator type, so a function argument 'initial_accum' is exposed. Passing
 /// AccumulatorType(0) as the last function argument can be easier than naming all template
 /// arguments explicitly.
+///
+/// If sample_tiles is positive, only that many pseudo-randomly chosen output tiles (selected by
+/// sample_seed) of each batch are computed; elements of tensor_d outside them are not written.
+/// Initializing tensor_d with the result under test therefore limits a full-tensor comparison to
+/// the sampled tiles, at a fraction of the reference's cost for large problems.
 template <
   typename ElementA,
   typename LayoutA,
@@ -223,7 +290,9 @@ void GemmComplex(
   int64_t batch_stride_A = 0,
   int64_t batch_stride_B = 0,
   int64_t batch_stride_C = 0,
-  int64_t batch_stride_D = 0) {
+  int64_t batch_stride_D = 0,
+  int sample_tiles = 0,
+  uint64_t sample_seed = 0) {
 
   static_assert(
     LayoutA::kRank == 2 &&
@@ -240,6 +309,14 @@ void GemmComplex(
     batch_count % std::numeric_limits<uint16_t>::max()
   );
 
+  detail::GemmTileSample sample = detail::make_gemm_tile_sample(
+    int64_t(grid.x) * grid.y, sample_tiles, sample_seed);
+
+  if (sample.count) {
+    grid.x = sample.count;
+    grid.y = 1;
+  }
+
   if (grid.y <= std::numeric_limits<uint16_t>::max()) {
     kernel::GemmComplex<
       ElementA,
@@ -270,7 +347,8 @@ void GemmComplex(
       batch_stride_A,
       batch_stride_B,
       batch_stride_C,
-      batch_stride_D
+      batch_stride_D,
+      sample
     );
   } else {
     // Using bigger thread tile size
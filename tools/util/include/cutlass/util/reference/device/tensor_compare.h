@@ -34,10 +34,14 @@
 
 #pragma once
 // Standard Library includes
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
 #include <utility>
 
 // Cutlass includes
 #include "cutlass/cutlass.h"
+#include "cutlass/complex.h"
 #include "cutlass/relatively_equal.h"
 
 #include "cutlass/util/distribution.h"
@@ -50,6 +54,90 @@ namespace device {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Result of comparing two blocks element by element in one pass on the device
+struct BlockCompareSummary {
+
+  /// Maximum number of mismatching elements whose indices are recorded
+  static int const kMaxRecordedMismatches = 16;
+
+  /// Number of elements compared
+  unsigned long long capacity;
+
+  /// Number of elements which are not (relatively) equal
+  unsigned long long mismatch_count;
+
+  /// Index of the first mismatching element, or capacity if there is none
+  unsigned long long first_mismatch;
+
+  /// Largest absolute difference |a - b| over all elements
+  double max_abs_error;
+
+  /// Largest difference relative to |a| + |b|, or to nonzero_floor for values smaller than it
+  double max_rel_error;
+
+  /// Number of valid entries of mismatch_index
+  int recorded_mismatches;
+
+  /// Indices of up to kMaxRecordedMismatches mismatching elements, in increasing order. They are
+  /// the first mismatches if no more than kMaxRecordedMismatches elements differ.
+  unsigned long long mismatch_index[kMaxRecordedMismatches];
+
+  /// True if all elements compared equal
+  bool passed() const {
+    return mismatch_count == 0;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Converts an element to double for error statistics
+template <typename Element>
+CUTLASS_HOST_DEVICE
+double block_compare_to_double(Element x) {
+  if constexpr (std::is_arithmetic_v<Element>) {
+    return static_cast<double>(x);
+  }
+  else {
+    return static_cast<double>(static_cast<float>(x));
+  }
+}
+
+/// Converts the real part of a complex element to double
+template <typename T>
+CUTLASS_HOST_DEVICE
+double block_compare_to_double(complex<T> x) {
+  return block_compare_to_double(x.real());
+}
+
+/// Absolute difference of two elements and the sum of their magnitudes
+template <typename Element>
+CUTLASS_HOST_DEVICE
+void block_compare_error(Element a, Element b, double &diff, double &magnitude) {
+  double a_d = block_compare_to_double(a);
+  double b_d = block_compare_to_double(b);
+  diff = (a_d < b_d) ? (b_d - a_d) : (a_d - b_d);
+  magnitude = (a_d < 0 ? -a_d : a_d) + (b_d < 0 ? -b_d : b_d);
+}
+
+template <typename T>
+CUTLASS_HOST_DEVICE
+void block_compare_error(complex<T> a, complex<T> b, double &diff, double &magnitude) {
+  double a_re = block_compare_to_double(a.real());
+  double a_im = block_compare_to_double(a.imag());
+  double b_re = block_compare_to_double(b.real());
+  double b_im = block_compare_to_double(b.imag());
+  double d_re = a_re - b_re;
+  double d_im = a_im - b_im;
+  diff = std::sqrt(d_re * d_re + d_im * d_im);
+  magnitude = std::sqrt(a_re * a_re + a_im * a_im) + std::sqrt(b_re * b_re + b_im * b_im);
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace kernel {
 
 template <typename Element>
@@ -97,6 +185,94 @@ __global__ void BlockCompareRelativelyEqual(
   }
 }
 
+/// Compares two blocks and accumulates a BlockCompareSummary. Each thread reduces its
+/// grid-stride slice, each warp combines its threads' results, and one lane per warp updates
+/// the summary, so the global atomics scale with the number of warps rather than elements.
+/// blockDim.x must be a multiple of the warp size.
+template <typename Element>
+__global__ void BlockCompareSummarize(
+  BlockCompareSummary *summary,
+  Element const *ptr_A,
+  Element const *ptr_B,
+  size_t capacity,
+  bool relative,
+  Element epsilon,
+  Element nonzero_floor) {
+
+  double const floor = device::detail::block_compare_to_double(nonzero_floor);
+
+  unsigned long long mismatch_count = 0;
+  unsigned long long first_mismatch = capacity;
+  double max_abs_error = 0;
+  double max_rel_error = 0;
+
+  size_t idx = threadIdx.x + blockDim.x * blockIdx.x;
+
+  for (; idx < capacity; idx += gridDim.x * blockDim.x) {
+
+    Element a = cutlass::ReferenceFactory<Element>::get(ptr_A, idx);
+    Element b = cutlass::ReferenceFactory<Element>::get(ptr_B, idx);
+
+    double diff, magnitude;
+    device::detail::block_compare_error(a, b, diff, magnitude);
+
+    double rel = (diff == 0) ? 0 : diff / ((magnitude < floor) ? floor : magnitude);
+    max_abs_error = (diff > max_abs_error || diff != diff) ? diff : max_abs_error;
+    max_rel_error = (rel > max_rel_error || rel != rel) ? rel : max_rel_error;
+
+    bool equal;
+    if constexpr (is_complex<Element>::value) {
+      // No relatively equal comparison for complex numbers
+      equal = !(a != b);
+    }
+    else {
+      equal = relative ? relatively_equal(a, b, epsilon, nonzero_floor) : !(a != b);
+    }
+
+    if (!equal) {
+      if (!mismatch_count) {
+        first_mismatch = idx;
+      }
+      ++mismatch_count;
+
+      // Mismatches are expected to be rare, so only the recording itself is atomic
+      if (*reinterpret_cast<int volatile *>(&summary->recorded_mismatches) < BlockCompareSummary::kMaxRecordedMismatches) {
+        int slot = atomicAdd(&summary->recorded_mismatches, 1);
+        if (slot < BlockCompareSummary::kMaxRecordedMismatches) {
+          summary->mismatch_index[slot] = idx;
+        }
+      }
+    }
+  }
+
+  // Reduce across the warp
+  CUTLASS_PRAGMA_UNROLL
+  for (int offset = 16; offset > 0; offset /= 2) {
+    unsigned long long other_count = __shfl_xor_sync(0xffffffff, mismatch_count, offset);
+    unsigned long long other_first = __shfl_xor_sync(0xffffffff, first_mismatch, offset);
+    double other_abs = __shfl_xor_sync(0xffffffff, max_abs_error, offset);
+    double other_rel = __shfl_xor_sync(0xffffffff, max_rel_error, offset);
+
+    mismatch_count += other_count;
+    first_mismatch = (other_first < first_mismatch) ? other_first : first_mismatch;
+    max_abs_error = (other_abs > max_abs_error || other_abs != other_abs) ? other_abs : max_abs_error;
+    max_rel_error = (other_rel > max_rel_error || other_rel != other_rel) ? other_rel : max_rel_error;
+  }
+
+  if ((threadIdx.x % 32) == 0) {
+    if (mismatch_count) {
+      atomicAdd(&summary->mismatch_count, mismatch_count);
+      atomicMin(&summary->first_mismatch, first_mismatch);
+    }
+
+    // Non-negative doubles, and NaN above all, order like their bit patterns
+    atomicMax(reinterpret_cast<unsigned long long *>(&summary->max_abs_error),
+              static_cast<unsigned long long>(__double_as_longlong(max_abs_error)));
+    atomicMax(reinterpret_cast<unsigned long long *>(&summary->max_rel_error),
+              static_cast<unsigned long long>(__double_as_longlong(max_rel_error)));
+  }
+}
+
 } // namespace kernel
 
 
@@ -245,6 +421,103 @@ bool BlockCompareRelativelyEqual(
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Compares two blocks in one pass on the device and returns the mismatch count, the largest
+/// absolute and relative errors, and the indices of up to BlockCompareSummary::kMaxRecordedMismatches
+/// mismatching elements. Real elements are compared with relatively_equal() if relative is true;
+/// complex elements, and all elements otherwise, must be equal. Only the summary is copied to the host.
+template <typename Element>
+BlockCompareSummary BlockCompareSummarize(
+  Element const *ptr_A,
+  Element const *ptr_B,
+  size_t capacity,
+  bool relative,
+  Element epsilon = Element(),
+  Element nonzero_floor = Element(),
+  int grid_size = 0,
+  int block_size = 0,
+  cudaStream_t stream = nullptr) {
+
+  BlockCompareSummary summary{};
+  summary.capacity = capacity;
+  summary.first_mismatch = capacity;
+
+  BlockCompareSummary *device_summary = nullptr;
+
+  if (cudaMalloc((void **)&device_summary, sizeof(BlockCompareSummary)) != cudaSuccess) {
+    throw std::runtime_error("Failed to allocate device comparison summary.");
+  }
+
+  if (cudaMemcpy(
+    device_summary,
+    &summary,
+    sizeof(BlockCompareSummary),
+    cudaMemcpyHostToDevice) != cudaSuccess) {
+
+    cudaFree(device_summary);
+
+    throw std::runtime_error("Failed to copy comparison summary to device.");
+  }
+
+  if (!grid_size || !block_size) {
+
+    // if grid_size or block_size are zero, query occupancy using the CUDA Occupancy API
+    cudaError_t result = cudaOccupancyMaxPotentialBlockSize(
+      &grid_size,
+      &block_size,
+      reinterpret_cast<void const *>(kernel::BlockCompareSummarize<Element>));
+
+    if (result != cudaSuccess) {
+      cudaFree(device_summary);
+
+      throw std::runtime_error("Failed to query occupancy.");
+    }
+    // Limit block size. This has the effect of increasing the number of items processed by a
+    // single thread and reduces the impact of initialization overhead.
+    block_size = (block_size < 128 ? block_size : 128);
+  }
+
+  // The kernel reduces across full warps
+  block_size = (block_size + 31) / 32 * 32;
+
+  dim3 grid(grid_size, 1, 1);
+  dim3 block(block_size, 1, 1);
+
+  kernel::BlockCompareSummarize<Element><<< grid, block, 0, stream >>>(
+    device_summary,
+    ptr_A,
+    ptr_B,
+    capacity,
+    relative,
+    epsilon,
+    nonzero_floor
+  );
+
+  cudaStreamSynchronize(stream);
+
+  if (cudaMemcpy(
+    &summary,
+    device_summary,
+    sizeof(BlockCompareSummary),
+    cudaMemcpyDeviceToHost) != cudaSuccess) {
+
+    cudaFree(device_summary);
+
+    throw std::runtime_error("Failed to copy comparison summary from device.");
+  }
+
+  cudaFree(device_summary);
+
+  int recorded = (summary.recorded_mismatches < BlockCompareSummary::kMaxRecordedMismatches ?
+    summary.recorded_mismatches : BlockCompareSummary::kMaxRecordedMismatches);
+
+  summary.recorded_mismatches = recorded;
+  std::sort(summary.mismatch_index, summary.mismatch_index + recorded);
+
+  return summary;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 } // device
 } // reference
 } // cutlass
@@ -45,6 +45,7 @@
 #include <cmath>
 #include <type_traits>
 #include <cstdint>
+#include <algorithm>
 
 #endif
 
@@ -1988,6 +1989,380 @@ void BlockFillRandom(
 
 namespace detail {
 
+/// Returns true if a block fill of Element may be performed on whole 128-bit packed chunks
+template <typename Element>
+struct IsPackedFillElement {
+  static bool const value = (sizeof_bits<Element>::value <= 32) && !is_complex<Element>::value;
+};
+
+/// Describes the smallest run of densely packed elements spanning a whole number of 128-bit vectors
+template <typename Element>
+struct PackedFillChunk {
+
+  static int const kElementBits = sizeof_bits<Element>::value;
+
+  /// Bits of a chunk: the least common multiple of 128 and the element width
+  static int const kBits = 128 * (kElementBits / (kElementBits & -kElementBits));
+
+  /// Elements of a chunk
+  static int const kElements = kBits / kElementBits;
+
+  /// 32-bit words of a chunk
+  static int const kWords = kBits / 32;
+
+  /// 128-bit vectors of a chunk
+  static int const kVectors = kBits / 128;
+};
+
+/// Computes a random uniform distribution from a counter-based generator
+template <typename Element>
+struct PackedRandomUniformFunc {
+
+  using FloatType = typename RandomUniformFunc<Element>::FloatType;
+
+  using Params = typename RandomUniformFunc<Element>::Params;
+
+  /// Parameters object
+  Params params;
+
+  CUTLASS_DEVICE
+  PackedRandomUniformFunc(Params const &params): params(params) { }
+
+  /// Compute random value and advance the generator
+  CUTLASS_DEVICE
+  Element operator()(curandStatePhilox4_32_10_t *rng_state) const {
+
+    if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
+      if (params.pnan > 0 && (curand_uniform(rng_state) < (params.pnan))) {
+        return Element(NAN);
+      }
+    }
+
+    FloatType rnd = curand_uniform(rng_state);
+    rnd = params.max - params.range * rnd;
+
+    Element result;
+
+    if (params.int_scale >= 0) {
+      rnd = FloatType(std::llround(rnd * params.float_scale_up));
+      result = Element(rnd * params.float_scale_down);
+    }
+    else {
+      result = Element(rnd);
+    }
+
+    if (params.exclude_zero >=0 && result == Element(0.0)) {
+      if (rnd > FloatType(0)) {
+        rnd = std::min(params.max, rnd + FloatType(1));
+      } else {
+        rnd = std::max((params.max - params.range), rnd - FloatType(1));
+      }
+      result = Element(rnd);
+    }
+
+    return result;
+  }
+};
+
+/// Computes an exponent-uniform random distribution for UE8M0 scale factors from a counter-based generator
+template <>
+struct PackedRandomUniformFunc<float_ue8m0_t> {
+
+  using Element = float_ue8m0_t;
+  using FloatType = float;
+
+  using Params = typename RandomUniformFunc<Element>::Params;
+
+  /// Parameters object
+  Params params;
+
+  CUTLASS_DEVICE
+  PackedRandomUniformFunc(Params const &params): params(params) { }
+
+  /// Compute random value and advance the generator
+  CUTLASS_DEVICE
+  Element operator()(curandStatePhilox4_32_10_t *rng_state) const {
+
+    if constexpr (std::numeric_limits<Element>::has_quiet_NaN) {
+      if (params.pnan > 0 && (curand_uniform(rng_state) < (params.pnan))) {
+        return Element(NAN);
+      }
+    }
+
+    using CUTLASS_CMATH_NAMESPACE :: pow;
+
+    FloatType rnd = curand_uniform(rng_state);
+    int exponent_count = params.exp_range + 1;
+    int exponent_offset = int(rnd * FloatType(exponent_count));
+    exponent_offset = exponent_offset < exponent_count ? exponent_offset : exponent_count - 1;
+    FloatType exp = FloatType(params.exp_min + exponent_offset);
+    FloatType sf = FloatType(pow(FloatType(2), exp));
+
+    return Element(sf);
+  }
+};
+
+/// Computes a random Gaussian distribution from a counter-based generator
+template <typename Element>
+struct PackedRandomGaussianFunc {
+
+  using FloatType = typename RandomGaussianFunc<Element>::FloatType;
+
+  using Params = typename RandomGaussianFunc<Element>::Params;
+
+  /// Parameters object
+  Params params;
+
+  CUTLASS_DEVICE
+  PackedRandomGaussianFunc(Params const &params): params(params) { }
+
+  /// Compute random value and advance the generator
+  CUTLASS_DEVICE
+  Element operator()(curandStatePhilox4_32_10_t *rng_state) const {
+
+    FloatType rnd = curand_normal(rng_state);
+    rnd = params.mean + params.stddev * rnd;
+
+    Element result;
+    if (params.int_scale >= 0) {
+      rnd = FloatType(std::llround(rnd * params.float_scale_up));
+      result = Element(rnd * params.float_scale_down);
+    }
+    else {
+      result = Element(rnd);
+    }
+
+    if (params.exclude_zero >=0 && result == Element(0.0)) {
+      if (rnd > FloatType(0)) {
+        rnd += FloatType(1);
+      } else {
+        rnd -= FloatType(1);
+      }
+      result = Element(rnd);
+    }
+
+    return result;
+  }
+};
+
+} // namespace detail
+
+namespace kernel {
+
+/// Fills a block with random elements one packed chunk at a time. Each chunk draws from its own
+/// Philox subsequence, so the contents depend only on the seed and not on the launch configuration.
+/// The block must be 16B aligned.
+template <typename Element, typename Func>
+__global__ void BlockFillRandomPacked(
+  Element *ptr,
+  size_t capacity,
+  typename Func::Params params) {
+
+  using Chunk = device::detail::PackedFillChunk<Element>;
+
+  uint32_t const kElementMask = uint32_t((uint64_t(1) << Chunk::kElementBits) - 1);
+
+  Func func(params);
+
+  size_t full_chunks = capacity / Chunk::kElements;
+  size_t chunks = (capacity + Chunk::kElements - 1) / Chunk::kElements;
+
+  uint4 *vectors = reinterpret_cast<uint4 *>(ptr);
+
+  for (size_t chunk = threadIdx.x + blockIdx.x * blockDim.x; chunk < chunks; chunk += blockDim.x * gridDim.x) {
+
+    curandStatePhilox4_32_10_t rng_state;
+    curand_init(params.seed, chunk, 0, &rng_state);
+
+    size_t first = chunk * Chunk::kElements;
+
+    if (chunk < full_chunks) {
+
+      uint32_t words[Chunk::kWords];
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int w = 0; w < Chunk::kWords; ++w) {
+        words[w] = 0;
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int i = 0; i < Chunk::kElements; ++i) {
+        Element value = func(&rng_state);
+
+        uint32_t bits = 0;
+        memcpy(&bits, &value, sizeof(Element));
+        bits &= kElementMask;
+
+        int const bit_offset = i * Chunk::kElementBits;
+        int const word = bit_offset / 32;
+        int const shift = bit_offset % 32;
+
+        words[word] |= bits << shift;
+        if (shift + Chunk::kElementBits > 32) {
+          words[word + 1] |= bits >> (32 - shift);
+        }
+      }
+
+      CUTLASS_PRAGMA_UNROLL
+      for (int v = 0; v < Chunk::kVectors; ++v) {
+        vectors[chunk * Chunk::kVectors + v] =
+          make_uint4(words[4 * v], words[4 * v + 1], words[4 * v + 2], words[4 * v + 3]);
+      }
+    }
+    else {
+      // The partial last chunk is written element by element
+      for (size_t idx = first; idx < capacity; ++idx) {
+        ReferenceFactory<Element>::get(ptr, idx) = func(&rng_state);
+      }
+    }
+  }
+}
+
+} // namespace kernel
+
+namespace detail {
+
+/// Launches kernel::BlockFillRandomPacked
+template <typename Element, typename Func>
+void BlockFillRandomPacked(
+  Element *ptr,
+  size_t capacity,
+  typename Func::Params params,
+  cudaStream_t stream) {
+
+  int grid_size = 0;
+  int block_size = 0;
+
+  cudaError_t result = cudaOccupancyMaxPotentialBlockSize(
+    &grid_size,
+    &block_size,
+    reinterpret_cast<void const *>(kernel::BlockFillRandomPacked<Element, Func>));
+
+  if (result != cudaSuccess) {
+    throw std::runtime_error("Failed to query occupancy.");
+  }
+
+  // Do not launch more threads than there are chunks
+  size_t chunks = (capacity + PackedFillChunk<Element>::kElements - 1) / PackedFillChunk<Element>::kElements;
+  size_t max_grid_size = (chunks + block_size - 1) / block_size;
+  grid_size = int(std::min(size_t(grid_size), max_grid_size));
+
+  dim3 grid(grid_size, 1, 1);
+  dim3 block(block_size, 1, 1);
+
+  kernel::BlockFillRandomPacked<Element, Func><<< grid, block, 0, stream >>>(ptr, capacity, params);
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Fills a block with random values with a uniform random distribution, writing 128-bit vectors of
+/// packed elements. Elements wider than 32 bits, complex elements, and blocks which are not 16B
+/// aligned are filled by BlockFillRandomUniform(). The values differ from those of
+/// BlockFillRandomUniform() for the same seed.
+template <typename Element>
+void BlockFillRandomUniformPacked(
+  Element *ptr,
+  size_t capacity,
+  uint64_t seed,                          ///< seed for RNG
+  typename detail::UniformDistributionValueType<Element>::Type max,   ///< upper bound of distribution
+  typename detail::UniformDistributionValueType<Element>::Type min,   ///< lower bound for distribution
+  int bits = -1,                          ///< If non-negative, specifies number of fractional bits that
+                                          ///  are not truncated to zero. Permits reducing precision of
+                                          ///  data.
+  double pnan = 0,                        ///< Percentage of NaN elements.
+  cudaStream_t stream = nullptr) {
+
+  if constexpr (detail::IsPackedFillElement<Element>::value) {
+    if (reinterpret_cast<uintptr_t>(ptr) % 16 == 0) {
+      if (capacity) {
+        using Func = detail::PackedRandomUniformFunc<Element>;
+        typename Func::Params params(seed, max, min, bits, pnan);
+        detail::BlockFillRandomPacked<Element, Func>(ptr, capacity, params, stream);
+      }
+      return;
+    }
+  }
+
+  BlockFillRandomUniform<Element>(ptr, capacity, seed, max, min, bits, pnan, stream);
+}
+
+/// Fills a block with random values with a Gaussian distribution, writing 128-bit vectors of packed
+/// elements. Elements wider than 32 bits, complex elements, and blocks which are not 16B aligned
+/// are filled by BlockFillRandomGaussian(). The values differ from those of
+/// BlockFillRandomGaussian() for the same seed.
+template <typename Element>
+void BlockFillRandomGaussianPacked(
+  Element *ptr,
+  size_t capacity,
+  uint64_t seed,                              ///< seed for RNG
+  typename RealType<Element>::Type mean,      ///< Gaussian distribution's mean
+  typename RealType<Element>::Type stddev,    ///< Gaussian distribution's standard deviation
+  int bits = -1,                              ///< If non-negative, specifies number of fractional bits that
+                                              ///  are not truncated to zero. Permits reducing precision of
+                                              ///  data.
+  cudaStream_t stream = nullptr) {
+
+  if constexpr (detail::IsPackedFillElement<Element>::value) {
+    if (reinterpret_cast<uintptr_t>(ptr) % 16 == 0) {
+      if (capacity) {
+        using Func = detail::PackedRandomGaussianFunc<Element>;
+        typename Func::Params params(seed, mean, stddev, bits);
+        detail::BlockFillRandomPacked<Element, Func>(ptr, capacity, params, stream);
+      }
+      return;
+    }
+  }
+
+  BlockFillRandomGaussian<Element>(ptr, capacity, seed, mean, stddev, bits, stream);
+}
+
+/// Fills a block of data with random elements using the packed fills where possible
+template <
+  typename Element
+>
+void BlockFillRandomPacked(
+  Element *ptr,
+  size_t capacity,
+  uint64_t seed,
+  Distribution dist,
+  cudaStream_t stream = nullptr) {
+
+  using Real = typename RealType<Element>::Type;
+  using UniformReal = typename detail::UniformDistributionValueType<Element>::Type;
+
+  if (dist.kind == Distribution::Gaussian) {
+    BlockFillRandomGaussianPacked<Element>(
+      ptr,
+      capacity,
+      seed,
+      static_cast<Real>(dist.gaussian.mean),
+      static_cast<Real>(dist.gaussian.stddev),
+      dist.int_scale,
+      stream);
+  }
+  else if (dist.kind == Distribution::Uniform) {
+    BlockFillRandomUniformPacked<Element>(
+      ptr,
+      capacity,
+      seed,
+      static_cast<UniformReal>(dist.uniform.max),
+      static_cast<UniformReal>(dist.uniform.min),
+      dist.int_scale,
+      dist.uniform.pnan,
+      stream);
+  }
+  else {
+    BlockFillRandom<Element>(ptr, capacity, seed, dist, stream);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
 /// Computes a random Gaussian distribution
 template <
   typename Element,               ///< Element type
@@ -118,35 +118,48 @@ void compute_gemm(
   int const Mblock = 16;
   int const Nblock = 16;
 
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
-
+  // Output blocks are independent; each thread accumulates its own block.
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(2)
+#endif
   for (int row_block = 0; row_block < M; row_block += Mblock) {
     for (int col_block = 0; col_block < N; col_block += Nblock) {
 
+      ConvertOp convert_op;
+      InnerProductOp inner_product_op;
+
       ComputeType accum[Mblock][Nblock];
 
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
+      for (int i = 0; i < Mblock; i++) {
+        for (int j = 0; j < Nblock; j++) {
           accum[i][j] = initial_accum;
         }
       }
 
       for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
 
-            if (row < M && col < N) {
-              ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-              ElementB b = tensor_b.at(MatrixCoord(k_block, col));
+        // Convert each operand once per k rather than once per output element, so the
+        // outer product below is a branch-free loop over contiguous accumulators.
+        ComputeType a_frag[Mblock];
+        ComputeType b_frag[Nblock];
+
+        for (int i = 0; i < Mblock; i++) {
+          int row = row_block + i;
+          a_frag[i] = (row < M) ?
+            ComputeType(cast_if_scalar<ComputeType>(ElementA(tensor_a.at(MatrixCoord(row, k_block))))) :
+            ComputeType(0);
+        }
 
-              ComputeType compute_a(cast_if_scalar<ComputeType>(a));
-              ComputeType compute_b(cast_if_scalar<ComputeType>(b));
+        for (int j = 0; j < Nblock; j++) {
+          int col = col_block + j;
+          b_frag[j] = (col < N) ?
+            ComputeType(cast_if_scalar<ComputeType>(ElementB(tensor_b.at(MatrixCoord(k_block, col))))) :
+            ComputeType(0);
+        }
 
-              accum[i][j] = inner_product_op(compute_a, compute_b, accum[i][j]);
-            }
+        for (int i = 0; i < Mblock; i++) {
+          for (int j = 0; j < Nblock; j++) {
+            accum[i][j] = inner_product_op(a_frag[i], b_frag[j], accum[i][j]);
           }
         }
       }
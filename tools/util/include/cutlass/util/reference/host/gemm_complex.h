@@ -102,46 +102,66 @@ void GemmComplex(
   int const Mblock = 16;
   int const Nblock = 16;
 
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
-
+  // Output blocks of all batches are independent; each thread accumulates its own block.
+#if defined(_OPENMP)
+  #pragma omp parallel for collapse(3)
+#endif
   for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
 
     // Compute matrix product using blocks
     for (int row_block = 0; row_block < M; row_block += Mblock) {
       for (int col_block = 0; col_block < N; col_block += Nblock) {
 
+        ConvertOp convert_op;
+        InnerProductOp inner_product_op;
+
+        TensorRef<ElementA, LayoutA> batch_a = tensor_a;
+        TensorRef<ElementB, LayoutB> batch_b = tensor_b;
+        TensorRef<ElementC, LayoutC> batch_c = tensor_c;
+        TensorRef<ElementD, LayoutC> batch_d = tensor_d;
+
+        batch_a.add_pointer_offset(batch_idx * batch_stride_A);
+        batch_b.add_pointer_offset(batch_idx * batch_stride_B);
+        if (batch_c.data()) {
+          batch_c.add_pointer_offset(batch_idx * batch_stride_C);
+        }
+        batch_d.add_pointer_offset(batch_idx * batch_stride_D);
+
         ComputeType accum[Mblock][Nblock];
 
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
+        for (int i = 0; i < Mblock; i++) {
+          for (int j = 0; j < Nblock; j++) {
             accum[i][j] = initial_accum;
           }
         }
 
         for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
 
-              if (row < M && col < N) {
-                ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-                ElementB b = tensor_b.at(MatrixCoord(k_block, col));
+          // Convert and transform each operand once per k rather than once per output
+          // element, so the outer product below is a branch-free loop over contiguous
+          // accumulators.
+          ComputeType a_frag[Mblock];
+          ComputeType b_frag[Nblock];
 
-                ComputeType a_ik = ComputeType(a);
-                ComputeType b_kj = ComputeType(b);
-
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_ik = conj(a_ik);
-                }
+          for (int i = 0; i < Mblock; i++) {
+            int row = row_block + i;
+            a_frag[i] = (row < M) ? ComputeType(ElementA(batch_a.at(MatrixCoord(row, k_block)))) : ComputeType(0);
+            if (transform_a == ComplexTransform::kConjugate) {
+              a_frag[i] = conj(a_frag[i]);
+            }
+          }
 
-                if (transform_b == ComplexTransform::kConjugate) {
-                  b_kj = conj(b_kj);
-                }
+          for (int j = 0; j < Nblock; j++) {
+            int col = col_block + j;
+            b_frag[j] = (col < N) ? ComputeType(ElementB(batch_b.at(MatrixCoord(k_block, col)))) : ComputeType(0);
+            if (transform_b == ComplexTransform::kConjugate) {
+              b_frag[j] = conj(b_frag[j]);
+            }
+          }
 
-                accum[i][j] = inner_product_op(a_ik, b_kj,  accum[i][j]);
-              }
+          for (int i = 0; i < Mblock; i++) {
+            for (int j = 0; j < Nblock; j++) {
+              accum[i][j] = inner_product_op(a_frag[i], b_frag[j], accum[i][j]);
             }
           }
         }
@@ -155,24 +175,16 @@ void GemmComplex(
 
             if (row < M && col < N) {
               ScalarType epilog = alpha * ScalarType(accum[i][j]);
-              if(tensor_c.data()) {
-                epilog += beta * ScalarType(tensor_c.at(coord));
+              if(batch_c.data()) {
+                epilog += beta * ScalarType(batch_c.at(coord));
               }
-              tensor_d.at(coord) = convert_op(epilog);
+              batch_d.at(coord) = convert_op(epilog);
             }
           }
         }
 
       } // for (col_block)
     } // for (row_block)
-
-    tensor_a.add_pointer_offset(batch_stride_A);
-    tensor_b.add_pointer_offset(batch_stride_B);
-    if(tensor_c.data()) {
-      tensor_c.add_pointer_offset(batch_stride_C);
-    }
-    tensor_d.add_pointer_offset(batch_stride_D);
-
   } // for (batch_idx)
 }
 
@@ -0,0 +1,298 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host decoder of the sampled synclog mode, producing per-CTA timelines.
+
+    Kernels must be compiled with CUTLASS_ENABLE_SYNCLOG_SAMPLED defined:
+
+      cutlass::arch::SynclogSampleConfig config;
+      config.cta_stride = 16;                  // every 16th CTA
+      config.warp_mask = 0x3;                  // first two warps of each sampled CTA
+      cutlass::arch::synclog_set_sample_config(config);
+      // ... run the GEMM, which calls synclog_setup() before its launch ...
+      auto timelines = cutlass::synclog_read_timelines();
+      cutlass::synclog_print_timelines(timelines, std::cout);
+      cutlass::synclog_write_chrome_trace(timelines, trace_file);
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+#include <cuda_runtime.h>
+
+#include "cutlass/arch/synclog.hpp"
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// One decoded synclog record
+struct SynclogEvent {
+  uint32_t header = 0;
+  uint32_t line = 0;
+  /// %globaltimer value at the event, in nanoseconds
+  uint64_t time = 0;
+  uint32_t thread[3] = {0, 0, 0};
+  uint32_t block[3] = {0, 0, 0};
+  /// Event specific payload (shared memory address, phase, ...), see synclog_emit_*()
+  uint32_t num_args = 0;
+  uint32_t args[5] = {0, 0, 0, 0, 0};
+};
+
+/// The events retained for one sampled CTA, ordered by time
+struct SynclogCtaTimeline {
+  /// Linear index of the CTA in launch order
+  uint32_t cta = 0;
+  /// Number of events the CTA recorded, including the ones overwritten in its ring
+  uint64_t recorded = 0;
+  std::vector<SynclogEvent> events;
+
+  uint64_t overwritten() const { return recorded - events.size(); }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+struct SynclogEventInfo {
+  uint32_t header;
+  uint32_t length;
+  char const* name;
+};
+
+#if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+inline SynclogEventInfo const* synclog_event_info(uint32_t header) {
+  static SynclogEventInfo const infos[] = {
+    {arch::synclog_header_syncthreads, arch::synclog_length_syncthreads, "syncthreads"},
+    {arch::synclog_header_syncwarp, arch::synclog_length_syncwarp, "syncwarp"},
+    {arch::synclog_header_named_barrier_arrive_and_wait, arch::synclog_length_named_barrier_arrive_and_wait, "named_barrier_arrive_and_wait"},
+    {arch::synclog_header_named_barrier_arrive, arch::synclog_length_named_barrier_arrive, "named_barrier_arrive"},
+    {arch::synclog_header_cluster_barrier_init, arch::synclog_length_cluster_barrier_init, "cluster_barrier_init"},
+    {arch::synclog_header_cluster_barrier_wait, arch::synclog_length_cluster_barrier_wait, "cluster_barrier_wait"},
+    {arch::synclog_header_cluster_barrier_test_wait, arch::synclog_length_cluster_barrier_test_wait, "cluster_barrier_test_wait"},
+    {arch::synclog_header_cluster_barrier_try_wait, arch::synclog_length_cluster_barrier_try_wait, "cluster_barrier_try_wait"},
+    {arch::synclog_header_cluster_barrier_arrive_cluster, arch::synclog_length_cluster_barrier_arrive_cluster, "cluster_barrier_arrive_cluster"},
+    {arch::synclog_header_cluster_barrier_arrive, arch::synclog_length_cluster_barrier_arrive, "cluster_barrier_arrive"},
+    {arch::synclog_header_cluster_barrier_invalidate, arch::synclog_length_cluster_barrier_invalidate, "cluster_barrier_invalidate"},
+    {arch::synclog_header_cluster_transaction_barrier_arrive_and_expect_tx, arch::synclog_length_cluster_transaction_barrier_arrive_and_expect_tx, "cluster_transaction_barrier_arrive_and_expect_tx"},
+    {arch::synclog_header_cluster_transaction_barrier_arrive_and_expect_tx_cluster, arch::synclog_length_cluster_transaction_barrier_arrive_and_expect_tx_cluster, "cluster_transaction_barrier_arrive_and_expect_tx_cluster"},
+    {arch::synclog_header_cluster_transaction_barrier_expect_transaction, arch::synclog_length_cluster_transaction_barrier_expect_transaction, "cluster_transaction_barrier_expect_transaction"},
+    {arch::synclog_header_cluster_transaction_barrier_complete_transaction, arch::synclog_length_cluster_transaction_barrier_complete_transaction, "cluster_transaction_barrier_complete_transaction"},
+    {arch::synclog_header_fence_barrier_init, arch::synclog_length_fence_barrier_init, "fence_barrier_init"},
+    {arch::synclog_header_fence_view_async_shared, arch::synclog_length_fence_view_async_shared, "fence_view_async_shared"},
+    {arch::synclog_header_fence_view_shared, arch::synclog_length_fence_view_shared, "fence_view_shared"},
+    {arch::synclog_header_cp_async_wait, arch::synclog_length_cp_async_wait, "cp_async_wait"},
+    {arch::synclog_header_cp_async_wait_all, arch::synclog_length_cp_async_wait_all, "cp_async_wait_all"},
+    {arch::synclog_header_cp_async_fence, arch::synclog_length_cp_async_fence, "cp_async_fence"},
+    {arch::synclog_header_cp_async_nan, arch::synclog_length_cp_async_nan, "cp_async_nan"},
+    {arch::synclog_header_cp_async_zfill, arch::synclog_length_cp_async_zfill, "cp_async_zfill"},
+    {arch::synclog_header_cp_async, arch::synclog_length_cp_async, "cp_async"},
+    {arch::synclog_header_tma_load, arch::synclog_length_tma_load, "tma_load"},
+    {arch::synclog_header_tma_store, arch::synclog_length_tma_store, "tma_store"},
+    {arch::synclog_header_tma_store_arrive, arch::synclog_length_tma_store_arrive, "tma_store_arrive"},
+    {arch::synclog_header_tma_store_wait, arch::synclog_length_tma_store_wait, "tma_store_wait"},
+    {arch::synclog_header_warpgroup_arrive, arch::synclog_length_warpgroup_arrive, "warpgroup_arrive"},
+    {arch::synclog_header_warpgroup_wait, arch::synclog_length_warpgroup_wait, "warpgroup_wait"},
+    {arch::synclog_header_warpgroup_commit_batch, arch::synclog_length_warpgroup_commit_batch, "warpgroup_commit_batch"},
+    {arch::synclog_header_wgmma_reg_smem, arch::synclog_length_wgmma_reg_smem, "wgmma_reg_smem"},
+    {arch::synclog_header_wgmma_smem_smem, arch::synclog_length_wgmma_smem_smem, "wgmma_smem_smem"},
+    {arch::synclog_header_cpasync_barrier_arrive, arch::synclog_length_cpasync_barrier_arrive, "cpasync_barrier_arrive"},
+  };
+  for (auto const& info : infos) {
+    if (info.header == header) {
+      return &info;
+    }
+  }
+  return nullptr;
+}
+#endif // defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+
+/// Earliest event over all timelines, which the printed times are relative to
+inline uint64_t synclog_start_time(std::vector<SynclogCtaTimeline> const& timelines) {
+  uint64_t start = ~uint64_t(0);
+  for (auto const& timeline : timelines) {
+    if (!timeline.events.empty()) {
+      start = std::min(start, timeline.events.front().time);
+    }
+  }
+  return start;
+}
+
+} // namespace detail
+
+/// Name of a synclog event as printed by synclog_print()
+inline char const* synclog_event_name(uint32_t header) {
+#if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+  if (auto const* info = detail::synclog_event_info(header)) {
+    return info->name;
+  }
+#else
+  CUTLASS_UNUSED(header);
+#endif
+  return "unknown";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Copies the rings of the last sampled launch on `device` back to the host and decodes them.
+/// Returns no timelines unless kernels were built with CUTLASS_ENABLE_SYNCLOG_SAMPLED.
+inline std::vector<SynclogCtaTimeline> synclog_read_timelines(int device = 0) {
+  std::vector<SynclogCtaTimeline> timelines;
+#if defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+  uint32_t* buf = nullptr;
+  {
+    std::scoped_lock lock(arch::synclog_mutex);
+    if (device < 0 || static_cast<size_t>(device) >= arch::synclog_buf_list.size()) {
+      return timelines;
+    }
+    buf = arch::synclog_buf_list[device];
+  }
+
+  int orig_device = 0;
+  if (cudaGetDevice(&orig_device) != cudaSuccess || cudaSetDevice(device) != cudaSuccess) {
+    return timelines;
+  }
+
+  uint32_t config[arch::synclog_sample_counters] = {};
+  std::vector<uint32_t> counters;
+  std::vector<uint32_t> rings;
+  bool copied = cudaMemcpy(config, buf, sizeof(config), cudaMemcpyDeviceToHost) == cudaSuccess;
+  uint32_t cta_stride = config[arch::synclog_sample_config_cta_stride];
+  uint32_t max_ctas = config[arch::synclog_sample_config_max_ctas];
+  uint32_t ring_slots = config[arch::synclog_sample_config_ring_slots];
+  if (copied && max_ctas > 0) {
+    counters.resize(max_ctas);
+    rings.resize(size_t(max_ctas) * ring_slots * arch::synclog_sample_slot_words);
+    copied = cudaMemcpy(counters.data(), buf + arch::synclog_sample_counters,
+        counters.size() * sizeof(uint32_t), cudaMemcpyDeviceToHost) == cudaSuccess &&
+      cudaMemcpy(rings.data(), buf + arch::synclog_sample_ring_base(max_ctas),
+        rings.size() * sizeof(uint32_t), cudaMemcpyDeviceToHost) == cudaSuccess;
+  }
+  (void)cudaSetDevice(orig_device);
+  if (!copied) {
+    return timelines;
+  }
+
+  for (uint32_t ring = 0; ring < max_ctas; ++ring) {
+    if (counters[ring] == 0) {
+      continue;
+    }
+    SynclogCtaTimeline timeline;
+    timeline.cta = ring * cta_stride;
+    timeline.recorded = counters[ring];
+    uint32_t retained = std::min(counters[ring], ring_slots);
+    for (uint32_t slot = 0; slot < retained; ++slot) {
+      uint32_t const* record =
+        rings.data() + (size_t(ring) * ring_slots + slot) * arch::synclog_sample_slot_words;
+      auto const* info = detail::synclog_event_info(record[0]);
+      if (info == nullptr) {
+        continue;
+      }
+      SynclogEvent event;
+      event.header = record[0];
+      event.line = record[1];
+      event.time = uint64_t(record[3]) << 32 | record[2];
+      std::copy(record + 4, record + 7, event.thread);
+      std::copy(record + 7, record + 10, event.block);
+      event.num_args = info->length - arch::synclog_length_prefix;
+      std::copy(record + arch::synclog_length_prefix, record + info->length, event.args);
+      timeline.events.push_back(event);
+    }
+    std::sort(timeline.events.begin(), timeline.events.end(),
+      [] (SynclogEvent const& a, SynclogEvent const& b) { return a.time < b.time; });
+    timelines.push_back(std::move(timeline));
+  }
+#else
+  CUTLASS_UNUSED(device);
+#endif // defined(CUTLASS_ENABLE_SYNCLOG_SAMPLED)
+  return timelines;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Prints one timeline per CTA, with times relative to the earliest event of all CTAs
+inline void synclog_print_timelines(std::vector<SynclogCtaTimeline> const& timelines, std::ostream& out) {
+  uint64_t start = detail::synclog_start_time(timelines);
+  for (auto const& timeline : timelines) {
+    out << "synclog CTA " << timeline.cta;
+    if (!timeline.events.empty()) {
+      auto const& block = timeline.events.front().block;
+      out << " (block=" << block[0] << "," << block[1] << "," << block[2] << ")";
+    }
+    out << ": " << timeline.events.size() << " events";
+    if (timeline.overwritten() > 0) {
+      out << ", " << timeline.overwritten() << " older events overwritten";
+    }
+    out << "\n      time(ns)  warp  line  event\n";
+    for (auto const& event : timeline.events) {
+      out << "  " << std::setw(12) << (event.time - start)
+          << std::setw(6) << event.thread[0] / 32
+          << std::setw(6) << event.line
+          << "  " << synclog_event_name(event.header);
+      for (uint32_t i = 0; i < event.num_args; ++i) {
+        out << " " << event.args[i];
+      }
+      out << "\n";
+    }
+  }
+}
+
+/// Writes the timelines in the Chrome trace event format (chrome://tracing, Perfetto), with one
+/// process per CTA and one thread per warp
+inline void synclog_write_chrome_trace(std::vector<SynclogCtaTimeline> const& timelines, std::ostream& out) {
+  uint64_t start = detail::synclog_start_time(timelines);
+  out << "{\"traceEvents\":[";
+  char const* sep = "\n";
+  for (auto const& timeline : timelines) {
+    for (auto const& event : timeline.events) {
+      out << sep << "{\"name\":\"" << synclog_event_name(event.header)
+          << "\",\"ph\":\"i\",\"s\":\"t\",\"pid\":" << timeline.cta
+          << ",\"tid\":" << event.thread[0] / 32
+          << ",\"ts\":" << std::fixed << std::setprecision(3) << double(event.time - start) / 1000.0
+          << ",\"args\":{\"line\":" << event.line;
+      for (uint32_t i = 0; i < event.num_args; ++i) {
+        out << ",\"arg" << i << "\":" << event.args[i];
+      }
+      out << "}}";
+      sep = ",\n";
+    }
+  }
+  out << "\n]}\n";
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
@@ -0,0 +1,182 @@
+/***************************************************************************************************
+ * Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host utilities for collecting and summarizing the per-CTA work accounting of persistent
+           tile schedulers.
+
+    Kernels must be compiled with CUTLASS_ENABLE_TILE_SCHEDULER_TELEMETRY defined and launched with
+    the telemetry member of the scheduler arguments pointing to a buffer with one entry per CTA:
+
+      cutlass::DeviceAllocation<cutlass::gemm::kernel::TileSchedulerTelemetry> telemetry(grid_size);
+      cutlass::reset_tile_scheduler_telemetry(telemetry.get(), telemetry.size());
+      arguments.scheduler.telemetry = telemetry.get();
+      // ... initialize and run the GEMM ...
+      cutlass::summarize_tile_scheduler_telemetry(telemetry.get(), telemetry.size()).print(std::cout);
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+#include "cutlass/gemm/kernel/tile_scheduler_telemetry.hpp"
+#include "cutlass/util/device_memory.h"
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Distribution of the work of a persistent kernel over its CTAs
+struct TileSchedulerTelemetrySummary {
+  /// Number of CTAs of the grid
+  size_t ctas = 0;
+  /// Number of CTAs which recorded work
+  size_t active_ctas = 0;
+  /// Number of distinct SMs on which the active CTAs ran
+  size_t sms = 0;
+
+  /// Work units per active CTA
+  uint32_t min_tiles = 0;
+  uint32_t max_tiles = 0;
+  double mean_tiles = 0;
+
+  /// K tiles per active CTA
+  uint32_t min_k_tiles = 0;
+  uint32_t max_k_tiles = 0;
+  double mean_k_tiles = 0;
+
+  /// Time (ns) from the start of the first to the end of the last CTA
+  uint64_t span_ns = 0;
+  /// Busy time (ns) per active CTA
+  uint64_t min_busy_ns = 0;
+  uint64_t max_busy_ns = 0;
+  double mean_busy_ns = 0;
+  /// Time (ns) from the median to the last CTA running out of work
+  uint64_t tail_ns = 0;
+
+  /// Ratio of the largest to the average number of K tiles per CTA, 1 for a perfect balance
+  double k_tile_imbalance() const {
+    return mean_k_tiles > 0 ? max_k_tiles / mean_k_tiles : 0;
+  }
+
+  /// Fraction of the kernel span the CTAs were busy on average
+  double efficiency() const {
+    return span_ns > 0 ? mean_busy_ns / span_ns : 0;
+  }
+
+  void print(std::ostream& out) const {
+    out << "Tile scheduler telemetry: " << active_ctas << " of " << ctas
+        << " CTAs recorded work on " << sms << " SMs\n"
+        << std::fixed << std::setprecision(2)
+        << "  tiles   min " << min_tiles << "  mean " << mean_tiles << "  max " << max_tiles << "\n"
+        << "  k tiles min " << min_k_tiles << "  mean " << mean_k_tiles << "  max " << max_k_tiles
+        << "  imbalance " << k_tile_imbalance() << "\n"
+        << "  busy    min " << min_busy_ns * 1e-3 << " us  mean " << mean_busy_ns * 1e-3
+        << " us  max " << max_busy_ns * 1e-3 << " us\n"
+        << "  span " << span_ns * 1e-3 << " us  tail " << tail_ns * 1e-3
+        << " us  efficiency " << efficiency() * 100 << " %\n";
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Initializes a device buffer of per-CTA telemetry entries before a launch
+inline void
+reset_tile_scheduler_telemetry(gemm::kernel::TileSchedulerTelemetry* device_ptr, size_t count) {
+  std::vector<gemm::kernel::TileSchedulerTelemetry> host(count);
+  device_memory::copy_to_device(device_ptr, host.data(), count);
+}
+
+/// Summarizes host copies of the per-CTA telemetry entries of a launch
+inline TileSchedulerTelemetrySummary
+summarize_tile_scheduler_telemetry(std::vector<gemm::kernel::TileSchedulerTelemetry> const& entries) {
+  TileSchedulerTelemetrySummary summary;
+  summary.ctas = entries.size();
+
+  std::vector<gemm::kernel::TileSchedulerTelemetry> active;
+  for (auto const& entry : entries) {
+    if (entry.end_time != 0 && entry.start_time <= entry.end_time) {
+      active.push_back(entry);
+    }
+  }
+  summary.active_ctas = active.size();
+  if (active.empty()) {
+    return summary;
+  }
+
+  std::vector<uint32_t> sm_ids;
+  std::vector<uint64_t> end_times;
+  uint64_t first_start = active.front().start_time;
+  summary.min_tiles = summary.max_tiles = active.front().tiles;
+  summary.min_k_tiles = summary.max_k_tiles = active.front().k_tiles;
+  summary.min_busy_ns = summary.max_busy_ns = active.front().end_time - active.front().start_time;
+  for (auto const& entry : active) {
+    uint64_t busy = entry.end_time - entry.start_time;
+    summary.min_tiles = std::min(summary.min_tiles, entry.tiles);
+    summary.max_tiles = std::max(summary.max_tiles, entry.tiles);
+    summary.mean_tiles += entry.tiles;
+    summary.min_k_tiles = std::min(summary.min_k_tiles, entry.k_tiles);
+    summary.max_k_tiles = std::max(summary.max_k_tiles, entry.k_tiles);
+    summary.mean_k_tiles += entry.k_tiles;
+    summary.min_busy_ns = std::min(summary.min_busy_ns, busy);
+    summary.max_busy_ns = std::max(summary.max_busy_ns, busy);
+    summary.mean_busy_ns += static_cast<double>(busy);
+    first_start = std::min(first_start, entry.start_time);
+    sm_ids.push_back(entry.sm_id);
+    end_times.push_back(entry.end_time);
+  }
+  summary.mean_tiles /= active.size();
+  summary.mean_k_tiles /= active.size();
+  summary.mean_busy_ns /= active.size();
+
+  std::sort(sm_ids.begin(), sm_ids.end());
+  summary.sms = static_cast<size_t>(std::unique(sm_ids.begin(), sm_ids.end()) - sm_ids.begin());
+
+  std::sort(end_times.begin(), end_times.end());
+  summary.span_ns = end_times.back() - first_start;
+  summary.tail_ns = end_times.back() - end_times[end_times.size() / 2];
+  return summary;
+}
+
+/// Copies the per-CTA telemetry entries of a launch to the host and summarizes them
+inline TileSchedulerTelemetrySummary
+summarize_tile_scheduler_telemetry(gemm::kernel::TileSchedulerTelemetry const* device_ptr, size_t count) {
+  std::vector<gemm::kernel::TileSchedulerTelemetry> host(count);
+  device_memory::copy_to_host(host.data(), device_ptr, count);
+  return summarize_tile_scheduler_telemetry(host);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass